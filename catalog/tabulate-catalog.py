@@ -1,14 +1,14 @@
 # /star-tracker     rev. 06022025       preston mavady
 # ----------------------------------------------------------
 # Takes in a star catalog, outputs a binned version with
-# a bin resolution of 0.1 degrees (as an EEPROM flash-ready
+# a bin resolution of 0.05 degrees (as an EEPROM flash-ready
 # bytestream)
 
 # Pseudocode:
 
 # 1. CONVERT CATALOG TO UNIT VECTORS: 
 # catalog is stored as ID, RA, DEC, Vmag in a 4 column csv
-# generate unit vectors (ignore Vmag)
+# generate unit vectors (Vmag is kept for the brightness LUT)
     # append ID  |  X  |  Y  | Z  to a 4 column csv
 
 # 2. GENERATE A LIST OF ALL PAIRWISE ANGLES:
@@ -18,9 +18,11 @@
         # calculate the angle between them
         # ignore lines that are empty/wrong format
             # append ID1  |  ID2  | angle to a 3-column csv
+# pack every pair into tab_cat as [index1][index2][angle (uint16)],
+# 4 bytes per pair, sorted by angle
 
-# 3. CREATE A BINNED LIST OF PAIRWISE ANGLES (BIN RESOLUTION 0.1deg):
-# we are using 840 bins (0–84° range with 0.1° resolution)
+# 3. CREATE A BINNED LIST OF PAIRWISE ANGLES (BIN RESOLUTION 0.05deg):
+# we are using 1680 bins (0–84° range with 0.05° resolution)
 # any angles greater than 84 will be ignored
 # for each bin
     # collect [index1, index2] pairs
@@ -41,12 +43,43 @@
         # 2 bytes per pair: [ID1, ID2]
 
 # print out how many bytes long the bytestream is.
+
+# 6. GENERATE K-VECTOR ANGLE INDEX
+# sort every pair by angle (no binning), then fit a line through the
+# sorted angles: k[j] counts the pairs at or below the line at slot j,
+# so any [lo, hi] angle query finds its start/end slots in O(1)
+#
+# 7. GENERATE TRIANGLE INDEX
+# every star triangle whose three sides fit the camera FOV, vertices
+# labelled by side length, sorted by the longest side so one range
+# lookup finds the candidates for an image triangle
+#
+# 8. GENERATE GEOMETRIC HASH
+# key every star on pairs of its nearest-neighbour angles, quantized to
+# HASH_CELL; each star goes in every cell its patterns +/- HASH_TOL
+# touch, so the solver finds it with a single probe per pattern
+#
+# 9. GENERATE NEIGHBOUR ADJACENCY
+# for every star, the stars within the camera FOV of it and their angles
+# (mdeg), sorted by index, in compressed-sparse-row form: "is B a
+# neighbour of A, and at what angle" is a binary search over A's row
+#
+# 10. GENERATE ANGLE MATRIX (optional, --angle-matrix)
+# every pair's angle in one uint16 table read as angle[a][b]: the full
+# 256 x 256 square (128 KB), the upper triangle packed row by row when
+# flash is tight (64 KB), or off
 # ----------------------------------------------------------
 
+import argparse
 import numpy as np
 import csv
 import os
 
+parser = argparse.ArgumentParser(description="Tabulate the star catalog into solver tables.")
+parser.add_argument("--angle-matrix", choices=("full", "packed", "off"), default="full",
+                    help="layout of catalog_angle_matrix.c (default: full 256 x 256)")
+args = parser.parse_args()
+
 c_code_output_dir = "c_code"
 os.makedirs(c_code_output_dir, exist_ok=True)
 
@@ -58,10 +91,41 @@ binned_file = '4_binned_catalog.csv'
 memory_map_file = "5_eeprom_memory_map.txt"
 
 # Defines for binning section
-BIN_COUNT = 840
-BIN_WIDTH = 0.1
+# (the solver walks every bin within its angle tolerance, so BIN_WIDTH can
+#  shrink for less vote noise; BIN_COUNT follows to keep the 84 deg ceiling)
+MAX_ANGLE = 84.0
+BIN_WIDTH = 0.05
+BIN_COUNT = int(round(MAX_ANGLE / BIN_WIDTH))
+BIN_WIDTH_MDEG = int(round(BIN_WIDTH * 1000))
 PAIR_SIZE = 2
 
+# Defines for k-vector section
+PAIR_ANGLE_LSB_MDEG = 2             # packed pair angles, 2 mdeg steps (84 deg fits a uint16)
+KVECTOR_EPS = 0.5                   # half an LSB of slack at each end of the fit line
+
+# Defines for the triangle index (gvtri.c): no triangle wider than the
+# camera FOV can appear in one frame
+TRI_MAX_SIDE = 46.0                 # deg; diagonal of the 40 x 22.5 deg FOV, rounded up
+
+# Defines for the geometric hash (gvhash.c)
+HASH_CELL_MDEG = 200                # cell edge of the (d1, d2) grid
+HASH_TOL_MDEG = 100                 # pattern error each star is filed against
+HASH_SIZE = 2048                    # buckets, power of two
+HASH_NN = 4                         # neighbours a pattern is drawn from
+
+# Defines for the neighbour adjacency (gvalg.c second round): the same
+# FOV bound as the triangles, angles in whole mdeg
+ADJ_MAX_ANGLE = TRI_MAX_SIDE
+
+# Defines for on-device pair tabulation (gvpairs.c): angle = 2*asin(c/2)
+# for chord c = |u - v|, sampled up to the chord of MAX_ANGLE
+CHORD_LUT_SIZE = 512                # linear interpolation error < 0.05 mdeg
+CHORD_LUT_MAX = 2 * np.sin(np.radians(MAX_ANGLE) / 2)
+
+# Emitted headers are shared with the host (C++) tools
+C_EXTERN_OPEN = "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n"
+C_EXTERN_CLOSE = "#ifdef __cplusplus\n}\n#endif\n\n"
+
 # Defines for memory-mapping section
 EEPROM_ADDR = "0x50"
 EEPROM_LINE_WIDTH = 8
@@ -80,19 +144,21 @@ def radec_to_unit_vector(ra_deg, dec_deg):
     return np.array([x, y, z])
 
 unit_vectors = []
+hip_to_vmag = {}
 with open(catalog_file, 'r') as f:
     reader = csv.reader(f)
     next(reader)
     for row in reader:
         if len(row) < 4:
             continue
-        hip_str, ra_str, dec_str, _ = row
+        hip_str, ra_str, dec_str, vmag_str = row
         try:
             hip = int(hip_str)
             ra = float(ra_str)
             dec = float(dec_str)
             vec = radec_to_unit_vector(ra, dec)
             unit_vectors.append((hip, vec))
+            hip_to_vmag[hip] = float(vmag_str)
         except ValueError:
             continue
 
@@ -115,14 +181,23 @@ xyz_c_file = os.path.join(c_code_output_dir, "catalog_xyz.c")
 with open(xyz_c_file, 'w') as cf:
     cf.write(f"// catalog_xyz.c - Auto-generated unit vector catalog\n")
     cf.write(f"// Each row: {{ HIP_ID, x, y, z }}\n\n")
-    cf.write(f"#define CATALOG_SIZE {len(unit_vectors)}\n")
-    cf.write(f"double catalog_xyz[CATALOG_SIZE][4] = {{\n")
+    cf.write(f"#include \"catalog_xyz.h\"\n\n")
+    cf.write(f"const gv_real cat[CATALOG_SIZE][4] = {{\n")
     for hip, vec in unit_vectors:
         x, y, z = vec
         index = hip_to_index[hip]
         cf.write(f"    {{ {index}, {x:.8f}, {y:.8f}, {z:.8f} }},\n")
     cf.write("};\n")
-print(f"    ...Wrote catalog_xyz.c with {len(unit_vectors)} entries.")
+
+with open(os.path.join(c_code_output_dir, "catalog_xyz.h"), 'w') as hf:
+    hf.write("#ifndef CATALOG_XYZ_H\n#define CATALOG_XYZ_H\n\n")
+    hf.write("#include \"gv_real.h\"\n\n")
+    hf.write(C_EXTERN_OPEN)
+    hf.write(f"#define CATALOG_SIZE {len(unit_vectors)}\n")
+    hf.write("extern const gv_real cat[CATALOG_SIZE][4];\n\n")
+    hf.write(C_EXTERN_CLOSE)
+    hf.write("#endif\n")
+print(f"    ...Wrote catalog_xyz.c/.h with {len(unit_vectors)} entries.")
 
 
 # --------------------------------------------------------
@@ -146,18 +221,36 @@ with open(angle_file, 'w', newline='') as csvf:
         writer.writerow([id1, id2, f"{angle:.6f}"])
 print(f"\n    ...Wrote {len(angle_data)} pairwise angles to '{angle_file}'.")
 
+# ── PACK EVERY PAIR AS A 4-BYTE catalog_pair_t, SORTED BY ANGLE
+# (catalog indices instead of HIP IDs; the k-vector in STEP 7 indexes
+# this same table)
+packed_pairs = sorted(
+    (int(round(angle * 1000 / PAIR_ANGLE_LSB_MDEG)), hip_to_index[hip1], hip_to_index[hip2])
+    for hip1, hip2, angle in angle_data
+)
+if packed_pairs and packed_pairs[-1][0] > 0xFFFF:
+    raise ValueError("Packed pair angles must fit a uint16; raise PAIR_ANGLE_LSB_MDEG.")
+
 # ── WRITE OUT A C-READY file (tab_cat.c)
 c_file = os.path.join(c_code_output_dir, "tab_cat.c")
 with open(c_file, 'w') as cf:
-    # 1) define N_PAIRS
     cf.write(f"// Automatically generated on {__import__('datetime').datetime.now().strftime('%Y-%m-%d')}\n")
-    cf.write(f"#include <stddef.h>\n\n")
-    cf.write(f"#define N_PAIRS {len(angle_data)}\n\n")
-    cf.write(f"double pairs[{len(angle_data)}][3] = {{\n")
-    # 2) emit each (ID1, ID2, Angle) as a C initializer
-    for idx1, idx2, angle in angle_data:
-        cf.write(f"    {{ {idx1}, {idx2}, {angle:.6f} }},\n")
+    cf.write(f"// Each row: {{ index1, index2, angle / CATALOG_PAIR_ANGLE_LSB_MDEG }}, ascending angle\n")
+    cf.write(f"#include \"tab_cat.h\"\n\n")
+    cf.write(f"const catalog_pair_t tab_cat[N_PAIRS] = {{\n")
+    for y, idx1, idx2 in packed_pairs:
+        cf.write(f"    {{ {idx1}, {idx2}, {y} }},\n")
     cf.write("};\n")
+
+with open(os.path.join(c_code_output_dir, "tab_cat.h"), 'w') as hf:
+    hf.write("#ifndef TAB_CAT_H\n#define TAB_CAT_H\n\n")
+    hf.write("#include \"catalog_luts.h\"\n\n")
+    hf.write(C_EXTERN_OPEN)
+    hf.write("// every catalog pair within the binned range, sorted by angle\n")
+    hf.write(f"#define N_PAIRS {len(packed_pairs)}\n")
+    hf.write("extern const catalog_pair_t tab_cat[N_PAIRS];\n\n")
+    hf.write(C_EXTERN_CLOSE)
+    hf.write("#endif\n")
 print(f"    ...Wrote C array to '{c_file}'.")
 
 # Track discarded angles
@@ -169,7 +262,7 @@ print(f"    ...Discarded {discarded_pairs} pairwise angles (>84°).")
 print(f"    ...Kept {len(angle_data)} pairwise angles.")
 
 # --------------------------------------------------------
-# STEP 3: Create a Binned List of All Pairwise Angles (0.1deg)
+# STEP 3: Create a Binned List of All Pairwise Angles (BIN_WIDTH)
 # --------------------------------------------------------
 binned = [[] for _ in range(BIN_COUNT)]
 for hip1, hip2, angle in angle_data:
@@ -249,18 +342,38 @@ for idx, (hip, vec) in enumerate(unit_vectors):
 # ---------- Write catalog_luts.h ----------
 with open(os.path.join(c_code_output_dir, "catalog_luts.h"), 'w') as f:
     f.write("#ifndef CATALOG_LUTS_H\n#define CATALOG_LUTS_H\n\n")
-    f.write("#include <stdint.h>\n\n")
+    f.write("#include <stddef.h>\n#include <stdint.h>\n#include \"gv_real.h\"\n\n")
+    f.write(C_EXTERN_OPEN)
     f.write("extern const uint8_t catalog[];\n")
-    f.write("extern const uint16_t index_to_hip_ID_lut[];\n")
+    f.write("extern const uint32_t index_to_hip_ID_lut[];\n")
+    f.write("extern const int16_t index_to_vmag_lut[];   // V magnitude x 100\n")
     f.write("extern const uint16_t bin_angle_to_address_lut[];\n")
     f.write("extern const size_t index_count;\n")
     f.write("extern const size_t bin_count;\n\n")
+    f.write("// packed catalog pair: two catalog indices + their angle\n")
+    f.write("typedef struct {\n")
+    f.write("    uint8_t a;\n")
+    f.write("    uint8_t b;\n")
+    f.write(f"    uint16_t angle;   // in units of CATALOG_PAIR_ANGLE_LSB_MDEG\n")
+    f.write("} catalog_pair_t;\n\n")
+    f.write(f"#define CATALOG_PAIR_ANGLE_LSB_MDEG {PAIR_ANGLE_LSB_MDEG}\n\n")
+    f.write("// angular width of one bytestream bin\n")
+    f.write(f"#define CATALOG_BIN_WIDTH_MDEG {BIN_WIDTH_MDEG}\n\n")
+    f.write("// widest pair angle the catalog tables hold\n")
+    f.write(f"#define CATALOG_MAX_ANGLE_MDEG {int(round(MAX_ANGLE * 1000))}\n\n")
+    f.write("// chord -> angle: chord_to_mdeg_lut[k] is the angle (mdeg) of two unit\n")
+    f.write("// vectors k * CHORD_LUT_MAX / CHORD_LUT_SIZE apart; CHORD_LUT_MAX is the\n")
+    f.write("// chord of CATALOG_MAX_ANGLE_MDEG\n")
+    f.write(f"#define CHORD_LUT_SIZE {CHORD_LUT_SIZE}\n")
+    f.write(f"#define CHORD_LUT_MAX {CHORD_LUT_MAX:.9f}\n")
+    f.write("extern const gv_real chord_to_mdeg_lut[CHORD_LUT_SIZE + 1];\n\n")
+    f.write(C_EXTERN_CLOSE)
     f.write("#endif // CATALOG_LUTS_H\n")
 
 # ---------- Write catalog_luts.c ----------
 with open(os.path.join(c_code_output_dir, "catalog_luts.c"), 'w') as f:
     f.write("// catalog_luts.c - LUT data for star tracker catalog\n\n")
-    f.write("#include <stdint.h>\n\n")
+    f.write("#include \"catalog_luts.h\"\n\n")
 
     # catalog[]
     f.write("const uint8_t catalog[] = {\n")
@@ -274,7 +387,8 @@ with open(os.path.join(c_code_output_dir, "catalog_luts.c"), 'w') as f:
     f.write("};\n\n")
 
     # index_to_hip_ID_lut[]
-    f.write("const uint16_t index_to_hip_ID_lut[] = {\n    ")
+    # HIP IDs run past 0xFFFF, so this table is 32-bit
+    f.write("const uint32_t index_to_hip_ID_lut[] = {\n    ")
     for i, hip in enumerate(index_to_hip_lut):
         f.write(f"0x{hip:04X}")
         if i != len(index_to_hip_lut) - 1:
@@ -284,6 +398,16 @@ with open(os.path.join(c_code_output_dir, "catalog_luts.c"), 'w') as f:
     f.write("\n};\n")
     f.write(f"const size_t index_count = sizeof(index_to_hip_ID_lut) / sizeof(index_to_hip_ID_lut[0]);\n\n")
 
+    # index_to_vmag_lut[] (centimagnitudes, for brightness-ranked selection)
+    f.write("const int16_t index_to_vmag_lut[] = {\n    ")
+    for i, (hip, _) in enumerate(unit_vectors):
+        f.write(f"{int(round(hip_to_vmag[hip] * 100))}")
+        if i != len(unit_vectors) - 1:
+            f.write(", ")
+        if (i + 1) % 12 == 0:
+            f.write("\n    ")
+    f.write("\n};\n\n")
+
     # bin_angle_to_address_lut[]
     f.write("const uint16_t bin_angle_to_address_lut[] = {\n    ")
     for i, addr in enumerate(bin_angle_to_address_lut):
@@ -293,14 +417,27 @@ with open(os.path.join(c_code_output_dir, "catalog_luts.c"), 'w') as f:
         if (i + 1) % 8 == 0:
             f.write("\n    ")
     f.write("\n};\n")
-    f.write(f"const size_t bin_count = sizeof(bin_angle_to_address_lut) / sizeof(bin_angle_to_address_lut[0]);\n")
+    f.write(f"const size_t bin_count = sizeof(bin_angle_to_address_lut) / sizeof(bin_angle_to_address_lut[0]);\n\n")
+
+    # chord_to_mdeg_lut[]
+    f.write("const gv_real chord_to_mdeg_lut[CHORD_LUT_SIZE + 1] = {\n    ")
+    for k in range(CHORD_LUT_SIZE + 1):
+        chord = k * CHORD_LUT_MAX / CHORD_LUT_SIZE
+        f.write(f"{np.degrees(2 * np.arcsin(chord / 2)) * 1000:.4f}")
+        if k != CHORD_LUT_SIZE:
+            f.write(", ")
+        if (k + 1) % 8 == 0:
+            f.write("\n    ")
+    f.write("\n};\n")
 
 # 2. Write catalog_bytestream.h/.c
 with open(os.path.join(c_code_output_dir, "catalog_bytestream.h"), 'w') as f:
     f.write("#ifndef CATALOG_BYTESTREAM_H\n#define CATALOG_BYTESTREAM_H\n\n")
-    f.write("#include <stdint.h>\n\n")
+    f.write("#include <stddef.h>\n#include <stdint.h>\n\n")
+    f.write(C_EXTERN_OPEN)
     f.write("extern const uint8_t catalog_bytestream[];\n")
     f.write("extern const size_t bytestream_len;\n\n")
+    f.write(C_EXTERN_CLOSE)
     f.write("#endif // CATALOG_BYTESTREAM_H\n")
 
 # ----- write catalog_bytestream.c -----
@@ -311,7 +448,8 @@ bin_angle_to_address_lut = []
 
 address_counter = 0
 with open(os.path.join(c_code_output_dir, "catalog_bytestream.c"), 'w') as f:
-    f.write("// AUTO-GENERATED BINARY CATALOG\n\n")
+    f.write("// AUTO-GENERATED BINARY CATALOG\n")
+    f.write("#include <stddef.h>\n#include <stdint.h>\n\n")
     f.write("const uint8_t catalog_bytestream[] = {\n")
 
     for bin_index, contents in enumerate(binned):
@@ -332,16 +470,327 @@ with open(os.path.join(c_code_output_dir, "catalog_bytestream.c"), 'w') as f:
 
     f.write("};\n\n")
 
-    # Write the LUT
-    f.write("const uint16_t bin_angle_to_address_lut[] = {\n")
-    for i, addr in enumerate(bin_angle_to_address_lut):
-        f.write(f"  0x{addr:04X},")
-        if (i + 1) % 8 == 0:
-            f.write("\n")
+    # (bin_angle_to_address_lut itself lives in catalog_luts.c)
+    f.write("const size_t bytestream_len = sizeof(catalog_bytestream);\n")
+
+# --------------------------------------------------------
+# STEP 7: Generate k-Vector Angle Index
+# --------------------------------------------------------
+# built over tab_cat's packed_pairs, which are already sorted by angle
+kv_n = len(packed_pairs)
+if kv_n > 0xFFFF:
+    raise ValueError("k-vector entries must fit the uint16 k table.")
+kv_y = [y for y, _, _ in packed_pairs]
+
+# line z(j) = m*j + q runs from just below the smallest angle (j = 0)
+# to just above the largest (j = n-1)
+kv_m = (kv_y[-1] - kv_y[0] + 2 * KVECTOR_EPS) / (kv_n - 1)
+kv_q = kv_y[0] - KVECTOR_EPS
+kv_k = []
+count = 0
+for j in range(kv_n):
+    z = kv_m * j + kv_q
+    while count < kv_n and kv_y[count] <= z:
+        count += 1
+    kv_k.append(count)
+
+with open(os.path.join(c_code_output_dir, "catalog_kvector.h"), 'w') as f:
+    f.write("#ifndef CATALOG_KVECTOR_H\n#define CATALOG_KVECTOR_H\n\n")
+    f.write("#include <stdint.h>\n#include \"tab_cat.h\"\n\n")
+    f.write(C_EXTERN_OPEN)
+    f.write("// k-vector angle index over tab_cat[] (sorted by angle):\n")
+    f.write("// kvector_k[j] = number of pairs with angle <= KVECTOR_M * j + KVECTOR_Q\n")
+    f.write("#define KVECTOR_N N_PAIRS\n")
+    f.write(f"#define KVECTOR_M {kv_m:.9f}\n")
+    f.write(f"#define KVECTOR_Q {kv_q:.9f}\n\n")
+    f.write("extern const uint16_t kvector_k[KVECTOR_N];\n\n")
+    f.write(C_EXTERN_CLOSE)
+    f.write("#endif // CATALOG_KVECTOR_H\n")
+
+with open(os.path.join(c_code_output_dir, "catalog_kvector.c"), 'w') as f:
+    f.write("// AUTO-GENERATED K-VECTOR ANGLE INDEX\n")
+    f.write("#include \"catalog_kvector.h\"\n\n")
+    f.write("const uint16_t kvector_k[KVECTOR_N] = {\n    ")
+    for i, k in enumerate(kv_k):
+        f.write(f"{k}")
+        if i != kv_n - 1:
+            f.write(", ")
+        if (i + 1) % 12 == 0:
+            f.write("\n    ")
     f.write("\n};\n")
-    
+print(f"\n    ...Wrote k-vector index over {kv_n} pairs (m = {kv_m:.6f}).")
+
+# --------------------------------------------------------
+# STEP 8: Generate Triangle Index
+# --------------------------------------------------------
+# vertices are labelled by their sides so an image triangle maps onto a
+# catalog one without trying permutations: a-b is the longest side, b-c
+# the middle one, c-a the shortest
+tri_angle = {}
+tri_nbrs = [set() for _ in unit_vectors]
+for hip1, hip2, angle in angle_data:
+    if angle <= TRI_MAX_SIDE:
+        i, j = hip_to_index[hip1], hip_to_index[hip2]
+        tri_angle[(min(i, j), max(i, j))] = angle
+        tri_nbrs[i].add(j)
+        tri_nbrs[j].add(i)
+
+def tri_side(i, j):
+    return tri_angle[(min(i, j), max(i, j))]
+
+triangles = []
+for i in range(len(unit_vectors)):
+    for j in sorted(n for n in tri_nbrs[i] if n > i):
+        for k in sorted(n for n in tri_nbrs[i] & tri_nbrs[j] if n > j):
+            sides = sorted([(tri_side(i, j), i, j, k), (tri_side(j, k), j, k, i), (tri_side(i, k), i, k, j)])
+            longest, x, y, c = sides[-1]
+            a, b = (y, x) if tri_side(x, c) > tri_side(y, c) else (x, y)
+            triangles.append((int(round(longest * 1000 / PAIR_ANGLE_LSB_MDEG)), a, b, c))
+triangles.sort()
+
+with open(os.path.join(c_code_output_dir, "catalog_triangles.h"), 'w') as f:
+    f.write("#ifndef CATALOG_TRIANGLES_H\n#define CATALOG_TRIANGLES_H\n\n")
+    f.write("#include <stdint.h>\n#include \"catalog_luts.h\"\n\n")
+    f.write(C_EXTERN_OPEN)
+    f.write("// every catalog triangle whose sides all fit TRI_MAX_SIDE_MDEG (the\n")
+    f.write("// camera FOV), labelled by side: a-b longest, b-c middle, c-a shortest\n")
+    f.write("typedef struct {\n")
+    f.write("    uint8_t a;\n")
+    f.write("    uint8_t b;\n")
+    f.write("    uint8_t c;\n")
+    f.write("} catalog_tri_t;\n\n")
+    f.write(f"#define TRI_MAX_SIDE_MDEG {int(round(TRI_MAX_SIDE * 1000))}\n")
+    f.write(f"#define N_TRIS {len(triangles)}\n\n")
+    f.write("extern const catalog_tri_t tri_cat[N_TRIS];\n")
+    f.write("// a-b side of tri_cat[i], in CATALOG_PAIR_ANGLE_LSB_MDEG units, ascending\n")
+    f.write("extern const uint16_t tri_key[N_TRIS];\n\n")
+    f.write(C_EXTERN_CLOSE)
+    f.write("#endif // CATALOG_TRIANGLES_H\n")
+
+with open(os.path.join(c_code_output_dir, "catalog_triangles.c"), 'w') as f:
+    f.write("// AUTO-GENERATED TRIANGLE INDEX\n")
+    f.write("#include \"catalog_triangles.h\"\n\n")
+    f.write("const catalog_tri_t tri_cat[N_TRIS] = {\n")
+    for _, a, b, c in triangles:
+        f.write(f"    {{ {a}, {b}, {c} }},\n")
+    f.write("};\n\n")
+    f.write("const uint16_t tri_key[N_TRIS] = {\n    ")
+    for i, (y, _, _, _) in enumerate(triangles):
+        f.write(f"{y}")
+        if i != len(triangles) - 1:
+            f.write(", ")
+        if (i + 1) % 12 == 0:
+            f.write("\n    ")
+    f.write("\n};\n")
+print(f"\n    ...Wrote triangle index: {len(triangles)} triangles with sides <= {TRI_MAX_SIDE} deg "
+      f"({len(triangles) * 5} bytes).")
+
+# --------------------------------------------------------
+# STEP 9: Generate Geometric Hash
+# --------------------------------------------------------
+# pattern = angles to two of the three nearest catalog stars (mdeg). A
+# star is filed under all three choices, (1st, 2nd), (1st, 3rd) and
+# (2nd, 3rd), so an image that misses one neighbour (off the frame edge,
+# dropped) or gains one (a false star) still finds it; the cell hash must
+# match HASH_CELL() in catalog_hash.h
+def hash_cell(q1, q2):
+    return (((q1 * 2654435761) & 0xFFFFFFFF) ^ ((q2 * 40503) & 0xFFFFFFFF)) & (HASH_SIZE - 1)
+
+cat_vecs = np.array([vec for _, vec in unit_vectors])
+nn_angles = np.degrees(np.arccos(np.clip(cat_vecs @ cat_vecs.T, -1.0, 1.0))) * 1000
+np.fill_diagonal(nn_angles, np.inf)
+
+hash_pattern = []
+buckets = [set() for _ in range(HASH_SIZE)]
+for idx in range(len(unit_vectors)):
+    nn = np.sort(nn_angles[idx])[:HASH_NN]
+    hash_pattern.append([int(round(d / PAIR_ANGLE_LSB_MDEG)) for d in nn])
+    for k in range(HASH_NN):
+        for l in range(k + 1, HASH_NN):
+            d1, d2 = nn[k], nn[l]
+            for q1 in range(int((d1 - HASH_TOL_MDEG) // HASH_CELL_MDEG), int((d1 + HASH_TOL_MDEG) // HASH_CELL_MDEG) + 1):
+                for q2 in range(int((d2 - HASH_TOL_MDEG) // HASH_CELL_MDEG), int((d2 + HASH_TOL_MDEG) // HASH_CELL_MDEG) + 1):
+                    if q1 >= 0 and q2 >= 0:
+                        buckets[hash_cell(q1, q2)].add(idx)
+
+hash_start = [0]
+hash_entries = []
+for bucket in buckets:
+    hash_entries.extend(sorted(bucket))
+    hash_start.append(len(hash_entries))
+if hash_start[-1] > 0xFFFF:
+    raise ValueError("Hash entries must fit the uint16 start table.")
+
+with open(os.path.join(c_code_output_dir, "catalog_hash.h"), 'w') as f:
+    f.write("#ifndef CATALOG_HASH_H\n#define CATALOG_HASH_H\n\n")
+    f.write("#include <stdint.h>\n#include \"catalog_luts.h\"\n\n")
+    f.write(C_EXTERN_OPEN)
+    f.write("// geometric hash: every catalog star keyed on the angles to two of its\n")
+    f.write("// HASH_NN nearest catalog stars (every choice of two), quantized\n")
+    f.write("// to HASH_CELL_MDEG. A star is filed in every cell a pattern +/-\n")
+    f.write("// HASH_TOL_MDEG touches, so a pattern measured that closely needs one probe.\n")
+    f.write(f"#define HASH_CELL_MDEG {HASH_CELL_MDEG}\n")
+    f.write(f"#define HASH_TOL_MDEG {HASH_TOL_MDEG}\n")
+    f.write(f"#define HASH_SIZE {HASH_SIZE}\n")
+    f.write(f"#define HASH_NN {HASH_NN}\n")
+    f.write("#define HASH_CELL(q1, q2) \\\n")
+    f.write("    ((((uint32_t)(q1) * 2654435761u) ^ ((uint32_t)(q2) * 40503u)) & (HASH_SIZE - 1))\n\n")
+    f.write("// bucket h holds hash_entries[hash_start[h] .. hash_start[h+1]) (catalog indices)\n")
+    f.write("extern const uint16_t hash_start[HASH_SIZE + 1];\n")
+    f.write("extern const uint8_t hash_entries[];\n")
+    f.write("// each star's HASH_NN nearest-neighbour angles, ascending, in\n")
+    f.write("// CATALOG_PAIR_ANGLE_LSB_MDEG units\n")
+    f.write("extern const uint16_t hash_pattern[][HASH_NN];\n\n")
+    f.write(C_EXTERN_CLOSE)
+    f.write("#endif // CATALOG_HASH_H\n")
+
+with open(os.path.join(c_code_output_dir, "catalog_hash.c"), 'w') as f:
+    f.write("// AUTO-GENERATED GEOMETRIC HASH\n")
+    f.write("#include \"catalog_hash.h\"\n\n")
+    for name, ctype, values in (("hash_start[HASH_SIZE + 1]", "uint16_t", hash_start),
+                                ("hash_entries[]", "uint8_t", hash_entries)):
+        f.write(f"const {ctype} {name} = {{\n    ")
+        for i, x in enumerate(values):
+            f.write(f"{x}")
+            if i != len(values) - 1:
+                f.write(", ")
+            if (i + 1) % 12 == 0:
+                f.write("\n    ")
+        f.write("\n};\n\n")
+    f.write("const uint16_t hash_pattern[][HASH_NN] = {\n")
+    for nn in hash_pattern:
+        f.write("    { " + ", ".join(str(d) for d in nn) + " },\n")
+    f.write("};\n")
+hash_bytes = 2 * len(hash_start) + len(hash_entries) + 2 * HASH_NN * len(hash_pattern)
+print(f"\n    ...Wrote geometric hash: {len(hash_entries)} entries in {HASH_SIZE} buckets ({hash_bytes} bytes).")
+
+# --------------------------------------------------------
+# STEP 10: Generate Neighbour Adjacency
+# --------------------------------------------------------
+# row i lists every star within ADJ_MAX_ANGLE of star i, ascending by
+# index, with the pair angle rounded to the mdeg; each pair shows up in
+# both its stars' rows so a lookup never has to order (a, b)
+adj_rows = [[] for _ in unit_vectors]
+for hip1, hip2, angle in angle_data:
+    if angle <= ADJ_MAX_ANGLE:
+        i, j = hip_to_index[hip1], hip_to_index[hip2]
+        mdeg = int(round(angle * 1000))
+        adj_rows[i].append((j, mdeg))
+        adj_rows[j].append((i, mdeg))
+
+adj_start = [0]
+adj_nbr = []
+adj_angle = []
+for row in adj_rows:
+    for j, mdeg in sorted(row):
+        adj_nbr.append(j)
+        adj_angle.append(mdeg)
+    adj_start.append(len(adj_nbr))
+if adj_start[-1] > 0xFFFF:
+    raise ValueError("Adjacency entries must fit the uint16 start table.")
+
+with open(os.path.join(c_code_output_dir, "catalog_adjacency.h"), 'w') as f:
+    f.write("#ifndef CATALOG_ADJACENCY_H\n#define CATALOG_ADJACENCY_H\n\n")
+    f.write("#include <stdint.h>\n#include \"catalog_xyz.h\"\n\n")
+    f.write(C_EXTERN_OPEN)
+    f.write("// neighbour adjacency: for every catalog star, the stars within\n")
+    f.write("// ADJ_MAX_ANGLE_MDEG (the camera FOV) of it, ascending by index\n")
+    f.write(f"#define ADJ_MAX_ANGLE_MDEG {int(round(ADJ_MAX_ANGLE * 1000))}\n")
+    f.write(f"#define N_ADJ {len(adj_nbr)}\n\n")
+    f.write("// star a's neighbours are adj_nbr[adj_start[a] .. adj_start[a+1])\n")
+    f.write("extern const uint16_t adj_start[CATALOG_SIZE + 1];\n")
+    f.write("extern const uint8_t adj_nbr[N_ADJ];\n")
+    f.write("// angle from a to adj_nbr[k], in mdeg\n")
+    f.write("extern const uint16_t adj_angle[N_ADJ];\n\n")
+    f.write(C_EXTERN_CLOSE)
+    f.write("#endif // CATALOG_ADJACENCY_H\n")
+
+with open(os.path.join(c_code_output_dir, "catalog_adjacency.c"), 'w') as f:
+    f.write("// AUTO-GENERATED NEIGHBOUR ADJACENCY\n")
+    f.write("#include \"catalog_adjacency.h\"\n\n")
+    for name, ctype, values in (("adj_start[CATALOG_SIZE + 1]", "uint16_t", adj_start),
+                                ("adj_nbr[N_ADJ]", "uint8_t", adj_nbr),
+                                ("adj_angle[N_ADJ]", "uint16_t", adj_angle)):
+        if values is not adj_start:
+            f.write("\n")
+        f.write(f"const {ctype} {name} = {{\n    ")
+        for i, x in enumerate(values):
+            f.write(f"{x}")
+            if i != len(values) - 1:
+                f.write(", ")
+            if (i + 1) % 12 == 0:
+                f.write("\n    ")
+        f.write("\n};\n")
+adj_bytes = 2 * len(adj_start) + 3 * len(adj_nbr)
+print(f"\n    ...Wrote neighbour adjacency: {len(adj_nbr)} entries within {ADJ_MAX_ANGLE} deg ({adj_bytes} bytes).")
+
+# --------------------------------------------------------
+# STEP 11: Generate Angle Matrix
+# --------------------------------------------------------
+# uint16 in CATALOG_PAIR_ANGLE_LSB_MDEG units like tab_cat (84 deg is
+# 42000, past an int16), 0xFFFF where the pair is wider than MAX_ANGLE
+# (no image pair is) and on the diagonal. The packed form
+# keeps a < b only: row a starts at a * (2N - a - 1) / 2
+n_cat = len(unit_vectors)
+angle_matrix = np.full((n_cat, n_cat), 0xFFFF, dtype=np.int32)
+for hip1, hip2, angle in angle_data:
+    i, j = hip_to_index[hip1], hip_to_index[hip2]
+    angle_matrix[i, j] = angle_matrix[j, i] = int(round(angle * 1000 / PAIR_ANGLE_LSB_MDEG))
+if angle_matrix[angle_matrix != 0xFFFF].max() >= 0xFFFF:
+    raise ValueError("Angle matrix entries must fit a uint16.")
+
+if args.angle_matrix == "full":
+    matrix_values = [angle_matrix[i].tolist() for i in range(n_cat)]
+elif args.angle_matrix == "packed":
+    matrix_values = [[x for i in range(n_cat) for x in angle_matrix[i, i + 1:].tolist()]]
+else:
+    matrix_values = []
+matrix_layout = {"off": 0, "full": 1, "packed": 2}[args.angle_matrix]
+
+with open(os.path.join(c_code_output_dir, "catalog_angle_matrix.h"), 'w') as f:
+    f.write("#ifndef CATALOG_ANGLE_MATRIX_H\n#define CATALOG_ANGLE_MATRIX_H\n\n")
+    f.write("#include <stdint.h>\n#include \"catalog_xyz.h\"\n\n")
+    f.write(C_EXTERN_OPEN)
+    f.write("// every catalog pair's angle in CATALOG_PAIR_ANGLE_LSB_MDEG units,\n")
+    f.write("// ANGLE_MATRIX_NONE past CATALOG_MAX_ANGLE_MDEG and for a star with itself\n")
+    f.write("#define ANGLE_MATRIX_NONE 0xFFFF\n")
+    f.write("#define ANGLE_MATRIX_OFF    0   // not generated\n")
+    f.write("#define ANGLE_MATRIX_FULL   1   // catalog_angle_matrix[a][b]\n")
+    f.write("#define ANGLE_MATRIX_PACKED 2   // a < b only, row a from ANGLE_MATRIX_ROW(a)\n")
+    f.write(f"#define ANGLE_MATRIX_LAYOUT {['ANGLE_MATRIX_OFF', 'ANGLE_MATRIX_FULL', 'ANGLE_MATRIX_PACKED'][matrix_layout]}\n\n")
+    if args.angle_matrix == "full":
+        f.write("extern const uint16_t catalog_angle_matrix[CATALOG_SIZE][CATALOG_SIZE];\n\n")
+    elif args.angle_matrix == "packed":
+        f.write("#define ANGLE_MATRIX_ROW(a) ((a) * (2 * CATALOG_SIZE - (a) - 1) / 2)\n")
+        f.write(f"#define N_ANGLE_MATRIX {len(matrix_values[0])}\n")
+        f.write("// pair (a, b), a < b: catalog_angle_matrix[ANGLE_MATRIX_ROW(a) + b - a - 1]\n")
+        f.write("extern const uint16_t catalog_angle_matrix[N_ANGLE_MATRIX];\n\n")
+    f.write(C_EXTERN_CLOSE)
+    f.write("#endif // CATALOG_ANGLE_MATRIX_H\n")
+
+with open(os.path.join(c_code_output_dir, "catalog_angle_matrix.c"), 'w') as f:
+    f.write("// AUTO-GENERATED ANGLE MATRIX\n")
+    f.write("#include \"catalog_angle_matrix.h\"\n")
+    if args.angle_matrix == "full":
+        f.write("\nconst uint16_t catalog_angle_matrix[CATALOG_SIZE][CATALOG_SIZE] = {\n")
+    elif args.angle_matrix == "packed":
+        f.write("\nconst uint16_t catalog_angle_matrix[N_ANGLE_MATRIX] = {\n")
+    for row in matrix_values:
+        f.write("    { " if args.angle_matrix == "full" else "    ")
+        for i, x in enumerate(row):
+            f.write(f"{x}")
+            if i != len(row) - 1:
+                f.write(", ")
+            if (i + 1) % 16 == 0 and i != len(row) - 1:
+                f.write("\n      " if args.angle_matrix == "full" else "\n    ")
+        f.write(" },\n" if args.angle_matrix == "full" else "\n")
+    if matrix_values:
+        f.write("};\n")
+matrix_bytes = 2 * sum(len(row) for row in matrix_values)
+print(f"\n    ...Wrote angle matrix ({args.angle_matrix}, {matrix_bytes} bytes).")
+
 # --------------------------------------------------------
-# STEP 7: Output Visual EEPROM Memory Map (as a text file)
+# STEP 12: Output Visual EEPROM Memory Map (as a text file)
 # --------------------------------------------------------
 
 # EEPROM1: [HIP][RA][DEC] — derived from unit_vectors
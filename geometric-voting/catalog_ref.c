@@ -0,0 +1,11 @@
+// /star-tracker     catalog reference
+// ----------------------------------------------------------
+// catalog_xyz compiled a second time as double, whatever gv_real is,
+// under the name gv_cat_ref. gvbench --numeric measures the solver's
+// pair angles against it.
+// ----------------------------------------------------------
+
+#undef GV_REAL_FLOAT
+#define GV_REAL_DOUBLE
+#define cat gv_cat_ref
+#include "catalog_xyz.c"
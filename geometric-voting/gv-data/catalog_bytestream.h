@@ -1,9 +0,0 @@
-#ifndef CATALOG_BYTESTREAM_H
-#define CATALOG_BYTESTREAM_H
-
-#include <stdint.h>
-
-extern const uint8_t catalog_bytestream[];
-extern const size_t bytestream_len;
-
-#endif // CATALOG_BYTESTREAM_H
@@ -1,411 +0,0 @@
-// catalog_luts.c - LUT data for star tracker catalog
-
-#include <stdint.h>
-
-const uint8_t catalog[] = {
-    //Catalog stored as:
-    //[HIP_ID],[x],[y],[z] (1 byte each)
-    0x00, 0xEF, 0x84, 0xBD,
-    0x01, 0xC1, 0x82, 0xED,
-    0x02, 0xFA, 0x87, 0xA1,
-    0x03, 0x9B, 0x83, 0x03,
-    0x04, 0xDD, 0x8A, 0x2A,
-    0x05, 0xEB, 0x92, 0xC1,
-    0x06, 0xC5, 0x8C, 0xEA,
-    0x07, 0xF7, 0x96, 0x58,
-    0x08, 0xBC, 0x8F, 0xEF,
-    0x09, 0xD3, 0x98, 0x23,
-    0x0A, 0xE2, 0x9F, 0xCA,
-    0x0B, 0xBA, 0x97, 0xEE,
-    0x0C, 0xBE, 0x9C, 0x14,
-    0x0D, 0xB1, 0x9B, 0xF2,
-    0x0E, 0xE8, 0xB9, 0xAD,
-    0x0F, 0xB4, 0x9E, 0x0F,
-    0x10, 0xD0, 0xB0, 0xD5,
-    0x11, 0xE3, 0xBD, 0xB2,
-    0x12, 0xD8, 0xB7, 0xC9,
-    0x13, 0x81, 0x81, 0xFF,
-    0x14, 0xC5, 0xC4, 0x2D,
-    0x15, 0xD9, 0xDA, 0x89,
-    0x16, 0xB4, 0xB6, 0xE6,
-    0x17, 0xC4, 0xC7, 0xCF,
-    0x18, 0xC1, 0xC6, 0xD3,
-    0x19, 0xB3, 0xBF, 0xE1,
-    0x1A, 0xB0, 0xC6, 0xDE,
-    0x1B, 0x92, 0x9C, 0x05,
-    0x1C, 0xBF, 0xE1, 0xB4,
-    0x1D, 0xB8, 0xDC, 0xC3,
-    0x1E, 0xB1, 0xD4, 0xD1,
-    0x1F, 0xBE, 0xEA, 0x62,
-    0x20, 0x9A, 0xB4, 0x0E,
-    0x21, 0x9A, 0xC3, 0x17,
-    0x22, 0xAB, 0xF2, 0xA4,
-    0x23, 0xA6, 0xF8, 0x8F,
-    0x24, 0x9C, 0xE6, 0xC5,
-    0x25, 0x97, 0xD9, 0xD8,
-    0x26, 0x9B, 0xF2, 0x4F,
-    0x27, 0x96, 0xDD, 0xD4,
-    0x28, 0x9C, 0xFB, 0x74,
-    0x29, 0x98, 0xF7, 0x5C,
-    0x2A, 0x98, 0xFB, 0x6D,
-    0x2B, 0x90, 0xD6, 0xDB,
-    0x2C, 0x93, 0xFD, 0x7A,
-    0x2D, 0x93, 0xFD, 0x8E,
-    0x2E, 0x90, 0xEE, 0xBD,
-    0x2F, 0x90, 0xF6, 0x52,
-    0x30, 0x8F, 0xFE, 0x7F,
-    0x31, 0x8E, 0xF8, 0x58,
-    0x32, 0x8D, 0xFC, 0x95,
-    0x33, 0x8D, 0xFE, 0x72,
-    0x34, 0x8D, 0xFE, 0x7D,
-    0x35, 0x8B, 0xF6, 0xAD,
-    0x36, 0x89, 0xE9, 0x38,
-    0x37, 0x8A, 0xFE, 0x7B,
-    0x38, 0x86, 0xFD, 0x6A,
-    0x39, 0x84, 0xE7, 0x35,
-    0x3A, 0x82, 0xFE, 0x90,
-    0x3B, 0x80, 0xDA, 0xDA,
-    0x3C, 0x80, 0xE5, 0xCD,
-    0x3D, 0x78, 0xF5, 0xB0,
-    0x3E, 0x76, 0xED, 0x40,
-    0x3F, 0x74, 0xF8, 0x58,
-    0x40, 0x74, 0xF5, 0xB0,
-    0x41, 0x77, 0xCC, 0x1A,
-    0x42, 0x6B, 0xF8, 0xA3,
-    0x43, 0x70, 0xDB, 0x28,
-    0x44, 0x6A, 0xF1, 0xB6,
-    0x45, 0x68, 0xF7, 0x5B,
-    0x46, 0x67, 0xF9, 0x9C,
-    0x47, 0x73, 0xBA, 0x0F,
-    0x48, 0x6E, 0xCE, 0x1D,
-    0x49, 0x63, 0xEB, 0x42,
-    0x4A, 0x60, 0xF0, 0x4C,
-    0x4B, 0x5E, 0xED, 0x47,
-    0x4C, 0x5E, 0xDF, 0x33,
-    0x4D, 0x58, 0xE7, 0x41,
-    0x4E, 0x51, 0xF5, 0x92,
-    0x4F, 0x5C, 0xD5, 0x28,
-    0x50, 0x54, 0xE3, 0xC3,
-    0x51, 0x4A, 0xF3, 0x8B,
-    0x52, 0x4E, 0xE4, 0xBB,
-    0x53, 0x4A, 0xE6, 0x4A,
-    0x54, 0x4D, 0xD3, 0x2E,
-    0x55, 0x42, 0xE2, 0x4B,
-    0x56, 0x51, 0xC8, 0x22,
-    0x57, 0x5A, 0xB4, 0x12,
-    0x58, 0x59, 0xB1, 0xEF,
-    0x59, 0x4F, 0xB7, 0x17,
-    0x5A, 0x2B, 0xDE, 0x8E,
-    0x5B, 0x28, 0xDB, 0x8D,
-    0x5C, 0x43, 0xBC, 0xDE,
-    0x5D, 0x3C, 0xBF, 0x28,
-    0x5E, 0x5E, 0x9D, 0x08,
-    0x5F, 0x4E, 0xAA, 0x12,
-    0x60, 0x2F, 0xC3, 0xC8,
-    0x61, 0x47, 0xAE, 0x17,
-    0x62, 0x1C, 0xCD, 0x6C,
-    0x63, 0x48, 0xA9, 0x15,
-    0x64, 0x40, 0xAF, 0xE4,
-    0x65, 0x1E, 0xC0, 0xB3,
-    0x66, 0x53, 0x9D, 0x0C,
-    0x67, 0x11, 0xBA, 0x9A,
-    0x68, 0x59, 0x93, 0x08,
-    0x69, 0x48, 0x9A, 0x10,
-    0x6A, 0x13, 0xB2, 0xAB,
-    0x6B, 0x29, 0xA7, 0xD4,
-    0x6C, 0x47, 0x96, 0x0F,
-    0x6D, 0x4B, 0x92, 0x0D,
-    0x6E, 0x31, 0x9A, 0x1F,
-    0x6F, 0x0B, 0xA5, 0x5C,
-    0x70, 0x3B, 0x91, 0xEA,
-    0x71, 0x45, 0x8E, 0xF0,
-    0x72, 0x27, 0x93, 0xD9,
-    0x73, 0x0A, 0x97, 0xAC,
-    0x74, 0x07, 0x98, 0xA1,
-    0x75, 0x46, 0x86, 0x0E,
-    0x76, 0x04, 0x85, 0xA0,
-    0x77, 0x34, 0x82, 0xE6,
-    0x78, 0x2F, 0x7D, 0x1D,
-    0x79, 0x0A, 0x7A, 0x4E,
-    0x7A, 0x3D, 0x7B, 0x13,
-    0x7B, 0x3A, 0x7B, 0xEA,
-    0x7C, 0x06, 0x77, 0x59,
-    0x7D, 0x46, 0x79, 0x0E,
-    0x7E, 0x06, 0x70, 0x5B,
-    0x7F, 0x3B, 0x76, 0x14,
-    0x80, 0x0C, 0x6E, 0x4D,
-    0x81, 0x53, 0x78, 0x08,
-    0x82, 0x2D, 0x70, 0x1F,
-    0x83, 0x02, 0x68, 0x7C,
-    0x84, 0x51, 0x76, 0x09,
-    0x85, 0x41, 0x72, 0x11,
-    0x86, 0x3A, 0x6F, 0xE9,
-    0x87, 0x04, 0x61, 0x87,
-    0x88, 0x1E, 0x67, 0xCF,
-    0x89, 0x07, 0x5E, 0x98,
-    0x8A, 0x11, 0x58, 0x4D,
-    0x8B, 0x20, 0x5C, 0x33,
-    0x8C, 0x3B, 0x65, 0xE8,
-    0x8D, 0x0B, 0x52, 0x67,
-    0x8E, 0x0B, 0x4C, 0x7E,
-    0x8F, 0x3B, 0x5F, 0x19,
-    0x90, 0x35, 0x5A, 0xE0,
-    0x91, 0x15, 0x45, 0xA8,
-    0x92, 0x34, 0x56, 0x22,
-    0x93, 0x49, 0x5F, 0x11,
-    0x94, 0x1E, 0x44, 0x46,
-    0x95, 0x28, 0x4A, 0x34,
-    0x96, 0x1C, 0x3C, 0xA9,
-    0x97, 0x31, 0x42, 0xCF,
-    0x98, 0x36, 0x44, 0x2A,
-    0x99, 0x50, 0x58, 0x10,
-    0x9A, 0x50, 0x58, 0x10,
-    0x9B, 0x3E, 0x47, 0x22,
-    0x9C, 0x57, 0x5C, 0x0C,
-    0x9D, 0x2A, 0x35, 0xBA,
-    0x9E, 0x66, 0x68, 0xFA,
-    0x9F, 0x25, 0x2C, 0x5C,
-    0xA0, 0x3D, 0x3E, 0x28,
-    0xA1, 0x3C, 0x3D, 0x2A,
-    0xA2, 0x2F, 0x2D, 0x49,
-    0xA3, 0x2D, 0x20, 0x6B,
-    0xA4, 0x62, 0x5C, 0x09,
-    0xA5, 0x66, 0x61, 0xF9,
-    0xA6, 0x42, 0x35, 0x2C,
-    0xA7, 0x46, 0x39, 0x26,
-    0xA8, 0x56, 0x4C, 0xED,
-    0xA9, 0x3C, 0x24, 0xB9,
-    0xAA, 0x47, 0x32, 0x2C,
-    0xAB, 0x39, 0x16, 0x8E,
-    0xAC, 0x62, 0x4F, 0x0D,
-    0xAD, 0x46, 0x1D, 0x47,
-    0xAE, 0x45, 0x19, 0x4E,
-    0xAF, 0x46, 0x16, 0x54,
-    0xB0, 0x47, 0x0E, 0x77,
-    0xB1, 0x49, 0x0D, 0x75,
-    0xB2, 0x4F, 0x17, 0x48,
-    0xB3, 0x67, 0x48, 0xF0,
-    0xB4, 0x54, 0x16, 0x47,
-    0xB5, 0x52, 0x12, 0xAE,
-    0xB6, 0x57, 0x17, 0x43,
-    0xB7, 0x53, 0x0A, 0x68,
-    0xB8, 0x5B, 0x19, 0xC2,
-    0xB9, 0x72, 0x54, 0x08,
-    0xBA, 0x60, 0x1B, 0x38,
-    0xBB, 0x62, 0x1F, 0x31,
-    0xBC, 0x5E, 0x06, 0x94,
-    0xBD, 0x6D, 0x3B, 0x16,
-    0xBE, 0x74, 0x4C, 0xF4,
-    0xBF, 0x65, 0x08, 0x5D,
-    0xC0, 0x6C, 0x25, 0x28,
-    0xC1, 0x67, 0x06, 0x9F,
-    0xC2, 0x69, 0x0E, 0xB5,
-    0xC3, 0x6C, 0x1B, 0xCC,
-    0xC4, 0x6C, 0x0E, 0x4A,
-    0xC5, 0x75, 0x38, 0x16,
-    0xC6, 0x75, 0x3A, 0x15,
-    0xC7, 0x75, 0x32, 0xE4,
-    0xC8, 0x73, 0x1B, 0x32,
-    0xC9, 0x75, 0x2E, 0x1E,
-    0xCA, 0x74, 0x1A, 0x33,
-    0xCB, 0x72, 0x04, 0x9B,
-    0xCC, 0x76, 0x23, 0x29,
-    0xCD, 0x78, 0x1D, 0x2F,
-    0xCE, 0x76, 0x01, 0x8A,
-    0xCF, 0x7A, 0x1E, 0x2D,
-    0xD0, 0x7B, 0x1A, 0x33,
-    0xD1, 0x7E, 0x30, 0xE3,
-    0xD2, 0x7F, 0x02, 0x6A,
-    0xD3, 0x82, 0x12, 0x3F,
-    0xD4, 0x87, 0x1A, 0x33,
-    0xD5, 0x8A, 0x11, 0x40,
-    0xD6, 0x8B, 0x01, 0x79,
-    0xD7, 0x8B, 0x17, 0x37,
-    0xD8, 0x8E, 0x0D, 0x49,
-    0xD9, 0x8F, 0x1D, 0xCF,
-    0xDA, 0x96, 0x10, 0x46,
-    0xDB, 0x9B, 0x11, 0x47,
-    0xDC, 0x9B, 0x18, 0xC4,
-    0xDD, 0x9D, 0x15, 0x40,
-    0xDE, 0xA2, 0x09, 0x9E,
-    0xDF, 0xA0, 0x13, 0x44,
-    0xE0, 0xA3, 0x0E, 0x52,
-    0xE1, 0x8F, 0x51, 0xF5,
-    0xE2, 0xAE, 0x09, 0x86,
-    0xE3, 0xAB, 0x18, 0xBB,
-    0xE4, 0xA7, 0x2F, 0xDA,
-    0xE5, 0xB8, 0x0F, 0x97,
-    0xE6, 0xBA, 0x10, 0x93,
-    0xE7, 0xC5, 0x14, 0x7E,
-    0xE8, 0xC7, 0x1B, 0x5F,
-    0xE9, 0xB8, 0x30, 0xD2,
-    0xEA, 0xA9, 0x47, 0x15,
-    0xEB, 0xB6, 0x3D, 0x22,
-    0xEC, 0xBA, 0x3B, 0xDA,
-    0xED, 0xC6, 0x30, 0xC7,
-    0xEE, 0xD2, 0x36, 0xC0,
-    0xEF, 0xAC, 0x59, 0xF1,
-    0xF0, 0xA1, 0x65, 0xF8,
-    0xF1, 0xE5, 0x33, 0x73,
-    0xF2, 0xE8, 0x39, 0x95,
-    0xF3, 0xE6, 0x3C, 0x5C,
-    0xF4, 0xD6, 0x4B, 0x32,
-    0xF5, 0xEF, 0x43, 0x7F,
-    0xF6, 0xCC, 0x57, 0x22,
-    0xF7, 0xBB, 0x61, 0xEC,
-    0xF8, 0xB9, 0x64, 0x11,
-    0xF9, 0xD2, 0x63, 0x22,
-    0xFA, 0xE8, 0x5B, 0xC0,
-    0xFB, 0xF5, 0x5D, 0x5D,
-    0xFC, 0xEA, 0x62, 0x40,
-    0xFD, 0xED, 0x64, 0xBC,
-    0xFE, 0xF7, 0x62, 0xA1,
-    0xFF, 0x9B, 0x7D, 0xFC,
-};
-
-const uint16_t index_to_hip_ID_lut[] = {
-    0x02A5, 0x02EA, 0x042B, 0x07E5, 0x0821, 0x0C14, 0x0C6B, 0x0D5B, 
-    0x114B, 0x142D, 0x1547, 0x1A1E, 0x1DA4, 0x22B6, 0x22C7, 0x2414, 
-    0x25A8, 0x269C, 0x2750, 0x2DF7, 0x3617, 0x3737, 0x37F8, 0x3812, 
-    0x38F0, 0x3DF7, 0x43CE, 0x450E, 0x4526, 0x4746, 0x4864, 0x486F, 
-    0x4D44, 0x5321, 0x53AD, 0x57B1, 0x59E7, 0x5B78, 0x5C85, 0x5CD7, 
-    0x5D43, 0x5EF1, 0x5F74, 0x6020, 0x62C1, 0x62F8, 0x6354, 0x6406, 
-    0x654A, 0x6581, 0x665F, 0x6681, 0x66C7, 0x6753, 0x680A, 0x6867, 
-    0x6AE6, 0x6BEC, 0x6D55, 0x6EC8, 0x6EDC, 0x73D7, 0x75AA, 0x7674, 
-    0x7687, 0x76E6, 0x7BC1, 0x7BC5, 0x7DF6, 0x7E5D, 0x7E6A, 0x7F5F, 
-    0x8000, 0x832B, 0x84B9, 0x868C, 0x89C0, 0x8C40, 0x8D5C, 0x8E19, 
-    0x8FF2, 0x919F, 0x93C2, 0x951A, 0x9A05, 0x9B4D, 0x9C11, 0xA04D, 
-    0xA2E8, 0xA7A1, 0xA865, 0xAB25, 0xAC5F, 0xAF10, 0xB0B6, 0xB1F4, 
-    0xB324, 0xB375, 0xB536, 0xB66D, 0xB705, 0xBB24, 0xBB82, 0xC205, 
-    0xC3B3, 0xC4C3, 0xC597, 0xC671, 0xC978, 0xCCC3, 0xCDF7, 0xCECF, 
-    0xD296, 0xD32D, 0xD50B, 0xD658, 0xD65F, 0xDCF1, 0xE120, 0xE291, 
-    0xE73C, 0xE7B4, 0xE963, 0xE97E, 0xE99B, 0xED2E, 0xEE25, 0xEE9C, 
-    0xEFAF, 0xF091, 0xF1EC, 0xF1F5, 0xF372, 0xF3E2, 0xF5EC, 0xF672, 
-    0xF695, 0xF878, 0xFDC2, 0xFE55, 0xFF62, 0xFFC2, 0x102C9, 0x10461, 
-    0x106E5, 0x10957, 0x109A2, 0x10C5E, 0x10D1F, 0x10D45, 0x11029, 0x115A3, 
-    0x116B8, 0x11801, 0x11803, 0x118B4, 0x118E4, 0x119A9, 0x11B9F, 0x11BAE, 
-    0x11E39, 0x11E76, 0x11FF2, 0x12421, 0x124C2, 0x12559, 0x12585, 0x12600, 
-    0x126C2, 0x129EB, 0x12A09, 0x12D0E, 0x13080, 0x131B9, 0x13241, 0x133E4, 
-    0x136E9, 0x1380A, 0x138F0, 0x139CB, 0x13B7B, 0x13BB0, 0x13D72, 0x13DE1, 
-    0x13F1D, 0x14161, 0x141DC, 0x14252, 0x14438, 0x14489, 0x147B7, 0x1482C, 
-    0x148AF, 0x14979, 0x1499B, 0x1499C, 0x14BEA, 0x14D0A, 0x14D13, 0x14EA6, 
-    0x14EC0, 0x14F20, 0x14FA7, 0x15010, 0x150D4, 0x1528E, 0x152D6, 0x15421, 
-    0x154DD, 0x15719, 0x157F0, 0x15A3B, 0x15E2A, 0x15F4B, 0x15F6A, 0x16049, 
-    0x16180, 0x1647E, 0x16789, 0x16AB7, 0x16C0A, 0x16D42, 0x16E33, 0x16EA8, 
-    0x16FBD, 0x170A8, 0x1750D, 0x176CB, 0x17B8D, 0x17BFE, 0x17D71, 0x18491, 
-    0x187F9, 0x18865, 0x1898F, 0x18D8C, 0x18ED2, 0x19058, 0x1991C, 0x19AEF, 
-    0x19E30, 0x19F26, 0x1A333, 0x1A424, 0x1A635, 0x1AA12, 0x1AAD4, 0x1ABB4, 
-    0x1AE32, 0x1B5FA, 0x1B61E, 0x1B9F0, 0x1BAD8, 0x1BCD9, 0x1BD2B, 0x1C7F7
-    
-};
-const size_t index_count = sizeof(index_to_hip_ID_lut) / sizeof(index_to_hip_ID_lut[0]);
-
-const uint16_t bin_angle_to_address_lut[] = {
-    0x0000, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x000A, 0x000B, 
-    0x000C, 0x000F, 0x0010, 0x0013, 0x0014, 0x0015, 0x001C, 0x0021, 
-    0x0022, 0x0023, 0x0024, 0x0029, 0x002A, 0x002F, 0x0034, 0x0039, 
-    0x003C, 0x0041, 0x0042, 0x0049, 0x0050, 0x0059, 0x0060, 0x0063, 
-    0x006C, 0x006F, 0x0078, 0x007B, 0x0082, 0x0087, 0x008E, 0x0091, 
-    0x0098, 0x00A1, 0x00B0, 0x00BB, 0x00C8, 0x00D1, 0x00DE, 0x00E7, 
-    0x00F2, 0x00F5, 0x00FE, 0x010D, 0x0114, 0x011D, 0x0124, 0x012B, 
-    0x013A, 0x0149, 0x014E, 0x0155, 0x015E, 0x0163, 0x016E, 0x0173, 
-    0x017E, 0x018B, 0x0192, 0x019B, 0x01A8, 0x01AF, 0x01C4, 0x01CB, 
-    0x01D0, 0x01DD, 0x01E4, 0x01F1, 0x01FC, 0x0207, 0x0218, 0x0225, 
-    0x0230, 0x0241, 0x024A, 0x0257, 0x026A, 0x0273, 0x0278, 0x027D, 
-    0x0294, 0x02A5, 0x02B2, 0x02C7, 0x02D0, 0x02E7, 0x02F4, 0x0301, 
-    0x030E, 0x031D, 0x032C, 0x0331, 0x0344, 0x034D, 0x0358, 0x0365, 
-    0x0370, 0x0381, 0x0390, 0x039B, 0x03A6, 0x03AF, 0x03C2, 0x03D1, 
-    0x03E0, 0x03F1, 0x0406, 0x0411, 0x042A, 0x0437, 0x043E, 0x0451, 
-    0x0464, 0x0477, 0x0488, 0x049B, 0x04AE, 0x04C5, 0x04D2, 0x04E3, 
-    0x04F2, 0x0509, 0x0516, 0x0527, 0x0538, 0x054D, 0x055A, 0x056B, 
-    0x0580, 0x0595, 0x05AC, 0x05C1, 0x05D0, 0x05EB, 0x0606, 0x0615, 
-    0x0624, 0x062D, 0x063C, 0x0647, 0x0652, 0x065F, 0x0674, 0x0685, 
-    0x0696, 0x069F, 0x06B6, 0x06C9, 0x06DE, 0x06EF, 0x0708, 0x0729, 
-    0x073A, 0x0751, 0x075C, 0x0775, 0x078A, 0x079F, 0x07B4, 0x07D1, 
-    0x07F4, 0x0801, 0x0816, 0x0825, 0x0838, 0x0853, 0x086A, 0x087F, 
-    0x089C, 0x08B5, 0x08C4, 0x08DB, 0x08FC, 0x090F, 0x0922, 0x093F, 
-    0x0954, 0x0969, 0x097A, 0x0999, 0x09C2, 0x09EB, 0x0A06, 0x0A13, 
-    0x0A26, 0x0A3B, 0x0A4E, 0x0A61, 0x0A76, 0x0A97, 0x0AB6, 0x0AD1, 
-    0x0AE2, 0x0B01, 0x0B20, 0x0B31, 0x0B3E, 0x0B55, 0x0B66, 0x0B81, 
-    0x0B98, 0x0BB1, 0x0BCE, 0x0BDF, 0x0BFA, 0x0C17, 0x0C2C, 0x0C49, 
-    0x0C58, 0x0C75, 0x0C92, 0x0CA3, 0x0CC8, 0x0CEB, 0x0D02, 0x0D13, 
-    0x0D36, 0x0D51, 0x0D74, 0x0D93, 0x0DAE, 0x0DD1, 0x0DF0, 0x0E17, 
-    0x0E40, 0x0E57, 0x0E6A, 0x0E7F, 0x0E9E, 0x0EC1, 0x0EDE, 0x0EF9, 
-    0x0F14, 0x0F31, 0x0F50, 0x0F67, 0x0F86, 0x0F9D, 0x0FB6, 0x0FD7, 
-    0x0FF0, 0x1015, 0x1034, 0x1053, 0x1070, 0x108F, 0x10A2, 0x10C3, 
-    0x10DC, 0x10F9, 0x1114, 0x1133, 0x1150, 0x1161, 0x117E, 0x11A1, 
-    0x11D0, 0x11EF, 0x120A, 0x1225, 0x1256, 0x1275, 0x129E, 0x12B9, 
-    0x12E2, 0x1303, 0x131A, 0x132B, 0x1346, 0x136F, 0x1386, 0x13A3, 
-    0x13B8, 0x13D7, 0x1406, 0x141B, 0x1432, 0x144F, 0x146C, 0x148D, 
-    0x14AE, 0x14CD, 0x14E4, 0x150F, 0x152E, 0x154D, 0x1570, 0x1585, 
-    0x15AA, 0x15BB, 0x15D2, 0x15E9, 0x1614, 0x162D, 0x1644, 0x166B, 
-    0x16A0, 0x16CB, 0x16E8, 0x1707, 0x172C, 0x1753, 0x177C, 0x179D, 
-    0x17C2, 0x17D7, 0x17F2, 0x181D, 0x183A, 0x185B, 0x187C, 0x189F, 
-    0x18B0, 0x18D9, 0x18FC, 0x1929, 0x1946, 0x1963, 0x197C, 0x199D, 
-    0x19C4, 0x19EB, 0x1A0A, 0x1A2D, 0x1A56, 0x1A77, 0x1A8C, 0x1AAD, 
-    0x1ADA, 0x1AFF, 0x1B1C, 0x1B39, 0x1B5A, 0x1B8F, 0x1BAA, 0x1BC7, 
-    0x1BE2, 0x1C13, 0x1C32, 0x1C51, 0x1C7C, 0x1C99, 0x1CC2, 0x1CFB, 
-    0x1D18, 0x1D3B, 0x1D5E, 0x1D7B, 0x1DA4, 0x1DBD, 0x1DEA, 0x1E13, 
-    0x1E2A, 0x1E47, 0x1E70, 0x1E91, 0x1EC4, 0x1EDB, 0x1F06, 0x1F1F, 
-    0x1F46, 0x1F65, 0x1F8E, 0x1FBB, 0x1FDE, 0x2001, 0x201E, 0x2045, 
-    0x205C, 0x208B, 0x20A2, 0x20C7, 0x20E4, 0x2111, 0x2136, 0x215B, 
-    0x2188, 0x219F, 0x21C4, 0x21DD, 0x2200, 0x221D, 0x2246, 0x2265, 
-    0x2294, 0x22BF, 0x22D6, 0x2317, 0x2338, 0x2369, 0x2390, 0x23B3, 
-    0x23E8, 0x2409, 0x2436, 0x245D, 0x24A2, 0x24C7, 0x24EA, 0x2507, 
-    0x2528, 0x255B, 0x2578, 0x25A1, 0x25C4, 0x25FD, 0x2620, 0x2647, 
-    0x2678, 0x269D, 0x26C2, 0x26EB, 0x2718, 0x273F, 0x2774, 0x2797, 
-    0x27BC, 0x27D9, 0x2818, 0x2831, 0x285E, 0x288D, 0x28B6, 0x28ED, 
-    0x291E, 0x294F, 0x297A, 0x29A1, 0x29DA, 0x29FD, 0x2A1C, 0x2A47, 
-    0x2A7A, 0x2AA9, 0x2AD6, 0x2B05, 0x2B2E, 0x2B4F, 0x2B7E, 0x2BB5, 
-    0x2BE2, 0x2C11, 0x2C2E, 0x2C53, 0x2C7C, 0x2CAF, 0x2CCE, 0x2CFB, 
-    0x2D20, 0x2D55, 0x2D7A, 0x2DA9, 0x2DD6, 0x2DFD, 0x2E24, 0x2E57, 
-    0x2E80, 0x2EB5, 0x2ED2, 0x2F07, 0x2F2E, 0x2F5B, 0x2F8C, 0x2FBB, 
-    0x2FDC, 0x3007, 0x3032, 0x3069, 0x309A, 0x30C7, 0x30FA, 0x312B, 
-    0x3150, 0x3165, 0x318E, 0x31BB, 0x31FC, 0x322F, 0x3248, 0x326B, 
-    0x3294, 0x32C1, 0x32EE, 0x3327, 0x3352, 0x338D, 0x33B4, 0x33E7, 
-    0x3416, 0x3449, 0x347C, 0x34B1, 0x34D8, 0x3517, 0x3540, 0x356B, 
-    0x358A, 0x35B5, 0x35E0, 0x3601, 0x3626, 0x3653, 0x3678, 0x368F, 
-    0x36C8, 0x3707, 0x373E, 0x375D, 0x379A, 0x37C3, 0x37FA, 0x382D, 
-    0x3864, 0x3881, 0x38AE, 0x38D7, 0x3902, 0x392B, 0x3966, 0x399D, 
-    0x39D2, 0x3A03, 0x3A30, 0x3A5F, 0x3A88, 0x3AC1, 0x3AF6, 0x3B1F, 
-    0x3B3C, 0x3B5F, 0x3B8E, 0x3BC1, 0x3BEA, 0x3C11, 0x3C38, 0x3C6D, 
-    0x3CAA, 0x3CBB, 0x3CF0, 0x3D27, 0x3D50, 0x3D7F, 0x3DB4, 0x3DEF, 
-    0x3E24, 0x3E55, 0x3E82, 0x3EB3, 0x3EE6, 0x3F0F, 0x3F36, 0x3F5D, 
-    0x3F8E, 0x3FC5, 0x4002, 0x4031, 0x405C, 0x407D, 0x40A6, 0x40D3, 
-    0x4100, 0x4139, 0x416E, 0x419B, 0x41D8, 0x41FD, 0x4234, 0x4261, 
-    0x4296, 0x42C7, 0x42F6, 0x4323, 0x4344, 0x436F, 0x4390, 0x43C7, 
-    0x43F0, 0x4427, 0x4452, 0x446B, 0x4484, 0x44BB, 0x44E8, 0x4527, 
-    0x455E, 0x4581, 0x45B8, 0x45E1, 0x460C, 0x4629, 0x4652, 0x4699, 
-    0x46D8, 0x4703, 0x4728, 0x4751, 0x4782, 0x47B3, 0x47E2, 0x480D, 
-    0x484A, 0x4877, 0x48A0, 0x48C5, 0x48FE, 0x494B, 0x4970, 0x49B5, 
-    0x49E6, 0x4A0D, 0x4A40, 0x4A79, 0x4AB2, 0x4AE5, 0x4B18, 0x4B49, 
-    0x4B7C, 0x4BAB, 0x4BD8, 0x4C0B, 0x4C36, 0x4C61, 0x4C96, 0x4CC3, 
-    0x4D02, 0x4D31, 0x4D58, 0x4D87, 0x4DC2, 0x4DFB, 0x4E20, 0x4E43, 
-    0x4E80, 0x4EA7, 0x4EE2, 0x4F25, 0x4F54, 0x4F81, 0x4FB4, 0x4FE9, 
-    0x5026, 0x5061, 0x5090, 0x50C1, 0x50F2, 0x5123, 0x5152, 0x5189, 
-    0x51BC, 0x51F5, 0x522E, 0x525D, 0x529A, 0x52C3, 0x52FE, 0x5325, 
-    0x5368, 0x538F, 0x53D2, 0x540D, 0x5444, 0x546F, 0x548A, 0x54C9, 
-    0x54EE, 0x5525, 0x555A, 0x558B, 0x55BA, 0x55F3, 0x561E, 0x564B, 
-    0x5686, 0x56AF, 0x56EA, 0x571D, 0x5752, 0x5797, 0x57CC, 0x57F1, 
-    0x580E, 0x5845, 0x587E, 0x589F, 0x58C8, 0x590D, 0x593C, 0x597D, 
-    0x59AC, 0x59E1, 0x5A0E, 0x5A59, 0x5A8E, 0x5AAB, 0x5AE8, 0x5B2D, 
-    0x5B62, 0x5BAB, 0x5BCC, 0x5C0D, 0x5C2A, 0x5C5D, 0x5C92, 0x5CC1, 
-    0x5CE0, 0x5D19, 0x5D4C, 0x5D6F, 0x5DAA, 0x5DDB, 0x5E12, 0x5E39, 
-    0x5E6C, 0x5E93, 0x5ED0, 0x5F09, 0x5F48, 0x5F6D, 0x5FB0, 0x5FF1, 
-    0x603A, 0x6079, 0x60B0, 0x60F3, 0x613C, 0x617B, 0x61B4, 0x61EF, 
-    0x622C, 0x6255, 0x6284, 0x62AF, 0x62E6, 0x6311, 0x6342, 0x6373, 
-    0x63B2, 0x63FD, 0x643C, 0x6475, 0x6496, 0x64B9, 0x64E6, 0x6523, 
-    0x6568, 0x65A1, 0x65D6, 0x6603, 0x663C, 0x6689, 0x66CA, 0x66F7, 
-    0x671E, 0x676D, 0x6794, 0x67C5, 0x67F2, 0x6831, 0x6876, 0x68AB, 
-    0x68D8, 0x690F, 0x694A, 0x6981, 0x69C4, 0x69FB, 0x6A48, 0x6A8B, 
-    0x6AD6, 0x6B11, 0x6B5A, 0x6B9F, 0x6BD0, 0x6C01, 0x6C2C, 0x6C67, 
-    0x6C90, 0x6CD9, 0x6D0C, 0x6D45, 0x6D78, 0x6DBF, 0x6DF2, 0x6E23, 
-    0x6E5C, 0x6E8B, 0x6EC2, 0x6EEF, 0x6F3A, 0x6F71, 0x6FB6, 0x6FF9, 
-    0x702C, 0x7073, 0x70B2, 0x70EB, 0x712E, 0x7163, 0x719A, 0x71D9, 
-    0x7214, 0x7257, 0x7282, 0x72B5, 0x72DA, 0x7313, 0x735E, 0x7389, 
-    0x73B4, 0x73EB, 0x7432, 0x746F, 0x74A0, 0x74CF, 0x74FA, 0x7535, 
-    0x756A, 0x75A1, 0x75C6, 0x75FB, 0x761E, 0x764D, 0x7682, 0x76BB, 
-    0x76F0, 0x771D, 0x7746, 0x7773, 0x77B6, 0x77DF, 0x780C, 0x7847
-    
-};
-const size_t bin_count = sizeof(bin_angle_to_address_lut) / sizeof(bin_angle_to_address_lut[0]);
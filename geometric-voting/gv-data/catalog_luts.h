@@ -1,12 +0,0 @@
-#ifndef CATALOG_LUTS_H
-#define CATALOG_LUTS_H
-
-#include <stdint.h>
-
-extern const uint8_t catalog[];
-extern const uint16_t index_to_hip_ID_lut[];
-extern const uint16_t bin_angle_to_address_lut[];
-extern const size_t index_count;
-extern const size_t bin_count;
-
-#endif // CATALOG_LUTS_H
@@ -1,262 +0,0 @@
-// catalog_xyz.c - Auto-generated unit vector catalog
-// Each row: { HIP_ID, x, y, z }
-
-#define CATALOG_SIZE 256
-double catalog_xyz[CATALOG_SIZE][4] = {
-    { 0, 0.87326512, 0.03196827, 0.48619550 },
-    { 1, 0.51237873, 0.02050796, 0.85851468 },
-    { 2, 0.96348243, 0.05570519, 0.26191322 },
-    { 3, 0.21923112, 0.02464240, -0.97536171 },
-    { 4, 0.73471361, 0.08462309, -0.67307863 },
-    { 5, 0.84580535, 0.14657724, 0.51296045 },
-    { 6, 0.54280261, 0.09694802, 0.83424601 },
-    { 7, 0.93397882, 0.17980161, -0.30879595 },
-    { 8, 0.47423032, 0.11979696, 0.87221230 },
-    { 9, 0.65727859, 0.19496032, -0.72799405 },
-    { 10, 0.77555356, 0.24352681, 0.58241854 },
-    { 11, 0.46204497, 0.18156213, 0.86807237 },
-    { 12, 0.49272510, 0.22380179, -0.84091304 },
-    { 13, 0.38942390, 0.21230918, 0.89625545 },
-    { 14, 0.82024848, 0.44832498, 0.35524237 },
-    { 15, 0.41357971, 0.23581688, -0.87939879 },
-    { 16, 0.63385529, 0.38047728, 0.67339773 },
-    { 17, 0.77968291, 0.48328934, 0.39815321 },
-    { 18, 0.69185054, 0.43881621, 0.57339617 },
-    { 19, 0.01012774, 0.00789734, 0.99991753 },
-    { 20, 0.54332416, 0.53514513, -0.64685280 },
-    { 21, 0.69825567, 0.71228659, 0.07132206 },
-    { 22, 0.41164644, 0.42924783, 0.80392382 },
-    { 23, 0.53818605, 0.56305631, 0.62715498 },
-    { 24, 0.51464985, 0.55271014, 0.65547466 },
-    { 25, 0.40498035, 0.50155041, 0.76448551 },
-    { 26, 0.37831994, 0.55524503, 0.74065983 },
-    { 27, 0.14869287, 0.22730702, -0.96240426 },
-    { 28, 0.49886576, 0.76441545, 0.40841397 },
-    { 29, 0.44324824, 0.72425121, 0.52819616 },
-    { 30, 0.38915968, 0.65969860, 0.64292495 },
-    { 31, 0.49339257, 0.83785541, -0.23358528 },
-    { 32, 0.20544569, 0.41397583, -0.88680104 },
-    { 33, 0.20999150, 0.53306246, -0.81960233 },
-    { 34, 0.34390531, 0.89497017, 0.28417870 },
-    { 35, 0.29916796, 0.94647218, 0.12119800 },
-    { 36, 0.22724197, 0.80565320, 0.54706856 },
-    { 37, 0.18073858, 0.69847322, 0.69243680 },
-    { 38, 0.21799086, 0.89867880, -0.38060006 },
-    { 39, 0.17391280, 0.73163051, 0.65914425 },
-    { 40, 0.22469804, 0.97038703, -0.08865548 },
-    { 41, 0.19583265, 0.94008657, -0.27908210 },
-    { 42, 0.19505209, 0.97036261, -0.14265725 },
-    { 43, 0.13050096, 0.68230249, 0.71932803 },
-    { 44, 0.15424356, 0.98714717, -0.04182575 },
-    { 45, 0.15062807, 0.98238459, 0.11059706 },
-    { 46, 0.12865945, 0.86843844, 0.47881250 },
-    { 47, 0.12914599, 0.92611683, -0.35444171 },
-    { 48, 0.12183883, 0.99253617, -0.00522014 },
-    { 49, 0.11300957, 0.94527911, -0.30606573 },
-    { 50, 0.10664515, 0.97921647, 0.17251645 },
-    { 51, 0.10641987, 0.98897580, -0.10296440 },
-    { 52, 0.10357897, 0.99440002, -0.02097587 },
-    { 53, 0.09083297, 0.92825207, 0.36069025 },
-    { 54, 0.07345601, 0.82505066, -0.56026389 },
-    { 55, 0.08380902, 0.99590511, -0.03389789 },
-    { 56, 0.05263846, 0.98438635, -0.16796639 },
-    { 57, 0.03199880, 0.81074599, -0.58452290 },
-    { 58, 0.02089101, 0.99143526, 0.12891738 },
-    { 59, 0.00145301, 0.70775372, 0.70645776 },
-    { 60, 0.00097077, 0.79639462, 0.60477655 },
-    { 61, -0.05993201, 0.92188791, 0.38279346 },
-    { 62, -0.07660871, 0.86207457, -0.50095763 },
-    { 63, -0.09406838, 0.94663161, -0.30828516 },
-    { 64, -0.09239141, 0.91915518, 0.38290675 },
-    { 65, -0.06322173, 0.60274124, -0.79542819 },
-    { 66, -0.15714263, 0.94635883, 0.28233166 },
-    { 67, -0.11957329, 0.71914427, -0.68449524 },
-    { 68, -0.17248358, 0.88875549, 0.42469177 },
-    { 69, -0.18748087, 0.93922763, -0.28758023 },
-    { 70, -0.19138140, 0.95580464, 0.22318300 },
-    { 71, -0.09818045, 0.46000461, -0.88247173 },
-    { 72, -0.13716474, 0.61953380, -0.77289307 },
-    { 73, -0.22135825, 0.84638829, -0.48438351 },
-    { 74, -0.24838770, 0.88035522, -0.40407702 },
-    { 75, -0.26335887, 0.85617526, -0.44452899 },
-    { 76, -0.26343361, 0.75285129, -0.60317300 },
-    { 77, -0.31284986, 0.81399220, -0.48942994 },
-    { 78, -0.36729233, 0.91886365, 0.14417329 },
-    { 79, -0.27624123, 0.67328376, -0.68584238 },
-    { 80, -0.34060606, 0.77776499, 0.52826995 },
-    { 81, -0.41813726, 0.90380312, 0.09111069 },
-    { 82, -0.39153681, 0.79114763, 0.46987696 },
-    { 83, -0.41648253, 0.80610603, -0.42039905 },
-    { 84, -0.39333260, 0.65731176, -0.64283024 },
-    { 85, -0.48141802, 0.77384400, -0.41158493 },
-    { 86, -0.36295610, 0.57229931, -0.73534779 },
-    { 87, -0.29557216, 0.41241569, -0.86171364 },
-    { 88, -0.29819851, 0.38768326, 0.87222665 },
-    { 89, -0.38036486, 0.43485741, -0.81622399 },
-    { 90, -0.66098703, 0.74202265, 0.11179686 },
-    { 91, -0.68902978, 0.71729251, 0.10358290 },
-    { 92, -0.47113408, 0.47437687, 0.74363920 },
-    { 93, -0.53108884, 0.49526445, -0.68750111 },
-    { 94, -0.25882588, 0.23059732, -0.93799469 },
-    { 95, -0.38718228, 0.33335136, -0.85963175 },
-    { 96, -0.63457113, 0.52749728, 0.56485936 },
-    { 97, -0.44264877, 0.36452242, -0.81925910 },
-    { 98, -0.77793290, 0.61004566, -0.15054797 },
-    { 99, -0.43345261, 0.32894119, -0.83899733 },
-    { 100, -0.49662797, 0.37128161, 0.78454485 },
-    { 101, -0.76279590, 0.50559370, 0.40313450 },
-    { 102, -0.35257994, 0.23093659, -0.90683829 },
-    { 103, -0.86450700, 0.45785691, 0.20735162 },
-    { 104, -0.30535456, 0.15268030, -0.93991878 },
-    { 105, -0.43216657, 0.20825854, -0.87741691 },
-    { 106, -0.85244989, 0.39764266, 0.33942524 },
-    { 107, -0.68197324, 0.30960778, 0.66261264 },
-    { 108, -0.43979468, 0.17763338, -0.88035619 },
-    { 109, -0.40798277, 0.14255963, -0.90179089 },
-    { 110, -0.61758048, 0.20433878, -0.75949985 },
-    { 111, -0.91540045, 0.29027720, -0.27889276 },
-    { 112, -0.53591618, 0.13899697, 0.83275068 },
-    { 113, -0.45910845, 0.11504195, 0.88089998 },
-    { 114, -0.69613398, 0.15539925, 0.70089126 },
-    { 115, -0.91781115, 0.18628514, 0.35060026 },
-    { 116, -0.94480690, 0.19119008, 0.26605689 },
-    { 117, -0.45115157, 0.04785159, -0.89116356 },
-    { 118, -0.96672925, 0.04616205, 0.25160211 },
-    { 119, -0.59187264, 0.01594060, 0.80587386 },
-    { 120, -0.63265711, -0.02308532, -0.77408788 },
-    { 121, -0.92217667, -0.04076878, -0.38461421 },
-    { 122, -0.51765716, -0.03426013, -0.85490193 },
-    { 123, -0.54292990, -0.03659475, 0.83898030 },
-    { 124, -0.95122913, -0.06571483, -0.30140456 },
-    { 125, -0.44940559, -0.05239353, -0.89179007 },
-    { 126, -0.95061548, -0.12458713, -0.28426793 },
-    { 127, -0.53797750, -0.07361122, -0.83973900 },
-    { 128, -0.90746653, -0.13718971, -0.39709380 },
-    { 129, -0.35148094, -0.05753316, -0.93442554 },
-    { 130, -0.64584179, -0.11830137, -0.75425007 },
-    { 131, -0.98320416, -0.18074754, -0.02529624 },
-    { 132, -0.36528003, -0.07478385, -0.92788894 },
-    { 133, -0.49379549, -0.10433355, -0.86329632 },
-    { 134, -0.54429170, -0.13074124, 0.82864545 },
-    { 135, -0.96900184, -0.23983985, 0.05926454 },
-    { 136, -0.76124819, -0.18990874, 0.62002892 },
-    { 137, -0.94585126, -0.26310502, 0.19010825 },
-    { 138, -0.86536020, -0.31035889, -0.39348326 },
-    { 139, -0.75258253, -0.27615511, -0.59779419 },
-    { 140, -0.53654335, -0.20575468, 0.81840470 },
-    { 141, -0.91407976, -0.35635452, -0.19357078 },
-    { 142, -0.91579551, -0.40151015, -0.01040090 },
-    { 143, -0.53964316, -0.25131840, -0.80350751 },
-    { 144, -0.58145682, -0.29480627, 0.75828572 },
-    { 145, -0.83253779, -0.45525958, 0.31562564 },
-    { 146, -0.59392145, -0.32766138, -0.73477570 },
-    { 147, -0.42393758, -0.25428470, -0.86926188 },
-    { 148, -0.76108747, -0.46809207, -0.44903861 },
-    { 149, -0.68529365, -0.42278656, -0.59297903 },
-    { 150, -0.78373804, -0.52700985, 0.32865682 },
-    { 151, -0.61817782, -0.48331799, 0.61988701 },
-    { 152, -0.57709925, -0.46527606, -0.67117408 },
-    { 153, -0.37373042, -0.31264375, -0.87325796 },
-    { 154, -0.37374668, -0.31272702, -0.87322118 },
-    { 155, -0.51495147, -0.43953647, -0.73595698 },
-    { 156, -0.32105344, -0.27544693, -0.90612012 },
-    { 157, -0.66948372, -0.58705695, 0.45514360 },
-    { 158, -0.20072763, -0.18507471, 0.96200612 },
-    { 159, -0.70607148, -0.65199833, -0.27633539 },
-    { 160, -0.51931042, -0.51270247, -0.68370525 },
-    { 161, -0.52653742, -0.52269931, -0.67048026 },
-    { 162, -0.62792087, -0.65063452, -0.42707154 },
-    { 163, -0.64400081, -0.74745159, -0.16303094 },
-    { 164, -0.23502821, -0.27740919, -0.93156099 },
-    { 165, -0.19964205, -0.23946727, 0.95015708 },
-    { 166, -0.48421463, -0.58413220, -0.65140292 },
-    { 167, -0.45057235, -0.54991128, -0.70326534 },
-    { 168, -0.32281578, -0.40196760, 0.85686173 },
-    { 169, -0.52917488, -0.71963701, 0.44955147 },
-    { 170, -0.44476292, -0.60736337, -0.65825198 },
-    { 171, -0.55472146, -0.82447554, 0.11191155 },
-    { 172, -0.23179957, -0.38254615, -0.89438661 },
-    { 173, -0.45284935, -0.77536268, -0.44015926 },
-    { 174, -0.46036872, -0.80006868, -0.38464366 },
-    { 175, -0.45096319, -0.82572926, -0.33882648 },
-    { 176, -0.44392160, -0.89374646, -0.06442738 },
-    { 177, -0.42780889, -0.90015926, -0.08180993 },
-    { 178, -0.37690932, -0.81935330, -0.43197167 },
-    { 179, -0.19400576, -0.43570202, 0.87893431 },
-    { 180, -0.34481572, -0.82641235, -0.44513453 },
-    { 181, -0.35525149, -0.85999792, 0.36633312 },
-    { 182, -0.31620488, -0.82248293, -0.47279626 },
-    { 183, -0.34764531, -0.91951708, -0.18338779 },
-    { 184, -0.28678788, -0.80197387, 0.52401396 },
-    { 185, -0.10961530, -0.34071911, -0.93375317 },
-    { 186, -0.24784730, -0.78811813, -0.56341949 },
-    { 187, -0.23066830, -0.75296178, -0.61631217 },
-    { 188, -0.26503276, -0.95038013, 0.16289644 },
-    { 189, -0.14801638, -0.53939670, -0.82894050 },
-    { 190, -0.09114140, -0.40105577, 0.91150837 },
-    { 191, -0.20678985, -0.94009814, -0.27102295 },
-    { 192, -0.15098992, -0.71268985, -0.68503666 },
-    { 193, -0.19042956, -0.94972199, 0.24852511 },
-    { 194, -0.17691747, -0.89007510, 0.42007919 },
-    { 195, -0.15603327, -0.78528406, 0.59915154 },
-    { 196, -0.14954659, -0.89388840, -0.42261016 },
-    { 197, -0.08536617, -0.55950227, -0.82442091 },
-    { 198, -0.08329138, -0.54741556, -0.83270568 },
-    { 199, -0.07867239, -0.60642644, 0.79123804 },
-    { 200, -0.10120627, -0.78905452, -0.60592926 },
-    { 201, -0.07897887, -0.63958635, -0.76465132 },
-    { 202, -0.09163715, -0.79226246, -0.60326017 },
-    { 203, -0.10654322, -0.97023431, 0.21747168 },
-    { 204, -0.07226330, -0.72780092, -0.68197055 },
-    { 205, -0.05929927, -0.77455057, -0.62972615 },
-    { 206, -0.07182162, -0.99423427, 0.07962336 },
-    { 207, -0.04140065, -0.76349633, -0.64448378 },
-    { 208, -0.03531185, -0.79739824, -0.60241939 },
-    { 209, -0.00921998, -0.62259728, 0.78248810 },
-    { 210, -0.00418549, -0.98547807, -0.16975113 },
-    { 211, 0.02185314, -0.86202777, -0.50638974 },
-    { 212, 0.06156282, -0.79876711, -0.59848235 },
-    { 213, 0.07935591, -0.86388501, -0.49739856 },
-    { 214, 0.09275300, -0.99440550, -0.05054277 },
-    { 215, 0.08688152, -0.82068209, -0.56474110 },
-    { 216, 0.10995667, -0.89645787, -0.42927009 },
-    { 217, 0.12508927, -0.76942200, 0.62637246 },
-    { 218, 0.17634140, -0.87345665, -0.45384710 },
-    { 219, 0.21409626, -0.87057333, -0.44301790 },
-    { 220, 0.21407557, -0.81392740, 0.54008688 },
-    { 221, 0.23394485, -0.83491298, -0.49818683 },
-    { 222, 0.27334503, -0.93159435, 0.23961316 },
-    { 223, 0.25501826, -0.84812798, -0.46437552 },
-    { 224, 0.27977151, -0.89051976, -0.35875124 },
-    { 225, 0.11832262, -0.36119401, 0.92495332 },
-    { 226, 0.36391541, -0.92984596, 0.05433289 },
-    { 227, 0.34058277, -0.81497408, 0.46885033 },
-    { 228, 0.31195946, -0.63277192, 0.70871785 },
-    { 229, 0.43956030, -0.87912732, 0.18417898 },
-    { 230, 0.45920230, -0.87485522, 0.15414797 },
-    { 231, 0.54203539, -0.84023335, -0.01433696 },
-    { 232, 0.55808242, -0.78958960, -0.25513190 },
-    { 233, 0.44378637, -0.62085622, 0.64621298 },
-    { 234, 0.32558999, -0.44142797, -0.83614144 },
-    { 235, 0.43043988, -0.52418231, -0.73481590 },
-    { 236, 0.45564902, -0.53618214, 0.71055800 },
-    { 237, 0.55009573, -0.62063854, 0.55875083 },
-    { 238, 0.64446135, -0.57552534, 0.50342840 },
-    { 239, 0.35086091, -0.29814080, 0.88769853 },
-    { 240, 0.26284497, -0.20414152, 0.94299457 },
-    { 241, 0.79370820, -0.60050179, -0.09708187 },
-    { 242, 0.81720079, -0.55024615, 0.17149938 },
-    { 243, 0.80346621, -0.52658463, -0.27776010 },
-    { 244, 0.67753636, -0.41548941, -0.60688799 },
-    { 245, 0.87835282, -0.47798031, -0.00558200 },
-    { 246, 0.60293557, -0.31980650, -0.73088474 },
-    { 247, 0.46830284, -0.24156846, 0.84990419 },
-    { 248, 0.44821546, -0.21258162, -0.86828103 },
-    { 249, 0.64492745, -0.22627511, -0.72997819 },
-    { 250, 0.81577834, -0.28487399, 0.50334134 },
-    { 251, 0.92327101, -0.27063655, -0.27262887 },
-    { 252, 0.83733161, -0.23360173, -0.49427322 },
-    { 253, 0.85585129, -0.21429139, 0.47074173 },
-    { 254, 0.93709683, -0.23034527, 0.26227959 },
-    { 255, 0.21332150, -0.01927329, 0.97679193 },
-};
@@ -0,0 +1,889 @@
+// /star-tracker     gvbench
+// ----------------------------------------------------------
+// Host benchmark for the gvalg star-ID solver, fed by the synthetic
+// scene generator (scene.hpp).
+//
+//   1. Size sweep: noise-free frames of exactly 4-50 centroids (the n
+//      catalog stars nearest a random boresight in a wide FOV).
+//      Reports ns/solve, votes cast, bins touched and the fraction of
+//      centroids given their true catalog index, plus ns to build the
+//      frame's pair table from its unit vectors (gv_tabulate_pairs).
+//
+//   2. Scene run: thousands of camera-like frames with centroid noise,
+//      false stars and dropouts. Reports solves/s, success rate and
+//      per-solve latency percentiles. With --select, each frame goes
+//      through gv_select_pairs() first (included in the latency).
+//      A frame succeeds when at least 3 centroids carry their true ID
+//      and no verified centroid (v2 > 0) carries a wrong one.
+//
+//   3. Track run (--track RATE): the scene run's frames come in
+//      sequences of kTrackFrames with the pointing drifting RATE degrees
+//      per frame. gv_track_frame() identifies each frame from the last
+//      one, and only when it loses the track does gvalg() solve the frame
+//      and re-seed it. Reports success and latency split into tracked and
+//      lost-in-space frames.
+//
+//   4. Attitude run (--attitude): the scene run's frames are solved by
+//      gvalg() and the verified matches handed to gv_attitude() (QUEST).
+//      Reports ns/solve against Davenport's q-method (Jacobi on K, in
+//      double) on the same matches, how far apart the two answers are,
+//      and each one's error against the scene's true attitude.
+//
+//   usage: gvbench [options]
+//     --frames N    frames per size in the sweep   (default 200)
+//     --reps N      timed passes over each batch   (default 5)
+//     --scenes N    frames in the scene run        (default 5000)
+//     --fov X Y     scene-run FOV in degrees       (default 40 22.5)
+//     --noise MDEG  scene-run centroid noise       (default 20)
+//     --false N     scene-run false stars / frame  (default 1)
+//     --drop P      scene-run dropout probability  (default 0.05)
+//     --max-stars N scene-run: keep the N stars nearest boresight (default all)
+//     --loc-err MDEG scene-run pair tolerance      (default 2 sigma of a
+//                   pair angle, i.e. 2 * sqrt(2) * noise, at least 10)
+//     --lookup L    first-round angle index: bins | kvector (default bins)
+//     --engine E    first-round engine: votes | bitset (default votes)
+//     --verify V    second-round check: cosine | adjacency | matrix (default cosine)
+//     --select K NN scene run: keep the K brightest centroids, each paired
+//                   with its NN nearest (gv_select_pairs; default: all pairs)
+//     --triangles   scene run: gv_triangle_id() instead of gvalg()
+//     --hash        scene run: gv_hash_id() instead of gvalg()
+//     --track RATE  track run instead of the scene run, RATE deg/frame
+//     --attitude    attitude run instead of the scene run
+//     --seed S      RNG seed
+//     --numeric     only run the numeric check below
+//
+//   Numeric check: for every catalog pair in the binned range, how far
+//   the solver's cosine-space verification (gv_dot3 on the gv_real table
+//   vs gv_cos_mdeg of the pair angle) is from long double math on a
+//   double copy of the catalog, as an angle. Fails if the error bound is
+//   exceeded, so it matters for GV_REAL=float builds. Cosines flatten out
+//   near 0, so the closest pairs are left out (kNumericMinMdeg). Also
+//   checks gv_tabulate_pairs() on the whole catalog the same way, and
+//   that gv_adj_angle_mdeg() has every pair inside ADJ_MAX_ANGLE_MDEG
+//   and gv_matrix_angle_mdeg() (unless generated off) every pair inside
+//   CATALOG_MAX_ANGLE_MDEG.
+// ----------------------------------------------------------
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "gvalg.h"
+#include "gvatt.h"
+#include "gvpairs.h"
+#include "gvtri.h"
+#include "gvhash.h"
+#include "gvtrack.h"
+#include "catalog_luts.h"
+#include "catalog_xyz.h"
+#include "tab_cat.h"
+#include "catalog_triangles.h"
+#include "catalog_hash.h"
+#include "catalog_adjacency.h"
+#include "catalog_angle_matrix.h"
+#include "scene.hpp"
+
+extern "C" const double gv_cat_ref[CATALOG_SIZE][4];  // catalog_ref.c
+
+namespace {
+
+constexpr int kMaxStars = 64;
+constexpr int kMaxVotes = kMaxStars * 8192;  // shared vote pool, bytes
+constexpr double kSweepLocErr = 10.0;  // millidegrees; sweep frames only carry rounding error
+constexpr double kNumericBoundMdeg = 1.0;  // a tenth of the tightest loc_err above
+constexpr double kNumericMinMdeg = 250.0;  // ~12 px on the IMX290; closer pairs merge anyway
+constexpr int kTrackFrames = 100;  // frames per track-run sequence
+
+using Clock = std::chrono::steady_clock;
+
+struct Score {
+    int correct = 0;        // centroids holding their true catalog index
+    int wrong_verified = 0; // verified centroids holding someone else's index
+};
+
+Score score(const scene::Scene &s, const int *id, const gv_real *v2) {
+    Score sc;
+    for (int i = 0; i < s.n_stars(); i++) {
+        if (id[i] != GV_ID_NONE && id[i] == s.stars[i].truth) {
+            sc.correct++;
+        } else if (v2[i] > 0) {
+            sc.wrong_verified++;
+        }
+    }
+    return sc;
+}
+
+bool solve(gv_workspace *ws, const scene::Scene &s, double loc_err, int *id, gv_real *v2) {
+    return gvalg(ws, cat, s.rows(), (gv_real)loc_err, id, v2, s.n_image(), s.n_stars()) == 0;
+}
+
+// a scene's star vectors in the solver's precision, rows of 3
+std::vector<gv_real> star_vectors(const scene::Scene &s) {
+    std::vector<gv_real> v;
+    for (const scene::SceneStar &st : s.stars) {
+        v.insert(v.end(), {(gv_real)st.v[0], (gv_real)st.v[1], (gv_real)st.v[2]});
+    }
+    return v;
+}
+
+const gv_real (*as_rows(const std::vector<gv_real> &v))[3] {
+    return reinterpret_cast<const gv_real (*)[3]>(v.data());
+}
+
+double percentile(std::vector<double> &v, double p) {
+    if (v.empty()) return 0.0;
+    size_t k = (size_t)(p * (v.size() - 1) + 0.5);
+    std::nth_element(v.begin(), v.begin() + k, v.end());
+    return v[k];
+}
+
+void size_sweep(gv_workspace *ws, int frames, int reps, std::mt19937 &rng) {
+    const int sizes[] = {4, 5, 6, 8, 10, 15, 20, 30, 40, 50};
+
+    scene::SceneConfig cfg;
+    cfg.fov_x_deg = cfg.fov_y_deg = 120.0;
+
+    std::printf("size sweep (%d noise-free frames per size)\n", frames);
+    std::printf("%6s %7s %12s %12s %11s %9s %10s\n",
+                "stars", "pairs", "ns/solve", "votes/solve", "bins/solve", "correct", "ns/pairs");
+
+    for (int n : sizes) {
+        cfg.max_stars = n;
+        std::vector<scene::Scene> batch;
+        while ((int)batch.size() < frames) {
+            scene::Scene s = scene::make_scene(scene::random_pointing(rng), cfg, rng);
+            if (s.n_stars() == n) batch.push_back(std::move(s));
+        }
+
+        int id[kMaxStars];
+        gv_real v2[kMaxStars];
+        long votes = 0, bins = 0, correct = 0;
+
+        // one untimed pass for the counters and accuracy
+        for (const scene::Scene &s : batch) {
+            solve(ws, s, kSweepLocErr, id, v2);
+            votes += ws->votes_cast;
+            bins += ws->bins_touched;
+            correct += score(s, id, v2).correct;
+        }
+
+        auto t0 = Clock::now();
+        for (int r = 0; r < reps; r++) {
+            for (const scene::Scene &s : batch) solve(ws, s, kSweepLocErr, id, v2);
+        }
+        auto t1 = Clock::now();
+
+        // pair tabulation from the same frames' unit vectors
+        std::vector<std::vector<gv_real>> vecs;
+        for (const scene::Scene &s : batch) vecs.push_back(star_vectors(s));
+        std::vector<gv_real> rows(3 * GV_MAX_PAIRS(n));
+        gv_real (*tab)[3] = reinterpret_cast<gv_real (*)[3]>(rows.data());
+        auto t2 = Clock::now();
+        for (int r = 0; r < reps; r++) {
+            for (const std::vector<gv_real> &v : vecs) gv_tabulate_pairs(as_rows(v), n, tab, GV_MAX_PAIRS(n));
+        }
+        auto t3 = Clock::now();
+
+        double solves = (double)frames * reps;
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / solves;
+        double ns_pairs = std::chrono::duration<double, std::nano>(t3 - t2).count() / solves;
+        std::printf("%6d %7d %12.0f %12.1f %11.1f %8.1f%% %10.0f\n",
+                    n, n * (n - 1) / 2, ns, (double)votes / frames, (double)bins / frames,
+                    100.0 * correct / ((double)frames * n), ns_pairs);
+    }
+}
+
+// brightest-K / k-nearest-neighbour pair selection (0 = every pair)
+struct Select {
+    int k_bright = 0;
+    int k_nn = 0;
+};
+
+// a frame as a camera front end would hand it over
+struct FrameInput {
+    std::vector<gv_real> v;       // unit vectors, rows of 3
+    std::vector<gv_real> flux;    // brightness per centroid
+};
+
+// gv_select_pairs() + gvalg() on the selected slots, with the answers
+// mapped back onto the scene's centroids (unselected ones stay GV_ID_NONE)
+bool solve_selected(gv_workspace *ws, const FrameInput &in, int n_stars, const Select &select, double loc_err,
+                    int *id, gv_real *v2) {
+    int sel[GV_SELECT_MAX_BRIGHT], n_sel = 0;
+    int sid[GV_SELECT_MAX_BRIGHT];
+    gv_real sv2[GV_SELECT_MAX_BRIGHT];
+    gv_real rows[GV_SELECT_MAX_BRIGHT * GV_SELECT_MAX_NN][3];
+
+    int n_image = gv_select_pairs(as_rows(in.v), in.flux.data(), n_stars, select.k_bright, select.k_nn, sel, &n_sel,
+                                  rows, select.k_bright * select.k_nn);
+    int rc = gvalg(ws, cat, rows, (gv_real)loc_err, sid, sv2, n_image, n_sel);
+
+    for (int i = 0; i < n_stars; i++) {
+        id[i] = GV_ID_NONE;
+        v2[i] = 0;
+    }
+    for (int k = 0; k < n_sel; k++) {
+        id[sel[k]] = sid[k];
+        v2[sel[k]] = sv2[k];
+    }
+    return rc == 0;
+}
+
+// scene-run solver: gvalg() on tab_image, or one of the solvers that
+// start from unit vectors
+enum class Method { Vote, Triangles, Hash };
+
+// gv_triangle_id() / gv_hash_id() with the centroids handed over
+// brightest first, as both only use the first few
+bool solve_vectors(Method method, const FrameInput &in, int n_stars, double loc_err, int *id, gv_real *v2) {
+    int order[kMaxStars], sid[kMaxStars];
+    gv_real sv[kMaxStars][3], sv2[kMaxStars];
+    for (int i = 0; i < n_stars; i++) order[i] = i;
+    std::sort(order, order + n_stars, [&](int a, int b) { return in.flux[a] > in.flux[b]; });
+    for (int k = 0; k < n_stars; k++) {
+        for (int c = 0; c < 3; c++) sv[k][c] = in.v[3 * order[k] + c];
+    }
+
+    int n_id = (method == Method::Hash) ? gv_hash_id(cat, sv, n_stars, (gv_real)loc_err, sid, sv2)
+                                        : gv_triangle_id(cat, sv, n_stars, (gv_real)loc_err, sid, sv2);
+    for (int k = 0; k < n_stars; k++) {
+        id[order[k]] = sid[k];
+        v2[order[k]] = sv2[k];
+    }
+    return n_id > 0;
+}
+
+void scene_run(gv_workspace *ws, int scenes, const scene::SceneConfig &cfg, double loc_err, const Select &select,
+               Method method, std::mt19937 &rng) {
+    bool vectors = (method != Method::Vote);
+    std::vector<scene::Scene> batch;
+    std::vector<FrameInput> inputs;
+    long stars = 0;
+    int most = 0;
+    for (int k = 0; k < scenes; k++) {
+        scene::Scene s = scene::make_scene(scene::random_pointing(rng), cfg, rng);
+        // without selection every centroid goes to the solver
+        if ((select.k_bright == 0 || vectors) && s.n_stars() > kMaxStars) continue;
+        stars += s.n_stars();
+        most = std::max(most, s.n_stars());
+        if (select.k_bright > 0 || vectors) {
+            FrameInput in;
+            in.v = star_vectors(s);
+            for (const scene::SceneStar &st : s.stars) in.flux.push_back((gv_real)st.flux());
+            inputs.push_back(std::move(in));
+        }
+        batch.push_back(std::move(s));
+    }
+
+    std::vector<int> id(std::max(1, most));
+    std::vector<gv_real> v2(std::max(1, most));
+    std::vector<double> lat_us;
+    lat_us.reserve(batch.size());
+    int solvable = 0, solved = 0, wrong = 0, rejected = 0;
+    long peak_votes = 0;
+
+    auto t0 = Clock::now();
+    for (size_t f = 0; f < batch.size(); f++) {
+        const scene::Scene &s = batch[f];
+        auto a = Clock::now();
+        bool ok = vectors              ? solve_vectors(method, inputs[f], s.n_stars(), loc_err, id.data(), v2.data())
+                  : select.k_bright > 0 ? solve_selected(ws, inputs[f], s.n_stars(), select, loc_err, id.data(), v2.data())
+                                        : solve(ws, s, loc_err, id.data(), v2.data());
+        auto b = Clock::now();
+        rejected += !ok;
+        peak_votes = std::max(peak_votes, ws->votes_cast);
+        lat_us.push_back(std::chrono::duration<double, std::micro>(b - a).count());
+
+        int real = 0;
+        for (const scene::SceneStar &st : s.stars) real += (st.truth >= 0);
+        Score sc = score(s, id.data(), v2.data());
+        solvable += (real >= 3);
+        solved += (sc.correct >= 3 && sc.wrong_verified == 0);
+        wrong += (sc.wrong_verified > 0);
+    }
+    auto t1 = Clock::now();
+    double secs = std::chrono::duration<double>(t1 - t0).count();
+
+    std::printf("\nscene run (%zu frames, FOV %.1fx%.1f deg, noise %.0f mdeg, %d false, %.0f%% dropout, "
+                "loc_err %.0f mdeg)\n",
+                batch.size(), cfg.fov_x_deg, cfg.fov_y_deg, cfg.noise_mdeg, cfg.false_stars,
+                100.0 * cfg.dropout, loc_err);
+    if (method == Method::Triangles) {
+        std::printf("  triangle index    first %d brightest, sides <= %d mdeg\n", GV_TRI_MAX_STARS,
+                    TRI_MAX_SIDE_MDEG);
+    } else if (method == Method::Hash) {
+        std::printf("  geometric hash    first %d brightest, %d mdeg cells, filed +/- %d mdeg\n",
+                    GV_HASH_MAX_STARS, HASH_CELL_MDEG, HASH_TOL_MDEG);
+    } else if (select.k_bright > 0) {
+        std::printf("  pair selection    %d brightest, %d nearest each (<= %d pairs)\n", select.k_bright,
+                    select.k_nn, select.k_bright * select.k_nn);
+    }
+    std::printf("  mean stars/frame  %8.1f  (max %d)\n", batch.empty() ? 0.0 : (double)stars / batch.size(), most);
+    std::printf("  solves/s          %8.0f\n", batch.size() / secs);
+    std::printf("  success           %7.1f%%  (%.1f%% of frames with >= 3 real stars)\n",
+                100.0 * solved / std::max<size_t>(1, batch.size()), 100.0 * solved / std::max(1, solvable));
+    std::printf("  wrong verified ID %7.1f%%\n", 100.0 * wrong / std::max<size_t>(1, batch.size()));
+    if (method == Method::Triangles) {
+        std::printf("  no unique triangle %7d frames\n", rejected);
+    } else if (method == Method::Hash) {
+        std::printf("  nothing identified %7d frames\n", rejected);
+    } else {
+        std::printf("  votes/frame peak  %8ld  (pool %d, %d frames over)\n", peak_votes, kMaxVotes, rejected);
+    }
+    std::printf("  latency us  p50 %.2f  p90 %.2f  p99 %.2f  max %.2f\n",
+                percentile(lat_us, 0.50), percentile(lat_us, 0.90), percentile(lat_us, 0.99),
+                percentile(lat_us, 1.0));
+}
+
+// frames of a sequence: the boresight slews rate_deg per frame along its
+// meridian (a great circle, turning back short of the poles) while the
+// camera rolls half as fast
+std::vector<scene::Scene> drift_sequence(const scene::SceneConfig &cfg, double rate_deg, std::mt19937 &rng) {
+    scene::Pointing p = scene::random_pointing(rng);
+    double d_dec = (rng() & 1) ? rate_deg : -rate_deg;
+    std::vector<scene::Scene> seq;
+    for (int k = 0; k < kTrackFrames; k++) {
+        seq.push_back(scene::make_scene(p, cfg, rng));
+        if (std::fabs(p.dec_deg + d_dec) > 89.0) d_dec = -d_dec;
+        p.dec_deg += d_dec;
+        p.roll_deg += 0.5 * rate_deg;
+    }
+    return seq;
+}
+
+void track_run(gv_workspace *ws, int scenes, const scene::SceneConfig &cfg, double loc_err, double rate_deg,
+               std::mt19937 &rng) {
+    int sequences = std::max(1, scenes / kTrackFrames);
+    std::vector<std::vector<scene::Scene>> seqs;
+    std::vector<std::vector<std::vector<gv_real>>> vecs;
+    int most = 0;
+    for (int q = 0; q < sequences; q++) {
+        seqs.push_back(drift_sequence(cfg, rate_deg, rng));
+        vecs.emplace_back();
+        for (const scene::Scene &s : seqs.back()) {
+            most = std::max(most, s.n_stars());
+            vecs.back().push_back(star_vectors(s));
+        }
+    }
+
+    // slew plus roll moves a star at most 1.5 * rate_deg, and noise adds
+    // up to a pair angle's worth
+    double max_motion = 1500.0 * rate_deg + 2.0 * loc_err;
+    std::vector<int> id(std::max(1, most));
+    std::vector<gv_real> v2(std::max(1, most));
+    std::vector<double> lat_track, lat_lis, lat_same;
+    std::vector<const scene::Scene *> tracked_frames;
+    int frames = 0, skipped = 0, solvable = 0, solved = 0, wrong = 0, tracked = 0, lost = 0;
+    long overflows = 0;
+
+    auto t0 = Clock::now();
+    for (size_t q = 0; q < seqs.size(); q++) {
+        gv_track t;
+        gv_track_init(&t, (gv_real)max_motion);
+        for (size_t f = 0; f < seqs[q].size(); f++) {
+            const scene::Scene &s = seqs[q][f];
+            if (s.n_stars() > kMaxStars) {
+                skipped++;
+                continue;
+            }
+            const gv_real (*v)[3] = as_rows(vecs[q][f]);
+            bool was_valid = t.valid;
+            auto a = Clock::now();
+            bool by_track = gv_track_frame(&t, cat, v, s.n_stars(), (gv_real)loc_err, id.data(), v2.data()) > 0;
+            bool ok = by_track;
+            if (!ok) {
+                ok = solve(ws, s, loc_err, id.data(), v2.data());
+                if (ok) gv_track_seed(&t, cat, v, s.n_stars(), id.data(), v2.data());
+            }
+            auto b = Clock::now();
+
+            double us = std::chrono::duration<double, std::micro>(b - a).count();
+            int real = 0;
+            for (const scene::SceneStar &st : s.stars) real += (st.truth >= 0);
+            Score sc = score(s, id.data(), v2.data());
+            frames++;
+            solvable += (real >= 3);
+            solved += (sc.correct >= 3 && sc.wrong_verified == 0);
+            wrong += (sc.wrong_verified > 0);
+            lost += (was_valid && !by_track);
+            if (by_track) {
+                tracked++;
+                lat_track.push_back(us);
+                tracked_frames.push_back(&s);
+            } else {
+                lat_lis.push_back(us);
+            }
+        }
+        overflows += t.cand_overflows;
+    }
+    auto t1 = Clock::now();
+    double secs = std::chrono::duration<double>(t1 - t0).count();
+
+    // what lost-in-space would have cost on the frames tracking handled
+    for (const scene::Scene *s : tracked_frames) {
+        auto a = Clock::now();
+        solve(ws, *s, loc_err, id.data(), v2.data());
+        auto b = Clock::now();
+        lat_same.push_back(std::chrono::duration<double, std::micro>(b - a).count());
+    }
+
+    std::printf("\ntrack run (%d sequences of %d frames, %.2f deg/frame, FOV %.1fx%.1f deg, noise %.0f mdeg, "
+                "%d false, %.0f%% dropout, loc_err %.0f mdeg)\n",
+                sequences, kTrackFrames, rate_deg, cfg.fov_x_deg, cfg.fov_y_deg, cfg.noise_mdeg, cfg.false_stars,
+                100.0 * cfg.dropout, loc_err);
+    std::printf("  frames/s          %8.0f  (%d frames over %d stars skipped)\n", frames / secs, skipped, kMaxStars);
+    std::printf("  success           %7.1f%%  (%.1f%% of frames with >= 3 real stars)\n",
+                100.0 * solved / std::max(1, frames), 100.0 * solved / std::max(1, solvable));
+    std::printf("  wrong verified ID %7.1f%%\n", 100.0 * wrong / std::max(1, frames));
+    std::printf("  tracked           %7.1f%%  (track lost %d times, %ld to over %d candidates)\n",
+                100.0 * tracked / std::max(1, frames), lost, overflows, GV_TRACK_MAX_CAND);
+    std::printf("  latency us   tracked       p50 %.2f  p90 %.2f  p99 %.2f\n", percentile(lat_track, 0.50),
+                percentile(lat_track, 0.90), percentile(lat_track, 0.99));
+    std::printf("               gvalg, same   p50 %.2f  p90 %.2f  p99 %.2f\n", percentile(lat_same, 0.50),
+                percentile(lat_same, 0.90), percentile(lat_same, 0.99));
+    std::printf("               lost-in-space p50 %.2f  p90 %.2f  p99 %.2f  (untracked frames)\n",
+                percentile(lat_lis, 0.50), percentile(lat_lis, 0.90), percentile(lat_lis, 0.99));
+}
+
+// ---- q-method reference ----
+// Davenport's K for the verified matches, weights 1/n, and its largest
+// eigenvector by cyclic Jacobi: the textbook answer QUEST approximates.
+// Returns false with fewer than two matches.
+bool q_method(const gv_real v[][3], int n_stars, const int *id, const gv_real *v2, double q[4]) {
+    double B[3][3] = {};
+    int n = 0;
+    for (int i = 0; i < n_stars; i++) {
+        if (id[i] == GV_ID_NONE || v2[i] <= 0) continue;
+        for (int j = 0; j < 3; j++) {
+            for (int k = 0; k < 3; k++) B[j][k] += (double)v[i][j] * (double)cat[id[i]][1 + k];
+        }
+        n++;
+    }
+    if (n < 2) return false;
+
+    double sigma = (B[0][0] + B[1][1] + B[2][2]) / n;
+    double K[4][4], E[4][4] = {};
+    for (int j = 0; j < 3; j++) {
+        for (int k = 0; k < 3; k++) K[j][k] = (B[j][k] + B[k][j]) / n;
+        K[j][j] -= sigma;
+        E[j][j] = 1.0;
+    }
+    K[0][3] = K[3][0] = (B[1][2] - B[2][1]) / n;
+    K[1][3] = K[3][1] = (B[2][0] - B[0][2]) / n;
+    K[2][3] = K[3][2] = (B[0][1] - B[1][0]) / n;
+    K[3][3] = sigma;
+    E[3][3] = 1.0;
+
+    for (int sweep = 0; sweep < 50; sweep++) {
+        double off = 0.0;
+        for (int p = 0; p < 4; p++) {
+            for (int r = p + 1; r < 4; r++) off += K[p][r] * K[p][r];
+        }
+        if (off < 1e-30) break;
+        for (int p = 0; p < 4; p++) {
+            for (int r = p + 1; r < 4; r++) {
+                if (K[p][r] == 0.0) continue;
+                double theta = (K[r][r] - K[p][p]) / (2.0 * K[p][r]);
+                double t = (theta >= 0 ? 1.0 : -1.0) / (std::fabs(theta) + std::sqrt(theta * theta + 1.0));
+                double c = 1.0 / std::sqrt(t * t + 1.0), sn = t * c;
+                for (int k = 0; k < 4; k++) {
+                    double kp = K[k][p], kr = K[k][r];
+                    K[k][p] = c * kp - sn * kr;
+                    K[k][r] = sn * kp + c * kr;
+                }
+                for (int k = 0; k < 4; k++) {
+                    double kp = K[p][k], kr = K[r][k];
+                    K[p][k] = c * kp - sn * kr;
+                    K[r][k] = sn * kp + c * kr;
+                }
+                for (int k = 0; k < 4; k++) {
+                    double ep = E[k][p], er = E[k][r];
+                    E[k][p] = c * ep - sn * er;
+                    E[k][r] = sn * ep + c * er;
+                }
+            }
+        }
+    }
+
+    int top = 0;
+    for (int k = 1; k < 4; k++) {
+        if (K[k][k] > K[top][top]) top = k;
+    }
+    double sign = (E[3][top] < 0) ? -1.0 : 1.0;
+    for (int k = 0; k < 4; k++) q[k] = sign * E[k][top];
+    return true;
+}
+
+// angle in mdeg between the rotations two unit quaternions describe
+double quat_angle_mdeg(const double a[4], const double b[4]) {
+    double dm = 0.0, dp = 0.0;
+    for (int k = 0; k < 4; k++) {
+        dm += (a[k] - b[k]) * (a[k] - b[k]);
+        dp += (a[k] + b[k]) * (a[k] + b[k]);
+    }
+    return 4.0 * std::asin(std::min(1.0, std::sqrt(std::min(dm, dp)) / 2.0)) * (180000.0 / M_PI);
+}
+
+// angle in mdeg between R(q) and a scene's true catalog -> body rotation
+double truth_error_mdeg(const double q[4], const scene::Scene &s) {
+    gv_real gq[4] = {(gv_real)q[0], (gv_real)q[1], (gv_real)q[2], (gv_real)q[3]};
+    gv_real R[3][3];
+    gv_quat_to_matrix(gq, R);
+    // trace of R * truth^T = 1 + 2 cos(angle); atan2 form keeps small angles
+    double tr = 0.0, skew[3];
+    double M[3][3];
+    for (int j = 0; j < 3; j++) {
+        for (int k = 0; k < 3; k++) {
+            M[j][k] = 0.0;
+            for (int m = 0; m < 3; m++) M[j][k] += (double)R[j][m] * s.R[k][m];
+        }
+        tr += M[j][j];
+    }
+    skew[0] = M[2][1] - M[1][2];
+    skew[1] = M[0][2] - M[2][0];
+    skew[2] = M[1][0] - M[0][1];
+    double sn = std::sqrt(skew[0] * skew[0] + skew[1] * skew[1] + skew[2] * skew[2]);
+    return std::atan2(sn, tr - 1.0) * (180000.0 / M_PI);
+}
+
+void attitude_run(gv_workspace *ws, int scenes, const scene::SceneConfig &cfg, double loc_err, int reps,
+                  std::mt19937 &rng) {
+    // frames gvalg() solved with at least two verified matches
+    struct Solved {
+        scene::Scene s;
+        std::vector<gv_real> v;
+        std::vector<int> id;
+        std::vector<gv_real> v2;
+        bool clean;  // no verified ID is wrong
+    };
+    std::vector<Solved> frames;
+    for (int k = 0; k < scenes; k++) {
+        scene::Scene s = scene::make_scene(scene::random_pointing(rng), cfg, rng);
+        if (s.n_stars() > kMaxStars) continue;
+        Solved f;
+        f.id.resize(std::max(1, s.n_stars()));
+        f.v2.resize(std::max(1, s.n_stars()));
+        if (!solve(ws, s, loc_err, f.id.data(), f.v2.data())) continue;
+        int verified = 0;
+        for (int i = 0; i < s.n_stars(); i++) verified += (f.id[i] != GV_ID_NONE && f.v2[i] > 0);
+        if (verified < 2) continue;
+        f.clean = score(s, f.id.data(), f.v2.data()).wrong_verified == 0;
+        f.v = star_vectors(s);
+        f.s = std::move(s);
+        frames.push_back(std::move(f));
+    }
+
+    std::vector<std::array<double, 4>> q_quest(frames.size()), q_ref(frames.size());
+    std::vector<double> residual(frames.size());
+    std::vector<bool> quest_ok(frames.size());
+
+    auto t0 = Clock::now();
+    for (int r = 0; r < reps; r++) {
+        for (size_t f = 0; f < frames.size(); f++) {
+            const Solved &fr = frames[f];
+            gv_real q[4], res = 0;
+            quest_ok[f] = gv_attitude(cat, as_rows(fr.v), fr.s.n_stars(), fr.id.data(), fr.v2.data(), q, &res) > 0;
+            for (int k = 0; k < 4; k++) q_quest[f][k] = (double)q[k];
+            residual[f] = (double)res;
+        }
+    }
+    auto t1 = Clock::now();
+    for (int r = 0; r < reps; r++) {
+        for (size_t f = 0; f < frames.size(); f++) {
+            const Solved &fr = frames[f];
+            q_method(as_rows(fr.v), fr.s.n_stars(), fr.id.data(), fr.v2.data(), q_ref[f].data());
+        }
+    }
+    auto t2 = Clock::now();
+
+    // wrong IDs leave no good fit to compare; the residual flags them
+    int failed = 0, clean = 0, dirty = 0;
+    double max_gap = 0.0, sum_gap2 = 0.0, sum_quest2 = 0.0, sum_ref2 = 0.0, res_clean = 0.0, res_dirty = 0.0;
+    for (size_t f = 0; f < frames.size(); f++) {
+        if (!quest_ok[f]) {
+            failed++;
+        } else if (!frames[f].clean) {
+            res_dirty += residual[f];
+            dirty++;
+        } else {
+            double gap = quat_angle_mdeg(q_quest[f].data(), q_ref[f].data());
+            double eq = truth_error_mdeg(q_quest[f].data(), frames[f].s);
+            double er = truth_error_mdeg(q_ref[f].data(), frames[f].s);
+            max_gap = std::max(max_gap, gap);
+            sum_gap2 += gap * gap;
+            sum_quest2 += eq * eq;
+            sum_ref2 += er * er;
+            res_clean += residual[f];
+            clean++;
+        }
+    }
+    double solves = std::max(1.0, (double)frames.size() * reps);
+
+    std::printf("\nattitude run (%zu of %d frames solved with >= 2 verified IDs, FOV %.1fx%.1f deg, noise %.0f mdeg, "
+                "%d false, %.0f%% dropout)\n",
+                frames.size(), scenes, cfg.fov_x_deg, cfg.fov_y_deg, cfg.noise_mdeg, cfg.false_stars,
+                100.0 * cfg.dropout);
+    std::printf("  ns/solve          QUEST %8.0f   q-method (Jacobi, double) %8.0f\n",
+                std::chrono::duration<double, std::nano>(t1 - t0).count() / solves,
+                std::chrono::duration<double, std::nano>(t2 - t1).count() / solves);
+    std::printf("  QUEST vs q-method max %.4f mdeg  rms %.4f mdeg  (%d frames without wrong IDs, %d rejected)\n",
+                max_gap, std::sqrt(sum_gap2 / std::max(1, clean)), clean, failed);
+    std::printf("  error vs truth    QUEST rms %.2f mdeg   q-method rms %.2f mdeg\n",
+                std::sqrt(sum_quest2 / std::max(1, clean)), std::sqrt(sum_ref2 / std::max(1, clean)));
+    std::printf("  mean residual     %.2f mdeg  (%.0f mdeg on the %d frames with a wrong verified ID)\n",
+                res_clean / std::max(1, clean), res_dirty / std::max(1, dirty), dirty);
+}
+
+// angle between catalog rows i and j in radians, long double atan2 form:
+// the 8-digit table vectors are not exactly unit length, which acos()
+// would read as angle
+long double ref_angle(int i, int j) {
+    const double *u = &gv_cat_ref[i][1], *v = &gv_cat_ref[j][1];
+    long double cx = (long double)u[1] * v[2] - (long double)u[2] * v[1];
+    long double cy = (long double)u[2] * v[0] - (long double)u[0] * v[2];
+    long double cz = (long double)u[0] * v[1] - (long double)u[1] * v[0];
+    long double dot = (long double)u[0] * v[0] + (long double)u[1] * v[1] + (long double)u[2] * v[2];
+    return std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), dot);
+}
+
+// gv_tabulate_pairs() over the whole catalog: max angle error in mdeg
+double pairs_check(long *kept, int *worst_i, int *worst_j) {
+    std::vector<gv_real> v;
+    for (int i = 0; i < CATALOG_SIZE; i++) v.insert(v.end(), {cat[i][1], cat[i][2], cat[i][3]});
+    std::vector<gv_real> rows(3 * GV_MAX_PAIRS(CATALOG_SIZE));
+    gv_real (*tab)[3] = reinterpret_cast<gv_real (*)[3]>(rows.data());
+    int n = gv_tabulate_pairs(as_rows(v), CATALOG_SIZE, tab, GV_MAX_PAIRS(CATALOG_SIZE));
+
+    double max_err = 0.0;
+    for (int k = 0; k < n; k++) {
+        int i = (int)tab[k][0], j = (int)tab[k][1];
+        double err = std::fabs((double)tab[k][2] - (double)(ref_angle(i, j) * (180000.0L / M_PI)));
+        if (err > max_err) {
+            max_err = err;
+            *worst_i = i;
+            *worst_j = j;
+        }
+    }
+    *kept = n;
+    return max_err;
+}
+
+int numeric_check() {
+    const double max_mdeg = (double)bin_count * CATALOG_BIN_WIDTH_MDEG;
+    double max_table = 0.0, max_err = 0.0, sum_sq = 0.0, worst_deg = 0.0;
+    int worst_i = 0, worst_j = 0;
+    long pairs = 0, close = 0;
+
+    for (int i = 0; i < CATALOG_SIZE; i++) {
+        for (int k = 1; k < 4; k++) {
+            max_table = std::max(max_table, std::fabs((double)cat[i][k] - gv_cat_ref[i][k]));
+        }
+    }
+
+    for (int i = 0; i < CATALOG_SIZE; i++) {
+        for (int j = i + 1; j < CATALOG_SIZE; j++) {
+            long double rad = ref_angle(i, j);
+            double ref = (double)(rad * (180000.0L / M_PI));
+            if (ref > max_mdeg) continue;
+            if (ref < kNumericMinMdeg) {
+                close++;
+                continue;
+            }
+
+            // verification compares gv_dot3() against gv_cos_mdeg() of the
+            // image angle; an exact image angle should land on the dot
+            // product, and the cosine gap over sin() is that miss in angle
+            double gap = (double)gv_dot3(&cat[i][1], &cat[j][1]) - (double)gv_cos_mdeg((gv_real)ref);
+            double err = std::fabs(gap) / (double)std::sin(rad) * (180000.0 / M_PI);
+            sum_sq += err * err;
+            pairs++;
+            if (err > max_err) {
+                max_err = err;
+                worst_i = i;
+                worst_j = j;
+                worst_deg = ref / 1000.0;
+            }
+        }
+    }
+
+    long kept = 0;
+    int pair_i = 0, pair_j = 0;
+    double pair_err = pairs_check(&kept, &pair_i, &pair_j);
+
+    // adjacency and matrix: both directions of every pair inside their
+    // reach, none past it
+    double adj_err = 0.0, mat_err = 0.0;
+    long adj_pairs = 0, adj_missing = 0, mat_pairs = 0, mat_missing = 0;
+    const bool has_matrix = ANGLE_MATRIX_LAYOUT != ANGLE_MATRIX_OFF;
+    for (int i = 0; i < CATALOG_SIZE; i++) {
+        for (int j = 0; j < CATALOG_SIZE; j++) {
+            if (j == i) continue;
+            double ref = (double)(ref_angle(i, j) * (180000.0L / M_PI));
+            int d = gv_adj_angle_mdeg(i, j);
+            if ((d >= 0) != (ref <= ADJ_MAX_ANGLE_MDEG)) {
+                adj_missing++;
+            } else if (d >= 0) {
+                adj_err = std::max(adj_err, std::fabs(d - ref));
+                adj_pairs++;
+            }
+            int m = gv_matrix_angle_mdeg(i, j);
+            if (has_matrix && (m >= 0) != (ref <= max_mdeg)) {
+                mat_missing++;
+            } else if (m >= 0) {
+                mat_err = std::max(mat_err, std::fabs(m - ref));
+                mat_pairs++;
+            }
+        }
+    }
+
+    // the matrix is in CATALOG_PAIR_ANGLE_LSB_MDEG steps: half of one is
+    // its rounding, plus a little for the float angles it was built from
+    const double mat_bound = 0.5 * CATALOG_PAIR_ANGLE_LSB_MDEG + 0.01;
+    bool ok = max_err <= kNumericBoundMdeg && pair_err <= kNumericBoundMdeg && adj_err <= kNumericBoundMdeg &&
+              adj_missing == 0 && mat_err <= mat_bound && mat_missing == 0;
+    std::printf("numeric check (gv_real = %s, %ld catalog pairs up to %.0f deg, %ld closer than %.0f mdeg skipped)\n",
+                sizeof(gv_real) == sizeof(float) ? "float" : "double", pairs, max_mdeg / 1000.0, close,
+                kNumericMinMdeg);
+    std::printf("  table   max |xyz error|  %.3g\n", max_table);
+    std::printf("  verify  max |error|      %.4f mdeg  (#%d-#%d at %.3f deg)\n", max_err, worst_i, worst_j,
+                worst_deg);
+    std::printf("          rms error        %.4f mdeg\n", std::sqrt(sum_sq / std::max(1L, pairs)));
+    std::printf("  pairs   max |error|      %.4f mdeg  (#%d-#%d; %ld of %d pairs inside %d mdeg, catalog %d)\n",
+                pair_err, pair_i, pair_j, kept, CATALOG_SIZE * (CATALOG_SIZE - 1) / 2, CATALOG_MAX_ANGLE_MDEG,
+                N_PAIRS);
+    std::printf("  adj     max |error|      %.4f mdeg  (%ld entries inside %d mdeg, %ld wrong)\n", adj_err,
+                adj_pairs, ADJ_MAX_ANGLE_MDEG, adj_missing);
+    if (has_matrix) {
+        std::printf("  matrix  max |error|      %.4f mdeg  (%ld entries inside %.0f mdeg, %ld wrong; bound %.2f)\n",
+                    mat_err, mat_pairs, max_mdeg, mat_missing, mat_bound);
+    } else {
+        std::printf("  matrix  not generated\n");
+    }
+    std::printf("  bound   %.4f mdeg  %s\n", kNumericBoundMdeg, ok ? "ok" : "EXCEEDED");
+    return ok ? 0 : 1;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    int frames = 200, reps = 5, scenes = 5000;
+    unsigned seed = 0x5eed;
+    double loc_err = -1.0;
+    gv_lookup lookup = GV_LOOKUP_BINS;
+    gv_engine engine = GV_ENGINE_VOTES;
+    gv_verify verify = GV_VERIFY_COSINE;
+    bool numeric_only = false;
+    Method method = Method::Vote;
+    double track_rate = -1.0;
+    bool attitude = false;
+    Select select;
+    scene::SceneConfig cfg;
+    cfg.noise_mdeg = 20.0;
+    cfg.false_stars = 1;
+    cfg.dropout = 0.05;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto need = [&](int n) {
+            if (i + n >= argc) {
+                std::fprintf(stderr, "gvbench: %s needs %d value(s)\n", arg.c_str(), n);
+                std::exit(2);
+            }
+        };
+        if (arg == "--frames") { need(1); frames = std::atoi(argv[++i]); }
+        else if (arg == "--reps") { need(1); reps = std::atoi(argv[++i]); }
+        else if (arg == "--scenes") { need(1); scenes = std::atoi(argv[++i]); }
+        else if (arg == "--fov") { need(2); cfg.fov_x_deg = std::atof(argv[++i]); cfg.fov_y_deg = std::atof(argv[++i]); }
+        else if (arg == "--noise") { need(1); cfg.noise_mdeg = std::atof(argv[++i]); }
+        else if (arg == "--false") { need(1); cfg.false_stars = std::atoi(argv[++i]); }
+        else if (arg == "--drop") { need(1); cfg.dropout = std::atof(argv[++i]); }
+        else if (arg == "--max-stars") { need(1); cfg.max_stars = std::atoi(argv[++i]); }
+        else if (arg == "--loc-err") { need(1); loc_err = std::atof(argv[++i]); }
+        else if (arg == "--lookup") {
+            need(1);
+            std::string l = argv[++i];
+            if (l == "bins") lookup = GV_LOOKUP_BINS;
+            else if (l == "kvector") lookup = GV_LOOKUP_KVECTOR;
+            else {
+                std::fprintf(stderr, "gvbench: unknown lookup %s\n", l.c_str());
+                return 2;
+            }
+        }
+        else if (arg == "--engine") {
+            need(1);
+            std::string e = argv[++i];
+            if (e == "votes") engine = GV_ENGINE_VOTES;
+            else if (e == "bitset") engine = GV_ENGINE_BITSET;
+            else {
+                std::fprintf(stderr, "gvbench: unknown engine %s\n", e.c_str());
+                return 2;
+            }
+        }
+        else if (arg == "--verify") {
+            need(1);
+            std::string v = argv[++i];
+            if (v == "cosine") verify = GV_VERIFY_COSINE;
+            else if (v == "adjacency") verify = GV_VERIFY_ADJACENCY;
+            else if (v == "matrix") verify = GV_VERIFY_MATRIX;
+            else {
+                std::fprintf(stderr, "gvbench: unknown verify %s\n", v.c_str());
+                return 2;
+            }
+        }
+        else if (arg == "--select") { need(2); select.k_bright = std::atoi(argv[++i]); select.k_nn = std::atoi(argv[++i]); }
+        else if (arg == "--triangles") { method = Method::Triangles; }
+        else if (arg == "--hash") { method = Method::Hash; }
+        else if (arg == "--track") { need(1); track_rate = std::atof(argv[++i]); }
+        else if (arg == "--attitude") { attitude = true; }
+        else if (arg == "--numeric") { numeric_only = true; }
+        else if (arg == "--seed") { need(1); seed = (unsigned)std::strtoul(argv[++i], nullptr, 0); }
+        else {
+            std::fprintf(stderr, "gvbench: unknown option %s\n", arg.c_str());
+            return 2;
+        }
+    }
+
+    if (numeric_only) {
+        return numeric_check();
+    }
+
+    std::vector<unsigned char> arena(GV_WORKSPACE_BYTES(kMaxStars, kMaxVotes));
+    gv_workspace ws;
+    if (gv_workspace_init(&ws, arena.data(), arena.size(), kMaxStars, kMaxVotes) != 0) {
+        std::fprintf(stderr, "gvbench: workspace arena too small\n");
+        return 1;
+    }
+    ws.lookup = lookup;
+    ws.engine = engine;
+    ws.verify = verify;
+    std::printf("lookup: %s, engine: %s, verify: %s\n\n", lookup == GV_LOOKUP_KVECTOR ? "kvector" : "bins",
+                engine == GV_ENGINE_BITSET ? "bitset" : "votes",
+                verify == GV_VERIFY_ADJACENCY ? "adjacency" : verify == GV_VERIFY_MATRIX ? "matrix" : "cosine");
+
+    if (loc_err < 0.0) {
+        loc_err = std::max(10.0, 2.0 * std::sqrt(2.0) * cfg.noise_mdeg);
+    }
+
+    std::mt19937 rng(seed);
+    size_sweep(&ws, frames, reps, rng);
+    if (select.k_bright != 0 &&
+        (select.k_bright < 1 || select.k_bright > GV_SELECT_MAX_BRIGHT || select.k_nn < 1 ||
+         select.k_nn > GV_SELECT_MAX_NN)) {
+        std::fprintf(stderr, "gvbench: --select needs 1 <= K <= %d and 1 <= NN <= %d\n", GV_SELECT_MAX_BRIGHT,
+                     GV_SELECT_MAX_NN);
+        return 2;
+    }
+    if (attitude) {
+        attitude_run(&ws, scenes, cfg, loc_err, reps, rng);
+    } else if (track_rate >= 0.0) {
+        track_run(&ws, scenes, cfg, loc_err, track_rate, rng);
+    } else {
+        scene_run(&ws, scenes, cfg, loc_err, select, method, rng);
+    }
+    return 0;
+}
@@ -0,0 +1,148 @@
+// /star-tracker     scene generator
+// ----------------------------------------------------------
+// See scene.hpp. Projection is a plain pinhole model: a body-frame
+// vector u is on the sensor when u.z > 0 and its tangent-plane
+// coordinates u.x/u.z, u.y/u.z fall inside tan(fov/2).
+// ----------------------------------------------------------
+
+#include "scene.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "catalog_luts.h"
+#include "catalog_xyz.h"
+
+namespace scene {
+
+namespace {
+
+constexpr double kDegToRad = M_PI / 180.0;
+constexpr double kMdegToRad = M_PI / 180000.0;
+
+void normalize(double v[3]) {
+    double n = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    v[0] /= n;
+    v[1] /= n;
+    v[2] /= n;
+}
+
+}  // namespace
+
+double SceneStar::flux() const {
+    return std::pow(10.0, -0.4 * mag);
+}
+
+Pointing random_pointing(std::mt19937 &rng) {
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    std::uniform_real_distribution<double> turn(0.0, 360.0);
+    Pointing p;
+    p.ra_deg = turn(rng);
+    p.dec_deg = std::asin(unit(rng)) / kDegToRad;
+    p.roll_deg = turn(rng);
+    return p;
+}
+
+void pointing_to_matrix(const Pointing &p, double R[3][3]) {
+    double ra = p.ra_deg * kDegToRad;
+    double dec = p.dec_deg * kDegToRad;
+    double roll = p.roll_deg * kDegToRad;
+
+    // boresight plus local east/north on the sky
+    double bore[3] = {std::cos(dec) * std::cos(ra), std::cos(dec) * std::sin(ra), std::sin(dec)};
+    double east[3] = {-std::sin(ra), std::cos(ra), 0.0};
+    double north[3] = {-std::sin(dec) * std::cos(ra), -std::sin(dec) * std::sin(ra), std::cos(dec)};
+
+    // roll turns the sensor axes about the boresight
+    double c = std::cos(roll), s = std::sin(roll);
+    for (int k = 0; k < 3; k++) {
+        R[0][k] = c * east[k] + s * north[k];
+        R[1][k] = -s * east[k] + c * north[k];
+        R[2][k] = bore[k];
+    }
+}
+
+double angle_mdeg(const double a[3], const double b[3]) {
+    double dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    dot = std::max(-1.0, std::min(1.0, dot));
+    return std::acos(dot) / kMdegToRad;
+}
+
+Scene make_scene(const Pointing &p, const SceneConfig &cfg, std::mt19937 &rng) {
+    Scene s;
+    s.pointing = p;
+    pointing_to_matrix(p, s.R);
+
+    const double tan_x = std::tan(0.5 * cfg.fov_x_deg * kDegToRad);
+    const double tan_y = std::tan(0.5 * cfg.fov_y_deg * kDegToRad);
+
+    // ----- project the catalog -----
+    for (int i = 0; i < CATALOG_SIZE; i++) {
+        SceneStar star;
+        for (int r = 0; r < 3; r++) {
+            star.v[r] = s.R[r][0] * cat[i][1] + s.R[r][1] * cat[i][2] + s.R[r][2] * cat[i][3];
+        }
+        if (star.v[2] <= 0.0 ||
+            std::fabs(star.v[0] / star.v[2]) > tan_x ||
+            std::fabs(star.v[1] / star.v[2]) > tan_y) {
+            continue;
+        }
+        star.truth = (int)cat[i][0];
+        star.mag = index_to_vmag_lut[star.truth] / 100.0;
+        s.stars.push_back(star);
+    }
+
+    if (cfg.max_stars > 0 && (int)s.stars.size() > cfg.max_stars) {
+        std::partial_sort(s.stars.begin(), s.stars.begin() + cfg.max_stars, s.stars.end(),
+                          [](const SceneStar &a, const SceneStar &b) { return a.v[2] > b.v[2]; });
+        s.stars.resize(cfg.max_stars);
+    }
+
+    // ----- dropouts -----
+    if (cfg.dropout > 0.0) {
+        std::bernoulli_distribution lost(cfg.dropout);
+        s.stars.erase(std::remove_if(s.stars.begin(), s.stars.end(),
+                                     [&](const SceneStar &) { return lost(rng); }),
+                      s.stars.end());
+    }
+
+    // ----- centroid noise (small tangent-plane offsets) -----
+    if (cfg.noise_mdeg > 0.0) {
+        std::normal_distribution<double> err(0.0, cfg.noise_mdeg * kMdegToRad);
+        for (SceneStar &star : s.stars) {
+            double dx = err(rng), dy = err(rng);
+            star.v[0] += dx * star.v[2];
+            star.v[1] += dy * star.v[2];
+            normalize(star.v);
+        }
+    }
+
+    // ----- false stars -----
+    std::uniform_real_distribution<double> fx(-tan_x, tan_x), fy(-tan_y, tan_y);
+    auto mags = std::minmax_element(index_to_vmag_lut, index_to_vmag_lut + CATALOG_SIZE);
+    std::uniform_real_distribution<double> fmag(*mags.first / 100.0, *mags.second / 100.0);
+    for (int k = 0; k < cfg.false_stars; k++) {
+        SceneStar star{{fx(rng), fy(rng), 1.0}, -1, fmag(rng)};
+        normalize(star.v);
+        s.stars.push_back(star);
+    }
+
+    // the solver must not be able to lean on catalog order
+    std::shuffle(s.stars.begin(), s.stars.end(), rng);
+
+    tabulate_pairs(s);
+    return s;
+}
+
+void tabulate_pairs(Scene &s) {
+    s.tab_image.clear();
+    for (int i = 0; i < s.n_stars(); i++) {
+        for (int j = i + 1; j < s.n_stars(); j++) {
+            s.tab_image.push_back(i);
+            s.tab_image.push_back(j);
+            s.tab_image.push_back((gv_real)std::round(angle_mdeg(s.stars[i].v, s.stars[j].v)));
+        }
+    }
+}
+
+}  // namespace scene
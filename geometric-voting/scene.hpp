@@ -0,0 +1,78 @@
+// /star-tracker     scene generator
+// ----------------------------------------------------------
+// Synthetic star fields for exercising the solver on the host.
+//   > Point a pinhole camera (RA/Dec boresight + roll) at catalog_xyz
+//   > Keep the catalog stars that land inside the FOV rectangle
+//   > Perturb each with centroid noise, drop some, add false stars
+//   > Tabulate every image pair as a tab_image row {a, b, angle_mdeg}
+//
+//   Every star carries its ground truth (catalog index, or -1 for a
+//   false star) so benchmarks can score the solver's answers, and a V
+//   magnitude (catalog Vmag; false stars anywhere in the catalog's range)
+//   for brightness-ranked pair selection.
+// ----------------------------------------------------------
+
+#ifndef GV_SCENE_HPP
+#define GV_SCENE_HPP
+
+#include <random>
+#include <vector>
+
+#include "gv_real.h"
+
+namespace scene {
+
+// where the camera looks: boresight RA/Dec and roll about it (degrees)
+struct Pointing {
+    double ra_deg = 0.0;
+    double dec_deg = 0.0;
+    double roll_deg = 0.0;
+};
+
+struct SceneConfig {
+    double fov_x_deg = 40.0;     // full field of view across the sensor
+    double fov_y_deg = 22.5;     // ... and down it (IMX290 is 16:9)
+    double noise_mdeg = 0.0;     // 1-sigma centroid error, per tangent axis
+    int false_stars = 0;         // spurious centroids scattered over the FOV
+    double dropout = 0.0;        // chance a visible catalog star is missed
+    int max_stars = 0;           // keep only the n stars nearest boresight (0 = all)
+};
+
+struct SceneStar {
+    double v[3];                 // body-frame unit vector (+z = boresight)
+    int truth;                   // catalog index, or -1 for a false star
+    double mag;                  // V magnitude (smaller = brighter)
+
+    double flux() const;         // relative brightness, 10^(-0.4 mag)
+};
+
+struct Scene {
+    Pointing pointing;
+    double R[3][3];              // inertial -> body rotation (rows = body axes)
+    std::vector<SceneStar> stars;
+    std::vector<gv_real> tab_image; // n_image rows of {a, b, angle_mdeg}
+
+    int n_stars() const { return (int)stars.size(); }
+    int n_image() const { return (int)tab_image.size() / 3; }
+    const gv_real (*rows() const)[3] {
+        return reinterpret_cast<const gv_real (*)[3]>(tab_image.data());
+    }
+};
+
+// uniform over the sphere, uniform roll
+Pointing random_pointing(std::mt19937 &rng);
+
+// body axes for a pointing: R * v_inertial = v_body
+void pointing_to_matrix(const Pointing &p, double R[3][3]);
+
+Scene make_scene(const Pointing &p, const SceneConfig &cfg, std::mt19937 &rng);
+
+// (re)build tab_image from the scene's star vectors, every pair once
+void tabulate_pairs(Scene &s);
+
+// pair angle in millidegrees between two unit vectors
+double angle_mdeg(const double a[3], const double b[3]);
+
+}  // namespace scene
+
+#endif  // GV_SCENE_HPP
@@ -0,0 +1,143 @@
+// /star-tracker     scenegen
+// ----------------------------------------------------------
+// Command-line front end for the scene generator (scene.hpp).
+//   Writes one or more synthetic frames as tab_image pair tables (or
+//   main.c image vectors) with the ground-truth catalog index of every
+//   centroid.
+//
+//   usage: scenegen [options]
+//     --count N            N random pointings (default 1)
+//     --pointing RA DEC ROLL
+//                          one scripted pointing, in degrees
+//     --script FILE        one pointing per line: "RA DEC ROLL"
+//     --fov X Y            full FOV in degrees (default 40 22.5)
+//     --noise MDEG         1-sigma centroid noise in millidegrees
+//     --false N            false stars per frame
+//     --drop P             dropout probability per real star
+//     --seed S             RNG seed
+//     --c                  emit main.c's image_vectors (gv_real) instead of CSV
+//
+//   CSV output, per scene:
+//     scene,<k>,<ra_deg>,<dec_deg>,<roll_deg>
+//     star,<i>,<x>,<y>,<z>,<truth_index>,<truth_hip>,<vmag>   (-1,-1 = false star)
+//     pair,<a>,<b>,<angle_mdeg>
+// ----------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "scene.hpp"
+#include "catalog_luts.h"
+
+namespace {
+
+long truth_hip(int truth) {
+    return truth < 0 ? -1 : (long)index_to_hip_ID_lut[truth];
+}
+
+void write_csv(const scene::Scene &s, int k) {
+    std::printf("scene,%d,%.6f,%.6f,%.6f\n", k, s.pointing.ra_deg, s.pointing.dec_deg, s.pointing.roll_deg);
+    for (int i = 0; i < s.n_stars(); i++) {
+        const scene::SceneStar &st = s.stars[i];
+        std::printf("star,%d,%.9f,%.9f,%.9f,%d,%ld,%.2f\n", i, st.v[0], st.v[1], st.v[2], st.truth,
+                    truth_hip(st.truth), st.mag);
+    }
+    for (int i = 0; i < s.n_image(); i++) {
+        std::printf("pair,%d,%d,%d\n", (int)s.rows()[i][0], (int)s.rows()[i][1], (int)s.rows()[i][2]);
+    }
+}
+
+// main.c's sample starfield: n_stars_img and image_vectors, from which
+// main.c tabulates its own pairs (gv_tabulate_pairs()). Every scene sits
+// under #if GV_SCENE == k, so the whole output pastes in and scene 0 is
+// solved unless GV_SCENE says otherwise.
+void write_c(const scene::Scene &s, int k) {
+    if (k == 0) {
+        std::printf("#ifndef GV_SCENE\n#define GV_SCENE 0\n#endif\n");
+    }
+    std::printf("// scene %d: RA %.4f, Dec %.4f, roll %.4f\n", k, s.pointing.ra_deg, s.pointing.dec_deg,
+                s.pointing.roll_deg);
+    std::printf("#if GV_SCENE == %d\n", k);
+    std::printf("#define n_stars_img %d\n", s.n_stars());
+    std::printf("static const gv_real image_vectors[%d][3] = {\n", s.n_stars() > 0 ? s.n_stars() : 1);
+    for (int i = 0; i < s.n_stars(); i++) {
+        const scene::SceneStar &st = s.stars[i];
+        std::printf("    { %.8f, %.8f, %.8f },  // CENT %d ", st.v[0], st.v[1], st.v[2], i);
+        if (st.truth < 0) {
+            std::printf("(false star)\n");
+        } else {
+            std::printf("(#%d, HIP %ld)\n", st.truth, truth_hip(st.truth));
+        }
+    }
+    std::printf("};\n#endif\n\n");
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    scene::SceneConfig cfg;
+    std::vector<scene::Pointing> scripted;
+    int count = 1;
+    unsigned seed = 1;
+    bool as_c = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto need = [&](int n) {
+            if (i + n >= argc) {
+                std::fprintf(stderr, "scenegen: %s needs %d value(s)\n", arg.c_str(), n);
+                std::exit(2);
+            }
+        };
+        if (arg == "--count") { need(1); count = std::atoi(argv[++i]); }
+        else if (arg == "--pointing") {
+            need(3);
+            scene::Pointing p;
+            p.ra_deg = std::atof(argv[++i]);
+            p.dec_deg = std::atof(argv[++i]);
+            p.roll_deg = std::atof(argv[++i]);
+            scripted.push_back(p);
+        } else if (arg == "--script") {
+            need(1);
+            std::ifstream in(argv[++i]);
+            if (!in) {
+                std::fprintf(stderr, "scenegen: cannot open %s\n", argv[i]);
+                return 1;
+            }
+            std::string line;
+            while (std::getline(in, line)) {
+                std::istringstream ls(line);
+                scene::Pointing p;
+                if (line.empty() || line[0] == '#') continue;
+                if (ls >> p.ra_deg >> p.dec_deg >> p.roll_deg) scripted.push_back(p);
+            }
+        }
+        else if (arg == "--fov") { need(2); cfg.fov_x_deg = std::atof(argv[++i]); cfg.fov_y_deg = std::atof(argv[++i]); }
+        else if (arg == "--noise") { need(1); cfg.noise_mdeg = std::atof(argv[++i]); }
+        else if (arg == "--false") { need(1); cfg.false_stars = std::atoi(argv[++i]); }
+        else if (arg == "--drop") { need(1); cfg.dropout = std::atof(argv[++i]); }
+        else if (arg == "--seed") { need(1); seed = (unsigned)std::strtoul(argv[++i], nullptr, 0); }
+        else if (arg == "--c") { as_c = true; }
+        else {
+            std::fprintf(stderr, "scenegen: unknown option %s\n", arg.c_str());
+            return 2;
+        }
+    }
+
+    std::mt19937 rng(seed);
+    if (scripted.empty()) {
+        for (int k = 0; k < count; k++) scripted.push_back(scene::random_pointing(rng));
+    }
+
+    for (int k = 0; k < (int)scripted.size(); k++) {
+        scene::Scene s = scene::make_scene(scripted[k], cfg, rng);
+        if (as_c) write_c(s, k);
+        else write_csv(s, k);
+    }
+    return 0;
+}
@@ -7,54 +7,185 @@
 #   > Gaussian Blur To Suppress Noise (random noisy
 #     pixels will get reduced by surrounding dark)
 #   > Adaptive Percentile-based Thresholding
-#     to avoid light pollution/noise.
+#     to avoid light pollution/noise (optionally per tile,
+#     for a sky glow that varies across the frame).
 #   > Accepts/Rejects Pixels based on Threshold
 #   > Differentiates Stars from Noise and Objects
 #     by checking pixel cluster size.
+#   The native fused pass (starcentroid.py, native/preprocess.cpp)
+#   is the canonical path: greyscale, CLAHE, blur, threshold
+#   and clusters in one pass over the camera's frame with no
+#   intermediate images. A CLAHE tile can't be mapped until
+#   its whole histogram is in, so the tile LUTs, like the one
+#   threshold for the frame, come from the previous frame's
+#   counts: the sky they see is a frame old. Without the
+#   library, cv2, numpy and scipy compute the same thing step
+#   by step, lag included, only slower. clahe=False skips the
+#   enhancement on both paths.
 
 import cv2
 import numpy as np
 from scipy.ndimage import label
 
+try:
+    import starcentroid
+except ImportError:
+    starcentroid = None
+
+_centroider = None
+_last = None  # fallback: (shape, CLAHE LUTs, percentile threshold) of the last frame
+
+CLAHE_CLIP = 2.0
+CLAHE_GRID = (8, 8)  # tiles across, down
+
+
+def _native_centroider(width):
+    # built once and kept: its working memory is reused frame to frame
+    global _centroider
+    if starcentroid is None:
+        return None
+    if _centroider is None or _centroider.max_width < width:
+        try:
+            _centroider = starcentroid.Centroider(width)
+        except OSError as e:
+            print(f"Native centroider unavailable ({e}), using scipy")
+            return None
+    return _centroider
+
+
+def _clahe_luts(image):
+    # cv2.createCLAHE(CLAHE_CLIP, CLAHE_GRID)'s tile LUTs, [tiles down,
+    # tiles across, 256]: each tile's histogram clipped, the excess spread
+    # evenly, its cdf scaled to 0-255. A frame that doesn't split evenly
+    # is padded right and bottom (reflect-101) as cv2 does.
+    gx, gy = CLAHE_GRID
+    h, w = image.shape
+    if w % gx or h % gy:
+        image = np.pad(image, ((0, gy - h % gy), (0, gx - w % gx)), mode="reflect")
+    th, tw = image.shape[0] // gy, image.shape[1] // gx
+    limit = max(int(CLAHE_CLIP * th * tw / 256), 1) if CLAHE_CLIP > 0 else 0
+    scale = np.float32(255) / np.float32(th * tw)
+    luts = np.empty((gy, gx, 256), dtype=np.uint8)
+    for ty in range(gy):
+        for tx in range(gx):
+            hist = np.bincount(image[ty * th:(ty + 1) * th, tx * tw:(tx + 1) * tw].ravel(), minlength=256)
+            if limit:
+                clipped = int(np.maximum(hist - limit, 0).sum())
+                hist = np.minimum(hist, limit) + clipped // 256
+                residual = clipped % 256
+                if residual:
+                    hist[::max(256 // residual, 1)][:residual] += 1
+            luts[ty, tx] = np.clip(np.rint(np.cumsum(hist).astype(np.float32) * scale), 0, 255)
+    return luts
+
+
+def _clahe_apply(image, luts):
+    # every pixel through its four nearest tiles' LUTs, bilinear, in
+    # cv2's float32 arithmetic
+    gy, gx = luts.shape[:2]
+    h, w = image.shape
+    even = w % gx == 0 and h % gy == 0
+    tw = (w if even else w + gx - w % gx) // gx
+    th = (h if even else h + gy - h % gy) // gy
+
+    def weights(n, size, tiles):
+        f = np.arange(n, dtype=np.float32) * (np.float32(1) / np.float32(size)) - np.float32(0.5)
+        t1 = np.floor(f)
+        return np.maximum(t1, 0).astype(int), np.minimum(t1 + 1, tiles - 1).astype(int), f - t1
+
+    tx1, tx2, xa = weights(w, tw, gx)
+    ty1, ty2, ya = weights(h, th, gy)
+    xa1, ya1 = 1 - xa, (1 - ya)[:, None]
+    ya = ya[:, None]
+    top = luts[ty1[:, None], tx1, image] * xa1 + luts[ty1[:, None], tx2, image] * xa
+    bottom = luts[ty2[:, None], tx1, image] * xa1 + luts[ty2[:, None], tx2, image] * xa
+    return np.clip(np.rint(top * ya1 + bottom * ya), 0, 255).astype(np.uint8)
+
+
+def _tile_thresholds(image, tile, percentile, floor):
+    # starcentroid.tile_thresholds() in numpy: each tile's percentile,
+    # floored, never below floor
+    h, w = image.shape
+    grid = np.zeros(((h + tile - 1) // tile, (w + tile - 1) // tile), dtype=np.uint8)
+    for ty in range(grid.shape[0]):
+        for tx in range(grid.shape[1]):
+            block = image[ty * tile:(ty + 1) * tile, tx * tile:(tx + 1) * tile]
+            grid[ty, tx] = min(max(int(np.floor(np.percentile(block, percentile))), floor), 255)
+    return grid
+
+
+def _scipy_centroids(image, threshold, min_area, max_area):
+    # same clusters and sums as the native path: label once, then every
+    # blob's area and moments in a single bincount pass each
+    # pixels brighter than threshold (a number, or one per pixel)
+    binary = image > threshold
+    structure = np.ones((3, 3), dtype=np.uint8)
+    labeled, num_features = label(binary, structure=structure)
+    flat = labeled.ravel()
+    weights = image.ravel().astype(np.float64)
+    y_idx, x_idx = np.divmod(np.arange(flat.size), image.shape[1])
+    area = np.bincount(flat, minlength=num_features + 1)
+    total = np.bincount(flat, weights, minlength=num_features + 1)
+    sum_x = np.bincount(flat, weights * x_idx, minlength=num_features + 1)
+    sum_y = np.bincount(flat, weights * y_idx, minlength=num_features + 1)
+    centroids = []
+    for i in range(1, num_features + 1):
+        if min_area <= area[i] <= max_area and total[i] > 0:
+            centroids.append((sum_x[i] / total[i], sum_y[i] / total[i]))
+    return centroids, num_features
+
+
+def find_centroids(image, min_area=3, max_area=200, local_tile=None, local_floor=0, clahe=True):
+    percentile = 99  # pick top 1% brightest pixels
+    native = _native_centroider(image.shape[1])
+    if native is not None:
+        # greyscale, CLAHE, blur, threshold and 8-connected clusters in one
+        # pass over the frame; local_tile gives one threshold per
+        # local_tile x local_tile square, never below local_floor
+        native.clahe(CLAHE_CLIP, CLAHE_GRID if clahe else None)
+        centroids, num_features = native.find_frame(image, percentile, min_area, max_area,
+                                                    tile=local_tile, floor=local_floor)
+        if local_tile:
+            tiles = native.threshold
+            print(f"Using {tiles.shape[1]}x{tiles.shape[0]} tile thresholds: {tiles.min()}-{tiles.max()}")
+        else:
+            print(f"Using adaptive threshold: {native.threshold:.2f}")
+        print(f"Found {num_features} blobs, accepted {len(centroids)}")
+        return centroids
+
+    # 0. Convert the image to greyscale (the camera's Y plane already is)
+    if image.ndim == 3:
+        image = cv2.cvtColor(image, cv2.COLOR_BGR2GRAY)
+
+    # the last frame's statistics, as the native pass uses them (the
+    # first frame, or one of a new size, uses its own)
+    global _last
+    last = _last if _last is not None and _last[0] == image.shape else None
 
-def find_centroids(image, min_area=3, max_area=200):
-    # 0. Convert the image to greyscale
-    image = cv2.cvtColor(image, cv2.COLOR_BGR2GRAY)
-    
     # 1. Local contrast enhancement (adaptive histogram equalization)
-    clahe = cv2.createCLAHE(clipLimit=2.0, tileGridSize=(8, 8))
-    image = clahe.apply(image)
+    luts = None
+    if clahe:
+        luts = _clahe_luts(image)
+        image = _clahe_apply(image, last[1] if last is not None and last[1] is not None else luts)
 
     # 2. Slight Gaussian Blur
     image = cv2.GaussianBlur(image, (3, 3), 0)
 
     # 3. Adaptive Thresholding
-    percentile = 99  # pick top 1% brightest pixels
     # create an adaptive 'brightness' threshold (0-255) from image
-    threshold = np.percentile(image, percentile)
-    print(f"Using adaptive threshold: {threshold:.2f}")
-    # create a binary image based on threshold (sets pixels to either 0 or 255)
-    _, binary = cv2.threshold(image, threshold, 255, cv2.THRESH_BINARY)
+    sky = np.percentile(image, percentile)
+    if local_tile:
+        tiles = _tile_thresholds(image, local_tile, percentile, local_floor)
+        print(f"Using {tiles.shape[1]}x{tiles.shape[0]} tile thresholds: {tiles.min()}-{tiles.max()}")
+        threshold = np.repeat(np.repeat(tiles, local_tile, 0), local_tile, 1)[:image.shape[0], :image.shape[1]]
+    else:
+        threshold = last[2] if last is not None else sky
+        print(f"Using adaptive threshold: {threshold:.2f}")
+    _last = (image.shape, luts, sky)
 
     # 4. Cluster Detection
-    # define the cluster structure as a 3x3 pixel matrix
-    # > this means a pixel will be checked in all 8 possible directions
-    structure = np.ones((3, 3), dtype=np.uint8)
-    # find all the clusters in the binary image
-    labeled, num_features = label(binary, structure=structure)
-    # iterate through each cluster, reject if area is too large, append centroids to list
-    centroids = []
-    print(f"Found {num_features} blobs")
-    for i in range(1, num_features + 1):
-        mask = labeled == i
-        area = np.sum(mask)
-        print(f"  Blob {i}: area={area}, accepted={min_area <= area <= max_area}")
-        if min_area <= area <= max_area:
-            weights = image * mask
-            total_intensity = np.sum(weights)
-            if total_intensity > 0:
-                y_idx, x_idx = np.indices(image.shape)
-                x_center = np.sum(x_idx * weights) / total_intensity
-                y_center = np.sum(y_idx * weights) / total_intensity
-                centroids.append((x_center, y_center))
+    # 8-connected clusters (a 3x3 structure), rejected if too small or too
+    # large; each accepted cluster's intensity-weighted centroid
+    centroids, num_features = _scipy_centroids(image, threshold, min_area, max_area)
+    print(f"Found {num_features} blobs, accepted {len(centroids)}")
     return centroids
@@ -0,0 +1,127 @@
+# /star-tracker     frame sources
+# ----------------------------------------------------------
+# Where the pipeline's frames come from, behind one interface.
+#   > grab() blocks for the next frame and returns it as a Frame: a
+#     greyscale uint8 view plus release(), which hands its buffer
+#     back. None once the source has nothing more to give.
+#   > Buffers are bounded: a source lends out at most `buffers`
+#     frames, and grab() waits for one to be released.
+#   > CameraSource: the IMX290 through picamera2. Each Frame is a
+#     borrowed capture request, so the camera's own buffers are the
+#     ring and nothing is copied.
+#   > ReplaySource: frames from files (.pgm as FrameArchiver writes
+#     them, or anything cv2 reads), read into a fixed ring of
+#     buffers. It stands in for the camera on any Linux box.
+
+import os
+import queue
+import time
+
+import numpy as np
+
+REPLAY_EXTENSIONS = (".pgm", ".png", ".jpg", ".jpeg", ".bmp", ".tif", ".tiff")
+
+
+class Frame:
+    def __init__(self, image, index, timestamp, release=None):
+        self.image = image          # (height, width) uint8, rows may be padded
+        self.index = index          # 0, 1, 2, ... in capture order
+        self.timestamp = timestamp  # time.monotonic() at capture
+        self._release = release
+
+    def release(self):
+        # the buffer goes back to its source; image is invalid after this
+        if self._release is not None:
+            self._release()
+            self._release = None
+
+
+class CameraSource:
+    def __init__(self, buffers=4, **camera_args):
+        # picamera2 only exists on the Pi
+        from imagecapture import CameraManager
+        self.camera = CameraManager(buffers=buffers, **camera_args)
+        self._index = 0
+
+    def grab(self):
+        image, release = self.camera.borrow()
+        frame = Frame(image, self._index, time.monotonic(), release)
+        self._index += 1
+        return frame
+
+    def close(self):
+        self.camera.close()
+
+
+def read_pgm_header(f):
+    # width, height of a binary 8-bit greymap, leaving f at the pixels
+    tokens = []
+    while len(tokens) < 4:
+        line = f.readline()
+        if not line:
+            raise ValueError("truncated PGM header")
+        tokens += line.split(b"#")[0].split()
+    if tokens[0] != b"P5" or int(tokens[3]) > 255:
+        raise ValueError("not an 8-bit binary PGM")
+    return int(tokens[1]), int(tokens[2])
+
+
+class ReplaySource:
+    def __init__(self, paths, buffers=4, loop=False, fps=None):
+        # paths: files and/or folders (their images, in name order)
+        self.files = []
+        for path in paths:
+            if os.path.isdir(path):
+                self.files += sorted(os.path.join(path, f) for f in os.listdir(path)
+                                     if f.lower().endswith(REPLAY_EXTENSIONS))
+            else:
+                self.files.append(path)
+        if not self.files:
+            raise ValueError("nothing to replay")
+        self.loop = loop
+        self.period = 1.0 / fps if fps else 0.0
+        self._free = queue.Queue()
+        for _ in range(buffers):
+            self._free.put(np.empty((0, 0), dtype=np.uint8))
+        self._index = 0
+        self._next_time = time.monotonic()
+
+    def _read(self, path, buf):
+        # the file's pixels into buf (reallocated only if the size changes)
+        if path.lower().endswith(".pgm"):
+            with open(path, "rb") as f:
+                width, height = read_pgm_header(f)
+                if buf.shape != (height, width):
+                    buf = np.empty((height, width), dtype=np.uint8)
+                if f.readinto(memoryview(buf).cast("B")) != buf.size:
+                    raise ValueError(f"{path}: truncated PGM")
+            return buf
+        import cv2
+        image = cv2.imread(path, cv2.IMREAD_GRAYSCALE)
+        if image is None:
+            raise ValueError(f"{path}: cv2 can't read it")
+        if buf.shape != image.shape:
+            buf = np.empty(image.shape, dtype=np.uint8)
+        np.copyto(buf, image)
+        return buf
+
+    def grab(self):
+        if self._index >= len(self.files) and not self.loop:
+            return None
+        buf = self._free.get()  # waits for the pipeline to hand one back
+        path = self.files[self._index % len(self.files)]
+        try:
+            buf = self._read(path, buf)
+        except (OSError, ValueError):
+            self._free.put(buf)
+            raise
+        if self.period:
+            # paced like a camera: one frame per period at most
+            time.sleep(max(0.0, self._next_time - time.monotonic()))
+            self._next_time = max(self._next_time, time.monotonic()) + self.period
+        frame = Frame(buf, self._index, time.monotonic(), lambda: self._free.put(buf))
+        self._index += 1
+        return frame
+
+    def close(self):
+        pass
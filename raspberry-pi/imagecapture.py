@@ -4,54 +4,146 @@
 # @ Target Hardware: RPi Zero 2 W + Waveshare IMX290-83
 # ! Make sure you install the IMX290 overlay from waveshare.
 #   > Self-Aware Incremental/Time-Stamping File Naming.
-#   > Outputs .jpg to home/pi/images folder.
+#   > Frames are lent straight out of the camera's buffer as a
+#     greyscale view (the YUV420 Y plane): no copy, encode or
+#     disk I/O before centroiding.
+#   > Archival to home/pi/images is optional and lossless (.pgm
+#     raw, or .png), written on a background thread.
 #   > Total time to take an image:
 
-from picamera2 import Picamera2
+try:
+    from picamera2 import Picamera2, MappedArray
+except ImportError:
+    Picamera2 = MappedArray = None  # off the Pi: FrameArchiver still works
+from contextlib import ExitStack, contextmanager
 import os
+import queue
+import threading
 import time
 import re
 from datetime import datetime
 import cv2
+import numpy as np
 
 # ------ DEFINES ------
 FRAME_WIDTH = 1920
 FRAME_HEIGHT = 1080
 IMAGE_FOLDER = "/home/pi/images"
 BASE_NAME = "starfield"
-EXTENSION = ".jpg"
-
-# ------ MAKE SURE OUTPUT FOLDER EXISTS ------
-os.makedirs(IMAGE_FOLDER, exist_ok=True)
+EXTENSION = ".pgm"          # archive format: ".pgm" (raw) or ".png", both lossless
+ARCHIVE_QUEUE = 4           # frames waiting for the disk before new ones are dropped
 
 # ------ FILE NAMING (TIMESTAMP + INCREMENT) ------
-def get_incremented_timestamped_name(folder, base_name=BASE_NAME, extension=EXTENSION):
+def next_image_number(folder, base_name=BASE_NAME, extension=EXTENSION):
     existing = os.listdir(folder)
     pattern = re.compile(rf"{re.escape(base_name)}_(\d+)_\d{{8}}_\d{{6}}{re.escape(extension)}")
     numbers = [int(m.group(1)) for f in existing if (m := pattern.match(f))]
-    next_num = max(numbers, default=0) + 1
+    return max(numbers, default=0) + 1
+
+def timestamped_name(number, base_name=BASE_NAME, extension=EXTENSION):
     timestamp = datetime.now().strftime("%Y%m%d_%H%M%S")
-    return f"{base_name}_{next_num:03d}_{timestamp}{extension}"
+    return f"{base_name}_{number:03d}_{timestamp}{extension}"
+
+# ------ LOSSLESS WRITERS ------
+def write_pgm(path, frame):
+    # binary greymap: a short text header, then the raw 8-bit rows
+    height, width = frame.shape
+    with open(path, "wb") as f:
+        f.write(b"P5\n%d %d\n255\n" % (width, height))
+        f.write(np.ascontiguousarray(frame).tobytes())
+
+def write_png(path, frame):
+    # lossless but compressed; level 1 keeps the worker quick
+    if not cv2.imwrite(path, frame, [cv2.IMWRITE_PNG_COMPRESSION, 1]):
+        raise OSError(f"cv2.imwrite failed for {path}")
+
+WRITERS = {".pgm": write_pgm, ".png": write_png}
+
+# ------ FRAME ARCHIVER CLASS ------
+class FrameArchiver:
+    # Keeps frames on disk without holding up the pipeline. submit()
+    # only copies the frame (its buffer goes back to the camera) onto a
+    # bounded queue; a background thread names and writes it. When the
+    # SD card falls behind, new frames are dropped rather than waited for.
+    def __init__(self, folder=IMAGE_FOLDER, extension=EXTENSION, max_pending=ARCHIVE_QUEUE):
+        if extension not in WRITERS:
+            raise ValueError(f"archive format must be one of {', '.join(WRITERS)}")
+        os.makedirs(folder, exist_ok=True)
+        self.folder = folder
+        self.extension = extension
+        self.dropped = 0
+        self._number = next_image_number(folder, extension=extension)  # listed once, then counted
+        self._queue = queue.Queue(maxsize=max_pending)
+        self._thread = threading.Thread(target=self._run, name="FrameArchiver", daemon=True)
+        self._thread.start()
+
+    def submit(self, frame):
+        try:
+            self._queue.put_nowait(np.array(frame, copy=True))
+            return True
+        except queue.Full:
+            self.dropped += 1
+            print(f"[Archiver] Disk behind, frame dropped ({self.dropped} so far)")
+            return False
+
+    def _run(self):
+        while True:
+            frame = self._queue.get()
+            if frame is None:
+                return
+            path = os.path.join(self.folder, timestamped_name(self._number, extension=self.extension))
+            self._number += 1
+            try:
+                WRITERS[self.extension](path, frame)
+                print(f"[Archiver] Image saved to {path}")
+            except Exception as e:  # a bad write loses that frame, not the archiver
+                print(f"[Archiver] Write error: {e}")
+
+    def close(self):
+        # waits for the frames already queued
+        self._queue.put(None)
+        self._thread.join()
 
 # ------ CAMERA MANAGER CLASS ------
 class CameraManager:
-    def __init__(self, resolution=(FRAME_WIDTH, FRAME_HEIGHT)):
+    def __init__(self, resolution=(FRAME_WIDTH, FRAME_HEIGHT), buffers=1):
+        # buffers: frames the camera can have captured or lent out at once
+        if Picamera2 is None:
+            raise RuntimeError("picamera2 is not installed (replay frames from files instead)")
         self.picam2 = Picamera2()
-        config = self.picam2.create_still_configuration(main={"size": resolution})
+        # YUV420: the Y plane is already the greyscale frame
+        config = self.picam2.create_still_configuration(main={"size": resolution, "format": "YUV420"},
+                                                        buffer_count=buffers)
         self.picam2.configure(config)
+        self.resolution = resolution
         self.picam2.start()
         time.sleep(1)  # One-time warm-up
         print("[CameraManager] Camera initialized and running.")
 
-    def capture_image(self, save_path):
+    def borrow(self):
+        # Lends the next frame's Y plane: a (height, width) uint8 view of
+        # the camera's own buffer (rows may be padded, which the
+        # centroider takes as is), and the function that hands it back.
+        # The view is only valid until then.
+        stack = ExitStack()
+        request = self.picam2.capture_request()
+        stack.callback(request.release)
         try:
-            frame = self.picam2.capture_array()
-            cv2.imwrite(save_path, frame)
-            print(f"[Camera] Image saved to {save_path}")
-            return True
-        except Exception as e:
-            print(f"[Camera] Capture error: {e}")
-            return False
+            mapped = stack.enter_context(MappedArray(request, "main"))
+        except BaseException:
+            stack.close()
+            raise
+        width, height = self.resolution
+        return mapped.array[:height, :width], stack.close
+
+    @contextmanager
+    def frame(self):
+        # borrow() for the length of a with block
+        image, release = self.borrow()
+        try:
+            yield image
+        finally:
+            release()
 
     def close(self):
         self.picam2.close()
@@ -60,11 +152,13 @@ class CameraManager:
 # === Main ===
 if __name__ == "__main__":
     camera = CameraManager()
-    image_name = get_incremented_timestamped_name(IMAGE_FOLDER)
-    image_path = os.path.join(IMAGE_FOLDER, image_name)
-
-    success = camera.capture_image(image_path)
-    camera.close()
-
-    if not success:
+    archiver = FrameArchiver()
+    try:
+        with camera.frame() as frame:
+            archiver.submit(frame)
+    except Exception as e:
+        print(f"[Camera] Capture error: {e}")
         exit(1)
+    finally:
+        camera.close()
+        archiver.close()
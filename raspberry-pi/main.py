@@ -1,46 +1,66 @@
 # /star-tracker     rev. 05312025       preston mavady
 # ----------------------------------------------------------
 # Master control for star tracker system
-#   > Captures image
-#   > Extracts star centroids
+#   > Starts the camera (or a replay of saved frames) and the SPI
+#     link once, then runs them continuously (pipeline.py)
+#   > Captures frames
+#   > Extracts star centroids (straight from the camera's buffer)
 #   > Sends data over SPI to STM32
-#   > Logs output
+#   > Logs output (optionally archives frames, off the critical path)
 
-import os
-import cv2
+import argparse
 
-from imagecapture import CameraManager, get_incremented_timestamped_name, IMAGE_FOLDER
 from centroiding import find_centroids
-from spi-protocol import SPIDevice
+from framesource import CameraSource, ReplaySource
+from imagecapture import FrameArchiver, IMAGE_FOLDER, WRITERS
+from pipeline import Pipeline
 
 def main():
-    # ----- Step 1: Capture image -----
-    camera = CameraManager()
-    image_name = get_incremented_timestamped_name(IMAGE_FOLDER)
-    image_path = os.path.join(IMAGE_FOLDER, image_name)
+    parser = argparse.ArgumentParser(description="Capture frames, centroid them and send the centroids over SPI")
+    parser.add_argument("--replay", nargs="+", metavar="PATH",
+                        help="frames from these files/folders instead of the camera (any Linux box)")
+    parser.add_argument("--loop", action="store_true", help="replay the files over and over")
+    parser.add_argument("--fps", type=float, help="pace the replay like a camera at this frame rate")
+    parser.add_argument("--frames", type=int, help="stop after this many frames (default: run until stopped)")
+    parser.add_argument("--depth", type=int, default=2, help="frames captured ahead of centroiding (default 2)")
+    parser.add_argument("--no-spi", action="store_true", help="centroid only, send nothing")
+    parser.add_argument("--archive", choices=[ext[1:] for ext in WRITERS] + ["none"], default="none",
+                        help="keep every frame in this lossless format (about 2 MB each; default none)")
+    parser.add_argument("--archive-dir", default=IMAGE_FOLDER, help=f"where archived frames go (default {IMAGE_FOLDER})")
+    parser.add_argument("--local-tile", type=int, help="threshold each N x N px tile on its own")
+    parser.add_argument("--no-clahe", action="store_true", help="skip contrast enhancement (CLAHE) before the blur")
+    args = parser.parse_args()
 
-    if not camera.capture_image(image_path):
-        print("[Main] Image capture failed. Exiting.")
-        camera.close()
-        return
-    camera.close()
-
-    # ----- Step 2: Load and process image -----
-    print(f"[Main] Loading image: {image_path}")
-    image = cv2.imread(image_path)
-    if image is None:
-        print("[Main] Failed to load image.")
-        return
-
-    centroids = find_centroids(image)
-    print(f"[Main] Found {len(centroids)} centroids.")
-
-    # ----- Step 3: Send via SPI -----
-    spi = SPIDevice()
+    archiver = None
+    source = None
+    spi = None
     try:
-        spi.send_centroids(centroids)
+        # ----- Set up once: frame source, SPI link, archiver -----
+        # the source lends out depth queued frames, one being centroided
+        # and one being captured
+        buffers = args.depth + 2
+        if args.replay:
+            source = ReplaySource(args.replay, buffers=buffers, loop=args.loop, fps=args.fps)
+        else:
+            source = CameraSource(buffers=buffers)
+        if not args.no_spi:
+            from spi_protocol import SPIDevice  # spidev only exists on the Pi
+            spi = SPIDevice()
+        if args.archive != "none":
+            archiver = FrameArchiver(args.archive_dir, "." + args.archive)
+
+        # ----- Capture > Centroid > SPI TX, overlapped -----
+        pipeline = Pipeline(source, lambda image: find_centroids(image, local_tile=args.local_tile,
+                                                                  clahe=not args.no_clahe),
+                            spi.send_centroids if spi is not None else None, archiver, depth=args.depth)
+        pipeline.run(args.frames)
     finally:
-        spi.close()
+        if source is not None:
+            source.close()
+        if spi is not None:
+            spi.close()
+        if archiver is not None:
+            archiver.close()  # the last frames may still be on their way to disk
 
     print("[Main] Complete.")
 
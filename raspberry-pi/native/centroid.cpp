@@ -0,0 +1,303 @@
+// /star-tracker     streaming centroider
+// ----------------------------------------------------------
+// Row-streaming connected components (see centroid.h).
+//   Blobs live in one pool indexed by label. A label that is merged
+//   into another, or whose blob is finished, goes back on a free list
+//   at the end of the row, once no run can still name it, so the pool
+//   only grows with the widest row's worth of blobs.
+// ----------------------------------------------------------
+
+#include "centroid.h"
+#include "pixel_ops.h"
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+namespace {
+
+// a row's pixels [x0, x1) above the threshold, their sums, and the blob
+// they joined
+struct Run {
+    int x0;
+    int x1;
+    int label;
+    uint64_t sum;        // sum(I)
+    uint64_t sum_x;      // sum(I * x)
+};
+
+struct Blob {
+    uint64_t sum;        // sum(I)
+    uint64_t sum_x;      // sum(I * x)
+    uint64_t sum_y;      // sum(I * y)
+    uint32_t area;
+    uint32_t first;      // raster index of the first pixel
+    int parent;          // union-find: itself for a root
+    int last_row;        // last row a run joined it
+};
+
+}  // namespace
+
+struct sc_centroider {
+    int max_width;
+    std::vector<Run> prev, cur;
+    std::vector<Blob> blobs;
+    std::vector<int> free_labels;
+    std::vector<int> retired;       // labels to free at the end of the row
+    std::vector<sc_blob> found;
+
+    int find(int l) {
+        int root = l;
+        while (blobs[root].parent != root) {
+            root = blobs[root].parent;
+        }
+        while (blobs[l].parent != root) {
+            int next = blobs[l].parent;
+            blobs[l].parent = root;
+            l = next;
+        }
+        return root;
+    }
+
+    int new_blob(uint32_t first, int row) {
+        int l;
+        if (!free_labels.empty()) {
+            l = free_labels.back();
+            free_labels.pop_back();
+        } else {
+            l = (int)blobs.size();
+            blobs.emplace_back();
+        }
+        blobs[l] = Blob{0, 0, 0, 0, first, l, row};
+        return l;
+    }
+
+    // b's blob into a's; both roots
+    void merge(int a, int b) {
+        Blob &A = blobs[a];
+        const Blob &B = blobs[b];
+        A.sum += B.sum;
+        A.sum_x += B.sum_x;
+        A.sum_y += B.sum_y;
+        A.area += B.area;
+        A.first = std::min(A.first, B.first);
+        A.last_row = std::max(A.last_row, B.last_row);
+        blobs[b].parent = a;
+        retired.push_back(b);
+    }
+
+    void finish(int l, int min_area, int max_area, int *n_blobs) {
+        const Blob &b = blobs[l];
+        (*n_blobs)++;
+        if ((int)b.area >= min_area && (int)b.area <= max_area && b.sum > 0) {
+            found.push_back(sc_blob{(double)b.sum_x / (double)b.sum, (double)b.sum_y / (double)b.sum, b.area,
+                                    b.first, b.sum});
+        }
+        blobs[l].last_row = -1;  // finished: later runs of the same row see it once
+        retired.push_back(l);
+    }
+
+    // appends the runs of row[x_begin .. x_end) brighter than t to cur,
+    // continuing the last run if it ends at x_begin (tiles meet there)
+    void cut_runs(const uint8_t *row, int x_begin, int x_end, uint8_t t) {
+        sc_px::for_each_run(row, x_begin, x_end, t, [this](int x0, int x1, uint64_t sum, uint64_t sum_x) {
+            if (!cur.empty() && cur.back().x1 == x0) {
+                cur.back().x1 = x1;
+                cur.back().sum += sum;
+                cur.back().sum_x += sum_x;
+            } else {
+                cur.push_back(Run{x0, x1, -1, sum, sum_x});
+            }
+        });
+    }
+
+    void begin_frame() {
+        prev.clear();
+        found.clear();
+        blobs.clear();
+        free_labels.clear();
+        retired.clear();
+    }
+
+    void join_row(int y, int width, int min_area, int max_area, int *blob_count);
+    int end_frame(int blob_count, sc_blob *out, int max_out, int *n_blobs);
+
+    int find_frame(const uint8_t *frame, int width, int height, ptrdiff_t stride, int tile,
+                   const uint8_t *thresholds, int min_area, int max_area, sc_blob *out, int max_out,
+                   int *n_blobs);
+};
+
+// ---- sc_create() ----
+sc_centroider *sc_create(int max_width) {
+    if (max_width < 1) {
+        return nullptr;
+    }
+    sc_centroider *c = new (std::nothrow) sc_centroider();
+    if (c != nullptr) {
+        c->max_width = max_width;
+    }
+    return c;
+}
+
+// ---- sc_destroy() ----
+void sc_destroy(sc_centroider *c) {
+    delete c;
+}
+
+// ---- sc_find() ----
+int sc_find(sc_centroider *c, const uint8_t *frame, int width, int height, ptrdiff_t stride,
+            int threshold, int min_area, int max_area, sc_blob *out, int max_out, int *n_blobs) {
+    if (c == nullptr || threshold < 0) {
+        return -1;
+    }
+    // one tile over the whole frame; nothing is brighter than 255, so
+    // every row comes out empty past that
+    uint8_t t8 = (uint8_t)std::min(threshold, 255);
+    return c->find_frame(frame, width, height, stride, std::max(std::max(width, height), 1), &t8, min_area,
+                         max_area, out, max_out, n_blobs);
+}
+
+// ---- sc_find_tiled() ----
+int sc_find_tiled(sc_centroider *c, const uint8_t *frame, int width, int height, ptrdiff_t stride, int tile,
+                  const uint8_t *thresholds, int min_area, int max_area, sc_blob *out, int max_out,
+                  int *n_blobs) {
+    if (c == nullptr || tile < 1) {
+        return -1;
+    }
+    return c->find_frame(frame, width, height, stride, tile, thresholds, min_area, max_area, out, max_out,
+                         n_blobs);
+}
+
+// ---- find_frame() ----
+int sc_centroider::find_frame(const uint8_t *frame, int width, int height, ptrdiff_t stride, int tile,
+                              const uint8_t *thresholds, int min_area, int max_area, sc_blob *out,
+                              int max_out, int *n_blobs) {
+    if (width > max_width || width < 0 || height < 0) {
+        return -1;
+    }
+    const int tiles_x = (width + tile - 1) / tile;
+    int blob_count = 0;
+
+    try {
+        begin_frame();
+        for (int y = 0; y <= height; y++) {
+            cur.clear();
+            if (y < height) {
+                const uint8_t *row = frame + (ptrdiff_t)y * stride;
+                const uint8_t *t_row = thresholds + (size_t)(y / tile) * tiles_x;
+                for (int tx = 0; tx < tiles_x; tx++) {
+                    cut_runs(row, tx * tile, std::min(width, (tx + 1) * tile), t_row[tx]);
+                }
+            }
+            join_row(y, width, min_area, max_area, &blob_count);
+        }
+    } catch (const std::bad_alloc &) {
+        return -1;
+    }
+    return end_frame(blob_count, out, max_out, n_blobs);
+}
+
+// ---- sc_find_runs() ----
+int sc_find_runs(sc_centroider *c, const sc_run *runs, int n_runs, int width, int height, int min_area,
+                 int max_area, sc_blob *out, int max_out, int *n_blobs) {
+    if (c == nullptr || width > c->max_width || width < 0 || height < 0 || n_runs < 0) {
+        return -1;
+    }
+    int blob_count = 0;
+    int k = 0;
+
+    try {
+        c->begin_frame();
+        for (int y = 0; y <= height; y++) {
+            c->cur.clear();
+            for (; k < n_runs && runs[k].y == y; k++) {
+                const sc_run &r = runs[k];
+                if (r.x0 < 0 || r.x1 > width || r.x0 >= r.x1 ||
+                    (!c->cur.empty() && r.x0 < c->cur.back().x1)) {
+                    return -1;
+                }
+                if (!c->cur.empty() && c->cur.back().x1 == r.x0) {
+                    c->cur.back().x1 = r.x1;
+                    c->cur.back().sum += r.sum;
+                    c->cur.back().sum_x += r.sum_x;
+                } else {
+                    c->cur.push_back(Run{r.x0, r.x1, -1, r.sum, r.sum_x});
+                }
+            }
+            if (k < n_runs && runs[k].y < y) {
+                return -1;  // not in raster order
+            }
+            c->join_row(y, width, min_area, max_area, &blob_count);
+        }
+    } catch (const std::bad_alloc &) {
+        return -1;
+    }
+    if (k < n_runs) {
+        return -1;  // runs below the last row
+    }
+    return c->end_frame(blob_count, out, max_out, n_blobs);
+}
+
+// ---- join_row() ----
+// Labels row y's runs (cur) against the row above (prev) and finishes
+// the blobs that stopped there; y == height, with cur empty, finishes
+// the rest.
+void sc_centroider::join_row(int y, int width, int min_area, int max_area, int *blob_count) {
+    // ---------------- JOIN THE ROW ABOVE ----------------
+    // prev and cur are both sorted by x, so one sweep pairs every run
+    // with the runs above it that it touches, diagonals too
+    size_t p = 0;
+    for (Run &r : cur) {
+        while (p < prev.size() && prev[p].x1 < r.x0) {
+            p++;
+        }
+        int label = -1;
+        for (size_t q = p; q < prev.size() && prev[q].x0 <= r.x1; q++) {
+            int other = find(prev[q].label);
+            if (label < 0) {
+                label = other;
+            } else if (other != label) {
+                merge(label, other);
+            }
+        }
+        if (label < 0) {
+            label = new_blob((uint32_t)y * (uint32_t)width + (uint32_t)r.x0, y);
+        }
+        r.label = label;
+
+        Blob &b = blobs[label];
+        b.sum += r.sum;
+        b.sum_x += r.sum_x;
+        b.sum_y += r.sum * (uint64_t)y;
+        b.area += (uint32_t)(r.x1 - r.x0);
+        b.last_row = y;
+    }
+
+    // ---------------- FINISH ----------------
+    // a blob from the row above that no run of this row reached is
+    // complete
+    for (const Run &r : prev) {
+        int root = find(r.label);
+        if (blobs[root].last_row >= 0 && blobs[root].last_row < y) {
+            finish(root, min_area, max_area, blob_count);
+        }
+    }
+    for (Run &r : cur) {
+        r.label = find(r.label);
+    }
+    free_labels.insert(free_labels.end(), retired.begin(), retired.end());
+    retired.clear();
+    std::swap(prev, cur);
+}
+
+// ---- end_frame() ----
+int sc_centroider::end_frame(int blob_count, sc_blob *out, int max_out, int *n_blobs) {
+    std::sort(found.begin(), found.end(),
+              [](const sc_blob &a, const sc_blob &b) { return a.first < b.first; });
+    int n = std::min((int)found.size(), std::max(max_out, 0));
+    std::copy(found.begin(), found.begin() + n, out);
+    if (n_blobs != nullptr) {
+        *n_blobs = blob_count;
+    }
+    return n;
+}
@@ -0,0 +1,158 @@
+// /star-tracker     streaming centroider
+// ----------------------------------------------------------
+// Star centroids from an 8-bit greyscale frame in a single pass over
+// its rows, for centroiding.py (through starcentroid.py) and host tools.
+//   > each row is cut into runs of pixels brighter than the threshold;
+//     16-pixel blocks with nothing above it are skipped whole
+//   > a run joins the blobs of every run it touches in the row above
+//     (8-connected, as scipy's label() with a 3x3 structure), merging
+//     blobs that meet through it (union-find)
+//   > every blob sums area, intensity and first moments as its runs go
+//     by, and is finished the first row none of its runs continues into
+//
+//   The cost is one read of the frame plus a little per run, however
+//   many stars are in view. Working memory is a few rows' worth of runs
+//   and blobs, grown on demand and reused from frame to frame.
+//
+//   Thresholds come from a 256-bin histogram rather than a sort
+//   (threshold.cpp): one for the frame, as np.percentile() gave, or one
+//   per square tile, all from the same single pass.
+//
+//   sc_preprocess() (preprocess.cpp) fuses the steps before all that:
+//   greyscale, 3x3 blur, tile thresholds and runs in one read of the
+//   camera's frame, a strip of rows at a time, and sc_find_runs() takes
+//   its runs straight to blobs.
+// ----------------------------------------------------------
+
+#ifndef STAR_CENTROID_H
+#define STAR_CENTROID_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// one blob: the intensity-weighted centroid of its pixels, as
+// find_centroids() has always computed it
+typedef struct {
+    double x;               // sum(I * x) / sum(I), pixels from the left edge
+    double y;               // sum(I * y) / sum(I), pixels from the top edge
+    uint32_t area;          // pixels above the threshold
+    uint32_t first;         // raster index (y * width + x) of its first pixel
+    uint64_t intensity;     // sum(I)
+} sc_blob;
+
+typedef struct sc_centroider sc_centroider;
+
+// A centroider for frames up to max_width pixels wide; NULL if out of
+// memory or max_width < 1.
+sc_centroider *sc_create(int max_width);
+void sc_destroy(sc_centroider *c);
+
+// Finds the blobs of pixels brighter than threshold (I > threshold, as
+// cv2.THRESH_BINARY) in a width x height frame whose rows are stride
+// bytes apart. Blobs of min_area..max_area pixels with a non-zero
+// intensity are written to out[], at most max_out of them, in raster
+// order of their first pixel (scipy's label order). *n_blobs (if not
+// NULL) gets every blob found, accepted or not.
+// Returns the number written, or -1 for a frame wider than max_width, a
+// negative threshold or an allocation failure.
+int sc_find(sc_centroider *c, const uint8_t *frame, int width, int height, ptrdiff_t stride,
+            int threshold, int min_area, int max_area, sc_blob *out, int max_out, int *n_blobs);
+
+// As sc_find(), but pixel (x, y) is foreground when brighter than
+// thresholds[(y / tile) * tiles_x + x / tile], tiles_x = ceil(width / tile)
+// (sc_tile_thresholds() fills that grid). Blobs may straddle tiles.
+int sc_find_tiled(sc_centroider *c, const uint8_t *frame, int width, int height, ptrdiff_t stride, int tile,
+                  const uint8_t *thresholds, int min_area, int max_area, sc_blob *out, int max_out,
+                  int *n_blobs);
+
+// one run of foreground pixels [x0, x1) in row y, with the sums the
+// centroider needs, so blobs can be built without the pixels
+typedef struct {
+    int32_t y;
+    int32_t x0;
+    int32_t x1;
+    uint32_t sum;           // sum(I)
+    uint64_t sum_x;         // sum(I * x)
+} sc_run;
+
+// As sc_find(), from runs in raster order (y, then x0) rather than a
+// frame: the same blobs sc_find() gives for the frame they came from.
+// Runs that touch in a row are one run. Returns -1 for a frame wider
+// than max_width, runs out of order, overlapping or outside the frame,
+// or an allocation failure.
+int sc_find_runs(sc_centroider *c, const sc_run *runs, int n_runs, int width, int height, int min_area,
+                 int max_area, sc_blob *out, int max_out, int *n_blobs);
+
+// ---------------- THRESHOLDS ----------------
+
+// hist[v] = pixels of value v, in one pass over the frame
+void sc_histogram(const uint8_t *frame, int width, int height, ptrdiff_t stride, uint32_t hist[256]);
+
+// np.percentile() of the pixels hist[] counts (percentile 0-100, linear
+// interpolation between the two closest ranks); 0 for an empty histogram
+double sc_hist_percentile(const uint32_t hist[256], double percentile);
+
+// One threshold per tile x tile square (the last row and column of tiles
+// may be cut short): floor of the tile's percentile, never below
+// min_threshold, so a tile of pure background doesn't turn its own top
+// percent of noise into stars. thresholds[] holds ceil(height / tile)
+// rows of ceil(width / tile). One pass over the frame, one 256-bin
+// histogram per tile column. Returns 0, or -1 for tile < 1 or no memory.
+int sc_tile_thresholds(const uint8_t *frame, int width, int height, ptrdiff_t stride, int tile,
+                       double percentile, int min_threshold, uint8_t *thresholds);
+
+// ---------------- FUSED PREPROCESSING ----------------
+
+typedef struct sc_prep sc_prep;
+
+// Working memory for sc_preprocess() on frames up to max_width pixels
+// wide; NULL if out of memory or max_width < 1.
+sc_prep *sc_prep_create(int max_width);
+void sc_prep_destroy(sc_prep *p);
+
+// Contrast enhancement for sc_preprocess(), off until this is called:
+// cv2.createCLAHE(clip_limit, (tiles_x, tiles_y)).apply() on the grey
+// frame, ahead of the blur. A tile's LUT needs its whole histogram, so
+// each frame is mapped through the LUTs of the frame before, whose grey
+// rows were counted as they went by; only the first frame (or the first
+// of a new size) pays a counting pass of its own. tiles 0, 0 turns it
+// off. Returns -1 for bad tiles or out of memory.
+int sc_prep_clahe(sc_prep *p, int tiles_x, int tiles_y, double clip_limit);
+
+// From the camera's frame to foreground runs in one pass, tile rows
+// (one strip) at a time:
+//   > greyscale: channels 1 (grey), 3 (BGR) or 4 (BGRX) bytes per pixel,
+//     as cv2.COLOR_BGR2GRAY rounds it (14-bit fixed point)
+//   > CLAHE, if sc_prep_clahe() turned it on
+//   > 3x3 Gaussian blur, cv2.GaussianBlur(.., (3, 3), 0): [1 2 1] each
+//     way, /16 rounded to nearest, borders reflected (BORDER_REFLECT_101)
+//   > thresholds: threshold >= 0 for one over the whole frame, else one
+//     per tile x tile square as sc_tile_thresholds() gives for the blurred
+//     frame (percentile, min_threshold)
+//   > runs of blurred pixels brighter than their threshold, in raster
+//     order, for sc_find_runs()
+// The strip of blurred rows is the only intermediate image: tile 64 at
+// 1920 px wide is 120 KB, well inside the Pi Zero 2 W's 512 KB L2, so
+// the frame is read from memory once and nothing full-frame is written.
+// hist (if not NULL) gets the blurred frame's histogram, from which the
+// next frame's global threshold can be taken (sc_hist_percentile()).
+// Returns the number of runs (sc_prep_runs()), or -1 for a frame wider
+// than max_width, channels other than 1, 3 or 4, tile < 1 or an
+// allocation failure.
+int sc_preprocess(sc_prep *p, const uint8_t *frame, int width, int height, ptrdiff_t stride, int channels,
+                  int tile, int threshold, double percentile, int min_threshold, uint32_t hist[256]);
+
+// the last sc_preprocess() call's runs, and its thresholds as
+// ceil(height / tile) rows of ceil(width / tile); valid until the next call
+const sc_run *sc_prep_runs(const sc_prep *p);
+const uint8_t *sc_prep_thresholds(const sc_prep *p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STAR_CENTROID_H
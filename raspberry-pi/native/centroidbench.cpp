@@ -0,0 +1,492 @@
+// /star-tracker     centroidbench
+// ----------------------------------------------------------
+// Host benchmark for the streaming centroider (centroid.h) on synthetic
+// IMX290-sized frames: a noisy background plus N Gaussian star images.
+//
+//   For each star count, reports ms per frame and Mpixel/s for
+//   sc_find(), and the same frame through the per-blob scan
+//   centroiding.py used to do (label, then one full-frame masked sum per
+//   blob), which grows with the number of blobs. Every blob is checked
+//   against a flood-fill reference labelling: same blobs, same order,
+//   same area and centroid.
+//
+//   Then on one frame of 100 stars (plus --glow): the 99th-percentile
+//   threshold from sc_histogram() against the partition np.percentile()
+//   does (std::nth_element), which must agree exactly, and tiled
+//   thresholds (sc_tile_thresholds + sc_find_tiled) checked against the
+//   flood fill the same way.
+//
+//   Last, the same frame as a BGR camera image through the fused pass
+//   (sc_preprocess + sc_find_runs) against the separate full-frame steps
+//   it replaces: greyscale, a separable 3x3 blur, tile thresholds and
+//   sc_find_tiled, tiled (also from the grey frame) and with the global
+//   threshold. The blur is
+//   checked against a direct 9-tap reference, and thresholds and blobs
+//   must agree exactly. Exits non-zero on any
+//   mismatch.
+//
+//   usage: centroidbench [options]
+//     --size W H        frame size              (default 1920 1080)
+//     --reps N          timed sc_find() passes  (default 20)
+//     --threshold T     pixels brighter than T are foreground (default 40)
+//     --scan-max N      skip the per-blob scan past N stars (default 1000)
+//     --glow G          sky glow rising G counts left to right (default 0)
+//     --tile T          tiled thresholds over T x T px tiles  (default 64)
+//     --seed S          RNG seed
+// ----------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "centroid.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kMinArea = 3;     // find_centroids() defaults
+constexpr int kMaxArea = 200;
+constexpr int kStarCounts[] = {0, 10, 100, 1000, 5000};
+constexpr double kPercentile = 99.0;  // find_centroids()' threshold
+constexpr int kTileFloor = 20;        // tiled: no threshold below this
+
+struct Frame {
+    int width = 0, height = 0;
+    std::vector<uint8_t> px;
+};
+
+// background of 8-24 counts plus glow rising 0-glow counts across the
+// frame, stars as Gaussians of sigma 0.8-1.6 px peaking at 60-255
+// counts (overlapping stars add, clipped at 255)
+Frame synth(int width, int height, int n_stars, double glow, std::mt19937 &rng) {
+    Frame f;
+    f.width = width;
+    f.height = height;
+    std::vector<float> acc((size_t)width * height);
+    std::uniform_real_distribution<float> bg(8.0f, 24.0f);
+    for (size_t k = 0; k < acc.size(); k++) acc[k] = bg(rng) + (float)(glow * (k % width) / width);
+
+    std::uniform_real_distribution<float> ux(0.0f, (float)width), uy(0.0f, (float)height);
+    std::uniform_real_distribution<float> usig(0.8f, 1.6f), upeak(60.0f, 255.0f);
+    for (int s = 0; s < n_stars; s++) {
+        float cx = ux(rng), cy = uy(rng), sig = usig(rng), peak = upeak(rng);
+        int r = (int)std::ceil(4 * sig);
+        for (int y = std::max(0, (int)cy - r); y <= std::min(height - 1, (int)cy + r); y++) {
+            for (int x = std::max(0, (int)cx - r); x <= std::min(width - 1, (int)cx + r); x++) {
+                float dx = x - cx, dy = y - cy;
+                acc[(size_t)y * width + x] += peak * std::exp(-(dx * dx + dy * dy) / (2 * sig * sig));
+            }
+        }
+    }
+    f.px.resize(acc.size());
+    for (size_t k = 0; k < acc.size(); k++) f.px[k] = (uint8_t)std::min(255.0f, acc[k]);
+    return f;
+}
+
+// flood-fill labelling in raster order (scipy's label() numbering),
+// labels from 1, of the pixels brighter than their entry in thr[];
+// returns the label count
+int label_frame(const Frame &f, const std::vector<uint8_t> &thr, std::vector<int> &labels) {
+    labels.assign(f.px.size(), 0);
+    std::vector<int> stack;
+    int n = 0;
+    for (int start = 0; start < (int)f.px.size(); start++) {
+        if (f.px[start] <= thr[start] || labels[start] != 0) continue;
+        labels[start] = ++n;
+        stack.push_back(start);
+        while (!stack.empty()) {
+            int k = stack.back();
+            stack.pop_back();
+            int x = k % f.width, y = k / f.width;
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    int nx = x + dx, ny = y + dy;
+                    if (nx < 0 || ny < 0 || nx >= f.width || ny >= f.height) continue;
+                    int nk = ny * f.width + nx;
+                    if (f.px[nk] > thr[nk] && labels[nk] == 0) {
+                        labels[nk] = n;
+                        stack.push_back(nk);
+                    }
+                }
+            }
+        }
+    }
+    return n;
+}
+
+// centroiding.py's old loop: one full-frame masked sum per blob
+std::vector<sc_blob> per_blob_scan(const Frame &f, const std::vector<int> &labels, int n_labels) {
+    std::vector<sc_blob> out;
+    for (int l = 1; l <= n_labels; l++) {
+        uint64_t area = 0, sum = 0, sum_x = 0, sum_y = 0;
+        uint32_t first = 0;
+        for (int k = 0; k < (int)labels.size(); k++) {
+            if (labels[k] != l) continue;
+            if (area == 0) first = (uint32_t)k;
+            area++;
+            uint64_t v = f.px[k];
+            sum += v;
+            sum_x += v * (uint64_t)(k % f.width);
+            sum_y += v * (uint64_t)(k / f.width);
+        }
+        if (area >= kMinArea && area <= kMaxArea && sum > 0) {
+            out.push_back(sc_blob{(double)sum_x / (double)sum, (double)sum_y / (double)sum, (uint32_t)area, first,
+                                  sum});
+        }
+    }
+    return out;
+}
+
+// the same sums in one pass over the label image
+std::vector<sc_blob> reference(const Frame &f, const std::vector<int> &labels, int n_labels) {
+    std::vector<uint64_t> area(n_labels + 1), sum(n_labels + 1), sum_x(n_labels + 1), sum_y(n_labels + 1);
+    std::vector<uint32_t> first(n_labels + 1, UINT32_MAX);
+    for (int k = 0; k < (int)labels.size(); k++) {
+        int l = labels[k];
+        if (l == 0) continue;
+        uint64_t v = f.px[k];
+        first[l] = std::min(first[l], (uint32_t)k);
+        area[l]++;
+        sum[l] += v;
+        sum_x[l] += v * (uint64_t)(k % f.width);
+        sum_y[l] += v * (uint64_t)(k / f.width);
+    }
+    std::vector<sc_blob> out;
+    for (int l = 1; l <= n_labels; l++) {
+        if (area[l] >= kMinArea && area[l] <= kMaxArea && sum[l] > 0) {
+            out.push_back(sc_blob{(double)sum_x[l] / (double)sum[l], (double)sum_y[l] / (double)sum[l],
+                                  (uint32_t)area[l], first[l], sum[l]});
+        }
+    }
+    return out;
+}
+
+bool same(const std::vector<sc_blob> &a, const std::vector<sc_blob> &b) {
+    if (a.size() != b.size()) return false;
+    for (size_t k = 0; k < a.size(); k++) {
+        if (a[k].x != b[k].x || a[k].y != b[k].y || a[k].area != b[k].area || a[k].first != b[k].first ||
+            a[k].intensity != b[k].intensity) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double ms_since(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+// np.percentile(frame, p) the way numpy gets it: partition for the two
+// ranks either side of p/100 * (n - 1) and interpolate
+double partition_percentile(const Frame &f, double p) {
+    std::vector<uint8_t> v = f.px;
+    double rank = p / 100.0 * (double)(v.size() - 1);
+    size_t lo = (size_t)std::floor(rank);
+    std::nth_element(v.begin(), v.begin() + lo, v.end());
+    double v_lo = v[lo];
+    double v_hi = (lo + 1 < v.size()) ? *std::min_element(v.begin() + lo + 1, v.end()) : v_lo;
+    return v_lo + (rank - (double)lo) * (v_hi - v_lo);
+}
+
+// the same frame as BGR, each channel off the grey value by up to 6
+// counts either way, and the grey value cv2.COLOR_BGR2GRAY gives for it
+std::vector<uint8_t> to_bgr(const Frame &f, std::mt19937 &rng, Frame &gray) {
+    std::uniform_int_distribution<int> jitter(-6, 6);
+    std::vector<uint8_t> bgr(f.px.size() * 3);
+    gray = f;
+    for (size_t k = 0; k < f.px.size(); k++) {
+        for (int ch = 0; ch < 3; ch++) {
+            bgr[k * 3 + ch] = (uint8_t)std::min(255, std::max(0, f.px[k] + jitter(rng)));
+        }
+        gray.px[k] = (uint8_t)((bgr[k * 3] * 1868 + bgr[k * 3 + 1] * 9617 + bgr[k * 3 + 2] * 4899 + 8192) >> 14);
+    }
+    return bgr;
+}
+
+// cv2.GaussianBlur(f, (3, 3), 0): all nine taps at once, reflect-101
+// borders, rounded to nearest
+Frame blur_reference(const Frame &f) {
+    auto refl = [](int i, int n) { return n == 1 ? 0 : (i < 0 ? -i : (i >= n ? 2 * n - 2 - i : i)); };
+    static const int w[3] = {1, 2, 1};
+    Frame out = f;
+    for (int y = 0; y < f.height; y++) {
+        for (int x = 0; x < f.width; x++) {
+            int s = 0;
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    s += w[dy + 1] * w[dx + 1] *
+                         f.px[(size_t)refl(y + dy, f.height) * f.width + refl(x + dx, f.width)];
+                }
+            }
+            out.px[(size_t)y * f.width + x] = (uint8_t)((s + 8) >> 4);
+        }
+    }
+    return out;
+}
+
+// the same blur as two full-frame passes through a 16-bit image, the
+// way a separable filter library does it
+void blur_separable(const std::vector<uint8_t> &in, int width, int height, std::vector<uint16_t> &tmp,
+                    std::vector<uint8_t> &out) {
+    auto refl = [](int i, int n) { return n == 1 ? 0 : (i < 0 ? -i : (i >= n ? 2 * n - 2 - i : i)); };
+    tmp.resize(in.size());
+    out.resize(in.size());
+    for (int y = 0; y < height; y++) {
+        const uint8_t *a = &in[(size_t)refl(y - 1, height) * width], *b = &in[(size_t)y * width],
+                      *c = &in[(size_t)refl(y + 1, height) * width];
+        uint16_t *t = &tmp[(size_t)y * width];
+        for (int x = 0; x < width; x++) t[x] = (uint16_t)(a[x] + 2 * b[x] + c[x]);
+    }
+    for (int y = 0; y < height; y++) {
+        const uint16_t *t = &tmp[(size_t)y * width];
+        uint8_t *o = &out[(size_t)y * width];
+        for (int x = 0; x < width; x++) {
+            o[x] = (uint8_t)((t[refl(x - 1, width)] + 2 * t[x] + t[refl(x + 1, width)] + 8) >> 4);
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    int width = 1920, height = 1080, reps = 20, threshold = 40, scan_max = 1000, tile = 64;
+    double glow = 0.0;
+    unsigned seed = 0x5eed;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto need = [&](int n) {
+            if (i + n >= argc) {
+                std::fprintf(stderr, "centroidbench: %s needs %d value(s)\n", arg.c_str(), n);
+                std::exit(2);
+            }
+        };
+        if (arg == "--size") { need(2); width = std::atoi(argv[++i]); height = std::atoi(argv[++i]); }
+        else if (arg == "--reps") { need(1); reps = std::max(1, std::atoi(argv[++i])); }
+        else if (arg == "--threshold") { need(1); threshold = std::atoi(argv[++i]); }
+        else if (arg == "--scan-max") { need(1); scan_max = std::atoi(argv[++i]); }
+        else if (arg == "--glow") { need(1); glow = std::atof(argv[++i]); }
+        else if (arg == "--tile") { need(1); tile = std::max(1, std::atoi(argv[++i])); }
+        else if (arg == "--seed") { need(1); seed = (unsigned)std::strtoul(argv[++i], nullptr, 0); }
+        else {
+            std::fprintf(stderr, "centroidbench: unknown option %s\n", arg.c_str());
+            return 2;
+        }
+    }
+
+    sc_centroider *c = sc_create(width);
+    if (c == nullptr) {
+        std::fprintf(stderr, "centroidbench: sc_create failed\n");
+        return 1;
+    }
+    std::mt19937 rng(seed);
+    bool ok = true;
+    std::vector<sc_blob> out(8192);
+    std::vector<int> labels;
+
+    std::printf("%dx%d frames, threshold %d, area %d-%d px\n", width, height, threshold, kMinArea, kMaxArea);
+    std::printf(" stars   blobs  accepted   stream ms   Mpix/s   per-blob scan ms   match\n");
+    for (int n_stars : kStarCounts) {
+        Frame f = synth(width, height, n_stars, glow, rng);
+
+        int n_blobs = 0, n = 0;
+        auto t0 = Clock::now();
+        for (int r = 0; r < reps; r++) {
+            n = sc_find(c, f.px.data(), width, height, width, threshold, kMinArea, kMaxArea, out.data(),
+                        (int)out.size(), &n_blobs);
+        }
+        double stream_ms = ms_since(t0) / reps;
+
+        int n_labels = label_frame(f, std::vector<uint8_t>(f.px.size(), (uint8_t)threshold), labels);
+        std::vector<sc_blob> ref = reference(f, labels, n_labels);
+        double scan_ms = -1.0;
+        if (n_stars <= scan_max) {
+            auto t1 = Clock::now();
+            std::vector<sc_blob> scan = per_blob_scan(f, labels, n_labels);
+            scan_ms = ms_since(t1);
+            ok = ok && same(scan, ref);
+        }
+        bool match = n >= 0 && n_blobs == n_labels && same(std::vector<sc_blob>(out.begin(), out.begin() + n), ref);
+        ok = ok && match;
+
+        std::printf("%6d  %6d  %8d  %10.3f  %7.1f  ", n_stars, n_blobs, n, stream_ms,
+                    (double)width * height / (stream_ms * 1e3));
+        if (scan_ms >= 0) {
+            std::printf("%17.1f", scan_ms);
+        } else {
+            std::printf("%17s", "-");
+        }
+        std::printf("   %s\n", match ? "ok" : "MISMATCH");
+    }
+
+    // ---------------- THRESHOLDS ----------------
+    Frame f = synth(width, height, 100, glow, rng);
+    uint32_t hist[256];
+    double hist_pct = 0.0;
+    auto t0 = Clock::now();
+    for (int r = 0; r < reps; r++) {
+        sc_histogram(f.px.data(), width, height, width, hist);
+        hist_pct = sc_hist_percentile(hist, kPercentile);
+    }
+    double hist_ms = ms_since(t0) / reps;
+    t0 = Clock::now();
+    double part_pct = partition_percentile(f, kPercentile);
+    double part_ms = ms_since(t0);
+    ok = ok && hist_pct == part_pct;
+
+    const int tiles_x = (width + tile - 1) / tile, tiles_y = (height + tile - 1) / tile;
+    std::vector<uint8_t> grid((size_t)tiles_x * tiles_y);
+    t0 = Clock::now();
+    for (int r = 0; r < reps; r++) {
+        sc_tile_thresholds(f.px.data(), width, height, width, tile, kPercentile, kTileFloor, grid.data());
+    }
+    double tiles_ms = ms_since(t0) / reps;
+    int n_blobs = 0, n = 0;
+    t0 = Clock::now();
+    for (int r = 0; r < reps; r++) {
+        n = sc_find_tiled(c, f.px.data(), width, height, width, tile, grid.data(), kMinArea, kMaxArea,
+                          out.data(), (int)out.size(), &n_blobs);
+    }
+    double tiled_ms = ms_since(t0) / reps;
+    std::vector<uint8_t> thr(f.px.size());
+    for (size_t k = 0; k < thr.size(); k++) {
+        thr[k] = grid[(k / width / tile) * tiles_x + (k % width) / tile];
+    }
+    int n_labels = label_frame(f, thr, labels);
+    bool tiled_ok = n >= 0 && n_blobs == n_labels &&
+                    same(std::vector<sc_blob>(out.begin(), out.begin() + n), reference(f, labels, n_labels));
+    ok = ok && tiled_ok;
+    int global_n = sc_find(c, f.px.data(), width, height, width, (int)std::floor(hist_pct), kMinArea, kMaxArea,
+                           out.data(), (int)out.size(), &n_blobs);
+
+    std::printf("\n%g%% threshold, 100 stars, glow %g\n", kPercentile, glow);
+    std::printf("  histogram      %8.3f ms   %.2f  (%d accepted)\n", hist_ms, hist_pct, global_n);
+    std::printf("  nth_element    %8.3f ms   %.2f  %s\n", part_ms, part_pct, hist_pct == part_pct ? "ok" : "MISMATCH");
+    std::printf("  %dpx tiles     %8.3f ms   %dx%d grid, floor %d\n", tile, tiles_ms, tiles_x, tiles_y, kTileFloor);
+    std::printf("  tiled find     %8.3f ms   %d accepted of %d  %s\n", tiled_ms, n, n_blobs,
+                tiled_ok ? "ok" : "MISMATCH");
+
+    // ---------------- FUSED ----------------
+    Frame gray;
+    std::vector<uint8_t> bgr = to_bgr(f, rng, gray);
+    Frame blurred = blur_reference(gray);
+    sc_prep *prep = sc_prep_create(width);
+    if (prep == nullptr) {
+        std::fprintf(stderr, "centroidbench: sc_prep_create failed\n");
+        return 1;
+    }
+
+    // the steps apart: each a full-frame image written and read back
+    std::vector<uint8_t> step_gray(f.px.size()), step_blur;
+    std::vector<uint16_t> step_tmp;
+    t0 = Clock::now();
+    for (int r = 0; r < reps; r++) {
+        for (size_t k = 0; k < step_gray.size(); k++) {
+            step_gray[k] =
+                (uint8_t)((bgr[k * 3] * 1868 + bgr[k * 3 + 1] * 9617 + bgr[k * 3 + 2] * 4899 + 8192) >> 14);
+        }
+        blur_separable(step_gray, width, height, step_tmp, step_blur);
+        sc_tile_thresholds(step_blur.data(), width, height, width, tile, kPercentile, kTileFloor, grid.data());
+        n = sc_find_tiled(c, step_blur.data(), width, height, width, tile, grid.data(), kMinArea, kMaxArea,
+                          out.data(), (int)out.size(), &n_blobs);
+    }
+    double steps_ms = ms_since(t0) / reps;
+    std::vector<sc_blob> steps_out(out.begin(), out.begin() + std::max(n, 0));
+    int steps_n = n, steps_blobs = n_blobs;
+    bool fused_ok = n >= 0 && step_blur == blurred.px;
+
+    int n_runs = 0;
+    t0 = Clock::now();
+    for (int r = 0; r < reps; r++) {
+        n_runs = sc_preprocess(prep, bgr.data(), width, height, (ptrdiff_t)width * 3, 3, tile, -1, kPercentile,
+                               kTileFloor, nullptr);
+        n = sc_find_runs(c, sc_prep_runs(prep), n_runs, width, height, kMinArea, kMaxArea, out.data(),
+                         (int)out.size(), &n_blobs);
+    }
+    double fused_ms = ms_since(t0) / reps;
+    int fused_runs = n_runs;
+    fused_ok = fused_ok && n_runs >= 0 && n_blobs == steps_blobs &&
+               std::equal(grid.begin(), grid.end(), sc_prep_thresholds(prep)) &&
+               same(std::vector<sc_blob>(out.begin(), out.begin() + std::max(n, 0)), steps_out);
+
+    // a grey frame (the camera's Y plane) skips the conversion
+    t0 = Clock::now();
+    for (int r = 0; r < reps; r++) {
+        n_runs = sc_preprocess(prep, gray.px.data(), width, height, width, 1, tile, -1, kPercentile, kTileFloor,
+                               nullptr);
+        n = sc_find_runs(c, sc_prep_runs(prep), n_runs, width, height, kMinArea, kMaxArea, out.data(),
+                         (int)out.size(), &n_blobs);
+    }
+    double grey_ms = ms_since(t0) / reps;
+    fused_ok = fused_ok && n_runs == fused_runs && n_blobs == steps_blobs &&
+               same(std::vector<sc_blob>(out.begin(), out.begin() + std::max(n, 0)), steps_out);
+
+    // CLAHE (8x8 tiles, clip 2) ahead of the blur, in steady state: the
+    // LUTs come from the frame before, the first call primes them
+    sc_prep_clahe(prep, 8, 8, 2.0);
+    sc_preprocess(prep, bgr.data(), width, height, (ptrdiff_t)width * 3, 3, tile, -1, kPercentile, kTileFloor,
+                  nullptr);
+    t0 = Clock::now();
+    for (int r = 0; r < reps; r++) {
+        n_runs = sc_preprocess(prep, bgr.data(), width, height, (ptrdiff_t)width * 3, 3, tile, -1, kPercentile,
+                               kTileFloor, nullptr);
+        n = sc_find_runs(c, sc_prep_runs(prep), n_runs, width, height, kMinArea, kMaxArea, out.data(),
+                         (int)out.size(), &n_blobs);
+    }
+    double clahe_ms = ms_since(t0) / reps;
+    int clahe_n = n, clahe_blobs = n_blobs;
+    sc_prep_clahe(prep, 0, 0, 0);
+
+    // global threshold: the first frame pays a histogram pass; after that
+    // each pass applies the previous frame's percentile and counts this
+    // frame's histogram for the next. Checked against sc_find() on the
+    // reference blur.
+    uint32_t fused_hist[256];
+    t0 = Clock::now();
+    for (int r = 0; r < reps; r++) {
+        sc_preprocess(prep, bgr.data(), width, height, (ptrdiff_t)width * 3, 3, tile, 255, kPercentile, 0,
+                      fused_hist);
+        int t = (int)std::floor(sc_hist_percentile(fused_hist, kPercentile));
+        n_runs = sc_preprocess(prep, bgr.data(), width, height, (ptrdiff_t)width * 3, 3, tile, t, kPercentile, 0,
+                               fused_hist);
+        n = sc_find_runs(c, sc_prep_runs(prep), n_runs, width, height, kMinArea, kMaxArea, out.data(),
+                         (int)out.size(), &n_blobs);
+    }
+    double first_ms = ms_since(t0) / reps;
+    int global_t = (int)std::floor(sc_hist_percentile(fused_hist, kPercentile));
+    t0 = Clock::now();
+    for (int r = 0; r < reps; r++) {
+        n_runs = sc_preprocess(prep, bgr.data(), width, height, (ptrdiff_t)width * 3, 3, tile, global_t,
+                               kPercentile, 0, fused_hist);
+        n = sc_find_runs(c, sc_prep_runs(prep), n_runs, width, height, kMinArea, kMaxArea, out.data(),
+                         (int)out.size(), &n_blobs);
+    }
+    double global_ms = ms_since(t0) / reps;
+    sc_histogram(blurred.px.data(), width, height, width, hist);
+    std::vector<sc_blob> ref_out(out.size());
+    int ref_blobs = 0;
+    int ref_n = sc_find(c, blurred.px.data(), width, height, width, global_t, kMinArea, kMaxArea, ref_out.data(),
+                        (int)ref_out.size(), &ref_blobs);
+    bool global_ok = std::equal(hist, hist + 256, fused_hist) && n >= 0 && ref_n >= 0 && n_blobs == ref_blobs &&
+                     same(std::vector<sc_blob>(out.begin(), out.begin() + n),
+                          std::vector<sc_blob>(ref_out.begin(), ref_out.begin() + ref_n));
+    ok = ok && fused_ok && global_ok;
+
+    std::printf("\nBGR frame, 100 stars, glow %g: greyscale, 3x3 blur, %dpx tile thresholds, blobs\n", glow, tile);
+    std::printf("  separate steps %8.3f ms   %d accepted of %d\n", steps_ms, steps_n, steps_blobs);
+    std::printf("  fused          %8.3f ms   %d runs  %s\n", fused_ms, fused_runs, fused_ok ? "ok" : "MISMATCH");
+    std::printf("  fused, grey in %8.3f ms\n", grey_ms);
+    std::printf("  fused + CLAHE  %8.3f ms   %d accepted of %d\n", clahe_ms, clahe_n, clahe_blobs);
+    std::printf("  global, first  %8.3f ms   histogram pass, then threshold %d\n", first_ms, global_t);
+    std::printf("  global         %8.3f ms   last frame's threshold, %d accepted of %d  %s\n", global_ms, n, n_blobs,
+                global_ok ? "ok" : "MISMATCH");
+    sc_prep_destroy(prep);
+    sc_destroy(c);
+    return ok ? 0 : 1;
+}
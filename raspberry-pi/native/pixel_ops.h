@@ -0,0 +1,102 @@
+// /star-tracker     pixel row kernels
+// ----------------------------------------------------------
+// Row-level helpers shared by the centroider, the thresholds and the
+// fused preprocessing pass. Internal: not part of the library's API.
+//   16 pixels at a time through GCC/Clang vector extensions, so one code
+//   path becomes SSE2 (or AVX, with -mavx2) on x86 and NEON on the Pi's
+//   Cortex-A53.
+// ----------------------------------------------------------
+
+#ifndef STAR_PIXEL_OPS_H
+#define STAR_PIXEL_OPS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "centroid.h"
+
+namespace sc_px {
+
+typedef uint8_t u8x16 __attribute__((vector_size(16)));
+typedef uint16_t u16x16 __attribute__((vector_size(32)));
+constexpr int kBlock = 16;
+
+// t in every lane (a broadcast, where filling lane by lane turns into
+// 16 stalled stores at -O3)
+inline u8x16 splat(uint8_t t) {
+    u8x16 v = {};
+    return v + t;
+}
+
+// any of 16 pixels brighter than t
+inline bool any_above(const uint8_t *p, u8x16 t) {
+    u8x16 v;
+    std::memcpy(&v, p, sizeof v);
+    u8x16 hit = (u8x16)(v > t);
+    uint64_t w[2];
+    std::memcpy(w, &hit, sizeof w);
+    return (w[0] | w[1]) != 0;
+}
+
+// Calls run(x0, x1, sum, sum_x) for every run of row[x_begin .. x_end)
+// brighter than t, sum = sum(I) and sum_x = sum(I * x) over [x0, x1).
+template <class Run>
+inline void for_each_run(const uint8_t *row, int x_begin, int x_end, uint8_t t, Run run) {
+    const u8x16 tv = splat(t);
+    int x = x_begin;
+    while (x < x_end) {
+        // skip background a block at a time, then pixel by pixel
+        while (x + kBlock <= x_end && !any_above(row + x, tv)) {
+            x += kBlock;
+        }
+        while (x < x_end && row[x] <= t) {
+            x++;
+        }
+        if (x >= x_end) {
+            break;
+        }
+        int x0 = x;
+        uint64_t sum = 0, sum_x = 0;
+        while (x < x_end && row[x] > t) {
+            sum += row[x];
+            sum_x += (uint64_t)row[x] * (uint64_t)x;
+            x++;
+        }
+        run(x0, x, sum, sum_x);
+    }
+}
+
+// pixels [0, n) of one row into four partial histograms
+inline void count_row(const uint8_t *row, int n, uint32_t h[4][256]) {
+    int x = 0;
+    for (; x + 4 <= n; x += 4) {
+        h[0][row[x]]++;
+        h[1][row[x + 1]]++;
+        h[2][row[x + 2]]++;
+        h[3][row[x + 3]]++;
+    }
+    for (; x < n; x++) {
+        h[0][row[x]]++;
+    }
+}
+
+inline void fold(const uint32_t h[4][256], uint32_t hist[256]) {
+    for (int v = 0; v < 256; v++) {
+        hist[v] = h[0][v] + h[1][v] + h[2][v] + h[3][v];
+    }
+}
+
+// a tile's threshold from its partial histograms: floor of the
+// percentile, at least min_threshold (sc_tile_thresholds())
+inline uint8_t tile_threshold(const uint32_t h[4][256], double percentile, int min_threshold) {
+    uint32_t hist[256];
+    fold(h, hist);
+    int t = (int)std::floor(sc_hist_percentile(hist, percentile));
+    return (uint8_t)std::min(std::max(t, min_threshold), 255);
+}
+
+}  // namespace sc_px
+
+#endif // STAR_PIXEL_OPS_H
@@ -0,0 +1,418 @@
+// /star-tracker     fused preprocessing
+// ----------------------------------------------------------
+// Greyscale, CLAHE, blur, thresholds and runs in one pass (see centroid.h).
+//   Each frame row is converted to grey once, counted into its CLAHE
+//   tile's histogram and mapped through the LUTs the last frame's counts
+//   gave, into a ring of three rows, and blurred into the strip as soon
+//   as the row below it is in. The
+//   strip's tile histograms are counted off the blurred row while it is
+//   still in L1; once the strip is full its thresholds are known and it
+//   is cut into runs, reading it back from L2 rather than memory.
+// ----------------------------------------------------------
+
+#include "centroid.h"
+#include "pixel_ops.h"
+
+#include <algorithm>
+#include <cmath>
+#include <new>
+#include <vector>
+
+namespace {
+
+using sc_px::kBlock;
+using sc_px::u16x16;
+using sc_px::u8x16;
+
+// cv2.COLOR_BGR2GRAY in 14-bit fixed point
+constexpr int kGrayB = 1868, kGrayG = 9617, kGrayR = 4899, kGrayShift = 14;
+
+// BORDER_REFLECT_101 index into [0, n)
+inline int reflect(int i, int n) {
+    if (n == 1) {
+        return 0;
+    }
+    return i < 0 ? -i : (i >= n ? 2 * n - 2 - i : i);
+}
+
+// a constant pixel stride lets the compiler load whole channels at once
+// (NEON ld3/ld4 on the Pi); x86 has no cheap byte deinterleave, so
+// there it stays about a cycle or two per pixel
+template <int kChannels>
+inline void to_gray(const uint8_t *src, int width, uint8_t *dst) {
+    for (int x = 0; x < width; x++) {
+        const uint8_t *px = src + (ptrdiff_t)x * kChannels;
+        dst[x] = (uint8_t)((px[0] * kGrayB + px[1] * kGrayG + px[2] * kGrayR + (1 << (kGrayShift - 1))) >>
+                           kGrayShift);
+    }
+}
+
+// one blurred row from the grey rows above (a), at (b) and below (c);
+// v holds width + 2 column sums, v[0] and v[width + 1] the reflected
+// borders
+inline void blur_row(const uint8_t *a, const uint8_t *b, const uint8_t *c, int width, uint16_t *v,
+                     uint8_t *out) {
+    uint16_t *vc = v + 1;
+    int x = 0;
+    for (; x + kBlock <= width; x += kBlock) {
+        u8x16 ra, rb, rc;
+        std::memcpy(&ra, a + x, sizeof ra);
+        std::memcpy(&rb, b + x, sizeof rb);
+        std::memcpy(&rc, c + x, sizeof rc);
+        u16x16 s = __builtin_convertvector(ra, u16x16) + (__builtin_convertvector(rb, u16x16) << 1) +
+                   __builtin_convertvector(rc, u16x16);
+        std::memcpy(vc + x, &s, sizeof s);
+    }
+    for (; x < width; x++) {
+        vc[x] = (uint16_t)(a[x] + 2 * b[x] + c[x]);
+    }
+    vc[-1] = vc[reflect(-1, width)];
+    vc[width] = vc[reflect(width, width)];
+
+    // at most (4 * 1020 + 8) >> 4 = 255, so the narrowing is exact
+    x = 0;
+    for (; x + kBlock <= width; x += kBlock) {
+        u16x16 l, m, r;
+        std::memcpy(&l, vc + x - 1, sizeof l);
+        std::memcpy(&m, vc + x, sizeof m);
+        std::memcpy(&r, vc + x + 1, sizeof r);
+        u16x16 s = (l + (m << 1) + r + 8) >> 4;
+        u8x16 o = __builtin_convertvector(s, u8x16);
+        std::memcpy(out + x, &o, sizeof o);
+    }
+    for (; x < width; x++) {
+        out[x] = (uint8_t)((vc[x - 1] + 2 * vc[x] + vc[x + 1] + 8) >> 4);
+    }
+}
+
+}  // namespace
+
+struct sc_prep {
+    int max_width;
+    std::vector<uint8_t> ring;          // 3 grey rows, for colour frames or CLAHE
+    int ring_row[3];                    // frame row each slot holds
+    std::vector<uint8_t> grey;          // a colour row in grey, before CLAHE
+    std::vector<uint16_t> vsum;         // column sums, width + 2
+    std::vector<uint8_t> strip;         // blurred rows of the current strip
+    std::vector<uint32_t> tile_h;       // 4 x 256 counts per tile column
+    std::vector<uint8_t> thresholds;
+    std::vector<sc_run> runs;
+
+    // CLAHE (sc_prep_clahe()), off while clahe_x is 0. A frame that
+    // doesn't split evenly into tiles is padded right and bottom
+    // (reflect-101) to ext_w x ext_h, as cv2 does.
+    int clahe_x = 0, clahe_y = 0;
+    double clahe_clip = 0;
+    int lut_w = -1, lut_h = -1;         // frame size lut was built for, -1: none
+    int ext_w = 0, ext_h = 0, clahe_tw = 0, clahe_th = 0;  // padded frame, tile size
+    std::vector<uint8_t> lut;           // [clahe_y * clahe_x][256]
+    std::vector<uint32_t> clahe_h;      // [clahe_y * clahe_x][256] this frame's grey counts
+    std::vector<int> ind1, ind2;        // per column: LUT offset of the left and right tile
+    std::vector<float> xa;              // per column: weight of the right tile
+
+    // the frame's raw grey row y: the frame itself, or converted into buf
+    static const uint8_t *raw_gray(const uint8_t *frame, int width, ptrdiff_t stride, int channels, int y,
+                                   uint8_t *buf) {
+        const uint8_t *src = frame + (ptrdiff_t)y * stride;
+        if (channels == 1) {
+            return src;
+        }
+        if (channels == 3) {
+            to_gray<3>(src, width, buf);
+        } else {
+            to_gray<4>(src, width, buf);
+        }
+        return buf;
+    }
+
+    // grey row y (already reflected) of the frame, after CLAHE; each row
+    // is made (and counted) once, as the blur asks for it
+    const uint8_t *gray(const uint8_t *frame, int width, int height, ptrdiff_t stride, int channels, int y) {
+        if (channels == 1 && clahe_x == 0) {
+            return frame + (ptrdiff_t)y * stride;
+        }
+        uint8_t *dst = ring.data() + (size_t)(y % 3) * max_width;
+        if (ring_row[y % 3] != y) {
+            if (clahe_x == 0) {
+                raw_gray(frame, width, stride, channels, y, dst);
+            } else {
+                const uint8_t *g = raw_gray(frame, width, stride, channels, y, grey.data());
+                clahe_count(g, y, width, height);
+                clahe_map(g, y, width, dst);
+            }
+            ring_row[y % 3] = y;
+        }
+        return dst;
+    }
+
+    // tile sizes and per-column interpolation weights for a frame
+    void clahe_layout(int width, int height) {
+        const bool even = width % clahe_x == 0 && height % clahe_y == 0;
+        ext_w = even ? width : width + clahe_x - width % clahe_x;
+        ext_h = even ? height : height + clahe_y - height % clahe_y;
+        clahe_tw = ext_w / clahe_x;
+        clahe_th = ext_h / clahe_y;
+        const float inv_tw = 1.0f / clahe_tw;
+        for (int x = 0; x < width; x++) {
+            float txf = x * inv_tw - 0.5f;
+            int tx1 = (int)std::floor(txf);
+            xa[x] = txf - tx1;
+            ind1[x] = std::max(tx1, 0) * 256;
+            ind2[x] = std::min(tx1 + 1, clahe_x - 1) * 256;
+        }
+    }
+
+    // grey row y into its tiles' histograms, once for itself and once
+    // for every padding row that mirrors it
+    void clahe_count(const uint8_t *row, int y, int width, int height) {
+        for (int e = y; e < ext_h; e = (e == y) ? height : e + 1) {
+            if (e != y && reflect(e, height) != y) {
+                continue;
+            }
+            uint32_t *h = clahe_h.data() + (size_t)(e / clahe_th) * clahe_x * 256;
+            for (int tx = 0; tx < clahe_x; tx++, h += 256) {
+                const int x0 = tx * clahe_tw, x1 = x0 + clahe_tw;
+                int x = x0;
+                for (; x < std::min(x1, width); x++) {
+                    h[row[x]]++;
+                }
+                for (; x < x1; x++) {
+                    h[row[reflect(x, width)]]++;
+                }
+            }
+        }
+    }
+
+    // clahe_h -> lut: each tile's histogram clipped at clip_limit times its
+    // mean bin, the excess spread evenly, then its cdf scaled to 0-255
+    // (cv2's CLAHE_CalcLut_Body, rounding included)
+    void clahe_build() {
+        const int area = clahe_tw * clahe_th;
+        const float scale = 255.0f / area;
+        const int clip = clahe_clip > 0 ? std::max((int)(clahe_clip * area / 256), 1) : 0;
+        for (int t = 0; t < clahe_x * clahe_y; t++) {
+            int h[256];
+            for (int i = 0; i < 256; i++) {
+                h[i] = (int)clahe_h[(size_t)t * 256 + i];
+            }
+            if (clip > 0) {
+                int clipped = 0;
+                for (int i = 0; i < 256; i++) {
+                    if (h[i] > clip) {
+                        clipped += h[i] - clip;
+                        h[i] = clip;
+                    }
+                }
+                const int batch = clipped / 256;
+                int residual = clipped - batch * 256;
+                for (int i = 0; i < 256; i++) {
+                    h[i] += batch;
+                }
+                if (residual != 0) {
+                    const int step = std::max(256 / residual, 1);
+                    for (int i = 0; i < 256 && residual > 0; i += step, residual--) {
+                        h[i]++;
+                    }
+                }
+            }
+            int sum = 0;
+            for (int i = 0; i < 256; i++) {
+                sum += h[i];
+                lut[(size_t)t * 256 + i] = (uint8_t)std::min(std::max((int)std::lrint(sum * scale), 0), 255);
+            }
+        }
+    }
+
+    // row y through the LUTs, bilinear between the four nearest tile
+    // centres (cv2's CLAHE_Interpolation_Body, same float arithmetic)
+    void clahe_map(const uint8_t *row, int y, int width, uint8_t *out) const {
+        const float tyf = y * (1.0f / clahe_th) - 0.5f;
+        const int ty = (int)std::floor(tyf);
+        const float ya = tyf - ty, ya1 = 1.0f - ya;
+        const uint8_t *l1 = lut.data() + (size_t)std::max(ty, 0) * clahe_x * 256;
+        const uint8_t *l2 = lut.data() + (size_t)std::min(ty + 1, clahe_y - 1) * clahe_x * 256;
+        for (int x = 0; x < width; x++) {
+            const int i1 = ind1[x] + row[x], i2 = ind2[x] + row[x];
+            const float xr = xa[x], xl = 1.0f - xr;
+            float res = (l1[i1] * xl + l1[i2] * xr) * ya1 + (l2[i1] * xl + l2[i2] * xr) * ya;
+            out[x] = (uint8_t)std::min(std::max((int)std::lrint(res), 0), 255);
+        }
+    }
+
+    // appends the runs of blurred row y brighter than its tiles'
+    // thresholds; runs meeting at a tile edge are one run
+    void cut_runs(const uint8_t *row, int y, int width, int tile, const uint8_t *t_row) {
+        const int tiles_x = (width + tile - 1) / tile;
+        for (int tx = 0; tx < tiles_x; tx++) {
+            sc_px::for_each_run(row, tx * tile, std::min(width, (tx + 1) * tile), t_row[tx],
+                                [this, y](int x0, int x1, uint64_t sum, uint64_t sum_x) {
+                                    if (!runs.empty() && runs.back().y == y && runs.back().x1 == x0) {
+                                        runs.back().x1 = x1;
+                                        runs.back().sum += (uint32_t)sum;
+                                        runs.back().sum_x += sum_x;
+                                    } else {
+                                        runs.push_back(sc_run{y, x0, x1, (uint32_t)sum, sum_x});
+                                    }
+                                });
+        }
+    }
+};
+
+// ---- sc_prep_create() ----
+sc_prep *sc_prep_create(int max_width) {
+    if (max_width < 1) {
+        return nullptr;
+    }
+    sc_prep *p = new (std::nothrow) sc_prep();
+    if (p == nullptr) {
+        return nullptr;
+    }
+    p->max_width = max_width;
+    try {
+        p->ring.resize((size_t)3 * max_width);
+        p->grey.resize((size_t)max_width);
+        p->vsum.resize((size_t)max_width + 2);
+        p->ind1.resize((size_t)max_width);
+        p->ind2.resize((size_t)max_width);
+        p->xa.resize((size_t)max_width);
+    } catch (const std::bad_alloc &) {
+        delete p;
+        return nullptr;
+    }
+    return p;
+}
+
+// ---- sc_prep_destroy() ----
+void sc_prep_destroy(sc_prep *p) {
+    delete p;
+}
+
+// ---- sc_prep_clahe() ----
+int sc_prep_clahe(sc_prep *p, int tiles_x, int tiles_y, double clip_limit) {
+    if (p == nullptr || tiles_x < 0 || tiles_y < 0 || (tiles_x == 0) != (tiles_y == 0)) {
+        return -1;
+    }
+    if (tiles_x != p->clahe_x || tiles_y != p->clahe_y || clip_limit != p->clahe_clip) {
+        try {
+            p->lut.resize((size_t)tiles_x * tiles_y * 256);
+            p->clahe_h.resize((size_t)tiles_x * tiles_y * 256);
+        } catch (const std::bad_alloc &) {
+            p->clahe_x = p->clahe_y = 0;
+            return -1;
+        }
+        p->clahe_x = tiles_x;
+        p->clahe_y = tiles_y;
+        p->clahe_clip = clip_limit;
+        p->lut_w = p->lut_h = -1;
+    }
+    return 0;
+}
+
+// ---- sc_prep_runs() ----
+const sc_run *sc_prep_runs(const sc_prep *p) {
+    return p->runs.data();
+}
+
+// ---- sc_prep_thresholds() ----
+const uint8_t *sc_prep_thresholds(const sc_prep *p) {
+    return p->thresholds.data();
+}
+
+// ---- sc_preprocess() ----
+int sc_preprocess(sc_prep *p, const uint8_t *frame, int width, int height, ptrdiff_t stride, int channels,
+                  int tile, int threshold, double percentile, int min_threshold, uint32_t hist[256]) {
+    if (p == nullptr || width > p->max_width || width < 0 || height < 0 || tile < 1 ||
+        (channels != 1 && channels != 3 && channels != 4)) {
+        return -1;
+    }
+    const int tiles_x = (width + tile - 1) / tile, tiles_y = (height + tile - 1) / tile;
+    const int strip_rows = std::min(tile, height);
+    // a fixed threshold needs no counting unless the caller wants hist
+    const bool count = threshold < 0 || hist != nullptr;
+
+    try {
+        p->runs.clear();
+        if (p->strip.size() < (size_t)strip_rows * width) {
+            p->strip.resize((size_t)strip_rows * width);
+        }
+        p->tile_h.resize((size_t)tiles_x * 4 * 256);
+        p->thresholds.resize((size_t)tiles_x * tiles_y);
+    } catch (const std::bad_alloc &) {
+        return -1;
+    }
+    uint32_t (*tile_h)[4][256] = reinterpret_cast<uint32_t (*)[4][256]>(p->tile_h.data());
+    std::fill(p->ring_row, p->ring_row + 3, -1);
+    if (hist != nullptr) {
+        std::fill(hist, hist + 256, 0);
+    }
+    if (width == 0) {
+        return 0;
+    }
+
+    // ---------------- CLAHE LUTS ----------------
+    // this frame is mapped through the last one's LUTs; without them (the
+    // first frame, or a new size) a pass over its own grey builds them
+    if (p->clahe_x > 0) {
+        if (p->lut_w != width || p->lut_h != height) {
+            p->clahe_layout(width, height);
+            std::fill(p->clahe_h.begin(), p->clahe_h.end(), 0);
+            for (int y = 0; y < height; y++) {
+                p->clahe_count(p->raw_gray(frame, width, stride, channels, y, p->grey.data()), y, width, height);
+            }
+            p->clahe_build();
+            p->lut_w = width;
+            p->lut_h = height;
+        }
+        std::fill(p->clahe_h.begin(), p->clahe_h.end(), 0);
+    }
+
+    try {
+        for (int y0 = 0; y0 < height; y0 += tile) {
+            const int rows = std::min(tile, height - y0);
+
+            // ---------------- BLUR ----------------
+            if (count) {
+                std::fill(p->tile_h.begin(), p->tile_h.end(), 0);
+            }
+            for (int r = 0; r < rows; r++) {
+                const int y = y0 + r;
+                const uint8_t *a = p->gray(frame, width, height, stride, channels, reflect(y - 1, height));
+                const uint8_t *b = p->gray(frame, width, height, stride, channels, y);
+                const uint8_t *c = p->gray(frame, width, height, stride, channels, reflect(y + 1, height));
+                uint8_t *out = p->strip.data() + (size_t)r * width;
+                blur_row(a, b, c, width, p->vsum.data(), out);
+                if (count) {
+                    for (int tx = 0; tx < tiles_x; tx++) {
+                        sc_px::count_row(out + tx * tile, std::min(width - tx * tile, tile), tile_h[tx]);
+                    }
+                }
+            }
+
+            // ---------------- THRESHOLDS ----------------
+            uint8_t *t_row = p->thresholds.data() + (size_t)(y0 / tile) * tiles_x;
+            for (int tx = 0; tx < tiles_x; tx++) {
+                t_row[tx] = threshold >= 0 ? (uint8_t)std::min(threshold, 255)
+                                           : sc_px::tile_threshold(tile_h[tx], percentile, min_threshold);
+                if (hist != nullptr) {
+                    for (int v = 0; v < 256; v++) {
+                        hist[v] += tile_h[tx][0][v] + tile_h[tx][1][v] + tile_h[tx][2][v] + tile_h[tx][3][v];
+                    }
+                }
+            }
+
+            // ---------------- RUNS ----------------
+            for (int r = 0; r < rows; r++) {
+                p->cut_runs(p->strip.data() + (size_t)r * width, y0 + r, width, tile, t_row);
+            }
+        }
+    } catch (const std::bad_alloc &) {
+        p->lut_w = -1;
+        return -1;
+    }
+
+    // every row was counted as it went by: the next frame's LUTs
+    if (p->clahe_x > 0) {
+        p->clahe_build();
+    }
+    return (int)p->runs.size();
+}
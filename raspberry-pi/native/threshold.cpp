@@ -0,0 +1,94 @@
+// /star-tracker     histogram thresholds
+// ----------------------------------------------------------
+// Percentile thresholds for the centroider (see centroid.h).
+//   8-bit pixels have only 256 values, so a percentile is a walk up a
+//   256-bin histogram rather than a partition of the whole frame, and
+//   the histogram is one pass of increments. Four interleaved
+//   histograms keep a run of equal pixels (the dark sky) from stalling
+//   on one counter.
+// ----------------------------------------------------------
+
+#include "centroid.h"
+#include "pixel_ops.h"
+
+#include <algorithm>
+#include <cmath>
+#include <new>
+#include <vector>
+
+namespace {
+
+using sc_px::count_row;
+using sc_px::fold;
+
+// value of rank k (0-based) among the pixels hist[] counts
+inline int rank_value(const uint32_t hist[256], uint64_t k) {
+    uint64_t seen = 0;
+    for (int v = 0; v < 256; v++) {
+        seen += hist[v];
+        if (seen > k) {
+            return v;
+        }
+    }
+    return 255;
+}
+
+}  // namespace
+
+// ---- sc_histogram() ----
+void sc_histogram(const uint8_t *frame, int width, int height, ptrdiff_t stride, uint32_t hist[256]) {
+    uint32_t h[4][256] = {{0}};
+    for (int y = 0; y < height; y++) {
+        count_row(frame + (ptrdiff_t)y * stride, width, h);
+    }
+    fold(h, hist);
+}
+
+// ---- sc_hist_percentile() ----
+double sc_hist_percentile(const uint32_t hist[256], double percentile) {
+    uint64_t n = 0;
+    for (int v = 0; v < 256; v++) {
+        n += hist[v];
+    }
+    if (n == 0) {
+        return 0.0;
+    }
+    // numpy's "linear" method: rank p/100 * (n - 1), between its floor
+    // and the next rank up
+    double rank = std::min(std::max(percentile, 0.0), 100.0) / 100.0 * (double)(n - 1);
+    uint64_t lo = (uint64_t)std::floor(rank);
+    int v_lo = rank_value(hist, lo);
+    int v_hi = (lo + 1 < n) ? rank_value(hist, lo + 1) : v_lo;
+    return v_lo + (rank - (double)lo) * (v_hi - v_lo);
+}
+
+// ---- sc_tile_thresholds() ----
+int sc_tile_thresholds(const uint8_t *frame, int width, int height, ptrdiff_t stride, int tile,
+                       double percentile, int min_threshold, uint8_t *thresholds) {
+    if (tile < 1 || width < 0 || height < 0) {
+        return -1;
+    }
+    const int tiles_x = (width + tile - 1) / tile;
+    std::vector<uint32_t> h;
+    try {
+        h.resize((size_t)tiles_x * 4 * 256);
+    } catch (const std::bad_alloc &) {
+        return -1;
+    }
+    uint32_t (*tile_h)[4][256] = reinterpret_cast<uint32_t (*)[4][256]>(h.data());
+
+    for (int y0 = 0; y0 < height; y0 += tile) {
+        std::fill(h.begin(), h.end(), 0);
+        for (int y = y0; y < std::min(height, y0 + tile); y++) {
+            const uint8_t *row = frame + (ptrdiff_t)y * stride;
+            for (int tx = 0; tx < tiles_x; tx++) {
+                count_row(row + tx * tile, std::min(width - tx * tile, tile), tile_h[tx]);
+            }
+        }
+        for (int tx = 0; tx < tiles_x; tx++) {
+            thresholds[(size_t)(y0 / tile) * tiles_x + tx] =
+                sc_px::tile_threshold(tile_h[tx], percentile, min_threshold);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,131 @@
+# /star-tracker     continuous pipeline
+# ----------------------------------------------------------
+# Runs capture, centroiding and SPI as three overlapping stages
+# for as long as the source has frames.
+#   > capture thread: source.grab() into a bounded queue of
+#     `depth` frames; when it's full, capture waits (the source
+#     lends out only so many buffers anyway)
+#   > centroid stage (the calling thread): each frame through
+#     find_centroids() while frame N+1 is being captured. The
+#     native centroider drops the GIL, so the two really run at
+#     once. The frame's buffer goes back as soon as it's done.
+#   > send thread: the centroids out over SPI, opened once
+#   Frame rate is the slowest stage's, not the sum of the three.
+
+import queue
+import threading
+import time
+
+POLL = 0.1  # seconds between checks for stop() while a queue is blocked
+
+
+class Pipeline:
+    def __init__(self, source, centroid, send=None, archiver=None, depth=2, report_every=50):
+        # centroid(image) -> [(x, y), ...]; send(centroids), or None to drop them
+        self.source = source
+        self.centroid = centroid
+        self.send = send
+        self.archiver = archiver
+        self.report_every = report_every
+        self._frames = queue.Queue(maxsize=depth)
+        self._results = queue.Queue(maxsize=depth)
+        self._stop = threading.Event()
+        self._error = None
+        self.frames = 0
+        self.centroid_s = 0.0       # total time in centroid()
+        self.send_s = 0.0           # total time in send()
+
+    def stop(self):
+        self._stop.set()
+
+    def _put(self, q, item):
+        # blocks like q.put(), but gives up once stop() is called
+        while not self._stop.is_set():
+            try:
+                q.put(item, timeout=POLL)
+                return True
+            except queue.Full:
+                pass
+        return False
+
+    def _capture(self):
+        try:
+            while not self._stop.is_set():
+                frame = self.source.grab()
+                if frame is None:
+                    break
+                if not self._put(self._frames, frame):
+                    frame.release()
+        except Exception as e:
+            self._error = e
+        finally:
+            self._put(self._frames, None)
+
+    def _sender(self):
+        while True:
+            centroids = self._results.get()
+            if centroids is None:
+                return
+            t0 = time.perf_counter()
+            try:
+                self.send(centroids)
+            except Exception as e:
+                self._error = e
+                self.stop()
+            self.send_s += time.perf_counter() - t0
+
+    def run(self, max_frames=None):
+        # until the source runs dry, max_frames are done, stop() or Ctrl-C;
+        # returns the number of frames centroided
+        capture = threading.Thread(target=self._capture, name="capture", daemon=True)
+        sender = threading.Thread(target=self._sender, name="send", daemon=True)
+        capture.start()
+        if self.send is not None:
+            sender.start()
+        start = time.perf_counter()
+        try:
+            while not self._stop.is_set() and (max_frames is None or self.frames < max_frames):
+                try:
+                    frame = self._frames.get(timeout=POLL)
+                except queue.Empty:
+                    continue
+                if frame is None:
+                    break
+                try:
+                    if self.archiver is not None:
+                        self.archiver.submit(frame.image)
+                    t0 = time.perf_counter()
+                    centroids = self.centroid(frame.image)
+                    self.centroid_s += time.perf_counter() - t0
+                finally:
+                    frame.release()
+                self.frames += 1
+                if self.send is not None:
+                    self._put(self._results, centroids)
+                if self.report_every and self.frames % self.report_every == 0:
+                    self.report(time.perf_counter() - start)
+        except KeyboardInterrupt:
+            print("[Pipeline] Interrupted.")
+        finally:
+            self.stop()
+            capture.join()
+            # frames still queued hand their buffers back
+            while True:
+                try:
+                    frame = self._frames.get_nowait()
+                except queue.Empty:
+                    break
+                if frame is not None:
+                    frame.release()
+            if self.send is not None:
+                self._results.put(None)
+                sender.join()
+        self.report(time.perf_counter() - start)
+        if self._error is not None:
+            raise self._error
+        return self.frames
+
+    def report(self, elapsed):
+        n = max(self.frames, 1)
+        print(f"[Pipeline] {self.frames} frames, {self.frames / max(elapsed, 1e-9):.1f} fps: "
+              f"centroid {1e3 * self.centroid_s / n:.1f} ms, send {1e3 * self.send_s / n:.1f} ms per frame")
@@ -0,0 +1,250 @@
+# /star-tracker     native centroider bindings
+# ----------------------------------------------------------
+# ctypes front end for libstarcentroid (native/centroid.h): single-pass,
+# row-streaming blob extraction, so centroiding costs one trip over the
+# frame however many stars are in view.
+#   > build it with the repo's CMake (cmake -S . -B build && cmake
+#     --build build), on the Pi or the host
+#   > the library is looked for in $STARCENTROID_LIB, next to this file,
+#     then in build/raspberry-pi/native/
+#   > frames are passed by pointer, never copied: any 2-D uint8 array
+#     whose pixels are contiguous along each row will do
+#   > thresholds come from a 256-bin histogram (percentile(), equal to
+#     np.percentile() on uint8), or one per square tile
+#     (tile_thresholds()) for a sky that isn't evenly dark
+#   > Centroider.find_frame() takes the camera's frame as it comes (grey,
+#     BGR or BGRX) through greyscale, CLAHE (Centroider.clahe()), blur,
+#     threshold and blobs in one fused pass (sc_preprocess), with no
+#     intermediate images
+
+import ctypes
+import os
+import sys
+
+import numpy as np
+
+_LIB_NAME = "libstarcentroid.dylib" if sys.platform == "darwin" else "libstarcentroid.so"
+_HERE = os.path.dirname(os.path.abspath(__file__))
+_SEARCH = [
+    os.environ.get("STARCENTROID_LIB", ""),
+    os.path.join(_HERE, _LIB_NAME),
+    os.path.join(_HERE, "..", "build", "raspberry-pi", "native", _LIB_NAME),
+]
+
+
+class Blob(ctypes.Structure):
+    # mirrors sc_blob
+    _fields_ = [
+        ("x", ctypes.c_double),
+        ("y", ctypes.c_double),
+        ("area", ctypes.c_uint32),
+        ("first", ctypes.c_uint32),
+        ("intensity", ctypes.c_uint64),
+    ]
+
+
+def _load():
+    for path in _SEARCH:
+        if path and os.path.exists(path):
+            lib = ctypes.CDLL(path)
+            lib.sc_create.argtypes = [ctypes.c_int]
+            lib.sc_create.restype = ctypes.c_void_p
+            lib.sc_destroy.argtypes = [ctypes.c_void_p]
+            lib.sc_destroy.restype = None
+            lib.sc_find.argtypes = [ctypes.c_void_p, ctypes.c_void_p, ctypes.c_int, ctypes.c_int,
+                                    ctypes.c_ssize_t, ctypes.c_int, ctypes.c_int, ctypes.c_int,
+                                    ctypes.POINTER(Blob), ctypes.c_int, ctypes.POINTER(ctypes.c_int)]
+            lib.sc_find.restype = ctypes.c_int
+            lib.sc_find_tiled.argtypes = [ctypes.c_void_p, ctypes.c_void_p, ctypes.c_int, ctypes.c_int,
+                                          ctypes.c_ssize_t, ctypes.c_int, ctypes.c_void_p, ctypes.c_int,
+                                          ctypes.c_int, ctypes.POINTER(Blob), ctypes.c_int,
+                                          ctypes.POINTER(ctypes.c_int)]
+            lib.sc_find_tiled.restype = ctypes.c_int
+            lib.sc_histogram.argtypes = [ctypes.c_void_p, ctypes.c_int, ctypes.c_int, ctypes.c_ssize_t,
+                                         ctypes.c_void_p]
+            lib.sc_histogram.restype = None
+            lib.sc_hist_percentile.argtypes = [ctypes.c_void_p, ctypes.c_double]
+            lib.sc_hist_percentile.restype = ctypes.c_double
+            lib.sc_tile_thresholds.argtypes = [ctypes.c_void_p, ctypes.c_int, ctypes.c_int, ctypes.c_ssize_t,
+                                               ctypes.c_int, ctypes.c_double, ctypes.c_int, ctypes.c_void_p]
+            lib.sc_tile_thresholds.restype = ctypes.c_int
+            lib.sc_find_runs.argtypes = [ctypes.c_void_p, ctypes.c_void_p, ctypes.c_int, ctypes.c_int, ctypes.c_int,
+                                         ctypes.c_int, ctypes.c_int, ctypes.POINTER(Blob), ctypes.c_int,
+                                         ctypes.POINTER(ctypes.c_int)]
+            lib.sc_find_runs.restype = ctypes.c_int
+            lib.sc_prep_create.argtypes = [ctypes.c_int]
+            lib.sc_prep_create.restype = ctypes.c_void_p
+            lib.sc_prep_destroy.argtypes = [ctypes.c_void_p]
+            lib.sc_prep_destroy.restype = None
+            lib.sc_prep_clahe.argtypes = [ctypes.c_void_p, ctypes.c_int, ctypes.c_int, ctypes.c_double]
+            lib.sc_prep_clahe.restype = ctypes.c_int
+            lib.sc_preprocess.argtypes = [ctypes.c_void_p, ctypes.c_void_p, ctypes.c_int, ctypes.c_int,
+                                          ctypes.c_ssize_t, ctypes.c_int, ctypes.c_int, ctypes.c_int,
+                                          ctypes.c_double, ctypes.c_int, ctypes.c_void_p]
+            lib.sc_preprocess.restype = ctypes.c_int
+            lib.sc_prep_runs.argtypes = [ctypes.c_void_p]
+            lib.sc_prep_runs.restype = ctypes.c_void_p
+            lib.sc_prep_thresholds.argtypes = [ctypes.c_void_p]
+            lib.sc_prep_thresholds.restype = ctypes.POINTER(ctypes.c_uint8)
+            return lib
+    raise OSError(f"{_LIB_NAME} not found (tried {', '.join(p for p in _SEARCH if p)})")
+
+
+_lib = None
+
+# strip height for find_frame() with one threshold for the frame: 64 rows
+# of a 1920 px frame stay well inside the Pi Zero 2 W's 512 KB L2
+_STRIP = 64
+
+
+def _library():
+    global _lib
+    if _lib is None:
+        _lib = _load()
+    return _lib
+
+
+def _check(image):
+    if image.dtype != np.uint8 or image.ndim != 2 or image.strides[1] != 1:
+        raise ValueError("image must be a 2-D uint8 array with contiguous rows")
+
+
+def _channels(frame):
+    # bytes per pixel of a grey (h, w) or BGR/BGRX (h, w, 3|4) frame
+    if frame.dtype != np.uint8:
+        raise ValueError("frame must be uint8")
+    if frame.ndim == 2 and frame.strides[1] == 1:
+        return 1
+    if frame.ndim == 3 and frame.shape[2] in (3, 4) and frame.strides[2] == 1 and frame.strides[1] == frame.shape[2]:
+        return frame.shape[2]
+    raise ValueError("frame must be grey (h, w) or BGR/BGRX (h, w, 3|4) with contiguous rows")
+
+
+def percentile(image, p):
+    # np.percentile(image, p) from one histogram pass, no partition
+    _check(image)
+    hist = np.zeros(256, dtype=np.uint32)
+    lib = _library()
+    lib.sc_histogram(image.ctypes.data, image.shape[1], image.shape[0], image.strides[0], hist.ctypes.data)
+    return lib.sc_hist_percentile(hist.ctypes.data, p)
+
+
+def tile_thresholds(image, tile, p, floor=0):
+    # floor of each tile x tile square's p-th percentile, at least floor,
+    # as a (ceil(h / tile), ceil(w / tile)) uint8 grid for find(..., tile=)
+    _check(image)
+    h, w = image.shape
+    grid = np.empty(((h + tile - 1) // tile, (w + tile - 1) // tile), dtype=np.uint8)
+    if _library().sc_tile_thresholds(image.ctypes.data, w, h, image.strides[0], tile, p, floor,
+                                     grid.ctypes.data) != 0:
+        raise ValueError("sc_tile_thresholds failed")
+    return grid
+
+
+class Centroider:
+    # One per camera: the native side keeps its working memory between
+    # frames, and out[] is allocated once for max_blobs results.
+    def __init__(self, max_width, max_blobs=4096):
+        self._handle = None
+        self._prep = None
+        self._handle = _library().sc_create(max_width)
+        if not self._handle:
+            raise MemoryError("sc_create failed")
+        self._prep = _library().sc_prep_create(max_width)
+        if not self._prep:
+            raise MemoryError("sc_prep_create failed")
+        self.max_width = max_width
+        self._out = (Blob * max_blobs)()
+        self._max_blobs = max_blobs
+        # find_frame()'s last blurred frame: its histogram, and the
+        # threshold (an int, or a tile grid) it used
+        self.histogram = np.zeros(256, dtype=np.uint32)
+        self.threshold = None
+        self._hist_size = 0         # pixels .histogram counted, 0 if none
+
+    def clahe(self, clip_limit=2.0, grid=(8, 8)):
+        # find_frame() applies cv2.createCLAHE(clip_limit, grid) before the
+        # blur, with each tile's LUT from the frame before (the first frame
+        # builds its own); grid None turns it off
+        tiles_x, tiles_y = grid if grid else (0, 0)
+        if _lib.sc_prep_clahe(self._prep, tiles_x, tiles_y, clip_limit) != 0:
+            raise ValueError("sc_prep_clahe failed (bad grid, or out of memory)")
+
+    def find(self, image, threshold, min_area=3, max_area=200, tile=None):
+        # Returns ([(x, y), ...] for blobs of min_area..max_area pixels
+        # brighter than threshold, in scipy label() order, and the number
+        # of blobs found in all). A fractional threshold is floored, as
+        # cv2.threshold() compares it against integer pixels. With tile,
+        # threshold is a tile_thresholds() grid instead.
+        _check(image)
+        n_blobs = ctypes.c_int(0)
+        h, w = image.shape
+        if tile is None:
+            n = _lib.sc_find(self._handle, image.ctypes.data, w, h, image.strides[0], int(np.floor(threshold)),
+                             min_area, max_area, self._out, self._max_blobs, ctypes.byref(n_blobs))
+        else:
+            grid = np.ascontiguousarray(threshold, dtype=np.uint8)
+            if grid.shape != ((h + tile - 1) // tile, (w + tile - 1) // tile):
+                raise ValueError("threshold grid doesn't match the image and tile size")
+            n = _lib.sc_find_tiled(self._handle, image.ctypes.data, w, h, image.strides[0], tile,
+                                   grid.ctypes.data, min_area, max_area, self._out, self._max_blobs,
+                                   ctypes.byref(n_blobs))
+        if n < 0:
+            raise ValueError("sc_find failed (frame wider than the centroider, or out of memory)")
+        return [(self._out[k].x, self._out[k].y) for k in range(n)], n_blobs.value
+
+    def find_frame(self, frame, percentile=99, min_area=3, max_area=200, tile=None, floor=0, threshold=None):
+        # find_centroids() from the camera's frame in one fused native
+        # pass: greyscale, CLAHE if clahe() set it up, 3x3 Gaussian blur,
+        # threshold, blobs. With tile, each tile x tile square's
+        # percentile, never below floor, read off the blurred rows as they
+        # go by. Otherwise one threshold for
+        # the frame: threshold if given, else the percentile of the last
+        # frame's .histogram, counted during its pass, so the sky is one
+        # frame old. Only the first frame (or one of a new size) pays a
+        # histogram pass of its own. Returns what find() does.
+        channels = _channels(frame)
+        h, w = frame.shape[:2]
+        hist = self.histogram.ctypes.data
+        local = tile is not None
+        if local:
+            n_runs = _lib.sc_preprocess(self._prep, frame.ctypes.data, w, h, frame.strides[0], channels, tile, -1,
+                                        percentile, floor, hist)
+        else:
+            tile = _STRIP
+            if threshold is None and self._hist_size != w * h:
+                # nothing is brighter than 255: a pass for the histogram alone
+                _lib.sc_preprocess(self._prep, frame.ctypes.data, w, h, frame.strides[0], channels, tile, 255,
+                                   percentile, 0, hist)
+            if threshold is None:
+                threshold = _lib.sc_hist_percentile(hist, percentile)
+            n_runs = _lib.sc_preprocess(self._prep, frame.ctypes.data, w, h, frame.strides[0], channels, tile,
+                                        max(int(np.floor(threshold)), 0), percentile, 0, hist)
+        self._hist_size = w * h if n_runs >= 0 else 0
+        if n_runs < 0:
+            raise ValueError("sc_preprocess failed (frame wider than the centroider, or out of memory)")
+        n_blobs = ctypes.c_int(0)
+        n = _lib.sc_find_runs(self._handle, _lib.sc_prep_runs(self._prep), n_runs, w, h, min_area, max_area,
+                              self._out, self._max_blobs, ctypes.byref(n_blobs))
+        if n < 0:
+            raise ValueError("sc_find_runs failed (out of memory)")
+        if local:
+            grid = ((h + tile - 1) // tile, (w + tile - 1) // tile)
+            if grid[0] * grid[1] == 0:
+                self.threshold = np.zeros(grid, dtype=np.uint8)
+            else:
+                self.threshold = np.ctypeslib.as_array(_lib.sc_prep_thresholds(self._prep), shape=grid).copy()
+        else:
+            self.threshold = threshold
+        return [(self._out[k].x, self._out[k].y) for k in range(n)], n_blobs.value
+
+    def close(self):
+        if self._handle:
+            _lib.sc_destroy(self._handle)
+            self._handle = None
+        if self._prep:
+            _lib.sc_prep_destroy(self._prep)
+            self._prep = None
+
+    def __del__(self):
+        self.close()
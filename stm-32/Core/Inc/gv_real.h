@@ -0,0 +1,38 @@
+#ifndef GV_REAL_H
+#define GV_REAL_H
+
+#include <math.h>
+
+// ---- gv_real ----
+// Numeric policy for the solver and the gv-data tables, fixed at compile
+// time. The STM32L4's FPU (fpv4-sp-d16) only does single precision, so
+// any double arithmetic there is a libgcc soft-float call; a target whose
+// FPU lacks double support gets float unless told otherwise. Everything
+// else (the host build) stays on double.
+//
+//   -DGV_REAL_FLOAT    force float
+//   -DGV_REAL_DOUBLE   force double
+//
+// gvbench --numeric checks the float build's pair angles against a double
+// copy of the catalog.
+#if !defined(GV_REAL_FLOAT) && !defined(GV_REAL_DOUBLE)
+#if defined(__ARM_FP) && !(__ARM_FP & 0x8)
+#define GV_REAL_FLOAT
+#endif
+#endif
+
+#ifdef GV_REAL_FLOAT
+typedef float gv_real;
+#define gv_cos    cosf
+#define gv_sqrt   sqrtf
+#define gv_floor  floorf
+#define gv_ceil   ceilf
+#else
+typedef double gv_real;
+#define gv_cos    cos
+#define gv_sqrt   sqrt
+#define gv_floor  floor
+#define gv_ceil   ceil
+#endif
+
+#endif // GV_REAL_H
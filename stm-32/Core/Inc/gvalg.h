@@ -1,7 +1,150 @@
 #ifndef GVALG_H
 #define GVALG_H
 
-void gvalg(const double cat[][4], const double tab_cat[][3], double **tab_image,
-           int *id, double *v2, int n_image, int n_stars_img);
+#include <stddef.h>
+#include <stdint.h>
+#include "gv_real.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// every block carved from the workspace arena starts on this boundary
+#define GV_ARENA_ALIGN 8
+
+// id[] value for a centroid that drew no votes (catalog index 0 is a real star)
+#define GV_ID_NONE (-1)
+
+// image pairs a frame of n centroids can produce
+#define GV_MAX_PAIRS(max_stars) ((size_t)(max_stars) * ((max_stars) - 1) / 2)
+
+// catalog angle index the first round votes from
+typedef enum {
+    GV_LOOKUP_BINS = 0,    // fixed-width bins of catalog_bytestream (default)
+    GV_LOOKUP_KVECTOR,     // k-vector over angle-sorted pairs: exact [lo, hi] ranges
+} gv_lookup;
+
+// first-round engine: how votes are stored and the mode is found
+typedef enum {
+    GV_ENGINE_VOTES = 0,   // append votes to CSR slices, histogram mode (default)
+    GV_ENGINE_BITSET,      // 256-bit candidate masks, bit-sliced counts per centroid
+} gv_engine;
+
+// second-round check of each identified pair against the catalog
+typedef enum {
+    GV_VERIFY_COSINE = 0,  // catalog dot product inside the image angle's cosine band (default)
+    GV_VERIFY_ADJACENCY,   // catalog_adjacency.c lookup: no vector math, but pairs past
+                           // ADJ_MAX_ANGLE_MDEG (the FOV) never verify
+    GV_VERIFY_MATRIX,      // catalog_angle_matrix.c read as angle[a][b]; cosines again
+                           // if the matrix was generated with --angle-matrix off
+} gv_verify;
+
+// GV_ENGINE_BITSET: one bit per catalog index, in native words (4 x 64
+// bits on the host, 8 x 32 on the STM32)
+#if UINTPTR_MAX > 0xFFFFFFFFu
+typedef uint64_t gv_mask_word;
+#define GV_MASK_POPCOUNT(w) __builtin_popcountll(w)
+#define GV_MASK_CTZ(w)      __builtin_ctzll(w)
+#else
+typedef uint32_t gv_mask_word;
+#define GV_MASK_POPCOUNT(w) __builtin_popcount(w)
+#define GV_MASK_CTZ(w)      __builtin_ctz(w)
+#endif
+#define GV_MASK_BITS   ((int)(8 * sizeof(gv_mask_word)))
+#define GV_MASK_WORDS  (256 / GV_MASK_BITS)
+// bit planes per centroid: counts saturate at 2^GV_BITSET_PLANES - 1
+#define GV_BITSET_PLANES 8
+#define GV_BITSET_BYTES  ((size_t)GV_BITSET_PLANES * GV_MASK_WORDS * sizeof(gv_mask_word))
+
+// catalog span one image pair votes from: bytestream byte offsets
+// (GV_LOOKUP_BINS) or tab_cat slots (GV_LOOKUP_KVECTOR), end exclusive
+typedef struct {
+    uint32_t first;
+    uint32_t end;
+} gv_span;
+
+// ---- gv_workspace ----
+// Caller-owned solver scratch. It is carved once out of a single arena
+// (a static buffer on the STM32) sized for the largest frame, then reused
+// by every gvalg() call, so steady-state solves never touch the heap.
+// Votes share one pool rather than fixed per-centroid rows: each solve
+// counts first and hands every centroid exactly the slice it needs, so
+// max_votes bounds the frame's total, however the votes split up.
+typedef struct {
+    int max_stars;        // most centroids a single solve may pass in
+    int max_votes;        // vote pool shared by all centroids (2 per catalog pair each)
+    gv_lookup lookup;     // angle index for voting; init sets GV_LOOKUP_BINS
+    gv_engine engine;     // first-round engine; init sets GV_ENGINE_VOTES
+    gv_verify verify;     // second-round check; init sets GV_VERIFY_COSINE
+    int *k_n;             // [max_stars] catalog pairs voted per centroid
+    int *row_start;       // [max_stars + 1] centroid i votes are votes[row_start[i] .. row_start[i+1])
+    int *margin;          // [max_stars] winner's lead over the runner-up
+    uint8_t *votes;       // [max_votes] vote pool, one contiguous slice per centroid
+    gv_span *spans;       // [GV_MAX_PAIRS] catalog span per image pair (counting -> fill pass)
+    gv_real *cos_lo;      // [GV_MAX_PAIRS] cos(angle + loc_err) per image pair
+    gv_real *cos_hi;      // [GV_MAX_PAIRS] cos(angle - loc_err) per image pair
+    gv_mask_word *planes; // [max_stars][GV_BITSET_PLANES][GV_MASK_WORDS] bit-sliced candidate counts
+    uint16_t hist[256];   // setmode() vote histogram, one bin per catalog index
+
+    // counters for the last solve (benchmarking / diagnostics)
+    long votes_cast;      // votes cast across all centroids (or needed, if over max_votes;
+                          // GV_ENGINE_BITSET: candidate bits added)
+    long bins_touched;    // angle bins (or k-vector ranges) the first round walked
+} gv_workspace;
+
+// arena size needed for gv_workspace_init(), including alignment slack
+#define GV_WORKSPACE_BYTES(max_stars, max_votes)                              \
+    (9 * GV_ARENA_ALIGN +                                                     \
+     (3 * (size_t)(max_stars) + 1) * sizeof(int) +                            \
+     (size_t)(max_votes) +                                                    \
+     GV_MAX_PAIRS(max_stars) * sizeof(gv_span) +                              \
+     2 * GV_MAX_PAIRS(max_stars) * sizeof(gv_real) +                          \
+     (size_t)(max_stars) * GV_BITSET_BYTES)
+
+int gv_workspace_init(gv_workspace *ws, void *arena, size_t arena_len,
+                      int max_stars, int max_votes);
+
+int gvalg(gv_workspace *ws, const gv_real cat[][4], const gv_real tab_image[][3], gv_real loc_err,
+          int *id, gv_real *v2, int n_image, int n_stars_img);
+
+// catalog angle (mdeg) between stars a and b from catalog_adjacency.c,
+// or -1 when they are further apart than ADJ_MAX_ANGLE_MDEG (or a == b)
+int gv_adj_angle_mdeg(int a, int b);
+
+// catalog angle (mdeg) between stars a and b from catalog_angle_matrix.c,
+// or -1 past CATALOG_MAX_ANGLE_MDEG, for a == b, or with no matrix
+int gv_matrix_angle_mdeg(int a, int b);
+
+// cosine of an angle given in millidegrees, as the verification bounds
+// are computed
+gv_real gv_cos_mdeg(gv_real mdeg);
+
+// dot product of two catalog unit vectors (rows pass &cat[i][1])
+static inline gv_real gv_dot3(const gv_real u[3], const gv_real v[3]) {
+    return u[0] * v[0] + u[1] * v[1] + u[2] * v[2];
+}
+
+// ---- gv_cos_band ----
+// Cosine bounds for |d_cat - angle| < loc_err (mdeg): a catalog dot
+// product strictly inside [lo, hi] passes. Past either end of 0-180 deg
+// a bound can't be crossed and is pushed out of [-1, 1].
+typedef struct {
+    gv_real lo, hi;
+} gv_cos_band;
+
+static inline gv_cos_band gv_band_mdeg(gv_real angle, gv_real loc_err) {
+    gv_cos_band b;
+    b.lo = (angle + loc_err < 180000) ? gv_cos_mdeg(angle + loc_err) : -2;
+    b.hi = (angle - loc_err > 0) ? gv_cos_mdeg(angle - loc_err) : 2;
+    return b;
+}
+
+static inline int gv_in_band(gv_real dot, gv_cos_band b) {
+    return dot > b.lo && dot < b.hi;
+}
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif // GVALG_H
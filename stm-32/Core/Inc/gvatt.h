@@ -0,0 +1,33 @@
+#ifndef GVATT_H
+#define GVATT_H
+
+#include "gv_real.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Attitude from identified stars, the stage after gvalg() (or gvtri,
+// gvhash, gvtrack). Every verified centroid (id[i] != GV_ID_NONE and
+// v2[i] > 0) is paired with its catalog_xyz vector, all weighted alike,
+// and QUEST finds the rotation that fits them best in the least-squares
+// (Wahba) sense, in closed form and on the stack.
+//   v:        [n_stars] body-frame unit vectors
+//   id, v2:   [n_stars] as gvalg() returns them
+//   q:        out, quaternion {x, y, z, w} (scalar last) rotating catalog
+//             vectors into the body frame: v = R(q) * cat, w >= 0
+//   residual: out, rms angle in mdeg between each centroid and its
+//             catalog star rotated by q
+// Returns the number of stars used, or -1 (q and residual untouched)
+// with fewer than two, or when they all lie along one axis.
+int gv_attitude(const gv_real cat[][4], const gv_real v[][3], int n_stars, const int *id,
+                const gv_real *v2, gv_real q[4], gv_real *residual);
+
+// R(q) for a unit quaternion {x, y, z, w}: v_body = R * v_catalog
+void gv_quat_to_matrix(const gv_real q[4], gv_real R[3][3]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GVATT_H
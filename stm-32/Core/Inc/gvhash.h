@@ -0,0 +1,35 @@
+#ifndef GVHASH_H
+#define GVHASH_H
+
+#include "gv_real.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// gv_hash_id() limits; its scratch lives on the stack
+#define GV_HASH_MAX_STARS 16   // only the first 16 centroids are used (pass the brightest first)
+#define GV_HASH_MAX_CAND  8    // closest candidates kept per centroid after the pattern check
+
+// Geometric-hashing identification, another alternative to gvalg().
+// Each centroid's patterns (angles to two of its HASH_NN nearest
+// neighbours in the frame) are quantized and looked up in catalog_hash.c,
+// one probe each; of the candidates whose own pattern is within loc_err,
+// the GV_HASH_MAX_CAND closest are kept, and each centroid takes the
+// candidate that the most other centroids' candidates agree with on pair
+// angle. Centroids that can't be catalog
+// stars (too faint) break their neighbours' patterns, so pass only the
+// brightest.
+//   v:       [n_stars] body-frame unit vectors
+//   loc_err: angle tolerance in mdeg, as for gvalg(); patterns further
+//            off than HASH_TOL_MDEG can land in the wrong cell
+//   id, v2:  [n_stars] out, with gvalg()'s meaning
+// Returns the number of centroids identified.
+int gv_hash_id(const gv_real cat[][4], const gv_real v[][3], int n_stars, gv_real loc_err,
+               int *id, gv_real *v2);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GVHASH_H
@@ -0,0 +1,61 @@
+#ifndef GVPAIRS_H
+#define GVPAIRS_H
+
+#include "gv_real.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- gv_camera ----
+// Pinhole intrinsics for turning pixel centroids into body-frame unit
+// vectors (+z = boresight).
+typedef struct {
+    gv_real fx, fy;   // focal length, in pixels
+    gv_real cx, cy;   // principal point, in pixels
+} gv_camera;
+
+// px[i] = {column, row} of centroid i -> unit vector v[i]
+void gv_centroids_to_vectors(const gv_camera *cam, const gv_real px[][2], gv_real v[][3], int n_stars);
+
+// angle between two unit vectors in mdeg, read off chord_to_mdeg_lut as
+// gv_tabulate_pairs() does, or -1 if wider than CATALOG_MAX_ANGLE_MDEG
+gv_real gv_pair_angle_mdeg(const gv_real u[3], const gv_real v[3]);
+
+// v2[] for solvers that start from unit vectors (gvtri, gvhash): every
+// pair of identified centroids whose catalog angle matches the image
+// angle within loc_err adds one to both, as gvalg() scores it
+void gv_verify_vectors(const gv_real cat[][4], const gv_real v[][3], int n_stars, gv_real loc_err,
+                       const int *id, gv_real *v2);
+
+// Builds gvalg()'s tab_image from n_stars body-frame unit vectors: one
+// {a, b, angle_mdeg} row per pair, skipping pairs wider than the
+// catalog's CATALOG_MAX_ANGLE_MDEG (they can never match). Returns the
+// number of rows written, or -1 if more than max_pairs would be needed
+// (GV_MAX_PAIRS(n_stars) rows always suffice).
+int gv_tabulate_pairs(const gv_real v[][3], int n_stars, gv_real tab_image[][3], int max_pairs);
+
+// gv_select_pairs() limits; its scratch lives on the stack
+#define GV_SELECT_MAX_BRIGHT 32
+#define GV_SELECT_MAX_NN     8
+
+// Bounded alternative to gv_tabulate_pairs() for crowded frames. Keeps
+// the k_bright brightest centroids and pairs each with its k_nn nearest
+// neighbours among them (inside the catalog ceiling), so a frame yields
+// at most about k_bright * k_nn rows however many centroids it has.
+//   brightness[i]: anything that ranks centroid i, larger = brighter
+//   sel[]:         [k_bright] out, sel[slot] = original centroid index,
+//                  brightest first; *n_sel = slots used
+// Row indices are slots, so gvalg() runs with n_stars_img = *n_sel and
+// id[slot] belongs to centroid sel[slot]. Never writes more than
+// max_pairs rows (ties in distance can add a few past k_bright * k_nn).
+// Returns the number of rows, or -1 if k_bright / k_nn are out of range.
+int gv_select_pairs(const gv_real v[][3], const gv_real brightness[], int n_stars,
+                    int k_bright, int k_nn, int sel[], int *n_sel,
+                    gv_real tab_image[][3], int max_pairs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GVPAIRS_H
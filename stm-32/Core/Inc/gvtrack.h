@@ -0,0 +1,59 @@
+#ifndef GVTRACK_H
+#define GVTRACK_H
+
+#include "gv_real.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GV_TRACK_MAX_IDS  32   // catalog stars carried from one frame to the next
+#define GV_TRACK_MAX_CAND 64   // catalog stars tested against the predicted FOV
+#define GV_TRACK_MIN_IDS  3    // verified IDs a frame needs to stay tracked
+#define GV_TRACK_SLACK_MDEG 3000  // candidate list reaches this far past the FOV
+
+// ---- gv_track ----
+// Tracking state: the last frame's attitude and the catalog stars it
+// saw. Consecutive frames barely move, so gv_track_frame() predicts
+// where those stars land, matches them to the new centroids by nearest
+// neighbour and skips lost-in-space voting entirely; only when that
+// fails does the caller need gvalg() (or gvtri/gvhash) and a re-seed.
+typedef struct {
+    int valid;                   // R and ids[] describe the last frame
+    gv_real R[3][3];             // catalog -> body rotation: v = R * cat
+    int ids[GV_TRACK_MAX_IDS];   // verified catalog indices of the last frame
+    int n_ids;
+    gv_real max_motion_mdeg;     // furthest a star may move between frames
+    gv_real cos_motion;
+    // catalog stars within cand_reach_mdeg of cand_axis (catalog frame);
+    // rebuilt only once the FOV drifts past that
+    int cand[GV_TRACK_MAX_CAND];
+    int n_cand;
+    gv_real cand_axis[3];
+    gv_real cand_reach_mdeg;
+    long cand_overflows;         // frames lost to more than GV_TRACK_MAX_CAND stars in reach
+} gv_track;
+
+void gv_track_init(gv_track *t, gv_real max_motion_mdeg);
+
+// Seeds (or re-seeds) tracking from a solved frame: id[]/v2[] as gvalg()
+// and the others return them, v[] the frame's unit vectors. Returns 0,
+// or -1 (and tracking stays off) with fewer than GV_TRACK_MIN_IDS
+// verified IDs.
+int gv_track_seed(gv_track *t, const gv_real cat[][4], const gv_real v[][3], int n_stars,
+                  const int *id, const gv_real *v2);
+
+// Identifies a frame from the tracking state. Fills id[]/v2[] with
+// gvalg()'s meaning, re-seeds itself from the result and returns the
+// number of verified IDs; returns 0 when not tracking or when the match
+// fails, which turns tracking off until the next gv_track_seed(). A
+// predicted FOV holding more than GV_TRACK_MAX_CAND catalog stars fails
+// the frame too (counted in cand_overflows) rather than testing only some.
+int gv_track_frame(gv_track *t, const gv_real cat[][4], const gv_real v[][3], int n_stars,
+                   gv_real loc_err, int *id, gv_real *v2);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GVTRACK_H
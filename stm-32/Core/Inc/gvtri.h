@@ -0,0 +1,32 @@
+#ifndef GVTRI_H
+#define GVTRI_H
+
+#include "gv_real.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// only the first GV_TRI_MAX_STARS centroids form triangles (pass the
+// brightest first); its scratch lives on the stack
+#define GV_TRI_MAX_STARS 8
+
+// Triangle identification for sparse frames, as an alternative to
+// gvalg(). Image triangles (sides within TRI_MAX_SIDE_MDEG) are looked
+// up in the catalog triangle index, and the first one that matches
+// exactly one catalog triangle, handedness included, fixes three IDs.
+// Every other centroid is then identified by its angles to those three.
+//   v:       [n_stars] body-frame unit vectors
+//   loc_err: side tolerance in mdeg, as for gvalg()
+//   id, v2:  [n_stars] out, with gvalg()'s meaning: catalog index or
+//            GV_ID_NONE, and the number of verified pair angles
+// Returns the number of centroids identified (0 if no triangle was
+// unique, leaving every id[] at GV_ID_NONE).
+int gv_triangle_id(const gv_real cat[][4], const gv_real v[][3], int n_stars, gv_real loc_err,
+                   int *id, gv_real *v2);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GVTRI_H
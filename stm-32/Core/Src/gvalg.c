@@ -4,35 +4,44 @@
 //   Associates unknown image star centroids with known catalog stars
 //   by voting across angular distances between star pairs.
 //
+//   Portable core: no HAL calls and no heap, so the same file builds
+//   into the STM32 firmware and the host library (see geometric-voting/).
+//
 //   Inputs:
-//     - cat: double** [N_cat][7]
-//         Catalog of known stars, where each row represents one star:
-//           cat[i][0] = HIP ID (or catalog ID)        [integer as double]
+//     - ws: gv_workspace*
+//         Caller-owned scratch set up once by gv_workspace_init();
+//         gvalg() does no heap allocation of its own
+//
+//   Every real-valued argument is gv_real (gv_real.h): float on the
+//   STM32's single-precision FPU, double on the host.
+//
+//     - cat: const gv_real [N_cat][4]  (catalog_xyz.c)
+//         Catalog of known stars, where each row represents one star;
+//         row i is catalog index i, so IDs address rows directly:
+//           cat[i][0] = catalog index, i.e. i (0-255)  [integer as gv_real]
 //           cat[i][1] = x component of unit vector
 //           cat[i][2] = y component of unit vector
 //           cat[i][3] = z component of unit vector
-
-//      ! Cat needs to be changed to rather than array of lists of 7 things [HIP_ID, RA, Dec, Mag, X, Y, Z]
-//      ! It should instead be [HIP_ID, RA_ DEC]
-
-//
-//     - tab_cat: double** [N_cat_pairs][3]
-//         Precomputed catalog star pair angle table:
-//           tab_cat[i][0] = HIP ID of star A          [integer as double]
-//           tab_cat[i][1] = HIP ID of star B          [integer as double]
-//           tab_cat[i][2] = angle between A and B     [in radians]
 //
-//     - tab_image: double** [n_image][3]
+//     - tab_image: const gv_real [n_image][3]
 //         Image star pair angular distances, derived from centroid vectors:
-//           tab_image[i][0] = index of image centroid A   [int as double, in range 0 to n_stars_img-1]
-//           tab_image[i][1] = index of image centroid B   [int as double]
-//           tab_image[i][2] = angle between them (A,B)    [in radians]
+//           tab_image[i][0] = index of image centroid A   [int as gv_real, in range 0 to n_stars_img-1]
+//           tab_image[i][1] = index of image centroid B   [int as gv_real]
+//           tab_image[i][2] = angle between them (A,B)    [in millidegrees]
+//
+//     - loc_err: gv_real
+//         Pair angle tolerance                           [in millidegrees]
+//         Voting takes every catalog pair within +/- loc_err of an image
+//         angle (by bins or k-vector, see ws->lookup); verification
+//         accepts |d_cat - d_image| < loc_err, tested on cosines or
+//         looked up in the neighbour adjacency or angle matrix
+//         (see ws->verify)
 //
 //     - id: int* [n_stars_img]
-//         Output: for each image centroid, holds the most-voted catalog HIP ID
-//         (0 means unidentified)
+//         Output: for each image centroid, holds the most-voted catalog index
+//         (GV_ID_NONE, i.e. -1, means unidentified)
 //
-//     - v2: double* [n_stars_img]
+//     - v2: gv_real* [n_stars_img]
 //         Output: verification scores (number of pairwise matches that confirmed ID)
 //
 //     - n_image: int
@@ -44,195 +53,542 @@
 // ----------------------------------------------------------
 //
 //   Output:
-//     - id[i] = HIP ID of the catalog star identified as matching image centroid i
+//     - returns 0, or -1 if the frame exceeds the workspace limits
+//       (n_stars_img, n_image, or the total vote count against the vote
+//       pool; ws->votes_cast then holds the count that didn't fit and
+//       every id[] is GV_ID_NONE)
+//     - id[i] = catalog index of the star identified as matching image centroid i
+//               (index_to_hip_ID_lut[] maps it to a HIP ID)
 //     - v2[i] = number of verified angle matches that support this ID (higher = more reliable)
+//     - ws->margin[i], ws->votes_cast, ws->bins_touched describe the last solve
 //
 //   Algorithm Summary:
 //     > For each image pair (i,j), find catalog star pairs with similar angles
 //     > "Vote" for all stars in those catalog pairs to be possible matches
-//     > Each image centroid accumulates votes from many pairs
+//     > Each image centroid accumulates votes from many pairs, counted
+//       first so they land in one exactly-sized compressed-sparse-row pool
 //     > Take the mode (most frequent vote) as the ID guess
 //     > Verify IDs by checking if their unit vectors match known catalog angles
 //
 // ----------------------------------------------------------
 
 
-#include <stdio.h>
-#include <stdlib.h>
 #include <math.h>
-#include "LPUART.h"
+#include "gvalg.h"
 #include "catalog_luts.h"
 #include "catalog_bytestream.h"
+#include "catalog_kvector.h"
+#include "catalog_adjacency.h"
+#include "catalog_angle_matrix.h"
+
+// millidegrees -> radians
+#define GV_MDEG_TO_RAD ((gv_real)(3.14159265358979323846 / 180000.0))
+
+int setmode(uint16_t hist[256], const uint8_t nums[], int numsize, int *margin);
+
+// ---- gv_workspace_init() ----
+// Carves the solver scratch out of a caller-owned arena. Every block is
+// rounded up to GV_ARENA_ALIGN so the arena itself may be a plain byte
+// buffer. Returns -1 if the arena is too small for the requested limits.
+static void *gv_carve(uint8_t **cursor, size_t *left, size_t bytes) {
+    bytes = (bytes + GV_ARENA_ALIGN - 1) & ~(size_t)(GV_ARENA_ALIGN - 1);
+    if (bytes > *left) {
+        return NULL;
+    }
+    void *block = *cursor;
+    *cursor += bytes;
+    *left -= bytes;
+    return block;
+}
 
-uint8_t setmode(int nums[], int numsize);
+int gv_workspace_init(gv_workspace *ws, void *arena, size_t arena_len,
+                      int max_stars, int max_votes) {
+    uint8_t *cursor = (uint8_t *)arena;
+    size_t left = arena_len;
 
-void gvalg(const double cat[][4], const double tab_cat[][3], double **tab_image,
-           int *id, double *v2, int n_image, int n_stars_img) {
+    // line the arena itself up before carving
+    size_t pad = (GV_ARENA_ALIGN - ((uintptr_t)cursor & (GV_ARENA_ALIGN - 1))) & (GV_ARENA_ALIGN - 1);
+    if (pad > left) {
+        return -1;
+    }
+    cursor += pad;
+    left -= pad;
+
+    ws->max_stars = max_stars;
+    ws->max_votes = max_votes;
+    ws->lookup = GV_LOOKUP_BINS;
+    ws->engine = GV_ENGINE_VOTES;
+    ws->verify = GV_VERIFY_COSINE;
+    ws->k_n       = (int *)gv_carve(&cursor, &left, (size_t)max_stars * sizeof(int));
+    ws->row_start = (int *)gv_carve(&cursor, &left, ((size_t)max_stars + 1) * sizeof(int));
+    ws->margin    = (int *)gv_carve(&cursor, &left, (size_t)max_stars * sizeof(int));
+    ws->votes     = (uint8_t *)gv_carve(&cursor, &left, (size_t)max_votes);
+    ws->spans     = (gv_span *)gv_carve(&cursor, &left, GV_MAX_PAIRS(max_stars) * sizeof(gv_span));
+    ws->cos_lo    = (gv_real *)gv_carve(&cursor, &left, GV_MAX_PAIRS(max_stars) * sizeof(gv_real));
+    ws->cos_hi    = (gv_real *)gv_carve(&cursor, &left, GV_MAX_PAIRS(max_stars) * sizeof(gv_real));
+    ws->planes    = (gv_mask_word *)gv_carve(&cursor, &left, (size_t)max_stars * GV_BITSET_BYTES);
+
+    if (ws->k_n == NULL || ws->row_start == NULL || ws->margin == NULL || ws->votes == NULL ||
+        ws->spans == NULL || ws->cos_lo == NULL || ws->cos_hi == NULL || ws->planes == NULL) {
+        return -1;
+    }
+    return 0;
+}
 
+// ---- span_bins() ----
+// Finds the bytestream span holding every bin that overlaps [lo, hi]
+// (mdeg) and returns how many catalog pairs it holds. Consecutive bins
+// are consecutive in the bytestream, so the whole range is one span:
+// [n_pairs][idx1 idx2]...[n_pairs][idx1 idx2]... Only the bin headers
+// are read; the pairs themselves are left for the fill pass.
+static int span_bins(gv_workspace *ws, gv_real lo, gv_real hi, gv_span *span) {
+    int bin_lo = (int)lo / CATALOG_BIN_WIDTH_MDEG;
+    int bin_hi = (int)hi / CATALOG_BIN_WIDTH_MDEG;
+    if (bin_lo < 0) bin_lo = 0;
+    if (bin_hi >= (int)bin_count) bin_hi = (int)bin_count - 1;
+    span->first = span->end = 0;
+    if (bin_lo > bin_hi) {
+        return 0;
+    }
 
-    // ---------------- MEMORY ALLOCATION ----------------
-    // allocate k_n - (used in future loops) counts how many
-    // catalog pairs have been voted for a specific star in the image
-    int *k_n = (int *)calloc(n_stars_img, sizeof(int));
+    span->first = bin_angle_to_address_lut[bin_lo];
+    span->end = (bin_hi + 1 < (int)bin_count) ? bin_angle_to_address_lut[bin_hi + 1]
+                                              : (uint32_t)bytestream_len;
+    ws->bins_touched += bin_hi - bin_lo + 1;
 
-    // allocate v - an array for storing matches for each centroid.
-    // Each row v[i] holds a list of voted catalog star IDs
-    int **v = (int **)calloc(n_stars_img, sizeof(int *));
-    for (int i = 0; i < n_stars_img; i++) {
-        v[i] = (int *)calloc(512, sizeof(int));  // Enough space for 256 pairs (2 votes per pair)
+    int n = 0;
+    for (uint32_t pos = span->first; pos < span->end; pos += 1 + 2 * catalog_bytestream[pos]) {
+        n += catalog_bytestream[pos];
     }
+    return n;
+}
 
+// ---- span_kvector() ----
+// Finds exactly the tab_cat slots whose angle lies in [lo, hi] (mdeg)
+// and returns how many there are. The k-vector line gives the start and
+// end slots directly; the edge loops only step over the odd pair that
+// shares a slot with the bounds.
+static int span_kvector(gv_workspace *ws, gv_real lo, gv_real hi, gv_span *span) {
+    gv_real ya = lo / CATALOG_PAIR_ANGLE_LSB_MDEG;
+    gv_real yb = hi / CATALOG_PAIR_ANGLE_LSB_MDEG;
+    int jb = (int)gv_floor((ya - (gv_real)KVECTOR_Q) / (gv_real)KVECTOR_M);
+    int jt = (int)gv_ceil((yb - (gv_real)KVECTOR_Q) / (gv_real)KVECTOR_M);
+    span->first = span->end = 0;
+    if (jt < 0 || jb > KVECTOR_N - 1) {
+        return 0;
+    }
+    if (jb < 0) jb = 0;
+    if (jt > KVECTOR_N - 1) jt = KVECTOR_N - 1;
+
+    int start = kvector_k[jb];
+    int end = kvector_k[jt];
+    while (start > 0 && tab_cat[start - 1].angle >= ya) start--;
+    while (start < end && tab_cat[start].angle < ya) start++;
+    while (end < KVECTOR_N && tab_cat[end].angle <= yb) end++;
+    while (end > start && tab_cat[end - 1].angle > yb) end--;
+    ws->bins_touched++;
+
+    span->first = (uint32_t)start;
+    span->end = (uint32_t)end;
+    return end - start;
+}
 
-    // ---------------- FIRST ROUND ----------------
-    // for each centroid pair from the image (each entry in tab_image[i][3]
-    for (int i = 0; i < n_image; i++) {
+// ---- cast_vote() ----
+// Appends catalog pair (a, b) to the vote slices of both image centroids.
+// fill[] is each centroid's write cursor into ws->votes; the counting pass
+// sized every slice exactly, so no bounds check is needed here.
+static inline void cast_vote(uint8_t *votes, int *fill, int idx0, int idx1, uint8_t a, uint8_t b) {
+    // Vote for star A
+    uint8_t *v0 = votes + fill[idx0];
+    v0[0] = a;
+    v0[1] = b;
+    fill[idx0] += 2;
+
+    // Vote for star B
+    uint8_t *v1 = votes + fill[idx1];
+    v1[0] = a;
+    v1[1] = b;
+    fill[idx1] += 2;
+}
 
-    	// store the angle of the current pair (in millidegrees
-    	int angle = tab_image[i][2];
-        // find the starting address of the bin (milidegrees/100 - i.e. 84000/100 = 840)
-    	int bin_index = (int)(angle/100);
-    	int bin_addr = bin_angle_to_address_lut[bin_index];
-        // starting index to add a vote to (location of first pair in bin)
-        int index_min = (bin_addr + 1);
-        // stopping index to add a vote to (location of last pair in bin)
-        int index_max = (bin_addr + catalog_bytestream[bin_addr]);
+// ---- find_span() ----
+// Catalog span of every pair within [lo, hi] (mdeg), through whichever
+// angle index ws->lookup selects. Returns the number of pairs in it.
+static inline int find_span(gv_workspace *ws, gv_real lo, gv_real hi, gv_span *span) {
+    if (ws->lookup == GV_LOOKUP_KVECTOR) {
+        return span_kvector(ws, lo, hi, span);
+    }
+    return span_bins(ws, lo, hi, span);
+}
 
+// ---- vote_csr() ----
+// GV_ENGINE_VOTES first round: every catalog pair within loc_err of an
+// image angle appends both its stars to both centroids' vote lists, and
+// each centroid's ID is the mode of its list. Two passes: the first only
+// finds each image pair's catalog span and counts it against both
+// centroids, the second copies the pairs into vote slices sized exactly
+// from those counts. Returns -1 if the frame outgrows the vote pool.
+static int vote_csr(gv_workspace *ws, const gv_real tab_image[][3], gv_real loc_err,
+                    int *id, int n_image, int n_stars_img) {
+    // k_n - counts how many catalog pairs will be voted for a
+    // specific star in the image; row_start[] turns those counts
+    // into one slice of the shared ws->votes pool per centroid
+    int *k_n = ws->k_n;
+    int *row_start = ws->row_start;
+    gv_span *spans = ws->spans;
+    for (int i = 0; i < n_stars_img; i++) {
+        k_n[i] = 0;
+    }
 
+    // -*-*-----*-*- count -*-*------*-*-
+    for (int i = 0; i < n_image; i++) {
+        int idx0 = (int)tab_image[i][0];
+        int idx1 = (int)tab_image[i][1];
+        // the angle of the current pair (in millidegrees)
+        gv_real angle = tab_image[i][2];
+
+        int n = find_span(ws, angle - loc_err, angle + loc_err, &spans[i]);
+        k_n[idx0] += n;
+        k_n[idx1] += n;
+    }
 
-        // --- DEBUG 1 DEBUG 1 DEBUG 1 DEBUG 1 ---
-        char dbg[256];
+    // -*-*-----*-*- size the slices -*-*------*-*-
+    // slice i is votes[row_start[i] .. row_start[i+1]). Each entry is
+    // parked one slot up (row_start[i+1] = start of slice i) so the fill
+    // pass can use it as slice i's write cursor; once every vote is in,
+    // it has advanced to the end of slice i, i.e. the start of i+1.
+    long total = 0;
+    row_start[0] = 0;
+    for (int i = 0; i < n_stars_img; i++) {
+        row_start[i + 1] = (int)total;
+        total += 2L * k_n[i];  // Each pair adds 2 votes
+    }
+    ws->votes_cast = total;
+    if (total > ws->max_votes) {
+        return -1;
+    }
 
-        // Print image pair and angle
-        snprintf(dbg, sizeof(dbg), "\n[DEBUG] Image Pair %d: centroid (%d, %d), angle = %d\r\n",
-                 i, (int)tab_image[i][0], (int)tab_image[i][1], angle);
-        LPUART_Print(dbg);
+    // -*-*-----*-*- fill -*-*------*-*-
+    uint8_t *votes = ws->votes;
+    int *fill = row_start + 1;
+    for (int i = 0; i < n_image; i++) {
+        int idx0 = (int)tab_image[i][0];
+        int idx1 = (int)tab_image[i][1];
 
-        // Print bin info
-        snprintf(dbg, sizeof(dbg), "         → bin_index = %d, bin_addr = %d\r\n", bin_index, bin_addr);
-        LPUART_Print(dbg);
-        snprintf(dbg, sizeof(dbg), "         → index_min = %d, index_max = %d\r\n", index_min, index_max);
-        LPUART_Print(dbg);
-        // ------------------------------------
+        if (ws->lookup == GV_LOOKUP_KVECTOR) {
+            for (uint32_t j = spans[i].first; j < spans[i].end; j++) {
+                cast_vote(votes, fill, idx0, idx1, tab_cat[j].a, tab_cat[j].b);
+            }
+        } else {
+            const uint8_t *pos = &catalog_bytestream[spans[i].first];
+            const uint8_t *end = &catalog_bytestream[spans[i].end];
+            while (pos < end) {
+                int n_pairs = *pos++;
+                for (int j = 0; j < n_pairs; j++, pos += 2) { // iterate through all pairs in bin
+                    cast_vote(votes, fill, idx0, idx1, pos[0], pos[1]);
+                }
+            }
+        }
+    }
 
+    // -*-*-----*-*- count votes -*-*------*-*-
+    for (int i = 0; i < n_stars_img; i++) {
+        const uint8_t *v = votes + row_start[i];
+        id[i] = setmode(ws->hist, v, row_start[i + 1] - row_start[i], &ws->margin[i]);
+    }
+    return 0;
+}
 
-        for (int j = index_min; j <= index_max + 4; j++) {// iterate through all pairs in bin
+// ---- vote_bitset() ----
+// GV_ENGINE_BITSET first round. Catalog indices fit in a byte, so the
+// stars of every catalog pair within loc_err of an image angle OR into
+// one 256-bit candidate mask per image pair. Each centroid then counts,
+// per catalog star, how many of its pairs' masks hold that star: the
+// counters are bit-sliced (plane p holds bit p of all 256 counts), so
+// adding a mask is a ripple-carry of word-wide AND/XOR down the planes
+// and never touches a single star. A star is counted at most once per
+// image pair, however many catalog pairs put it in the mask.
+static void mask_add(gv_mask_word *planes, const gv_mask_word *mask) {
+    for (int w = 0; w < GV_MASK_WORDS; w++) {
+        gv_mask_word carry = mask[w];
+        for (int p = 0; p < GV_BITSET_PLANES && carry; p++) {
+            gv_mask_word *plane = &planes[p * GV_MASK_WORDS + w];
+            gv_mask_word sum = *plane ^ carry;
+            carry &= *plane;
+            *plane = sum;
+        }
+        // saturate rather than wrap past 2^GV_BITSET_PLANES - 1
+        for (int p = 0; carry && p < GV_BITSET_PLANES; p++) {
+            planes[p * GV_MASK_WORDS + w] |= carry;
+        }
+    }
+}
 
-        	int idx0 = (int)tab_image[i][0];
-        	int idx1 = (int)tab_image[i][1];
+// highest count among the stars in set[] (narrowed to the stars holding
+// it), walking the planes from the top: wherever some candidate has the
+// bit set, only those candidates can still be the maximum
+static int mask_max(const gv_mask_word *planes, gv_mask_word set[GV_MASK_WORDS]) {
+    int count = 0;
+    for (int p = GV_BITSET_PLANES - 1; p >= 0; p--) {
+        gv_mask_word hit[GV_MASK_WORDS];
+        gv_mask_word any = 0;
+        for (int w = 0; w < GV_MASK_WORDS; w++) {
+            hit[w] = set[w] & planes[p * GV_MASK_WORDS + w];
+            any |= hit[w];
+        }
+        if (any) {
+            count |= 1 << p;
+            for (int w = 0; w < GV_MASK_WORDS; w++) {
+                set[w] = hit[w];
+            }
+        }
+    }
+    return count;
+}
 
-        	// Vote for star A
-        	v[idx0][2 * k_n[idx0] + 0] = (int)catalog_bytestream[j];
-        	v[idx0][2 * k_n[idx0] + 1] = (int)catalog_bytestream[j+1];
+static void vote_bitset(gv_workspace *ws, const gv_real tab_image[][3], gv_real loc_err,
+                        int *id, int n_image, int n_stars_img) {
+    const size_t stride = (size_t)GV_BITSET_PLANES * GV_MASK_WORDS;
+    gv_mask_word *planes = ws->planes;
+    for (size_t k = 0; k < (size_t)n_stars_img * stride; k++) {
+        planes[k] = 0;
+    }
 
-        	// Vote for star B
-        	v[idx1][2 * k_n[idx1] + 0] = (int)catalog_bytestream[j];
-        	v[idx1][2 * k_n[idx1] + 1] = (int)catalog_bytestream[j+1];
+    for (int i = 0; i < n_image; i++) {
+        int idx0 = (int)tab_image[i][0];
+        int idx1 = (int)tab_image[i][1];
+        gv_real angle = tab_image[i][2];
+
+        gv_span span;
+        gv_mask_word mask[GV_MASK_WORDS] = {0};
+        if (find_span(ws, angle - loc_err, angle + loc_err, &span) == 0) {
+            continue;
+        }
+        if (ws->lookup == GV_LOOKUP_KVECTOR) {
+            for (uint32_t j = span.first; j < span.end; j++) {
+                mask[tab_cat[j].a / GV_MASK_BITS] |= (gv_mask_word)1 << (tab_cat[j].a % GV_MASK_BITS);
+                mask[tab_cat[j].b / GV_MASK_BITS] |= (gv_mask_word)1 << (tab_cat[j].b % GV_MASK_BITS);
+            }
+        } else {
+            const uint8_t *pos = &catalog_bytestream[span.first];
+            const uint8_t *end = &catalog_bytestream[span.end];
+            while (pos < end) {
+                int n_pairs = *pos++;
+                for (int j = 0; j < n_pairs; j++, pos += 2) {
+                    mask[pos[0] / GV_MASK_BITS] |= (gv_mask_word)1 << (pos[0] % GV_MASK_BITS);
+                    mask[pos[1] / GV_MASK_BITS] |= (gv_mask_word)1 << (pos[1] % GV_MASK_BITS);
+                }
+            }
+        }
 
-            // --- DEBUG 2 DEBUG 2 DEBUG 2 DEBUG 2 ---
-            // Vote print for tab_image[i][0]
-            snprintf(dbg, sizeof(dbg), "         → VOTE[%d] += (%d, %d)\r\n",
-            (int)tab_image[i][0], v[idx1][2 * k_n[idx1] + 0], v[idx0][2 * k_n[idx0] + 1]);
-            LPUART_Print(dbg);
+        for (int w = 0; w < GV_MASK_WORDS; w++) {
+            ws->votes_cast += 2 * GV_MASK_POPCOUNT(mask[w]);
+        }
+        mask_add(planes + (size_t)idx0 * stride, mask);
+        mask_add(planes + (size_t)idx1 * stride, mask);
+    }
 
-            // Vote print for tab_image[i][1]
-            snprintf(dbg, sizeof(dbg), "         → VOTE[%d] += (%d, %d)\r\n",
-            (int)tab_image[i][1], v[idx1][2 * k_n[idx1] + 0], v[idx1][2 * k_n[idx1] + 1]);
-            LPUART_Print(dbg);
-            delay_us(200000);
-            // ------------------------------------
+    // -*-*-----*-*- pick the winners -*-*------*-*-
+    // the mode is the lowest-index star with the top count; the runner-up
+    // count comes from a second walk with the winners taken out
+    for (int i = 0; i < n_stars_img; i++) {
+        const gv_mask_word *c = planes + (size_t)i * stride;
+        gv_mask_word top[GV_MASK_WORDS], rest[GV_MASK_WORDS];
+        for (int w = 0; w < GV_MASK_WORDS; w++) {
+            top[w] = ~(gv_mask_word)0;
+        }
 
+        int best = mask_max(c, top);
+        if (best == 0) {
+            id[i] = GV_ID_NONE;
+            ws->margin[i] = 0;
+            continue;
+        }
 
-        	// Now increment vote counters
-        	k_n[idx0]++;
-        	k_n[idx1]++;
-        	j+=1;
+        int winners = 0;
+        id[i] = GV_ID_NONE;
+        for (int w = 0; w < GV_MASK_WORDS; w++) {
+            winners += GV_MASK_POPCOUNT(top[w]);
+            if (id[i] == GV_ID_NONE && top[w]) {
+                id[i] = w * GV_MASK_BITS + GV_MASK_CTZ(top[w]);
+            }
+            rest[w] = ~top[w];
         }
+        ws->margin[i] = (winners > 1) ? 0 : best - mask_max(c, rest);
     }
+}
 
-    LPUART_Print(" \r\n");
-    for (int i = 0; i < n_stars_img; i++) {
-        char buf[128];
-        sprintf(buf, "Centroid %d received %d votes\r\n", i, k_n[i] * 2);
-        LPUART_Print(buf);
-    }
+int gvalg(gv_workspace *ws, const gv_real cat[][4], const gv_real tab_image[][3], gv_real loc_err,
+          int *id, gv_real *v2, int n_image, int n_stars_img) {
 
+    if (n_stars_img > ws->max_stars || (size_t)n_image > GV_MAX_PAIRS(ws->max_stars)) {
+        return -1;
+    }
 
-    // -*-*-----*-*- count votes -*-*------*-*-
+    // ---------------- WORKSPACE SETUP ----------------
     for (int i = 0; i < n_stars_img; i++) {
-    	int vote_count = k_n[i] * 2;  // Each pair adds 2 votes
-    	id[i] = setmode(v[i], vote_count);
-
-        // Fallback in case of invalid match
-        if (id[i] < 0) id[i] = 0;
+        v2[i] = 0;
     }
+    ws->votes_cast = 0;
+    ws->bins_touched = 0;
 
-    LPUART_Print(" \r\n");
-    for (int i = 0; i < n_stars_img; i++) {
-        char buf[128];
-        sprintf(buf, "Centroid %d assigned HIP ID %d\r\n", i, id[i]);
-        LPUART_Print(buf);
+
+    // ---------------- FIRST ROUND ----------------
+    // for each centroid pair from the image (each entry in tab_image[i][3]),
+    // vote for every catalog pair within loc_err of its angle, so a true
+    // match sitting just across a bin edge still gets its vote; ws->engine
+    // picks how the votes are stored and counted
+    if (ws->engine == GV_ENGINE_BITSET) {
+        vote_bitset(ws, tab_image, loc_err, id, n_image, n_stars_img);
+    } else if (vote_csr(ws, tab_image, loc_err, id, n_image, n_stars_img) != 0) {
+        for (int i = 0; i < n_stars_img; i++) {
+            id[i] = GV_ID_NONE;
+        }
+        return -1;
     }
 
 
     // ---------------- SECOND ROUND ----------------
-    // Now that stars have been matched, calculate real pairwise
+    // Now that stars have been matched, check the real pairwise
     // angles from catalog to confirm that matches are correct.
+    int by_matrix = ws->verify == GV_VERIFY_MATRIX && ANGLE_MATRIX_LAYOUT != ANGLE_MATRIX_OFF;
+    if (ws->verify == GV_VERIFY_ADJACENCY || by_matrix) {
+        // the catalog angle is a table read: a binary search of star a's
+        // neighbour row, or one matrix entry, and no cosines at all
+        for (int i = 0; i < n_image; i++) {
+            if (tab_image[i][0] >= 0 && tab_image[i][1] >= 0) {
+                int a = id[(int)tab_image[i][0]];
+                int b = id[(int)tab_image[i][1]];
+                if (a != GV_ID_NONE && b != GV_ID_NONE) {
+                    int d_cat = by_matrix ? gv_matrix_angle_mdeg(a, b) : gv_adj_angle_mdeg(a, b);
+                    gv_real diff = (gv_real)d_cat - tab_image[i][2];
+                    if (d_cat >= 0 && diff < loc_err && -diff < loc_err) {
+                        v2[(int)tab_image[i][0]]++;
+                        v2[(int)tab_image[i][1]]++;
+                    }
+                }
+            }
+        }
+        return 0;
+    }
+
+    // Done in cosine space: |d_cat - d_image| < loc_err is
+    //   cos(d_image + loc_err) < cat_a . cat_b < cos(d_image - loc_err)
+    // (cos falls monotonically over 0-180 deg), so the catalog side is a
+    // bare dot product. The bounds only depend on the image, so they are
+    // computed up front in one straight pass; past either end of 0-180
+    // deg the bound can't be crossed and is pushed out of [-1, 1].
+    gv_real *cos_lo = ws->cos_lo;
+    gv_real *cos_hi = ws->cos_hi;
+    for (int i = 0; i < n_image; i++) {
+        gv_cos_band b = gv_band_mdeg(tab_image[i][2], loc_err);
+        cos_lo[i] = b.lo;
+        cos_hi[i] = b.hi;
+    }
+
     for (int i = 0; i < n_image; i++) {
-    	if (tab_image[i][0] >= 0 && tab_image[i][1] >= 0) {
+        if (tab_image[i][0] >= 0 && tab_image[i][1] >= 0) {
             int a = id[(int)tab_image[i][0]];
             int b = id[(int)tab_image[i][1]];
 
             // Check that both centroids were successfully ID'd
-            if (a != 0 && b != 0) {
-                // Calculate catalog angle between identified stars
-            	int a_idx = -1, b_idx = -1;
-            	for (int j = 0; j < 256; j++) {
-            	    if ((int)cat[j][0] == a) a_idx = j;
-            	    if ((int)cat[j][0] == b) b_idx = j;
-            	}
-
-            	if (a_idx >= 0 && b_idx >= 0) {
-            	    double d_cat = acos(cat[a_idx][1] * cat[b_idx][1] +
-            	                        cat[a_idx][2] * cat[b_idx][2] +
-            	                        cat[a_idx][3] * cat[b_idx][3]);
-
-            	    double d_image = tab_image[i][2];
-
-            	    if (fabs(d_cat - d_image) < 1) {
-            	        v2[(int)tab_image[i][0]]++;
-            	        v2[(int)tab_image[i][1]]++;
-            	    }
-            	}
-
+            if (a != GV_ID_NONE && b != GV_ID_NONE) {
+                // IDs are catalog indices, which are also cat[] rows:
+                // cosine of the catalog angle between identified stars
+                gv_real dot = gv_dot3(&cat[a][1], &cat[b][1]);
+
+                // If the real catalog angle is close to the image angle, increase confidence score
+                if (dot > cos_lo[i] && dot < cos_hi[i]) {
+                    v2[(int)tab_image[i][0]]++;
+                    v2[(int)tab_image[i][1]]++;
+                }
             }
         }
     }
 
-    // --- Free dynamically allocated memory ---
-    free(k_n);
-    for (int i = 0; i < n_stars_img; i++)
-    {
-        free(v[i]);
+    return 0;
+}
+
+// ---- gv_adj_angle_mdeg() ----
+int gv_adj_angle_mdeg(int a, int b) {
+    // star a's row is sorted by neighbour index; halving it without
+    // branching on the compare keeps the pipeline full, and a row is
+    // never longer than ~70 entries, so that is 6-7 steps
+    int first = adj_start[a];
+    int n = adj_start[a + 1] - first;
+    if (n == 0) {
+        return -1;
+    }
+    while (n > 1) {
+        int half = n >> 1;
+        first = (adj_nbr[first + half] <= b) ? first + half : first;
+        n -= half;
     }
-    free(v);
+    return (adj_nbr[first] == b) ? adj_angle[first] : -1;
 }
 
-uint8_t setmode(int nums[], int numsize){
-	int mode = 0;
-    int counting = 0;
-    int maxcount = 0;
+// ---- gv_matrix_angle_mdeg() ----
+int gv_matrix_angle_mdeg(int a, int b) {
+#if ANGLE_MATRIX_LAYOUT == ANGLE_MATRIX_FULL
+    uint16_t q = catalog_angle_matrix[a][b];
+#elif ANGLE_MATRIX_LAYOUT == ANGLE_MATRIX_PACKED
+    // upper triangle only: order the pair, a == b has no entry
+    if (a == b) {
+        return -1;
+    }
+    if (a > b) {
+        int t = a;
+        a = b;
+        b = t;
+    }
+    uint16_t q = catalog_angle_matrix[ANGLE_MATRIX_ROW(a) + b - a - 1];
+#else
+    (void)a;
+    (void)b;
+    uint16_t q = ANGLE_MATRIX_NONE;
+#endif
+    return (q == ANGLE_MATRIX_NONE) ? -1 : q * CATALOG_PAIR_ANGLE_LSB_MDEG;
+}
+
+// ---- gv_cos_mdeg() ----
+gv_real gv_cos_mdeg(gv_real mdeg) {
+    return gv_cos(mdeg * GV_MDEG_TO_RAD);
+}
 
+// ---- setmode() ----
+// Linear-time mode finder. Catalog indices fit in a byte, so every vote
+// bumps one bin of a 256-entry histogram, and the top-1/top-2 counts are
+// updated as each vote arrives (counts only ever grow, so one compare
+// against each leader is enough). *margin receives the winner's lead over
+// the runner-up: 0 means a tie, i.e. the ID is ambiguous. hist[] is
+// workspace scratch; its contents on entry don't matter. Returns
+// GV_ID_NONE when there are no votes at all.
+int setmode(uint16_t hist[256], const uint8_t nums[], int numsize, int *margin) {
+    int mode = GV_ID_NONE, mode_count = 0;
+    int runner_up_count = 0;
+
+    // only clear the bins this vote list touches
     for (int i = 0; i < numsize; i++) {
-        for (int x = 0; x < numsize; x++) {
-            if (nums[i] == nums[x]) {
-                counting++;
-            }
-        }
-        if (counting > maxcount) {
-            mode = nums[i];
-            maxcount = counting;
+        hist[nums[i]] = 0;
+    }
+
+    for (int i = 0; i < numsize; i++) {
+        uint8_t star = nums[i];
+        int count = ++hist[star];
+
+        if (star == mode) {
+            mode_count = count;
+        } else if (count > mode_count) {
+            runner_up_count = mode_count;
+            mode = star;
+            mode_count = count;
+        } else if (count > runner_up_count) {
+            runner_up_count = count;
         }
-        counting = 0;
+    }
+
+    if (margin != NULL) {
+        *margin = mode_count - runner_up_count;
     }
     return mode;
 }
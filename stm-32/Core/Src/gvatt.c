@@ -0,0 +1,188 @@
+// /star-tracker     attitude determination
+// ----------------------------------------------------------
+// QUEST on the verified matches: the quaternion maximising Wahba's gain
+//   g(q) = q^T K q,   K = [S - sigma I   z]   B = sum w b r^T
+//                         [z^T       sigma]   S = B + B^T, sigma = tr B
+// over body vectors b and catalog vectors r, with no eigen-solver.
+//   Portable like gvalg.c (no HAL, no heap).
+//
+//   > q is K's eigenvector for its largest eigenvalue lambda, i.e. a
+//     column of adj(K - lambda I), which is rank one and proportional to
+//     q q^T. The column through its largest diagonal entry is the best
+//     conditioned whatever the rotation (QUEST's Gibbs-vector form
+//     breaks down near 180 degrees)
+//   > weights sum to 1, so lambda is 1 less Wahba's (tiny) loss.
+//     QUEST's Newton iteration on the characteristic polynomial can't
+//     resolve that in single precision: its coefficients cancel to ~1e-6,
+//     as much as lambda's gap to the next eigenvalue for close stars.
+//     Instead lambda = 1 gives a first q, and the loss of that q,
+//     measured directly on the vectors, gives lambda for the second (a
+//     near-optimal q's loss is off by the square of its error). The 8-
+//     digit catalog vectors are not quite unit length; that is added back
+// ----------------------------------------------------------
+
+#include "gvatt.h"
+#include "gvalg.h"
+
+// radians -> millidegrees
+#define ATT_RAD_TO_MDEG ((gv_real)(180000.0 / 3.14159265358979323846))
+
+// adj(K - lambda I)'s largest diagonal entry is the product of lambda's
+// gaps to the other eigenvalues; below this (stars less than ~0.1 deg
+// off one axis) the rotation about that axis is noise
+#define ATT_MIN_GAP ((gv_real)1e-5)
+
+// det of M with row r and column c left out
+static gv_real minor3(const gv_real M[4][4], int r, int c) {
+    int i[3], j[3];
+    for (int k = 0, n = 0; k < 4; k++) {
+        if (k != r) {
+            i[n++] = k;
+        }
+    }
+    for (int k = 0, n = 0; k < 4; k++) {
+        if (k != c) {
+            j[n++] = k;
+        }
+    }
+    return M[i[0]][j[0]] * (M[i[1]][j[1]] * M[i[2]][j[2]] - M[i[1]][j[2]] * M[i[2]][j[1]]) -
+           M[i[0]][j[1]] * (M[i[1]][j[0]] * M[i[2]][j[2]] - M[i[1]][j[2]] * M[i[2]][j[0]]) +
+           M[i[0]][j[2]] * (M[i[1]][j[0]] * M[i[2]][j[1]] - M[i[1]][j[1]] * M[i[2]][j[0]]);
+}
+
+// ---- gv_quat_to_matrix() ----
+void gv_quat_to_matrix(const gv_real q[4], gv_real R[3][3]) {
+    gv_real x = q[0], y = q[1], z = q[2], w = q[3];
+    R[0][0] = w * w + x * x - y * y - z * z;
+    R[0][1] = 2 * (x * y + w * z);
+    R[0][2] = 2 * (x * z - w * y);
+    R[1][0] = 2 * (x * y - w * z);
+    R[1][1] = w * w - x * x + y * y - z * z;
+    R[1][2] = 2 * (y * z + w * x);
+    R[2][0] = 2 * (x * z + w * y);
+    R[2][1] = 2 * (y * z - w * x);
+    R[2][2] = w * w - x * x - y * y + z * z;
+}
+
+// ---- quest_vector() ----
+// Unit eigenvector of K for eigenvalue lambda (w >= 0) via adj(K - lambda I).
+// Returns the adjugate's largest diagonal entry, ~0 if lambda is a
+// double root.
+static gv_real quest_vector(const gv_real S[3][3], gv_real sigma, const gv_real z[3], gv_real lambda,
+                            gv_real q[4]) {
+    gv_real M[4][4];
+    for (int j = 0; j < 3; j++) {
+        for (int k = 0; k < 3; k++) {
+            M[j][k] = S[j][k];
+        }
+        M[j][j] -= sigma + lambda;
+        M[j][3] = M[3][j] = z[j];
+    }
+    M[3][3] = sigma - lambda;
+
+    // adj(M) is symmetric: column m holds the signed minors of row m
+    int m = 0;
+    gv_real best = 0;
+    for (int k = 0; k < 4; k++) {
+        gv_real diag = minor3(M, k, k);
+        diag = (diag > 0) ? diag : -diag;
+        if (diag > best) {
+            best = diag;
+            m = k;
+        }
+    }
+    if (!(best > ATT_MIN_GAP)) {
+        return best;
+    }
+    gv_real p[4], norm2 = 0;
+    for (int k = 0; k < 4; k++) {
+        p[k] = ((k + m) & 1) ? -minor3(M, m, k) : minor3(M, m, k);
+        norm2 += p[k] * p[k];
+    }
+    gv_real scale = ((p[3] < 0) ? -1 : 1) / gv_sqrt(norm2);
+    for (int k = 0; k < 4; k++) {
+        q[k] = p[k] * scale;
+    }
+    return best;
+}
+
+// ---- fit() ----
+// Over the verified matches: returns sum |b - R(q) r|^2, and *excess
+// gets sum (|b|^2 - 1) + (|r|^2 - 1), the part of 2 sum b . R(q) r that
+// unit vectors wouldn't have
+static gv_real fit(const gv_real cat[][4], const gv_real v[][3], int n_stars, const int *id,
+                   const gv_real *v2, const gv_real q[4], gv_real *excess) {
+    gv_real R[3][3];
+    gv_quat_to_matrix(q, R);
+    gv_real sum = 0, norms = 0;
+    for (int i = 0; i < n_stars; i++) {
+        if (id[i] == GV_ID_NONE || v2[i] <= 0) {
+            continue;
+        }
+        const gv_real *r = &cat[id[i]][1];
+        for (int j = 0; j < 3; j++) {
+            gv_real diff = v[i][j] - gv_dot3(R[j], r);
+            sum += diff * diff;
+        }
+        norms += (gv_dot3(v[i], v[i]) - 1) + (gv_dot3(r, r) - 1);
+    }
+    *excess = norms;
+    return sum;
+}
+
+// ---- gv_attitude() ----
+int gv_attitude(const gv_real cat[][4], const gv_real v[][3], int n_stars, const int *id,
+                const gv_real *v2, gv_real q[4], gv_real *residual) {
+    // ---------------- ATTITUDE PROFILE MATRIX ----------------
+    gv_real B[3][3] = {{0}};
+    int n = 0;
+    for (int i = 0; i < n_stars; i++) {
+        if (id[i] == GV_ID_NONE || v2[i] <= 0) {
+            continue;
+        }
+        const gv_real *r = &cat[id[i]][1];
+        for (int j = 0; j < 3; j++) {
+            for (int k = 0; k < 3; k++) {
+                B[j][k] += v[i][j] * r[k];
+            }
+        }
+        n++;
+    }
+    if (n < 2) {
+        return -1;
+    }
+    gv_real w = (gv_real)1 / n;
+    for (int j = 0; j < 3; j++) {
+        for (int k = 0; k < 3; k++) {
+            B[j][k] *= w;
+        }
+    }
+
+    gv_real sigma = B[0][0] + B[1][1] + B[2][2];
+    gv_real z[3] = {B[1][2] - B[2][1], B[2][0] - B[0][2], B[0][1] - B[1][0]};
+    gv_real S[3][3];
+    for (int j = 0; j < 3; j++) {
+        for (int k = 0; k < 3; k++) {
+            S[j][k] = B[j][k] + B[k][j];
+        }
+    }
+
+    // ---------------- EIGENVECTOR, TWICE ----------------
+    // collinear stars leave lambda a double root and adj(K - lambda I) ~0
+    gv_real q0[4];
+    if (!(quest_vector(S, sigma, z, 1, q0) > ATT_MIN_GAP)) {
+        return -1;
+    }
+    gv_real excess;
+    gv_real loss = fit(cat, v, n_stars, id, v2, q0, &excess) * w / 2;
+    if (!(quest_vector(S, sigma, z, 1 - loss + excess * w / 2, q) > ATT_MIN_GAP)) {
+        for (int k = 0; k < 4; k++) {
+            q[k] = q0[k];
+        }
+    }
+
+    // ---------------- RESIDUAL ----------------
+    // chord |b - R r| is the angle to well under a microradian here
+    *residual = gv_sqrt(fit(cat, v, n_stars, id, v2, q, &excess) * w) * ATT_RAD_TO_MDEG;
+    return n;
+}
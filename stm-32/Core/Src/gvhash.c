@@ -0,0 +1,186 @@
+// /star-tracker     geometric-hash identification
+// ----------------------------------------------------------
+// Lost-in-space by pattern hashing: instead of walking angle bins per
+// pair, every centroid reads its candidates straight out of a hash.
+//   Portable like gvalg.c (no HAL, no heap).
+//
+//   > a star's pattern is a pair of angles to two of its HASH_NN nearest
+//     neighbours. catalog_hash.c files every catalog star under each
+//     HASH_CELL_MDEG grid cell any of its patterns +/- HASH_TOL_MDEG
+//     touches, so one probe at an image pattern's own cell finds it
+//   > every choice of two neighbours is filed and probed, so a star
+//     whose nearest neighbour is off the frame edge or dropped, or
+//     which has a false star beside it, still shares a pattern
+//   > a bucket also holds whatever else hashed there; the stored
+//     hash_pattern[] drops candidates more than loc_err off, and of the
+//     rest each centroid keeps the GV_HASH_MAX_CAND closest
+//   > the frame then settles the rest: each centroid keeps the candidate
+//     whose pair angles to the most other centroids' candidates match
+// ----------------------------------------------------------
+
+#include "gvhash.h"
+#include "gvalg.h"
+#include "gvpairs.h"
+#include "catalog_hash.h"
+
+// how far catalog pattern p is from angles d1 and d2 (d1 <= d2), in order:
+// the smallest |e1| + |e2| over its stored pairs within tol, or -1
+static gv_real pattern_error(const uint16_t p[HASH_NN], gv_real d1, gv_real d2, gv_real tol) {
+    gv_real best = -1;
+    for (int k = 0; k < HASH_NN; k++) {
+        gv_real e1 = (gv_real)p[k] * CATALOG_PAIR_ANGLE_LSB_MDEG - d1;
+        if (e1 >= tol || e1 <= -tol) {
+            continue;
+        }
+        for (int l = k + 1; l < HASH_NN; l++) {
+            gv_real e2 = (gv_real)p[l] * CATALOG_PAIR_ANGLE_LSB_MDEG - d2;
+            if (e2 < tol && e2 > -tol) {
+                gv_real e = ((e1 < 0) ? -e1 : e1) + ((e2 < 0) ? -e2 : e2);
+                if (best < 0 || e < best) {
+                    best = e;
+                }
+            }
+        }
+    }
+    return best;
+}
+
+// files candidate x with pattern error e into list[]/err[] (n entries,
+// ascending error, at most GV_HASH_MAX_CAND): a candidate already there
+// keeps its smaller error, and a full list drops its worst
+static void keep_best(int *list, gv_real *err, int *n, int x, gv_real e) {
+    int k = 0;
+    while (k < *n && list[k] != x) {
+        k++;
+    }
+    if (k < *n) {
+        if (err[k] <= e) {
+            return;
+        }
+    } else if (*n < GV_HASH_MAX_CAND) {
+        k = (*n)++;
+    } else if (e < err[*n - 1]) {
+        k = *n - 1;
+    } else {
+        return;
+    }
+    while (k > 0 && err[k - 1] > e) {
+        list[k] = list[k - 1];
+        err[k] = err[k - 1];
+        k--;
+    }
+    list[k] = x;
+    err[k] = e;
+}
+
+// ---- gv_hash_id() ----
+int gv_hash_id(const gv_real cat[][4], const gv_real v[][3], int n_stars, gv_real loc_err,
+               int *id, gv_real *v2) {
+    for (int i = 0; i < n_stars; i++) {
+        id[i] = GV_ID_NONE;
+        v2[i] = 0;
+    }
+
+    // pair angles among the centroids used (-1: past the catalog ceiling)
+    int n = (n_stars < GV_HASH_MAX_STARS) ? n_stars : GV_HASH_MAX_STARS;
+    gv_real d[GV_HASH_MAX_STARS][GV_HASH_MAX_STARS];
+    for (int i = 0; i < n; i++) {
+        d[i][i] = -1;
+        for (int j = i + 1; j < n; j++) {
+            d[i][j] = d[j][i] = gv_pair_angle_mdeg(v[i], v[j]);
+        }
+    }
+
+    // ---------------- HASH EACH PATTERN ----------------
+    int cand[GV_HASH_MAX_STARS][GV_HASH_MAX_CAND];
+    int n_cand[GV_HASH_MAX_STARS];
+    gv_real tol = loc_err + CATALOG_PAIR_ANGLE_LSB_MDEG;  // hash_pattern[] is rounded to the LSB
+    for (int i = 0; i < n; i++) {
+        n_cand[i] = 0;
+
+        // HASH_NN nearest neighbours, ascending
+        gv_real nn[HASH_NN];
+        int n_nn = 0;
+        for (int j = 0; j < n; j++) {
+            gv_real a = d[i][j];
+            if (a < 0 || (n_nn == HASH_NN && a >= nn[HASH_NN - 1])) {
+                continue;
+            }
+            int slot = (n_nn < HASH_NN) ? n_nn++ : HASH_NN - 1;
+            while (slot > 0 && nn[slot - 1] > a) {
+                nn[slot] = nn[slot - 1];
+                slot--;
+            }
+            nn[slot] = a;
+        }
+
+        // one probe per pattern; a candidate has to match the pattern on
+        // two of its own stored neighbour angles, and the closest
+        // matches are kept however many the buckets hold
+        gv_real err[GV_HASH_MAX_CAND];
+        for (int k = 0; k < n_nn; k++) {
+            for (int l = k + 1; l < n_nn; l++) {
+                uint32_t h = HASH_CELL((int)(nn[k] / HASH_CELL_MDEG), (int)(nn[l] / HASH_CELL_MDEG));
+                for (int e = hash_start[h]; e < hash_start[h + 1]; e++) {
+                    int x = hash_entries[e];
+                    gv_real pe = pattern_error(hash_pattern[x], nn[k], nn[l], tol);
+                    if (pe >= 0) {
+                        keep_best(cand[i], err, &n_cand[i], x, pe);
+                    }
+                }
+            }
+        }
+    }
+
+    // ---------------- CONSENSUS ----------------
+    // support for candidate c of centroid i: other centroids j with some
+    // candidate at the right catalog angle from c
+    for (int i = 0; i < n; i++) {
+        if (n_cand[i] == 0) {
+            continue;
+        }
+        gv_cos_band b[GV_HASH_MAX_STARS];
+        for (int j = 0; j < n; j++) {
+            if (j != i && n_cand[j] > 0 && d[i][j] >= 0) {
+                b[j] = gv_band_mdeg(d[i][j], loc_err);
+            }
+        }
+
+        int best = GV_ID_NONE, best_support = 0, tie = 0;
+        for (int k = 0; k < n_cand[i]; k++) {
+            int c = cand[i][k];
+            int support = 0;
+            for (int j = 0; j < n; j++) {
+                if (j == i || n_cand[j] == 0 || d[i][j] < 0) {
+                    continue;
+                }
+                for (int m = 0; m < n_cand[j]; m++) {
+                    int cj = cand[j][m];
+                    if (cj != c && gv_in_band(gv_dot3(&cat[c][1], &cat[cj][1]), b[j])) {
+                        support++;
+                        break;
+                    }
+                }
+            }
+            if (support > best_support) {
+                best = c;
+                best_support = support;
+                tie = 0;
+            } else if (support == best_support && support > 0) {
+                tie = 1;
+            }
+        }
+        if (!tie) {
+            id[i] = best;
+        }
+    }
+
+    // ---------------- VERIFY ----------------
+    gv_verify_vectors(cat, v, n_stars, loc_err, id, v2);
+
+    int n_id = 0;
+    for (int i = 0; i < n; i++) {
+        n_id += (id[i] != GV_ID_NONE);
+    }
+    return n_id;
+}
@@ -0,0 +1,196 @@
+// /star-tracker     image pair tabulation
+// ----------------------------------------------------------
+// Front end for gvalg(): centroids -> unit vectors -> tab_image.
+//   Portable like gvalg.c (no HAL, no heap).
+//
+//   Pair angles come from the chord c = |u - v| rather than acos(u . v):
+//     > angle = 2 * asin(c / 2), which is smooth over the whole 0-84 deg
+//       range, so chord_to_mdeg_lut (catalog_luts.c) with linear
+//       interpolation stays within ~0.05 mdeg; acos near 1 is not
+//     > c^2 is three subtractions and three multiplies, and comparing it
+//       against CHORD_LUT_MAX^2 culls pairs past the catalog's ceiling
+//       before the one sqrt
+//   so no pair costs a transcendental call.
+//
+//   gv_select_pairs() bounds the work for crowded frames: brightest
+//   k_bright centroids only, each paired with its k_nn nearest.
+// ----------------------------------------------------------
+
+#include "gvpairs.h"
+#include "gvalg.h"
+#include "catalog_luts.h"
+
+// ---- gv_centroids_to_vectors() ----
+void gv_centroids_to_vectors(const gv_camera *cam, const gv_real px[][2], gv_real v[][3], int n_stars) {
+    for (int i = 0; i < n_stars; i++) {
+        gv_real x = (px[i][0] - cam->cx) / cam->fx;
+        gv_real y = (px[i][1] - cam->cy) / cam->fy;
+        gv_real inv = 1 / gv_sqrt(x * x + y * y + 1);
+        v[i][0] = x * inv;
+        v[i][1] = y * inv;
+        v[i][2] = inv;
+    }
+}
+
+// squared chord between two unit vectors
+static inline gv_real chord2(const gv_real u[3], const gv_real v[3]) {
+    gv_real dx = u[0] - v[0];
+    gv_real dy = u[1] - v[1];
+    gv_real dz = u[2] - v[2];
+    return dx * dx + dy * dy + dz * dz;
+}
+
+#define CHORD2_MAX ((gv_real)(CHORD_LUT_MAX * CHORD_LUT_MAX))
+
+// pair angle (mdeg) for a squared chord below CHORD2_MAX. c2 just under
+// CHORD2_MAX can still round x up to CHORD_LUT_SIZE, so the last slot is
+// clamped to keep slot + 1 inside the table
+static inline gv_real chord2_to_mdeg(gv_real c2) {
+    gv_real x = gv_sqrt(c2) * (gv_real)(CHORD_LUT_SIZE / CHORD_LUT_MAX);
+    int slot = (int)x;
+    gv_real frac = x - slot;
+    if (slot >= CHORD_LUT_SIZE) {
+        slot = CHORD_LUT_SIZE - 1;
+        frac = 1;
+    }
+    gv_real lo = chord_to_mdeg_lut[slot];
+    return lo + frac * (chord_to_mdeg_lut[slot + 1] - lo);
+}
+
+// ---- gv_pair_angle_mdeg() ----
+gv_real gv_pair_angle_mdeg(const gv_real u[3], const gv_real v[3]) {
+    gv_real c2 = chord2(u, v);
+    return (c2 < CHORD2_MAX) ? chord2_to_mdeg(c2) : -1;
+}
+
+// ---- gv_verify_vectors() ----
+// The image angle a is never formed: from its cosine u . v and sine
+// |u x v| the angle-sum rule gives cos(a +/- loc_err) directly, so a
+// pair costs a cross product and a sqrt instead of gv_band_mdeg()'s two
+// cosines. The chord still culls pairs past the catalog's ceiling.
+void gv_verify_vectors(const gv_real cat[][4], const gv_real v[][3], int n_stars, gv_real loc_err,
+                       const int *id, gv_real *v2) {
+    gv_real cos_e = gv_cos_mdeg(loc_err);
+    gv_real sin_e = gv_cos_mdeg(90000 - loc_err);
+
+    for (int i = 0; i < n_stars; i++) {
+        v2[i] = 0;
+    }
+    for (int i = 0; i < n_stars; i++) {
+        if (id[i] == GV_ID_NONE) {
+            continue;
+        }
+        for (int j = i + 1; j < n_stars; j++) {
+            if (id[j] == GV_ID_NONE || chord2(v[i], v[j]) >= CHORD2_MAX) {
+                continue;
+            }
+            gv_real c = gv_dot3(v[i], v[j]);
+            gv_real x = v[i][1] * v[j][2] - v[i][2] * v[j][1];
+            gv_real y = v[i][2] * v[j][0] - v[i][0] * v[j][2];
+            gv_real z = v[i][0] * v[j][1] - v[i][1] * v[j][0];
+            gv_real s = gv_sqrt(x * x + y * y + z * z);
+
+            // a < loc_err: no upper bound; a + loc_err past 180 deg: no lower
+            gv_cos_band b;
+            b.lo = (c > -cos_e) ? c * cos_e - s * sin_e : -2;
+            b.hi = (c < cos_e) ? c * cos_e + s * sin_e : 2;
+            if (gv_in_band(gv_dot3(&cat[id[i]][1], &cat[id[j]][1]), b)) {
+                v2[i]++;
+                v2[j]++;
+            }
+        }
+    }
+}
+
+// ---- gv_tabulate_pairs() ----
+int gv_tabulate_pairs(const gv_real v[][3], int n_stars, gv_real tab_image[][3], int max_pairs) {
+    int n_image = 0;
+
+    for (int i = 0; i < n_stars; i++) {
+        for (int j = i + 1; j < n_stars; j++) {
+            gv_real c2 = chord2(v[i], v[j]);
+
+            // wider than any catalog pair: it can't vote for anything
+            if (c2 >= CHORD2_MAX) {
+                continue;
+            }
+            if (n_image == max_pairs) {
+                return -1;
+            }
+
+            tab_image[n_image][0] = i;
+            tab_image[n_image][1] = j;
+            tab_image[n_image][2] = chord2_to_mdeg(c2);
+            n_image++;
+        }
+    }
+    return n_image;
+}
+
+// ---- gv_select_pairs() ----
+int gv_select_pairs(const gv_real v[][3], const gv_real brightness[], int n_stars,
+                    int k_bright, int k_nn, int sel[], int *n_sel,
+                    gv_real tab_image[][3], int max_pairs) {
+    if (k_bright < 1 || k_bright > GV_SELECT_MAX_BRIGHT || k_nn < 1 || k_nn > GV_SELECT_MAX_NN) {
+        return -1;
+    }
+
+    // ----- k_bright brightest, kept sorted by insertion -----
+    int n = 0;
+    for (int i = 0; i < n_stars; i++) {
+        if (n == k_bright && brightness[i] <= brightness[sel[n - 1]]) {
+            continue;
+        }
+        int slot = (n < k_bright) ? n++ : n - 1;
+        while (slot > 0 && brightness[sel[slot - 1]] < brightness[i]) {
+            sel[slot] = sel[slot - 1];
+            slot--;
+        }
+        sel[slot] = i;
+    }
+    *n_sel = n;
+
+    // ----- reach[a]: squared chord to a's k_nn-th nearest partner -----
+    gv_real reach[GV_SELECT_MAX_BRIGHT];
+    for (int a = 0; a < n; a++) {
+        gv_real best[GV_SELECT_MAX_NN];
+        int kept = 0;
+        for (int b = 0; b < n; b++) {
+            if (b == a) {
+                continue;
+            }
+            gv_real c2 = chord2(v[sel[a]], v[sel[b]]);
+            if (c2 >= CHORD2_MAX || (kept == k_nn && c2 >= best[kept - 1])) {
+                continue;
+            }
+            int slot = (kept < k_nn) ? kept++ : kept - 1;
+            while (slot > 0 && best[slot - 1] > c2) {
+                best[slot] = best[slot - 1];
+                slot--;
+            }
+            best[slot] = c2;
+        }
+        // fewer than k_nn partners in range: take all of them
+        reach[a] = (kept == k_nn) ? best[kept - 1] : CHORD2_MAX;
+    }
+
+    // ----- a pair is kept if either end has the other among its nearest -----
+    int n_image = 0;
+    for (int a = 0; a < n; a++) {
+        for (int b = a + 1; b < n; b++) {
+            gv_real c2 = chord2(v[sel[a]], v[sel[b]]);
+            if (c2 >= CHORD2_MAX || (c2 > reach[a] && c2 > reach[b])) {
+                continue;
+            }
+            if (n_image == max_pairs) {
+                return n_image;
+            }
+
+            tab_image[n_image][0] = a;
+            tab_image[n_image][1] = b;
+            tab_image[n_image][2] = chord2_to_mdeg(c2);
+            n_image++;
+        }
+    }
+    return n_image;
+}
@@ -0,0 +1,273 @@
+// /star-tracker     tracking mode
+// ----------------------------------------------------------
+// Frame-to-frame identification without lost-in-space voting.
+//   Portable like gvalg.c (no HAL, no heap).
+//
+//   > predict: the last attitude R puts each star seen in the last frame
+//     at R * cat; the nearest new centroid within max_motion_mdeg takes
+//     its ID (two stars claiming one centroid drop out)
+//   > re-estimate: TRIAD on the two matched stars furthest apart gives
+//     this frame's attitude
+//   > identify: every centroid is turned back into the catalog frame
+//     and takes the nearest catalog star inside the predicted FOV,
+//     so stars entering the frame are picked up as well. The catalog
+//     stars around the FOV are listed with GV_TRACK_SLACK_MDEG to spare
+//     and only re-listed once the frame drifts out of that; more than
+//     GV_TRACK_MAX_CAND of them loses the track rather than test a few
+//   > verify: gv_verify_vectors() as for the other solvers; fewer than
+//     GV_TRACK_MIN_IDS confirmed IDs means the track is lost
+// ----------------------------------------------------------
+
+#include "gvtrack.h"
+#include "gvalg.h"
+#include "gvpairs.h"
+#include "catalog_xyz.h"
+#include "catalog_luts.h"
+
+// two claims on one centroid
+#define TRACK_CONFLICT (-2)
+
+// widest pair TRIAD is built from must be at least this far apart
+#define TRACK_MIN_BASE_MDEG 1000
+
+// centroid-to-catalog match gate after re-estimation, in loc_errs
+#define TRACK_GATE_LOC_ERRS 8
+
+static const gv_real z_axis[3] = {0, 0, 1};
+
+static inline void cross3(const gv_real u[3], const gv_real v[3], gv_real w[3]) {
+    w[0] = u[1] * v[2] - u[2] * v[1];
+    w[1] = u[2] * v[0] - u[0] * v[2];
+    w[2] = u[0] * v[1] - u[1] * v[0];
+}
+
+// ---- triad() ----
+// Rotation R with b = R r from two body vectors and their catalog
+// counterparts. The first pair is matched exactly, the second only in
+// the plane it spans with the first.
+static void triad(const gv_real b1[3], const gv_real b2[3], const gv_real r1[3], const gv_real r2[3],
+                  gv_real R[3][3]) {
+    gv_real tb[3][3], tr[3][3];
+    for (int k = 0; k < 3; k++) {
+        tb[0][k] = b1[k];
+        tr[0][k] = r1[k];
+    }
+    cross3(b1, b2, tb[1]);
+    cross3(r1, r2, tr[1]);
+    gv_real nb = 1 / gv_sqrt(gv_dot3(tb[1], tb[1]));
+    gv_real nr = 1 / gv_sqrt(gv_dot3(tr[1], tr[1]));
+    for (int k = 0; k < 3; k++) {
+        tb[1][k] *= nb;
+        tr[1][k] *= nr;
+    }
+    cross3(tb[0], tb[1], tb[2]);
+    cross3(tr[0], tr[1], tr[2]);
+
+    for (int j = 0; j < 3; j++) {
+        for (int k = 0; k < 3; k++) {
+            R[j][k] = tb[0][j] * tr[0][k] + tb[1][j] * tr[1][k] + tb[2][j] * tr[2][k];
+        }
+    }
+}
+
+// usable for TRIAD: identified, and verified if only verified IDs count
+static inline int usable(const int *id, const gv_real *v2, int i, int verified_only) {
+    return id[i] >= 0 && (!verified_only || v2[i] > 0);
+}
+
+// ---- attitude_from_ids() ----
+// TRIAD on the two usable centroids furthest apart: the wider the base,
+// the less centroid noise tilts the attitude about it. Returns -1 if no
+// pair is at least TRACK_MIN_BASE_MDEG apart.
+static int attitude_from_ids(const gv_real cat[][4], const gv_real v[][3], int n_stars, const int *id,
+                             const gv_real *v2, int verified_only, gv_real R[3][3]) {
+    int a = -1, b = -1;
+    gv_real widest = gv_cos_mdeg(TRACK_MIN_BASE_MDEG);
+    for (int i = 0; i < n_stars; i++) {
+        if (!usable(id, v2, i, verified_only)) {
+            continue;
+        }
+        for (int j = i + 1; j < n_stars; j++) {
+            gv_real dot = gv_dot3(v[i], v[j]);
+            if (dot < widest && usable(id, v2, j, verified_only)) {
+                widest = dot;
+                a = i;
+                b = j;
+            }
+        }
+    }
+    if (a < 0) {
+        return -1;
+    }
+
+    triad(v[a], v[b], &cat[id[a]][1], &cat[id[b]][1], R);
+    return 0;
+}
+
+// ---- gv_track_init() ----
+void gv_track_init(gv_track *t, gv_real max_motion_mdeg) {
+    t->valid = 0;
+    t->n_ids = 0;
+    t->max_motion_mdeg = max_motion_mdeg;
+    t->cos_motion = gv_cos_mdeg(max_motion_mdeg);
+    t->n_cand = 0;
+    t->cand_reach_mdeg = -1;  // nothing listed yet
+    t->cand_overflows = 0;
+}
+
+// ---- list_candidates() ----
+// Makes sure t->cand[] holds every catalog star within reach_mdeg of the
+// boresight axis[] (catalog frame), re-listing around axis[] with
+// GV_TRACK_SLACK_MDEG to spare when the current list can't promise that.
+// Returns -1 if more than GV_TRACK_MAX_CAND stars are in reach: a
+// truncated list would miss stars for as long as it was reused, so it
+// is not kept.
+static int list_candidates(gv_track *t, const gv_real cat[][4], const gv_real axis[3], gv_real reach_mdeg) {
+    if (t->cand_reach_mdeg >= 0) {
+        gv_real drift = gv_pair_angle_mdeg(axis, t->cand_axis);
+        if (drift >= 0 && drift + reach_mdeg <= t->cand_reach_mdeg) {
+            return 0;
+        }
+    }
+
+    gv_real cos_reach = gv_cos_mdeg(reach_mdeg + GV_TRACK_SLACK_MDEG);
+    t->n_cand = 0;
+    for (int c = 0; c < CATALOG_SIZE; c++) {
+        if (gv_dot3(axis, &cat[c][1]) > cos_reach) {
+            if (t->n_cand == GV_TRACK_MAX_CAND) {
+                t->n_cand = 0;
+                t->cand_reach_mdeg = -1;
+                t->cand_overflows++;
+                return -1;
+            }
+            t->cand[t->n_cand++] = c;
+        }
+    }
+    t->cand_reach_mdeg = reach_mdeg + GV_TRACK_SLACK_MDEG;
+    for (int k = 0; k < 3; k++) {
+        t->cand_axis[k] = axis[k];
+    }
+    return 0;
+}
+
+// ---- gv_track_seed() ----
+int gv_track_seed(gv_track *t, const gv_real cat[][4], const gv_real v[][3], int n_stars,
+                  const int *id, const gv_real *v2) {
+    // only verified IDs carry over
+    t->valid = 0;
+    t->n_ids = 0;
+    for (int i = 0; i < n_stars && t->n_ids < GV_TRACK_MAX_IDS; i++) {
+        if (usable(id, v2, i, 1)) {
+            t->ids[t->n_ids++] = id[i];
+        }
+    }
+    if (t->n_ids < GV_TRACK_MIN_IDS || attitude_from_ids(cat, v, n_stars, id, v2, 1, t->R) != 0) {
+        return -1;
+    }
+    t->valid = 1;
+    return 0;
+}
+
+// ---- gv_track_frame() ----
+int gv_track_frame(gv_track *t, const gv_real cat[][4], const gv_real v[][3], int n_stars,
+                   gv_real loc_err, int *id, gv_real *v2) {
+    if (!t->valid) {
+        return 0;
+    }
+    for (int i = 0; i < n_stars; i++) {
+        id[i] = GV_ID_NONE;
+        v2[i] = 0;
+    }
+
+    // ---------------- PREDICT + MATCH ----------------
+    for (int k = 0; k < t->n_ids; k++) {
+        const gv_real *c = &cat[t->ids[k]][1];
+        gv_real p[3] = {gv_dot3(t->R[0], c), gv_dot3(t->R[1], c), gv_dot3(t->R[2], c)};
+
+        int best = -1;
+        gv_real best_dot = t->cos_motion;
+        for (int i = 0; i < n_stars; i++) {
+            gv_real dot = gv_dot3(p, v[i]);
+            if (dot > best_dot) {
+                best_dot = dot;
+                best = i;
+            }
+        }
+        if (best >= 0) {
+            id[best] = (id[best] == GV_ID_NONE) ? t->ids[k] : TRACK_CONFLICT;
+        }
+    }
+    for (int i = 0; i < n_stars; i++) {
+        if (id[i] == TRACK_CONFLICT) {
+            id[i] = GV_ID_NONE;
+        }
+    }
+
+    // ---------------- RE-ESTIMATE ATTITUDE ----------------
+    gv_real R[3][3];
+    if (attitude_from_ids(cat, v, n_stars, id, v2, 0, R) != 0) {
+        t->valid = 0;
+        return 0;
+    }
+
+    // ---------------- IDENTIFY ----------------
+    // catalog stars inside the predicted FOV: the boresight in the
+    // catalog frame is R^T z (R's last row), and the FOV reaches as far
+    // off-axis as the widest centroid, plus the match gate. TRIAD's error
+    // grows with distance from its base, so the gate is wider than
+    // loc_err; catalog stars are far sparser than that, and verification
+    // still has the final say
+    gv_real tol = TRACK_GATE_LOC_ERRS * loc_err;
+    gv_real cos_tol = gv_cos_mdeg(tol);
+    gv_real off_axis = 0;
+    for (int i = 0; i < n_stars; i++) {
+        gv_real a = gv_pair_angle_mdeg(v[i], z_axis);
+        if (a < 0 || a > off_axis) {
+            off_axis = (a < 0) ? CATALOG_MAX_ANGLE_MDEG : a;
+        }
+    }
+    if (list_candidates(t, cat, R[2], off_axis + tol) != 0) {
+        // more catalog stars in view than can be tested: lost-in-space
+        t->valid = 0;
+        return 0;
+    }
+
+    for (int i = 0; i < n_stars; i++) {
+        // centroid in the catalog frame: R^T v
+        gv_real u[3];
+        for (int k = 0; k < 3; k++) {
+            u[k] = R[0][k] * v[i][0] + R[1][k] * v[i][1] + R[2][k] * v[i][2];
+        }
+        int best = GV_ID_NONE;
+        gv_real best_dot = cos_tol;
+        for (int m = 0; m < t->n_cand; m++) {
+            gv_real dot = gv_dot3(u, &cat[t->cand[m]][1]);
+            if (dot > best_dot) {
+                best_dot = dot;
+                best = t->cand[m];
+            }
+        }
+        id[i] = best;
+    }
+
+    // a catalog star taken twice is trusted for neither centroid
+    for (int i = 0; i < n_stars; i++) {
+        int dup = 0;
+        for (int j = i + 1; j < n_stars && id[i] != GV_ID_NONE; j++) {
+            if (id[j] == id[i]) {
+                id[j] = GV_ID_NONE;
+                dup = 1;
+            }
+        }
+        if (dup) {
+            id[i] = GV_ID_NONE;
+        }
+    }
+
+    // ---------------- VERIFY ----------------
+    gv_verify_vectors(cat, v, n_stars, loc_err, id, v2);
+    if (gv_track_seed(t, cat, v, n_stars, id, v2) != 0) {
+        return 0;
+    }
+    return t->n_ids;
+}
@@ -0,0 +1,204 @@
+// /star-tracker     triangle identification
+// ----------------------------------------------------------
+// Sparse-frame alternative to gvalg(): one star triangle identifies
+// the frame, instead of many pairs voting until a winner emerges.
+//   Portable like gvalg.c (no HAL, no heap).
+//
+//   > catalog_triangles.c holds every catalog triangle that fits the
+//     camera FOV, vertices labelled by side length (a-b longest, b-c
+//     middle, c-a shortest) and sorted by the longest side
+//   > an image triangle is labelled the same way; a binary search on
+//     tri_key gives the candidates whose longest side is within loc_err,
+//     and each is checked side by side in cosine space (as gvalg's
+//     verification), plus handedness, which side lengths alone can't
+//     tell from a mirror image
+//   > a near-tie between the middle and shortest sides can swap the
+//     image labels, so both labellings of a candidate are tried
+//   > the first image triangle with exactly one match wins; the other
+//     centroids are then identified by their angles to its three stars
+// ----------------------------------------------------------
+
+#include "gvtri.h"
+#include "gvalg.h"
+#include "gvpairs.h"
+#include "catalog_xyz.h"
+#include "catalog_triangles.h"
+
+// millidegrees -> radians
+#define TRI_MDEG_TO_RAD ((gv_real)(3.14159265358979323846 / 180000.0))
+
+// u . (v x w): positive when u, v, w run counter-clockwise seen from outside
+static inline gv_real det3(const gv_real u[3], const gv_real v[3], const gv_real w[3]) {
+    return u[0] * (v[1] * w[2] - v[2] * w[1]) +
+           u[1] * (v[2] * w[0] - v[0] * w[2]) +
+           u[2] * (v[0] * w[1] - v[1] * w[0]);
+}
+
+// first tri_key[] slot >= key
+static int key_lower_bound(int key) {
+    int lo = 0, hi = N_TRIS;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (tri_key[mid] < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// ---- match_triangle() ----
+// Image triangle p, q, r (p-q longest, q-r middle, r-p shortest, sides
+// in d[]) against the catalog index. Returns how many catalog triangles
+// match, stopping at 2; the first one's stars for p, q, r go to abc[].
+static int match_triangle(const gv_real cat[][4], const gv_real v[][3], int p, int q, int r,
+                          const gv_real d[3], gv_real loc_err, int abc[3]) {
+    gv_cos_band pq = gv_band_mdeg(d[0], loc_err);
+    gv_cos_band qr = gv_band_mdeg(d[1], loc_err);
+    gv_cos_band rp = gv_band_mdeg(d[2], loc_err);
+
+    // too flat for the sign to survive centroid noise: skip the check
+    gv_real hand = det3(v[p], v[q], v[r]);
+    int use_hand = (hand > 0 ? hand : -hand) >= (loc_err * TRI_MDEG_TO_RAD) * (d[0] * TRI_MDEG_TO_RAD);
+
+    int key_lo = (int)gv_ceil((d[0] - loc_err) / CATALOG_PAIR_ANGLE_LSB_MDEG - (gv_real)0.5);
+    int key_hi = (int)gv_floor((d[0] + loc_err) / CATALOG_PAIR_ANGLE_LSB_MDEG + (gv_real)0.5);
+
+    int matches = 0;
+    for (int t = key_lower_bound(key_lo); t < N_TRIS && tri_key[t] <= key_hi; t++) {
+        const gv_real *a = &cat[tri_cat[t].a][1];
+        const gv_real *b = &cat[tri_cat[t].b][1];
+        const gv_real *c = &cat[tri_cat[t].c][1];
+
+        // the key already put a-b in range, so the short sides are what
+        // rejects most candidates: test those first
+        gv_real bc = gv_dot3(b, c);
+        if (!gv_in_band(bc, qr) && !gv_in_band(bc, rp)) {
+            continue;
+        }
+        gv_real ca = gv_dot3(c, a);
+        if (!gv_in_band(gv_dot3(a, b), pq)) {
+            continue;
+        }
+        gv_real cat_hand = use_hand ? det3(a, b, c) : 0;
+
+        // p -> a, q -> b as labelled, or p -> b, q -> a if the image's
+        // middle and shortest sides came out the other way round
+        for (int swap = 0; swap < 2; swap++) {
+            if (!gv_in_band(swap ? ca : bc, qr) || !gv_in_band(swap ? bc : ca, rp)) {
+                continue;
+            }
+            if (use_hand && ((hand > 0) != ((swap ? -cat_hand : cat_hand) > 0))) {
+                continue;
+            }
+            if (matches++ == 0) {
+                abc[0] = swap ? tri_cat[t].b : tri_cat[t].a;
+                abc[1] = swap ? tri_cat[t].a : tri_cat[t].b;
+                abc[2] = tri_cat[t].c;
+            }
+            if (matches > 1) {
+                return matches;
+            }
+        }
+    }
+    return matches;
+}
+
+// ---- gv_triangle_id() ----
+int gv_triangle_id(const gv_real cat[][4], const gv_real v[][3], int n_stars, gv_real loc_err,
+                   int *id, gv_real *v2) {
+    for (int i = 0; i < n_stars; i++) {
+        id[i] = GV_ID_NONE;
+        v2[i] = 0;
+    }
+
+    // pair angles among the triangle candidates (-1: past the catalog ceiling)
+    int n_tri = (n_stars < GV_TRI_MAX_STARS) ? n_stars : GV_TRI_MAX_STARS;
+    gv_real d[GV_TRI_MAX_STARS][GV_TRI_MAX_STARS];
+    for (int i = 0; i < n_tri; i++) {
+        for (int j = i + 1; j < n_tri; j++) {
+            d[i][j] = d[j][i] = gv_pair_angle_mdeg(v[i], v[j]);
+        }
+    }
+
+    // ---------------- FIND ONE UNIQUE TRIANGLE ----------------
+    int tri[3] = {-1, -1, -1};
+    int abc[3];
+    for (int i = 0; i < n_tri && tri[0] < 0; i++) {
+        for (int j = i + 1; j < n_tri && tri[0] < 0; j++) {
+            for (int k = j + 1; k < n_tri && tri[0] < 0; k++) {
+                gv_real dij = d[i][j], djk = d[j][k], dik = d[i][k];
+                if (dij < 0 || djk < 0 || dik < 0) {
+                    continue;
+                }
+
+                // label by side: p-q longest, then q-r the longer of the rest
+                int p = i, q = j, r = k;
+                gv_real lp = dij;
+                if (djk > lp) { p = j; q = k; r = i; lp = djk; }
+                if (dik > lp) { p = i; q = k; r = j; lp = dik; }
+                if (d[p][r] > d[q][r]) {
+                    int t = p; p = q; q = t;
+                }
+                if (lp > TRI_MAX_SIDE_MDEG + loc_err) {
+                    continue;
+                }
+
+                gv_real sides[3] = {d[p][q], d[q][r], d[r][p]};
+                if (match_triangle(cat, v, p, q, r, sides, loc_err, abc) == 1) {
+                    tri[0] = p;
+                    tri[1] = q;
+                    tri[2] = r;
+                }
+            }
+        }
+    }
+    if (tri[0] < 0) {
+        return 0;
+    }
+    for (int m = 0; m < 3; m++) {
+        id[tri[m]] = abc[m];
+    }
+
+    // ---------------- EXTEND TO THE REST ----------------
+    // each other centroid is the one catalog star matching its angles
+    // to all three triangle stars
+    int n_id = 3;
+    for (int s = 0; s < n_stars; s++) {
+        if (id[s] != GV_ID_NONE) {
+            continue;
+        }
+        gv_cos_band to[3];
+        int ok = 1;
+        for (int m = 0; m < 3 && ok; m++) {
+            gv_real angle = gv_pair_angle_mdeg(v[s], v[tri[m]]);
+            ok = (angle >= 0);
+            to[m] = gv_band_mdeg(angle, loc_err);
+        }
+        if (!ok) {
+            continue;
+        }
+
+        int found = GV_ID_NONE, hits = 0;
+        for (int x = 0; x < CATALOG_SIZE && hits < 2; x++) {
+            if (x == abc[0] || x == abc[1] || x == abc[2]) {
+                continue;
+            }
+            if (gv_in_band(gv_dot3(&cat[x][1], &cat[abc[0]][1]), to[0]) &&
+                gv_in_band(gv_dot3(&cat[x][1], &cat[abc[1]][1]), to[1]) &&
+                gv_in_band(gv_dot3(&cat[x][1], &cat[abc[2]][1]), to[2])) {
+                found = x;
+                hits++;
+            }
+        }
+        if (hits == 1) {
+            id[s] = found;
+            n_id++;
+        }
+    }
+
+    // ---------------- VERIFY ----------------
+    gv_verify_vectors(cat, v, n_stars, loc_err, id, v2);
+    return n_id;
+}
@@ -6,14 +6,21 @@
 #include "LPUART.h"
 #include "delay.h"
 #include "gvalg.h"
-#include "tab_cat.h"
+#include "gvatt.h"
+#include "gvpairs.h"
 #include "catalog_xyz.h"
 #include "catalog_luts.h"
 #include "catalog_bytestream.h"
 
+// solver scratch: sized once for the largest frame, reused by every solve
+#define GV_MAX_STARS 16
+// vote pool shared by the whole frame (1 byte each): gvbench --max-stars 16
+// peaks at about 11k votes on its densest frames, so 16 KB leaves margin
+#define GV_MAX_VOTES 16384
+static uint8_t gv_arena[GV_WORKSPACE_BYTES(GV_MAX_STARS, GV_MAX_VOTES)];
+static gv_workspace gv_ws;
+
 void SystemClock_Config(void);
-double **allocate_matrix(int rows, int cols);
-void free_matrix(double **mat, int rows);
 
 int main(void) {
 	 HAL_Init();
@@ -27,64 +34,75 @@ int main(void) {
     LPUART_Send_ESC_Seq("H");
     // >> -----------
     LPUART_Print("Starting GValg... ...\r\n");
+    if (gv_workspace_init(&gv_ws, gv_arena, sizeof(gv_arena), GV_MAX_STARS, GV_MAX_VOTES) != 0) {
+        LPUART_Print("GValg workspace too small!\r\n");
+        return 1;
+    }
 	// ------------- SAMPLE STARFIELD IMAGE: -------------
-	// HIP IDs used: 1, 6, 8, 13, 16
+	// HIP IDs used: 1, 6, 8, 13
 	#define n_stars_img 4
-	// We would take in a list of centroids, calculate their body-frame
-	// unit vector, and then create this image_centrodis[] list
-	// double image_centroids[n_stars_img][3] = {
-	//	{0.51237873, 0.02050796, 0.85851468},  // CENT 0 (HIP 1 = 746)
-	//	{0.54280261, 0.09694802, 0.83424601},  // CENT 1 (HIP 6 = 3179)
-	//	{0.47423032, 0.11979696, 0.87221230},  // CENT 2 (HIP 8 = 4427)
-	//	{0.38942390, 0.21230918, 0.89625545},  // CENT 3 (HIP 13 = 8886)
-	// };
+	// Body-frame unit vectors of the centroids (identity attitude, so
+	// they are the catalog vectors); gv_centroids_to_vectors() makes
+	// these from pixel centroids
+	static const gv_real image_vectors[n_stars_img][3] = {
+		{0.51237873, 0.02050796, 0.85851468},  // CENT 0 (HIP 1 = 746)
+		{0.54280261, 0.09694802, 0.83424601},  // CENT 1 (HIP 6 = 3179)
+		{0.47423032, 0.11979696, 0.87221230},  // CENT 2 (HIP 8 = 4427)
+		{0.38942390, 0.21230918, 0.89625545},  // CENT 3 (HIP 13 = 8886)
+	};
 	// Image pair angle table [indexA, indexB, angle_millideg]
-	#define n_image 6
-	double **tab_image = allocate_matrix(n_image, 3);
-
-	tab_image[0][0] = 0; tab_image[0][1] = 1; tab_image[0][2] = 4916;   // 1 and 6
-	tab_image[1][0] = 0; tab_image[1][1] = 2; tab_image[1][2] = 6147;   // 1 and 8
-	tab_image[2][0] = 0; tab_image[2][1] = 3; tab_image[2][2] = 13261;  // 1 and 13
-	tab_image[3][0] = 1; tab_image[3][1] = 2; tab_image[3][2] = 4679;   // 6 and 8
-	tab_image[4][0] = 1; tab_image[4][1] = 3; tab_image[4][2] = 11575;  // 6 and 13
-	tab_image[5][0] = 2; tab_image[5][1] = 3; tab_image[5][2] = 7326;   // 8 and 13
+	static gv_real tab_image[GV_MAX_PAIRS(n_stars_img)][3];
+	int n_image = gv_tabulate_pairs(image_vectors, n_stars_img, tab_image, GV_MAX_PAIRS(n_stars_img));
+	// pair angle tolerance (millidegrees): these sample vectors are exact;
+	// real centroids want roughly 2x their pair-angle noise
+	#define loc_err 10
 
-
-//	tab_image[0][0] = 0; tab_image[0][1] = 1; tab_image[0][2] = 4916; // 1 and 6
-//	// bin 49: 1,6 + 40,44 + 160,166 + 161,167
-//	tab_image[1][0] = 0; tab_image[1][1] = 2; tab_image[1][2] = 6147; // 1 and 8
-//	// bin 61: 1,8, 125,129 + 155,161 + 213,218...
-//	tab_image[2][0] = 0; tab_image[2][1] = 3; tab_image[2][2] = 13261; // 1 and 13
-//	// bin 132: 1,13 + 29,36 + 39,46...
-//	tab_image[3][0] = 1; tab_image[4][1] = 2; tab_image[4][2] = 4679; // 6 and 8
-//	// bin 46: 6,8 + 160,167 + 213,215 + 213,216
-//	tab_image[4][0] = 1; tab_image[5][1] = 3; tab_image[5][2] = 11575; // 6 and 13
-//	tab_image[5][0] = 2; tab_image[7][1] = 3; tab_image[7][2] = 7326; // 8 and 13
     LPUART_Print("Successfully Created Fake Starfield... ...\r\n");
 	// ---------------------------------------------------
 
     // Output buffers
     int id[n_stars_img];
-    double v2[n_stars_img];
-    for (int i = 0; i < n_stars_img; i++) {
-        v2[i] = 0;
-    }
+    gv_real v2[n_stars_img];
 
     // Call algorithm
-    gvalg(cat, tab_cat, tab_image, id, v2, n_image, n_stars_img);
+    if (gvalg(&gv_ws, cat, tab_image, loc_err, id, v2, n_image, n_stars_img) != 0) {
+        char buffer[128];
+        // too many centroids, or more votes than the pool holds
+        sprintf(buffer, "GValg rejected the frame: %d stars, %ld votes (limits %d, %d)\r\n",
+                n_stars_img, gv_ws.votes_cast, GV_MAX_STARS, GV_MAX_VOTES);
+        LPUART_Print(buffer);
+        return 1;
+    }
     LPUART_Print("Successfully Ran GValg... ...\r\n\r\n");
 
     // Print output
     LPUART_Print(":: STAR MATCHES ::\r\n");
     for (int i = 0; i < n_stars_img; i++) {
         char buffer[128];
-        int v2_rounded = (int)(v2[i] + 0.5);  // manual round instead of %.0f
-        sprintf(buffer, "Image Star %d → Catalog HIP ID %d, verified %d times\r\n", i, id[i], v2_rounded);
+        int v2_rounded = (int)(v2[i] + 0.5f);  // manual round instead of %.0f
+        if (id[i] == GV_ID_NONE) {
+            sprintf(buffer, "Image Star %d → unidentified\r\n", i);
+        } else {
+            // catalog index -> HIP ID, only here at output time
+            sprintf(buffer, "Image Star %d → Catalog #%d (HIP %lu), margin %d, verified %d times\r\n",
+                    i, id[i], (unsigned long)index_to_hip_ID_lut[id[i]], gv_ws.margin[i], v2_rounded);
+        }
         LPUART_Print(buffer);
     	}
 
-    // Cleanup
-    free_matrix(tab_image, n_image);
+    // Attitude from the verified matches
+    gv_real q[4], residual;
+    LPUART_Print("\r\n:: ATTITUDE ::\r\n");
+    if (gv_attitude(cat, image_vectors, n_stars_img, id, v2, q, &residual) < 0) {
+        LPUART_Print("not enough verified stars\r\n");
+    } else {
+        char buffer[128];
+        // micro-units and whole mdeg, as printf has no floats here
+        sprintf(buffer, "q = (%ld, %ld, %ld, %ld) e-6 {x, y, z, w}, residual %d mdeg\r\n",
+                (long)(q[0] * 1e6f), (long)(q[1] * 1e6f), (long)(q[2] * 1e6f), (long)(q[3] * 1e6f),
+                (int)(residual + 0.5f));
+        LPUART_Print(buffer);
+    }
 
     // Blink LED if Done
     for (int i = 0; i < 100; i++){
@@ -120,20 +138,3 @@ void SystemClock_Config(void)
 	 RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;
 	 RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
 }
-
-// ------------- HELPER FUNCTIONS: -------------
-// ---- allocate_matrix() ----
-double **allocate_matrix(int rows, int cols) {
-    double **mat = (double **)malloc(rows * sizeof(double *));
-    for (int i = 0; i < rows; i++) {
-        mat[i] = (double *)calloc(cols, sizeof(double));
-    }
-    return mat;
-}
-// ---- free_matrix() ----
-void free_matrix(double **mat, int rows) {
-    for (int i = 0; i < rows; i++) {
-        free(mat[i]);
-    }
-    free(mat);
-}
@@ -0,0 +1,1913 @@
+// AUTO-GENERATED NEIGHBOUR ADJACENCY
+#include "catalog_adjacency.h"
+
+const uint16_t adj_start[CATALOG_SIZE + 1] = {
+    0, 27, 65, 86, 132, 150, 178, 214, 230, 265, 282, 312, 
+    346, 366, 404, 435, 462, 497, 529, 563, 599, 624, 660, 694, 
+    730, 765, 801, 838, 886, 930, 975, 1016, 1049, 1088, 1130, 1177, 
+    1225, 1269, 1313, 1356, 1400, 1444, 1490, 1535, 1575, 1621, 1669, 1713, 
+    1760, 1810, 1855, 1904, 1949, 1997, 2042, 2089, 2136, 2182, 2230, 2281, 
+    2322, 2364, 2410, 2457, 2507, 2553, 2600, 2647, 2697, 2740, 2789, 2840, 
+    2890, 2938, 2990, 3039, 3086, 3135, 3186, 3234, 3280, 3318, 3363, 3400, 
+    3449, 3497, 3544, 3592, 3642, 3677, 3728, 3758, 3788, 3824, 3872, 3921, 
+    3973, 4004, 4057, 4088, 4143, 4172, 4199, 4250, 4276, 4329, 4385, 4412, 
+    4436, 4492, 4547, 4603, 4638, 4667, 4694, 4722, 4755, 4786, 4842, 4875, 
+    4904, 4958, 5002, 5060, 5091, 5127, 5185, 5222, 5280, 5323, 5380, 5437, 
+    5462, 5519, 5576, 5609, 5637, 5670, 5700, 5747, 5808, 5839, 5880, 5913, 
+    5980, 6013, 6045, 6110, 6178, 6241, 6309, 6343, 6375, 6445, 6514, 6583, 
+    6653, 6719, 6753, 6787, 6842, 6912, 6983, 7050, 7106, 7172, 7206, 7274, 
+    7345, 7377, 7410, 7477, 7512, 7582, 7648, 7712, 7775, 7831, 7887, 7951, 
+    7984, 8048, 8081, 8144, 8202, 8239, 8306, 8368, 8433, 8478, 8545, 8582, 
+    8639, 8704, 8742, 8776, 8813, 8873, 8940, 9005, 9040, 9100, 9163, 9223, 
+    9266, 9329, 9388, 9437, 9497, 9557, 9591, 9642, 9699, 9758, 9814, 9863, 
+    9921, 9976, 10009, 10064, 10115, 10148, 10201, 10239, 10289, 10340, 10372, 10411, 
+    10445, 10479, 10512, 10545, 10577, 10615, 10647, 10692, 10734, 10768, 10797, 10826, 
+    10859, 10890, 10917, 10941, 10965, 10992, 11011, 11039, 11073, 11102, 11122, 11151, 
+    11169, 11187, 11214, 11238, 11274
+};
+
+const uint8_t adj_nbr[N_ADJ] = {
+    1, 2, 5, 6, 8, 10, 11, 13, 14, 16, 17, 18, 
+    22, 23, 24, 25, 26, 236, 237, 238, 239, 242, 245, 247, 
+    250, 253, 254, 0, 2, 5, 6, 8, 10, 11, 13, 14, 
+    16, 17, 18, 19, 22, 23, 24, 25, 26, 29, 30, 37, 
+    43, 158, 165, 190, 225, 228, 233, 236, 237, 238, 239, 240, 
+    247, 250, 253, 254, 255, 0, 1, 5, 6, 7, 10, 14, 
+    16, 17, 18, 21, 23, 24, 238, 241, 242, 245, 250, 251, 
+    253, 254, 4, 9, 12, 15, 20, 27, 32, 33, 65, 71, 
+    72, 87, 89, 94, 95, 97, 99, 102, 104, 105, 108, 109, 
+    117, 122, 125, 127, 129, 132, 133, 147, 153, 154, 156, 164, 
+    172, 185, 189, 197, 198, 201, 234, 235, 244, 246, 248, 249, 
+    3, 7, 9, 12, 15, 20, 27, 32, 33, 234, 235, 243, 
+    244, 246, 248, 249, 251, 252, 0, 1, 2, 6, 8, 10, 
+    11, 13, 14, 16, 17, 18, 21, 22, 23, 24, 25, 26, 
+    28, 29, 30, 238, 239, 242, 247, 250, 253, 254, 0, 1, 
+    2, 5, 8, 10, 11, 13, 14, 16, 17, 18, 19, 22, 
+    23, 24, 25, 26, 29, 30, 37, 39, 43, 225, 228, 233, 
+    236, 237, 238, 239, 240, 247, 250, 253, 254, 255, 2, 4, 
+    9, 12, 14, 15, 20, 21, 243, 244, 245, 246, 249, 251, 
+    252, 254, 0, 1, 5, 6, 10, 11, 13, 14, 16, 17, 
+    18, 19, 22, 23, 24, 25, 26, 29, 30, 37, 39, 43, 
+    59, 158, 165, 190, 225, 233, 236, 239, 240, 247, 250, 253, 
+    255, 3, 4, 7, 12, 15, 20, 27, 32, 33, 234, 235, 
+    244, 246, 248, 249, 251, 252, 0, 1, 2, 5, 6, 8, 
+    11, 13, 14, 16, 17, 18, 21, 22, 23, 24, 25, 26, 
+    28, 29, 30, 37, 39, 239, 240, 247, 250, 253, 254, 255, 
+    0, 1, 5, 6, 8, 10, 13, 14, 16, 17, 18, 19, 
+    22, 23, 24, 25, 26, 28, 29, 30, 36, 37, 39, 43, 
+    59, 158, 225, 236, 239, 240, 247, 250, 253, 255, 3, 4, 
+    7, 9, 15, 20, 27, 32, 33, 65, 71, 72, 94, 234, 
+    235, 244, 246, 248, 249, 252, 0, 1, 5, 6, 8, 10, 
+    11, 14, 16, 17, 18, 19, 22, 23, 24, 25, 26, 28, 
+    29, 30, 36, 37, 39, 43, 59, 60, 88, 158, 165, 190, 
+    225, 236, 239, 240, 247, 250, 253, 255, 0, 1, 2, 5, 
+    6, 7, 8, 10, 11, 13, 16, 17, 18, 21, 22, 23, 
+    24, 25, 26, 28, 29, 30, 31, 34, 35, 36, 37, 39, 
+    250, 253, 254, 3, 4, 7, 9, 12, 20, 27, 32, 33, 
+    54, 57, 65, 67, 71, 72, 87, 94, 102, 104, 185, 234, 
+    235, 244, 246, 248, 249, 252, 0, 1, 2, 5, 6, 8, 
+    10, 11, 13, 14, 17, 18, 21, 22, 23, 24, 25, 26, 
+    28, 29, 30, 34, 36, 37, 39, 43, 46, 59, 60, 239, 
+    240, 247, 250, 253, 255, 0, 1, 2, 5, 6, 8, 10, 
+    11, 13, 14, 16, 18, 21, 22, 23, 24, 25, 26, 28, 
+    29, 30, 31, 34, 35, 36, 37, 39, 43, 46, 250, 253, 
+    254, 0, 1, 2, 5, 6, 8, 10, 11, 13, 14, 16, 
+    17, 21, 22, 23, 24, 25, 26, 28, 29, 30, 34, 36, 
+    37, 39, 43, 46, 59, 60, 247, 250, 253, 254, 255, 1, 
+    6, 8, 11, 13, 22, 25, 26, 37, 43, 59, 88, 92, 
+    100, 112, 113, 114, 119, 123, 134, 140, 144, 158, 165, 168, 
+    179, 190, 199, 209, 225, 228, 236, 239, 240, 247, 255, 3, 
+    4, 7, 9, 12, 15, 21, 27, 31, 32, 33, 38, 40, 
+    41, 42, 47, 49, 54, 57, 62, 65, 67, 71, 72, 249, 
+    2, 5, 7, 10, 14, 16, 17, 18, 20, 23, 24, 26, 
+    28, 29, 30, 31, 34, 35, 36, 38, 40, 41, 42, 44, 
+    45, 46, 47, 48, 49, 50, 51, 52, 53, 55, 56, 58, 
+    0, 1, 5, 6, 8, 10, 11, 13, 14, 16, 17, 18, 
+    19, 23, 24, 25, 26, 28, 29, 30, 34, 36, 37, 39, 
+    43, 46, 53, 59, 60, 88, 239, 240, 247, 255, 0, 1, 
+    2, 5, 6, 8, 10, 11, 13, 14, 16, 17, 18, 21, 
+    22, 24, 25, 26, 28, 29, 30, 34, 35, 36, 37, 39, 
+    43, 45, 46, 50, 53, 59, 60, 61, 64, 255, 0, 1, 
+    2, 5, 6, 8, 10, 11, 13, 14, 16, 17, 18, 21, 
+    22, 23, 25, 26, 28, 29, 30, 34, 35, 36, 37, 39, 
+    43, 46, 50, 53, 59, 60, 61, 64, 255, 0, 1, 5, 
+    6, 8, 10, 11, 13, 14, 16, 17, 18, 19, 22, 23, 
+    24, 26, 28, 29, 30, 34, 36, 37, 39, 43, 46, 53, 
+    59, 60, 61, 64, 68, 88, 240, 247, 255, 0, 1, 5, 
+    6, 8, 10, 11, 13, 14, 16, 17, 18, 19, 21, 22, 
+    23, 24, 25, 28, 29, 30, 34, 35, 36, 37, 39, 43, 
+    46, 50, 53, 59, 60, 61, 64, 68, 88, 255, 3, 4, 
+    9, 12, 15, 20, 32, 33, 54, 57, 65, 67, 71, 72, 
+    76, 79, 84, 86, 87, 89, 93, 94, 95, 97, 99, 102, 
+    104, 105, 108, 109, 117, 122, 125, 127, 129, 132, 133, 147, 
+    153, 154, 156, 164, 172, 185, 234, 246, 248, 249, 5, 10, 
+    11, 13, 14, 16, 17, 18, 21, 22, 23, 24, 25, 26, 
+    29, 30, 31, 34, 35, 36, 37, 39, 40, 41, 42, 43, 
+    44, 45, 46, 48, 50, 51, 52, 53, 55, 56, 58, 59, 
+    60, 61, 64, 66, 68, 70, 1, 5, 6, 8, 10, 11, 
+    13, 14, 16, 17, 18, 21, 22, 23, 24, 25, 26, 28, 
+    30, 31, 34, 35, 36, 37, 39, 40, 42, 43, 44, 45, 
+    46, 48, 50, 51, 52, 53, 55, 58, 59, 60, 61, 64, 
+    66, 68, 70, 1, 5, 6, 8, 10, 11, 13, 14, 16, 
+    17, 18, 21, 22, 23, 24, 25, 26, 28, 29, 34, 35, 
+    36, 37, 39, 43, 45, 46, 48, 50, 53, 58, 59, 60, 
+    61, 64, 66, 68, 70, 80, 88, 255, 14, 17, 20, 21, 
+    28, 29, 33, 34, 35, 38, 40, 41, 42, 44, 45, 47, 
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 62, 
+    63, 67, 69, 73, 74, 3, 4, 9, 12, 15, 20, 27, 
+    33, 38, 47, 54, 57, 62, 65, 67, 71, 72, 73, 76, 
+    77, 79, 84, 86, 87, 89, 93, 94, 95, 97, 99, 102, 
+    104, 105, 108, 109, 117, 129, 132, 248, 3, 4, 9, 12, 
+    15, 20, 27, 31, 32, 38, 41, 47, 49, 54, 57, 62, 
+    63, 65, 67, 69, 71, 72, 73, 74, 75, 76, 77, 79, 
+    84, 86, 87, 89, 93, 94, 95, 97, 99, 102, 104, 105, 
+    108, 109, 14, 16, 17, 18, 21, 22, 23, 24, 25, 26, 
+    28, 29, 30, 31, 35, 36, 37, 38, 39, 40, 41, 42, 
+    43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 55, 
+    56, 58, 59, 60, 61, 63, 64, 66, 68, 70, 78, 80, 
+    82, 14, 17, 21, 23, 24, 26, 28, 29, 30, 31, 34, 
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 
+    60, 61, 62, 63, 64, 66, 68, 69, 70, 74, 78, 80, 
+    81, 11, 13, 14, 16, 17, 18, 21, 22, 23, 24, 25, 
+    26, 28, 29, 30, 34, 35, 37, 39, 40, 42, 43, 44, 
+    45, 46, 48, 50, 51, 52, 53, 55, 56, 58, 59, 60, 
+    61, 64, 66, 68, 70, 78, 80, 82, 88, 1, 6, 8, 
+    10, 11, 13, 14, 16, 17, 18, 19, 22, 23, 24, 25, 
+    26, 28, 29, 30, 34, 35, 36, 39, 43, 45, 46, 48, 
+    50, 52, 53, 58, 59, 60, 61, 64, 66, 68, 70, 80, 
+    82, 88, 92, 100, 255, 20, 21, 31, 32, 33, 34, 35, 
+    40, 41, 42, 44, 45, 47, 48, 49, 50, 51, 52, 53, 
+    54, 55, 56, 57, 58, 62, 63, 65, 66, 67, 69, 70, 
+    71, 72, 73, 74, 75, 76, 77, 79, 83, 84, 85, 86, 
+    6, 8, 10, 11, 13, 14, 16, 17, 18, 22, 23, 24, 
+    25, 26, 28, 29, 30, 34, 35, 36, 37, 43, 44, 45, 
+    46, 48, 50, 52, 53, 55, 58, 59, 60, 61, 64, 66, 
+    68, 70, 78, 80, 82, 88, 92, 100, 20, 21, 28, 29, 
+    31, 34, 35, 36, 38, 41, 42, 44, 45, 46, 47, 48, 
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 60, 61, 
+    62, 63, 64, 66, 67, 68, 69, 70, 73, 74, 75, 76, 
+    77, 78, 81, 83, 20, 21, 28, 31, 33, 34, 35, 38, 
+    40, 42, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 
+    54, 55, 56, 57, 58, 61, 62, 63, 64, 65, 66, 67, 
+    69, 70, 72, 73, 74, 75, 76, 77, 78, 79, 81, 83, 
+    84, 85, 20, 21, 28, 29, 31, 34, 35, 36, 38, 40, 
+    41, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 
+    55, 56, 57, 58, 61, 62, 63, 64, 66, 67, 68, 69, 
+    70, 73, 74, 75, 76, 77, 78, 79, 81, 83, 85, 1, 
+    6, 8, 11, 13, 16, 17, 18, 19, 22, 23, 24, 25, 
+    26, 28, 29, 30, 34, 35, 36, 37, 39, 45, 46, 50, 
+    53, 58, 59, 60, 61, 64, 66, 68, 70, 80, 82, 88, 
+    92, 100, 255, 21, 28, 29, 31, 34, 35, 36, 38, 39, 
+    40, 41, 42, 45, 46, 47, 48, 49, 50, 51, 52, 53, 
+    54, 55, 56, 57, 58, 60, 61, 62, 63, 64, 66, 67, 
+    68, 69, 70, 73, 74, 75, 76, 77, 78, 81, 82, 83, 
+    85, 21, 23, 28, 29, 30, 31, 34, 35, 36, 37, 38, 
+    39, 40, 41, 42, 43, 44, 46, 47, 48, 49, 50, 51, 
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 
+    64, 66, 68, 69, 70, 73, 74, 75, 77, 78, 80, 81, 
+    82, 16, 17, 18, 21, 22, 23, 24, 25, 26, 28, 29, 
+    30, 34, 35, 36, 37, 39, 40, 41, 42, 43, 44, 45, 
+    48, 50, 51, 52, 53, 55, 56, 58, 59, 60, 61, 64, 
+    66, 68, 70, 78, 80, 81, 82, 88, 92, 20, 21, 31, 
+    32, 33, 34, 35, 38, 40, 41, 42, 44, 45, 48, 49, 
+    50, 51, 52, 53, 54, 55, 56, 57, 58, 61, 62, 63, 
+    64, 65, 66, 67, 69, 70, 71, 72, 73, 74, 75, 76, 
+    77, 78, 79, 81, 83, 84, 85, 86, 21, 28, 29, 30, 
+    31, 34, 35, 36, 37, 38, 39, 40, 41, 42, 44, 45, 
+    46, 47, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 
+    59, 60, 61, 62, 63, 64, 66, 67, 68, 69, 70, 73, 
+    74, 75, 76, 77, 78, 80, 81, 82, 83, 85, 20, 21, 
+    31, 33, 34, 35, 38, 40, 41, 42, 44, 45, 47, 48, 
+    50, 51, 52, 53, 54, 55, 56, 57, 58, 61, 62, 63, 
+    64, 65, 66, 67, 69, 70, 72, 73, 74, 75, 76, 77, 
+    78, 79, 81, 83, 84, 85, 86, 21, 23, 24, 26, 28, 
+    29, 30, 31, 34, 35, 36, 37, 38, 39, 40, 41, 42, 
+    43, 44, 45, 46, 47, 48, 49, 51, 52, 53, 54, 55, 
+    56, 57, 58, 59, 60, 61, 62, 63, 64, 66, 68, 69, 
+    70, 73, 74, 75, 78, 80, 81, 82, 21, 28, 29, 31, 
+    34, 35, 36, 38, 40, 41, 42, 44, 45, 46, 47, 48, 
+    49, 50, 52, 53, 54, 55, 56, 57, 58, 60, 61, 62, 
+    63, 64, 66, 67, 68, 69, 70, 73, 74, 75, 76, 77, 
+    78, 79, 81, 83, 85, 21, 28, 29, 31, 34, 35, 36, 
+    37, 38, 39, 40, 41, 42, 44, 45, 46, 47, 48, 49, 
+    50, 51, 53, 54, 55, 56, 57, 58, 60, 61, 62, 63, 
+    64, 66, 67, 68, 69, 70, 73, 74, 75, 76, 77, 78, 
+    80, 81, 82, 83, 85, 21, 22, 23, 24, 25, 26, 28, 
+    29, 30, 31, 34, 35, 36, 37, 38, 39, 40, 41, 42, 
+    43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 55, 56, 
+    58, 59, 60, 61, 63, 64, 66, 68, 69, 70, 78, 80, 
+    81, 82, 15, 20, 27, 31, 32, 33, 35, 38, 40, 41, 
+    42, 44, 45, 47, 48, 49, 50, 51, 52, 55, 56, 57, 
+    58, 62, 63, 65, 67, 69, 71, 72, 73, 74, 75, 76, 
+    77, 79, 83, 84, 85, 86, 87, 89, 93, 94, 95, 97, 
+    99, 21, 28, 29, 31, 34, 35, 36, 38, 39, 40, 41, 
+    42, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 
+    56, 57, 58, 60, 61, 62, 63, 64, 66, 67, 68, 69, 
+    70, 73, 74, 75, 76, 77, 78, 80, 81, 82, 83, 85, 
+    21, 28, 31, 34, 35, 36, 38, 40, 41, 42, 44, 45, 
+    46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 57, 58, 
+    61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 72, 73, 
+    74, 75, 76, 77, 78, 79, 81, 83, 84, 85, 15, 20, 
+    27, 31, 32, 33, 35, 38, 40, 41, 42, 44, 45, 47, 
+    48, 49, 50, 51, 52, 54, 55, 56, 58, 62, 63, 65, 
+    67, 69, 71, 72, 73, 74, 75, 76, 77, 79, 83, 84, 
+    85, 86, 87, 89, 93, 94, 95, 97, 99, 102, 21, 28, 
+    29, 30, 31, 34, 35, 36, 37, 38, 39, 40, 41, 42, 
+    43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 
+    55, 56, 57, 59, 60, 61, 62, 63, 64, 66, 68, 69, 
+    70, 73, 74, 75, 77, 78, 80, 81, 82, 83, 85, 90, 
+    91, 8, 11, 13, 16, 18, 19, 22, 23, 24, 25, 26, 
+    28, 29, 30, 34, 35, 36, 37, 39, 43, 45, 46, 48, 
+    50, 53, 58, 60, 61, 64, 66, 68, 70, 78, 80, 81, 
+    82, 88, 92, 96, 100, 113, 13, 16, 18, 22, 23, 24, 
+    25, 26, 28, 29, 30, 34, 35, 36, 37, 39, 40, 43, 
+    44, 45, 46, 48, 50, 51, 52, 53, 55, 58, 59, 61, 
+    64, 66, 68, 70, 78, 80, 81, 82, 88, 92, 96, 100, 
+    23, 24, 25, 26, 28, 29, 30, 34, 35, 36, 37, 39, 
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 
+    52, 53, 55, 56, 58, 59, 60, 63, 64, 66, 68, 69, 
+    70, 78, 80, 81, 82, 88, 90, 91, 92, 96, 20, 31, 
+    32, 33, 35, 38, 40, 41, 42, 44, 45, 47, 48, 49, 
+    50, 51, 52, 54, 55, 56, 57, 58, 63, 65, 67, 69, 
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 81, 83, 
+    84, 85, 86, 87, 89, 93, 95, 97, 99, 31, 33, 34, 
+    35, 38, 40, 41, 42, 44, 45, 47, 48, 49, 50, 51, 
+    52, 53, 54, 55, 56, 57, 58, 61, 62, 64, 65, 66, 
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 
+    79, 81, 83, 84, 85, 86, 89, 90, 91, 93, 98, 23, 
+    24, 25, 26, 28, 29, 30, 34, 35, 36, 37, 39, 40, 
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 
+    53, 55, 56, 58, 59, 60, 61, 63, 66, 68, 69, 70, 
+    78, 80, 81, 82, 88, 90, 91, 92, 96, 3, 12, 15, 
+    20, 27, 32, 33, 38, 41, 47, 49, 54, 56, 57, 62, 
+    63, 67, 69, 71, 72, 73, 74, 75, 76, 77, 79, 83, 
+    84, 85, 86, 87, 89, 93, 94, 95, 97, 99, 102, 104, 
+    105, 108, 109, 110, 117, 125, 129, 132, 28, 29, 30, 34, 
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 
+    47, 48, 49, 50, 51, 52, 53, 55, 56, 58, 59, 60, 
+    61, 63, 64, 68, 69, 70, 73, 74, 75, 78, 80, 81, 
+    82, 83, 90, 91, 92, 96, 101, 15, 20, 27, 31, 32, 
+    33, 38, 40, 41, 42, 44, 47, 48, 49, 51, 52, 54, 
+    55, 56, 57, 62, 63, 65, 69, 71, 72, 73, 74, 75, 
+    76, 77, 79, 83, 84, 85, 86, 87, 89, 93, 94, 95, 
+    97, 99, 102, 104, 105, 108, 109, 110, 117, 25, 26, 28, 
+    29, 30, 34, 35, 36, 37, 39, 40, 42, 43, 44, 45, 
+    46, 48, 50, 51, 52, 53, 55, 56, 58, 59, 60, 61, 
+    63, 64, 66, 69, 70, 78, 80, 81, 82, 88, 90, 91, 
+    92, 96, 100, 101, 31, 33, 35, 38, 40, 41, 42, 44, 
+    45, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 
+    58, 61, 62, 63, 64, 65, 66, 67, 68, 70, 71, 72, 
+    73, 74, 75, 76, 77, 78, 79, 81, 83, 84, 85, 86, 
+    89, 90, 91, 93, 98, 28, 29, 30, 34, 35, 36, 37, 
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 
+    50, 51, 52, 53, 55, 56, 58, 59, 60, 61, 62, 63, 
+    64, 66, 68, 69, 73, 74, 75, 77, 78, 80, 81, 82, 
+    83, 85, 90, 91, 92, 96, 98, 101, 3, 12, 15, 20, 
+    27, 32, 33, 38, 47, 54, 57, 62, 63, 65, 67, 69, 
+    72, 73, 74, 75, 76, 77, 79, 83, 84, 85, 86, 87, 
+    89, 93, 94, 95, 97, 99, 102, 104, 105, 108, 109, 110, 
+    117, 120, 122, 125, 127, 129, 132, 133, 156, 164, 3, 12, 
+    15, 20, 27, 32, 33, 38, 41, 47, 49, 54, 56, 57, 
+    62, 63, 65, 67, 69, 71, 73, 74, 75, 76, 77, 79, 
+    83, 84, 85, 86, 87, 89, 93, 94, 95, 97, 99, 102, 
+    104, 105, 108, 109, 110, 117, 122, 125, 129, 132, 31, 32, 
+    33, 38, 40, 41, 42, 44, 45, 47, 48, 49, 50, 51, 
+    52, 54, 55, 56, 57, 58, 62, 63, 65, 66, 67, 69, 
+    70, 71, 72, 74, 75, 76, 77, 78, 79, 81, 83, 84, 
+    85, 86, 87, 89, 90, 91, 93, 94, 95, 97, 98, 99, 
+    102, 105, 31, 33, 35, 38, 40, 41, 42, 44, 45, 47, 
+    48, 49, 50, 51, 52, 54, 55, 56, 57, 58, 62, 63, 
+    65, 66, 67, 69, 70, 71, 72, 73, 75, 76, 77, 78, 
+    79, 81, 83, 84, 85, 86, 87, 89, 90, 91, 93, 95, 
+    97, 98, 99, 33, 38, 40, 41, 42, 44, 45, 47, 48, 
+    49, 50, 51, 52, 54, 55, 56, 57, 58, 62, 63, 65, 
+    66, 67, 69, 70, 71, 72, 73, 74, 76, 77, 78, 79, 
+    81, 83, 84, 85, 86, 87, 89, 90, 91, 93, 95, 97, 
+    98, 99, 27, 32, 33, 38, 40, 41, 42, 44, 47, 48, 
+    49, 51, 52, 54, 55, 56, 57, 62, 63, 65, 67, 69, 
+    71, 72, 73, 74, 75, 77, 78, 79, 81, 83, 84, 85, 
+    86, 87, 89, 93, 94, 95, 97, 98, 99, 102, 104, 105, 
+    108, 109, 110, 32, 33, 38, 40, 41, 42, 44, 45, 47, 
+    48, 49, 51, 52, 54, 55, 56, 57, 58, 62, 63, 65, 
+    67, 69, 70, 71, 72, 73, 74, 75, 76, 78, 79, 81, 
+    83, 84, 85, 86, 87, 89, 90, 91, 93, 94, 95, 97, 
+    98, 99, 102, 105, 108, 110, 34, 35, 36, 39, 40, 41, 
+    42, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 55, 
+    56, 58, 59, 60, 61, 62, 63, 64, 66, 68, 69, 70, 
+    73, 74, 75, 76, 77, 80, 81, 82, 83, 85, 90, 91, 
+    92, 96, 98, 101, 103, 106, 27, 32, 33, 38, 41, 42, 
+    47, 49, 51, 54, 56, 57, 62, 63, 65, 67, 69, 71, 
+    72, 73, 74, 75, 76, 77, 83, 84, 85, 86, 87, 89, 
+    93, 94, 95, 97, 98, 99, 102, 104, 105, 108, 109, 110, 
+    117, 122, 125, 129, 30, 34, 35, 36, 37, 39, 43, 45, 
+    46, 48, 50, 52, 53, 55, 58, 59, 60, 61, 64, 66, 
+    68, 70, 78, 81, 82, 88, 90, 91, 92, 96, 100, 101, 
+    103, 106, 107, 112, 113, 114, 35, 40, 41, 42, 44, 45, 
+    46, 47, 48, 49, 50, 51, 52, 53, 55, 56, 58, 59, 
+    60, 61, 62, 63, 64, 66, 68, 69, 70, 73, 74, 75, 
+    76, 77, 78, 80, 82, 83, 84, 85, 90, 91, 96, 98, 
+    101, 103, 106, 34, 36, 37, 39, 43, 44, 45, 46, 48, 
+    50, 52, 53, 55, 58, 59, 60, 61, 64, 66, 68, 70, 
+    78, 80, 81, 88, 90, 91, 92, 96, 98, 100, 101, 103, 
+    106, 107, 112, 114, 38, 40, 41, 42, 44, 47, 48, 49, 
+    51, 52, 54, 55, 56, 57, 58, 62, 63, 65, 66, 67, 
+    69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 81, 
+    84, 85, 86, 87, 89, 90, 91, 93, 95, 97, 98, 99, 
+    102, 105, 108, 110, 111, 27, 32, 33, 38, 41, 47, 49, 
+    54, 56, 57, 62, 63, 65, 67, 69, 71, 72, 73, 74, 
+    75, 76, 77, 79, 81, 83, 85, 86, 87, 89, 93, 94, 
+    95, 97, 98, 99, 102, 104, 105, 108, 109, 110, 111, 117, 
+    120, 122, 125, 127, 129, 38, 41, 42, 44, 47, 48, 49, 
+    51, 52, 54, 55, 56, 57, 58, 62, 63, 65, 67, 69, 
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 81, 83, 
+    84, 86, 87, 89, 90, 91, 93, 95, 97, 98, 99, 102, 
+    105, 108, 110, 111, 27, 32, 33, 38, 47, 49, 54, 57, 
+    62, 63, 65, 67, 69, 71, 72, 73, 74, 75, 76, 77, 
+    79, 83, 84, 85, 87, 89, 93, 94, 95, 97, 98, 99, 
+    102, 104, 105, 108, 109, 110, 111, 117, 120, 122, 125, 127, 
+    129, 130, 132, 133, 3, 15, 27, 32, 33, 54, 57, 62, 
+    65, 67, 71, 72, 73, 74, 75, 76, 77, 79, 83, 84, 
+    85, 86, 89, 93, 94, 95, 97, 99, 102, 104, 105, 108, 
+    109, 110, 117, 120, 122, 125, 127, 129, 130, 132, 133, 143, 
+    147, 153, 154, 156, 164, 185, 13, 19, 22, 25, 26, 30, 
+    36, 37, 39, 43, 46, 59, 60, 61, 64, 68, 80, 82, 
+    92, 96, 100, 101, 106, 107, 112, 113, 114, 119, 123, 134, 
+    140, 144, 158, 165, 255, 3, 27, 32, 33, 54, 57, 62, 
+    63, 65, 67, 69, 71, 72, 73, 74, 75, 76, 77, 79, 
+    83, 84, 85, 86, 87, 93, 94, 95, 97, 99, 102, 104, 
+    105, 108, 109, 110, 111, 117, 120, 122, 125, 127, 129, 130, 
+    132, 133, 143, 147, 153, 154, 156, 164, 58, 61, 63, 64, 
+    66, 68, 69, 70, 73, 74, 75, 77, 78, 80, 81, 82, 
+    83, 85, 91, 92, 96, 98, 101, 103, 106, 107, 111, 115, 
+    116, 118, 58, 61, 63, 64, 66, 68, 69, 70, 73, 74, 
+    75, 77, 78, 80, 81, 82, 83, 85, 90, 92, 96, 98, 
+    101, 103, 106, 107, 111, 115, 116, 118, 19, 37, 39, 43, 
+    46, 59, 60, 61, 64, 66, 68, 70, 78, 80, 82, 88, 
+    90, 91, 96, 100, 101, 103, 106, 107, 112, 113, 114, 115, 
+    116, 119, 123, 134, 136, 140, 144, 158, 27, 32, 33, 54, 
+    57, 62, 63, 65, 67, 69, 71, 72, 73, 74, 75, 76, 
+    77, 79, 83, 84, 85, 86, 87, 89, 94, 95, 97, 98, 
+    99, 102, 104, 105, 108, 109, 110, 111, 117, 120, 121, 122, 
+    125, 127, 129, 130, 132, 133, 143, 147, 3, 12, 15, 27, 
+    32, 33, 54, 57, 65, 67, 71, 72, 73, 76, 77, 79, 
+    84, 86, 87, 89, 93, 95, 97, 99, 102, 104, 105, 108, 
+    109, 110, 117, 120, 122, 125, 127, 129, 130, 132, 133, 143, 
+    146, 147, 153, 154, 155, 156, 164, 172, 185, 3, 27, 32, 
+    33, 54, 57, 62, 65, 67, 71, 72, 73, 74, 75, 76, 
+    77, 79, 83, 84, 85, 86, 87, 89, 93, 94, 97, 99, 
+    102, 104, 105, 108, 109, 110, 117, 120, 122, 125, 127, 129, 
+    130, 132, 133, 139, 143, 146, 147, 153, 154, 156, 164, 172, 
+    185, 59, 60, 61, 64, 66, 68, 70, 78, 80, 81, 82, 
+    88, 90, 91, 92, 98, 100, 101, 103, 106, 107, 112, 113, 
+    114, 115, 116, 118, 119, 123, 134, 136, 3, 27, 32, 33, 
+    54, 57, 62, 65, 67, 71, 72, 73, 74, 75, 76, 77, 
+    79, 83, 84, 85, 86, 87, 89, 93, 94, 95, 99, 102, 
+    104, 105, 108, 109, 110, 111, 117, 120, 121, 122, 125, 127, 
+    129, 130, 132, 133, 139, 143, 146, 147, 153, 154, 156, 164, 
+    172, 63, 69, 70, 73, 74, 75, 76, 77, 78, 79, 81, 
+    82, 83, 84, 85, 86, 90, 91, 93, 96, 101, 103, 106, 
+    110, 111, 115, 116, 118, 121, 124, 126, 3, 27, 32, 33, 
+    54, 57, 62, 65, 67, 71, 72, 73, 74, 75, 76, 77, 
+    79, 83, 84, 85, 86, 87, 89, 93, 94, 95, 97, 102, 
+    104, 105, 108, 109, 110, 111, 117, 120, 121, 122, 125, 127, 
+    129, 130, 132, 133, 139, 143, 146, 147, 153, 154, 155, 156, 
+    164, 172, 185, 19, 37, 39, 43, 59, 60, 68, 80, 82, 
+    88, 92, 96, 101, 103, 106, 107, 112, 113, 114, 115, 116, 
+    119, 123, 134, 136, 140, 144, 158, 165, 66, 68, 70, 78, 
+    80, 81, 82, 88, 90, 91, 92, 96, 98, 100, 103, 106, 
+    107, 111, 112, 113, 114, 115, 116, 118, 119, 123, 136, 3, 
+    15, 27, 32, 33, 57, 65, 67, 71, 72, 73, 76, 77, 
+    79, 83, 84, 85, 86, 87, 89, 93, 94, 95, 97, 99, 
+    104, 105, 108, 109, 110, 117, 120, 122, 125, 127, 129, 130, 
+    132, 133, 139, 143, 146, 147, 152, 153, 154, 155, 156, 164, 
+    172, 185, 78, 80, 81, 82, 90, 91, 92, 96, 98, 100, 
+    101, 106, 107, 111, 112, 114, 115, 116, 118, 121, 124, 126, 
+    131, 135, 136, 137, 3, 15, 27, 32, 33, 65, 67, 71, 
+    72, 76, 79, 84, 86, 87, 89, 93, 94, 95, 97, 99, 
+    102, 105, 108, 109, 110, 117, 120, 122, 125, 127, 129, 130, 
+    132, 133, 139, 143, 146, 147, 149, 152, 153, 154, 155, 156, 
+    160, 161, 164, 167, 172, 185, 189, 197, 198, 3, 27, 32, 
+    33, 65, 67, 71, 72, 73, 76, 77, 79, 83, 84, 85, 
+    86, 87, 89, 93, 94, 95, 97, 99, 102, 104, 108, 109, 
+    110, 111, 117, 120, 121, 122, 125, 127, 128, 129, 130, 132, 
+    133, 139, 143, 146, 147, 149, 152, 153, 154, 155, 156, 160, 
+    161, 164, 167, 172, 185, 78, 80, 81, 82, 88, 90, 91, 
+    92, 96, 98, 100, 101, 103, 107, 111, 112, 113, 114, 115, 
+    116, 118, 119, 123, 131, 135, 136, 137, 80, 82, 88, 90, 
+    91, 92, 96, 100, 101, 103, 106, 112, 113, 114, 115, 116, 
+    118, 119, 123, 134, 136, 140, 144, 158, 3, 27, 32, 33, 
+    65, 67, 71, 72, 76, 77, 79, 83, 84, 85, 86, 87, 
+    89, 93, 94, 95, 97, 99, 102, 104, 105, 109, 110, 111, 
+    117, 120, 121, 122, 125, 127, 128, 129, 130, 132, 133, 139, 
+    143, 146, 147, 149, 152, 153, 154, 155, 156, 160, 161, 164, 
+    167, 172, 185, 189, 3, 27, 32, 33, 65, 67, 71, 72, 
+    76, 79, 84, 86, 87, 89, 93, 94, 95, 97, 99, 102, 
+    104, 105, 108, 110, 117, 120, 121, 122, 125, 127, 128, 129, 
+    130, 132, 133, 139, 143, 146, 147, 149, 152, 153, 154, 155, 
+    156, 160, 161, 164, 166, 167, 172, 185, 189, 197, 198, 65, 
+    67, 71, 72, 76, 77, 79, 83, 84, 85, 86, 87, 89, 
+    93, 94, 95, 97, 98, 99, 102, 104, 105, 108, 109, 111, 
+    117, 120, 121, 122, 124, 125, 126, 127, 128, 129, 130, 132, 
+    133, 138, 139, 143, 146, 147, 148, 149, 152, 153, 154, 155, 
+    156, 160, 161, 164, 167, 172, 185, 83, 84, 85, 86, 89, 
+    90, 91, 93, 97, 98, 99, 101, 103, 105, 106, 108, 110, 
+    115, 116, 118, 120, 121, 122, 124, 126, 127, 128, 130, 131, 
+    135, 137, 138, 139, 141, 142, 19, 80, 82, 88, 92, 96, 
+    100, 101, 103, 106, 107, 113, 114, 115, 116, 118, 119, 123, 
+    134, 136, 140, 144, 151, 158, 165, 168, 179, 190, 255, 19, 
+    59, 80, 88, 92, 96, 100, 101, 106, 107, 112, 114, 115, 
+    119, 123, 134, 136, 140, 144, 151, 158, 165, 168, 179, 190, 
+    225, 255, 19, 80, 82, 88, 92, 96, 100, 101, 103, 106, 
+    107, 112, 113, 115, 116, 118, 119, 123, 134, 136, 137, 140, 
+    144, 145, 151, 158, 165, 168, 90, 91, 92, 96, 98, 100, 
+    101, 103, 106, 107, 111, 112, 113, 114, 116, 118, 119, 121, 
+    123, 124, 126, 131, 134, 135, 136, 137, 140, 141, 142, 144, 
+    145, 150, 151, 90, 91, 92, 96, 98, 100, 101, 103, 106, 
+    107, 111, 112, 114, 115, 118, 119, 121, 123, 124, 126, 128, 
+    131, 134, 135, 136, 137, 141, 142, 144, 145, 150, 3, 27, 
+    32, 65, 67, 71, 72, 79, 84, 86, 87, 89, 93, 94, 
+    95, 97, 99, 102, 104, 105, 108, 109, 110, 120, 121, 122, 
+    125, 127, 128, 129, 130, 132, 133, 138, 139, 143, 146, 147, 
+    148, 149, 152, 153, 154, 155, 156, 160, 161, 164, 166, 167, 
+    170, 172, 185, 189, 197, 198, 90, 91, 96, 98, 101, 103, 
+    106, 107, 111, 112, 114, 115, 116, 119, 121, 123, 124, 126, 
+    128, 131, 134, 135, 136, 137, 138, 140, 141, 142, 144, 145, 
+    150, 151, 157, 19, 88, 92, 96, 100, 101, 106, 107, 112, 
+    113, 114, 115, 116, 118, 123, 134, 136, 137, 140, 144, 145, 
+    150, 151, 157, 158, 165, 168, 179, 190, 71, 84, 86, 87, 
+    89, 93, 94, 95, 97, 99, 102, 104, 105, 108, 109, 110, 
+    111, 117, 121, 122, 124, 125, 126, 127, 128, 129, 130, 132, 
+    133, 138, 139, 141, 143, 146, 147, 148, 149, 152, 153, 154, 
+    155, 156, 160, 161, 162, 164, 166, 167, 170, 172, 185, 189, 
+    197, 198, 93, 97, 98, 99, 103, 105, 108, 109, 110, 111, 
+    115, 116, 117, 118, 120, 122, 124, 125, 126, 127, 128, 130, 
+    131, 132, 133, 135, 137, 138, 139, 141, 142, 143, 146, 147, 
+    148, 149, 152, 155, 159, 160, 161, 162, 166, 167, 3, 27, 
+    71, 72, 79, 84, 86, 87, 89, 93, 94, 95, 97, 99, 
+    102, 104, 105, 108, 109, 110, 111, 117, 120, 121, 124, 125, 
+    126, 127, 128, 129, 130, 132, 133, 138, 139, 143, 146, 147, 
+    148, 149, 152, 153, 154, 155, 156, 160, 161, 162, 164, 166, 
+    167, 170, 172, 185, 189, 197, 198, 201, 19, 88, 92, 96, 
+    100, 101, 106, 107, 112, 113, 114, 115, 116, 118, 119, 134, 
+    136, 140, 144, 145, 150, 151, 157, 158, 165, 168, 179, 190, 
+    199, 225, 255, 98, 103, 110, 111, 115, 116, 118, 120, 121, 
+    122, 125, 126, 127, 128, 130, 131, 133, 135, 137, 138, 139, 
+    141, 142, 143, 145, 146, 148, 149, 152, 155, 159, 160, 161, 
+    162, 163, 166, 3, 27, 65, 71, 72, 79, 84, 86, 87, 
+    89, 93, 94, 95, 97, 99, 102, 104, 105, 108, 109, 110, 
+    117, 120, 121, 122, 124, 127, 128, 129, 130, 132, 133, 138, 
+    139, 143, 146, 147, 148, 149, 152, 153, 154, 155, 156, 160, 
+    161, 162, 164, 166, 167, 170, 172, 185, 189, 192, 197, 198, 
+    201, 98, 103, 110, 111, 115, 116, 118, 120, 121, 122, 124, 
+    127, 128, 130, 131, 133, 135, 137, 138, 139, 141, 142, 143, 
+    145, 146, 148, 149, 150, 152, 155, 159, 160, 161, 162, 163, 
+    166, 167, 3, 27, 71, 84, 86, 87, 89, 93, 94, 95, 
+    97, 99, 102, 104, 105, 108, 109, 110, 111, 117, 120, 121, 
+    122, 124, 125, 126, 128, 129, 130, 132, 133, 138, 139, 143, 
+    146, 147, 148, 149, 152, 153, 154, 155, 156, 160, 161, 162, 
+    164, 166, 167, 170, 172, 185, 187, 189, 192, 197, 198, 201, 
+    105, 108, 109, 110, 111, 116, 117, 118, 120, 121, 122, 124, 
+    125, 126, 127, 129, 130, 131, 132, 133, 135, 137, 138, 139, 
+    141, 142, 143, 146, 147, 148, 149, 152, 153, 154, 155, 159, 
+    160, 161, 162, 163, 166, 167, 170, 3, 27, 32, 65, 71, 
+    72, 79, 84, 86, 87, 89, 93, 94, 95, 97, 99, 102, 
+    104, 105, 108, 109, 110, 117, 120, 122, 125, 127, 128, 130, 
+    132, 133, 139, 143, 146, 147, 148, 149, 152, 153, 154, 155, 
+    156, 160, 161, 164, 166, 167, 170, 172, 185, 187, 189, 192, 
+    197, 198, 201, 204, 86, 87, 89, 93, 94, 95, 97, 99, 
+    102, 104, 105, 108, 109, 110, 111, 117, 120, 121, 122, 124, 
+    125, 126, 127, 128, 129, 132, 133, 138, 139, 141, 143, 146, 
+    147, 148, 149, 152, 153, 154, 155, 156, 159, 160, 161, 162, 
+    164, 166, 167, 170, 172, 173, 185, 187, 189, 192, 197, 198, 
+    201, 103, 106, 111, 115, 116, 118, 121, 124, 126, 128, 135, 
+    136, 137, 138, 139, 141, 142, 145, 148, 149, 150, 157, 159, 
+    162, 163, 3, 27, 32, 65, 71, 72, 86, 87, 89, 93, 
+    94, 95, 97, 99, 102, 104, 105, 108, 109, 110, 117, 120, 
+    121, 122, 125, 127, 128, 129, 130, 133, 138, 139, 143, 146, 
+    147, 148, 149, 152, 153, 154, 155, 156, 160, 161, 164, 166, 
+    167, 170, 172, 185, 187, 189, 192, 197, 198, 201, 204, 3, 
+    27, 71, 86, 87, 89, 93, 94, 95, 97, 99, 102, 104, 
+    105, 108, 109, 110, 117, 120, 121, 122, 124, 125, 126, 127, 
+    128, 129, 130, 132, 138, 139, 143, 146, 147, 148, 149, 152, 
+    153, 154, 155, 156, 160, 161, 162, 164, 166, 167, 170, 172, 
+    185, 187, 189, 192, 197, 198, 201, 204, 19, 88, 92, 96, 
+    100, 107, 112, 113, 114, 115, 116, 118, 119, 123, 136, 137, 
+    140, 144, 145, 150, 151, 157, 158, 165, 168, 169, 179, 184, 
+    190, 199, 209, 225, 255, 103, 106, 111, 115, 116, 118, 121, 
+    124, 126, 128, 131, 136, 137, 138, 139, 141, 142, 145, 148, 
+    149, 150, 151, 157, 159, 162, 163, 169, 171, 92, 96, 100, 
+    101, 103, 106, 107, 112, 113, 114, 115, 116, 118, 119, 123, 
+    131, 134, 135, 137, 140, 142, 144, 145, 150, 151, 157, 158, 
+    165, 168, 169, 179, 184, 190, 103, 106, 111, 114, 115, 116, 
+    118, 119, 121, 124, 126, 128, 131, 134, 135, 136, 138, 140, 
+    141, 142, 144, 145, 148, 150, 151, 157, 159, 163, 169, 171, 
+    110, 111, 117, 118, 120, 121, 122, 124, 125, 126, 127, 128, 
+    130, 131, 132, 133, 135, 137, 139, 141, 142, 143, 145, 146, 
+    147, 148, 149, 150, 152, 153, 154, 155, 156, 159, 160, 161, 
+    162, 163, 166, 167, 170, 173, 174, 175, 178, 180, 182, 95, 
+    97, 99, 102, 104, 105, 108, 109, 110, 111, 117, 120, 121, 
+    122, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 135, 
+    138, 141, 142, 143, 146, 147, 148, 149, 152, 153, 154, 155, 
+    156, 159, 160, 161, 162, 163, 164, 166, 167, 170, 172, 173, 
+    174, 175, 178, 180, 182, 185, 186, 187, 189, 192, 197, 198, 
+    19, 88, 92, 100, 107, 112, 113, 114, 115, 118, 119, 123, 
+    134, 136, 137, 144, 145, 150, 151, 157, 158, 165, 168, 169, 
+    179, 184, 190, 195, 199, 209, 225, 111, 115, 116, 118, 120, 
+    121, 124, 126, 128, 130, 131, 135, 137, 138, 139, 142, 143, 
+    145, 146, 148, 149, 150, 152, 155, 157, 159, 160, 161, 162, 
+    163, 166, 167, 170, 171, 173, 174, 175, 176, 177, 178, 180, 
+    111, 115, 116, 118, 121, 124, 126, 128, 131, 135, 136, 137, 
+    138, 139, 141, 145, 148, 149, 150, 151, 152, 157, 159, 161, 
+    162, 163, 169, 171, 173, 174, 175, 176, 177, 87, 89, 93, 
+    94, 95, 97, 99, 102, 104, 105, 108, 109, 110, 117, 120, 
+    121, 122, 124, 125, 126, 127, 128, 129, 130, 132, 133, 138, 
+    139, 141, 146, 147, 148, 149, 152, 153, 154, 155, 156, 159, 
+    160, 161, 162, 164, 166, 167, 170, 172, 173, 174, 175, 178, 
+    180, 182, 185, 186, 187, 189, 192, 197, 198, 200, 201, 202, 
+    204, 205, 207, 208, 19, 88, 92, 100, 107, 112, 113, 114, 
+    115, 116, 118, 119, 123, 134, 136, 137, 140, 145, 150, 151, 
+    157, 158, 165, 168, 169, 179, 181, 184, 190, 195, 199, 209, 
+    225, 114, 115, 116, 118, 119, 123, 124, 126, 131, 134, 135, 
+    136, 137, 138, 140, 141, 142, 144, 148, 150, 151, 157, 159, 
+    163, 168, 169, 171, 176, 177, 181, 184, 188, 94, 95, 97, 
+    99, 102, 104, 105, 108, 109, 110, 117, 120, 121, 122, 124, 
+    125, 126, 127, 128, 129, 130, 132, 133, 138, 139, 141, 143, 
+    147, 148, 149, 152, 153, 154, 155, 156, 159, 160, 161, 162, 
+    163, 164, 166, 167, 170, 172, 173, 174, 175, 178, 180, 182, 
+    185, 186, 187, 189, 192, 197, 198, 200, 201, 202, 204, 205, 
+    207, 208, 3, 27, 87, 89, 93, 94, 95, 97, 99, 102, 
+    104, 105, 108, 109, 110, 117, 120, 121, 122, 125, 127, 128, 
+    129, 130, 132, 133, 138, 139, 143, 146, 148, 149, 152, 153, 
+    154, 155, 156, 159, 160, 161, 162, 164, 166, 167, 170, 172, 
+    173, 174, 175, 178, 180, 182, 185, 186, 187, 189, 192, 197, 
+    198, 200, 201, 202, 204, 205, 207, 208, 212, 234, 110, 117, 
+    120, 121, 122, 124, 125, 126, 127, 128, 129, 130, 131, 132, 
+    133, 135, 137, 138, 139, 141, 142, 143, 145, 146, 147, 149, 
+    150, 152, 153, 154, 155, 156, 159, 160, 161, 162, 163, 164, 
+    166, 167, 170, 171, 172, 173, 174, 175, 176, 177, 178, 180, 
+    182, 183, 186, 187, 189, 191, 192, 196, 197, 200, 201, 202, 
+    204, 104, 105, 108, 109, 110, 117, 120, 121, 122, 124, 125, 
+    126, 127, 128, 129, 130, 131, 132, 133, 135, 138, 139, 141, 
+    142, 143, 146, 147, 148, 152, 153, 154, 155, 156, 159, 160, 
+    161, 162, 163, 164, 166, 167, 170, 172, 173, 174, 175, 176, 
+    177, 178, 180, 182, 183, 185, 186, 187, 189, 191, 192, 196, 
+    197, 198, 200, 201, 202, 204, 205, 207, 208, 115, 116, 118, 
+    119, 123, 126, 131, 134, 135, 136, 137, 138, 140, 141, 142, 
+    144, 145, 148, 151, 157, 159, 163, 168, 169, 171, 176, 177, 
+    181, 183, 184, 188, 193, 194, 195, 112, 113, 114, 115, 118, 
+    119, 123, 134, 135, 136, 137, 140, 142, 144, 145, 150, 157, 
+    158, 165, 168, 169, 171, 179, 181, 184, 188, 190, 193, 194, 
+    195, 199, 209, 102, 104, 105, 108, 109, 110, 117, 120, 121, 
+    122, 124, 125, 126, 127, 128, 129, 130, 132, 133, 138, 139, 
+    141, 142, 143, 146, 147, 148, 149, 153, 154, 155, 156, 159, 
+    160, 161, 162, 163, 164, 166, 167, 170, 172, 173, 174, 175, 
+    176, 177, 178, 180, 182, 183, 185, 186, 187, 189, 191, 192, 
+    196, 197, 198, 200, 201, 202, 204, 205, 207, 208, 211, 212, 
+    215, 3, 27, 87, 89, 94, 95, 97, 99, 102, 104, 105, 
+    108, 109, 110, 117, 120, 122, 125, 127, 128, 129, 130, 132, 
+    133, 138, 139, 143, 146, 147, 148, 149, 152, 154, 155, 156, 
+    159, 160, 161, 162, 164, 166, 167, 170, 172, 173, 174, 175, 
+    178, 180, 182, 185, 186, 187, 189, 192, 196, 197, 198, 200, 
+    201, 202, 204, 205, 207, 208, 211, 212, 215, 234, 3, 27, 
+    87, 89, 94, 95, 97, 99, 102, 104, 105, 108, 109, 110, 
+    117, 120, 122, 125, 127, 128, 129, 130, 132, 133, 138, 139, 
+    143, 146, 147, 148, 149, 152, 153, 155, 156, 159, 160, 161, 
+    162, 164, 166, 167, 170, 172, 173, 174, 175, 178, 180, 182, 
+    185, 186, 187, 189, 192, 196, 197, 198, 200, 201, 202, 204, 
+    205, 207, 208, 211, 212, 215, 234, 94, 99, 102, 104, 105, 
+    108, 109, 110, 117, 120, 121, 122, 124, 125, 126, 127, 128, 
+    129, 130, 132, 133, 138, 139, 141, 143, 146, 147, 148, 149, 
+    152, 153, 154, 156, 159, 160, 161, 162, 163, 164, 166, 167, 
+    170, 172, 173, 174, 175, 178, 180, 182, 183, 185, 186, 187, 
+    189, 191, 192, 196, 197, 198, 200, 201, 202, 204, 205, 207, 
+    208, 211, 212, 213, 215, 3, 27, 71, 87, 89, 94, 95, 
+    97, 99, 102, 104, 105, 108, 109, 110, 117, 120, 122, 125, 
+    127, 129, 130, 132, 133, 138, 139, 143, 146, 147, 148, 149, 
+    152, 153, 154, 155, 160, 161, 162, 164, 166, 167, 170, 172, 
+    173, 174, 178, 180, 182, 185, 186, 187, 189, 192, 197, 198, 
+    200, 201, 202, 204, 205, 207, 208, 212, 215, 234, 248, 118, 
+    119, 123, 131, 134, 135, 136, 137, 140, 141, 142, 144, 145, 
+    150, 151, 159, 163, 165, 168, 169, 171, 176, 177, 179, 181, 
+    184, 188, 190, 193, 194, 195, 199, 203, 209, 1, 8, 11, 
+    13, 19, 88, 92, 100, 107, 112, 113, 114, 119, 123, 134, 
+    136, 140, 144, 151, 165, 168, 179, 184, 190, 195, 199, 209, 
+    217, 225, 228, 239, 240, 247, 255, 121, 124, 126, 128, 130, 
+    131, 135, 137, 138, 139, 141, 142, 143, 145, 146, 147, 148, 
+    149, 150, 152, 153, 154, 155, 157, 160, 161, 162, 163, 166, 
+    167, 169, 170, 171, 173, 174, 175, 176, 177, 178, 180, 181, 
+    182, 183, 186, 187, 188, 191, 192, 196, 200, 202, 204, 205, 
+    207, 208, 104, 105, 108, 109, 110, 117, 120, 121, 122, 124, 
+    125, 126, 127, 128, 129, 130, 132, 133, 138, 139, 141, 143, 
+    146, 147, 148, 149, 152, 153, 154, 155, 156, 159, 161, 162, 
+    163, 164, 166, 167, 170, 172, 173, 174, 175, 176, 177, 178, 
+    180, 182, 183, 185, 186, 187, 189, 191, 192, 196, 197, 198, 
+    200, 201, 202, 204, 205, 207, 208, 211, 212, 213, 215, 216, 
+    104, 105, 108, 109, 110, 117, 120, 121, 122, 124, 125, 126, 
+    127, 128, 129, 130, 132, 133, 138, 139, 141, 142, 143, 146, 
+    147, 148, 149, 152, 153, 154, 155, 156, 159, 160, 162, 163, 
+    164, 166, 167, 170, 172, 173, 174, 175, 176, 177, 178, 180, 
+    182, 183, 185, 186, 187, 189, 191, 192, 196, 197, 198, 200, 
+    201, 202, 204, 205, 207, 208, 211, 212, 213, 215, 216, 120, 
+    121, 122, 124, 125, 126, 127, 128, 130, 131, 133, 135, 138, 
+    139, 141, 142, 143, 146, 147, 148, 149, 152, 153, 154, 155, 
+    156, 159, 160, 161, 163, 164, 166, 167, 170, 171, 172, 173, 
+    174, 175, 176, 177, 178, 180, 182, 183, 186, 187, 188, 189, 
+    191, 192, 196, 197, 198, 200, 201, 202, 204, 205, 207, 208, 
+    210, 211, 212, 213, 215, 216, 124, 126, 128, 131, 135, 137, 
+    138, 139, 141, 142, 145, 146, 148, 149, 150, 152, 155, 157, 
+    159, 160, 161, 162, 166, 167, 169, 170, 171, 173, 174, 175, 
+    176, 177, 178, 180, 181, 182, 183, 184, 186, 187, 188, 191, 
+    192, 193, 194, 196, 200, 202, 203, 204, 205, 206, 207, 208, 
+    210, 211, 3, 27, 71, 87, 89, 94, 95, 97, 99, 102, 
+    104, 105, 108, 109, 110, 117, 120, 122, 125, 127, 129, 130, 
+    132, 133, 139, 143, 146, 147, 148, 149, 152, 153, 154, 155, 
+    156, 160, 161, 162, 166, 167, 170, 172, 173, 178, 180, 182, 
+    185, 186, 187, 189, 192, 197, 198, 200, 201, 202, 204, 205, 
+    207, 208, 211, 212, 215, 234, 235, 248, 1, 8, 13, 19, 
+    88, 100, 112, 113, 114, 119, 123, 134, 136, 140, 144, 151, 
+    157, 158, 168, 169, 179, 184, 190, 195, 199, 209, 217, 225, 
+    228, 236, 239, 240, 247, 255, 109, 117, 120, 121, 122, 124, 
+    125, 126, 127, 128, 129, 130, 132, 133, 138, 139, 141, 143, 
+    146, 147, 148, 149, 152, 153, 154, 155, 156, 159, 160, 161, 
+    162, 163, 164, 167, 170, 172, 173, 174, 175, 176, 177, 178, 
+    180, 182, 183, 185, 186, 187, 189, 191, 192, 196, 197, 198, 
+    200, 201, 202, 204, 205, 207, 208, 211, 212, 213, 215, 216, 
+    218, 221, 104, 105, 108, 109, 110, 117, 120, 121, 122, 125, 
+    126, 127, 128, 129, 130, 132, 133, 138, 139, 141, 143, 146, 
+    147, 148, 149, 152, 153, 154, 155, 156, 159, 160, 161, 162, 
+    163, 164, 166, 170, 172, 173, 174, 175, 176, 177, 178, 180, 
+    182, 183, 185, 186, 187, 189, 191, 192, 196, 197, 198, 200, 
+    201, 202, 204, 205, 207, 208, 211, 212, 213, 215, 216, 218, 
+    221, 19, 112, 113, 114, 119, 123, 134, 136, 140, 144, 145, 
+    150, 151, 157, 158, 165, 169, 179, 181, 184, 190, 194, 195, 
+    199, 209, 217, 220, 225, 228, 239, 240, 255, 134, 135, 136, 
+    137, 140, 142, 144, 145, 150, 151, 157, 159, 163, 165, 168, 
+    171, 176, 177, 179, 181, 183, 184, 188, 190, 193, 194, 195, 
+    199, 203, 206, 209, 217, 220, 117, 120, 122, 125, 127, 128, 
+    129, 130, 132, 133, 138, 139, 141, 143, 146, 147, 148, 149, 
+    152, 153, 154, 155, 156, 159, 160, 161, 162, 163, 164, 166, 
+    167, 172, 173, 174, 175, 176, 177, 178, 180, 182, 183, 185, 
+    186, 187, 189, 191, 192, 196, 197, 198, 200, 201, 202, 204, 
+    205, 207, 208, 210, 211, 212, 213, 215, 216, 218, 219, 221, 
+    223, 135, 137, 141, 142, 145, 148, 150, 151, 157, 159, 162, 
+    163, 169, 173, 174, 175, 176, 177, 178, 180, 181, 182, 183, 
+    184, 186, 188, 191, 193, 194, 195, 196, 203, 206, 210, 214, 
+    3, 27, 94, 95, 97, 99, 102, 104, 105, 108, 109, 110, 
+    117, 120, 122, 125, 127, 129, 130, 132, 133, 139, 143, 146, 
+    147, 148, 149, 152, 153, 154, 155, 156, 160, 161, 162, 164, 
+    166, 167, 170, 173, 174, 175, 178, 180, 182, 185, 186, 187, 
+    189, 192, 196, 197, 198, 200, 201, 202, 204, 205, 207, 208, 
+    211, 212, 213, 215, 216, 218, 221, 234, 235, 248, 130, 138, 
+    139, 141, 142, 143, 146, 147, 148, 149, 152, 153, 154, 155, 
+    156, 159, 160, 161, 162, 163, 164, 166, 167, 170, 171, 172, 
+    174, 175, 176, 177, 178, 180, 182, 183, 185, 186, 187, 188, 
+    189, 191, 192, 193, 196, 197, 198, 200, 201, 202, 203, 204, 
+    205, 206, 207, 208, 210, 211, 212, 213, 214, 215, 216, 218, 
+    219, 221, 223, 224, 138, 139, 141, 142, 143, 146, 147, 148, 
+    149, 152, 153, 154, 155, 156, 159, 160, 161, 162, 163, 166, 
+    167, 170, 171, 172, 173, 175, 176, 177, 178, 180, 181, 182, 
+    183, 186, 187, 188, 189, 191, 192, 193, 196, 197, 198, 200, 
+    201, 202, 203, 204, 205, 206, 207, 208, 210, 211, 212, 213, 
+    214, 215, 216, 218, 219, 221, 223, 224, 138, 139, 141, 142, 
+    143, 146, 147, 148, 149, 152, 153, 154, 155, 159, 160, 161, 
+    162, 163, 166, 167, 170, 171, 172, 173, 174, 176, 177, 178, 
+    180, 181, 182, 183, 186, 187, 188, 189, 191, 192, 193, 196, 
+    197, 198, 200, 201, 202, 203, 204, 205, 206, 207, 208, 210, 
+    211, 212, 213, 214, 215, 216, 218, 219, 221, 223, 224, 141, 
+    142, 145, 148, 149, 150, 152, 157, 159, 160, 161, 162, 163, 
+    166, 167, 169, 170, 171, 173, 174, 175, 177, 178, 180, 181, 
+    182, 183, 184, 186, 187, 188, 191, 192, 193, 194, 195, 196, 
+    200, 202, 203, 204, 205, 206, 207, 208, 210, 211, 212, 213, 
+    214, 215, 216, 218, 219, 222, 224, 141, 142, 145, 148, 149, 
+    150, 152, 157, 159, 160, 161, 162, 163, 166, 167, 169, 170, 
+    171, 173, 174, 175, 176, 178, 180, 181, 182, 183, 184, 186, 
+    187, 188, 191, 192, 193, 194, 195, 196, 200, 202, 203, 204, 
+    205, 206, 207, 208, 210, 211, 212, 213, 214, 215, 216, 218, 
+    219, 222, 224, 138, 139, 141, 143, 146, 147, 148, 149, 152, 
+    153, 154, 155, 156, 159, 160, 161, 162, 163, 164, 166, 167, 
+    170, 171, 172, 173, 174, 175, 176, 177, 180, 182, 183, 185, 
+    186, 187, 188, 189, 191, 192, 193, 196, 197, 198, 200, 201, 
+    202, 203, 204, 205, 206, 207, 208, 210, 211, 212, 213, 214, 
+    215, 216, 218, 219, 221, 223, 224, 19, 112, 113, 119, 123, 
+    134, 136, 140, 144, 151, 157, 158, 165, 168, 169, 181, 184, 
+    190, 194, 195, 199, 209, 217, 220, 225, 227, 228, 233, 236, 
+    239, 240, 247, 255, 138, 139, 141, 143, 146, 147, 148, 149, 
+    152, 153, 154, 155, 156, 159, 160, 161, 162, 163, 164, 166, 
+    167, 170, 171, 172, 173, 174, 175, 176, 177, 178, 182, 183, 
+    185, 186, 187, 188, 189, 191, 192, 193, 196, 197, 198, 200, 
+    201, 202, 203, 204, 205, 206, 207, 208, 210, 211, 212, 213, 
+    214, 215, 216, 218, 219, 221, 223, 224, 144, 145, 150, 151, 
+    157, 159, 163, 168, 169, 171, 174, 175, 176, 177, 179, 183, 
+    184, 188, 190, 191, 193, 194, 195, 199, 203, 206, 209, 210, 
+    214, 217, 220, 222, 227, 138, 139, 143, 146, 147, 148, 149, 
+    152, 153, 154, 155, 156, 159, 160, 161, 162, 163, 164, 166, 
+    167, 170, 171, 172, 173, 174, 175, 176, 177, 178, 180, 183, 
+    185, 186, 187, 188, 189, 191, 192, 193, 196, 197, 198, 200, 
+    201, 202, 203, 204, 205, 206, 207, 208, 210, 211, 212, 213, 
+    214, 215, 216, 218, 219, 221, 223, 224, 148, 149, 150, 152, 
+    155, 159, 160, 161, 162, 163, 166, 167, 169, 170, 171, 173, 
+    174, 175, 176, 177, 178, 180, 181, 182, 184, 186, 187, 188, 
+    189, 191, 192, 193, 194, 196, 197, 200, 201, 202, 203, 204, 
+    205, 206, 207, 208, 210, 211, 212, 213, 214, 215, 216, 218, 
+    219, 221, 222, 223, 224, 226, 134, 136, 140, 144, 145, 150, 
+    151, 157, 158, 163, 165, 168, 169, 171, 176, 177, 179, 181, 
+    183, 188, 190, 193, 194, 195, 199, 203, 206, 209, 210, 214, 
+    217, 220, 222, 225, 227, 228, 233, 3, 15, 27, 87, 94, 
+    95, 99, 102, 104, 105, 108, 109, 110, 117, 120, 122, 125, 
+    127, 129, 130, 132, 133, 139, 143, 146, 147, 149, 152, 153, 
+    154, 155, 156, 160, 161, 164, 166, 167, 170, 172, 173, 178, 
+    180, 182, 186, 187, 189, 192, 196, 197, 198, 200, 201, 202, 
+    204, 205, 207, 208, 211, 212, 213, 215, 218, 221, 234, 235, 
+    246, 248, 139, 143, 146, 147, 148, 149, 152, 153, 154, 155, 
+    156, 159, 160, 161, 162, 163, 164, 166, 167, 170, 171, 172, 
+    173, 174, 175, 176, 177, 178, 180, 182, 183, 185, 187, 188, 
+    189, 191, 192, 196, 197, 198, 200, 201, 202, 204, 205, 206, 
+    207, 208, 210, 211, 212, 213, 214, 215, 216, 218, 219, 221, 
+    223, 224, 234, 235, 127, 129, 130, 132, 133, 139, 143, 146, 
+    147, 148, 149, 152, 153, 154, 155, 156, 159, 160, 161, 162, 
+    163, 164, 166, 167, 170, 172, 173, 174, 175, 176, 177, 178, 
+    180, 182, 183, 185, 186, 189, 191, 192, 196, 197, 198, 200, 
+    201, 202, 204, 205, 206, 207, 208, 210, 211, 212, 213, 214, 
+    215, 216, 218, 219, 221, 223, 224, 234, 235, 145, 150, 151, 
+    157, 159, 162, 163, 169, 171, 173, 174, 175, 176, 177, 178, 
+    180, 181, 182, 183, 184, 186, 191, 193, 194, 195, 196, 199, 
+    203, 206, 209, 210, 211, 213, 214, 216, 217, 218, 219, 220, 
+    222, 224, 226, 227, 229, 230, 3, 104, 108, 109, 117, 120, 
+    122, 125, 127, 129, 130, 132, 133, 139, 143, 146, 147, 148, 
+    149, 152, 153, 154, 155, 156, 160, 161, 162, 164, 166, 167, 
+    170, 172, 173, 174, 175, 178, 180, 182, 183, 185, 186, 187, 
+    191, 192, 196, 197, 198, 200, 201, 202, 204, 205, 207, 208, 
+    211, 212, 213, 215, 216, 218, 219, 221, 223, 224, 234, 235, 
+    248, 1, 8, 13, 19, 112, 113, 119, 123, 134, 136, 140, 
+    144, 151, 157, 158, 165, 168, 169, 179, 181, 184, 194, 195, 
+    199, 209, 217, 220, 225, 227, 228, 233, 236, 237, 239, 240, 
+    247, 255, 148, 149, 152, 155, 159, 160, 161, 162, 163, 166, 
+    167, 170, 171, 173, 174, 175, 176, 177, 178, 180, 181, 182, 
+    183, 186, 187, 188, 189, 192, 193, 194, 196, 197, 198, 200, 
+    201, 202, 203, 204, 205, 206, 207, 208, 210, 211, 212, 213, 
+    214, 215, 216, 218, 219, 221, 222, 223, 224, 226, 232, 125, 
+    127, 129, 130, 132, 133, 139, 143, 146, 147, 148, 149, 152, 
+    153, 154, 155, 156, 159, 160, 161, 162, 163, 164, 166, 167, 
+    170, 172, 173, 174, 175, 176, 177, 178, 180, 182, 183, 185, 
+    186, 187, 189, 191, 196, 197, 198, 200, 201, 202, 204, 205, 
+    207, 208, 210, 211, 212, 213, 214, 215, 216, 218, 219, 221, 
+    223, 224, 234, 235, 150, 151, 157, 163, 169, 171, 173, 174, 
+    175, 176, 177, 178, 180, 181, 182, 183, 184, 188, 191, 194, 
+    195, 196, 199, 203, 206, 209, 210, 214, 216, 217, 220, 222, 
+    224, 226, 227, 228, 229, 230, 150, 151, 157, 163, 168, 169, 
+    171, 176, 177, 179, 181, 183, 184, 188, 190, 191, 193, 195, 
+    199, 203, 206, 209, 210, 214, 217, 220, 222, 226, 227, 228, 
+    229, 230, 233, 236, 140, 144, 150, 151, 157, 158, 165, 168, 
+    169, 171, 176, 177, 179, 181, 184, 188, 190, 193, 194, 199, 
+    203, 206, 209, 214, 217, 220, 222, 225, 226, 227, 228, 229, 
+    230, 233, 236, 237, 239, 148, 149, 152, 153, 154, 155, 159, 
+    160, 161, 162, 163, 166, 167, 170, 171, 172, 173, 174, 175, 
+    176, 177, 178, 180, 182, 183, 185, 186, 187, 188, 189, 191, 
+    192, 193, 197, 198, 200, 201, 202, 203, 204, 205, 206, 207, 
+    208, 210, 211, 212, 213, 214, 215, 216, 218, 219, 221, 223, 
+    224, 226, 232, 234, 235, 3, 104, 109, 117, 120, 122, 125, 
+    127, 129, 130, 132, 133, 139, 143, 146, 147, 148, 149, 152, 
+    153, 154, 155, 156, 160, 161, 162, 164, 166, 167, 170, 172, 
+    173, 174, 175, 178, 180, 182, 183, 185, 186, 187, 189, 191, 
+    192, 196, 198, 200, 201, 202, 204, 205, 207, 208, 211, 212, 
+    213, 215, 216, 218, 219, 221, 223, 224, 234, 235, 246, 248, 
+    3, 104, 109, 117, 120, 122, 125, 127, 129, 130, 132, 133, 
+    139, 143, 146, 147, 149, 152, 153, 154, 155, 156, 160, 161, 
+    162, 164, 166, 167, 170, 172, 173, 174, 175, 178, 180, 182, 
+    185, 186, 187, 189, 191, 192, 196, 197, 200, 201, 202, 204, 
+    205, 207, 208, 211, 212, 213, 215, 216, 218, 219, 221, 223, 
+    224, 234, 235, 246, 248, 19, 123, 134, 140, 144, 151, 157, 
+    158, 165, 168, 169, 179, 181, 184, 188, 190, 193, 194, 195, 
+    203, 209, 217, 220, 222, 225, 227, 228, 233, 236, 237, 238, 
+    239, 240, 247, 255, 143, 146, 147, 148, 149, 152, 153, 154, 
+    155, 156, 159, 160, 161, 162, 163, 164, 166, 167, 170, 172, 
+    173, 174, 175, 176, 177, 178, 180, 182, 183, 185, 186, 187, 
+    189, 191, 192, 196, 197, 198, 201, 202, 204, 205, 206, 207, 
+    208, 210, 211, 212, 213, 214, 215, 216, 218, 219, 221, 223, 
+    224, 232, 234, 235, 3, 122, 125, 127, 129, 130, 132, 133, 
+    143, 146, 147, 148, 149, 152, 153, 154, 155, 156, 160, 161, 
+    162, 164, 166, 167, 170, 172, 173, 174, 175, 178, 180, 182, 
+    183, 185, 186, 187, 189, 191, 192, 196, 197, 198, 200, 202, 
+    204, 205, 207, 208, 210, 211, 212, 213, 215, 216, 218, 219, 
+    221, 223, 224, 234, 235, 246, 248, 143, 146, 147, 148, 149, 
+    152, 153, 154, 155, 156, 159, 160, 161, 162, 163, 164, 166, 
+    167, 170, 172, 173, 174, 175, 176, 177, 178, 180, 182, 183, 
+    185, 186, 187, 189, 191, 192, 196, 197, 198, 200, 201, 204, 
+    205, 206, 207, 208, 210, 211, 212, 213, 214, 215, 216, 218, 
+    219, 221, 223, 224, 232, 234, 235, 157, 163, 169, 171, 173, 
+    174, 175, 176, 177, 178, 180, 181, 182, 183, 184, 188, 191, 
+    193, 194, 195, 196, 199, 206, 209, 210, 211, 213, 214, 216, 
+    217, 218, 219, 220, 222, 223, 224, 226, 227, 228, 229, 230, 
+    231, 233, 129, 132, 133, 143, 146, 147, 148, 149, 152, 153, 
+    154, 155, 156, 159, 160, 161, 162, 163, 164, 166, 167, 170, 
+    172, 173, 174, 175, 176, 177, 178, 180, 182, 183, 185, 186, 
+    187, 189, 191, 192, 196, 197, 198, 200, 201, 202, 205, 207, 
+    208, 210, 211, 212, 213, 214, 215, 216, 218, 219, 221, 223, 
+    224, 232, 234, 235, 248, 143, 146, 147, 149, 152, 153, 154, 
+    155, 156, 159, 160, 161, 162, 163, 164, 166, 167, 170, 172, 
+    173, 174, 175, 176, 177, 178, 180, 182, 183, 185, 186, 187, 
+    189, 191, 192, 196, 197, 198, 200, 201, 202, 204, 206, 207, 
+    208, 210, 211, 212, 213, 214, 215, 216, 218, 219, 221, 223, 
+    224, 232, 234, 235, 163, 169, 171, 173, 174, 175, 176, 177, 
+    178, 180, 181, 182, 183, 184, 186, 187, 188, 191, 193, 194, 
+    195, 196, 200, 202, 203, 205, 207, 208, 210, 211, 212, 213, 
+    214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 226, 
+    227, 229, 230, 231, 232, 143, 146, 147, 149, 152, 153, 154, 
+    155, 156, 159, 160, 161, 162, 163, 164, 166, 167, 170, 172, 
+    173, 174, 175, 176, 177, 178, 180, 182, 183, 185, 186, 187, 
+    189, 191, 192, 196, 197, 198, 200, 201, 202, 204, 205, 206, 
+    208, 210, 211, 212, 213, 214, 215, 216, 218, 219, 221, 223, 
+    224, 232, 234, 235, 248, 143, 146, 147, 149, 152, 153, 154, 
+    155, 156, 159, 160, 161, 162, 163, 164, 166, 167, 170, 172, 
+    173, 174, 175, 176, 177, 178, 180, 182, 183, 185, 186, 187, 
+    189, 191, 192, 196, 197, 198, 200, 201, 202, 204, 205, 206, 
+    207, 210, 211, 212, 213, 214, 215, 216, 218, 219, 221, 223, 
+    224, 226, 232, 234, 235, 19, 134, 140, 144, 151, 157, 158, 
+    165, 168, 169, 179, 181, 184, 188, 190, 193, 194, 195, 199, 
+    203, 217, 220, 222, 225, 227, 228, 233, 236, 237, 238, 239, 
+    240, 247, 255, 162, 163, 170, 171, 173, 174, 175, 176, 177, 
+    178, 180, 181, 182, 183, 184, 186, 187, 188, 191, 192, 193, 
+    194, 196, 200, 201, 202, 203, 204, 205, 206, 207, 208, 211, 
+    212, 213, 214, 215, 216, 218, 219, 220, 221, 222, 223, 224, 
+    226, 227, 229, 230, 231, 232, 152, 153, 154, 155, 160, 161, 
+    162, 163, 164, 166, 167, 170, 172, 173, 174, 175, 176, 177, 
+    178, 180, 182, 183, 185, 186, 187, 188, 189, 191, 192, 196, 
+    197, 198, 200, 201, 202, 203, 204, 205, 206, 207, 208, 210, 
+    212, 213, 214, 215, 216, 218, 219, 221, 223, 224, 226, 231, 
+    232, 234, 235, 147, 152, 153, 154, 155, 156, 160, 161, 162, 
+    164, 166, 167, 170, 172, 173, 174, 175, 176, 177, 178, 180, 
+    182, 183, 185, 186, 187, 189, 191, 192, 196, 197, 198, 200, 
+    201, 202, 204, 205, 206, 207, 208, 210, 211, 213, 214, 215, 
+    216, 218, 219, 221, 223, 224, 226, 231, 232, 234, 235, 244, 
+    246, 248, 155, 160, 161, 162, 166, 167, 170, 172, 173, 174, 
+    175, 176, 177, 178, 180, 182, 183, 185, 186, 187, 188, 189, 
+    191, 192, 196, 197, 198, 200, 201, 202, 203, 204, 205, 206, 
+    207, 208, 210, 211, 212, 214, 215, 216, 218, 219, 221, 222, 
+    223, 224, 226, 229, 230, 231, 232, 234, 235, 244, 171, 173, 
+    174, 175, 176, 177, 178, 180, 181, 182, 183, 184, 186, 187, 
+    188, 191, 192, 193, 194, 195, 196, 200, 202, 203, 204, 205, 
+    206, 207, 208, 210, 211, 212, 213, 215, 216, 217, 218, 219, 
+    220, 221, 222, 223, 224, 226, 227, 229, 230, 231, 232, 152, 
+    153, 154, 155, 156, 160, 161, 162, 164, 166, 167, 170, 172, 
+    173, 174, 175, 176, 177, 178, 180, 182, 183, 185, 186, 187, 
+    189, 191, 192, 196, 197, 198, 200, 201, 202, 204, 205, 206, 
+    207, 208, 210, 211, 212, 213, 214, 216, 218, 219, 221, 223, 
+    224, 226, 231, 232, 234, 235, 244, 246, 248, 160, 161, 162, 
+    166, 167, 170, 172, 173, 174, 175, 176, 177, 178, 180, 182, 
+    183, 186, 187, 188, 189, 191, 192, 193, 196, 197, 198, 200, 
+    201, 202, 203, 204, 205, 206, 207, 208, 210, 211, 212, 213, 
+    214, 215, 218, 219, 221, 222, 223, 224, 226, 229, 230, 231, 
+    232, 234, 235, 244, 158, 165, 168, 169, 179, 181, 184, 188, 
+    190, 193, 194, 195, 199, 203, 206, 209, 214, 220, 222, 225, 
+    226, 227, 228, 229, 230, 231, 233, 236, 237, 238, 239, 240, 
+    247, 166, 167, 170, 172, 173, 174, 175, 176, 177, 178, 180, 
+    182, 183, 185, 186, 187, 188, 189, 191, 192, 196, 197, 198, 
+    200, 201, 202, 203, 204, 205, 206, 207, 208, 210, 211, 212, 
+    213, 214, 215, 216, 219, 221, 222, 223, 224, 226, 229, 230, 
+    231, 232, 234, 235, 241, 243, 244, 246, 170, 173, 174, 175, 
+    176, 177, 178, 180, 182, 183, 186, 187, 188, 189, 191, 192, 
+    196, 197, 198, 200, 201, 202, 203, 204, 205, 206, 207, 208, 
+    210, 211, 212, 213, 214, 215, 216, 218, 221, 222, 223, 224, 
+    226, 229, 230, 231, 232, 234, 235, 241, 243, 244, 246, 168, 
+    169, 179, 181, 184, 188, 190, 193, 194, 195, 199, 203, 206, 
+    209, 210, 214, 217, 222, 225, 226, 227, 228, 229, 230, 231, 
+    233, 236, 237, 238, 239, 240, 242, 247, 166, 167, 170, 172, 
+    173, 174, 175, 178, 180, 182, 183, 185, 186, 187, 189, 191, 
+    192, 196, 197, 198, 200, 201, 202, 204, 205, 206, 207, 208, 
+    210, 211, 212, 213, 214, 215, 216, 218, 219, 222, 223, 224, 
+    226, 229, 230, 231, 232, 234, 235, 241, 243, 244, 246, 248, 
+    249, 176, 177, 181, 183, 184, 188, 191, 193, 194, 195, 199, 
+    203, 206, 209, 210, 213, 214, 216, 217, 218, 219, 220, 221, 
+    223, 224, 226, 227, 228, 229, 230, 231, 232, 233, 236, 237, 
+    238, 241, 242, 170, 173, 174, 175, 178, 180, 182, 183, 186, 
+    187, 189, 191, 192, 196, 197, 198, 200, 201, 202, 203, 204, 
+    205, 206, 207, 208, 210, 211, 212, 213, 214, 215, 216, 218, 
+    219, 221, 222, 224, 226, 229, 230, 231, 232, 234, 235, 241, 
+    243, 244, 246, 248, 249, 173, 174, 175, 176, 177, 178, 180, 
+    182, 183, 186, 187, 188, 189, 191, 192, 193, 196, 197, 198, 
+    200, 201, 202, 203, 204, 205, 206, 207, 208, 210, 211, 212, 
+    213, 214, 215, 216, 218, 219, 221, 222, 223, 226, 229, 230, 
+    231, 232, 234, 235, 241, 243, 244, 246, 1, 6, 8, 11, 
+    13, 19, 113, 123, 134, 140, 144, 158, 165, 168, 179, 184, 
+    190, 195, 199, 209, 217, 220, 227, 228, 233, 236, 237, 238, 
+    239, 240, 247, 255, 183, 188, 191, 193, 194, 195, 196, 203, 
+    206, 208, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 
+    220, 221, 222, 223, 224, 227, 228, 229, 230, 231, 232, 233, 
+    236, 237, 238, 241, 242, 243, 245, 179, 181, 184, 188, 190, 
+    193, 194, 195, 199, 203, 206, 209, 210, 214, 217, 220, 222, 
+    225, 226, 228, 229, 230, 231, 232, 233, 236, 237, 238, 239, 
+    240, 241, 242, 247, 250, 1, 6, 19, 158, 165, 168, 179, 
+    184, 190, 193, 194, 195, 199, 203, 209, 217, 220, 222, 225, 
+    226, 227, 229, 230, 233, 236, 237, 238, 239, 240, 242, 247, 
+    250, 253, 255, 188, 193, 194, 195, 203, 206, 210, 213, 214, 
+    216, 217, 218, 219, 220, 221, 222, 223, 224, 226, 227, 228, 
+    230, 231, 232, 233, 236, 237, 238, 241, 242, 243, 245, 250, 
+    188, 193, 194, 195, 203, 206, 210, 213, 214, 216, 217, 218, 
+    219, 220, 221, 222, 223, 224, 226, 227, 228, 229, 231, 232, 
+    233, 236, 237, 238, 241, 242, 243, 245, 250, 203, 206, 210, 
+    211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 
+    223, 224, 226, 227, 229, 230, 232, 233, 237, 238, 241, 242, 
+    243, 244, 245, 251, 254, 191, 196, 200, 202, 204, 205, 206, 
+    207, 208, 210, 211, 212, 213, 214, 215, 216, 218, 219, 221, 
+    222, 223, 224, 226, 227, 229, 230, 231, 234, 235, 241, 242, 
+    243, 244, 245, 246, 249, 251, 252, 1, 6, 8, 179, 184, 
+    190, 194, 195, 199, 203, 209, 217, 220, 222, 225, 226, 227, 
+    228, 229, 230, 231, 236, 237, 238, 239, 240, 242, 247, 250, 
+    253, 254, 255, 3, 4, 9, 12, 15, 27, 147, 153, 154, 
+    156, 164, 172, 185, 186, 187, 189, 192, 196, 197, 198, 200, 
+    201, 202, 204, 205, 207, 208, 211, 212, 213, 215, 216, 218, 
+    219, 221, 223, 224, 232, 235, 243, 244, 246, 248, 249, 252, 
+    3, 4, 9, 12, 15, 164, 172, 185, 186, 187, 189, 192, 
+    196, 197, 198, 200, 201, 202, 204, 205, 207, 208, 211, 212, 
+    213, 215, 216, 218, 219, 221, 223, 224, 232, 234, 241, 243, 
+    244, 246, 248, 249, 251, 252, 0, 1, 6, 8, 11, 13, 
+    19, 165, 179, 190, 194, 195, 199, 209, 217, 220, 222, 225, 
+    226, 227, 228, 229, 230, 233, 237, 238, 239, 240, 242, 247, 
+    250, 253, 254, 255, 0, 1, 6, 190, 195, 199, 209, 217, 
+    220, 222, 225, 226, 227, 228, 229, 230, 231, 233, 236, 238, 
+    239, 240, 241, 242, 245, 247, 250, 253, 254, 0, 1, 2, 
+    5, 6, 199, 209, 217, 220, 222, 225, 226, 227, 228, 229, 
+    230, 231, 233, 236, 237, 239, 240, 241, 242, 245, 247, 250, 
+    253, 254, 0, 1, 5, 6, 8, 10, 11, 13, 16, 19, 
+    22, 158, 165, 168, 179, 190, 195, 199, 209, 217, 220, 225, 
+    227, 228, 233, 236, 237, 238, 240, 247, 250, 253, 255, 1, 
+    6, 8, 10, 11, 13, 16, 19, 22, 25, 158, 165, 168, 
+    179, 190, 199, 209, 217, 220, 225, 227, 228, 233, 236, 237, 
+    238, 239, 247, 250, 253, 255, 2, 218, 219, 221, 222, 223, 
+    224, 226, 227, 229, 230, 231, 232, 235, 237, 238, 242, 243, 
+    244, 245, 246, 249, 250, 251, 252, 253, 254, 0, 2, 5, 
+    220, 222, 226, 227, 228, 229, 230, 231, 232, 233, 236, 237, 
+    238, 241, 243, 245, 250, 251, 252, 253, 254, 4, 7, 218, 
+    219, 221, 223, 224, 226, 229, 230, 231, 232, 234, 235, 241, 
+    242, 244, 245, 246, 248, 249, 251, 252, 254, 3, 4, 7, 
+    9, 12, 15, 212, 213, 215, 216, 218, 219, 221, 223, 224, 
+    231, 232, 234, 235, 241, 243, 245, 246, 248, 249, 251, 252, 
+    0, 2, 7, 226, 229, 230, 231, 232, 237, 238, 241, 242, 
+    243, 244, 250, 251, 252, 253, 254, 3, 4, 7, 9, 12, 
+    15, 27, 185, 197, 198, 201, 212, 215, 218, 219, 221, 223, 
+    224, 232, 234, 235, 241, 243, 244, 248, 249, 251, 252, 0, 
+    1, 5, 6, 8, 10, 11, 13, 16, 18, 19, 22, 25, 
+    158, 165, 179, 190, 199, 209, 217, 220, 225, 227, 228, 233, 
+    236, 237, 238, 239, 240, 250, 253, 254, 255, 3, 4, 9, 
+    12, 15, 27, 32, 156, 164, 172, 185, 189, 197, 198, 201, 
+    204, 207, 212, 215, 221, 223, 234, 235, 243, 244, 246, 249, 
+    251, 252, 3, 4, 7, 9, 12, 15, 20, 27, 221, 223, 
+    232, 234, 235, 241, 243, 244, 246, 248, 251, 252, 0, 1, 
+    2, 5, 6, 8, 10, 11, 13, 14, 16, 17, 18, 227, 
+    228, 229, 230, 233, 236, 237, 238, 239, 240, 241, 242, 245, 
+    247, 253, 254, 2, 4, 7, 9, 231, 232, 235, 241, 242, 
+    243, 244, 245, 246, 248, 249, 252, 253, 254, 4, 7, 9, 
+    12, 15, 232, 234, 235, 241, 242, 243, 244, 245, 246, 248, 
+    249, 251, 254, 0, 1, 2, 5, 6, 8, 10, 11, 13, 
+    14, 16, 17, 18, 228, 233, 236, 237, 238, 239, 240, 241, 
+    242, 245, 247, 250, 251, 254, 0, 1, 2, 5, 6, 7, 
+    10, 14, 17, 18, 231, 233, 236, 237, 238, 241, 242, 243, 
+    245, 247, 250, 251, 252, 253, 1, 6, 8, 10, 11, 13, 
+    16, 18, 19, 22, 23, 24, 25, 26, 30, 37, 43, 88, 
+    112, 113, 123, 134, 158, 165, 168, 179, 190, 199, 209, 225, 
+    228, 233, 236, 239, 240, 247
+};
+
+const uint16_t adj_angle[N_ADJ] = {
+    30060, 13952, 6929, 28028, 32646, 14484, 33763, 38500, 25399, 26736, 27139, 26236, 
+    40176, 37543, 38207, 42151, 44909, 43429, 42929, 37894, 43243, 38792, 41493, 35467, 
+    18557, 14209, 20201, 30060, 43973, 28746, 4916, 6148, 25526, 9695, 13261, 42739, 
+    24398, 41303, 31156, 30255, 24508, 34338, 33095, 29060, 32744, 45939, 40103, 45461, 
+    45700, 44007, 44885, 43313, 32080, 40948, 39697, 33644, 41511, 41357, 20648, 19938, 
+    15280, 32406, 33043, 45525, 18649, 13952, 43973, 16777, 41679, 34003, 24029, 24727, 
+    36072, 28065, 32732, 43020, 44426, 45707, 43886, 45102, 36714, 35096, 25584, 36575, 
+    20617, 16516, 34950, 30800, 20976, 17405, 40251, 12341, 23046, 30842, 39029, 31729, 
+    42350, 38201, 43661, 30251, 40378, 44683, 42996, 35621, 31397, 39987, 39948, 37473, 
+    39513, 43986, 39646, 45630, 33599, 34603, 43013, 41527, 40350, 40354, 36233, 31761, 
+    35698, 28560, 40291, 39502, 38699, 44542, 28831, 37045, 43094, 33157, 19963, 32026, 
+    34950, 24596, 8347, 18746, 23691, 28375, 39081, 38477, 41319, 40124, 39961, 42886, 
+    29411, 24788, 26396, 18911, 32972, 21857, 6929, 28746, 16777, 25677, 29994, 7937, 
+    30379, 34891, 19659, 20395, 20847, 19331, 42981, 34566, 30747, 31511, 36079, 38620, 
+    41970, 41236, 40918, 44031, 44894, 45692, 37188, 24984, 20942, 26699, 28028, 4916, 
+    41679, 25677, 4679, 21493, 6981, 11576, 38274, 19486, 36657, 26307, 32813, 20654, 
+    29551, 28386, 25012, 28708, 41283, 35752, 41971, 44339, 42517, 36789, 45635, 43962, 
+    37989, 45206, 44438, 25564, 24554, 19981, 33374, 33228, 45160, 21750, 34003, 24596, 
+    29104, 40527, 42523, 45555, 36542, 40694, 42140, 41798, 42596, 43003, 38087, 26124, 
+    26788, 41165, 32646, 6148, 29994, 4679, 25182, 3615, 7326, 41189, 21010, 39202, 
+    28262, 28611, 18589, 29577, 28117, 23230, 26882, 40741, 34478, 39345, 41838, 39553, 
+    45440, 43804, 45140, 45270, 34955, 45596, 39502, 25186, 22678, 20862, 37650, 37741, 
+    18043, 30800, 8347, 29104, 11573, 16663, 21195, 32577, 30534, 33006, 42553, 44302, 
+    36280, 30000, 27716, 24328, 41188, 30158, 14484, 25526, 24029, 7937, 21493, 25182, 
+    24751, 28870, 17782, 12461, 17394, 12208, 40840, 26873, 23106, 23723, 28179, 30684, 
+    35814, 34130, 33184, 44475, 45817, 44232, 45303, 36930, 31079, 27657, 34570, 43143, 
+    33763, 9695, 30379, 6981, 3615, 24751, 4800, 39757, 18825, 37475, 26222, 29060, 
+    14984, 26451, 24887, 19642, 23284, 43629, 37363, 30942, 43434, 35766, 38244, 36040, 
+    42061, 44867, 37626, 43114, 28530, 25449, 24454, 40347, 40078, 19440, 20976, 18746, 
+    40527, 11573, 5091, 21342, 21023, 20016, 24219, 39409, 37188, 43863, 44533, 40115, 
+    44546, 41306, 32847, 25389, 28239, 39110, 38500, 13261, 34891, 11576, 7326, 28870, 
+    4800, 42862, 21385, 40263, 28777, 25604, 13600, 26974, 25145, 18311, 21716, 43730, 
+    36891, 29792, 41422, 32936, 35529, 32820, 38372, 44643, 41589, 41863, 43698, 45869, 
+    37024, 45537, 29664, 25287, 26771, 44901, 44790, 17363, 25399, 42739, 24727, 19659, 
+    38274, 42523, 41189, 17782, 39757, 42862, 21609, 3933, 14553, 23449, 35345, 23556, 
+    25473, 34043, 34678, 26235, 28847, 32503, 45785, 38346, 44539, 42104, 44978, 45185, 
+    43926, 39361, 40663, 17405, 23691, 45555, 16663, 5091, 23111, 15964, 15753, 21043, 
+    44140, 44073, 35364, 43774, 32444, 39731, 42878, 39448, 45081, 42585, 45936, 40016, 
+    45524, 44280, 35246, 25998, 31206, 43458, 26736, 24398, 36072, 20395, 19486, 21010, 
+    12461, 18825, 21385, 21609, 18879, 7424, 40392, 15071, 12126, 12067, 15776, 18228, 
+    28106, 24188, 21469, 41421, 35019, 32156, 33647, 34237, 42743, 41761, 44693, 45030, 
+    43619, 38991, 41613, 38927, 38219, 27139, 41303, 28065, 20847, 36657, 39202, 17394, 
+    37475, 40263, 3933, 18879, 11536, 23501, 31952, 19706, 21664, 30398, 30884, 22927, 
+    25053, 28571, 45844, 35530, 42360, 38339, 41046, 41269, 44118, 44711, 45671, 41309, 
+    43636, 26236, 31156, 32732, 19331, 26307, 28262, 12208, 26222, 28777, 14553, 7424, 
+    11536, 33223, 20913, 11754, 12981, 20178, 21552, 23828, 21976, 21970, 37476, 34468, 
+    34046, 34983, 36664, 41871, 44221, 45820, 45144, 43281, 39825, 45762, 45636, 30255, 
+    32813, 28611, 29060, 25604, 35765, 39422, 41512, 45595, 43450, 44602, 29285, 42051, 
+    38521, 34070, 28707, 45972, 36876, 33579, 34711, 35779, 41409, 16578, 18886, 31751, 
+    29137, 24859, 38225, 38976, 22598, 45023, 44693, 27274, 19271, 31497, 11841, 40251, 
+    28375, 36542, 21195, 21342, 23111, 44404, 34415, 29826, 24934, 21640, 32268, 45675, 
+    37814, 44148, 37340, 40071, 32452, 33968, 41948, 36608, 40302, 40213, 40803, 45452, 
+    43020, 42981, 40694, 40840, 23449, 40392, 23501, 33223, 44404, 34757, 36889, 44563, 
+    22788, 30340, 38049, 22385, 26120, 26912, 39507, 40077, 32673, 38145, 35195, 36114, 
+    35629, 42050, 43568, 37658, 43081, 38348, 39520, 38819, 41381, 40051, 43453, 43116, 
+    40176, 24508, 34566, 20654, 18589, 26873, 14984, 13600, 35345, 15071, 31952, 20913, 
+    35765, 14666, 12564, 4736, 8308, 30479, 23368, 16212, 41045, 28458, 21427, 23717, 
+    22349, 35839, 43464, 29269, 34061, 41853, 43106, 38861, 39435, 30139, 37543, 34338, 
+    44426, 30747, 29551, 29577, 23106, 26451, 26974, 23556, 12126, 19706, 11754, 34757, 
+    14666, 2192, 11534, 11261, 17248, 12149, 10230, 29862, 39652, 23216, 22359, 23230, 
+    25104, 45286, 30850, 44197, 37084, 32611, 34083, 43374, 44931, 44229, 38207, 33095, 
+    45707, 31511, 28386, 28117, 23723, 24887, 25145, 25473, 12067, 21664, 12981, 36889, 
+    12564, 2192, 9342, 9222, 18747, 12932, 9487, 30916, 40840, 22952, 21101, 22190, 
+    23683, 30677, 44831, 37229, 31241, 33166, 43147, 44646, 42320, 42151, 29060, 36079, 
+    25012, 23230, 28179, 19642, 18311, 34043, 15776, 30398, 20178, 39422, 4736, 11534, 
+    9342, 3697, 26149, 18817, 11484, 36351, 23889, 17660, 19731, 19095, 31382, 38914, 
+    26409, 30439, 43051, 44249, 45527, 42227, 43534, 44091, 34567, 44909, 32744, 38620, 
+    28708, 26882, 30684, 23284, 21716, 34678, 18228, 30884, 21552, 41512, 44563, 8308, 
+    11261, 9222, 3697, 23700, 16046, 8227, 33122, 43242, 20199, 14290, 16213, 16056, 
+    27686, 44616, 35222, 23541, 27064, 39401, 40623, 42032, 41542, 37489, 12341, 39081, 
+    32577, 21023, 15964, 34415, 12011, 19749, 42467, 41271, 26731, 36443, 20073, 30201, 
+    44565, 39464, 44799, 38388, 28465, 34124, 45952, 23557, 32273, 36342, 35137, 29213, 
+    26635, 34156, 34690, 32899, 36731, 42439, 38782, 44648, 33493, 34746, 42802, 44296, 
+    44456, 44461, 40385, 37010, 42325, 36399, 41168, 43915, 31355, 41669, 41970, 35814, 
+    43629, 43730, 26235, 28106, 22927, 23828, 22788, 30479, 17248, 18747, 26149, 23700, 
+    7915, 16054, 37702, 13650, 22744, 17703, 24921, 23761, 35148, 45386, 38666, 28303, 
+    35466, 29394, 22544, 35179, 29286, 39912, 36559, 25552, 37884, 44754, 34821, 33874, 
+    31101, 33783, 35619, 40507, 39934, 43422, 45939, 41236, 41283, 40741, 34130, 37363, 
+    36891, 28847, 24188, 25053, 21976, 30340, 23368, 12149, 12932, 18817, 16046, 7915, 
+    8161, 45402, 18062, 28103, 13300, 17876, 17229, 40924, 44448, 21259, 40428, 33209, 
+    20132, 39638, 32049, 44842, 40972, 25436, 42224, 37307, 27578, 26277, 32509, 34209, 
+    40104, 37669, 43506, 40103, 40918, 35752, 34478, 33184, 30942, 29792, 32503, 21469, 
+    28571, 21970, 38049, 16212, 10230, 9487, 11484, 8227, 16054, 8161, 24913, 35042, 
+    13677, 12498, 13065, 15555, 38940, 21437, 45667, 37022, 28404, 41836, 22829, 23853, 
+    33803, 35255, 41869, 37605, 45609, 43931, 45534, 45709, 45785, 45844, 29826, 22385, 
+    37702, 45402, 42125, 31443, 24174, 18301, 19158, 18292, 19510, 24082, 29357, 22711, 
+    26756, 23182, 33616, 25153, 27231, 42413, 30864, 27909, 27129, 33735, 35819, 36725, 
+    35041, 45297, 40394, 44514, 44810, 23046, 38477, 30534, 20016, 15753, 24934, 12011, 
+    7845, 41033, 43594, 31407, 30621, 38243, 19624, 28339, 17667, 23979, 42738, 37586, 
+    45031, 33883, 40415, 35466, 29053, 34340, 45122, 29061, 34837, 38142, 37707, 34172, 
+    33489, 39148, 40192, 39203, 44159, 42893, 44205, 39279, 30842, 41319, 33006, 24219, 
+    21043, 21640, 19749, 42125, 7845, 33200, 39558, 35777, 38879, 23876, 23368, 31346, 
+    42478, 16269, 23183, 45813, 18582, 20786, 36708, 41556, 40055, 32822, 39704, 30344, 
+    37377, 33742, 30227, 34824, 44278, 33138, 36779, 39392, 39469, 37598, 38036, 42320, 
+    43624, 43161, 38346, 41421, 35530, 37476, 26120, 41045, 29862, 30916, 36351, 33122, 
+    13650, 18062, 24913, 31443, 10136, 17321, 27866, 39547, 25589, 22994, 33964, 26494, 
+    30690, 22388, 15754, 16756, 39418, 21766, 37072, 15831, 26818, 23130, 15313, 24426, 
+    31639, 21389, 33418, 27755, 24044, 43344, 25887, 29173, 31043, 31458, 42522, 43192, 
+    45014, 44539, 42360, 26912, 39652, 40840, 43242, 22744, 28103, 35042, 24174, 10136, 
+    26257, 36958, 29581, 34474, 12859, 23861, 16365, 39466, 12739, 8786, 23296, 29282, 
+    12780, 26951, 11589, 17177, 14160, 18295, 42696, 15515, 22015, 45083, 16211, 40894, 
+    34172, 25709, 42921, 33855, 27287, 28005, 32749, 37059, 29022, 44769, 38989, 45712, 
+    42151, 43434, 41422, 42104, 35019, 38339, 34468, 39507, 28458, 23216, 22952, 23889, 
+    20199, 17703, 13300, 13677, 17321, 26257, 10701, 8287, 38339, 41578, 13375, 36151, 
+    27601, 7761, 34465, 24835, 40126, 35590, 15025, 36596, 44508, 29070, 16860, 13421, 
+    20196, 21720, 28215, 24609, 31934, 42634, 33049, 36344, 43801, 45461, 41971, 39345, 
+    44475, 35766, 32936, 44978, 32156, 41046, 34046, 45595, 21427, 22359, 21101, 17660, 
+    14290, 24921, 17876, 12498, 27866, 36958, 10701, 2721, 3394, 37817, 15975, 44629, 
+    34645, 45673, 23861, 38230, 10331, 12786, 26085, 27071, 34096, 27912, 38042, 32061, 
+    36178, 34830, 40438, 44535, 45456, 32268, 40077, 18301, 41033, 33200, 39547, 29581, 
+    17294, 6412, 14336, 20500, 29121, 5537, 22998, 7851, 33114, 17981, 22451, 44215, 
+    13903, 22155, 16250, 16656, 32170, 18433, 18640, 33837, 44866, 28269, 24126, 42921, 
+    43292, 34813, 26268, 27026, 28212, 31928, 31832, 36305, 37473, 41442, 41657, 44351, 
+    44339, 41838, 45817, 38244, 35529, 45185, 33647, 41269, 34983, 23717, 23230, 22190, 
+    19731, 16213, 23761, 17229, 13065, 25589, 34474, 8287, 2721, 5107, 43823, 35131, 
+    13255, 41934, 31931, 42969, 21143, 43874, 35514, 10351, 11047, 23598, 24659, 31663, 
+    25819, 35598, 45298, 30906, 34870, 36225, 40949, 45380, 45675, 32673, 35148, 40924, 
+    19158, 22994, 12859, 38339, 17294, 11189, 3530, 4943, 12222, 33985, 16437, 7700, 
+    14114, 16486, 6913, 8074, 27228, 29912, 8792, 10901, 32248, 17188, 43994, 32093, 
+    30260, 22363, 33151, 30908, 42974, 38184, 26519, 30150, 35459, 33457, 35801, 43545, 
+    40272, 37218, 39194, 43454, 37814, 38145, 45386, 18292, 39558, 33964, 23861, 6412, 
+    11189, 8013, 14098, 22756, 44930, 5823, 16587, 5001, 26711, 11678, 16063, 37837, 
+    18851, 15823, 10706, 21319, 25823, 41575, 20735, 16758, 42343, 39083, 38731, 32470, 
+    22105, 36987, 39533, 27438, 26907, 28674, 34463, 32802, 41267, 39623, 42069, 37479, 
+    43920, 41577, 44148, 35195, 38666, 44448, 19510, 26494, 16365, 41578, 14336, 3530, 
+    8013, 6309, 14789, 36919, 12987, 9021, 10590, 18847, 5668, 8839, 29888, 26511, 
+    9043, 8334, 28795, 18606, 34079, 26741, 19230, 34988, 32072, 39452, 39809, 23674, 
+    30873, 32089, 30293, 32558, 40075, 36997, 36925, 45790, 38514, 40452, 44297, 45700, 
+    42517, 39553, 36040, 32820, 34237, 44118, 36664, 43450, 22349, 25104, 23683, 19095, 
+    16056, 28303, 21259, 15555, 30690, 39466, 13375, 3394, 5107, 39691, 17493, 36280, 
+    25223, 39473, 7578, 11891, 26293, 27061, 34077, 27204, 38028, 29978, 34239, 31458, 
+    37145, 41161, 44166, 36114, 35466, 40428, 24082, 22388, 12739, 36151, 20500, 43823, 
+    4943, 14098, 6309, 8748, 31008, 18385, 2818, 15557, 12614, 4450, 3167, 23759, 
+    31874, 4093, 9292, 33931, 12440, 40446, 27775, 30669, 21117, 28708, 26084, 43938, 
+    33595, 24458, 25222, 34752, 32045, 34599, 43300, 39127, 32395, 34525, 45498, 41488, 
+    45020, 35629, 45286, 29394, 33209, 38940, 29357, 15754, 8786, 27601, 37817, 29121, 
+    35131, 12222, 22756, 14789, 39691, 8748, 22260, 27120, 6867, 24245, 4356, 12526, 
+    8042, 15100, 40569, 9164, 16982, 42554, 7530, 39318, 31854, 20123, 38744, 28153, 
+    21347, 20406, 26608, 30386, 20800, 41878, 38488, 41213, 45701, 30311, 39540, 33387, 
+    39628, 42743, 44711, 41871, 42050, 35839, 30850, 30677, 31382, 27686, 22544, 20132, 
+    21437, 16756, 23296, 7761, 15975, 13255, 33985, 44930, 36919, 17493, 31008, 22260, 
+    28939, 18789, 34588, 29904, 7896, 30747, 38627, 22269, 17619, 11092, 12531, 14144, 
+    20476, 17639, 24175, 34940, 27802, 39220, 30495, 44279, 44975, 37340, 43568, 22711, 
+    43594, 35777, 39418, 29282, 5537, 16437, 5823, 12987, 18385, 27120, 20481, 3122, 
+    30740, 14951, 19654, 41965, 13551, 19062, 12044, 15813, 28933, 44736, 14973, 13141, 
+    45284, 33698, 40881, 26724, 18639, 38614, 43438, 33902, 22035, 22111, 23585, 28718, 
+    27511, 41198, 33803, 41346, 32673, 38206, 36834, 41946, 37658, 35179, 39638, 45667, 
+    26756, 21766, 12780, 34465, 44629, 22998, 41934, 7700, 16587, 9021, 2818, 6867, 
+    28939, 20481, 17524, 10263, 5676, 1386, 21486, 33822, 2736, 10157, 35743, 9630, 
+    45656, 38056, 25081, 31905, 21610, 25968, 23267, 45349, 30808, 24373, 22454, 35350, 
+    32260, 34913, 44087, 39434, 29945, 43306, 32260, 42686, 41276, 44638, 40071, 43081, 
+    23182, 38879, 37072, 26951, 7851, 14114, 5001, 10590, 15557, 24245, 3122, 17524, 
+    27763, 11931, 16642, 38983, 16325, 16001, 8931, 18396, 25831, 41625, 16348, 11887, 
+    42164, 36287, 37777, 28863, 17319, 35554, 36226, 22585, 21908, 23706, 29946, 27884, 
+    38469, 35399, 38812, 32478, 39318, 36576, 43529, 38348, 44197, 44831, 44616, 29286, 
+    32049, 37022, 33616, 15831, 11589, 24835, 34645, 33114, 31931, 16486, 26711, 18847, 
+    36280, 12614, 4356, 18789, 30740, 10263, 27763, 15844, 11139, 11225, 44021, 11959, 
+    19854, 45856, 5558, 35405, 27837, 15767, 41447, 30261, 17009, 16537, 22308, 31777, 
+    17440, 43811, 40017, 42810, 27691, 35273, 31114, 35510, 39520, 39912, 44842, 25153, 
+    26818, 17177, 40126, 17981, 6913, 11678, 5668, 4450, 12526, 34588, 14951, 5676, 
+    11931, 15844, 4712, 27058, 28181, 4184, 4842, 30072, 14198, 43494, 30011, 26363, 
+    16679, 30710, 27110, 39739, 35227, 20193, 25588, 30302, 27647, 30177, 38865, 34703, 
+    31262, 45002, 32864, 37233, 40847, 38819, 36559, 40972, 27231, 23130, 14160, 35590, 
+    45673, 22451, 42969, 8074, 16063, 8839, 3167, 8042, 29904, 19654, 1386, 16642, 
+    11139, 4712, 22347, 32882, 1356, 8941, 34737, 9822, 38799, 25513, 30704, 20273, 
+    26310, 23240, 44185, 31018, 22989, 22188, 34016, 30888, 33548, 42777, 38067, 29232, 
+    43360, 31403, 42582, 39891, 43258, 41381, 43464, 37084, 37229, 38914, 35222, 25552, 
+    25436, 28404, 42413, 15313, 18295, 15025, 23861, 44215, 21143, 27228, 37837, 29888, 
+    25223, 23759, 15100, 7896, 41965, 21486, 38983, 11225, 27058, 22347, 23098, 30912, 
+    14373, 24228, 16768, 8747, 40626, 10603, 14979, 15740, 41316, 18132, 29358, 28168, 
+    33505, 29738, 44140, 32452, 42467, 30864, 31407, 23876, 42696, 13903, 29912, 18851, 
+    26511, 31874, 40569, 13551, 33822, 16325, 44021, 28181, 32882, 32133, 24475, 2872, 
+    41644, 9496, 18768, 20232, 14523, 22741, 29919, 20918, 17554, 20855, 20594, 19994, 
+    22659, 23154, 29539, 29123, 33520, 30963, 36742, 37988, 40993, 45832, 43263, 43345, 
+    44797, 40051, 37884, 42224, 27909, 24426, 15515, 36596, 22155, 43874, 8792, 15823, 
+    9043, 4093, 9164, 30747, 19062, 2736, 16001, 11959, 4184, 1356, 23098, 32133, 
+    7920, 33909, 10017, 39402, 25827, 29645, 19035, 26534, 23111, 43165, 31100, 21656, 
+    21831, 32776, 29584, 32257, 41571, 36771, 28426, 43270, 30461, 42340, 38542, 41903, 
+    43453, 44754, 27129, 31639, 22015, 44508, 16250, 10901, 10706, 8334, 9292, 16982, 
+    38627, 12044, 10157, 8931, 19854, 4842, 8941, 30912, 24475, 7920, 26110, 17176, 
+    32855, 21763, 11852, 33319, 43647, 28850, 35255, 37395, 15635, 26707, 42907, 25461, 
+    22867, 25363, 34051, 29886, 30575, 40233, 31529, 32626, 42750, 36336, 44073, 33968, 
+    41271, 33735, 30621, 23368, 45083, 16656, 32248, 21319, 28795, 33931, 42554, 15813, 
+    35743, 18396, 45856, 30072, 34737, 2872, 33909, 26110, 43188, 8392, 19149, 17900, 
+    11672, 22546, 27671, 18255, 15792, 19612, 18994, 17348, 20608, 20296, 27631, 26353, 
+    31508, 28091, 34045, 35166, 38150, 43368, 40505, 40514, 41993, 45088, 43116, 34821, 
+    37307, 41836, 35819, 21389, 16211, 29070, 38230, 32170, 35514, 17188, 25823, 18606, 
+    39473, 12440, 7530, 22269, 28933, 9630, 25831, 5558, 14198, 9822, 14373, 41644, 
+    10017, 17176, 43188, 37552, 29824, 15827, 37954, 26257, 16521, 13744, 21205, 27103, 
+    13494, 39460, 35360, 38184, 42491, 22793, 33686, 25964, 33200, 42582, 45243, 42585, 
+    44756, 45440, 42061, 38372, 41761, 44221, 44602, 29269, 32611, 31241, 26409, 23541, 
+    33874, 27578, 22829, 33418, 40894, 16860, 10331, 10351, 7578, 39318, 17619, 45656, 
+    35405, 24228, 37552, 7735, 22660, 22941, 29656, 21752, 33502, 41267, 22606, 45297, 
+    26961, 27109, 30638, 39514, 35284, 45326, 44643, 44693, 45820, 34061, 34083, 33166, 
+    30439, 27064, 31101, 26277, 23853, 27755, 34172, 13421, 12786, 11047, 43994, 11891, 
+    40446, 31854, 11092, 38056, 27837, 43494, 38799, 16768, 39402, 29824, 7735, 15065, 
+    15529, 22441, 15318, 26364, 35054, 20188, 39242, 23956, 33284, 34201, 40439, 39675, 
+    43374, 43147, 43051, 39401, 33783, 32509, 33803, 24044, 25709, 20196, 26085, 23598, 
+    32093, 41575, 34079, 26293, 27775, 20123, 12531, 44736, 25081, 41625, 15767, 30011, 
+    25513, 8747, 25827, 32855, 15827, 22660, 15065, 40508, 1866, 8138, 7143, 39913, 
+    12028, 22438, 20008, 26729, 21143, 44834, 39962, 42080, 41391, 42222, 41948, 36725, 
+    38243, 31346, 42921, 18433, 30260, 20735, 26741, 30669, 38744, 14973, 31905, 16348, 
+    41447, 26363, 30704, 9496, 29645, 21763, 8392, 37954, 12120, 22642, 13586, 14508, 
+    43379, 32203, 21286, 8404, 11367, 11201, 13746, 13863, 41579, 19063, 40045, 20375, 
+    23247, 24470, 27183, 35918, 35619, 35703, 41611, 40662, 42517, 35041, 42478, 43344, 
+    33855, 18640, 22363, 16758, 19230, 21117, 28153, 13141, 21610, 11887, 30261, 16679, 
+    20273, 40626, 18768, 19035, 11852, 19149, 26257, 40508, 12120, 40470, 34741, 34554, 
+    25440, 43396, 5501, 31351, 44214, 33108, 13744, 11095, 13518, 22571, 18036, 30691, 
+    28982, 29910, 21272, 30973, 25215, 36621, 45648, 43102, 44611, 43052, 45807, 44931, 
+    44646, 44249, 40623, 35619, 34209, 35255, 25887, 27287, 21720, 27071, 24659, 33151, 
+    42343, 34988, 27061, 28708, 21347, 14144, 45284, 25968, 42164, 17009, 30710, 26310, 
+    10603, 26534, 33319, 16521, 22941, 15529, 1866, 40470, 7033, 5463, 39601, 10986, 
+    20978, 18444, 25277, 19390, 44121, 38195, 40304, 40155, 40556, 39029, 39409, 35364, 
+    36608, 26731, 19624, 16269, 33837, 39083, 33698, 36287, 20232, 43647, 17900, 22642, 
+    34741, 9774, 36224, 9798, 4533, 24572, 29802, 27589, 18156, 25880, 14346, 32156, 
+    21191, 34487, 17672, 17693, 20707, 28484, 25649, 24608, 25926, 26743, 28017, 30799, 
+    31704, 33370, 34001, 39974, 39984, 45074, 43045, 44268, 40507, 40104, 41869, 29173, 
+    28005, 28215, 34096, 44866, 31663, 30908, 38731, 32072, 34077, 26084, 20406, 20476, 
+    40881, 23267, 37777, 16537, 27110, 23240, 14979, 23111, 28850, 13744, 29656, 22441, 
+    8138, 34554, 7033, 8852, 33163, 3954, 45652, 40705, 43437, 14535, 20163, 18782, 
+    19456, 44796, 33107, 35280, 42868, 40677, 44589, 43774, 40302, 36443, 45297, 28339, 
+    23183, 28269, 42974, 32470, 39452, 43938, 26724, 45349, 28863, 39739, 44185, 14523, 
+    43165, 35255, 11672, 13586, 25440, 9774, 26529, 18809, 7703, 14827, 20050, 17921, 
+    9675, 16705, 9364, 23470, 16312, 26389, 16603, 22814, 23522, 27094, 32983, 29021, 
+    28854, 30382, 34008, 37844, 36675, 38470, 39774, 42212, 45705, 45527, 42032, 39934, 
+    37669, 37605, 31043, 32749, 24609, 27912, 25819, 38184, 39809, 27204, 33595, 26608, 
+    17639, 30808, 22308, 35227, 31018, 15740, 31100, 37395, 21205, 21752, 15318, 7143, 
+    43396, 5463, 8852, 41845, 12239, 19741, 13007, 23925, 14017, 39967, 34818, 36838, 
+    35047, 35099, 41511, 41225, 40394, 45813, 37059, 24126, 26519, 22105, 23674, 24458, 
+    30386, 18639, 24373, 17319, 31777, 20193, 22989, 41316, 22741, 21656, 15635, 22546, 
+    27103, 39913, 14508, 5501, 39601, 36224, 33163, 26529, 41845, 29609, 45232, 33915, 
+    12644, 8260, 11081, 21573, 15436, 27074, 28189, 25701, 17040, 28840, 20701, 35211, 
+    44400, 37936, 39368, 40320, 40349, 43422, 43506, 45609, 31458, 29022, 31934, 38042, 
+    42921, 35598, 30150, 36987, 30873, 38028, 25222, 20800, 24175, 38614, 22454, 35554, 
+    17440, 25588, 22188, 18132, 21831, 26707, 13494, 33502, 26364, 12028, 43379, 31351, 
+    10986, 3954, 12239, 29609, 41992, 36984, 39689, 43226, 11268, 22108, 15374, 20612, 
+    40856, 42275, 30607, 32799, 44802, 41262, 45704, 44011, 31729, 37188, 32444, 40213, 
+    20073, 17667, 18582, 43292, 43438, 29919, 27671, 32203, 44214, 9798, 18809, 45232, 
+    11330, 33015, 38192, 35710, 25249, 33169, 19598, 38492, 24734, 39964, 18591, 11715, 
+    16729, 27543, 16415, 18203, 20914, 20891, 19762, 21617, 24143, 25607, 25652, 34425, 
+    31490, 42726, 37862, 36196, 40536, 33628, 34885, 40331, 45216, 44148, 42350, 43863, 
+    39731, 40803, 30201, 23979, 20786, 34813, 39533, 33902, 36226, 20918, 42907, 18255, 
+    21286, 33108, 4533, 7703, 33915, 11330, 21704, 26901, 24477, 14364, 22258, 9905, 
+    28181, 16661, 30280, 13422, 15833, 17743, 24350, 25400, 22477, 23111, 24259, 26833, 
+    30353, 29951, 31702, 32726, 37030, 38712, 44722, 44074, 42712, 43869, 44514, 42738, 
+    36708, 26268, 35459, 27438, 32089, 34752, 41878, 22035, 35350, 22585, 43811, 30302, 
+    34016, 17554, 32776, 25461, 15792, 39460, 8404, 13744, 24572, 45652, 14827, 12644, 
+    41992, 33015, 21704, 5232, 3365, 9001, 5571, 37891, 15588, 35571, 12012, 17295, 
+    16074, 22939, 33707, 32046, 43929, 44809, 29569, 45023, 38349, 36549, 40407, 38670, 
+    44540, 45818, 44810, 41556, 44769, 27026, 33457, 26907, 30293, 32045, 38488, 22111, 
+    32260, 21908, 40017, 27647, 30888, 20855, 29584, 22867, 19612, 35360, 11367, 11095, 
+    29802, 40705, 20050, 8260, 36984, 38192, 26901, 5232, 2833, 13605, 7217, 32659, 
+    20203, 30378, 10585, 20590, 14727, 26986, 38308, 36184, 39444, 40468, 32250, 42524, 
+    40368, 37710, 42585, 40055, 28212, 35801, 28674, 32558, 34599, 41213, 23585, 34913, 
+    23706, 42810, 30177, 33548, 20594, 32257, 25363, 18994, 38184, 11201, 13518, 27589, 
+    43437, 17921, 11081, 39689, 35710, 24477, 3365, 2833, 10864, 4529, 34980, 17431, 
+    32496, 9344, 17802, 13519, 24153, 35512, 33351, 40564, 41449, 29598, 39690, 37547, 
+    37429, 39759, 44565, 37586, 32822, 31928, 43545, 34463, 40075, 43300, 28718, 44087, 
+    29946, 38865, 42777, 19994, 41571, 34051, 17348, 13746, 22571, 18156, 9675, 21573, 
+    25249, 14364, 9001, 13605, 10864, 7928, 45447, 6619, 42640, 14030, 9525, 16731, 
+    14067, 24754, 23087, 21959, 36142, 29370, 27725, 40973, 29786, 35539, 40331, 36882, 
+    38685, 40647, 39228, 45031, 39704, 31832, 40272, 32802, 36997, 39127, 45701, 27511, 
+    39434, 27884, 34703, 38067, 22659, 36771, 29886, 20608, 42491, 13863, 18036, 25880, 
+    16705, 15436, 43226, 33169, 22258, 5571, 7217, 4529, 7928, 37600, 14036, 34723, 
+    7153, 13414, 10901, 20066, 31797, 29255, 40881, 41519, 25072, 43301, 35590, 33262, 
+    35548, 35512, 42088, 42764, 44516, 43008, 42522, 38989, 42634, 45298, 37218, 41267, 
+    36925, 32395, 30311, 34940, 41198, 29945, 38469, 27691, 31262, 29232, 29358, 28426, 
+    30575, 22793, 41267, 35054, 22438, 41579, 30691, 20978, 14535, 19741, 27074, 11268, 
+    37891, 32659, 34980, 45447, 37600, 23663, 4299, 20197, 33585, 34051, 19829, 22012, 
+    44263, 36945, 34455, 36596, 39814, 43330, 39464, 33883, 30344, 36305, 39623, 45790, 
+    33803, 35399, 45002, 23154, 40233, 20296, 19063, 28982, 14346, 9364, 28189, 19598, 
+    9905, 15588, 20203, 17431, 6619, 14036, 18895, 7210, 20563, 8144, 18136, 16733, 
+    17884, 29533, 22932, 21629, 43207, 23562, 28975, 33717, 30529, 32342, 34191, 33996, 
+    39822, 45069, 45533, 45635, 43931, 43192, 45712, 33049, 32061, 30906, 29978, 39540, 
+    27802, 43306, 35273, 43360, 28168, 43270, 33686, 22606, 20188, 20008, 18444, 20163, 
+    13007, 22108, 23663, 26684, 4506, 30247, 30536, 32082, 22740, 22361, 29264, 30002, 
+    40527, 38837, 34601, 43067, 44667, 43262, 42151, 39194, 42069, 38514, 34525, 33387, 
+    39220, 41346, 32260, 38812, 31114, 32864, 31403, 33505, 30461, 31529, 25964, 45297, 
+    39242, 26729, 40045, 29910, 25277, 18782, 23925, 25701, 15374, 35571, 30378, 32496, 
+    42640, 34723, 4299, 26684, 22844, 30185, 45575, 30322, 16821, 18944, 37481, 30353, 
+    35645, 37421, 41690, 45014, 36344, 36178, 34870, 34239, 45498, 39628, 30495, 42686, 
+    35510, 42582, 29738, 42340, 33200, 26961, 23956, 21143, 19390, 19456, 14017, 20612, 
+    20197, 4506, 22844, 33560, 26054, 27633, 24607, 21377, 44235, 31038, 27366, 37046, 
+    36114, 34583, 44676, 43545, 37473, 43454, 37479, 40452, 41488, 32673, 41276, 32478, 
+    37233, 39891, 29539, 38542, 32626, 27631, 42582, 20375, 21272, 32156, 44796, 23470, 
+    17040, 40856, 38492, 28181, 12012, 10585, 9344, 14030, 7153, 33585, 18895, 30185, 
+    15437, 4186, 22833, 35133, 31560, 34265, 34751, 24571, 37687, 34653, 28472, 37022, 
+    44419, 44215, 45856, 42164, 42905, 44799, 40415, 37377, 41442, 43920, 38206, 39318, 
+    29123, 42750, 26353, 23247, 30973, 21191, 16312, 28840, 24734, 16661, 17295, 20590, 
+    17802, 9525, 13414, 7210, 45575, 15437, 15721, 7411, 19732, 16231, 12477, 31091, 
+    22481, 19888, 36510, 22174, 29141, 34445, 29436, 31167, 33501, 30065, 43102, 38577, 
+    43006, 43059, 44308, 45330, 45484, 41657, 41577, 44297, 45020, 36834, 44638, 36576, 
+    40847, 43258, 33520, 41903, 36336, 31508, 45243, 24470, 25215, 34487, 26389, 20701, 
+    42275, 39964, 30280, 16074, 14727, 13519, 16731, 10901, 34051, 20563, 30322, 4186, 
+    15721, 23036, 35303, 31177, 32177, 32419, 22795, 37044, 33656, 24694, 36046, 43806, 
+    43085, 44641, 39822, 38730, 38388, 35466, 33742, 44351, 41946, 43529, 30963, 28091, 
+    27183, 36621, 17672, 16603, 35211, 18591, 13422, 22939, 26986, 24153, 14067, 20066, 
+    8144, 22833, 7411, 23036, 12322, 9201, 10962, 23700, 15542, 13659, 42082, 15734, 
+    22032, 27205, 22890, 24680, 26773, 25895, 45295, 32173, 38220, 37162, 37917, 39589, 
+    38577, 43834, 39457, 41032, 38201, 42878, 28465, 29053, 30227, 36742, 34045, 35918, 
+    17693, 22814, 11715, 15833, 33707, 38308, 35512, 24754, 31797, 18136, 35133, 19732, 
+    35303, 12322, 5664, 17511, 11511, 6939, 9200, 9337, 11219, 15600, 14139, 15874, 
+    16968, 22886, 22926, 32380, 28889, 28395, 31541, 27703, 37622, 28753, 32131, 41561, 
+    39692, 42775, 42780, 40349, 40729, 45852, 41589, 29285, 41853, 42227, 41542, 45534, 
+    43801, 34830, 36225, 31458, 44279, 27109, 33284, 44834, 44121, 39967, 30247, 33560, 
+    13339, 27574, 12490, 39186, 45218, 25665, 19941, 18222, 28458, 27677, 28419, 33448, 
+    37433, 43905, 34188, 37302, 38657, 43661, 34124, 34340, 34824, 37988, 35166, 35619, 
+    45648, 20707, 23522, 44400, 16729, 17743, 32046, 36184, 33351, 23087, 29255, 16733, 
+    31560, 16231, 31177, 9201, 5664, 11894, 15347, 6341, 5388, 6917, 12911, 18245, 
+    13805, 15614, 17591, 19320, 45408, 23103, 30409, 28383, 28830, 30904, 29381, 35919, 
+    30256, 32103, 41252, 40519, 44030, 44035, 42104, 43187, 42585, 39962, 43102, 38195, 
+    33107, 34818, 37936, 30607, 43929, 39444, 40564, 40881, 19829, 30536, 16821, 26054, 
+    34265, 32177, 2193, 41708, 29072, 18187, 22418, 20877, 26303, 41010, 37882, 38364, 
+    37239, 45462, 44756, 42080, 44611, 40304, 35280, 36838, 39368, 32799, 44809, 40468, 
+    41449, 41519, 22012, 32082, 18944, 27633, 34751, 32419, 2193, 42105, 29059, 16663, 
+    21564, 18992, 24804, 40482, 35898, 36646, 35344, 43508, 42051, 40438, 40949, 37145, 
+    44975, 30638, 34201, 41391, 40155, 42868, 35047, 44802, 44263, 22740, 24607, 13339, 
+    41708, 42105, 14245, 6524, 25972, 38859, 32578, 16072, 20333, 22188, 22646, 38602, 
+    42804, 27663, 30421, 35843, 43144, 40202, 45734, 43767, 45952, 45122, 44278, 40993, 
+    38150, 35703, 43052, 28484, 27094, 40320, 27543, 24350, 29569, 32250, 29598, 21959, 
+    25072, 17884, 24571, 12477, 22795, 10962, 17511, 11894, 26293, 15904, 11801, 35036, 
+    14087, 22320, 27873, 20628, 22060, 24870, 17946, 34748, 28839, 31046, 42778, 32253, 
+    34327, 34251, 36813, 36587, 37356, 36477, 44394, 45827, 30251, 44533, 39448, 23557, 
+    29061, 33138, 45832, 43368, 25649, 32983, 16415, 25400, 45023, 36142, 43301, 29533, 
+    31091, 23700, 11511, 15347, 26293, 10450, 14741, 12834, 5663, 5203, 10613, 11316, 
+    10151, 23165, 15483, 27808, 21878, 19825, 24503, 17409, 32074, 18621, 24004, 33342, 
+    39881, 29951, 32462, 32467, 43759, 29598, 29464, 35834, 34345, 40378, 32273, 34837, 
+    36779, 43263, 40505, 41611, 24608, 29021, 18203, 22477, 38349, 42524, 39690, 29370, 
+    35590, 22932, 37687, 22481, 37044, 15542, 6939, 6341, 15904, 10450, 4318, 2914, 
+    6763, 12283, 7690, 9503, 11277, 16235, 16922, 25486, 22496, 22609, 25093, 23049, 
+    30796, 23916, 26035, 44503, 35325, 41204, 34247, 37706, 37711, 35766, 36934, 43024, 
+    42984, 39514, 40439, 42222, 40556, 40677, 35099, 41262, 36945, 22361, 37481, 21377, 
+    27574, 29072, 29059, 14245, 43079, 17417, 11913, 24874, 19537, 13985, 27898, 31831, 
+    23129, 28512, 31714, 38746, 32944, 36953, 41884, 42851, 44683, 36342, 38142, 39392, 
+    43345, 40514, 40662, 25926, 28854, 20914, 23111, 36549, 40368, 37547, 27725, 33262, 
+    21629, 34653, 19888, 33656, 13659, 9200, 5388, 11801, 14741, 4318, 2390, 10522, 
+    16084, 9583, 11285, 13746, 14050, 42311, 18695, 25068, 44892, 23503, 24434, 25938, 
+    25823, 30607, 26541, 27401, 43762, 36337, 41804, 36185, 39925, 39929, 38367, 39995, 
+    45902, 45807, 40349, 45704, 40407, 37710, 37429, 40973, 35548, 34455, 43207, 30353, 
+    44235, 28472, 36510, 24694, 42082, 18187, 16663, 35036, 43079, 32738, 22982, 31281, 
+    43992, 21379, 39208, 35750, 42069, 41373, 41817, 45065, 42996, 35137, 37707, 39469, 
+    44797, 41993, 42517, 26743, 30382, 20891, 24259, 38670, 42585, 39759, 29786, 35512, 
+    23562, 37022, 22174, 36046, 15734, 9337, 6917, 14087, 12834, 2914, 2390, 8260, 
+    13792, 7262, 9004, 11381, 13560, 43426, 16468, 23639, 44846, 21507, 22215, 24005, 
+    23450, 29092, 24185, 25308, 42530, 34373, 39992, 33961, 37645, 37649, 45886, 36022, 
+    37608, 43529, 44040, 38521, 44535, 45380, 41161, 35284, 39675, 41511, 29264, 31038, 
+    12490, 6524, 17417, 28016, 40358, 33146, 13223, 13811, 15883, 17580, 36866, 41502, 
+    21235, 23898, 29322, 37440, 33680, 39266, 38214, 40915, 44589, 41225, 44011, 36596, 
+    30002, 35645, 27366, 39186, 22418, 21564, 25972, 11913, 32738, 28016, 12961, 8839, 
+    19289, 42896, 35434, 40227, 26858, 20670, 22389, 30437, 38334, 42789, 42725, 35621, 
+    45081, 29213, 34172, 37598, 45088, 28017, 34008, 19762, 26833, 44540, 35539, 42088, 
+    28975, 44419, 29141, 43806, 22032, 11219, 12911, 22320, 5663, 6763, 10522, 8260, 
+    5572, 5034, 6053, 5986, 17507, 11969, 23117, 18220, 17242, 20903, 16662, 27825, 
+    17643, 21112, 41955, 30584, 36864, 28475, 45197, 31628, 31633, 41630, 29391, 30279, 
+    36443, 36223, 39814, 40527, 37421, 37046, 20877, 18992, 38859, 24874, 22982, 40358, 
+    12961, 8353, 29690, 29952, 45604, 35086, 17928, 16363, 24626, 45668, 43134, 45104, 
+    40360, 42253, 45596, 42553, 31397, 42585, 26635, 33489, 38036, 30799, 37844, 21617, 
+    30353, 40331, 33717, 34445, 27205, 15600, 18245, 27873, 5203, 12283, 16084, 13792, 
+    5572, 8712, 8553, 6303, 20989, 10677, 23474, 16986, 14661, 19555, 12359, 27367, 
+    13526, 18865, 41451, 28159, 34719, 24816, 45408, 42606, 27479, 27485, 38568, 24816, 
+    43704, 44670, 25176, 44387, 31458, 30784, 42100, 44313, 43570, 39987, 34156, 39148, 
+    42320, 31704, 36675, 24143, 29951, 45818, 36882, 42764, 30529, 44215, 29436, 43085, 
+    22890, 14139, 13805, 20628, 10613, 7690, 9583, 7262, 5034, 8712, 1816, 4248, 
+    12617, 45512, 9298, 18594, 43322, 14831, 15033, 17452, 44600, 16302, 23614, 16975, 
+    18351, 37604, 27639, 33577, 26752, 43247, 42149, 30389, 30393, 39036, 28785, 44148, 
+    45010, 30552, 45793, 36365, 37278, 43330, 38837, 41690, 36114, 45218, 26303, 24804, 
+    32578, 19537, 31281, 33146, 8839, 8353, 21663, 36765, 37367, 42599, 26733, 12718, 
+    13656, 21899, 38333, 42858, 40741, 41343, 38384, 39986, 34601, 34583, 25665, 41010, 
+    40482, 16072, 13985, 13223, 19289, 29690, 21663, 16197, 21186, 9149, 23665, 28379, 
+    32829, 19514, 23815, 28384, 29402, 32383, 36127, 44190, 39948, 34690, 40192, 43624, 
+    33370, 38470, 25607, 31702, 38685, 44516, 32342, 45856, 31167, 44641, 24680, 15874, 
+    15614, 22060, 11316, 9503, 11285, 9004, 6053, 8553, 1816, 2978, 12436, 45599, 
+    7495, 17135, 42530, 13044, 13237, 15678, 43588, 14763, 22023, 15369, 16535, 36080, 
+    25834, 31803, 24969, 41555, 40357, 28645, 28650, 37222, 27130, 42335, 43199, 29050, 
+    43978, 34778, 35931, 45650, 37473, 32899, 39203, 43161, 34001, 39774, 25652, 32726, 
+    40647, 34191, 33501, 26773, 16968, 17591, 24870, 10151, 11277, 13746, 11381, 5986, 
+    6303, 4248, 2978, 14983, 5997, 17657, 44171, 12244, 11453, 14926, 44865, 12081, 
+    22058, 12805, 15182, 36220, 24642, 30884, 22986, 41057, 39252, 26440, 26445, 35795, 
+    24653, 40945, 41846, 26309, 45436, 42300, 32158, 33050, 43028, 45692, 45019, 39974, 
+    42212, 34425, 37030, 39228, 43008, 33996, 42164, 30065, 39822, 25895, 22886, 19320, 
+    17946, 23165, 16235, 14050, 43992, 13560, 17507, 20989, 12617, 12436, 14983, 33231, 
+    15151, 13114, 31427, 15847, 36587, 19239, 38965, 17257, 33489, 23793, 18641, 23789, 
+    20064, 39659, 30416, 26851, 30918, 29534, 44322, 38075, 39548, 33885, 33888, 38078, 
+    33882, 42674, 43314, 37252, 45571, 41903, 44988, 42905, 43102, 38730, 45295, 45408, 
+    37882, 35898, 34748, 42311, 21379, 43426, 42896, 29952, 45512, 36765, 45599, 33231, 
+    37207, 32202, 34088, 37971, 20017, 45385, 20652, 24033, 45147, 25628, 39895, 31283, 
+    36786, 42571, 35728, 39152, 38067, 43559, 34070, 43067, 44676, 19941, 20333, 27898, 
+    13811, 35434, 45604, 37367, 16197, 5374, 11948, 35931, 41021, 42775, 7903, 10088, 
+    15511, 26117, 19869, 25565, 38710, 27999, 30123, 33831, 39164, 41222, 45859, 28707, 
+    45326, 44667, 18222, 22188, 31831, 15883, 40227, 42599, 21186, 5374, 17274, 41267, 
+    10435, 10227, 15247, 29093, 19336, 25709, 39261, 23322, 25697, 31044, 35590, 36998, 
+    44035, 40509, 45972, 43262, 43545, 28458, 22646, 23129, 17580, 26858, 35086, 26733, 
+    9149, 11948, 17274, 23992, 29085, 31075, 11670, 16199, 20053, 20773, 41340, 23774, 
+    27072, 43111, 37842, 38258, 39850, 40286, 38364, 36646, 38602, 28512, 39208, 36866, 
+    20670, 17928, 12718, 23665, 37207, 35931, 41267, 23992, 5094, 10235, 34031, 45256, 
+    38220, 40963, 41443, 30700, 40028, 30065, 28275, 27656, 42179, 45194, 40352, 41875, 
+    37818, 42576, 45999, 37239, 35344, 42804, 31714, 35750, 41502, 22389, 16363, 13656, 
+    28379, 32202, 41021, 29085, 5094, 8452, 39044, 40434, 43182, 36296, 36994, 43489, 
+    27420, 44788, 27695, 32017, 26630, 41927, 38213, 45993, 38416, 43351, 39513, 36731, 
+    44159, 39984, 45705, 31490, 38712, 39822, 38577, 32173, 22926, 23103, 28839, 15483, 
+    16922, 18695, 16468, 11969, 10677, 9298, 7495, 5997, 15151, 13054, 40813, 6404, 
+    5747, 9057, 40824, 8681, 16690, 8841, 9205, 43430, 30790, 18650, 24896, 17494, 
+    43852, 35176, 33257, 21273, 21277, 29871, 20088, 35010, 35900, 22641, 39555, 36516, 
+    40694, 27955, 30086, 38768, 41718, 41109, 45462, 43508, 38746, 42069, 30437, 24626, 
+    21899, 32829, 34088, 42775, 31075, 10235, 8452, 39134, 37548, 42755, 32784, 32678, 
+    39553, 20645, 43228, 19847, 27975, 18182, 43677, 44348, 35064, 30211, 42329, 30318, 
+    35311, 43007, 42724, 36876, 27677, 27663, 32944, 21235, 38334, 38333, 19514, 7903, 
+    10435, 11670, 34031, 39044, 39134, 4531, 8940, 18702, 44860, 13140, 18097, 42281, 
+    43918, 30937, 41090, 26987, 28351, 28934, 35295, 38546, 42726, 43006, 38220, 32380, 
+    30409, 31046, 27808, 25486, 25068, 23639, 23117, 23474, 18594, 17135, 17657, 13114, 
+    37971, 13054, 28105, 8085, 33214, 12617, 34479, 7213, 27789, 18734, 5626, 17994, 
+    10555, 30770, 19048, 42577, 14258, 17807, 18744, 32870, 25533, 26441, 23127, 23129, 
+    25092, 24371, 29584, 30209, 42024, 28812, 34506, 32633, 36395, 32025, 36868, 41603, 
+    45163, 44772, 42778, 44892, 41373, 44846, 45668, 43322, 42530, 44171, 31427, 20017, 
+    45256, 40434, 40813, 37548, 28105, 36140, 5250, 40574, 7672, 34706, 5636, 27064, 
+    22514, 45831, 37659, 28288, 35919, 15844, 20741, 21264, 30129, 35221, 32471, 42638, 
+    26665, 28686, 35972, 39117, 38373, 40292, 40116, 39661, 43872, 44894, 43986, 42439, 
+    37862, 44722, 45069, 43059, 37162, 28889, 28383, 32253, 21878, 22496, 23503, 21507, 
+    18220, 16986, 14831, 13044, 12244, 15847, 45385, 6404, 8085, 36140, 41207, 4566, 
+    42321, 2682, 35518, 10655, 10521, 9968, 4269, 37346, 24481, 12869, 18767, 13760, 
+    37448, 28816, 27319, 18061, 18065, 24384, 18144, 29438, 30269, 44566, 21942, 34152, 
+    31427, 35533, 26141, 29924, 36509, 39811, 39308, 44234, 33579, 28419, 30421, 36953, 
+    23898, 42789, 42858, 23815, 10088, 10227, 16199, 38220, 43182, 42755, 4531, 5429, 
+    19873, 9782, 15706, 42822, 43901, 29145, 39931, 22652, 23891, 24651, 30831, 34014, 
+    43219, 43532, 45219, 41817, 43134, 36587, 20652, 40963, 36296, 32784, 33214, 5250, 
+    41207, 45595, 3514, 39675, 7293, 31848, 17301, 42543, 23126, 30716, 15815, 23907, 
+    17962, 25756, 39464, 43388, 36104, 27118, 30865, 38572, 42222, 37082, 42799, 42499, 
+    39756, 44696, 45947, 39646, 38782, 45074, 36196, 44074, 45533, 44308, 37917, 28395, 
+    28830, 34327, 19825, 22609, 24434, 22215, 17242, 14661, 15033, 13237, 11453, 19239, 
+    5747, 12617, 40574, 4566, 45595, 6013, 39724, 6129, 14286, 5402, 4242, 40882, 
+    27651, 13530, 20058, 11751, 39914, 30802, 28082, 15613, 15618, 24388, 14809, 29545, 
+    30465, 45802, 18026, 33991, 30855, 35043, 22806, 25865, 33486, 44266, 36593, 36030, 
+    41331, 45065, 45104, 38965, 24033, 41443, 36994, 32678, 34479, 7672, 42321, 3514, 
+    40598, 6963, 32532, 15343, 43296, 20904, 28612, 13308, 23110, 14451, 22549, 39402, 
+    40675, 35483, 24568, 29227, 44171, 37121, 41106, 33800, 41245, 40865, 36930, 41265, 
+    44090, 45833, 45630, 44648, 40536, 45330, 39589, 31541, 30904, 34251, 24503, 25093, 
+    25938, 24005, 20903, 19555, 17452, 15678, 14926, 17257, 45147, 9057, 7213, 34706, 
+    2682, 39675, 6013, 40598, 33721, 12041, 8298, 11127, 3366, 35034, 21999, 10406, 
+    16125, 12382, 34817, 26137, 24725, 16788, 16791, 21967, 17465, 26969, 27777, 41898, 
+    21701, 31734, 29139, 33202, 25323, 29754, 45808, 35370, 44851, 38793, 38338, 42973, 
+    44600, 43588, 44865, 33489, 25628, 43489, 40824, 39553, 27789, 5636, 35518, 7293, 
+    39724, 6963, 33721, 45741, 25602, 22018, 44749, 36368, 27289, 35022, 10227, 16623, 
+    17205, 27093, 32515, 28873, 40113, 21062, 23744, 31345, 43214, 43213, 34931, 32869, 
+    35601, 35337, 34038, 41263, 38903, 40219, 41555, 33599, 33493, 42893, 43045, 33628, 
+    42712, 45635, 45484, 38577, 27703, 29381, 36813, 17409, 23049, 25823, 23450, 16662, 
+    12359, 16302, 14763, 12081, 23793, 8681, 18734, 10655, 6129, 12041, 45741, 20183, 
+    1320, 9513, 32965, 17263, 23908, 12605, 44436, 34987, 31044, 15129, 15134, 26622, 
+    12737, 31691, 32685, 14294, 35660, 32096, 36259, 20079, 21463, 45549, 30947, 42761, 
+    33638, 32979, 38825, 45209, 43834, 37622, 35919, 36587, 32074, 30796, 30607, 29092, 
+    27825, 27367, 23614, 22023, 22058, 18641, 39895, 16690, 5626, 27064, 10521, 31848, 
+    14286, 32532, 8298, 25602, 20183, 19157, 10766, 26825, 14163, 38876, 10166, 12433, 
+    16358, 27674, 19972, 20934, 20444, 20446, 20004, 22575, 42135, 24254, 24823, 36426, 
+    27472, 29173, 27564, 31176, 29593, 44260, 35375, 45339, 38313, 45692, 42000, 41701, 
+    45299, 40360, 40741, 31283, 30700, 27420, 20645, 22514, 17301, 15343, 22018, 5969, 
+    39906, 13416, 23526, 36392, 14526, 13283, 26765, 32406, 40075, 30961, 41163, 35010, 
+    41774, 39429, 34603, 34746, 44205, 44268, 34885, 43869, 39457, 28753, 30256, 37356, 
+    18621, 23916, 26541, 24185, 17643, 13526, 16975, 15369, 12805, 23789, 8841, 17994, 
+    45831, 9968, 5402, 11127, 44749, 1320, 19157, 8421, 45218, 31762, 15954, 22595, 
+    11348, 43141, 33679, 29730, 14027, 14032, 25330, 11860, 30409, 31400, 13837, 34413, 
+    30878, 35048, 19409, 21261, 44566, 30280, 41919, 33071, 32433, 38169, 44470, 43013, 
+    42802, 40331, 41032, 32131, 32103, 36477, 24004, 26035, 27401, 25308, 21112, 18865, 
+    18351, 16535, 15182, 20064, 9205, 10555, 37659, 4269, 42543, 4242, 43296, 3366, 
+    36368, 9513, 10766, 8421, 36929, 23579, 9474, 15890, 9495, 35677, 26566, 24086, 
+    13821, 13825, 20693, 14182, 25820, 26701, 41700, 18339, 30413, 27502, 31651, 22105, 
+    26391, 43571, 32329, 42243, 35684, 35203, 40017, 45544, 34711, 33448, 35843, 41884, 
+    29322, 28384, 15511, 15247, 20053, 40028, 44788, 43228, 8940, 5429, 17645, 45029, 
+    4362, 10462, 39267, 39841, 24031, 35085, 21469, 21980, 20233, 41007, 27015, 45959, 
+    30979, 38944, 42708, 41472, 45907, 42253, 41343, 36786, 30065, 27695, 19847, 28288, 
+    23126, 20904, 27289, 5969, 34921, 7735, 27170, 40531, 16313, 10552, 20832, 34599, 
+    43088, 25134, 41265, 35264, 34494, 42337, 37473, 44601, 42106, 43144, 42851, 37440, 
+    42725, 45596, 38384, 29402, 26117, 29093, 20773, 28275, 32017, 27975, 18702, 19873, 
+    39906, 17645, 34921, 27394, 17263, 39919, 14355, 23663, 25779, 18787, 25400, 38333, 
+    38133, 31421, 35092, 39159, 45931, 44708, 42553, 39986, 42571, 41340, 27656, 26630, 
+    18182, 44860, 35919, 30716, 28612, 35022, 13416, 45029, 7735, 27394, 34376, 44175, 
+    22847, 14101, 39494, 14706, 40741, 19535, 33931, 29048, 38108, 39214, 39166, 40281, 
+    39659, 35728, 43430, 43677, 30770, 15844, 37346, 15815, 40882, 13308, 35034, 10227, 
+    26825, 23526, 45218, 36929, 27170, 34376, 13546, 12103, 22898, 30554, 42477, 25208, 
+    38018, 11310, 16751, 44565, 24784, 40177, 40175, 29353, 43957, 22766, 28653, 28153, 
+    24027, 31414, 31060, 33144, 33655, 36321, 37056, 38754, 41372, 43111, 44362, 44503, 
+    43762, 42530, 41955, 41451, 37604, 36080, 36220, 30416, 39152, 30790, 19048, 20741, 
+    24481, 23907, 27651, 23110, 21999, 16623, 32965, 14163, 36392, 31762, 23579, 40531, 
+    13546, 25572, 36263, 17087, 12391, 24645, 13956, 9258, 15415, 27173, 27172, 18400, 
+    30755, 28763, 19759, 19709, 24833, 37951, 35868, 23776, 24306, 26370, 35437, 35110, 
+    37123, 39649, 39812, 41078, 41605, 42712, 42185, 41413, 40897, 43949, 44636, 44631, 
+    35779, 37433, 40202, 33680, 32383, 19869, 19336, 23774, 42179, 44348, 13140, 9782, 
+    4362, 17263, 44175, 6676, 36996, 37068, 20208, 31517, 21078, 20933, 16829, 36879, 
+    24068, 41605, 28669, 42638, 35458, 39336, 39842, 38067, 45194, 41927, 35064, 42577, 
+    21264, 17962, 14451, 17205, 38876, 14526, 16313, 22847, 12103, 25572, 10826, 42407, 
+    30442, 36689, 18301, 26892, 32798, 34590, 39664, 42857, 21371, 37839, 37122, 27315, 
+    27553, 39026, 41931, 41375, 38812, 39154, 38705, 39461, 42545, 43309, 43935, 45905, 
+    43559, 40352, 38213, 30211, 30129, 25756, 22549, 27093, 13283, 10552, 39919, 14101, 
+    22898, 36263, 10826, 19620, 27175, 36533, 22192, 41085, 43755, 32426, 24318, 45650, 
+    32783, 26928, 39746, 33083, 43062, 41683, 41578, 39999, 41057, 41561, 41252, 44394, 
+    33342, 35325, 36337, 34373, 30584, 28159, 27639, 25834, 24642, 26851, 18650, 14258, 
+    35221, 12869, 39464, 13530, 39402, 10406, 32515, 17263, 10166, 15954, 9474, 30554, 
+    17087, 42407, 6661, 7633, 27232, 17725, 14613, 10911, 10911, 11564, 13939, 39922, 
+    16573, 17400, 32272, 19080, 21328, 18839, 22844, 19969, 37542, 40662, 43687, 40851, 
+    41285, 40779, 26484, 38323, 36009, 28177, 35804, 31885, 31613, 42287, 35138, 42837, 
+    39657, 42891, 42940, 45291, 41409, 43905, 45734, 39266, 36127, 25565, 25709, 27072, 
+    41875, 45993, 42329, 18097, 15706, 10462, 14355, 39494, 6676, 30948, 30651, 13595, 
+    24842, 25743, 24883, 17069, 30601, 24806, 42449, 36819, 30411, 39053, 34461, 38532, 
+    42348, 43111, 37818, 38416, 30318, 42281, 42822, 43388, 40675, 26765, 39267, 20832, 
+    23663, 14706, 42477, 36996, 30442, 19620, 30948, 45170, 5029, 21512, 14468, 37114, 
+    34413, 43763, 24485, 29250, 40876, 42256, 36591, 39712, 45192, 39881, 41204, 41804, 
+    39992, 36864, 34719, 33577, 31803, 30884, 30918, 24896, 17807, 32471, 18767, 36104, 
+    20058, 35483, 16125, 28873, 23908, 12433, 22595, 15890, 25208, 12391, 36689, 6661, 
+    13140, 20716, 11113, 8748, 14971, 14969, 7852, 18786, 33277, 11821, 12408, 25852, 
+    41653, 23798, 16741, 15306, 18768, 23046, 32174, 35095, 38061, 35931, 36616, 36419, 
+    30363, 34973, 33221, 29104, 34255, 32882, 32787, 40193, 35083, 40775, 38511, 41261, 
+    41556, 43540, 41527, 44296, 39692, 40519, 45827, 29951, 34247, 36185, 33961, 28475, 
+    24816, 26752, 24969, 22986, 29534, 17494, 18744, 42638, 13760, 11751, 12382, 40113, 
+    12605, 16358, 11348, 9495, 38018, 24645, 7633, 13140, 33694, 24009, 18846, 4418, 
+    4421, 14114, 6381, 45144, 19118, 20123, 36594, 11493, 23066, 19581, 23768, 13344, 
+    39488, 42864, 45919, 41958, 41990, 41046, 19129, 37322, 34412, 23004, 32785, 26479, 
+    26058, 39623, 30593, 40120, 36049, 39692, 39473, 42149, 45793, 45489, 44322, 43852, 
+    32870, 26665, 37448, 27118, 39914, 24568, 34817, 21062, 44436, 27674, 32406, 43141, 
+    35677, 34599, 40741, 11310, 13956, 18301, 27175, 27232, 45170, 20716, 33694, 9687, 
+    45925, 16585, 34622, 34619, 21853, 38724, 14836, 19568, 18829, 13035, 24045, 43361, 
+    20859, 23634, 23309, 40723, 40791, 25143, 26155, 28129, 38266, 38400, 30190, 31880, 
+    33075, 38981, 35851, 36413, 42492, 44017, 40876, 43779, 45808, 44072, 45344, 44644, 
+    45420, 45408, 43247, 41555, 41057, 38075, 35176, 25533, 28686, 28816, 30865, 30802, 
+    29227, 26137, 23744, 34987, 19972, 40075, 33679, 26566, 43088, 16751, 9258, 26892, 
+    36533, 17725, 11113, 24009, 9687, 8033, 25025, 25022, 12805, 29099, 22574, 12022, 
+    11649, 16537, 31349, 33825, 15190, 16606, 17841, 31686, 25953, 28136, 30788, 43922, 
+    43758, 30587, 31826, 32351, 42630, 39388, 33160, 32661, 34812, 45582, 35806, 43029, 
+    38380, 38529, 40336, 38926, 40933, 40393, 42139, 42833, 44065, 42576, 43351, 35311, 
+    43918, 43901, 44171, 30961, 39841, 25134, 25779, 19535, 44565, 37068, 32798, 22192, 
+    30651, 5029, 45925, 19450, 10368, 36277, 32322, 41716, 19654, 25036, 37084, 38483, 
+    31565, 45830, 34952, 40349, 42993, 41772, 42857, 38710, 39261, 37842, 45999, 43007, 
+    30937, 29145, 24031, 41265, 18787, 33931, 20208, 41085, 13595, 21512, 19450, 11555, 
+    35917, 34092, 22333, 17521, 35828, 28913, 30419, 27161, 43602, 35392, 43047, 36874, 
+    32070, 33674, 37659, 45197, 42606, 42149, 40357, 39252, 39548, 33257, 26441, 35972, 
+    27319, 38572, 28082, 37121, 24725, 31345, 31044, 20934, 29730, 24086, 24784, 15415, 
+    34590, 43755, 14613, 8748, 18846, 16585, 8033, 18692, 18688, 5353, 22838, 26324, 
+    4344, 4385, 17873, 34020, 27134, 8725, 8923, 11167, 24210, 23434, 26351, 29325, 
+    44335, 43894, 27294, 28083, 28056, 41276, 31951, 27392, 26220, 26779, 42384, 28537, 
+    38200, 30354, 30497, 33673, 31088, 34270, 33065, 35189, 35739, 37277, 43252, 42455, 
+    44705, 40350, 44456, 42775, 44030, 32462, 37706, 39925, 37645, 31628, 27479, 30389, 
+    28645, 26440, 33885, 21273, 23127, 18061, 15613, 16788, 43214, 15129, 20444, 14027, 
+    13821, 40177, 27173, 10911, 14971, 4418, 34622, 25025, 18692, 5, 13455, 4148, 
+    44843, 17931, 18967, 35803, 8863, 21183, 17360, 21419, 9155, 37247, 40704, 43732, 
+    39263, 39108, 37983, 15656, 33794, 30704, 18588, 28662, 45218, 22065, 21652, 35546, 
+    26205, 36026, 31779, 35488, 35217, 37948, 45288, 41466, 44170, 41712, 40354, 44461, 
+    42780, 44035, 32467, 37711, 39929, 37649, 31633, 27485, 30393, 28650, 26445, 33888, 
+    21277, 23129, 18065, 15618, 16791, 43213, 15134, 20446, 14032, 13825, 40175, 27172, 
+    10911, 14969, 4421, 34619, 25022, 18688, 5, 13451, 4152, 44839, 17926, 18963, 
+    35798, 8865, 21177, 17354, 21414, 9154, 37242, 40699, 43727, 39258, 39103, 37978, 
+    15657, 33789, 30699, 18585, 28658, 45213, 22062, 21650, 35542, 26202, 36022, 31775, 
+    35484, 35213, 37944, 45283, 41462, 44166, 41712, 43759, 45886, 41630, 38568, 39036, 
+    37222, 35795, 38078, 29871, 25092, 39117, 24384, 42222, 24388, 41106, 21967, 34931, 
+    26622, 20004, 25330, 20693, 29353, 18400, 39664, 11564, 7852, 14114, 21853, 12805, 
+    5353, 13455, 13451, 17587, 31401, 5159, 6104, 22537, 38726, 21790, 9769, 7562, 
+    11352, 18961, 26112, 29331, 32379, 29292, 29727, 29273, 44098, 26695, 27291, 25403, 
+    22576, 44015, 26471, 38654, 26283, 26319, 32342, 27805, 32924, 30795, 33443, 33776, 
+    35706, 42241, 40550, 45178, 42979, 36233, 40385, 45216, 40349, 42104, 29598, 35766, 
+    38367, 36022, 29391, 24816, 28785, 27130, 24653, 33882, 20088, 24371, 18144, 14809, 
+    17465, 12737, 22575, 11860, 14182, 43957, 30755, 13939, 18786, 6381, 38724, 29099, 
+    22838, 4148, 4152, 17587, 21957, 22992, 39844, 5143, 24960, 21033, 24968, 8023, 
+    40730, 44216, 42429, 42125, 40845, 12804, 36178, 32869, 18699, 30059, 21791, 21242, 
+    36977, 26569, 37413, 32689, 36583, 36140, 39028, 42051, 44775, 39222, 45459, 42724, 
+    41090, 39931, 41163, 35085, 35264, 25400, 29048, 31517, 42857, 32426, 24842, 14468, 
+    10368, 11555, 43139, 37275, 45033, 32638, 11082, 24997, 37575, 38957, 38214, 24572, 
+    25670, 35953, 44657, 37047, 33678, 33053, 39753, 42278, 43296, 44007, 43804, 44867, 
+    41863, 16578, 34188, 43767, 38214, 44190, 27999, 23322, 38258, 26987, 22652, 21469, 
+    38333, 21078, 25743, 35917, 3191, 15528, 15177, 44757, 14211, 41145, 27227, 29560, 
+    43957, 21107, 42584, 32995, 26851, 39797, 25786, 38373, 37082, 33800, 32869, 42135, 
+    35010, 34494, 38108, 22766, 28763, 21371, 24318, 39922, 37114, 33277, 45144, 14836, 
+    22574, 36277, 26324, 44843, 44839, 31401, 43139, 27141, 26123, 9740, 9213, 25478, 
+    29423, 44060, 26883, 26064, 18753, 17638, 18118, 23941, 24276, 23116, 25138, 44739, 
+    27105, 26406, 32377, 34502, 40380, 33504, 40484, 36372, 41118, 41586, 44439, 43872, 
+    45160, 44659, 43704, 44148, 42335, 40945, 42674, 35010, 29584, 40292, 29438, 42799, 
+    29545, 41245, 26969, 35601, 31691, 24254, 30409, 25820, 28653, 19759, 37839, 16573, 
+    11821, 19118, 19568, 12022, 4344, 17931, 17926, 5159, 21957, 27141, 1036, 17888, 
+    33991, 25685, 4923, 4618, 7060, 21874, 20991, 24181, 27227, 42878, 42302, 24334, 
+    24891, 24612, 38981, 29539, 23366, 21996, 23049, 39224, 24193, 34422, 26511, 26717, 
+    29380, 26909, 29976, 28725, 30856, 31396, 32961, 39028, 38118, 42117, 40380, 45892, 
+    44670, 45010, 43199, 41846, 43314, 35900, 30209, 40116, 30269, 42499, 30465, 40865, 
+    27777, 35337, 32685, 24823, 31400, 26701, 28153, 19709, 37122, 45650, 17400, 12408, 
+    20123, 18829, 11649, 4385, 18967, 18963, 6104, 22992, 26123, 1036, 16853, 32956, 
+    26703, 4413, 4992, 6784, 22828, 20142, 23293, 26333, 41918, 41356, 23600, 24220, 
+    24020, 38128, 30472, 23043, 21836, 23699, 38557, 24310, 33970, 27107, 27339, 29309, 
+    27305, 29907, 28870, 30874, 31461, 32933, 38868, 38152, 41990, 40371, 45693, 42024, 
+    39661, 44566, 39756, 45802, 36930, 41898, 34038, 36426, 41774, 41700, 42337, 24027, 
+    24833, 27315, 32783, 32272, 25852, 36594, 13035, 16537, 17873, 35803, 35798, 22537, 
+    39844, 9740, 17888, 16853, 16194, 43455, 15783, 19770, 17144, 33180, 39066, 12363, 
+    13120, 15177, 27406, 27222, 17398, 19211, 20674, 26507, 24629, 26110, 44340, 37069, 
+    30990, 31672, 31132, 39671, 40174, 33310, 37600, 33834, 35889, 35892, 37061, 37035, 
+    44249, 40234, 42554, 43559, 43896, 45769, 44696, 41265, 41263, 39429, 37473, 39214, 
+    31414, 37951, 27553, 26928, 34413, 41653, 24045, 31349, 32322, 34020, 38726, 37275, 
+    9213, 33991, 32956, 16194, 31280, 35328, 36352, 32036, 17205, 19449, 16824, 15666, 
+    15329, 15914, 22244, 24170, 35721, 26429, 19767, 45677, 32802, 35725, 31297, 28353, 
+    42130, 37628, 44705, 33556, 41084, 41449, 40680, 45435, 43963, 39067, 45379, 44195, 
+    39918, 44536, 31761, 37010, 44148, 40729, 43187, 29464, 36934, 39995, 37608, 30279, 
+    25176, 30552, 29050, 26309, 37252, 22641, 28812, 21942, 18026, 21701, 14294, 27472, 
+    13837, 18339, 35868, 19080, 23798, 11493, 43361, 33825, 27134, 8863, 8865, 21790, 
+    5143, 25685, 26703, 43455, 28034, 23995, 27598, 6395, 42983, 44087, 43534, 42019, 
+    8057, 36703, 33152, 16936, 29384, 19391, 18711, 36183, 24727, 36554, 31331, 35370, 
+    34724, 37749, 45111, 40125, 42833, 34427, 43216, 40316, 44885, 45140, 43698, 18886, 
+    37302, 40915, 30123, 25697, 39850, 28351, 23891, 21980, 38133, 20933, 24883, 34092, 
+    45033, 3191, 12875, 45161, 11987, 41652, 11388, 37955, 24115, 26566, 41024, 19657, 
+    40302, 44555, 32349, 26823, 39475, 27110, 45436, 39555, 34506, 43872, 34152, 45947, 
+    33991, 44090, 31734, 38903, 35660, 29173, 34413, 30413, 31060, 23776, 39026, 21328, 
+    16741, 23066, 20859, 15190, 8725, 21183, 21177, 9769, 24960, 25478, 4923, 4413, 
+    15783, 31280, 28034, 4049, 2653, 23321, 16481, 19810, 22867, 38832, 38163, 19524, 
+    20005, 19690, 34420, 30644, 18668, 17638, 22070, 34329, 20666, 29559, 25151, 25509, 
+    25228, 24503, 25826, 25263, 26955, 27644, 28919, 34632, 34246, 37795, 36371, 41407, 
+    43907, 45658, 44387, 45793, 43978, 42300, 45571, 36516, 32633, 44894, 31427, 30855, 
+    45833, 29139, 40219, 32096, 27564, 30878, 27502, 33144, 24306, 41931, 18839, 15306, 
+    19581, 23634, 16606, 8923, 17360, 17354, 7562, 21033, 29423, 4618, 4992, 19770, 
+    35328, 23995, 4049, 4196, 19300, 19953, 23379, 26420, 42540, 41815, 22454, 22651, 
+    21987, 37696, 26692, 19729, 17931, 18866, 36799, 19659, 31113, 22191, 22456, 25090, 
+    22323, 25682, 24162, 26425, 26906, 28590, 34883, 33653, 37898, 35971, 41813, 43942, 
+    45245, 31751, 33831, 31044, 40286, 28934, 24651, 20233, 31421, 16829, 17069, 43763, 
+    41716, 22333, 32638, 15528, 12875, 32296, 7739, 39261, 30236, 13671, 39209, 28428, 
+    18712, 22523, 36330, 43876, 25901, 40454, 39896, 36368, 39117, 41007, 44601, 35092, 
+    39166, 36879, 39746, 30601, 24485, 19654, 17521, 11082, 44060, 36352, 45161, 32296, 
+    20417, 31884, 33134, 35773, 13697, 40249, 15321, 26181, 41702, 26369, 22632, 23503, 
+    33515, 31531, 37881, 36420, 39727, 44337, 40694, 36395, 35533, 35043, 33202, 41555, 
+    36259, 31176, 35048, 31651, 33655, 26370, 41375, 22844, 18768, 23768, 23309, 17841, 
+    11167, 21419, 21414, 11352, 24968, 26883, 7060, 6784, 17144, 32036, 27598, 2653, 
+    4196, 22456, 15830, 19286, 22313, 38494, 37735, 18263, 18503, 17936, 33507, 29502, 
+    16305, 15071, 20100, 32717, 18021, 27425, 23006, 23414, 22615, 22040, 23213, 22618, 
+    24311, 24992, 26291, 44590, 32094, 31601, 35233, 33741, 38910, 41338, 43519, 43032, 
+    44978, 42106, 40281, 38812, 33083, 29250, 40723, 25036, 35828, 24997, 26064, 33180, 
+    17205, 20417, 32731, 29312, 26743, 12601, 13995, 33251, 34632, 18718, 36811, 21496, 
+    28485, 43596, 18411, 30743, 23585, 28478, 36769, 39407, 27948, 29718, 37267, 40292, 
+    35698, 42325, 35834, 43024, 45902, 43529, 36443, 31458, 36365, 34778, 32158, 41903, 
+    27955, 32025, 26141, 22806, 25323, 20079, 29593, 19409, 22105, 35437, 19969, 23046, 
+    13344, 40791, 31686, 24210, 9155, 9154, 18961, 8023, 21874, 22828, 39066, 6395, 
+    23321, 19300, 22456, 37321, 40817, 43660, 38079, 37421, 35826, 7742, 30361, 26781, 
+    10873, 23027, 41010, 13790, 13225, 29860, 18760, 30247, 25161, 29160, 28588, 31568, 
+    38958, 34252, 40804, 36974, 45462, 45639, 44705, 32730, 40716, 41061, 44260, 36321, 
+    35110, 39154, 43062, 37542, 32174, 39488, 25143, 25953, 23434, 37247, 37242, 26112, 
+    40730, 18753, 20991, 20142, 12363, 19449, 42983, 16481, 19953, 15830, 32731, 37321, 
+    3509, 6488, 22726, 21922, 5052, 6856, 8498, 17990, 43546, 13758, 16352, 38260, 
+    31775, 19635, 22707, 44502, 18769, 33348, 34036, 22431, 29745, 22880, 45186, 26206, 
+    25232, 39792, 26567, 25918, 32784, 28191, 31253, 31480, 41300, 32268, 33464, 37141, 
+    39371, 40474, 41710, 43806, 37056, 37123, 38705, 41683, 40662, 35095, 42864, 26155, 
+    28136, 26351, 40704, 40699, 29331, 44216, 17638, 24181, 23293, 13120, 16824, 19810, 
+    23379, 19286, 29312, 40817, 3509, 3057, 19229, 18449, 5609, 7630, 44708, 9778, 
+    14926, 15978, 18973, 34943, 35061, 17901, 25417, 41243, 18814, 36482, 37192, 24362, 
+    32628, 24757, 42127, 28613, 27225, 37071, 28621, 27632, 31166, 29026, 32762, 32226, 
+    39436, 33506, 33724, 37607, 39793, 41244, 42288, 43807, 38754, 39649, 39461, 41578, 
+    43687, 38061, 45919, 28129, 30788, 29325, 43732, 43727, 32379, 18118, 27227, 26333, 
+    15177, 15666, 22867, 26420, 22313, 26743, 43660, 6488, 3057, 16257, 15435, 6832, 
+    8616, 41737, 10905, 11990, 17552, 20838, 31888, 37532, 15981, 27291, 38198, 18424, 
+    38755, 39491, 25513, 34631, 25852, 39148, 30160, 28396, 34271, 29833, 28541, 29174, 
+    29129, 33427, 32212, 37212, 33919, 33270, 37298, 39429, 41174, 42041, 43054, 42545, 
+    39999, 40876, 38266, 43922, 37084, 44335, 37575, 23941, 42878, 41918, 27406, 15329, 
+    38832, 42540, 31884, 38494, 12601, 22726, 19229, 16257, 1407, 21960, 23022, 25482, 
+    25052, 8901, 35874, 31712, 35406, 16950, 18292, 41572, 23461, 32116, 42903, 26808, 
+    37891, 38036, 25785, 43407, 40611, 23745, 42075, 39900, 26676, 37500, 43521, 39744, 
+    31698, 43005, 38735, 42979, 44637, 45907, 45987, 43309, 41057, 42256, 38400, 43758, 
+    38483, 43894, 38957, 24276, 42302, 41356, 27222, 15914, 38163, 41815, 33134, 37735, 
+    13995, 21922, 18449, 15435, 1407, 20911, 21900, 26344, 23891, 7502, 36705, 30508, 
+    34220, 17147, 16888, 40344, 23647, 32592, 43563, 25419, 36569, 36706, 25690, 42111, 
+    39276, 23193, 40738, 38540, 25476, 36095, 42128, 38337, 30731, 41602, 37342, 41588, 
+    43255, 45409, 44662, 41372, 39812, 43935, 40851, 35931, 41958, 30190, 30587, 27294, 
+    39263, 39258, 29292, 42429, 23116, 24334, 23600, 17398, 22244, 44087, 19524, 22454, 
+    18263, 33251, 38079, 5052, 5609, 6832, 21960, 20911, 2028, 4196, 15494, 43628, 
+    10721, 14043, 36077, 31149, 15141, 20484, 42049, 13753, 32142, 32899, 18844, 27856, 
+    19218, 42168, 23342, 21720, 36167, 23136, 22045, 28072, 23535, 27152, 26775, 36713, 
+    27916, 28538, 32301, 34514, 35795, 36928, 38815, 29137, 39164, 35590, 35295, 30831, 
+    27015, 39159, 24068, 24806, 28913, 38214, 15177, 11987, 7739, 35773, 40039, 30045, 
+    6497, 37688, 25968, 12857, 16093, 30513, 38020, 18668, 45485, 33061, 41202, 39668, 
+    32642, 29913, 40411, 34356, 43111, 41078, 45905, 41285, 36616, 41990, 31880, 31826, 
+    28083, 39108, 39103, 29727, 42125, 25138, 24891, 24220, 19211, 24170, 43534, 20005, 
+    22651, 18503, 34632, 37421, 6856, 7630, 8616, 23022, 21900, 2028, 2291, 15970, 
+    42691, 9043, 12542, 36459, 30027, 14337, 18920, 42277, 11929, 30819, 31595, 16922, 
+    26341, 17280, 42120, 21573, 19804, 35809, 21232, 20063, 26948, 21524, 25138, 24774, 
+    35678, 25888, 26618, 30339, 32560, 33791, 34947, 36950, 42449, 36591, 31565, 30419, 
+    24572, 44739, 35721, 39261, 13697, 18718, 44708, 41737, 25482, 26344, 40039, 32102, 
+    10410, 13796, 44667, 38495, 12721, 10826, 18147, 32930, 17840, 24533, 34375, 38112, 
+    36513, 32143, 34737, 37642, 41267, 44362, 41605, 40779, 36419, 41046, 33075, 32351, 
+    28056, 37983, 37978, 29273, 40845, 27105, 24612, 24020, 20674, 26429, 42019, 19690, 
+    21987, 17936, 36811, 35826, 8498, 9778, 10905, 25052, 23891, 4196, 2291, 17651, 
+    40855, 6799, 10382, 37958, 28071, 14818, 16704, 43627, 10795, 28723, 29509, 14655, 
+    24140, 15024, 43208, 19285, 17534, 36601, 18957, 17855, 26859, 19693, 23006, 22985, 
+    35664, 23861, 25108, 28691, 30931, 31976, 33229, 35552, 38981, 42630, 45830, 41276, 
+    44098, 26406, 38981, 38128, 26507, 19767, 34420, 37696, 40249, 33507, 21496, 17990, 
+    14926, 11990, 8901, 7502, 15494, 15970, 32102, 17651, 42181, 23911, 27678, 20584, 
+    45616, 9589, 33545, 26631, 36591, 17929, 45946, 29325, 40905, 29427, 27214, 34974, 
+    31971, 22395, 33423, 31133, 20157, 28608, 34631, 30909, 26951, 34107, 30140, 34403, 
+    36165, 38945, 44139, 39070, 38059, 44067, 45959, 45931, 41605, 36819, 39712, 34952, 
+    27161, 25670, 44757, 45677, 41652, 30236, 15321, 28485, 35874, 36705, 30045, 10410, 
+    42181, 22550, 34369, 18827, 10041, 8702, 22554, 22688, 30720, 24219, 45366, 41892, 
+    24576, 29030, 37412, 42233, 36717, 37873, 44825, 28560, 45936, 36399, 45852, 34345, 
+    42984, 44040, 36223, 30784, 37278, 35931, 33050, 44988, 30086, 36868, 29924, 25865, 
+    29754, 21463, 35375, 21261, 26391, 42712, 26484, 30363, 19129, 39388, 31951, 15656, 
+    15657, 26695, 12804, 29539, 30472, 8057, 30644, 26692, 29502, 7742, 43546, 43628, 
+    42691, 40855, 34736, 30983, 13085, 25969, 44310, 14118, 13298, 32250, 19852, 32512, 
+    26787, 30861, 29950, 33063, 40168, 34488, 41402, 37115, 45408, 43613, 26432, 35159, 
+    43503, 33482, 42185, 38323, 34973, 37322, 35851, 33160, 27392, 33794, 33789, 27291, 
+    36178, 32377, 23366, 23043, 24629, 32802, 36703, 18668, 19729, 16305, 43596, 30361, 
+    13758, 15978, 17552, 31712, 30508, 10721, 9043, 6799, 23911, 34736, 3770, 43704, 
+    21746, 19116, 9913, 11575, 22088, 22893, 8757, 17357, 9250, 12647, 11497, 40842, 
+    12812, 12416, 29150, 16408, 17925, 19709, 37889, 19361, 22909, 25791, 28036, 28271, 
+    29904, 33424, 42413, 43909, 45808, 45549, 45339, 44566, 43571, 41413, 36009, 33221, 
+    34412, 36413, 32661, 26220, 30704, 30699, 25403, 32869, 34502, 21996, 21836, 26110, 
+    35725, 33152, 17638, 17931, 15071, 26781, 16352, 18973, 20838, 35406, 34220, 14043, 
+    12542, 10382, 27678, 30983, 3770, 17978, 22692, 6459, 14529, 18364, 19161, 7729, 
+    13816, 8319, 9942, 9939, 44265, 10997, 11526, 32047, 17035, 17042, 20162, 40667, 
+    18922, 23908, 26270, 28459, 28148, 30005, 34198, 39412, 41559, 45192, 40349, 43602, 
+    35953, 40380, 44340, 31297, 26181, 18411, 38260, 34943, 31888, 16950, 17147, 36077, 
+    36459, 13796, 37958, 20584, 22550, 43704, 25297, 6511, 16007, 27715, 34882, 43442, 
+    9683, 12338, 43812, 24490, 43032, 44031, 24182, 41157, 36858, 44810, 45696, 36411, 
+    31575, 44460, 37240, 40479, 41495, 42705, 40291, 42100, 45650, 43028, 38768, 41603, 
+    36509, 33486, 35370, 30947, 38313, 30280, 32329, 40897, 28177, 29104, 23004, 42492, 
+    34812, 26779, 18588, 18585, 22576, 18699, 23049, 23699, 37069, 16936, 22070, 18866, 
+    20100, 10873, 31775, 35061, 37532, 31149, 30027, 28071, 45616, 13085, 21746, 17978, 
+    40328, 12935, 31283, 3779, 3744, 19460, 7891, 19784, 14400, 18455, 17788, 20819, 
+    28175, 23387, 29940, 26110, 34603, 34790, 36377, 34036, 36422, 42581, 27991, 34091, 
+    39819, 43313, 45270, 45869, 24859, 41222, 36998, 38546, 34014, 30979, 44708, 28669, 
+    30411, 35392, 44657, 14211, 11388, 13671, 41702, 6497, 44667, 34369, 40887, 28920, 
+    13687, 15468, 29759, 36945, 12264, 43683, 29384, 37100, 34796, 44921, 26267, 23442, 
+    34015, 28521, 44017, 45582, 42384, 44015, 33504, 39224, 38557, 30990, 28353, 34329, 
+    36799, 32717, 30743, 19635, 17901, 15981, 18292, 16888, 15141, 14337, 38495, 14818, 
+    9589, 19116, 22692, 25297, 40328, 27516, 30134, 40581, 9666, 39908, 40753, 22038, 
+    34427, 21990, 28930, 27874, 24344, 21883, 25711, 23044, 13265, 19419, 25790, 21482, 
+    21665, 24959, 20551, 24814, 26592, 29362, 41034, 29490, 28771, 38356, 45890, 44266, 
+    44851, 42761, 45692, 41919, 42243, 43949, 35804, 34255, 32785, 40876, 35806, 28537, 
+    28662, 28658, 26471, 30059, 40484, 24193, 24310, 31672, 42130, 29384, 20666, 19659, 
+    18021, 23027, 22707, 25417, 27291, 41572, 40344, 20484, 18920, 16704, 33545, 25969, 
+    9913, 6459, 12935, 27516, 18350, 12473, 13308, 6920, 7447, 7374, 4598, 7090, 
+    7306, 9492, 34989, 16674, 14079, 19190, 43170, 16536, 23600, 24936, 26924, 25712, 
+    27864, 33052, 33047, 35712, 42993, 43047, 37047, 37628, 26369, 23585, 44502, 41243, 
+    38198, 23461, 23647, 42049, 42277, 12721, 43627, 26631, 18827, 6511, 30134, 10450, 
+    22419, 39431, 38042, 5260, 12120, 38046, 26551, 23910, 43634, 30392, 29950, 26842, 
+    45307, 34178, 34344, 44136, 37156, 38580, 41772, 36874, 33678, 44705, 39209, 22632, 
+    28478, 32116, 32592, 37688, 10826, 36591, 10041, 16007, 40887, 40581, 10450, 11970, 
+    27617, 13148, 21393, 27810, 36237, 32064, 22205, 24012, 28178, 38180, 30448, 36318, 
+    38547, 40341, 41793, 45963, 42638, 39053, 42857, 32070, 33053, 41145, 37955, 28428, 
+    23503, 36769, 42903, 43563, 25968, 18147, 8702, 27715, 28920, 22419, 11970, 15727, 
+    24656, 32895, 16426, 42597, 16263, 21665, 33646, 34979, 45093, 29801, 29207, 42935, 
+    44951, 36343, 39132, 42581, 44664, 43779, 43029, 38200, 45218, 45213, 38654, 36372, 
+    34422, 33970, 31132, 33556, 29559, 31113, 27425, 39407, 41010, 18769, 18814, 18424, 
+    26808, 25419, 13753, 11929, 10795, 17929, 44310, 11575, 14529, 34882, 31283, 9666, 
+    18350, 39431, 30536, 31384, 12437, 24950, 12355, 37692, 18270, 14680, 30023, 16047, 
+    13430, 17585, 11100, 16719, 13938, 26314, 16409, 14916, 18879, 21029, 22799, 23617, 
+    25069, 41080, 43100, 45632, 44379, 39502, 44313, 45692, 41718, 45163, 39811, 36593, 
+    38793, 33638, 42000, 33071, 35684, 44636, 31885, 32882, 26479, 45808, 38380, 30354, 
+    22065, 22062, 26283, 21791, 26511, 27107, 39671, 19391, 25151, 22191, 23006, 13790, 
+    33348, 36482, 38755, 32142, 30819, 28723, 45946, 14118, 22088, 18364, 3779, 39908, 
+    12473, 30536, 848, 18257, 5740, 18480, 12681, 16747, 15838, 18949, 26114, 20762, 
+    27546, 23460, 32212, 32026, 33484, 30921, 33322, 39635, 24699, 30420, 43112, 37202, 
+    38699, 43570, 45019, 41109, 44772, 39308, 36030, 38338, 32979, 41701, 32433, 35203, 
+    44631, 31613, 32787, 26058, 38529, 30497, 21652, 21650, 26319, 21242, 26717, 27339, 
+    40174, 18711, 25509, 22456, 23414, 13225, 34036, 37192, 39491, 32899, 31595, 29509, 
+    13298, 22893, 19161, 3744, 40753, 13308, 31384, 848, 19103, 6573, 19323, 13515, 
+    17576, 16652, 19765, 26907, 21489, 28300, 24178, 32962, 32714, 34143, 31526, 33929, 
+    40278, 24386, 30347, 42823, 36673, 38225, 43219, 38944, 35458, 34461, 33674, 39753, 
+    27227, 24115, 18712, 33515, 12857, 32930, 22554, 43442, 13687, 38042, 27617, 15727, 
+    39751, 4117, 17756, 25300, 42859, 19680, 33028, 23081, 31472, 31622, 39177, 45842, 
+    31176, 31870, 38544, 39845, 42287, 40193, 39623, 44072, 40336, 33673, 35546, 35542, 
+    32342, 36977, 41118, 29380, 29309, 33310, 41084, 36183, 25228, 25090, 22615, 29860, 
+    22431, 24362, 25513, 37891, 36569, 18844, 16922, 14655, 29325, 32250, 8757, 7729, 
+    19460, 22038, 6920, 12437, 18257, 19103, 12582, 598, 5838, 2884, 41967, 4333, 
+    3812, 28252, 9999, 9363, 12836, 36305, 11198, 16994, 18852, 20981, 20449, 22364, 
+    26908, 43851, 34714, 35384, 44542, 44234, 41331, 42973, 38825, 45299, 38169, 40017, 
+    35138, 35083, 30593, 45344, 38926, 31088, 26205, 26202, 27805, 26569, 26909, 27305, 
+    37600, 24727, 24503, 22323, 22040, 18760, 29745, 32628, 34631, 27856, 26341, 24140, 
+    40905, 19852, 17357, 13816, 7891, 34427, 7447, 24950, 5740, 6573, 12582, 12776, 
+    6942, 11009, 10135, 13236, 40498, 20475, 15496, 22089, 18220, 26758, 26905, 28520, 
+    26303, 28670, 34736, 26366, 30329, 44291, 40138, 42837, 40775, 40120, 44644, 40933, 
+    34270, 36026, 36022, 32924, 37413, 41586, 29976, 29907, 33834, 41449, 36554, 25826, 
+    25682, 23213, 30247, 22880, 24757, 25852, 38036, 36706, 19218, 17280, 15024, 29427, 
+    32512, 9250, 8319, 19784, 21990, 7374, 12355, 18480, 19323, 598, 12776, 5937, 
+    2601, 41734, 4073, 3241, 27927, 9448, 8799, 12255, 35922, 10605, 16440, 18262, 
+    20387, 19853, 21765, 26323, 43253, 34482, 35002, 42278, 40680, 31531, 27948, 45186, 
+    42127, 39148, 25785, 25690, 42168, 42120, 17840, 43208, 27214, 22688, 9683, 28930, 
+    5260, 13148, 24656, 37692, 39751, 8267, 39175, 23121, 43621, 43818, 19277, 40119, 
+    29610, 43116, 43489, 27829, 22051, 45995, 40871, 28930, 31086, 42707, 32201, 33549, 
+    41031, 45923, 45209, 44470, 45544, 39657, 38511, 36049, 45420, 40393, 33065, 31779, 
+    31775, 30795, 32689, 44439, 28725, 28870, 35889, 45435, 31331, 25263, 24162, 22618, 
+    25161, 26206, 28613, 30160, 43407, 42111, 23342, 21573, 19285, 34974, 26787, 12647, 
+    9942, 14400, 27874, 4598, 18270, 12681, 13515, 5838, 6942, 5937, 4086, 3453, 
+    6419, 33561, 13797, 9922, 15801, 41280, 12538, 20406, 21177, 23036, 21488, 23719, 
+    29242, 44901, 29777, 31623, 44400, 42891, 41261, 39692, 42139, 35189, 35488, 35484, 
+    33443, 36583, 43872, 30856, 30874, 35892, 43963, 35370, 26955, 26425, 24311, 29160, 
+    25232, 27225, 28396, 40611, 39276, 21720, 19804, 17534, 31971, 30861, 11497, 9939, 
+    18455, 24344, 7090, 14680, 16747, 17576, 2884, 11009, 2601, 4086, 43597, 1472, 
+    2460, 29489, 9845, 7291, 12139, 37199, 9550, 16634, 17847, 19850, 18821, 20897, 
+    25963, 42341, 31882, 32519, 39067, 37881, 29718, 39792, 37071, 34271, 23745, 23193, 
+    36167, 35809, 24533, 36601, 22395, 30720, 40842, 44265, 12338, 21883, 12120, 21393, 
+    32895, 30023, 41967, 41734, 8267, 43597, 44704, 41637, 14854, 35396, 42091, 35551, 
+    12044, 40116, 31874, 36305, 34953, 35422, 33190, 39319, 22230, 38006, 33204, 25488, 
+    34599, 31002, 31886, 37315, 43561, 42940, 41556, 39473, 42833, 35739, 35217, 35213, 
+    33776, 36140, 45160, 31396, 31461, 37061, 45379, 34724, 27644, 26906, 24992, 28588, 
+    26567, 28621, 29833, 42075, 40738, 23136, 21232, 18957, 33423, 29950, 12812, 10997, 
+    17788, 25711, 7306, 16047, 15838, 16652, 4333, 10135, 4073, 3453, 1472, 44704, 
+    3115, 30460, 10388, 6774, 12352, 38005, 9264, 16952, 17810, 19723, 18406, 20566, 
+    25903, 41912, 30410, 31133, 45304, 45291, 43540, 42149, 44065, 37277, 37948, 37944, 
+    35706, 39028, 44659, 32961, 32933, 37035, 44195, 37749, 28919, 28590, 26291, 31568, 
+    25918, 27632, 28541, 39900, 38540, 22045, 20063, 17855, 31133, 33063, 12416, 11526, 
+    20819, 23044, 9492, 13430, 18949, 19765, 3812, 13236, 3241, 6419, 2460, 41637, 
+    3115, 27349, 7402, 5558, 9701, 34904, 7452, 14175, 15491, 17538, 16741, 18731, 
+    23603, 45903, 40217, 32413, 32280, 38976, 42708, 39336, 38532, 37659, 43296, 29560, 
+    26566, 22523, 36420, 16093, 34375, 24219, 43812, 15468, 38046, 27810, 16426, 4117, 
+    39175, 14530, 21969, 40095, 18639, 29410, 18977, 27364, 27671, 35060, 41729, 28717, 
+    30395, 35794, 39253, 44249, 39918, 44590, 37267, 32784, 31166, 29174, 26676, 25476, 
+    28072, 26948, 38112, 26859, 20157, 45366, 29150, 32047, 24490, 13265, 34989, 26551, 
+    36237, 17585, 28252, 40498, 27927, 23121, 33561, 29489, 14854, 30460, 27349, 20711, 
+    27314, 20700, 8827, 25275, 17089, 20434, 21214, 44803, 24991, 28807, 23996, 20395, 
+    25096, 43770, 33565, 33482, 34086, 35006, 43252, 45288, 45283, 42241, 39028, 38868, 
+    40234, 44536, 45111, 34632, 34883, 32094, 38958, 28191, 29026, 29129, 37500, 36095, 
+    23535, 21524, 19693, 28608, 40168, 16408, 17035, 43032, 28175, 19419, 16674, 11100, 
+    26114, 26907, 9999, 20475, 9448, 43621, 13797, 9845, 35396, 10388, 7402, 20711, 
+    6798, 3337, 27770, 5540, 6997, 9383, 11628, 12283, 13630, 17170, 38557, 41977, 
+    34710, 35801, 33554, 45793, 42455, 41466, 41462, 40550, 42051, 38118, 38152, 42554, 
+    40125, 34246, 33653, 31601, 34252, 31253, 32762, 33427, 43521, 42128, 27152, 25138, 
+    23006, 34631, 34488, 17925, 17042, 23387, 25790, 14079, 16719, 20762, 21489, 9363, 
+    15496, 8799, 9922, 7291, 42091, 6774, 5558, 27314, 6798, 6969, 33875, 2724, 
+    11553, 11431, 13169, 11633, 13814, 19396, 42894, 44512, 35140, 29184, 27752, 42540, 
+    43114, 44189, 45178, 42117, 41990, 43559, 37795, 37898, 35233, 40804, 31480, 32226, 
+    32212, 39744, 38337, 26775, 24774, 22985, 30909, 41402, 19709, 20162, 44031, 29940, 
+    21482, 19190, 13938, 27546, 28300, 12836, 22089, 12255, 43818, 15801, 12139, 35551, 
+    12352, 9701, 20700, 3337, 6969, 26931, 4606, 4670, 6119, 8341, 9021, 44984, 
+    10295, 14082, 36377, 45353, 44312, 39103, 31427, 34606, 31517, 44392, 40292, 41300, 
+    39436, 37212, 31698, 30731, 36713, 35678, 36513, 35664, 26951, 41892, 37889, 40667, 
+    24182, 21665, 43170, 23910, 32064, 42597, 26314, 36305, 35922, 19277, 41280, 37199, 
+    12044, 38005, 34904, 8827, 27770, 33875, 26931, 31494, 22581, 41836, 24788, 24776, 
+    36685, 28703, 20011, 27063, 21624, 17127, 35084, 25086, 25209, 27559, 31807, 44705, 
+    44170, 44166, 42979, 44775, 40380, 40371, 43896, 42833, 36371, 35971, 33741, 36974, 
+    32268, 33506, 33919, 43005, 41602, 27916, 25888, 23861, 34107, 37115, 19361, 18922, 
+    26110, 24959, 16536, 16409, 23460, 24178, 11198, 18220, 10605, 12538, 9550, 40116, 
+    9264, 7452, 25275, 5540, 2724, 4606, 31494, 9001, 8714, 10500, 9295, 11348, 
+    16716, 40178, 41862, 32799, 30372, 28047, 42048, 43314, 45271, 45892, 45693, 45769, 
+    41407, 41813, 38910, 45462, 33464, 33724, 33270, 38735, 37342, 28538, 26618, 25108, 
+    30140, 22909, 23908, 41157, 34603, 20551, 23600, 43634, 14916, 32212, 32962, 16994, 
+    26758, 16440, 40119, 20406, 16634, 31874, 16952, 14175, 17089, 6997, 11553, 4670, 
+    22581, 9001, 4266, 6202, 8868, 40330, 8998, 10556, 31760, 40767, 39772, 35016, 
+    28512, 37772, 33626, 44969, 43957, 41024, 36330, 39727, 30513, 32143, 24576, 36858, 
+    29759, 30392, 22205, 16263, 17756, 29610, 36305, 14530, 41836, 7551, 25701, 29299, 
+    37345, 15563, 14114, 32138, 34195, 45145, 20284, 23848, 26320, 32989, 33972, 38683, 
+    39031, 43907, 43942, 41338, 45639, 37141, 37607, 37298, 42979, 41588, 32301, 30339, 
+    28691, 34403, 45408, 25791, 26270, 44810, 34790, 24814, 24936, 18879, 32026, 32714, 
+    18852, 26905, 18262, 43116, 21177, 17847, 34953, 17810, 15491, 20434, 9383, 11431, 
+    6119, 24788, 8714, 4266, 2257, 4716, 41135, 4775, 8116, 31604, 40377, 39180, 
+    33280, 25328, 34668, 29859, 44884, 43307, 40727, 44162, 43519, 39371, 39793, 39429, 
+    44637, 43255, 34514, 32560, 30931, 36165, 28036, 28459, 45696, 36377, 26592, 26924, 
+    21029, 33484, 34143, 20981, 28520, 20387, 43489, 23036, 19850, 35422, 19723, 17538, 
+    21214, 11628, 13169, 8341, 24776, 10500, 6202, 2257, 3933, 40236, 2941, 6230, 
+    30306, 38935, 37660, 31363, 23088, 34469, 29069, 42632, 41105, 39137, 43005, 43876, 
+    44337, 38020, 34737, 29030, 36411, 36945, 29950, 24012, 21665, 25300, 27829, 33190, 
+    21969, 44803, 36685, 7551, 18884, 35028, 30223, 8326, 15295, 24616, 26668, 37610, 
+    18314, 23405, 22378, 28563, 37135, 42969, 44322, 40896, 45658, 45245, 43032, 44705, 
+    40474, 41244, 41174, 35795, 33791, 31976, 38945, 43613, 28271, 28148, 34036, 29362, 
+    25712, 22799, 30921, 31526, 20449, 26303, 19853, 21488, 18821, 39319, 18406, 16741, 
+    24991, 12283, 11633, 9021, 28703, 9295, 8868, 4716, 3933, 43749, 2405, 9002, 
+    33446, 41835, 40442, 33335, 23523, 30540, 25255, 42658, 40004, 36124, 39450, 44364, 
+    45294, 45907, 45409, 37642, 44139, 37412, 31575, 41034, 26842, 28178, 33646, 42859, 
+    22051, 22230, 40095, 28807, 44984, 20011, 40330, 25701, 41135, 40236, 18884, 43749, 
+    41535, 34904, 11838, 15277, 32373, 10494, 12186, 21954, 34209, 31292, 37410, 30409, 
+    33598, 41139, 39006, 44978, 41710, 42288, 42041, 36928, 34947, 33229, 39070, 29904, 
+    30005, 36422, 29490, 27864, 23617, 33322, 33929, 22364, 28670, 21765, 45995, 23719, 
+    20897, 38006, 20566, 18731, 23996, 13630, 13814, 10295, 27063, 11348, 8998, 4775, 
+    2941, 2405, 41535, 6677, 31107, 39450, 38046, 30962, 21492, 32253, 26418, 40818, 
+    38694, 36197, 40146, 45749, 45944, 43806, 43807, 43054, 45987, 44662, 38815, 36950, 
+    35552, 38059, 33424, 34198, 44460, 42581, 28771, 33052, 45307, 25069, 39635, 40278, 
+    26908, 34736, 26323, 40871, 29242, 25963, 33204, 25903, 23603, 20395, 17170, 19396, 
+    14082, 21624, 16716, 10556, 8116, 6230, 9002, 34904, 6677, 24444, 32883, 31543, 
+    25172, 18046, 38357, 31697, 37661, 37499, 38988, 44301, 32080, 36789, 34955, 37626, 
+    37024, 22598, 44035, 43532, 41472, 39842, 42348, 21107, 19657, 25901, 18668, 42233, 
+    12264, 34979, 19680, 18639, 29299, 35028, 39796, 22928, 29017, 25202, 36285, 41429, 
+    14003, 12296, 21754, 20660, 44067, 37240, 38356, 34178, 38180, 45093, 41080, 28930, 
+    25488, 45903, 25096, 38557, 42894, 36377, 17127, 40178, 31760, 37345, 31604, 30306, 
+    30223, 33446, 11838, 31107, 24444, 24876, 42233, 9097, 8519, 12105, 22567, 39294, 
+    45333, 36134, 37152, 32654, 35080, 39920, 40200, 45485, 41267, 36717, 40479, 43683, 
+    34344, 30448, 29801, 33028, 31086, 34599, 29410, 43770, 35084, 15563, 8326, 15277, 
+    39796, 24876, 17403, 17726, 19669, 30384, 44443, 16239, 22285, 17229, 22397, 38861, 
+    45732, 44422, 36180, 40988, 41755, 40948, 45635, 45023, 42584, 40302, 40454, 33061, 
+    37873, 29384, 44136, 36318, 29207, 23081, 42707, 18977, 14114, 15295, 32373, 22928, 
+    42233, 17403, 34519, 36285, 8394, 9933, 16193, 22778, 21992, 28419, 43560, 25672, 
+    37676, 42590, 39555, 41495, 37156, 38547, 42935, 32201, 31002, 33565, 45353, 25086, 
+    40767, 32138, 40377, 38935, 24616, 41835, 10494, 39450, 32883, 9097, 17726, 34519, 
+    2071, 13021, 26815, 30694, 36628, 27085, 28120, 30804, 29010, 40098, 36364, 45434, 
+    42705, 38580, 40341, 44951, 33549, 31886, 33482, 44312, 25209, 39772, 34195, 39180, 
+    37660, 26668, 40442, 12186, 38046, 31543, 8519, 19669, 36285, 2071, 10955, 24808, 
+    32161, 38015, 28151, 28712, 28972, 27984, 38110, 34851, 45459, 41031, 37315, 34086, 
+    41977, 44512, 39103, 27559, 41862, 35016, 45145, 33280, 31363, 37610, 33335, 21954, 
+    30962, 25172, 12105, 30384, 13021, 10955, 14164, 41154, 35743, 34343, 20582, 25468, 
+    28122, 43526, 28623, 42967, 45755, 45890, 43100, 43851, 43253, 44901, 42341, 43561, 
+    41912, 40217, 35006, 34710, 35140, 31427, 31807, 32799, 28512, 25328, 23088, 23523, 
+    34209, 21492, 18046, 22567, 44443, 26815, 24808, 14164, 41963, 32692, 19631, 32137, 
+    20764, 30568, 29654, 39152, 43545, 37012, 38935, 39697, 43962, 45596, 41202, 44825, 
+    37100, 41793, 36343, 31472, 45923, 27364, 20284, 18314, 31292, 29017, 39294, 16239, 
+    8394, 30694, 32161, 41154, 6134, 7894, 14386, 23872, 31486, 35402, 24903, 30213, 
+    35209, 43250, 42451, 28831, 40124, 42553, 40115, 40016, 41168, 45489, 41712, 41712, 
+    39222, 34427, 32730, 26432, 42413, 39412, 27991, 33047, 45632, 24699, 24386, 34714, 
+    26366, 34482, 29777, 31882, 30410, 32413, 35801, 29184, 34606, 30372, 37772, 34668, 
+    34469, 30540, 32253, 38357, 41963, 9617, 43423, 24293, 18449, 15032, 23040, 37905, 
+    37045, 39961, 44302, 44546, 45524, 43216, 40716, 35159, 43909, 41559, 34091, 35712, 
+    44379, 30420, 30347, 35384, 30329, 35002, 31623, 32519, 31133, 32280, 33554, 27752, 
+    31517, 28047, 33626, 29859, 29069, 25255, 26418, 31697, 32692, 9617, 43302, 34313, 
+    17180, 15371, 19543, 21154, 42302, 32213, 43429, 33644, 37989, 39502, 43114, 45537, 
+    44693, 44555, 39668, 34796, 45963, 39132, 31622, 27671, 23848, 23405, 37410, 25202, 
+    45333, 22285, 9933, 36628, 38015, 6134, 11348, 16270, 18105, 25937, 37885, 18771, 
+    28103, 32928, 42535, 36717, 42929, 41511, 45206, 44921, 42581, 39177, 35060, 26320, 
+    22378, 30409, 36285, 36134, 17229, 16193, 27085, 28151, 35743, 7894, 11348, 6783, 
+    29068, 37043, 40969, 27518, 39039, 28064, 24933, 29908, 36389, 37894, 41357, 43886, 
+    44031, 44438, 45842, 41729, 32989, 28563, 33598, 41429, 37152, 22397, 22778, 28120, 
+    28712, 34343, 14386, 16270, 6783, 32371, 40393, 36075, 21616, 33034, 29692, 19424, 
+    24234, 29712, 43243, 20648, 44894, 25564, 25186, 44232, 28530, 29664, 45030, 27274, 
+    43106, 32995, 32349, 39896, 32642, 26267, 44664, 31176, 28717, 33972, 37135, 14003, 
+    38861, 21992, 23872, 18105, 29068, 32371, 8036, 7782, 35118, 38551, 18614, 19938, 
+    24554, 22678, 45303, 25449, 25287, 43619, 19271, 38861, 43534, 26851, 26823, 36368, 
+    29913, 23442, 31870, 30395, 38683, 42969, 12296, 45732, 28419, 31486, 25937, 37043, 
+    40393, 8036, 13129, 41649, 44552, 11153, 45102, 44884, 42632, 42658, 41139, 40818, 
+    37661, 32654, 44422, 30804, 28972, 20582, 19631, 43302, 40969, 36075, 15763, 11217, 
+    32201, 10027, 42136, 44058, 39674, 22810, 31476, 40335, 31058, 38792, 36714, 45692, 
+    44322, 39006, 35080, 36180, 43560, 29010, 27984, 25468, 32137, 35402, 37885, 27518, 
+    21616, 15763, 26011, 11524, 24532, 31057, 43278, 26097, 20360, 42886, 42140, 43307, 
+    41105, 40004, 38694, 37499, 39920, 40098, 38110, 28122, 20764, 43423, 34313, 11217, 
+    26011, 21293, 16469, 31146, 44501, 32850, 16249, 21082, 36739, 43094, 29411, 41798, 
+    36280, 41306, 44280, 42540, 44392, 42048, 44969, 40727, 39137, 36124, 36197, 38988, 
+    43526, 30568, 24293, 17180, 32201, 21293, 37146, 9952, 23226, 13096, 25384, 15345, 
+    41493, 35096, 42596, 40200, 36364, 34851, 28623, 29654, 39039, 33034, 10027, 11524, 
+    16469, 37146, 31800, 19637, 31800, 31621, 21293, 33157, 24788, 43003, 30000, 32847, 
+    35246, 43915, 43503, 43112, 42823, 44291, 43114, 43314, 44162, 43005, 39450, 40146, 
+    44301, 39152, 18449, 15371, 42136, 31146, 9952, 13383, 5877, 32597, 19810, 35467, 
+    15280, 37188, 19981, 20862, 36930, 24454, 26771, 38991, 45144, 31497, 39435, 44091, 
+    39797, 39475, 40411, 34015, 38544, 35794, 39031, 40896, 21754, 40988, 25672, 24903, 
+    18771, 28064, 29692, 7782, 13129, 28521, 31499, 44160, 20815, 19963, 26396, 27716, 
+    25389, 25998, 31355, 39279, 45459, 40316, 41061, 33482, 39819, 37202, 36673, 40138, 
+    44400, 45304, 44189, 45271, 44364, 45749, 15032, 19543, 44501, 23226, 13383, 13834, 
+    44921, 31336, 32026, 18911, 38087, 24328, 28239, 31206, 45452, 41669, 45294, 45944, 
+    43545, 23040, 21154, 44058, 32850, 13096, 5877, 13834, 31163, 17506, 18557, 32406, 
+    25584, 24984, 33374, 37650, 31079, 40347, 44901, 43926, 41613, 45671, 43281, 41755, 
+    37676, 45434, 45459, 30213, 28103, 24933, 19424, 35118, 41649, 39674, 24532, 31800, 
+    28521, 5013, 15825, 36575, 32972, 26124, 41188, 42967, 37012, 42302, 22810, 31057, 
+    16249, 25384, 19637, 32597, 44921, 31163, 13818, 43959, 31126, 21857, 26788, 30158, 
+    39110, 43458, 38935, 37905, 32213, 31476, 43278, 21082, 15345, 31800, 19810, 31336, 
+    17506, 13818, 44860, 14209, 33043, 20617, 20942, 33228, 37741, 27657, 40078, 44790, 
+    39361, 38927, 41309, 39825, 42590, 35209, 32928, 29908, 24234, 38551, 44552, 40335, 
+    26097, 31621, 31499, 5013, 43959, 12879, 20201, 45525, 16516, 26699, 45160, 41165, 
+    34570, 40663, 43636, 45762, 45755, 43250, 42535, 36389, 29712, 31058, 20360, 36739, 
+    21293, 44160, 15825, 31126, 44860, 12879, 18649, 21750, 18043, 43143, 19440, 17363, 
+    38219, 45636, 11841, 30139, 44229, 42320, 34567, 37489, 45709, 45456, 44166, 38657, 
+    45859, 40509, 45219, 45907, 25786, 27110, 39117, 34356, 28521, 39845, 39253, 20660, 
+    39555, 42451, 36717, 18614, 11153, 20815
+};
@@ -0,0 +1,26 @@
+#ifndef CATALOG_ADJACENCY_H
+#define CATALOG_ADJACENCY_H
+
+#include <stdint.h>
+#include "catalog_xyz.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// neighbour adjacency: for every catalog star, the stars within
+// ADJ_MAX_ANGLE_MDEG (the camera FOV) of it, ascending by index
+#define ADJ_MAX_ANGLE_MDEG 46000
+#define N_ADJ 11274
+
+// star a's neighbours are adj_nbr[adj_start[a] .. adj_start[a+1])
+extern const uint16_t adj_start[CATALOG_SIZE + 1];
+extern const uint8_t adj_nbr[N_ADJ];
+// angle from a to adj_nbr[k], in mdeg
+extern const uint16_t adj_angle[N_ADJ];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CATALOG_ADJACENCY_H
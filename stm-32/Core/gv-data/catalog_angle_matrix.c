@@ -0,0 +1,4101 @@
+// AUTO-GENERATED ANGLE MATRIX
+#include "catalog_angle_matrix.h"
+
+const uint16_t catalog_angle_matrix[CATALOG_SIZE][CATALOG_SIZE] = {
+    { 65535, 15030, 6976, 65535, 35757, 3464, 14014, 23919, 16323, 38461, 7242, 16881, 65535, 19250, 12699, 65535, 
+      13368, 13570, 13118, 30157, 39900, 24074, 20088, 18771, 19103, 21076, 22454, 65535, 24402, 24081, 23830, 34937, 
+      65535, 65535, 31077, 34743, 30324, 29440, 65535, 30141, 39695, 65535, 41208, 30477, 40805, 38742, 34052, 65535, 
+      41104, 65535, 38988, 65535, 41783, 36740, 65535, 65535, 65535, 65535, 41767, 34223, 35658, 40302, 65535, 65535, 
+      41124, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39930, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36675, 65535, 
+      65535, 65535, 65535, 65535, 65535, 36871, 65535, 65535, 41501, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 37939, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34733, 65535, 
+      65535, 65535, 65535, 41267, 65535, 65535, 65535, 36373, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 34680, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33548, 65535, 65535, 32472, 65535, 35504, 65535, 
+      65535, 28607, 35835, 30023, 26681, 31779, 31693, 31964, 35120, 23505, 65535, 65535, 21714, 21464, 18947, 21621, 
+      23520, 25596, 19396, 28325, 36771, 20746, 40369, 17734, 65535, 39201, 9279, 24157, 30545, 7104, 10100, 24328 },
+    { 15030, 65535, 21987, 65535, 65535, 14373, 2458, 38730, 3074, 65535, 12763, 4847, 65535, 6631, 21369, 65535, 
+      12199, 20652, 15578, 15127, 65535, 32152, 12254, 17169, 16548, 14530, 16372, 65535, 25772, 22969, 20052, 65535, 
+      65535, 65535, 31995, 36967, 26471, 22730, 65535, 23967, 65535, 65535, 65535, 22850, 65535, 39457, 30172, 65535, 
+      65535, 65535, 38562, 65535, 65535, 33981, 65535, 65535, 65535, 65535, 40926, 25777, 28793, 35764, 65535, 65535, 
+      36264, 65535, 39778, 65535, 36438, 65535, 41752, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      36422, 65535, 38675, 65535, 65535, 65535, 65535, 65535, 26422, 65535, 65535, 65535, 32999, 65535, 65535, 65535, 
+      40088, 65535, 65535, 65535, 32371, 65535, 65535, 65535, 65535, 65535, 65535, 38476, 65535, 65535, 65535, 65535, 
+      31846, 29220, 37814, 65535, 65535, 65535, 65535, 33556, 65535, 65535, 65535, 31905, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 32271, 65535, 41023, 65535, 65535, 65535, 32473, 65535, 65535, 65535, 
+      34847, 65535, 65535, 65535, 65535, 65535, 65535, 39070, 65535, 65535, 65535, 65535, 65535, 65535, 22004, 65535, 
+      65535, 65535, 65535, 65535, 65535, 22443, 65535, 65535, 27904, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 24871, 65535, 41703, 65535, 65535, 36676, 65535, 65535, 65535, 65535, 65535, 21656, 65535, 
+      65535, 65535, 37710, 32635, 65535, 65535, 65535, 25602, 65535, 65535, 65535, 41779, 65535, 65535, 65535, 65535, 
+      65535, 24567, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 27061, 65535, 65535, 28087, 65535, 35467, 65535, 
+      65535, 16040, 38820, 27961, 20474, 34287, 34766, 37815, 65535, 19848, 65535, 65535, 16822, 20756, 20679, 10324, 
+      9969, 35940, 28156, 40326, 65535, 32093, 65535, 7640, 65535, 65535, 16203, 38250, 65535, 16521, 22763, 9324 },
+    { 6976, 21987, 65535, 65535, 28784, 8389, 20840, 17001, 23104, 31517, 12014, 23475, 37258, 25777, 12363, 39778, 
+      18036, 14033, 16366, 37106, 33713, 21510, 25435, 22213, 22854, 25902, 26942, 65535, 25468, 26359, 27272, 31278, 
+      65535, 65535, 31447, 34059, 32988, 33386, 40385, 33804, 37840, 40166, 39096, 34691, 39446, 38386, 36339, 65535, 
+      40068, 65535, 39159, 41246, 40695, 38243, 65535, 41342, 65535, 65535, 41868, 38473, 39123, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41306, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 40357, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38006, 65535, 65535, 36200, 65535, 37042, 65535, 
+      41381, 35179, 35878, 33037, 31598, 32495, 32137, 30928, 32365, 27894, 65535, 39434, 26735, 25038, 21943, 28181, 
+      30367, 22551, 18357, 23888, 30960, 17548, 34091, 24337, 39448, 32659, 12792, 18288, 24186, 10309, 8258, 31297 },
+    { 65535, 65535, 65535, 65535, 17475, 65535, 65535, 29656, 65535, 15400, 65535, 65535, 10488, 65535, 65535, 8703, 
+      65535, 65535, 65535, 65535, 20126, 65535, 65535, 65535, 65535, 65535, 65535, 6171, 65535, 65535, 65535, 34553, 
+      11523, 15421, 65535, 65535, 65535, 65535, 31911, 65535, 40407, 35113, 39061, 65535, 65535, 65535, 65535, 33310, 
+      65535, 34860, 65535, 40741, 65535, 65535, 27173, 65535, 39242, 26668, 65535, 65535, 65535, 65535, 30229, 36169, 
+      65535, 19515, 65535, 24383, 65535, 37390, 65535, 15865, 21175, 31795, 34408, 33307, 28347, 32303, 65535, 25660, 
+      65535, 65535, 65535, 35104, 28077, 35820, 24663, 19100, 65535, 21830, 65535, 65535, 65535, 27752, 15126, 20189, 
+      65535, 22341, 65535, 21498, 65535, 65535, 17810, 65535, 15698, 19994, 65535, 65535, 19974, 18736, 26190, 65535, 
+      65535, 65535, 65535, 65535, 65535, 19757, 65535, 65535, 25997, 40049, 21993, 65535, 65535, 19823, 65535, 22815, 
+      39670, 16800, 26880, 65535, 17302, 21506, 65535, 65535, 65535, 65535, 39628, 32858, 65535, 65535, 65535, 24380, 
+      65535, 65535, 27331, 20764, 37477, 32655, 65535, 65535, 29446, 20175, 20177, 26776, 18116, 65535, 65535, 65535, 
+      28645, 29144, 37380, 65535, 15881, 65535, 29508, 27499, 65535, 65535, 29012, 65535, 17849, 35942, 37627, 38902, 
+      65535, 65535, 35714, 65535, 35116, 65535, 34094, 65535, 65535, 14280, 30795, 28930, 65535, 20145, 65535, 39353, 
+      25933, 65535, 65535, 65535, 34530, 19751, 19350, 65535, 28338, 22271, 28358, 65535, 25424, 27200, 65535, 26539, 
+      27966, 65535, 40965, 30740, 27361, 30616, 65535, 28328, 32560, 65535, 31313, 31384, 65535, 29447, 65535, 30397, 
+      33544, 65535, 65535, 65535, 65535, 65535, 65535, 41782, 34703, 65535, 14416, 18523, 65535, 65535, 65535, 65535, 
+      65535, 37646, 65535, 32136, 21547, 39634, 16578, 65535, 9982, 16013, 65535, 31253, 24354, 65535, 65535, 65535 },
+    { 35757, 65535, 28784, 17475, 65535, 36614, 65535, 12298, 65535, 4174, 39278, 65535, 9373, 65535, 33165, 11846, 
+      65535, 34886, 40411, 65535, 14187, 29156, 65535, 65535, 65535, 65535, 65535, 19540, 40503, 65535, 65535, 26899, 
+      19238, 20659, 41059, 38695, 65535, 65535, 30251, 65535, 36064, 32857, 35625, 65535, 38498, 41572, 65535, 32840, 
+      39902, 34172, 65535, 38317, 39979, 65535, 29971, 40145, 38203, 30476, 65535, 65535, 65535, 65535, 34639, 38690, 
+      65535, 28660, 65535, 32148, 65535, 41112, 65535, 27946, 30922, 38204, 40281, 39869, 36985, 40151, 65535, 35800, 
+      65535, 65535, 65535, 65535, 39252, 65535, 36968, 33282, 65535, 36069, 65535, 65535, 65535, 41714, 31284, 35598, 
+      65535, 37552, 65535, 37046, 65535, 65535, 34115, 65535, 32544, 36551, 65535, 65535, 36737, 35690, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 37096, 65535, 65535, 65535, 65535, 39460, 65535, 65535, 37298, 65535, 40289, 
+      65535, 34270, 65535, 65535, 34761, 38955, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41465, 
+      65535, 65535, 65535, 37699, 65535, 65535, 65535, 65535, 65535, 36669, 36670, 65535, 34735, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 32239, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33232, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 29363, 41253, 39768, 65535, 33100, 65535, 65535, 
+      36576, 65535, 65535, 65535, 65535, 31794, 31533, 65535, 37266, 33132, 37118, 65535, 34929, 35827, 65535, 35099, 
+      35908, 65535, 65535, 36752, 33819, 35669, 65535, 34003, 36455, 65535, 34415, 33777, 65535, 32058, 65535, 32325, 
+      34091, 65535, 40625, 65535, 65535, 41421, 40408, 35159, 29503, 65535, 20062, 19981, 65535, 65535, 65535, 65535, 
+      65535, 26648, 31999, 21443, 14706, 26254, 12394, 65535, 13198, 9456, 38161, 16486, 10929, 36456, 30248, 65535 },
+    { 3464, 14373, 8389, 65535, 36614, 65535, 12839, 24429, 14997, 38907, 3968, 15189, 65535, 17446, 9830, 65535, 
+      10197, 10423, 9666, 29245, 39051, 21491, 17283, 15373, 15755, 18040, 19310, 65535, 20985, 20618, 20459, 32573, 
+      65535, 65535, 27700, 31502, 26889, 26189, 41529, 26834, 36666, 40389, 38233, 27297, 37652, 35422, 30601, 65535, 
+      37884, 65535, 35601, 39752, 38569, 33276, 65535, 39247, 65535, 65535, 38377, 31069, 32337, 36846, 65535, 65535, 
+      37673, 65535, 40668, 65535, 39166, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37701, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36374, 65535, 
+      65535, 65535, 65535, 65535, 65535, 36767, 65535, 65535, 41912, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 38560, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35314, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 37748, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 36201, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35840, 65535, 65535, 35098, 65535, 38717, 65535, 
+      65535, 29280, 39250, 32925, 28840, 35141, 35085, 35428, 38486, 25994, 65535, 65535, 23917, 24315, 22015, 22447, 
+      23730, 28879, 22846, 31309, 39207, 23967, 65535, 18594, 65535, 41038, 12492, 26515, 32569, 10471, 13350, 23631 },
+    { 14014, 2458, 20840, 65535, 65535, 12839, 65535, 37263, 2340, 65535, 10747, 3490, 65535, 5788, 19137, 65535, 
+      9743, 18328, 13153, 16407, 65535, 29749, 10327, 14775, 14193, 12506, 14354, 65535, 23358, 20642, 17876, 40566, 
+      65535, 65535, 29651, 34595, 24432, 20985, 65535, 22169, 40916, 65535, 65535, 21258, 40845, 37190, 28197, 65535, 
+      40454, 65535, 36369, 65535, 41117, 31942, 65535, 41734, 65535, 65535, 38792, 24397, 27195, 33951, 65535, 65535, 
+      34499, 65535, 37998, 65535, 34853, 65535, 39962, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      35328, 65535, 37579, 65535, 65535, 65535, 65535, 65535, 26444, 65535, 65535, 65535, 32878, 65535, 65535, 65535, 
+      39876, 65535, 65535, 65535, 32553, 65535, 65535, 65535, 65535, 65535, 65535, 38862, 65535, 65535, 65535, 65535, 
+      32668, 30105, 38589, 65535, 65535, 65535, 65535, 34678, 65535, 65535, 65535, 33159, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 33735, 65535, 65535, 65535, 65535, 65535, 34094, 65535, 65535, 65535, 
+      36619, 65535, 65535, 65535, 65535, 65535, 65535, 41128, 65535, 65535, 65535, 65535, 65535, 65535, 23748, 65535, 
+      65535, 65535, 65535, 65535, 65535, 24309, 65535, 65535, 29979, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 27074, 65535, 65535, 65535, 65535, 39122, 65535, 65535, 65535, 65535, 65535, 23887, 65535, 
+      65535, 65535, 40161, 35092, 65535, 65535, 65535, 28021, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 27013, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 29473, 65535, 65535, 30400, 65535, 37526, 65535, 
+      65535, 18394, 40608, 30099, 22817, 36060, 36480, 39208, 65535, 21981, 65535, 65535, 18995, 22603, 22219, 12782, 
+      12277, 36523, 28885, 40589, 65535, 32400, 65535, 9991, 65535, 65535, 16687, 37836, 65535, 16614, 22580, 10875 },
+    { 23919, 38730, 17001, 29656, 12298, 24429, 37263, 65535, 39374, 14552, 26982, 39345, 20263, 41406, 21261, 22777, 
+      31549, 23100, 28385, 65535, 18271, 20347, 38839, 32890, 33906, 38282, 38514, 30757, 30747, 33799, 36764, 23437, 
+      28653, 28486, 33387, 32829, 39577, 65535, 30569, 65535, 32844, 32008, 33189, 65535, 35230, 36775, 41310, 33318, 
+      36455, 34141, 38575, 36000, 36810, 40966, 33524, 37233, 36929, 34568, 40456, 65535, 65535, 65535, 38111, 39887, 
+      65535, 36423, 65535, 38381, 65535, 65535, 65535, 37361, 38588, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41418, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 41901, 65535, 65535, 40750, 39808, 65535, 38580, 65535, 38378, 
+      38881, 65535, 40515, 65535, 65535, 39360, 38528, 34462, 31369, 65535, 30562, 28839, 41850, 38362, 34971, 65535, 
+      65535, 24223, 26156, 21070, 20899, 21298, 21501, 41222, 24785, 19043, 28135, 13062, 13394, 26008, 20582, 65535 },
+    { 16323, 3074, 23104, 65535, 65535, 14997, 2340, 39374, 65535, 65535, 12591, 1808, 65535, 3663, 20594, 65535, 
+      10505, 19601, 14131, 14306, 65535, 30701, 9294, 14789, 14058, 11615, 13441, 65535, 23407, 20371, 17239, 41247, 
+      65535, 65535, 29395, 34420, 23522, 19673, 65535, 20919, 40817, 65535, 65535, 19777, 40544, 36703, 27180, 65535, 
+      40044, 65535, 35718, 65535, 40688, 31019, 65535, 41280, 65535, 65535, 38024, 22720, 25719, 32712, 65535, 65535, 
+      33202, 65535, 36718, 65535, 33364, 65535, 38692, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      33448, 65535, 35701, 65535, 65535, 65535, 65535, 65535, 24128, 65535, 65535, 65535, 30591, 65535, 65535, 65535, 
+      37615, 65535, 65535, 65535, 30223, 65535, 65535, 65535, 65535, 65535, 65535, 36523, 65535, 65535, 65535, 65535, 
+      30368, 27820, 36277, 65535, 65535, 65535, 65535, 32453, 65535, 65535, 65535, 30986, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 31661, 65535, 40482, 65535, 65535, 65535, 32116, 65535, 65535, 65535, 
+      34746, 65535, 65535, 65535, 65535, 65535, 65535, 39535, 65535, 65535, 65535, 65535, 65535, 65535, 21902, 65535, 
+      65535, 65535, 65535, 65535, 65535, 22570, 65535, 65535, 28449, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 25754, 65535, 65535, 65535, 65535, 38499, 65535, 65535, 65535, 65535, 65535, 22635, 65535, 
+      65535, 65535, 39935, 34618, 65535, 65535, 65535, 27269, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 26438, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 29552, 65535, 65535, 30818, 65535, 38439, 65535, 
+      65535, 17478, 41883, 30891, 23174, 37353, 37838, 40864, 65535, 22798, 65535, 65535, 19751, 23817, 23743, 12593, 
+      11339, 38652, 30944, 65535, 65535, 34621, 65535, 10431, 65535, 65535, 18825, 40175, 65535, 18870, 24896, 9021 },
+    { 38461, 65535, 31517, 15400, 4174, 38907, 65535, 14552, 65535, 65535, 41172, 65535, 5787, 65535, 34206, 8331, 
+      65535, 35764, 41471, 65535, 10598, 28457, 65535, 65535, 65535, 65535, 65535, 16288, 39827, 65535, 65535, 24438, 
+      15267, 16503, 39417, 36483, 65535, 65535, 26724, 65535, 33167, 29496, 32544, 65535, 35539, 38938, 65535, 29217, 
+      36948, 30612, 41109, 35131, 36953, 65535, 25951, 37051, 34793, 26399, 41751, 65535, 65535, 65535, 30578, 34843, 
+      65535, 24539, 65535, 27975, 65535, 37190, 65535, 24060, 26805, 34076, 36195, 35746, 32812, 35989, 65535, 31661, 
+      65535, 65535, 65535, 39539, 35135, 41147, 32950, 29553, 65535, 32299, 65535, 65535, 65535, 37821, 28052, 32066, 
+      65535, 33940, 65535, 33522, 65535, 65535, 30871, 65535, 29557, 33358, 65535, 65535, 33633, 32705, 39616, 65535, 
+      65535, 65535, 65535, 65535, 65535, 34402, 65535, 65535, 40884, 65535, 37006, 65535, 65535, 34951, 65535, 37957, 
+      65535, 32011, 65535, 65535, 32557, 36763, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39779, 
+      65535, 65535, 65535, 36133, 65535, 65535, 65535, 65535, 65535, 35392, 35394, 41796, 33369, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 30996, 65535, 65535, 41882, 65535, 65535, 65535, 65535, 32451, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28614, 65535, 40679, 65535, 33179, 65535, 65535, 
+      37450, 65535, 65535, 65535, 65535, 32108, 31797, 65535, 38623, 33831, 38514, 65535, 36058, 37214, 65535, 36478, 
+      37468, 65535, 65535, 38794, 35656, 37884, 65535, 36024, 38939, 65535, 36989, 36466, 65535, 34644, 65535, 35052, 
+      37125, 65535, 65535, 65535, 65535, 65535, 65535, 39147, 33254, 65535, 21277, 22151, 65535, 65535, 65535, 65535, 
+      65535, 30811, 36121, 25562, 18140, 30389, 15000, 65535, 13858, 12164, 41721, 20594, 15079, 39872, 33830, 65535 },
+    { 7242, 12763, 12014, 65535, 39278, 3968, 10747, 26982, 12591, 41172, 65535, 12375, 65535, 14435, 8891, 65535, 
+      6230, 8697, 6104, 26845, 39962, 20420, 13437, 11553, 11862, 14090, 15342, 65535, 17907, 17065, 16592, 31607, 
+      65535, 65535, 24723, 28892, 23143, 22237, 40215, 22909, 34482, 38696, 36136, 23330, 35194, 32568, 26917, 41575, 
+      35270, 40988, 32531, 37364, 35962, 29782, 65535, 36637, 39736, 65535, 35283, 27101, 28422, 33181, 65535, 65535, 
+      33982, 65535, 37078, 65535, 35365, 65535, 38812, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      38265, 65535, 40319, 65535, 65535, 65535, 65535, 65535, 34107, 65535, 65535, 65535, 39721, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 40333, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 39669, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34464, 65535, 
+      65535, 65535, 65535, 65535, 65535, 35054, 65535, 65535, 40663, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 37603, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34372, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 37698, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 36362, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37035, 65535, 65535, 36799, 65535, 41419, 65535, 
+      65535, 28572, 65535, 35100, 29980, 38231, 38267, 39015, 65535, 27647, 65535, 65535, 25229, 26532, 24621, 22116, 
+      22652, 32810, 26577, 35271, 65535, 27918, 65535, 18465, 65535, 65535, 15539, 30285, 36132, 13829, 17285, 21571 },
+    { 16881, 4847, 23475, 65535, 65535, 15189, 3490, 39345, 1808, 65535, 12375, 65535, 65535, 2400, 19878, 65535, 
+      9413, 18737, 13111, 14530, 65535, 29539, 7492, 13226, 12443, 9821, 11642, 65535, 21815, 18681, 15471, 39893, 
+      65535, 65535, 27692, 32731, 21717, 17883, 65535, 19122, 39142, 65535, 40905, 18020, 38816, 34941, 25373, 65535, 
+      38293, 65535, 33932, 40995, 38933, 29213, 65535, 39520, 65535, 65535, 36224, 21031, 23965, 30919, 65535, 65535, 
+      31417, 65535, 34930, 65535, 31617, 65535, 36904, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41488, 65535, 
+      31871, 65535, 34123, 65535, 65535, 65535, 65535, 65535, 23194, 65535, 65535, 65535, 29535, 65535, 65535, 65535, 
+      36484, 65535, 65535, 65535, 29368, 65535, 65535, 65535, 65535, 65535, 65535, 35780, 65535, 65535, 65535, 65535, 
+      29983, 27505, 35820, 65535, 65535, 65535, 65535, 32299, 65535, 65535, 65535, 30957, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 31817, 65535, 40628, 65535, 65535, 65535, 32419, 65535, 65535, 65535, 
+      35181, 65535, 65535, 65535, 65535, 65535, 65535, 40259, 65535, 65535, 65535, 65535, 65535, 65535, 22434, 65535, 
+      65535, 65535, 65535, 65535, 65535, 23221, 65535, 65535, 29277, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 26771, 65535, 65535, 65535, 65535, 39909, 65535, 65535, 65535, 65535, 65535, 23721, 65535, 
+      65535, 65535, 41516, 36108, 65535, 65535, 65535, 28645, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 27904, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31247, 65535, 65535, 32584, 65535, 40247, 65535, 
+      65535, 18813, 65535, 32696, 24937, 39133, 39607, 65535, 65535, 24605, 65535, 65535, 21557, 25603, 25464, 14265, 
+      12724, 40006, 32375, 65535, 65535, 35843, 65535, 12227, 65535, 65535, 20173, 40953, 65535, 20039, 25884, 9720 },
+    { 65535, 65535, 37258, 10488, 9373, 65535, 65535, 20263, 65535, 5787, 65535, 65535, 65535, 65535, 39063, 2545, 
+      65535, 40469, 65535, 65535, 10671, 31837, 65535, 65535, 65535, 65535, 65535, 10512, 65535, 65535, 65535, 25584, 
+      10008, 12110, 41243, 37545, 65535, 65535, 25527, 65535, 33135, 28605, 32163, 65535, 35302, 39200, 65535, 27661, 
+      36674, 29179, 41363, 34439, 36534, 65535, 23107, 36491, 33601, 23235, 41445, 65535, 65535, 65535, 27399, 32433, 
+      65535, 19705, 65535, 23671, 65535, 34461, 65535, 18594, 21931, 30406, 32758, 32086, 28457, 31961, 65535, 26875, 
+      65535, 65535, 65535, 35405, 30202, 36808, 27708, 23917, 65535, 26698, 65535, 65535, 65535, 32352, 22266, 26324, 
+      65535, 28234, 65535, 27779, 65535, 65535, 25084, 65535, 23808, 27573, 65535, 65535, 27856, 26950, 33830, 65535, 
+      65535, 65535, 65535, 65535, 65535, 28733, 65535, 65535, 35243, 65535, 31430, 65535, 65535, 29442, 65535, 32437, 
+      65535, 26575, 36584, 65535, 27150, 31329, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34648, 
+      65535, 65535, 37705, 31139, 65535, 65535, 65535, 65535, 39934, 30650, 30652, 37264, 28586, 65535, 65535, 65535, 
+      39105, 39600, 65535, 65535, 26369, 65535, 39860, 37870, 65535, 65535, 39277, 65535, 28238, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 24542, 39952, 38172, 65535, 29887, 65535, 65535, 
+      34996, 65535, 65535, 65535, 65535, 29133, 28771, 65535, 36778, 31276, 36726, 65535, 33988, 35457, 65535, 34735, 
+      35949, 65535, 65535, 37948, 34608, 37345, 65535, 35243, 38806, 65535, 37077, 36775, 65535, 34837, 65535, 35477, 
+      38050, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35886, 65535, 20057, 22273, 65535, 65535, 65535, 65535, 
+      65535, 35113, 41112, 29614, 20653, 35350, 16424, 65535, 12694, 14120, 65535, 25710, 19555, 65535, 39535, 65535 },
+    { 19250, 6631, 25777, 65535, 65535, 17446, 5788, 41406, 3663, 65535, 14435, 2400, 65535, 65535, 21431, 65535, 
+      10692, 20132, 14389, 12802, 65535, 30426, 6800, 13487, 12573, 9155, 10858, 65535, 21865, 18446, 14896, 40377, 
+      65535, 65535, 27323, 32391, 20711, 16468, 65535, 17765, 38820, 65535, 40567, 16410, 38288, 34255, 24212, 65535, 
+      37658, 65535, 33084, 40422, 38273, 28120, 65535, 38830, 65535, 65535, 35239, 19186, 22322, 29486, 65535, 65535, 
+      29922, 65535, 33437, 65535, 29929, 65535, 35413, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39778, 65535, 
+      29803, 41822, 32056, 65535, 65535, 65535, 65535, 65535, 20795, 65535, 65535, 65535, 27143, 65535, 65535, 65535, 
+      34107, 65535, 65535, 65535, 26972, 40059, 65535, 65535, 65535, 65535, 65535, 33397, 65535, 65535, 65535, 65535, 
+      27723, 25285, 33520, 65535, 65535, 65535, 65535, 30160, 65535, 65535, 65535, 28905, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 29902, 65535, 38677, 65535, 65535, 65535, 30629, 65535, 65535, 65535, 
+      33504, 65535, 65535, 65535, 65535, 65535, 65535, 38873, 65535, 65535, 65535, 65535, 65535, 65535, 20932, 65535, 
+      65535, 65535, 65535, 65535, 65535, 21849, 65535, 65535, 28079, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 25853, 65535, 65535, 65535, 65535, 39591, 65535, 65535, 65535, 65535, 65535, 22934, 65535, 
+      65535, 65535, 41593, 35985, 65535, 65535, 65535, 28325, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 27780, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31732, 65535, 65535, 33379, 65535, 41455, 65535, 
+      65535, 18512, 65535, 33839, 25757, 40698, 41229, 65535, 65535, 25835, 65535, 65535, 22769, 27161, 27275, 14832, 
+      12643, 65535, 34600, 65535, 65535, 38187, 65535, 13386, 65535, 65535, 22451, 65535, 65535, 22395, 28279, 8681 },
+    { 12699, 21369, 12363, 65535, 33165, 9830, 19137, 21261, 20594, 34206, 8891, 19878, 39063, 21431, 65535, 41191, 
+      10805, 1966, 7276, 34233, 31442, 11724, 17673, 11778, 12737, 17021, 17339, 65535, 13118, 14423, 16252, 22892, 
+      65535, 41552, 19173, 22269, 21052, 22489, 31740, 22593, 26997, 30561, 28510, 24025, 28171, 26448, 24160, 33360, 
+      28554, 32968, 27001, 30195, 29222, 25886, 38319, 29894, 32430, 39755, 29754, 27644, 27531, 29996, 40811, 38124, 
+      30907, 65535, 33346, 65535, 32965, 40247, 34731, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40342, 65535, 
+      37555, 65535, 39218, 65535, 65535, 65535, 65535, 65535, 38084, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 37355, 65535, 65535, 38529, 65535, 65535, 65535, 65535, 35813, 65535, 65535, 33654, 34097, 31646, 31000, 
+      31337, 34838, 30509, 35539, 40574, 29861, 65535, 27354, 65535, 40157, 21963, 28688, 33007, 19680, 20331, 29557 },
+    { 65535, 65535, 39778, 8703, 11846, 65535, 65535, 22777, 65535, 8331, 65535, 65535, 2545, 65535, 41191, 65535, 
+      65535, 65535, 65535, 65535, 11556, 33397, 65535, 65535, 65535, 65535, 65535, 7982, 65535, 65535, 65535, 26312, 
+      7876, 10522, 65535, 38047, 65535, 65535, 25224, 65535, 33219, 28381, 32109, 65535, 35264, 39328, 65535, 27151, 
+      36600, 28699, 41458, 34211, 36398, 65535, 22070, 36292, 33160, 22037, 41292, 65535, 65535, 65535, 26127, 31454, 
+      65535, 17682, 65535, 21887, 65535, 33309, 65535, 16222, 19866, 28862, 31299, 30530, 26600, 30232, 65535, 24818, 
+      65535, 65535, 65535, 33599, 28054, 34899, 25419, 21439, 65535, 24235, 65535, 65535, 65535, 29943, 19724, 23795, 
+      65535, 25720, 65535, 25249, 65535, 65535, 22540, 65535, 21292, 25030, 65535, 65535, 25320, 24429, 31285, 65535, 
+      65535, 65535, 65535, 65535, 65535, 26264, 65535, 65535, 32783, 65535, 29010, 65535, 65535, 27063, 65535, 30046, 
+      65535, 24243, 34195, 65535, 24832, 28985, 65535, 65535, 65535, 65535, 65535, 40706, 65535, 65535, 65535, 32451, 
+      65535, 65535, 35570, 29027, 65535, 41024, 65535, 65535, 38003, 28670, 28672, 35348, 26597, 65535, 65535, 65535, 
+      37300, 37803, 65535, 65535, 24480, 65535, 38209, 36198, 65535, 65535, 37711, 65535, 26549, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 22968, 39023, 37197, 65535, 28639, 65535, 65535, 
+      34083, 65535, 65535, 65535, 65535, 28050, 27669, 65535, 36123, 30364, 36098, 65535, 33267, 34860, 65535, 34155, 
+      35453, 65535, 65535, 37729, 34345, 37272, 65535, 35091, 38893, 65535, 37285, 37083, 65535, 35123, 65535, 35855, 
+      38610, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37198, 65535, 20008, 22762, 65535, 65535, 65535, 65535, 
+      65535, 37108, 65535, 31552, 22140, 37600, 17623, 65535, 12999, 15603, 65535, 28049, 21729, 65535, 65535, 65535 },
+    { 13368, 12199, 18036, 65535, 65535, 10197, 9743, 31549, 10505, 65535, 6230, 9413, 65535, 10692, 10805, 65535, 
+      65535, 9440, 3712, 23470, 41773, 20196, 7536, 6063, 6034, 7888, 9114, 65535, 14053, 12094, 10735, 30845, 
+      65535, 65535, 20711, 25425, 17509, 16078, 38534, 16823, 31566, 36455, 33312, 17119, 31782, 28531, 21372, 39362, 
+      31585, 38493, 28098, 34006, 32270, 24592, 65535, 32922, 36427, 65535, 30746, 20880, 22347, 27606, 65535, 65535, 
+      28351, 65535, 31609, 65535, 29508, 65535, 33440, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38825, 65535, 
+      32083, 40971, 34165, 65535, 65535, 65535, 65535, 65535, 28459, 65535, 65535, 65535, 33752, 65535, 65535, 65535, 
+      39849, 65535, 65535, 65535, 34610, 65535, 65535, 65535, 65535, 65535, 65535, 41215, 65535, 65535, 65535, 65535, 
+      37050, 34880, 65535, 65535, 65535, 65535, 65535, 40002, 65535, 65535, 65535, 39029, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 40302, 65535, 65535, 65535, 65535, 65535, 41186, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31623, 65535, 
+      65535, 65535, 65535, 65535, 65535, 32514, 65535, 65535, 38662, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 36177, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33103, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 37696, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 36745, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38987, 65535, 65535, 39532, 65535, 65535, 65535, 
+      65535, 27957, 65535, 38601, 32132, 65535, 65535, 65535, 65535, 30650, 65535, 65535, 27858, 30369, 29047, 22515, 
+      21809, 38961, 32453, 41500, 65535, 34107, 65535, 19495, 65535, 65535, 20807, 36311, 41870, 19463, 23462, 19110 },
+    { 13570, 20652, 14033, 65535, 34886, 10423, 18328, 23100, 19601, 35764, 8697, 18737, 40469, 20132, 1966, 65535, 
+      9440, 65535, 5768, 32903, 32434, 11750, 15976, 9853, 10832, 15199, 15442, 65535, 11463, 12526, 14285, 22922, 
+      65535, 65535, 17765, 21180, 19169, 20523, 31540, 20634, 26246, 30135, 27825, 22059, 27251, 25244, 22356, 32987, 
+      27534, 32485, 25656, 29336, 28214, 24234, 38265, 28890, 31631, 39697, 28427, 25679, 25606, 28275, 40471, 37423, 
+      29178, 65535, 31716, 65535, 31173, 39429, 33162, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38789, 65535, 
+      35649, 40772, 37341, 65535, 65535, 65535, 65535, 65535, 36207, 65535, 65535, 65535, 40454, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 41998, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41061, 65535, 
+      65535, 65535, 65535, 65535, 65535, 41931, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 36692, 65535, 65535, 38657, 65535, 65535, 65535, 65535, 36174, 65535, 65535, 33863, 34713, 32432, 30562, 
+      30601, 36572, 31964, 37424, 65535, 31576, 65535, 27036, 65535, 65535, 22835, 30640, 34965, 20655, 21818, 28456 },
+    { 13118, 15578, 16366, 65535, 40411, 9666, 13153, 28385, 14131, 41471, 6104, 13111, 65535, 14389, 7276, 65535, 
+      3712, 5768, 65535, 27140, 38062, 16611, 10456, 5877, 6490, 10089, 10776, 65535, 11914, 10988, 10985, 27447, 
+      65535, 65535, 18738, 23114, 17234, 17023, 35459, 17491, 28982, 33585, 30691, 18332, 29471, 26611, 20936, 36496, 
+      29440, 35744, 26479, 31674, 30132, 23695, 65535, 30802, 34078, 65535, 29219, 22110, 22910, 27184, 65535, 40003, 
+      28007, 65535, 31033, 65535, 29529, 41625, 32741, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38299, 65535, 
+      32943, 40409, 34887, 65535, 65535, 65535, 65535, 65535, 31179, 65535, 65535, 65535, 36012, 65535, 65535, 65535, 
+      41660, 65535, 65535, 65535, 37192, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      40172, 38117, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35319, 65535, 
+      65535, 65535, 65535, 65535, 65535, 36223, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 39857, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36762, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 41174, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 40133, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41898, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 31508, 65535, 40778, 34923, 65535, 65535, 65535, 65535, 33050, 65535, 65535, 30416, 32310, 30592, 25808, 
+      25365, 38353, 32511, 40236, 65535, 33375, 65535, 22572, 65535, 65535, 21640, 34337, 39425, 19912, 22881, 22818 },
+    { 30157, 15127, 37106, 65535, 65535, 29245, 16407, 65535, 14306, 65535, 26845, 14530, 65535, 12802, 34233, 65535, 
+      23470, 32903, 27140, 65535, 65535, 65535, 17883, 25216, 24159, 19711, 20756, 65535, 32599, 28714, 24653, 65535, 
+      65535, 65535, 36430, 41216, 28121, 22797, 65535, 24096, 65535, 65535, 65535, 21725, 65535, 41558, 30430, 65535, 
+      65535, 65535, 39777, 65535, 65535, 34176, 65535, 65535, 65535, 65535, 41064, 22301, 26168, 33540, 65535, 65535, 
+      33548, 65535, 36625, 65535, 32268, 65535, 38388, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40753, 65535, 
+      28966, 65535, 30914, 65535, 65535, 65535, 65535, 65535, 14643, 65535, 41815, 65535, 21025, 65535, 65535, 65535, 
+      27884, 65535, 65535, 65535, 19260, 33231, 65535, 39167, 65535, 65535, 35247, 24423, 65535, 65535, 65535, 65535, 
+      17035, 14354, 22986, 34978, 37525, 65535, 37993, 18438, 65535, 65535, 65535, 16790, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 17356, 65535, 26177, 39861, 65535, 65535, 17889, 65535, 65535, 65535, 
+      20705, 36164, 65535, 65535, 65535, 65535, 35773, 26214, 65535, 65535, 65535, 65535, 65535, 31830, 8289, 65535, 
+      65535, 65535, 65535, 65535, 65535, 9443, 65535, 65535, 15875, 31997, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 14569, 65535, 34575, 65535, 65535, 29510, 65535, 65535, 65535, 40608, 65535, 12430, 65535, 
+      65535, 38084, 32859, 26875, 65535, 65535, 65535, 19113, 65535, 65535, 65535, 38977, 65535, 65535, 65535, 65535, 
+      65535, 19488, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 25787, 65535, 65535, 28802, 65535, 38204, 65535, 
+      65535, 11299, 65535, 31118, 22512, 39766, 40632, 65535, 65535, 24889, 65535, 65535, 22347, 27994, 29822, 13637, 
+      9636, 65535, 39949, 65535, 65535, 65535, 65535, 15748, 65535, 65535, 29691, 65535, 65535, 30733, 37170, 5921 },
+    { 39900, 65535, 33713, 20126, 14187, 39051, 65535, 18271, 65535, 10598, 39962, 65535, 10671, 65535, 31442, 11556, 
+      41773, 32434, 38062, 65535, 65535, 22202, 65535, 39581, 40646, 65535, 65535, 17208, 32711, 36669, 40727, 14913, 
+      12467, 10820, 30593, 26899, 39210, 65535, 16134, 65535, 22837, 18907, 22074, 65535, 25137, 28794, 38501, 18670, 
+      26539, 20036, 30971, 24591, 26494, 35886, 16226, 26550, 24196, 16984, 31354, 65535, 65535, 38846, 20974, 24544, 
+      39407, 18304, 38103, 20151, 41923, 27035, 37372, 20106, 20401, 24880, 26653, 26471, 24732, 27197, 39263, 24584, 
+      65535, 39303, 65535, 30754, 28184, 32621, 27108, 25933, 65535, 28178, 65535, 65535, 65535, 32545, 26938, 29197, 
+      65535, 30510, 65535, 30552, 65535, 65535, 29380, 65535, 29207, 31814, 65535, 65535, 32407, 32013, 37314, 65535, 
+      65535, 65535, 65535, 65535, 65535, 34544, 65535, 65535, 40842, 65535, 37660, 65535, 65535, 36132, 65535, 38895, 
+      65535, 33750, 65535, 65535, 34397, 38225, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 39352, 65535, 65535, 65535, 65535, 65535, 39392, 39394, 65535, 37338, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 35474, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37824, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34385, 65535, 65535, 65535, 40190, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 39597, 39219, 65535, 65535, 41859, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 30607, 32308, 65535, 65535, 65535, 65535, 
+      65535, 40028, 65535, 35232, 28715, 38497, 25504, 65535, 23129, 22726, 65535, 28891, 24742, 65535, 38756, 65535 },
+    { 24074, 32152, 21510, 65535, 29156, 21491, 29749, 20347, 30701, 28457, 20420, 29539, 31837, 30426, 11724, 33397, 
+      20196, 11750, 16611, 65535, 22202, 65535, 24710, 17378, 18445, 23004, 22281, 39316, 11394, 15170, 19025, 11192, 
+      33986, 31052, 13060, 13456, 19753, 23847, 20038, 23202, 16336, 19073, 17597, 25533, 18057, 17815, 21025, 21784, 
+      18829, 21540, 19174, 19760, 19410, 20690, 26601, 20025, 21726, 28036, 21558, 28127, 26166, 25026, 29172, 27042, 
+      25933, 35413, 27117, 33835, 28559, 29415, 27865, 39344, 36559, 32779, 32431, 33391, 35992, 35474, 32951, 38123, 
+      34639, 34502, 35558, 37661, 40753, 39649, 65535, 65535, 41261, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      41975, 41567, 39497, 40218, 41154, 37095, 40945, 38776, 65535, 38143, 33129, 32188, 33739, 30705, 29702, 39088 },
+    { 20088, 12254, 25435, 65535, 65535, 17283, 10327, 38839, 9294, 65535, 13437, 7492, 65535, 6800, 17673, 65535, 
+      7536, 15976, 10456, 17883, 65535, 24710, 65535, 7333, 6282, 2368, 4154, 65535, 15240, 11684, 8106, 33989, 
+      65535, 65535, 20523, 25591, 14229, 10713, 40120, 11859, 32019, 37471, 33767, 11175, 31513, 27534, 17919, 40230, 
+      30918, 39049, 26460, 33661, 31544, 21732, 65535, 32116, 35995, 65535, 28733, 14634, 17030, 23626, 65535, 41560, 
+      24184, 65535, 27677, 65535, 24657, 65535, 29638, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34477, 65535, 
+      25903, 36599, 28104, 65535, 65535, 65535, 65535, 65535, 20926, 65535, 41083, 41913, 26295, 65535, 65535, 65535, 
+      32604, 65535, 65535, 65535, 27076, 38436, 65535, 65535, 65535, 65535, 65535, 33683, 65535, 65535, 65535, 65535, 
+      29717, 27675, 34952, 65535, 65535, 65535, 65535, 32864, 65535, 65535, 65535, 32099, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 33647, 65535, 65535, 65535, 65535, 65535, 34795, 65535, 65535, 65535, 
+      37947, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 26158, 65535, 
+      65535, 65535, 65535, 65535, 65535, 27314, 65535, 65535, 33727, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 31957, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 29229, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 34958, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 34511, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38505, 65535, 65535, 40021, 65535, 65535, 65535, 
+      65535, 25206, 65535, 40185, 32375, 65535, 65535, 65535, 65535, 32085, 65535, 65535, 29043, 32922, 32489, 21553, 
+      19431, 65535, 38113, 65535, 65535, 40631, 65535, 19718, 65535, 65535, 25908, 65535, 65535, 25150, 30075, 15070 },
+    { 18771, 17169, 22213, 65535, 65535, 15373, 14775, 32890, 14789, 65535, 11553, 13226, 65535, 13487, 11778, 65535, 
+      6063, 9853, 5877, 25216, 39581, 17378, 7333, 65535, 1096, 5767, 5630, 65535, 8624, 6074, 5115, 26893, 
+      65535, 65535, 14931, 19826, 11608, 11180, 33690, 11615, 26143, 31317, 27907, 12552, 26111, 22643, 15425, 34183, 
+      25800, 33176, 22099, 28332, 26476, 18542, 40608, 27113, 30747, 41925, 24717, 16306, 17042, 21687, 41266, 36600, 
+      22466, 65535, 25646, 65535, 23814, 37833, 27445, 65535, 65535, 65535, 41883, 65535, 65535, 65535, 32894, 65535, 
+      27066, 35031, 29017, 65535, 65535, 65535, 65535, 65535, 26392, 65535, 41202, 65535, 30660, 65535, 65535, 65535, 
+      35978, 65535, 65535, 65535, 32145, 41352, 65535, 65535, 65535, 65535, 65535, 38561, 65535, 65535, 65535, 65535, 
+      35907, 34138, 40617, 65535, 65535, 65535, 65535, 39353, 65535, 65535, 65535, 38840, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 40595, 65535, 65535, 65535, 65535, 65535, 41881, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33489, 65535, 
+      65535, 65535, 65535, 65535, 65535, 34646, 65535, 65535, 41054, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 39188, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36368, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 41772, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 41114, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 31935, 65535, 65535, 37581, 65535, 65535, 65535, 65535, 36435, 65535, 65535, 33555, 36361, 35107, 27356, 
+      25918, 65535, 38129, 65535, 65535, 39229, 65535, 24765, 65535, 65535, 26768, 40004, 65535, 25283, 28688, 22115 },
+    { 19103, 16548, 22854, 65535, 65535, 15755, 14193, 33906, 14058, 65535, 11862, 12443, 65535, 12573, 12737, 65535, 
+      6034, 10832, 6490, 24159, 40646, 18445, 6282, 1096, 65535, 4671, 4611, 65535, 9374, 6466, 4743, 27837, 
+      65535, 65535, 15458, 20420, 11476, 10551, 34468, 11095, 26784, 32029, 28549, 11842, 26652, 23066, 15338, 34878, 
+      26282, 33833, 22416, 28865, 26951, 18614, 41364, 27577, 31272, 65535, 24983, 15620, 16583, 21573, 41880, 37087, 
+      22323, 65535, 25576, 65535, 23546, 38230, 27412, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32793, 65535, 
+      26534, 34938, 28530, 65535, 65535, 65535, 65535, 65535, 25381, 65535, 40883, 41850, 29763, 65535, 65535, 65535, 
+      35207, 65535, 65535, 65535, 31181, 40654, 65535, 65535, 65535, 65535, 65535, 37629, 65535, 65535, 65535, 65535, 
+      34852, 33063, 39610, 65535, 65535, 65535, 65535, 38280, 65535, 65535, 65535, 37753, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 39501, 65535, 65535, 65535, 65535, 65535, 40785, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32426, 65535, 
+      65535, 65535, 65535, 65535, 65535, 33594, 65535, 65535, 40009, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 38191, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35399, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 40890, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 40279, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 31063, 65535, 65535, 37008, 65535, 65535, 65535, 65535, 36006, 65535, 65535, 33089, 36081, 34953, 26649, 
+      25084, 65535, 38385, 65535, 65535, 39693, 65535, 24175, 65535, 65535, 26839, 40777, 65535, 25453, 29103, 21160 },
+    { 21076, 14530, 25902, 65535, 65535, 18040, 12506, 38282, 11615, 65535, 14090, 9821, 65535, 9155, 17021, 65535, 
+      7888, 15199, 10089, 19711, 65535, 23004, 2368, 5767, 4671, 65535, 1848, 65535, 13075, 9408, 5742, 31901, 
+      65535, 65535, 18176, 23244, 11945, 8830, 37819, 9866, 29671, 35139, 31415, 9548, 29146, 25169, 15691, 37885, 
+      28551, 36694, 24113, 31293, 29178, 19457, 65535, 29751, 33628, 65535, 26412, 13205, 15220, 21526, 65535, 39202, 
+      22125, 65535, 25591, 65535, 22763, 39952, 27538, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32509, 65535, 
+      24502, 34646, 26656, 65535, 65535, 65535, 65535, 65535, 21114, 65535, 39525, 40399, 26001, 65535, 65535, 65535, 
+      31967, 65535, 65535, 65535, 27103, 37677, 65535, 65535, 65535, 65535, 41736, 33658, 65535, 65535, 65535, 65535, 
+      30353, 28481, 35310, 65535, 65535, 65535, 65535, 33697, 65535, 65535, 65535, 33112, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 34833, 65535, 65535, 65535, 65535, 65535, 36116, 65535, 65535, 65535, 
+      39338, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 27926, 65535, 
+      65535, 65535, 65535, 65535, 65535, 29152, 65535, 65535, 35586, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 33993, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31346, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 37201, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 36804, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40872, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 27490, 65535, 65535, 34733, 65535, 65535, 65535, 65535, 34378, 65535, 65535, 31345, 35103, 34536, 23920, 
+      21767, 65535, 39638, 65535, 65535, 41793, 65535, 22046, 65535, 65535, 27545, 65535, 65535, 26601, 31162, 17283 },
+    { 22454, 16372, 26942, 65535, 65535, 19310, 14354, 38514, 13441, 65535, 15342, 11642, 65535, 10858, 17339, 65535, 
+      9114, 15442, 10776, 20756, 65535, 22281, 4154, 5630, 4611, 1848, 65535, 65535, 11850, 8023, 4113, 30694, 
+      65535, 65535, 16561, 21621, 10100, 7145, 36284, 8106, 28036, 33543, 29771, 8028, 27433, 23407, 13843, 36254, 
+      26803, 35033, 22308, 29564, 27423, 17611, 65535, 27987, 31882, 65535, 24583, 11771, 13532, 19701, 65535, 37415, 
+      20312, 65535, 23768, 65535, 21016, 38128, 25710, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 30722, 65535, 
+      23016, 32862, 25135, 65535, 65535, 65535, 65535, 65535, 20771, 65535, 37917, 38812, 25255, 65535, 65535, 65535, 
+      30944, 65535, 65535, 65535, 26588, 36549, 65535, 65535, 65535, 65535, 40696, 33065, 65535, 65535, 65535, 65535, 
+      30290, 28568, 34999, 65535, 65535, 65535, 65535, 33777, 65535, 65535, 65535, 33346, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 35207, 65535, 65535, 65535, 65535, 65535, 36603, 65535, 65535, 65535, 
+      39874, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28868, 65535, 
+      65535, 65535, 65535, 65535, 65535, 30157, 65535, 65535, 36591, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 35193, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32647, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 38658, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 38340, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 29021, 65535, 65535, 36523, 65535, 65535, 65535, 65535, 36217, 65535, 65535, 33181, 36949, 36358, 25671, 
+      23401, 65535, 41246, 65535, 65535, 65535, 65535, 23869, 65535, 65535, 29225, 65535, 65535, 28198, 32555, 18744 },
+    { 65535, 65535, 65535, 6171, 19540, 65535, 65535, 30757, 65535, 16288, 65535, 65535, 10512, 65535, 65535, 7982, 
+      65535, 65535, 65535, 65535, 17208, 39316, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 30375, 
+      6005, 9875, 65535, 40890, 65535, 65535, 26458, 65535, 35083, 29622, 33620, 65535, 36644, 40997, 65535, 27596, 
+      37798, 29124, 65535, 35070, 37417, 65535, 21234, 37124, 33422, 20636, 65535, 65535, 65535, 65535, 24094, 30070, 
+      65535, 13365, 65535, 18222, 65535, 31229, 65535, 10036, 15101, 25635, 28246, 27160, 22283, 26222, 65535, 19732, 
+      65535, 65535, 65535, 29136, 22399, 29986, 19194, 14232, 65535, 17062, 65535, 65535, 65535, 22976, 11779, 16136, 
+      65535, 18171, 40168, 17569, 65535, 65535, 14606, 65535, 13317, 17078, 65535, 65535, 17345, 16450, 23360, 39282, 
+      65535, 65535, 65535, 65535, 65535, 18365, 65535, 65535, 24892, 38535, 21219, 65535, 41158, 19391, 65535, 22324, 
+      38762, 16746, 26459, 65535, 17373, 21401, 65535, 65535, 65535, 65535, 39831, 33191, 65535, 65535, 65535, 25255, 
+      65535, 65535, 28510, 22148, 38863, 34059, 65535, 65535, 31488, 22228, 22230, 28936, 20193, 65535, 65535, 65535, 
+      31169, 31687, 40113, 65535, 18505, 65535, 32515, 30499, 65535, 65535, 32288, 65535, 21162, 39814, 41558, 65535, 
+      65535, 65535, 40006, 65535, 39545, 65535, 38615, 65535, 65535, 18200, 35480, 33595, 65535, 24610, 65535, 65535, 
+      30826, 65535, 65535, 65535, 39777, 24595, 24175, 65535, 33562, 27318, 33620, 65535, 30652, 32546, 65535, 31931, 
+      33421, 65535, 65535, 36432, 33099, 36447, 65535, 34146, 38478, 65535, 37332, 37456, 65535, 35534, 65535, 36510, 
+      39686, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40714, 65535, 20584, 24652, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 37254, 26908, 65535, 21958, 65535, 15677, 20835, 65535, 35118, 28416, 65535, 65535, 65535 },
+    { 24402, 25772, 25468, 65535, 40503, 20985, 23358, 30747, 23407, 39827, 17907, 21815, 65535, 21865, 13118, 65535, 
+      14053, 11463, 11914, 32599, 32711, 11394, 15240, 8624, 9374, 13075, 11850, 65535, 65535, 3958, 8027, 18851, 
+      65535, 39888, 6825, 11372, 8851, 12461, 25094, 11881, 17574, 22693, 19333, 14152, 17733, 14697, 11272, 25563, 
+      17589, 24580, 14643, 19956, 18280, 12776, 31996, 18942, 22377, 33305, 17410, 16937, 15550, 16892, 32704, 28290, 
+      17809, 65535, 20254, 38924, 19967, 29769, 21711, 65535, 65535, 35100, 33709, 35015, 39298, 37279, 27343, 65535, 
+      25090, 29351, 26517, 38153, 65535, 39720, 65535, 65535, 29873, 65535, 36776, 37853, 32225, 65535, 65535, 65535, 
+      35748, 65535, 65535, 65535, 34558, 40089, 65535, 65535, 65535, 65535, 65535, 40191, 65535, 65535, 65535, 65535, 
+      39844, 38684, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40649, 65535, 
+      65535, 65535, 65535, 65535, 65535, 41975, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 40377, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41910, 65535, 65535, 35980, 
+      34444, 65535, 65535, 65535, 65535, 65535, 65535, 33334, 65535, 65535, 33374, 40908, 65535, 31455, 33257, 30309 },
+    { 24081, 22969, 26359, 65535, 65535, 20618, 20642, 33799, 20371, 65535, 17065, 18681, 65535, 18446, 14423, 65535, 
+      12094, 12526, 10988, 28714, 36669, 15170, 11684, 6074, 6466, 9408, 8023, 65535, 3958, 65535, 4081, 22701, 
+      65535, 65535, 9031, 14051, 6650, 8938, 28438, 8615, 20462, 25833, 22224, 10630, 20214, 16605, 10066, 28632, 
+      19819, 27518, 16025, 22421, 20486, 12718, 35239, 21112, 24821, 36492, 18653, 13789, 13139, 16255, 35493, 30622, 
+      17104, 65535, 20052, 41949, 18835, 31781, 21753, 65535, 65535, 37494, 35848, 37211, 41845, 39455, 27316, 65535, 
+      23131, 29422, 24818, 39898, 65535, 41275, 65535, 65535, 26230, 65535, 36167, 37204, 29081, 65535, 65535, 65535, 
+      33238, 65535, 65535, 65535, 31204, 38027, 65535, 65535, 65535, 65535, 65535, 37110, 65535, 65535, 65535, 65535, 
+      36182, 34906, 39984, 65535, 65535, 65535, 65535, 39965, 65535, 65535, 65535, 39932, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36717, 65535, 
+      65535, 65535, 65535, 65535, 65535, 38058, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40669, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 36888, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39554, 65535, 41128, 32946, 
+      31088, 65535, 65535, 65535, 65535, 65535, 65535, 30607, 65535, 65535, 32547, 65535, 65535, 30892, 33614, 26689 },
+    { 23830, 20052, 27272, 65535, 65535, 20459, 17876, 36764, 17239, 65535, 16592, 15471, 65535, 14896, 16252, 65535, 
+      10735, 14285, 10985, 24653, 40727, 19025, 8106, 5115, 4743, 5742, 4113, 65535, 8027, 4081, 65535, 26759, 
+      65535, 65535, 12456, 17521, 6838, 6249, 32171, 6532, 23943, 29436, 25683, 7777, 23408, 19470, 10719, 32160, 
+      22833, 30957, 18511, 25562, 23468, 14202, 38861, 24051, 27907, 40063, 20918, 11414, 11927, 16902, 38739, 33533, 
+      17628, 65535, 20934, 65535, 18803, 34396, 22804, 65535, 65535, 40373, 38519, 39916, 65535, 65535, 28113, 65535, 
+      21965, 30261, 23903, 65535, 65535, 65535, 65535, 65535, 22767, 65535, 36146, 37119, 26288, 65535, 65535, 65535, 
+      31171, 65535, 65535, 65535, 28108, 36395, 65535, 65535, 65535, 65535, 40721, 34300, 65535, 65535, 65535, 65535, 
+      32629, 31191, 36803, 65535, 65535, 65535, 65535, 36322, 65535, 65535, 65535, 36152, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 38213, 65535, 65535, 65535, 65535, 65535, 39767, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32637, 65535, 
+      65535, 65535, 65535, 65535, 65535, 33981, 65535, 65535, 40394, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 39168, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36691, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 33135, 65535, 65535, 40408, 65535, 65535, 65535, 65535, 39856, 65535, 65535, 36857, 40284, 39384, 29649, 
+      27489, 65535, 65535, 65535, 65535, 65535, 65535, 27649, 65535, 65535, 31527, 65535, 65535, 30187, 33791, 22854 },
+    { 34937, 65535, 31278, 34553, 26899, 32573, 40566, 23437, 41247, 24438, 31607, 39893, 25584, 40377, 22892, 26312, 
+      30845, 22922, 27447, 65535, 14913, 11192, 33989, 26893, 27837, 31901, 30694, 30375, 18851, 22701, 26759, 65535, 
+      24526, 21062, 15722, 12087, 24375, 29580, 9150, 28493, 9579, 9146, 9755, 31047, 12041, 14679, 23607, 11355, 
+      13378, 11591, 16808, 12576, 13616, 21206, 15432, 13954, 13565, 16868, 17909, 32308, 29116, 24600, 18363, 17521, 
+      25287, 24365, 24751, 22649, 27960, 20197, 24568, 28552, 25403, 22257, 22405, 23136, 25041, 25030, 28145, 26992, 
+      34444, 29008, 34452, 27691, 29774, 29769, 30912, 33180, 65535, 34224, 37184, 38150, 65535, 35864, 36732, 36599, 
+      65535, 36918, 40325, 37533, 65535, 65535, 38312, 65535, 39325, 40216, 65535, 65535, 41049, 41300, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 41325, 65535, 39224, 65535, 37884, 36297, 65535, 36497, 35279, 41185, 38995, 65535 },
+    { 65535, 65535, 65535, 11523, 19238, 65535, 65535, 28653, 65535, 15267, 65535, 65535, 10008, 65535, 65535, 7876, 
+      65535, 65535, 65535, 65535, 12467, 33986, 65535, 65535, 65535, 65535, 65535, 6005, 65535, 65535, 65535, 24526, 
+      65535, 3922, 39549, 34885, 65535, 65535, 20516, 65535, 29115, 23699, 27685, 65535, 30741, 35075, 65535, 21797, 
+      31931, 23344, 37040, 29247, 31579, 65535, 15704, 31321, 27720, 15310, 36259, 65535, 65535, 65535, 19122, 24882, 
+      65535, 9812, 41868, 14170, 65535, 26374, 40442, 8833, 11989, 21369, 23899, 23005, 18793, 22515, 39900, 16942, 
+      65535, 39013, 65535, 25807, 20208, 27048, 17733, 14526, 65535, 17170, 65535, 65535, 65535, 22561, 14531, 17419, 
+      65535, 19071, 38462, 18854, 65535, 65535, 17086, 65535, 16744, 19574, 65535, 65535, 20096, 19602, 25429, 39832, 
+      65535, 65535, 65535, 65535, 65535, 22080, 65535, 65535, 28422, 41128, 25194, 65535, 65535, 23702, 65535, 26433, 
+      41874, 21447, 30421, 65535, 22103, 25808, 65535, 65535, 65535, 65535, 65535, 37430, 65535, 65535, 65535, 30078, 
+      65535, 65535, 33400, 27327, 65535, 38938, 65535, 65535, 36750, 27688, 27690, 34299, 25712, 65535, 65535, 65535, 
+      36650, 37167, 65535, 65535, 24236, 65535, 38164, 36168, 65535, 65535, 38029, 65535, 27022, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 24179, 41483, 39598, 65535, 30612, 65535, 65535, 
+      36827, 65535, 65535, 65535, 65535, 30594, 30175, 65535, 39527, 33302, 39577, 65535, 36612, 38481, 65535, 37851, 
+      39323, 65535, 65535, 65535, 38859, 65535, 65535, 39847, 65535, 65535, 65535, 65535, 65535, 40854, 65535, 41753, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 25635, 29231, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 39425, 29822, 65535, 25118, 65535, 19639, 23336, 65535, 35686, 29547, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 15421, 20659, 65535, 65535, 28486, 65535, 16503, 65535, 65535, 12110, 65535, 41552, 10522, 
+      65535, 65535, 65535, 65535, 10820, 31052, 65535, 65535, 65535, 65535, 65535, 9875, 39888, 65535, 65535, 21062, 
+      3922, 65535, 35778, 31047, 65535, 65535, 16600, 65535, 25211, 19779, 23767, 65535, 26819, 31156, 65535, 17888, 
+      28008, 19439, 33118, 25330, 27659, 38696, 11938, 27406, 23833, 11684, 32354, 65535, 65535, 40248, 15673, 21239, 
+      40491, 8134, 38055, 11591, 65535, 22907, 36679, 9291, 10393, 18354, 20778, 20027, 16411, 19852, 36436, 15172, 
+      65535, 35690, 65535, 23311, 18689, 24776, 16871, 15113, 65535, 17412, 40248, 40606, 65535, 22139, 16569, 18390, 
+      65535, 19696, 36714, 19734, 65535, 65535, 18799, 65535, 19018, 21160, 65535, 65535, 21812, 21581, 26503, 39492, 
+      65535, 65535, 65535, 65535, 65535, 24305, 65535, 65535, 30353, 65535, 27495, 65535, 65535, 26255, 65535, 28793, 
+      65535, 24297, 32598, 65535, 24957, 28376, 65535, 65535, 65535, 65535, 65535, 39678, 65535, 65535, 65535, 32858, 
+      65535, 65535, 36186, 30399, 65535, 41648, 65535, 65535, 39789, 30964, 30966, 37443, 29051, 65535, 65535, 65535, 
+      39873, 40387, 65535, 65535, 27754, 65535, 41530, 39563, 65535, 65535, 41486, 65535, 30643, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 27949, 65535, 65535, 65535, 34426, 65535, 65535, 
+      40691, 65535, 65535, 65535, 65535, 34465, 34044, 65535, 65535, 37192, 65535, 65535, 40518, 65535, 65535, 41769, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 29389, 32796, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 41679, 32639, 65535, 28139, 65535, 23088, 26093, 65535, 37077, 31422, 65535, 65535, 65535 },
+    { 31077, 31995, 31447, 65535, 41059, 27700, 29651, 33387, 29395, 39417, 24723, 27692, 41243, 27323, 19173, 65535, 
+      20711, 17765, 18738, 36430, 30593, 13060, 20523, 14931, 15458, 18176, 16561, 65535, 6825, 9031, 12456, 15722, 
+      39549, 35778, 65535, 5068, 8661, 13933, 19774, 12795, 11497, 16982, 13247, 15345, 11194, 7877, 8378, 19709, 
+      10883, 18536, 7915, 13409, 11565, 7657, 26406, 12213, 15820, 27608, 10695, 16709, 13877, 12022, 26464, 21672, 
+      12944, 36522, 14586, 32961, 15522, 23011, 15729, 41348, 36641, 28532, 27005, 28339, 32842, 30598, 21261, 35890, 
+      21596, 23147, 22507, 31347, 37158, 32896, 39862, 65535, 30255, 65535, 31030, 32125, 30858, 65535, 65535, 65535, 
+      32760, 65535, 38185, 65535, 33695, 36129, 65535, 40066, 65535, 65535, 40421, 38326, 65535, 65535, 65535, 65535, 
+      39910, 39366, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41955, 
+      39941, 65535, 65535, 65535, 65535, 65535, 65535, 39629, 65535, 65535, 40146, 65535, 65535, 38165, 39505, 35253 },
+    { 34743, 36967, 34059, 65535, 38695, 31502, 34595, 32829, 34420, 36483, 28892, 32731, 37545, 32391, 22269, 38047, 
+      25425, 21180, 23114, 41216, 26899, 13456, 25591, 19826, 20420, 23244, 21621, 40890, 11372, 14051, 17521, 12087, 
+      34885, 31047, 5068, 65535, 13129, 18479, 14790, 17237, 6429, 11931, 8183, 19733, 6370, 4393, 11648, 14641, 
+      6390, 13475, 5794, 8589, 7080, 9147, 21348, 7757, 11008, 22542, 8105, 20447, 17086, 12855, 21460, 16927, 
+      13643, 31462, 14002, 27906, 16374, 18530, 14511, 36300, 31575, 23728, 22385, 23669, 27950, 25933, 19494, 30935, 
+      22856, 21076, 23240, 27013, 32376, 28709, 34941, 39305, 33727, 39265, 29397, 30483, 33268, 38453, 65535, 65535, 
+      33899, 41747, 35474, 65535, 36334, 36296, 65535, 39236, 65535, 65535, 40325, 40126, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41834, 65535, 40282 },
+    { 30324, 26471, 32988, 65535, 65535, 26889, 24432, 39577, 23522, 65535, 23143, 21717, 65535, 20711, 21052, 65535, 
+      17509, 19169, 17234, 28121, 39210, 19753, 14229, 11608, 11476, 11945, 10100, 65535, 8851, 6650, 6838, 24375, 
+      65535, 65535, 8661, 13129, 65535, 5351, 27787, 4144, 19169, 24759, 20789, 6688, 18075, 13801, 3880, 27219, 
+      17233, 25849, 12417, 20063, 17795, 7513, 33991, 18298, 22254, 35041, 14535, 8430, 6710, 10098, 33115, 27533, 
+      10860, 65535, 14107, 39881, 12305, 28084, 15967, 65535, 65535, 34247, 32210, 33624, 38742, 35761, 21317, 65535, 
+      16524, 23462, 18172, 35523, 65535, 36604, 65535, 65535, 21901, 65535, 29709, 30723, 23502, 65535, 65535, 65535, 
+      26929, 65535, 38282, 65535, 26007, 31482, 65535, 36695, 65535, 65535, 35900, 31405, 65535, 65535, 65535, 65535, 
+      31764, 30974, 34743, 41169, 65535, 65535, 65535, 35692, 65535, 65535, 65535, 36087, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 38519, 65535, 65535, 65535, 65535, 65535, 40396, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35318, 65535, 
+      65535, 65535, 65535, 65535, 65535, 36825, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40546, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 38001, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35512, 
+      32862, 65535, 65535, 65535, 65535, 65535, 65535, 33934, 65535, 65535, 38315, 65535, 65535, 36889, 40081, 27718 },
+    { 29440, 22730, 33386, 65535, 65535, 26189, 20985, 65535, 19673, 65535, 22237, 17883, 65535, 16468, 22489, 65535, 
+      16078, 20523, 17023, 22797, 65535, 23847, 10713, 11180, 10551, 8830, 7145, 65535, 12461, 8938, 6249, 29580, 
+      65535, 65535, 13933, 18479, 5351, 65535, 33100, 1360, 24464, 30041, 26051, 1697, 23248, 18908, 7987, 32432, 
+      22315, 31024, 17323, 25152, 22836, 11930, 39185, 23292, 27247, 40184, 19115, 5166, 6393, 13043, 38015, 32243, 
+      13535, 65535, 17048, 65535, 13956, 32488, 19021, 65535, 65535, 38770, 36565, 37980, 65535, 40016, 23763, 65535, 
+      16031, 25886, 18089, 39329, 65535, 40150, 65535, 65535, 17415, 65535, 30780, 31686, 20219, 65535, 65535, 65535, 
+      24922, 65535, 39779, 65535, 22268, 30184, 65535, 36057, 65535, 65535, 34490, 28254, 65535, 65535, 65535, 65535, 
+      27385, 26301, 31046, 39027, 40773, 65535, 65535, 31236, 65535, 65535, 65535, 31395, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 33706, 65535, 40423, 65535, 65535, 65535, 35487, 65535, 65535, 65535, 
+      38820, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 29981, 65535, 
+      65535, 65535, 65535, 65535, 65535, 31481, 65535, 65535, 37636, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 37191, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35227, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 41840, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 41978, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 32911, 65535, 65535, 41982, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39236, 65535, 65535, 30988, 
+      28045, 65535, 65535, 65535, 65535, 65535, 65535, 29854, 65535, 65535, 36361, 65535, 65535, 35336, 39521, 22728 },
+    { 65535, 65535, 40385, 31911, 30251, 41529, 65535, 30569, 65535, 26724, 40215, 65535, 25527, 65535, 31740, 25224, 
+      38534, 31540, 35459, 65535, 16134, 20038, 40120, 33690, 34468, 37819, 36284, 26458, 25094, 28438, 32171, 9150, 
+      20516, 16600, 19774, 14790, 27787, 33100, 65535, 31803, 8647, 3206, 7168, 34209, 10250, 14561, 25613, 2768, 
+      11499, 3926, 16557, 8991, 11225, 22108, 6951, 11077, 8125, 8328, 16085, 34220, 30470, 23977, 9217, 9320, 
+      24344, 16918, 22433, 14135, 26584, 12063, 21460, 21646, 17406, 13134, 13513, 14106, 15964, 15916, 23152, 18152, 
+      32467, 23327, 31731, 18736, 20721, 20828, 22176, 25321, 65535, 25895, 30651, 31468, 65535, 26887, 29741, 28578, 
+      41533, 28559, 32077, 29319, 65535, 41131, 30794, 40858, 32318, 32365, 65535, 65535, 33248, 33759, 35120, 40180, 
+      65535, 65535, 65535, 65535, 65535, 36755, 65535, 65535, 41093, 65535, 39764, 65535, 65535, 39396, 65535, 41087, 
+      65535, 38430, 65535, 65535, 39047, 41347, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41490, 65535, 38141, 38790, 65535, 65535, 40376, 65535, 65535, 65535 },
+    { 30141, 23967, 33804, 65535, 65535, 26834, 22169, 65535, 20919, 65535, 22909, 19122, 65535, 17765, 22593, 65535, 
+      16823, 20634, 17491, 24096, 65535, 23202, 11859, 11615, 11095, 9866, 8106, 65535, 11881, 8615, 6532, 28493, 
+      65535, 65535, 12795, 17237, 4144, 1360, 31803, 65535, 23161, 28730, 24735, 2554, 21911, 17566, 6628, 31099, 
+      20967, 29684, 15966, 23804, 21485, 10572, 37847, 21937, 25891, 38838, 17757, 5176, 5523, 11799, 36655, 30885, 
+      12330, 65535, 15831, 65535, 12909, 31145, 17799, 65535, 65535, 37421, 35227, 36643, 41917, 38689, 22649, 65535, 
+      15453, 24782, 17435, 38050, 65535, 38905, 65535, 65535, 18112, 65535, 29946, 30878, 20474, 65535, 65535, 65535, 
+      24808, 65535, 38886, 65535, 22690, 29902, 65535, 35629, 65535, 65535, 34253, 28499, 65535, 65535, 65535, 65535, 
+      28062, 27100, 31480, 39004, 40659, 65535, 65535, 31951, 65535, 65535, 65535, 32209, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 34576, 65535, 41053, 65535, 65535, 65535, 36403, 65535, 65535, 65535, 
+      39728, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31184, 65535, 
+      65535, 65535, 65535, 65535, 65535, 32697, 65535, 65535, 38805, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 38445, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36525, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 34266, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40532, 65535, 65535, 32329, 
+      29403, 65535, 65535, 65535, 65535, 65535, 65535, 31148, 65535, 65535, 37310, 65535, 65535, 36201, 40184, 24088 },
+    { 39695, 65535, 37840, 40407, 36064, 36666, 40916, 32844, 40817, 33167, 34482, 39142, 33135, 38820, 26997, 33219, 
+      31566, 26246, 28982, 65535, 22837, 16336, 32019, 26143, 26784, 29671, 28036, 35083, 17574, 20462, 23943, 9579, 
+      29115, 25211, 11497, 6429, 19169, 24464, 8647, 23161, 65535, 5594, 1765, 25562, 2471, 6111, 16993, 8218, 
+      3850, 7057, 8243, 3457, 4037, 13614, 14956, 4396, 5451, 16124, 8594, 25678, 21997, 16047, 15130, 11181, 
+      16576, 25059, 15454, 21487, 19092, 13260, 15075, 29915, 25146, 17730, 16729, 17900, 21772, 20136, 18609, 24651, 
+      25425, 19597, 25175, 21727, 26333, 23608, 28693, 32892, 38296, 32933, 27916, 28928, 36615, 32513, 37798, 35889, 
+      35692, 35460, 32249, 36386, 39840, 36766, 38491, 38303, 40313, 39734, 40274, 65535, 40640, 41363, 41356, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 40166, 35113, 32857, 40389, 65535, 32008, 65535, 29496, 38696, 65535, 28605, 65535, 30561, 28381, 
+      36455, 30135, 33585, 65535, 18907, 19073, 37471, 31317, 32029, 35139, 33543, 29622, 22693, 25833, 29436, 9146, 
+      23699, 19779, 16982, 11931, 24759, 30041, 3206, 28730, 5594, 65535, 4007, 31105, 7049, 11378, 22465, 2912, 
+      8294, 2501, 13355, 5839, 8031, 18918, 9425, 7911, 5353, 10660, 12911, 31032, 27272, 20788, 10367, 8379, 
+      21171, 19541, 19366, 16235, 23453, 11052, 18493, 24369, 19767, 13719, 13454, 14337, 17232, 16401, 20633, 19812, 
+      29433, 21034, 28796, 18740, 21960, 20788, 23883, 27614, 65535, 27899, 28763, 29652, 40798, 28198, 32334, 30740, 
+      38822, 30506, 31204, 31355, 65535, 38839, 33175, 39136, 34877, 34572, 41780, 65535, 35470, 36097, 36777, 40064, 
+      65535, 65535, 65535, 65535, 65535, 39075, 65535, 65535, 65535, 65535, 41986, 65535, 65535, 41796, 65535, 65535, 
+      65535, 41038, 65535, 65535, 41637, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41258, 41632, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 41208, 65535, 39096, 39061, 35625, 38233, 65535, 33189, 65535, 32544, 36136, 40905, 32163, 40567, 28510, 32109, 
+      33312, 27825, 30691, 65535, 22074, 17597, 33767, 27907, 28549, 31415, 29771, 33620, 19333, 22224, 25683, 9755, 
+      27685, 23767, 13247, 8183, 20789, 26051, 7168, 24735, 1765, 4007, 65535, 27101, 3155, 7395, 18459, 6493, 
+      4511, 5295, 9423, 2834, 4419, 14944, 13255, 4521, 4167, 14398, 9303, 27053, 23315, 17039, 13371, 9615, 
+      17494, 23342, 16036, 19726, 19904, 11837, 15436, 28210, 23395, 16044, 15146, 16279, 20037, 18499, 18463, 22895, 
+      26100, 19257, 25685, 20226, 24623, 22149, 26941, 31130, 39419, 31170, 27445, 28424, 37396, 30818, 36058, 34124, 
+      36045, 33701, 31251, 34624, 40643, 36741, 36730, 37877, 38567, 37969, 40072, 65535, 38875, 39599, 39635, 40892, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 30477, 22850, 34691, 65535, 65535, 27297, 21258, 65535, 19777, 65535, 23330, 18020, 65535, 16410, 24025, 65535, 
+      17119, 22059, 18332, 21725, 65535, 25533, 11175, 12552, 11842, 9548, 8028, 65535, 14152, 10630, 7777, 31047, 
+      65535, 65535, 15345, 19733, 6688, 1697, 34209, 2554, 25562, 31105, 27101, 65535, 24213, 19846, 8747, 33405, 
+      23210, 31962, 18140, 26038, 23699, 12611, 40120, 24118, 28052, 41066, 19737, 3789, 5945, 13147, 38709, 32839, 
+      13531, 65535, 17039, 65535, 13602, 32913, 19014, 65535, 65535, 39226, 36942, 38350, 65535, 40324, 23472, 65535, 
+      14989, 25562, 17119, 39429, 65535, 40132, 65535, 65535, 15729, 65535, 29985, 30853, 18573, 65535, 65535, 65535, 
+      23444, 65535, 39044, 65535, 20581, 28814, 65535, 34795, 65535, 65535, 33079, 26605, 65535, 65535, 65535, 65535, 
+      25698, 24645, 29356, 37479, 39274, 65535, 65535, 29557, 65535, 65535, 65535, 29745, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 32081, 65535, 38731, 65535, 65535, 65535, 33886, 65535, 65535, 65535, 
+      37215, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28674, 65535, 
+      65535, 65535, 65535, 65535, 65535, 30197, 65535, 65535, 36272, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 35981, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34138, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 40828, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 41067, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 32128, 65535, 65535, 41589, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39093, 65535, 65535, 30628, 
+      27508, 65535, 65535, 65535, 65535, 65535, 65535, 29746, 65535, 65535, 37044, 65535, 65535, 36148, 40577, 22083 },
+    { 40805, 65535, 39446, 65535, 38498, 37652, 40845, 35230, 40544, 35539, 35194, 38816, 35302, 38288, 28171, 35264, 
+      31782, 27251, 29471, 65535, 25137, 18057, 31513, 26111, 26652, 29146, 27433, 36644, 17733, 20214, 23408, 12041, 
+      30741, 26819, 11194, 6370, 18075, 23248, 10250, 21911, 2471, 7049, 3155, 24213, 65535, 4374, 15504, 9193, 
+      1409, 7779, 6307, 2225, 1583, 11880, 15937, 2046, 4646, 16966, 6220, 23992, 20223, 13888, 15334, 10558, 
+      14354, 25896, 13042, 21969, 16798, 12229, 12611, 30792, 25742, 17376, 16023, 17300, 21650, 19564, 16198, 24703, 
+      23061, 17262, 22749, 20744, 26021, 22510, 28668, 33287, 36264, 33063, 25627, 26656, 34311, 32084, 38441, 36112, 
+      33235, 35492, 30379, 36483, 37551, 34309, 38894, 35972, 40891, 39943, 37854, 40027, 40851, 41683, 41028, 40483, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 38742, 39457, 38386, 65535, 41572, 35422, 37190, 36775, 36703, 38938, 32568, 34941, 39200, 34255, 26448, 39328, 
+      28531, 25244, 26611, 41558, 28794, 17815, 27534, 22643, 23066, 25169, 23407, 40997, 14697, 16605, 19470, 14679, 
+      35075, 31156, 7877, 4393, 13801, 18908, 14561, 17566, 6111, 11378, 7395, 19846, 4374, 65535, 11130, 13560, 
+      3433, 12122, 2178, 6263, 4021, 7550, 20285, 4582, 8491, 21277, 3765, 19659, 15927, 10061, 19372, 14076, 
+      10673, 30177, 10203, 26105, 13304, 15193, 10400, 35076, 29918, 20939, 19244, 20607, 25357, 22851, 15156, 28523, 
+      19770, 16693, 19814, 23473, 29488, 25023, 32386, 37307, 32190, 36881, 25039, 26121, 30745, 35350, 65535, 39987, 
+      30491, 39208, 31130, 40249, 33935, 32381, 65535, 34985, 65535, 65535, 36278, 37028, 65535, 65535, 65535, 41657, 
+      40747, 40939, 41400, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41518 },
+    { 34052, 30172, 36339, 65535, 65535, 30601, 28197, 41310, 27180, 65535, 26917, 25373, 65535, 24212, 24160, 65535, 
+      21372, 22356, 20936, 30430, 38501, 21025, 17919, 15425, 15338, 15691, 13843, 65535, 11272, 10066, 10719, 23607, 
+      65535, 65535, 8378, 11648, 3880, 7987, 25613, 6628, 16993, 22465, 18459, 8747, 15504, 11130, 65535, 24685, 
+      14470, 23228, 9394, 17294, 14952, 3948, 31381, 15373, 19313, 32319, 11134, 8810, 5546, 6266, 30035, 24259, 
+      7072, 41137, 10238, 36828, 8819, 24584, 12088, 65535, 40678, 30832, 28689, 30106, 35332, 32193, 17470, 38623, 
+      13901, 19610, 15248, 31783, 38867, 32803, 65535, 65535, 22140, 65535, 26101, 27138, 22488, 65535, 65535, 65535, 
+      24845, 65535, 34523, 65535, 25320, 28863, 65535, 33657, 65535, 65535, 33268, 30053, 65535, 65535, 65535, 65535, 
+      31612, 31222, 33803, 38893, 40052, 65535, 65535, 35561, 65535, 65535, 65535, 36269, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 38845, 65535, 65535, 65535, 65535, 65535, 40856, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37047, 65535, 
+      65535, 65535, 65535, 65535, 65535, 38607, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 40848, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38902, 
+      36029, 65535, 65535, 65535, 65535, 65535, 65535, 37542, 65535, 65535, 65535, 65535, 65535, 40704, 65535, 30709 },
+    { 65535, 65535, 65535, 33310, 32840, 65535, 65535, 33318, 65535, 29217, 41575, 65535, 27661, 65535, 33360, 27151, 
+      39362, 32987, 36496, 65535, 18670, 21784, 40230, 34183, 34878, 37885, 36254, 27596, 25563, 28632, 32160, 11355, 
+      21797, 17888, 19709, 14641, 27219, 32432, 2768, 31099, 8218, 2912, 6493, 33405, 9193, 13560, 24685, 65535, 
+      10240, 1561, 15370, 7476, 9827, 20982, 6776, 9531, 6022, 7906, 14466, 33047, 29222, 22368, 7486, 6571, 
+      22642, 16849, 20440, 13362, 24718, 9319, 19307, 21719, 16951, 11018, 11056, 11793, 14359, 13755, 20599, 16902, 
+      30360, 20673, 29482, 16336, 19103, 18417, 20973, 24759, 65535, 24995, 27896, 28706, 41701, 25336, 29581, 27854, 
+      39045, 27597, 29405, 28452, 65535, 38444, 30338, 38090, 32104, 31691, 41038, 65535, 32591, 33243, 33874, 37777, 
+      65535, 65535, 65535, 65535, 65535, 36214, 65535, 65535, 40069, 65535, 39102, 65535, 65535, 38953, 65535, 40397, 
+      65535, 38277, 65535, 65535, 38867, 40814, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40142, 41194, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 41104, 65535, 40068, 65535, 39902, 37884, 40454, 36455, 40044, 36948, 35270, 38293, 36674, 37658, 28554, 36600, 
+      31585, 27534, 29440, 65535, 26539, 18829, 30918, 25800, 26282, 28551, 26803, 37798, 17589, 19819, 22833, 13378, 
+      31931, 28008, 10883, 6390, 17233, 22315, 11499, 20967, 3850, 8294, 4511, 23210, 1409, 3433, 14470, 10240, 
+      65535, 8762, 5131, 2838, 693, 10743, 16911, 1368, 5078, 17872, 4815, 22828, 19028, 12541, 15953, 10805, 
+      12984, 26755, 11633, 22675, 15404, 12187, 11227, 31653, 26485, 17675, 16130, 17457, 22043, 19717, 14973, 25172, 
+      21653, 16130, 21343, 20638, 26283, 22319, 29077, 33901, 34943, 33537, 24526, 25569, 32912, 32252, 39166, 36626, 
+      31843, 35906, 29618, 36928, 36154, 32999, 39495, 34817, 41576, 40436, 36600, 38624, 41343, 65535, 41221, 39872, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 34860, 34172, 65535, 65535, 34141, 65535, 30612, 40988, 65535, 29179, 65535, 32968, 28699, 
+      38493, 32485, 35744, 65535, 20036, 21540, 39049, 33176, 33833, 36694, 35033, 29124, 24580, 27518, 30957, 11591, 
+      23344, 19439, 18536, 13475, 25849, 31024, 3926, 29684, 7057, 2501, 5295, 31962, 7779, 12122, 23228, 1561, 
+      8762, 65535, 13881, 5965, 8321, 19492, 8163, 8001, 4465, 9198, 12915, 31533, 27701, 20812, 8174, 5943, 
+      21082, 18143, 18888, 14431, 23159, 8659, 17777, 23033, 18113, 11293, 10954, 11853, 14973, 13942, 19234, 17700, 
+      28827, 19406, 27979, 16239, 19659, 18288, 21764, 25835, 65535, 25919, 26833, 27678, 40177, 25894, 30794, 28846, 
+      37642, 28477, 28834, 29376, 65535, 37217, 31435, 37119, 33289, 32691, 39941, 65535, 33596, 34307, 34578, 37575, 
+      65535, 65535, 65535, 65535, 65535, 37257, 65535, 65535, 40872, 65535, 40084, 65535, 65535, 40030, 65535, 41362, 
+      65535, 39468, 65535, 65535, 40047, 41848, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41685, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 38988, 38562, 39159, 65535, 65535, 35601, 36369, 38575, 35718, 41109, 32531, 33932, 41363, 33084, 27001, 41458, 
+      28098, 25656, 26479, 39777, 30971, 19174, 26460, 22099, 22416, 24113, 22308, 65535, 14643, 16025, 18511, 16808, 
+      37040, 33118, 7915, 5794, 12417, 17323, 16557, 15966, 8243, 13355, 9423, 18140, 6307, 2178, 9394, 15370, 
+      5131, 13881, 65535, 7922, 5570, 5612, 22011, 5979, 9927, 22928, 2779, 17703, 13918, 7884, 20724, 15130, 
+      8505, 31748, 8268, 27508, 11154, 15889, 8720, 36639, 31349, 21906, 20008, 21405, 26384, 23606, 13845, 29618, 
+      17636, 15557, 17755, 23873, 30303, 25275, 33372, 38538, 30056, 37926, 23758, 24851, 28571, 35979, 65535, 41068, 
+      28443, 40152, 30381, 41232, 31758, 30550, 65535, 33463, 65535, 65535, 34541, 34917, 65535, 65535, 65535, 41019, 
+      38569, 38773, 39265, 40831, 41197, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40037 },
+    { 65535, 65535, 41246, 40741, 38317, 39752, 65535, 36000, 65535, 35131, 37364, 40995, 34439, 40422, 30195, 34211, 
+      34006, 29336, 31674, 65535, 24591, 19760, 33661, 28332, 28865, 31293, 29564, 35070, 19956, 22421, 25562, 12576, 
+      29247, 25330, 13409, 8589, 20063, 25152, 8991, 23804, 3457, 5839, 2834, 26038, 2225, 6263, 17294, 7476, 
+      2838, 5965, 7922, 65535, 2356, 13529, 14091, 2092, 2421, 15036, 7099, 25572, 21747, 15005, 13181, 8340, 
+      15355, 23917, 13555, 19869, 17613, 10097, 12794, 28816, 23668, 15151, 13824, 15088, 19433, 17351, 15631, 22501, 
+      23635, 16432, 23091, 18616, 23796, 20423, 26455, 31140, 37410, 30865, 24654, 25644, 34987, 29865, 36359, 33927, 
+      33336, 33281, 28793, 34279, 38247, 33916, 36743, 35078, 38784, 37752, 37239, 40240, 38660, 39511, 38805, 38693, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 41783, 65535, 40695, 65535, 39979, 38569, 41117, 36810, 40688, 36953, 35962, 38933, 36534, 38273, 29222, 36398, 
+      32270, 28214, 30132, 65535, 26494, 19410, 31544, 26476, 26951, 29178, 27423, 37417, 18280, 20486, 23468, 13616, 
+      31579, 27659, 11565, 7080, 17795, 22836, 11225, 21485, 4037, 8031, 4419, 23699, 1583, 4021, 14952, 9827, 
+      693, 8321, 5570, 2356, 65535, 11174, 16441, 678, 4470, 17368, 4911, 23220, 19399, 12756, 15352, 10136, 
+      13155, 26223, 11620, 22093, 15509, 11494, 11094, 31120, 25912, 17008, 15444, 16774, 21389, 19033, 14616, 24529, 
+      21680, 15702, 21291, 19945, 25608, 21629, 28422, 33287, 35173, 32893, 24080, 25114, 32982, 31567, 38582, 35988, 
+      31725, 35250, 29024, 36277, 36232, 32731, 38876, 34407, 40979, 39794, 36271, 38547, 40700, 41600, 40537, 39241, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 36740, 33981, 38243, 65535, 65535, 33276, 31942, 40966, 31019, 65535, 29782, 29213, 65535, 28120, 25886, 65535, 
+      24592, 24234, 23695, 34176, 35886, 20690, 21732, 18542, 18614, 19457, 17611, 65535, 12776, 12718, 14202, 21206, 
+      65535, 38696, 7657, 9147, 7513, 11930, 22108, 10572, 13614, 18918, 14944, 12611, 11880, 7550, 3948, 20982, 
+      10743, 19492, 5612, 13529, 11174, 65535, 27609, 11549, 15456, 28500, 7187, 12114, 8384, 4373, 26112, 20313, 
+      5301, 37262, 7490, 32904, 7870, 20658, 9066, 65535, 36755, 26892, 24771, 26188, 31392, 28295, 14679, 34680, 
+      14084, 16752, 14869, 28013, 34984, 29128, 38262, 65535, 24828, 65535, 24002, 25082, 24129, 40295, 65535, 65535, 
+      25262, 65535, 31906, 65535, 27186, 28473, 65535, 32543, 65535, 65535, 32768, 31163, 65535, 65535, 65535, 65535, 
+      33811, 33746, 35250, 38763, 39593, 65535, 65535, 37711, 65535, 65535, 65535, 38665, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41321, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40485, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      39975, 65535, 65535, 65535, 65535, 65535, 65535, 41414, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34640 },
+    { 65535, 65535, 65535, 27173, 29971, 65535, 65535, 33524, 65535, 25951, 65535, 65535, 23107, 65535, 38319, 22070, 
+      65535, 38265, 65535, 65535, 16226, 26601, 65535, 40608, 41364, 65535, 65535, 21234, 31996, 35239, 38861, 15432, 
+      15704, 11938, 26406, 21348, 33991, 39185, 6951, 37847, 14956, 9425, 13255, 40120, 15937, 20285, 31381, 6776, 
+      16911, 8163, 22011, 14091, 16441, 27609, 65535, 16066, 12238, 1436, 20822, 39575, 35720, 28599, 4748, 9384, 
+      28759, 10116, 26167, 7262, 30570, 11371, 24749, 14959, 10459, 8777, 10428, 10297, 9997, 11329, 24716, 11577, 
+      35647, 24200, 34428, 14770, 14561, 16760, 15481, 18371, 65535, 18994, 29966, 30554, 65535, 20497, 22916, 21632, 
+      65535, 21672, 28980, 22398, 65535, 41114, 23862, 39288, 25470, 25414, 65535, 65535, 26296, 26819, 28360, 35411, 
+      65535, 65535, 65535, 65535, 65535, 29814, 65535, 65535, 34198, 41724, 32813, 65535, 65535, 32475, 65535, 34135, 
+      65535, 31620, 36943, 65535, 32224, 34409, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39138, 
+      65535, 65535, 65535, 37877, 65535, 65535, 65535, 65535, 65535, 39119, 39121, 65535, 37559, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 36996, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40151, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38234, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41318, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 39526, 65535, 34940, 37178, 65535, 65535, 40811, 65535, 65535, 65535 },
+    { 65535, 65535, 41342, 65535, 40145, 39247, 41734, 37233, 41280, 37051, 36637, 39520, 36491, 38830, 29894, 36292, 
+      32922, 28890, 30802, 65535, 26550, 20025, 32116, 27113, 27577, 29751, 27987, 37124, 18942, 21112, 24051, 13954, 
+      31321, 27406, 12213, 7757, 18298, 23292, 11077, 21937, 4396, 7911, 4521, 24118, 2046, 4582, 15373, 9531, 
+      1368, 8001, 5979, 2092, 678, 11549, 16066, 65535, 3960, 16955, 5008, 23538, 19701, 12913, 14823, 9517, 
+      13267, 25771, 11556, 21583, 15550, 10828, 10915, 30664, 25412, 16388, 14792, 16128, 20785, 18386, 14213, 23942, 
+      21635, 15231, 21170, 19271, 24975, 20951, 27817, 32735, 35319, 32302, 23586, 24612, 32968, 30917, 38064, 35406, 
+      31532, 34643, 28404, 35677, 36225, 32395, 38317, 33941, 40445, 39204, 35878, 38389, 40109, 41024, 39888, 38592, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 39242, 38203, 65535, 65535, 36929, 65535, 34793, 39736, 65535, 33601, 65535, 32430, 33160, 
+      36427, 31631, 34078, 65535, 24196, 21726, 35995, 30747, 31272, 33628, 31882, 33422, 22377, 24821, 27907, 13565, 
+      27720, 23833, 15820, 11008, 22254, 27247, 8125, 25891, 5451, 5353, 4167, 28052, 4646, 8491, 19313, 6022, 
+      5078, 4465, 9927, 2421, 4470, 15456, 12238, 3960, 65535, 13055, 8588, 27341, 23483, 16428, 10881, 5926, 
+      16660, 21823, 14425, 17627, 18698, 7818, 13353, 26712, 21453, 12730, 11434, 12682, 17025, 14943, 15287, 20116, 
+      24390, 15764, 23607, 16313, 21375, 18168, 24052, 28823, 38662, 28483, 23700, 24638, 35751, 27448, 34114, 31559, 
+      33492, 30881, 27104, 31887, 39010, 33528, 34416, 34131, 36508, 35377, 36584, 40467, 36284, 37158, 36385, 36738, 
+      65535, 65535, 65535, 65535, 65535, 40018, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 26668, 30476, 65535, 65535, 34568, 65535, 26399, 65535, 65535, 23235, 65535, 39755, 22037, 
+      65535, 39697, 65535, 65535, 16984, 28036, 65535, 41925, 65535, 65535, 65535, 20636, 33305, 36492, 40063, 16868, 
+      15310, 11684, 27608, 22542, 35041, 40184, 8328, 38838, 16124, 10660, 14398, 41066, 16966, 21277, 32319, 7906, 
+      17872, 9198, 22928, 15036, 17368, 28500, 1436, 16955, 13055, 65535, 21594, 40370, 36505, 29275, 4196, 9575, 
+      29387, 8950, 26665, 5836, 31087, 11273, 25166, 13835, 9128, 7896, 9806, 9497, 8674, 10304, 24769, 10148, 
+      35944, 24116, 34627, 13815, 13177, 15754, 14045, 17023, 65535, 17583, 29498, 30035, 65535, 19075, 21684, 20253, 
+      65535, 20257, 28052, 20996, 65535, 40691, 22544, 38577, 24219, 24048, 65535, 65535, 24935, 25488, 26927, 34171, 
+      65535, 65535, 65535, 65535, 65535, 28479, 65535, 65535, 32787, 40331, 31456, 65535, 65535, 31164, 65535, 32773, 
+      65535, 30386, 35538, 65535, 30981, 33079, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37801, 
+      65535, 65535, 40836, 36620, 65535, 65535, 65535, 65535, 65535, 37909, 37912, 65535, 36390, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 35907, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39079, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37285, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40939, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 39604, 65535, 34771, 37350, 65535, 65535, 41372, 65535, 65535, 65535 },
+    { 41767, 40926, 41868, 65535, 65535, 38377, 38792, 40456, 38024, 41751, 35283, 36224, 41445, 35239, 29754, 41292, 
+      30746, 28427, 29219, 41064, 31354, 21558, 28733, 24717, 24983, 26412, 24583, 65535, 17410, 18653, 20918, 17909, 
+      36259, 32354, 10695, 8105, 14535, 19115, 16085, 17757, 8594, 12911, 9303, 19737, 6220, 3765, 11134, 14466, 
+      4815, 12915, 2779, 7099, 4911, 7187, 20822, 5008, 8588, 21594, 65535, 18776, 14912, 7914, 18977, 13129, 
+      8260, 30208, 6872, 25760, 10603, 13551, 6747, 35054, 29611, 19730, 17680, 19092, 24230, 21245, 11397, 27509, 
+      16843, 12982, 16600, 21291, 27952, 22622, 31144, 36523, 30311, 35730, 21293, 22378, 28098, 33482, 65535, 38892, 
+      27185, 37864, 27654, 38971, 31343, 28750, 41995, 31222, 65535, 65535, 32577, 33891, 65535, 65535, 65535, 38272, 
+      38235, 38703, 38355, 38918, 39111, 65535, 65535, 41919, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41806 },
+    { 34223, 25777, 38473, 65535, 65535, 31069, 24397, 65535, 22720, 65535, 27101, 21031, 65535, 19186, 27644, 65535, 
+      20880, 25679, 22110, 22301, 65535, 28127, 14634, 16306, 15620, 13205, 11771, 65535, 16937, 13789, 11414, 32308, 
+      65535, 65535, 16709, 20447, 8430, 5166, 34220, 5176, 25678, 31032, 27053, 3789, 23992, 19659, 8810, 33047, 
+      22828, 31533, 17703, 25572, 23220, 12114, 39575, 23538, 27341, 40370, 18776, 65535, 3867, 11330, 37580, 31562, 
+      11470, 65535, 14828, 65535, 10876, 31264, 16751, 65535, 65535, 37568, 35145, 36525, 41948, 38355, 20633, 65535, 
+      11303, 22649, 13480, 37081, 65535, 37577, 65535, 65535, 13554, 65535, 26451, 27280, 15319, 65535, 65535, 65535, 
+      19757, 65535, 35539, 65535, 17642, 25047, 65535, 31006, 65535, 65535, 29334, 23333, 65535, 65535, 65535, 65535, 
+      23347, 22663, 26417, 33889, 35611, 65535, 38968, 27284, 65535, 65535, 65535, 27764, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 30261, 65535, 36196, 65535, 65535, 65535, 32210, 65535, 65535, 65535, 
+      35481, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28373, 65535, 
+      65535, 65535, 65535, 65535, 65535, 29951, 65535, 65535, 35657, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 35902, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34451, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 41275, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 41781, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 33274, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41463, 65535, 65535, 32689, 
+      29264, 65535, 65535, 65535, 65535, 65535, 65535, 32262, 65535, 65535, 40537, 65535, 65535, 39753, 65535, 23706 },
+    { 35658, 28793, 39123, 65535, 65535, 32337, 27195, 65535, 25719, 65535, 28422, 23965, 65535, 22322, 27531, 65535, 
+      22347, 25606, 22910, 26168, 65535, 26166, 17030, 17042, 16583, 15220, 13532, 65535, 15550, 13139, 11927, 29116, 
+      65535, 65535, 13877, 17086, 6710, 6393, 30470, 5523, 21997, 27272, 23315, 5945, 20223, 15927, 5546, 29222, 
+      19028, 27701, 13918, 21747, 19399, 8384, 35720, 19701, 23483, 36505, 14912, 3867, 65535, 7532, 33724, 27717, 
+      7765, 65535, 11221, 40436, 7659, 27489, 13182, 65535, 65535, 33805, 31419, 32811, 38218, 34696, 17527, 41521, 
+      10094, 19621, 11978, 33606, 41140, 34238, 65535, 65535, 16642, 65535, 24430, 25356, 17101, 65535, 65535, 65535, 
+      20220, 65535, 33397, 65535, 19837, 24890, 65535, 30356, 65535, 65535, 29296, 24856, 65535, 65535, 65535, 65535, 
+      26067, 25698, 28420, 34465, 35903, 65535, 39582, 30017, 65535, 65535, 65535, 30732, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 33320, 65535, 38557, 65535, 65535, 65535, 35348, 65535, 65535, 65535, 
+      38550, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32132, 65535, 
+      65535, 65535, 65535, 65535, 65535, 33718, 65535, 65535, 39297, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 39688, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38299, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 37113, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36278, 
+      32961, 65535, 65535, 65535, 65535, 65535, 65535, 35606, 65535, 65535, 65535, 65535, 65535, 41702, 65535, 27429 },
+    { 40302, 35764, 65535, 65535, 65535, 36846, 33951, 65535, 32712, 65535, 33181, 30919, 65535, 29486, 29996, 65535, 
+      27606, 28275, 27184, 33540, 38846, 25026, 23626, 21687, 21573, 21526, 19701, 65535, 16892, 16255, 16902, 24600, 
+      65535, 40248, 12022, 12855, 10098, 13043, 23977, 11799, 16047, 20788, 17039, 13147, 13888, 10061, 6266, 22368, 
+      12541, 20812, 7884, 15005, 12756, 4373, 28599, 12913, 16428, 29275, 7914, 11330, 7532, 65535, 26293, 20254, 
+      933, 37614, 4069, 32957, 3571, 19957, 6014, 65535, 36765, 26273, 23897, 25293, 30692, 27211, 11219, 33997, 
+      10004, 13365, 10572, 26307, 33726, 27109, 37231, 65535, 22417, 41807, 19981, 21040, 20695, 38492, 65535, 65535, 
+      21111, 65535, 28269, 65535, 23875, 24115, 65535, 28204, 65535, 65535, 28399, 27277, 65535, 65535, 65535, 38772, 
+      30689, 30958, 31523, 34421, 35222, 65535, 39325, 34491, 65535, 65535, 65535, 35670, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 38372, 65535, 41903, 65535, 65535, 65535, 40520, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38949, 65535, 
+      65535, 65535, 65535, 65535, 65535, 40544, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      40483, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34959 },
+    { 65535, 65535, 65535, 30229, 34639, 65535, 65535, 38111, 65535, 30578, 65535, 65535, 27399, 65535, 40811, 26127, 
+      65535, 40471, 65535, 65535, 20974, 29172, 65535, 41266, 41880, 65535, 65535, 24094, 32704, 35493, 38739, 18363, 
+      19122, 15673, 26464, 21460, 33115, 38015, 9217, 36655, 15130, 10367, 13371, 38709, 15334, 19372, 30035, 7486, 
+      15953, 8174, 20724, 13181, 15352, 26112, 4748, 14823, 10881, 4196, 18977, 37580, 33724, 26293, 65535, 6060, 
+      26291, 11321, 23326, 6793, 27742, 7254, 21689, 16102, 10643, 4202, 5683, 5600, 6873, 6931, 20789, 9531, 
+      32205, 20023, 30767, 10188, 11623, 12235, 13592, 17959, 65535, 17809, 25316, 25869, 65535, 17852, 23244, 20805, 
+      38634, 20331, 24315, 21258, 65535, 36501, 23563, 34540, 25627, 24647, 38114, 65535, 25554, 26353, 26424, 31304, 
+      65535, 65535, 65535, 65535, 65535, 29258, 65535, 65535, 32698, 38405, 31999, 65535, 40187, 32075, 41905, 33260, 
+      40681, 31774, 35507, 65535, 32319, 33822, 65535, 65535, 65535, 65535, 65535, 41581, 65535, 65535, 65535, 38434, 
+      65535, 65535, 41233, 37799, 65535, 65535, 65535, 65535, 65535, 39332, 39334, 65535, 38025, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 37893, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41091, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39744, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38723, 41519, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 36169, 38690, 65535, 65535, 39887, 65535, 34843, 65535, 65535, 32433, 65535, 38124, 31454, 
+      65535, 37423, 40003, 65535, 24544, 27042, 41560, 36600, 37087, 39202, 37415, 30070, 28290, 30622, 33533, 17521, 
+      24882, 21239, 21672, 16927, 27533, 32243, 9320, 30885, 11181, 8379, 9615, 32839, 10558, 14076, 24259, 6571, 
+      10805, 5943, 15130, 8340, 10136, 20313, 9384, 9517, 5926, 9575, 13129, 31562, 27717, 20254, 6060, 65535, 
+      20235, 17370, 17277, 12720, 21698, 2750, 15676, 22107, 16554, 6872, 5548, 6759, 11286, 9018, 15346, 14491, 
+      26370, 14955, 25071, 10636, 15487, 12607, 18311, 23427, 41376, 22824, 21551, 22305, 37342, 21526, 28936, 25952, 
+      33681, 25131, 22903, 26176, 40503, 32390, 28952, 31602, 31209, 29725, 34696, 40601, 30627, 31585, 30472, 31728, 
+      65535, 65535, 65535, 40553, 39587, 34374, 65535, 65535, 36980, 40201, 36875, 65535, 41548, 37239, 65535, 38063, 
+      65535, 37267, 39778, 65535, 37772, 38827, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 41124, 36264, 65535, 65535, 65535, 37673, 34499, 65535, 33202, 65535, 33982, 31417, 65535, 29922, 30907, 65535, 
+      28351, 29178, 28007, 33548, 39407, 25933, 24184, 22466, 22323, 22125, 20312, 65535, 17809, 17104, 17628, 25287, 
+      65535, 40491, 12944, 13643, 10860, 13535, 24344, 12330, 16576, 21171, 17494, 13531, 14354, 10673, 7072, 22642, 
+      12984, 21082, 8505, 15355, 13155, 5301, 28759, 13267, 16660, 29387, 8260, 11470, 7765, 933, 26291, 20235, 
+      65535, 37605, 3516, 32899, 2732, 19801, 5493, 65535, 36685, 26099, 23679, 25064, 30482, 26933, 10489, 33779, 
+      9222, 12638, 9695, 25899, 33387, 26631, 36930, 65535, 22060, 41487, 19097, 20152, 20078, 38026, 65535, 65535, 
+      20278, 65535, 27452, 65535, 23281, 23202, 65535, 27271, 65535, 65535, 27477, 26518, 65535, 65535, 65535, 37921, 
+      30128, 30479, 30803, 33514, 34299, 65535, 38408, 33898, 65535, 65535, 65535, 35129, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 37838, 65535, 41173, 65535, 65535, 65535, 39995, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38740, 65535, 
+      65535, 65535, 65535, 65535, 65535, 40334, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      40711, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35165 },
+    { 65535, 65535, 65535, 19515, 28660, 65535, 65535, 36423, 65535, 24539, 65535, 65535, 19705, 65535, 65535, 17682, 
+      65535, 65535, 65535, 65535, 18304, 35413, 65535, 65535, 65535, 65535, 65535, 13365, 65535, 65535, 65535, 24365, 
+      9812, 8134, 36522, 31462, 65535, 65535, 16918, 65535, 25059, 19541, 23342, 65535, 25896, 30177, 41137, 16849, 
+      26755, 18143, 31748, 23917, 26223, 37262, 10116, 25771, 21823, 8950, 30208, 65535, 65535, 37614, 11321, 17370, 
+      37605, 65535, 34580, 4887, 38974, 18112, 32876, 4899, 2267, 12286, 14901, 13794, 9078, 12940, 31230, 7173, 
+      65535, 30042, 41327, 16078, 10595, 17244, 8836, 8847, 65535, 10353, 33207, 33413, 65535, 14242, 12825, 12304, 
+      65535, 12963, 28773, 13372, 65535, 65535, 14008, 40231, 15399, 15852, 65535, 65535, 16685, 17000, 19987, 31478, 
+      65535, 65535, 65535, 65535, 65535, 19992, 65535, 65535, 25036, 35072, 23102, 65535, 37457, 22537, 38906, 24442, 
+      36555, 21523, 27643, 65535, 22134, 24539, 65535, 65535, 65535, 65535, 39797, 34553, 65535, 65535, 65535, 29274, 
+      65535, 65535, 32440, 27800, 41463, 37460, 65535, 65535, 36574, 29004, 29007, 34664, 27449, 65535, 65535, 65535, 
+      37238, 37715, 65535, 65535, 26970, 65535, 39329, 37571, 65535, 65535, 39651, 65535, 30149, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28512, 65535, 65535, 65535, 34952, 65535, 65535, 
+      41413, 65535, 65535, 65535, 65535, 35550, 35132, 65535, 65535, 38419, 65535, 65535, 41890, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33881, 38017, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 39539, 65535, 34741, 65535, 28856, 33102, 65535, 65535, 39248, 65535, 65535, 65535 },
+    { 65535, 39778, 65535, 65535, 65535, 40668, 37998, 65535, 36718, 65535, 37078, 34930, 65535, 33437, 33346, 65535, 
+      31609, 31716, 31033, 36625, 38103, 27117, 27677, 25646, 25576, 25591, 23768, 65535, 20254, 20052, 20934, 24751, 
+      41868, 38055, 14586, 14002, 14107, 17048, 22433, 15831, 15454, 19366, 16036, 17039, 13042, 10203, 10238, 20440, 
+      11633, 18888, 8268, 13555, 11620, 7490, 26167, 11556, 14425, 26665, 6872, 14828, 11221, 4069, 23326, 17277, 
+      3516, 34580, 65535, 29798, 4426, 16582, 1977, 39184, 33534, 22826, 20352, 21719, 27149, 23527, 7267, 30430, 
+      10081, 9391, 9728, 22398, 29922, 23114, 33491, 39423, 24350, 38031, 16553, 17640, 21434, 34510, 65535, 41161, 
+      20338, 39721, 24462, 40903, 24695, 22295, 65535, 25560, 65535, 65535, 26346, 27019, 65535, 65535, 65535, 35067, 
+      31600, 32275, 31489, 32598, 33069, 65535, 37268, 35195, 65535, 65535, 65535, 36644, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 39356, 65535, 41699, 65535, 65535, 65535, 41535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41323, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38527 },
+    { 65535, 65535, 65535, 24383, 32148, 65535, 65535, 38381, 65535, 27975, 65535, 65535, 23671, 65535, 65535, 21887, 
+      65535, 65535, 65535, 65535, 20151, 33835, 65535, 65535, 65535, 65535, 65535, 18222, 38924, 41949, 65535, 22649, 
+      14170, 11591, 32961, 27906, 39881, 65535, 14135, 65535, 21487, 16235, 19726, 65535, 21969, 26105, 36828, 13362, 
+      22675, 14431, 27508, 19869, 22093, 32904, 7262, 21583, 17627, 5836, 25760, 65535, 40436, 32957, 6793, 12720, 
+      32899, 4887, 29798, 65535, 34171, 13265, 28059, 9405, 3851, 7414, 10025, 8960, 4837, 8352, 26349, 4682, 
+      38102, 25194, 36447, 11735, 8156, 13194, 8301, 11407, 65535, 11761, 28790, 29088, 65535, 13547, 16491, 14511, 
+      65535, 14427, 25298, 15191, 65535, 39848, 17004, 36550, 18922, 18338, 40525, 65535, 19235, 19887, 21106, 29698, 
+      65535, 65535, 65535, 65535, 65535, 22852, 65535, 65535, 26960, 34933, 25753, 65535, 37085, 25604, 38685, 27057, 
+      36820, 25094, 29720, 65535, 25658, 27452, 65535, 65535, 65535, 65535, 40698, 36254, 65535, 65535, 65535, 32146, 
+      65535, 65535, 35112, 31215, 65535, 39705, 65535, 65535, 39412, 32659, 32661, 37784, 31289, 65535, 65535, 65535, 
+      40356, 40802, 65535, 65535, 31104, 65535, 65535, 40982, 65535, 65535, 65535, 65535, 34302, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32985, 65535, 65535, 65535, 39313, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 40043, 39632, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38764, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 39284, 65535, 33589, 37470, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 36438, 65535, 65535, 65535, 39166, 34853, 65535, 33364, 65535, 35365, 31617, 65535, 29929, 32965, 65535, 
+      29508, 31173, 29529, 32268, 41923, 28559, 24657, 23814, 23546, 22763, 21016, 65535, 19967, 18835, 18803, 27960, 
+      65535, 65535, 15522, 16374, 12305, 13956, 26584, 12909, 19092, 23453, 19904, 13602, 16798, 13304, 8819, 24718, 
+      15404, 23159, 11154, 17613, 15509, 7870, 30570, 15550, 18698, 31087, 10603, 10876, 7659, 3571, 27742, 21698, 
+      2732, 38974, 4426, 34171, 65535, 20923, 6120, 65535, 37879, 27109, 24591, 25931, 31359, 27641, 9871, 34611, 
+      6503, 11963, 7009, 26215, 33863, 26708, 37496, 65535, 19983, 41974, 17409, 18419, 17523, 38063, 65535, 65535, 
+      17549, 65535, 26117, 65535, 20756, 20613, 65535, 24951, 65535, 65535, 24932, 23804, 65535, 65535, 65535, 36348, 
+      27638, 28126, 28115, 30893, 31760, 65535, 35831, 31355, 65535, 65535, 65535, 32664, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 35378, 65535, 38474, 65535, 65535, 65535, 37547, 65535, 65535, 65535, 
+      40387, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36909, 65535, 
+      65535, 65535, 65535, 65535, 65535, 38495, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      39998, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34422 },
+    { 65535, 65535, 65535, 37390, 41112, 65535, 65535, 65535, 65535, 37190, 65535, 65535, 34461, 65535, 40247, 33309, 
+      65535, 39429, 41625, 65535, 27035, 29415, 65535, 37833, 38230, 39952, 38128, 31229, 29769, 31781, 34396, 20197, 
+      26374, 22907, 23011, 18530, 28084, 32488, 12063, 31145, 13260, 11052, 11837, 32913, 12229, 15193, 24584, 9319, 
+      12187, 8659, 15889, 10097, 11494, 20658, 11371, 10828, 7818, 11273, 13551, 31264, 27489, 19957, 7254, 2750, 
+      19801, 18112, 16582, 13265, 20923, 65535, 14805, 22616, 16957, 6322, 4130, 5541, 10787, 7718, 13537, 14095, 
+      25013, 12851, 23526, 8520, 14420, 10351, 17605, 23162, 40130, 22200, 18968, 19684, 35668, 20160, 28833, 25368, 
+      31565, 24313, 20175, 25420, 38757, 29936, 28529, 28913, 30952, 29033, 32086, 38408, 29918, 30992, 29128, 29184, 
+      65535, 65535, 65535, 37873, 36864, 33653, 40622, 65535, 35682, 37903, 35949, 65535, 39135, 36526, 40891, 37072, 
+      40528, 36853, 38443, 65535, 37314, 37973, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 41752, 65535, 65535, 65535, 65535, 39962, 65535, 38692, 65535, 38812, 36904, 65535, 35413, 34731, 65535, 
+      33440, 33162, 32741, 38388, 37372, 27865, 29638, 27445, 27412, 27538, 25710, 65535, 21711, 21753, 22804, 24568, 
+      40442, 36679, 15729, 14511, 15967, 19021, 21460, 17799, 15075, 18493, 15436, 19014, 12611, 10400, 12088, 19307, 
+      11227, 17777, 8720, 12794, 11094, 9066, 24749, 10915, 13353, 25166, 6747, 16751, 13182, 6014, 21689, 15676, 
+      5493, 32876, 1977, 28059, 6120, 14805, 65535, 37420, 31759, 20996, 18492, 19844, 25276, 21613, 5634, 28545, 
+      11054, 7687, 10306, 20428, 27970, 21138, 31553, 37511, 25758, 36083, 15303, 16399, 22401, 32533, 65535, 39206, 
+      20631, 37753, 22852, 38936, 25658, 22005, 65535, 24754, 65535, 65535, 25880, 27474, 65535, 65535, 40860, 33510, 
+      32542, 33385, 32006, 32204, 32490, 65535, 36712, 36020, 65535, 65535, 65535, 37578, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 40276, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40433 },
+    { 65535, 65535, 65535, 15865, 27946, 65535, 65535, 37361, 65535, 24060, 65535, 65535, 18594, 65535, 65535, 16222, 
+      65535, 65535, 65535, 65535, 20106, 39344, 65535, 65535, 65535, 65535, 65535, 10036, 65535, 65535, 65535, 28552, 
+      8833, 9291, 41348, 36300, 65535, 65535, 21646, 65535, 29915, 24369, 28210, 65535, 30792, 35076, 65535, 21719, 
+      31653, 23033, 36639, 28816, 31120, 65535, 14959, 30664, 26712, 13835, 35054, 65535, 65535, 65535, 16102, 22107, 
+      65535, 4899, 39184, 9405, 65535, 22616, 37420, 65535, 5665, 16507, 19096, 17855, 12625, 16584, 35320, 9799, 
+      65535, 33944, 65535, 19246, 12367, 19982, 9295, 5857, 65535, 8365, 36044, 36085, 65535, 13771, 8207, 9101, 
+      65535, 10457, 30334, 10445, 65535, 65535, 9881, 41770, 10809, 12072, 65535, 65535, 12803, 12826, 17212, 30998, 
+      65535, 65535, 65535, 65535, 65535, 15745, 65535, 65535, 21363, 32860, 18931, 65535, 35392, 18098, 36664, 20268, 
+      33944, 16814, 23789, 65535, 17443, 20165, 65535, 65535, 65535, 65535, 36588, 30840, 65535, 65535, 65535, 24863, 
+      65535, 65535, 28110, 23116, 37594, 33333, 65535, 65535, 32110, 24216, 24219, 30072, 22608, 65535, 65535, 65535, 
+      32630, 33119, 40998, 65535, 22074, 65535, 34644, 32838, 65535, 65535, 34904, 65535, 25251, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 23655, 40426, 38641, 65535, 30069, 65535, 65535, 
+      36526, 65535, 65535, 65535, 65535, 30705, 30290, 65535, 39766, 33575, 39905, 65535, 37045, 39078, 65535, 38599, 
+      40156, 65535, 65535, 65535, 40551, 65535, 65535, 41775, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 29906, 34294, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 36932, 65535, 31990, 65535, 25679, 30762, 65535, 65535, 37864, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 21175, 30922, 65535, 65535, 38588, 65535, 26805, 65535, 65535, 21931, 65535, 65535, 19866, 
+      65535, 65535, 65535, 65535, 20401, 36559, 65535, 65535, 65535, 65535, 65535, 15101, 65535, 65535, 65535, 25403, 
+      11989, 10393, 36641, 31575, 65535, 65535, 17406, 65535, 25146, 19767, 23395, 65535, 25742, 29918, 40678, 16951, 
+      26485, 18113, 31349, 23668, 25912, 36755, 10459, 25412, 21453, 9128, 29611, 65535, 65535, 36765, 10643, 16554, 
+      36685, 2267, 33534, 3851, 37879, 16957, 31759, 5665, 65535, 10852, 13451, 12239, 7182, 11129, 29727, 4952, 
+      41546, 28424, 39795, 14090, 8331, 15140, 6711, 7917, 65535, 8871, 31178, 31344, 65535, 12175, 12700, 11238, 
+      65535, 11555, 26529, 12129, 65535, 41950, 13417, 37998, 15176, 14976, 65535, 65535, 15851, 16363, 18515, 29302, 
+      65535, 65535, 65535, 65535, 65535, 19356, 65535, 65535, 23937, 33258, 22361, 65535, 35586, 22037, 37081, 23687, 
+      34867, 21356, 26628, 65535, 21934, 23954, 65535, 65535, 65535, 65535, 38336, 33393, 65535, 65535, 65535, 28680, 
+      65535, 65535, 31744, 27539, 40354, 36560, 65535, 65535, 35981, 28913, 28915, 34230, 27495, 65535, 65535, 65535, 
+      36809, 37269, 65535, 65535, 27262, 65535, 38998, 37327, 65535, 65535, 39422, 65535, 30459, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 29144, 65535, 65535, 65535, 35462, 65535, 65535, 
+      41882, 65535, 65535, 65535, 65535, 36203, 35793, 65535, 65535, 39068, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35423, 39694, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 41591, 65535, 36749, 65535, 30726, 35197, 65535, 65535, 41483, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 31795, 38204, 65535, 65535, 65535, 65535, 34076, 65535, 65535, 30406, 65535, 65535, 28862, 
+      65535, 65535, 65535, 65535, 24880, 32779, 65535, 65535, 65535, 65535, 65535, 25635, 35100, 37494, 40373, 22257, 
+      21369, 18354, 28532, 23728, 34247, 38770, 13134, 37421, 17730, 13719, 16044, 39226, 17376, 20939, 30832, 11018, 
+      17675, 11293, 21906, 15151, 17008, 26892, 8777, 16388, 12730, 7896, 19730, 37568, 33805, 26273, 4202, 6872, 
+      26099, 12286, 22826, 7414, 27109, 6322, 20996, 16507, 10852, 65535, 2616, 1682, 4501, 2785, 18945, 7794, 
+      30729, 17786, 29042, 6006, 8648, 8037, 11469, 16853, 65535, 16023, 21964, 22405, 40814, 14785, 22512, 19175, 
+      35870, 18275, 20203, 19335, 65535, 33164, 22270, 30708, 24650, 22909, 34424, 65535, 23807, 24813, 23674, 27155, 
+      65535, 65535, 65535, 39494, 37995, 27554, 41231, 65535, 30150, 34575, 30010, 65535, 36243, 30425, 37978, 31192, 
+      36956, 30601, 32955, 65535, 31080, 31975, 65535, 65535, 65535, 65535, 41569, 38574, 65535, 65535, 65535, 36393, 
+      65535, 65535, 38937, 36281, 65535, 65535, 65535, 65535, 65535, 38024, 38027, 65535, 36964, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 37214, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40375, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39577, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40934, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 34408, 40281, 65535, 65535, 65535, 65535, 36195, 65535, 65535, 32758, 65535, 65535, 31299, 
+      65535, 65535, 65535, 65535, 26653, 32431, 65535, 41883, 65535, 65535, 65535, 28246, 33709, 35848, 38519, 22405, 
+      23899, 20778, 27005, 22385, 32210, 36565, 13513, 35227, 16729, 13454, 15146, 36942, 16023, 19244, 28689, 11056, 
+      16130, 10954, 20008, 13824, 15444, 24771, 10428, 14792, 11434, 9806, 17680, 35145, 31419, 23897, 5683, 5548, 
+      23679, 14901, 20352, 10025, 24591, 4130, 18492, 19096, 13451, 2616, 65535, 1417, 6803, 3608, 16329, 10101, 
+      28115, 15189, 26426, 5293, 10295, 7364, 13493, 19154, 65535, 18092, 19722, 20234, 38229, 16125, 24868, 21262, 
+      33406, 20184, 18855, 21293, 41173, 30928, 24452, 28861, 26919, 24909, 32436, 39984, 25793, 26878, 25097, 26722, 
+      65535, 65535, 65535, 37752, 36407, 29525, 39841, 65535, 31641, 34800, 31825, 65535, 36265, 32398, 38018, 32956, 
+      37314, 32764, 34418, 65535, 33216, 33844, 65535, 65535, 65535, 65535, 65535, 39659, 65535, 65535, 65535, 38131, 
+      65535, 65535, 40513, 38272, 65535, 65535, 65535, 65535, 65535, 40093, 40095, 65535, 39132, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 39507, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41998, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 33307, 39869, 65535, 65535, 65535, 65535, 35746, 65535, 65535, 32086, 65535, 65535, 30530, 
+      65535, 65535, 65535, 65535, 26471, 33391, 65535, 65535, 65535, 65535, 65535, 27160, 35015, 37211, 39916, 23136, 
+      23005, 20027, 28339, 23669, 33624, 37980, 14106, 36643, 17900, 14337, 16279, 38350, 17300, 20607, 30106, 11793, 
+      17457, 11853, 21405, 15088, 16774, 26188, 10297, 16128, 12682, 9497, 19092, 36525, 32811, 25293, 5600, 6759, 
+      25064, 13794, 21719, 8960, 25931, 5541, 19844, 17855, 12239, 1682, 1417, 65535, 5432, 2264, 17490, 8716, 
+      29308, 16248, 27569, 4672, 8901, 6759, 12076, 17756, 65535, 16675, 20282, 20725, 39242, 14799, 23478, 19845, 
+      34215, 18773, 18715, 19879, 65535, 31482, 23038, 29081, 25513, 23494, 32770, 40683, 24379, 25461, 23765, 26075, 
+      65535, 65535, 65535, 37899, 36444, 28113, 39749, 65535, 30298, 33866, 30427, 65535, 35419, 30985, 37166, 31566, 
+      36330, 31349, 33083, 41686, 31800, 32441, 65535, 65535, 65535, 65535, 41060, 38425, 65535, 65535, 65535, 36747, 
+      65535, 65535, 39158, 36860, 65535, 65535, 65535, 65535, 65535, 38677, 38679, 65535, 37716, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 38101, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41233, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40622, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 28347, 36985, 65535, 65535, 65535, 65535, 32812, 65535, 65535, 28457, 65535, 65535, 26600, 
+      65535, 65535, 65535, 65535, 24732, 35992, 65535, 65535, 65535, 65535, 65535, 22283, 39298, 41845, 65535, 25041, 
+      18793, 16411, 32842, 27950, 38742, 65535, 15964, 41917, 21772, 17232, 20037, 65535, 21650, 25357, 35332, 14359, 
+      22043, 14973, 26384, 19433, 21389, 31392, 9997, 20785, 17025, 8674, 24230, 41948, 38218, 30692, 6873, 11286, 
+      30482, 9078, 27149, 4837, 31359, 10787, 25276, 12625, 7182, 4501, 6803, 5432, 65535, 3964, 22724, 3309, 
+      34553, 21320, 32730, 7015, 4763, 8365, 7033, 12377, 65535, 11544, 24146, 24386, 65535, 10980, 18071, 14685, 
+      38540, 13862, 20487, 14893, 65535, 35110, 17769, 31712, 20165, 18441, 35693, 65535, 19342, 20323, 19614, 25552, 
+      65535, 65535, 65535, 40090, 38282, 23090, 41044, 65535, 25981, 31813, 25614, 65535, 33743, 25957, 35424, 26822, 
+      33979, 26100, 28794, 41028, 26579, 27546, 65535, 65535, 65535, 65535, 38303, 34728, 65535, 65535, 65535, 32024, 
+      65535, 65535, 34665, 31803, 41585, 38648, 65535, 65535, 39039, 33529, 33531, 37801, 32464, 65535, 65535, 65535, 
+      40303, 40698, 65535, 65535, 32742, 65535, 65535, 41297, 65535, 65535, 65535, 65535, 35894, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35196, 65535, 65535, 65535, 41181, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41782, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37891, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 32303, 40151, 65535, 65535, 65535, 65535, 35989, 65535, 65535, 31961, 65535, 65535, 30232, 
+      65535, 65535, 65535, 65535, 27197, 35474, 65535, 65535, 65535, 65535, 65535, 26222, 37279, 39455, 65535, 25030, 
+      22515, 19852, 30598, 25933, 35761, 40016, 15916, 38689, 20136, 16401, 18499, 40324, 19564, 22851, 32193, 13755, 
+      19717, 13942, 23606, 17351, 19033, 28295, 11329, 18386, 14943, 10304, 21245, 38355, 34696, 27211, 6931, 9018, 
+      26933, 12940, 23527, 8352, 27641, 7718, 21613, 16584, 11129, 2785, 3608, 2264, 3964, 65535, 18800, 7018, 
+      30621, 17362, 28777, 3577, 6707, 5450, 10033, 15898, 65535, 14628, 20440, 20759, 40118, 12536, 21651, 17795, 
+      34712, 16631, 17774, 17756, 65535, 31536, 21044, 28601, 23585, 21382, 32449, 40945, 22258, 23380, 21504, 24382, 
+      65535, 65535, 65535, 37252, 35638, 25978, 38737, 65535, 28041, 31834, 28231, 65535, 33472, 28848, 35210, 29355, 
+      34248, 29318, 30823, 40023, 29750, 30261, 65535, 65535, 65535, 65535, 38919, 36174, 65535, 65535, 65535, 34526, 
+      65535, 65535, 36908, 34723, 65535, 40383, 65535, 65535, 41256, 36576, 36579, 40294, 35677, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 36161, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39265, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38823, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41793, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41488, 65535, 39778, 40342, 65535, 
+      38825, 38789, 38299, 40753, 39263, 32951, 34477, 32894, 32793, 32509, 30722, 65535, 27343, 27316, 28113, 28145, 
+      39900, 36436, 21261, 19494, 21317, 23763, 23152, 22649, 18609, 20633, 18463, 23472, 16198, 15156, 17470, 20599, 
+      14973, 19234, 13845, 15631, 14616, 14679, 24716, 14213, 15287, 24769, 11397, 20633, 17527, 11219, 20789, 15346, 
+      10489, 31230, 7267, 26349, 9871, 13537, 5634, 35320, 29727, 18945, 16329, 17490, 22724, 18800, 65535, 25797, 
+      11831, 2150, 10099, 16793, 24511, 17026, 28208, 34349, 26868, 32532, 9914, 11006, 22131, 28281, 40056, 35530, 
+      18473, 33851, 17227, 35046, 25228, 18298, 38911, 19907, 41642, 38540, 21665, 25456, 39295, 40663, 36118, 27877, 
+      31801, 33169, 30016, 28013, 27936, 65535, 32147, 34811, 65535, 37886, 65535, 36668, 37893, 65535, 39416, 65535, 
+      40687, 65535, 65535, 39483, 65535, 65535, 39253, 40858, 39392, 41177, 65535, 65535, 41381, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 25660, 35800, 65535, 65535, 65535, 65535, 31661, 65535, 65535, 26875, 65535, 65535, 24818, 
+      65535, 65535, 65535, 65535, 24584, 38123, 65535, 65535, 65535, 65535, 65535, 19732, 65535, 65535, 65535, 26992, 
+      16942, 15172, 35890, 30935, 65535, 65535, 18152, 65535, 24651, 19812, 22895, 65535, 24703, 28523, 38623, 16902, 
+      25172, 17700, 29618, 22501, 24529, 34680, 11577, 23942, 20116, 10148, 27509, 65535, 41521, 33997, 9531, 14491, 
+      33779, 7173, 30430, 4682, 34611, 14095, 28545, 9799, 4952, 7794, 10101, 8716, 3309, 7018, 25797, 65535, 
+      37600, 24291, 35712, 9447, 3605, 10282, 4072, 9068, 65535, 8367, 26367, 26485, 65535, 8942, 14766, 11466, 
+      40888, 10815, 21604, 11781, 65535, 37030, 14488, 33059, 16859, 15265, 37155, 65535, 16171, 17095, 16998, 25119, 
+      65535, 65535, 65535, 41019, 39019, 19911, 41393, 65535, 23180, 30294, 22534, 65535, 32417, 22767, 34029, 23774, 
+      32245, 22818, 25986, 40186, 23306, 24417, 65535, 65535, 65535, 65535, 36273, 32204, 65535, 40822, 65535, 28965, 
+      65535, 65535, 31712, 28587, 39142, 35930, 65535, 65535, 36077, 30275, 30278, 34724, 29176, 65535, 65535, 65535, 
+      37252, 37661, 65535, 65535, 29433, 65535, 39604, 38159, 65535, 65535, 40240, 65535, 32587, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31907, 65535, 65535, 65535, 37872, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 38871, 38482, 65535, 65535, 41680, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39631, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41571, 65535, 35409, 40102, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 36422, 65535, 65535, 65535, 65535, 35328, 65535, 33448, 65535, 38265, 31871, 65535, 29803, 37555, 65535, 
+      32083, 35649, 32943, 28966, 65535, 34639, 25903, 27066, 26534, 24502, 23016, 65535, 25090, 23131, 21965, 34444, 
+      65535, 65535, 21596, 22856, 16524, 16031, 32467, 15453, 25425, 29433, 26100, 14989, 23061, 19770, 13901, 30360, 
+      21653, 28827, 17636, 23635, 21680, 14084, 35647, 21635, 24390, 35944, 16843, 11303, 10094, 10004, 32205, 26370, 
+      9222, 65535, 10081, 38102, 6503, 25013, 11054, 65535, 41546, 30729, 28115, 29308, 34553, 30621, 11831, 37600, 
+      65535, 13342, 2253, 28428, 36102, 28371, 39807, 65535, 15123, 65535, 15268, 16041, 11370, 39147, 65535, 65535, 
+      11180, 65535, 24353, 65535, 14632, 15001, 65535, 20264, 65535, 65535, 19419, 17301, 65535, 65535, 65535, 33516, 
+      21533, 22334, 21631, 25003, 26167, 65535, 30063, 25115, 65535, 65535, 65535, 26577, 41737, 65535, 65535, 65535, 
+      65535, 65535, 65535, 39788, 65535, 65535, 29285, 39966, 31976, 38705, 65535, 65535, 31466, 65535, 65535, 65535, 
+      34163, 65535, 65535, 65535, 65535, 65535, 65535, 40335, 65535, 65535, 65535, 65535, 65535, 65535, 32183, 65535, 
+      65535, 65535, 65535, 65535, 65535, 33719, 65535, 65535, 37762, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 39479, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39213, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 40182, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41624, 
+      37766, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32318 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41822, 65535, 65535, 
+      40971, 40772, 40409, 65535, 39303, 34502, 36599, 35031, 34938, 34646, 32862, 65535, 29351, 29422, 30261, 29008, 
+      39013, 35690, 23147, 21076, 23462, 25886, 23327, 24782, 19597, 21034, 19257, 25562, 17262, 16693, 19610, 20673, 
+      16130, 19406, 15557, 16432, 15702, 16752, 24200, 15231, 15764, 24116, 12982, 22649, 19621, 13365, 20023, 14955, 
+      12638, 30042, 9391, 25194, 11963, 12851, 7687, 33944, 28424, 17786, 15189, 16248, 21320, 17362, 2150, 24291, 
+      13342, 65535, 11422, 15093, 22787, 15161, 26493, 32651, 28160, 30732, 8411, 9472, 23046, 26312, 38317, 33683, 
+      18740, 31951, 15177, 33145, 26035, 17823, 37063, 18711, 39814, 36601, 20845, 25646, 37339, 38725, 34027, 25853, 
+      32406, 33951, 30152, 27131, 26847, 40666, 31019, 35204, 40015, 35859, 41912, 37156, 35944, 65535, 37495, 65535, 
+      38667, 65535, 65535, 37896, 65535, 65535, 39672, 39412, 39139, 39960, 65535, 65535, 41757, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 38675, 65535, 65535, 65535, 65535, 37579, 65535, 35701, 65535, 40319, 34123, 65535, 32056, 39218, 65535, 
+      34165, 37341, 34887, 30914, 65535, 35558, 28104, 29017, 28530, 26656, 25135, 65535, 26517, 24818, 23903, 34452, 
+      65535, 65535, 22507, 23240, 18172, 18089, 31731, 17435, 25175, 28796, 25685, 17119, 22749, 19814, 15248, 29482, 
+      21343, 27979, 17755, 23091, 21291, 14869, 34428, 21170, 23607, 34627, 16600, 13480, 11978, 10572, 30767, 25071, 
+      9695, 41327, 9728, 36447, 7009, 23526, 10306, 65535, 39795, 29042, 26426, 27569, 32730, 28777, 10099, 35712, 
+      2253, 11422, 65535, 26447, 34081, 26302, 37780, 65535, 16780, 41859, 13027, 13817, 12303, 36968, 65535, 65535, 
+      10689, 65535, 22117, 65535, 15519, 13683, 65535, 18523, 65535, 65535, 18057, 17291, 65535, 65535, 65535, 31403, 
+      22338, 23394, 21772, 23910, 24872, 65535, 28887, 25732, 65535, 40742, 65535, 27351, 39849, 65535, 40974, 65535, 
+      65535, 65535, 65535, 38349, 65535, 65535, 30032, 38719, 31975, 37717, 65535, 65535, 32208, 65535, 65535, 65535, 
+      34734, 41724, 65535, 65535, 65535, 65535, 65535, 40659, 65535, 65535, 65535, 65535, 65535, 65535, 33703, 65535, 
+      65535, 65535, 65535, 65535, 65535, 35209, 65535, 65535, 38910, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 40853, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40782, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      39854, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34444 },
+    { 65535, 65535, 65535, 35104, 65535, 65535, 65535, 65535, 65535, 39539, 65535, 65535, 35405, 65535, 65535, 33599, 
+      65535, 65535, 65535, 65535, 30754, 37661, 65535, 65535, 65535, 65535, 65535, 29136, 38153, 39898, 65535, 27691, 
+      25807, 23311, 31347, 27013, 35523, 39329, 18736, 38050, 21727, 18740, 20226, 39429, 20744, 23473, 31783, 16336, 
+      20638, 16239, 23873, 18616, 19945, 28013, 14770, 19271, 16313, 13815, 21291, 37081, 33606, 26307, 10188, 10636, 
+      25899, 16078, 22398, 11735, 26215, 8520, 20428, 19246, 14090, 6006, 5293, 4672, 7015, 3577, 16793, 9447, 
+      28428, 15093, 26447, 65535, 7718, 2093, 11417, 17567, 65535, 15780, 17133, 17376, 37287, 12285, 23263, 18844, 
+      31563, 17326, 14236, 18511, 39923, 28118, 22210, 25031, 24902, 22107, 28900, 37612, 22928, 24199, 21082, 21452, 
+      65535, 65535, 41538, 33677, 32083, 26525, 35242, 65535, 27614, 29571, 28406, 65535, 30986, 29339, 32741, 29409, 
+      32130, 30236, 30307, 37036, 30594, 30511, 65535, 39660, 65535, 65535, 37000, 34996, 65535, 39966, 65535, 34451, 
+      65535, 65535, 36507, 35152, 41311, 39410, 65535, 65535, 40760, 37146, 37148, 40119, 36493, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 37290, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40276, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40294, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 28077, 39252, 65535, 65535, 65535, 65535, 35135, 65535, 65535, 30202, 65535, 65535, 28054, 
+      65535, 65535, 65535, 65535, 28184, 40753, 65535, 65535, 65535, 65535, 65535, 22399, 65535, 65535, 65535, 29774, 
+      20208, 18689, 37158, 32376, 65535, 65535, 20721, 65535, 26333, 21960, 24623, 65535, 26021, 29488, 38867, 19103, 
+      26283, 19659, 30303, 23796, 25608, 34984, 14561, 24975, 21375, 13177, 27952, 65535, 41140, 33726, 11623, 15487, 
+      33387, 10595, 29922, 8156, 33863, 14420, 27970, 12367, 8331, 8648, 10295, 8901, 4763, 6707, 24511, 3605, 
+      36102, 22787, 34081, 7718, 65535, 7860, 3706, 9866, 65535, 8116, 23739, 23737, 65535, 6238, 15545, 11241, 
+      38257, 9944, 18255, 11087, 65535, 34043, 14571, 29745, 17222, 14718, 33880, 65535, 15583, 16750, 15032, 21551, 
+      65535, 65535, 65535, 37522, 35479, 19288, 37795, 65535, 21503, 27163, 21530, 65535, 29176, 22154, 30828, 22665, 
+      29266, 22742, 24307, 36745, 23146, 23555, 65535, 39658, 65535, 65535, 33544, 30040, 65535, 37769, 65535, 27848, 
+      65535, 65535, 30311, 28028, 36860, 34055, 65535, 65535, 34676, 29906, 29908, 33624, 29075, 65535, 65535, 65535, 
+      36068, 36435, 65535, 65535, 29704, 65535, 38491, 37232, 65535, 65535, 39265, 65535, 32751, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32602, 65535, 65535, 65535, 38159, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 39355, 38991, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41575, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37994, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 35820, 65535, 65535, 65535, 65535, 65535, 41147, 65535, 65535, 36808, 65535, 65535, 34899, 
+      65535, 65535, 65535, 65535, 32621, 39649, 65535, 65535, 65535, 65535, 65535, 29986, 39720, 41275, 65535, 29769, 
+      27048, 24776, 32896, 28709, 36604, 40150, 20828, 38905, 23608, 20788, 22149, 40132, 22510, 25023, 32803, 18417, 
+      22319, 18288, 25275, 20423, 21629, 29128, 16760, 20951, 18168, 15754, 22622, 37577, 34238, 27109, 12235, 12607, 
+      26631, 17244, 23114, 13194, 26708, 10351, 21138, 19982, 15140, 8037, 7364, 6759, 8365, 5450, 17026, 10282, 
+      28371, 15161, 26302, 2093, 7860, 65535, 11518, 17651, 65535, 15589, 16089, 16209, 36636, 11397, 23220, 18522, 
+      30618, 16828, 12347, 18023, 39129, 26831, 21903, 23376, 24653, 21542, 27331, 36416, 22320, 23660, 19911, 19365, 
+      65535, 65535, 40196, 31894, 30221, 25805, 33287, 65535, 26374, 27600, 27466, 65535, 28959, 28561, 30715, 28397, 
+      30193, 29692, 29004, 34943, 30004, 29591, 65535, 37569, 65535, 40004, 35111, 33378, 65535, 37940, 41136, 33335, 
+      65535, 65535, 35220, 34293, 39553, 37856, 65535, 65535, 39406, 36349, 36351, 38919, 35839, 65535, 65535, 65535, 
+      41131, 41411, 65535, 65535, 36813, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39708, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40006, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 24663, 36968, 65535, 65535, 65535, 65535, 32950, 65535, 65535, 27708, 65535, 65535, 25419, 
+      65535, 65535, 65535, 65535, 27108, 65535, 65535, 65535, 65535, 65535, 65535, 19194, 65535, 65535, 65535, 30912, 
+      17733, 16871, 39862, 34941, 65535, 65535, 22176, 65535, 28693, 23883, 26941, 65535, 28668, 32386, 65535, 20973, 
+      29077, 21764, 33372, 26455, 28422, 38262, 15481, 27817, 24052, 14045, 31144, 65535, 65535, 37231, 13592, 18311, 
+      36930, 8836, 33491, 8301, 37496, 17605, 31553, 9295, 6711, 11469, 13493, 12076, 7033, 10033, 28208, 4072, 
+      39807, 26493, 37780, 11417, 3706, 11518, 65535, 6161, 65535, 4601, 27192, 27119, 65535, 5481, 11850, 7771, 
+      41645, 6829, 21041, 7867, 65535, 37175, 11016, 32477, 13603, 11445, 36650, 65535, 12340, 13387, 12948, 22647, 
+      65535, 65535, 65535, 39759, 37563, 16086, 39457, 65535, 19110, 26772, 18581, 65535, 29021, 18958, 30567, 19795, 
+      28561, 19288, 21917, 37108, 19728, 20516, 65535, 40081, 65535, 65535, 32399, 28155, 65535, 37163, 41835, 24996, 
+      65535, 65535, 27682, 24821, 35106, 31858, 65535, 65535, 32052, 26605, 26608, 30770, 25651, 65535, 65535, 65535, 
+      33279, 33678, 40118, 65535, 26149, 65535, 35655, 34266, 65535, 65535, 36335, 65535, 29237, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28949, 65535, 41957, 65535, 34616, 65535, 65535, 
+      40667, 65535, 65535, 65535, 65535, 35759, 35388, 65535, 65535, 38501, 65535, 65535, 41808, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37937, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41104, 65535, 34629, 40013, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 19100, 33282, 65535, 65535, 65535, 65535, 29553, 65535, 65535, 23917, 65535, 65535, 21439, 
+      65535, 65535, 65535, 65535, 25933, 65535, 65535, 65535, 65535, 65535, 65535, 14232, 65535, 65535, 65535, 33180, 
+      14526, 15113, 65535, 39305, 65535, 65535, 25321, 65535, 32892, 27614, 31130, 65535, 33287, 37307, 65535, 24759, 
+      33901, 25835, 38538, 31140, 33287, 65535, 18371, 32735, 28823, 17023, 36523, 65535, 65535, 65535, 17959, 23427, 
+      65535, 8847, 39423, 11407, 65535, 23162, 37511, 5857, 7917, 16853, 19154, 17756, 12377, 15898, 34349, 9068, 
+      65535, 32651, 65535, 17567, 9866, 17651, 6161, 65535, 65535, 2832, 33053, 32891, 65535, 8756, 5755, 3469, 
+      65535, 4600, 26160, 4668, 65535, 65535, 5610, 37297, 7800, 7069, 41454, 65535, 7937, 8484, 11443, 25453, 
+      65535, 65535, 65535, 65535, 41299, 11463, 65535, 65535, 16190, 27021, 14445, 65535, 29542, 14197, 30835, 15770, 
+      28185, 13852, 18811, 38120, 14377, 16065, 65535, 41079, 65535, 65535, 31085, 25707, 65535, 36571, 41725, 20781, 
+      65535, 65535, 23828, 19846, 32619, 28686, 65535, 65535, 28074, 21388, 21390, 26381, 20175, 65535, 65535, 39876, 
+      28957, 29407, 36712, 65535, 20365, 65535, 31192, 29588, 65535, 65535, 31686, 65535, 23521, 39425, 41047, 65535, 
+      65535, 65535, 40810, 65535, 40841, 65535, 40348, 65535, 65535, 22926, 38242, 36609, 65535, 28808, 65535, 65535, 
+      35031, 65535, 65535, 65535, 65535, 29838, 29454, 65535, 38451, 32631, 38640, 65535, 36005, 38035, 65535, 37681, 
+      39211, 65535, 65535, 65535, 40161, 65535, 65535, 41482, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31877, 36577, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 40647, 65535, 35677, 65535, 29063, 34906, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 39930, 26422, 65535, 65535, 65535, 37701, 26444, 65535, 24128, 65535, 34107, 23194, 65535, 20795, 38084, 65535, 
+      28459, 36207, 31179, 14643, 65535, 41261, 20926, 26392, 25381, 21114, 20771, 65535, 29873, 26230, 22767, 65535, 
+      65535, 65535, 30255, 33727, 21901, 17415, 65535, 18112, 38296, 65535, 39419, 15729, 36264, 32190, 22140, 65535, 
+      34943, 65535, 30056, 37410, 35173, 24828, 65535, 35319, 38662, 65535, 30311, 13554, 16642, 22417, 65535, 41376, 
+      22060, 65535, 24350, 65535, 19983, 40130, 25758, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 26868, 65535, 
+      15123, 28160, 16780, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 27194, 27489, 6670, 65535, 65535, 65535, 
+      13787, 65535, 35148, 65535, 6245, 19593, 65535, 25982, 65535, 65535, 22609, 12833, 65535, 65535, 65535, 40911, 
+      9971, 9111, 14229, 24665, 26995, 65535, 29145, 13839, 65535, 65535, 65535, 14209, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 39201, 65535, 65535, 16724, 37830, 23019, 34883, 65535, 65535, 18717, 65535, 41890, 65535, 
+      21952, 34846, 65535, 65535, 65535, 65535, 35788, 28738, 65535, 65535, 65535, 65535, 65535, 34172, 17094, 65535, 
+      65535, 65535, 65535, 65535, 65535, 18651, 65535, 65535, 23272, 37141, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 24519, 65535, 65535, 65535, 65535, 38302, 65535, 65535, 65535, 65535, 65535, 24092, 65535, 
+      65535, 65535, 65535, 37326, 65535, 65535, 65535, 30706, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 31824, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38917, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 25421, 65535, 65535, 36875, 65535, 65535, 65535, 65535, 39506, 65535, 65535, 36988, 65535, 65535, 28177, 
+      24159, 65535, 65535, 65535, 65535, 65535, 65535, 29734, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 19328 },
+    { 65535, 65535, 65535, 21830, 36069, 65535, 65535, 65535, 65535, 32299, 65535, 65535, 26698, 65535, 65535, 24235, 
+      65535, 65535, 65535, 65535, 28178, 65535, 65535, 65535, 65535, 65535, 65535, 17062, 65535, 65535, 65535, 34224, 
+      17170, 17412, 65535, 39265, 65535, 65535, 25895, 65535, 32933, 27899, 31170, 65535, 33063, 36881, 65535, 24995, 
+      33537, 25919, 37926, 30865, 32893, 65535, 18994, 32302, 28483, 17583, 35730, 65535, 65535, 41807, 17809, 22824, 
+      41487, 10353, 38031, 11761, 41974, 22200, 36083, 8365, 8871, 16023, 18092, 16675, 11544, 14628, 32532, 8367, 
+      65535, 30732, 41859, 15780, 8116, 15589, 4601, 2832, 65535, 65535, 30565, 30348, 65535, 5947, 7674, 3170, 
+      65535, 2694, 23419, 3458, 65535, 39787, 6456, 34490, 9123, 6903, 38642, 65535, 7807, 8795, 9660, 22704, 
+      65535, 65535, 65535, 40862, 38488, 11552, 39745, 65535, 15205, 24843, 14191, 65535, 27301, 14415, 28678, 15452, 
+      26219, 14691, 17959, 35789, 15128, 16051, 65535, 38766, 65535, 65535, 29489, 24574, 65535, 34734, 39750, 20626, 
+      65535, 65535, 23454, 20260, 31549, 27944, 65535, 65535, 27799, 22015, 22018, 26370, 21052, 65535, 65535, 38922, 
+      28908, 29326, 36136, 65535, 21593, 65535, 31247, 29792, 65535, 65535, 31873, 65535, 24660, 39397, 40943, 65535, 
+      65535, 65535, 40986, 65535, 41117, 65535, 40729, 65535, 65535, 24514, 38897, 37365, 65535, 30055, 65535, 65535, 
+      36071, 65535, 65535, 65535, 65535, 31239, 30875, 65535, 39525, 33956, 39736, 65535, 37238, 39239, 65535, 38945, 
+      40443, 65535, 65535, 65535, 41619, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34245, 38994, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 38406, 65535, 31763, 37698, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 41815, 65535, 65535, 41083, 41202, 40883, 39525, 37917, 65535, 36776, 36167, 36146, 37184, 
+      65535, 40248, 31030, 29397, 29709, 30780, 30651, 29946, 27916, 28763, 27445, 29985, 25627, 25039, 26101, 27896, 
+      24526, 26833, 23758, 24654, 24080, 24002, 29966, 23586, 23700, 29498, 21293, 26451, 24430, 19981, 25316, 21551, 
+      19097, 33207, 16553, 28790, 17409, 18968, 15303, 36044, 31178, 21964, 19722, 20282, 24146, 20440, 9914, 26367, 
+      15268, 8411, 13027, 17133, 23739, 16089, 27192, 33053, 27194, 30565, 65535, 1097, 20854, 25041, 38136, 32986, 
+      14536, 30935, 9094, 32050, 23127, 11209, 36180, 10438, 38937, 34998, 13151, 20505, 35545, 37030, 30823, 18941, 
+      28300, 30418, 24586, 19182, 18620, 38231, 22731, 30226, 35834, 28784, 38611, 32408, 28443, 40441, 29864, 39024, 
+      31512, 65535, 37619, 29570, 65535, 40615, 34591, 31010, 32216, 31589, 36340, 38478, 36467, 35725, 36084, 65535, 
+      37751, 37827, 65535, 65535, 41971, 65535, 40288, 41575, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41913, 65535, 41850, 40399, 38812, 65535, 37853, 37204, 37119, 38150, 
+      65535, 40606, 32125, 30483, 30723, 31686, 31468, 30878, 28928, 29652, 28424, 30853, 26656, 26121, 27138, 28706, 
+      25569, 27678, 24851, 25644, 25114, 25082, 30554, 24612, 24638, 30035, 22378, 27280, 25356, 21040, 25869, 22305, 
+      20152, 33413, 17640, 29088, 18419, 19684, 16399, 36085, 31344, 22405, 20234, 20725, 24386, 20759, 11006, 26485, 
+      16041, 9472, 13817, 17376, 23737, 16209, 27119, 32891, 27489, 30348, 1097, 65535, 21052, 24730, 37862, 32682, 
+      14530, 30605, 8332, 31702, 23194, 10782, 35830, 9496, 38570, 34564, 12402, 20241, 35084, 36572, 30217, 17949, 
+      28137, 30326, 24208, 18323, 17672, 37676, 21754, 29910, 35087, 27753, 37952, 32115, 27378, 39824, 28788, 38325, 
+      30470, 65535, 36810, 28481, 65535, 39932, 34232, 29941, 31547, 30569, 35278, 37508, 36064, 34629, 35003, 41890, 
+      37236, 36876, 65535, 65535, 40914, 41914, 39347, 40876, 65535, 65535, 65535, 65535, 65535, 65535, 41981, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 32999, 65535, 65535, 65535, 65535, 32878, 65535, 30591, 65535, 39721, 29535, 65535, 27143, 65535, 65535, 
+      33752, 40454, 36012, 21025, 65535, 65535, 26295, 30660, 29763, 26001, 25255, 65535, 32225, 29081, 26288, 65535, 
+      65535, 65535, 30858, 33268, 23502, 20219, 65535, 20474, 36615, 40798, 37396, 18573, 34311, 30745, 22488, 41701, 
+      32912, 40177, 28571, 34987, 32982, 24129, 65535, 32968, 35751, 65535, 28098, 15319, 17101, 20695, 65535, 37342, 
+      20078, 65535, 21434, 65535, 17523, 35668, 22401, 65535, 65535, 40814, 38229, 39242, 65535, 40118, 22131, 65535, 
+      11370, 23046, 12303, 37287, 65535, 36636, 65535, 65535, 6670, 65535, 20854, 21052, 65535, 65535, 65535, 65535, 
+      7123, 65535, 28524, 65535, 3262, 12986, 65535, 19430, 65535, 65535, 16289, 8036, 65535, 65535, 65535, 34401, 
+      10166, 11094, 11323, 19301, 21402, 65535, 24180, 13832, 65535, 41291, 65535, 15210, 39441, 65535, 39892, 65535, 
+      65535, 65535, 65535, 34491, 65535, 65535, 17921, 33621, 21572, 31236, 65535, 65535, 20101, 41621, 38255, 65535, 
+      22867, 32867, 65535, 65535, 65535, 65535, 34338, 29235, 65535, 65535, 65535, 65535, 65535, 33976, 21883, 65535, 
+      65535, 65535, 65535, 65535, 65535, 23302, 65535, 65535, 26615, 37991, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 28715, 65535, 65535, 65535, 65535, 40850, 65535, 65535, 65535, 65535, 65535, 28980, 65535, 
+      65535, 65535, 65535, 40787, 65535, 65535, 65535, 35129, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 36544, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 31282, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34652, 
+      30639, 65535, 65535, 65535, 65535, 65535, 65535, 36367, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 25961 },
+    { 65535, 65535, 65535, 27752, 41714, 65535, 65535, 65535, 65535, 37821, 65535, 65535, 32352, 65535, 65535, 29943, 
+      65535, 65535, 65535, 65535, 32545, 65535, 65535, 65535, 65535, 65535, 65535, 22976, 65535, 65535, 65535, 35864, 
+      22561, 22139, 65535, 38453, 65535, 65535, 26887, 65535, 32513, 28198, 30818, 65535, 32084, 35350, 65535, 25336, 
+      32252, 25894, 35979, 29865, 31567, 40295, 20497, 30917, 27448, 19075, 33482, 65535, 65535, 38492, 17852, 21526, 
+      38026, 14242, 34510, 13547, 38063, 20160, 32533, 13771, 12175, 14785, 16125, 14799, 10980, 12536, 28281, 8942, 
+      39147, 26312, 36968, 12285, 6238, 11397, 5481, 8756, 65535, 5947, 25041, 24730, 65535, 65535, 13147, 7952, 
+      38941, 5901, 17518, 7044, 65535, 33884, 11160, 28544, 13937, 10314, 32699, 65535, 11030, 12435, 8973, 17374, 
+      65535, 65535, 65535, 35102, 32786, 14420, 34348, 65535, 15523, 21389, 16126, 65535, 23584, 17164, 25157, 17126, 
+      23303, 18407, 18293, 31627, 18678, 18239, 65535, 34600, 65535, 38018, 27401, 23816, 65535, 31883, 36431, 22197, 
+      65535, 65535, 24415, 22913, 30622, 27895, 65535, 65535, 28744, 24954, 24956, 27911, 24462, 65535, 65535, 37996, 
+      30266, 30601, 36125, 65535, 25553, 65535, 32718, 31614, 65535, 65535, 33586, 65535, 28367, 40423, 41765, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28949, 41304, 40010, 65535, 33791, 65535, 65535, 
+      39285, 65535, 65535, 65535, 65535, 35213, 34891, 65535, 65535, 37735, 65535, 65535, 40780, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39719, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37654, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 15126, 31284, 65535, 65535, 65535, 65535, 28052, 65535, 65535, 22266, 65535, 65535, 19724, 
+      65535, 65535, 65535, 65535, 26938, 65535, 65535, 65535, 65535, 65535, 65535, 11779, 65535, 65535, 65535, 36732, 
+      14531, 16569, 65535, 65535, 65535, 65535, 29741, 65535, 37798, 32334, 36058, 65535, 38441, 65535, 65535, 29581, 
+      39166, 30794, 65535, 36359, 38582, 65535, 22916, 38064, 34114, 21684, 65535, 65535, 65535, 65535, 23244, 28936, 
+      65535, 12825, 65535, 16491, 65535, 28833, 65535, 8207, 12700, 22512, 24868, 23478, 18071, 21651, 40056, 14766, 
+      65535, 38317, 65535, 23263, 15545, 23220, 11850, 5755, 65535, 7674, 38136, 37862, 65535, 13147, 65535, 5225, 
+      65535, 7370, 30551, 6417, 65535, 65535, 2831, 41125, 2601, 5307, 65535, 65535, 5658, 5076, 11583, 27783, 
+      65535, 65535, 65535, 65535, 65535, 7741, 65535, 65535, 13904, 26920, 10939, 65535, 29543, 9913, 30528, 12252, 
+      27425, 8705, 16037, 38159, 9310, 12002, 65535, 40979, 65535, 65535, 29284, 23112, 65535, 35184, 40565, 16671, 
+      65535, 65535, 19940, 14976, 29660, 25250, 65535, 65535, 23903, 16231, 16234, 21880, 14799, 65535, 65535, 36523, 
+      24445, 24930, 32801, 40766, 14732, 65535, 26506, 24749, 65535, 65535, 26833, 65535, 17917, 34717, 36408, 37935, 
+      65535, 65535, 35856, 65535, 35783, 65535, 35194, 65535, 65535, 17172, 32869, 31172, 65535, 23127, 65535, 65535, 
+      29424, 65535, 65535, 65535, 38381, 24106, 23719, 65535, 32816, 26915, 32996, 65535, 30311, 32348, 65535, 31974, 
+      33513, 65535, 65535, 37151, 34412, 37856, 65535, 35729, 40180, 65535, 39854, 40414, 65535, 38815, 65535, 39990, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 26628, 31404, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 36329, 65535, 31443, 65535, 24751, 31125, 65535, 65535, 39435, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 20189, 35598, 65535, 65535, 65535, 65535, 32066, 65535, 65535, 26324, 65535, 65535, 23795, 
+      65535, 65535, 65535, 65535, 29197, 65535, 65535, 65535, 65535, 65535, 65535, 16136, 65535, 65535, 65535, 36599, 
+      17419, 18390, 65535, 65535, 65535, 65535, 28578, 65535, 35889, 30740, 34124, 65535, 36112, 39987, 65535, 27854, 
+      36626, 28846, 41068, 33927, 35988, 65535, 21632, 35406, 31559, 20253, 38892, 65535, 65535, 65535, 20805, 25952, 
+      65535, 12304, 41161, 14511, 65535, 25368, 39206, 9101, 11238, 19175, 21262, 19845, 14685, 17795, 35530, 11466, 
+      65535, 33683, 65535, 18844, 11241, 18522, 7771, 3469, 65535, 3170, 32986, 32682, 65535, 7952, 5225, 65535, 
+      65535, 2159, 25328, 1457, 65535, 41631, 3381, 35997, 6142, 3845, 40082, 65535, 4751, 5638, 8118, 23148, 
+      65535, 65535, 65535, 41667, 39207, 8461, 40007, 65535, 12743, 23808, 11248, 65535, 26368, 11305, 27594, 12546, 
+      24843, 11525, 15398, 34995, 11958, 13018, 65535, 37930, 65535, 41696, 27630, 22252, 65535, 33163, 38361, 17663, 
+      65535, 65535, 20602, 17123, 29178, 25322, 65535, 65535, 24906, 18853, 18855, 23362, 17883, 65535, 65535, 36464, 
+      25919, 26350, 33418, 40967, 18467, 65535, 28223, 26719, 65535, 65535, 28808, 65535, 21512, 36414, 37992, 39506, 
+      65535, 65535, 37935, 65535, 38037, 65535, 37623, 65535, 65535, 21492, 35742, 34200, 65535, 26919, 65535, 65535, 
+      32905, 65535, 65535, 65535, 41461, 28136, 27778, 65535, 36360, 30830, 36572, 65535, 34093, 36088, 65535, 35803, 
+      37295, 65535, 65535, 40991, 38517, 41875, 65535, 39866, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31770, 36563, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 41529, 65535, 36624, 65535, 29934, 36200, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 40088, 65535, 65535, 65535, 65535, 39876, 65535, 37615, 65535, 65535, 36484, 65535, 34107, 65535, 65535, 
+      39849, 65535, 41660, 27884, 65535, 65535, 32604, 35978, 35207, 31967, 30944, 65535, 35748, 33238, 31171, 65535, 
+      65535, 65535, 32760, 33899, 26929, 24922, 41533, 24808, 35692, 38822, 36045, 23444, 33235, 30491, 24845, 39045, 
+      31843, 37642, 28443, 33336, 31725, 25262, 65535, 31532, 33492, 65535, 27185, 19757, 20220, 21111, 38634, 33681, 
+      20278, 65535, 20338, 65535, 17549, 31565, 20631, 65535, 65535, 35870, 33406, 34215, 38540, 34712, 18473, 40888, 
+      11180, 18740, 10689, 31563, 38257, 30618, 41645, 65535, 13787, 65535, 14536, 14530, 7123, 38941, 65535, 65535, 
+      65535, 65535, 21539, 65535, 8708, 5957, 65535, 12437, 65535, 65535, 9769, 6992, 65535, 65535, 65535, 27399, 
+      13949, 15916, 11564, 14256, 15857, 65535, 19373, 16472, 65535, 34865, 65535, 18476, 33251, 65535, 33928, 65535, 
+      36894, 65535, 65535, 29525, 65535, 65535, 20942, 29271, 21426, 27666, 40305, 65535, 23017, 36788, 34343, 65535, 
+      25037, 31098, 65535, 65535, 65535, 65535, 33055, 30413, 65535, 65535, 65535, 65535, 65535, 34073, 27515, 65535, 
+      65535, 65535, 65535, 65535, 65535, 28758, 65535, 65535, 30761, 38935, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 33530, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34414, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 39903, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 41570, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 37558, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41510, 
+      37519, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33016 },
+    { 65535, 65535, 65535, 22341, 37552, 65535, 65535, 65535, 65535, 33940, 65535, 65535, 28234, 65535, 65535, 25720, 
+      65535, 65535, 65535, 65535, 30510, 65535, 65535, 65535, 65535, 65535, 65535, 18171, 65535, 65535, 65535, 36918, 
+      19071, 19696, 65535, 41747, 65535, 65535, 28559, 65535, 35460, 30506, 33701, 65535, 35492, 39208, 65535, 27597, 
+      35906, 28477, 40152, 33281, 35250, 65535, 21672, 34643, 30881, 20257, 37864, 65535, 65535, 65535, 20331, 25131, 
+      65535, 12963, 39721, 14427, 65535, 24313, 37753, 10457, 11555, 18275, 20184, 18773, 13862, 16631, 33851, 10815, 
+      65535, 31951, 65535, 17326, 9944, 16828, 6829, 4600, 65535, 2694, 30935, 30605, 65535, 5901, 7370, 2159, 
+      65535, 65535, 23182, 1195, 65535, 39475, 5261, 33843, 8042, 4792, 37932, 65535, 5643, 6873, 7025, 21156, 
+      65535, 65535, 65535, 39613, 37170, 9347, 38097, 65535, 12534, 22446, 11752, 65535, 24953, 12217, 26268, 12969, 
+      23695, 12911, 15303, 33521, 13271, 13700, 65535, 36483, 65535, 40193, 26840, 21881, 65535, 32161, 37241, 18169, 
+      65535, 65535, 20902, 18093, 28857, 25289, 65535, 65535, 25264, 19962, 19965, 23941, 19183, 65535, 65535, 36233, 
+      26453, 26856, 33502, 40798, 19997, 65535, 28825, 27445, 65535, 65535, 29509, 65535, 22951, 36917, 38432, 39926, 
+      65535, 65535, 38585, 65535, 38761, 65535, 38425, 65535, 65535, 23212, 36750, 35288, 65535, 28385, 65535, 65535, 
+      34196, 65535, 65535, 65535, 65535, 29693, 29350, 65535, 37655, 32321, 37880, 65535, 35505, 37470, 65535, 37227, 
+      38690, 65535, 65535, 65535, 40051, 65535, 65535, 41408, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33834, 38634, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 38783, 65535, 32093, 38349, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40168, 65535, 65535, 65535, 40325, 
+      38462, 36714, 38185, 35474, 38282, 39779, 32077, 38886, 32249, 31204, 31251, 39044, 30379, 31130, 34523, 29405, 
+      29618, 28834, 30381, 28793, 29024, 31906, 28980, 28404, 27104, 28052, 27654, 35539, 33397, 28269, 24315, 22903, 
+      27452, 28773, 24462, 25298, 26117, 20175, 22852, 30334, 26529, 20203, 18855, 18715, 20487, 17774, 17227, 21604, 
+      24353, 15177, 22117, 14236, 18255, 12347, 21041, 26160, 35148, 23419, 9094, 8332, 28524, 17518, 30551, 25328, 
+      21539, 23182, 65535, 24190, 30174, 16369, 28259, 11491, 30912, 26732, 15641, 25855, 27168, 28654, 21996, 10690, 
+      33947, 36430, 28969, 19604, 17875, 29524, 21035, 34792, 26757, 20686, 29651, 37057, 20908, 31567, 22532, 29999, 
+      23498, 33864, 28529, 24411, 33888, 31613, 38677, 26616, 33740, 28430, 28553, 29768, 40145, 29238, 31014, 33602, 
+      40445, 35596, 34057, 36105, 34015, 34313, 38095, 65535, 37282, 38308, 38309, 37961, 38700, 65535, 65535, 39432, 
+      39403, 39475, 40517, 65535, 40575, 65535, 41600, 41527, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 21498, 37046, 65535, 65535, 65535, 65535, 33522, 65535, 65535, 27779, 65535, 65535, 25249, 
+      65535, 65535, 65535, 65535, 30552, 65535, 65535, 65535, 65535, 65535, 65535, 17569, 65535, 65535, 65535, 37533, 
+      18854, 19734, 65535, 65535, 65535, 65535, 29319, 65535, 36386, 31355, 34624, 65535, 36483, 40249, 65535, 28452, 
+      36928, 29376, 41232, 34279, 36277, 65535, 22398, 35677, 31887, 20996, 38971, 65535, 65535, 65535, 21258, 26176, 
+      65535, 13372, 40903, 15191, 65535, 25420, 38936, 10445, 12129, 19335, 21293, 19879, 14893, 17756, 35046, 11781, 
+      65535, 33145, 65535, 18511, 11087, 18023, 7867, 4668, 65535, 3458, 32050, 31702, 65535, 7044, 6417, 1457, 
+      65535, 1195, 24190, 65535, 65535, 40434, 4130, 34715, 6896, 3631, 38777, 65535, 4502, 5691, 6780, 21713, 
+      65535, 65535, 65535, 40253, 37785, 8234, 38554, 65535, 11819, 22423, 10754, 65535, 24971, 11108, 26221, 12002, 
+      23524, 11725, 14546, 33587, 12092, 12654, 65535, 36529, 65535, 40282, 26453, 21265, 65535, 31904, 37060, 17186, 
+      65535, 65535, 19996, 16980, 28225, 24522, 65535, 65535, 24342, 18822, 18825, 22943, 18011, 65535, 65535, 35565, 
+      25472, 25885, 32694, 40104, 18804, 65535, 27824, 26405, 65535, 65535, 28478, 65535, 21764, 35954, 37492, 38994, 
+      65535, 65535, 37575, 65535, 37729, 65535, 37370, 65535, 65535, 22020, 35642, 34161, 65535, 27197, 65535, 65535, 
+      33031, 65535, 65535, 65535, 41399, 28500, 28156, 65535, 36491, 31132, 36713, 65535, 34324, 36293, 65535, 36045, 
+      37511, 65535, 65535, 41212, 38860, 65535, 65535, 40216, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32734, 37539, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 37860, 65535, 31168, 37510, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 32371, 65535, 65535, 65535, 65535, 32553, 65535, 30223, 65535, 40333, 29368, 65535, 26972, 65535, 65535, 
+      34610, 41998, 37192, 19260, 65535, 65535, 27076, 32145, 31181, 27103, 26588, 65535, 34558, 31204, 28108, 65535, 
+      65535, 65535, 33695, 36334, 26007, 22268, 65535, 22690, 39840, 65535, 40643, 20581, 37551, 33935, 25320, 65535, 
+      36154, 65535, 31758, 38247, 36232, 27186, 65535, 36225, 39010, 65535, 31343, 17642, 19837, 23875, 65535, 40503, 
+      23281, 65535, 24695, 65535, 20756, 38757, 25658, 65535, 65535, 65535, 41173, 65535, 65535, 65535, 25228, 65535, 
+      14632, 26035, 15519, 39923, 65535, 39129, 65535, 65535, 6245, 65535, 23127, 23194, 3262, 65535, 65535, 65535, 
+      8708, 65535, 30174, 65535, 65535, 14008, 65535, 20179, 65535, 65535, 16573, 6611, 65535, 65535, 65535, 34952, 
+      6906, 7941, 8790, 18433, 20751, 65535, 23001, 10617, 65535, 40944, 65535, 11949, 38894, 65535, 39149, 65535, 
+      65535, 65535, 65535, 33169, 65535, 65535, 14661, 31990, 18720, 29294, 65535, 65535, 16840, 40112, 36344, 65535, 
+      19633, 30262, 65535, 65535, 65535, 65535, 31583, 26064, 65535, 65535, 65535, 65535, 65535, 30931, 19107, 65535, 
+      65535, 65535, 65535, 65535, 65535, 20458, 65535, 65535, 23448, 34808, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 25690, 65535, 40845, 65535, 65535, 37590, 65535, 65535, 65535, 65535, 65535, 26152, 65535, 
+      65535, 65535, 65535, 37584, 65535, 65535, 65535, 32118, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 33606, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40871, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 28903, 65535, 65535, 40218, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41204, 65535, 65535, 32851, 
+      28879, 65535, 65535, 65535, 65535, 65535, 65535, 34924, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 24607 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40059, 65535, 65535, 
+      65535, 65535, 65535, 33231, 65535, 65535, 38436, 41352, 40654, 37677, 36549, 65535, 40089, 38027, 36395, 65535, 
+      65535, 65535, 36129, 36296, 31482, 30184, 41131, 29902, 36766, 38839, 36741, 28814, 34309, 32381, 28863, 38444, 
+      32999, 37217, 30550, 33916, 32731, 28473, 41114, 32395, 33528, 40691, 28750, 25047, 24890, 24115, 36501, 32390, 
+      23202, 65535, 22295, 39848, 20613, 29936, 22005, 65535, 41950, 33164, 30928, 31482, 35110, 31536, 18298, 37030, 
+      15001, 17823, 13683, 28118, 34043, 26831, 37175, 65535, 19593, 39787, 11209, 10782, 12986, 33884, 65535, 41631, 
+      5957, 39475, 16369, 40434, 14008, 65535, 65535, 6481, 65535, 65535, 4419, 9645, 65535, 65535, 37221, 21448, 
+      17717, 20114, 13429, 10335, 11195, 65535, 15219, 19167, 40430, 29073, 65535, 21394, 27595, 65535, 28401, 65535, 
+      31217, 65535, 41301, 24789, 65535, 65535, 23455, 25038, 21363, 24155, 34923, 39423, 25284, 31978, 30285, 65535, 
+      26559, 28926, 65535, 65535, 40313, 65535, 31181, 30753, 65535, 65535, 65535, 65535, 65535, 33294, 31713, 65535, 
+      65535, 65535, 65535, 65535, 65535, 32764, 65535, 65535, 33571, 38615, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 36809, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38227, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38607 },
+    { 65535, 65535, 65535, 17810, 34115, 65535, 65535, 65535, 65535, 30871, 65535, 65535, 25084, 65535, 65535, 22540, 
+      65535, 65535, 65535, 65535, 29380, 65535, 65535, 65535, 65535, 65535, 65535, 14606, 65535, 65535, 65535, 38312, 
+      17086, 18799, 65535, 65535, 65535, 65535, 30794, 65535, 38491, 33175, 36730, 65535, 38894, 65535, 65535, 30338, 
+      39495, 31435, 65535, 36743, 38876, 65535, 23862, 38317, 34416, 22544, 41995, 65535, 65535, 65535, 23563, 28952, 
+      65535, 14008, 65535, 17004, 65535, 28529, 65535, 9881, 13417, 22270, 24452, 23038, 17769, 21044, 38911, 14488, 
+      65535, 37063, 65535, 22210, 14571, 21903, 11016, 5610, 65535, 6456, 36180, 35830, 65535, 11160, 2831, 3381, 
+      65535, 5261, 28259, 4130, 65535, 65535, 65535, 38572, 2786, 2517, 65535, 65535, 3026, 2993, 8754, 25003, 
+      65535, 65535, 65535, 65535, 41092, 5985, 41457, 65535, 11559, 24178, 9110, 65535, 26796, 8621, 27827, 10451, 
+      24791, 8331, 13913, 35431, 8821, 10556, 65535, 38277, 65535, 65535, 26912, 20977, 65535, 32724, 38069, 15292, 
+      65535, 65535, 18432, 14237, 27714, 23511, 65535, 65535, 22599, 15814, 15816, 20815, 14696, 65535, 65535, 34788, 
+      23394, 23852, 31357, 39165, 15140, 65535, 25602, 23981, 65535, 65535, 26079, 65535, 18222, 33841, 35476, 37002, 
+      65535, 65535, 35202, 65535, 35232, 65535, 34747, 65535, 65535, 18111, 32699, 31102, 65535, 23604, 65535, 65535, 
+      29673, 65535, 65535, 65535, 38365, 24785, 24423, 65535, 33119, 27501, 33323, 65535, 30793, 32800, 65535, 32497, 
+      34000, 65535, 65535, 37689, 35166, 38540, 65535, 36512, 40875, 65535, 40754, 41403, 65535, 39918, 65535, 41111, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28607, 33412, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 38777, 65535, 33946, 65535, 27265, 33761, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 39167, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 40066, 39236, 36695, 36057, 40858, 35629, 38303, 39136, 37877, 34795, 35972, 34985, 33657, 38090, 
+      34817, 37119, 33463, 35078, 34407, 32543, 39288, 33941, 34131, 38577, 31222, 31006, 30356, 28204, 34540, 31602, 
+      27271, 40231, 25560, 36550, 24951, 28913, 24754, 41770, 37998, 30708, 28861, 29081, 31712, 28601, 19907, 33059, 
+      20264, 18711, 18523, 25031, 29745, 23376, 32477, 37297, 25982, 34490, 10438, 9496, 19430, 28544, 41125, 35997, 
+      12437, 33843, 11491, 34715, 20179, 6481, 38572, 65535, 41005, 36660, 4176, 14845, 36900, 38322, 30984, 14976, 
+      22802, 25393, 17543, 8964, 8181, 38435, 12313, 23340, 33961, 22834, 37626, 25601, 21567, 39826, 22552, 37546, 
+      25128, 65535, 34824, 20180, 65535, 39228, 27187, 21126, 22798, 21277, 29185, 33204, 28681, 27030, 26360, 39674, 
+      29168, 27389, 38907, 65535, 34740, 36992, 29854, 31895, 40782, 65535, 65535, 65535, 65535, 33074, 36623, 37626, 
+      65535, 65535, 40501, 39794, 65535, 37466, 65535, 65535, 37087, 38610, 65535, 41402, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 40673, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 15698, 32544, 65535, 65535, 65535, 65535, 29557, 65535, 65535, 23808, 65535, 65535, 21292, 
+      65535, 65535, 65535, 65535, 29207, 65535, 65535, 65535, 65535, 65535, 65535, 13317, 65535, 65535, 65535, 39325, 
+      16744, 19018, 65535, 65535, 65535, 65535, 32318, 65535, 40313, 34877, 38567, 65535, 40891, 65535, 65535, 32104, 
+      41576, 33289, 65535, 38784, 40979, 65535, 25470, 40445, 36508, 24219, 65535, 65535, 65535, 65535, 25627, 31209, 
+      65535, 15399, 65535, 18922, 65535, 30952, 65535, 10809, 15176, 24650, 26919, 25513, 20165, 23585, 41642, 16859, 
+      65535, 39814, 65535, 24902, 17222, 24653, 13603, 7800, 65535, 9123, 38937, 38570, 65535, 13937, 2601, 6142, 
+      65535, 8042, 30912, 6896, 65535, 65535, 2786, 41005, 65535, 4356, 65535, 65535, 4277, 3151, 10495, 27064, 
+      65535, 65535, 65535, 65535, 65535, 5338, 65535, 65535, 11737, 25221, 8493, 65535, 27843, 7331, 28711, 9777, 
+      25497, 6179, 13683, 36379, 6763, 9433, 65535, 39127, 65535, 65535, 27038, 20726, 65535, 33003, 38407, 14079, 
+      65535, 65535, 17359, 12408, 27169, 22704, 65535, 65535, 21303, 13740, 13742, 19284, 12408, 65535, 65535, 33963, 
+      21852, 22335, 30204, 38182, 12588, 65535, 23930, 22193, 65535, 65535, 24282, 65535, 15729, 32152, 33835, 35363, 
+      65535, 65535, 33336, 65535, 33289, 65535, 32729, 41030, 65535, 15392, 30496, 28836, 65535, 21050, 65535, 39980, 
+      27234, 65535, 65535, 65535, 36079, 22157, 21785, 65535, 30659, 24911, 30852, 65535, 28250, 30272, 65535, 29939, 
+      31459, 65535, 65535, 35132, 32527, 35929, 65535, 33865, 38262, 65535, 38075, 38701, 65535, 37187, 65535, 38378, 
+      41675, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 25875, 30683, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 36268, 65535, 31499, 65535, 24850, 31479, 65535, 65535, 40012, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 19994, 36551, 65535, 65535, 65535, 65535, 33358, 65535, 65535, 27573, 65535, 65535, 25030, 
+      65535, 65535, 65535, 65535, 31814, 65535, 65535, 65535, 65535, 65535, 65535, 17078, 65535, 65535, 65535, 40216, 
+      19574, 21160, 65535, 65535, 65535, 65535, 32365, 65535, 39734, 34572, 37969, 65535, 39943, 65535, 65535, 31691, 
+      40436, 32691, 65535, 37752, 39794, 65535, 25414, 39204, 35377, 24048, 65535, 65535, 65535, 65535, 24647, 29725, 
+      65535, 15852, 65535, 18338, 65535, 29033, 65535, 12072, 14976, 22909, 24909, 23494, 18441, 21382, 38540, 15265, 
+      65535, 36601, 65535, 22107, 14718, 21542, 11445, 7069, 65535, 6903, 34998, 34564, 65535, 10314, 5307, 3845, 
+      65535, 4792, 26732, 3631, 65535, 65535, 2517, 36660, 4356, 65535, 40588, 65535, 908, 2124, 6309, 22756, 
+      65535, 65535, 65535, 41328, 38801, 4649, 39037, 65535, 9297, 21661, 7416, 65535, 24279, 7516, 25316, 8726, 
+      22300, 8151, 11807, 32915, 8487, 9176, 65535, 35765, 65535, 39606, 24556, 18802, 65535, 30308, 35630, 13820, 
+      65535, 65535, 16789, 13376, 25643, 21624, 65535, 65535, 21074, 15194, 15197, 19518, 14393, 65535, 65535, 32840, 
+      22074, 22505, 29649, 37296, 15276, 65535, 24382, 22896, 65535, 65535, 24981, 65535, 18182, 32569, 34148, 35662, 
+      65535, 65535, 34103, 65535, 34220, 65535, 33827, 41564, 65535, 18639, 32033, 30538, 65535, 23619, 65535, 41225, 
+      29405, 65535, 65535, 65535, 37783, 24965, 24630, 65535, 32864, 27560, 33088, 65535, 30722, 32682, 65535, 32445, 
+      33902, 65535, 65535, 37603, 35300, 38580, 65535, 36659, 40906, 65535, 40973, 41702, 65535, 40335, 65535, 41536, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 29967, 34770, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 40595, 65535, 35846, 65535, 29204, 35830, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 35247, 65535, 65535, 65535, 65535, 65535, 41736, 40696, 65535, 65535, 65535, 40721, 65535, 
+      65535, 65535, 40421, 40325, 35900, 34490, 65535, 34253, 40274, 41780, 40072, 33079, 37854, 36278, 33268, 41038, 
+      36600, 39941, 34541, 37239, 36271, 32768, 65535, 35878, 36584, 65535, 32577, 29334, 29296, 28399, 38114, 34696, 
+      27477, 65535, 26346, 40525, 24932, 32086, 25880, 65535, 65535, 34424, 32436, 32770, 35693, 32449, 21665, 37155, 
+      19419, 20845, 18057, 28900, 33880, 27331, 36650, 41454, 22609, 38642, 13151, 12402, 16289, 32699, 65535, 40082, 
+      9769, 37932, 15641, 38777, 16573, 4419, 65535, 4176, 65535, 40588, 65535, 10832, 40781, 65535, 34759, 18383, 
+      18683, 21299, 13366, 6359, 6828, 65535, 10949, 19167, 37246, 25128, 41049, 21429, 23483, 65535, 24185, 40852, 
+      27126, 65535, 37835, 20370, 65535, 65535, 23056, 20671, 19192, 19993, 30634, 35401, 24603, 27562, 25934, 65535, 
+      25260, 25260, 41364, 65535, 35963, 38798, 27622, 28481, 65535, 65535, 65535, 65535, 65535, 30272, 32455, 37796, 
+      65535, 65535, 41219, 39336, 65535, 33290, 65535, 65535, 33017, 35743, 65535, 39727, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 36557, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38422, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40917 },
+    { 65535, 38476, 65535, 65535, 65535, 65535, 38862, 65535, 36523, 65535, 65535, 35780, 65535, 33397, 65535, 65535, 
+      41215, 65535, 65535, 24423, 65535, 65535, 33683, 38561, 37629, 33658, 33065, 65535, 40191, 37110, 34300, 65535, 
+      65535, 65535, 38326, 40126, 31405, 28254, 65535, 28499, 65535, 65535, 65535, 26605, 40027, 37028, 30053, 65535, 
+      38624, 65535, 34917, 40240, 38547, 31163, 65535, 38389, 40467, 65535, 33891, 23333, 24856, 27277, 65535, 40601, 
+      26518, 65535, 27019, 65535, 23804, 38408, 27474, 65535, 65535, 65535, 39984, 40683, 65535, 40945, 25456, 65535, 
+      17301, 25646, 17291, 37612, 65535, 36416, 65535, 65535, 12833, 65535, 20505, 20241, 8036, 65535, 65535, 65535, 
+      6992, 65535, 25855, 65535, 6611, 9645, 65535, 14845, 65535, 65535, 10832, 65535, 65535, 65535, 65535, 29019, 
+      8099, 10593, 4575, 11832, 14190, 65535, 16415, 9757, 65535, 34406, 65535, 11908, 32309, 65535, 32540, 65535, 
+      35872, 65535, 65535, 26644, 65535, 65535, 14192, 25628, 14701, 23203, 38253, 65535, 16191, 33685, 30220, 65535, 
+      18063, 25255, 65535, 65535, 65535, 65535, 26954, 23473, 65535, 65535, 65535, 65535, 65535, 27401, 22095, 65535, 
+      65535, 65535, 65535, 65535, 65535, 23122, 65535, 65535, 24218, 32077, 65535, 39314, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 27282, 65535, 38682, 65535, 65535, 36436, 65535, 65535, 65535, 65535, 65535, 28591, 65535, 
+      65535, 65535, 41455, 37456, 65535, 65535, 65535, 33517, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 35304, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 32571, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37565, 
+      33759, 65535, 65535, 65535, 65535, 65535, 65535, 40135, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 30139 },
+    { 65535, 65535, 65535, 19974, 36737, 65535, 65535, 65535, 65535, 33633, 65535, 65535, 27856, 65535, 65535, 25320, 
+      65535, 65535, 65535, 65535, 32407, 65535, 65535, 65535, 65535, 65535, 65535, 17345, 65535, 65535, 65535, 41049, 
+      20096, 21812, 65535, 65535, 65535, 65535, 33248, 65535, 40640, 35470, 38875, 65535, 40851, 65535, 65535, 32591, 
+      41343, 33596, 65535, 38660, 40700, 65535, 26296, 40109, 36284, 24935, 65535, 65535, 65535, 65535, 25554, 30627, 
+      65535, 16685, 65535, 19235, 65535, 29918, 65535, 12803, 15851, 23807, 25793, 24379, 19342, 22258, 39295, 16171, 
+      65535, 37339, 65535, 22928, 15583, 22320, 12340, 7937, 65535, 7807, 35545, 35084, 65535, 11030, 5658, 4751, 
+      65535, 5643, 27168, 4502, 65535, 65535, 3026, 36900, 4277, 908, 40781, 65535, 65535, 1489, 6218, 22799, 
+      65535, 65535, 65535, 41321, 38785, 3748, 38884, 65535, 8568, 21265, 6522, 65535, 23889, 6618, 24872, 7839, 
+      21794, 7382, 11012, 32501, 7685, 8268, 65535, 35324, 65535, 39177, 23895, 18040, 65535, 29697, 35043, 12917, 
+      65535, 65535, 15902, 12485, 24846, 20777, 65535, 65535, 20178, 14323, 14325, 18611, 13565, 65535, 65535, 32012, 
+      21167, 21599, 28775, 36452, 14525, 65535, 23474, 21989, 65535, 65535, 24074, 65535, 17389, 31663, 33243, 34758, 
+      65535, 65535, 33195, 65535, 33313, 65535, 32923, 40657, 65535, 17966, 31144, 29659, 65535, 22825, 65535, 40323, 
+      28560, 65535, 65535, 65535, 36899, 24199, 23871, 65535, 32019, 26769, 32245, 65535, 29905, 31856, 65535, 31629, 
+      33079, 65535, 65535, 36778, 34514, 37775, 65535, 35874, 40097, 65535, 40198, 40941, 65535, 39600, 65535, 40802, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 29518, 34312, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 40324, 65535, 35624, 65535, 29014, 35704, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 18736, 35690, 65535, 65535, 65535, 65535, 32705, 65535, 65535, 26950, 65535, 65535, 24429, 
+      65535, 65535, 65535, 65535, 32013, 65535, 65535, 65535, 65535, 65535, 65535, 16450, 65535, 65535, 65535, 41300, 
+      19602, 21581, 65535, 65535, 65535, 65535, 33759, 65535, 41363, 36097, 39599, 65535, 41683, 65535, 65535, 33243, 
+      65535, 34307, 65535, 39511, 41600, 65535, 26819, 41024, 37158, 25488, 65535, 65535, 65535, 65535, 26353, 31585, 
+      65535, 17000, 65535, 19887, 65535, 30992, 65535, 12826, 16363, 24813, 26878, 25461, 20323, 23380, 40663, 17095, 
+      65535, 38725, 65535, 24199, 16750, 23660, 13387, 8484, 65535, 8795, 37030, 36572, 65535, 12435, 5076, 5638, 
+      65535, 6873, 28654, 5691, 65535, 65535, 2993, 38322, 3151, 2124, 65535, 65535, 1489, 65535, 7491, 24107, 
+      65535, 65535, 65535, 65535, 40025, 2999, 39987, 65535, 8829, 22086, 6122, 65535, 24710, 5726, 25607, 7463, 
+      22433, 6040, 11029, 33268, 6403, 7591, 65535, 36040, 65535, 39904, 24211, 18110, 65535, 30109, 35494, 12321, 
+      65535, 65535, 15442, 11493, 24777, 20528, 65535, 65535, 19626, 13220, 13222, 17898, 12327, 65535, 65535, 31810, 
+      20473, 20923, 28366, 36175, 13155, 65535, 22718, 21150, 65535, 65535, 23245, 65535, 16079, 30945, 32563, 34086, 
+      41790, 41554, 32377, 65535, 32447, 65535, 32008, 39928, 65535, 16525, 30104, 28571, 65535, 21514, 65535, 39385, 
+      27353, 65535, 65535, 65535, 35829, 22846, 22510, 65535, 30813, 25453, 31033, 65535, 28634, 30603, 65535, 30355, 
+      31821, 65535, 65535, 35522, 33188, 36481, 65535, 34547, 38808, 65535, 38856, 39580, 65535, 38210, 65535, 39412, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28032, 32825, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 38891, 65535, 34218, 65535, 27631, 34360, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 26190, 65535, 65535, 65535, 65535, 65535, 39616, 65535, 65535, 33830, 65535, 65535, 31285, 
+      65535, 65535, 65535, 65535, 37314, 65535, 65535, 65535, 65535, 65535, 65535, 23360, 65535, 65535, 65535, 65535, 
+      25429, 26503, 65535, 65535, 65535, 65535, 35120, 65535, 41356, 36777, 39635, 65535, 41028, 65535, 65535, 33874, 
+      41221, 34578, 65535, 38805, 40537, 65535, 28360, 39888, 36385, 26927, 65535, 65535, 65535, 65535, 26424, 30472, 
+      65535, 19987, 65535, 21106, 65535, 29128, 40860, 17212, 18515, 23674, 25097, 23765, 19614, 21504, 36118, 16998, 
+      65535, 34027, 65535, 21082, 15032, 19911, 12948, 11443, 65535, 9660, 30823, 30217, 65535, 8973, 11583, 8118, 
+      65535, 7025, 21996, 6780, 65535, 37221, 8754, 30984, 10495, 6309, 34759, 65535, 6218, 7491, 65535, 16616, 
+      65535, 65535, 65535, 35104, 32567, 7576, 32729, 65535, 6557, 15714, 7924, 65535, 18294, 9619, 19483, 8628, 
+      16744, 11897, 9321, 26940, 11894, 10032, 65535, 29854, 65535, 33647, 19829, 15208, 65535, 25152, 30283, 13426, 
+      65535, 39774, 15459, 14767, 22161, 19038, 41360, 65535, 19774, 16942, 16944, 19039, 16941, 65535, 65535, 29578, 
+      21337, 21657, 27303, 34179, 18626, 65535, 23795, 22785, 65535, 65535, 24710, 65535, 20952, 31450, 32804, 34231, 
+      40963, 40907, 33416, 65535, 33766, 65535, 33638, 40220, 65535, 22494, 32585, 31413, 65535, 26177, 65535, 40934, 
+      31051, 65535, 65535, 65535, 38332, 27815, 27554, 65535, 34405, 30038, 34668, 65535, 32776, 34553, 65535, 34479, 
+      35777, 65535, 65535, 39379, 37663, 40622, 65535, 39010, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34947, 39665, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41629, 65535, 35086, 41846, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39282, 65535, 65535, 65535, 65535, 
+      39832, 39492, 65535, 65535, 65535, 65535, 40180, 65535, 65535, 40064, 40892, 65535, 40483, 41657, 65535, 37777, 
+      39872, 37575, 41019, 38693, 39241, 65535, 35411, 38592, 36738, 34171, 38272, 65535, 65535, 38772, 31304, 31728, 
+      37921, 31478, 35067, 29698, 36348, 29184, 33510, 30998, 29302, 27155, 26722, 26075, 25552, 24382, 27877, 25119, 
+      33516, 25853, 31403, 21452, 21551, 19365, 22647, 25453, 40911, 22704, 18941, 17949, 34401, 17374, 27783, 23148, 
+      27399, 21156, 10690, 21713, 34952, 21448, 25003, 14976, 27064, 22756, 18383, 29019, 22799, 24107, 16616, 65535, 
+      36311, 38998, 30432, 18603, 16101, 23757, 17044, 35618, 18986, 10008, 22692, 37691, 10326, 24921, 12017, 22573, 
+      12814, 27776, 19948, 15641, 27574, 24255, 38375, 18393, 31022, 21286, 17864, 19576, 39139, 19033, 21779, 24912, 
+      38198, 28592, 24597, 28086, 23341, 23968, 30892, 37681, 27261, 30168, 30169, 28349, 31092, 35804, 65535, 28857, 
+      29427, 29426, 29833, 32645, 33385, 65535, 31456, 31661, 65535, 40683, 32759, 38138, 34739, 35903, 36378, 37239, 
+      40254, 40596, 38420, 65535, 39234, 65535, 39740, 65535, 65535, 37410, 40535, 40267, 65535, 38936, 65535, 65535, 
+      41485, 65535, 65535, 65535, 65535, 40812, 40699, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 31846, 65535, 65535, 65535, 65535, 32668, 65535, 30368, 65535, 65535, 29983, 65535, 27723, 65535, 65535, 
+      37050, 65535, 40172, 17035, 65535, 65535, 29717, 35907, 34852, 30353, 30290, 65535, 39844, 36182, 32629, 65535, 
+      65535, 65535, 39910, 65535, 31764, 27385, 65535, 28062, 65535, 65535, 65535, 25698, 65535, 40747, 31612, 65535, 
+      65535, 65535, 38569, 65535, 65535, 33811, 65535, 65535, 65535, 65535, 38235, 23347, 26067, 30689, 65535, 65535, 
+      30128, 65535, 31600, 65535, 27638, 65535, 32542, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31801, 65535, 
+      21533, 32406, 22338, 65535, 65535, 65535, 65535, 65535, 9971, 65535, 28300, 28137, 10166, 65535, 65535, 65535, 
+      13949, 65535, 33947, 65535, 6906, 17717, 65535, 22802, 65535, 65535, 18683, 8099, 65535, 65535, 65535, 36311, 
+      65535, 2687, 5974, 17965, 20510, 65535, 21388, 3952, 65535, 40157, 65535, 5044, 37772, 65535, 37601, 65535, 
+      41075, 65535, 65535, 30634, 65535, 65535, 7756, 28817, 13058, 25525, 65535, 65535, 9935, 36896, 32383, 65535, 
+      12782, 24890, 65535, 65535, 65535, 65535, 25825, 19355, 65535, 65535, 65535, 65535, 65535, 24494, 13999, 65535, 
+      65535, 65535, 65535, 41973, 65535, 15061, 65535, 65535, 16916, 28044, 65535, 36993, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 19582, 65535, 33960, 65535, 65535, 30703, 65535, 65535, 65535, 40814, 65535, 20611, 65535, 
+      65535, 39902, 35641, 30872, 65535, 65535, 65535, 25960, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 27624, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34829, 65535, 65535, 38590, 65535, 65535, 65535, 
+      65535, 24478, 65535, 65535, 35212, 65535, 65535, 65535, 65535, 38821, 65535, 65535, 37079, 65535, 65535, 29676, 
+      25986, 65535, 65535, 65535, 65535, 65535, 65535, 32481, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 22930 },
+    { 65535, 29220, 65535, 65535, 65535, 65535, 30105, 65535, 27820, 65535, 39669, 27505, 65535, 25285, 65535, 65535, 
+      34880, 65535, 38117, 14354, 65535, 65535, 27675, 34138, 33063, 28481, 28568, 65535, 38684, 34906, 31191, 65535, 
+      65535, 65535, 39366, 65535, 30974, 26301, 65535, 27100, 65535, 65535, 65535, 24645, 65535, 40939, 31222, 65535, 
+      65535, 65535, 38773, 65535, 65535, 33746, 65535, 65535, 65535, 65535, 38703, 22663, 25698, 30958, 65535, 65535, 
+      30479, 65535, 32275, 65535, 28126, 65535, 33385, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33169, 65535, 
+      22334, 33951, 23394, 65535, 65535, 65535, 65535, 65535, 9111, 65535, 30418, 30326, 11094, 65535, 65535, 65535, 
+      15916, 65535, 36430, 65535, 7941, 20114, 65535, 25393, 65535, 65535, 21299, 10593, 65535, 65535, 65535, 38998, 
+      2687, 65535, 8637, 20633, 23180, 65535, 23936, 5217, 65535, 65535, 65535, 5114, 40291, 65535, 40057, 65535, 
+      65535, 65535, 65535, 32950, 65535, 65535, 7623, 30999, 14547, 27574, 65535, 65535, 9668, 38993, 34293, 65535, 
+      12854, 26282, 65535, 65535, 65535, 65535, 26967, 19631, 65535, 65535, 65535, 65535, 65535, 25076, 11661, 65535, 
+      65535, 65535, 65535, 65535, 65535, 12848, 65535, 65535, 15522, 28104, 65535, 37512, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 17795, 65535, 33620, 65535, 65535, 29967, 65535, 65535, 65535, 40517, 65535, 18499, 65535, 
+      65535, 39316, 34791, 29698, 65535, 65535, 65535, 24222, 65535, 65535, 65535, 41298, 65535, 65535, 65535, 65535, 
+      65535, 25772, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33029, 65535, 65535, 36755, 65535, 65535, 65535, 
+      65535, 22017, 65535, 40313, 32951, 65535, 65535, 65535, 65535, 36449, 65535, 65535, 34602, 40157, 65535, 27042, 
+      23322, 65535, 65535, 65535, 65535, 65535, 65535, 29805, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 20255 },
+    { 65535, 37814, 65535, 65535, 65535, 65535, 38589, 65535, 36277, 65535, 65535, 35820, 65535, 33520, 65535, 65535, 
+      65535, 65535, 65535, 22986, 65535, 65535, 34952, 40617, 39610, 35310, 34999, 65535, 65535, 39984, 36803, 65535, 
+      65535, 65535, 65535, 65535, 34743, 31046, 65535, 31480, 65535, 65535, 65535, 29356, 65535, 41400, 33803, 65535, 
+      65535, 65535, 39265, 65535, 65535, 35250, 65535, 65535, 65535, 65535, 38355, 26417, 28420, 31523, 65535, 65535, 
+      30803, 65535, 31489, 65535, 28115, 65535, 32006, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 30016, 65535, 
+      21631, 30152, 21772, 41538, 65535, 40196, 65535, 65535, 14229, 65535, 24586, 24208, 11323, 65535, 65535, 65535, 
+      11564, 65535, 28969, 65535, 8790, 13429, 65535, 17543, 65535, 65535, 13366, 4575, 65535, 65535, 65535, 30432, 
+      5974, 8637, 65535, 11996, 14542, 65535, 15538, 5835, 65535, 34264, 65535, 8099, 31925, 65535, 31847, 65535, 
+      35302, 65535, 65535, 25155, 65535, 65535, 10027, 23624, 10387, 20670, 36918, 65535, 11887, 31780, 27700, 65535, 
+      13536, 21556, 65535, 65535, 40908, 65535, 23025, 18921, 65535, 65535, 65535, 65535, 65535, 23033, 19129, 39333, 
+      65535, 65535, 65535, 38707, 65535, 19925, 65535, 65535, 20143, 27568, 65535, 35169, 65535, 65535, 65535, 65535, 
+      41410, 65535, 65535, 23446, 65535, 34129, 65535, 65535, 31875, 65535, 65535, 65535, 40658, 65535, 25104, 65535, 
+      65535, 40421, 36892, 33007, 65535, 65535, 65535, 29498, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 31368, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38282, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 29675, 65535, 65535, 39779, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35317, 
+      31749, 65535, 65535, 65535, 65535, 65535, 65535, 38288, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28891 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 34978, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 41169, 39027, 65535, 39004, 65535, 65535, 65535, 37479, 65535, 65535, 38893, 65535, 
+      65535, 65535, 40831, 65535, 65535, 38763, 65535, 65535, 65535, 65535, 38918, 33889, 34465, 34421, 65535, 40553, 
+      33514, 65535, 32598, 65535, 30893, 37873, 32204, 65535, 65535, 39494, 37752, 37899, 40090, 37252, 28013, 41019, 
+      25003, 27131, 23910, 33677, 37522, 31894, 39759, 65535, 24665, 40862, 19182, 18323, 19301, 35102, 65535, 41667, 
+      14256, 39613, 19604, 40253, 18433, 10335, 65535, 8964, 65535, 41328, 6359, 11832, 41321, 65535, 35104, 18603, 
+      17965, 20633, 11996, 65535, 2547, 41827, 5118, 17015, 36122, 22628, 40135, 19110, 20481, 65535, 20722, 39651, 
+      24040, 65535, 36082, 15350, 65535, 41233, 20014, 15032, 14137, 13828, 26620, 32276, 21090, 22597, 20176, 40200, 
+      20937, 18909, 38456, 65535, 31503, 34991, 21288, 23000, 39007, 65535, 65535, 41187, 65535, 24171, 30427, 32276, 
+      40935, 40663, 36110, 33377, 65535, 30926, 41922, 65535, 29273, 29693, 65535, 33374, 65535, 41644, 41016, 40939, 
+      38694, 39340, 65535, 33053, 65535, 36443, 65535, 65535, 36345, 65535, 65535, 65535, 41458, 65535, 35411, 65535, 
+      65535, 65535, 40865, 39027, 65535, 65535, 65535, 38156, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 40198, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 40733, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40887 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 37525, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 40773, 65535, 40659, 65535, 65535, 65535, 39274, 65535, 65535, 40052, 65535, 
+      65535, 65535, 41197, 65535, 65535, 39593, 65535, 65535, 65535, 65535, 39111, 35611, 35903, 35222, 65535, 39587, 
+      34299, 65535, 33069, 65535, 31760, 36864, 32490, 65535, 65535, 37995, 36407, 36444, 38282, 35638, 27936, 39019, 
+      26167, 26847, 24872, 32083, 35479, 30221, 37563, 41299, 26995, 38488, 18620, 17672, 21402, 32786, 65535, 39207, 
+      15857, 37170, 17875, 37785, 20751, 11195, 41092, 8181, 65535, 38801, 6828, 14190, 38785, 40025, 32567, 16101, 
+      20510, 23180, 14542, 2547, 65535, 39281, 4226, 19522, 33604, 20217, 37611, 21591, 18148, 39893, 18497, 37144, 
+      21745, 65535, 33619, 13710, 65535, 38736, 22394, 13848, 16009, 13315, 24594, 30026, 23369, 20964, 19106, 37820, 
+      22996, 19208, 36181, 41535, 29664, 32933, 21675, 24480, 36938, 65535, 65535, 39036, 65535, 25052, 32891, 31018, 
+      38918, 38670, 34596, 32514, 65535, 33347, 40033, 41165, 31431, 30592, 41295, 33328, 65535, 40324, 39825, 39872, 
+      38310, 38929, 65535, 35249, 65535, 37207, 65535, 65535, 37553, 65535, 65535, 65535, 41784, 65535, 37704, 65535, 
+      65535, 65535, 41879, 40493, 65535, 65535, 65535, 40138, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 19757, 37096, 65535, 65535, 65535, 65535, 34402, 65535, 65535, 28733, 65535, 65535, 26264, 
+      65535, 65535, 65535, 65535, 34544, 65535, 65535, 65535, 65535, 65535, 65535, 18365, 65535, 65535, 65535, 65535, 
+      22080, 24305, 65535, 65535, 65535, 65535, 36755, 65535, 65535, 39075, 65535, 65535, 65535, 65535, 65535, 36214, 
+      65535, 37257, 65535, 65535, 65535, 65535, 29814, 65535, 40018, 28479, 65535, 65535, 65535, 65535, 29258, 34374, 
+      65535, 19992, 65535, 22852, 65535, 33653, 65535, 15745, 19356, 27554, 29525, 28113, 23090, 25978, 65535, 19911, 
+      65535, 40666, 65535, 26525, 19288, 25805, 16086, 11463, 65535, 11552, 38231, 37676, 65535, 14420, 7741, 8461, 
+      65535, 9347, 29524, 8234, 65535, 65535, 5985, 38435, 5338, 4649, 65535, 65535, 3748, 2999, 7576, 23757, 
+      65535, 65535, 65535, 41827, 39281, 65535, 38818, 65535, 6527, 20407, 3202, 65535, 23002, 2874, 23725, 4529, 
+      20412, 4340, 8345, 31388, 4420, 4603, 65535, 34053, 65535, 37918, 21715, 15395, 65535, 27700, 33110, 9325, 
+      65535, 65535, 12448, 8747, 21926, 17588, 65535, 65535, 16628, 10636, 10639, 14936, 10044, 65535, 65535, 28875, 
+      17505, 17950, 25374, 33209, 11321, 65535, 19778, 18258, 65535, 65535, 20347, 41811, 13977, 27991, 29595, 31116, 
+      38794, 38562, 29475, 65535, 29578, 65535, 29178, 36981, 65535, 15043, 27408, 25941, 65535, 19384, 65535, 36576, 
+      24936, 65535, 65535, 65535, 33170, 20859, 20555, 65535, 28389, 23325, 28623, 65535, 26367, 28286, 65535, 28094, 
+      29514, 65535, 41957, 33206, 31069, 34262, 65535, 32431, 36570, 65535, 36777, 37567, 65535, 36317, 65535, 37518, 
+      40661, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 27376, 32089, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 38784, 65535, 34326, 65535, 27924, 34795, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 37993, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38968, 39582, 39325, 65535, 65535, 
+      38408, 65535, 37268, 65535, 35831, 40622, 36712, 65535, 65535, 41231, 39841, 39749, 41044, 38737, 32147, 41393, 
+      30063, 31019, 28887, 35242, 37795, 33287, 39457, 65535, 29145, 39745, 22731, 21754, 24180, 34348, 65535, 40007, 
+      19373, 38097, 21035, 38554, 23001, 15219, 41457, 12313, 65535, 39037, 10949, 16415, 38884, 39987, 32729, 17044, 
+      21388, 23936, 15538, 5118, 4226, 38818, 65535, 19567, 32716, 18774, 36758, 21377, 16392, 39007, 16339, 36109, 
+      19777, 65535, 32294, 10322, 41663, 37603, 21614, 9924, 13987, 9091, 21839, 27820, 22174, 17532, 15106, 36033, 
+      21165, 15159, 34014, 39833, 26523, 30205, 17656, 21504, 34218, 41348, 41347, 36500, 65535, 21362, 32344, 27171, 
+      36080, 35783, 30998, 28418, 65535, 32551, 36952, 38256, 29698, 26870, 38166, 29120, 65535, 36534, 35930, 35892, 
+      34090, 34712, 38708, 33567, 39722, 33339, 40722, 37835, 34078, 65535, 65535, 65535, 37663, 65535, 36303, 65535, 
+      65535, 39150, 38185, 37306, 65535, 65535, 65535, 37846, 65535, 65535, 65535, 41758, 65535, 65535, 65535, 65535, 
+      65535, 39901, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 33556, 65535, 65535, 65535, 65535, 34678, 65535, 32453, 65535, 65535, 32299, 65535, 30160, 65535, 65535, 
+      40002, 65535, 65535, 18438, 65535, 65535, 32864, 39353, 38280, 33697, 33777, 65535, 65535, 39965, 36322, 65535, 
+      65535, 65535, 65535, 65535, 35692, 31236, 65535, 31951, 65535, 65535, 65535, 29557, 65535, 65535, 35561, 65535, 
+      65535, 65535, 65535, 65535, 65535, 37711, 65535, 65535, 65535, 65535, 41919, 27284, 30017, 34491, 65535, 65535, 
+      33898, 65535, 35195, 65535, 31355, 65535, 36020, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34811, 65535, 
+      25115, 35204, 25732, 65535, 65535, 65535, 65535, 65535, 13839, 65535, 30226, 29910, 13832, 65535, 65535, 65535, 
+      16472, 65535, 34792, 65535, 10617, 19167, 65535, 23340, 65535, 65535, 19167, 9757, 65535, 65535, 65535, 35618, 
+      3952, 5217, 5835, 17015, 19522, 65535, 19567, 65535, 65535, 38198, 65535, 2266, 35697, 65535, 35318, 65535, 
+      38795, 65535, 65535, 28018, 65535, 65535, 4470, 25934, 9351, 22430, 39520, 65535, 6570, 33853, 29090, 65535, 
+      9049, 21141, 65535, 65535, 65535, 65535, 21959, 15469, 65535, 65535, 65535, 65535, 65535, 20545, 13493, 39675, 
+      65535, 65535, 65535, 38120, 65535, 14176, 65535, 65535, 14467, 24197, 65535, 33043, 65535, 65535, 65535, 65535, 
+      39332, 40021, 65535, 17647, 65535, 30271, 65535, 65535, 27301, 65535, 65535, 65535, 37079, 65535, 19273, 65535, 
+      65535, 36336, 32296, 27880, 65535, 65535, 65535, 23791, 65535, 65535, 65535, 38562, 65535, 65535, 65535, 65535, 
+      65535, 25618, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32631, 65535, 65535, 36404, 65535, 65535, 65535, 
+      65535, 23982, 65535, 40302, 33944, 65535, 65535, 65535, 65535, 37814, 65535, 65535, 36440, 41704, 65535, 29902, 
+      26525, 65535, 65535, 65535, 65535, 65535, 65535, 33089, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 24327 },
+    { 65535, 65535, 65535, 25997, 65535, 65535, 65535, 65535, 65535, 40884, 65535, 65535, 35243, 65535, 65535, 32783, 
+      65535, 65535, 65535, 65535, 40842, 65535, 65535, 65535, 65535, 65535, 65535, 24892, 65535, 65535, 65535, 65535, 
+      28422, 30353, 65535, 65535, 65535, 65535, 41093, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40069, 
+      65535, 40872, 65535, 65535, 65535, 65535, 34198, 65535, 65535, 32787, 65535, 65535, 65535, 65535, 32698, 36980, 
+      65535, 25036, 65535, 26960, 65535, 35682, 65535, 21363, 23937, 30150, 31641, 30298, 25981, 28041, 65535, 23180, 
+      65535, 40015, 65535, 27614, 21503, 26374, 19110, 16190, 65535, 15205, 35834, 35087, 65535, 15523, 13904, 12743, 
+      65535, 12534, 26757, 11819, 65535, 40430, 11559, 33961, 11737, 9297, 37246, 65535, 8568, 8829, 6557, 18986, 
+      65535, 65535, 65535, 36122, 33604, 6527, 32716, 65535, 65535, 14052, 4043, 65535, 16607, 6308, 17239, 3606, 
+      13895, 9367, 2813, 24888, 8997, 5278, 65535, 27530, 65535, 31393, 15385, 9524, 65535, 21289, 26683, 7129, 
+      65535, 36484, 8903, 9372, 16435, 12767, 37655, 65535, 13220, 11563, 11564, 12546, 12186, 65535, 65535, 23747, 
+      14792, 15105, 21012, 28286, 14406, 65535, 17253, 16317, 65535, 65535, 18197, 36770, 16013, 24913, 26296, 27742, 
+      34715, 34610, 26859, 65535, 27211, 65535, 27098, 33736, 65535, 18434, 26164, 25089, 65535, 20801, 65535, 34378, 
+      25020, 65535, 65535, 65535, 31872, 22581, 22386, 65535, 28272, 24478, 28548, 65535, 26906, 28561, 65535, 28566, 
+      29765, 65535, 40489, 33271, 31860, 34610, 65535, 33175, 36768, 65535, 37467, 38423, 65535, 37557, 65535, 38713, 
+      41517, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31582, 36013, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 39474, 65535, 33415, 40331, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 40049, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38535, 65535, 65535, 65535, 65535, 
+      41128, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41724, 65535, 65535, 40331, 65535, 65535, 65535, 65535, 38405, 40201, 
+      65535, 35072, 65535, 34933, 65535, 37903, 65535, 32860, 33258, 34575, 34800, 33866, 31813, 31834, 37886, 30294, 
+      65535, 35859, 40742, 29571, 27163, 27600, 26772, 27021, 65535, 24843, 28784, 27753, 41291, 21389, 26920, 23808, 
+      34865, 22446, 20686, 22423, 40944, 29073, 24178, 22834, 25221, 21661, 25128, 34406, 21265, 22086, 15714, 10008, 
+      40157, 65535, 34264, 22628, 20217, 20407, 18774, 38198, 14052, 65535, 18070, 39830, 2625, 20287, 3836, 17353, 
+      2818, 23348, 13532, 11257, 22915, 18830, 39566, 14144, 30941, 17959, 7922, 10370, 39570, 10632, 15065, 17611, 
+      37566, 24162, 16235, 21319, 13332, 14343, 25921, 34715, 17986, 23056, 23056, 19559, 24510, 31104, 65535, 19186, 
+      20146, 20058, 19830, 23301, 27051, 65535, 21936, 22447, 65535, 34927, 23261, 29930, 27508, 25896, 26382, 27280, 
+      30964, 31220, 28415, 65535, 29237, 38594, 29769, 32310, 65535, 30849, 30743, 30642, 38631, 30745, 65535, 35267, 
+      32210, 41590, 65535, 65535, 35156, 32626, 32602, 65535, 34494, 33429, 34792, 65535, 34493, 35412, 65535, 35754, 
+      36368, 65535, 41862, 38946, 39057, 40590, 65535, 40090, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 21993, 39460, 65535, 65535, 65535, 65535, 37006, 65535, 65535, 31430, 65535, 65535, 29010, 
+      65535, 65535, 65535, 65535, 37660, 65535, 65535, 65535, 65535, 65535, 65535, 21219, 65535, 65535, 65535, 65535, 
+      25194, 27495, 65535, 65535, 65535, 65535, 39764, 65535, 65535, 41986, 65535, 65535, 65535, 65535, 65535, 39102, 
+      65535, 40084, 65535, 65535, 65535, 65535, 32813, 65535, 65535, 31456, 65535, 65535, 65535, 65535, 31999, 36875, 
+      65535, 23102, 65535, 25753, 65535, 35949, 65535, 18931, 22361, 30010, 31825, 30427, 25614, 28231, 65535, 22534, 
+      65535, 41912, 65535, 28406, 21530, 27466, 18581, 14445, 65535, 14191, 38611, 37952, 65535, 16126, 10939, 11248, 
+      65535, 11752, 29651, 10754, 65535, 65535, 9110, 37626, 8493, 7416, 41049, 65535, 6522, 6122, 7924, 22692, 
+      65535, 65535, 65535, 40135, 37611, 3202, 36758, 65535, 4043, 18070, 65535, 65535, 20604, 2283, 21161, 1341, 
+      17759, 5327, 5261, 28768, 4984, 2135, 65535, 31333, 65535, 35180, 18673, 12241, 65535, 24696, 30109, 6435, 
+      65535, 39910, 9384, 6880, 18724, 14408, 40895, 65535, 13659, 9031, 9033, 12192, 9072, 65535, 65535, 25693, 
+      14719, 15134, 22283, 30054, 10971, 65535, 17076, 15714, 65535, 65535, 17766, 38653, 13071, 25205, 26759, 28269, 
+      35805, 35601, 26834, 65535, 27015, 65535, 26706, 34196, 65535, 14962, 25217, 23886, 65535, 18254, 65535, 34113, 
+      23255, 65535, 65535, 65535, 31005, 19906, 19654, 65535, 26657, 22117, 26911, 65535, 24904, 26723, 65535, 26617, 
+      27951, 65535, 39785, 31592, 29763, 32780, 65535, 31114, 35038, 65535, 35468, 36339, 65535, 35262, 65535, 36450, 
+      39454, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 27924, 32477, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 39747, 65535, 35557, 65535, 29416, 36332, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 31905, 65535, 65535, 65535, 65535, 33159, 65535, 30986, 65535, 65535, 30957, 65535, 28905, 65535, 65535, 
+      39029, 65535, 65535, 16790, 65535, 65535, 32099, 38840, 37753, 33112, 33346, 65535, 65535, 39932, 36152, 65535, 
+      65535, 65535, 65535, 65535, 36087, 31395, 65535, 32209, 65535, 65535, 65535, 29745, 65535, 65535, 36269, 65535, 
+      65535, 65535, 65535, 65535, 65535, 38665, 65535, 65535, 65535, 65535, 65535, 27764, 30732, 35670, 65535, 65535, 
+      35129, 65535, 36644, 65535, 32664, 65535, 37578, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36668, 65535, 
+      26577, 37156, 27351, 65535, 65535, 65535, 65535, 65535, 14209, 65535, 32408, 32115, 15210, 65535, 65535, 65535, 
+      18476, 65535, 37057, 65535, 11949, 21394, 65535, 25601, 65535, 65535, 21429, 11908, 65535, 65535, 65535, 37691, 
+      5044, 5114, 8099, 19110, 21591, 65535, 21377, 2266, 65535, 39830, 65535, 65535, 37287, 65535, 36805, 65535, 
+      40264, 65535, 65535, 29361, 65535, 65535, 2715, 27113, 9937, 23474, 40656, 65535, 4891, 34850, 29895, 65535, 
+      7853, 21411, 65535, 65535, 65535, 65535, 21951, 14573, 65535, 65535, 65535, 65535, 65535, 19965, 11326, 39950, 
+      65535, 65535, 65535, 38050, 65535, 11945, 65535, 65535, 12325, 23153, 65535, 32417, 65535, 65535, 65535, 65535, 
+      38655, 39332, 65535, 15415, 65535, 28940, 65535, 65535, 25670, 65535, 65535, 65535, 35809, 65535, 17007, 65535, 
+      65535, 34859, 30623, 25983, 65535, 65535, 65535, 21610, 65535, 65535, 65535, 36995, 65535, 65535, 40913, 65535, 
+      65535, 23410, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 30469, 65535, 65535, 34245, 65535, 65535, 65535, 
+      65535, 21766, 65535, 38108, 31680, 65535, 65535, 65535, 65535, 35549, 65535, 65535, 34192, 39441, 65535, 27793, 
+      24505, 65535, 65535, 65535, 65535, 65535, 65535, 31059, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 22610 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41158, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40187, 41548, 
+      65535, 37457, 65535, 37085, 65535, 39135, 65535, 35392, 35586, 36243, 36265, 35419, 33743, 33472, 37893, 32417, 
+      41737, 35944, 39849, 30986, 29176, 28959, 29021, 29542, 65535, 27301, 28443, 27378, 39441, 23584, 29543, 26368, 
+      33251, 24953, 20908, 24971, 38894, 27595, 26796, 21567, 27843, 24279, 23483, 32309, 23889, 24710, 18294, 10326, 
+      37772, 40291, 31925, 20481, 18148, 23002, 16392, 35697, 16607, 2625, 20604, 37287, 65535, 22798, 1757, 19837, 
+      3647, 25851, 15924, 8651, 25399, 21271, 36972, 11563, 28326, 15358, 7907, 11954, 36953, 8981, 12878, 19732, 
+      34942, 21694, 18052, 23501, 13559, 15432, 23536, 32172, 19286, 25132, 25132, 21111, 26686, 28718, 65535, 18541, 
+      21399, 21249, 19878, 22348, 29248, 65535, 22974, 23707, 65535, 32735, 24297, 28381, 29494, 26046, 26334, 27086, 
+      29986, 30305, 28571, 65535, 29452, 36750, 30088, 31744, 40177, 32957, 31391, 31479, 37303, 32390, 65535, 35056, 
+      33307, 40145, 65535, 65535, 35415, 34251, 34260, 65535, 35343, 34829, 35637, 65535, 35605, 36358, 41852, 36756, 
+      37240, 65535, 41557, 39568, 39981, 41230, 65535, 40933, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 19823, 37298, 65535, 65535, 65535, 65535, 34951, 65535, 65535, 29442, 65535, 65535, 27063, 
+      65535, 65535, 65535, 65535, 36132, 65535, 65535, 65535, 65535, 65535, 65535, 19391, 65535, 65535, 65535, 65535, 
+      23702, 26255, 65535, 65535, 65535, 65535, 39396, 65535, 65535, 41796, 65535, 65535, 65535, 65535, 65535, 38953, 
+      65535, 40030, 65535, 65535, 65535, 65535, 32475, 65535, 65535, 31164, 65535, 65535, 65535, 65535, 32075, 37239, 
+      65535, 22537, 65535, 25604, 65535, 36526, 65535, 18098, 22037, 30425, 32398, 30985, 25957, 28848, 65535, 22767, 
+      65535, 65535, 65535, 29339, 22154, 28561, 18958, 14197, 65535, 14415, 40441, 39824, 65535, 17164, 9913, 11305, 
+      65535, 12217, 31567, 11108, 65535, 65535, 8621, 39826, 7331, 7516, 65535, 65535, 6618, 5726, 9619, 24921, 
+      65535, 65535, 65535, 65535, 39893, 2874, 39007, 65535, 6308, 20287, 2283, 65535, 22798, 65535, 23294, 3007, 
+      19862, 3065, 7143, 30857, 2701, 2121, 65535, 33361, 65535, 37188, 20441, 13826, 65535, 26490, 31888, 6765, 
+      65535, 41654, 10029, 5876, 19957, 15401, 65535, 65535, 14041, 7807, 7809, 12194, 7404, 65535, 65535, 26640, 
+      14773, 15232, 22901, 30854, 9013, 65535, 16995, 15428, 65535, 65535, 17521, 39445, 11403, 25228, 26856, 28382, 
+      36158, 35899, 26653, 65535, 26736, 65535, 26320, 34205, 65535, 12932, 24535, 23076, 65535, 16743, 65535, 33713, 
+      22133, 65535, 65535, 65535, 30299, 18297, 18015, 65535, 25579, 20665, 25817, 65535, 23626, 25519, 65535, 25351, 
+      26748, 65535, 39088, 30430, 28388, 31526, 65535, 29748, 33822, 65535, 34104, 34925, 65535, 33744, 65535, 34941, 
+      38031, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 25752, 30352, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 37510, 65535, 33286, 65535, 27133, 34049, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41905, 65535, 
+      65535, 38906, 65535, 38685, 65535, 40891, 65535, 36664, 37081, 37978, 38018, 37166, 35424, 35210, 39416, 34029, 
+      65535, 37495, 40974, 32741, 30828, 30715, 30567, 30835, 65535, 28678, 29864, 28788, 39892, 25157, 30528, 27594, 
+      33928, 26268, 22532, 26221, 39149, 28401, 27827, 22552, 28711, 25316, 24185, 32540, 24872, 25607, 19483, 12017, 
+      37601, 40057, 31847, 20722, 18497, 23725, 16339, 35318, 17239, 3836, 21161, 36805, 1757, 23294, 65535, 20299, 
+      3481, 26316, 16266, 7672, 25830, 21648, 36327, 10452, 27588, 14306, 6654, 11555, 36180, 7225, 11275, 19701, 
+      34021, 20337, 17742, 23508, 12284, 14614, 22085, 30929, 18561, 25012, 25012, 20553, 26669, 27268, 65535, 16900, 
+      20623, 20433, 18465, 20633, 29240, 65535, 22045, 22917, 41745, 31148, 23359, 26628, 29258, 24646, 24855, 25553, 
+      28259, 28587, 27163, 65535, 28066, 35040, 28745, 30094, 38540, 32832, 30199, 30386, 35546, 31835, 65535, 33500, 
+      32359, 38390, 40406, 65535, 34029, 33671, 33706, 65535, 34242, 34077, 34533, 40387, 34657, 35309, 40120, 35739, 
+      36146, 65535, 39960, 38335, 38906, 40002, 65535, 39809, 41289, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 22815, 40289, 65535, 65535, 65535, 65535, 37957, 65535, 65535, 32437, 65535, 65535, 30046, 
+      65535, 65535, 65535, 65535, 38895, 65535, 65535, 65535, 65535, 65535, 65535, 22324, 65535, 65535, 65535, 65535, 
+      26433, 28793, 65535, 65535, 65535, 65535, 41087, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40397, 
+      65535, 41362, 65535, 65535, 65535, 65535, 34135, 65535, 65535, 32773, 65535, 65535, 65535, 65535, 33260, 38063, 
+      65535, 24442, 65535, 27057, 65535, 37072, 65535, 20268, 23687, 31192, 32956, 31566, 26822, 29355, 65535, 23774, 
+      65535, 65535, 65535, 29409, 22665, 28397, 19795, 15770, 65535, 15452, 39024, 38325, 65535, 17126, 12252, 12546, 
+      65535, 12969, 29999, 12002, 65535, 65535, 10451, 37546, 9777, 8726, 40852, 65535, 7839, 7463, 8628, 22573, 
+      65535, 65535, 65535, 39651, 37144, 4529, 36109, 65535, 3606, 17353, 1341, 65535, 19837, 3007, 20299, 65535, 
+      16861, 6021, 4149, 27851, 5563, 1683, 65535, 30356, 65535, 34186, 17517, 10999, 65535, 23557, 28965, 5203, 
+      65535, 38752, 8063, 6191, 17408, 13069, 39686, 65535, 12362, 8394, 8395, 10984, 8733, 65535, 65535, 24354, 
+      13485, 13888, 20949, 28713, 10850, 65535, 15867, 14570, 65535, 65535, 16601, 37312, 12661, 23954, 25491, 26995, 
+      34489, 34293, 25629, 65535, 25837, 65535, 25560, 32938, 65535, 14877, 24179, 22904, 65535, 17685, 65535, 32959, 
+      22426, 65535, 65535, 65535, 29962, 19397, 19169, 65535, 25793, 21486, 26053, 65535, 24154, 25925, 65535, 25854, 
+      27149, 65535, 38724, 30757, 29056, 31993, 65535, 30398, 34225, 65535, 34740, 35641, 65535, 34635, 65535, 35814, 
+      38754, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 27990, 32454, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 39940, 65535, 35882, 65535, 29879, 36790, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 39670, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38762, 65535, 65535, 65535, 65535, 
+      41874, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40681, 65535, 
+      65535, 36555, 65535, 36820, 65535, 40528, 65535, 33944, 34867, 36956, 37314, 36330, 33979, 34248, 40687, 32245, 
+      65535, 38667, 65535, 32130, 29266, 30193, 28561, 28185, 65535, 26219, 31512, 30470, 65535, 23303, 27425, 24843, 
+      36894, 23695, 23498, 23524, 65535, 31217, 24791, 25128, 25497, 22300, 27126, 35872, 21794, 22433, 16744, 12814, 
+      41075, 65535, 35302, 24040, 21745, 20412, 19777, 38795, 13895, 2818, 17759, 40264, 3647, 19862, 3481, 16861, 
+      65535, 22870, 12801, 11009, 22374, 18184, 39733, 13644, 30962, 17511, 5113, 8311, 39520, 8603, 13547, 16257, 
+      37257, 23081, 14437, 20057, 10531, 11872, 24616, 33798, 15673, 21607, 21606, 17465, 23227, 29757, 65535, 16434, 
+      17801, 17668, 17019, 20631, 25796, 65535, 19451, 20109, 65535, 33198, 20778, 27553, 25915, 23102, 23568, 24462, 
+      28281, 28515, 25623, 65535, 26456, 36424, 27009, 29520, 40333, 29434, 28084, 28063, 36085, 28744, 65535, 32448, 
+      29774, 39102, 41674, 65535, 32388, 30605, 30613, 65535, 31926, 31208, 32222, 40877, 32068, 32893, 40107, 33266, 
+      33813, 65535, 39044, 36286, 36530, 37938, 65535, 37524, 39417, 65535, 40975, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 16800, 34270, 65535, 65535, 65535, 65535, 32011, 65535, 65535, 26575, 65535, 65535, 24243, 
+      65535, 65535, 65535, 65535, 33750, 65535, 65535, 65535, 65535, 65535, 65535, 16746, 65535, 65535, 65535, 65535, 
+      21447, 24297, 65535, 65535, 65535, 65535, 38430, 65535, 65535, 41038, 65535, 65535, 65535, 65535, 65535, 38277, 
+      65535, 39468, 65535, 65535, 65535, 65535, 31620, 65535, 65535, 30386, 65535, 65535, 65535, 65535, 31774, 37267, 
+      65535, 21523, 65535, 25094, 65535, 36853, 65535, 16814, 21356, 30601, 32764, 31349, 26100, 29318, 65535, 22818, 
+      65535, 65535, 65535, 30236, 22742, 29692, 19288, 13852, 65535, 14691, 65535, 65535, 65535, 18407, 8705, 11525, 
+      65535, 12911, 33864, 11725, 65535, 65535, 8331, 65535, 6179, 8151, 65535, 65535, 7382, 6040, 11897, 27776, 
+      65535, 65535, 65535, 65535, 65535, 4340, 65535, 65535, 9367, 23348, 5327, 65535, 25851, 3065, 26316, 6021, 
+      22870, 65535, 10091, 33845, 660, 4756, 65535, 36301, 65535, 40108, 23197, 16483, 65535, 29245, 34612, 8632, 
+      65535, 65535, 11954, 6303, 22218, 17493, 65535, 65535, 15522, 7564, 7567, 13311, 6368, 65535, 65535, 28525, 
+      15845, 16342, 24457, 32529, 7147, 65535, 17830, 16048, 65535, 65535, 18129, 41039, 10040, 26021, 27720, 29246, 
+      37238, 36912, 27160, 65535, 27110, 65535, 26556, 34865, 65535, 10732, 24391, 22775, 65535, 15474, 65535, 33833, 
+      21381, 65535, 65535, 65535, 30037, 16819, 16489, 65535, 24836, 19412, 25048, 65535, 22605, 24584, 65535, 24323, 
+      25798, 65535, 38740, 29498, 27150, 30442, 65535, 28509, 32770, 65535, 32823, 33560, 65535, 32224, 65535, 33427, 
+      36627, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 23095, 27782, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 34669, 65535, 30348, 65535, 24119, 31033, 65535, 65535, 39786, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 26880, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36584, 65535, 65535, 34195, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 26459, 65535, 65535, 65535, 65535, 
+      30421, 32598, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 36943, 65535, 65535, 35538, 65535, 65535, 65535, 65535, 35507, 39778, 
+      65535, 27643, 65535, 29720, 65535, 38443, 65535, 23789, 26628, 32955, 34418, 33083, 28794, 30823, 65535, 25986, 
+      65535, 65535, 65535, 30307, 24307, 29004, 21917, 18811, 65535, 17959, 37619, 36810, 65535, 18293, 16037, 15398, 
+      65535, 15303, 28529, 14546, 65535, 41301, 13913, 34824, 13683, 11807, 37835, 65535, 11012, 11029, 9321, 19948, 
+      65535, 65535, 65535, 36082, 33619, 8345, 32294, 65535, 2813, 13532, 5261, 65535, 15924, 7143, 16266, 4149, 
+      12801, 10091, 65535, 23755, 9579, 5383, 65535, 26224, 65535, 30046, 13413, 7081, 65535, 19438, 24849, 5083, 
+      65535, 34650, 6217, 8179, 13837, 9986, 35650, 65535, 10467, 10222, 10223, 10002, 11288, 40439, 65535, 21067, 
+      12127, 12412, 18213, 25574, 13736, 65535, 14587, 13782, 65535, 65535, 15588, 34099, 14797, 22130, 23496, 24936, 
+      31915, 31805, 24114, 65535, 24494, 65535, 24421, 30930, 65535, 17687, 23646, 22670, 40375, 19157, 65535, 31654, 
+      22846, 65535, 65535, 65535, 29297, 21000, 20851, 65535, 25997, 22649, 26280, 65535, 24837, 26389, 65535, 26452, 
+      27572, 65535, 37840, 30989, 29796, 32390, 65535, 31082, 34486, 65535, 35312, 36305, 65535, 35565, 65535, 36694, 
+      39370, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 30898, 35115, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 39240, 65535, 33505, 40372, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41686, 41028, 40023, 39483, 40186, 
+      39788, 37896, 38349, 37036, 36745, 34943, 37108, 38120, 39201, 35789, 29570, 28481, 34491, 31627, 38159, 34995, 
+      29525, 33521, 24411, 33587, 33169, 24789, 35431, 20180, 36379, 32915, 20370, 26644, 32501, 33268, 26940, 15641, 
+      30634, 32950, 25155, 15350, 13710, 31388, 10322, 28018, 24888, 11257, 28768, 29361, 8651, 30857, 7672, 27851, 
+      11009, 33845, 23755, 65535, 33332, 29126, 28732, 2985, 19953, 6708, 11763, 18196, 28521, 7263, 6641, 26696, 
+      26357, 13383, 24283, 30501, 16203, 20038, 15481, 23599, 24025, 31755, 31754, 26408, 33573, 20582, 39042, 17505, 
+      25822, 25507, 20887, 19715, 36127, 38776, 26632, 27966, 34192, 25142, 27843, 23122, 35678, 26689, 26314, 26522, 
+      26578, 27085, 29011, 37842, 30011, 30150, 30934, 29580, 32782, 39437, 33199, 33880, 32322, 37346, 41004, 33830, 
+      36433, 34677, 35541, 36864, 35690, 39058, 39176, 40195, 37540, 38863, 37804, 37030, 38650, 38815, 37811, 39377, 
+      39404, 65535, 39625, 40770, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 17302, 34761, 65535, 65535, 65535, 65535, 32557, 65535, 65535, 27150, 65535, 65535, 24832, 
+      65535, 65535, 65535, 65535, 34397, 65535, 65535, 65535, 65535, 65535, 65535, 17373, 65535, 65535, 65535, 65535, 
+      22103, 24957, 65535, 65535, 65535, 65535, 39047, 65535, 65535, 41637, 65535, 65535, 65535, 65535, 65535, 38867, 
+      65535, 40047, 65535, 65535, 65535, 65535, 32224, 65535, 65535, 30981, 65535, 65535, 65535, 65535, 32319, 37772, 
+      65535, 22134, 65535, 25658, 65535, 37314, 65535, 17443, 21934, 31080, 33216, 31800, 26579, 29750, 65535, 23306, 
+      65535, 65535, 65535, 30594, 23146, 30004, 19728, 14377, 65535, 15128, 65535, 65535, 65535, 18678, 9310, 11958, 
+      65535, 13271, 33888, 12092, 65535, 65535, 8821, 65535, 6763, 8487, 65535, 65535, 7685, 6403, 11894, 27574, 
+      65535, 65535, 65535, 65535, 65535, 4420, 41663, 65535, 8997, 22915, 4984, 65535, 25399, 2701, 25830, 5563, 
+      22374, 660, 9579, 33332, 65535, 4210, 65535, 35762, 65535, 39559, 22609, 15881, 65535, 28653, 34013, 7977, 
+      65535, 65535, 11298, 5674, 21570, 16839, 65535, 65535, 14865, 7013, 7016, 12665, 5930, 65535, 65535, 27865, 
+      15204, 15700, 23800, 31871, 6918, 65535, 17206, 15439, 65535, 65535, 17524, 40384, 9704, 25408, 27102, 28628, 
+      36608, 36286, 26573, 65535, 26537, 65535, 25998, 34268, 65535, 10630, 23879, 22283, 65535, 15140, 65535, 33295, 
+      20960, 65535, 65535, 65535, 29548, 16535, 16216, 65535, 24418, 19084, 24636, 65535, 22235, 24201, 65535, 23958, 
+      25419, 65535, 38271, 29120, 26830, 30094, 65535, 28191, 32419, 65535, 32519, 33274, 65535, 31972, 65535, 33175, 
+      36353, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 23188, 27841, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 34857, 65535, 30597, 65535, 24432, 31349, 65535, 65535, 40099, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 21506, 38955, 65535, 65535, 65535, 65535, 36763, 65535, 65535, 31329, 65535, 65535, 28985, 
+      65535, 65535, 65535, 65535, 38225, 65535, 65535, 65535, 65535, 65535, 65535, 21401, 65535, 65535, 65535, 65535, 
+      25808, 28376, 65535, 65535, 65535, 65535, 41347, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40814, 
+      65535, 41848, 65535, 65535, 65535, 65535, 34409, 65535, 65535, 33079, 65535, 65535, 65535, 65535, 33822, 38827, 
+      65535, 24539, 65535, 27452, 65535, 37973, 65535, 20165, 23954, 31975, 33844, 32441, 27546, 30261, 65535, 24417, 
+      65535, 65535, 65535, 30511, 23555, 29591, 20516, 16065, 65535, 16051, 40615, 39932, 65535, 18239, 12002, 13018, 
+      65535, 13700, 31613, 12654, 65535, 65535, 10556, 39228, 9433, 9176, 65535, 65535, 8268, 7591, 10032, 24255, 
+      65535, 65535, 65535, 41233, 38736, 4603, 37603, 65535, 5278, 18830, 2135, 65535, 21271, 2121, 21648, 1683, 
+      18184, 4756, 5383, 29126, 4210, 65535, 65535, 31553, 65535, 35354, 18464, 11790, 65535, 24515, 29898, 4737, 
+      65535, 39637, 7945, 4748, 17839, 13283, 40447, 65535, 12043, 6911, 6912, 10346, 7091, 65535, 65535, 24531, 
+      12910, 13351, 20850, 28769, 9169, 65535, 15206, 13751, 65535, 65535, 15826, 37366, 11053, 23402, 24997, 26517, 
+      34202, 33963, 24935, 65535, 25075, 65535, 24725, 32396, 65535, 13195, 23145, 21785, 65535, 16165, 65535, 32134, 
+      21121, 65535, 65535, 65535, 28931, 17842, 17602, 65535, 24525, 20009, 24778, 65535, 22772, 24588, 65535, 24484, 
+      25816, 65535, 37719, 29457, 27639, 30646, 65535, 28988, 32903, 65535, 33340, 34217, 65535, 33159, 65535, 34344, 
+      37332, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 26309, 30771, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 38272, 65535, 34247, 65535, 28302, 35204, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 32271, 65535, 65535, 65535, 65535, 33735, 65535, 31661, 65535, 65535, 31817, 65535, 29902, 65535, 65535, 
+      40302, 65535, 65535, 17356, 65535, 65535, 33647, 40595, 39501, 34833, 35207, 65535, 65535, 65535, 38213, 65535, 
+      65535, 65535, 65535, 65535, 38519, 33706, 65535, 34576, 65535, 65535, 65535, 32081, 65535, 65535, 38845, 65535, 
+      65535, 65535, 65535, 65535, 65535, 41321, 65535, 65535, 65535, 65535, 65535, 30261, 33320, 38372, 65535, 65535, 
+      37838, 65535, 39356, 65535, 35378, 65535, 40276, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39253, 65535, 
+      29285, 39672, 30032, 65535, 65535, 65535, 65535, 65535, 16724, 65535, 34591, 34232, 17921, 65535, 65535, 65535, 
+      20942, 65535, 38677, 65535, 14661, 23455, 65535, 27187, 65535, 65535, 23056, 14192, 65535, 65535, 65535, 38375, 
+      7756, 7623, 10027, 20014, 22394, 65535, 21614, 4470, 65535, 39566, 65535, 2715, 36972, 65535, 36327, 65535, 
+      39733, 65535, 65535, 28732, 65535, 65535, 65535, 26282, 8822, 22514, 39654, 65535, 2181, 33718, 28579, 65535, 
+      5231, 19633, 65535, 65535, 65535, 65535, 19921, 12016, 65535, 65535, 65535, 65535, 65535, 17543, 10735, 38040, 
+      65535, 65535, 65535, 35875, 65535, 10990, 65535, 65535, 10116, 20503, 65535, 29919, 65535, 65535, 65535, 65535, 
+      36118, 36788, 65535, 13508, 65535, 26228, 65535, 40470, 22980, 65535, 65535, 65535, 33102, 65535, 15489, 65535, 
+      65535, 32147, 27946, 23418, 65535, 65535, 65535, 19472, 65535, 65535, 65535, 34295, 65535, 65535, 38202, 65535, 
+      65535, 21354, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28263, 65535, 65535, 32030, 65535, 40060, 65535, 
+      65535, 20736, 65535, 35980, 29993, 65535, 65535, 65535, 65535, 33985, 65535, 65535, 32869, 37917, 40929, 27148, 
+      24158, 65535, 65535, 65535, 65535, 65535, 65535, 30626, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 22954 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40858, 65535, 
+      39966, 39412, 38719, 39660, 39658, 37569, 40081, 41079, 37830, 38766, 31010, 29941, 33621, 34600, 40979, 37930, 
+      29271, 36483, 26616, 36529, 31990, 25038, 38277, 21126, 39127, 35765, 20671, 25628, 35324, 36040, 29854, 18393, 
+      28817, 30999, 23624, 15032, 13848, 34053, 9924, 25934, 27530, 14144, 31333, 27113, 11563, 33361, 10452, 30356, 
+      13644, 36301, 26224, 2985, 35762, 31553, 26282, 65535, 17460, 3867, 13585, 20265, 25924, 8157, 5276, 28809, 
+      23614, 10416, 26185, 32574, 17299, 21544, 12567, 20632, 25437, 33666, 33665, 27945, 35564, 17632, 36394, 17247, 
+      27075, 26714, 21169, 18736, 38084, 36055, 27601, 29105, 31306, 22301, 28739, 21053, 37365, 26612, 26017, 26026, 
+      25078, 25637, 28789, 34922, 29803, 27548, 30799, 28435, 29957, 41190, 33342, 34217, 30185, 38538, 38100, 32904, 
+      36970, 32360, 32904, 33986, 35236, 40163, 40320, 37210, 37720, 39681, 37966, 34792, 39110, 39059, 35887, 39668, 
+      39531, 39096, 38341, 40525, 65535, 65535, 40813, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 41023, 65535, 65535, 65535, 65535, 65535, 65535, 40482, 65535, 65535, 40628, 65535, 38677, 65535, 65535, 
+      65535, 65535, 65535, 26177, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 40423, 65535, 41053, 65535, 65535, 65535, 38731, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36196, 38557, 41903, 65535, 65535, 
+      41173, 65535, 41699, 65535, 38474, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39392, 65535, 
+      31976, 39139, 31975, 65535, 65535, 65535, 65535, 65535, 23019, 65535, 32216, 31547, 21572, 65535, 65535, 65535, 
+      21426, 65535, 33740, 65535, 18720, 21363, 65535, 22798, 65535, 65535, 19192, 14701, 65535, 65535, 65535, 31022, 
+      13058, 14547, 10387, 14137, 16009, 65535, 13987, 9351, 65535, 30941, 65535, 9937, 28326, 65535, 27588, 65535, 
+      30962, 65535, 65535, 19953, 65535, 65535, 8822, 17460, 65535, 13697, 30862, 37622, 8632, 24973, 19960, 65535, 
+      7177, 11831, 65535, 65535, 33527, 38225, 12889, 9394, 41798, 65535, 65535, 65535, 65535, 12700, 19166, 30330, 
+      65535, 65535, 35160, 28960, 65535, 19067, 65535, 65535, 15711, 17546, 65535, 24795, 65535, 38673, 37349, 36570, 
+      31057, 31760, 39970, 19580, 40877, 24316, 65535, 35500, 22966, 65535, 65535, 65535, 30551, 65535, 22354, 40167, 
+      65535, 30676, 27828, 25126, 65535, 65535, 65535, 24134, 65535, 65535, 65535, 33205, 65535, 65535, 36485, 65535, 
+      65535, 26190, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31972, 65535, 65535, 35472, 65535, 41629, 65535, 
+      65535, 28247, 65535, 39634, 35605, 65535, 65535, 65535, 65535, 39793, 65535, 65535, 39362, 65535, 65535, 35064, 
+      32476, 65535, 65535, 65535, 65535, 65535, 65535, 38753, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31727 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 39861, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41177, 65535, 
+      38705, 39960, 37717, 65535, 65535, 40004, 65535, 65535, 34883, 65535, 31589, 30569, 31236, 38018, 65535, 41696, 
+      27666, 40193, 28430, 40282, 29294, 24155, 65535, 21277, 65535, 39606, 19993, 23203, 39177, 39904, 33647, 21286, 
+      25525, 27574, 20670, 13828, 13315, 37918, 9091, 22430, 31393, 17959, 35180, 23474, 15358, 37188, 14306, 34186, 
+      17511, 40108, 30046, 6708, 39559, 35354, 22514, 3867, 13697, 65535, 17188, 23934, 22088, 11424, 7050, 32463, 
+      19747, 7353, 29725, 36192, 20371, 24854, 9767, 16965, 28635, 37176, 37174, 31216, 39118, 14524, 32537, 19054, 
+      30129, 29732, 23425, 19607, 41606, 32188, 30400, 32039, 27485, 19583, 31457, 20140, 40690, 28363, 27526, 27296, 
+      25000, 25625, 30331, 31137, 31340, 25404, 32406, 28798, 27209, 65535, 35224, 36298, 28940, 41429, 34296, 33479, 
+      39229, 30747, 30612, 31044, 36382, 65535, 65535, 33697, 39578, 65535, 39802, 33292, 41260, 40971, 34920, 41626, 
+      41304, 35630, 38323, 41846, 65535, 65535, 40272, 65535, 65535, 39138, 65535, 65535, 41717, 65535, 65535, 65535, 
+      65535, 40427, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 39628, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39831, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 39797, 65535, 40698, 65535, 65535, 65535, 36588, 38336, 41569, 65535, 41060, 38303, 38919, 65535, 36273, 
+      65535, 65535, 65535, 37000, 33544, 35111, 32399, 31085, 65535, 29489, 36340, 35278, 65535, 27401, 29284, 27630, 
+      40305, 26840, 28553, 26453, 65535, 34923, 26912, 29185, 27038, 24556, 30634, 38253, 23895, 24211, 19829, 17864, 
+      65535, 65535, 36918, 26620, 24594, 21715, 21839, 39520, 15385, 7922, 18673, 40656, 7907, 20441, 6654, 17517, 
+      5113, 23197, 13413, 11763, 22609, 18464, 39654, 13585, 30862, 17188, 65535, 6773, 39052, 6051, 11449, 15277, 
+      36382, 21239, 12604, 19009, 5655, 8375, 22282, 31915, 12392, 20088, 20087, 14676, 21979, 27188, 65535, 11383, 
+      14327, 14076, 12014, 15707, 24501, 65535, 15530, 16572, 65535, 29855, 16827, 23110, 23918, 18160, 18528, 19377, 
+      23308, 23509, 20686, 65535, 21556, 32260, 22181, 24412, 36545, 27694, 23548, 23742, 31300, 25781, 65535, 27368, 
+      25791, 34396, 37345, 40890, 27516, 27558, 27638, 65535, 27594, 27704, 27884, 36038, 28084, 28676, 35080, 29119, 
+      29499, 65535, 33949, 31696, 32262, 33362, 37813, 33157, 34696, 65535, 36359, 37488, 65535, 37681, 65535, 38491, 
+      39948, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39691, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 32858, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40706, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33191, 65535, 65535, 65535, 65535, 
+      37430, 39678, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41581, 65535, 
+      65535, 34553, 65535, 36254, 65535, 65535, 65535, 30840, 33393, 38574, 39659, 38425, 34728, 36174, 65535, 32204, 
+      65535, 65535, 65535, 34996, 30040, 33378, 28155, 25707, 65535, 24574, 38478, 37508, 65535, 23816, 23112, 22252, 
+      65535, 21881, 29768, 21265, 65535, 39423, 20977, 33204, 20726, 18802, 35401, 65535, 18040, 18110, 15208, 19576, 
+      65535, 65535, 65535, 32276, 30026, 15395, 27820, 65535, 9524, 10370, 12241, 65535, 11954, 13826, 11555, 10999, 
+      8311, 16483, 7081, 18196, 15881, 11790, 65535, 20265, 37622, 23934, 6773, 65535, 65535, 12786, 18132, 8543, 
+      65535, 27848, 6196, 12322, 6978, 4629, 28696, 38406, 7707, 13587, 13586, 9200, 15378, 33402, 65535, 14381, 
+      9879, 9854, 12416, 18976, 17934, 65535, 11888, 12153, 65535, 35419, 13185, 27336, 17719, 17555, 18561, 19825, 
+      25863, 25862, 19906, 65535, 20539, 36695, 20803, 25652, 41437, 21356, 21093, 20707, 34311, 20449, 65535, 27371, 
+      21975, 37553, 41328, 65535, 26132, 22318, 22316, 65535, 24491, 23059, 24790, 38701, 24234, 25291, 36840, 25576, 
+      26317, 65535, 33933, 29189, 28929, 30782, 38204, 30038, 32538, 65535, 33839, 34936, 65535, 34685, 65535, 35672, 
+      37766, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33935, 37463, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38044, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 32473, 65535, 65535, 65535, 65535, 34094, 65535, 32116, 65535, 65535, 32419, 65535, 30629, 65535, 65535, 
+      41186, 65535, 65535, 17889, 65535, 65535, 34795, 41881, 40785, 36116, 36603, 65535, 65535, 65535, 39767, 65535, 
+      65535, 65535, 65535, 65535, 40396, 35487, 65535, 36403, 65535, 65535, 65535, 33886, 65535, 65535, 40856, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32210, 35348, 40520, 65535, 65535, 
+      39995, 65535, 41535, 65535, 37547, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41381, 65535, 
+      31466, 41757, 32208, 65535, 65535, 65535, 65535, 65535, 18717, 65535, 36467, 36064, 20101, 65535, 65535, 65535, 
+      23017, 65535, 40145, 65535, 16840, 25284, 65535, 28681, 65535, 65535, 24603, 16191, 65535, 65535, 65535, 39139, 
+      9935, 9668, 11887, 21090, 23369, 65535, 22174, 6570, 65535, 39570, 65535, 4891, 36953, 65535, 36180, 65535, 
+      39520, 65535, 65535, 28521, 65535, 65535, 2181, 25924, 8632, 22088, 39052, 65535, 65535, 33044, 27783, 65535, 
+      3338, 18498, 65535, 65535, 41058, 65535, 18534, 10104, 65535, 65535, 65535, 65535, 65535, 15758, 10539, 36666, 
+      65535, 65535, 41518, 34268, 65535, 10466, 65535, 65535, 8415, 18439, 65535, 28011, 65535, 65535, 65535, 41133, 
+      34162, 34824, 65535, 12034, 65535, 24068, 65535, 38480, 20803, 65535, 65535, 65535, 30948, 65535, 14335, 65535, 
+      65535, 29968, 25774, 21319, 65535, 65535, 65535, 17729, 65535, 65535, 65535, 32115, 65535, 65535, 36023, 65535, 
+      65535, 19668, 65535, 65535, 65535, 65535, 41742, 65535, 65535, 26428, 65535, 65535, 30178, 65535, 38024, 65535, 
+      65535, 19921, 65535, 34184, 28562, 65535, 65535, 65535, 65535, 32630, 65535, 65535, 31712, 36576, 39680, 26580, 
+      23861, 65535, 65535, 65535, 65535, 65535, 65535, 30198, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 23228 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40822, 
+      65535, 65535, 65535, 39966, 37769, 37940, 37163, 36571, 65535, 34734, 35725, 34629, 41621, 31883, 35184, 33163, 
+      36788, 32161, 29238, 31904, 40112, 31978, 32724, 27030, 33003, 30308, 27562, 33685, 29697, 30109, 25152, 19033, 
+      36896, 38993, 31780, 22597, 20964, 27700, 17532, 33853, 21289, 10632, 24696, 34850, 8981, 26490, 7225, 23557, 
+      8603, 29245, 19438, 7263, 28653, 24515, 33718, 8157, 24973, 11424, 6051, 12786, 33044, 65535, 5413, 21204, 
+      30337, 15221, 18345, 24865, 9150, 13446, 16399, 25940, 17295, 25766, 25765, 19832, 27729, 21428, 65535, 10686, 
+      18919, 18561, 13658, 13776, 30198, 65535, 19513, 20965, 37095, 24611, 20687, 19406, 29289, 19577, 19352, 19731, 
+      21273, 21655, 21968, 40325, 22953, 27962, 23825, 23541, 31740, 33137, 25971, 26620, 28337, 30396, 65535, 27398, 
+      29180, 31164, 33286, 36076, 28759, 32044, 32190, 41125, 30297, 31688, 30564, 33178, 31390, 31560, 33069, 32118, 
+      32170, 65535, 33589, 33671, 34933, 35317, 36889, 35597, 36210, 65535, 38118, 39223, 65535, 39812, 65535, 40425, 
+      41235, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 41136, 41835, 41725, 41890, 39750, 36084, 35003, 38255, 36431, 40565, 38361, 
+      34343, 37241, 31014, 37060, 36344, 30285, 38069, 26360, 38407, 35630, 25934, 30220, 35043, 35494, 30283, 21779, 
+      32383, 34293, 27700, 20176, 19106, 33110, 15106, 29090, 26683, 15065, 30109, 29895, 12878, 31888, 11275, 28965, 
+      13547, 34612, 24849, 6641, 34013, 29898, 28579, 5276, 19960, 7050, 11449, 18132, 27783, 5413, 65535, 26441, 
+      24993, 9810, 23456, 30021, 13588, 18267, 11096, 20543, 21878, 30759, 30758, 24513, 32771, 16213, 37817, 12159, 
+      23242, 22825, 16392, 13464, 35174, 37195, 23392, 25076, 31689, 19873, 24425, 16541, 33982, 21531, 20841, 20789, 
+      19999, 20528, 23631, 34956, 24645, 24089, 25669, 23206, 27303, 37853, 28341, 29335, 25747, 34427, 38204, 27637, 
+      32217, 28209, 29500, 31565, 29992, 35928, 36129, 36052, 32715, 35150, 32951, 30498, 34281, 34085, 31173, 34721, 
+      34488, 37753, 33171, 35324, 37151, 36889, 35824, 37589, 37355, 39586, 39409, 40452, 41406, 41376, 41519, 41790, 
+      41984, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 24380, 41465, 65535, 65535, 65535, 65535, 39779, 65535, 65535, 34648, 65535, 65535, 32451, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 25255, 65535, 65535, 65535, 65535, 
+      30078, 32858, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 39138, 65535, 65535, 37801, 65535, 65535, 65535, 65535, 38434, 65535, 
+      65535, 29274, 65535, 32146, 65535, 65535, 65535, 24863, 28680, 36393, 38131, 36747, 32024, 34526, 65535, 28965, 
+      65535, 65535, 65535, 34451, 27848, 33335, 24996, 20781, 65535, 20626, 65535, 41890, 65535, 22197, 16671, 17663, 
+      65535, 18169, 33602, 17186, 65535, 65535, 15292, 39674, 14079, 13820, 65535, 65535, 12917, 12321, 13426, 24912, 
+      65535, 65535, 65535, 40200, 37820, 9325, 36033, 65535, 7129, 17611, 6435, 65535, 19732, 6765, 19701, 5203, 
+      16257, 8632, 5083, 26696, 7977, 4737, 65535, 28809, 65535, 32463, 15277, 8543, 65535, 21204, 26441, 65535, 
+      65535, 35968, 3330, 3816, 13616, 8862, 36532, 65535, 7306, 5455, 5455, 5782, 6969, 40886, 65535, 19961, 
+      8287, 8700, 16136, 24106, 9540, 65535, 10664, 9419, 65535, 41980, 11422, 32689, 9985, 18771, 20331, 21843, 
+      29470, 29239, 20426, 65535, 20642, 41742, 20389, 27762, 65535, 13242, 19161, 18005, 37732, 14088, 65535, 27777, 
+      17902, 40925, 65535, 65535, 24920, 15943, 15806, 65535, 21143, 17569, 21419, 41364, 19829, 21446, 38509, 21470, 
+      22646, 65535, 33637, 26142, 24789, 27487, 38043, 26092, 29639, 65535, 30362, 31331, 65535, 30530, 65535, 31671, 
+      34417, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 26311, 30334, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 38456, 65535, 34992, 65535, 29694, 36410, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 34847, 65535, 65535, 65535, 65535, 36619, 65535, 34746, 65535, 65535, 35181, 65535, 33504, 65535, 65535, 
+      65535, 65535, 65535, 20705, 65535, 65535, 37947, 65535, 65535, 39338, 39874, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 38820, 65535, 39728, 65535, 65535, 65535, 37215, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35481, 38550, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 40387, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      34163, 65535, 34734, 65535, 65535, 65535, 65535, 65535, 21952, 65535, 37751, 37236, 22867, 65535, 65535, 65535, 
+      25037, 65535, 40445, 65535, 19633, 26559, 65535, 29168, 65535, 65535, 25260, 18063, 65535, 65535, 65535, 38198, 
+      12782, 12854, 13536, 20937, 22996, 65535, 21165, 9049, 65535, 37566, 65535, 7853, 34942, 65535, 34021, 65535, 
+      37257, 65535, 65535, 26357, 65535, 65535, 5231, 23614, 7177, 19747, 36382, 65535, 3338, 30337, 24993, 65535, 
+      65535, 15474, 65535, 65535, 38056, 65535, 15325, 6798, 65535, 65535, 65535, 65535, 65535, 12421, 12872, 33422, 
+      65535, 65535, 38261, 30944, 65535, 12441, 65535, 65535, 8534, 15300, 65535, 24712, 65535, 40451, 38884, 37799, 
+      30894, 31561, 41174, 12403, 41941, 21224, 65535, 35239, 18409, 65535, 65535, 65535, 28048, 65535, 15206, 39469, 
+      65535, 27304, 23429, 19527, 65535, 65535, 65535, 17231, 65535, 65535, 65535, 29572, 65535, 65535, 33359, 65535, 
+      65535, 19266, 40273, 65535, 65535, 65535, 39205, 65535, 65535, 25509, 65535, 65535, 29165, 65535, 36349, 65535, 
+      65535, 21174, 65535, 33281, 28571, 40882, 41906, 65535, 65535, 32740, 65535, 65535, 32205, 36667, 39912, 28075, 
+      25754, 65535, 65535, 65535, 65535, 65535, 65535, 31840, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 25757 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 36164, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 41724, 65535, 65535, 65535, 65535, 65535, 34846, 65535, 37827, 36876, 32867, 65535, 65535, 65535, 
+      31098, 65535, 35596, 65535, 30262, 28926, 65535, 27389, 65535, 65535, 25260, 25255, 65535, 65535, 39774, 28592, 
+      24890, 26282, 21556, 18909, 19208, 65535, 15159, 21141, 36484, 24162, 39910, 21411, 21694, 41654, 20337, 38752, 
+      23081, 65535, 34650, 13383, 65535, 39637, 19633, 10416, 11831, 7353, 21239, 27848, 18498, 15221, 9810, 35968, 
+      15474, 65535, 32844, 39397, 22585, 27420, 2515, 10756, 30643, 39878, 39876, 33319, 41938, 7234, 28144, 18557, 
+      31629, 31154, 23414, 17207, 65535, 27446, 31195, 33101, 21882, 12243, 31979, 14625, 65535, 26883, 25618, 24939, 
+      20438, 21128, 28300, 25205, 29240, 18296, 30380, 24723, 19856, 65535, 33606, 35052, 22596, 41924, 28448, 29514, 
+      38235, 23992, 23379, 23714, 33271, 65535, 65535, 26875, 37695, 41681, 37863, 26599, 39924, 39137, 28741, 39855, 
+      39165, 28723, 33256, 38809, 41453, 40099, 34464, 41466, 39783, 31825, 41912, 65535, 34364, 65535, 37103, 65535, 
+      65535, 34515, 41048, 38191, 37701, 65535, 65535, 65535, 65535, 41636, 65535, 65535, 65535, 65535, 65535, 41444, 
+      40055, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40991 },
+    { 65535, 65535, 65535, 27331, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37705, 65535, 65535, 35570, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28510, 65535, 65535, 65535, 65535, 
+      33400, 36186, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40836, 65535, 65535, 65535, 65535, 41233, 65535, 
+      65535, 32440, 65535, 35112, 65535, 65535, 65535, 28110, 31744, 38937, 40513, 39158, 34665, 36908, 65535, 31712, 
+      65535, 65535, 65535, 36507, 30311, 35220, 27682, 23828, 65535, 23454, 65535, 65535, 65535, 24415, 19940, 20602, 
+      65535, 20902, 34057, 19996, 65535, 65535, 18432, 38907, 17359, 16789, 41364, 65535, 15902, 15442, 15459, 24597, 
+      65535, 65535, 65535, 38456, 36181, 12448, 34014, 65535, 8903, 16235, 9384, 65535, 18052, 10029, 17742, 8063, 
+      14437, 11954, 6217, 24283, 11298, 7945, 65535, 26185, 65535, 29725, 12604, 6196, 65535, 18345, 23456, 3330, 
+      65535, 32844, 65535, 6570, 10358, 5557, 33315, 65535, 4374, 7486, 7484, 3926, 9393, 37597, 65535, 16638, 
+      5910, 6204, 12926, 20826, 11899, 65535, 8370, 7653, 65535, 38652, 9384, 29422, 11523, 16087, 17547, 19030, 
+      26427, 26236, 17965, 65535, 18308, 38540, 18210, 25010, 65535, 15181, 17486, 16610, 34783, 14552, 65535, 25475, 
+      17127, 38007, 65535, 65535, 23096, 16441, 16394, 65535, 20097, 17541, 20388, 38605, 19256, 20630, 35973, 20778, 
+      21770, 65535, 31624, 25046, 24162, 26515, 36034, 25391, 28527, 65535, 29503, 30539, 65535, 29978, 65535, 31059, 
+      33547, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41706, 65535, 27777, 31434, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 39825, 65535, 36759, 65535, 31902, 38426, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 20764, 37699, 65535, 65535, 65535, 65535, 36133, 65535, 65535, 31139, 65535, 65535, 29027, 
+      65535, 65535, 65535, 65535, 39352, 65535, 65535, 65535, 65535, 65535, 65535, 22148, 65535, 65535, 65535, 65535, 
+      27327, 30399, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 37877, 65535, 65535, 36620, 65535, 65535, 65535, 65535, 37799, 65535, 
+      65535, 27800, 65535, 31215, 65535, 65535, 65535, 23116, 27539, 36281, 38272, 36860, 31803, 34723, 65535, 28587, 
+      65535, 65535, 65535, 35152, 28028, 34293, 24821, 19846, 65535, 20260, 65535, 65535, 65535, 22913, 14976, 17123, 
+      65535, 18093, 36105, 16980, 65535, 65535, 14237, 65535, 12408, 13376, 65535, 65535, 12485, 11493, 14767, 28086, 
+      65535, 65535, 65535, 65535, 41535, 8747, 39833, 65535, 9372, 21319, 6880, 65535, 23501, 5876, 23508, 6191, 
+      20057, 6303, 8179, 30501, 5674, 4748, 65535, 32574, 65535, 36192, 19009, 12322, 65535, 24865, 30021, 3816, 
+      65535, 39397, 6570, 65535, 16847, 12004, 39798, 65535, 9423, 2209, 2210, 7057, 3191, 65535, 65535, 22572, 
+      9559, 10061, 18297, 26393, 5747, 65535, 11533, 9790, 65535, 65535, 11884, 34832, 6672, 19744, 21432, 22959, 
+      30935, 30612, 20979, 65535, 20995, 65535, 20523, 28637, 65535, 9564, 18661, 17206, 38868, 11502, 65535, 27892, 
+      16392, 41952, 65535, 65535, 24424, 13239, 13029, 65535, 19811, 15297, 20060, 65535, 18024, 19846, 38820, 19737, 
+      21075, 65535, 33213, 24725, 22896, 25900, 37540, 24245, 28162, 65535, 28595, 29478, 65535, 28447, 65535, 29628, 
+      32593, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39641, 65535, 22745, 26937, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 34880, 65535, 31273, 65535, 25886, 32625, 65535, 65535, 41147, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 37477, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38863, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 41463, 65535, 65535, 65535, 65535, 65535, 37594, 40354, 65535, 65535, 65535, 41585, 65535, 65535, 39142, 
+      65535, 65535, 65535, 41311, 36860, 39553, 35106, 32619, 65535, 31549, 41971, 40914, 65535, 30622, 29660, 29178, 
+      65535, 28857, 34015, 28225, 65535, 40313, 27714, 34740, 27169, 25643, 35963, 65535, 24846, 24777, 22161, 23341, 
+      65535, 65535, 40908, 31503, 29664, 21926, 26523, 65535, 16435, 13332, 18724, 65535, 13559, 19957, 12284, 17408, 
+      10531, 22218, 13837, 16203, 21570, 17839, 65535, 17299, 33527, 20371, 5655, 6978, 41058, 9150, 13588, 13616, 
+      38056, 22585, 10358, 16847, 65535, 4843, 22962, 32634, 8292, 17311, 17309, 10927, 19362, 27276, 65535, 7418, 
+      9784, 9415, 6518, 12023, 21681, 65535, 10429, 11817, 65535, 28735, 11654, 20362, 20395, 12572, 13077, 14065, 
+      19133, 19200, 15095, 65535, 15940, 29720, 16537, 19490, 34500, 24266, 17926, 18206, 27505, 21246, 65535, 22008, 
+      20438, 30726, 34368, 38725, 21890, 22904, 23044, 65535, 22036, 22672, 22322, 32025, 22710, 23167, 30517, 23645, 
+      23942, 65535, 28634, 26051, 26716, 27718, 32659, 27568, 29041, 65535, 30708, 31836, 65535, 32061, 41541, 32853, 
+      34296, 65535, 41153, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35235, 37829, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40737, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 32655, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41024, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34059, 65535, 65535, 65535, 65535, 
+      38938, 41648, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 37460, 65535, 39705, 65535, 65535, 65535, 33333, 36560, 65535, 65535, 65535, 38648, 40383, 65535, 35930, 
+      65535, 65535, 65535, 39410, 34055, 37856, 31858, 28686, 65535, 27944, 65535, 41914, 65535, 27895, 25250, 25322, 
+      65535, 25289, 34313, 24522, 65535, 65535, 23511, 36992, 22704, 21624, 38798, 65535, 20777, 20528, 19038, 23968, 
+      65535, 65535, 65535, 34991, 32933, 17588, 30205, 65535, 12767, 14343, 14408, 65535, 15432, 15401, 14614, 13069, 
+      11872, 17493, 9986, 20038, 16839, 13283, 65535, 21544, 38225, 24854, 8375, 4629, 65535, 13446, 18267, 8862, 
+      65535, 27420, 5557, 12004, 4843, 65535, 27798, 37453, 4017, 12513, 12511, 6402, 14549, 32040, 65535, 11287, 
+      6011, 5824, 8269, 15674, 16912, 65535, 7595, 8303, 65535, 33201, 8921, 24260, 15843, 12977, 14068, 15394, 
+      21961, 21879, 15294, 65535, 15913, 33528, 16175, 21315, 38502, 19694, 16580, 16331, 30433, 17406, 65535, 22791, 
+      17903, 33689, 37807, 65535, 21515, 19190, 19264, 65535, 20168, 19463, 20466, 34626, 20196, 21069, 32508, 21417, 
+      22033, 65535, 29328, 24738, 24714, 26357, 33621, 25757, 28034, 65535, 29416, 30525, 65535, 30393, 65535, 31333, 
+      33289, 65535, 41799, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31328, 34377, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 40529, 65535, 36344, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 35773, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35788, 65535, 40288, 39347, 34338, 65535, 65535, 65535, 
+      33055, 65535, 38095, 65535, 31583, 31181, 65535, 29854, 65535, 65535, 27622, 26954, 65535, 65535, 41360, 30892, 
+      25825, 26967, 23025, 21288, 21675, 65535, 17656, 21959, 37655, 25921, 40895, 21951, 23536, 65535, 22085, 39686, 
+      24616, 65535, 35650, 15481, 65535, 40447, 19921, 12567, 12889, 9767, 22282, 28696, 18534, 16399, 11096, 36532, 
+      15325, 2515, 33315, 39798, 22962, 27798, 65535, 9725, 30758, 40087, 40085, 33418, 65535, 5184, 27589, 18139, 
+      31548, 31055, 23000, 16161, 65535, 26746, 30877, 32841, 20858, 9827, 31554, 12518, 65535, 25883, 24501, 23686, 
+      18542, 19241, 27090, 23946, 27990, 15782, 29136, 22915, 17476, 65535, 32443, 33986, 20175, 41328, 27191, 27679, 
+      37204, 21496, 20886, 21428, 31647, 65535, 65535, 25056, 36391, 40754, 36539, 24109, 38761, 37829, 26334, 38557, 
+      37764, 26832, 31085, 37146, 39931, 38363, 32115, 39850, 37904, 29557, 40020, 40820, 31990, 65535, 34589, 65535, 
+      41203, 33161, 38567, 35769, 35611, 39834, 40634, 65535, 65535, 39472, 65535, 65535, 40426, 65535, 65535, 39993, 
+      38895, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40280 },
+    { 65535, 39070, 65535, 65535, 65535, 65535, 41128, 65535, 39535, 65535, 65535, 40259, 65535, 38873, 65535, 65535, 
+      65535, 65535, 65535, 26214, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      40335, 65535, 40659, 65535, 65535, 65535, 65535, 65535, 28738, 65535, 41575, 40876, 29235, 65535, 65535, 65535, 
+      30413, 65535, 65535, 65535, 26064, 30753, 65535, 31895, 65535, 65535, 28481, 23473, 65535, 65535, 65535, 37681, 
+      19355, 19631, 18921, 23000, 24480, 65535, 21504, 15469, 65535, 34715, 65535, 14573, 32172, 65535, 30929, 65535, 
+      33798, 65535, 65535, 23599, 65535, 65535, 12016, 20632, 9394, 16965, 31915, 38406, 10104, 25940, 20543, 65535, 
+      6798, 10756, 65535, 65535, 32634, 37453, 9725, 65535, 40235, 65535, 65535, 65535, 65535, 5778, 17958, 27264, 
+      40831, 40324, 32015, 24415, 65535, 17046, 39878, 41889, 11166, 8760, 40383, 17914, 65535, 33776, 32176, 31053, 
+      24103, 24774, 34412, 14457, 35164, 15209, 36274, 28466, 13581, 65535, 39673, 41425, 21801, 65535, 17696, 32766, 
+      65535, 21523, 18437, 16035, 37391, 65535, 65535, 16837, 65535, 65535, 65535, 23982, 65535, 65535, 27475, 65535, 
+      65535, 18829, 34029, 65535, 65535, 65535, 33462, 65535, 65535, 23467, 65535, 65535, 26714, 65535, 32272, 65535, 
+      65535, 23781, 37521, 30853, 28237, 37247, 38218, 65535, 65535, 32383, 65535, 65535, 32648, 36083, 39470, 30740, 
+      29309, 65535, 65535, 65535, 65535, 65535, 65535, 34631, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 30561 },
+    { 65535, 65535, 65535, 29446, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39934, 65535, 65535, 38003, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31488, 65535, 65535, 65535, 65535, 
+      36750, 39789, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 36574, 65535, 39412, 65535, 65535, 65535, 32110, 35981, 65535, 65535, 65535, 39039, 41256, 65535, 36077, 
+      65535, 65535, 65535, 40760, 34676, 39406, 32052, 28074, 65535, 27799, 65535, 65535, 65535, 28744, 23903, 24906, 
+      65535, 25264, 37282, 24342, 65535, 65535, 22599, 40782, 21303, 21074, 65535, 65535, 20178, 19626, 19774, 27261, 
+      65535, 65535, 65535, 39007, 36938, 16628, 34218, 65535, 13220, 17986, 13659, 65535, 19286, 14041, 18561, 12362, 
+      15673, 15522, 10467, 24025, 14865, 12043, 65535, 25437, 41798, 28635, 12392, 7707, 65535, 17295, 21878, 7306, 
+      65535, 30643, 4374, 9423, 8292, 4017, 30758, 40235, 65535, 9346, 9344, 2676, 11419, 34633, 65535, 13162, 
+      2172, 2193, 8937, 17010, 13567, 65535, 4363, 4461, 65535, 35108, 5584, 25526, 12105, 11717, 13175, 14663, 
+      22167, 21947, 13647, 65535, 14042, 34472, 14028, 20638, 39613, 15976, 13696, 13110, 30467, 13389, 65535, 21192, 
+      14268, 33679, 38225, 65535, 19100, 15177, 15248, 65535, 16836, 15544, 17135, 34236, 16532, 17594, 31609, 17869, 
+      18638, 65535, 27455, 21626, 21228, 23185, 31850, 22352, 25038, 65535, 26233, 27315, 65535, 26999, 41702, 28003, 
+      30209, 65535, 39636, 65535, 65535, 65535, 65535, 65535, 38747, 65535, 27321, 30373, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 38949, 65535, 36529, 65535, 32488, 38556, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 20175, 36669, 65535, 65535, 65535, 65535, 35392, 65535, 65535, 30650, 65535, 65535, 28670, 
+      65535, 65535, 65535, 65535, 39392, 65535, 65535, 65535, 65535, 65535, 65535, 22228, 65535, 65535, 65535, 65535, 
+      27688, 30964, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 39119, 65535, 65535, 37909, 65535, 65535, 65535, 65535, 39332, 65535, 
+      65535, 29004, 65535, 32659, 65535, 65535, 65535, 24216, 28913, 38024, 40093, 38677, 33529, 36576, 65535, 30275, 
+      65535, 65535, 65535, 37146, 29906, 36349, 26605, 21388, 65535, 22015, 65535, 65535, 65535, 24954, 16231, 18853, 
+      65535, 19962, 38308, 18822, 65535, 65535, 15814, 65535, 13740, 15194, 65535, 65535, 14323, 13220, 16942, 30168, 
+      65535, 65535, 65535, 65535, 65535, 10636, 41348, 65535, 11563, 23056, 9031, 65535, 25132, 7807, 25012, 8394, 
+      21607, 7564, 10222, 31755, 7013, 6911, 65535, 33666, 65535, 37176, 20088, 13587, 65535, 25766, 30759, 5455, 
+      65535, 39878, 7486, 2209, 17311, 12513, 40087, 65535, 9346, 65535, 3, 6728, 2074, 65535, 65535, 22422, 
+      8966, 9484, 17901, 25961, 4431, 65535, 10591, 8680, 65535, 65535, 10710, 34224, 4578, 18624, 20352, 21866, 
+      29947, 29576, 19631, 65535, 19554, 65535, 18992, 27361, 65535, 7828, 16897, 15352, 37645, 9294, 65535, 26282, 
+      14331, 40656, 65535, 65535, 22609, 11032, 10826, 65535, 17773, 13103, 18013, 40592, 15890, 17744, 37223, 17608, 
+      18974, 65535, 31374, 22644, 20733, 23781, 35657, 22085, 26059, 65535, 26439, 27309, 65535, 26254, 65535, 27437, 
+      30424, 65535, 41921, 65535, 65535, 65535, 65535, 65535, 37433, 65535, 20856, 24928, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 41931, 33003, 65535, 29571, 65535, 24457, 31075, 65535, 65535, 39473, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 20177, 36670, 65535, 65535, 65535, 65535, 35394, 65535, 65535, 30652, 65535, 65535, 28672, 
+      65535, 65535, 65535, 65535, 39394, 65535, 65535, 65535, 65535, 65535, 65535, 22230, 65535, 65535, 65535, 65535, 
+      27690, 30966, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 39121, 65535, 65535, 37912, 65535, 65535, 65535, 65535, 39334, 65535, 
+      65535, 29007, 65535, 32661, 65535, 65535, 65535, 24219, 28915, 38027, 40095, 38679, 33531, 36579, 65535, 30278, 
+      65535, 65535, 65535, 37148, 29908, 36351, 26608, 21390, 65535, 22018, 65535, 65535, 65535, 24956, 16234, 18855, 
+      65535, 19965, 38309, 18825, 65535, 65535, 15816, 65535, 13742, 15197, 65535, 65535, 14325, 13222, 16944, 30169, 
+      65535, 65535, 65535, 65535, 65535, 10639, 41347, 65535, 11564, 23056, 9033, 65535, 25132, 7809, 25012, 8395, 
+      21606, 7567, 10223, 31754, 7016, 6912, 65535, 33665, 65535, 37174, 20087, 13586, 65535, 25765, 30758, 5455, 
+      65535, 39876, 7484, 2210, 17309, 12511, 40085, 65535, 9344, 3, 65535, 6725, 2076, 65535, 65535, 22419, 
+      8963, 9481, 17899, 25958, 4433, 65535, 10589, 8677, 65535, 65535, 10707, 34221, 4577, 18621, 20350, 21863, 
+      29945, 29574, 19629, 65535, 19551, 65535, 18989, 27358, 65535, 7829, 16895, 15350, 37642, 9292, 65535, 26280, 
+      14329, 40653, 65535, 65535, 22607, 11031, 10825, 65535, 17771, 13101, 18011, 40590, 15888, 17742, 37220, 17606, 
+      18972, 65535, 31372, 22642, 20731, 23779, 35655, 22083, 26057, 65535, 26438, 27307, 65535, 26253, 65535, 27435, 
+      30422, 65535, 41919, 65535, 65535, 65535, 65535, 65535, 37431, 65535, 20856, 24928, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 41931, 33003, 65535, 29572, 65535, 24458, 31075, 65535, 65535, 39474, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 26776, 65535, 65535, 65535, 65535, 65535, 41796, 65535, 65535, 37264, 65535, 65535, 35348, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28936, 65535, 65535, 65535, 65535, 
+      34299, 37443, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 34664, 65535, 37784, 65535, 65535, 65535, 30072, 34230, 65535, 65535, 65535, 37801, 40294, 65535, 34724, 
+      65535, 65535, 65535, 40119, 33624, 38919, 30770, 26381, 65535, 26370, 65535, 65535, 65535, 27911, 21880, 23362, 
+      65535, 23941, 37961, 22943, 65535, 65535, 20815, 65535, 19284, 19518, 65535, 65535, 18611, 17898, 19039, 28349, 
+      65535, 65535, 65535, 41187, 39036, 14936, 36500, 65535, 12546, 19559, 12192, 65535, 21111, 12194, 20553, 10984, 
+      17465, 13311, 10002, 26408, 12665, 10346, 65535, 27945, 65535, 31216, 14676, 9200, 65535, 19832, 24513, 5782, 
+      65535, 33319, 3926, 7057, 10927, 6402, 33418, 65535, 2676, 6728, 6725, 65535, 8793, 37233, 65535, 15701, 
+      2580, 3052, 11268, 19363, 10895, 65535, 4885, 3781, 65535, 37526, 5676, 27775, 9481, 13056, 14665, 16190, 
+      24011, 23728, 14646, 65535, 14863, 36531, 14637, 22049, 41712, 13348, 13646, 12701, 32129, 11288, 65535, 22008, 
+      13235, 35287, 40014, 65535, 19327, 13141, 13160, 65535, 16171, 13902, 16462, 35630, 15397, 16722, 32728, 16888, 
+      17853, 65535, 27964, 21121, 20275, 22589, 32377, 21489, 24604, 65535, 25581, 26621, 65535, 26091, 65535, 27161, 
+      29622, 65535, 39777, 65535, 65535, 65535, 65535, 65535, 37837, 65535, 25040, 28332, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 36859, 65535, 34204, 65535, 29946, 36133, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 18116, 34735, 65535, 65535, 65535, 65535, 33369, 65535, 65535, 28586, 65535, 65535, 26597, 
+      65535, 65535, 65535, 65535, 37338, 65535, 65535, 65535, 65535, 65535, 65535, 20193, 65535, 65535, 65535, 65535, 
+      25712, 29051, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 37559, 65535, 65535, 36390, 65535, 65535, 65535, 65535, 38025, 65535, 
+      65535, 27449, 65535, 31289, 65535, 65535, 65535, 22608, 27495, 36964, 39132, 37716, 32464, 35677, 65535, 29176, 
+      65535, 65535, 65535, 36493, 29075, 35839, 25651, 20175, 65535, 21052, 65535, 65535, 65535, 24462, 14799, 17883, 
+      65535, 19183, 38700, 18011, 65535, 65535, 14696, 65535, 12408, 14393, 65535, 65535, 13565, 12327, 16941, 31092, 
+      65535, 65535, 65535, 65535, 65535, 10044, 65535, 65535, 12186, 24510, 9072, 65535, 26686, 7404, 26669, 8733, 
+      23227, 6368, 11288, 33573, 5930, 7091, 65535, 35564, 65535, 39118, 21979, 15378, 65535, 27729, 32771, 6969, 
+      65535, 41938, 9393, 3191, 19362, 14549, 65535, 65535, 11419, 2074, 2076, 8793, 65535, 65535, 65535, 24477, 
+      10978, 11496, 19922, 27959, 2571, 65535, 12480, 10517, 65535, 65535, 12484, 36157, 4011, 20365, 22108, 23608, 
+      31722, 31325, 21214, 65535, 21063, 65535, 20423, 28961, 65535, 6402, 18089, 16435, 39253, 9349, 65535, 27593, 
+      15030, 65535, 65535, 65535, 23689, 10895, 10621, 65535, 18488, 13285, 18707, 65535, 16344, 18292, 38505, 18070, 
+      19514, 65535, 32374, 23214, 21025, 24229, 36573, 22387, 26544, 65535, 26736, 27538, 65535, 26339, 65535, 27537, 
+      30640, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37183, 65535, 19611, 23888, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 41012, 31730, 65535, 28083, 65535, 22729, 29444, 65535, 65535, 37957, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 31830, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34172, 65535, 65535, 65535, 33976, 65535, 65535, 65535, 
+      34073, 65535, 65535, 65535, 30931, 33294, 65535, 33074, 65535, 65535, 30272, 27401, 65535, 65535, 65535, 35804, 
+      24494, 25076, 23033, 24171, 25052, 65535, 21362, 20545, 65535, 31104, 65535, 19965, 28718, 65535, 27268, 65535, 
+      29757, 65535, 40439, 20582, 65535, 65535, 17543, 17632, 12700, 14524, 27188, 33402, 15758, 21428, 16213, 40886, 
+      12421, 7234, 37597, 65535, 27276, 32040, 5184, 5778, 34633, 65535, 65535, 37233, 65535, 65535, 23544, 21570, 
+      35139, 34628, 26279, 18637, 65535, 22517, 34123, 36139, 16319, 5541, 34612, 12499, 65535, 28040, 26464, 25385, 
+      18788, 19478, 28769, 19107, 29555, 12286, 30679, 23221, 12835, 65535, 34075, 35791, 17976, 65535, 22328, 27730, 
+      39007, 18523, 16839, 16526, 32186, 65535, 65535, 19877, 37608, 65535, 37706, 21139, 40244, 39004, 24044, 39739, 
+      38717, 21648, 29865, 37437, 40533, 38421, 30044, 40205, 37546, 24614, 39578, 40219, 27264, 41935, 30887, 41675, 
+      40042, 28186, 35458, 31183, 30488, 36101, 36980, 41443, 65535, 34404, 65535, 65535, 35271, 37750, 41105, 34935, 
+      34047, 65535, 65535, 65535, 65535, 65535, 65535, 38789, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35878 },
+    { 36675, 22004, 65535, 65535, 65535, 36374, 23748, 65535, 21902, 65535, 34464, 22434, 65535, 20932, 65535, 65535, 
+      31623, 41061, 35319, 8289, 65535, 65535, 26158, 33489, 32426, 27926, 28868, 65535, 40649, 36717, 32637, 65535, 
+      65535, 65535, 65535, 65535, 35318, 29981, 65535, 31184, 65535, 65535, 65535, 28674, 65535, 65535, 37047, 65535, 
+      65535, 65535, 65535, 65535, 65535, 40485, 65535, 65535, 65535, 65535, 65535, 28373, 32132, 38949, 65535, 65535, 
+      38740, 65535, 41323, 65535, 36909, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      32183, 65535, 33703, 65535, 65535, 65535, 65535, 65535, 17094, 65535, 65535, 41981, 21883, 65535, 65535, 65535, 
+      27515, 65535, 65535, 65535, 19107, 31713, 65535, 36623, 65535, 65535, 32455, 22095, 65535, 65535, 65535, 65535, 
+      13999, 11661, 19129, 30427, 32891, 65535, 32344, 13493, 65535, 65535, 65535, 11326, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 39042, 65535, 65535, 10735, 36394, 19166, 32537, 65535, 65535, 10539, 65535, 37817, 65535, 
+      12872, 28144, 65535, 65535, 65535, 65535, 27589, 17958, 65535, 65535, 65535, 65535, 65535, 23544, 65535, 65535, 
+      65535, 65535, 65535, 41820, 65535, 1595, 65535, 65535, 7764, 23894, 65535, 34093, 65535, 65535, 65535, 65535, 
+      39450, 39997, 65535, 7589, 65535, 27173, 65535, 65535, 22379, 65535, 65535, 65535, 33653, 65535, 7106, 65535, 
+      65535, 31529, 26409, 20573, 65535, 65535, 65535, 13613, 65535, 65535, 65535, 32893, 65535, 65535, 37018, 65535, 
+      65535, 14780, 65535, 65535, 65535, 65535, 41646, 65535, 65535, 21978, 65535, 65535, 25577, 65535, 34816, 65535, 
+      65535, 10554, 40649, 28879, 21292, 37712, 38703, 65535, 65535, 24824, 65535, 65535, 23132, 28591, 31259, 16497, 
+      13425, 65535, 65535, 65535, 65535, 65535, 65535, 19898, 65535, 65535, 34044, 65535, 65535, 35647, 41933, 12893 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 39876, 65535, 38922, 65535, 65535, 65535, 37996, 36523, 36464, 
+      65535, 36233, 39432, 35565, 65535, 65535, 34788, 37626, 33963, 32840, 37796, 65535, 32012, 31810, 29578, 28857, 
+      65535, 65535, 39333, 32276, 31018, 28875, 27171, 39675, 23747, 19186, 25693, 39950, 18541, 26640, 16900, 24354, 
+      16434, 28525, 21067, 17505, 27865, 24531, 38040, 17247, 30330, 19054, 11383, 14381, 36666, 10686, 12159, 19961, 
+      33422, 18557, 16638, 22572, 7418, 11287, 18139, 27264, 13162, 22422, 22419, 15701, 24477, 21570, 65535, 65535, 
+      13571, 13062, 4870, 4607, 26413, 65535, 12739, 14712, 37666, 22030, 13441, 13032, 24341, 9377, 8819, 9059, 
+      11970, 12138, 11558, 39868, 12569, 22370, 13553, 13203, 27255, 28056, 16189, 17251, 20190, 23372, 65535, 16752, 
+      20242, 23382, 26951, 31416, 18186, 24620, 24886, 38284, 20559, 23419, 20793, 24815, 22219, 21936, 23697, 22580, 
+      22329, 39342, 23090, 23321, 25003, 24930, 26678, 25482, 25641, 38049, 27611, 28697, 38343, 29440, 34812, 29959, 
+      30585, 65535, 35235, 40358, 65535, 38882, 39127, 40133, 39487, 65535, 36602, 38030, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 28645, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39105, 65535, 65535, 37300, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31169, 65535, 65535, 65535, 65535, 
+      36650, 39873, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 37238, 65535, 40356, 65535, 65535, 65535, 32630, 36809, 65535, 65535, 65535, 40303, 65535, 65535, 37252, 
+      65535, 65535, 65535, 65535, 36068, 41131, 33279, 28957, 65535, 28908, 65535, 65535, 65535, 30266, 24445, 25919, 
+      65535, 26453, 39403, 25472, 65535, 65535, 23394, 65535, 21852, 22074, 65535, 65535, 21167, 20473, 21337, 29427, 
+      65535, 65535, 65535, 40935, 38918, 17505, 36080, 65535, 14792, 20146, 14719, 65535, 21399, 14773, 20623, 13485, 
+      17801, 15845, 12127, 25822, 15204, 12910, 65535, 27075, 65535, 30129, 14327, 9879, 65535, 18919, 23242, 8287, 
+      65535, 31629, 5910, 9559, 9784, 6011, 31548, 40831, 2172, 8966, 8963, 2580, 10978, 35139, 65535, 13571, 
+      65535, 518, 8944, 16996, 12842, 65535, 2461, 2309, 65535, 35171, 3530, 25317, 10937, 10495, 12091, 13614, 
+      21439, 21151, 12167, 65535, 12445, 33990, 12306, 19490, 39178, 14769, 11683, 10998, 29551, 11525, 65535, 19612, 
+      12096, 32712, 37435, 65535, 17211, 13255, 13358, 65535, 14690, 13454, 14988, 33083, 14362, 15428, 30244, 15698, 
+      16480, 65535, 25714, 19514, 19059, 21058, 30125, 20190, 22946, 65535, 24100, 25176, 65535, 24835, 40052, 25846, 
+      28091, 65535, 37743, 65535, 65535, 65535, 41996, 40422, 36588, 65535, 25515, 28398, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 36986, 65535, 34739, 65535, 30987, 36864, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 29144, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39600, 65535, 65535, 37803, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31687, 65535, 65535, 65535, 65535, 
+      37167, 40387, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 37715, 65535, 40802, 65535, 65535, 65535, 33119, 37269, 65535, 65535, 65535, 40698, 65535, 65535, 37661, 
+      65535, 65535, 65535, 65535, 36435, 41411, 33678, 29407, 65535, 29326, 65535, 65535, 65535, 30601, 24930, 26350, 
+      65535, 26856, 39475, 25885, 65535, 65535, 23852, 65535, 22335, 22505, 65535, 65535, 21599, 20923, 21657, 29426, 
+      65535, 65535, 65535, 40663, 38670, 17950, 35783, 65535, 15105, 20058, 15134, 65535, 21249, 15232, 20433, 13888, 
+      17668, 16342, 12412, 25507, 15700, 13351, 65535, 26714, 65535, 29732, 14076, 9854, 65535, 18561, 22825, 8700, 
+      65535, 31154, 6204, 10061, 9415, 5824, 31055, 40324, 2193, 9484, 9481, 3052, 11496, 34628, 65535, 13062, 
+      518, 65535, 8426, 16478, 13352, 65535, 2206, 2496, 65535, 34653, 3392, 24805, 11414, 10071, 11647, 13166, 
+      20959, 20678, 11800, 65535, 12110, 33493, 12010, 19064, 38679, 15236, 11522, 10918, 29095, 11850, 65535, 19279, 
+      12155, 32264, 36967, 65535, 16985, 13553, 13670, 65535, 14655, 13652, 14953, 32664, 14435, 15437, 29864, 15731, 
+      16467, 65535, 25433, 19434, 19076, 20995, 29840, 20185, 22847, 65535, 24044, 25128, 65535, 24833, 39746, 25828, 
+      28017, 65535, 37525, 65535, 65535, 41998, 41780, 40298, 36573, 65535, 25845, 28657, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 37247, 65535, 35070, 65535, 31394, 37223, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 37380, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40113, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 40998, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 40118, 36712, 65535, 36136, 65535, 65535, 65535, 36125, 32801, 33418, 
+      65535, 33502, 40517, 32694, 65535, 65535, 31357, 40501, 30204, 29649, 41219, 65535, 28775, 28366, 27303, 29833, 
+      65535, 65535, 65535, 36110, 34596, 25374, 30998, 65535, 21012, 19830, 22283, 65535, 19878, 22901, 18465, 20949, 
+      17019, 24457, 18213, 20887, 23800, 20850, 65535, 21169, 35160, 23425, 12014, 12416, 41518, 13658, 16392, 16136, 
+      38261, 23414, 12926, 18297, 6518, 8269, 23000, 32015, 8937, 17901, 17899, 11268, 19922, 26279, 65535, 4870, 
+      8944, 8426, 65535, 8097, 21728, 65535, 7891, 9885, 65535, 26259, 8572, 16590, 19533, 6181, 6560, 7589, 
+      13703, 13611, 8699, 65535, 9605, 25616, 10337, 13253, 30720, 23213, 12314, 13055, 22170, 18535, 65535, 15495, 
+      15836, 25425, 29641, 34664, 15566, 19836, 20087, 41956, 16655, 18800, 16917, 26375, 17944, 17946, 24427, 18531, 
+      18518, 65535, 22125, 20117, 21277, 21779, 26193, 21948, 22885, 40554, 24676, 25798, 40266, 26238, 35300, 26921, 
+      28078, 65535, 34656, 41665, 65535, 38724, 38791, 38867, 37101, 65535, 31953, 33691, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 40929, 65535, 38420, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40766, 40967, 
+      65535, 40798, 65535, 40104, 65535, 65535, 39165, 39794, 38182, 37296, 39336, 65535, 36452, 36175, 34179, 32645, 
+      41973, 65535, 38707, 33377, 32514, 33209, 28418, 38120, 28286, 23301, 30054, 38050, 22348, 30854, 20633, 28713, 
+      20631, 32529, 25574, 19715, 31871, 28769, 35875, 18736, 28960, 19607, 15707, 18976, 34268, 13776, 13464, 24106, 
+      30944, 17207, 20826, 26393, 12023, 15674, 16161, 24415, 17010, 25961, 25958, 19363, 27959, 18637, 41820, 4607, 
+      16996, 16478, 8097, 65535, 29649, 40610, 15640, 17664, 34184, 18176, 16018, 8603, 27239, 9724, 8412, 7833, 
+      7665, 7957, 11122, 36051, 12085, 17861, 13215, 9883, 22839, 30739, 16401, 17862, 15648, 25340, 38943, 14177, 
+      21065, 18814, 22353, 26930, 16778, 26293, 26616, 33990, 20542, 24594, 20725, 20340, 22718, 21981, 19533, 22690, 
+      22098, 34948, 19959, 22268, 24542, 23746, 23115, 24747, 23996, 33447, 26086, 27096, 33757, 28158, 30617, 28474, 
+      28524, 65535, 31571, 35868, 40497, 34940, 35273, 36831, 37097, 65535, 37566, 38222, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 15881, 32239, 65535, 65535, 65535, 65535, 30996, 65535, 65535, 26369, 65535, 65535, 24480, 
+      65535, 65535, 65535, 65535, 35474, 65535, 65535, 65535, 65535, 65535, 65535, 18505, 65535, 65535, 65535, 65535, 
+      24236, 27754, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 36996, 65535, 65535, 35907, 65535, 65535, 65535, 65535, 37893, 65535, 
+      65535, 26970, 65535, 31104, 65535, 65535, 65535, 22074, 27262, 37214, 39507, 38101, 32742, 36161, 65535, 29433, 
+      65535, 65535, 65535, 37290, 29704, 36813, 26149, 20365, 65535, 21593, 65535, 65535, 65535, 25553, 14732, 18467, 
+      65535, 19997, 40575, 18804, 65535, 65535, 15140, 65535, 12588, 15276, 65535, 65535, 14525, 13155, 18626, 33385, 
+      65535, 65535, 65535, 65535, 65535, 11321, 65535, 65535, 14406, 27051, 10971, 65535, 29248, 9013, 29240, 10850, 
+      25796, 7147, 13736, 36127, 6918, 9169, 65535, 38084, 65535, 41606, 24501, 17934, 65535, 30198, 35174, 9540, 
+      65535, 65535, 11899, 5747, 21681, 16912, 65535, 65535, 13567, 4431, 4433, 10895, 2571, 65535, 65535, 26413, 
+      12842, 13352, 21728, 29649, 65535, 65535, 14017, 11997, 65535, 65535, 13799, 37618, 3198, 21491, 23246, 24703, 
+      32826, 32378, 22043, 65535, 21767, 65535, 21010, 29747, 65535, 4028, 18352, 16576, 39984, 8468, 65535, 27907, 
+      14692, 65535, 65535, 65535, 23703, 9696, 9355, 65535, 18091, 12364, 18277, 65535, 15665, 17685, 38689, 17362, 
+      18875, 65535, 32187, 22556, 20063, 23408, 36237, 21417, 25742, 65535, 25709, 26426, 65535, 25077, 65535, 26280, 
+      29485, 65535, 41502, 65535, 65535, 65535, 65535, 41581, 35501, 65535, 17213, 21608, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 38763, 29288, 65535, 25553, 65535, 20158, 26878, 65535, 41783, 35413, 65535, 65535, 65535 },
+    { 36871, 22443, 65535, 65535, 65535, 36767, 24309, 65535, 22570, 65535, 35054, 23221, 65535, 21849, 65535, 65535, 
+      32514, 41931, 36223, 9443, 65535, 65535, 27314, 34646, 33594, 29152, 30157, 65535, 41975, 38058, 33981, 65535, 
+      65535, 65535, 65535, 65535, 36825, 31481, 65535, 32697, 65535, 65535, 65535, 30197, 65535, 65535, 38607, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 29951, 33718, 40544, 65535, 65535, 
+      40334, 65535, 65535, 65535, 38495, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      33719, 65535, 35209, 65535, 65535, 65535, 65535, 65535, 18651, 65535, 65535, 65535, 23302, 65535, 65535, 65535, 
+      28758, 65535, 65535, 65535, 20458, 32764, 65535, 37466, 65535, 65535, 33290, 23122, 65535, 65535, 65535, 65535, 
+      15061, 12848, 19925, 30926, 33347, 65535, 32551, 14176, 65535, 65535, 65535, 11945, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 38776, 65535, 65535, 10990, 36055, 19067, 32188, 65535, 65535, 10466, 65535, 37195, 65535, 
+      12441, 27446, 65535, 65535, 65535, 65535, 26746, 17046, 65535, 65535, 65535, 65535, 65535, 22517, 1595, 65535, 
+      65535, 65535, 65535, 40610, 65535, 65535, 65535, 65535, 6437, 22580, 65535, 32756, 65535, 65535, 65535, 65535, 
+      38014, 38550, 65535, 5994, 65535, 25661, 65535, 41688, 20826, 65535, 65535, 65535, 32099, 65535, 5694, 65535, 
+      65535, 29948, 24819, 18978, 65535, 65535, 65535, 12058, 65535, 65535, 65535, 31299, 65535, 65535, 35424, 65535, 
+      65535, 13283, 65535, 65535, 65535, 65535, 40060, 65535, 65535, 20512, 65535, 65535, 24146, 65535, 33330, 65535, 
+      65535, 9829, 39184, 27533, 20151, 36338, 37338, 65535, 65535, 23809, 65535, 65535, 22278, 27635, 30412, 16175, 
+      13412, 65535, 41220, 65535, 65535, 65535, 65535, 19738, 65535, 65535, 33721, 65535, 65535, 35434, 41632, 13555 },
+    { 65535, 65535, 65535, 29508, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39860, 65535, 65535, 38209, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32515, 65535, 65535, 65535, 65535, 
+      38164, 41530, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 39329, 65535, 65535, 65535, 65535, 65535, 34644, 38998, 65535, 65535, 65535, 65535, 65535, 65535, 39604, 
+      65535, 65535, 65535, 65535, 38491, 65535, 35655, 31192, 65535, 31247, 65535, 65535, 65535, 32718, 26506, 28223, 
+      65535, 28825, 41600, 27824, 65535, 65535, 25602, 65535, 23930, 24382, 65535, 65535, 23474, 22718, 23795, 31456, 
+      65535, 65535, 65535, 41922, 40033, 19778, 36952, 65535, 17253, 21936, 17076, 65535, 22974, 16995, 22045, 15867, 
+      19451, 17830, 14587, 26632, 17206, 15206, 65535, 27601, 65535, 30400, 15530, 11888, 65535, 19513, 23392, 10664, 
+      65535, 31195, 8370, 11533, 10429, 7595, 30877, 39878, 4363, 10591, 10589, 4885, 12480, 34123, 65535, 12739, 
+      2461, 2206, 7891, 15640, 14017, 65535, 65535, 2025, 65535, 33717, 1326, 23683, 11660, 8241, 9905, 11433, 
+      19416, 19082, 9762, 65535, 10003, 32084, 9845, 17210, 37287, 15322, 9334, 8819, 27367, 11035, 65535, 17164, 
+      10333, 30491, 35307, 40861, 14779, 12576, 12754, 65535, 12614, 12251, 12913, 30766, 12631, 13478, 27845, 13822, 
+      14460, 65535, 23254, 17316, 17123, 18898, 27664, 18186, 20703, 65535, 21954, 23048, 65535, 22829, 37592, 23795, 
+      25900, 65535, 35319, 65535, 65535, 39794, 39574, 38125, 34536, 65535, 24922, 27400, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 35972, 65535, 34113, 65535, 30894, 36409, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 27499, 65535, 65535, 65535, 65535, 65535, 41882, 65535, 65535, 37870, 65535, 65535, 36198, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 30499, 65535, 65535, 65535, 65535, 
+      36168, 39563, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 37571, 65535, 40982, 65535, 65535, 65535, 32838, 37327, 65535, 65535, 65535, 41297, 65535, 65535, 38159, 
+      65535, 65535, 65535, 65535, 37232, 65535, 34266, 29588, 65535, 29792, 65535, 65535, 65535, 31614, 24749, 26719, 
+      65535, 27445, 41527, 26405, 65535, 65535, 23981, 65535, 22193, 22896, 65535, 65535, 21989, 21150, 22785, 31661, 
+      65535, 65535, 65535, 65535, 41165, 18258, 38256, 65535, 16317, 22447, 15714, 65535, 23707, 15428, 22917, 14570, 
+      20109, 16048, 13782, 27966, 15439, 13751, 65535, 29105, 65535, 32039, 16572, 12153, 65535, 20965, 25076, 9419, 
+      65535, 33101, 7653, 9790, 11817, 8303, 32841, 41889, 4461, 8680, 8677, 3781, 10517, 36139, 65535, 14712, 
+      2309, 2496, 9885, 17664, 11997, 65535, 2025, 65535, 65535, 35729, 2098, 25673, 9650, 9977, 11689, 13210, 
+      21270, 20908, 11227, 65535, 11326, 33977, 10994, 18848, 39181, 13346, 9864, 8966, 29082, 9433, 65535, 18399, 
+      9830, 32162, 37056, 65535, 15557, 11096, 11228, 65535, 12545, 11162, 12841, 32310, 12081, 13213, 29230, 13453, 
+      14295, 65535, 24228, 17442, 16827, 18949, 28638, 17985, 20907, 65535, 21971, 23033, 65535, 22623, 38627, 23653, 
+      25990, 65535, 35996, 65535, 65535, 40517, 40229, 38413, 34383, 65535, 23419, 26166, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 41470, 34756, 65535, 32639, 65535, 29146, 34842, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 41501, 27904, 65535, 65535, 65535, 41912, 29979, 65535, 28449, 65535, 40663, 29277, 65535, 28079, 65535, 65535, 
+      38662, 65535, 65535, 15875, 65535, 65535, 33727, 41054, 40009, 35586, 36591, 65535, 65535, 65535, 40394, 65535, 
+      65535, 65535, 65535, 65535, 65535, 37636, 65535, 38805, 65535, 65535, 65535, 36272, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35657, 39297, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      37762, 65535, 38910, 65535, 65535, 65535, 65535, 65535, 23272, 65535, 65535, 65535, 26615, 65535, 65535, 65535, 
+      30761, 65535, 65535, 65535, 23448, 33571, 65535, 37087, 65535, 65535, 33017, 24218, 65535, 65535, 65535, 65535, 
+      16916, 15522, 20143, 29273, 31431, 65535, 29698, 14467, 65535, 65535, 65535, 12325, 65535, 65535, 41745, 65535, 
+      65535, 65535, 65535, 34192, 65535, 65535, 10116, 31306, 15711, 27485, 65535, 65535, 8415, 37095, 31689, 65535, 
+      8534, 21882, 65535, 65535, 65535, 65535, 20858, 11166, 65535, 65535, 65535, 65535, 65535, 16319, 7764, 37666, 
+      65535, 65535, 65535, 34184, 65535, 6437, 65535, 65535, 65535, 16148, 65535, 26336, 65535, 65535, 40958, 39606, 
+      31713, 32271, 65535, 3870, 65535, 19631, 65535, 35526, 15118, 65535, 65535, 65535, 26308, 65535, 6835, 38868, 
+      65535, 24495, 19605, 14214, 65535, 65535, 65535, 9356, 65535, 65535, 65535, 26178, 65535, 65535, 30295, 65535, 
+      65535, 11262, 37701, 65535, 65535, 65535, 35473, 65535, 65535, 18165, 65535, 65535, 21938, 65535, 30279, 65535, 
+      65535, 12951, 36186, 25864, 20227, 34164, 35198, 40673, 65535, 24349, 65535, 65535, 23684, 28294, 31478, 19948, 
+      18184, 65535, 65535, 65535, 65535, 65535, 65535, 23805, 65535, 65535, 36797, 65535, 65535, 38845, 65535, 19558 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 31997, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37141, 65535, 65535, 65535, 37991, 65535, 65535, 65535, 
+      38935, 65535, 65535, 65535, 34808, 38615, 65535, 38610, 65535, 65535, 35743, 32077, 65535, 65535, 65535, 40683, 
+      28044, 28104, 27568, 29693, 30592, 65535, 26870, 24197, 65535, 34927, 65535, 23153, 32735, 65535, 31148, 65535, 
+      33198, 65535, 65535, 25142, 65535, 65535, 20503, 22301, 17546, 19583, 29855, 35419, 18439, 24611, 19873, 41980, 
+      15300, 12243, 38652, 65535, 28735, 33201, 9827, 8760, 35108, 65535, 65535, 37526, 65535, 5541, 23894, 22030, 
+      35171, 34653, 26259, 18176, 65535, 22580, 33717, 35729, 16148, 65535, 33941, 10209, 65535, 26574, 24862, 23557, 
+      15942, 16567, 26747, 17887, 27378, 6848, 28431, 20125, 7660, 65535, 31787, 33620, 13090, 65535, 20851, 24193, 
+      36726, 13185, 11316, 11752, 28915, 65535, 65535, 16758, 34787, 40445, 34835, 15765, 37601, 36100, 18940, 36822, 
+      35617, 18210, 25287, 33798, 37073, 34570, 24962, 36549, 33399, 19864, 35328, 35848, 22168, 37670, 25346, 37268, 
+      35319, 26092, 29967, 25950, 26245, 30564, 31439, 35929, 40449, 29919, 65535, 65535, 31172, 33000, 36288, 32331, 
+      32211, 65535, 65535, 65535, 65535, 65535, 65535, 36028, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35058 },
+    { 65535, 65535, 65535, 29012, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39277, 65535, 65535, 37711, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32288, 65535, 65535, 65535, 65535, 
+      38029, 41486, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 39651, 65535, 65535, 65535, 65535, 65535, 34904, 39422, 65535, 65535, 65535, 65535, 65535, 65535, 40240, 
+      65535, 65535, 65535, 65535, 39265, 65535, 36335, 31686, 65535, 31873, 65535, 65535, 65535, 33586, 26833, 28808, 
+      65535, 29509, 65535, 28478, 65535, 65535, 26079, 65535, 24282, 24981, 65535, 65535, 24074, 23245, 24710, 32759, 
+      65535, 65535, 65535, 65535, 41295, 20347, 38166, 65535, 18197, 23261, 17766, 65535, 24297, 17521, 23359, 16601, 
+      20778, 18129, 15588, 27843, 17524, 15826, 65535, 28739, 65535, 31457, 16827, 13185, 65535, 20687, 24425, 11422, 
+      65535, 31979, 9384, 11884, 11654, 8921, 31554, 40383, 5584, 10710, 10707, 5676, 12484, 34612, 65535, 13441, 
+      3530, 3392, 8572, 16018, 13799, 65535, 1326, 2098, 65535, 33941, 65535, 23819, 11228, 7915, 9643, 11157, 
+      19247, 18868, 9132, 65535, 9252, 31974, 8968, 16754, 37177, 14751, 8153, 7536, 26997, 10050, 65535, 16358, 
+      9011, 30068, 34977, 40630, 13713, 11503, 11707, 65535, 11307, 11020, 11607, 30214, 11309, 12155, 27155, 12496, 
+      13145, 65535, 22295, 16047, 15801, 17617, 26709, 16871, 19455, 65535, 20669, 21759, 65535, 21516, 36675, 22489, 
+      24632, 65535, 34231, 65535, 65535, 38727, 38479, 36909, 33233, 65535, 23824, 26183, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 40822, 34741, 65535, 32986, 65535, 29957, 35332, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 41402, 65535, 65535, 39727, 39314, 65535, 65535, 65535, 38138, 
+      36993, 37512, 35169, 33374, 33328, 41811, 29120, 33043, 36770, 29930, 38653, 32417, 28381, 39445, 26628, 37312, 
+      27553, 41039, 34099, 23122, 40384, 37366, 29919, 21053, 24795, 20140, 23110, 27336, 28011, 19406, 16541, 32689, 
+      24712, 14625, 29422, 34832, 20362, 24260, 12518, 17914, 25526, 34224, 34221, 27775, 36157, 12499, 34093, 13032, 
+      25317, 24805, 16590, 8603, 37618, 32756, 23683, 25673, 26336, 10209, 23819, 65535, 34943, 16366, 14656, 13371, 
+      6300, 6997, 16626, 27792, 17316, 9359, 18406, 10748, 14243, 38139, 21798, 23587, 9206, 32137, 30552, 15372, 
+      26755, 11792, 14239, 18385, 19704, 32697, 33075, 25395, 25146, 30475, 25234, 13974, 27840, 26529, 14859, 27263, 
+      26219, 26350, 18633, 25032, 28061, 26112, 20146, 27791, 25472, 25287, 27571, 28336, 26106, 29906, 24982, 29807, 
+      28697, 35193, 27595, 28812, 32331, 29947, 30532, 33508, 35884, 35122, 65535, 41809, 37203, 37195, 40009, 40671, 
+      41322, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 17849, 33232, 65535, 65535, 65535, 65535, 32451, 65535, 65535, 28238, 65535, 65535, 26549, 
+      65535, 65535, 65535, 65535, 37824, 65535, 65535, 65535, 65535, 65535, 65535, 21162, 65535, 65535, 65535, 65535, 
+      27022, 30643, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 40151, 65535, 65535, 39079, 65535, 65535, 65535, 65535, 41091, 65535, 
+      65535, 30149, 65535, 34302, 65535, 65535, 65535, 25251, 30459, 40375, 65535, 41233, 35894, 39265, 65535, 32587, 
+      65535, 65535, 65535, 40276, 32751, 39708, 29237, 23521, 65535, 24660, 65535, 65535, 65535, 28367, 17917, 21512, 
+      65535, 22951, 65535, 21764, 65535, 65535, 18222, 65535, 15729, 18182, 65535, 65535, 17389, 16079, 20952, 34739, 
+      65535, 65535, 65535, 65535, 65535, 13977, 65535, 65535, 16013, 27508, 13071, 65535, 29494, 11403, 29258, 12661, 
+      25915, 10040, 14797, 35678, 9704, 11053, 65535, 37365, 65535, 40690, 23918, 17719, 65535, 29289, 33982, 9985, 
+      65535, 65535, 11523, 6672, 20395, 15843, 65535, 65535, 12105, 4578, 4577, 9481, 4011, 65535, 65535, 24341, 
+      10937, 11414, 19533, 27239, 3198, 65535, 11660, 9650, 65535, 65535, 11228, 34943, 65535, 18660, 20409, 21830, 
+      29920, 29445, 19040, 65535, 18711, 65535, 17913, 26695, 65535, 3871, 15181, 13391, 36891, 5437, 65535, 24731, 
+      11513, 39664, 65535, 65535, 20505, 6895, 6612, 65535, 14930, 9380, 15123, 39192, 12581, 14580, 35494, 14294, 
+      15784, 65535, 29005, 19479, 17126, 20402, 33082, 18487, 22731, 65535, 22820, 23592, 65535, 22353, 65535, 23552, 
+      26684, 65535, 38564, 65535, 65535, 65535, 65535, 38980, 33183, 65535, 16365, 20358, 65535, 65535, 65535, 65535, 
+      65535, 41191, 65535, 37357, 28498, 65535, 25243, 65535, 20531, 26923, 65535, 41168, 35143, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 35942, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39814, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 39425, 65535, 39397, 65535, 65535, 65535, 40423, 34717, 36414, 
+      65535, 36917, 65535, 35954, 65535, 65535, 33841, 65535, 32152, 32569, 65535, 65535, 31663, 30945, 31450, 35903, 
+      65535, 65535, 65535, 41644, 40324, 27991, 36534, 65535, 24913, 25896, 25205, 65535, 26046, 25228, 24646, 23954, 
+      23102, 26021, 22130, 26689, 25408, 23402, 65535, 26612, 38673, 28363, 18160, 17555, 65535, 19577, 21531, 18771, 
+      40451, 26883, 16087, 19744, 12572, 12977, 25883, 33776, 11717, 18624, 18621, 13056, 20365, 28040, 65535, 9377, 
+      10495, 10071, 6181, 9724, 21491, 65535, 8241, 9977, 65535, 26574, 7915, 16366, 18660, 65535, 1754, 3244, 
+      11363, 10961, 2526, 65535, 3428, 24104, 4249, 8995, 29299, 21773, 6879, 8176, 19130, 15887, 65535, 9817, 
+      11353, 22251, 27086, 32715, 9384, 16674, 17018, 40467, 11215, 14872, 11440, 22593, 13103, 12616, 19896, 13284, 
+      12959, 40904, 16392, 14095, 15627, 15740, 20650, 16134, 16732, 37339, 18570, 19685, 36379, 20237, 30229, 20855, 
+      21903, 65535, 28921, 37129, 65535, 33163, 33132, 32824, 30925, 65535, 27873, 28830, 65535, 65535, 65535, 65535, 
+      65535, 40718, 65535, 40202, 36796, 65535, 36372, 65535, 34939, 39094, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 37627, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41558, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 41047, 65535, 40943, 65535, 65535, 65535, 41765, 36408, 37992, 
+      65535, 38432, 65535, 37492, 65535, 65535, 35476, 65535, 33835, 34148, 65535, 65535, 33243, 32563, 32804, 36378, 
+      65535, 65535, 65535, 41016, 39825, 29595, 35930, 65535, 26296, 26382, 26759, 65535, 26334, 26856, 24855, 25491, 
+      23568, 27720, 23496, 26314, 27102, 24997, 65535, 26017, 37349, 27526, 18528, 18561, 65535, 19352, 20841, 20331, 
+      38884, 25618, 17547, 21432, 13077, 14068, 24501, 32176, 13175, 20352, 20350, 14665, 22108, 26464, 65535, 8819, 
+      12091, 11647, 6560, 8412, 23246, 65535, 9905, 11689, 40958, 24862, 9643, 14656, 20409, 1754, 65535, 1529, 
+      9615, 9224, 2805, 65535, 3815, 22354, 4889, 7463, 27551, 23491, 7989, 9486, 17471, 17530, 65535, 8950, 
+      12709, 20622, 25402, 30994, 9407, 18241, 18596, 38732, 12181, 16314, 12379, 21064, 14307, 13613, 18535, 14311, 
+      13816, 39191, 15583, 14513, 16381, 16113, 19718, 16753, 16862, 35757, 18804, 19897, 34912, 20622, 29087, 21144, 
+      21904, 65535, 28127, 35823, 65535, 32261, 32290, 32323, 30887, 65535, 29169, 29872, 65535, 65535, 65535, 65535, 
+      65535, 40617, 65535, 40447, 37645, 65535, 37482, 65535, 36340, 40254, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 38902, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37935, 39506, 
+      65535, 39926, 65535, 38994, 65535, 65535, 37002, 65535, 35363, 35662, 65535, 65535, 34758, 34086, 34231, 37239, 
+      65535, 65535, 65535, 40939, 39872, 31116, 35892, 65535, 27742, 27280, 28269, 65535, 27086, 28382, 25553, 26995, 
+      24462, 29246, 24936, 26522, 28628, 26517, 65535, 26026, 36570, 27296, 19377, 19825, 41133, 19731, 20789, 21843, 
+      37799, 24939, 19030, 22959, 14065, 15394, 23686, 31053, 14663, 21866, 21863, 16190, 23608, 25385, 65535, 9059, 
+      13614, 13166, 7589, 7833, 24703, 65535, 11433, 13210, 39606, 23557, 11157, 13371, 21830, 3244, 1529, 65535, 
+      8129, 7717, 3416, 40702, 4308, 20869, 5453, 5995, 26061, 24836, 8776, 10419, 15944, 18766, 65535, 7991, 
+      13646, 19099, 23873, 29475, 9212, 19377, 19746, 37223, 12756, 17316, 12926, 19574, 15080, 14198, 17136, 14916, 
+      14271, 37669, 14587, 14565, 16714, 16106, 18606, 16959, 16635, 34244, 18649, 19714, 33443, 20587, 27806, 21021, 
+      21527, 65535, 27089, 34435, 40927, 31135, 31207, 31492, 30436, 65535, 29968, 30405, 65535, 65535, 65535, 65535, 
+      65535, 40082, 65535, 40205, 37963, 65535, 38062, 65535, 37239, 40879, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41790, 40963, 40254, 
+      65535, 65535, 41410, 38694, 38310, 38794, 34090, 39332, 34715, 30964, 35805, 38655, 29986, 36158, 28259, 34489, 
+      28281, 37238, 31915, 26578, 36608, 34202, 36118, 25078, 31057, 25000, 23308, 25863, 34162, 21273, 19999, 29470, 
+      30894, 20438, 26427, 30935, 19133, 21961, 18542, 24103, 22167, 29947, 29945, 24011, 31722, 18788, 39450, 11970, 
+      21439, 20959, 13703, 7665, 32826, 38014, 19416, 21270, 31713, 15942, 19247, 6300, 29920, 11363, 9615, 8129, 
+      65535, 703, 10980, 32617, 11511, 12741, 12526, 4450, 17937, 32793, 15856, 17703, 8475, 26522, 35056, 9146, 
+      20786, 11730, 16058, 21451, 13404, 26884, 27279, 29134, 18945, 24504, 19018, 12893, 21704, 20305, 11873, 21037, 
+      19950, 29664, 13338, 18750, 21760, 19872, 15849, 21502, 19367, 26858, 21489, 22319, 26650, 23794, 22953, 23784, 
+      22994, 38918, 24121, 28420, 33790, 27320, 27690, 29626, 30840, 35782, 36155, 35525, 38317, 37034, 39353, 65535, 
+      65535, 39506, 41613, 41212, 41852, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41554, 40907, 40596, 
+      65535, 65535, 65535, 39340, 38929, 38562, 34712, 40021, 34610, 31220, 35601, 39332, 30305, 35899, 28587, 34293, 
+      28515, 36912, 31805, 27085, 36286, 33963, 36788, 25637, 31760, 25625, 23509, 25862, 34824, 21655, 20528, 29239, 
+      31561, 21128, 26236, 30612, 19200, 21879, 19241, 24774, 21947, 29576, 29574, 23728, 31325, 19478, 39997, 12138, 
+      21151, 20678, 13611, 7957, 32378, 38550, 19082, 20908, 32271, 16567, 18868, 6997, 29445, 10961, 9224, 7717, 
+      703, 65535, 10456, 33108, 10950, 13172, 11945, 3751, 18352, 32267, 15254, 17110, 8574, 25963, 35504, 8444, 
+      20172, 11823, 16296, 21782, 12710, 26292, 26690, 29508, 18284, 23886, 18353, 12845, 21056, 19638, 11597, 20369, 
+      19270, 29988, 12738, 18048, 21064, 19168, 15365, 20801, 18671, 26998, 20794, 21628, 26676, 23097, 22705, 23092, 
+      22331, 39265, 23700, 28332, 33890, 26984, 27329, 29145, 30235, 35785, 35473, 34823, 38364, 36941, 39197, 65535, 
+      65535, 38970, 41217, 40599, 41155, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 35714, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40006, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 40810, 65535, 40986, 65535, 65535, 65535, 65535, 35856, 37935, 
+      65535, 38585, 65535, 37575, 65535, 65535, 35202, 65535, 33336, 34103, 65535, 65535, 33195, 32377, 33416, 38420, 
+      65535, 65535, 65535, 65535, 65535, 29475, 38708, 65535, 26859, 28415, 26834, 65535, 28571, 26653, 27163, 25629, 
+      25623, 27160, 24114, 29011, 26573, 24935, 65535, 28789, 39970, 30331, 20686, 19906, 65535, 21968, 23631, 20426, 
+      41174, 28300, 17965, 20979, 15095, 15294, 27090, 34412, 13647, 19631, 19629, 14646, 21214, 28769, 65535, 11558, 
+      12167, 11800, 8699, 11122, 22043, 65535, 9762, 11227, 65535, 26747, 9132, 16626, 19040, 2526, 2805, 3416, 
+      10980, 10456, 65535, 65535, 1014, 23567, 2098, 7747, 28698, 21814, 5361, 7022, 18039, 15575, 65535, 7570, 
+      10242, 21024, 26042, 31839, 6876, 16071, 16450, 39677, 9422, 13928, 9609, 21084, 11671, 10860, 18083, 11568, 
+      11023, 39944, 14036, 11768, 13576, 13388, 18356, 13958, 14269, 35889, 16150, 17257, 34667, 17897, 28084, 18464, 
+      19408, 65535, 26521, 35157, 65535, 30818, 30750, 30318, 28426, 65535, 26559, 27110, 65535, 65535, 65535, 65535, 
+      65535, 38210, 65535, 37802, 34841, 65535, 34741, 65535, 33823, 37535, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 37939, 24871, 65535, 65535, 65535, 38560, 27074, 65535, 25754, 65535, 37603, 26771, 65535, 25853, 65535, 65535, 
+      36177, 65535, 39857, 14569, 65535, 65535, 31957, 39188, 38191, 33993, 35193, 65535, 65535, 65535, 39168, 65535, 
+      65535, 65535, 65535, 65535, 65535, 37191, 65535, 38445, 65535, 65535, 65535, 35981, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35902, 39688, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      39479, 65535, 40853, 65535, 65535, 65535, 65535, 65535, 24519, 65535, 65535, 65535, 28715, 65535, 65535, 65535, 
+      33530, 65535, 65535, 65535, 25690, 36809, 65535, 40673, 65535, 65535, 36557, 27282, 65535, 65535, 65535, 65535, 
+      19582, 17795, 23446, 33053, 35249, 65535, 33567, 17647, 65535, 65535, 65535, 15415, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 37842, 65535, 65535, 13508, 34922, 19580, 31137, 65535, 65535, 12034, 40325, 34956, 65535, 
+      12403, 25205, 65535, 65535, 65535, 65535, 23946, 14457, 65535, 65535, 65535, 65535, 65535, 19107, 7589, 39868, 
+      65535, 65535, 65535, 36051, 65535, 5994, 65535, 65535, 3870, 17887, 65535, 27792, 65535, 65535, 65535, 40702, 
+      32617, 33108, 65535, 65535, 65535, 20020, 65535, 36064, 15022, 65535, 65535, 65535, 26253, 65535, 3248, 38895, 
+      65535, 23998, 18844, 12984, 65535, 65535, 65535, 6428, 65535, 65535, 65535, 25307, 65535, 65535, 29431, 65535, 
+      65535, 8047, 36840, 65535, 65535, 65535, 34116, 65535, 65535, 15257, 65535, 65535, 19010, 65535, 27852, 65535, 
+      65535, 9334, 33762, 22742, 16530, 31318, 32343, 37811, 65535, 20601, 65535, 65535, 19834, 24548, 27687, 16321, 
+      14957, 65535, 38294, 65535, 65535, 65535, 65535, 20206, 65535, 65535, 32952, 65535, 65535, 35029, 40713, 17178 },
+    { 65535, 65535, 65535, 35116, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39545, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 40841, 65535, 41117, 65535, 65535, 65535, 65535, 35783, 38037, 
+      65535, 38761, 65535, 37729, 65535, 65535, 35232, 65535, 33289, 34220, 65535, 65535, 33313, 32447, 33766, 39234, 
+      65535, 65535, 65535, 65535, 65535, 29578, 39722, 65535, 27211, 29237, 27015, 65535, 29452, 26736, 28066, 25837, 
+      26456, 27110, 24494, 30011, 26537, 25075, 65535, 29803, 40877, 31340, 21556, 20539, 65535, 22953, 24645, 20642, 
+      41941, 29240, 18308, 20995, 15940, 15913, 27990, 35164, 14042, 19554, 19551, 14863, 21063, 29555, 65535, 12569, 
+      12445, 12110, 9605, 12085, 21767, 65535, 10003, 11326, 65535, 27378, 9252, 17316, 18711, 3428, 3815, 4308, 
+      11511, 10950, 1014, 65535, 65535, 23961, 1146, 7985, 29052, 21346, 4522, 6271, 18229, 15013, 65535, 7169, 
+      9460, 21139, 26220, 32073, 5964, 15409, 15797, 39929, 8461, 13171, 8640, 21060, 10787, 9902, 17905, 10616, 
+      10032, 40124, 13474, 10762, 12569, 12387, 17839, 12944, 13309, 35853, 15169, 16280, 34499, 16895, 27661, 17474, 
+      18475, 65535, 25887, 34837, 65535, 30232, 30131, 29539, 27497, 65535, 25669, 26138, 65535, 65535, 65535, 65535, 
+      65535, 37293, 65535, 36817, 33837, 65535, 33779, 65535, 32972, 36584, 65535, 65535, 41429, 65535, 65535, 65535 },
+    { 65535, 41703, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 34575, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 40845, 65535, 65535, 65535, 65535, 65535, 65535, 38682, 65535, 65535, 65535, 65535, 
+      33960, 33620, 34129, 36443, 37207, 65535, 33339, 30271, 65535, 38594, 65535, 28940, 36750, 65535, 35040, 65535, 
+      36424, 65535, 65535, 30150, 65535, 65535, 26228, 27548, 24316, 25404, 32260, 36695, 24068, 27962, 24089, 41742, 
+      21224, 18296, 38540, 65535, 29720, 33528, 15782, 15209, 34472, 65535, 65535, 36531, 65535, 12286, 27173, 22370, 
+      33990, 33493, 25616, 17861, 65535, 25661, 32084, 33977, 19631, 6848, 31974, 9359, 65535, 24104, 22354, 20869, 
+      12741, 13172, 23567, 20020, 23961, 65535, 24862, 16051, 5205, 65535, 27992, 29877, 6898, 38857, 22334, 19248, 
+      32721, 6361, 5413, 9073, 24080, 38954, 39368, 16465, 30245, 36332, 30234, 8920, 33156, 31420, 12266, 32100, 
+      30735, 17188, 19056, 28383, 31762, 28912, 18257, 31047, 27463, 16071, 29258, 29657, 17368, 31551, 18821, 31026, 
+      28827, 26298, 23174, 20634, 23067, 24068, 24891, 29173, 33606, 26096, 65535, 65535, 27988, 28555, 31614, 31405, 
+      32341, 39264, 37888, 65535, 65535, 65535, 65535, 34673, 65535, 65535, 40988, 65535, 65535, 65535, 65535, 36313 },
+    { 65535, 65535, 65535, 34094, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38615, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 40348, 65535, 40729, 65535, 65535, 65535, 65535, 35194, 37623, 
+      65535, 38425, 65535, 37370, 65535, 65535, 34747, 65535, 32729, 33827, 65535, 65535, 32923, 32008, 33638, 39740, 
+      65535, 65535, 65535, 65535, 65535, 29178, 40722, 65535, 27098, 29769, 26706, 65535, 30088, 26320, 28745, 25560, 
+      27009, 26556, 24421, 30934, 25998, 24725, 65535, 30799, 65535, 32406, 22181, 20803, 65535, 23825, 25669, 20389, 
+      65535, 30380, 18210, 20523, 16537, 16175, 29136, 36274, 14028, 18992, 18989, 14637, 20423, 30679, 65535, 13553, 
+      12306, 12010, 10337, 13215, 21010, 65535, 9845, 10994, 65535, 28431, 8968, 18406, 17913, 4249, 4889, 5453, 
+      12526, 11945, 2098, 65535, 1146, 24862, 65535, 8826, 29916, 20427, 3400, 5191, 18979, 14035, 65535, 7409, 
+      8352, 21814, 26943, 32836, 5397, 14361, 14755, 40699, 7327, 12070, 7512, 21604, 9643, 8767, 18301, 9478, 
+      8928, 40830, 13430, 9846, 11503, 11493, 17832, 11930, 12554, 36357, 14346, 15465, 34866, 15988, 27747, 16614, 
+      17776, 65535, 25695, 35033, 65535, 30099, 29951, 29117, 26794, 65535, 24524, 25013, 65535, 65535, 65535, 65535, 
+      65535, 36606, 41754, 35959, 32758, 41611, 32648, 65535, 31832, 35447, 65535, 65535, 40366, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41030, 41564, 65535, 65535, 40657, 39928, 40220, 65535, 
+      65535, 65535, 65535, 65535, 65535, 36981, 37835, 65535, 33736, 32310, 34196, 65535, 31744, 34205, 30094, 32938, 
+      29520, 34865, 30930, 29580, 34268, 32396, 40470, 28435, 35500, 28798, 24412, 25652, 38480, 23541, 23206, 27762, 
+      35239, 24723, 25010, 28637, 19490, 21315, 22915, 28466, 20638, 27361, 27358, 22049, 28961, 23221, 65535, 13203, 
+      19490, 19064, 13253, 9883, 29747, 41688, 17210, 18848, 35526, 20125, 16754, 10748, 26695, 8995, 7463, 5995, 
+      4450, 3751, 7747, 36064, 7985, 16051, 8826, 65535, 21090, 29245, 11956, 13839, 10292, 22808, 38254, 4794, 
+      16773, 13316, 18296, 24103, 8965, 22973, 23381, 31952, 14663, 20453, 14713, 13607, 17487, 15986, 11197, 16711, 
+      15566, 32197, 10079, 14304, 17315, 15454, 13475, 17053, 15070, 28346, 17201, 18082, 27452, 19473, 22070, 19535, 
+      19029, 41515, 22033, 28488, 34957, 25777, 25968, 27035, 27316, 36328, 31755, 31077, 39105, 36960, 38856, 65535, 
+      65535, 36450, 39512, 37589, 37530, 41116, 38690, 65535, 39264, 41620, 65535, 65535, 65535, 65535, 65535, 65535 },
+    { 65535, 36676, 65535, 65535, 65535, 65535, 39122, 65535, 38499, 65535, 65535, 39909, 65535, 39591, 65535, 65535, 
+      65535, 65535, 65535, 29510, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38302, 65535, 65535, 65535, 40850, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 37590, 65535, 65535, 65535, 65535, 65535, 65535, 36436, 65535, 65535, 65535, 65535, 
+      30703, 29967, 31875, 36345, 37553, 65535, 34078, 27301, 65535, 65535, 65535, 25670, 40177, 65535, 38540, 65535, 
+      40333, 65535, 65535, 32782, 65535, 65535, 22980, 29957, 22966, 27209, 36545, 41437, 20803, 31740, 27303, 65535, 
+      18409, 19856, 65535, 65535, 34500, 38502, 17476, 13581, 39613, 65535, 65535, 41712, 65535, 12835, 22379, 27255, 
+      39178, 38679, 30720, 22839, 65535, 20826, 37287, 39181, 15118, 7660, 37177, 14243, 65535, 29299, 27551, 26061, 
+      17937, 18352, 28698, 15022, 29052, 5205, 29916, 21090, 65535, 65535, 32964, 34846, 11275, 65535, 17185, 23919, 
+      37587, 9414, 5021, 4351, 28716, 65535, 65535, 11277, 34930, 41124, 34893, 11344, 37849, 36025, 15360, 36677, 
+      35246, 12109, 22683, 32592, 35991, 32916, 20946, 35143, 31227, 12288, 32832, 33066, 14515, 35018, 18706, 34336, 
+      31758, 21116, 23974, 18359, 18936, 23754, 24703, 29639, 35077, 22413, 65535, 65535, 23902, 25373, 28640, 26434, 
+      27187, 39141, 36368, 65535, 65535, 41308, 65535, 29841, 65535, 65535, 37516, 65535, 65535, 40016, 65535, 31108 },
+    { 65535, 65535, 65535, 14280, 29363, 65535, 65535, 41418, 65535, 28614, 65535, 65535, 24542, 65535, 65535, 22968, 
+      65535, 65535, 65535, 65535, 34385, 65535, 65535, 65535, 65535, 65535, 65535, 18200, 65535, 65535, 65535, 65535, 
+      24179, 27949, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 38234, 65535, 65535, 37285, 65535, 65535, 65535, 65535, 39744, 65535, 
+      65535, 28512, 65535, 32985, 65535, 65535, 65535, 23655, 29144, 39577, 41998, 40622, 35196, 38823, 65535, 31907, 
+      65535, 65535, 65535, 40294, 32602, 40006, 28949, 22926, 65535, 24514, 65535, 65535, 65535, 28949, 17172, 21492, 
+      65535, 23212, 65535, 22020, 65535, 65535, 18111, 65535, 15392, 18639, 65535, 65535, 17966, 16525, 22494, 37410, 
+      65535, 65535, 65535, 65535, 65535, 15043, 65535, 65535, 18434, 30849, 14962, 65535, 32957, 12932, 32832, 14877, 
+      29434, 10732, 17687, 39437, 10630, 13195, 65535, 41190, 65535, 65535, 27694, 21356, 65535, 33137, 37853, 13242, 
+      65535, 65535, 15181, 9564, 24266, 19694, 65535, 65535, 15976, 7828, 7829, 13348, 6402, 65535, 65535, 28056, 
+      14769, 15236, 23213, 30739, 4028, 65535, 15322, 13346, 65535, 65535, 14751, 38139, 3871, 21773, 23491, 24836, 
+      32793, 32267, 21814, 65535, 21346, 65535, 20427, 29245, 65535, 65535, 17368, 15492, 39209, 6543, 65535, 26706, 
+      12984, 41773, 65535, 65535, 22155, 7059, 6649, 65535, 16125, 9926, 16256, 40999, 13393, 15431, 37100, 14975, 
+      16532, 65535, 30174, 20084, 17244, 20701, 33962, 18557, 23017, 65535, 22704, 23310, 65535, 21807, 65535, 23001, 
+      26287, 65535, 38464, 65535, 65535, 65535, 65535, 38049, 31754, 65535, 13216, 17580, 65535, 65535, 65535, 65535, 
+      65535, 38990, 65535, 34735, 25328, 65535, 21751, 65535, 16741, 23263, 65535, 37892, 31649, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 30795, 41253, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39952, 65535, 65535, 39023, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35480, 65535, 65535, 65535, 65535, 
+      41483, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 40426, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 38242, 65535, 38897, 65535, 65535, 65535, 41304, 32869, 35742, 
+      65535, 36750, 65535, 35642, 65535, 65535, 32699, 65535, 30496, 32033, 65535, 65535, 31144, 30104, 32585, 40535, 
+      65535, 65535, 65535, 65535, 65535, 27408, 65535, 65535, 26164, 30743, 25217, 65535, 31391, 24535, 30199, 24179, 
+      28084, 24391, 23646, 33199, 23879, 23145, 65535, 33342, 65535, 35224, 23548, 21093, 65535, 25971, 28341, 19161, 
+      65535, 33606, 17486, 18661, 17926, 16580, 32443, 39673, 13696, 16897, 16895, 13646, 18089, 34075, 65535, 16189, 
+      11683, 11522, 12314, 16401, 18352, 65535, 9334, 9864, 65535, 31787, 8153, 21798, 15181, 6879, 7989, 8776, 
+      15856, 15254, 5361, 65535, 4522, 27992, 3400, 11956, 32964, 17368, 65535, 1885, 21852, 10873, 65535, 9558, 
+      4957, 24515, 29713, 35669, 5788, 11044, 11446, 65535, 4378, 8679, 4625, 24023, 6323, 5749, 20421, 6406, 
+      6208, 65535, 14575, 8204, 8962, 9854, 18945, 9681, 11455, 38573, 12895, 14018, 36747, 14136, 28948, 14952, 
+      16712, 65535, 26132, 36459, 65535, 30653, 30368, 28796, 25559, 65535, 21207, 21954, 65535, 65535, 65535, 65535, 
+      65535, 35328, 41135, 34069, 29952, 40334, 29521, 65535, 28465, 32273, 65535, 41032, 37611, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 28930, 39768, 65535, 65535, 65535, 65535, 40679, 65535, 65535, 38172, 65535, 65535, 37197, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33595, 65535, 65535, 65535, 65535, 
+      39598, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 38641, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41957, 36609, 65535, 37365, 65535, 65535, 65535, 40010, 31172, 34200, 
+      65535, 35288, 65535, 34161, 65535, 65535, 31102, 65535, 28836, 30538, 65535, 65535, 29659, 28571, 31413, 40267, 
+      65535, 65535, 65535, 65535, 65535, 25941, 65535, 65535, 25089, 30642, 23886, 65535, 31479, 23076, 30386, 22904, 
+      28063, 22775, 22670, 33880, 22283, 21785, 65535, 34217, 65535, 36298, 23742, 20707, 65535, 26620, 29335, 18005, 
+      65535, 35052, 16610, 17206, 18206, 16331, 33986, 41425, 13110, 15352, 15350, 12701, 16435, 35791, 65535, 17251, 
+      10998, 10918, 13055, 17862, 16576, 65535, 8819, 8966, 65535, 33620, 7536, 23587, 13391, 8176, 9486, 10419, 
+      17703, 17110, 7022, 65535, 6271, 29877, 5191, 13839, 34846, 15492, 1885, 65535, 23721, 8989, 65535, 11346, 
+      3229, 26355, 31561, 37524, 7265, 9182, 9580, 65535, 3865, 6908, 4160, 25802, 4971, 4969, 22133, 5499, 
+      5763, 65535, 16024, 8517, 8521, 10081, 20334, 9461, 11954, 40267, 13135, 14229, 38333, 14074, 30306, 15002, 
+      17099, 65535, 27179, 37876, 65535, 31723, 31377, 29452, 25731, 65535, 19706, 20779, 65535, 65535, 65535, 65535, 
+      65535, 35399, 41551, 33760, 28977, 40375, 28242, 65535, 26857, 30934, 65535, 40430, 36650, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 40608, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      40814, 40517, 40658, 41458, 41784, 65535, 37663, 37079, 65535, 38631, 65535, 35809, 37303, 65535, 35546, 65535, 
+      36085, 65535, 40375, 32322, 65535, 65535, 33102, 30185, 30551, 28940, 31300, 34311, 30948, 28337, 25747, 37732, 
+      28048, 22596, 34783, 38868, 27505, 30433, 20175, 21801, 30467, 37645, 37642, 32129, 39253, 17976, 33653, 20190, 
+      29551, 29095, 22170, 15648, 39984, 32099, 27367, 29082, 26308, 13090, 26997, 9206, 36891, 19130, 17471, 15944, 
+      8475, 8574, 18039, 26253, 18229, 6898, 18979, 10292, 11275, 39209, 21852, 23721, 65535, 32683, 28186, 12648, 
+      26358, 3255, 8003, 13857, 17441, 32581, 33002, 21721, 23655, 29860, 23618, 4841, 26574, 24757, 6169, 25416, 
+      24003, 21906, 12245, 21516, 24905, 22016, 12091, 24161, 20579, 18429, 22405, 22848, 18205, 24717, 15787, 24243, 
+      22230, 31223, 18620, 20240, 25322, 20748, 21353, 24633, 27940, 27356, 39318, 37335, 29849, 28826, 31365, 35215, 
+      36931, 34923, 35235, 37990, 41657, 38629, 65535, 37941, 65535, 65535, 41077, 65535, 65535, 65535, 65535, 41528 },
+    { 65535, 65535, 65535, 20145, 33100, 65535, 65535, 65535, 65535, 33179, 65535, 65535, 29887, 65535, 65535, 28639, 
+      65535, 65535, 65535, 65535, 40190, 65535, 65535, 65535, 65535, 65535, 65535, 24610, 65535, 65535, 65535, 65535, 
+      30612, 34426, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 34952, 65535, 39313, 65535, 65535, 65535, 30069, 35462, 65535, 65535, 65535, 41181, 65535, 65535, 37872, 
+      65535, 65535, 65535, 65535, 38159, 65535, 34616, 28808, 65535, 30055, 65535, 65535, 65535, 33791, 23127, 26919, 
+      65535, 28385, 65535, 27197, 65535, 65535, 23604, 65535, 21050, 23619, 65535, 65535, 22825, 21514, 26177, 38936, 
+      65535, 65535, 65535, 65535, 65535, 19384, 65535, 65535, 20801, 30745, 18254, 65535, 32390, 16743, 31835, 17685, 
+      28744, 15474, 19157, 37346, 15140, 16165, 65535, 38538, 65535, 41429, 25781, 20449, 65535, 30396, 34427, 14088, 
+      65535, 41924, 14552, 11502, 21246, 17406, 41328, 65535, 13389, 9294, 9292, 11288, 9349, 65535, 65535, 23372, 
+      11525, 11850, 18535, 25340, 8468, 65535, 11035, 9433, 65535, 65535, 10050, 32137, 5437, 15887, 17530, 18766, 
+      26522, 25963, 15575, 65535, 15013, 38857, 14035, 22808, 65535, 6543, 10873, 8989, 32683, 65535, 65535, 20164, 
+      6467, 35230, 40453, 65535, 15641, 1890, 1872, 65535, 9730, 3945, 9892, 34486, 7200, 9227, 30627, 8894, 
+      10409, 65535, 23854, 14088, 11693, 14970, 27815, 13055, 17301, 65535, 17395, 18189, 65535, 17018, 37364, 18211, 
+      21291, 65535, 33128, 65535, 65535, 37570, 36985, 33682, 28152, 65535, 13995, 17045, 65535, 65535, 65535, 65535, 
+      65535, 36664, 65535, 33356, 25589, 41195, 23220, 65535, 19909, 25412, 65535, 38195, 32841, 65535, 65535, 65535 },
+    { 34733, 21656, 41306, 65535, 65535, 35314, 23887, 65535, 22635, 65535, 34372, 23721, 65535, 22934, 65535, 65535, 
+      33103, 65535, 36762, 12430, 65535, 65535, 29229, 36368, 35399, 31346, 32647, 65535, 65535, 40669, 36691, 65535, 
+      65535, 65535, 65535, 65535, 40546, 35227, 65535, 36525, 65535, 65535, 65535, 34138, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34451, 38299, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      39213, 65535, 40782, 65535, 65535, 65535, 65535, 65535, 24092, 65535, 65535, 65535, 28980, 65535, 65535, 65535, 
+      34414, 65535, 65535, 65535, 26152, 38227, 65535, 65535, 65535, 65535, 38422, 28591, 65535, 65535, 65535, 65535, 
+      20611, 18499, 25104, 35411, 37704, 65535, 36303, 19273, 65535, 65535, 65535, 17007, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 41004, 65535, 65535, 15489, 38100, 22354, 34296, 65535, 65535, 14335, 65535, 38204, 65535, 
+      15206, 28448, 65535, 65535, 65535, 65535, 27191, 17696, 65535, 65535, 65535, 65535, 65535, 22328, 7106, 65535, 
+      65535, 65535, 65535, 38943, 65535, 5694, 65535, 65535, 6835, 20851, 65535, 30552, 65535, 65535, 65535, 65535, 
+      35056, 35504, 65535, 3248, 65535, 22334, 65535, 38254, 17185, 65535, 65535, 65535, 28186, 65535, 65535, 40720, 
+      65535, 25667, 20444, 14460, 65535, 65535, 65535, 6844, 65535, 65535, 65535, 26670, 65535, 65535, 30727, 65535, 
+      65535, 7734, 38031, 65535, 65535, 65535, 34931, 65535, 65535, 14879, 65535, 65535, 18472, 65535, 27725, 65535, 
+      65535, 6132, 33545, 21842, 14692, 30644, 31644, 37034, 65535, 18550, 65535, 65535, 17398, 22461, 25440, 13134, 
+      11721, 65535, 36195, 65535, 65535, 41942, 65535, 17007, 65535, 65535, 30043, 65535, 65535, 32043, 37878, 14261 },
+    { 65535, 65535, 65535, 39353, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39980, 41225, 65535, 65535, 40323, 39385, 40934, 65535, 
+      65535, 65535, 65535, 65535, 65535, 36576, 65535, 65535, 34378, 35267, 34113, 65535, 35056, 33713, 33500, 32959, 
+      32448, 33833, 31654, 33830, 33295, 32134, 65535, 32904, 40167, 33479, 27368, 27371, 65535, 27398, 27637, 27777, 
+      39469, 29514, 25475, 27892, 22008, 22791, 27679, 32766, 21192, 26282, 26280, 22008, 27593, 27730, 65535, 16752, 
+      19612, 19279, 15495, 14177, 27907, 65535, 17164, 18399, 38868, 24193, 16358, 15372, 24731, 9817, 8950, 7991, 
+      9146, 8444, 7570, 38895, 7169, 19248, 7409, 4794, 23919, 26706, 9558, 11346, 12648, 20164, 40720, 65535, 
+      13758, 15067, 20290, 26273, 4833, 19954, 20377, 34083, 11019, 17214, 10995, 14465, 13937, 12172, 10941, 12856, 
+      11522, 33984, 6633, 9709, 12895, 10741, 10833, 12479, 10275, 29075, 12407, 13296, 27467, 14681, 20517, 14745, 
+      14385, 65535, 19178, 27672, 35114, 23357, 23354, 23512, 22945, 35767, 27476, 26460, 38726, 35721, 37128, 65535, 
+      65535, 32370, 36217, 33080, 32741, 37191, 34017, 65535, 34986, 36954, 65535, 41052, 39803, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 25933, 36576, 65535, 65535, 65535, 65535, 37450, 65535, 65535, 34996, 65535, 65535, 34083, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 30826, 65535, 65535, 65535, 65535, 
+      36827, 40691, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 41413, 65535, 65535, 65535, 65535, 65535, 36526, 41882, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 40667, 35031, 65535, 36071, 65535, 65535, 65535, 39285, 29424, 32905, 
+      65535, 34196, 65535, 33031, 65535, 65535, 29673, 65535, 27234, 29405, 65535, 65535, 28560, 27353, 31051, 41485, 
+      65535, 65535, 65535, 65535, 65535, 24936, 65535, 65535, 25020, 32210, 23255, 65535, 33307, 22133, 32359, 22426, 
+      29774, 21381, 22846, 36433, 20960, 21121, 65535, 36970, 65535, 39229, 25791, 21975, 65535, 29180, 32217, 17902, 
+      65535, 38235, 17127, 16392, 20438, 17903, 37204, 65535, 14268, 14331, 14329, 13235, 15030, 39007, 65535, 20242, 
+      12096, 12155, 15836, 21065, 14692, 65535, 10333, 9830, 65535, 36726, 9011, 26755, 11513, 11353, 12709, 13646, 
+      20786, 20172, 10242, 65535, 9460, 32721, 8352, 16773, 37587, 12984, 4957, 3229, 26358, 6467, 65535, 13758, 
+      65535, 28816, 34041, 40025, 9175, 6236, 6654, 65535, 3460, 3723, 3687, 28021, 2299, 3545, 24163, 3653, 
+      4746, 65535, 17495, 8337, 7040, 9595, 21585, 8268, 11800, 65535, 12468, 13462, 39880, 12856, 31354, 13932, 
+      16526, 65535, 27607, 38991, 65535, 32139, 31674, 29105, 24607, 65535, 16523, 17856, 65535, 65535, 65535, 65535, 
+      65535, 33999, 40649, 31812, 26221, 38885, 25195, 65535, 23632, 27835, 65535, 38050, 33875, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 38084, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      39902, 39316, 40421, 65535, 65535, 65535, 39150, 36336, 65535, 41590, 65535, 34859, 40145, 65535, 38390, 65535, 
+      39102, 65535, 65535, 34677, 65535, 65535, 32147, 32360, 30676, 30747, 34396, 37553, 29968, 31164, 28209, 40925, 
+      27304, 23992, 38007, 41952, 30726, 33689, 21496, 21523, 33679, 40656, 40653, 35287, 65535, 18523, 31529, 23382, 
+      32712, 32264, 25425, 18814, 65535, 29948, 30491, 32162, 24495, 13185, 30068, 11792, 39664, 22251, 20622, 19099, 
+      11730, 11823, 21024, 23998, 21139, 6361, 21814, 13316, 9414, 41773, 24515, 26355, 3255, 35230, 25667, 15067, 
+      28816, 65535, 5225, 11210, 19715, 34978, 35402, 19021, 25912, 32189, 25844, 2630, 28812, 26907, 6060, 27526, 
+      26049, 19023, 13275, 23237, 26631, 23511, 11955, 25750, 21817, 15196, 23454, 23737, 14975, 25675, 13421, 25048, 
+      22653, 28304, 17089, 17172, 22068, 18578, 19290, 23137, 27267, 24131, 40703, 38256, 26599, 25712, 28351, 32045, 
+      33889, 33366, 32911, 36927, 41705, 36712, 65535, 34711, 65535, 65535, 38048, 65535, 65535, 40468, 41972, 38633 },
+    { 65535, 37710, 65535, 65535, 65535, 65535, 40161, 65535, 39935, 65535, 65535, 41516, 65535, 41593, 65535, 65535, 
+      65535, 65535, 65535, 32859, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41455, 65535, 65535, 65535, 65535, 
+      35641, 34791, 36892, 40865, 41879, 65535, 38185, 32296, 65535, 65535, 65535, 30623, 65535, 65535, 40406, 65535, 
+      41674, 65535, 65535, 35541, 65535, 65535, 27946, 32904, 27828, 30612, 37345, 41328, 25774, 33286, 29500, 65535, 
+      23429, 23379, 65535, 65535, 34368, 37807, 20886, 18437, 38225, 65535, 65535, 40014, 65535, 16839, 26409, 26951, 
+      37435, 36967, 29641, 22353, 65535, 24819, 35307, 37056, 19605, 11316, 34977, 14239, 65535, 27086, 25402, 23873, 
+      16058, 16296, 26042, 18844, 26220, 5413, 26943, 18296, 5021, 65535, 29713, 31561, 8003, 40453, 20444, 20290, 
+      34041, 5225, 65535, 5985, 24934, 40200, 40624, 13808, 31123, 37404, 31049, 6574, 34016, 32096, 10697, 32704, 
+      31212, 13905, 18118, 28293, 31671, 28456, 16032, 30727, 26632, 11102, 28124, 28286, 12006, 30249, 14089, 29511, 
+      26835, 23220, 19090, 15224, 18159, 19274, 20171, 24881, 30103, 20897, 65535, 65535, 22982, 23192, 26215, 27408, 
+      28952, 34656, 32670, 38943, 65535, 37236, 65535, 30356, 65535, 65535, 35648, 65535, 65535, 38143, 40704, 33531 },
+    { 41267, 32635, 65535, 65535, 65535, 65535, 35092, 65535, 34618, 65535, 65535, 36108, 65535, 35985, 65535, 65535, 
+      65535, 65535, 65535, 26875, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37326, 65535, 65535, 65535, 40787, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 37584, 65535, 65535, 65535, 65535, 65535, 65535, 37456, 65535, 65535, 65535, 65535, 
+      30872, 29698, 33007, 39027, 40493, 65535, 37306, 27880, 65535, 65535, 65535, 25983, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 36864, 65535, 65535, 23418, 33986, 25126, 31044, 40890, 65535, 21319, 36076, 31565, 65535, 
+      19527, 23714, 65535, 65535, 38725, 65535, 21428, 16035, 65535, 65535, 65535, 65535, 65535, 16526, 20573, 31416, 
+      65535, 65535, 34664, 26930, 65535, 18978, 40861, 65535, 14214, 11752, 40630, 18385, 65535, 32715, 30994, 29475, 
+      21451, 21782, 31839, 12984, 32073, 9073, 32836, 24103, 4351, 65535, 35669, 37524, 13857, 65535, 14460, 26273, 
+      40025, 11210, 5985, 65535, 30915, 65535, 65535, 7864, 37097, 65535, 37019, 12328, 39984, 38051, 16447, 38649, 
+      37145, 8213, 23857, 34138, 37493, 34204, 21298, 36495, 32278, 8131, 33632, 33684, 10833, 35649, 16823, 34818, 
+      31925, 17489, 22546, 14901, 14604, 21467, 22475, 27741, 33830, 18172, 65535, 65535, 19566, 21291, 24615, 22332, 
+      23410, 36584, 32981, 41504, 65535, 38206, 65535, 25628, 65535, 65535, 33274, 65535, 65535, 35766, 39471, 27726 },
+    { 65535, 65535, 65535, 34530, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39777, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38381, 41461, 
+      65535, 65535, 65535, 41399, 65535, 65535, 38365, 65535, 36079, 37783, 65535, 65535, 36899, 35829, 38332, 65535, 
+      65535, 65535, 65535, 65535, 65535, 33170, 65535, 65535, 31872, 35156, 31005, 65535, 35415, 30299, 34029, 29962, 
+      32388, 30037, 29297, 35690, 29548, 28931, 65535, 35236, 65535, 36382, 27516, 26132, 65535, 28759, 29992, 24920, 
+      65535, 33271, 23096, 24424, 21890, 21515, 31647, 37391, 19100, 22609, 22607, 19327, 23689, 32186, 65535, 18186, 
+      17211, 16985, 15566, 16778, 23703, 65535, 14779, 15557, 65535, 28915, 13713, 19704, 20505, 9384, 9407, 9212, 
+      13404, 12710, 6876, 65535, 5964, 24080, 5397, 8965, 28716, 22155, 5788, 7265, 17441, 15641, 65535, 4833, 
+      9175, 19715, 24934, 30915, 65535, 15268, 15692, 38661, 6218, 12475, 6177, 18846, 9135, 7340, 15011, 8023, 
+      6715, 38433, 8792, 5550, 8360, 6969, 13157, 8204, 7458, 33075, 9440, 10514, 31070, 11399, 23161, 11808, 
+      12534, 65535, 20540, 30676, 38661, 25019, 24797, 23731, 21550, 38777, 22816, 22189, 41818, 38163, 39076, 65535, 
+      65535, 31335, 36356, 31050, 29114, 36323, 29848, 65535, 30332, 32762, 65535, 38673, 36497, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 19751, 31794, 65535, 65535, 65535, 65535, 32108, 65535, 65535, 29133, 65535, 65535, 28050, 
+      65535, 65535, 65535, 65535, 39597, 65535, 65535, 65535, 65535, 65535, 65535, 24595, 65535, 65535, 65535, 65535, 
+      30594, 34465, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 35550, 65535, 40043, 65535, 65535, 65535, 30705, 36203, 65535, 65535, 65535, 65535, 65535, 65535, 38871, 
+      65535, 65535, 65535, 65535, 39355, 65535, 35759, 29838, 65535, 31239, 65535, 65535, 65535, 35213, 24106, 28136, 
+      65535, 29693, 65535, 28500, 65535, 65535, 24785, 65535, 22157, 24965, 65535, 65535, 24199, 22846, 27815, 40812, 
+      65535, 65535, 65535, 65535, 65535, 20859, 65535, 65535, 22581, 32626, 19906, 65535, 34251, 18297, 33671, 19397, 
+      30605, 16819, 21000, 39058, 16535, 17842, 65535, 40163, 65535, 65535, 27558, 22318, 65535, 32044, 35928, 15943, 
+      65535, 65535, 16441, 13239, 22904, 19190, 65535, 65535, 15177, 11032, 11031, 13141, 10895, 65535, 65535, 24620, 
+      13255, 13553, 19836, 26293, 9696, 65535, 12576, 11096, 65535, 65535, 11503, 32697, 6895, 16674, 18241, 19377, 
+      26884, 26292, 16071, 65535, 15409, 38954, 14361, 22973, 65535, 7059, 11044, 9182, 32581, 1890, 65535, 19954, 
+      6236, 34978, 40200, 65535, 15268, 65535, 424, 65535, 9129, 2870, 9240, 34060, 6341, 8374, 30107, 7919, 
+      9475, 65535, 23118, 13057, 10381, 13773, 26917, 11730, 16106, 65535, 16013, 16742, 65535, 15460, 36261, 16661, 
+      19817, 65535, 31808, 65535, 65535, 36196, 35572, 32086, 26405, 65535, 12349, 15210, 65535, 65535, 65535, 65535, 
+      65535, 34809, 65535, 31467, 23774, 39318, 21556, 65535, 18601, 23837, 65535, 36350, 31090, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 19350, 31533, 65535, 65535, 65535, 65535, 31797, 65535, 65535, 28771, 65535, 65535, 27669, 
+      65535, 65535, 65535, 65535, 39219, 65535, 65535, 65535, 65535, 65535, 65535, 24175, 65535, 65535, 65535, 65535, 
+      30175, 34044, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 35132, 65535, 39632, 65535, 65535, 65535, 30290, 35793, 65535, 65535, 65535, 41782, 65535, 65535, 38482, 
+      65535, 65535, 65535, 65535, 38991, 65535, 35388, 29454, 65535, 30875, 65535, 65535, 65535, 34891, 23719, 27778, 
+      65535, 29350, 65535, 28156, 65535, 65535, 24423, 65535, 21785, 24630, 65535, 65535, 23871, 22510, 27554, 40699, 
+      65535, 65535, 65535, 65535, 65535, 20555, 65535, 65535, 22386, 32602, 19654, 65535, 34260, 18015, 33706, 19169, 
+      30613, 16489, 20851, 39176, 16216, 17602, 65535, 40320, 65535, 65535, 27638, 22316, 65535, 32190, 36129, 15806, 
+      65535, 65535, 16394, 13029, 23044, 19264, 65535, 65535, 15248, 10826, 10825, 13160, 10621, 65535, 65535, 24886, 
+      13358, 13670, 20087, 26616, 9355, 65535, 12754, 11228, 65535, 65535, 11707, 33075, 6612, 17018, 18596, 19746, 
+      27279, 26690, 16450, 65535, 15797, 39368, 14755, 23381, 65535, 6649, 11446, 9580, 33002, 1872, 65535, 20377, 
+      6654, 35402, 40624, 65535, 15692, 424, 65535, 65535, 9552, 3286, 9662, 34484, 6757, 8788, 30529, 8326, 
+      9883, 65535, 23533, 13454, 10744, 14150, 27320, 12089, 16481, 65535, 16357, 17072, 65535, 15763, 36641, 16965, 
+      20139, 65535, 32156, 65535, 65535, 36533, 35901, 32369, 26629, 65535, 12193, 15174, 65535, 65535, 65535, 65535, 
+      65535, 34956, 65535, 31544, 23720, 39432, 21411, 65535, 18336, 23656, 65535, 36323, 30992, 65535, 65535, 65535 },
+    { 36373, 25602, 65535, 65535, 65535, 37748, 28021, 65535, 27269, 65535, 37698, 28645, 65535, 28325, 65535, 65535, 
+      37696, 65535, 41174, 19113, 65535, 65535, 34958, 41772, 40890, 37201, 38658, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 41840, 65535, 65535, 65535, 65535, 65535, 40828, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41275, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 30706, 65535, 65535, 65535, 35129, 65535, 65535, 65535, 
+      39903, 65535, 65535, 65535, 32118, 65535, 65535, 65535, 65535, 65535, 65535, 33517, 65535, 65535, 65535, 65535, 
+      25960, 24222, 29498, 38156, 40138, 65535, 37846, 23791, 65535, 65535, 65535, 21610, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 40195, 65535, 65535, 19472, 37210, 24134, 33697, 65535, 65535, 17729, 41125, 36052, 65535, 
+      17231, 26875, 65535, 65535, 65535, 65535, 25056, 16837, 65535, 65535, 65535, 65535, 65535, 19877, 13613, 38284, 
+      65535, 65535, 41956, 33990, 65535, 12058, 65535, 65535, 9356, 16758, 65535, 25395, 65535, 40467, 38732, 37223, 
+      29134, 29508, 39677, 6428, 39929, 16465, 40699, 31952, 11277, 65535, 65535, 65535, 21721, 65535, 6844, 34083, 
+      65535, 19021, 13808, 7864, 38661, 65535, 65535, 65535, 65535, 65535, 65535, 19876, 65535, 65535, 23905, 65535, 
+      65535, 2059, 31189, 41543, 65535, 41436, 28119, 65535, 39368, 8878, 40492, 40380, 12650, 65535, 21430, 41357, 
+      38229, 9840, 27336, 16514, 11541, 24944, 25974, 31450, 38262, 15736, 65535, 65535, 15811, 19588, 22921, 15588, 
+      15935, 38501, 33052, 65535, 65535, 38753, 65535, 19272, 65535, 65535, 29773, 65535, 65535, 32105, 37064, 19923 },
+    { 65535, 65535, 65535, 28338, 37266, 65535, 65535, 65535, 65535, 38623, 65535, 65535, 36778, 65535, 65535, 36123, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33562, 65535, 65535, 65535, 65535, 
+      39527, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 39766, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 38451, 65535, 39525, 65535, 65535, 65535, 65535, 32816, 36360, 
+      65535, 37655, 65535, 36491, 65535, 65535, 33119, 65535, 30659, 32864, 65535, 65535, 32019, 30813, 34405, 65535, 
+      65535, 65535, 65535, 65535, 65535, 28389, 65535, 65535, 28272, 34494, 26657, 65535, 35343, 25579, 34242, 25793, 
+      31926, 24836, 25997, 37540, 24418, 24525, 65535, 37720, 65535, 39578, 27594, 24491, 65535, 30297, 32715, 21143, 
+      65535, 37695, 20097, 19811, 22036, 20168, 36391, 65535, 16836, 17773, 17771, 16171, 18488, 37608, 65535, 20559, 
+      14690, 14655, 16655, 20542, 18091, 65535, 12614, 12545, 65535, 34787, 11307, 25146, 14930, 11215, 12181, 12756, 
+      18945, 18284, 9422, 65535, 8461, 30245, 7327, 14663, 34930, 16125, 4378, 3865, 23655, 9730, 65535, 11019, 
+      3460, 25912, 31123, 37097, 6218, 9129, 9552, 65535, 65535, 6291, 299, 24933, 2919, 1442, 20984, 2166, 
+      1906, 65535, 14126, 4999, 4681, 6418, 18152, 5599, 8497, 38795, 9426, 10490, 36472, 10225, 27895, 11182, 
+      13454, 65535, 24199, 35532, 65535, 28740, 28302, 25958, 21926, 65535, 17357, 17692, 65535, 65535, 65535, 65535, 
+      65535, 31554, 37834, 29918, 25585, 36522, 25320, 65535, 24786, 28124, 65535, 36712, 33240, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 22271, 33132, 65535, 65535, 65535, 65535, 33831, 65535, 65535, 31276, 65535, 65535, 30364, 
+      65535, 65535, 65535, 65535, 41859, 65535, 65535, 65535, 65535, 65535, 65535, 27318, 65535, 65535, 65535, 65535, 
+      33302, 37192, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 38419, 65535, 65535, 65535, 65535, 65535, 33575, 39068, 65535, 65535, 65535, 65535, 65535, 65535, 41680, 
+      65535, 65535, 65535, 65535, 65535, 65535, 38501, 32631, 65535, 33956, 65535, 65535, 65535, 37735, 26915, 30830, 
+      65535, 32321, 65535, 31132, 65535, 65535, 27501, 65535, 24911, 27560, 65535, 65535, 26769, 25453, 30038, 65535, 
+      65535, 65535, 65535, 65535, 65535, 23325, 65535, 65535, 24478, 33429, 22117, 65535, 34829, 20665, 34077, 21486, 
+      31208, 19412, 22649, 38863, 19084, 20009, 65535, 39681, 65535, 65535, 27704, 23059, 65535, 31688, 35150, 17569, 
+      65535, 41681, 17541, 15297, 22672, 19463, 40754, 65535, 15544, 13103, 13101, 13902, 13285, 65535, 65535, 23419, 
+      13454, 13652, 18800, 24594, 12364, 65535, 12251, 11162, 65535, 40445, 11020, 30475, 9380, 14872, 16314, 17316, 
+      24504, 23886, 13928, 65535, 13171, 36332, 12070, 20453, 41124, 9926, 8679, 6908, 29860, 3945, 65535, 17214, 
+      3723, 32189, 37404, 65535, 12475, 2870, 3286, 65535, 6291, 65535, 6388, 31220, 3471, 5505, 27251, 5067, 
+      6618, 65535, 20249, 10237, 7748, 11045, 24069, 9110, 13379, 65535, 13452, 14260, 65535, 13152, 33491, 14335, 
+      17368, 65535, 29185, 41096, 65535, 33624, 33042, 29816, 24501, 65535, 13183, 15164, 65535, 65535, 65535, 65535, 
+      65535, 33348, 40505, 30470, 23723, 38039, 22146, 65535, 20069, 24655, 65535, 36011, 31267, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 28358, 37118, 65535, 65535, 65535, 65535, 38514, 65535, 65535, 36726, 65535, 65535, 36098, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33620, 65535, 65535, 65535, 65535, 
+      39577, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 39905, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 38640, 65535, 39736, 65535, 65535, 65535, 65535, 32996, 36572, 
+      65535, 37880, 65535, 36713, 65535, 65535, 33323, 65535, 30852, 33088, 65535, 65535, 32245, 31033, 34668, 65535, 
+      65535, 65535, 65535, 65535, 65535, 28623, 65535, 65535, 28548, 34792, 26911, 65535, 35637, 25817, 34533, 26053, 
+      32222, 25048, 26280, 37804, 24636, 24778, 65535, 37966, 65535, 39802, 27884, 24790, 65535, 30564, 32951, 21419, 
+      65535, 37863, 20388, 20060, 22322, 20466, 36539, 65535, 17135, 18013, 18011, 16462, 18707, 37706, 65535, 20793, 
+      14988, 14953, 16917, 20725, 18277, 65535, 12913, 12841, 65535, 34835, 11607, 25234, 15123, 11440, 12379, 12926, 
+      19018, 18353, 9609, 65535, 8640, 30234, 7512, 14713, 34893, 16256, 4625, 4160, 23618, 9892, 65535, 10995, 
+      3687, 25844, 31049, 37019, 6177, 9240, 9662, 65535, 299, 6388, 65535, 24833, 2968, 1300, 20867, 2036, 
+      1621, 65535, 13964, 4724, 4399, 6128, 17961, 5302, 8220, 38638, 9131, 10194, 36289, 9926, 27678, 10883, 
+      13162, 65535, 23945, 35316, 65535, 28484, 28040, 25671, 21627, 65535, 17241, 17501, 65535, 65535, 65535, 65535, 
+      65535, 31255, 37536, 29631, 25357, 36224, 25140, 65535, 24686, 27954, 65535, 36443, 33007, 65535, 65535, 65535 },
+    { 65535, 41779, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 38977, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 41298, 65535, 65535, 65535, 65535, 41758, 38562, 65535, 65535, 65535, 36995, 65535, 65535, 40387, 65535, 
+      40877, 65535, 65535, 37030, 65535, 65535, 34295, 34792, 33205, 33292, 36038, 38701, 32115, 33178, 30498, 41364, 
+      29572, 26599, 38605, 65535, 32025, 34626, 24109, 23982, 34236, 40592, 40590, 35630, 65535, 21139, 32893, 24815, 
+      33083, 32664, 26375, 20340, 65535, 31299, 30766, 32310, 26178, 15765, 30214, 13974, 39192, 22593, 21064, 19574, 
+      12893, 12845, 21084, 25307, 21060, 8920, 21604, 13607, 11344, 40999, 24023, 25802, 4841, 34486, 26670, 14465, 
+      28021, 2630, 6574, 12328, 18846, 34060, 34484, 19876, 24933, 31220, 24833, 65535, 27781, 25810, 4134, 26385, 
+      24864, 19588, 11561, 21811, 25168, 21909, 9639, 24190, 20060, 14805, 21558, 21745, 13914, 23703, 11025, 22997, 
+      20435, 28693, 14465, 15543, 21354, 16101, 16775, 20515, 24686, 22961, 38887, 36184, 25615, 24156, 26593, 31790, 
+      33984, 30757, 30523, 34299, 39262, 34174, 65535, 34163, 65535, 65535, 36303, 41989, 65535, 38672, 39795, 38986 },
+    { 65535, 65535, 65535, 25424, 34929, 65535, 65535, 65535, 65535, 36058, 65535, 65535, 33988, 65535, 65535, 33267, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 30652, 65535, 65535, 65535, 65535, 
+      36612, 40518, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 41890, 65535, 65535, 65535, 65535, 65535, 37045, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41808, 36005, 65535, 37238, 65535, 65535, 65535, 40780, 30311, 34093, 
+      65535, 35505, 65535, 34324, 65535, 65535, 30793, 65535, 28250, 30722, 65535, 65535, 29905, 28634, 32776, 65535, 
+      65535, 65535, 65535, 65535, 65535, 26367, 65535, 65535, 26906, 34493, 24904, 65535, 35605, 23626, 34657, 24154, 
+      32068, 22605, 24837, 38650, 22235, 22772, 65535, 39110, 65535, 41260, 28084, 24234, 65535, 31390, 34281, 19829, 
+      65535, 39924, 19256, 18024, 22710, 20196, 38761, 65535, 16532, 15890, 15888, 15397, 16344, 40244, 65535, 22219, 
+      14362, 14435, 17944, 22718, 15665, 65535, 12631, 12081, 65535, 37601, 11309, 27840, 12581, 13103, 14307, 15080, 
+      21704, 21056, 11671, 65535, 10787, 33156, 9643, 17487, 37849, 13393, 6323, 4971, 26574, 7200, 65535, 13937, 
+      2299, 28812, 34016, 39984, 9135, 6341, 6757, 65535, 2919, 3471, 2968, 27781, 65535, 2043, 23793, 1727, 
+      3209, 65535, 16780, 6898, 4961, 7901, 20640, 6269, 10203, 41445, 10588, 11518, 38980, 10744, 30170, 11859, 
+      14621, 65535, 26082, 37797, 65535, 30577, 30052, 27200, 22450, 65535, 14888, 15811, 65535, 65535, 65535, 65535, 
+      65535, 31760, 38514, 29514, 24070, 36625, 23279, 65535, 22200, 25991, 65535, 35784, 31738, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 27200, 35827, 65535, 65535, 65535, 65535, 37214, 65535, 65535, 35457, 65535, 65535, 34860, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32546, 65535, 65535, 65535, 65535, 
+      38481, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 39078, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 38035, 65535, 39239, 65535, 65535, 65535, 65535, 32348, 36088, 
+      65535, 37470, 65535, 36293, 65535, 65535, 32800, 65535, 30272, 32682, 65535, 65535, 31856, 30603, 34553, 65535, 
+      65535, 65535, 65535, 65535, 65535, 28286, 65535, 65535, 28561, 35412, 26723, 65535, 36358, 25519, 35309, 25925, 
+      32893, 24584, 26389, 38815, 24201, 24588, 65535, 39059, 65535, 40971, 28676, 25291, 65535, 31560, 34085, 21446, 
+      65535, 39137, 20630, 19846, 23167, 21069, 37829, 65535, 17594, 17744, 17742, 16722, 18292, 39004, 65535, 21936, 
+      15428, 15437, 17946, 21981, 17685, 65535, 13478, 13213, 65535, 36100, 12155, 26529, 14580, 12616, 13613, 14198, 
+      20305, 19638, 10860, 65535, 9902, 31420, 8767, 15986, 36025, 15431, 5749, 4969, 24757, 9227, 65535, 12172, 
+      3545, 26907, 32096, 38051, 7340, 8374, 8788, 65535, 1442, 5505, 1300, 25810, 2043, 65535, 21799, 736, 
+      1230, 65535, 14745, 4922, 3645, 6069, 18599, 4775, 8317, 39404, 8923, 9925, 36941, 9411, 28163, 10448, 
+      12981, 65535, 24181, 35796, 65535, 28696, 28203, 25560, 21171, 65535, 15941, 16259, 65535, 65535, 65535, 65535, 
+      65535, 30684, 37176, 28823, 24204, 35619, 23881, 65535, 23388, 26683, 65535, 35470, 31867, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40913, 41852, 65535, 40120, 65535, 
+      40107, 65535, 65535, 37811, 65535, 65535, 38202, 35887, 36485, 34920, 35080, 36840, 36023, 33069, 31173, 38509, 
+      33359, 28741, 35973, 38820, 30517, 32508, 26334, 27475, 31609, 37223, 37220, 32728, 38505, 24044, 37018, 23697, 
+      30244, 29864, 24427, 19533, 38689, 35424, 27845, 29230, 30295, 18940, 27155, 14859, 35494, 19896, 18535, 17136, 
+      11873, 11597, 18083, 29431, 17905, 12266, 18301, 11197, 15360, 37100, 20421, 22133, 6169, 30627, 30727, 10941, 
+      24163, 6060, 10697, 16447, 15011, 30107, 30529, 23905, 20984, 27251, 20867, 4134, 23793, 21799, 65535, 22352, 
+      20818, 23501, 7427, 17698, 21045, 17775, 6022, 20058, 15937, 18153, 17477, 17711, 16595, 19660, 11115, 19003, 
+      16602, 32448, 12744, 17300, 24230, 15501, 15943, 18657, 21781, 25221, 34789, 32211, 28078, 25767, 27764, 35004, 
+      37490, 28919, 29933, 31829, 35786, 32844, 38749, 37042, 41842, 41539, 37325, 39784, 41185, 39551, 39739, 65535 },
+    { 65535, 65535, 65535, 26539, 35099, 65535, 65535, 65535, 65535, 36478, 65535, 65535, 34735, 65535, 65535, 34155, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31931, 65535, 65535, 65535, 65535, 
+      37851, 41769, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 38599, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 37681, 65535, 38945, 65535, 65535, 65535, 65535, 31974, 35803, 
+      65535, 37227, 65535, 36045, 65535, 65535, 32497, 65535, 29939, 32445, 65535, 65535, 31629, 30355, 34479, 65535, 
+      65535, 65535, 65535, 65535, 65535, 28094, 65535, 65535, 28566, 35754, 26617, 65535, 36756, 25351, 35739, 25854, 
+      33266, 24323, 26452, 39377, 23958, 24484, 65535, 39668, 65535, 41626, 29119, 25576, 65535, 32118, 34721, 21470, 
+      65535, 39855, 20778, 19737, 23645, 21417, 38557, 65535, 17869, 17608, 17606, 16888, 18070, 39739, 65535, 22580, 
+      15698, 15731, 18531, 22690, 17362, 65535, 13822, 13453, 65535, 36822, 12496, 27263, 14294, 13284, 14311, 14916, 
+      21037, 20369, 11568, 65535, 10616, 32100, 9478, 16711, 36677, 14975, 6406, 5499, 25416, 8894, 65535, 12856, 
+      3653, 27526, 32704, 38649, 8023, 7919, 8326, 65535, 2166, 5067, 2036, 26385, 1727, 736, 22352, 65535, 
+      1558, 65535, 15230, 5194, 3387, 6176, 19002, 4632, 8476, 39856, 8905, 9862, 37332, 9203, 28470, 10283, 
+      12951, 65535, 24356, 36092, 65535, 28851, 28331, 25537, 20956, 65535, 15205, 15567, 65535, 65535, 65535, 65535, 
+      65535, 30389, 36997, 28392, 23566, 35300, 23175, 65535, 22652, 25969, 65535, 34936, 31234, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 27966, 35908, 65535, 65535, 65535, 65535, 37468, 65535, 65535, 35949, 65535, 65535, 35453, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33421, 65535, 65535, 65535, 65535, 
+      39323, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 40156, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 39211, 65535, 40443, 65535, 65535, 65535, 65535, 33513, 37295, 
+      65535, 38690, 65535, 37511, 65535, 65535, 34000, 65535, 31459, 33902, 65535, 65535, 33079, 31821, 35777, 65535, 
+      65535, 65535, 65535, 65535, 65535, 29514, 65535, 65535, 29765, 36368, 27951, 65535, 37240, 26748, 36146, 27149, 
+      33813, 25798, 27572, 39404, 25419, 25816, 65535, 39531, 65535, 41304, 29499, 26317, 65535, 32170, 34488, 22646, 
+      65535, 39165, 21770, 21075, 23942, 22033, 37764, 65535, 18638, 18974, 18972, 17853, 19514, 38717, 65535, 22329, 
+      16480, 16467, 18518, 22098, 18875, 65535, 14460, 14295, 65535, 35617, 13145, 26219, 15784, 12959, 13816, 14271, 
+      19950, 19270, 11023, 65535, 10032, 30735, 8928, 15566, 35246, 16532, 6208, 5763, 24003, 10409, 65535, 11522, 
+      4746, 26049, 31212, 37145, 6715, 9475, 9883, 65535, 1906, 6618, 1621, 24864, 3209, 1230, 20818, 1558, 
+      65535, 65535, 13674, 3701, 2779, 4850, 17452, 3726, 7088, 38299, 7746, 8769, 35786, 8371, 26962, 9365, 
+      11802, 65535, 22951, 34591, 65535, 27466, 26974, 24369, 20108, 65535, 16207, 16140, 65535, 41009, 41182, 65535, 
+      65535, 29692, 36073, 28012, 23851, 34650, 23811, 65535, 23705, 26658, 65535, 34835, 31485, 65535, 65535, 65535 },
+    { 34680, 24567, 40357, 65535, 65535, 36201, 27013, 65535, 26438, 65535, 36362, 27904, 65535, 27780, 65535, 65535, 
+      36745, 65535, 40133, 19488, 65535, 65535, 34511, 41114, 40279, 36804, 38340, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 41978, 65535, 65535, 65535, 65535, 65535, 41067, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41781, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31824, 65535, 65535, 65535, 36544, 65535, 65535, 65535, 
+      41570, 65535, 65535, 65535, 33606, 65535, 65535, 65535, 65535, 65535, 65535, 35304, 65535, 65535, 65535, 65535, 
+      27624, 25772, 31368, 40198, 65535, 65535, 39901, 25618, 65535, 65535, 65535, 23410, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 21354, 39096, 26190, 35630, 65535, 65535, 19668, 65535, 37753, 65535, 
+      19266, 28723, 65535, 65535, 65535, 65535, 26832, 18829, 65535, 65535, 65535, 65535, 65535, 21648, 14780, 39342, 
+      65535, 65535, 65535, 34948, 65535, 13283, 65535, 65535, 11262, 18210, 65535, 26350, 65535, 40904, 39191, 37669, 
+      29664, 29988, 39944, 8047, 40124, 17188, 40830, 32197, 12109, 65535, 65535, 65535, 21906, 65535, 7734, 33984, 
+      65535, 19023, 13905, 8213, 38433, 65535, 65535, 2059, 65535, 65535, 65535, 19588, 65535, 65535, 23501, 65535, 
+      65535, 65535, 30632, 40969, 65535, 40747, 27320, 65535, 38610, 7265, 39609, 39425, 10984, 41328, 20047, 40329, 
+      37134, 9319, 25912, 14705, 9489, 23287, 24309, 29771, 36666, 13682, 65535, 65535, 13836, 17530, 20864, 14359, 
+      15198, 36553, 31007, 65535, 65535, 36717, 65535, 17897, 65535, 65535, 27844, 65535, 65535, 30202, 35061, 19626 },
+    { 65535, 65535, 65535, 40965, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 41957, 65535, 65535, 40489, 41862, 39785, 65535, 41557, 39088, 39960, 38724, 
+      39044, 38740, 37840, 39625, 38271, 37719, 65535, 38341, 65535, 38323, 33949, 33933, 65535, 33589, 33171, 33637, 
+      40273, 33256, 31624, 33213, 28634, 29328, 31085, 34029, 27455, 31374, 31372, 27964, 32374, 29865, 65535, 23090, 
+      25714, 25433, 22125, 19959, 32187, 65535, 23254, 24228, 37701, 25287, 22295, 18633, 29005, 16392, 15583, 14587, 
+      13338, 12738, 14036, 36840, 13474, 19056, 13430, 10079, 22683, 30174, 14575, 16024, 12245, 23854, 38031, 6633, 
+      17495, 13275, 18118, 23857, 8792, 23118, 23533, 31189, 14126, 20249, 13964, 11561, 16780, 14745, 7427, 15230, 
+      13674, 30632, 65535, 10355, 13657, 10350, 4413, 12638, 8545, 24676, 10217, 10607, 22402, 12495, 14404, 11998, 
+      10197, 39277, 12548, 21885, 29935, 16783, 16741, 17043, 17503, 29990, 27429, 25123, 33027, 29519, 30690, 40928, 
+      65535, 26388, 29677, 27878, 29680, 31038, 32053, 65535, 34603, 34933, 39469, 35997, 35952, 41332, 39857, 65535 },
+    { 65535, 65535, 65535, 30740, 36752, 65535, 65535, 65535, 65535, 38794, 65535, 65535, 37948, 65535, 65535, 37729, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36432, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37151, 40991, 
+      65535, 65535, 65535, 41212, 65535, 65535, 37689, 65535, 35132, 37603, 65535, 65535, 36778, 35522, 39379, 65535, 
+      65535, 65535, 65535, 65535, 65535, 33206, 65535, 65535, 33271, 38946, 31592, 65535, 39568, 30430, 38335, 30757, 
+      36286, 29498, 30989, 40770, 29120, 29457, 65535, 40525, 65535, 41846, 31696, 29189, 65535, 33671, 35324, 26142, 
+      65535, 38809, 25046, 24725, 26051, 24738, 37146, 65535, 21626, 22644, 22642, 21121, 23214, 37437, 65535, 23321, 
+      19514, 19434, 20117, 22268, 22556, 65535, 17316, 17442, 65535, 33798, 16047, 25032, 19479, 14095, 14513, 14565, 
+      18750, 18048, 11768, 65535, 10762, 28383, 9846, 14304, 32592, 20084, 8204, 8517, 21516, 14088, 65535, 9709, 
+      8337, 23237, 28293, 34138, 5550, 13057, 13454, 41543, 4999, 10237, 4724, 21811, 6898, 4922, 17698, 5194, 
+      3701, 40969, 10355, 65535, 3399, 1668, 13885, 2770, 3499, 34793, 4691, 5814, 32177, 6142, 23276, 6815, 
+      8585, 65535, 19278, 30900, 39424, 23805, 23338, 20989, 17355, 38714, 17901, 16777, 41775, 37344, 37605, 65535, 
+      65535, 27128, 33044, 26128, 23567, 32137, 24389, 65535, 25374, 27317, 65535, 33475, 30984, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 27361, 33819, 65535, 65535, 65535, 65535, 35656, 65535, 65535, 34608, 65535, 65535, 34345, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33099, 65535, 65535, 65535, 65535, 
+      38859, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 40551, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 40161, 65535, 41619, 65535, 65535, 65535, 65535, 34412, 38517, 
+      65535, 40051, 65535, 38860, 65535, 65535, 35166, 65535, 32527, 35300, 65535, 65535, 34514, 33188, 37663, 65535, 
+      65535, 65535, 65535, 65535, 65535, 31069, 65535, 65535, 31860, 39057, 29763, 65535, 39981, 28388, 38906, 29056, 
+      36530, 27150, 29796, 65535, 26830, 27639, 65535, 65535, 65535, 65535, 32262, 28929, 65535, 34933, 37151, 24789, 
+      65535, 41453, 24162, 22896, 26716, 24714, 39931, 65535, 21228, 20733, 20731, 20275, 21025, 40533, 65535, 25003, 
+      19059, 19076, 21277, 24542, 20063, 65535, 17123, 16827, 65535, 37073, 15801, 28061, 17126, 15627, 16381, 16714, 
+      21760, 21064, 13576, 65535, 12569, 31762, 11503, 17315, 35991, 17244, 8962, 8521, 24905, 11693, 65535, 12895, 
+      7040, 26631, 31671, 37493, 8360, 10381, 10744, 65535, 4681, 7748, 4399, 25168, 4961, 3645, 21045, 3387, 
+      2779, 65535, 13657, 3399, 65535, 3484, 16937, 1362, 5776, 37838, 5716, 6584, 35059, 5816, 25931, 6907, 
+      9698, 65535, 21447, 33481, 65535, 25877, 25297, 22256, 17570, 41078, 14592, 13876, 65535, 39372, 39287, 65535, 
+      65535, 27041, 33610, 25241, 21270, 31973, 21557, 65535, 22094, 24452, 65535, 32070, 28863, 65535, 65535, 65535 },
+    { 65535, 65535, 65535, 30616, 35669, 65535, 65535, 65535, 65535, 37884, 65535, 65535, 37345, 65535, 65535, 37272, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36447, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37856, 41875, 
+      65535, 65535, 65535, 65535, 65535, 65535, 38540, 65535, 35929, 38580, 65535, 65535, 37775, 36481, 40622, 65535, 
+      65535, 65535, 65535, 65535, 65535, 34262, 65535, 65535, 34610, 40590, 32780, 65535, 41230, 31526, 40002, 31993, 
+      37938, 30442, 32390, 65535, 30094, 30646, 65535, 65535, 65535, 65535, 33362, 30782, 65535, 35317, 36889, 27487, 
+      65535, 40099, 26515, 25900, 27718, 26357, 38363, 65535, 23185, 23781, 23779, 22589, 24229, 38421, 65535, 24930, 
+      21058, 20995, 21779, 23746, 23408, 65535, 18898, 18949, 65535, 34570, 17617, 26112, 20402, 15740, 16113, 16106, 
+      19872, 19168, 13388, 65535, 12387, 28912, 11493, 15454, 32916, 20701, 9854, 10081, 22016, 14970, 65535, 10741, 
+      9595, 23511, 28456, 34204, 6969, 13773, 14150, 41436, 6418, 11045, 6128, 21909, 7901, 6069, 17775, 6176, 
+      4850, 40747, 10350, 1668, 3484, 65535, 13466, 2303, 2335, 34356, 3059, 4171, 31580, 4510, 22492, 5147, 
+      7041, 65535, 18188, 30071, 38678, 22677, 22156, 19552, 15714, 37757, 17303, 15758, 40805, 36214, 36333, 65535, 
+      65535, 25474, 31471, 24471, 22196, 30481, 23277, 65535, 24688, 26214, 65535, 31863, 29531, 65535, 40892, 65535 },
+    { 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 40813, 65535, 40272, 37813, 38204, 41742, 36889, 35824, 38043, 
+      39205, 34464, 36034, 37540, 32659, 33621, 32115, 33462, 31850, 35657, 35655, 32377, 36573, 30044, 41646, 26678, 
+      30125, 29840, 26193, 23115, 36237, 40060, 27664, 28638, 35473, 24962, 26709, 20146, 33082, 20650, 19718, 18606, 
+      15849, 15365, 18356, 34116, 17839, 18257, 17832, 13475, 20946, 33962, 18945, 20334, 12091, 27815, 34931, 10833, 
+      21585, 11955, 16032, 21298, 13157, 26917, 27320, 28119, 18152, 24069, 17961, 9639, 20640, 18599, 6022, 19002, 
+      17452, 27320, 4413, 13885, 16937, 13466, 65535, 15747, 11290, 20918, 12394, 12388, 18342, 14352, 10006, 13531, 
+      10812, 35566, 8564, 17542, 25756, 12543, 12604, 13780, 15903, 25626, 29621, 26625, 28674, 25106, 26327, 36746, 
+      39823, 23747, 26050, 26126, 29778, 28074, 32870, 38036, 36366, 35616, 35259, 34187, 35216, 37207, 36190, 65535 },
+    { 65535, 65535, 65535, 28328, 34003, 65535, 65535, 41901, 65535, 36024, 65535, 65535, 35243, 65535, 65535, 35091, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34146, 65535, 65535, 65535, 65535, 
+      39847, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 41775, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 41482, 65535, 65535, 65535, 65535, 65535, 65535, 35729, 39866, 
+      65535, 41408, 65535, 40216, 65535, 65535, 36512, 65535, 33865, 36659, 65535, 65535, 35874, 34547, 39010, 65535, 
+      65535, 65535, 65535, 65535, 65535, 32431, 65535, 65535, 33175, 40090, 31114, 65535, 40933, 29748, 39809, 30398, 
+      37524, 28509, 31082, 65535, 28191, 28988, 65535, 65535, 65535, 65535, 33157, 30038, 65535, 35597, 37589, 26092, 
+      65535, 41466, 25391, 24245, 27568, 25757, 39850, 65535, 22352, 22085, 22083, 21489, 22387, 40205, 65535, 25482, 
+      20190, 20185, 21948, 24747, 21417, 65535, 18186, 17985, 65535, 36549, 16871, 27791, 18487, 16134, 16753, 16959, 
+      21502, 20801, 13958, 65535, 12944, 31047, 11930, 17053, 35143, 18557, 9681, 9461, 24161, 13055, 65535, 12479, 
+      8268, 25750, 30727, 36495, 8204, 11730, 12089, 65535, 5599, 9110, 5302, 24190, 6269, 4775, 20058, 4632, 
+      3726, 65535, 12638, 2770, 1362, 2303, 15747, 65535, 4500, 36614, 4357, 5250, 33785, 4647, 24617, 5674, 
+      8358, 65535, 20089, 32150, 40798, 24515, 23935, 20931, 16400, 39724, 15186, 14023, 65535, 38010, 37938, 65535, 
+      65535, 25966, 32402, 24395, 21024, 30927, 21657, 65535, 22635, 24579, 65535, 31426, 28536, 65535, 41487, 65535 },
+    { 65535, 65535, 65535, 32560, 36455, 65535, 65535, 65535, 65535, 38939, 65535, 65535, 38806, 65535, 65535, 38893, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38478, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40180, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 40875, 65535, 38262, 40906, 65535, 65535, 40097, 38808, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 36570, 65535, 65535, 36768, 65535, 35038, 65535, 65535, 33822, 41289, 34225, 
+      39417, 32770, 34486, 65535, 32419, 32903, 65535, 65535, 65535, 65535, 34696, 32538, 65535, 36210, 37355, 29639, 
+      65535, 39783, 28527, 28162, 29041, 28034, 37904, 65535, 25038, 26059, 26057, 24604, 26544, 37546, 65535, 25641, 
+      22946, 22847, 22885, 23996, 25742, 65535, 20703, 20907, 65535, 33399, 19455, 25472, 22731, 16732, 16862, 16635, 
+      19367, 18671, 14269, 65535, 13309, 27463, 12554, 15070, 31227, 23017, 11455, 11954, 20579, 17301, 65535, 10275, 
+      11800, 21817, 26632, 32278, 7458, 16106, 16481, 39368, 8497, 13379, 8220, 20060, 10203, 8317, 15937, 8476, 
+      7088, 38610, 8545, 3499, 5776, 2335, 11290, 4500, 65535, 32119, 2133, 3101, 29289, 4434, 20165, 4499, 
+      5278, 65535, 15880, 27737, 36352, 20384, 19886, 17508, 14256, 35427, 18886, 16813, 38477, 33926, 34121, 65535, 
+      65535, 24072, 29684, 23592, 22485, 29083, 24092, 65535, 26112, 27024, 41294, 31269, 29546, 65535, 39321, 65535 },
+    { 33548, 27061, 38006, 65535, 65535, 35840, 29473, 65535, 29552, 65535, 37035, 31247, 65535, 31732, 65535, 65535, 
+      38987, 65535, 41898, 25787, 65535, 65535, 38505, 65535, 65535, 40872, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38917, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 40871, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      34829, 33029, 38282, 65535, 65535, 65535, 65535, 32631, 65535, 65535, 65535, 30469, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 28263, 65535, 31972, 39138, 65535, 65535, 26428, 65535, 39586, 65535, 
+      25509, 31825, 65535, 65535, 65535, 65535, 29557, 23467, 65535, 65535, 65535, 65535, 65535, 24614, 21978, 38049, 
+      65535, 65535, 40554, 33447, 65535, 20512, 65535, 65535, 18165, 19864, 65535, 25287, 65535, 37339, 35757, 34244, 
+      26858, 26998, 35889, 15257, 35853, 16071, 36357, 28346, 12288, 65535, 38573, 40267, 18429, 65535, 14879, 29075, 
+      65535, 15196, 11102, 8131, 33075, 65535, 65535, 8878, 38795, 65535, 38638, 14805, 41445, 39404, 18153, 39856, 
+      38299, 7265, 24676, 34793, 37838, 34356, 20918, 36614, 32119, 65535, 32903, 32610, 3776, 34462, 12851, 33411, 
+      30150, 14650, 18672, 7781, 7057, 16069, 17098, 22572, 29417, 10142, 65535, 65535, 11924, 13160, 16495, 16986, 
+      19342, 29983, 25363, 35314, 65535, 30848, 65535, 19516, 65535, 65535, 25234, 40601, 65535, 27736, 31347, 24603 },
+    { 65535, 65535, 65535, 31313, 34415, 65535, 65535, 40750, 65535, 36989, 65535, 65535, 37077, 65535, 65535, 37285, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37332, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39854, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 40754, 65535, 38075, 40973, 65535, 65535, 40198, 38856, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 36777, 65535, 65535, 37467, 65535, 35468, 65535, 65535, 34104, 65535, 34740, 
+      40975, 32823, 35312, 65535, 32519, 33340, 65535, 65535, 65535, 65535, 36359, 33839, 65535, 38118, 39409, 30362, 
+      65535, 41912, 29503, 28595, 30708, 29416, 40020, 65535, 26233, 26439, 26438, 25581, 26736, 39578, 65535, 27611, 
+      24100, 24044, 24676, 26086, 25709, 65535, 21954, 21971, 65535, 35328, 20669, 27571, 22820, 18570, 18804, 18649, 
+      21489, 20794, 16150, 65535, 15169, 29258, 14346, 17201, 32832, 22704, 12895, 13135, 22405, 17395, 65535, 12407, 
+      12468, 23454, 28124, 33632, 9440, 16013, 16357, 40492, 9426, 13452, 9131, 21558, 10588, 8923, 17477, 8905, 
+      7746, 39609, 10217, 4691, 5716, 3059, 12394, 4357, 2133, 32903, 65535, 1128, 29882, 2358, 20568, 2388, 
+      4058, 65535, 15802, 28003, 36689, 20188, 19590, 16640, 12664, 35449, 17334, 14930, 38463, 33662, 33589, 65535, 
+      65535, 22442, 28423, 21653, 20364, 27453, 22081, 65535, 24396, 25004, 40273, 29235, 27414, 41425, 37838, 65535 },
+    { 65535, 65535, 65535, 31384, 33777, 65535, 65535, 39808, 65535, 36466, 65535, 65535, 36775, 65535, 65535, 37083, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37456, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40414, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41403, 65535, 38701, 41702, 65535, 65535, 40941, 39580, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 37567, 65535, 65535, 38423, 65535, 36339, 65535, 65535, 34925, 65535, 35641, 
+      65535, 33560, 36305, 65535, 33274, 34217, 65535, 65535, 65535, 65535, 37488, 34936, 65535, 39223, 40452, 31331, 
+      65535, 65535, 30539, 29478, 31836, 30525, 40820, 65535, 27315, 27309, 27307, 26621, 27538, 40219, 65535, 28697, 
+      25176, 25128, 25798, 27096, 26426, 65535, 23048, 23033, 65535, 35848, 21759, 28336, 23592, 19685, 19897, 19714, 
+      22319, 21628, 17257, 65535, 16280, 29657, 15465, 18082, 33066, 23310, 14018, 14229, 22848, 18189, 65535, 13296, 
+      13462, 23737, 28286, 33684, 10514, 16742, 17072, 40380, 10490, 14260, 10194, 21745, 11518, 9925, 17711, 9862, 
+      8769, 39425, 10607, 5814, 6584, 4171, 12388, 5250, 3101, 32610, 1128, 65535, 29496, 1966, 20118, 1471, 
+      3115, 65535, 15153, 27461, 36160, 19468, 18830, 15682, 11544, 34780, 17235, 14535, 37775, 32880, 32709, 65535, 
+      65535, 21316, 27345, 20553, 19569, 26326, 21502, 65535, 24132, 24409, 39241, 28177, 26507, 40360, 36722, 65535 },
+    { 32472, 28087, 36200, 65535, 65535, 35098, 30400, 65535, 30818, 65535, 36799, 32584, 65535, 33379, 65535, 65535, 
+      39532, 65535, 65535, 28802, 65535, 65535, 40021, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      38590, 36755, 65535, 65535, 65535, 65535, 65535, 36404, 65535, 65535, 65535, 34245, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 32030, 65535, 35472, 41717, 65535, 65535, 30178, 65535, 41406, 65535, 
+      29165, 34364, 65535, 65535, 65535, 65535, 31990, 26714, 65535, 65535, 65535, 65535, 65535, 27264, 25577, 38343, 
+      65535, 65535, 40266, 33757, 65535, 24146, 65535, 65535, 21938, 22168, 65535, 26106, 65535, 36379, 34912, 33443, 
+      26650, 26676, 34667, 19010, 34499, 17368, 34866, 27452, 14515, 65535, 36747, 38333, 18205, 65535, 18472, 27467, 
+      39880, 14975, 12006, 10833, 31070, 65535, 65535, 12650, 36472, 65535, 36289, 13914, 38980, 36941, 16595, 37332, 
+      35786, 10984, 22402, 32177, 35059, 31580, 18342, 33785, 29289, 3776, 29882, 29496, 65535, 31288, 9442, 30195, 
+      26888, 17514, 15111, 4163, 7647, 12308, 13334, 18805, 25683, 9157, 65535, 41498, 11703, 11189, 14281, 18568, 
+      21484, 26341, 22161, 31609, 40529, 27483, 65535, 20448, 65535, 65535, 23642, 37147, 65535, 26137, 29006, 26960 },
+    { 65535, 65535, 65535, 29447, 32058, 65535, 65535, 38580, 65535, 34644, 65535, 65535, 34837, 65535, 65535, 35123, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35534, 65535, 65535, 65535, 65535, 
+      40854, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38815, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 39918, 65535, 37187, 40335, 65535, 65535, 39600, 38210, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 36317, 65535, 65535, 37557, 65535, 35262, 65535, 65535, 33744, 65535, 34635, 
+      65535, 32224, 35565, 65535, 31972, 33159, 65535, 65535, 65535, 65535, 37681, 34685, 65535, 39812, 41376, 30530, 
+      65535, 65535, 29978, 28447, 32061, 30393, 65535, 65535, 26999, 26254, 26253, 26091, 26339, 41935, 65535, 29440, 
+      24835, 24833, 26238, 28158, 25077, 65535, 22829, 22623, 65535, 37670, 21516, 29906, 22353, 20237, 20622, 20587, 
+      23794, 23097, 17897, 65535, 16895, 31551, 15988, 19473, 35018, 21807, 14136, 14074, 24717, 17018, 65535, 14681, 
+      12856, 25675, 30249, 35649, 11399, 15460, 15763, 65535, 10225, 13152, 9926, 23703, 10744, 9411, 19660, 9203, 
+      8371, 41328, 12495, 6142, 5816, 4510, 14352, 4647, 4434, 34462, 2358, 1966, 31288, 65535, 21875, 1203, 
+      4501, 65535, 16723, 29114, 37814, 20917, 20221, 16668, 11761, 36264, 15270, 12627, 39224, 34188, 33818, 65535, 
+      65535, 21329, 27794, 20002, 18062, 26301, 19725, 65535, 22182, 22647, 39875, 27353, 25210, 40842, 36844, 65535 },
+    { 35504, 35467, 37042, 65535, 65535, 38717, 37526, 65535, 38439, 65535, 41419, 40247, 65535, 41455, 65535, 65535, 
+      65535, 65535, 65535, 38204, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 40060, 65535, 41629, 65535, 65535, 65535, 38024, 65535, 41519, 65535, 
+      36349, 37103, 65535, 65535, 41541, 65535, 34589, 32272, 41702, 65535, 65535, 65535, 65535, 30887, 34816, 34812, 
+      40052, 39746, 35300, 30617, 65535, 33330, 37592, 38627, 30279, 25346, 36675, 24982, 65535, 30229, 29087, 27806, 
+      22953, 22705, 28084, 27852, 27661, 18821, 27747, 22070, 18706, 65535, 28948, 30306, 15787, 37364, 27725, 20517, 
+      31354, 13421, 14089, 16823, 23161, 36261, 36641, 21430, 27895, 33491, 27678, 11025, 30170, 28163, 11115, 28470, 
+      26962, 20047, 14404, 23276, 25931, 22492, 10006, 24617, 20165, 12851, 20568, 20118, 9442, 21875, 65535, 20768, 
+      17452, 26905, 5919, 7638, 16187, 5247, 6093, 10977, 17104, 15646, 36275, 32269, 18705, 15205, 16799, 27051, 
+      30396, 20569, 19503, 24968, 32366, 23420, 36643, 28086, 41770, 38875, 26242, 31975, 35424, 28441, 28876, 35961 },
+    { 65535, 65535, 65535, 30397, 32325, 65535, 65535, 38378, 65535, 35052, 65535, 65535, 35477, 65535, 65535, 35855, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36510, 65535, 65535, 65535, 65535, 
+      41753, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39990, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41111, 65535, 38378, 41536, 65535, 65535, 40802, 39412, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 37518, 65535, 65535, 38713, 65535, 36450, 65535, 65535, 34941, 65535, 35814, 
+      65535, 33427, 36694, 65535, 33175, 34344, 65535, 65535, 65535, 65535, 38491, 35672, 65535, 40425, 41790, 31671, 
+      65535, 65535, 31059, 29628, 32853, 31333, 65535, 65535, 28003, 27437, 27435, 27161, 27537, 41675, 65535, 29959, 
+      25846, 25828, 26921, 28474, 26280, 65535, 23795, 23653, 65535, 37268, 22489, 29807, 23552, 20855, 21144, 21021, 
+      23784, 23092, 18464, 65535, 17474, 31026, 16614, 19535, 34336, 23001, 14952, 15002, 24243, 18211, 65535, 14745, 
+      13932, 25048, 29511, 34818, 11808, 16661, 16965, 41357, 11182, 14335, 10883, 22997, 11859, 10448, 19003, 10283, 
+      9365, 40329, 11998, 6815, 6907, 5147, 13531, 5674, 4499, 33411, 2388, 1471, 30195, 1203, 20768, 65535, 
+      3339, 65535, 15554, 27961, 36657, 19725, 19023, 15481, 10746, 35072, 16126, 13209, 38028, 32986, 32624, 65535, 
+      65535, 20409, 26728, 19347, 18098, 25402, 20073, 65535, 22874, 22972, 38766, 26865, 25060, 39774, 35894, 65535 },
+    { 65535, 65535, 41381, 33544, 34091, 65535, 65535, 38881, 65535, 37125, 65535, 65535, 38050, 65535, 65535, 38610, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39686, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41675, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 40661, 65535, 65535, 41517, 65535, 39454, 65535, 65535, 38031, 65535, 38754, 
+      65535, 36627, 39370, 65535, 36353, 37332, 65535, 65535, 65535, 65535, 39948, 37766, 65535, 41235, 41984, 34417, 
+      65535, 65535, 33547, 32593, 34296, 33289, 41203, 65535, 30209, 30424, 30422, 29622, 30640, 40042, 65535, 30585, 
+      28091, 28017, 28078, 28524, 29485, 65535, 25900, 25990, 65535, 35319, 24632, 28697, 26684, 21903, 21904, 21527, 
+      22994, 22331, 19408, 65535, 18475, 28827, 17776, 19029, 31758, 26287, 16712, 17099, 22230, 21291, 65535, 14385, 
+      16526, 22653, 26835, 31925, 12534, 19817, 20139, 38229, 13454, 17368, 13162, 20435, 14621, 12981, 16602, 12951, 
+      11802, 37134, 10197, 8585, 9698, 7041, 10812, 8358, 5278, 30150, 4058, 3115, 26888, 4501, 17452, 3339, 
+      65535, 65535, 12222, 24622, 33320, 16441, 15772, 12586, 9023, 31781, 19179, 15849, 34755, 29796, 29594, 65535, 
+      65535, 18830, 24460, 18749, 19494, 23835, 22150, 65535, 25615, 24962, 36231, 26668, 25856, 37424, 34043, 65535 },
+    { 28607, 16040, 35179, 65535, 65535, 29280, 18394, 65535, 17478, 65535, 28572, 18813, 65535, 18512, 37355, 65535, 
+      27957, 36692, 31508, 11299, 65535, 65535, 25206, 31935, 31063, 27490, 29021, 65535, 40377, 36888, 33135, 65535, 
+      65535, 65535, 65535, 65535, 38001, 32911, 65535, 34266, 65535, 65535, 65535, 32128, 65535, 65535, 40848, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33274, 37113, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      40182, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 25421, 65535, 65535, 65535, 31282, 65535, 65535, 65535, 
+      37558, 65535, 65535, 65535, 28903, 65535, 65535, 65535, 65535, 65535, 65535, 32571, 65535, 65535, 65535, 65535, 
+      24478, 22017, 29675, 40733, 65535, 65535, 65535, 23982, 65535, 65535, 65535, 21766, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 20736, 65535, 28247, 40427, 65535, 65535, 19921, 65535, 65535, 65535, 
+      21174, 34515, 65535, 65535, 65535, 65535, 33161, 23781, 65535, 65535, 65535, 65535, 65535, 28186, 10554, 65535, 
+      65535, 65535, 65535, 65535, 65535, 9829, 65535, 65535, 12951, 26092, 65535, 35193, 65535, 65535, 65535, 65535, 
+      38918, 39265, 65535, 9334, 65535, 26298, 65535, 41515, 21116, 65535, 65535, 65535, 31223, 65535, 6132, 65535, 
+      65535, 28304, 23220, 17489, 65535, 65535, 65535, 9840, 65535, 65535, 65535, 28693, 65535, 65535, 32448, 65535, 
+      65535, 9319, 39277, 65535, 65535, 65535, 35566, 65535, 65535, 14650, 65535, 65535, 17514, 65535, 26905, 65535, 
+      65535, 65535, 32293, 19898, 11464, 28662, 29571, 34623, 41691, 14508, 65535, 65535, 12601, 18143, 20714, 7002, 
+      6148, 38616, 31498, 65535, 65535, 37126, 65535, 10877, 65535, 65535, 24159, 65535, 65535, 26057, 32054, 10330 },
+    { 35835, 38820, 35878, 65535, 40625, 39250, 40608, 40515, 41883, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 41048, 65535, 65535, 41153, 41799, 38567, 37521, 39636, 41921, 41919, 39777, 65535, 35458, 40649, 35235, 
+      37743, 37525, 34656, 31571, 41502, 39184, 35319, 35996, 36186, 29967, 34231, 27595, 38564, 28921, 28127, 27089, 
+      24121, 23700, 26521, 33762, 25887, 23174, 25695, 22033, 23974, 38464, 26132, 27179, 18620, 33128, 33545, 19178, 
+      27607, 17089, 19090, 22546, 20540, 31808, 32156, 27336, 24199, 29185, 23945, 14465, 26082, 24181, 12744, 24356, 
+      22951, 25912, 12548, 19278, 21447, 18188, 8564, 20089, 15880, 18672, 15802, 15153, 15111, 16723, 5919, 15554, 
+      12222, 32293, 65535, 12438, 21117, 4548, 4260, 6053, 11284, 19647, 30542, 26417, 22666, 18067, 18576, 31527, 
+      35162, 16327, 17540, 19960, 26567, 20100, 30753, 31909, 35862, 33041, 26953, 27526, 30163, 28784, 27644, 40726 },
+    { 30023, 27961, 33037, 65535, 65535, 32925, 30099, 65535, 30891, 65535, 35100, 32696, 65535, 33839, 65535, 65535, 
+      38601, 65535, 40778, 31118, 65535, 65535, 40185, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 40313, 65535, 65535, 65535, 65535, 65535, 40302, 65535, 65535, 65535, 38108, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 35980, 65535, 39634, 65535, 65535, 65535, 34184, 65535, 65535, 65535, 
+      33281, 38191, 65535, 65535, 65535, 65535, 35769, 30853, 65535, 65535, 65535, 65535, 65535, 31183, 28879, 40358, 
+      65535, 65535, 41665, 35868, 65535, 27533, 65535, 65535, 25864, 25950, 65535, 28812, 65535, 37129, 35823, 34435, 
+      28420, 28332, 35157, 22742, 34837, 20634, 35033, 28488, 18359, 65535, 36459, 37876, 20240, 65535, 21842, 27672, 
+      38991, 17172, 15224, 14901, 30676, 65535, 65535, 16514, 35532, 41096, 35316, 15543, 37797, 35796, 17300, 36092, 
+      34591, 14705, 21885, 30900, 33481, 30071, 17542, 32150, 27737, 7781, 28003, 27461, 4163, 29114, 7638, 27961, 
+      24622, 19898, 12438, 65535, 8702, 8863, 9834, 15192, 22221, 8119, 65535, 38373, 11143, 8615, 11199, 19430, 
+      22866, 22211, 18090, 27535, 36726, 23340, 41458, 20494, 65535, 65535, 20878, 32986, 37944, 23310, 25480, 28442 },
+    { 26681, 20474, 31598, 65535, 65535, 28840, 22817, 65535, 23174, 65535, 29980, 24937, 65535, 25757, 38529, 65535, 
+      32132, 38657, 34923, 22512, 65535, 65535, 32375, 37581, 37008, 34733, 36523, 65535, 65535, 65535, 40408, 65535, 
+      65535, 65535, 65535, 65535, 65535, 41982, 65535, 65535, 65535, 65535, 65535, 41589, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36875, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 40218, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      35212, 32951, 39779, 65535, 65535, 65535, 65535, 33944, 65535, 65535, 65535, 31680, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 29993, 65535, 35605, 65535, 65535, 65535, 28562, 65535, 65535, 65535, 
+      28571, 37701, 65535, 65535, 65535, 65535, 35611, 28237, 65535, 65535, 65535, 65535, 65535, 30488, 21292, 65535, 
+      65535, 65535, 65535, 40497, 65535, 20151, 65535, 65535, 20227, 26245, 65535, 32331, 65535, 65535, 65535, 40927, 
+      33790, 33890, 65535, 16530, 65535, 23067, 65535, 34957, 18936, 65535, 65535, 65535, 25322, 65535, 14692, 35114, 
+      65535, 22068, 18159, 14604, 38661, 65535, 65535, 11541, 65535, 65535, 65535, 21354, 65535, 65535, 24230, 65535, 
+      65535, 9489, 29935, 39424, 65535, 38678, 25756, 40798, 36352, 7057, 36689, 36160, 7647, 37814, 16187, 36657, 
+      33320, 11464, 21117, 8702, 65535, 17259, 18142, 23161, 30234, 4197, 65535, 65535, 4966, 8097, 11389, 10996, 
+      14210, 28014, 21780, 33616, 65535, 27537, 65535, 12836, 65535, 65535, 18838, 37285, 65535, 21295, 25697, 19778 },
+    { 31779, 34287, 32495, 65535, 41421, 35141, 36060, 39360, 37353, 65535, 38231, 39133, 65535, 40698, 65535, 65535, 
+      65535, 65535, 65535, 39766, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      40882, 65535, 65535, 65535, 65535, 65535, 39834, 37247, 65535, 65535, 65535, 65535, 65535, 36101, 37712, 38882, 
+      65535, 41998, 38724, 34940, 65535, 36338, 39794, 40517, 34164, 30564, 38727, 29947, 65535, 33163, 32261, 31135, 
+      27320, 26984, 30818, 31318, 30232, 24068, 30099, 25777, 23754, 65535, 30653, 31723, 20748, 37570, 30644, 23357, 
+      32139, 18578, 19274, 21467, 25019, 36196, 36533, 24944, 28740, 33624, 28484, 16101, 30577, 28696, 15501, 28851, 
+      27466, 23287, 16783, 23805, 25877, 22677, 12543, 24515, 20384, 16069, 20188, 19468, 12308, 20917, 5247, 19725, 
+      16441, 28662, 4548, 8863, 17259, 65535, 1035, 6510, 13407, 15347, 33920, 29512, 18314, 13543, 14060, 27281, 
+      31026, 15402, 14505, 20049, 28272, 18182, 32848, 27459, 38528, 34819, 22717, 26796, 30579, 24681, 24246, 36553 },
+    { 31693, 34766, 32137, 65535, 40408, 35085, 36480, 38528, 37838, 65535, 38267, 39607, 65535, 41229, 65535, 65535, 
+      65535, 65535, 65535, 40632, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      41906, 65535, 65535, 65535, 65535, 65535, 40634, 38218, 65535, 65535, 65535, 65535, 65535, 36980, 38703, 39127, 
+      41996, 41780, 38791, 35273, 65535, 37338, 39574, 40229, 35198, 31439, 38479, 30532, 65535, 33132, 32290, 31207, 
+      27690, 27329, 30750, 32343, 30131, 24891, 29951, 25968, 24703, 65535, 30368, 31377, 21353, 36985, 31644, 23354, 
+      31674, 19290, 20171, 22475, 24797, 35572, 35901, 25974, 28302, 33042, 28040, 16775, 30052, 28203, 15943, 28331, 
+      26974, 24309, 16741, 23338, 25297, 22156, 12604, 23935, 19886, 17098, 19590, 18830, 13334, 20221, 6093, 19023, 
+      15772, 29571, 4260, 9834, 18142, 1035, 65535, 5478, 12404, 16080, 32998, 28557, 19008, 14076, 14356, 28014, 
+      31799, 14486, 13992, 19055, 27237, 17425, 31821, 28062, 37526, 33784, 22729, 25889, 29579, 24614, 23879, 37305 },
+    { 31964, 37815, 30928, 41782, 35159, 35428, 39208, 34462, 40864, 39147, 39015, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41443, 65535, 40133, 
+      40422, 40298, 38867, 36831, 41581, 65535, 38125, 38413, 40673, 35929, 36909, 33508, 38980, 32824, 32323, 31492, 
+      29626, 29145, 30318, 37811, 29539, 29173, 29117, 27035, 29639, 38049, 28796, 29452, 24633, 33682, 37034, 23512, 
+      29105, 23137, 24881, 27741, 23731, 32086, 32369, 31450, 25958, 29816, 25671, 20515, 27200, 25560, 18657, 25537, 
+      24369, 29771, 17043, 20989, 22256, 19552, 13780, 20931, 17508, 22572, 16640, 15682, 18805, 16668, 10977, 15481, 
+      12586, 34623, 6053, 15192, 23161, 6510, 5478, 65535, 7082, 20577, 27994, 23410, 23291, 17872, 17171, 32331, 
+      36257, 10291, 12734, 14061, 21763, 14311, 26349, 31800, 32139, 28311, 23799, 21483, 24456, 25208, 22878, 41617 },
+    { 35120, 65535, 32365, 34703, 29503, 38486, 65535, 31369, 65535, 33254, 65535, 65535, 35886, 65535, 65535, 37198, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40714, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 41706, 39641, 65535, 65535, 65535, 65535, 38747, 37433, 37431, 37837, 37183, 65535, 65535, 39487, 
+      36588, 36573, 37101, 37097, 35501, 65535, 34536, 34383, 65535, 40449, 33233, 35884, 33183, 30925, 30887, 30436, 
+      30840, 30235, 28426, 65535, 27497, 33606, 26794, 27316, 35077, 31754, 25559, 25731, 27940, 28152, 65535, 22945, 
+      24607, 27267, 30103, 33830, 21550, 26405, 26629, 38262, 21926, 24501, 21627, 24686, 22450, 21171, 21781, 20956, 
+      20108, 36666, 17503, 17355, 17570, 15714, 15903, 16400, 14256, 29417, 12664, 11544, 25683, 11761, 17104, 10746, 
+      9023, 41691, 11284, 22221, 30234, 13407, 12404, 7082, 65535, 27519, 20981, 16346, 30120, 24559, 23357, 39093, 
+      65535, 9816, 16068, 10382, 15284, 14827, 19576, 38197, 25122, 21773, 28255, 18506, 19468, 29107, 25181, 65535 },
+    { 23505, 19848, 27894, 65535, 65535, 25994, 21981, 65535, 22798, 65535, 27647, 24605, 65535, 25835, 35813, 65535, 
+      30650, 36174, 33050, 24889, 65535, 65535, 32085, 36435, 36006, 34378, 36217, 65535, 65535, 65535, 39856, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39506, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      38821, 36449, 65535, 65535, 65535, 65535, 65535, 37814, 65535, 65535, 65535, 35549, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 33985, 65535, 39793, 65535, 65535, 65535, 32630, 65535, 65535, 65535, 
+      32740, 41636, 65535, 65535, 65535, 65535, 39472, 32383, 65535, 65535, 65535, 65535, 65535, 34404, 24824, 65535, 
+      65535, 65535, 65535, 65535, 65535, 23809, 65535, 65535, 24349, 29919, 65535, 35122, 65535, 65535, 65535, 65535, 
+      35782, 35785, 65535, 20601, 65535, 26096, 65535, 36328, 22413, 65535, 65535, 65535, 27356, 65535, 18550, 35767, 
+      65535, 24131, 20897, 18172, 38777, 65535, 65535, 15736, 65535, 65535, 65535, 22961, 65535, 65535, 25221, 65535, 
+      65535, 13682, 29990, 38714, 41078, 37757, 25626, 39724, 35427, 10142, 35449, 34780, 9157, 36264, 15646, 35072, 
+      31781, 14508, 19647, 8119, 4197, 15347, 16080, 20577, 27519, 65535, 65535, 65535, 3067, 3947, 7193, 11936, 
+      15743, 24261, 17701, 29867, 40209, 23463, 65535, 12451, 65535, 65535, 15106, 33161, 39313, 17604, 21625, 21226 },
+    { 65535, 65535, 65535, 14416, 20062, 65535, 65535, 30562, 65535, 21277, 65535, 65535, 20057, 65535, 65535, 20008, 
+      65535, 65535, 65535, 65535, 30607, 65535, 65535, 65535, 65535, 65535, 65535, 20584, 65535, 65535, 65535, 65535, 
+      25635, 29389, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41318, 65535, 65535, 40939, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 33881, 65535, 38764, 65535, 65535, 65535, 29906, 35423, 65535, 65535, 65535, 65535, 65535, 65535, 39631, 
+      65535, 65535, 65535, 65535, 41575, 65535, 37937, 31877, 65535, 34245, 65535, 65535, 65535, 39719, 26628, 31770, 
+      65535, 33834, 65535, 32734, 65535, 65535, 28607, 65535, 25875, 29967, 65535, 65535, 29518, 28032, 34947, 65535, 
+      65535, 65535, 65535, 65535, 65535, 27376, 65535, 65535, 31582, 65535, 27924, 65535, 65535, 25752, 65535, 27990, 
+      65535, 23095, 30898, 65535, 23188, 26309, 65535, 65535, 65535, 65535, 39691, 33935, 65535, 65535, 65535, 26311, 
+      65535, 65535, 27777, 22745, 35235, 31328, 65535, 65535, 27321, 20856, 20856, 25040, 19611, 65535, 65535, 36602, 
+      25515, 25845, 31953, 37566, 17213, 65535, 24922, 23419, 65535, 65535, 23824, 65535, 16365, 27873, 29169, 29968, 
+      36155, 35473, 26559, 65535, 25669, 65535, 24524, 31755, 65535, 13216, 21207, 19706, 39318, 13995, 65535, 27476, 
+      16523, 40703, 65535, 65535, 22816, 12349, 12193, 65535, 17357, 13183, 17241, 38887, 14888, 15941, 34789, 15205, 
+      16207, 65535, 27429, 17901, 14592, 17303, 29621, 15186, 18886, 65535, 17334, 17235, 65535, 15270, 36275, 16126, 
+      19179, 65535, 30542, 65535, 65535, 33920, 32998, 27994, 20981, 65535, 65535, 4809, 65535, 65535, 65535, 65535, 
+      65535, 26397, 34279, 21712, 12147, 29946, 9225, 65535, 7516, 11520, 65535, 24803, 18953, 65535, 39597, 65535 },
+    { 65535, 65535, 39434, 18523, 19981, 65535, 65535, 28839, 65535, 22151, 65535, 65535, 22273, 65535, 65535, 22762, 
+      65535, 65535, 65535, 65535, 32308, 65535, 65535, 65535, 65535, 65535, 65535, 24652, 65535, 65535, 65535, 65535, 
+      29231, 32796, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 38017, 65535, 65535, 65535, 65535, 65535, 34294, 39694, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 36577, 65535, 38994, 65535, 65535, 65535, 65535, 31404, 36563, 
+      65535, 38634, 65535, 37539, 65535, 65535, 33412, 65535, 30683, 34770, 65535, 65535, 34312, 32825, 39665, 65535, 
+      65535, 65535, 65535, 65535, 65535, 32089, 65535, 65535, 36013, 65535, 32477, 65535, 65535, 30352, 65535, 32454, 
+      65535, 27782, 35115, 65535, 27841, 30771, 65535, 65535, 65535, 65535, 65535, 37463, 65535, 65535, 65535, 30334, 
+      65535, 65535, 31434, 26937, 37829, 34377, 65535, 65535, 30373, 24928, 24928, 28332, 23888, 65535, 65535, 38030, 
+      28398, 28657, 33691, 38222, 21608, 65535, 27400, 26166, 65535, 65535, 26183, 41809, 20358, 28830, 29872, 30405, 
+      35525, 34823, 27110, 65535, 26138, 65535, 25013, 31077, 65535, 17580, 21954, 20779, 37335, 17045, 65535, 26460, 
+      17856, 38256, 65535, 65535, 22189, 15210, 15174, 65535, 17692, 15164, 17501, 36184, 15811, 16259, 32211, 15567, 
+      16140, 65535, 25123, 16777, 13876, 15758, 26625, 14023, 16813, 65535, 14930, 14535, 41498, 12627, 32269, 13209, 
+      15849, 65535, 26417, 38373, 65535, 29512, 28557, 23410, 16346, 65535, 4809, 65535, 65535, 40642, 38964, 65535, 
+      65535, 21651, 29529, 17156, 8590, 25374, 7685, 65535, 9772, 10577, 41248, 21151, 16107, 41126, 35324, 65535 },
+    { 21714, 16822, 26735, 65535, 65535, 23917, 18995, 41850, 19751, 65535, 25229, 21557, 65535, 22769, 33654, 65535, 
+      27858, 33863, 30416, 22347, 65535, 65535, 29043, 33555, 33089, 31345, 33181, 65535, 41910, 39554, 36857, 65535, 
+      65535, 65535, 65535, 65535, 65535, 39236, 65535, 40532, 65535, 65535, 65535, 39093, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41463, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36988, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 41204, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      37079, 34602, 65535, 65535, 65535, 65535, 65535, 36440, 65535, 65535, 65535, 34192, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 32869, 65535, 39362, 65535, 65535, 65535, 31712, 65535, 65535, 65535, 
+      32205, 65535, 65535, 65535, 65535, 65535, 40426, 32648, 65535, 65535, 65535, 65535, 65535, 35271, 23132, 65535, 
+      65535, 65535, 65535, 65535, 65535, 22278, 65535, 65535, 23684, 31172, 65535, 37203, 65535, 65535, 65535, 65535, 
+      38317, 38364, 65535, 19834, 65535, 27988, 65535, 39105, 23902, 65535, 65535, 65535, 29849, 65535, 17398, 38726, 
+      65535, 26599, 22982, 19566, 41818, 65535, 65535, 15811, 65535, 65535, 65535, 25615, 65535, 65535, 28078, 65535, 
+      65535, 13836, 33027, 41775, 65535, 40805, 28674, 65535, 38477, 11924, 38463, 37775, 11703, 39224, 18705, 38028, 
+      34755, 12601, 22666, 11143, 4966, 18314, 19008, 23291, 30120, 3067, 65535, 65535, 65535, 5674, 8135, 9053, 
+      12969, 26037, 18942, 31594, 65535, 24633, 65535, 9385, 65535, 65535, 14051, 34078, 40525, 16464, 21268, 18358 },
+    { 21464, 20756, 25038, 65535, 65535, 24315, 22603, 38362, 23817, 65535, 26532, 25603, 65535, 27161, 34097, 65535, 
+      30369, 34713, 32310, 27994, 65535, 65535, 32922, 36361, 36081, 35103, 36949, 65535, 65535, 65535, 40284, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 40157, 65535, 65535, 65535, 65535, 65535, 41704, 65535, 65535, 65535, 39441, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 37917, 65535, 65535, 65535, 65535, 65535, 36576, 65535, 65535, 65535, 
+      36667, 65535, 65535, 65535, 65535, 65535, 65535, 36083, 65535, 65535, 65535, 65535, 65535, 37750, 28591, 65535, 
+      65535, 65535, 65535, 65535, 65535, 27635, 65535, 65535, 28294, 33000, 65535, 37195, 65535, 65535, 65535, 65535, 
+      37034, 36941, 65535, 24548, 65535, 28555, 65535, 36960, 25373, 65535, 65535, 65535, 28826, 65535, 22461, 35721, 
+      65535, 25712, 23192, 21291, 38163, 65535, 65535, 19588, 65535, 65535, 65535, 24156, 65535, 65535, 25767, 65535, 
+      41009, 17530, 29519, 37344, 39372, 36214, 25106, 38010, 33926, 13160, 33662, 32880, 11189, 34188, 15205, 32986, 
+      29796, 18143, 18067, 8615, 8097, 13543, 14076, 17872, 24559, 3947, 65535, 40642, 5674, 65535, 3392, 14534, 
+      18521, 20484, 13759, 26075, 36527, 19520, 41503, 14032, 65535, 65535, 12466, 29216, 35383, 14954, 18195, 23769 },
+    { 18947, 20679, 21943, 65535, 65535, 22015, 22219, 34971, 23743, 65535, 24621, 25464, 65535, 27275, 31646, 65535, 
+      29047, 32432, 30592, 29822, 65535, 65535, 32489, 35107, 34953, 34536, 36358, 65535, 65535, 41128, 39384, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 40929, 65535, 65535, 65535, 65535, 65535, 39680, 65535, 65535, 65535, 
+      39912, 65535, 65535, 65535, 65535, 65535, 65535, 39470, 65535, 65535, 65535, 65535, 65535, 41105, 31259, 65535, 
+      65535, 65535, 65535, 65535, 65535, 30412, 65535, 65535, 31478, 36288, 65535, 40009, 65535, 65535, 65535, 65535, 
+      39353, 39197, 65535, 27687, 65535, 31614, 65535, 38856, 28640, 65535, 65535, 65535, 31365, 65535, 25440, 37128, 
+      65535, 28351, 26215, 24615, 39076, 65535, 65535, 22921, 65535, 65535, 65535, 26593, 65535, 65535, 27764, 65535, 
+      41182, 20864, 30690, 37605, 39287, 36333, 26327, 37938, 34121, 16495, 33589, 32709, 14281, 33818, 16799, 32624, 
+      29594, 20714, 18576, 11199, 11389, 14060, 14356, 17171, 23357, 7193, 65535, 38964, 8135, 3392, 65535, 16186, 
+      20197, 18038, 10808, 23538, 34135, 16517, 39095, 14846, 65535, 39863, 9712, 26078, 32417, 12117, 14856, 25092 },
+    { 21621, 10324, 28181, 65535, 65535, 22447, 12782, 65535, 12593, 65535, 22116, 14265, 65535, 14832, 31000, 65535, 
+      22515, 30562, 25808, 13637, 65535, 65535, 21553, 27356, 26649, 23920, 25671, 65535, 35980, 32946, 29649, 65535, 
+      65535, 65535, 41955, 65535, 35512, 30988, 65535, 32329, 65535, 65535, 65535, 30628, 65535, 65535, 38902, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 32689, 36278, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      41624, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28177, 65535, 65535, 65535, 34652, 65535, 65535, 65535, 
+      41510, 65535, 65535, 65535, 32851, 65535, 65535, 65535, 65535, 65535, 65535, 37565, 65535, 65535, 65535, 65535, 
+      29676, 27042, 35317, 65535, 65535, 65535, 65535, 29902, 65535, 65535, 65535, 27793, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 27148, 65535, 35064, 65535, 65535, 65535, 26580, 65535, 65535, 65535, 
+      28075, 41444, 65535, 65535, 65535, 65535, 39993, 30740, 65535, 65535, 65535, 65535, 65535, 34935, 16497, 65535, 
+      65535, 65535, 65535, 65535, 65535, 16175, 65535, 65535, 19948, 32331, 65535, 40671, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 16321, 65535, 31405, 65535, 65535, 26434, 65535, 65535, 65535, 35215, 65535, 13134, 65535, 
+      65535, 32045, 27408, 22332, 65535, 65535, 65535, 15588, 65535, 65535, 65535, 31790, 65535, 65535, 35004, 65535, 
+      65535, 14359, 40928, 65535, 65535, 65535, 36746, 65535, 65535, 16986, 65535, 65535, 18568, 65535, 27051, 65535, 
+      65535, 7002, 31527, 19430, 10996, 27281, 28014, 32331, 39093, 11936, 65535, 65535, 9053, 14534, 16186, 65535, 
+      4018, 34101, 26457, 39455, 65535, 31765, 65535, 3891, 65535, 65535, 17559, 40321, 65535, 19276, 25464, 9307 },
+    { 23520, 9969, 30367, 65535, 65535, 23730, 12277, 65535, 11339, 65535, 22652, 12724, 65535, 12643, 31337, 65535, 
+      21809, 30601, 25365, 9636, 65535, 41975, 19431, 25918, 25084, 21767, 23401, 65535, 34444, 31088, 27489, 65535, 
+      65535, 65535, 39941, 65535, 32862, 28045, 65535, 29403, 65535, 65535, 65535, 27508, 65535, 65535, 36029, 65535, 
+      65535, 65535, 65535, 65535, 65535, 39975, 65535, 65535, 65535, 65535, 65535, 29264, 32961, 40483, 65535, 65535, 
+      40711, 65535, 65535, 65535, 39998, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      37766, 65535, 39854, 65535, 65535, 65535, 65535, 65535, 24159, 65535, 65535, 65535, 30639, 65535, 65535, 65535, 
+      37519, 65535, 65535, 65535, 28879, 65535, 65535, 65535, 65535, 65535, 65535, 33759, 65535, 65535, 65535, 65535, 
+      25986, 23322, 31749, 65535, 65535, 65535, 65535, 26525, 65535, 65535, 65535, 24505, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 24158, 65535, 32476, 65535, 65535, 65535, 23861, 65535, 65535, 65535, 
+      25754, 40055, 65535, 65535, 65535, 65535, 38895, 29309, 65535, 65535, 65535, 65535, 65535, 34047, 13425, 65535, 
+      65535, 65535, 65535, 65535, 65535, 13412, 65535, 65535, 18184, 32211, 65535, 41322, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 14957, 65535, 32341, 65535, 65535, 27187, 65535, 65535, 65535, 36931, 65535, 11721, 65535, 
+      65535, 33889, 28952, 23410, 65535, 65535, 65535, 15935, 65535, 65535, 65535, 33984, 65535, 65535, 37490, 65535, 
+      65535, 15198, 65535, 65535, 65535, 65535, 39823, 65535, 65535, 19342, 65535, 65535, 21484, 65535, 30396, 65535, 
+      65535, 6148, 35162, 22866, 14210, 31026, 31799, 36257, 65535, 15743, 65535, 65535, 12969, 18521, 20197, 4018, 
+      65535, 38067, 30368, 65535, 65535, 35572, 65535, 6565, 65535, 65535, 20825, 65535, 65535, 22276, 28636, 5576 },
+    { 25596, 35940, 22551, 37646, 26648, 28879, 36523, 24223, 38652, 30811, 32810, 40006, 35113, 65535, 34838, 37108, 
+      38961, 36572, 38353, 65535, 40028, 41567, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41191, 40718, 40617, 40082, 
+      39506, 38970, 38210, 65535, 37293, 39264, 36606, 36450, 39141, 38990, 35328, 35399, 34923, 36664, 65535, 32370, 
+      33999, 33366, 34656, 36584, 31335, 34809, 34956, 38501, 31554, 33348, 31255, 30757, 31760, 30684, 28919, 30389, 
+      29692, 36553, 26388, 27128, 27041, 25474, 23747, 25966, 24072, 29983, 22442, 21316, 26341, 21329, 20569, 20409, 
+      18830, 38616, 16327, 22211, 28014, 15402, 14486, 10291, 9816, 24261, 26397, 21651, 26037, 20484, 18038, 34101, 
+      38067, 65535, 7882, 5608, 16100, 5014, 21068, 32131, 27705, 22029, 19837, 11405, 15738, 20167, 15529, 65535 },
+    { 19396, 28156, 18357, 65535, 31999, 22846, 28885, 26156, 30944, 36121, 26577, 32375, 41112, 34600, 30509, 65535, 
+      32453, 31964, 32511, 39949, 65535, 39497, 38113, 38129, 38385, 39638, 41246, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 41220, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      41613, 41217, 65535, 38294, 65535, 37888, 41754, 39512, 36368, 65535, 41135, 41551, 35235, 65535, 36195, 36217, 
+      40649, 32911, 32670, 32981, 36356, 65535, 65535, 33052, 37834, 40505, 37536, 30523, 38514, 37176, 29933, 36997, 
+      36073, 31007, 29677, 33044, 33610, 31471, 26050, 32402, 29684, 25363, 28423, 27345, 22161, 27794, 19503, 26728, 
+      24460, 31498, 17540, 18090, 21780, 14505, 13992, 12734, 16068, 17701, 34279, 29529, 18942, 13759, 10808, 26457, 
+      30368, 7882, 65535, 13006, 23648, 5762, 28544, 24297, 35234, 29120, 12266, 15528, 21639, 13049, 10180, 34681 },
+    { 28325, 40326, 23888, 32136, 21443, 31309, 40589, 21070, 65535, 25562, 35271, 65535, 29614, 65535, 35539, 31552, 
+      41500, 37424, 40236, 65535, 35232, 40218, 65535, 65535, 65535, 65535, 65535, 37254, 65535, 65535, 65535, 65535, 
+      39425, 41679, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41931, 41931, 65535, 41012, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 38763, 65535, 65535, 41470, 65535, 65535, 40822, 65535, 37357, 40202, 40447, 40205, 
+      41212, 40599, 37802, 65535, 36817, 65535, 35959, 37589, 65535, 34735, 34069, 33760, 37990, 33356, 65535, 33080, 
+      31812, 36927, 38943, 41504, 31050, 31467, 31544, 65535, 29918, 30470, 29631, 34299, 29514, 28823, 31829, 28392, 
+      28012, 65535, 27878, 26128, 25241, 24471, 26126, 24395, 23592, 35314, 21653, 20553, 31609, 20002, 24968, 19347, 
+      18749, 65535, 19960, 27535, 33616, 20049, 19055, 14061, 10382, 29867, 21712, 17156, 31594, 26075, 23538, 39455, 
+      65535, 5608, 13006, 65535, 10646, 8234, 15573, 37245, 22250, 16425, 24134, 8124, 10541, 23977, 18369, 65535 },
+    { 36771, 65535, 30960, 21547, 14706, 39207, 65535, 20899, 65535, 18140, 65535, 65535, 20653, 65535, 40574, 22140, 
+      65535, 65535, 65535, 65535, 28715, 41154, 65535, 65535, 65535, 65535, 65535, 26908, 65535, 65535, 65535, 41325, 
+      29822, 32639, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 39539, 65535, 65535, 65535, 65535, 65535, 36932, 41591, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 40647, 65535, 65535, 65535, 65535, 65535, 65535, 36329, 41529, 
+      65535, 65535, 65535, 65535, 65535, 65535, 38777, 65535, 36268, 40595, 65535, 65535, 40324, 38891, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 38784, 65535, 65535, 65535, 65535, 39747, 65535, 65535, 37510, 65535, 39940, 
+      65535, 34669, 65535, 65535, 34857, 38272, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 38456, 
+      65535, 65535, 39825, 34880, 65535, 65535, 65535, 65535, 38949, 33003, 33003, 36859, 31730, 65535, 65535, 65535, 
+      36986, 37247, 65535, 65535, 29288, 65535, 35972, 34756, 65535, 65535, 34741, 65535, 28498, 36796, 37645, 37963, 
+      41852, 41155, 34841, 65535, 33837, 65535, 32758, 37530, 65535, 25328, 29952, 28977, 41657, 25589, 65535, 32741, 
+      26221, 41705, 65535, 65535, 29114, 23774, 23720, 65535, 25585, 23723, 25357, 39262, 24070, 24204, 35786, 23566, 
+      23851, 65535, 29680, 23567, 21270, 22196, 29778, 21024, 22485, 65535, 20364, 19569, 40529, 18062, 32366, 18098, 
+      19494, 65535, 26567, 36726, 65535, 28272, 27237, 21763, 15284, 40209, 12147, 8590, 65535, 36527, 34135, 65535, 
+      65535, 16100, 23648, 10646, 65535, 18573, 4976, 65535, 11613, 6548, 34277, 12692, 7672, 33733, 27574, 65535 },
+    { 20746, 32093, 17548, 39634, 26254, 23967, 32400, 21298, 34621, 30389, 27918, 35843, 35350, 38187, 29861, 37600, 
+      34107, 31576, 33375, 65535, 38497, 37095, 40631, 39229, 39693, 41793, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41611, 41116, 41308, 65535, 40334, 40375, 38629, 41195, 41942, 37191, 
+      38885, 36712, 37236, 38206, 36323, 39318, 39432, 38753, 36522, 38039, 36224, 34174, 36625, 35619, 32844, 35300, 
+      34650, 36717, 31038, 32137, 31973, 30481, 28074, 30927, 29083, 30848, 27453, 26326, 27483, 26301, 23420, 25402, 
+      23835, 37126, 20100, 23340, 27537, 18182, 17425, 14311, 14827, 23463, 29946, 25374, 24633, 19520, 16517, 31765, 
+      35572, 5014, 5762, 8234, 18573, 65535, 23322, 29265, 29995, 23629, 15900, 9819, 15900, 15810, 10646, 39491 },
+    { 40369, 65535, 34091, 16578, 12394, 65535, 65535, 21501, 65535, 15000, 65535, 65535, 16424, 65535, 65535, 17623, 
+      65535, 65535, 65535, 65535, 25504, 40945, 65535, 65535, 65535, 65535, 65535, 21958, 65535, 65535, 65535, 39224, 
+      25118, 28139, 65535, 65535, 65535, 65535, 41490, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 39526, 65535, 65535, 39604, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 34741, 65535, 39284, 65535, 65535, 65535, 31990, 36749, 65535, 65535, 65535, 65535, 65535, 65535, 41571, 
+      65535, 65535, 65535, 65535, 65535, 65535, 41104, 35677, 65535, 38406, 65535, 65535, 65535, 65535, 31443, 36624, 
+      65535, 38783, 65535, 37860, 65535, 65535, 33946, 65535, 31499, 35846, 65535, 65535, 35624, 34218, 41629, 65535, 
+      65535, 65535, 65535, 65535, 65535, 34326, 65535, 65535, 39474, 65535, 35557, 65535, 65535, 33286, 65535, 35882, 
+      65535, 30348, 39240, 65535, 30597, 34247, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34992, 
+      65535, 65535, 36759, 31273, 65535, 40529, 65535, 65535, 36529, 29571, 29572, 34204, 28083, 65535, 65535, 65535, 
+      34739, 35070, 40929, 65535, 25553, 65535, 34113, 32639, 65535, 65535, 32986, 65535, 25243, 36372, 37482, 38062, 
+      65535, 65535, 34741, 65535, 33779, 65535, 32648, 38690, 65535, 21751, 29521, 28242, 65535, 23220, 65535, 34017, 
+      25195, 65535, 65535, 65535, 29848, 21556, 21411, 65535, 25320, 22146, 25140, 65535, 23279, 23881, 38749, 23175, 
+      23811, 65535, 32053, 24389, 21557, 23277, 32870, 21657, 24092, 65535, 22081, 21502, 65535, 19725, 36643, 20073, 
+      22150, 65535, 30753, 41458, 65535, 32848, 31821, 26349, 19576, 65535, 9225, 7685, 65535, 41503, 39095, 65535, 
+      65535, 21068, 28544, 15573, 4976, 23322, 65535, 65535, 6692, 2939, 38790, 16298, 9905, 38042, 31725, 65535 },
+    { 17734, 7640, 24337, 65535, 65535, 18594, 9991, 41222, 10431, 65535, 18465, 12227, 65535, 13386, 27354, 65535, 
+      19495, 27036, 22572, 15748, 65535, 38776, 19718, 24765, 24175, 22046, 23869, 65535, 33334, 30607, 27649, 65535, 
+      65535, 65535, 39629, 65535, 33934, 29854, 65535, 31148, 65535, 65535, 65535, 29746, 65535, 65535, 37542, 65535, 
+      65535, 65535, 65535, 65535, 65535, 41414, 65535, 65535, 65535, 65535, 65535, 32262, 35606, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 29734, 65535, 65535, 65535, 36367, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 34924, 65535, 65535, 65535, 65535, 65535, 65535, 40135, 65535, 65535, 65535, 65535, 
+      32481, 29805, 38288, 65535, 65535, 65535, 65535, 33089, 65535, 65535, 65535, 31059, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 30626, 65535, 38753, 65535, 65535, 65535, 30198, 65535, 65535, 65535, 
+      31840, 65535, 65535, 65535, 65535, 65535, 65535, 34631, 65535, 65535, 65535, 65535, 65535, 38789, 19898, 65535, 
+      65535, 65535, 65535, 65535, 65535, 19738, 65535, 65535, 23805, 36028, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 20206, 65535, 34673, 65535, 65535, 29841, 65535, 65535, 65535, 37941, 65535, 17007, 65535, 
+      65535, 34711, 30356, 25628, 65535, 65535, 65535, 19272, 65535, 65535, 65535, 34163, 65535, 65535, 37042, 65535, 
+      65535, 17897, 65535, 65535, 65535, 65535, 38036, 65535, 65535, 19516, 65535, 65535, 20448, 65535, 28086, 65535, 
+      65535, 10877, 31909, 20494, 12836, 27459, 28062, 31800, 38197, 12451, 65535, 65535, 9385, 14032, 14846, 3891, 
+      6565, 32131, 24297, 37245, 65535, 29265, 65535, 65535, 65535, 65535, 14261, 37286, 65535, 15750, 22080, 10407 },
+    { 65535, 65535, 39448, 9982, 13198, 65535, 65535, 24785, 65535, 13858, 65535, 65535, 12694, 65535, 65535, 12999, 
+      65535, 65535, 65535, 65535, 23129, 65535, 65535, 65535, 65535, 65535, 65535, 15677, 65535, 65535, 65535, 37884, 
+      19639, 23088, 65535, 65535, 65535, 65535, 38141, 65535, 65535, 41258, 65535, 65535, 65535, 65535, 65535, 40142, 
+      65535, 41685, 65535, 65535, 65535, 65535, 34940, 65535, 65535, 34771, 65535, 65535, 65535, 65535, 38723, 65535, 
+      65535, 28856, 65535, 33589, 65535, 65535, 65535, 25679, 30726, 40934, 65535, 65535, 37891, 41793, 65535, 35409, 
+      65535, 65535, 65535, 65535, 37994, 65535, 34629, 29063, 65535, 31763, 65535, 65535, 65535, 37654, 24751, 29934, 
+      65535, 32093, 65535, 31168, 65535, 65535, 27265, 65535, 24850, 29204, 65535, 65535, 29014, 27631, 35086, 65535, 
+      65535, 65535, 65535, 65535, 65535, 27924, 65535, 65535, 33415, 65535, 29416, 65535, 65535, 27133, 65535, 29879, 
+      65535, 24119, 33505, 65535, 24432, 28302, 65535, 65535, 65535, 65535, 65535, 38044, 65535, 65535, 65535, 29694, 
+      65535, 65535, 31902, 25886, 40737, 36344, 65535, 65535, 32488, 24457, 24458, 29946, 22729, 65535, 65535, 65535, 
+      30987, 31394, 38420, 65535, 20158, 65535, 30894, 29146, 65535, 65535, 29957, 65535, 20531, 34939, 36340, 37239, 
+      65535, 65535, 33823, 65535, 32972, 65535, 31832, 39264, 65535, 16741, 28465, 26857, 65535, 19909, 65535, 34986, 
+      23632, 65535, 65535, 65535, 30332, 18601, 18336, 65535, 24786, 20069, 24686, 65535, 22200, 23388, 41842, 22652, 
+      23705, 65535, 34603, 25374, 22094, 24688, 36366, 22635, 26112, 65535, 24396, 24132, 65535, 22182, 41770, 22874, 
+      25615, 65535, 35862, 65535, 65535, 38528, 37526, 32139, 25122, 65535, 7516, 9772, 65535, 65535, 65535, 65535, 
+      65535, 27705, 35234, 22250, 11613, 29995, 6692, 65535, 65535, 6917, 65535, 22461, 15668, 65535, 38020, 65535 },
+    { 39201, 65535, 32659, 16013, 9456, 41038, 65535, 19043, 65535, 12164, 65535, 65535, 14120, 65535, 40157, 15603, 
+      65535, 65535, 65535, 65535, 22726, 38143, 65535, 65535, 65535, 65535, 65535, 20835, 65535, 65535, 65535, 36297, 
+      23336, 26093, 65535, 65535, 65535, 65535, 38790, 65535, 65535, 41632, 65535, 65535, 65535, 65535, 65535, 41194, 
+      65535, 65535, 65535, 65535, 65535, 65535, 37178, 65535, 65535, 37350, 65535, 65535, 65535, 65535, 41519, 65535, 
+      65535, 33102, 65535, 37470, 65535, 65535, 65535, 30762, 35197, 65535, 65535, 65535, 65535, 65535, 65535, 40102, 
+      65535, 65535, 65535, 65535, 65535, 65535, 40013, 34906, 65535, 37698, 65535, 65535, 65535, 65535, 31125, 36200, 
+      65535, 38349, 65535, 37510, 65535, 65535, 33761, 65535, 31479, 35830, 65535, 65535, 35704, 34360, 41846, 65535, 
+      65535, 65535, 65535, 65535, 65535, 34795, 65535, 65535, 40331, 65535, 36332, 65535, 65535, 34049, 65535, 36790, 
+      65535, 31033, 40372, 65535, 31349, 35204, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 36410, 
+      65535, 65535, 38426, 32625, 65535, 65535, 65535, 65535, 38556, 31075, 31075, 36133, 29444, 65535, 65535, 65535, 
+      36864, 37223, 65535, 65535, 26878, 65535, 36409, 34842, 65535, 65535, 35332, 65535, 26923, 39094, 40254, 40879, 
+      65535, 65535, 37535, 65535, 36584, 65535, 35447, 41620, 65535, 23263, 32273, 30934, 65535, 25412, 65535, 36954, 
+      27835, 65535, 65535, 65535, 32762, 23837, 23656, 65535, 28124, 24655, 27954, 65535, 25991, 26683, 41539, 25969, 
+      26658, 65535, 34933, 27317, 24452, 26214, 35616, 24579, 27024, 65535, 25004, 24409, 65535, 22647, 38875, 22972, 
+      24962, 65535, 33041, 65535, 65535, 34819, 33784, 28311, 21773, 65535, 11520, 10577, 65535, 65535, 39863, 65535, 
+      65535, 22029, 29120, 16425, 6548, 23629, 2939, 65535, 6917, 65535, 38553, 15582, 8753, 37559, 31144, 65535 },
+    { 9279, 16203, 12792, 65535, 38161, 12492, 16687, 28135, 18825, 41721, 15539, 20173, 65535, 22451, 21963, 65535, 
+      20807, 22835, 21640, 29691, 65535, 33129, 25908, 26768, 26839, 27545, 29225, 65535, 33374, 32547, 31527, 65535, 
+      65535, 65535, 40146, 65535, 38315, 36361, 65535, 37310, 65535, 65535, 65535, 37044, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40537, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34044, 65535, 
+      65535, 65535, 65535, 65535, 65535, 33721, 65535, 65535, 36797, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 32952, 65535, 40988, 65535, 65535, 37516, 65535, 65535, 65535, 41077, 65535, 30043, 65535, 
+      65535, 38048, 35648, 33274, 65535, 65535, 65535, 29773, 65535, 65535, 65535, 36303, 65535, 65535, 37325, 65535, 
+      65535, 27844, 39469, 65535, 65535, 65535, 35259, 65535, 41294, 25234, 40273, 39241, 23642, 39875, 26242, 38766, 
+      36231, 24159, 26953, 20878, 18838, 22717, 22729, 23799, 28255, 15106, 65535, 41248, 14051, 12466, 9712, 17559, 
+      20825, 19837, 12266, 24134, 34277, 15900, 38790, 14261, 65535, 38553, 65535, 23064, 29972, 2507, 7913, 23921 },
+    { 24157, 38250, 18288, 31253, 16486, 26515, 37836, 13062, 40175, 20594, 30285, 40953, 25710, 65535, 28688, 28049, 
+      36311, 30640, 34337, 65535, 28891, 32188, 65535, 40004, 40777, 65535, 65535, 35118, 40908, 65535, 65535, 36497, 
+      35686, 37077, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 41783, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41168, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37892, 41032, 40430, 65535, 38195, 65535, 41052, 
+      38050, 65535, 65535, 65535, 38673, 36350, 36323, 65535, 36712, 36011, 36443, 41989, 35784, 35470, 39784, 34936, 
+      34835, 65535, 35997, 33475, 32070, 31863, 34187, 31426, 31269, 40601, 29235, 28177, 37147, 27353, 31975, 26865, 
+      26668, 65535, 27526, 32986, 37285, 26796, 25889, 21483, 18506, 33161, 24803, 21151, 34078, 29216, 26078, 40321, 
+      65535, 11405, 15528, 8124, 12692, 9819, 16298, 37286, 22461, 15582, 23064, 65535, 6909, 21979, 15563, 65535 },
+    { 30545, 65535, 24186, 24354, 10929, 32569, 65535, 13394, 65535, 15079, 36132, 65535, 19555, 65535, 33007, 21729, 
+      41870, 34965, 39425, 65535, 24742, 33739, 65535, 65535, 65535, 65535, 65535, 28416, 65535, 65535, 65535, 35279, 
+      29547, 31422, 65535, 65535, 65535, 65535, 40376, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 40811, 65535, 65535, 41372, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 39248, 65535, 65535, 65535, 65535, 65535, 37864, 41483, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39435, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 40012, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 39786, 65535, 65535, 40099, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 41147, 65535, 65535, 65535, 65535, 65535, 39473, 39474, 65535, 37957, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 35413, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35143, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 41429, 65535, 40366, 65535, 65535, 31649, 37611, 36650, 65535, 32841, 65535, 39803, 
+      33875, 65535, 65535, 65535, 36497, 31090, 30992, 65535, 33240, 31267, 33007, 65535, 31738, 31867, 41185, 31234, 
+      31485, 65535, 35952, 30984, 28863, 29531, 35216, 28536, 29546, 65535, 27414, 26507, 65535, 25210, 35424, 25060, 
+      25856, 65535, 30163, 37944, 65535, 30579, 29579, 24456, 19468, 39313, 18953, 16107, 40525, 35383, 32417, 65535, 
+      65535, 15738, 21639, 10541, 7672, 15900, 9905, 65535, 15668, 8753, 29972, 6909, 65535, 28861, 22430, 65535 },
+    { 7104, 16521, 10309, 65535, 36456, 10471, 16614, 26008, 18870, 39872, 13829, 20039, 65535, 22395, 19680, 65535, 
+      19463, 20655, 19912, 30733, 65535, 30705, 25150, 25283, 25453, 26601, 28198, 65535, 31455, 30892, 30187, 41185, 
+      65535, 65535, 38165, 41834, 36889, 35336, 65535, 36201, 65535, 65535, 65535, 36148, 65535, 65535, 40704, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 39753, 41702, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 35647, 65535, 
+      65535, 65535, 65535, 65535, 65535, 35434, 65535, 65535, 38845, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 35029, 65535, 65535, 65535, 65535, 40016, 65535, 65535, 65535, 65535, 65535, 32043, 65535, 
+      65535, 40468, 38143, 35766, 65535, 65535, 65535, 32105, 65535, 65535, 65535, 38672, 65535, 65535, 39551, 65535, 
+      65535, 30202, 41332, 65535, 65535, 65535, 37207, 65535, 65535, 27736, 41425, 40360, 26137, 40842, 28441, 39774, 
+      37424, 26057, 28784, 23310, 21295, 24681, 24614, 25208, 29107, 17604, 65535, 41126, 16464, 14954, 12117, 19276, 
+      22276, 20167, 13049, 23977, 33733, 15810, 38042, 15750, 65535, 37559, 2507, 21979, 28861, 65535, 6440, 24860 },
+    { 10100, 22763, 8258, 65535, 30248, 13350, 22580, 20582, 24896, 33830, 17285, 25884, 39535, 28279, 20331, 65535, 
+      23462, 21818, 22881, 37170, 38756, 29702, 30075, 28688, 29103, 31162, 32555, 65535, 33257, 33614, 33791, 38995, 
+      65535, 65535, 39505, 65535, 40081, 39521, 65535, 40184, 65535, 65535, 65535, 40577, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 41933, 65535, 
+      65535, 65535, 65535, 65535, 65535, 41632, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 40713, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 37878, 65535, 
+      65535, 41972, 40704, 39471, 65535, 65535, 65535, 37064, 65535, 65535, 65535, 39795, 65535, 65535, 39739, 65535, 
+      65535, 35061, 39857, 65535, 65535, 40892, 36190, 41487, 39321, 31347, 37838, 36722, 29006, 36844, 28876, 35894, 
+      34043, 32054, 27644, 25480, 25697, 24246, 23879, 22878, 25181, 21625, 39597, 35324, 21268, 18195, 14856, 25464, 
+      28636, 15529, 10180, 18369, 27574, 10646, 31725, 22080, 38020, 31144, 7913, 15563, 22430, 6440, 65535, 31289 },
+    { 24328, 9324, 31297, 65535, 65535, 23631, 10875, 65535, 9021, 65535, 21571, 9720, 65535, 8681, 29557, 65535, 
+      19110, 28456, 22818, 5921, 65535, 39088, 15070, 22115, 21160, 17283, 18744, 65535, 30309, 26689, 22854, 65535, 
+      65535, 65535, 35253, 40282, 27718, 22728, 65535, 24088, 65535, 65535, 65535, 22083, 65535, 41518, 30709, 65535, 
+      65535, 65535, 40037, 65535, 65535, 34640, 65535, 65535, 65535, 65535, 41806, 23706, 27429, 34959, 65535, 65535, 
+      35165, 65535, 38527, 65535, 34422, 65535, 40433, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 
+      32318, 65535, 34444, 65535, 65535, 65535, 65535, 65535, 19328, 65535, 65535, 65535, 25961, 65535, 65535, 65535, 
+      33016, 65535, 65535, 65535, 24607, 38607, 65535, 65535, 65535, 65535, 40917, 30139, 65535, 65535, 65535, 65535, 
+      22930, 20255, 28891, 40887, 65535, 65535, 65535, 24327, 65535, 65535, 65535, 22610, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 65535, 65535, 65535, 22954, 65535, 31727, 65535, 65535, 65535, 23228, 65535, 65535, 65535, 
+      25757, 40991, 65535, 65535, 65535, 65535, 40280, 30561, 65535, 65535, 65535, 65535, 65535, 35878, 12893, 65535, 
+      65535, 65535, 65535, 65535, 65535, 13555, 65535, 65535, 19558, 35058, 65535, 65535, 65535, 65535, 65535, 65535, 
+      65535, 65535, 65535, 17178, 65535, 36313, 65535, 65535, 31108, 65535, 65535, 65535, 41528, 65535, 14261, 65535, 
+      65535, 38633, 33531, 27726, 65535, 65535, 65535, 19923, 65535, 65535, 65535, 38986, 65535, 65535, 65535, 65535, 
+      65535, 19626, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 24603, 65535, 65535, 26960, 65535, 35961, 65535, 
+      65535, 10330, 40726, 28442, 19778, 36553, 37305, 41617, 65535, 21226, 65535, 65535, 18358, 23769, 25092, 9307, 
+      5576, 65535, 34681, 65535, 65535, 39491, 65535, 10407, 65535, 65535, 23921, 65535, 65535, 24860, 31289, 65535 },
+};
@@ -0,0 +1,25 @@
+#ifndef CATALOG_ANGLE_MATRIX_H
+#define CATALOG_ANGLE_MATRIX_H
+
+#include <stdint.h>
+#include "catalog_xyz.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// every catalog pair's angle in CATALOG_PAIR_ANGLE_LSB_MDEG units,
+// ANGLE_MATRIX_NONE past CATALOG_MAX_ANGLE_MDEG and for a star with itself
+#define ANGLE_MATRIX_NONE 0xFFFF
+#define ANGLE_MATRIX_OFF    0   // not generated
+#define ANGLE_MATRIX_FULL   1   // catalog_angle_matrix[a][b]
+#define ANGLE_MATRIX_PACKED 2   // a < b only, row a from ANGLE_MATRIX_ROW(a)
+#define ANGLE_MATRIX_LAYOUT ANGLE_MATRIX_FULL
+
+extern const uint16_t catalog_angle_matrix[CATALOG_SIZE][CATALOG_SIZE];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CATALOG_ANGLE_MATRIX_H
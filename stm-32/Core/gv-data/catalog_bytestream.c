@@ -1,4 +1,5 @@
 // AUTO-GENERATED BINARY CATALOG
+#include <stddef.h>
 #include <stdint.h>
 
 const uint8_t catalog_bytestream[] = {
@@ -7,839 +8,1681 @@ const uint8_t catalog_bytestream[] = {
   0x00, // BIN 2: 0 pairs
   0x00, // BIN 3: 0 pairs
   0x00, // BIN 4: 0 pairs
-  0x01, 0xC8, 0xCA, // BIN 5: 1 pair
+  0x00, // BIN 5: 0 pairs
   0x00, // BIN 6: 0 pairs
   0x00, // BIN 7: 0 pairs
-  0x01, 0xC5, 0xC6, // BIN 8: 1 pair
+  0x00, // BIN 8: 0 pairs
   0x00, // BIN 9: 0 pairs
-  0x01, 0xA0, 0xA1, // BIN 10: 1 pair
-  0x00, // BIN 11: 0 pairs
+  0x00, // BIN 10: 0 pairs
+  0x01, 0xC8, 0xCA, // BIN 11: 1 pair
   0x00, // BIN 12: 0 pairs
-  0x03, 0x30, 0x34, 0x34, 0x37, 0x81, 0x84, // BIN 13: 3 pairs
-  0x02, 0xB0, 0xB1, 0xCD, 0xCF, // BIN 14: 2 pairs
+  0x00, // BIN 13: 0 pairs
+  0x00, // BIN 14: 0 pairs
   0x00, // BIN 15: 0 pairs
-  0x00, // BIN 16: 0 pairs
+  0x01, 0xC5, 0xC6, // BIN 16: 1 pair
   0x00, // BIN 17: 0 pairs
-  0x02, 0x3D, 0x40, 0x69, 0x6C, // BIN 18: 2 pairs
+  0x00, // BIN 18: 0 pairs
   0x00, // BIN 19: 0 pairs
-  0x02, 0xB2, 0xB4, 0xE5, 0xE6, // BIN 20: 2 pairs
-  0x02, 0x17, 0x18, 0x5A, 0x5B, // BIN 21: 2 pairs
-  0x02, 0xB4, 0xB6, 0xDA, 0xDB, // BIN 22: 2 pairs
-  0x01, 0x61, 0x63, // BIN 23: 1 pair
-  0x02, 0xCD, 0xD0, 0xDD, 0xDF, // BIN 24: 2 pairs
+  0x01, 0xA0, 0xA1, // BIN 20: 1 pair
+  0x00, // BIN 21: 0 pairs
+  0x00, // BIN 22: 0 pairs
+  0x00, // BIN 23: 0 pairs
+  0x00, // BIN 24: 0 pairs
   0x00, // BIN 25: 0 pairs
-  0x03, 0x7A, 0x7F, 0xA6, 0xAA, 0xCA, 0xCD, // BIN 26: 3 pairs
-  0x03, 0x25, 0x27, 0x30, 0x37, 0xD4, 0xD7, // BIN 27: 3 pairs
-  0x04, 0x2C, 0x30, 0x36, 0x39, 0x4A, 0x4B, 0xC8, 0xCD, // BIN 28: 4 pairs
-  0x03, 0x5F, 0x63, 0x6C, 0x6D, 0xDB, 0xDF, // BIN 29: 3 pairs
-  0x01, 0xAE, 0xAF, // BIN 30: 1 pair
-  0x04, 0x2C, 0x34, 0x2F, 0x31, 0x9E, 0xA5, 0xCF, 0xD0, // BIN 31: 4 pairs
-  0x01, 0xCA, 0xD0, // BIN 32: 1 pair
-  0x04, 0x25, 0x2B, 0x49, 0x4B, 0x7F, 0x85, 0xD3, 0xD5, // BIN 33: 4 pairs
-  0x01, 0xCC, 0xCF, // BIN 34: 1 pair
-  0x03, 0x28, 0x2A, 0x7C, 0x7E, 0xAD, 0xAE, // BIN 35: 3 pairs
-  0x02, 0x08, 0x0B, 0x19, 0x1A, // BIN 36: 2 pairs
-  0x03, 0xBA, 0xBB, 0xBD, 0xC5, 0xBD, 0xC6, // BIN 37: 3 pairs
-  0x01, 0xC8, 0xD0, // BIN 38: 1 pair
-  0x03, 0x0E, 0x11, 0x42, 0x46, 0xDB, 0xDD, // BIN 39: 3 pairs
-  0x04, 0x2C, 0x37, 0xA6, 0xA7, 0xCA, 0xCF, 0xCC, 0xCD, // BIN 40: 4 pairs
-  0x07, 0x33, 0x37, 0x53, 0x55, 0x99, 0x9C, 0x9A, 0x9C, 0xA7, 0xAA, 0xB2, 0xB6, 0xC7, 0xD1, // BIN 41: 7 pairs
-  0x05, 0x4E, 0x51, 0x69, 0x6D, 0x7A, 0x85, 0x7D, 0x85, 0xD8, 0xDA, // BIN 42: 5 pairs
-  0x06, 0x2D, 0x32, 0x5F, 0x61, 0x86, 0x8C, 0x98, 0xA0, 0x98, 0xA1, 0xC8, 0xCF, // BIN 43: 6 pairs
-  0x04, 0x2C, 0x33, 0x93, 0x99, 0x93, 0x9A, 0xA1, 0xA6, // BIN 44: 4 pairs
-  0x06, 0x41, 0x48, 0x4B, 0x4D, 0x50, 0x52, 0x77, 0x7B, 0x7A, 0x7D, 0xC0, 0xCC, // BIN 45: 6 pairs
-  0x04, 0x06, 0x08, 0xA0, 0xA7, 0xD5, 0xD7, 0xD5, 0xD8, // BIN 46: 4 pairs
-  0x05, 0x0B, 0x0D, 0x16, 0x19, 0x33, 0x34, 0xDA, 0xDD, 0xDA, 0xDF, // BIN 47: 5 pairs
-  0x01, 0x33, 0x38, // BIN 48: 1 pair
-  0x04, 0x01, 0x06, 0x28, 0x2C, 0xA0, 0xA6, 0xA1, 0xA7, // BIN 49: 4 pairs
-  0x07, 0x0C, 0x0F, 0x29, 0x31, 0x66, 0x69, 0x73, 0x74, 0x91, 0x96, 0xAD, 0xB2, 0xFA, 0xFD, // BIN 50: 7 pairs
-  0x03, 0x27, 0x2B, 0x9B, 0xA0, 0x9C, 0xA4, // BIN 51: 3 pairs
-  0x04, 0x49, 0x4A, 0x5E, 0x68, 0x79, 0x7C, 0xC1, 0xCB, // BIN 52: 4 pairs
-  0x03, 0x59, 0x61, 0x70, 0x71, 0x98, 0x9B, // BIN 53: 3 pairs
-  0x03, 0x40, 0x44, 0x7B, 0x86, 0x7D, 0x84, // BIN 54: 3 pairs
-  0x07, 0x26, 0x2F, 0x32, 0x3A, 0x3F, 0x45, 0x49, 0x4D, 0x66, 0x68, 0xD0, 0xD4, 0xD3, 0xD7, // BIN 55: 7 pairs
-  0x07, 0x2A, 0x33, 0x30, 0x33, 0x57, 0x59, 0x5E, 0x66, 0x78, 0x82, 0x79, 0x80, 0xAE, 0xB2, // BIN 56: 7 pairs
-  0x02, 0x75, 0x7D, 0xC5, 0xC9, // BIN 57: 2 pairs
-  0x03, 0x29, 0x2F, 0xC8, 0xCC, 0xF6, 0xF9, // BIN 58: 3 pairs
-  0x04, 0x66, 0x6D, 0x6D, 0x75, 0x83, 0x87, 0xCA, 0xCC, // BIN 59: 4 pairs
-  0x02, 0x66, 0x6C, 0x7D, 0x7F, // BIN 60: 2 pairs
-  0x05, 0x01, 0x08, 0x7D, 0x81, 0x9B, 0xA1, 0xD5, 0xDA, 0xE9, 0xEC, // BIN 61: 5 pairs
-  0x02, 0xD8, 0xDB, 0xDB, 0xE0, // BIN 62: 2 pairs
-  0x05, 0x2A, 0x2C, 0x59, 0x5F, 0x68, 0x6D, 0x93, 0x9C, 0xA4, 0xAC, // BIN 63: 5 pairs
-  0x06, 0x26, 0x29, 0x75, 0x7A, 0xAD, 0xAF, 0xB3, 0xBE, 0xBB, 0xC0, 0xCC, 0xD0, // BIN 64: 6 pairs
-  0x03, 0x5C, 0x64, 0xBC, 0xC1, 0xC6, 0xC9, // BIN 65: 3 pairs
-  0x04, 0x4C, 0x4F, 0x8C, 0x90, 0x8F, 0x92, 0xDF, 0xE0, // BIN 66: 4 pairs
-  0x06, 0x5F, 0x66, 0xA1, 0xAA, 0xB6, 0xBA, 0xCF, 0xD4, 0xD3, 0xD4, 0xED, 0xEE, // BIN 67: 6 pairs
-  0x03, 0x2D, 0x30, 0xAD, 0xB4, 0xAF, 0xB2, // BIN 68: 3 pairs
-  0x0A, 0x00, 0x05, 0x06, 0x0B, 0x28, 0x33, 0x57, 0x5F, 0x59, 0x63, 0x7E, 0x80, 0xC0, 0xC8, 0xC9, 0xCC, 0xD3, 0xD8, 0xD4, 0xD5, // BIN 69: 10 pairs
-  0x03, 0x40, 0x42, 0xA0, 0xAA, 0xC0, 0xCD, // BIN 70: 3 pairs
-  0x02, 0x3D, 0x44, 0x4D, 0x53, // BIN 71: 2 pairs
-  0x06, 0x4A, 0x4D, 0x4F, 0x54, 0x63, 0x69, 0x78, 0x7F, 0x7C, 0x80, 0xCD, 0xD4, // BIN 72: 6 pairs
-  0x03, 0x08, 0x0D, 0xC0, 0xCA, 0xC0, 0xCF, // BIN 73: 3 pairs
-  0x06, 0x10, 0x12, 0x54, 0x56, 0x6C, 0x75, 0xC0, 0xC9, 0xD0, 0xD3, 0xD0, 0xD7, // BIN 74: 6 pairs
-  0x05, 0x2B, 0x3B, 0x2D, 0x3A, 0x9B, 0xA7, 0xB1, 0xB7, 0xD9, 0xDC, // BIN 75: 5 pairs
-  0x05, 0x28, 0x30, 0x5F, 0x69, 0x79, 0x7E, 0x8F, 0x93, 0xAE, 0xB4, // BIN 76: 5 pairs
-  0x08, 0x24, 0x2E, 0x3B, 0x3C, 0x43, 0x48, 0x87, 0x89, 0xA8, 0xB3, 0xAC, 0xB9, 0xBB, 0xC8, 0xEF, 0xF7, // BIN 77: 8 pairs
-  0x06, 0x20, 0x21, 0x26, 0x31, 0x2E, 0x35, 0x92, 0x9B, 0xBD, 0xC9, 0xE9, 0xED, // BIN 78: 6 pairs
-  0x05, 0x05, 0x0A, 0x1C, 0x1D, 0x37, 0x38, 0x4C, 0x4D, 0x70, 0x77, // BIN 79: 5 pairs
-  0x08, 0x28, 0x34, 0x29, 0x2A, 0x2D, 0x34, 0x78, 0x7A, 0x95, 0x98, 0x9C, 0xAC, 0xA4, 0xB9, 0xEF, 0xF0, // BIN 80: 8 pairs
-  0x04, 0x1D, 0x1E, 0x3D, 0x42, 0x4F, 0x56, 0xDA, 0xE0, // BIN 81: 4 pairs
-  0x06, 0x1A, 0x1E, 0x24, 0x27, 0x45, 0x4A, 0x63, 0x66, 0x7F, 0x82, 0xCB, 0xCE, // BIN 82: 6 pairs
-  0x09, 0x04, 0x09, 0x16, 0x1A, 0x2A, 0x38, 0x39, 0x3E, 0x67, 0x6A, 0xBB, 0xCA, 0xD5, 0xDB, 0xDC, 0xE3, 0xE4, 0xE9, // BIN 83: 9 pairs
-  0x04, 0x3E, 0x49, 0x74, 0x76, 0x84, 0x85, 0xAD, 0xB6, // BIN 84: 4 pairs
-  0x02, 0x68, 0x6C, 0xE2, 0xE6, // BIN 85: 2 pairs
-  0x02, 0x75, 0x81, 0xAF, 0xB4, // BIN 86: 2 pairs
-  0x0B, 0x23, 0x2D, 0x28, 0x37, 0x2C, 0x2D, 0x35, 0x3D, 0x68, 0x69, 0x92, 0x98, 0x98, 0xA6, 0xB8, 0xC3, 0xBA, 0xC8, 0xCA, 0xD4, 0xD7, 0xDA, // BIN 87: 11 pairs
-  0x08, 0x2A, 0x34, 0x42, 0x44, 0x65, 0x6A, 0x75, 0x84, 0x99, 0xA4, 0x9A, 0xA4, 0xD2, 0xD6, 0xD8, 0xDD, // BIN 88: 8 pairs
-  0x06, 0x31, 0x38, 0x34, 0x38, 0x77, 0x86, 0x98, 0xA7, 0xB0, 0xB7, 0xD8, 0xDF, // BIN 89: 6 pairs
-  0x0A, 0x2A, 0x30, 0x2A, 0x37, 0x49, 0x4C, 0x63, 0x6C, 0x75, 0x7F, 0xB4, 0xBA, 0xD5, 0xDD, 0xD7, 0xD8, 0xDD, 0xE0, 0xE2, 0xE5, // BIN 90: 10 pairs
-  0x04, 0x2D, 0x37, 0x6B, 0x72, 0x99, 0xAC, 0x9A, 0xAC, // BIN 91: 4 pairs
-  0x0B, 0x18, 0x1A, 0x2C, 0x38, 0x56, 0x59, 0x57, 0x61, 0x69, 0x75, 0x75, 0x85, 0x8B, 0x95, 0x9F, 0xA3, 0xBA, 0xCA, 0xCF, 0xD7, 0xD7, 0xDD, // BIN 92: 11 pairs
-  0x06, 0x18, 0x19, 0x43, 0x4F, 0x4B, 0x53, 0x57, 0x63, 0xC8, 0xD4, 0xD3, 0xDA, // BIN 93: 6 pairs
-  0x06, 0x18, 0x1E, 0x36, 0x3E, 0x85, 0x8F, 0x85, 0x93, 0xC0, 0xD0, 0xCA, 0xD3, // BIN 94: 6 pairs
-  0x06, 0x4C, 0x54, 0x5F, 0x6C, 0x61, 0x69, 0x81, 0x85, 0xB7, 0xBF, 0xCD, 0xD7, // BIN 95: 6 pairs
-  0x07, 0x01, 0x0B, 0x30, 0x3A, 0x43, 0x4C, 0x94, 0x95, 0xBC, 0xCB, 0xBF, 0xC4, 0xEA, 0xEB, // BIN 96: 7 pairs
-  0x07, 0x41, 0x43, 0x41, 0x47, 0x7B, 0x8C, 0x9B, 0xA6, 0x9F, 0xA2, 0xAE, 0xB6, 0xD0, 0xD5, // BIN 97: 7 pairs
-  0x02, 0x34, 0x3A, 0xCD, 0xD3, // BIN 98: 2 pairs
-  0x09, 0x48, 0x4F, 0x7A, 0x84, 0xBA, 0xC0, 0xBB, 0xCC, 0xBB, 0xCD, 0xC8, 0xD3, 0xCC, 0xD4, 0xE4, 0xEC, 0xF4, 0xF6, // BIN 99: 9 pairs
-  0x04, 0x37, 0x3A, 0x70, 0x7B, 0xB8, 0xC2, 0xF1, 0xF5, // BIN 100: 4 pairs
-  0x05, 0x22, 0x23, 0x30, 0x38, 0x5E, 0x6D, 0x82, 0x8F, 0xC9, 0xCF, // BIN 101: 5 pairs
-  0x06, 0x17, 0x1E, 0x30, 0x32, 0x71, 0x7B, 0x73, 0x76, 0x80, 0x8A, 0xD5, 0xDF, // BIN 102: 6 pairs
-  0x05, 0x25, 0x3B, 0x27, 0x3B, 0x96, 0x9D, 0xB6, 0xBB, 0xCF, 0xD3, // BIN 103: 5 pairs
-  0x08, 0x5E, 0x5F, 0x71, 0x77, 0x7F, 0x8F, 0x86, 0x90, 0xB5, 0xB8, 0xC1, 0xC2, 0xD7, 0xDB, 0xDE, 0xE5, // BIN 104: 8 pairs
-  0x07, 0x2A, 0x31, 0x4A, 0x53, 0x61, 0x66, 0x78, 0x85, 0x7A, 0x82, 0x87, 0x8E, 0xD8, 0xE0, // BIN 105: 7 pairs
-  0x05, 0x35, 0x40, 0x5E, 0x69, 0x68, 0x75, 0x7A, 0x81, 0xCA, 0xD7, // BIN 106: 5 pairs
-  0x05, 0x24, 0x25, 0x29, 0x38, 0x82, 0x85, 0xB2, 0xBA, 0xB6, 0xC4, // BIN 107: 5 pairs
-  0x04, 0x4B, 0x4C, 0x8D, 0x8E, 0xAC, 0xBD, 0xB5, 0xC2, // BIN 108: 4 pairs
-  0x09, 0x28, 0x38, 0x40, 0x46, 0x4D, 0x55, 0x56, 0x5D, 0x8F, 0x99, 0x8F, 0x9A, 0xAF, 0xB6, 0xBB, 0xCF, 0xE6, 0xE7, // BIN 109: 9 pairs
-  0x07, 0x27, 0x3C, 0x2E, 0x3C, 0x3F, 0x4A, 0x45, 0x4B, 0x9D, 0xA9, 0xC4, 0xD3, 0xC9, 0xCD, // BIN 110: 7 pairs
-  0x07, 0x28, 0x29, 0x32, 0x34, 0x7F, 0x84, 0x92, 0x95, 0x98, 0xAA, 0xC8, 0xD7, 0xF0, 0xFF, // BIN 111: 7 pairs
-  0x08, 0x17, 0x1A, 0x32, 0x35, 0x3E, 0x4B, 0x46, 0x4E, 0x57, 0x66, 0x5F, 0x6D, 0x61, 0x6C, 0xF1, 0xF3, // BIN 112: 8 pairs
-  0x0A, 0x3E, 0x4A, 0x47, 0x48, 0x5E, 0x6C, 0x63, 0x6D, 0x84, 0x93, 0x8A, 0x94, 0x9B, 0xAA, 0xA5, 0xBE, 0xD7, 0xDF, 0xEC, 0xED, // BIN 113: 10 pairs
-  0x05, 0x19, 0x1E, 0x6D, 0x7D, 0x93, 0xA4, 0xBA, 0xCD, 0xD4, 0xDA, // BIN 114: 5 pairs
-  0x0C, 0x06, 0x0D, 0x09, 0x0C, 0x11, 0x12, 0x17, 0x19, 0x23, 0x32, 0x57, 0x5E, 0x8F, 0x9B, 0x97, 0x9D, 0xBA, 0xC4, 0xBB, 0xD0, 0xD4, 0xD8, 0xF2, 0xF5, // BIN 115: 12 pairs
-  0x06, 0x29, 0x33, 0x39, 0x43, 0x72, 0x77, 0x95, 0xA1, 0xD3, 0xDB, 0xD4, 0xDD, // BIN 116: 6 pairs
-  0x03, 0x12, 0x17, 0x47, 0x57, 0x7D, 0x93, // BIN 117: 3 pairs
-  0x09, 0x13, 0xFF, 0x2B, 0x3C, 0x31, 0x3F, 0x38, 0x3F, 0x59, 0x5D, 0x5D, 0x61, 0x84, 0x9C, 0x92, 0xA0, 0xDE, 0xE2, // BIN 118: 9 pairs
-  0x09, 0x31, 0x33, 0x32, 0x37, 0x60, 0x65, 0x66, 0x75, 0x70, 0x72, 0xA5, 0xB3, 0xAF, 0xB7, 0xB4, 0xC4, 0xC2, 0xC3, // BIN 119: 9 pairs
-  0x09, 0x10, 0x18, 0x1B, 0x20, 0x2F, 0x38, 0x3D, 0x46, 0x49, 0x53, 0x6D, 0x81, 0x7F, 0x81, 0x95, 0xA0, 0xCE, 0xD6, // BIN 120: 9 pairs
-  0x08, 0x10, 0x17, 0x17, 0x1D, 0x3E, 0x3F, 0x8A, 0x8D, 0xC1, 0xCE, 0xCD, 0xD5, 0xDE, 0xE6, 0xE2, 0xE7, // BIN 121: 8 pairs
-  0x09, 0x0A, 0x12, 0x28, 0x2D, 0x44, 0x46, 0x5F, 0x68, 0x6D, 0x7A, 0xBE, 0xE1, 0xCA, 0xD5, 0xD3, 0xDD, 0xE1, 0xF0, // BIN 122: 9 pairs
-  0x09, 0x03, 0x1B, 0x56, 0x57, 0x68, 0x81, 0x7F, 0x93, 0x8B, 0x92, 0xA2, 0xAD, 0xBC, 0xCE, 0xC4, 0xCA, 0xCF, 0xD5, // BIN 123: 9 pairs
-  0x0B, 0x0A, 0x10, 0x1E, 0x25, 0x2C, 0x3A, 0x54, 0x5D, 0x58, 0x64, 0x6C, 0x6E, 0x82, 0x92, 0x92, 0xA1, 0xBA, 0xD0, 0xC0, 0xC5, 0xC4, 0xC8, // BIN 124: 11 pairs
-  0x06, 0x16, 0x18, 0x2D, 0x33, 0x2E, 0x3D, 0xB4, 0xBB, 0xC8, 0xC9, 0xCC, 0xD7, // BIN 125: 6 pairs
-  0x08, 0x2C, 0x32, 0x45, 0x49, 0x69, 0x6E, 0x78, 0x7D, 0x81, 0x93, 0xAB, 0xB0, 0xBA, 0xCC, 0xC5, 0xCC, // BIN 126: 8 pairs
-  0x07, 0x23, 0x2C, 0x23, 0x30, 0x25, 0x3C, 0x6A, 0x73, 0x81, 0x9C, 0xB5, 0xC1, 0xC9, 0xCA, // BIN 127: 7 pairs
-  0x0B, 0x23, 0x28, 0x5E, 0x63, 0x6D, 0x84, 0x7A, 0x8F, 0x95, 0x9B, 0x9C, 0xB9, 0xA5, 0xA8, 0xB3, 0xC7, 0xBA, 0xCF, 0xC8, 0xD5, 0xFD, 0xFE, // BIN 128: 11 pairs
-  0x06, 0x12, 0x18, 0x18, 0x1D, 0x2A, 0x2F, 0x59, 0x66, 0x65, 0x67, 0xBD, 0xC0, // BIN 129: 6 pairs
-  0x08, 0x1E, 0x27, 0x44, 0x50, 0x6C, 0x7A, 0x75, 0x78, 0x94, 0xA2, 0xB9, 0xBD, 0xE5, 0xE7, 0xF4, 0xF9, // BIN 130: 8 pairs
-  0x08, 0x2F, 0x3F, 0x6E, 0x78, 0x77, 0x8C, 0x92, 0x93, 0xA2, 0xAE, 0xC2, 0xCB, 0xD4, 0xDB, 0xF0, 0xF7, // BIN 131: 8 pairs
-  0x0A, 0x01, 0x0D, 0x1D, 0x24, 0x27, 0x2E, 0x64, 0x6B, 0x6C, 0x7D, 0x83, 0x8E, 0xAC, 0xC6, 0xB9, 0xC6, 0xBF, 0xD2, 0xC9, 0xD0, // BIN 132: 10 pairs
-  0x06, 0x24, 0x2B, 0x58, 0x5C, 0x7E, 0x8A, 0x93, 0xAC, 0xC0, 0xC6, 0xF6, 0xF8, // BIN 133: 6 pairs
-  0x08, 0x24, 0x3C, 0x3A, 0x46, 0x48, 0x56, 0x4D, 0x54, 0x83, 0x89, 0x99, 0x9B, 0x9A, 0x9B, 0xC4, 0xD0, // BIN 134: 8 pairs
-  0x0A, 0x2F, 0x36, 0x3E, 0x43, 0x3F, 0x4B, 0x4B, 0x55, 0x63, 0x6E, 0x68, 0x84, 0x7D, 0x8F, 0x8A, 0x8B, 0x90, 0x97, 0xC6, 0xCC, // BIN 135: 10 pairs
-  0x0A, 0x0D, 0x16, 0x1C, 0x22, 0x1E, 0x24, 0x4A, 0x4C, 0x56, 0x61, 0x6A, 0x74, 0xA8, 0xBE, 0xA9, 0xB5, 0xBE, 0xC7, 0xD3, 0xDF, // BIN 136: 10 pairs
-  0x0B, 0x3A, 0x42, 0x3E, 0x4C, 0x3F, 0x49, 0x61, 0x6D, 0x63, 0x68, 0x7A, 0x93, 0xAC, 0xC5, 0xAD, 0xBA, 0xB2, 0xC4, 0xB5, 0xBC, 0xCC, 0xD3, // BIN 137: 11 pairs
-  0x0A, 0x3E, 0x4D, 0x59, 0x69, 0x64, 0x70, 0x84, 0xA4, 0x85, 0x99, 0x85, 0x9A, 0xBB, 0xC9, 0xD4, 0xDF, 0xF8, 0xF9, 0xFB, 0xFC, // BIN 138: 10 pairs
-  0x07, 0x00, 0x02, 0x26, 0x36, 0x60, 0x6B, 0x8B, 0x94, 0x8F, 0x9C, 0xAB, 0xB1, 0xC4, 0xD5, // BIN 139: 7 pairs
-  0x0D, 0x29, 0x2C, 0x44, 0x52, 0x4C, 0x53, 0x4C, 0x56, 0x4D, 0x4F, 0x5D, 0x63, 0x61, 0x6E, 0x84, 0x99, 0x84, 0x9A, 0xB2, 0xBB, 0xC0, 0xD4, 0xD5, 0xE0, 0xE1, 0xEF, // BIN 140: 13 pairs
-  0x0D, 0x23, 0x34, 0x28, 0x31, 0x2E, 0x40, 0x33, 0x3A, 0x57, 0x69, 0x82, 0x8B, 0x85, 0x9C, 0x89, 0x8E, 0x93, 0x9B, 0xB9, 0xC5, 0xD0, 0xD8, 0xD9, 0xE4, 0xE7, 0xE8, // BIN 141: 13 pairs
-  0x07, 0x00, 0xFD, 0x1A, 0x25, 0x5C, 0x60, 0x78, 0x8F, 0x7D, 0x82, 0x81, 0xA4, 0x9E, 0xBE, // BIN 142: 7 pairs
-  0x07, 0x26, 0x2A, 0x35, 0x3A, 0x41, 0x4F, 0x48, 0x4C, 0x88, 0x90, 0xB4, 0xBF, 0xE9, 0xEE, // BIN 143: 7 pairs
-  0x04, 0x00, 0x0A, 0x7E, 0x8D, 0x91, 0x9D, 0xBD, 0xCC, // BIN 144: 4 pairs
-  0x07, 0x0E, 0x12, 0x36, 0x43, 0x3E, 0x45, 0x42, 0x4E, 0x83, 0x8D, 0xBB, 0xC4, 0xD1, 0xD9, // BIN 145: 7 pairs
-  0x05, 0x16, 0x17, 0x68, 0x7D, 0x8F, 0x98, 0xB6, 0xC8, 0xC4, 0xCD, // BIN 146: 5 pairs
-  0x05, 0x2A, 0x2D, 0x4A, 0x55, 0x5E, 0x61, 0x6C, 0x81, 0x89, 0x91, // BIN 147: 5 pairs
-  0x06, 0x43, 0x49, 0x69, 0x7A, 0x7D, 0x9C, 0x94, 0x9F, 0xB6, 0xBF, 0xCE, 0xD2, // BIN 148: 6 pairs
-  0x0A, 0x0B, 0x16, 0x2F, 0x33, 0x2F, 0x3E, 0x35, 0x42, 0x6D, 0x6E, 0x6D, 0x7F, 0x92, 0x99, 0x92, 0x9A, 0xAE, 0xB7, 0xC4, 0xD8, // BIN 149: 10 pairs
-  0x08, 0x10, 0x16, 0x24, 0x35, 0x2D, 0x35, 0x3C, 0x3D, 0x69, 0x7D, 0xAA, 0xBB, 0xB6, 0xCA, 0xEA, 0xF8, // BIN 150: 8 pairs
-  0x08, 0x6D, 0x85, 0x6E, 0x75, 0x81, 0x99, 0x81, 0x9A, 0x95, 0xA6, 0x9E, 0xB3, 0xA2, 0xAF, 0xB2, 0xBF, // BIN 151: 8 pairs
-  0x04, 0x01, 0xF7, 0x71, 0x86, 0xDC, 0xE4, 0xDE, 0xE3, // BIN 152: 4 pairs
-  0x0B, 0x22, 0x35, 0x3C, 0x44, 0x46, 0x51, 0x59, 0x5E, 0x6C, 0x84, 0x7E, 0x83, 0x92, 0xA7, 0xA3, 0xB0, 0xA9, 0xB8, 0xEB, 0xF6, 0xF4, 0xFC, // BIN 153: 11 pairs
-  0x09, 0x45, 0x4D, 0x53, 0x54, 0x5E, 0x75, 0x8B, 0x98, 0xAF, 0xB1, 0xB2, 0xB7, 0xBE, 0xD1, 0xC9, 0xD4, 0xD0, 0xDA, // BIN 154: 9 pairs
-  0x0A, 0x1E, 0x2B, 0x23, 0x37, 0x2C, 0x31, 0x3C, 0x40, 0x49, 0x4F, 0x56, 0x5F, 0x57, 0x68, 0x70, 0x86, 0x9E, 0xA8, 0xD9, 0xE3, // BIN 155: 10 pairs
-  0x08, 0x38, 0x45, 0x59, 0x6C, 0x6C, 0x7F, 0x7D, 0x99, 0x7D, 0x9A, 0x99, 0xB9, 0x9A, 0xB9, 0xA3, 0xAF, // BIN 156: 8 pairs
-  0x0C, 0x0F, 0x20, 0x10, 0x19, 0x22, 0x2D, 0x32, 0x3D, 0x35, 0x44, 0x39, 0x49, 0x54, 0x55, 0x56, 0x63, 0x7B, 0x90, 0xA2, 0xA6, 0xC3, 0xC7, 0xF1, 0xF2, // BIN 157: 12 pairs
-  0x10, 0x22, 0x32, 0x29, 0x37, 0x2F, 0x39, 0x32, 0x33, 0x3A, 0x3D, 0x48, 0x57, 0x57, 0x6C, 0x64, 0x71, 0x6E, 0x7A, 0x79, 0x8A, 0x7C, 0x8A, 0x85, 0x92, 0xAA, 0xAD, 0xC5, 0xCF, 0xCC, 0xD5, 0xFA, 0xFE, // BIN 158: 16 pairs
-  0x08, 0x0F, 0x1B, 0x25, 0x2E, 0x5D, 0x5F, 0x84, 0x8F, 0xA3, 0xB1, 0xAE, 0xBA, 0xAF, 0xBF, 0xB4, 0xB7, // BIN 159: 8 pairs
-  0x0B, 0x1A, 0x1D, 0x1A, 0x2B, 0x1C, 0x1E, 0x29, 0x34, 0x31, 0x37, 0x49, 0x55, 0x5C, 0x6B, 0x61, 0x68, 0xB3, 0xD1, 0xBC, 0xC2, 0xC4, 0xCF, // BIN 160: 11 pairs
-  0x05, 0x6B, 0x70, 0x72, 0x7B, 0x7F, 0x92, 0xA2, 0xA3, 0xE4, 0xED, // BIN 161: 5 pairs
-  0x0C, 0x16, 0x1E, 0x1A, 0x27, 0x21, 0x41, 0x23, 0x3A, 0x26, 0x38, 0x54, 0x59, 0x5F, 0x6E, 0xAF, 0xB0, 0xC3, 0xD9, 0xE3, 0xE9, 0xEC, 0xEE, 0xF3, 0xFB, // BIN 162: 12 pairs
-  0x0A, 0x23, 0x2A, 0x31, 0x36, 0x31, 0x3E, 0x43, 0x54, 0x67, 0x74, 0x69, 0x81, 0x82, 0x93, 0x87, 0x8D, 0xAA, 0xBA, 0xAD, 0xBB, // BIN 163: 10 pairs
-  0x0A, 0x28, 0x2F, 0x28, 0x32, 0x47, 0x5E, 0x63, 0x75, 0xA6, 0xAD, 0xBA, 0xD3, 0xC3, 0xD1, 0xC4, 0xD7, 0xCA, 0xD8, 0xF3, 0xF5, // BIN 164: 10 pairs
-  0x0A, 0x02, 0xFE, 0x13, 0x9E, 0x29, 0x30, 0x32, 0x42, 0x3A, 0x40, 0x6C, 0x85, 0x8F, 0xA0, 0x94, 0x98, 0x95, 0xA2, 0xC0, 0xD7, // BIN 165: 10 pairs
-  0x0E, 0x09, 0x0F, 0x26, 0x39, 0x31, 0x34, 0x33, 0x3F, 0x43, 0x56, 0x48, 0x54, 0x5B, 0x62, 0x66, 0x81, 0x75, 0x82, 0x80, 0x8B, 0x95, 0xA7, 0xC0, 0xD3, 0xC6, 0xCF, 0xCD, 0xD8, // BIN 166: 14 pairs
-  0x11, 0x02, 0x05, 0x22, 0x2E, 0x29, 0x3F, 0x35, 0x3C, 0x43, 0x4D, 0x47, 0x59, 0x4C, 0x55, 0x4F, 0x59, 0x7F, 0x99, 0x7F, 0x9A, 0x8A, 0x95, 0x92, 0xA6, 0xB6, 0xC0, 0xC4, 0xD4, 0xC5, 0xCD, 0xD0, 0xDD, 0xD7, 0xE0, // BIN 167: 17 pairs
-  0x06, 0x24, 0x3B, 0x51, 0x5A, 0x8C, 0xA8, 0xA1, 0xA2, 0xA3, 0xAE, 0xB1, 0xBF, // BIN 168: 6 pairs
-  0x0A, 0x2D, 0x38, 0x57, 0x6D, 0x5F, 0x75, 0x68, 0x7A, 0x69, 0x84, 0xA4, 0xBD, 0xB0, 0xBC, 0xB4, 0xC8, 0xC8, 0xD8, 0xCF, 0xD8, // BIN 169: 10 pairs
-  0x07, 0x32, 0x40, 0x45, 0x53, 0x8B, 0x8F, 0x90, 0xA8, 0xBB, 0xD3, 0xBB, 0xD4, 0xD2, 0xD8, // BIN 170: 7 pairs
-  0x09, 0x23, 0x33, 0x28, 0x3A, 0x38, 0x3A, 0x6C, 0x78, 0xA2, 0xAA, 0xB1, 0xBC, 0xD3, 0xE0, 0xD6, 0xE2, 0xEB, 0xF4, // BIN 171: 9 pairs
-  0x0D, 0x17, 0x1C, 0x1D, 0x27, 0x26, 0x28, 0x49, 0x54, 0x66, 0x7D, 0x6E, 0x7F, 0x71, 0x72, 0x80, 0x8D, 0x81, 0x8F, 0x88, 0x8C, 0xA3, 0xAB, 0xB4, 0xCA, 0xE3, 0xED, // BIN 172: 13 pairs
-  0x0B, 0x0A, 0x11, 0x0D, 0xFF, 0x22, 0x24, 0x31, 0x45, 0x39, 0x4C, 0x7C, 0x83, 0x8F, 0xA1, 0x99, 0xA7, 0x9A, 0xA7, 0xA2, 0xB2, 0xBA, 0xC9, // BIN 173: 11 pairs
-  0x0A, 0x03, 0x0F, 0x2B, 0x2E, 0x32, 0x46, 0x4B, 0x4F, 0x5E, 0x81, 0x60, 0x64, 0x69, 0x7F, 0x75, 0x93, 0x7F, 0x9C, 0xE3, 0xE4, // BIN 174: 10 pairs
-  0x0E, 0x30, 0x31, 0x36, 0x49, 0x57, 0x5D, 0x59, 0x6D, 0x64, 0x72, 0x66, 0x6E, 0x97, 0xA9, 0x9B, 0x9C, 0xAF, 0xBA, 0xB6, 0xCD, 0xC4, 0xD2, 0xC6, 0xCD, 0xD0, 0xDB, 0xF9, 0xFC, // BIN 175: 14 pairs
-  0x0C, 0x19, 0x25, 0x20, 0x47, 0x2E, 0x3B, 0x2E, 0x44, 0x41, 0x56, 0x41, 0x57, 0x66, 0x84, 0x6D, 0x78, 0x86, 0x88, 0x9F, 0xAE, 0xA6, 0xBB, 0xB6, 0xB7, // BIN 176: 12 pairs
-  0x07, 0x0A, 0x0E, 0x1C, 0x24, 0x48, 0x59, 0x8F, 0x95, 0xBD, 0xCF, 0xC7, 0xD9, 0xE3, 0xE5, // BIN 177: 7 pairs
-  0x0B, 0x1D, 0x25, 0x4B, 0x54, 0x4F, 0x5D, 0x78, 0x92, 0x95, 0xAA, 0x98, 0xA2, 0xA0, 0xA2, 0xB5, 0xCB, 0xB6, 0xD0, 0xCD, 0xDA, 0xCF, 0xDA, // BIN 178: 11 pairs
-  0x10, 0x26, 0x33, 0x39, 0x41, 0x43, 0x4B, 0x5D, 0x6E, 0x67, 0x73, 0x78, 0x84, 0x7C, 0x8D, 0x99, 0xA0, 0x9A, 0xA0, 0xA7, 0xBB, 0xAA, 0xB6, 0xAD, 0xB7, 0xAE, 0xBF, 0xB7, 0xC4, 0xBA, 0xD4, 0xBB, 0xBD, // BIN 179: 16 pairs
-  0x09, 0x08, 0xFF, 0x1D, 0x22, 0x3F, 0x4D, 0x77, 0x90, 0x7A, 0x99, 0x7A, 0x9A, 0x7D, 0xA4, 0xAA, 0xC0, 0xE0, 0xE8, // BIN 180: 9 pairs
-  0x09, 0x35, 0x46, 0x41, 0x4C, 0x4F, 0x57, 0x5A, 0x62, 0x76, 0x89, 0x7A, 0x9C, 0x9F, 0xAF, 0xB5, 0xC3, 0xEC, 0xEF, // BIN 181: 9 pairs
-  0x0E, 0x10, 0x1A, 0x1F, 0x29, 0x23, 0x35, 0x39, 0x48, 0x47, 0x5F, 0x58, 0x71, 0x59, 0x68, 0x66, 0x7A, 0xAA, 0xB2, 0xB0, 0xBF, 0xC4, 0xCC, 0xC5, 0xC8, 0xC9, 0xD7, 0xCA, 0xDA, // BIN 182: 14 pairs
-  0x0A, 0x0D, 0x19, 0x1F, 0x26, 0x2C, 0x2F, 0x31, 0x39, 0x69, 0x85, 0x85, 0xA4, 0x8D, 0x94, 0xBB, 0xC5, 0xC0, 0xC4, 0xDC, 0xE9, // BIN 183: 10 pairs
-  0x0A, 0x26, 0x3E, 0x40, 0x50, 0x8B, 0x9B, 0xAB, 0xBC, 0xAE, 0xB1, 0xAF, 0xC4, 0xBD, 0xCD, 0xC5, 0xCA, 0xCF, 0xDD, 0xEA, 0xF6, // BIN 184: 10 pairs
-  0x08, 0x00, 0xFA, 0x08, 0x16, 0x21, 0x47, 0x47, 0x56, 0x69, 0x78, 0x99, 0xBD, 0x9A, 0xBD, 0xAA, 0xB4, // BIN 185: 8 pairs
-  0x0F, 0x01, 0xFF, 0x26, 0x3F, 0x2A, 0x3A, 0x2F, 0x45, 0x5E, 0x84, 0x61, 0x75, 0x6E, 0x82, 0x75, 0x8F, 0x98, 0x99, 0x98, 0x9A, 0x9C, 0xBD, 0xA6, 0xBA, 0xB3, 0xE1, 0xD1, 0xE1, 0xEF, 0xFF, // BIN 186: 15 pairs
-  0x14, 0x04, 0x0C, 0x18, 0x1C, 0x2E, 0x32, 0x36, 0x3F, 0x42, 0x51, 0x77, 0x88, 0x78, 0x81, 0x78, 0x93, 0x7A, 0x92, 0x88, 0x97, 0x92, 0x9C, 0x92, 0xAA, 0x9F, 0xAD, 0xA4, 0xC6, 0xA8, 0xC7, 0xAB, 0xB5, 0xAC, 0xC9, 0xAD, 0xC4, 0xD0, 0xDF, 0xEC, 0xF7, // BIN 187: 20 pairs
-  0x14, 0x0B, 0x10, 0x10, 0x11, 0x13, 0xA5, 0x19, 0x1D, 0x29, 0x36, 0x2A, 0x32, 0x43, 0x47, 0x4F, 0x53, 0x68, 0x85, 0x8F, 0xA7, 0x93, 0x98, 0x94, 0xA1, 0xA7, 0xBD, 0xAE, 0xC4, 0xB2, 0xC8, 0xB8, 0xC1, 0xC4, 0xDA, 0xC8, 0xDA, 0xCD, 0xDD, 0xDC, 0xDE, // BIN 188: 20 pairs
-  0x0D, 0x04, 0xF9, 0x39, 0x4B, 0x51, 0x5B, 0x5B, 0x67, 0x99, 0xA1, 0x9A, 0xA1, 0x9B, 0xAC, 0xAE, 0xBB, 0xB4, 0xC0, 0xB6, 0xCF, 0xBB, 0xD7, 0xC5, 0xD0, 0xD1, 0xE4, // BIN 189: 13 pairs
-  0x06, 0x19, 0x2B, 0x2F, 0x37, 0x37, 0x3F, 0x3E, 0x4F, 0x78, 0x8B, 0x8F, 0xA4, // BIN 190: 6 pairs
-  0x09, 0x1F, 0x28, 0x39, 0x3F, 0x82, 0x84, 0x93, 0xA0, 0x93, 0xB9, 0xBA, 0xBF, 0xBB, 0xC6, 0xC0, 0xD5, 0xC6, 0xC8, // BIN 191: 9 pairs
-  0x0A, 0x13, 0xF0, 0x2A, 0x3F, 0x65, 0x6B, 0x6E, 0x7D, 0xA2, 0xB4, 0xAA, 0xAE, 0xAE, 0xB0, 0xB2, 0xCA, 0xB6, 0xCC, 0xCB, 0xD6, // BIN 192: 10 pairs
-  0x09, 0x05, 0x12, 0x40, 0x52, 0x59, 0x6E, 0x71, 0x8C, 0xA4, 0xC5, 0xA7, 0xAC, 0xBA, 0xD7, 0xC6, 0xCA, 0xD4, 0xE0, // BIN 193: 9 pairs
-  0x09, 0x06, 0x10, 0x0B, 0xFF, 0x42, 0x52, 0x84, 0xAC, 0x96, 0x97, 0xA3, 0xAD, 0xBD, 0xC8, 0xBF, 0xD3, 0xEE, 0xFA, // BIN 194: 9 pairs
-  0x0A, 0x1F, 0x2A, 0x47, 0x4F, 0x60, 0x6A, 0x68, 0x7F, 0x6B, 0x77, 0x89, 0x96, 0x93, 0xA7, 0x94, 0xA0, 0xA6, 0xB2, 0xEB, 0xF8, // BIN 195: 10 pairs
-  0x10, 0x05, 0x0E, 0x0B, 0x19, 0x20, 0x41, 0x2F, 0x34, 0x39, 0x4A, 0x8E, 0x91, 0x96, 0xA9, 0xA5, 0xE1, 0xA6, 0xB6, 0xA7, 0xC0, 0xAD, 0xBF, 0xB6, 0xD3, 0xC7, 0xE1, 0xE3, 0xE6, 0xE8, 0xF1, 0xF5, 0xFB, // BIN 196: 16 pairs
-  0x0F, 0x11, 0x17, 0x19, 0x27, 0x1B, 0x21, 0x44, 0x4E, 0x47, 0x66, 0x54, 0x57, 0x8B, 0xA0, 0x8B, 0xA1, 0xA2, 0xA7, 0xA3, 0xB7, 0xA7, 0xBA, 0xBA, 0xD5, 0xBD, 0xCA, 0xC6, 0xD0, 0xCF, 0xDB, // BIN 197: 15 pairs
-  0x0D, 0x32, 0x38, 0x4E, 0x5A, 0x54, 0x61, 0x5E, 0x7D, 0x70, 0x8C, 0x76, 0x87, 0x7B, 0x88, 0xA6, 0xAE, 0xB4, 0xCD, 0xB9, 0xC9, 0xCA, 0xDD, 0xCD, 0xDB, 0xF6, 0xFC, // BIN 198: 13 pairs
-  0x08, 0x01, 0xF0, 0x03, 0xF8, 0x06, 0xF7, 0x36, 0x4C, 0x58, 0x70, 0x82, 0x95, 0x8F, 0xAC, 0xA7, 0xAD, // BIN 199: 8 pairs
-  0x0F, 0x0C, 0x20, 0x1B, 0x47, 0x3D, 0x50, 0x43, 0x4A, 0x4D, 0x56, 0x6E, 0x85, 0x6F, 0x79, 0x72, 0x86, 0x75, 0x9C, 0x7D, 0x92, 0x81, 0xAC, 0x82, 0x9B, 0xA6, 0xB4, 0xB4, 0xD0, 0xD6, 0xDE, // BIN 200: 15 pairs
-  0x0F, 0x12, 0x19, 0x1A, 0x24, 0x1D, 0x2E, 0x24, 0x3D, 0x2D, 0x3D, 0x33, 0x45, 0x3C, 0x50, 0x42, 0x50, 0x4E, 0x52, 0x81, 0x82, 0x93, 0xA1, 0xA1, 0xAD, 0xAA, 0xBD, 0xB7, 0xD2, 0xBB, 0xD5, // BIN 201: 15 pairs
-  0x08, 0x00, 0xFE, 0x34, 0x3F, 0x36, 0x41, 0x39, 0x4F, 0x4A, 0x4F, 0x86, 0xA8, 0x8C, 0x97, 0xD9, 0xE9, // BIN 202: 8 pairs
-  0x06, 0x05, 0x10, 0x3E, 0x53, 0x5C, 0x70, 0xCA, 0xDB, 0xD2, 0xE0, 0xF2, 0xFE, // BIN 203: 6 pairs
-  0x0B, 0x2D, 0x42, 0x2E, 0x42, 0x2F, 0x30, 0x82, 0x99, 0x82, 0x9A, 0xA9, 0xAB, 0xB2, 0xC0, 0xC8, 0xDD, 0xC9, 0xD3, 0xCC, 0xD8, 0xD2, 0xDA, // BIN 204: 11 pairs
-  0x08, 0x26, 0x2C, 0x36, 0x4B, 0x4A, 0x54, 0x4F, 0x55, 0xB7, 0xBC, 0xBF, 0xD8, 0xCF, 0xDF, 0xE7, 0xF1, // BIN 205: 8 pairs
-  0x0D, 0x01, 0xEF, 0x02, 0xFD, 0x06, 0x16, 0x39, 0x4D, 0x46, 0x52, 0x5D, 0x69, 0x65, 0x73, 0x6F, 0x7C, 0x76, 0x83, 0x85, 0x9B, 0xA2, 0xB6, 0xA6, 0xC0, 0xE1, 0xFF, // BIN 206: 13 pairs
-  0x0B, 0x21, 0x48, 0x29, 0x3E, 0x41, 0x59, 0x45, 0x55, 0x72, 0x88, 0x79, 0x8B, 0x92, 0x94, 0xC5, 0xD4, 0xD2, 0xD3, 0xD2, 0xD5, 0xE8, 0xF3, // BIN 207: 11 pairs
-  0x0C, 0x05, 0x11, 0x08, 0xF7, 0x2D, 0x46, 0x36, 0x4A, 0x47, 0x63, 0x5A, 0x67, 0x87, 0x91, 0x94, 0xA6, 0xAF, 0xBB, 0xBD, 0xD0, 0xCD, 0xDF, 0xF7, 0xFF, // BIN 208: 12 pairs
-  0x0E, 0x03, 0x0C, 0x05, 0xFD, 0x12, 0x16, 0x36, 0x48, 0x40, 0x4E, 0x47, 0x61, 0x66, 0x7F, 0x68, 0x6E, 0x7E, 0x87, 0x82, 0x98, 0x8C, 0xA5, 0xA0, 0xAD, 0xB1, 0xB2, 0xC8, 0xDB, // BIN 209: 14 pairs
-  0x08, 0x08, 0x10, 0x0C, 0x1B, 0x0F, 0x21, 0x80, 0x94, 0x8C, 0x9E, 0x9C, 0xA7, 0xC4, 0xDB, 0xF3, 0xFC, // BIN 210: 8 pairs
-  0x0D, 0x09, 0x14, 0x18, 0x25, 0x27, 0x35, 0x2C, 0x3F, 0x3D, 0x52, 0x41, 0x54, 0x66, 0x85, 0x6B, 0x71, 0x99, 0xA6, 0x9A, 0xA6, 0x9E, 0xE1, 0xCC, 0xDA, 0xEB, 0xF9, // BIN 211: 13 pairs
-  0x0E, 0x1D, 0x2B, 0x3A, 0x44, 0x3E, 0x48, 0x3F, 0x53, 0x64, 0x77, 0x75, 0x99, 0x75, 0x9A, 0x79, 0x8D, 0x84, 0xB9, 0x9C, 0xC6, 0xB4, 0xCF, 0xD2, 0xDB, 0xF3, 0xF4, 0xF5, 0xFE, // BIN 212: 14 pairs
-  0x0A, 0x0C, 0x14, 0x0D, 0x10, 0x22, 0x3A, 0x29, 0x39, 0x2D, 0x40, 0x52, 0x60, 0x62, 0x6F, 0x8D, 0x9F, 0x8F, 0xA6, 0xC2, 0xCE, // BIN 213: 10 pairs
-  0x0E, 0x06, 0x0A, 0x10, 0x1E, 0x16, 0x25, 0x1E, 0x2E, 0x30, 0x35, 0x81, 0xB9, 0x86, 0x9E, 0x99, 0xAA, 0x9A, 0xAA, 0xAB, 0xB7, 0xBF, 0xD5, 0xC6, 0xD4, 0xCC, 0xDD, 0xDF, 0xE8, // BIN 214: 14 pairs
-  0x07, 0x12, 0x1A, 0x45, 0x4C, 0x5B, 0x65, 0x63, 0x7A, 0x91, 0x97, 0xB4, 0xCC, 0xB4, 0xD3, // BIN 215: 7 pairs
-  0x0E, 0x0E, 0x10, 0x11, 0x18, 0x14, 0x21, 0x30, 0x3F, 0x37, 0x45, 0x47, 0x68, 0x4F, 0x61, 0x6A, 0x6B, 0x99, 0xC6, 0x9A, 0xC6, 0xBF, 0xD6, 0xC3, 0xDC, 0xD6, 0xE0, 0xEE, 0xF2, // BIN 216: 14 pairs
-  0x0E, 0x06, 0xFF, 0x0D, 0x1A, 0x22, 0x30, 0x24, 0x40, 0x38, 0x3E, 0x3B, 0x44, 0x48, 0x49, 0x7F, 0xA4, 0x9B, 0xA4, 0x9C, 0xC5, 0xB2, 0xCD, 0xBA, 0xBD, 0xCA, 0xDF, 0xE1, 0xF7, // BIN 217: 14 pairs
-  0x08, 0x04, 0xFC, 0x37, 0x46, 0x5E, 0x7A, 0x6A, 0x76, 0x94, 0x9B, 0xA0, 0xAC, 0xA1, 0xBB, 0xBF, 0xCE, // BIN 218: 8 pairs
-  0x12, 0x12, 0x1D, 0x12, 0x1E, 0x31, 0x4A, 0x4C, 0x5D, 0x7A, 0xA4, 0x7F, 0x8B, 0x7F, 0x9B, 0x86, 0xA5, 0x9C, 0xA0, 0xA0, 0xBB, 0xA7, 0xB6, 0xAD, 0xB1, 0xB0, 0xB2, 0xB1, 0xB4, 0xBF, 0xCA, 0xD1, 0xDC, 0xDE, 0xE7, 0xE4, 0xEF, // BIN 219: 18 pairs
-  0x11, 0x23, 0x38, 0x2F, 0x49, 0x4E, 0x5B, 0x56, 0x66, 0x5D, 0x6C, 0x6C, 0x82, 0x6D, 0x82, 0x80, 0x83, 0x99, 0xC5, 0x9A, 0xC5, 0xA6, 0xBD, 0xAA, 0xC9, 0xB2, 0xD0, 0xBA, 0xC5, 0xBF, 0xC8, 0xC9, 0xD5, 0xCB, 0xDE, // BIN 220: 17 pairs
-  0x0B, 0x18, 0x27, 0x26, 0x37, 0x29, 0x45, 0x2F, 0x4A, 0x34, 0x46, 0x46, 0x50, 0x54, 0x63, 0x5C, 0x71, 0x85, 0xAC, 0x8E, 0x96, 0xA7, 0xC5, // BIN 221: 11 pairs
-  0x08, 0x2D, 0x2E, 0x2E, 0x3A, 0x48, 0x4D, 0x63, 0x7D, 0xA3, 0xB2, 0xC2, 0xD9, 0xCE, 0xDE, 0xE3, 0xEC, // BIN 222: 8 pairs
-  0x11, 0x15, 0x1F, 0x16, 0x2B, 0x17, 0x25, 0x22, 0x2C, 0x28, 0x3F, 0x32, 0x44, 0x34, 0x35, 0x50, 0x60, 0x5D, 0x66, 0x65, 0x74, 0x97, 0xA8, 0xA7, 0xC9, 0xAA, 0xAF, 0xB7, 0xCE, 0xC8, 0xDF, 0xDC, 0xED, 0xE3, 0xEE, // BIN 223: 17 pairs
-  0x0D, 0x26, 0x34, 0x30, 0x46, 0x3C, 0x42, 0x3D, 0x4E, 0x48, 0x5F, 0x54, 0x5F, 0x5A, 0x65, 0x5F, 0x7A, 0xA7, 0xB2, 0xA7, 0xC6, 0xAA, 0xAC, 0xAD, 0xC8, 0xC1, 0xC3, // BIN 224: 13 pairs
-  0x11, 0x13, 0xE1, 0x1C, 0x2E, 0x31, 0x49, 0x39, 0x45, 0x3F, 0x4C, 0x79, 0x83, 0x7E, 0x8E, 0x82, 0x9C, 0x84, 0x92, 0x95, 0x9F, 0x9B, 0xA2, 0x9B, 0xBD, 0xA8, 0xD1, 0xB8, 0xBC, 0xB8, 0xC7, 0xD6, 0xD8, 0xE2, 0xE8, // BIN 225: 17 pairs
-  0x0F, 0x08, 0xF0, 0x36, 0x4D, 0x3B, 0x3D, 0x3B, 0x50, 0x3E, 0x41, 0x5C, 0x72, 0x5F, 0x7D, 0x75, 0xA4, 0x7B, 0x9E, 0xA7, 0xB4, 0xA9, 0xC2, 0xAA, 0xC8, 0xAA, 0xCC, 0xB8, 0xCB, 0xBB, 0xBF, // BIN 226: 15 pairs
-  0x0D, 0x15, 0x1C, 0x1C, 0x23, 0x1F, 0x2F, 0x29, 0x2D, 0x36, 0x45, 0x3A, 0x4E, 0x50, 0x5C, 0x55, 0x5D, 0x8A, 0x9F, 0xAD, 0xB0, 0xAD, 0xC0, 0xC4, 0xDD, 0xE4, 0xEE, // BIN 227: 13 pairs
-  0x11, 0x1E, 0x3B, 0x38, 0x4A, 0x43, 0x57, 0x51, 0x52, 0x53, 0x56, 0x56, 0x69, 0x57, 0x6E, 0x7D, 0xAC, 0x89, 0x8D, 0x8A, 0x8E, 0x8F, 0xAA, 0x98, 0x9C, 0xA1, 0xAC, 0xA6, 0xAF, 0xAD, 0xCA, 0xBA, 0xC6, 0xF1, 0xFB, // BIN 228: 17 pairs
-  0x0F, 0x11, 0x1C, 0x18, 0x24, 0x22, 0x28, 0x26, 0x30, 0x34, 0x45, 0x3B, 0x40, 0x49, 0x56, 0x4F, 0x5F, 0x57, 0x75, 0x62, 0x67, 0x6D, 0x93, 0x9C, 0xA1, 0xB6, 0xD5, 0xBA, 0xD8, 0xE1, 0xE4, // BIN 229: 15 pairs
-  0x13, 0x03, 0x20, 0x35, 0x37, 0x4C, 0x59, 0x55, 0x56, 0x5F, 0x81, 0x92, 0xAC, 0x93, 0xA6, 0x93, 0xBD, 0xA0, 0xBD, 0xA1, 0xBA, 0xAA, 0xC5, 0xAC, 0xC0, 0xB0, 0xB4, 0xB6, 0xD4, 0xBF, 0xD0, 0xC7, 0xE4, 0xCC, 0xDB, 0xDB, 0xE8, 0xEA, 0xF9, // BIN 230: 19 pairs
-  0x14, 0x0A, 0x17, 0x0F, 0x14, 0x1F, 0x31, 0x21, 0x43, 0x22, 0x34, 0x36, 0x4F, 0x37, 0x42, 0x48, 0x61, 0x59, 0x75, 0x5E, 0x6E, 0x60, 0x72, 0x66, 0x78, 0x78, 0x99, 0x78, 0x9A, 0x7C, 0x87, 0x7E, 0x8B, 0x9F, 0xB2, 0xB1, 0xCE, 0xB2, 0xCF, 0xCB, 0xD2, // BIN 231: 20 pairs
-  0x0B, 0x08, 0x19, 0x0B, 0x1A, 0x17, 0x24, 0x17, 0x27, 0x23, 0x2E, 0x30, 0x42, 0x34, 0x42, 0x3E, 0x54, 0xA1, 0xAE, 0xAA, 0xCA, 0xF4, 0xF8, // BIN 232: 11 pairs
-  0x09, 0x16, 0x1D, 0x21, 0x39, 0x71, 0x9E, 0x94, 0xAA, 0xA0, 0xBA, 0xA6, 0xAC, 0xA7, 0xAE, 0xB2, 0xCC, 0xBD, 0xD4, // BIN 233: 9 pairs
-  0x0A, 0x0E, 0x15, 0x43, 0x53, 0x63, 0x81, 0x68, 0x78, 0x98, 0xAD, 0xAA, 0xC6, 0xB0, 0xC1, 0xBE, 0xF0, 0xC5, 0xD7, 0xDC, 0xEC, // BIN 234: 10 pairs
-  0x0F, 0x0E, 0x17, 0x11, 0x15, 0x1A, 0x3B, 0x1B, 0x5E, 0x27, 0x3D, 0x2F, 0x4B, 0x43, 0x59, 0x4F, 0x63, 0x61, 0x7A, 0x83, 0x8A, 0x85, 0x8B, 0xA9, 0xC3, 0xAB, 0xC1, 0xB2, 0xD3, 0xDD, 0xE8, // BIN 235: 15 pairs
-  0x11, 0x04, 0x0F, 0x18, 0x2B, 0x1A, 0x1C, 0x2A, 0x45, 0x4E, 0x50, 0x56, 0x5E, 0x63, 0x78, 0x69, 0x82, 0x6B, 0x73, 0x88, 0x91, 0x94, 0xA7, 0xA1, 0xB2, 0xA1, 0xBD, 0xB1, 0xC1, 0xC0, 0xD8, 0xC4, 0xDF, 0xD0, 0xE0, // BIN 236: 17 pairs
-  0x0E, 0x0A, 0x18, 0x16, 0x27, 0x1C, 0x27, 0x2C, 0x35, 0x31, 0x4B, 0x6E, 0x81, 0x6E, 0x84, 0x72, 0x8C, 0x80, 0x95, 0x8B, 0xA6, 0x92, 0xA4, 0x93, 0xAA, 0xB0, 0xCE, 0xCC, 0xDF, // BIN 237: 14 pairs
-  0x0D, 0x12, 0x1C, 0x19, 0x24, 0x1E, 0x3C, 0x21, 0x36, 0x23, 0x29, 0x25, 0x35, 0x64, 0x7B, 0x6B, 0x7B, 0x7B, 0xA5, 0xB1, 0xB6, 0xB6, 0xD7, 0xD9, 0xEC, 0xE9, 0xEF, // BIN 238: 13 pairs
-  0x0D, 0x20, 0x48, 0x3C, 0x52, 0x44, 0x51, 0x5F, 0x84, 0x72, 0x73, 0x7C, 0x8B, 0x81, 0x92, 0x9F, 0xB0, 0xA4, 0xA7, 0xB7, 0xBA, 0xBB, 0xD8, 0xC1, 0xD6, 0xD2, 0xDF, // BIN 239: 13 pairs
-  0x0E, 0x02, 0x0A, 0x1F, 0x2C, 0x22, 0x3D, 0x5E, 0x85, 0x63, 0x7F, 0x6F, 0x7E, 0x85, 0x98, 0x86, 0x97, 0x8A, 0xA2, 0x8C, 0xB3, 0x93, 0x95, 0x94, 0xA3, 0xA1, 0xB6, 0xC2, 0xDC, // BIN 240: 14 pairs
-  0x0F, 0x10, 0x1D, 0x1F, 0x23, 0x26, 0x45, 0x2E, 0x46, 0x47, 0x69, 0x4B, 0x56, 0x63, 0x84, 0xA0, 0xAE, 0xA0, 0xC0, 0xA3, 0xB4, 0xA5, 0xC7, 0xA7, 0xCC, 0xB6, 0xC9, 0xBC, 0xD6, 0xC6, 0xD7, // BIN 241: 15 pairs
-  0x0B, 0x0C, 0x21, 0x2D, 0x31, 0x35, 0x3B, 0x48, 0x63, 0x82, 0xA0, 0x98, 0xAC, 0x9F, 0xB1, 0xA1, 0xB4, 0xB8, 0xD1, 0xEA, 0xF4, 0xEE, 0xFD, // BIN 242: 11 pairs
-  0x0F, 0x01, 0x10, 0x09, 0xF9, 0x30, 0x45, 0x48, 0x5D, 0x78, 0x9C, 0x7A, 0x9B, 0x7D, 0x9B, 0x8B, 0xA7, 0x8E, 0x9F, 0xA0, 0xB2, 0xA1, 0xC0, 0xAA, 0xCD, 0xAE, 0xC8, 0xBF, 0xCD, 0xC6, 0xEA, // BIN 243: 15 pairs
-  0x0B, 0x0B, 0xF7, 0x22, 0x37, 0x2C, 0x45, 0x36, 0x38, 0x3E, 0x55, 0x48, 0x4B, 0x61, 0x7D, 0x7A, 0x8B, 0x91, 0xA9, 0xBC, 0xD2, 0xE0, 0xE2, // BIN 244: 11 pairs
-  0x0C, 0x01, 0x16, 0x04, 0x07, 0x06, 0xF0, 0x41, 0x49, 0x53, 0x5D, 0x5E, 0x7F, 0x7E, 0x94, 0x9D, 0xB5, 0xA6, 0xC9, 0xB5, 0xCE, 0xB8, 0xD9, 0xF2, 0xFA, // BIN 245: 12 pairs
-  0x10, 0x24, 0x44, 0x27, 0x40, 0x41, 0x5F, 0x52, 0x5C, 0x55, 0x62, 0x56, 0x6C, 0x67, 0x76, 0x6D, 0x8F, 0x6D, 0x9C, 0x7B, 0xA8, 0x8B, 0x93, 0xA0, 0xB6, 0xA2, 0xBA, 0xC3, 0xCB, 0xC5, 0xEA, 0xDC, 0xE5, // BIN 246: 16 pairs
-  0x0C, 0x02, 0x0E, 0x04, 0xF6, 0x0A, 0x0B, 0x47, 0x54, 0x4C, 0x57, 0x7F, 0x98, 0x8A, 0x98, 0xA4, 0xC9, 0xAE, 0xCA, 0xB4, 0xD5, 0xD6, 0xDA, 0xD6, 0xDB, // BIN 247: 12 pairs
-  0x12, 0x0B, 0x18, 0x13, 0xBE, 0x24, 0x32, 0x5B, 0x6A, 0x5D, 0x6D, 0x60, 0x67, 0x68, 0x93, 0x68, 0x9C, 0x75, 0x92, 0x82, 0xA1, 0x8B, 0xA2, 0x90, 0x9D, 0x90, 0xA5, 0x90, 0xB3, 0xA0, 0xB4, 0xBF, 0xDA, 0xE2, 0xE3, 0xE6, 0xE8, // BIN 248: 18 pairs
-  0x0F, 0x05, 0xFA, 0x14, 0x20, 0x1C, 0x25, 0x1E, 0x22, 0x6C, 0x93, 0x9C, 0xA6, 0x9C, 0xAA, 0x9D, 0xAB, 0xAA, 0xCF, 0xBF, 0xD7, 0xC0, 0xDA, 0xC4, 0xC9, 0xD2, 0xDD, 0xE9, 0xF7, 0xED, 0xFA, // BIN 249: 15 pairs
-  0x0F, 0x06, 0x19, 0x11, 0x1D, 0x30, 0x3D, 0x4D, 0x5D, 0x5F, 0x7F, 0x61, 0x78, 0x78, 0x9B, 0x95, 0x99, 0x95, 0x9A, 0x96, 0xAB, 0xA7, 0xC8, 0xB0, 0xB6, 0xC4, 0xE0, 0xD2, 0xE2, 0xD6, 0xE5, // BIN 250: 15 pairs
-  0x0E, 0x08, 0x0A, 0x08, 0xEF, 0x0D, 0x18, 0x17, 0x2B, 0x1F, 0x33, 0x68, 0xA4, 0x87, 0x96, 0x94, 0xAD, 0x9F, 0xB4, 0xA6, 0xC5, 0xAC, 0xCC, 0xB4, 0xD4, 0xB6, 0xD8, 0xE0, 0xE7, // BIN 251: 14 pairs
-  0x0F, 0x0D, 0xF0, 0x2B, 0x35, 0x2C, 0x46, 0x3F, 0x55, 0x40, 0x51, 0x47, 0x4C, 0x8A, 0x92, 0xA6, 0xC8, 0xA6, 0xCC, 0xAD, 0xCD, 0xBC, 0xBF, 0xD2, 0xD7, 0xD6, 0xE6, 0xDD, 0xEB, 0xE1, 0xEC, // BIN 252: 15 pairs
-  0x09, 0x00, 0x0E, 0x0C, 0xF8, 0x38, 0x4B, 0x63, 0x85, 0x7F, 0xAC, 0x84, 0x9B, 0xC7, 0xDC, 0xDA, 0xE8, 0xF4, 0xFB, // BIN 253: 9 pairs
-  0x10, 0x0B, 0xF0, 0x0E, 0x18, 0x1D, 0x35, 0x38, 0x49, 0x3F, 0x43, 0x48, 0x5E, 0x5F, 0x78, 0x88, 0x9D, 0x9B, 0xBB, 0x9F, 0xA6, 0xAE, 0xC0, 0xB0, 0xB5, 0xB1, 0xC4, 0xB1, 0xD2, 0xCE, 0xE2, 0xE7, 0xF2, // BIN 254: 16 pairs
-  0x0C, 0x01, 0x0A, 0x02, 0xFA, 0x06, 0xEF, 0x1C, 0x35, 0x22, 0x27, 0x33, 0x46, 0x34, 0x3D, 0x70, 0x90, 0x78, 0x95, 0x8B, 0x8D, 0xA6, 0xC6, 0xAF, 0xC8, // BIN 255: 12 pairs
-  0x0E, 0x05, 0x06, 0x0D, 0x13, 0x41, 0x5E, 0x47, 0x6C, 0x47, 0x6D, 0x58, 0x6B, 0x6F, 0x80, 0x71, 0xA5, 0x80, 0x82, 0x9D, 0xB8, 0xA0, 0xA4, 0xA7, 0xCA, 0xB1, 0xCB, 0xE4, 0xF7, // BIN 256: 14 pairs
-  0x0D, 0x23, 0x3D, 0x45, 0x51, 0x71, 0x90, 0x7C, 0x8E, 0x88, 0x96, 0x90, 0x9E, 0x9E, 0xFF, 0xB0, 0xCB, 0xBA, 0xDA, 0xBF, 0xCF, 0xBF, 0xD4, 0xC0, 0xDD, 0xD9, 0xDE, // BIN 257: 13 pairs
-  0x0F, 0x22, 0x40, 0x27, 0x44, 0x29, 0x3A, 0x31, 0x3A, 0x37, 0x3D, 0x41, 0x4D, 0x56, 0x6E, 0x61, 0x81, 0x6C, 0x8F, 0x7D, 0xB9, 0x85, 0xA0, 0x92, 0xA2, 0xA6, 0xCA, 0xAF, 0xCA, 0xB4, 0xD7, // BIN 258: 15 pairs
-  0x0E, 0x0F, 0xF8, 0x30, 0x40, 0x3A, 0x51, 0x41, 0x61, 0x5C, 0x65, 0x61, 0x7F, 0x95, 0xAD, 0xA8, 0xE1, 0xAD, 0xD0, 0xB3, 0xC3, 0xB9, 0xC0, 0xCD, 0xE0, 0xCF, 0xE0, 0xEC, 0xF0, // BIN 259: 14 pairs
-  0x08, 0x25, 0x3D, 0x2C, 0x42, 0x52, 0x5A, 0x5F, 0x85, 0x93, 0xC6, 0x9F, 0xAB, 0xF2, 0xF3, 0xF2, 0xFD, // BIN 260: 8 pairs
-  0x0E, 0x07, 0xFB, 0x15, 0x22, 0x19, 0x1C, 0x38, 0x39, 0x70, 0x88, 0x7A, 0xAC, 0x7F, 0x95, 0x94, 0xAE, 0x9B, 0xAD, 0x9F, 0xA1, 0xA2, 0xBB, 0xA9, 0xBC, 0xBD, 0xD7, 0xC5, 0xD3, // BIN 261: 14 pairs
-  0x11, 0x00, 0x12, 0x0B, 0x12, 0x0E, 0x1C, 0x1D, 0x3C, 0x23, 0x24, 0x26, 0x49, 0x2B, 0x3D, 0x3A, 0x3F, 0x5D, 0x5E, 0x98, 0xBB, 0x99, 0xC9, 0x9A, 0xC9, 0x9B, 0xC5, 0xAA, 0xD0, 0xAD, 0xCC, 0xBB, 0xDA, 0xBE, 0xEF, // BIN 262: 17 pairs
-  0x17, 0x04, 0xF8, 0x06, 0x12, 0x33, 0x3E, 0x34, 0x40, 0x39, 0x54, 0x3C, 0x46, 0x43, 0x55, 0x5A, 0x6A, 0x6D, 0xA4, 0x85, 0xB9, 0x8B, 0xAA, 0x98, 0x9F, 0x98, 0xAE, 0x9B, 0xC6, 0xA1, 0xAF, 0xA9, 0xC1, 0xB1, 0xB5, 0xB4, 0xC9, 0xC4, 0xD6, 0xC9, 0xDD, 0xC9, 0xEA, 0xCA, 0xE0, 0xD9, 0xED, // BIN 263: 23 pairs
-  0x0F, 0x0B, 0x17, 0x19, 0x3B, 0x22, 0x2A, 0x6D, 0x99, 0x6D, 0x9A, 0x78, 0x98, 0x8F, 0xB9, 0x93, 0xC5, 0x9B, 0xC0, 0x9F, 0xB7, 0xA3, 0xB6, 0xA7, 0xAF, 0xA7, 0xCD, 0xB9, 0xEA, 0xDF, 0xEB, // BIN 264: 15 pairs
-  0x0D, 0x28, 0x45, 0x2A, 0x36, 0x37, 0x40, 0x43, 0x45, 0x61, 0x84, 0x85, 0x95, 0x9C, 0xC9, 0xA0, 0xC5, 0xA2, 0xB7, 0xA5, 0xD1, 0xAD, 0xCF, 0xBF, 0xDB, 0xC1, 0xD2, // BIN 265: 13 pairs
-  0x0D, 0x05, 0xFE, 0x1B, 0x68, 0x2D, 0x44, 0x50, 0x51, 0x74, 0x89, 0x79, 0x94, 0x81, 0x9B, 0x9B, 0xB9, 0xA7, 0xB9, 0xB0, 0xD2, 0xB4, 0xD8, 0xB7, 0xC1, 0xDC, 0xE6, // BIN 266: 13 pairs
-  0x18, 0x00, 0x10, 0x07, 0xFC, 0x0D, 0xF7, 0x1B, 0x41, 0x1F, 0x30, 0x29, 0x32, 0x2A, 0x3E, 0x2F, 0x43, 0x38, 0x46, 0x3D, 0x51, 0x41, 0x63, 0x56, 0x6D, 0x69, 0x93, 0x6A, 0x72, 0x83, 0x91, 0x85, 0xA1, 0x98, 0xBD, 0xA0, 0xC6, 0xA1, 0xA4, 0xAB, 0xAF, 0xAC, 0xBB, 0xB2, 0xD5, 0xB9, 0xCC, 0xC9, 0xD8, // BIN 267: 24 pairs
-  0x0F, 0x08, 0x1A, 0x0A, 0x16, 0x22, 0x33, 0x48, 0x66, 0x65, 0x72, 0x6E, 0x8F, 0x82, 0x8A, 0x8D, 0x95, 0x9E, 0xF0, 0x9F, 0xAA, 0xA5, 0xF0, 0xB0, 0xC4, 0xB6, 0xD2, 0xC1, 0xDE, 0xE5, 0xE8, // BIN 268: 15 pairs
-  0x14, 0x0D, 0x17, 0x15, 0x23, 0x23, 0x31, 0x29, 0x4A, 0x3B, 0x52, 0x48, 0x4A, 0x4A, 0x56, 0x77, 0x9E, 0x7F, 0xA0, 0x8E, 0xA3, 0xA0, 0xC9, 0xA6, 0xCD, 0xA7, 0xCF, 0xB4, 0xD2, 0xB7, 0xD6, 0xC0, 0xDB, 0xC6, 0xD3, 0xC8, 0xE0, 0xC9, 0xDA, 0xD5, 0xD6, // BIN 269: 20 pairs
-  0x0D, 0x1A, 0x3C, 0x25, 0x40, 0x26, 0x4A, 0x2B, 0x40, 0x33, 0x35, 0x43, 0x5D, 0x45, 0x4E, 0x72, 0x90, 0x79, 0x82, 0x80, 0x8E, 0x86, 0xB3, 0xD6, 0xDF, 0xE5, 0xED, // BIN 270: 13 pairs
-  0x14, 0x00, 0x11, 0x1F, 0x38, 0x2D, 0x2F, 0x33, 0x42, 0x3A, 0x45, 0x3B, 0x58, 0x3E, 0x56, 0x6C, 0x9C, 0x7C, 0x94, 0x87, 0x8A, 0x8B, 0x99, 0x8B, 0x9A, 0x8E, 0x94, 0x97, 0xB8, 0x98, 0xA4, 0x9F, 0xA0, 0x9F, 0xB6, 0xA1, 0xC5, 0xA5, 0xFF, 0xB2, 0xD4, // BIN 271: 20 pairs
-  0x10, 0x13, 0xEF, 0x1F, 0x34, 0x23, 0x40, 0x28, 0x35, 0x2B, 0x44, 0x56, 0x68, 0x80, 0x87, 0x8F, 0x94, 0x98, 0xB2, 0x9B, 0xBA, 0x9E, 0xC7, 0xA0, 0xAF, 0xA2, 0xB1, 0xAE, 0xCD, 0xAF, 0xC0, 0xB7, 0xCB, // BIN 272: 16 pairs
-  0x0B, 0x52, 0x65, 0x68, 0x82, 0x7A, 0x98, 0x88, 0x89, 0x8D, 0xA2, 0x98, 0xBA, 0xA1, 0xC6, 0xA1, 0xC9, 0xD0, 0xD2, 0xD1, 0xE9, 0xD2, 0xD4, // BIN 273: 11 pairs
-  0x08, 0x29, 0x49, 0x61, 0x85, 0x68, 0x99, 0x68, 0x9A, 0x74, 0x83, 0x82, 0xA4, 0xA2, 0xB0, 0xAA, 0xC4, // BIN 274: 8 pairs
-  0x0D, 0x1D, 0x3B, 0x2F, 0x4D, 0x41, 0x4B, 0x47, 0x5D, 0x58, 0x60, 0x82, 0xA7, 0x85, 0xA7, 0x8D, 0xA3, 0xA4, 0xAA, 0xBF, 0xC0, 0xC5, 0xD5, 0xD6, 0xE7, 0xED, 0xF2, // BIN 275: 13 pairs
-  0x14, 0x0A, 0xFD, 0x1A, 0x2E, 0x24, 0x2D, 0x32, 0x4E, 0x33, 0x4A, 0x39, 0x47, 0x39, 0x53, 0x52, 0x5B, 0x58, 0x77, 0x5C, 0x77, 0x69, 0x8F, 0x73, 0x89, 0x74, 0x87, 0x7D, 0x8B, 0x82, 0x94, 0xA6, 0xCF, 0xAE, 0xD0, 0xB7, 0xBB, 0xC2, 0xC7, 0xD1, 0xEC, // BIN 276: 20 pairs
-  0x0B, 0x09, 0xF8, 0x22, 0x3C, 0x2C, 0x3D, 0x31, 0x32, 0x4C, 0x61, 0x57, 0x81, 0x78, 0x80, 0x7F, 0xA1, 0xBC, 0xC3, 0xD3, 0xD6, 0xD4, 0xEB, // BIN 277: 11 pairs
-  0x0E, 0x22, 0x25, 0x2E, 0x50, 0x31, 0x4D, 0x32, 0x3C, 0x5D, 0x68, 0x5E, 0x78, 0x60, 0x70, 0x66, 0x82, 0x9B, 0xC9, 0xB2, 0xC9, 0xBF, 0xCC, 0xC0, 0xDF, 0xC2, 0xD1, 0xCB, 0xDC, // BIN 278: 14 pairs
-  0x0A, 0x1F, 0x37, 0x25, 0x44, 0x70, 0x9E, 0x75, 0xAC, 0x76, 0x88, 0xAB, 0xCB, 0xB2, 0xD7, 0xBD, 0xEA, 0xCA, 0xD2, 0xE6, 0xF2, // BIN 279: 10 pairs
-  0x0F, 0x00, 0x06, 0x02, 0x11, 0x23, 0x42, 0x39, 0x56, 0x41, 0x66, 0x64, 0x65, 0x7D, 0x98, 0x98, 0xB4, 0x98, 0xB6, 0xA4, 0xA6, 0xB2, 0xD2, 0xB6, 0xBD, 0xBA, 0xDB, 0xD7, 0xEB, 0xED, 0xF7, // BIN 280: 15 pairs
-  0x17, 0x08, 0x18, 0x0A, 0x19, 0x10, 0x1C, 0x1D, 0x23, 0x2D, 0x3F, 0x33, 0x36, 0x35, 0x50, 0x45, 0x4F, 0x48, 0x53, 0x68, 0x8F, 0x78, 0x79, 0x8A, 0xA1, 0x8F, 0xBD, 0x94, 0xAF, 0x95, 0xAE, 0xAD, 0xD3, 0xBB, 0xDD, 0xBD, 0xD3, 0xC2, 0xDE, 0xE5, 0xEE, 0xE6, 0xED, 0xE7, 0xF3, 0xEC, 0xFA, // BIN 281: 23 pairs
-  0x0A, 0x08, 0x12, 0x0C, 0xF9, 0x24, 0x42, 0x26, 0x43, 0x26, 0x4B, 0x73, 0x88, 0x79, 0x87, 0xBA, 0xDD, 0xC6, 0xD5, 0xC8, 0xD2, // BIN 282: 10 pairs
-  0x0B, 0x04, 0x14, 0x06, 0x18, 0x1C, 0x2B, 0x20, 0x43, 0x57, 0x7D, 0x59, 0x7A, 0x6B, 0x74, 0x6B, 0x86, 0x77, 0xA5, 0xA3, 0xBF, 0xAF, 0xCD, // BIN 283: 11 pairs
-  0x0E, 0x16, 0x24, 0x1B, 0x57, 0x1E, 0x35, 0x37, 0x4E, 0x41, 0x5D, 0x53, 0x62, 0x58, 0x72, 0x58, 0x7B, 0x66, 0x93, 0xA8, 0xC3, 0xAB, 0xB8, 0xAB, 0xC2, 0xBB, 0xDB, 0xE4, 0xF0, // BIN 284: 14 pairs
-  0x0E, 0x03, 0xB9, 0x0B, 0xEF, 0x11, 0x1E, 0x60, 0x73, 0x98, 0xC0, 0xA7, 0xD0, 0xAC, 0xCF, 0xAF, 0xD0, 0xB2, 0xD8, 0xBE, 0xFF, 0xC9, 0xDB, 0xD8, 0xE8, 0xDC, 0xEE, 0xF7, 0xFA, // BIN 285: 14 pairs
-  0x10, 0x08, 0x13, 0x29, 0x4B, 0x6C, 0x99, 0x6C, 0x9A, 0x79, 0x95, 0x7E, 0x89, 0x8A, 0xA0, 0x8C, 0xBE, 0x99, 0xC0, 0x9A, 0xC0, 0xAE, 0xCC, 0xAE, 0xCF, 0xB6, 0xDA, 0xB7, 0xD3, 0xC9, 0xDF, 0xE7, 0xF5, // BIN 286: 16 pairs
-  0x10, 0x01, 0x05, 0x06, 0x1A, 0x0D, 0x12, 0x13, 0x71, 0x2A, 0x39, 0x2C, 0x40, 0x2F, 0x4C, 0x57, 0x84, 0x69, 0x9C, 0x8B, 0x9F, 0xA0, 0xCC, 0xB6, 0xC5, 0xBF, 0xE0, 0xD1, 0xEF, 0xD6, 0xDD, 0xE6, 0xEE, // BIN 287: 16 pairs
-  0x0F, 0x03, 0xEA, 0x0A, 0x0D, 0x0E, 0x1D, 0x31, 0x43, 0x38, 0x42, 0x43, 0x61, 0x45, 0x54, 0x57, 0x7A, 0x59, 0x7D, 0x5D, 0x75, 0x78, 0xA4, 0x7A, 0x95, 0x80, 0x92, 0xA1, 0xCC, 0xD2, 0xDE, // BIN 288: 15 pairs
-  0x0B, 0x2E, 0x30, 0x2F, 0x3A, 0x3F, 0x4F, 0x4F, 0x66, 0x77, 0xA8, 0x97, 0xB3, 0xA6, 0xD0, 0xBE, 0xC3, 0xBF, 0xCB, 0xCB, 0xE2, 0xE6, 0xF1, // BIN 289: 11 pairs
-  0x15, 0x01, 0x19, 0x0B, 0x13, 0x20, 0x57, 0x20, 0x5E, 0x23, 0x46, 0x24, 0x3A, 0x43, 0x5F, 0x5A, 0x60, 0x5B, 0x60, 0x63, 0x82, 0x6C, 0xA4, 0x71, 0x88, 0x72, 0x74, 0x89, 0x9D, 0x95, 0x9C, 0xAE, 0xD3, 0xB8, 0xDC, 0xDB, 0xEB, 0xE1, 0xE9, 0xE5, 0xF2, 0xED, 0xEF, // BIN 290: 21 pairs
-  0x0F, 0x07, 0x09, 0x13, 0xB3, 0x22, 0x42, 0x26, 0x2D, 0x36, 0x54, 0x54, 0x66, 0x7B, 0x97, 0x7F, 0xA7, 0x82, 0xA6, 0x92, 0xBD, 0xAC, 0xCD, 0xAF, 0xD2, 0xAF, 0xD3, 0xBA, 0xD2, 0xD4, 0xEA, // BIN 291: 15 pairs
-  0x0F, 0x13, 0x58, 0x16, 0x3B, 0x1B, 0x66, 0x1C, 0x32, 0x23, 0x2F, 0x34, 0x4E, 0x4D, 0x59, 0x50, 0x64, 0x7E, 0x95, 0x91, 0xAB, 0x9B, 0xB2, 0x9B, 0xB6, 0xC3, 0xE4, 0xCC, 0xE0, 0xD9, 0xE1, // BIN 292: 15 pairs
-  0x11, 0x1C, 0x2D, 0x1F, 0x2D, 0x35, 0x4E, 0x4C, 0x5F, 0x59, 0x81, 0x64, 0x86, 0x66, 0x9C, 0x8A, 0x9B, 0x98, 0xAF, 0x9B, 0xAE, 0xA0, 0xC8, 0xA1, 0xC8, 0xA4, 0xC0, 0xAB, 0xAE, 0xB7, 0xC8, 0xBE, 0xE4, 0xBF, 0xDD, // BIN 293: 17 pairs
-  0x0A, 0x04, 0xF4, 0x54, 0x69, 0x5E, 0xA4, 0x6B, 0x88, 0x7A, 0xA0, 0x9F, 0xA7, 0xB7, 0xCA, 0xBF, 0xDF, 0xCD, 0xD2, 0xD1, 0xE3, // BIN 294: 10 pairs
-  0x12, 0x06, 0x17, 0x08, 0x17, 0x23, 0x26, 0x36, 0x53, 0x37, 0x4A, 0x49, 0x5D, 0x4B, 0x5D, 0x4F, 0x5E, 0x5E, 0x9C, 0x6E, 0x93, 0x78, 0xA0, 0x7D, 0xA0, 0x82, 0xAC, 0x9E, 0xD1, 0xA0, 0xB9, 0xA6, 0xC4, 0xAA, 0xB9, 0xB6, 0xC6, // BIN 295: 18 pairs
-  0x08, 0x0D, 0xEF, 0x37, 0x3E, 0x3B, 0x42, 0x45, 0x46, 0x67, 0x6B, 0xCB, 0xD9, 0xE8, 0xF5, 0xEE, 0xF7, // BIN 296: 8 pairs
-  0x0B, 0x0D, 0x1E, 0x35, 0x52, 0x4C, 0x63, 0x7F, 0xB9, 0x84, 0x98, 0x9B, 0xB4, 0xAB, 0xCE, 0xAD, 0xC9, 0xBE, 0xD9, 0xCC, 0xEA, 0xEE, 0xFE, // BIN 297: 11 pairs
-  0x0B, 0x14, 0x1F, 0x17, 0x22, 0x2A, 0x35, 0x38, 0x4D, 0x3A, 0x3C, 0x41, 0x4A, 0x75, 0x9B, 0xAC, 0xC8, 0xAF, 0xCF, 0xC3, 0xE3, 0xDA, 0xEB, // BIN 298: 11 pairs
-  0x15, 0x05, 0x08, 0x09, 0xF6, 0x28, 0x36, 0x2B, 0x50, 0x2E, 0x34, 0x30, 0x4E, 0x31, 0x4C, 0x36, 0x47, 0x3F, 0x51, 0x48, 0x69, 0x5E, 0x93, 0x67, 0x6F, 0x7A, 0xB9, 0xA0, 0xCA, 0xA1, 0xCA, 0xB3, 0xF0, 0xB9, 0xCF, 0xBA, 0xDF, 0xBD, 0xD5, 0xC1, 0xDC, 0xED, 0xFD, // BIN 299: 21 pairs
-  0x0C, 0x00, 0x01, 0x33, 0x39, 0x33, 0x3D, 0x50, 0x65, 0x54, 0x6E, 0x73, 0x87, 0x75, 0xB9, 0x9C, 0xC0, 0xB3, 0xB8, 0xB4, 0xBD, 0xBB, 0xDF, 0xC4, 0xCE, // BIN 300: 12 pairs
-  0x0B, 0x09, 0xFC, 0x16, 0xFF, 0x28, 0x46, 0x33, 0x4B, 0x51, 0x53, 0x70, 0xA5, 0x79, 0x8E, 0x94, 0xB2, 0xAF, 0xCC, 0xB7, 0xD8, 0xBF, 0xC1, // BIN 301: 11 pairs
-  0x13, 0x01, 0x13, 0x03, 0x5E, 0x1B, 0x48, 0x21, 0x57, 0x28, 0x3E, 0x2A, 0x4A, 0x32, 0x3F, 0x48, 0x55, 0x50, 0x58, 0x59, 0x84, 0x66, 0xA4, 0x76, 0x8E, 0x78, 0xA1, 0x7A, 0xA1, 0x84, 0xBD, 0xA8, 0xB8, 0xAC, 0xCA, 0xDC, 0xE2, 0xE9, 0xFA, // BIN 302: 19 pairs
-  0x1A, 0x05, 0x0B, 0x11, 0x19, 0x15, 0x1D, 0x21, 0x4F, 0x2D, 0x45, 0x2D, 0x4E, 0x33, 0x49, 0x43, 0x63, 0x48, 0x68, 0x4A, 0x51, 0x51, 0x55, 0x51, 0x62, 0x69, 0x99, 0x69, 0x9A, 0x76, 0x91, 0x92, 0xB9, 0x98, 0xC5, 0xAC, 0xBA, 0xB4, 0xDA, 0xC1, 0xD9, 0xC6, 0xEB, 0xC9, 0xEB, 0xD1, 0xF0, 0xD7, 0xEA, 0xDB, 0xE2, 0xE3, 0xE7, // BIN 303: 26 pairs
-  0x15, 0x16, 0x1C, 0x19, 0x3C, 0x2E, 0x52, 0x37, 0x51, 0x59, 0x78, 0x5C, 0x7B, 0x65, 0x76, 0x6E, 0x8B, 0x7D, 0xA1, 0x84, 0xA0, 0x85, 0xA6, 0x8D, 0x91, 0x90, 0xBE, 0x97, 0xB5, 0x98, 0xC6, 0xA1, 0xB9, 0xC2, 0xE3, 0xC5, 0xEB, 0xCF, 0xD2, 0xCF, 0xEA, 0xDE, 0xED, // BIN 304: 21 pairs
-  0x0E, 0x09, 0x20, 0x38, 0x4E, 0x4F, 0x69, 0x50, 0x5A, 0x66, 0x8F, 0x69, 0xA4, 0x8A, 0x8F, 0x93, 0xC9, 0x95, 0xB2, 0xB1, 0xBA, 0xB3, 0xD9, 0xC4, 0xC5, 0xDD, 0xEA, 0xE8, 0xF4, // BIN 305: 14 pairs
-  0x0F, 0x0A, 0x1A, 0x18, 0x2E, 0x20, 0x39, 0x22, 0x2B, 0x2C, 0x3E, 0x3B, 0x5C, 0x3F, 0x4E, 0x46, 0x5A, 0x61, 0x82, 0x73, 0x83, 0x90, 0x96, 0x90, 0xA9, 0x9A, 0xBB, 0xA6, 0xB9, 0xE5, 0xE9, // BIN 306: 15 pairs
-  0x12, 0x05, 0x17, 0x2E, 0x37, 0x2F, 0x32, 0x33, 0x40, 0x34, 0x3E, 0x41, 0x68, 0x5F, 0x82, 0x68, 0xB9, 0x75, 0x8B, 0x78, 0x8A, 0x7C, 0x89, 0x8B, 0x9C, 0x95, 0xAF, 0x99, 0xBB, 0x9B, 0xCC, 0xAB, 0xBF, 0xB1, 0xD6, 0xB8, 0xCE, // BIN 307: 18 pairs
-  0x13, 0x03, 0x09, 0x03, 0x21, 0x11, 0x1A, 0x17, 0x2E, 0x1F, 0x36, 0x2A, 0x46, 0x30, 0x44, 0x34, 0x4A, 0x6D, 0x92, 0x7B, 0xB3, 0x7C, 0x95, 0x7D, 0x95, 0x7D, 0xA7, 0x84, 0xA7, 0xA0, 0xCD, 0xA1, 0xCD, 0xB4, 0xC5, 0xB9, 0xCD, 0xE5, 0xF1, // BIN 308: 19 pairs
-  0x14, 0x0B, 0x1E, 0x18, 0x22, 0x27, 0x50, 0x28, 0x42, 0x35, 0x38, 0x36, 0x56, 0x3F, 0x54, 0x59, 0x7F, 0x6E, 0x92, 0x77, 0x97, 0x81, 0xBD, 0x83, 0x96, 0x86, 0xBE, 0x90, 0x91, 0xA2, 0xBF, 0xB6, 0xDB, 0xB7, 0xD5, 0xB9, 0xBB, 0xC5, 0xDD, 0xDF, 0xE7, // BIN 309: 20 pairs
-  0x10, 0x0A, 0xFA, 0x22, 0x44, 0x2C, 0x2E, 0x34, 0x44, 0x52, 0x64, 0x54, 0x5E, 0x5D, 0x78, 0x71, 0xA8, 0x72, 0x76, 0x81, 0x98, 0x8A, 0xA6, 0x98, 0xC9, 0xCB, 0xE3, 0xCE, 0xE5, 0xF1, 0xFE, 0xF2, 0xFB, // BIN 310: 16 pairs
-  0x12, 0x01, 0x12, 0x1C, 0x3C, 0x32, 0x51, 0x37, 0x44, 0x54, 0x6C, 0x55, 0x59, 0x82, 0xAA, 0xA2, 0xC4, 0xA7, 0xC4, 0xAE, 0xD2, 0xB2, 0xBD, 0xB7, 0xD0, 0xC7, 0xEF, 0xCF, 0xEB, 0xDF, 0xE2, 0xF3, 0xF6, 0xF9, 0xFB, 0xFB, 0xFE, // BIN 311: 18 pairs
-  0x0A, 0x0F, 0xF9, 0x18, 0x3B, 0x33, 0x4E, 0x62, 0x6A, 0x6F, 0x83, 0xA3, 0xA6, 0xA3, 0xBC, 0xAD, 0xD4, 0xBD, 0xC4, 0xDE, 0xE9, // BIN 312: 10 pairs
-  0x0D, 0x03, 0x68, 0x19, 0x2E, 0x1B, 0xF8, 0x21, 0x3E, 0x3F, 0x46, 0x80, 0x98, 0x84, 0xA1, 0x95, 0xA3, 0xA0, 0xCF, 0xA4, 0xCC, 0xC4, 0xC6, 0xDB, 0xE7, 0xF8, 0xFC, // BIN 313: 13 pairs
-  0x15, 0x13, 0xF7, 0x1F, 0x22, 0x20, 0x36, 0x22, 0x46, 0x2B, 0x58, 0x34, 0x51, 0x47, 0x75, 0x68, 0xAC, 0x6E, 0x79, 0x7A, 0xA7, 0x88, 0xA8, 0x8A, 0xA3, 0x9B, 0x9F, 0xA1, 0xCF, 0xAD, 0xD5, 0xC7, 0xE9, 0xD5, 0xE8, 0xD6, 0xD7, 0xE9, 0xF0, 0xF1, 0xFC, 0xF7, 0xFD, // BIN 314: 21 pairs
-  0x0E, 0x05, 0x18, 0x38, 0x51, 0x39, 0x55, 0x53, 0x59, 0x57, 0x7F, 0x8C, 0x9D, 0x96, 0xB5, 0xA9, 0xCB, 0xAC, 0xD0, 0xB4, 0xC6, 0xBC, 0xDE, 0xC6, 0xDD, 0xD5, 0xEB, 0xE0, 0xE6, // BIN 315: 14 pairs
-  0x10, 0x22, 0x38, 0x27, 0x42, 0x66, 0x99, 0x66, 0x9A, 0x81, 0xA0, 0x85, 0xAA, 0x8F, 0xC6, 0x95, 0xAC, 0xA2, 0xC0, 0xAA, 0xD4, 0xB0, 0xD6, 0xC7, 0xEC, 0xCC, 0xEB, 0xDA, 0xE2, 0xE0, 0xEB, 0xF5, 0xFD, // BIN 316: 16 pairs
-  0x10, 0x03, 0x47, 0x03, 0xA4, 0x13, 0xA8, 0x32, 0x45, 0x41, 0x69, 0x48, 0x6C, 0x4D, 0x57, 0x60, 0x74, 0x7F, 0xA6, 0x84, 0x8B, 0x99, 0xCC, 0x9A, 0xCC, 0xAD, 0xBD, 0xB0, 0xBA, 0xD8, 0xE2, 0xF5, 0xFA, // BIN 317: 16 pairs
-  0x11, 0x26, 0x4D, 0x2C, 0x36, 0x2D, 0x3C, 0x60, 0x71, 0x6C, 0x92, 0x7C, 0x82, 0x8F, 0xC5, 0x94, 0xB4, 0x95, 0xB4, 0xA9, 0xB0, 0xAF, 0xBC, 0xC7, 0xF0, 0xCD, 0xEA, 0xCE, 0xD8, 0xCE, 0xE6, 0xD6, 0xE8, 0xF5, 0xFC, // BIN 318: 17 pairs
-  0x08, 0x11, 0x16, 0x24, 0x46, 0x26, 0x4C, 0x27, 0x32, 0x30, 0x3E, 0x98, 0xB9, 0xB6, 0xDD, 0xB7, 0xCD, // BIN 319: 8 pairs
-  0x14, 0x01, 0xE1, 0x03, 0xF9, 0x1D, 0x32, 0x25, 0x50, 0x28, 0x3D, 0x2A, 0x42, 0x2A, 0x49, 0x2C, 0x4A, 0x49, 0x59, 0x50, 0x5B, 0x5E, 0x82, 0x74, 0x88, 0x78, 0xAC, 0x81, 0xA7, 0x97, 0xC3, 0xA3, 0xAA, 0xAA, 0xD3, 0xBB, 0xD2, 0xC2, 0xD6, 0xC5, 0xDA, // BIN 320: 20 pairs
-  0x11, 0x10, 0x25, 0x26, 0x3A, 0x36, 0x37, 0x41, 0x53, 0x55, 0x5A, 0x56, 0x75, 0x57, 0x85, 0x59, 0x85, 0x6D, 0xAC, 0x92, 0xAD, 0xB0, 0xC2, 0xB2, 0xC5, 0xB5, 0xB7, 0xB5, 0xD9, 0xD9, 0xE5, 0xE6, 0xE9, 0xE8, 0xF2, // BIN 321: 17 pairs
-  0x16, 0x14, 0x26, 0x1B, 0x5F, 0x28, 0x39, 0x30, 0x4A, 0x30, 0x51, 0x37, 0x4B, 0x3E, 0x47, 0x4A, 0x5D, 0x5D, 0x7A, 0x6F, 0x74, 0x8F, 0xA2, 0xA8, 0xA9, 0xAD, 0xD7, 0xAE, 0xD5, 0xAF, 0xD5, 0xB9, 0xC8, 0xC5, 0xD8, 0xCB, 0xE5, 0xD0, 0xEB, 0xDF, 0xEA, 0xEB, 0xFC, 0xF1, 0xF4, // BIN 322: 22 pairs
-  0x0E, 0x2C, 0x4E, 0x4F, 0x6C, 0x57, 0x78, 0x6B, 0x8C, 0x85, 0xBD, 0x95, 0xB6, 0x96, 0xA3, 0x9B, 0xAF, 0x9B, 0xC8, 0x9F, 0xBA, 0xA5, 0xEF, 0xB2, 0xDA, 0xDE, 0xE4, 0xEE, 0xEF, // BIN 323: 14 pairs
-  0x0E, 0x01, 0xFA, 0x0F, 0x47, 0x14, 0x36, 0x29, 0x43, 0x31, 0x53, 0x4B, 0x51, 0x55, 0x5B, 0x5E, 0x99, 0x5E, 0x9A, 0x79, 0x92, 0x83, 0x94, 0x84, 0xC6, 0x8E, 0x9D, 0xD0, 0xEA, // BIN 324: 14 pairs
-  0x0C, 0x09, 0x1B, 0x0E, 0x1E, 0x1D, 0x3D, 0x2A, 0x4B, 0x5C, 0x6A, 0x7E, 0x82, 0x80, 0x8F, 0xB1, 0xC2, 0xB4, 0xDB, 0xB9, 0xCA, 0xCD, 0xEB, 0xF6, 0xFB, // BIN 325: 12 pairs
-  0x10, 0x00, 0x08, 0x15, 0x28, 0x17, 0x3B, 0x2F, 0x53, 0x38, 0x53, 0x4A, 0x4E, 0x76, 0x7E, 0x78, 0xA7, 0x81, 0xA1, 0x95, 0xBB, 0x9C, 0xCC, 0x9D, 0xA8, 0xAE, 0xC9, 0xB3, 0xEF, 0xE2, 0xF1, 0xE8, 0xEB, // BIN 326: 16 pairs
-  0x13, 0x01, 0x1A, 0x02, 0x12, 0x23, 0x44, 0x37, 0x49, 0x46, 0x5B, 0x48, 0x6D, 0x62, 0x65, 0x76, 0x7C, 0x8D, 0x96, 0x8E, 0xA2, 0x92, 0xC6, 0x93, 0xC0, 0xAA, 0xBF, 0xAB, 0xAD, 0xAC, 0xEA, 0xAD, 0xD2, 0xAE, 0xD4, 0xC6, 0xDA, 0xD7, 0xE8, // BIN 327: 19 pairs
-  0x13, 0x06, 0x13, 0x0C, 0xF6, 0x0D, 0x2B, 0x1B, 0x6D, 0x21, 0x4C, 0x29, 0x4D, 0x33, 0x51, 0x34, 0x36, 0x38, 0x3D, 0x6B, 0x76, 0x78, 0x94, 0x80, 0x9F, 0x92, 0xC5, 0x9C, 0xBB, 0xA3, 0xBA, 0xB2, 0xC6, 0xC3, 0xCE, 0xE0, 0xE5, 0xF3, 0xF9, // BIN 328: 19 pairs
-  0x0F, 0x04, 0xFB, 0x0D, 0x25, 0x43, 0x5E, 0x60, 0x77, 0x81, 0x8B, 0x81, 0xC6, 0x9B, 0xCA, 0x9E, 0xEF, 0xA0, 0xD0, 0xA1, 0xA3, 0xA1, 0xD0, 0xB5, 0xC7, 0xC6, 0xD8, 0xD9, 0xEE, 0xEC, 0xFD, // BIN 329: 15 pairs
-  0x11, 0x01, 0x18, 0x01, 0xFD, 0x09, 0x21, 0x24, 0x50, 0x47, 0x49, 0x6D, 0xB9, 0x84, 0xC5, 0x8E, 0xAB, 0x94, 0xB6, 0x98, 0xCC, 0x9D, 0xC3, 0xB3, 0xE4, 0xB9, 0xD0, 0xC0, 0xE0, 0xC0, 0xEA, 0xC7, 0xE3, 0xEE, 0xF5, // BIN 330: 17 pairs
-  0x14, 0x03, 0xF6, 0x0A, 0x1E, 0x18, 0x3C, 0x1A, 0x22, 0x21, 0x26, 0x21, 0x5E, 0x26, 0x32, 0x28, 0x40, 0x3A, 0x52, 0x3F, 0x48, 0x42, 0x45, 0x42, 0x5A, 0x47, 0x4D, 0x64, 0x6A, 0x8A, 0xA7, 0x95, 0xBA, 0xA2, 0xAB, 0xA4, 0xBB, 0xA9, 0xB1, 0xCE, 0xDC, // BIN 331: 20 pairs
-  0x10, 0x06, 0xFD, 0x12, 0x15, 0x1D, 0x2D, 0x3C, 0x58, 0x4D, 0x61, 0x6E, 0x6F, 0x75, 0x98, 0x78, 0x7C, 0x7F, 0xAA, 0x92, 0x9F, 0x92, 0xBB, 0xAB, 0xB2, 0xAF, 0xD8, 0xB6, 0xDF, 0xCE, 0xE0, 0xDA, 0xE7, // BIN 332: 16 pairs
-  0x0A, 0x06, 0xFA, 0x2D, 0x51, 0x38, 0x40, 0x41, 0x6C, 0x4B, 0x59, 0x5E, 0x8F, 0xA2, 0xC8, 0xAD, 0xC5, 0xC5, 0xDF, 0xDD, 0xE7, // BIN 333: 10 pairs
-  0x10, 0x1B, 0x81, 0x20, 0x68, 0x22, 0x3B, 0x28, 0x4A, 0x58, 0x86, 0x6E, 0x80, 0x7D, 0xBD, 0x9B, 0xCD, 0xAD, 0xD8, 0xAF, 0xD4, 0xB7, 0xCF, 0xB9, 0xF8, 0xBA, 0xE0, 0xC5, 0xDB, 0xD2, 0xE6, 0xDD, 0xE2, // BIN 334: 16 pairs
-  0x16, 0x03, 0x81, 0x13, 0x7B, 0x2C, 0x44, 0x34, 0x4B, 0x35, 0x51, 0x36, 0x55, 0x3B, 0x46, 0x4E, 0x53, 0x52, 0x58, 0x54, 0x6D, 0x69, 0x92, 0x9F, 0xBF, 0xA3, 0xC4, 0xA9, 0xC7, 0xAA, 0xB7, 0xAE, 0xD7, 0xB7, 0xC0, 0xCB, 0xE6, 0xCC, 0xD2, 0xD2, 0xE5, 0xD3, 0xEB, 0xDE, 0xEE, // BIN 335: 22 pairs
-  0x12, 0x01, 0xEC, 0x10, 0x27, 0x1F, 0x32, 0x2F, 0x41, 0x3A, 0x50, 0x47, 0x81, 0x55, 0x61, 0x64, 0x8C, 0x81, 0xC5, 0x84, 0x95, 0x8A, 0xAA, 0x93, 0x94, 0x97, 0xC7, 0x98, 0xC8, 0x9D, 0xC2, 0xA7, 0xD4, 0xC3, 0xDE, 0xD8, 0xEB, // BIN 336: 18 pairs
-  0x0E, 0x00, 0x0B, 0x1C, 0x3D, 0x1F, 0x39, 0x21, 0x56, 0x49, 0x57, 0x4F, 0x68, 0x7E, 0x9F, 0x7F, 0x80, 0x99, 0xBA, 0x9A, 0xBA, 0x9B, 0xCF, 0xAA, 0xD7, 0xAE, 0xD8, 0xB4, 0xDD, // BIN 337: 14 pairs
-  0x0E, 0x1C, 0x3B, 0x1E, 0x3D, 0x20, 0x4F, 0x23, 0x3F, 0x26, 0x41, 0x2F, 0x4F, 0x30, 0x36, 0x6E, 0x99, 0x6E, 0x9A, 0x6E, 0x9C, 0x70, 0xA8, 0x95, 0xA4, 0xA2, 0xCA, 0xD4, 0xD6, // BIN 338: 14 pairs
-  0x10, 0x14, 0x39, 0x22, 0x29, 0x28, 0x2E, 0x2C, 0x39, 0x2F, 0x48, 0x37, 0x39, 0x45, 0x48, 0x4F, 0x6E, 0x63, 0x93, 0x7D, 0xA6, 0x89, 0x97, 0xA0, 0xA3, 0xA1, 0xC4, 0xAF, 0xD7, 0xC6, 0xDF, 0xD9, 0xEF, // BIN 339: 16 pairs
-  0x1A, 0x02, 0x07, 0x0E, 0x19, 0x12, 0x25, 0x13, 0x70, 0x16, 0x3C, 0x17, 0x3C, 0x25, 0x42, 0x2A, 0x3D, 0x2B, 0x42, 0x34, 0x49, 0x38, 0x4C, 0x39, 0x57, 0x41, 0x6D, 0x43, 0x66, 0x4E, 0x55, 0x6F, 0x76, 0x73, 0x77, 0x7B, 0xBE, 0x80, 0xA2, 0x97, 0xA5, 0x98, 0xA3, 0xAD, 0xC6, 0xBD, 0xDD, 0xBD, 0xEB, 0xBE, 0xF7, 0xD2, 0xE7, // BIN 340: 26 pairs
-  0x0D, 0x0A, 0x1D, 0x1B, 0x59, 0x1B, 0x69, 0x20, 0x66, 0x23, 0x3C, 0x4F, 0x6D, 0x58, 0x9E, 0x7A, 0xA6, 0xB7, 0xD7, 0xBB, 0xE0, 0xC1, 0xE2, 0xC6, 0xDB, 0xD9, 0xE6, // BIN 341: 13 pairs
-  0x0E, 0x10, 0x2B, 0x1D, 0x40, 0x2B, 0x52, 0x3C, 0x5C, 0x53, 0x5A, 0x5D, 0x7F, 0x5F, 0x93, 0x92, 0xC0, 0x98, 0xCA, 0xA6, 0xD4, 0xAC, 0xD4, 0xAF, 0xCE, 0xB1, 0xBB, 0xDE, 0xE8, // BIN 342: 14 pairs
-  0x0D, 0x01, 0x17, 0x20, 0x59, 0x5D, 0x7D, 0x5E, 0xB9, 0x63, 0x8F, 0x89, 0x8A, 0xA6, 0xBF, 0xB3, 0xFF, 0xB5, 0xD1, 0xB8, 0xBE, 0xC1, 0xE3, 0xE7, 0xEE, 0xEB, 0xF3, // BIN 343: 13 pairs
-  0x18, 0x08, 0x1E, 0x12, 0x24, 0x14, 0x1B, 0x23, 0x27, 0x24, 0x30, 0x29, 0x4C, 0x41, 0x55, 0x47, 0x6E, 0x4E, 0x62, 0x54, 0x68, 0x78, 0x7E, 0x84, 0xA6, 0x87, 0x9F, 0x90, 0xC7, 0x91, 0xA3, 0x93, 0xBB, 0xA0, 0xC4, 0xA4, 0xEA, 0xA6, 0xB7, 0xB7, 0xDA, 0xB9, 0xD4, 0xBF, 0xC9, 0xCA, 0xEA, 0xDB, 0xEA, // BIN 344: 24 pairs
-  0x0F, 0x05, 0x16, 0x0A, 0xFE, 0x19, 0xFF, 0x2C, 0x4B, 0x2C, 0x51, 0x2E, 0x33, 0x3F, 0x42, 0x52, 0x6B, 0x78, 0xA6, 0x87, 0x94, 0x8D, 0x98, 0x9F, 0xBB, 0xB2, 0xDB, 0xCE, 0xE3, 0xE4, 0xE5, // BIN 345: 15 pairs
-  0x0F, 0x03, 0x84, 0x0E, 0x1A, 0x1B, 0x6C, 0x25, 0x32, 0x50, 0x6B, 0x53, 0x61, 0x94, 0x99, 0x94, 0x9A, 0xA6, 0xD3, 0xAB, 0xB4, 0xAF, 0xC9, 0xB7, 0xD4, 0xBD, 0xD8, 0xD5, 0xEA, 0xDA, 0xEA, // BIN 346: 15 pairs
-  0x15, 0x13, 0x86, 0x15, 0x17, 0x1B, 0x84, 0x2C, 0x49, 0x33, 0x4D, 0x34, 0x39, 0x3F, 0x41, 0x4D, 0x51, 0x53, 0x5B, 0x5D, 0x6F, 0x68, 0x92, 0x6C, 0xAC, 0x79, 0x7F, 0xA4, 0xCF, 0xB5, 0xDC, 0xB9, 0xBA, 0xBD, 0xDA, 0xBE, 0xEC, 0xC8, 0xEA, 0xC9, 0xE0, 0xD3, 0xE8, // BIN 347: 21 pairs
-  0x0E, 0x05, 0x0D, 0x1C, 0x3A, 0x20, 0x5F, 0x21, 0x59, 0x25, 0x58, 0x26, 0x48, 0x27, 0x52, 0x44, 0x5A, 0x47, 0x84, 0x7F, 0x94, 0x95, 0xBD, 0xA7, 0xD3, 0xBC, 0xC4, 0xE6, 0xF5, // BIN 348: 14 pairs
-  0x14, 0x03, 0x04, 0x08, 0xE1, 0x12, 0x27, 0x2A, 0x40, 0x2E, 0x4E, 0x30, 0x4B, 0x4B, 0x4E, 0x80, 0x9B, 0x81, 0x95, 0x87, 0x88, 0x92, 0xBA, 0x96, 0xB8, 0xAE, 0xBC, 0xB4, 0xDF, 0xB7, 0xCC, 0xC0, 0xD2, 0xC3, 0xE1, 0xCE, 0xDA, 0xD0, 0xD6, 0xDE, 0xE0, // BIN 349: 20 pairs
-  0x1C, 0x02, 0xF5, 0x10, 0x24, 0x1E, 0x23, 0x1F, 0x3F, 0x3C, 0x4E, 0x44, 0x5C, 0x44, 0x60, 0x5D, 0x62, 0x67, 0x72, 0x75, 0xA0, 0x76, 0x8D, 0x7D, 0xAA, 0x7F, 0x8A, 0x80, 0x89, 0x83, 0x9F, 0x84, 0xAA, 0x86, 0x9D, 0x88, 0xA9, 0x92, 0xAE, 0x92, 0xC9, 0xAE, 0xBD, 0xCA, 0xEB, 0xD1, 0xED, 0xD2, 0xE8, 0xD6, 0xE3, 0xD8, 0xE7, 0xDC, 0xE1, 0xE2, 0xF2, // BIN 350: 28 pairs
-  0x0E, 0x15, 0x2A, 0x1B, 0x63, 0x1C, 0x28, 0x1C, 0x30, 0x27, 0x2D, 0x39, 0x59, 0x53, 0x57, 0x75, 0x95, 0x8B, 0xAD, 0x8F, 0xC9, 0x98, 0xCD, 0xB9, 0xEB, 0xD4, 0xE8, 0xEF, 0xFA, // BIN 351: 14 pairs
-  0x11, 0x0F, 0xF6, 0x1A, 0x35, 0x1E, 0x40, 0x32, 0x50, 0x33, 0x44, 0x38, 0x43, 0x3B, 0x64, 0x42, 0x5B, 0x45, 0x56, 0x77, 0xB3, 0x79, 0x8F, 0x85, 0xC6, 0x87, 0x9D, 0x99, 0xCF, 0x9A, 0xCF, 0xAA, 0xD5, 0xE9, 0xFD, // BIN 352: 17 pairs
-  0x11, 0x0E, 0x16, 0x0F, 0x41, 0x30, 0x49, 0x31, 0x4F, 0x3A, 0x4A, 0x55, 0x57, 0x5B, 0x74, 0x5F, 0x8F, 0x76, 0x96, 0x7F, 0xBD, 0x80, 0xA1, 0x82, 0xB9, 0x97, 0xBE, 0xA3, 0xA7, 0xA4, 0xCD, 0xC8, 0xEB, 0xCE, 0xD3, // BIN 353: 17 pairs
-  0x0E, 0x00, 0xF7, 0x1C, 0x2C, 0x20, 0x56, 0x28, 0x49, 0x32, 0x3B, 0x65, 0x70, 0x7E, 0x92, 0x8B, 0xAC, 0x8C, 0xC7, 0x99, 0xCD, 0x9A, 0xCD, 0xB0, 0xBB, 0xCE, 0xDB, 0xE9, 0xF2, // BIN 354: 14 pairs
-  0x14, 0x0D, 0x27, 0x11, 0x22, 0x24, 0x34, 0x27, 0x3A, 0x27, 0x46, 0x31, 0x46, 0x32, 0x52, 0x49, 0x51, 0x4B, 0x57, 0x4C, 0x66, 0x4D, 0x5F, 0x4D, 0x62, 0x4D, 0x63, 0x71, 0xB3, 0x7A, 0x80, 0x7A, 0xAA, 0x99, 0xC8, 0x9A, 0xC8, 0xB6, 0xE0, 0xCE, 0xD5, // BIN 355: 20 pairs
-  0x0C, 0x03, 0x66, 0x03, 0xAC, 0x15, 0x2D, 0x1C, 0x40, 0x3E, 0x59, 0x51, 0x65, 0x80, 0xA0, 0x81, 0xA6, 0x85, 0x94, 0x85, 0xC5, 0xB4, 0xD6, 0xB6, 0xD6, // BIN 356: 12 pairs
-  0x16, 0x06, 0x1E, 0x0B, 0x25, 0x13, 0x16, 0x13, 0x8C, 0x21, 0x2F, 0x30, 0x39, 0x3E, 0x5D, 0x47, 0x4B, 0x5F, 0x9C, 0x62, 0x74, 0x6D, 0x9B, 0x6F, 0x8A, 0x98, 0xCF, 0x9A, 0xA2, 0x9B, 0xD0, 0xA3, 0xB5, 0xA3, 0xBB, 0xA9, 0xB3, 0xB2, 0xDD, 0xC0, 0xEB, 0xD1, 0xF7, 0xE7, 0xED, // BIN 357: 22 pairs
-  0x14, 0x0A, 0x1C, 0x16, 0x2E, 0x1F, 0x3A, 0x28, 0x4B, 0x5B, 0x6F, 0x5C, 0x86, 0x5E, 0xAC, 0x75, 0xA1, 0x8B, 0xA4, 0x8F, 0xC0, 0x94, 0xBA, 0x95, 0xC0, 0x97, 0xAB, 0x99, 0xA2, 0xA2, 0xCC, 0xA2, 0xCD, 0xAC, 0xB6, 0xB0, 0xB8, 0xB4, 0xCE, 0xD3, 0xEA, // BIN 358: 20 pairs
-  0x0B, 0x3E, 0x57, 0x59, 0x82, 0x6C, 0xB9, 0x70, 0x73, 0x79, 0x89, 0x79, 0x98, 0x92, 0xB2, 0x97, 0x9E, 0x9D, 0xBC, 0xA7, 0xD7, 0xCA, 0xD6, // BIN 359: 11 pairs
-  0x0E, 0x02, 0x10, 0x05, 0x19, 0x0B, 0x2B, 0x55, 0x63, 0x63, 0x9C, 0x6C, 0x8B, 0x7D, 0xC6, 0x8F, 0xBB, 0x93, 0xCC, 0x99, 0xCA, 0x9A, 0xCA, 0xB1, 0xD3, 0xB2, 0xBC, 0xEE, 0xF1, // BIN 360: 14 pairs
-  0x14, 0x15, 0x2C, 0x24, 0x2C, 0x25, 0x52, 0x47, 0x7D, 0x4A, 0x59, 0x4C, 0x5E, 0x52, 0x6A, 0x61, 0x93, 0x6B, 0x90, 0x79, 0x7A, 0x7C, 0x92, 0x9C, 0xBA, 0x9C, 0xCF, 0xA4, 0xC8, 0xB2, 0xCE, 0xB7, 0xDB, 0xDD, 0xF4, 0xDF, 0xF4, 0xE2, 0xED, 0xE3, 0xF2, // BIN 361: 20 pairs
-  0x10, 0x03, 0x9C, 0x09, 0xF4, 0x27, 0x58, 0x2B, 0x32, 0x31, 0x41, 0x31, 0x48, 0x41, 0x45, 0x66, 0xB9, 0x6D, 0x8B, 0x74, 0x7C, 0x81, 0xAA, 0x8B, 0x8E, 0x96, 0x9F, 0xC2, 0xD2, 0xE1, 0xED, 0xE4, 0xE6, // BIN 362: 16 pairs
-  0x19, 0x19, 0x22, 0x1B, 0x61, 0x1B, 0xB9, 0x24, 0x52, 0x26, 0x4F, 0x38, 0x55, 0x61, 0x8F, 0x69, 0xAC, 0x78, 0xAA, 0x80, 0x85, 0x83, 0x8B, 0x8A, 0xAD, 0x9F, 0xC4, 0xA3, 0xA9, 0xA6, 0xD7, 0xA8, 0xD9, 0xA8, 0xF0, 0xBD, 0xDB, 0xC2, 0xE4, 0xC3, 0xE9, 0xC8, 0xD6, 0xCE, 0xD9, 0xD5, 0xE2, 0xE5, 0xF5, 0xED, 0xFE, // BIN 363: 25 pairs
-  0x0B, 0x1B, 0x43, 0x5D, 0x85, 0x66, 0xAC, 0x82, 0xA2, 0x92, 0xB6, 0x94, 0xBB, 0xA9, 0xD1, 0xAE, 0xC5, 0xB4, 0xBC, 0xBC, 0xDC, 0xBD, 0xDF, // BIN 364: 11 pairs
-  0x15, 0x02, 0xFB, 0x07, 0x14, 0x1C, 0x34, 0x24, 0x37, 0x31, 0x55, 0x49, 0x61, 0x4E, 0x65, 0x54, 0x62, 0x5D, 0x82, 0x6E, 0x7C, 0x75, 0xA7, 0x7A, 0xBD, 0x7D, 0xC5, 0x8E, 0x95, 0x91, 0xB5, 0x93, 0xA2, 0x9C, 0xCD, 0xA4, 0xCA, 0xB1, 0xC8, 0xB5, 0xD6, 0xB7, 0xC2, // BIN 365: 21 pairs
-  0x0C, 0x06, 0x11, 0x12, 0x2B, 0x14, 0x41, 0x3F, 0x56, 0x43, 0x69, 0x5B, 0x73, 0x8D, 0x92, 0x92, 0xB4, 0xB6, 0xCE, 0xC6, 0xF8, 0xD6, 0xDC, 0xE5, 0xEC, // BIN 366: 12 pairs
-  0x13, 0x02, 0xF2, 0x06, 0xE1, 0x1B, 0x75, 0x1F, 0x3E, 0x21, 0x49, 0x21, 0x5F, 0x36, 0x57, 0x37, 0x4D, 0x6A, 0x6F, 0x6F, 0x87, 0xA4, 0xBA, 0xA7, 0xBF, 0xAB, 0xC3, 0xB1, 0xB8, 0xB1, 0xCA, 0xB2, 0xD6, 0xB8, 0xE3, 0xEC, 0xFF, 0xF3, 0xFE, // BIN 367: 19 pairs
-  0x0F, 0x0D, 0x1D, 0x13, 0x77, 0x15, 0x18, 0x2F, 0x55, 0x44, 0x5B, 0x4C, 0x69, 0x5D, 0x81, 0x64, 0x73, 0x66, 0x92, 0x78, 0xB9, 0x8C, 0xA9, 0x90, 0xB8, 0x97, 0xC2, 0xAB, 0xB6, 0xBC, 0xD9, // BIN 368: 15 pairs
-  0x14, 0x0A, 0xF7, 0x23, 0x25, 0x29, 0x46, 0x2A, 0x2E, 0x2A, 0x4D, 0x2A, 0x4E, 0x46, 0x4A, 0x4E, 0x60, 0x5F, 0xA4, 0x60, 0x7B, 0x71, 0xBE, 0x74, 0x7E, 0x7E, 0xA2, 0x85, 0x8A, 0x8C, 0x91, 0x9C, 0xC8, 0xAC, 0xD7, 0xB2, 0xDF, 0xB4, 0xE0, 0xBE, 0xDC, // BIN 369: 20 pairs
-  0x16, 0x03, 0xEB, 0x0D, 0xE1, 0x17, 0x35, 0x1B, 0xA4, 0x1E, 0x32, 0x22, 0x31, 0x23, 0x45, 0x48, 0x6E, 0x52, 0x67, 0x53, 0x63, 0x55, 0x5F, 0x7C, 0x9F, 0x8A, 0xAE, 0x8C, 0x96, 0x96, 0xB0, 0x9D, 0xC1, 0xA2, 0xBD, 0xA2, 0xCF, 0xA2, 0xD0, 0xAE, 0xCE, 0xE8, 0xFB, 0xED, 0xF0, // BIN 370: 22 pairs
-  0x11, 0x05, 0xF7, 0x0C, 0x47, 0x2B, 0x5C, 0x56, 0x7A, 0x7E, 0x98, 0x8B, 0xAE, 0x8D, 0xA1, 0x91, 0x9F, 0xAD, 0xDA, 0xAE, 0xC6, 0xB9, 0xD7, 0xBE, 0xE9, 0xC1, 0xE5, 0xCD, 0xD6, 0xDC, 0xEF, 0xE2, 0xEE, 0xF4, 0xF5, // BIN 371: 17 pairs
-  0x11, 0x18, 0x35, 0x28, 0x4E, 0x33, 0x53, 0x5A, 0x74, 0x69, 0xB9, 0x6C, 0x9B, 0x6E, 0xA4, 0x6F, 0x73, 0x98, 0xD0, 0x99, 0xAD, 0x9A, 0xAD, 0x9D, 0xA3, 0xAB, 0xD2, 0xAF, 0xD6, 0xAF, 0xDA, 0xBC, 0xE2, 0xC5, 0xF8, // BIN 372: 17 pairs
-  0x0E, 0x0B, 0x1D, 0x14, 0x2F, 0x1D, 0x3A, 0x21, 0x54, 0x38, 0x44, 0x58, 0xA5, 0x5D, 0x84, 0x6A, 0x70, 0x7A, 0x8A, 0x93, 0xBA, 0xAC, 0xAD, 0xB1, 0xD8, 0xCE, 0xE7, 0xD9, 0xE2, // BIN 373: 14 pairs
-  0x13, 0x03, 0x6D, 0x0B, 0x11, 0x12, 0x22, 0x1A, 0xFF, 0x26, 0x53, 0x29, 0x53, 0x4B, 0x62, 0x51, 0x60, 0x51, 0x67, 0x58, 0x8C, 0x64, 0x88, 0x7A, 0x94, 0x87, 0xA3, 0x9C, 0xCA, 0xAC, 0xB4, 0xB0, 0xD3, 0xB8, 0xDE, 0xDE, 0xEC, 0xE0, 0xF3, // BIN 374: 19 pairs
-  0x0B, 0x00, 0x17, 0x20, 0x4C, 0x21, 0x66, 0x3A, 0x3B, 0x4B, 0x61, 0x4D, 0x4E, 0x76, 0x79, 0x8F, 0xAD, 0x9D, 0xB0, 0xA2, 0xC9, 0xAF, 0xBD, // BIN 375: 11 pairs
-  0x17, 0x08, 0xFA, 0x0B, 0xE1, 0x15, 0x30, 0x1D, 0x44, 0x1E, 0x44, 0x53, 0x5F, 0x57, 0x82, 0x63, 0x99, 0x63, 0x9A, 0x63, 0xA4, 0x69, 0x8B, 0x79, 0x85, 0x97, 0xD1, 0xA3, 0xC1, 0xA7, 0xB7, 0xAE, 0xDA, 0xB3, 0xC2, 0xB5, 0xDE, 0xC4, 0xCB, 0xDB, 0xE6, 0xDC, 0xE7, 0xE0, 0xF1, 0xE4, 0xFA, // BIN 376: 23 pairs
-  0x0B, 0x08, 0xFD, 0x1C, 0x1F, 0x20, 0x63, 0x31, 0x42, 0x4A, 0x62, 0x5F, 0x99, 0x5F, 0x9A, 0xA4, 0xD0, 0xA6, 0xD5, 0xAA, 0xB1, 0xD8, 0xEA, // BIN 377: 11 pairs
-  0x12, 0x00, 0xEE, 0x14, 0x29, 0x1C, 0x37, 0x25, 0x2D, 0x29, 0x35, 0x43, 0x68, 0x47, 0x7A, 0x49, 0x4E, 0x5A, 0x6F, 0x72, 0x97, 0x73, 0x91, 0x8D, 0xA0, 0xA7, 0xD5, 0xA9, 0xCE, 0xB0, 0xC8, 0xB8, 0xE4, 0xBA, 0xD6, 0xEC, 0xF2, // BIN 378: 18 pairs
-  0x0E, 0x06, 0xEC, 0x36, 0x59, 0x3A, 0x3E, 0x45, 0x5A, 0x56, 0x7D, 0x6F, 0x78, 0x8B, 0xA3, 0x99, 0xB6, 0x99, 0xD0, 0x9A, 0xB6, 0x9A, 0xD0, 0xA5, 0xC3, 0xB6, 0xBC, 0xEA, 0xFC, // BIN 379: 14 pairs
-  0x16, 0x07, 0xF9, 0x15, 0x1E, 0x21, 0x68, 0x25, 0x46, 0x2B, 0x46, 0x30, 0x3C, 0x34, 0x4D, 0x6E, 0x95, 0x6E, 0x9B, 0x6F, 0x8D, 0x8A, 0x93, 0x92, 0xAF, 0xAC, 0xB2, 0xB0, 0xCA, 0xB3, 0xDC, 0xB7, 0xE0, 0xC1, 0xC7, 0xC1, 0xD1, 0xCE, 0xDF, 0xCF, 0xD6, 0xDF, 0xE6, 0xE6, 0xEC, // BIN 380: 22 pairs
-  0x12, 0x15, 0x29, 0x20, 0x61, 0x28, 0x44, 0x39, 0x5D, 0x3A, 0x4B, 0x40, 0x5A, 0x47, 0x4A, 0x84, 0xC9, 0x88, 0xA5, 0x89, 0x9F, 0xA0, 0xD4, 0xA1, 0xB7, 0xA1, 0xD4, 0xA6, 0xB1, 0xAF, 0xC1, 0xB5, 0xD2, 0xC2, 0xE2, 0xE6, 0xF3, // BIN 381: 18 pairs
-  0x12, 0x00, 0x18, 0x03, 0x57, 0x06, 0x0E, 0x0B, 0x27, 0x10, 0xFF, 0x13, 0xC7, 0x20, 0x3E, 0x25, 0x3A, 0x2F, 0x54, 0x56, 0x78, 0x64, 0x9E, 0x72, 0x9E, 0x73, 0x7B, 0x74, 0x8E, 0x94, 0xB0, 0x98, 0xC4, 0x9D, 0xB3, 0xAD, 0xBC, // BIN 382: 18 pairs
-  0x16, 0x0D, 0x3B, 0x0E, 0x22, 0x11, 0x24, 0x15, 0x32, 0x1B, 0x56, 0x24, 0x28, 0x49, 0x5F, 0x4A, 0x57, 0x5A, 0x73, 0x61, 0x9C, 0x65, 0x77, 0x6A, 0x77, 0x6A, 0x88, 0x79, 0x9F, 0x7F, 0xC6, 0x82, 0xBD, 0x88, 0x9E, 0x8F, 0xBA, 0x95, 0xC5, 0xB1, 0xD5, 0xBF, 0xE2, 0xE0, 0xEA, // BIN 383: 22 pairs
-  0x0B, 0x00, 0x0D, 0x04, 0x20, 0x2D, 0x4A, 0x31, 0x4E, 0x43, 0x6C, 0x47, 0x53, 0x74, 0x91, 0x94, 0xB1, 0x96, 0xB1, 0xAA, 0xB0, 0xB5, 0xBF, // BIN 384: 11 pairs
-  0x12, 0x13, 0x64, 0x2A, 0x51, 0x37, 0x53, 0x54, 0x75, 0x56, 0x81, 0x68, 0x9B, 0x77, 0xBE, 0x7C, 0x98, 0x90, 0xD1, 0x92, 0xCC, 0x95, 0xC6, 0xA1, 0xBF, 0xB1, 0xD0, 0xC1, 0xE6, 0xC2, 0xE5, 0xC7, 0xF7, 0xD3, 0xE2, 0xEF, 0xFD, // BIN 385: 18 pairs
-  0x0C, 0x03, 0xC6, 0x05, 0x1A, 0x1C, 0x2A, 0x2E, 0x38, 0x2F, 0x46, 0x49, 0x63, 0x4C, 0x6C, 0x58, 0xFF, 0x5C, 0x73, 0x9B, 0xC4, 0xD9, 0xF0, 0xDF, 0xF3, // BIN 386: 12 pairs
-  0x11, 0x00, 0xF2, 0x1B, 0x7D, 0x29, 0x42, 0x2D, 0x3E, 0x34, 0x3C, 0x48, 0x75, 0x55, 0x6F, 0x60, 0x76, 0x70, 0x97, 0x75, 0xBD, 0x7F, 0xC5, 0x8A, 0xAF, 0x8D, 0xAE, 0x94, 0x9C, 0x9B, 0xA3, 0xAF, 0xC5, 0xB0, 0xD8, // BIN 387: 17 pairs
-  0x0E, 0x15, 0x34, 0x16, 0xF0, 0x21, 0x31, 0x31, 0x51, 0x33, 0x4C, 0x50, 0x6A, 0x5C, 0x67, 0x81, 0xC9, 0x82, 0x8D, 0x8D, 0xAB, 0xA1, 0xD3, 0xA6, 0xB0, 0xB2, 0xE0, 0xE3, 0xEF, // BIN 388: 14 pairs
-  0x14, 0x10, 0xF7, 0x10, 0xFD, 0x13, 0xD1, 0x19, 0x35, 0x1E, 0x2D, 0x23, 0x4E, 0x31, 0x35, 0x6E, 0x7E, 0x80, 0xA6, 0x86, 0xC7, 0x94, 0xB7, 0x95, 0xC9, 0x9D, 0xB1, 0xA0, 0xB7, 0xAA, 0xD8, 0xAC, 0xD3, 0xB7, 0xDD, 0xDB, 0xE5, 0xE0, 0xF4, 0xE8, 0xFC, // BIN 389: 20 pairs
-  0x0F, 0x03, 0x41, 0x04, 0x1B, 0x29, 0x41, 0x69, 0x9B, 0x74, 0x77, 0x8D, 0xA6, 0x90, 0xC3, 0x9C, 0xD0, 0xA0, 0xD3, 0xA2, 0xAC, 0xA3, 0xCE, 0xB7, 0xDF, 0xD9, 0xF7, 0xDE, 0xF2, 0xED, 0xF5, // BIN 390: 15 pairs
-  0x17, 0x0C, 0xFC, 0x20, 0x69, 0x28, 0x51, 0x2C, 0x4D, 0x58, 0x65, 0x6F, 0x8B, 0x70, 0xB3, 0x76, 0x77, 0x79, 0x9B, 0x88, 0xB3, 0x89, 0xA9, 0x8D, 0xAD, 0x99, 0xB4, 0x9A, 0xB4, 0xA8, 0xFF, 0xAF, 0xCB, 0xC3, 0xEC, 0xC7, 0xED, 0xCB, 0xD1, 0xD5, 0xE7, 0xDA, 0xE6, 0xDB, 0xF4, 0xE8, 0xF6, // BIN 391: 23 pairs
-  0x15, 0x08, 0x11, 0x20, 0x6D, 0x20, 0xF8, 0x2E, 0x51, 0x3C, 0x51, 0x4C, 0x6E, 0x62, 0x73, 0x64, 0x90, 0x6D, 0x98, 0x71, 0x97, 0x86, 0x91, 0x89, 0xA3, 0x99, 0xB2, 0x9A, 0xB2, 0x9C, 0xEA, 0xA0, 0xBF, 0xA8, 0xB5, 0xA8, 0xC2, 0xB1, 0xCD, 0xD1, 0xFF, 0xE2, 0xE9, // BIN 392: 21 pairs
-  0x0B, 0x08, 0x25, 0x0E, 0xFD, 0x21, 0x61, 0x2D, 0x3B, 0x31, 0x54, 0x45, 0x5B, 0x7A, 0xC6, 0x8C, 0xD1, 0x95, 0xB9, 0xAD, 0xDB, 0xCE, 0xDD, // BIN 393: 11 pairs
-  0x20, 0x0C, 0x41, 0x0F, 0x5E, 0x13, 0x19, 0x16, 0xF7, 0x1A, 0x3D, 0x1B, 0x4F, 0x21, 0x63, 0x22, 0x2F, 0x23, 0x2B, 0x2A, 0x43, 0x2B, 0x3A, 0x30, 0x4D, 0x37, 0x3C, 0x3A, 0x49, 0x4A, 0x5A, 0x56, 0x84, 0x7C, 0x8F, 0x7E, 0x8F, 0x83, 0xA3, 0x89, 0x90, 0x8D, 0xAF, 0x93, 0xAD, 0x93, 0xCF, 0xA5, 0xF7, 0xAB, 0xC4, 0xAE, 0xD6, 0xAF, 0xC6, 0xAF, 0xDB, 0xBB, 0xEA, 0xC1, 0xC4, 0xDD, 0xF6, 0xDF, 0xE5, // BIN 394: 32 pairs
-  0x10, 0x03, 0x75, 0x03, 0xC5, 0x08, 0x2B, 0x08, 0xEC, 0x15, 0x24, 0x15, 0x33, 0x21, 0x29, 0x22, 0x26, 0x29, 0x48, 0x2D, 0x50, 0x3B, 0x60, 0x56, 0x7F, 0x6E, 0x98, 0x75, 0xA6, 0x76, 0x80, 0xE4, 0xFF, // BIN 395: 16 pairs
-  0x18, 0x01, 0xE9, 0x03, 0x7D, 0x17, 0x23, 0x1D, 0x30, 0x29, 0x4F, 0x2B, 0x2D, 0x2D, 0x52, 0x3C, 0x64, 0x40, 0x45, 0x46, 0x4B, 0x4B, 0x5F, 0x57, 0x93, 0x6E, 0x8A, 0x79, 0xA2, 0x7C, 0x7F, 0x8B, 0xAF, 0x8D, 0x9B, 0x8F, 0xCC, 0x93, 0xC8, 0x93, 0xCD, 0xA2, 0xC5, 0xB3, 0xEC, 0xC5, 0xE0, 0xF1, 0xFA, // BIN 396: 24 pairs
-  0x13, 0x0B, 0x0E, 0x0F, 0x48, 0x21, 0x4D, 0x33, 0x43, 0x43, 0x6D, 0x4B, 0x63, 0x7C, 0xA2, 0x7D, 0x80, 0x8E, 0xA9, 0x91, 0xB8, 0x9D, 0xC7, 0x9E, 0xF7, 0xA9, 0xD9, 0xAD, 0xCE, 0xAE, 0xDB, 0xB0, 0xD5, 0xC7, 0xCB, 0xD8, 0xE6, 0xE1, 0xE3, // BIN 397: 19 pairs
-  0x11, 0x12, 0xFD, 0x2A, 0x44, 0x34, 0x53, 0x4E, 0x67, 0x4F, 0x75, 0x55, 0x6E, 0x5E, 0x92, 0x6F, 0x82, 0x72, 0xA5, 0x7A, 0xC5, 0x86, 0x96, 0x8B, 0xB2, 0x8C, 0xE1, 0x9C, 0xA2, 0xA8, 0xEF, 0xBD, 0xF8, 0xC7, 0xFF, // BIN 398: 17 pairs
-  0x1A, 0x03, 0x69, 0x03, 0x6C, 0x04, 0xEB, 0x1C, 0x33, 0x1C, 0x44, 0x3D, 0x45, 0x3D, 0x5A, 0x41, 0x6E, 0x41, 0x75, 0x44, 0x58, 0x47, 0x55, 0x61, 0x99, 0x61, 0x9A, 0x61, 0xA4, 0x63, 0x92, 0x6A, 0x89, 0x7B, 0x9D, 0x7D, 0x94, 0x83, 0x88, 0x88, 0x8E, 0x8E, 0xB0, 0x8F, 0x9F, 0xA3, 0xD2, 0xB0, 0xD0, 0xBF, 0xC5, 0xE2, 0xF3, // BIN 399: 26 pairs
-  0x10, 0x0B, 0xFD, 0x0F, 0xEA, 0x14, 0x31, 0x15, 0x26, 0x15, 0x37, 0x21, 0x4B, 0x2A, 0x4C, 0x32, 0x4A, 0x3E, 0x51, 0x73, 0x86, 0x83, 0x95, 0x85, 0xC9, 0xB3, 0xB5, 0xD1, 0xDE, 0xDD, 0xF3, 0xE5, 0xF3, // BIN 400: 16 pairs
-  0x16, 0x00, 0x16, 0x01, 0x1E, 0x04, 0xEA, 0x0C, 0xEA, 0x1D, 0x42, 0x20, 0x6C, 0x24, 0x33, 0x40, 0x5C, 0x79, 0xA1, 0x80, 0x93, 0x8A, 0x99, 0x8A, 0x9A, 0x92, 0xC8, 0x93, 0xCA, 0xA2, 0xC6, 0xA4, 0xD4, 0xB9, 0xD3, 0xC9, 0xF8, 0xCB, 0xD8, 0xCE, 0xD7, 0xD7, 0xE2, 0xDF, 0xF6, // BIN 401: 22 pairs
-  0x13, 0x03, 0x14, 0x03, 0xBD, 0x0D, 0x11, 0x14, 0x47, 0x28, 0x4D, 0x38, 0x4F, 0x5C, 0x8C, 0x65, 0x71, 0x72, 0xA8, 0x79, 0xA0, 0x80, 0xA7, 0x89, 0xAB, 0xA2, 0xD3, 0xA9, 0xB7, 0xAB, 0xD6, 0xC6, 0xE0, 0xD0, 0xE8, 0xDB, 0xDE, 0xE2, 0xF5, // BIN 402: 19 pairs
-  0x22, 0x03, 0x5F, 0x03, 0x99, 0x03, 0x9A, 0x0B, 0xFA, 0x10, 0x15, 0x14, 0x43, 0x1B, 0x9C, 0x1F, 0x45, 0x40, 0x5B, 0x45, 0x5D, 0x45, 0x62, 0x47, 0x85, 0x4A, 0x61, 0x4C, 0x68, 0x57, 0x9C, 0x64, 0x67, 0x67, 0x83, 0x6C, 0x98, 0x73, 0x8E, 0x95, 0xC8, 0x95, 0xCC, 0x96, 0xBC, 0x9F, 0xBC, 0xA0, 0xD7, 0xA1, 0xD7, 0xA4, 0xF8, 0xA5, 0xE4, 0xB1, 0xC0, 0xBD, 0xBF, 0xC2, 0xE6, 0xD8, 0xDE, 0xDA, 0xE5, 0xEE, 0xF0, 0xF1, 0xFD, // BIN 403: 34 pairs
-  0x12, 0x1D, 0x2C, 0x20, 0x54, 0x25, 0x5C, 0x2A, 0x53, 0x2C, 0x3C, 0x3C, 0x60, 0x3F, 0x40, 0x49, 0x62, 0x4A, 0x5B, 0x5B, 0x6B, 0x74, 0x79, 0x9F, 0xC0, 0xA8, 0xE4, 0xAD, 0xDD, 0xB3, 0xF7, 0xBC, 0xE3, 0xC9, 0xD2, 0xDD, 0xE6, // BIN 404: 18 pairs
-  0x11, 0x07, 0x0C, 0x1C, 0x42, 0x2D, 0x36, 0x39, 0x5F, 0x39, 0x61, 0x3D, 0x3F, 0x40, 0x60, 0x47, 0x7F, 0x4B, 0x5A, 0x50, 0x67, 0x59, 0x93, 0x71, 0xFF, 0x79, 0x7D, 0x7E, 0x7F, 0x87, 0x8B, 0x9B, 0xD4, 0xBF, 0xC2, // BIN 405: 17 pairs
-  0x0E, 0x07, 0x15, 0x0E, 0xFE, 0x1A, 0x40, 0x35, 0x3F, 0x3E, 0x61, 0x42, 0x60, 0x4C, 0x6D, 0x75, 0xAA, 0x7E, 0x91, 0x8F, 0xAE, 0x9A, 0xAE, 0xA3, 0xCB, 0xB0, 0xCD, 0xBB, 0xD6, // BIN 406: 14 pairs
-  0x10, 0x08, 0x1D, 0x42, 0x4A, 0x57, 0xA4, 0x6A, 0x83, 0x89, 0x94, 0x8F, 0xB6, 0x92, 0xCA, 0x94, 0xAB, 0x94, 0xAC, 0x99, 0xAE, 0x9C, 0xAD, 0xAC, 0xEB, 0xB1, 0xCF, 0xBF, 0xC6, 0xD8, 0xE5, 0xDA, 0xF4, // BIN 407: 16 pairs
-  0x19, 0x0A, 0x15, 0x14, 0x48, 0x18, 0x23, 0x23, 0x3B, 0x2F, 0x42, 0x33, 0x55, 0x46, 0x53, 0x4D, 0x5A, 0x75, 0x79, 0x75, 0x80, 0x7D, 0x8A, 0x7E, 0xA1, 0x8B, 0xBD, 0x8F, 0xB2, 0x91, 0xB0, 0x94, 0xC0, 0x9C, 0xB6, 0xAC, 0xAE, 0xAC, 0xD5, 0xB6, 0xB9, 0xBA, 0xCE, 0xBE, 0xC2, 0xCB, 0xE0, 0xDC, 0xF7, 0xDF, 0xF1, // BIN 408: 25 pairs
-  0x0E, 0x01, 0xE4, 0x05, 0x1E, 0x1D, 0x28, 0x1D, 0x34, 0x27, 0x5C, 0x36, 0x5D, 0x4C, 0x62, 0x64, 0xA5, 0x6D, 0xA0, 0x73, 0x7C, 0x95, 0xCA, 0xB7, 0xC9, 0xE3, 0xF7, 0xED, 0xF1, // BIN 409: 14 pairs
-  0x14, 0x11, 0x25, 0x16, 0x22, 0x20, 0x26, 0x56, 0x85, 0x5A, 0x6B, 0x6D, 0x95, 0x70, 0x74, 0x77, 0x9D, 0x86, 0xA9, 0x8B, 0xB4, 0x8E, 0x97, 0x8E, 0xB1, 0x93, 0xB6, 0xA3, 0xC8, 0xA5, 0xD9, 0xAC, 0xC4, 0xAC, 0xF8, 0xBF, 0xDE, 0xC4, 0xE2, 0xCB, 0xE7, // BIN 410: 20 pairs
-  0x11, 0x07, 0xFE, 0x08, 0x0E, 0x09, 0xFB, 0x1B, 0xEA, 0x2B, 0x64, 0x2F, 0x4E, 0x75, 0xC6, 0x7E, 0x9B, 0x83, 0x9D, 0x9E, 0xC3, 0x9F, 0xC8, 0xAF, 0xDD, 0xBC, 0xD8, 0xDA, 0xDE, 0xDB, 0xF3, 0xDE, 0xF1, 0xE7, 0xE9, // BIN 411: 17 pairs
-  0x1C, 0x05, 0x1D, 0x06, 0x1D, 0x11, 0x27, 0x1B, 0x39, 0x29, 0x4E, 0x2D, 0x4B, 0x30, 0x53, 0x3B, 0x4E, 0x44, 0x65, 0x46, 0x60, 0x59, 0x8F, 0x5F, 0x92, 0x70, 0xBE, 0x71, 0x73, 0x7A, 0x7C, 0x7E, 0xA0, 0x7E, 0xA3, 0x80, 0xA3, 0x87, 0x97, 0x8F, 0xB4, 0x92, 0xCD, 0x98, 0xB7, 0xAD, 0xD6, 0xAE, 0xC1, 0xAE, 0xDD, 0xB3, 0xE9, 0xB5, 0xE3, 0xCC, 0xD6, // BIN 412: 28 pairs
-  0x11, 0x01, 0x11, 0x01, 0xEE, 0x04, 0x21, 0x0C, 0xF4, 0x11, 0xFD, 0x15, 0x35, 0x2F, 0x51, 0x35, 0x45, 0x3D, 0x5C, 0x62, 0x79, 0x6A, 0x87, 0x72, 0x89, 0x7D, 0xC9, 0x8A, 0xB2, 0x8D, 0xAA, 0xA1, 0xB1, 0xAA, 0xDA, // BIN 413: 17 pairs
-  0x13, 0x00, 0xF5, 0x0D, 0x24, 0x10, 0x22, 0x13, 0x90, 0x26, 0x54, 0x2C, 0x53, 0x32, 0x3E, 0x4B, 0x5B, 0x68, 0x8B, 0x73, 0x7E, 0x86, 0xE1, 0x8B, 0xBB, 0x99, 0xD4, 0x9A, 0xD4, 0xA3, 0xCA, 0xA6, 0xD8, 0xB9, 0xD5, 0xBC, 0xE5, 0xE1, 0xEE, // BIN 414: 19 pairs
-  0x18, 0x01, 0xED, 0x03, 0x93, 0x0D, 0x58, 0x13, 0x1A, 0x1A, 0x58, 0x21, 0x4A, 0x24, 0x2A, 0x29, 0x3D, 0x29, 0x55, 0x37, 0x4C, 0x3E, 0x4E, 0x44, 0x64, 0x4D, 0x5B, 0x57, 0x8F, 0x64, 0x74, 0x6C, 0x95, 0x80, 0xAA, 0x8E, 0xAF, 0x92, 0xCF, 0x9F, 0xCA, 0xB0, 0xC0, 0xB1, 0xDA, 0xBB, 0xEB, 0xDE, 0xDF, // BIN 415: 24 pairs
-  0x12, 0x02, 0x06, 0x10, 0xFA, 0x1B, 0xF9, 0x26, 0x55, 0x31, 0x3D, 0x36, 0x3A, 0x3E, 0x5F, 0x51, 0x6A, 0x66, 0x9B, 0x78, 0xBD, 0x8B, 0xB6, 0x8C, 0xB8, 0x8E, 0xAE, 0x92, 0xA3, 0xA5, 0xB8, 0xB1, 0xD7, 0xCE, 0xD0, 0xF0, 0xFA, // BIN 416: 18 pairs
-  0x12, 0x07, 0xF4, 0x10, 0x3B, 0x5A, 0x5C, 0x75, 0xC5, 0x82, 0xC6, 0x83, 0xA2, 0x85, 0xA2, 0x96, 0xA8, 0x96, 0xC2, 0x99, 0xEA, 0x9A, 0xEA, 0xA9, 0xBE, 0xAD, 0xDF, 0xAF, 0xB5, 0xC2, 0xE9, 0xCA, 0xCE, 0xD1, 0xEE, 0xE3, 0xFA, // BIN 417: 18 pairs
-  0x14, 0x08, 0x27, 0x0D, 0x9E, 0x12, 0x2E, 0x16, 0x58, 0x1E, 0x3A, 0x1E, 0x42, 0x2D, 0x49, 0x44, 0x45, 0x60, 0x86, 0x61, 0x92, 0x62, 0x7C, 0x6D, 0xA1, 0x73, 0x90, 0x7F, 0xA2, 0xA7, 0xB1, 0xA7, 0xD8, 0xB8, 0xD6, 0xD6, 0xD9, 0xD7, 0xE7, 0xDD, 0xE5, // BIN 418: 20 pairs
-  0x16, 0x05, 0x1C, 0x06, 0x25, 0x14, 0x3E, 0x27, 0x30, 0x2F, 0x35, 0x2F, 0x56, 0x37, 0x55, 0x39, 0x63, 0x46, 0x49, 0x66, 0x8B, 0x6E, 0xAC, 0x74, 0x8D, 0x84, 0xC0, 0x8D, 0xA7, 0x93, 0xB2, 0x93, 0xB4, 0xA1, 0xB0, 0xA1, 0xD5, 0xC8, 0xCE, 0xCF, 0xE8, 0xD3, 0xE7, 0xE8, 0xEA, // BIN 419: 22 pairs
-  0x13, 0x0B, 0x3B, 0x13, 0x5C, 0x15, 0x2E, 0x1A, 0x44, 0x29, 0x51, 0x3D, 0x5B, 0x4D, 0x66, 0x56, 0x62, 0x62, 0x76, 0x68, 0xBD, 0x78, 0xA2, 0x82, 0xC5, 0x9C, 0xD4, 0xA4, 0xB6, 0xAF, 0xDF, 0xB0, 0xCF, 0xB2, 0xC1, 0xCE, 0xD4, 0xD7, 0xF4, // BIN 420: 19 pairs
-  0x1A, 0x00, 0x19, 0x07, 0xF3, 0x0E, 0x24, 0x1F, 0x21, 0x23, 0x51, 0x31, 0x40, 0x53, 0x6E, 0x59, 0x9C, 0x5B, 0x5C, 0x69, 0x98, 0x73, 0x8C, 0x82, 0x9F, 0x87, 0xAB, 0x8B, 0xBA, 0x93, 0xD0, 0x95, 0xCD, 0x9C, 0xB4, 0xA0, 0xD5, 0xA3, 0xC0, 0xAE, 0xCB, 0xB1, 0xCC, 0xB1, 0xD4, 0xB2, 0xCB, 0xB4, 0xCB, 0xB7, 0xB8, 0xF1, 0xF6, // BIN 421: 26 pairs
-  0x11, 0x19, 0x58, 0x1D, 0x37, 0x3D, 0x60, 0x43, 0x6E, 0x46, 0x55, 0x67, 0x87, 0x77, 0x91, 0x7C, 0x9B, 0x85, 0xC0, 0x8F, 0xC8, 0x91, 0xB1, 0x9B, 0xD3, 0x9D, 0xCB, 0xAE, 0xDF, 0xB4, 0xC1, 0xB8, 0xE1, 0xE2, 0xE4, // BIN 422: 17 pairs
-  0x12, 0x03, 0x48, 0x11, 0x23, 0x18, 0xFF, 0x1B, 0xAC, 0x21, 0x69, 0x29, 0x40, 0x37, 0x52, 0x61, 0x6F, 0x6C, 0xA0, 0x6D, 0xA7, 0x76, 0x90, 0x7A, 0x7E, 0x87, 0xA2, 0x90, 0xE1, 0x98, 0xBF, 0xA0, 0xB1, 0xCD, 0xE8, 0xEB, 0xFB, // BIN 423: 18 pairs
-  0x0E, 0x1B, 0x36, 0x1B, 0x7A, 0x1F, 0x35, 0x21, 0x3F, 0x3A, 0x4D, 0x7C, 0xA1, 0x8A, 0x91, 0x8D, 0x8F, 0x90, 0xB5, 0x94, 0xBD, 0x98, 0xD4, 0x9C, 0xB2, 0xBA, 0xEA, 0xE9, 0xFF, // BIN 424: 14 pairs
-  0x1F, 0x06, 0x2B, 0x07, 0x0E, 0x07, 0xF5, 0x09, 0xEA, 0x0F, 0x68, 0x22, 0x4E, 0x2D, 0x39, 0x34, 0x52, 0x3A, 0x53, 0x3A, 0x5A, 0x3E, 0x63, 0x4A, 0x5F, 0x4A, 0x63, 0x63, 0x8B, 0x67, 0x89, 0x6A, 0x71, 0x6C, 0x79, 0x6F, 0x89, 0x73, 0x96, 0x78, 0x8D, 0x7C, 0x85, 0x8D, 0xB0, 0x9E, 0xE4, 0xA2, 0xD4, 0xA7, 0xB0, 0xBD, 0xE0, 0xC3, 0xD6, 0xC3, 0xED, 0xD4, 0xF4, 0xE4, 0xFD, 0xEC, 0xFE, // BIN 425: 31 pairs
-  0x0C, 0x23, 0x36, 0x24, 0x4E, 0x30, 0x52, 0x4C, 0x51, 0x68, 0x98, 0x6E, 0xA0, 0x79, 0x93, 0x8C, 0xC3, 0x95, 0xB7, 0xB4, 0xB9, 0xDB, 0xF1, 0xDD, 0xF1, // BIN 426: 12 pairs
-  0x16, 0x01, 0x0E, 0x10, 0x2E, 0x20, 0x49, 0x34, 0x4C, 0x38, 0x54, 0x47, 0x78, 0x48, 0x81, 0x4D, 0x69, 0x57, 0x99, 0x57, 0x9A, 0x5D, 0x79, 0x65, 0x7B, 0x65, 0x88, 0x70, 0x76, 0x76, 0x7B, 0x76, 0x9D, 0x7C, 0xA0, 0x81, 0xC0, 0x86, 0xD1, 0x8B, 0xB9, 0xBC, 0xE6, 0xCB, 0xE4, // BIN 427: 22 pairs
-  0x17, 0x04, 0xF3, 0x0D, 0x0E, 0x0F, 0x57, 0x1B, 0x85, 0x20, 0x81, 0x32, 0x4B, 0x42, 0x5C, 0x5C, 0x74, 0x60, 0x88, 0x65, 0x6F, 0x6A, 0x7B, 0x7B, 0x91, 0x8D, 0x9D, 0x8F, 0xCA, 0x8F, 0xCD, 0x93, 0xAE, 0x95, 0xCF, 0x96, 0xC3, 0xA0, 0xB0, 0xA4, 0xD7, 0xC6, 0xF6, 0xC7, 0xDE, 0xD4, 0xE2, // BIN 428: 23 pairs
-  0x14, 0x00, 0xED, 0x03, 0x63, 0x05, 0x15, 0x23, 0x3E, 0x26, 0x46, 0x27, 0x34, 0x28, 0x43, 0x38, 0x48, 0x53, 0x6F, 0x5F, 0xB9, 0x7F, 0xC9, 0x8F, 0xCF, 0x96, 0xC1, 0x9B, 0xD7, 0xA4, 0xAD, 0xB0, 0xC3, 0xB0, 0xDA, 0xC3, 0xE5, 0xDC, 0xF0, 0xE7, 0xFB, // BIN 429: 20 pairs
-  0x1B, 0x02, 0x15, 0x03, 0x85, 0x03, 0xF4, 0x07, 0xF6, 0x15, 0x31, 0x19, 0x3D, 0x3F, 0x5D, 0x41, 0x81, 0x4D, 0x6E, 0x50, 0x70, 0x54, 0x78, 0x54, 0x7A, 0x55, 0x69, 0x5F, 0xAC, 0x60, 0x62, 0x6D, 0xBD, 0x76, 0x97, 0x87, 0x95, 0x8E, 0xAD, 0x95, 0xC4, 0x97, 0xC1, 0xAA, 0xDD, 0xAF, 0xE0, 0xB0, 0xD7, 0xBC, 0xD3, 0xC4, 0xE8, 0xDB, 0xF6, // BIN 430: 27 pairs
-  0x18, 0x0A, 0xFF, 0x0B, 0xEC, 0x15, 0x3A, 0x16, 0xEF, 0x18, 0x3D, 0x21, 0x6D, 0x22, 0x50, 0x37, 0x43, 0x39, 0x3A, 0x3F, 0x5A, 0x54, 0x6F, 0x59, 0xA4, 0x5C, 0x88, 0x67, 0x7C, 0x6C, 0xA1, 0x72, 0x91, 0x74, 0x7B, 0x84, 0x94, 0x8A, 0xB4, 0x9D, 0x9F, 0xC0, 0xD6, 0xC5, 0xF6, 0xCB, 0xDA, 0xD4, 0xF6, // BIN 431: 24 pairs
-  0x18, 0x00, 0xEF, 0x12, 0xFA, 0x1A, 0x23, 0x26, 0x47, 0x34, 0x55, 0x36, 0x5F, 0x37, 0x50, 0x46, 0x4D, 0x4F, 0x62, 0x50, 0x72, 0x69, 0x95, 0x76, 0x86, 0x7B, 0xC7, 0x7E, 0x85, 0x80, 0x99, 0x80, 0x9A, 0x98, 0xD3, 0x9D, 0xD1, 0xA4, 0xEB, 0xB1, 0xDB, 0xB6, 0xCB, 0xCA, 0xE8, 0xE9, 0xFE, 0xF2, 0xFC, // BIN 432: 24 pairs
-  0x15, 0x01, 0xBE, 0x17, 0x3D, 0x22, 0x3F, 0x2C, 0x4C, 0x30, 0x50, 0x34, 0x50, 0x36, 0x61, 0x39, 0x5E, 0x3E, 0x46, 0x3F, 0x44, 0x4D, 0x5E, 0x4E, 0x6A, 0x69, 0x79, 0x6E, 0xA1, 0x74, 0x96, 0x7C, 0x91, 0x8D, 0xB1, 0x94, 0xA4, 0xD7, 0xF6, 0xDA, 0xF3, 0xEB, 0xF1, // BIN 433: 21 pairs
-  0x13, 0x00, 0xEC, 0x0B, 0x24, 0x0F, 0xFC, 0x13, 0x2B, 0x15, 0x38, 0x16, 0x35, 0x1C, 0x46, 0x28, 0x53, 0x2F, 0x47, 0x33, 0x3C, 0x42, 0x4B, 0x63, 0x6F, 0x74, 0x80, 0x75, 0x8A, 0xA2, 0xA4, 0xB0, 0xCC, 0xBC, 0xC7, 0xCB, 0xDB, 0xEA, 0xF3, // BIN 434: 19 pairs
-  0x1C, 0x15, 0x2F, 0x19, 0xF0, 0x1D, 0x46, 0x20, 0x2F, 0x28, 0x4C, 0x31, 0x56, 0x52, 0x72, 0x5B, 0x76, 0x63, 0xAC, 0x68, 0xC6, 0x6C, 0x80, 0x6F, 0x8E, 0x7B, 0xE1, 0x85, 0xBB, 0x92, 0xD0, 0xA2, 0xD5, 0xA4, 0xB4, 0xAA, 0xDB, 0xAB, 0xBA, 0xAD, 0xB9, 0xB0, 0xD4, 0xB1, 0xC3, 0xB9, 0xF6, 0xCD, 0xCE, 0xCE, 0xE8, 0xE4, 0xF2, 0xE7, 0xF4, 0xE8, 0xF9, // BIN 435: 28 pairs
-  0x11, 0x03, 0x59, 0x0B, 0x1C, 0x0D, 0xA5, 0x10, 0xF0, 0x11, 0xFE, 0x21, 0x6C, 0x38, 0x41, 0x76, 0x8A, 0x8F, 0xAF, 0x97, 0xBC, 0xAC, 0xAF, 0xB2, 0xB9, 0xB6, 0xC1, 0xB9, 0xDD, 0xBE, 0xE3, 0xC1, 0xD8, 0xCB, 0xD3, // BIN 436: 17 pairs
-  0x0F, 0x0D, 0x1C, 0x0F, 0x43, 0x5C, 0x9E, 0x5E, 0x9B, 0x61, 0x8B, 0x68, 0xA0, 0x8E, 0x98, 0x91, 0xA8, 0x94, 0xC4, 0x95, 0xB1, 0x99, 0xAF, 0x9A, 0xAF, 0xBA, 0xBC, 0xD2, 0xE3, 0xDD, 0xDE, // BIN 437: 15 pairs
-  0x15, 0x02, 0xEE, 0x08, 0x9E, 0x0C, 0x48, 0x24, 0x58, 0x27, 0x2C, 0x27, 0x37, 0x32, 0x49, 0x48, 0x84, 0x55, 0x66, 0x56, 0x82, 0x75, 0x94, 0x79, 0xA6, 0x98, 0xB1, 0x9F, 0xCD, 0xA2, 0xD7, 0xA8, 0xDC, 0xAD, 0xE0, 0xAE, 0xE0, 0xBC, 0xD1, 0xC8, 0xE8, 0xCB, 0xD5, // BIN 438: 21 pairs
-  0x19, 0x01, 0x02, 0x03, 0x7A, 0x06, 0xE9, 0x0E, 0xFA, 0x1B, 0xF6, 0x1E, 0x50, 0x28, 0x3C, 0x29, 0x54, 0x2C, 0x43, 0x49, 0x5A, 0x58, 0x90, 0x62, 0x6E, 0x6C, 0xA7, 0x77, 0x96, 0x7B, 0x96, 0x8A, 0x9C, 0x8B, 0xC0, 0x8D, 0xB2, 0x95, 0xB0, 0x9E, 0xD9, 0xA3, 0xCD, 0xA6, 0xDA, 0xA7, 0xDA, 0xBA, 0xEB, 0xFB, 0xFD, // BIN 439: 25 pairs
-  0x17, 0x01, 0x9E, 0x05, 0xEE, 0x0F, 0x39, 0x19, 0xF7, 0x30, 0x4C, 0x32, 0x36, 0x46, 0x65, 0x48, 0x7D, 0x59, 0x99, 0x59, 0x9A, 0x63, 0xB9, 0x71, 0xE1, 0x7E, 0xA6, 0x94, 0xBF, 0x94, 0xC8, 0x95, 0xD0, 0x9B, 0xB7, 0x9B, 0xBF, 0x9F, 0xA9, 0xA4, 0xB2, 0xB7, 0xE2, 0xBC, 0xD5, 0xF1, 0xF9, // BIN 440: 23 pairs
-  0x16, 0x0F, 0x36, 0x11, 0x2B, 0x14, 0x2A, 0x17, 0x32, 0x20, 0x75, 0x2B, 0xFF, 0x34, 0x43, 0x40, 0x58, 0x47, 0xA4, 0x69, 0xA0, 0x6B, 0x9E, 0x6D, 0x79, 0x7E, 0x96, 0x89, 0x8C, 0x99, 0xD7, 0x9A, 0xD7, 0xA3, 0xD0, 0xB7, 0xDE, 0xC1, 0xE4, 0xD4, 0xF8, 0xDA, 0xF6, 0xF7, 0xFE, // BIN 441: 22 pairs
-  0x17, 0x0A, 0xEF, 0x0F, 0xF4, 0x12, 0x3B, 0x17, 0xFF, 0x19, 0x40, 0x1B, 0x93, 0x20, 0x84, 0x21, 0x5D, 0x26, 0x35, 0x2A, 0x55, 0x2E, 0x58, 0x3F, 0x47, 0x41, 0x84, 0x4E, 0x5C, 0x52, 0x62, 0x53, 0x69, 0x7A, 0xC9, 0x7D, 0xC0, 0x82, 0xAD, 0x9C, 0xAE, 0xA2, 0xD2, 0xBB, 0xCE, 0xC9, 0xF6, // BIN 442: 23 pairs
-  0x14, 0x06, 0x27, 0x09, 0xEB, 0x26, 0x56, 0x54, 0x7D, 0x5D, 0x8F, 0x68, 0xA7, 0x68, 0xC5, 0x6E, 0x94, 0x76, 0x8C, 0x8A, 0xB6, 0x98, 0xB0, 0xA2, 0xBC, 0xA9, 0xDC, 0xB9, 0xC4, 0xC4, 0xEB, 0xD5, 0xE6, 0xD5, 0xF4, 0xDC, 0xF2, 0xDD, 0xF8, 0xE0, 0xF6, // BIN 443: 20 pairs
-  0x10, 0x02, 0x17, 0x06, 0xEE, 0x0A, 0x25, 0x14, 0x15, 0x1B, 0x99, 0x1B, 0x9A, 0x1D, 0x2A, 0x45, 0x59, 0x53, 0x66, 0x81, 0x94, 0x84, 0xCC, 0x9F, 0xCC, 0xBC, 0xE0, 0xCC, 0xF8, 0xE3, 0xE8, 0xE3, 0xF1, // BIN 444: 16 pairs
-  0x17, 0x03, 0xC9, 0x0C, 0x5E, 0x0C, 0xEB, 0x0E, 0x23, 0x15, 0x1A, 0x1B, 0x4C, 0x1F, 0x49, 0x24, 0x38, 0x25, 0x64, 0x42, 0x65, 0x49, 0x66, 0x4D, 0x6C, 0x5F, 0x8B, 0x7A, 0xA2, 0x84, 0xBB, 0x8A, 0x96, 0xA3, 0xD3, 0xA5, 0xEC, 0xAA, 0xD2, 0xAD, 0xC1, 0xD4, 0xE7, 0xF0, 0xFD, 0xF3, 0xF8, // BIN 445: 23 pairs
-  0x1B, 0x03, 0x61, 0x0D, 0x3C, 0x10, 0x3C, 0x13, 0x3B, 0x13, 0xEC, 0x18, 0x40, 0x1A, 0x32, 0x1B, 0x7F, 0x25, 0x30, 0x30, 0x55, 0x3F, 0x5B, 0x50, 0x71, 0x52, 0x70, 0x55, 0x6C, 0x68, 0xA1, 0x69, 0x80, 0x7C, 0xA3, 0x87, 0xA9, 0x8B, 0xC5, 0x8B, 0xC6, 0x94, 0xCA, 0x9D, 0xBE, 0x9F, 0xD0, 0xB0, 0xDB, 0xB1, 0xE0, 0xB5, 0xBE, 0xC3, 0xEF, // BIN 446: 27 pairs
-  0x16, 0x0D, 0xFD, 0x11, 0x2E, 0x1B, 0x54, 0x1C, 0x38, 0x23, 0x4A, 0x2F, 0x3D, 0x36, 0x63, 0x3A, 0x5B, 0x42, 0x53, 0x48, 0x7A, 0x74, 0x86, 0x78, 0xC6, 0x80, 0x84, 0x88, 0xBE, 0x98, 0xD7, 0x9C, 0xD7, 0x9E, 0xB8, 0x9F, 0xB5, 0xA3, 0xC2, 0xAC, 0xDD, 0xAE, 0xB5, 0xCE, 0xCF, // BIN 447: 22 pairs
-  0x17, 0x01, 0xA5, 0x05, 0xEF, 0x0B, 0x9E, 0x18, 0x32, 0x1D, 0x33, 0x1F, 0x4A, 0x26, 0x42, 0x3D, 0x58, 0x46, 0x5C, 0x49, 0x5B, 0x61, 0x79, 0x63, 0x79, 0x6D, 0x80, 0x77, 0x89, 0x79, 0xA7, 0x7F, 0xC0, 0x99, 0x9F, 0x9A, 0x9F, 0xB8, 0xE9, 0xBC, 0xDA, 0xD2, 0xDC, 0xDA, 0xF1, 0xFC, 0xFE, // BIN 448: 23 pairs
-  0x0E, 0x00, 0x1A, 0x0D, 0xFA, 0x0E, 0x25, 0x17, 0x40, 0x29, 0x2E, 0x2E, 0x5C, 0x6E, 0xB9, 0xAA, 0xDF, 0xBE, 0xED, 0xC3, 0xE6, 0xCC, 0xE8, 0xD5, 0xDE, 0xD8, 0xF4, 0xF8, 0xFB, // BIN 449: 14 pairs
-  0x12, 0x0F, 0x66, 0x10, 0xEF, 0x13, 0xE4, 0x20, 0x4D, 0x22, 0x52, 0x23, 0x39, 0x2C, 0x55, 0x33, 0x4F, 0x39, 0x66, 0x41, 0x7D, 0x49, 0x5E, 0x4F, 0x7A, 0x62, 0x7E, 0x69, 0xA1, 0x6D, 0xC6, 0x86, 0x89, 0x9D, 0xA5, 0xC3, 0xE2, // BIN 450: 18 pairs
-  0x14, 0x02, 0xF1, 0x06, 0xFE, 0x08, 0xA5, 0x0E, 0x27, 0x12, 0xF7, 0x20, 0x5D, 0x66, 0x98, 0x67, 0x7E, 0x6F, 0x7F, 0x73, 0x8D, 0x78, 0xC5, 0x91, 0x94, 0x91, 0xBC, 0x93, 0x9F, 0x9B, 0xD5, 0x9F, 0xCF, 0xA4, 0xD3, 0xA5, 0xA9, 0xAD, 0xCB, 0xD9, 0xE7, // BIN 451: 20 pairs
-  0x19, 0x06, 0xED, 0x08, 0xBE, 0x17, 0x2D, 0x1F, 0x43, 0x27, 0x4E, 0x2F, 0x40, 0x3A, 0x55, 0x3B, 0x51, 0x45, 0x47, 0x47, 0x9C, 0x56, 0x6F, 0x58, 0x6A, 0x73, 0x79, 0x7B, 0xFF, 0x81, 0xCC, 0x82, 0xC9, 0x84, 0x8A, 0x8F, 0xD0, 0x99, 0xC4, 0x99, 0xD3, 0x9A, 0xC4, 0x9A, 0xD3, 0xA7, 0xDD, 0xD7, 0xF8, 0xDD, 0xF9, // BIN 452: 25 pairs
-  0x0F, 0x0A, 0xF0, 0x1C, 0x29, 0x27, 0x64, 0x30, 0x43, 0x3B, 0x71, 0x54, 0x7F, 0x6F, 0x7A, 0x82, 0xBB, 0x94, 0xC9, 0xA3, 0xCF, 0xB8, 0xD2, 0xC1, 0xE0, 0xCF, 0xF8, 0xD5, 0xE5, 0xE2, 0xEC, // BIN 453: 15 pairs
-  0x16, 0x01, 0x25, 0x08, 0x3B, 0x14, 0xF9, 0x1D, 0x1F, 0x25, 0xFF, 0x2C, 0x52, 0x4C, 0x4E, 0x54, 0x81, 0x59, 0x6F, 0x5A, 0x76, 0x68, 0x95, 0x6D, 0xA6, 0x93, 0xEA, 0x94, 0xCC, 0x9C, 0xF8, 0xA3, 0xCC, 0xAC, 0xD8, 0xB1, 0xDE, 0xB3, 0xE3, 0xB9, 0xDA, 0xE5, 0xFA, 0xE6, 0xFA, // BIN 454: 22 pairs
-  0x12, 0x01, 0xFE, 0x07, 0x0F, 0x08, 0xE9, 0x0D, 0xEC, 0x0F, 0xEB, 0x13, 0x25, 0x19, 0x44, 0x1E, 0x58, 0x4F, 0x7D, 0x51, 0x54, 0x67, 0x88, 0x69, 0x6F, 0x6C, 0x6F, 0x6E, 0xA7, 0x7C, 0x7D, 0x81, 0xBB, 0x85, 0xCC, 0x95, 0xBF, // BIN 455: 18 pairs
-  0x1A, 0x03, 0x7F, 0x05, 0xF2, 0x06, 0xE4, 0x11, 0xFA, 0x12, 0xFF, 0x14, 0x28, 0x1E, 0x30, 0x1E, 0x46, 0x25, 0x34, 0x30, 0x3B, 0x3F, 0x59, 0x42, 0x49, 0x4F, 0x81, 0x67, 0x70, 0x67, 0x79, 0x6C, 0xBD, 0x6D, 0xC5, 0x82, 0xC0, 0x8E, 0xA1, 0xA1, 0xD8, 0xA3, 0xB8, 0xA6, 0xDD, 0xAC, 0xDA, 0xB7, 0xBD, 0xBC, 0xDB, 0xC4, 0xEA, // BIN 456: 26 pairs
-  0x12, 0x01, 0x2B, 0x02, 0x18, 0x0E, 0x1F, 0x12, 0xFE, 0x1E, 0xFF, 0x23, 0x50, 0x2A, 0x4F, 0x2D, 0x4D, 0x43, 0x75, 0x46, 0x62, 0x5C, 0x90, 0x69, 0xA7, 0x80, 0x81, 0x93, 0xD4, 0xA2, 0xD8, 0xDF, 0xF8, 0xE3, 0xF0, 0xE7, 0xFE, // BIN 457: 18 pairs
-  0x17, 0x0A, 0x27, 0x0D, 0xBE, 0x11, 0x1F, 0x12, 0x3C, 0x21, 0x45, 0x32, 0x39, 0x36, 0x5E, 0x3F, 0x62, 0x49, 0x69, 0x53, 0x6C, 0x57, 0xB9, 0x5D, 0x93, 0x63, 0x9B, 0x70, 0xFF, 0x79, 0x84, 0x7D, 0xA2, 0x7E, 0xA7, 0x7F, 0xBB, 0x94, 0xC5, 0x96, 0xB7, 0xA0, 0xD8, 0xBF, 0xE8, 0xC7, 0xEE, // BIN 458: 23 pairs
-  0x16, 0x01, 0x1D, 0x0F, 0xB9, 0x13, 0x72, 0x1B, 0x5D, 0x61, 0xAC, 0x73, 0x97, 0x74, 0x90, 0x7C, 0xA6, 0x86, 0xB8, 0x86, 0xFF, 0x88, 0xB8, 0x8D, 0xB4, 0x93, 0xAF, 0x94, 0x96, 0xB0, 0xDE, 0xB0, 0xE0, 0xB7, 0xC5, 0xC2, 0xEC, 0xCB, 0xDF, 0xCB, 0xE9, 0xD0, 0xE2, 0xDF, 0xF9, // BIN 459: 22 pairs
-  0x13, 0x15, 0x19, 0x1A, 0x50, 0x20, 0x4B, 0x22, 0x45, 0x31, 0x47, 0x4B, 0x66, 0x51, 0x5C, 0x58, 0x88, 0x60, 0x8C, 0x64, 0x76, 0x72, 0x96, 0x72, 0x9D, 0x75, 0x7C, 0x94, 0xC6, 0x96, 0xA2, 0xA6, 0xDB, 0xA7, 0xDB, 0xB9, 0xD8, 0xB9, 0xDF, // BIN 460: 19 pairs
-  0x13, 0x07, 0x11, 0x18, 0x2D, 0x21, 0xF8, 0x2C, 0x50, 0x33, 0x52, 0x4C, 0x75, 0x6A, 0x86, 0x79, 0x99, 0x79, 0x9A, 0x7D, 0xBB, 0x80, 0x91, 0x81, 0xEA, 0x8B, 0xC9, 0x92, 0xC4, 0x9F, 0xD2, 0xB1, 0xDD, 0xB1, 0xDF, 0xB5, 0xE4, 0xFA, 0xFB, // BIN 461: 19 pairs
-  0x19, 0x02, 0x08, 0x0A, 0x24, 0x0C, 0x36, 0x12, 0x23, 0x14, 0xF8, 0x1D, 0x50, 0x1F, 0x4B, 0x22, 0x51, 0x41, 0x7A, 0x42, 0x55, 0x47, 0x93, 0x54, 0x84, 0x5A, 0x64, 0x5E, 0x8B, 0x5E, 0xBD, 0x5F, 0x6F, 0x6B, 0xA5, 0x80, 0xAD, 0x83, 0xAB, 0x85, 0xBA, 0x8A, 0xAB, 0x9E, 0xEC, 0xA3, 0xD6, 0xC1, 0xE7, 0xC5, 0xD2, // BIN 462: 25 pairs
-  0x14, 0x08, 0xE4, 0x0B, 0x58, 0x26, 0x4E, 0x27, 0x28, 0x31, 0x44, 0x45, 0x57, 0x4F, 0x78, 0x5B, 0x64, 0x61, 0x62, 0x71, 0x74, 0x7B, 0xA9, 0x81, 0x8A, 0x84, 0xEA, 0x94, 0xCD, 0x98, 0xD5, 0xB5, 0xE2, 0xC2, 0xED, 0xC4, 0xDE, 0xCF, 0xF6, 0xE4, 0xE7, // BIN 463: 20 pairs
-  0x1A, 0x0B, 0xA5, 0x0C, 0x39, 0x15, 0x27, 0x19, 0x23, 0x23, 0x52, 0x25, 0x2C, 0x2B, 0x30, 0x2E, 0x31, 0x34, 0x3B, 0x3E, 0x5E, 0x40, 0x65, 0x55, 0x5E, 0x61, 0xB9, 0x6B, 0x89, 0x6D, 0xAA, 0x80, 0x9C, 0x8C, 0xFF, 0x8E, 0xA0, 0x8E, 0xB7, 0x9C, 0xD3, 0x9D, 0xB7, 0xA2, 0xB9, 0xA4, 0xAE, 0xBD, 0xF6, 0xC1, 0xD3, 0xC2, 0xE1, // BIN 464: 26 pairs
-  0x0E, 0x25, 0x37, 0x40, 0x64, 0x53, 0x5E, 0x58, 0xA8, 0x79, 0xAA, 0x7A, 0xC0, 0x7D, 0x7E, 0xA6, 0xD2, 0xB9, 0xF9, 0xCC, 0xF6, 0xD1, 0xE5, 0xD3, 0xDE, 0xD5, 0xF6, 0xE7, 0xEC, // BIN 465: 14 pairs
-  0x1A, 0x0A, 0x2B, 0x20, 0x31, 0x20, 0xF9, 0x21, 0x53, 0x26, 0x51, 0x2A, 0x3C, 0x2A, 0x41, 0x3B, 0x6B, 0x3B, 0x70, 0x3E, 0x42, 0x4F, 0x84, 0x5C, 0xA5, 0x5D, 0x80, 0x67, 0x77, 0x6F, 0x94, 0x71, 0xF0, 0x75, 0xC9, 0x79, 0x81, 0x79, 0xA3, 0x8A, 0xB0, 0x9F, 0xD3, 0xB9, 0xDB, 0xD3, 0xE6, 0xE3, 0xF5, 0xE3, 0xFD, 0xF5, 0xF6, // BIN 466: 26 pairs
-  0x13, 0x06, 0x1C, 0x1B, 0x6E, 0x2A, 0x48, 0x4D, 0x6D, 0x52, 0x71, 0x55, 0x67, 0x5F, 0x9B, 0x66, 0xA0, 0x74, 0x8C, 0x7E, 0xAA, 0x8E, 0xA6, 0x91, 0xC2, 0x9F, 0xBD, 0x9F, 0xC1, 0xB7, 0xC6, 0xBF, 0xE5, 0xBF, 0xE6, 0xCD, 0xF8, 0xE8, 0xEE, // BIN 467: 19 pairs
-  0x16, 0x07, 0x1F, 0x08, 0x1C, 0x1A, 0x2D, 0x1A, 0xF0, 0x1E, 0x2C, 0x2B, 0x60, 0x3F, 0x57, 0x59, 0x62, 0x64, 0xA8, 0x72, 0xB3, 0x7B, 0xD1, 0x85, 0xAD, 0x86, 0xC3, 0x89, 0xA2, 0x90, 0xC2, 0x91, 0xA2, 0x9F, 0xC9, 0xA4, 0xD5, 0xA7, 0xEA, 0xC3, 0xF0, 0xDE, 0xF5, 0xE7, 0xEB, // BIN 468: 22 pairs
-  0x18, 0x02, 0x0B, 0x10, 0x13, 0x10, 0xFE, 0x1E, 0x34, 0x24, 0x51, 0x29, 0x44, 0x2B, 0x4E, 0x2D, 0x53, 0x38, 0x3C, 0x4B, 0x5E, 0x4B, 0x69, 0x59, 0x92, 0x62, 0x80, 0x65, 0x86, 0x6A, 0x7C, 0x6B, 0x97, 0x6C, 0xA6, 0x7B, 0x89, 0x82, 0xAE, 0x8E, 0x92, 0x97, 0xD9, 0xAE, 0xB9, 0xC1, 0xDA, 0xE9, 0xF5, // BIN 469: 24 pairs
-  0x17, 0x00, 0xE9, 0x00, 0xF0, 0x08, 0x24, 0x18, 0x44, 0x24, 0x5C, 0x37, 0x3B, 0x42, 0x4D, 0x45, 0x52, 0x57, 0xAC, 0x63, 0x80, 0x66, 0x95, 0x7C, 0x93, 0x7C, 0x96, 0x7E, 0x93, 0x8A, 0xB1, 0x8A, 0xBA, 0x8D, 0xB7, 0x9D, 0x9E, 0xBF, 0xE7, 0xC1, 0xD5, 0xC6, 0xD2, 0xCE, 0xD1, 0xEE, 0xF3, // BIN 470: 23 pairs
-  0x10, 0x37, 0x5A, 0x3E, 0x66, 0x4D, 0x68, 0x54, 0x85, 0x5D, 0x7C, 0x7F, 0x8D, 0x80, 0xAE, 0x83, 0x97, 0xA9, 0xAF, 0xAB, 0xBB, 0xAC, 0xDB, 0xAC, 0xDF, 0xB2, 0xB5, 0xCF, 0xF4, 0xD3, 0xF4, 0xD8, 0xF3, // BIN 471: 16 pairs
-  0x15, 0x05, 0xFF, 0x16, 0x3D, 0x1F, 0x2E, 0x28, 0x55, 0x32, 0x4D, 0x33, 0x50, 0x38, 0x52, 0x66, 0xBD, 0x69, 0xBD, 0x72, 0x87, 0x7D, 0xCC, 0x82, 0xBA, 0x87, 0x90, 0x8E, 0xB2, 0x94, 0xCF, 0x9C, 0xAF, 0xBC, 0xCA, 0xC0, 0xF8, 0xDC, 0xFA, 0xF2, 0xF4, 0xF5, 0xF9, // BIN 472: 21 pairs
-  0x15, 0x0C, 0x43, 0x12, 0x35, 0x20, 0x29, 0x23, 0x4B, 0x2B, 0x34, 0x33, 0x48, 0x40, 0x4A, 0x47, 0xB9, 0x48, 0x7F, 0x49, 0x6E, 0x55, 0x6D, 0x61, 0x80, 0x96, 0xAF, 0x9C, 0xC4, 0x9F, 0xCE, 0xA6, 0xAB, 0xA7, 0xDF, 0xA8, 0xEC, 0xB1, 0xE2, 0xBC, 0xC8, 0xC6, 0xF9, // BIN 473: 21 pairs
-  0x1B, 0x05, 0xF0, 0x06, 0x9E, 0x08, 0xEE, 0x0B, 0xBE, 0x20, 0x7D, 0x23, 0x49, 0x38, 0x5A, 0x3B, 0xFF, 0x54, 0x5A, 0x54, 0x5B, 0x5E, 0xC6, 0x75, 0x7E, 0x78, 0x9F, 0x7C, 0xA7, 0x8A, 0xBB, 0x91, 0xC3, 0x9B, 0xB1, 0xA3, 0xD5, 0xA4, 0xC4, 0xBB, 0xBC, 0xC1, 0xDB, 0xC4, 0xE7, 0xC6, 0xF4, 0xC9, 0xF4, 0xCB, 0xDD, 0xD0, 0xF8, 0xD6, 0xF1, // BIN 474: 27 pairs
-  0x18, 0x0F, 0x5F, 0x1A, 0x42, 0x21, 0x2A, 0x25, 0x4E, 0x32, 0x5A, 0x33, 0x54, 0x47, 0x82, 0x4B, 0x6E, 0x4F, 0x7F, 0x6E, 0xA6, 0x6F, 0x75, 0x77, 0xC7, 0x82, 0x83, 0x97, 0xE1, 0x99, 0xD5, 0x9A, 0xD5, 0xA6, 0xDF, 0xB0, 0xDD, 0xB0, 0xDF, 0xB8, 0xE5, 0xC5, 0xF4, 0xCC, 0xCE, 0xE7, 0xFA, 0xED, 0xFF, // BIN 475: 24 pairs
-  0x16, 0x00, 0x1E, 0x08, 0xED, 0x0C, 0x68, 0x15, 0x25, 0x17, 0x44, 0x21, 0x38, 0x27, 0x33, 0x44, 0x6B, 0x49, 0x6C, 0x57, 0x92, 0x5D, 0x8B, 0x5F, 0x79, 0x84, 0xA2, 0x8D, 0xB6, 0xA5, 0xE9, 0xA8, 0xF7, 0xAA, 0xAB, 0xAA, 0xEA, 0xC5, 0xF9, 0xD0, 0xF6, 0xD3, 0xE5, 0xE0, 0xF5, // BIN 476: 22 pairs
-  0x19, 0x02, 0xF3, 0x06, 0xBE, 0x1A, 0xF7, 0x20, 0x4A, 0x29, 0x56, 0x32, 0x53, 0x36, 0x66, 0x3D, 0x4A, 0x3D, 0x64, 0x66, 0xA1, 0x6C, 0x7C, 0x6C, 0x8A, 0x6C, 0xC6, 0x7A, 0xBB, 0x84, 0xBA, 0x8C, 0xF0, 0x9C, 0xEB, 0x9E, 0xA9, 0xAF, 0xC2, 0xB1, 0xC9, 0xBD, 0xD2, 0xC3, 0xD2, 0xCD, 0xF6, 0xD0, 0xF4, 0xE6, 0xFE, // BIN 477: 25 pairs
-  0x18, 0x00, 0x07, 0x05, 0xEC, 0x0C, 0x57, 0x19, 0xEF, 0x1E, 0x28, 0x1E, 0x52, 0x33, 0x41, 0x37, 0x4F, 0x48, 0x78, 0x52, 0x73, 0x5E, 0x98, 0x61, 0x9B, 0x68, 0xA6, 0x71, 0x76, 0x89, 0x8B, 0x8A, 0xAC, 0x94, 0xD0, 0x96, 0xB3, 0xB8, 0xBF, 0xB8, 0xEC, 0xC7, 0xCE, 0xCA, 0xE2, 0xD7, 0xE6, 0xFA, 0xFF, // BIN 478: 24 pairs
-  0x12, 0x01, 0x27, 0x05, 0xF5, 0x0B, 0x3C, 0x26, 0x3D, 0x2C, 0x3B, 0x48, 0x85, 0x66, 0xA7, 0x6F, 0x95, 0x77, 0xE1, 0x7F, 0xAD, 0x84, 0xCF, 0x91, 0xC1, 0x97, 0xCB, 0xA3, 0xD8, 0xB3, 0xC1, 0xB4, 0xB5, 0xB8, 0xE2, 0xF3, 0xFD, // BIN 479: 18 pairs
-  0x0A, 0x0E, 0x2B, 0x35, 0x5A, 0x39, 0x69, 0x73, 0x80, 0x83, 0x98, 0x9B, 0xB0, 0x9D, 0xCE, 0xA1, 0xDA, 0xBA, 0xCB, 0xBC, 0xD0, // BIN 480: 10 pairs
-  0x14, 0x00, 0x15, 0x00, 0x1D, 0x09, 0x47, 0x13, 0x27, 0x1B, 0x3E, 0x1E, 0x37, 0x27, 0xFF, 0x34, 0x5A, 0x38, 0x56, 0x58, 0xBE, 0x6C, 0xAA, 0x8C, 0xB5, 0x8E, 0xB5, 0xA0, 0xDA, 0xB5, 0xC4, 0xB5, 0xE5, 0xC9, 0xD6, 0xCC, 0xF4, 0xD8, 0xF1, 0xD8, 0xF6, // BIN 481: 20 pairs
-  0x16, 0x08, 0x58, 0x19, 0x32, 0x2B, 0x37, 0x35, 0x5C, 0x39, 0x51, 0x3D, 0x65, 0x4C, 0x5A, 0x5E, 0xC5, 0x6D, 0x6F, 0x81, 0xF8, 0x82, 0xB2, 0x88, 0xC7, 0x8F, 0xA3, 0x96, 0xCB, 0x97, 0xB0, 0xA5, 0xDC, 0xAD, 0xB5, 0xB0, 0xE2, 0xB7, 0xC3, 0xC1, 0xE9, 0xDB, 0xF8, 0xF3, 0xFA, // BIN 482: 22 pairs
-  0x20, 0x00, 0xFB, 0x02, 0xFC, 0x0E, 0x2E, 0x13, 0x18, 0x14, 0x38, 0x16, 0x40, 0x18, 0xF7, 0x1B, 0xC6, 0x20, 0xB9, 0x53, 0x6D, 0x58, 0xF0, 0x5C, 0x76, 0x62, 0x63, 0x65, 0x89, 0x66, 0x79, 0x6A, 0x7E, 0x6C, 0xC5, 0x73, 0x9D, 0x77, 0xA9, 0x79, 0x91, 0x7F, 0xBA, 0x7F, 0xCC, 0x86, 0xF0, 0x92, 0xD4, 0xA9, 0xBF, 0xBC, 0xD7, 0xC0, 0xCE, 0xC8, 0xE2, 0xCB, 0xD7, 0xCB, 0xED, 0xCD, 0xE2, 0xE1, 0xFA, // BIN 483: 32 pairs
-  0x19, 0x07, 0xF1, 0x0D, 0x2E, 0x0F, 0x59, 0x0F, 0x81, 0x11, 0x35, 0x20, 0xA4, 0x2B, 0x2C, 0x36, 0x51, 0x39, 0x68, 0x3A, 0x4C, 0x47, 0x99, 0x47, 0x9A, 0x5B, 0x72, 0x6B, 0xA8, 0x6D, 0x8A, 0x71, 0xC7, 0x84, 0xCD, 0x8B, 0xCC, 0x93, 0xD7, 0x9C, 0xD5, 0xA7, 0xD2, 0xBC, 0xDF, 0xCD, 0xF4, 0xCE, 0xE4, 0xE5, 0xFE, // BIN 484: 25 pairs
-  0x0C, 0x21, 0x81, 0x2E, 0x3F, 0x4F, 0x51, 0x68, 0xAA, 0x69, 0x7C, 0x6F, 0x85, 0x7C, 0xAA, 0x83, 0x92, 0x94, 0xB9, 0x95, 0xAB, 0xE9, 0xF1, 0xF2, 0xF7, // BIN 485: 12 pairs
-  0x11, 0x00, 0xFF, 0x02, 0xF7, 0x05, 0xED, 0x06, 0xA5, 0x21, 0x75, 0x26, 0x40, 0x3E, 0x62, 0x42, 0x58, 0x45, 0x61, 0x54, 0x82, 0x63, 0x98, 0x77, 0xFF, 0x81, 0xCF, 0x88, 0xB5, 0x9F, 0xAC, 0xA8, 0xE9, 0xD1, 0xE6, // BIN 486: 17 pairs
-  0x14, 0x03, 0x43, 0x03, 0x8F, 0x03, 0xFC, 0x06, 0x3B, 0x1F, 0x24, 0x1F, 0x41, 0x29, 0x47, 0x38, 0x50, 0x4B, 0x6C, 0x4C, 0x5B, 0x4D, 0x6F, 0x50, 0x62, 0x69, 0xA6, 0x7F, 0x9F, 0x81, 0xBA, 0xCF, 0xE2, 0xD0, 0xE7, 0xD3, 0xF6, 0xD7, 0xF3, 0xDA, 0xF8, // BIN 487: 20 pairs
-  0x16, 0x00, 0x1C, 0x05, 0x07, 0x06, 0x24, 0x09, 0x1F, 0x0F, 0x6D, 0x13, 0x6B, 0x3C, 0x5A, 0x41, 0x7F, 0x4F, 0x85, 0x5D, 0x92, 0x5E, 0xA0, 0x62, 0x83, 0x66, 0xC6, 0x82, 0xB6, 0x84, 0xC8, 0x84, 0xF8, 0x8A, 0xB7, 0x8E, 0xAA, 0x93, 0xC4, 0x97, 0xA3, 0xA2, 0xCE, 0xDB, 0xF9, // BIN 488: 22 pairs
-  0x16, 0x0F, 0xA4, 0x25, 0x28, 0x42, 0x62, 0x4A, 0x66, 0x5D, 0x9C, 0x70, 0x9D, 0x70, 0xE1, 0x74, 0x97, 0x78, 0xC9, 0x80, 0xAF, 0x81, 0xA2, 0x82, 0xB4, 0x85, 0xCF, 0x8B, 0xC8, 0x99, 0xF8, 0x9A, 0xF8, 0x9C, 0x9F, 0xA8, 0xC1, 0xD4, 0xF9, 0xD5, 0xF3, 0xE0, 0xF2, 0xE7, 0xFC, // BIN 489: 22 pairs
-  0x1C, 0x09, 0x41, 0x0C, 0xB9, 0x14, 0x3F, 0x19, 0x50, 0x1F, 0x20, 0x30, 0x5A, 0x34, 0x4F, 0x41, 0x85, 0x4E, 0x54, 0x58, 0xB3, 0x59, 0xB9, 0x63, 0x95, 0x79, 0x9C, 0x7B, 0xF0, 0x7D, 0xBA, 0x85, 0x8D, 0x85, 0x9F, 0x85, 0xC8, 0x8A, 0xA4, 0x8E, 0x9B, 0x96, 0xAE, 0xA3, 0xD4, 0xB0, 0xC9, 0xB3, 0xED, 0xB6, 0xEA, 0xBA, 0xC1, 0xC9, 0xE8, 0xD7, 0xE5, // BIN 490: 28 pairs
-  0x15, 0x01, 0xD1, 0x10, 0x35, 0x14, 0x33, 0x14, 0x4F, 0x1A, 0x3A, 0x1B, 0xC5, 0x1C, 0x31, 0x1F, 0x3D, 0x1F, 0x46, 0x2E, 0x45, 0x44, 0x4A, 0x59, 0x8B, 0x5A, 0x72, 0x69, 0x8A, 0x6F, 0x92, 0x74, 0x8A, 0x81, 0xCD, 0x85, 0xCD, 0xA3, 0xC9, 0xD7, 0xF9, 0xE8, 0xED, // BIN 491: 21 pairs
-  0x1D, 0x0A, 0xEE, 0x0B, 0xE9, 0x1B, 0xBD, 0x2A, 0x54, 0x2B, 0x71, 0x37, 0x5B, 0x38, 0x5B, 0x3E, 0x69, 0x49, 0x68, 0x64, 0xFF, 0x69, 0xC6, 0x6A, 0x8C, 0x7E, 0xAD, 0x80, 0x96, 0x84, 0xCA, 0x8D, 0xA9, 0x8E, 0xB4, 0x9B, 0xD8, 0x9D, 0xD9, 0x9F, 0xC5, 0xAA, 0xE0, 0xBC, 0xE7, 0xC0, 0xE8, 0xC3, 0xEE, 0xD7, 0xDE, 0xD9, 0xFF, 0xE0, 0xE3, 0xE6, 0xFD, 0xEC, 0xF5, // BIN 492: 29 pairs
-  0x13, 0x03, 0x56, 0x13, 0x1E, 0x16, 0x44, 0x1B, 0xEB, 0x28, 0x4F, 0x2E, 0x2F, 0x33, 0x5A, 0x42, 0x64, 0x55, 0x68, 0x58, 0x73, 0x59, 0xAC, 0x7A, 0x8D, 0xA2, 0xDA, 0xC9, 0xF9, 0xCA, 0xF8, 0xCB, 0xE8, 0xD2, 0xD9, 0xD5, 0xF8, 0xE5, 0xFD, // BIN 493: 19 pairs
-  0x19, 0x0A, 0x22, 0x14, 0x4C, 0x14, 0xFC, 0x15, 0x16, 0x17, 0x3A, 0x27, 0x2A, 0x2C, 0x4F, 0x2F, 0x44, 0x36, 0x46, 0x36, 0x4E, 0x5B, 0x5D, 0x5E, 0xA7, 0x6D, 0x7C, 0x6E, 0xAA, 0x85, 0xB6, 0x90, 0xAB, 0x91, 0xB7, 0x93, 0xD3, 0x95, 0xD3, 0x95, 0xD4, 0xA3, 0xD7, 0xA4, 0xAF, 0xAC, 0xBF, 0xB8, 0xE6, 0xBC, 0xDD, // BIN 494: 25 pairs
-  0x17, 0x07, 0xF8, 0x17, 0xF7, 0x1F, 0x42, 0x21, 0x55, 0x24, 0x29, 0x27, 0x51, 0x2F, 0x57, 0x35, 0x4A, 0x39, 0x4E, 0x46, 0x67, 0x5E, 0xF8, 0x65, 0x83, 0x66, 0x80, 0x66, 0xC5, 0x6D, 0x94, 0x85, 0xCA, 0x88, 0xAB, 0x8B, 0xCA, 0x8F, 0xD4, 0x97, 0xB1, 0xBC, 0xCD, 0xC4, 0xE6, 0xC8, 0xF8, // BIN 495: 23 pairs
-  0x19, 0x0F, 0x4F, 0x0F, 0x84, 0x1D, 0x38, 0x1D, 0x52, 0x27, 0x60, 0x2E, 0x60, 0x35, 0x58, 0x49, 0x6D, 0x56, 0x93, 0x59, 0x79, 0x5F, 0x80, 0x68, 0xF8, 0x6C, 0x94, 0x81, 0xC8, 0x82, 0x8E, 0x82, 0xCC, 0x9E, 0xE9, 0x9F, 0xCB, 0xA0, 0xDD, 0xA1, 0xAB, 0xA1, 0xDD, 0xA5, 0xC2, 0xAF, 0xB9, 0xCA, 0xCB, 0xEA, 0xFB, // BIN 496: 25 pairs
-  0x19, 0x01, 0xB3, 0x08, 0xFE, 0x13, 0xE9, 0x14, 0x49, 0x1B, 0x78, 0x20, 0x3F, 0x32, 0x5B, 0x3C, 0x65, 0x3C, 0x6B, 0x47, 0x8F, 0x4A, 0x5E, 0x52, 0x74, 0x6C, 0x7E, 0x70, 0x91, 0x78, 0x83, 0x7E, 0xAE, 0x89, 0x95, 0x8D, 0x93, 0x9F, 0xC6, 0xA9, 0xAE, 0xB5, 0xB6, 0xB5, 0xE6, 0xC2, 0xE7, 0xCB, 0xD0, 0xFD, 0xFF, // BIN 497: 25 pairs
-  0x1A, 0x0B, 0xE4, 0x25, 0x60, 0x39, 0x6C, 0x44, 0x6A, 0x4A, 0x69, 0x53, 0x68, 0x5E, 0xA1, 0x5F, 0x98, 0x68, 0xC9, 0x6F, 0x7D, 0x6F, 0x8F, 0x75, 0xC0, 0x78, 0xAD, 0x7A, 0xCC, 0x82, 0xAF, 0x85, 0xB2, 0x8F, 0xC4, 0x91, 0xAF, 0x99, 0xEB, 0x9A, 0xEB, 0x9F, 0xD5, 0xA6, 0xEA, 0xBC, 0xD4, 0xC2, 0xC4, 0xC7, 0xE5, 0xC8, 0xCB, // BIN 498: 26 pairs
-  0x13, 0x18, 0x3A, 0x21, 0x84, 0x2F, 0x59, 0x37, 0x54, 0x44, 0x67, 0x56, 0x8F, 0x5D, 0x99, 0x5D, 0x9A, 0x61, 0x7C, 0x63, 0x7C, 0x69, 0xAA, 0x69, 0xC5, 0x85, 0xAE, 0x88, 0x8D, 0x8E, 0x90, 0xA9, 0xD6, 0xAB, 0xDE, 0xDE, 0xF3, 0xE0, 0xF9, // BIN 499: 19 pairs
-  0x1F, 0x02, 0xED, 0x0F, 0x69, 0x15, 0x3D, 0x1F, 0x4C, 0x1F, 0x4D, 0x2D, 0x55, 0x2D, 0x5A, 0x3B, 0x65, 0x41, 0x78, 0x45, 0x50, 0x50, 0x73, 0x53, 0x67, 0x5A, 0x5D, 0x60, 0x90, 0x65, 0x87, 0x66, 0x6F, 0x78, 0xC0, 0x7E, 0x99, 0x7E, 0x9A, 0x81, 0xCA, 0x89, 0xB0, 0x92, 0xB7, 0x92, 0xD3, 0x98, 0xD8, 0x9B, 0xEA, 0x9F, 0xD4, 0xAB, 0xD3, 0xB6, 0xEB, 0xC1, 0xDF, 0xC4, 0xE5, 0xDA, 0xF9, // BIN 500: 31 pairs
-  0x14, 0x0C, 0x66, 0x18, 0xF0, 0x1C, 0x26, 0x1C, 0x50, 0x28, 0x41, 0x35, 0x5B, 0x3F, 0x52, 0x40, 0x4B, 0x43, 0x81, 0x4A, 0x6E, 0x71, 0x9D, 0x74, 0x9D, 0x78, 0xBB, 0x85, 0xB4, 0x87, 0xB0, 0x8E, 0xA7, 0x96, 0xC7, 0xA4, 0xDD, 0xDF, 0xFC, 0xEE, 0xFF, // BIN 501: 20 pairs
-  0x15, 0x14, 0x2C, 0x1A, 0x52, 0x20, 0xF6, 0x28, 0x48, 0x34, 0x5B, 0x3F, 0x61, 0x4F, 0x6F, 0x50, 0x77, 0x67, 0x80, 0x6A, 0x79, 0x72, 0xBE, 0x7C, 0x99, 0x7C, 0x9A, 0x83, 0xA9, 0x88, 0xC3, 0xA1, 0xDB, 0xAB, 0xC8, 0xCA, 0xF6, 0xD2, 0xEB, 0xD6, 0xED, 0xE8, 0xF8, // BIN 502: 21 pairs
-  0x0F, 0x16, 0xFD, 0x19, 0x2D, 0x20, 0x7A, 0x25, 0x33, 0x28, 0x52, 0x30, 0x4F, 0x39, 0x46, 0x43, 0x51, 0x5D, 0x7E, 0x6E, 0x8D, 0x72, 0x83, 0xA0, 0xDB, 0xC0, 0xF6, 0xCB, 0xD4, 0xE8, 0xFE, // BIN 503: 15 pairs
-  0x15, 0x0A, 0xEC, 0x0F, 0x26, 0x0F, 0x63, 0x11, 0x2D, 0x13, 0x17, 0x16, 0xE1, 0x21, 0x28, 0x4E, 0x64, 0x5E, 0x95, 0x68, 0x79, 0x7A, 0xAD, 0x7A, 0xBA, 0x7D, 0xAD, 0x91, 0xB3, 0xAB, 0xCA, 0xAC, 0xF6, 0xCE, 0xE9, 0xD4, 0xF3, 0xD9, 0xFA, 0xDD, 0xFC, 0xE7, 0xFD, // BIN 504: 21 pairs
-  0x15, 0x0D, 0x71, 0x17, 0xFD, 0x1A, 0x5C, 0x1B, 0x8F, 0x1F, 0x40, 0x32, 0x55, 0x35, 0x60, 0x3D, 0x4B, 0x43, 0x62, 0x46, 0x4C, 0x47, 0xAC, 0x61, 0x95, 0x61, 0x98, 0x65, 0x8C, 0x6A, 0x90, 0x6A, 0x91, 0x6B, 0x91, 0x8B, 0xCD, 0xA9, 0xD2, 0xAB, 0xD9, 0xD4, 0xE6, // BIN 505: 21 pairs
-  0x10, 0x0F, 0x6C, 0x21, 0x33, 0x26, 0x57, 0x2E, 0x64, 0x2F, 0x5D, 0x3E, 0x5A, 0x5F, 0x62, 0x5F, 0x95, 0x69, 0x7E, 0xA0, 0xAB, 0xA3, 0xBD, 0xA9, 0xDE, 0xB3, 0xCB, 0xB9, 0xF4, 0xBC, 0xE4, 0xC8, 0xF6, // BIN 506: 16 pairs
-  0x12, 0x0B, 0x2E, 0x12, 0xF0, 0x18, 0x58, 0x2D, 0x4C, 0x3C, 0x5B, 0x45, 0x5F, 0x67, 0x71, 0x75, 0xA2, 0x7C, 0x84, 0x7D, 0xCF, 0x92, 0xD7, 0x9D, 0xAF, 0xAB, 0xC7, 0xB8, 0xED, 0xCA, 0xF4, 0xD3, 0xF8, 0xD9, 0xF2, 0xEB, 0xF5, // BIN 507: 18 pairs
-  0x16, 0x02, 0x16, 0x03, 0xCC, 0x0F, 0x56, 0x10, 0x23, 0x1F, 0x48, 0x20, 0x6E, 0x28, 0x50, 0x36, 0x69, 0x37, 0x48, 0x45, 0x63, 0x58, 0xE1, 0x84, 0xAD, 0x84, 0xD0, 0x87, 0x98, 0x89, 0xB5, 0xA1, 0xD2, 0xA2, 0xC1, 0xAE, 0xC2, 0xBC, 0xCF, 0xBD, 0xF9, 0xBE, 0xEE, 0xDF, 0xF5, // BIN 508: 22 pairs
-  0x12, 0x02, 0x1C, 0x0B, 0xEE, 0x18, 0xFD, 0x36, 0x68, 0x39, 0x6D, 0x4B, 0x6D, 0x4E, 0x6B, 0x57, 0x6F, 0x63, 0xA0, 0x68, 0x80, 0x6D, 0xC9, 0x7F, 0xAE, 0x92, 0xBF, 0x9F, 0xD7, 0xAB, 0xD8, 0xD5, 0xF1, 0xE3, 0xFE, 0xEF, 0xFE, // BIN 509: 18 pairs
-  0x0B, 0x0C, 0x26, 0x14, 0xF6, 0x15, 0x2B, 0x4B, 0x68, 0x70, 0x89, 0x7D, 0xCD, 0x83, 0xA1, 0x90, 0xD9, 0x98, 0xAB, 0xA0, 0xEA, 0xCF, 0xE7, // BIN 510: 11 pairs
-  0x1C, 0x00, 0xF1, 0x09, 0xF3, 0x0C, 0x1F, 0x16, 0x23, 0x18, 0x42, 0x19, 0x42, 0x1C, 0x2F, 0x1E, 0x33, 0x28, 0x2B, 0x2B, 0x51, 0x30, 0x5B, 0x33, 0x3B, 0x3E, 0x6C, 0x42, 0x67, 0x4C, 0x6F, 0x5D, 0xA4, 0x7D, 0xC8, 0x7E, 0xAF, 0x7F, 0xB6, 0x82, 0xA3, 0x8B, 0xCF, 0x9B, 0xDA, 0x9E, 0xDC, 0xA4, 0xF6, 0xBA, 0xE8, 0xBD, 0xF4, 0xC8, 0xF4, 0xCD, 0xE7, // BIN 511: 28 pairs
-  0x1F, 0x01, 0xC7, 0x0B, 0xED, 0x11, 0x3C, 0x17, 0x42, 0x1B, 0x49, 0x20, 0xEA, 0x26, 0x2E, 0x2C, 0x5A, 0x33, 0x5B, 0x34, 0x54, 0x3E, 0x68, 0x43, 0x7D, 0x4C, 0x7A, 0x51, 0x6B, 0x66, 0xA6, 0x67, 0x7B, 0x69, 0x94, 0x6B, 0x87, 0x6D, 0x7E, 0x77, 0xD1, 0x7F, 0xB2, 0x80, 0xB2, 0x87, 0xB1, 0x89, 0xB1, 0x91, 0xAE, 0x9F, 0xD8, 0xA2, 0xB5, 0xC3, 0xF7, 0xCB, 0xEC, 0xD6, 0xE9, 0xE0, 0xF8, // BIN 512: 31 pairs
-  0x1B, 0x03, 0x4F, 0x11, 0x32, 0x11, 0x3B, 0x1A, 0xEF, 0x1E, 0x2A, 0x28, 0x3B, 0x2A, 0x52, 0x2B, 0x70, 0x3C, 0x71, 0x43, 0x84, 0x46, 0x64, 0x47, 0xF8, 0x56, 0x9C, 0x64, 0xB3, 0x7A, 0x9F, 0x7B, 0xB8, 0x8B, 0xB7, 0x8E, 0xB6, 0xA5, 0xB5, 0xA7, 0xAB, 0xB4, 0xEA, 0xB6, 0xE2, 0xBE, 0xC1, 0xC1, 0xDD, 0xCA, 0xE7, 0xDC, 0xE8, 0xE4, 0xFE, // BIN 513: 27 pairs
-  0x0F, 0x08, 0x3C, 0x0C, 0xFB, 0x0F, 0x61, 0x1A, 0x46, 0x20, 0x9C, 0x2C, 0x48, 0x52, 0x77, 0x57, 0x8B, 0x8E, 0xBC, 0xA0, 0xD2, 0xA4, 0xD8, 0xA4, 0xDA, 0xBB, 0xE8, 0xC1, 0xD7, 0xC1, 0xED, // BIN 514: 15 pairs
-  0x1E, 0x01, 0x1C, 0x01, 0x3B, 0x02, 0x0D, 0x08, 0xB3, 0x0D, 0xE4, 0x13, 0xD9, 0x17, 0x30, 0x37, 0x41, 0x3A, 0x43, 0x43, 0x7A, 0x46, 0x58, 0x4A, 0x6C, 0x4E, 0x4F, 0x71, 0xD1, 0x7D, 0xEA, 0x7F, 0xC8, 0x80, 0xA4, 0x81, 0xD0, 0x8A, 0xBD, 0x8A, 0xC0, 0x8C, 0xC2, 0x8D, 0x99, 0x8D, 0x9A, 0x90, 0xF0, 0x90, 0xFF, 0x95, 0xD7, 0xA2, 0xDB, 0xB7, 0xE5, 0xCE, 0xED, 0xD6, 0xE4, // BIN 515: 30 pairs
-  0x14, 0x0D, 0xE9, 0x12, 0xEF, 0x1D, 0x29, 0x20, 0x53, 0x20, 0x85, 0x24, 0x31, 0x31, 0x57, 0x55, 0x75, 0x70, 0x96, 0x7D, 0xCA, 0x7E, 0x84, 0x7F, 0xB4, 0x83, 0xA0, 0x85, 0xD0, 0xA0, 0xDF, 0xA1, 0xDF, 0xA1, 0xEA, 0xBB, 0xCB, 0xC1, 0xCA, 0xCB, 0xCD, // BIN 516: 20 pairs
-  0x1B, 0x0B, 0xFE, 0x0D, 0xB3, 0x0E, 0x35, 0x25, 0x51, 0x26, 0x59, 0x27, 0x38, 0x2C, 0x41, 0x31, 0x5D, 0x3E, 0x5B, 0x40, 0x53, 0x46, 0x6A, 0x51, 0x6F, 0x62, 0x6B, 0x63, 0xA1, 0x68, 0xEA, 0x79, 0xAD, 0x7C, 0x81, 0x7F, 0xCF, 0x8B, 0xB0, 0x8B, 0xB1, 0x93, 0xF8, 0x96, 0xAD, 0xA8, 0xE3, 0xB4, 0xE2, 0xD4, 0xE5, 0xE0, 0xFC, 0xE6, 0xFB, // BIN 517: 27 pairs
-  0x19, 0x02, 0x19, 0x03, 0xC0, 0x14, 0x57, 0x15, 0x40, 0x16, 0x50, 0x16, 0xFA, 0x17, 0xF0, 0x23, 0x4D, 0x31, 0x59, 0x34, 0x48, 0x44, 0x4B, 0x5F, 0xA0, 0x6A, 0x8E, 0x75, 0xBB, 0x77, 0x87, 0x79, 0x96, 0x7F, 0xCD, 0x80, 0xAC, 0x87, 0x8C, 0x8D, 0x97, 0x93, 0xD5, 0xA6, 0xE0, 0xC1, 0xC8, 0xD1, 0xE2, 0xD4, 0xDE, // BIN 518: 25 pairs
-  0x1B, 0x03, 0x78, 0x05, 0xE9, 0x09, 0x36, 0x3F, 0x5F, 0x4C, 0x78, 0x4C, 0x7D, 0x4D, 0x75, 0x4F, 0x82, 0x58, 0x67, 0x5C, 0xFF, 0x70, 0xC7, 0x70, 0xF0, 0x7B, 0xC3, 0x82, 0xC8, 0x84, 0xB6, 0x8D, 0xBA, 0x99, 0xA3, 0x9A, 0xA3, 0xA7, 0xE0, 0xA9, 0xE3, 0xB1, 0xBD, 0xB7, 0xE6, 0xC7, 0xE6, 0xC8, 0xE7, 0xCC, 0xF9, 0xCF, 0xF9, 0xD7, 0xF1, // BIN 519: 27 pairs
-  0x0E, 0x07, 0xFD, 0x19, 0x5C, 0x24, 0x64, 0x2B, 0x33, 0x2C, 0x54, 0x51, 0x64, 0x7C, 0xAD, 0x81, 0xAD, 0x87, 0xAE, 0x87, 0xAF, 0xB2, 0xC2, 0xC1, 0xD0, 0xD6, 0xF2, 0xEC, 0xF1, // BIN 520: 14 pairs
-  0x16, 0x21, 0xF9, 0x25, 0x2A, 0x2A, 0x50, 0x3C, 0x70, 0x40, 0x49, 0x4B, 0x6F, 0x64, 0x97, 0x66, 0xAA, 0x7F, 0xCA, 0x8F, 0xD7, 0x94, 0xD3, 0x99, 0xD8, 0x9A, 0xD8, 0x9B, 0xDD, 0xA3, 0xDA, 0xA9, 0xE1, 0xAF, 0xB8, 0xB5, 0xE9, 0xCC, 0xE2, 0xE1, 0xFD, 0xED, 0xF3, 0xEE, 0xFB, // BIN 521: 22 pairs
-  0x14, 0x0F, 0x3E, 0x17, 0x28, 0x17, 0x2C, 0x2D, 0x43, 0x2D, 0x5B, 0x2E, 0x5A, 0x35, 0x3E, 0x44, 0x62, 0x4C, 0x81, 0x56, 0xA4, 0x8B, 0xC4, 0x8F, 0xD3, 0xAB, 0xD5, 0xAB, 0xDC, 0xB4, 0xEB, 0xBA, 0xE2, 0xD3, 0xF3, 0xD6, 0xF3, 0xD8, 0xF8, 0xDC, 0xFD, // BIN 522: 20 pairs
-  0x15, 0x03, 0x6E, 0x05, 0x25, 0x07, 0xF2, 0x13, 0x3C, 0x13, 0x88, 0x15, 0x3C, 0x16, 0x9E, 0x35, 0x4B, 0x36, 0x42, 0x3F, 0x63, 0x50, 0x74, 0x57, 0x62, 0x64, 0xBE, 0x6E, 0xBD, 0x78, 0xBA, 0x87, 0x92, 0x88, 0xD1, 0xA2, 0xD6, 0xA7, 0xEB, 0xA8, 0xCB, 0xAA, 0xEB, // BIN 523: 21 pairs
-  0x14, 0x11, 0x28, 0x13, 0x97, 0x1B, 0x4D, 0x1D, 0x58, 0x34, 0x41, 0x44, 0x53, 0x59, 0x80, 0x63, 0x7E, 0x82, 0x87, 0x86, 0xB5, 0x92, 0xB1, 0x98, 0xDA, 0xA2, 0xDD, 0xA9, 0xE4, 0xAB, 0xD0, 0xB4, 0xC2, 0xC0, 0xF4, 0xC2, 0xEE, 0xD5, 0xF9, 0xDE, 0xFA, // BIN 524: 20 pairs
-  0x1D, 0x04, 0xF5, 0x0F, 0x75, 0x16, 0x5C, 0x18, 0x30, 0x1E, 0x5C, 0x21, 0x7D, 0x30, 0x54, 0x36, 0x6C, 0x3D, 0x3E, 0x3D, 0x49, 0x3E, 0x40, 0x61, 0x7E, 0x71, 0x91, 0x78, 0xAE, 0x82, 0xCA, 0x86, 0x87, 0x99, 0xBF, 0x99, 0xDD, 0x9A, 0xBF, 0x9A, 0xDD, 0x9D, 0xA2, 0xA2, 0xA9, 0xA3, 0xC5, 0xA4, 0xDF, 0xB1, 0xC5, 0xB3, 0xBC, 0xB5, 0xE1, 0xB9, 0xE0, 0xBF, 0xC3, // BIN 525: 29 pairs
-  0x1B, 0x0C, 0x5F, 0x0F, 0x1F, 0x25, 0x71, 0x28, 0x54, 0x3D, 0x53, 0x42, 0x6A, 0x43, 0x4E, 0x51, 0x5D, 0x52, 0x55, 0x5F, 0xA1, 0x7C, 0xAE, 0x7D, 0xB6, 0x7E, 0x81, 0x83, 0xAE, 0x85, 0xEA, 0x8B, 0xD0, 0x8F, 0xEA, 0x96, 0xCE, 0x9C, 0xDD, 0xA8, 0xAB, 0xA8, 0xBC, 0xAB, 0xD1, 0xD6, 0xEE, 0xDB, 0xF5, 0xDC, 0xF1, 0xDD, 0xF5, 0xE7, 0xF6, // BIN 526: 27 pairs
-  0x1A, 0x02, 0x1D, 0x09, 0x39, 0x0C, 0xA4, 0x17, 0x58, 0x20, 0x45, 0x32, 0x4C, 0x3E, 0x6D, 0x3F, 0x50, 0x4F, 0x5A, 0x55, 0x78, 0x57, 0x9B, 0x59, 0x9B, 0x5F, 0x7C, 0x67, 0x8E, 0x75, 0xCC, 0x79, 0xAE, 0x82, 0xCD, 0x83, 0x90, 0x93, 0xA3, 0x95, 0xD5, 0xA2, 0xCB, 0xBB, 0xC1, 0xBC, 0xC0, 0xCB, 0xCF, 0xD2, 0xF1, 0xEA, 0xF1, // BIN 527: 26 pairs
-  0x18, 0x01, 0x58, 0x06, 0x58, 0x08, 0xD1, 0x0E, 0x2D, 0x19, 0x3A, 0x20, 0x7F, 0x22, 0x36, 0x3B, 0x72, 0x3E, 0x6E, 0x4A, 0x52, 0x52, 0x53, 0x63, 0xA7, 0x83, 0x9B, 0x8C, 0xD9, 0x8E, 0x8F, 0x92, 0xB0, 0x99, 0xDA, 0x9A, 0xDA, 0x9E, 0xC2, 0x9F, 0xA4, 0xA4, 0xDB, 0xB8, 0xEF, 0xC5, 0xE8, 0xE2, 0xEB, // BIN 528: 24 pairs
-  0x16, 0x01, 0x24, 0x12, 0x32, 0x14, 0x34, 0x14, 0x4B, 0x16, 0x32, 0x17, 0x34, 0x1B, 0x26, 0x1B, 0x82, 0x22, 0x3E, 0x30, 0x48, 0x33, 0x56, 0x3B, 0x5A, 0x4F, 0x5B, 0x51, 0x56, 0x61, 0xA0, 0x63, 0x8A, 0x7D, 0x8D, 0x80, 0xB4, 0x82, 0xCF, 0x9D, 0xAE, 0xBF, 0xEB, 0xEF, 0xF2, // BIN 529: 22 pairs
-  0x17, 0x03, 0xCF, 0x05, 0xFB, 0x0A, 0xED, 0x0F, 0xAC, 0x14, 0x30, 0x18, 0x50, 0x1C, 0x52, 0x21, 0x6E, 0x40, 0x6B, 0x48, 0x62, 0x53, 0x75, 0x5E, 0xA6, 0x76, 0x94, 0x77, 0xF0, 0x83, 0xAF, 0x84, 0xB4, 0x85, 0xAF, 0x92, 0xD5, 0x9C, 0xD8, 0xAB, 0xCD, 0xB0, 0xBD, 0xB2, 0xE2, 0xDB, 0xFC, // BIN 530: 23 pairs
-  0x14, 0x0A, 0xF2, 0x0C, 0x81, 0x0F, 0x9C, 0x14, 0x37, 0x1A, 0x64, 0x26, 0x44, 0x4C, 0x84, 0x50, 0x7B, 0x65, 0x90, 0x81, 0xB6, 0x83, 0xB0, 0x84, 0xB2, 0x8C, 0xEF, 0x91, 0xCB, 0xA9, 0xAD, 0xB2, 0xEA, 0xBC, 0xCC, 0xC1, 0xEC, 0xCB, 0xEE, 0xE2, 0xF4, // BIN 531: 20 pairs
-  0x1C, 0x04, 0xF1, 0x0F, 0x4C, 0x12, 0x2D, 0x15, 0x36, 0x18, 0xEF, 0x19, 0xFD, 0x2B, 0x6B, 0x40, 0x55, 0x48, 0x82, 0x56, 0x99, 0x56, 0x9A, 0x5C, 0xA8, 0x5E, 0xEA, 0x62, 0x87, 0x6B, 0x83, 0x73, 0x8A, 0x7A, 0xCF, 0x7D, 0x9F, 0x7E, 0xAB, 0x83, 0xA6, 0x87, 0xAD, 0x8D, 0xBB, 0x9B, 0xDB, 0xA3, 0xC6, 0xC1, 0xD4, 0xC2, 0xD8, 0xC6, 0xE8, 0xD6, 0xEB, // BIN 532: 28 pairs
-  0x1A, 0x00, 0xE4, 0x03, 0x39, 0x0C, 0x59, 0x14, 0x4A, 0x18, 0x2C, 0x19, 0x52, 0x1D, 0xFF, 0x2C, 0x5B, 0x39, 0x42, 0x78, 0x8E, 0x7A, 0xC8, 0x7C, 0x9C, 0x7D, 0xB2, 0x7E, 0x9C, 0x83, 0x8F, 0x83, 0xAD, 0x9F, 0xD6, 0xAC, 0xB7, 0xAC, 0xE0, 0xB0, 0xDC, 0xB1, 0xC6, 0xB1, 0xDC, 0xBE, 0xCB, 0xCD, 0xF9, 0xD0, 0xF9, 0xE0, 0xFB, // BIN 533: 26 pairs
-  0x14, 0x02, 0xEC, 0x09, 0x26, 0x38, 0x47, 0x44, 0x55, 0x4A, 0x6F, 0x5F, 0xA7, 0x62, 0x69, 0x7A, 0xB6, 0x7A, 0xCD, 0x7D, 0xB4, 0x7D, 0xD0, 0x87, 0xA1, 0x94, 0xD4, 0x96, 0xA5, 0x97, 0xDC, 0x9C, 0xDA, 0xA9, 0xB2, 0xAA, 0xD6, 0xB9, 0xBF, 0xDF, 0xF2, // BIN 534: 20 pairs
-  0x0E, 0x03, 0x9B, 0x0B, 0xB3, 0x17, 0xFA, 0x18, 0x28, 0x1E, 0x1F, 0x30, 0x41, 0x56, 0x79, 0x62, 0x78, 0x66, 0x7C, 0x6C, 0xC9, 0x7A, 0xAE, 0xAB, 0xC0, 0xB6, 0xE8, 0xE5, 0xFB, // BIN 535: 14 pairs
-  0x11, 0x05, 0x27, 0x09, 0x48, 0x0A, 0x13, 0x18, 0xFA, 0x1A, 0x30, 0x21, 0x2C, 0x31, 0x5A, 0x36, 0x6D, 0x4C, 0x7F, 0x51, 0x74, 0x55, 0x65, 0x5E, 0xAA, 0x61, 0x8A, 0x7A, 0xB2, 0x84, 0xD4, 0x96, 0xD1, 0xC2, 0xE0, // BIN 536: 17 pairs
-  0x17, 0x03, 0x82, 0x04, 0x1F, 0x05, 0x24, 0x0C, 0x4F, 0x13, 0xC3, 0x14, 0x23, 0x17, 0x1F, 0x26, 0x5D, 0x35, 0x49, 0x4A, 0x6D, 0x4E, 0x58, 0x61, 0xA1, 0x76, 0xA9, 0x78, 0xB2, 0x7D, 0xAE, 0x91, 0xAD, 0x91, 0xC7, 0xA4, 0xF9, 0xB0, 0xC5, 0xB0, 0xD9, 0xBB, 0xF8, 0xDC, 0xE0, 0xDF, 0xFB, // BIN 537: 23 pairs
-  0x19, 0x02, 0x1A, 0x0A, 0x2E, 0x0C, 0x6D, 0x14, 0x5E, 0x1B, 0xF4, 0x24, 0x60, 0x2A, 0x56, 0x39, 0x6E, 0x40, 0x4D, 0x4A, 0x68, 0x5E, 0x79, 0x5E, 0xC9, 0x5F, 0xBD, 0x66, 0x8A, 0x6E, 0x83, 0x78, 0xCC, 0x7A, 0xCA, 0x93, 0xEB, 0xA2, 0xDF, 0xA3, 0xC3, 0xAC, 0xF9, 0xB6, 0xC2, 0xC1, 0xCD, 0xC5, 0xD6, 0xDE, 0xE1, // BIN 538: 25 pairs
-  0x14, 0x07, 0x0A, 0x0D, 0x64, 0x0E, 0x28, 0x18, 0x34, 0x1F, 0x4F, 0x41, 0xA4, 0x43, 0x78, 0x58, 0x74, 0x6B, 0x96, 0x71, 0x96, 0x7F, 0xAF, 0x98, 0xDD, 0x9F, 0xC2, 0xAA, 0xBC, 0xB1, 0xD9, 0xB1, 0xE5, 0xD0, 0xDE, 0xD0, 0xE6, 0xDC, 0xFF, 0xE2, 0xFA, // BIN 539: 20 pairs
-  0x13, 0x06, 0xD1, 0x0E, 0x32, 0x11, 0xF7, 0x14, 0x45, 0x15, 0x3F, 0x20, 0x55, 0x20, 0xAC, 0x22, 0x4A, 0x23, 0x53, 0x42, 0x6B, 0x57, 0x79, 0x67, 0x8D, 0x68, 0x8A, 0x71, 0xEF, 0x7A, 0xB4, 0x80, 0xB6, 0xB7, 0xE7, 0xD4, 0xF1, 0xD8, 0xF9, // BIN 540: 19 pairs
-  0x13, 0x01, 0xD9, 0x06, 0xB3, 0x0F, 0x7D, 0x16, 0x64, 0x17, 0x50, 0x27, 0x71, 0x2A, 0x3B, 0x43, 0x7F, 0x68, 0x6F, 0x78, 0xB6, 0x79, 0xA4, 0x7C, 0xAF, 0x83, 0xB1, 0x87, 0xA0, 0x96, 0xB2, 0xA3, 0xDB, 0xAD, 0xC2, 0xAF, 0xE2, 0xDE, 0xEF, // BIN 541: 19 pairs
-  0x1A, 0x0A, 0x3B, 0x0C, 0x84, 0x0D, 0x5C, 0x12, 0x13, 0x14, 0x56, 0x15, 0x42, 0x17, 0x37, 0x19, 0x64, 0x2A, 0x2B, 0x2E, 0x5B, 0x38, 0x62, 0x3D, 0x55, 0x42, 0x4C, 0x44, 0x49, 0x51, 0x73, 0x56, 0x5B, 0x6A, 0x80, 0x7B, 0x87, 0x7D, 0xF8, 0x7F, 0xD0, 0x81, 0xB4, 0x81, 0xD4, 0x84, 0xAE, 0x86, 0xEF, 0xB2, 0xEB, 0xD3, 0xF1, // BIN 542: 26 pairs
-  0x1E, 0x03, 0x36, 0x03, 0xCD, 0x06, 0x3C, 0x08, 0x2E, 0x0D, 0xED, 0x0F, 0x2F, 0x12, 0x3D, 0x14, 0x4D, 0x1B, 0x4B, 0x35, 0x64, 0x3A, 0x60, 0x49, 0x6F, 0x54, 0x79, 0x56, 0x5A, 0x58, 0x5A, 0x62, 0x6C, 0x63, 0xBD, 0x67, 0x86, 0x68, 0x94, 0x76, 0x9F, 0x7E, 0xB2, 0x81, 0xB2, 0x8A, 0x9D, 0x96, 0xBE, 0x9B, 0xDF, 0x9E, 0xB5, 0xAA, 0xCE, 0xB8, 0xF0, 0xBB, 0xE2, 0xCC, 0xE7, // BIN 543: 30 pairs
-  0x08, 0x24, 0x2F, 0x25, 0x38, 0x3D, 0x4D, 0x68, 0xC0, 0x78, 0xB4, 0x89, 0xB8, 0xA3, 0xAC, 0xE6, 0xF4, // BIN 544: 8 pairs
-  0x1A, 0x02, 0x1E, 0x05, 0x2B, 0x08, 0xC7, 0x0D, 0xEE, 0x11, 0x2C, 0x29, 0x3C, 0x3B, 0x5B, 0x3B, 0x77, 0x3D, 0x6B, 0x40, 0x67, 0x48, 0xA4, 0x66, 0xF8, 0x6B, 0xB3, 0x6F, 0x98, 0x79, 0xAF, 0x7E, 0x9D, 0x89, 0xAF, 0x94, 0x9D, 0x97, 0x9F, 0x9D, 0xDC, 0x9F, 0xB8, 0xAB, 0xCF, 0xB0, 0xC6, 0xC1, 0xE8, 0xC9, 0xCE, 0xE5, 0xEF, // BIN 545: 26 pairs
-  0x1B, 0x03, 0x92, 0x0D, 0x22, 0x16, 0xA5, 0x1B, 0xC9, 0x1C, 0x4E, 0x1D, 0x4E, 0x20, 0x93, 0x38, 0x3B, 0x55, 0x6A, 0x59, 0x7C, 0x6E, 0xA2, 0x77, 0xB8, 0x8B, 0xAB, 0x8E, 0xB8, 0x90, 0xC1, 0x98, 0xDB, 0x98, 0xEA, 0x99, 0xDB, 0x9A, 0xDB, 0xB0, 0xE5, 0xB1, 0xE6, 0xB7, 0xE8, 0xC6, 0xD6, 0xC7, 0xE2, 0xD1, 0xD6, 0xD3, 0xF9, 0xDB, 0xF2, // BIN 546: 27 pairs
-  0x14, 0x03, 0xD4, 0x0C, 0x3E, 0x0E, 0xF7, 0x17, 0xEF, 0x25, 0x70, 0x52, 0x7B, 0x5B, 0x7C, 0x60, 0x6F, 0x67, 0x91, 0x6D, 0xC0, 0x75, 0xEA, 0x8A, 0xBF, 0x8B, 0xBF, 0x8D, 0xBF, 0x99, 0xB7, 0x9A, 0xB7, 0xA6, 0xBC, 0xA9, 0xB4, 0xBC, 0xE9, 0xDD, 0xFB, // BIN 547: 20 pairs
-  0x17, 0x12, 0x1F, 0x17, 0x46, 0x18, 0x46, 0x1A, 0x2C, 0x1A, 0x34, 0x21, 0x37, 0x2A, 0x5A, 0x38, 0x5D, 0x3C, 0xFF, 0x41, 0x9C, 0x5D, 0x8A, 0x5E, 0x80, 0x61, 0xA7, 0x6B, 0x9D, 0x75, 0xBA, 0x91, 0x95, 0x91, 0xA5, 0x99, 0xDF, 0x9A, 0xDF, 0xA6, 0xEB, 0xC2, 0xEF, 0xD2, 0xEA, 0xDA, 0xFC, // BIN 548: 23 pairs
-  0x1A, 0x03, 0xA7, 0x19, 0xE1, 0x1E, 0xF0, 0x21, 0x7A, 0x3C, 0x45, 0x40, 0x62, 0x40, 0x6A, 0x43, 0x85, 0x46, 0x6B, 0x48, 0x9C, 0x55, 0x7A, 0x58, 0x5B, 0x89, 0xA8, 0x8F, 0xD5, 0x97, 0xCE, 0x98, 0xD2, 0xB4, 0xE8, 0xB5, 0xD8, 0xB7, 0xDC, 0xBF, 0xDC, 0xBF, 0xEA, 0xD0, 0xE5, 0xDA, 0xF5, 0xDB, 0xE3, 0xDC, 0xF5, 0xE5, 0xF7, // BIN 549: 26 pairs
-  0x1D, 0x0B, 0x71, 0x0E, 0x3C, 0x11, 0x30, 0x16, 0x2D, 0x19, 0x46, 0x19, 0xFA, 0x1D, 0x31, 0x24, 0x3F, 0x2B, 0xF0, 0x32, 0x43, 0x3A, 0x4F, 0x48, 0x93, 0x4C, 0x85, 0x60, 0x9E, 0x66, 0xC9, 0x78, 0x87, 0x79, 0xAC, 0x87, 0xB5, 0x89, 0xAE, 0x8A, 0xC4, 0x94, 0xBC, 0x9C, 0xDB, 0x9C, 0xDF, 0xA5, 0xE3, 0xC1, 0xCF, 0xE2, 0xFB, 0xE3, 0xF3, 0xE4, 0xF5, 0xE8, 0xE9, // BIN 550: 29 pairs
-  0x1A, 0x0C, 0x69, 0x18, 0x37, 0x1B, 0x2F, 0x2F, 0x61, 0x49, 0x75, 0x4B, 0x52, 0x5F, 0x7E, 0x65, 0x7C, 0x69, 0xC9, 0x6A, 0x8D, 0x6E, 0xC6, 0x6F, 0x84, 0x71, 0x89, 0x72, 0xA9, 0x7E, 0x88, 0x80, 0xAB, 0x82, 0xD0, 0x8A, 0xC5, 0x8A, 0xC8, 0x94, 0xD7, 0x96, 0x9E, 0x9C, 0xBF, 0xAB, 0xDA, 0xAB, 0xE2, 0xAE, 0xB8, 0xF4, 0xFE, // BIN 551: 26 pairs
-  0x18, 0x0A, 0xE9, 0x0E, 0x3B, 0x10, 0x3D, 0x1E, 0xF7, 0x22, 0x39, 0x29, 0x57, 0x35, 0x36, 0x41, 0x82, 0x44, 0x4D, 0x44, 0x70, 0x53, 0x78, 0x55, 0x79, 0x5F, 0x8A, 0x6A, 0x96, 0x6D, 0xF8, 0x70, 0xD1, 0x85, 0xD4, 0x87, 0xA6, 0x8A, 0xC6, 0x8E, 0xBF, 0x9F, 0xDA, 0xA5, 0xED, 0xC0, 0xE2, 0xE2, 0xFE, // BIN 552: 24 pairs
-  0x16, 0x0B, 0x22, 0x0C, 0x2F, 0x0F, 0xC6, 0x16, 0x42, 0x16, 0x71, 0x1F, 0x53, 0x20, 0x2A, 0x20, 0x99, 0x20, 0x9A, 0x21, 0x34, 0x31, 0x5B, 0x3A, 0x62, 0x56, 0x92, 0x60, 0x89, 0x8A, 0xB9, 0x96, 0xBF, 0xA6, 0xD6, 0xB0, 0xE6, 0xB3, 0xEE, 0xB4, 0xDE, 0xBF, 0xE3, 0xCA, 0xDE, // BIN 553: 22 pairs
-  0x18, 0x05, 0x22, 0x0C, 0x56, 0x0D, 0x70, 0x20, 0x38, 0x24, 0xFF, 0x31, 0x3C, 0x3C, 0x3F, 0x3E, 0x44, 0x66, 0x94, 0x72, 0x8E, 0x75, 0x8D, 0x78, 0xAF, 0x81, 0xAE, 0x8A, 0xC9, 0x8D, 0x9C, 0x94, 0xD5, 0x9D, 0xBF, 0xB6, 0xDE, 0xBE, 0xDE, 0xC3, 0xE7, 0xC3, 0xFF, 0xD8, 0xE3, 0xD9, 0xFD, 0xF1, 0xF8, // BIN 554: 24 pairs
-  0x19, 0x03, 0x5D, 0x0C, 0x63, 0x0D, 0xD1, 0x21, 0xA4, 0x24, 0x26, 0x3B, 0x7B, 0x41, 0x93, 0x59, 0x98, 0x5B, 0x79, 0x5E, 0x6F, 0x5F, 0xC6, 0x6F, 0x81, 0x7B, 0xEF, 0x81, 0xEB, 0x8C, 0x8E, 0x8F, 0xB7, 0x8F, 0xBF, 0x92, 0xEA, 0x95, 0x96, 0x9B, 0xAB, 0xAB, 0xB3, 0xAB, 0xD7, 0xCB, 0xCC, 0xCE, 0xEE, 0xDD, 0xF2, // BIN 555: 25 pairs
-  0x14, 0x08, 0x71, 0x11, 0x2A, 0x18, 0x1F, 0x37, 0x56, 0x54, 0x8F, 0x63, 0xA6, 0x66, 0x7E, 0x68, 0x7C, 0x6E, 0xC5, 0x76, 0x8B, 0x83, 0xAA, 0x84, 0xEB, 0x88, 0xC2, 0x8B, 0x91, 0xA6, 0xCE, 0xAB, 0xCC, 0xAF, 0xDE, 0xBD, 0xD6, 0xC0, 0xF9, 0xD1, 0xFA, // BIN 556: 20 pairs
-  0x13, 0x02, 0xE9, 0x0C, 0x6C, 0x10, 0xEC, 0x13, 0x60, 0x15, 0x46, 0x29, 0x59, 0x2F, 0x5A, 0x2F, 0x5F, 0x4E, 0x6F, 0x5D, 0x95, 0x77, 0xC3, 0x7F, 0x83, 0x84, 0x9F, 0x8A, 0xCA, 0x93, 0xBF, 0xAD, 0xEA, 0xB3, 0xDE, 0xC8, 0xDE, 0xD2, 0xF3, // BIN 557: 19 pairs
-  0x13, 0x01, 0xA8, 0x04, 0x47, 0x0A, 0xF5, 0x0B, 0xD1, 0x17, 0x2A, 0x19, 0x9E, 0x1E, 0x38, 0x21, 0xB9, 0x23, 0x43, 0x28, 0x5A, 0x4E, 0x74, 0x59, 0x95, 0x5D, 0x9B, 0x75, 0xF8, 0x7A, 0xEA, 0x86, 0xC2, 0x87, 0x9B, 0xA4, 0xBF, 0xBC, 0xE8, // BIN 558: 19 pairs
-  0x18, 0x01, 0xE3, 0x03, 0xD0, 0x09, 0x43, 0x10, 0xE1, 0x13, 0xED, 0x1A, 0x37, 0x1F, 0x44, 0x23, 0x4C, 0x31, 0x52, 0x3A, 0x54, 0x46, 0x54, 0x75, 0xAD, 0x7A, 0xD0, 0x7F, 0xEA, 0x83, 0xA7, 0x8D, 0xB5, 0x96, 0xB4, 0x9B, 0xD2, 0x9C, 0xA3, 0xB5, 0xBA, 0xB5, 0xEC, 0xCA, 0xF9, 0xDF, 0xE3, 0xE7, 0xEA, // BIN 559: 24 pairs
-  0x1B, 0x06, 0xC7, 0x0F, 0xC5, 0x0F, 0xFB, 0x12, 0x40, 0x15, 0x39, 0x1A, 0x28, 0x21, 0x30, 0x25, 0xF0, 0x35, 0x53, 0x4D, 0x78, 0x4E, 0x73, 0x54, 0x93, 0x6D, 0xEA, 0x70, 0xA9, 0x77, 0x83, 0x8C, 0xAB, 0x90, 0xBC, 0x95, 0xD8, 0x98, 0xDF, 0x9D, 0xAD, 0xA1, 0xE0, 0xC0, 0xCB, 0xCA, 0xE6, 0xD0, 0xF3, 0xDA, 0xE3, 0xE4, 0xF1, 0xE6, 0xEF, // BIN 560: 27 pairs
-  0x1E, 0x01, 0xDC, 0x03, 0x54, 0x09, 0x5E, 0x0D, 0xA8, 0x0F, 0x54, 0x10, 0x32, 0x24, 0x45, 0x27, 0x70, 0x2B, 0x38, 0x39, 0x62, 0x3A, 0x5C, 0x43, 0x46, 0x57, 0x98, 0x6F, 0x93, 0x75, 0xCF, 0x7E, 0xB4, 0x80, 0xBA, 0x80, 0xBB, 0x8A, 0xCC, 0x90, 0xEF, 0x9C, 0xF6, 0x9F, 0xB9, 0xA0, 0xE0, 0xA2, 0xE0, 0xAB, 0xD4, 0xB2, 0xDE, 0xCE, 0xEC, 0xD6, 0xF5, 0xDE, 0xF7, 0xE6, 0xF7, // BIN 561: 30 pairs
-  0x17, 0x07, 0xFA, 0x0D, 0x35, 0x13, 0x24, 0x15, 0x3B, 0x16, 0x52, 0x1E, 0x4E, 0x1E, 0x64, 0x1F, 0x4E, 0x21, 0xF6, 0x44, 0x71, 0x44, 0x72, 0x47, 0x92, 0x4A, 0x50, 0x4B, 0x75, 0x53, 0x65, 0x5B, 0x70, 0x5F, 0xC5, 0x71, 0xA9, 0x91, 0x9E, 0xAE, 0xE2, 0xC2, 0xDA, 0xC7, 0xD6, 0xC8, 0xF9, // BIN 562: 23 pairs
-  0x15, 0x01, 0xF2, 0x02, 0xEF, 0x06, 0x2E, 0x0E, 0x2C, 0x14, 0x54, 0x14, 0x59, 0x1A, 0xFD, 0x29, 0x5D, 0x51, 0x58, 0x56, 0x8B, 0x57, 0x80, 0x58, 0xEF, 0x63, 0xC6, 0x84, 0xD7, 0x93, 0xD8, 0x9D, 0xE1, 0xA3, 0xDD, 0xBC, 0xBE, 0xBD, 0xE8, 0xCD, 0xDE, 0xDB, 0xFB, // BIN 563: 21 pairs
-  0x10, 0x0C, 0x61, 0x0C, 0xAC, 0x11, 0x34, 0x1B, 0x4A, 0x2A, 0x47, 0x3D, 0x67, 0x4D, 0x7A, 0x4E, 0x56, 0x5F, 0xA6, 0x63, 0x94, 0x68, 0xCC, 0x88, 0xE1, 0x8E, 0xC1, 0x97, 0xE4, 0xBB, 0xF6, 0xCD, 0xE6, // BIN 564: 16 pairs
-  0x14, 0x0D, 0xFE, 0x11, 0x3D, 0x1C, 0x3F, 0x25, 0x6B, 0x35, 0x4D, 0x3D, 0x62, 0x4E, 0x5D, 0x62, 0x66, 0x75, 0xCD, 0x78, 0xA3, 0x78, 0xC8, 0x7A, 0xAF, 0x7E, 0xB0, 0x80, 0xB0, 0x86, 0xD9, 0xA8, 0xED, 0xC2, 0xD3, 0xC2, 0xDB, 0xE5, 0xF4, 0xE8, 0xFA, // BIN 565: 20 pairs
-  0x16, 0x00, 0xF3, 0x03, 0x4C, 0x03, 0xC8, 0x03, 0xD7, 0x0D, 0xC7, 0x17, 0x33, 0x22, 0x4B, 0x5A, 0x70, 0x6F, 0x9B, 0x7C, 0x88, 0x85, 0xF8, 0x8D, 0xBC, 0x8E, 0xBA, 0x91, 0xB2, 0x9B, 0xEB, 0xAB, 0xDB, 0xB1, 0xE3, 0xB7, 0xD9, 0xC1, 0xE1, 0xC8, 0xE6, 0xCF, 0xE6, 0xE7, 0xF9, // BIN 566: 22 pairs
-  0x16, 0x03, 0xCA, 0x07, 0x12, 0x0F, 0x29, 0x10, 0x40, 0x21, 0x85, 0x36, 0x6E, 0x3B, 0x9E, 0x3D, 0x6A, 0x50, 0x55, 0x55, 0x7F, 0x5D, 0xAC, 0x61, 0xBD, 0x6D, 0xA2, 0x75, 0xC8, 0x7C, 0xAB, 0x7D, 0xAF, 0x7D, 0xD4, 0x89, 0xAD, 0xA0, 0xEB, 0xB5, 0xD3, 0xC1, 0xEE, 0xCF, 0xF3, // BIN 567: 22 pairs
-  0x1C, 0x08, 0xA8, 0x0A, 0x3C, 0x11, 0x3A, 0x1B, 0xFC, 0x1D, 0x26, 0x20, 0x78, 0x2A, 0x5B, 0x32, 0x60, 0x34, 0x56, 0x37, 0x62, 0x3C, 0x72, 0x48, 0x51, 0x50, 0x53, 0x53, 0x7A, 0x5A, 0x7C, 0x62, 0x89, 0x65, 0x7E, 0x76, 0xA3, 0x79, 0xB2, 0x87, 0xB7, 0x91, 0xBE, 0x93, 0xDD, 0xA9, 0xB6, 0xB0, 0xE3, 0xB2, 0xE8, 0xDA, 0xF2, 0xDE, 0xFD, 0xE3, 0xFF, // BIN 568: 28 pairs
-  0x1A, 0x07, 0x21, 0x09, 0x15, 0x0C, 0x4C, 0x10, 0x58, 0x11, 0xFF, 0x19, 0x71, 0x1F, 0x27, 0x27, 0x6B, 0x2F, 0x63, 0x31, 0x61, 0x35, 0x39, 0x35, 0x65, 0x38, 0x59, 0x39, 0x75, 0x5B, 0x83, 0x63, 0xAA, 0x63, 0xC5, 0x6A, 0x97, 0x97, 0xB7, 0xA3, 0xDF, 0xAC, 0xF4, 0xB7, 0xE3, 0xBA, 0xF8, 0xC2, 0xD5, 0xCA, 0xE5, 0xCF, 0xDE, // BIN 569: 26 pairs
-  0x16, 0x0E, 0x2A, 0x10, 0x2D, 0x18, 0x2A, 0x18, 0x52, 0x1B, 0x92, 0x22, 0x49, 0x2D, 0x4F, 0x41, 0xB9, 0x45, 0x66, 0x46, 0x4F, 0x5C, 0x62, 0x5D, 0x67, 0x62, 0x82, 0x78, 0xCA, 0x80, 0xB1, 0x81, 0x9F, 0x81, 0xD7, 0x83, 0x8C, 0x92, 0xD8, 0xA3, 0xE0, 0xD7, 0xFC, 0xF2, 0xF6, // BIN 570: 22 pairs
-  0x1E, 0x0A, 0xE1, 0x0C, 0x9C, 0x0E, 0x30, 0x15, 0x44, 0x19, 0x30, 0x1A, 0x71, 0x1F, 0x47, 0x26, 0x5F, 0x26, 0x61, 0x32, 0x5C, 0x36, 0x3D, 0x4F, 0x93, 0x55, 0x7D, 0x56, 0x80, 0x62, 0x8A, 0x6B, 0xBE, 0x6C, 0xC0, 0x6D, 0xBB, 0x6F, 0x91, 0x78, 0xCD, 0x78, 0xCF, 0x7C, 0xB2, 0x7E, 0xB1, 0x86, 0x8E, 0x8C, 0xE4, 0x90, 0xE4, 0x93, 0xDA, 0x9E, 0xED, 0xB5, 0xED, 0xE6, 0xEB, // BIN 571: 30 pairs
-  0x12, 0x00, 0xE1, 0x03, 0xA0, 0x09, 0xB9, 0x0B, 0xC7, 0x0C, 0x29, 0x0F, 0xBD, 0x1D, 0x2F, 0x4D, 0x67, 0x66, 0xEA, 0x6D, 0xCC, 0x75, 0xCA, 0x84, 0xAF, 0x89, 0x98, 0x93, 0xB7, 0x94, 0xD2, 0xA7, 0xD6, 0xB8, 0xEE, 0xF0, 0xFE, // BIN 572: 18 pairs
-  0x1B, 0x04, 0x41, 0x07, 0x20, 0x0E, 0xFB, 0x0F, 0x31, 0x0F, 0x99, 0x0F, 0x9A, 0x17, 0xFE, 0x28, 0x56, 0x2B, 0x9E, 0x2C, 0x56, 0x2E, 0x4A, 0x48, 0x8F, 0x57, 0x95, 0x59, 0x7E, 0x62, 0x6D, 0x67, 0x8C, 0x84, 0x8D, 0x8A, 0xCD, 0x8B, 0x96, 0x9F, 0xDB, 0xA1, 0xEB, 0xAB, 0xE0, 0xB2, 0xB8, 0xCB, 0xE1, 0xCD, 0xE5, 0xD6, 0xEC, 0xE1, 0xE5, // BIN 573: 27 pairs
-  0x16, 0x0C, 0x75, 0x13, 0x1D, 0x14, 0xF4, 0x16, 0x3A, 0x23, 0x55, 0x27, 0x29, 0x2F, 0x5B, 0x58, 0x97, 0x5C, 0xB3, 0x5D, 0x98, 0x68, 0x7E, 0x7C, 0x9D, 0x7E, 0xB6, 0x7F, 0xA3, 0x80, 0xBD, 0x83, 0x86, 0x87, 0xAA, 0x91, 0xCE, 0x91, 0xD1, 0x94, 0xA9, 0xB8, 0xC4, 0xC8, 0xE5, // BIN 574: 22 pairs
-  0x1A, 0x01, 0x3C, 0x02, 0x04, 0x0C, 0xC6, 0x14, 0x2D, 0x21, 0x7F, 0x29, 0x52, 0x29, 0x5A, 0x33, 0x62, 0x36, 0x40, 0x3A, 0x65, 0x41, 0x62, 0x43, 0x5A, 0x4C, 0x82, 0x4D, 0x52, 0x5A, 0x79, 0x5B, 0x7E, 0x60, 0xA5, 0x6C, 0xA2, 0x7A, 0x83, 0x85, 0xA3, 0x87, 0xB2, 0x89, 0xB7, 0x8D, 0xC4, 0x9D, 0xB2, 0xBA, 0xE7, 0xE2, 0xFD, // BIN 575: 26 pairs
-  0x18, 0x05, 0xE4, 0x07, 0xEB, 0x13, 0xDC, 0x2B, 0x65, 0x31, 0x50, 0x31, 0x5F, 0x31, 0x62, 0x33, 0x47, 0x38, 0x57, 0x45, 0x5E, 0x4D, 0x7D, 0x57, 0xBD, 0x5F, 0xAA, 0x61, 0xA6, 0x68, 0xBB, 0x70, 0x87, 0x87, 0x8F, 0xAB, 0xE3, 0xAD, 0xEB, 0xB5, 0xE0, 0xBC, 0xED, 0xC0, 0xC1, 0xC1, 0xCC, 0xCD, 0xF3, // BIN 576: 24 pairs
-  0x17, 0x05, 0xF1, 0x06, 0xF2, 0x0A, 0x23, 0x0F, 0x49, 0x11, 0x37, 0x14, 0xFB, 0x18, 0x33, 0x1A, 0x9E, 0x2E, 0x65, 0x41, 0xF8, 0x4A, 0x67, 0x52, 0x76, 0x53, 0x6A, 0x61, 0x94, 0x64, 0xF0, 0x6F, 0x9F, 0x72, 0xFF, 0x75, 0x9F, 0x9E, 0xE3, 0xCF, 0xE5, 0xD4, 0xFC, 0xDE, 0xFE, 0xFC, 0xFD, // BIN 577: 23 pairs
-  0x16, 0x03, 0xBB, 0x0D, 0x7B, 0x1B, 0x9B, 0x28, 0x5B, 0x3F, 0x5E, 0x45, 0x67, 0x48, 0x99, 0x48, 0x9A, 0x56, 0xB9, 0x59, 0xA0, 0x5D, 0xB9, 0x64, 0xE1, 0x65, 0x91, 0x7B, 0xB5, 0x85, 0xC4, 0x89, 0xBC, 0x8B, 0xD4, 0xA9, 0xC4, 0xAD, 0xE2, 0xB5, 0xD5, 0xBA, 0xDE, 0xCE, 0xF1, // BIN 578: 22 pairs
-  0x10, 0x0F, 0x85, 0x12, 0x28, 0x13, 0x50, 0x36, 0x62, 0x3F, 0x66, 0x4F, 0x8F, 0x55, 0x7C, 0x57, 0xA0, 0x5C, 0xBE, 0x62, 0x72, 0x7F, 0x8E, 0x85, 0xD7, 0x88, 0xA3, 0x9C, 0xB7, 0xBB, 0xF4, 0xC2, 0xF0, // BIN 579: 16 pairs
-  0x15, 0x03, 0xAA, 0x0F, 0x7A, 0x0F, 0x93, 0x10, 0xEE, 0x16, 0xEC, 0x17, 0x52, 0x1A, 0xE1, 0x1F, 0x51, 0x34, 0x62, 0x41, 0x99, 0x41, 0x9A, 0x45, 0x69, 0x49, 0x52, 0x55, 0x82, 0x56, 0x7C, 0x6B, 0x6F, 0x6C, 0xF8, 0x83, 0xB2, 0x94, 0xD8, 0xAC, 0xD2, 0xDC, 0xFE, // BIN 580: 21 pairs
-  0x10, 0x1D, 0x5C, 0x21, 0x9C, 0x30, 0x56, 0x43, 0x5B, 0x4B, 0x67, 0x54, 0x9C, 0x57, 0xF8, 0x65, 0x79, 0x77, 0x8E, 0x7F, 0xD4, 0xA1, 0xBC, 0xA7, 0xBC, 0xAE, 0xDE, 0xB4, 0xB8, 0xBF, 0xD9, 0xD8, 0xF5, // BIN 581: 16 pairs
-  0x1B, 0x03, 0xA1, 0x0C, 0xC5, 0x18, 0xFE, 0x19, 0x2C, 0x1B, 0x31, 0x1B, 0x53, 0x1F, 0x3C, 0x20, 0x28, 0x35, 0x55, 0x45, 0x6E, 0x48, 0xB9, 0x58, 0x76, 0x76, 0xAB, 0x83, 0x85, 0x84, 0xD3, 0x87, 0xA7, 0x8A, 0xCF, 0x96, 0xB6, 0xA7, 0xF8, 0xB0, 0xC7, 0xB1, 0xE7, 0xB6, 0xE7, 0xC0, 0xE7, 0xC4, 0xF4, 0xDD, 0xE3, 0xE8, 0xFD, 0xF2, 0xF9, // BIN 582: 27 pairs
-  0x14, 0x04, 0x15, 0x0C, 0x31, 0x11, 0x40, 0x14, 0x5F, 0x15, 0x3E, 0x19, 0x34, 0x19, 0xA5, 0x45, 0x6F, 0x4F, 0x9C, 0x54, 0x7C, 0x5F, 0x94, 0x67, 0x8A, 0x67, 0x90, 0x75, 0xB6, 0x8B, 0xD3, 0x8D, 0xC0, 0x90, 0xDC, 0xAE, 0xEA, 0xB5, 0xE7, 0xC9, 0xE2, // BIN 583: 20 pairs
-  0x1B, 0x01, 0x71, 0x05, 0x13, 0x09, 0x2F, 0x0B, 0x35, 0x0E, 0x34, 0x12, 0x3A, 0x14, 0x68, 0x16, 0xBE, 0x1A, 0xFA, 0x20, 0x33, 0x20, 0xEB, 0x2F, 0x3C, 0x56, 0xAC, 0x5C, 0x97, 0x62, 0x8D, 0x69, 0xF8, 0x79, 0xB4, 0x7C, 0xA4, 0x7E, 0xA4, 0x81, 0x8D, 0x81, 0xAF, 0x8F, 0xB1, 0x91, 0xB4, 0xA7, 0xCE, 0xB7, 0xB9, 0xDA, 0xFB, 0xED, 0xFB, // BIN 584: 27 pairs
-  0x15, 0x05, 0xE1, 0x0B, 0xA8, 0x39, 0x3D, 0x3B, 0xF0, 0x3C, 0x6A, 0x3E, 0x75, 0x41, 0x8F, 0x50, 0x86, 0x54, 0x80, 0x5E, 0x8A, 0x60, 0x87, 0x64, 0x89, 0x73, 0xA8, 0x7E, 0xAC, 0x82, 0xC4, 0x8D, 0xAC, 0xA4, 0xF4, 0xAD, 0xB8, 0xB5, 0xDA, 0xD8, 0xDC, 0xF5, 0xF7, // BIN 585: 21 pairs
-  0x0C, 0x11, 0x33, 0x26, 0x63, 0x3B, 0x6A, 0x48, 0x6F, 0x4B, 0x50, 0x4D, 0x81, 0x53, 0x7D, 0x59, 0xA1, 0x61, 0xC6, 0x8E, 0xBB, 0x95, 0xD2, 0x97, 0xF0, // BIN 586: 12 pairs
-  0x0C, 0x04, 0xB9, 0x08, 0x22, 0x0B, 0x64, 0x14, 0x66, 0x1C, 0x51, 0x21, 0xEA, 0x23, 0x5A, 0x2B, 0x72, 0x31, 0x63, 0x39, 0x40, 0x4D, 0x7F, 0x7B, 0x83, // BIN 587: 12 pairs
-  0x1B, 0x00, 0x25, 0x03, 0x98, 0x03, 0xDD, 0x0C, 0x7D, 0x12, 0x30, 0x15, 0x45, 0x1D, 0x51, 0x1E, 0x29, 0x27, 0xF0, 0x29, 0x50, 0x2F, 0x62, 0x4F, 0xA4, 0x53, 0x7F, 0x57, 0xA1, 0x5E, 0xC0, 0x69, 0xC0, 0x6F, 0xA0, 0x6F, 0xA1, 0x7A, 0xF8, 0x80, 0xB9, 0x92, 0xAB, 0x95, 0xDA, 0x9C, 0xF9, 0x9F, 0xDD, 0xAC, 0xB1, 0xB3, 0xCE, 0xD9, 0xE8, // BIN 588: 27 pairs
-  0x16, 0x06, 0xD9, 0x09, 0x29, 0x0D, 0x3D, 0x12, 0x2C, 0x2D, 0x54, 0x2F, 0x52, 0x39, 0x5A, 0x57, 0xC6, 0x59, 0x8A, 0x72, 0xC7, 0x75, 0xB2, 0x7C, 0xAC, 0x7C, 0xB4, 0x81, 0xD3, 0x85, 0xD3, 0x8A, 0xD0, 0x8F, 0xB0, 0x93, 0xDB, 0xA4, 0xE0, 0xAF, 0xC3, 0xBB, 0xE7, 0xDB, 0xDC, // BIN 589: 22 pairs
-  0x1F, 0x03, 0xA6, 0x04, 0xE8, 0x0B, 0x15, 0x0B, 0x5C, 0x10, 0x44, 0x12, 0x44, 0x13, 0xB8, 0x20, 0xFC, 0x4A, 0x75, 0x57, 0x7C, 0x5E, 0x7C, 0x60, 0x83, 0x61, 0xAA, 0x62, 0x75, 0x6C, 0xEA, 0x75, 0xD0, 0x80, 0xB7, 0x84, 0xC4, 0x8E, 0xC2, 0x91, 0xBF, 0x92, 0xDA, 0xB1, 0xC7, 0xB4, 0xE7, 0xBA, 0xF6, 0xC2, 0xDF, 0xCC, 0xF3, 0xD2, 0xED, 0xD5, 0xFC, 0xD8, 0xFC, 0xE5, 0xEB, 0xEB, 0xF2, // BIN 590: 31 pairs
-  0x1B, 0x08, 0xD9, 0x09, 0x57, 0x09, 0x68, 0x0E, 0xFF, 0x1A, 0x33, 0x1F, 0x25, 0x2B, 0x77, 0x2F, 0x5E, 0x53, 0x79, 0x55, 0x85, 0x57, 0xA7, 0x5A, 0x83, 0x6E, 0x9F, 0x75, 0xAE, 0x75, 0xB4, 0x83, 0xB7, 0x90, 0xCB, 0x96, 0xD9, 0x99, 0xB1, 0x99, 0xF6, 0x9A, 0xB1, 0x9A, 0xF6, 0x9D, 0xB4, 0xA0, 0xBC, 0xE0, 0xEE, 0xE1, 0xE6, 0xE6, 0xFC, // BIN 591: 27 pairs
-  0x11, 0x0C, 0xF3, 0x16, 0x46, 0x1B, 0x29, 0x1E, 0xEF, 0x30, 0x62, 0x32, 0x4F, 0x3A, 0x48, 0x69, 0xA2, 0x8F, 0xD8, 0x93, 0xDF, 0x9B, 0xE0, 0xA2, 0xC2, 0xA3, 0xA4, 0xB0, 0xE7, 0xB8, 0xE7, 0xCA, 0xF3, 0xD6, 0xEA, // BIN 592: 17 pairs
-  0x1B, 0x03, 0x07, 0x06, 0x22, 0x13, 0xFA, 0x19, 0x28, 0x27, 0x31, 0x29, 0x5B, 0x43, 0x6F, 0x55, 0x81, 0x5E, 0x94, 0x61, 0xC5, 0x62, 0x7A, 0x66, 0xC0, 0x6C, 0x8D, 0x6C, 0xBB, 0x70, 0xEF, 0x71, 0xC3, 0x72, 0xE1, 0x73, 0xA9, 0x74, 0x94, 0x76, 0xA8, 0x8F, 0xF8, 0xB0, 0xD1, 0xB5, 0xDB, 0xD0, 0xF1, 0xD2, 0xF2, 0xD2, 0xF4, 0xD8, 0xF2, // BIN 593: 27 pairs
-  0x14, 0x06, 0x15, 0x15, 0xFE, 0x16, 0x70, 0x24, 0x5A, 0x26, 0x5E, 0x2B, 0x7B, 0x2B, 0xF7, 0x3F, 0x69, 0x43, 0x82, 0x48, 0x4E, 0x4D, 0x84, 0x54, 0x67, 0x54, 0xA4, 0x58, 0xF7, 0x7D, 0xD7, 0x89, 0x92, 0x89, 0xA1, 0x94, 0xB5, 0xA4, 0xB7, 0xBA, 0xC2, // BIN 594: 20 pairs
-  0x15, 0x0A, 0x35, 0x0E, 0x3A, 0x18, 0x5C, 0x19, 0x37, 0x1A, 0x2A, 0x1C, 0x45, 0x1F, 0x54, 0x1F, 0x55, 0x42, 0x43, 0x59, 0xA7, 0x62, 0x8B, 0x78, 0xD0, 0x79, 0xB6, 0x7A, 0xD4, 0x80, 0x9D, 0x80, 0xC0, 0x82, 0xD4, 0xC7, 0xFA, 0xD1, 0xE7, 0xD6, 0xF4, 0xE0, 0xED, // BIN 595: 21 pairs
-  0x0E, 0x0D, 0x50, 0x13, 0xEE, 0x20, 0xF4, 0x36, 0x75, 0x57, 0xC5, 0x6F, 0xA2, 0x71, 0xF7, 0x87, 0xB4, 0xA1, 0xD6, 0xAB, 0xDF, 0xB8, 0xF7, 0xBC, 0xEC, 0xC4, 0xF6, 0xC9, 0xE7, // BIN 596: 14 pairs
-  0x14, 0x0C, 0xBD, 0x0E, 0x37, 0x0E, 0xF5, 0x1C, 0x58, 0x25, 0xF7, 0x33, 0x5D, 0x5A, 0x7E, 0x67, 0x96, 0x6E, 0x87, 0x7B, 0x8E, 0x7F, 0xF8, 0x85, 0x8E, 0x8A, 0xA9, 0x9D, 0xD2, 0xA1, 0xCE, 0xAE, 0xEB, 0xB5, 0xBB, 0xBC, 0xC9, 0xDA, 0xDC, 0xE9, 0xF3, // BIN 597: 20 pairs
-  0x23, 0x0D, 0x40, 0x0D, 0x44, 0x0D, 0x86, 0x0F, 0x5D, 0x27, 0x5A, 0x27, 0x65, 0x28, 0x47, 0x2D, 0x48, 0x42, 0x54, 0x45, 0x65, 0x45, 0x6C, 0x47, 0xEA, 0x54, 0x99, 0x54, 0x9A, 0x5B, 0x77, 0x5B, 0x87, 0x5F, 0xF8, 0x68, 0xCF, 0x6C, 0xCC, 0x77, 0xEF, 0x79, 0xAB, 0x86, 0xAB, 0x99, 0xB0, 0x9A, 0xB0, 0x9B, 0xF8, 0xA5, 0xC1, 0xA9, 0xE9, 0xAB, 0xDD, 0xAB, 0xE5, 0xAC, 0xB0, 0xB6, 0xB8, 0xC8, 0xF3, 0xCE, 0xF2, 0xD2, 0xE4, 0xEA, 0xF5, // BIN 598: 35 pairs
-  0x1F, 0x04, 0x36, 0x06, 0xA8, 0x0A, 0xE4, 0x0B, 0x70, 0x0E, 0x3D, 0x1B, 0x55, 0x25, 0x9E, 0x2B, 0x5A, 0x36, 0x5A, 0x3B, 0xA5, 0x62, 0x7F, 0x69, 0xEA, 0x71, 0xB8, 0x7C, 0xB0, 0x7F, 0xC4, 0x86, 0xE4, 0x87, 0xB8, 0x8C, 0xC1, 0x8E, 0xC4, 0x92, 0xDD, 0x9F, 0xDF, 0xA9, 0xE2, 0xAA, 0xF8, 0xAF, 0xEA, 0xB1, 0xD1, 0xB6, 0xE6, 0xBA, 0xF4, 0xD2, 0xE9, 0xD9, 0xF1, 0xF5, 0xF8, 0xFA, 0xFC, // BIN 599: 31 pairs
-  0x15, 0x00, 0xE3, 0x0F, 0x7F, 0x25, 0x29, 0x2E, 0x3E, 0x39, 0x5B, 0x3C, 0x77, 0x41, 0x51, 0x49, 0x7A, 0x4E, 0x72, 0x52, 0x86, 0x54, 0x8B, 0x55, 0x84, 0x6E, 0xC9, 0x74, 0x8B, 0x81, 0xC4, 0x82, 0x89, 0x83, 0xB4, 0x8B, 0xD7, 0x8E, 0x93, 0x9D, 0xD6, 0xBE, 0xFA, // BIN 600: 21 pairs
-  0x12, 0x06, 0xE3, 0x16, 0xFE, 0x1B, 0x3F, 0x20, 0x8F, 0x2E, 0x6B, 0x32, 0x58, 0x47, 0x9B, 0x47, 0xBD, 0x50, 0x76, 0x59, 0xBD, 0x7A, 0xA3, 0x7C, 0xB6, 0x7E, 0xB7, 0x84, 0xD5, 0xAA, 0xC1, 0xB6, 0xE5, 0xCC, 0xE6, 0xD5, 0xE3, // BIN 601: 18 pairs
-  0x14, 0x00, 0x27, 0x06, 0x71, 0x11, 0x29, 0x12, 0x34, 0x2E, 0x4B, 0x40, 0x70, 0x41, 0xAC, 0x49, 0x78, 0x6B, 0xFF, 0x6D, 0x8D, 0x6D, 0xBA, 0x7A, 0x8E, 0x83, 0xB5, 0x89, 0xA0, 0xA0, 0xD6, 0xB4, 0xE6, 0xC2, 0xE8, 0xC5, 0xCE, 0xD9, 0xE0, 0xE8, 0xEC, // BIN 602: 20 pairs
-  0x18, 0x00, 0x13, 0x01, 0x2E, 0x0D, 0x77, 0x0E, 0x33, 0x1A, 0xA5, 0x1E, 0xFD, 0x20, 0xC6, 0x25, 0x65, 0x2B, 0xA5, 0x2D, 0x41, 0x51, 0x72, 0x55, 0x80, 0x62, 0x64, 0x6F, 0x99, 0x6F, 0x9A, 0x7E, 0xBA, 0x87, 0xBC, 0x8C, 0xDC, 0x8C, 0xF7, 0x8D, 0xA4, 0xB9, 0xD2, 0xCC, 0xDE, 0xDC, 0xDF, 0xE2, 0xFC, // BIN 603: 24 pairs
-  0x18, 0x03, 0x3E, 0x04, 0xFE, 0x08, 0x64, 0x0C, 0x54, 0x0F, 0x4D, 0x3A, 0x41, 0x53, 0x81, 0x55, 0x74, 0x5A, 0x77, 0x5B, 0x6E, 0x68, 0xA2, 0x6B, 0x8E, 0x76, 0x95, 0x98, 0xE0, 0xA0, 0xCE, 0xAA, 0xCB, 0xAD, 0xDE, 0xB1, 0xE8, 0xB4, 0xE5, 0xB5, 0xC8, 0xB5, 0xCA, 0xC2, 0xDD, 0xD1, 0xFD, 0xE4, 0xE8, // BIN 604: 24 pairs
-  0x17, 0x04, 0x26, 0x0A, 0xFB, 0x1A, 0x70, 0x1E, 0x51, 0x22, 0x58, 0x3B, 0x86, 0x47, 0xC6, 0x4B, 0x78, 0x4D, 0x85, 0x4F, 0x79, 0x4F, 0x99, 0x4F, 0x9A, 0x5D, 0xA0, 0x64, 0x91, 0x65, 0x8E, 0x68, 0xCD, 0x6A, 0x9D, 0x6E, 0x8E, 0x77, 0xB5, 0x7D, 0xC4, 0x8D, 0xC8, 0xA8, 0xCE, 0xA8, 0xDE, // BIN 605: 23 pairs
-  0x15, 0x00, 0x24, 0x1C, 0xFF, 0x2F, 0x66, 0x32, 0x54, 0x3A, 0x58, 0x47, 0x62, 0x53, 0x82, 0x54, 0x92, 0x59, 0x5B, 0x5B, 0x71, 0x5E, 0xCC, 0x69, 0x8D, 0x7C, 0xB1, 0x81, 0xF6, 0x88, 0x9F, 0x89, 0xB2, 0x8D, 0x90, 0x8F, 0xEB, 0xB2, 0xE7, 0xBB, 0xDE, 0xC4, 0xF8, // BIN 606: 21 pairs
-  0x1E, 0x02, 0xF0, 0x03, 0xDF, 0x08, 0x70, 0x09, 0xF5, 0x0F, 0xC9, 0x10, 0xED, 0x19, 0x70, 0x1B, 0x1F, 0x21, 0x78, 0x21, 0x93, 0x2C, 0x62, 0x2F, 0x50, 0x32, 0x62, 0x39, 0x81, 0x3C, 0x67, 0x6D, 0xCF, 0x7D, 0xEB, 0x7E, 0xBB, 0x7F, 0x87, 0x7F, 0xD7, 0x8D, 0xBD, 0x8F, 0xDA, 0x91, 0xB6, 0x95, 0xDD, 0x98, 0xEB, 0xBA, 0xE6, 0xC2, 0xF7, 0xCF, 0xF1, 0xDE, 0xF0, 0xF0, 0xF2, // BIN 607: 30 pairs
-  0x16, 0x06, 0xDC, 0x0C, 0x49, 0x0D, 0x15, 0x12, 0xEC, 0x13, 0x2E, 0x20, 0x82, 0x42, 0x4F, 0x49, 0x7D, 0x4B, 0x7A, 0x5A, 0x71, 0x60, 0x97, 0x6F, 0x72, 0x73, 0x9E, 0x7D, 0xD3, 0x81, 0xD5, 0x89, 0xA6, 0x95, 0xBC, 0x99, 0xE0, 0x9A, 0xE0, 0xA5, 0xEE, 0xAF, 0xE8, 0xAF, 0xEB, // BIN 608: 22 pairs
-  0x14, 0x00, 0x2B, 0x04, 0x39, 0x1B, 0xA7, 0x23, 0x5B, 0x26, 0x3C, 0x2D, 0x60, 0x3F, 0x6E, 0x40, 0x4C, 0x40, 0x71, 0x48, 0xAC, 0x5B, 0x80, 0x68, 0xBA, 0x7B, 0xD9, 0x8E, 0xCB, 0x98, 0xBC, 0x9D, 0xE4, 0xA6, 0xC1, 0xAB, 0xC9, 0xC9, 0xF3, 0xD5, 0xF5, // BIN 609: 20 pairs
-  0x12, 0x00, 0xFC, 0x0E, 0xF2, 0x0F, 0x4B, 0x14, 0x61, 0x29, 0x61, 0x32, 0x65, 0x53, 0x85, 0x5E, 0x7E, 0x69, 0xBB, 0x83, 0x93, 0x8F, 0xDD, 0x92, 0xDB, 0x94, 0xCE, 0x95, 0xDB, 0xAB, 0xE6, 0xC6, 0xCE, 0xCB, 0xF2, 0xE2, 0xEA, // BIN 610: 18 pairs
-  0x1C, 0x07, 0x26, 0x07, 0xEA, 0x08, 0x5C, 0x09, 0x3E, 0x0E, 0x29, 0x11, 0xEF, 0x12, 0xEE, 0x14, 0x22, 0x14, 0x63, 0x20, 0xC5, 0x22, 0x4D, 0x36, 0x44, 0x36, 0x5B, 0x53, 0x84, 0x56, 0x7E, 0x59, 0x5A, 0x5B, 0x89, 0x5E, 0x62, 0x74, 0xA9, 0x84, 0xF6, 0x88, 0xBC, 0x8D, 0xCA, 0x97, 0xFF, 0x9F, 0xE0, 0xA9, 0xE5, 0xAB, 0xBE, 0xCC, 0xE5, 0xE5, 0xFC, // BIN 611: 28 pairs
-  0x26, 0x03, 0xD5, 0x05, 0x2E, 0x09, 0x31, 0x0D, 0x8C, 0x10, 0xE9, 0x11, 0xF0, 0x11, 0xFB, 0x14, 0xEA, 0x1D, 0x3F, 0x1D, 0xF7, 0x20, 0xBD, 0x21, 0xAC, 0x2B, 0xEF, 0x3F, 0x6C, 0x49, 0x81, 0x4D, 0x50, 0x55, 0x60, 0x5B, 0x61, 0x5C, 0xF0, 0x5D, 0x94, 0x5D, 0xA1, 0x6A, 0x8A, 0x6D, 0xCD, 0x70, 0x83, 0x79, 0xBB, 0x7B, 0xC2, 0x80, 0xC5, 0x80, 0xC6, 0x85, 0xD5, 0x86, 0xF7, 0x89, 0xC2, 0x91, 0x98, 0x93, 0xB1, 0x9C, 0xE0, 0xA3, 0xDE, 0xBD, 0xCE, 0xBE, 0xE5, 0xD1, 0xD2, // BIN 612: 38 pairs
-  0x12, 0x0C, 0x99, 0x0C, 0x9A, 0x12, 0x2A, 0x17, 0x5C, 0x1A, 0x1F, 0x1B, 0xCC, 0x26, 0x5A, 0x37, 0x47, 0x3D, 0x4C, 0x3D, 0x70, 0x68, 0xC8, 0x68, 0xEB, 0x88, 0xC1, 0x9D, 0xB6, 0xBA, 0xE5, 0xC4, 0xE3, 0xCD, 0xF1, 0xD2, 0xEE, // BIN 613: 18 pairs
-  0x22, 0x03, 0xD3, 0x07, 0x1C, 0x08, 0x15, 0x10, 0x3A, 0x13, 0xFD, 0x15, 0xFD, 0x17, 0x38, 0x1A, 0x4E, 0x20, 0x2C, 0x24, 0x5B, 0x29, 0x5F, 0x2D, 0x5C, 0x2E, 0xFF, 0x3C, 0x7B, 0x47, 0xC5, 0x48, 0xF8, 0x49, 0x50, 0x49, 0x67, 0x51, 0x59, 0x55, 0x7E, 0x58, 0xC7, 0x69, 0xCC, 0x70, 0xB8, 0x79, 0xBA, 0x79, 0xBD, 0x89, 0xC1, 0x94, 0xC1, 0x94, 0xDA, 0x97, 0xEF, 0xA2, 0xB8, 0xA3, 0xB9, 0xB5, 0xD0, 0xBE, 0xCE, 0xC2, 0xD7, // BIN 614: 34 pairs
-  0x18, 0x03, 0xBA, 0x07, 0x1B, 0x14, 0x53, 0x25, 0x5A, 0x26, 0x66, 0x2C, 0x47, 0x31, 0x5E, 0x3E, 0x52, 0x47, 0xF9, 0x56, 0x9B, 0x60, 0xA8, 0x65, 0x97, 0x66, 0xCC, 0x7F, 0xD3, 0x85, 0xEB, 0x87, 0xB6, 0x8B, 0xD5, 0x8E, 0x99, 0x8E, 0x9A, 0x96, 0x98, 0xA6, 0xCB, 0xB2, 0xE6, 0xCB, 0xF1, 0xE2, 0xF6, // BIN 615: 24 pairs
-  0x13, 0x08, 0xDC, 0x09, 0xF1, 0x10, 0x1F, 0x12, 0x37, 0x1B, 0xC0, 0x2A, 0x5D, 0x2E, 0x49, 0x40, 0x72, 0x47, 0x8B, 0x4D, 0x82, 0x54, 0x7E, 0x57, 0x7E, 0x5A, 0x6E, 0x5F, 0xC9, 0x6D, 0xC8, 0x79, 0xB9, 0xB0, 0xE8, 0xB2, 0xE5, 0xD9, 0xF5, // BIN 616: 19 pairs
-  0x19, 0x08, 0xE3, 0x09, 0x66, 0x1D, 0xFD, 0x22, 0x5C, 0x27, 0x3F, 0x27, 0x5B, 0x2B, 0x5B, 0x33, 0x59, 0x38, 0x61, 0x44, 0x73, 0x59, 0xC6, 0x68, 0xCA, 0x6F, 0x96, 0x70, 0xC3, 0x7D, 0x83, 0x7D, 0xA3, 0x82, 0xEA, 0x88, 0x8A, 0x90, 0xB0, 0x96, 0xA6, 0x97, 0xE3, 0x9D, 0xDE, 0xA6, 0xF8, 0xAE, 0xE8, 0xD3, 0xE3, // BIN 617: 25 pairs
-  0x1C, 0x02, 0xE7, 0x04, 0x48, 0x08, 0xF2, 0x0B, 0x3D, 0x0E, 0x40, 0x13, 0x52, 0x16, 0x30, 0x1A, 0x60, 0x1F, 0x56, 0x23, 0x4F, 0x37, 0x5D, 0x4A, 0x65, 0x5A, 0x61, 0x62, 0x68, 0x64, 0x9D, 0x6D, 0xAD, 0x73, 0xA5, 0x79, 0x88, 0x7E, 0x97, 0x82, 0xB7, 0x83, 0xB6, 0x8C, 0xBC, 0x90, 0xA3, 0x93, 0xB0, 0xAD, 0xE8, 0xBB, 0xF9, 0xC3, 0xC4, 0xD7, 0xF5, // BIN 618: 28 pairs
-  0x1C, 0x02, 0xF4, 0x08, 0x7B, 0x09, 0xA4, 0x0B, 0x7B, 0x0E, 0xEF, 0x14, 0x32, 0x1E, 0x31, 0x21, 0x99, 0x21, 0x9A, 0x24, 0x71, 0x25, 0xEF, 0x39, 0x84, 0x3D, 0x71, 0x45, 0x68, 0x45, 0x6D, 0x47, 0x6F, 0x4B, 0x7D, 0x53, 0x7C, 0x67, 0x6E, 0x71, 0x87, 0x76, 0xA2, 0x79, 0xB0, 0x80, 0x88, 0x82, 0xD3, 0xA0, 0xF8, 0xAE, 0xC3, 0xC6, 0xFC, 0xD3, 0xFC, // BIN 619: 28 pairs
-  0x19, 0x08, 0x35, 0x12, 0x42, 0x1F, 0x2B, 0x21, 0x23, 0x22, 0x5A, 0x25, 0x31, 0x25, 0x72, 0x29, 0x3B, 0x3B, 0x67, 0x51, 0x76, 0x5A, 0x87, 0x62, 0x8E, 0x6D, 0xCA, 0x6F, 0x88, 0x74, 0x9F, 0x7A, 0xC4, 0x81, 0xF9, 0x89, 0xC3, 0xB5, 0xD7, 0xB5, 0xDF, 0xC2, 0xCA, 0xC4, 0xF3, 0xD1, 0xF2, 0xD2, 0xF5, 0xE5, 0xF0, // BIN 620: 25 pairs
-  0x19, 0x00, 0x22, 0x05, 0x3B, 0x15, 0x21, 0x18, 0xE1, 0x1D, 0xF0, 0x27, 0x2F, 0x39, 0x44, 0x49, 0x84, 0x57, 0x8A, 0x60, 0x91, 0x6E, 0xC0, 0x6F, 0x9C, 0x75, 0xD4, 0x7B, 0xF7, 0x82, 0xD7, 0x88, 0xB0, 0x92, 0xDF, 0x96, 0xA1, 0x96, 0xD2, 0x97, 0xAF, 0x99, 0xF9, 0x9A, 0xF9, 0xB7, 0xEB, 0xC4, 0xDC, 0xC5, 0xFC, // BIN 621: 25 pairs
-  0x18, 0x0C, 0x93, 0x13, 0xE3, 0x27, 0x45, 0x27, 0xF7, 0x29, 0x2B, 0x2A, 0x57, 0x2D, 0x62, 0x33, 0x57, 0x34, 0x47, 0x3A, 0x56, 0x43, 0xA4, 0x5E, 0xF9, 0x63, 0xC9, 0x66, 0xBB, 0x6C, 0xBA, 0x75, 0xAF, 0x79, 0x9D, 0x7A, 0xD7, 0x7E, 0xA9, 0x89, 0xB3, 0xAF, 0xE5, 0xB8, 0xFF, 0xC2, 0xC8, 0xF9, 0xFE, // BIN 622: 24 pairs
-  0x19, 0x11, 0x44, 0x12, 0x58, 0x18, 0x64, 0x19, 0xFE, 0x1B, 0xA0, 0x1E, 0x60, 0x1E, 0x71, 0x21, 0x2D, 0x27, 0x9E, 0x2A, 0x59, 0x35, 0x6B, 0x39, 0x7D, 0x48, 0x5A, 0x49, 0x7F, 0x57, 0xA6, 0x5E, 0xBB, 0x63, 0xF8, 0x65, 0x96, 0x8D, 0xC1, 0x8E, 0xCE, 0x91, 0xA1, 0x91, 0xA6, 0x9D, 0xE3, 0xA9, 0xEC, 0xC7, 0xD2, // BIN 623: 25 pairs
-  0x17, 0x0B, 0xD9, 0x1B, 0x45, 0x1D, 0x64, 0x25, 0x77, 0x29, 0x62, 0x2E, 0x71, 0x3A, 0x67, 0x3F, 0x68, 0x41, 0x4E, 0x43, 0x93, 0x59, 0xA6, 0x59, 0xC5, 0x5C, 0x89, 0x65, 0x80, 0x79, 0xB1, 0x80, 0xC9, 0x89, 0x9B, 0xAF, 0xE6, 0xB8, 0xD8, 0xBC, 0xE1, 0xC2, 0xD0, 0xC9, 0xCB, 0xCF, 0xFC, // BIN 624: 23 pairs
-  0x16, 0x02, 0x1F, 0x02, 0xFF, 0x03, 0xFB, 0x04, 0x5E, 0x0C, 0xC9, 0x0F, 0x4A, 0x0F, 0x6E, 0x18, 0x38, 0x19, 0x33, 0x2A, 0x62, 0x3B, 0x45, 0x43, 0x9C, 0x5C, 0xE1, 0x8A, 0xBC, 0x93, 0xF6, 0x9E, 0xEE, 0xA5, 0xCB, 0xC9, 0xFC, 0xCA, 0xF1, 0xD8, 0xFB, 0xDC, 0xDD, 0xFE, 0xFF, // BIN 625: 22 pairs
-  0x19, 0x03, 0xDA, 0x05, 0xF3, 0x0C, 0x85, 0x0E, 0xF0, 0x17, 0x29, 0x19, 0xBE, 0x19, 0xEC, 0x20, 0x37, 0x22, 0x53, 0x32, 0x48, 0x3A, 0x64, 0x3E, 0x6F, 0x48, 0x5B, 0x4B, 0x81, 0x7A, 0x87, 0x84, 0xF9, 0x87, 0xA8, 0x89, 0xB4, 0x8F, 0xDB, 0x95, 0xDF, 0x95, 0xEA, 0x9C, 0xB1, 0xB3, 0xE5, 0xC4, 0xF1, 0xD9, 0xFE, // BIN 626: 25 pairs
-  0x15, 0x03, 0xDB, 0x07, 0xE8, 0x14, 0x3A, 0x25, 0x7B, 0x29, 0x63, 0x2E, 0x36, 0x35, 0x4C, 0x44, 0x4C, 0x44, 0x77, 0x66, 0xA2, 0x72, 0xD1, 0x75, 0x83, 0x78, 0x89, 0x7C, 0xBA, 0x8D, 0xCC, 0x99, 0xD2, 0x9A, 0xD2, 0xA1, 0xF8, 0xBB, 0xE6, 0xBC, 0xEE, 0xC0, 0xDE, // BIN 627: 21 pairs
-  0x15, 0x02, 0x22, 0x0B, 0x40, 0x0C, 0x7A, 0x0E, 0x14, 0x19, 0x2A, 0x21, 0xFC, 0x24, 0x6B, 0x31, 0x66, 0x3C, 0x4A, 0x52, 0x6F, 0x5E, 0xEB, 0x5E, 0xF6, 0x6E, 0xBB, 0x74, 0xA8, 0x92, 0xEB, 0x9F, 0xC3, 0xA9, 0xE6, 0xB5, 0xCD, 0xB5, 0xEF, 0xC7, 0xE7, 0xD7, 0xFB, // BIN 628: 21 pairs
-  0x1A, 0x0F, 0x3F, 0x1B, 0x98, 0x1C, 0xFD, 0x23, 0x41, 0x24, 0x65, 0x25, 0xA5, 0x26, 0x5B, 0x27, 0x72, 0x39, 0x7A, 0x41, 0x6F, 0x42, 0x72, 0x4B, 0x65, 0x50, 0x8C, 0x68, 0xD0, 0x68, 0xF6, 0x68, 0xF9, 0x6E, 0xAD, 0x6F, 0xA6, 0x7C, 0xBB, 0x89, 0xAA, 0xA8, 0xEE, 0xAF, 0xE7, 0xC5, 0xF3, 0xD0, 0xFC, 0xD5, 0xF2, 0xE1, 0xF2, // BIN 629: 26 pairs
-  0x16, 0x02, 0x09, 0x04, 0xC6, 0x05, 0x23, 0x07, 0x10, 0x11, 0x26, 0x12, 0xE1, 0x16, 0x2C, 0x16, 0x34, 0x1E, 0xFA, 0x31, 0x3B, 0x37, 0x60, 0x3D, 0x72, 0x4D, 0x65, 0x59, 0x94, 0x5A, 0x80, 0x5B, 0x88, 0x73, 0x94, 0x7D, 0xD5, 0x96, 0xA0, 0x9E, 0xC1, 0xC6, 0xF3, 0xE2, 0xEF, // BIN 630: 22 pairs
-  0x1F, 0x02, 0xE4, 0x0F, 0xF3, 0x10, 0x28, 0x10, 0x30, 0x11, 0xF5, 0x20, 0x34, 0x23, 0x48, 0x34, 0x5D, 0x38, 0x5F, 0x3B, 0x3F, 0x3F, 0x6D, 0x45, 0x60, 0x46, 0x56, 0x4B, 0x7F, 0x53, 0x60, 0x5A, 0x89, 0x62, 0x7D, 0x64, 0x96, 0x78, 0xEA, 0x7A, 0xD3, 0x85, 0x87, 0x8D, 0xCD, 0x8E, 0xC3, 0x90, 0xB1, 0x96, 0xAA, 0xA3, 0xE2, 0xB5, 0xDD, 0xBB, 0xC2, 0xC8, 0xF1, 0xD5, 0xDC, 0xEC, 0xF3, // BIN 631: 31 pairs
-  0x17, 0x0A, 0x1F, 0x0B, 0x44, 0x0E, 0xEE, 0x10, 0x42, 0x10, 0x9E, 0x11, 0x38, 0x2E, 0x70, 0x36, 0x81, 0x3F, 0x67, 0x42, 0x70, 0x4A, 0x78, 0x5D, 0x83, 0x5D, 0xA7, 0x62, 0x85, 0x6C, 0xCF, 0x91, 0xA0, 0x92, 0xD2, 0x96, 0xC4, 0x98, 0xCE, 0xB5, 0xEE, 0xB9, 0xFC, 0xBE, 0xE6, 0xDC, 0xF3, // BIN 632: 23 pairs
-  0x13, 0x00, 0xE6, 0x08, 0x86, 0x09, 0x4F, 0x12, 0x33, 0x1B, 0xA1, 0x25, 0x5B, 0x2F, 0x69, 0x30, 0x47, 0x57, 0xAA, 0x6C, 0xAD, 0x6F, 0xA7, 0x7B, 0xE4, 0x82, 0xBF, 0x8A, 0xD3, 0x8D, 0xC9, 0x8E, 0xA8, 0x8F, 0xDF, 0xC0, 0xE6, 0xC2, 0xD4, // BIN 633: 19 pairs
-  0x17, 0x0D, 0xD9, 0x0E, 0x26, 0x11, 0x42, 0x26, 0x52, 0x32, 0x41, 0x34, 0x60, 0x3F, 0x6F, 0x48, 0x92, 0x4C, 0x67, 0x4F, 0x92, 0x5B, 0x63, 0x65, 0x9E, 0x72, 0xF0, 0x7C, 0xB7, 0x88, 0xFF, 0x8C, 0xEC, 0x8D, 0xB8, 0x9C, 0xB0, 0x9C, 0xF4, 0xA8, 0xB0, 0xBB, 0xE5, 0xCC, 0xFC, 0xF6, 0xFE, // BIN 634: 23 pairs
-  0x1D, 0x00, 0xE5, 0x03, 0x49, 0x04, 0xC5, 0x09, 0xC6, 0x10, 0x2C, 0x1D, 0x45, 0x24, 0x70, 0x2E, 0x53, 0x32, 0x64, 0x3E, 0x81, 0x44, 0x74, 0x46, 0x48, 0x4B, 0x84, 0x59, 0xF8, 0x5F, 0xEA, 0x72, 0x8D, 0x83, 0x99, 0x83, 0x9A, 0x88, 0xB1, 0xA9, 0xBA, 0xB5, 0xD4, 0xB7, 0xEA, 0xB8, 0xE0, 0xB9, 0xE8, 0xCB, 0xEF, 0xCC, 0xF1, 0xE0, 0xE9, 0xE6, 0xF0, 0xEF, 0xF5, // BIN 635: 29 pairs
-  0x1C, 0x01, 0x70, 0x0B, 0x86, 0x0C, 0x15, 0x13, 0x9D, 0x14, 0x69, 0x26, 0x27, 0x30, 0x60, 0x4A, 0x7A, 0x4C, 0x79, 0x4C, 0x93, 0x4D, 0x79, 0x4E, 0x70, 0x58, 0xD1, 0x6D, 0x9F, 0x6D, 0xD0, 0x72, 0x7E, 0x7E, 0xBD, 0x82, 0xB1, 0x90, 0xF7, 0x91, 0xD9, 0x94, 0xDB, 0xB2, 0xC3, 0xB6, 0xF8, 0xC0, 0xF3, 0xC5, 0xE2, 0xCE, 0xF3, 0xE6, 0xF6, 0xE7, 0xF7, // BIN 636: 28 pairs
-  0x12, 0x0B, 0x50, 0x1A, 0x38, 0x38, 0x63, 0x55, 0x73, 0x56, 0x95, 0x57, 0xEA, 0x59, 0xAA, 0x5D, 0x8D, 0x67, 0x97, 0x6C, 0xCD, 0x72, 0xB8, 0x78, 0xC4, 0x78, 0xD4, 0x7D, 0x8E, 0x84, 0xA3, 0x98, 0xD6, 0xCD, 0xFC, 0xD5, 0xFB, // BIN 637: 18 pairs
-  0x11, 0x01, 0x7B, 0x03, 0x26, 0x06, 0x35, 0x17, 0xE1, 0x19, 0x1F, 0x1B, 0xCF, 0x20, 0x30, 0x35, 0x62, 0x4F, 0xB9, 0x63, 0x8D, 0x72, 0x7C, 0x80, 0xC8, 0x82, 0xB0, 0x8A, 0x97, 0x92, 0xF8, 0xC3, 0xE0, 0xE2, 0xF7, // BIN 638: 17 pairs
-  0x1E, 0x00, 0xE7, 0x01, 0x22, 0x04, 0xF2, 0x0C, 0x4D, 0x11, 0xF2, 0x13, 0xA9, 0x16, 0xB3, 0x19, 0x60, 0x1C, 0x36, 0x27, 0x77, 0x2B, 0x31, 0x3E, 0x7A, 0x47, 0xF6, 0x49, 0x85, 0x50, 0x88, 0x51, 0x61, 0x52, 0x88, 0x5E, 0xCF, 0x64, 0x87, 0x65, 0x8D, 0x7F, 0xD5, 0x84, 0xDD, 0x88, 0xD9, 0x91, 0xAA, 0x96, 0xDC, 0xA2, 0xEA, 0xAA, 0xB5, 0xB7, 0xC7, 0xD4, 0xF5, 0xDE, 0xFB, // BIN 639: 30 pairs
-  0x13, 0x07, 0x29, 0x09, 0x81, 0x14, 0x6D, 0x16, 0x28, 0x18, 0x29, 0x46, 0x72, 0x4C, 0x8F, 0x69, 0xBA, 0x6C, 0x9F, 0x6C, 0xC8, 0x6D, 0xB6, 0x86, 0xDC, 0x89, 0xA7, 0x8D, 0xC5, 0x94, 0xCB, 0x95, 0x9D, 0x97, 0xA2, 0xBE, 0xFD, 0xC1, 0xEF, // BIN 640: 19 pairs
-  0x1D, 0x01, 0xF5, 0x04, 0xDD, 0x09, 0x5F, 0x0C, 0x4B, 0x0D, 0x52, 0x10, 0x50, 0x16, 0x7B, 0x16, 0xE9, 0x26, 0x62, 0x2B, 0x86, 0x2C, 0x5D, 0x3E, 0x7D, 0x45, 0x6A, 0x53, 0x74, 0x56, 0x98, 0x5A, 0x63, 0x61, 0xF8, 0x6B, 0xA9, 0x75, 0xEB, 0x80, 0xCC, 0x94, 0xDD, 0xA5, 0xBC, 0xA6, 0xB5, 0xB4, 0xC3, 0xC2, 0xCD, 0xC5, 0xE7, 0xD2, 0xF6, 0xD4, 0xFB, 0xE1, 0xFE, // BIN 641: 29 pairs
-  0x21, 0x02, 0xE6, 0x03, 0xF3, 0x04, 0x43, 0x08, 0x8C, 0x09, 0xC5, 0x0F, 0x2A, 0x10, 0xE4, 0x16, 0x37, 0x17, 0x64, 0x22, 0x5B, 0x2B, 0xE1, 0x2F, 0x68, 0x3C, 0x9E, 0x43, 0x8F, 0x47, 0x98, 0x4E, 0x76, 0x53, 0x80, 0x5B, 0x7B, 0x64, 0xC7, 0x85, 0xBF, 0x86, 0xC1, 0x8C, 0xCB, 0x8D, 0xCF, 0x96, 0xD6, 0x9B, 0xBC, 0xAB, 0xBD, 0xB5, 0xCF, 0xC0, 0xE5, 0xC7, 0xFD, 0xD3, 0xF5, 0xD8, 0xD9, 0xE7, 0xF8, 0xF1, 0xF7, // BIN 642: 33 pairs
-  0x17, 0x01, 0x15, 0x0C, 0x2A, 0x15, 0xFB, 0x1E, 0x26, 0x1E, 0x2F, 0x2D, 0x58, 0x2E, 0x4D, 0x50, 0x9E, 0x61, 0x8D, 0x68, 0xAD, 0x7C, 0x97, 0x89, 0xA5, 0x8D, 0xC6, 0x8D, 0xD0, 0x97, 0xAE, 0x9D, 0xC4, 0xA4, 0xD2, 0xA7, 0xC1, 0xB7, 0xD1, 0xC1, 0xC9, 0xC6, 0xE2, 0xD3, 0xDC, 0xD7, 0xE3, // BIN 643: 23 pairs
-  0x16, 0x04, 0xA4, 0x1C, 0x5C, 0x24, 0x4A, 0x25, 0x3F, 0x27, 0x7B, 0x28, 0x62, 0x36, 0x84, 0x3B, 0x8C, 0x3E, 0x50, 0x46, 0x73, 0x4F, 0x80, 0x4F, 0x8B, 0x52, 0x8C, 0x5A, 0x88, 0x6C, 0xCA, 0x79, 0xC0, 0x80, 0xCA, 0x81, 0xDD, 0x8E, 0xC0, 0x90, 0xEC, 0xA9, 0xF0, 0xCE, 0xEB, // BIN 644: 22 pairs
-  0x19, 0x01, 0x86, 0x09, 0x59, 0x0B, 0x77, 0x10, 0x34, 0x13, 0x44, 0x1B, 0xAA, 0x30, 0x5D, 0x3B, 0xF7, 0x42, 0x71, 0x73, 0x8B, 0x73, 0x9F, 0x76, 0x82, 0x77, 0xC2, 0x8A, 0xB5, 0x8A, 0xD4, 0x97, 0xDE, 0xA1, 0xC1, 0xA8, 0xB1, 0xAE, 0xE5, 0xAE, 0xE6, 0xB1, 0xB9, 0xBA, 0xF9, 0xC3, 0xD8, 0xDE, 0xEB, 0xE1, 0xE2, // BIN 645: 25 pairs
-  0x1A, 0x03, 0x4D, 0x04, 0xDF, 0x05, 0x3C, 0x12, 0xED, 0x14, 0xEB, 0x1F, 0x3B, 0x26, 0x68, 0x27, 0xEF, 0x29, 0x5E, 0x2E, 0x39, 0x37, 0x59, 0x3E, 0x84, 0x50, 0xFF, 0x5E, 0xCD, 0x61, 0xC9, 0x6B, 0x7C, 0x76, 0x9E, 0x79, 0xB7, 0x83, 0xBC, 0xA7, 0xCB, 0xA9, 0xEF, 0xAB, 0xE4, 0xAE, 0xE7, 0xB3, 0xE6, 0xB5, 0xF0, 0xE7, 0xEF, // BIN 646: 26 pairs
-  0x1E, 0x01, 0x64, 0x02, 0xE8, 0x0B, 0xF2, 0x0C, 0x5D, 0x0D, 0x23, 0x16, 0xE4, 0x21, 0x3A, 0x23, 0x54, 0x26, 0x69, 0x2D, 0x56, 0x2D, 0x65, 0x37, 0x65, 0x3F, 0x65, 0x4A, 0x7D, 0x56, 0x8A, 0x6D, 0xB2, 0x70, 0x8E, 0x7C, 0xBD, 0x7E, 0xC0, 0x80, 0xC4, 0x82, 0xD5, 0x85, 0xB7, 0x87, 0xC1, 0x97, 0xE9, 0x9B, 0xD6, 0x9C, 0xD2, 0xA4, 0xB1, 0xBF, 0xF1, 0xC6, 0xE7, 0xDE, 0xF4, // BIN 647: 30 pairs
-  0x1D, 0x06, 0xF5, 0x0B, 0x8C, 0x0C, 0x3F, 0x0C, 0x7F, 0x0E, 0x38, 0x11, 0x14, 0x11, 0xEE, 0x14, 0x6C, 0x15, 0x4A, 0x18, 0x9E, 0x25, 0x2F, 0x41, 0x92, 0x4A, 0x6A, 0x4B, 0x85, 0x4D, 0x6A, 0x4F, 0x7C, 0x51, 0x70, 0x5A, 0x7B, 0x69, 0xCF, 0x6D, 0xB4, 0x75, 0xD7, 0x7B, 0xAB, 0x80, 0xBF, 0x84, 0xD8, 0x89, 0xB6, 0x96, 0xBA, 0xCE, 0xE1, 0xD7, 0xF2, 0xEE, 0xFC, // BIN 648: 29 pairs
-  0x17, 0x00, 0xDC, 0x01, 0x8C, 0x02, 0xE5, 0x08, 0x77, 0x09, 0xAC, 0x0F, 0x8F, 0x10, 0xF2, 0x11, 0x31, 0x16, 0xEE, 0x25, 0x45, 0x26, 0x50, 0x36, 0x7D, 0x46, 0x74, 0x4C, 0x9C, 0x56, 0x67, 0x66, 0xCF, 0x6A, 0x9E, 0x70, 0xF7, 0x7A, 0xEB, 0x7F, 0xEB, 0x88, 0xF0, 0x89, 0x8F, 0x98, 0xF8, // BIN 649: 23 pairs
-  0x18, 0x04, 0x68, 0x09, 0x2A, 0x0A, 0x32, 0x10, 0xA5, 0x12, 0xF2, 0x14, 0x5D, 0x19, 0x4E, 0x1B, 0xA6, 0x1B, 0xCD, 0x1D, 0xFA, 0x28, 0x5D, 0x35, 0x67, 0x46, 0x5D, 0x46, 0x70, 0x4E, 0x59, 0x68, 0xD4, 0x6B, 0x7E, 0x6C, 0x83, 0x74, 0xA3, 0x81, 0xA3, 0x84, 0xDA, 0x89, 0x9E, 0x8B, 0xD8, 0x95, 0xCE, // BIN 650: 24 pairs
-  0x18, 0x03, 0xD8, 0x05, 0x1F, 0x05, 0xFC, 0x06, 0x64, 0x09, 0x84, 0x0A, 0x2D, 0x0B, 0xDC, 0x13, 0x1C, 0x1A, 0xFE, 0x21, 0x82, 0x2F, 0x6C, 0x3A, 0x6A, 0x42, 0x73, 0x4F, 0xAC, 0x69, 0xAD, 0x6B, 0xE1, 0x6D, 0xAE, 0x6E, 0x74, 0x6E, 0xBA, 0x76, 0xA5, 0x87, 0x93, 0x93, 0xE0, 0xB8, 0xD3, 0xBC, 0xC5, // BIN 651: 24 pairs
-  0x18, 0x01, 0xC3, 0x14, 0x55, 0x16, 0x60, 0x1A, 0xBE, 0x1E, 0x70, 0x1E, 0x9E, 0x21, 0xF4, 0x47, 0xA0, 0x54, 0xB9, 0x57, 0x94, 0x57, 0xC9, 0x6F, 0xA3, 0x77, 0xD9, 0x79, 0xC5, 0x79, 0xC6, 0x8C, 0xE9, 0x93, 0xF9, 0x94, 0x97, 0x97, 0xEC, 0xA7, 0xF6, 0xB0, 0xB3, 0xB6, 0xF6, 0xD9, 0xDB, 0xDF, 0xEE, // BIN 652: 24 pairs
-  0x17, 0x02, 0xF9, 0x03, 0x95, 0x06, 0x70, 0x0B, 0xE3, 0x27, 0xA5, 0x31, 0x69, 0x3B, 0xEF, 0x3E, 0x78, 0x43, 0x99, 0x43, 0x9A, 0x44, 0x7B, 0x51, 0x57, 0x5B, 0x5F, 0x5D, 0x6A, 0x63, 0xA2, 0x66, 0xBA, 0x69, 0xCD, 0x8F, 0xAB, 0x94, 0xD6, 0xA1, 0xCB, 0xAB, 0xC5, 0xBC, 0xBD, 0xC2, 0xF2, // BIN 653: 23 pairs
-  0x1B, 0x08, 0x3D, 0x09, 0x6D, 0x0B, 0x23, 0x12, 0x46, 0x14, 0x1C, 0x1C, 0x3E, 0x34, 0x65, 0x37, 0x57, 0x4C, 0x52, 0x4C, 0xA4, 0x53, 0x7E, 0x5D, 0xA6, 0x63, 0xEA, 0x66, 0x8D, 0x68, 0xB6, 0x6E, 0x76, 0x76, 0x78, 0x7C, 0xA9, 0x8E, 0xC8, 0x90, 0xE9, 0x9B, 0xCE, 0xA0, 0xC1, 0xAD, 0xC3, 0xB5, 0xC0, 0xBF, 0xF4, 0xC2, 0xCF, 0xDB, 0xEE, // BIN 654: 27 pairs
-  0x19, 0x0C, 0x4A, 0x0F, 0x78, 0x15, 0x49, 0x18, 0x4E, 0x21, 0xEB, 0x22, 0x60, 0x35, 0x6A, 0x39, 0x78, 0x39, 0x7F, 0x4A, 0x81, 0x4B, 0x6A, 0x54, 0xAC, 0x5D, 0x74, 0x65, 0xA5, 0x6E, 0xCC, 0x6F, 0xAA, 0x7A, 0xD5, 0x81, 0xD8, 0x83, 0xB8, 0x8E, 0x9C, 0x97, 0xBF, 0xA5, 0xAB, 0xB0, 0xB9, 0xB6, 0xF4, 0xC4, 0xF9, // BIN 655: 25 pairs
-  0x1C, 0x04, 0x2F, 0x07, 0x23, 0x07, 0x28, 0x09, 0x4C, 0x0A, 0xF1, 0x22, 0x4C, 0x2B, 0x3F, 0x2E, 0x55, 0x36, 0x7A, 0x3C, 0x4B, 0x47, 0xA7, 0x5E, 0xA2, 0x5E, 0xC8, 0x66, 0xCD, 0x69, 0x9F, 0x6D, 0xEB, 0x6E, 0xAE, 0x7E, 0xB9, 0x81, 0xDA, 0x91, 0x92, 0x96, 0xA7, 0xA4, 0xB0, 0xAD, 0xE7, 0xB6, 0xC3, 0xB8, 0xDA, 0xBD, 0xFC, 0xCE, 0xF5, 0xE5, 0xF6, // BIN 656: 28 pairs
-  0x1C, 0x03, 0x8B, 0x04, 0x29, 0x06, 0x5C, 0x07, 0x17, 0x13, 0xC2, 0x16, 0x77, 0x17, 0x4E, 0x1A, 0x51, 0x21, 0x8F, 0x22, 0x55, 0x24, 0xF0, 0x28, 0x57, 0x34, 0x59, 0x40, 0x43, 0x41, 0x46, 0x47, 0x79, 0x57, 0x5B, 0x5C, 0x91, 0x5E, 0xBA, 0x64, 0xEF, 0x69, 0xC8, 0x74, 0x9E, 0x80, 0xCD, 0x86, 0xEC, 0x94, 0xDF, 0x9E, 0xCB, 0xD6, 0xF6, 0xDB, 0xED, // BIN 657: 28 pairs
-  0x17, 0x05, 0xE3, 0x09, 0x56, 0x10, 0x37, 0x11, 0x13, 0x12, 0x50, 0x16, 0xED, 0x1D, 0xEF, 0x25, 0xE1, 0x28, 0x59, 0x2B, 0x45, 0x30, 0x5C, 0x35, 0x43, 0x5F, 0xC0, 0x69, 0x83, 0x6C, 0xB6, 0x74, 0x95, 0x7F, 0xB7, 0x85, 0xD8, 0x87, 0xBF, 0x87, 0xC2, 0xB8, 0xD5, 0xC1, 0xF2, 0xD9, 0xDA, // BIN 658: 23 pairs
-  0x1E, 0x01, 0x5C, 0x02, 0x24, 0x0E, 0x31, 0x0E, 0x44, 0x11, 0x2F, 0x15, 0x4E, 0x22, 0x43, 0x30, 0x65, 0x34, 0x5C, 0x37, 0x5C, 0x3C, 0xF0, 0x3D, 0x43, 0x43, 0xB9, 0x49, 0x82, 0x4A, 0x7F, 0x5A, 0x5F, 0x5E, 0xCA, 0x71, 0x83, 0x71, 0xE4, 0x7C, 0xB9, 0x7F, 0xBF, 0x8E, 0xCA, 0xAA, 0xF6, 0xB3, 0xFA, 0xB4, 0xF8, 0xB8, 0xBA, 0xC3, 0xF2, 0xDF, 0xED, 0xE3, 0xFB, 0xE6, 0xEA, // BIN 659: 30 pairs
-  0x14, 0x02, 0xE3, 0x0E, 0xFC, 0x2F, 0x3B, 0x60, 0xFF, 0x63, 0xC0, 0x68, 0x8D, 0x6A, 0xA8, 0x71, 0xD9, 0x72, 0xC3, 0x77, 0xAB, 0x8C, 0x8D, 0x99, 0xF4, 0x9A, 0xF4, 0xA9, 0xED, 0xBC, 0xC6, 0xC9, 0xE6, 0xCA, 0xFC, 0xD2, 0xEC, 0xD3, 0xF2, 0xE2, 0xF9, // BIN 660: 20 pairs
-  0x1D, 0x04, 0xBD, 0x0D, 0x32, 0x12, 0xE9, 0x18, 0x71, 0x18, 0xEC, 0x1A, 0x6B, 0x1B, 0xD4, 0x25, 0x26, 0x2B, 0x6A, 0x2C, 0x59, 0x39, 0x85, 0x42, 0x74, 0x4B, 0x82, 0x4F, 0x67, 0x57, 0x5A, 0x60, 0x96, 0x67, 0x9D, 0x69, 0xCA, 0x6C, 0xD0, 0x73, 0xB3, 0x77, 0xF7, 0x8D, 0xCE, 0xA0, 0xCB, 0xAB, 0xC6, 0xAC, 0xD6, 0xB8, 0xDB, 0xBF, 0xF3, 0xC4, 0xD9, 0xC7, 0xF2, // BIN 661: 29 pairs
-  0x13, 0x04, 0xC9, 0x0C, 0x28, 0x10, 0xBE, 0x15, 0xFA, 0x19, 0x7B, 0x1E, 0xE1, 0x21, 0x32, 0x24, 0x3E, 0x41, 0xF9, 0x47, 0xA1, 0x51, 0x63, 0x66, 0xC8, 0x75, 0x8E, 0x86, 0xBC, 0x8D, 0xB9, 0x91, 0xA7, 0xAD, 0xE6, 0xB1, 0xB3, 0xBD, 0xE2, // BIN 662: 19 pairs
-  0x21, 0x04, 0x0E, 0x06, 0x7B, 0x07, 0x2A, 0x09, 0x28, 0x09, 0xBD, 0x0A, 0x3D, 0x0F, 0x38, 0x11, 0x46, 0x17, 0x31, 0x1A, 0xEC, 0x1B, 0x8B, 0x1F, 0x57, 0x29, 0x66, 0x49, 0x65, 0x4E, 0x71, 0x5F, 0x8D, 0x64, 0x83, 0x6C, 0xB2, 0x6D, 0xD4, 0x75, 0xC4, 0x78, 0xD7, 0x80, 0xA9, 0x83, 0xBA, 0x84, 0xDF, 0x85, 0xDD, 0x8A, 0xD7, 0x8D, 0xCB, 0x8E, 0xD2, 0x96, 0xE1, 0xAC, 0xE8, 0xAD, 0xE5, 0xB5, 0xCC, 0xE9, 0xFB, // BIN 663: 33 pairs
-  0x13, 0x04, 0xAC, 0x08, 0x40, 0x0F, 0x28, 0x13, 0x65, 0x1D, 0x60, 0x26, 0x6C, 0x2C, 0x60, 0x2F, 0x6D, 0x41, 0x5A, 0x4A, 0x84, 0x67, 0x8B, 0x6C, 0xAE, 0x75, 0xA3, 0x75, 0xD3, 0x88, 0xCB, 0x93, 0xD2, 0x95, 0xA9, 0xAA, 0xE8, 0xC8, 0xFC, // BIN 664: 19 pairs
-  0x21, 0x04, 0x57, 0x05, 0x35, 0x09, 0xE8, 0x0F, 0xCC, 0x1C, 0xFE, 0x23, 0x5C, 0x2C, 0x57, 0x2E, 0x6A, 0x31, 0x68, 0x33, 0x61, 0x34, 0x57, 0x3B, 0xE1, 0x3E, 0x7F, 0x48, 0x79, 0x55, 0x76, 0x56, 0xA0, 0x60, 0x7C, 0x65, 0x9D, 0x68, 0xB4, 0x6A, 0xA5, 0x6D, 0x83, 0x78, 0xD3, 0x7D, 0xF6, 0x80, 0xCF, 0x84, 0xBF, 0x84, 0xDB, 0x89, 0xCB, 0x8D, 0xC2, 0x90, 0xE3, 0x91, 0xC4, 0x91, 0xD2, 0x95, 0xE0, 0xC3, 0xFA, // BIN 665: 33 pairs
-  0x1D, 0x03, 0x2F, 0x03, 0x4B, 0x07, 0x2F, 0x0E, 0x42, 0x0F, 0x45, 0x10, 0x2A, 0x1A, 0x7B, 0x1C, 0x39, 0x1C, 0xF7, 0x20, 0xC9, 0x33, 0x60, 0x3C, 0x86, 0x47, 0x95, 0x55, 0x8F, 0x66, 0xCA, 0x68, 0xB2, 0x6C, 0xB4, 0x74, 0xA5, 0x74, 0xAB, 0x76, 0xB5, 0x7C, 0xC0, 0x83, 0x84, 0x85, 0xDA, 0x87, 0xBA, 0x91, 0x9B, 0x92, 0x96, 0xA5, 0xDE, 0xC9, 0xF1, 0xE0, 0xE4, // BIN 666: 29 pairs
-  0x1B, 0x02, 0x25, 0x07, 0x22, 0x08, 0x44, 0x09, 0x69, 0x09, 0x9C, 0x0D, 0x6B, 0x0D, 0xDC, 0x0E, 0x2F, 0x0F, 0x15, 0x12, 0xF5, 0x15, 0x4B, 0x1C, 0xFA, 0x32, 0x56, 0x3C, 0x62, 0x40, 0x54, 0x46, 0x71, 0x48, 0x8B, 0x55, 0x8B, 0x6F, 0xA4, 0x73, 0xA3, 0x73, 0xAB, 0x7D, 0x87, 0x8A, 0xD5, 0x90, 0xCE, 0xA9, 0xD8, 0xBD, 0xF3, 0xC1, 0xF1, // BIN 667: 27 pairs
-  0x15, 0x08, 0x50, 0x0D, 0x42, 0x10, 0x46, 0x1B, 0x38, 0x1B, 0xD0, 0x20, 0x92, 0x2B, 0x2F, 0x41, 0x5B, 0x4A, 0x60, 0x5F, 0xA2, 0x66, 0xEB, 0x6E, 0xB2, 0x78, 0xF8, 0x79, 0xC9, 0x81, 0xDF, 0x8B, 0x9D, 0x90, 0x9F, 0x96, 0x9B, 0xA3, 0xD9, 0xAF, 0xDC, 0xD9, 0xDF, // BIN 668: 21 pairs
-  0x0D, 0x17, 0x9E, 0x32, 0x67, 0x38, 0x60, 0x3A, 0x5D, 0x42, 0x56, 0x4D, 0x7C, 0x7E, 0xBF, 0x89, 0xBF, 0x97, 0xD6, 0xA1, 0xB5, 0xC9, 0xDE, 0xD3, 0xFB, 0xD4, 0xE3, // BIN 669: 13 pairs
-  0x1F, 0x00, 0xD9, 0x03, 0xE0, 0x07, 0x36, 0x09, 0x63, 0x0D, 0x72, 0x0D, 0x90, 0x13, 0x3D, 0x13, 0x40, 0x1A, 0x29, 0x1E, 0x3F, 0x30, 0x59, 0x38, 0x65, 0x40, 0x73, 0x42, 0x48, 0x46, 0x6F, 0x4C, 0x99, 0x4C, 0x9A, 0x50, 0x6F, 0x54, 0x8A, 0x5E, 0xD0, 0x60, 0xB3, 0x61, 0x83, 0x61, 0xA2, 0x6B, 0xC7, 0x82, 0xF8, 0x88, 0x94, 0x92, 0xE0, 0x95, 0xB5, 0xAB, 0xE7, 0xBE, 0xE2, 0xC2, 0xFF, // BIN 670: 31 pairs
-  0x12, 0x01, 0x77, 0x0F, 0x53, 0x12, 0x29, 0x17, 0xEC, 0x18, 0xA5, 0x1B, 0xBB, 0x1B, 0xC8, 0x31, 0x6C, 0x43, 0xF8, 0x47, 0xC9, 0x5D, 0xAA, 0x63, 0x83, 0x65, 0xA8, 0x76, 0xB3, 0x81, 0xDB, 0x83, 0x9C, 0x8D, 0xD2, 0xDA, 0xEE, // BIN 671: 18 pairs
-  0x1B, 0x09, 0x6C, 0x0C, 0x38, 0x16, 0x86, 0x19, 0x38, 0x1B, 0x2A, 0x1B, 0xCA, 0x1D, 0xFE, 0x24, 0x4B, 0x3C, 0x53, 0x54, 0x9B, 0x5C, 0x87, 0x62, 0x8F, 0x64, 0xD1, 0x6E, 0x89, 0x6E, 0xB6, 0x71, 0xB5, 0x74, 0x78, 0x74, 0x82, 0x8F, 0xD2, 0x91, 0xBA, 0x95, 0xD6, 0xA9, 0xBB, 0xB5, 0xE8, 0xC3, 0xDA, 0xC9, 0xE5, 0xD4, 0xF2, 0xE4, 0xF3, // BIN 672: 27 pairs
-  0x1A, 0x0E, 0xEC, 0x16, 0x33, 0x16, 0x6B, 0x17, 0x26, 0x19, 0x6B, 0x19, 0x77, 0x22, 0x64, 0x2E, 0x67, 0x3F, 0x60, 0x45, 0x75, 0x51, 0x5F, 0x53, 0x73, 0x56, 0xA1, 0x6B, 0x8D, 0x7E, 0xC5, 0x87, 0x99, 0x87, 0x9A, 0x89, 0xC7, 0x8D, 0xD3, 0x95, 0xC1, 0x98, 0xC1, 0x9E, 0xBC, 0xA2, 0xEB, 0xBD, 0xE7, 0xC3, 0xDB, 0xDA, 0xED, // BIN 673: 26 pairs
-  0x18, 0x02, 0x14, 0x06, 0x86, 0x15, 0xFC, 0x16, 0xA8, 0x1C, 0x4A, 0x23, 0x58, 0x25, 0x86, 0x2A, 0x61, 0x35, 0x71, 0x3C, 0x3E, 0x3C, 0xA5, 0x3D, 0x54, 0x4C, 0x7C, 0x50, 0xA5, 0x52, 0x9E, 0x62, 0x88, 0x78, 0xB7, 0x7D, 0xBF, 0x7D, 0xDD, 0x7E, 0xC6, 0x86, 0x8D, 0xA5, 0xFA, 0xA6, 0xA9, 0xF4, 0xFD, // BIN 674: 24 pairs
-  0x17, 0x04, 0xDB, 0x07, 0x1D, 0x10, 0x5C, 0x14, 0x81, 0x16, 0x2A, 0x1A, 0x77, 0x1E, 0xFE, 0x26, 0x6D, 0x40, 0x4F, 0x5D, 0xBD, 0x66, 0xF9, 0x6B, 0xF0, 0x6E, 0xB4, 0x80, 0x97, 0x97, 0xAD, 0xA3, 0xDC, 0xA9, 0xD3, 0xB0, 0xE4, 0xB3, 0xE2, 0xB4, 0xF6, 0xBB, 0xF3, 0xD7, 0xDC, 0xE6, 0xF9, // BIN 675: 23 pairs
-  0x1C, 0x02, 0x27, 0x04, 0xD4, 0x09, 0xC9, 0x09, 0xFE, 0x0C, 0x6E, 0x0D, 0xE3, 0x15, 0x43, 0x18, 0x31, 0x2E, 0x72, 0x35, 0x70, 0x3C, 0x49, 0x3E, 0x85, 0x4A, 0x85, 0x61, 0x67, 0x61, 0xEA, 0x66, 0xAD, 0x68, 0xAE, 0x69, 0xB6, 0x7D, 0xD8, 0x80, 0xD0, 0x81, 0x83, 0x81, 0xBF, 0x83, 0xBF, 0x8B, 0xDA, 0xB2, 0xF8, 0xB4, 0xF4, 0xC3, 0xE8, 0xDD, 0xEE, // BIN 676: 28 pairs
-  0x15, 0x11, 0xEC, 0x23, 0x60, 0x2B, 0x8C, 0x2F, 0x6E, 0x3A, 0x6B, 0x3B, 0x73, 0x40, 0x77, 0x41, 0xEA, 0x44, 0x54, 0x4B, 0x79, 0x4E, 0x61, 0x54, 0x6A, 0x5D, 0x65, 0x62, 0x81, 0x62, 0x84, 0x68, 0xD7, 0x77, 0x8D, 0x83, 0xBB, 0xB1, 0xE4, 0xC0, 0xFC, 0xC1, 0xF0, // BIN 677: 21 pairs
-  0x16, 0x07, 0x18, 0x09, 0x61, 0x0B, 0x32, 0x24, 0xF7, 0x2D, 0x64, 0x30, 0x57, 0x33, 0x5F, 0x33, 0x65, 0x37, 0x67, 0x47, 0x51, 0x47, 0x80, 0x60, 0x7E, 0x62, 0x70, 0x66, 0xF6, 0x69, 0xD0, 0x77, 0xE4, 0x8A, 0xD2, 0x8B, 0xD2, 0x8B, 0xEA, 0xA9, 0xAA, 0xD8, 0xED, 0xE5, 0xEA, // BIN 678: 22 pairs
-  0x1D, 0x01, 0x35, 0x06, 0x3D, 0x0A, 0x40, 0x0C, 0xCC, 0x15, 0x20, 0x16, 0x1F, 0x19, 0xB3, 0x1E, 0xA5, 0x24, 0x36, 0x3D, 0x4F, 0x4C, 0x80, 0x51, 0x71, 0x59, 0xC9, 0x5C, 0x9D, 0x67, 0x78, 0x68, 0x9F, 0x70, 0xB5, 0x85, 0xB1, 0x86, 0xE9, 0x87, 0xC3, 0x8E, 0xAC, 0x96, 0xBB, 0xA0, 0xB5, 0xA3, 0xC7, 0xA7, 0xB5, 0xB9, 0xD6, 0xBF, 0xD1, 0xC0, 0xF1, 0xCB, 0xF0, // BIN 679: 29 pairs
-  0x14, 0x04, 0xD7, 0x10, 0x33, 0x21, 0xC6, 0x4F, 0x7E, 0x51, 0x6E, 0x54, 0x65, 0x62, 0x94, 0x66, 0xD0, 0x76, 0x92, 0x7D, 0xF9, 0x7E, 0x90, 0x7E, 0xC4, 0x84, 0x8E, 0x97, 0xD2, 0x9D, 0xF0, 0x9E, 0xFA, 0xBF, 0xF6, 0xC0, 0xC2, 0xC2, 0xCC, 0xE0, 0xFE, // BIN 680: 20 pairs
-  0x1D, 0x00, 0x2E, 0x02, 0x23, 0x02, 0xF6, 0x03, 0xB6, 0x04, 0xE0, 0x06, 0x8C, 0x09, 0x49, 0x0E, 0xED, 0x0F, 0xC0, 0x12, 0x38, 0x1B, 0x95, 0x52, 0x54, 0x54, 0x95, 0x5F, 0xCC, 0x60, 0x9D, 0x62, 0x92, 0x6D, 0xAF, 0x75, 0x87, 0x76, 0xB0, 0x76, 0xB8, 0x7E, 0xC9, 0x82, 0xAB, 0x8E, 0xCD, 0x9D, 0xBA, 0x9E, 0xAB, 0xBA, 0xF3, 0xBF, 0xC7, 0xC5, 0xCB, 0xEC, 0xFB, // BIN 681: 29 pairs
-  0x19, 0x04, 0x66, 0x07, 0x31, 0x0A, 0x58, 0x0B, 0x52, 0x0D, 0x60, 0x10, 0xF5, 0x17, 0x71, 0x1B, 0xD7, 0x2A, 0x5F, 0x2B, 0xBE, 0x36, 0x7F, 0x38, 0x5E, 0x38, 0x67, 0x69, 0xAE, 0x69, 0xB2, 0x72, 0xB5, 0x7A, 0xBF, 0x7D, 0xDA, 0x9D, 0xA6, 0xA6, 0xF6, 0xB3, 0xD6, 0xC3, 0xD3, 0xD8, 0xEE, 0xEE, 0xF4, 0xEF, 0xF1, // BIN 682: 25 pairs
-  0x1A, 0x04, 0x31, 0x0F, 0x82, 0x0F, 0xCF, 0x10, 0x52, 0x13, 0x35, 0x17, 0x2F, 0x36, 0x78, 0x39, 0x6F, 0x43, 0x44, 0x50, 0x90, 0x58, 0x9D, 0x61, 0xC0, 0x63, 0xBB, 0x6E, 0xA3, 0x7A, 0xB7, 0x7B, 0xEC, 0x7F, 0x89, 0x83, 0xA8, 0x8C, 0xB0, 0x8C, 0xE3, 0xA3, 0xA8, 0xA8, 0xE5, 0xCB, 0xF5, 0xCB, 0xF7, 0xD6, 0xFB, 0xDD, 0xED, // BIN 683: 26 pairs
-  0x22, 0x00, 0x3B, 0x09, 0x0E, 0x0E, 0x13, 0x0F, 0x33, 0x1F, 0x59, 0x24, 0x49, 0x26, 0x2B, 0x26, 0x3B, 0x3C, 0x55, 0x48, 0x9B, 0x4B, 0x60, 0x4D, 0x80, 0x59, 0xEA, 0x5B, 0x86, 0x5F, 0xBB, 0x69, 0xB4, 0x6D, 0xF6, 0x6E, 0xAF, 0x76, 0x98, 0x7B, 0xDC, 0x7D, 0xB7, 0x7E, 0xC8, 0x7F, 0xD8, 0x85, 0xB0, 0x85, 0xDB, 0x85, 0xF6, 0x87, 0xBB, 0x98, 0xCB, 0x99, 0xAB, 0x9A, 0xAB, 0x9B, 0xF6, 0xAA, 0xE2, 0xAF, 0xD9, 0xC3, 0xD5, // BIN 684: 34 pairs
-  0x1A, 0x01, 0xE5, 0x04, 0x81, 0x0D, 0x2D, 0x20, 0x9B, 0x27, 0x6A, 0x27, 0xE1, 0x33, 0x63, 0x40, 0x74, 0x47, 0xEB, 0x55, 0x93, 0x56, 0xA7, 0x71, 0x8E, 0x72, 0x79, 0x75, 0xD5, 0x7C, 0xC5, 0x7C, 0xC6, 0x7F, 0xB1, 0x84, 0xB7, 0x86, 0xCB, 0x89, 0xBE, 0x8C, 0xA3, 0x8E, 0xCC, 0x94, 0xE0, 0xCB, 0xF3, 0xEA, 0xF2, 0xF4, 0xFA, // BIN 685: 26 pairs
-  0x12, 0x0F, 0xD4, 0x12, 0xFB, 0x1E, 0x6B, 0x2C, 0x5C, 0x2C, 0x65, 0x31, 0x6D, 0x43, 0xAC, 0x4E, 0x57, 0x5C, 0x96, 0x5D, 0x76, 0x60, 0x8E, 0x62, 0x95, 0x63, 0xCC, 0x6C, 0xEB, 0x75, 0xF6, 0x85, 0xDF, 0x8B, 0xBC, 0xB8, 0xDF, // BIN 686: 18 pairs
-  0x0E, 0x0A, 0xBE, 0x14, 0x84, 0x14, 0xB9, 0x19, 0xE9, 0x1E, 0x45, 0x3F, 0x75, 0x6D, 0xF9, 0x78, 0xBF, 0x8A, 0xC1, 0x91, 0xDC, 0x94, 0xC2, 0x95, 0xEB, 0xA7, 0xE8, 0xD5, 0xD9, // BIN 687: 14 pairs
-  0x1B, 0x03, 0x4A, 0x04, 0xDA, 0x08, 0x23, 0x09, 0x75, 0x0C, 0x33, 0x1C, 0xF0, 0x1F, 0x50, 0x21, 0xBD, 0x34, 0x67, 0x36, 0x52, 0x36, 0x85, 0x38, 0x66, 0x3D, 0x73, 0x44, 0xFF, 0x49, 0x6A, 0x4A, 0x82, 0x52, 0xFF, 0x5C, 0x6F, 0x5E, 0xD4, 0x60, 0xBE, 0x6B, 0x79, 0x6E, 0xC8, 0x8E, 0xBD, 0x8F, 0xE0, 0x97, 0xB2, 0x9D, 0xE9, 0xAF, 0xE3, // BIN 688: 27 pairs
-  0x1C, 0x06, 0x40, 0x07, 0xE7, 0x0A, 0x28, 0x0A, 0x9E, 0x0C, 0x45, 0x16, 0x4E, 0x18, 0x26, 0x1F, 0x52, 0x21, 0xC5, 0x25, 0x6A, 0x3B, 0xBE, 0x3C, 0x73, 0x3D, 0x77, 0x53, 0x8F, 0x59, 0x67, 0x5C, 0x83, 0x6E, 0xCF, 0x79, 0xC8, 0x79, 0xCC, 0x7F, 0xB0, 0x82, 0xD8, 0x8E, 0xD0, 0x91, 0xD6, 0x98, 0xB5, 0xB4, 0xDC, 0xBD, 0xCB, 0xC6, 0xCB, 0xD9, 0xDD, // BIN 689: 28 pairs
-  0x10, 0x03, 0xC4, 0x14, 0x75, 0x15, 0x51, 0x16, 0xD1, 0x19, 0xEE, 0x2E, 0x62, 0x32, 0x6A, 0x3E, 0x67, 0x42, 0x5D, 0x4D, 0x8F, 0x6C, 0xD4, 0x6D, 0xD7, 0x7E, 0xCA, 0x91, 0xE1, 0x94, 0xB8, 0xA6, 0xE8, // BIN 690: 16 pairs
-  0x14, 0x03, 0x1F, 0x06, 0x23, 0x07, 0x39, 0x0D, 0xF2, 0x13, 0xB5, 0x1C, 0x64, 0x27, 0x86, 0x29, 0x69, 0x31, 0x6E, 0x41, 0x42, 0x41, 0x8B, 0x49, 0x79, 0x4C, 0x50, 0x5A, 0x86, 0x5B, 0x69, 0x6E, 0xCD, 0x74, 0xA2, 0x96, 0xDE, 0xA9, 0xD5, 0xD0, 0xE3, // BIN 691: 20 pairs
-  0x22, 0x04, 0x3E, 0x08, 0xC3, 0x08, 0xF5, 0x09, 0xDD, 0x0C, 0x8F, 0x0C, 0xD4, 0x10, 0x64, 0x15, 0x50, 0x17, 0xA5, 0x19, 0x51, 0x2A, 0x63, 0x35, 0xFF, 0x37, 0x61, 0x39, 0x52, 0x44, 0x4F, 0x47, 0xA6, 0x56, 0xBD, 0x56, 0xF8, 0x5B, 0x8D, 0x5D, 0x87, 0x71, 0xEC, 0x78, 0xB1, 0x78, 0xD5, 0x7F, 0xDD, 0x81, 0x8E, 0x82, 0x91, 0x95, 0xCB, 0x97, 0xF7, 0x98, 0x9D, 0x9D, 0xA1, 0x9D, 0xAA, 0xD0, 0xF5, 0xD2, 0xF8, 0xE1, 0xE7, // BIN 692: 34 pairs
-  0x17, 0x00, 0xD1, 0x02, 0x2B, 0x06, 0x77, 0x35, 0x4F, 0x3C, 0x4D, 0x3F, 0x6A, 0x41, 0x9B, 0x4C, 0x92, 0x54, 0x98, 0x5C, 0xEF, 0x6E, 0xCA, 0x7E, 0xCC, 0x81, 0xF4, 0x83, 0xC1, 0x8A, 0xD8, 0x8B, 0xDD, 0xA1, 0xA9, 0xA2, 0xC3, 0xA2, 0xE2, 0xB2, 0xDC, 0xB5, 0xF7, 0xC2, 0xF1, 0xF2, 0xFF, // BIN 693: 23 pairs
-  0x20, 0x00, 0x23, 0x00, 0xBE, 0x03, 0xE8, 0x04, 0x9C, 0x08, 0x90, 0x0C, 0xCF, 0x0E, 0x46, 0x11, 0xED, 0x19, 0xE4, 0x24, 0x72, 0x41, 0xF6, 0x4C, 0x8B, 0x4D, 0x60, 0x4D, 0x93, 0x4F, 0x9B, 0x52, 0x90, 0x59, 0x8D, 0x5E, 0xAD, 0x63, 0x67, 0x66, 0xB6, 0x67, 0x94, 0x6F, 0xAC, 0x76, 0xB1, 0x78, 0xB0, 0x79, 0x97, 0x7F, 0xDA, 0x8E, 0xCF, 0xA0, 0xF6, 0xAA, 0xF4, 0xB2, 0xF6, 0xB9, 0xF3, 0xC1, 0xF7, // BIN 694: 32 pairs
-  0x17, 0x01, 0xE6, 0x04, 0x84, 0x09, 0x38, 0x16, 0x8C, 0x2B, 0x67, 0x39, 0xF8, 0x4A, 0x79, 0x62, 0x77, 0x66, 0x9F, 0x69, 0xEB, 0x6A, 0x6E, 0x6C, 0xAF, 0x71, 0xC2, 0x75, 0xF9, 0x79, 0xCA, 0x87, 0xCB, 0x92, 0xBC, 0xA7, 0xF4, 0xA9, 0xC8, 0xCE, 0xEA, 0xD3, 0xD9, 0xDB, 0xE9, 0xE0, 0xEC, // BIN 695: 23 pairs
-  0x1A, 0x01, 0x90, 0x09, 0x3F, 0x0C, 0xDD, 0x0E, 0xF1, 0x19, 0x86, 0x30, 0x67, 0x4E, 0x77, 0x58, 0x91, 0x64, 0xA9, 0x67, 0x82, 0x70, 0xD9, 0x7C, 0xC9, 0x8C, 0xB1, 0x93, 0xAB, 0x9E, 0xDE, 0x9F, 0xDE, 0xA7, 0xF9, 0xA9, 0xCA, 0xB1, 0xEB, 0xB2, 0xF4, 0xB4, 0xE3, 0xB8, 0xBB, 0xC3, 0xDF, 0xC5, 0xF1, 0xD0, 0xFB, 0xE5, 0xF9, // BIN 696: 26 pairs
-  0x16, 0x03, 0x31, 0x04, 0x11, 0x06, 0x44, 0x0F, 0x55, 0x0F, 0xCD, 0x10, 0x71, 0x12, 0x52, 0x18, 0x2F, 0x18, 0x70, 0x20, 0x23, 0x29, 0x68, 0x48, 0x80, 0x58, 0x89, 0x5D, 0xC6, 0x60, 0x79, 0x7B, 0x8D, 0x7B, 0xC1, 0x81, 0xB7, 0x84, 0xF4, 0x93, 0xF4, 0xB6, 0xDC, 0xB8, 0xCA, // BIN 697: 22 pairs
-  0x25, 0x00, 0x1F, 0x04, 0xCC, 0x0B, 0x2D, 0x0B, 0x42, 0x12, 0xE4, 0x18, 0x51, 0x1D, 0x71, 0x23, 0x56, 0x30, 0x58, 0x32, 0x6B, 0x36, 0xF8, 0x43, 0x79, 0x47, 0xAA, 0x55, 0x83, 0x57, 0xF9, 0x64, 0xF7, 0x65, 0x8A, 0x6E, 0xEA, 0x79, 0xA9, 0x7C, 0x90, 0x7D, 0xDB, 0x7D, 0xDF, 0x87, 0xB3, 0x89, 0xCE, 0x8B, 0xDB, 0x8D, 0xD4, 0x9D, 0xEF, 0xA3, 0xD1, 0xA3, 0xE5, 0xAB, 0xAC, 0xAD, 0xF8, 0xAE, 0xDC, 0xB8, 0xC8, 0xBC, 0xF1, 0xBE, 0xD6, 0xCF, 0xFB, 0xD2, 0xF9, // BIN 698: 37 pairs
-  0x1A, 0x07, 0xEE, 0x09, 0x7D, 0x0C, 0xC0, 0x11, 0xFC, 0x13, 0x73, 0x16, 0x72, 0x16, 0xC7, 0x18, 0xEE, 0x1A, 0x72, 0x2D, 0x67, 0x33, 0x5C, 0x35, 0x54, 0x3D, 0xFF, 0x41, 0xBD, 0x53, 0x8B, 0x5A, 0x69, 0x5F, 0x83, 0x64, 0x6F, 0x73, 0x95, 0x8E, 0xB3, 0x8F, 0xF6, 0xAA, 0xC2, 0xB7, 0xE4, 0xBF, 0xF8, 0xC1, 0xC5, 0xC6, 0xF1, // BIN 699: 26 pairs
-  0x0E, 0x17, 0x51, 0x1A, 0x31, 0x1C, 0x4B, 0x24, 0x39, 0x4E, 0x63, 0x57, 0xC0, 0x5B, 0x8E, 0x6C, 0x8E, 0x7A, 0xD8, 0x7E, 0xB5, 0xB3, 0xFD, 0xB6, 0xE3, 0xB8, 0xDD, 0xCE, 0xEF, // BIN 700: 14 pairs
-  0x1E, 0x04, 0xCF, 0x05, 0xDC, 0x05, 0xE6, 0x06, 0xC3, 0x09, 0xDF, 0x0A, 0xA5, 0x0A, 0xE3, 0x0F, 0xD7, 0x1B, 0x28, 0x1B, 0x33, 0x20, 0x2D, 0x2D, 0x47, 0x33, 0x67, 0x3A, 0x47, 0x41, 0x79, 0x42, 0x6F, 0x5B, 0x6C, 0x5B, 0x78, 0x6E, 0xF8, 0x7C, 0xBF, 0x88, 0xEF, 0x8A, 0xCE, 0x91, 0xBB, 0xA1, 0xF6, 0xA9, 0xFF, 0xB0, 0xBE, 0xB8, 0xE8, 0xD1, 0xFE, 0xD4, 0xDC, 0xDF, 0xE9, // BIN 701: 30 pairs
-  0x22, 0x00, 0xE8, 0x03, 0x29, 0x03, 0x53, 0x03, 0xB4, 0x05, 0xE5, 0x09, 0x33, 0x09, 0x54, 0x0C, 0xF1, 0x0F, 0xDD, 0x17, 0xEE, 0x19, 0x29, 0x19, 0xED, 0x1B, 0xFB, 0x1C, 0x49, 0x26, 0x6E, 0x3B, 0x4A, 0x40, 0x7B, 0x41, 0xC6, 0x43, 0x92, 0x4C, 0x65, 0x55, 0x8A, 0x56, 0x94, 0x58, 0x62, 0x5C, 0xC7, 0x5D, 0x73, 0x68, 0xD3, 0x6E, 0x73, 0x82, 0xEB, 0x98, 0xA9, 0x9D, 0xA0, 0xAB, 0xE9, 0xAC, 0xFC, 0xB8, 0xD7, 0xBF, 0xE4, // BIN 702: 34 pairs
-  0x1A, 0x02, 0xE1, 0x04, 0xE7, 0x0A, 0x2C, 0x0B, 0x90, 0x1A, 0xB3, 0x34, 0x58, 0x40, 0xFF, 0x42, 0x77, 0x48, 0xF9, 0x4C, 0xB9, 0x53, 0x93, 0x5E, 0x8D, 0x5E, 0xB6, 0x66, 0xD4, 0x72, 0xAB, 0x79, 0xC4, 0x7A, 0x89, 0x88, 0xA2, 0x8E, 0xA4, 0x8E, 0xC9, 0x97, 0xB4, 0xA0, 0xA9, 0xA8, 0xE6, 0xAB, 0xE1, 0xB2, 0xE3, 0xE2, 0xF0, // BIN 703: 26 pairs
-  0x24, 0x07, 0x2C, 0x0C, 0x78, 0x0C, 0xD7, 0x0D, 0x3A, 0x13, 0x6A, 0x14, 0xF3, 0x18, 0x60, 0x1A, 0x86, 0x1D, 0x36, 0x25, 0xBE, 0x27, 0x4A, 0x34, 0x61, 0x35, 0x72, 0x3D, 0x74, 0x4D, 0x7E, 0x51, 0x77, 0x52, 0xA5, 0x53, 0x76, 0x55, 0x92, 0x5D, 0xC5, 0x66, 0xB2, 0x66, 0xB4, 0x70, 0xE4, 0x74, 0xB3, 0x85, 0xF9, 0x87, 0xC4, 0x89, 0xBA, 0x90, 0xB7, 0x94, 0xEA, 0x9F, 0xE2, 0xB8, 0xD0, 0xBC, 0xEF, 0xBC, 0xF2, 0xBD, 0xC1, 0xD6, 0xFC, 0xF2, 0xF8, // BIN 704: 36 pairs
-  0x10, 0x0A, 0x30, 0x0A, 0x3A, 0x0A, 0xF3, 0x0F, 0x2C, 0x1F, 0xFC, 0x22, 0xFF, 0x5B, 0x8A, 0x61, 0xBB, 0x69, 0xD4, 0x79, 0xBF, 0x7A, 0xDD, 0x9B, 0xC1, 0x9D, 0xEC, 0xA3, 0xE6, 0xCF, 0xF5, 0xD6, 0xFA, // BIN 705: 16 pairs
-  0x20, 0x05, 0xBE, 0x06, 0x50, 0x0C, 0x2C, 0x0F, 0x9B, 0x12, 0x9E, 0x19, 0x72, 0x24, 0x9E, 0x25, 0xFD, 0x2E, 0x4C, 0x37, 0x58, 0x3C, 0x8C, 0x47, 0x4E, 0x6B, 0xD1, 0x6C, 0x87, 0x72, 0x80, 0x72, 0xEF, 0x77, 0x7E, 0x7C, 0xC8, 0x7E, 0xCD, 0x82, 0xDA, 0x8D, 0xD5, 0x8E, 0xD3, 0xA2, 0xDE, 0xA6, 0xC2, 0xA6, 0xE2, 0xA9, 0xDA, 0xA9, 0xE0, 0xAA, 0xF9, 0xBA, 0xF1, 0xCA, 0xE3, 0xD9, 0xF3, 0xEB, 0xFE, // BIN 706: 32 pairs
-  0x0E, 0x09, 0x99, 0x09, 0x9A, 0x0A, 0x44, 0x0C, 0xF5, 0x18, 0xBE, 0x2D, 0x5D, 0x38, 0x69, 0x44, 0x86, 0x47, 0x7C, 0x56, 0xC6, 0x68, 0xAF, 0x85, 0x89, 0xBB, 0xF1, 0xED, 0xFC, // BIN 707: 14 pairs
-  0x19, 0x05, 0x2D, 0x05, 0xE7, 0x0C, 0x53, 0x0D, 0x46, 0x15, 0x41, 0x36, 0x6F, 0x37, 0x5F, 0x48, 0xEA, 0x4B, 0x7C, 0x4C, 0x7E, 0x4F, 0xF8, 0x66, 0x83, 0x6A, 0x8B, 0x73, 0xBE, 0x79, 0xCD, 0x7C, 0xC4, 0x8B, 0xA9, 0xA4, 0xFC, 0xA5, 0xCE, 0xA5, 0xFD, 0xB6, 0xF9, 0xC1, 0xC6, 0xD8, 0xE9, 0xDA, 0xE9, 0xDE, 0xFC, // BIN 708: 25 pairs
-  0x1A, 0x01, 0xDE, 0x0C, 0xCD, 0x0C, 0xDF, 0x0F, 0xD0, 0x12, 0x26, 0x14, 0xA4, 0x15, 0x4D, 0x1B, 0xBA, 0x1D, 0x3E, 0x23, 0x62, 0x25, 0x8C, 0x28, 0x61, 0x29, 0x6C, 0x2C, 0x61, 0x3B, 0x90, 0x48, 0xBD, 0x54, 0x74, 0x66, 0xAE, 0x6D, 0x8E, 0x7A, 0xDA, 0x88, 0xDC, 0x9D, 0xE2, 0xA8, 0xD6, 0xAC, 0xCE, 0xB1, 0xEA, 0xCD, 0xFB, // BIN 709: 26 pairs
-  0x17, 0x00, 0xDE, 0x09, 0x2C, 0x0E, 0xF3, 0x1B, 0xDD, 0x24, 0x53, 0x24, 0xEF, 0x39, 0x82, 0x3B, 0x62, 0x3E, 0x82, 0x41, 0xC5, 0x4E, 0x5F, 0x5A, 0x6C, 0x61, 0xCC, 0x6D, 0xD3, 0x7B, 0xE9, 0x7E, 0xBC, 0x83, 0xC2, 0x88, 0xB7, 0xA4, 0xE8, 0xA8, 0xB7, 0xB0, 0xEB, 0xB1, 0xBE, 0xC8, 0xE3, // BIN 710: 23 pairs
-  0x0F, 0x04, 0x5F, 0x0F, 0x92, 0x15, 0x52, 0x19, 0xA8, 0x2E, 0x77, 0x48, 0x7C, 0x62, 0x91, 0x63, 0x9F, 0x7A, 0xF6, 0x82, 0xDD, 0x87, 0x9C, 0x8D, 0xD7, 0xC5, 0xE6, 0xD6, 0xE1, 0xF0, 0xF5, // BIN 711: 15 pairs
-  0x1C, 0x04, 0x2A, 0x05, 0x32, 0x11, 0x50, 0x27, 0x67, 0x36, 0x50, 0x3B, 0x74, 0x3C, 0xF7, 0x4D, 0x74, 0x63, 0xBA, 0x69, 0x8E, 0x6C, 0xF6, 0x6F, 0x77, 0x70, 0xC2, 0x7A, 0xB1, 0x7C, 0xCA, 0x7C, 0xCC, 0x7F, 0xDB, 0x82, 0x96, 0x88, 0xE4, 0x89, 0xD1, 0x96, 0xE4, 0x9B, 0xCB, 0x9E, 0xFD, 0xA9, 0xD0, 0xC2, 0xFA, 0xC3, 0xDD, 0xCD, 0xF5, 0xD6, 0xF9, // BIN 712: 28 pairs
-  0x19, 0x00, 0x3C, 0x04, 0x6D, 0x04, 0xD5, 0x09, 0xD4, 0x20, 0xFB, 0x21, 0x51, 0x24, 0x77, 0x28, 0x60, 0x37, 0x63, 0x3B, 0xA8, 0x3D, 0x7B, 0x45, 0x5C, 0x45, 0x78, 0x4C, 0x6A, 0x4D, 0x9C, 0x56, 0xA6, 0x57, 0xF6, 0x69, 0xAF, 0x77, 0x7C, 0x83, 0xAC, 0x83, 0xC4, 0x8B, 0xDF, 0x99, 0xD6, 0x9A, 0xD6, 0xBA, 0xC3, // BIN 713: 25 pairs
-  0x11, 0x03, 0xB2, 0x08, 0x32, 0x08, 0x52, 0x09, 0x4B, 0x12, 0x31, 0x1C, 0x60, 0x36, 0x3C, 0x3A, 0x59, 0x4F, 0x52, 0x5A, 0x8D, 0x5E, 0xD7, 0x5F, 0xBA, 0x6A, 0xA9, 0x6C, 0xF9, 0x7E, 0xCF, 0xA7, 0xA9, 0xBF, 0xED, // BIN 714: 17 pairs
-  0x1D, 0x00, 0x04, 0x01, 0x3D, 0x09, 0x11, 0x0B, 0x6B, 0x13, 0x96, 0x21, 0x22, 0x24, 0x4D, 0x38, 0x5C, 0x48, 0xC6, 0x56, 0xC5, 0x58, 0x96, 0x59, 0x83, 0x5E, 0xB4, 0x69, 0x87, 0x6E, 0xD0, 0x76, 0xA1, 0x79, 0xCF, 0x84, 0x87, 0x96, 0xE3, 0x9D, 0xBB, 0xAE, 0xD9, 0xB0, 0xE9, 0xB1, 0xE9, 0xBF, 0xE9, 0xC3, 0xFD, 0xCC, 0xFB, 0xCD, 0xE3, 0xCE, 0xF4, 0xD0, 0xDC, // BIN 715: 29 pairs
-  0x18, 0x00, 0xE2, 0x03, 0x55, 0x04, 0x4F, 0x04, 0xCD, 0x05, 0xD9, 0x0B, 0x72, 0x0B, 0xF5, 0x0E, 0xE9, 0x1D, 0x4A, 0x44, 0x76, 0x55, 0x9C, 0x5A, 0x78, 0x5B, 0x66, 0x5F, 0xCF, 0x69, 0xF6, 0x69, 0xF9, 0x6D, 0xC4, 0x6F, 0x9D, 0x7A, 0xB0, 0x7B, 0xBC, 0x7F, 0xDF, 0x8E, 0xD6, 0xA9, 0xDB, 0xAE, 0xE3, // BIN 716: 24 pairs
-  0x1B, 0x02, 0xE2, 0x0C, 0xE8, 0x0F, 0xDF, 0x14, 0x35, 0x1F, 0x5D, 0x22, 0x4F, 0x24, 0x6A, 0x28, 0x5F, 0x37, 0x6A, 0x49, 0x60, 0x4C, 0xAC, 0x51, 0x79, 0x5E, 0xB2, 0x6B, 0x80, 0x6C, 0xD7, 0x76, 0xAF, 0x7D, 0xB1, 0x7F, 0xF6, 0x86, 0xA3, 0x87, 0xCE, 0x9D, 0xFF, 0xA3, 0xE3, 0xAB, 0xE8, 0xB2, 0xD9, 0xB4, 0xD9, 0xDF, 0xFE, 0xE2, 0xF8, // BIN 717: 27 pairs
-  0x13, 0x01, 0xF1, 0x03, 0xAD, 0x04, 0xD0, 0x0C, 0xD0, 0x17, 0x70, 0x30, 0x61, 0x39, 0x50, 0x39, 0xA4, 0x3B, 0xB3, 0x3C, 0x74, 0x45, 0x7A, 0x4F, 0x95, 0x51, 0x7C, 0x68, 0xD5, 0x6F, 0xAD, 0x76, 0xAE, 0x8E, 0xC5, 0xA9, 0xE7, 0xC6, 0xE6, // BIN 718: 19 pairs
-  0x19, 0x09, 0x4D, 0x0A, 0x34, 0x0D, 0xC3, 0x15, 0x4C, 0x16, 0x38, 0x17, 0x60, 0x1C, 0xEF, 0x2B, 0xB3, 0x2C, 0x67, 0x32, 0x5D, 0x34, 0x5F, 0x48, 0x98, 0x5F, 0x67, 0x63, 0xAD, 0x6A, 0x94, 0x86, 0xE3, 0x8F, 0x91, 0x92, 0xCE, 0xA6, 0xF4, 0xA7, 0xE2, 0xB6, 0xF3, 0xB8, 0xD4, 0xD2, 0xFB, 0xD2, 0xFC, 0xDE, 0xFF, // BIN 719: 25 pairs
-  0x13, 0x07, 0x33, 0x09, 0xD7, 0x12, 0x5C, 0x18, 0xE9, 0x2A, 0x60, 0x2E, 0xF0, 0x46, 0x77, 0x47, 0x5A, 0x57, 0xCC, 0x63, 0xCF, 0x6D, 0x87, 0x76, 0x8F, 0x78, 0xEB, 0x8A, 0xCB, 0x8C, 0xCE, 0x92, 0xD6, 0xA9, 0xF7, 0xB8, 0xCD, 0xC9, 0xFB, // BIN 720: 19 pairs
-  0x1E, 0x04, 0x28, 0x04, 0x59, 0x06, 0xE5, 0x09, 0xCC, 0x0F, 0xCA, 0x18, 0xED, 0x24, 0x7B, 0x25, 0x67, 0x29, 0x6D, 0x2A, 0x5E, 0x46, 0x59, 0x47, 0x5B, 0x4F, 0x98, 0x54, 0xA0, 0x59, 0xC0, 0x5A, 0x8E, 0x5B, 0x8C, 0x5F, 0xCD, 0x68, 0xC4, 0x73, 0x82, 0x76, 0xA0, 0x80, 0xBC, 0x87, 0xA5, 0x8D, 0xC3, 0x8E, 0xC7, 0x97, 0xED, 0xA3, 0xB3, 0xB3, 0xB7, 0xCF, 0xE3, 0xD0, 0xF2, // BIN 721: 30 pairs
-  0x1C, 0x09, 0x93, 0x09, 0xF2, 0x0A, 0x2A, 0x0A, 0xFC, 0x0B, 0xC3, 0x0F, 0xC8, 0x14, 0x7D, 0x19, 0x8C, 0x1E, 0x5A, 0x22, 0x65, 0x2B, 0xFD, 0x2C, 0x5F, 0x4E, 0x6E, 0x50, 0x54, 0x59, 0xA2, 0x5D, 0xA2, 0x62, 0x93, 0x73, 0x78, 0x73, 0xA2, 0x76, 0x7F, 0x7E, 0xD0, 0x83, 0xA4, 0x86, 0xB0, 0x8E, 0xC6, 0x9B, 0xF9, 0x9D, 0xA7, 0x9D, 0xE5, 0xA9, 0xCD, // BIN 722: 28 pairs
-  0x1F, 0x02, 0xDC, 0x03, 0x3F, 0x09, 0x4A, 0x0F, 0xA7, 0x10, 0xB3, 0x11, 0xE9, 0x13, 0x91, 0x1D, 0x5A, 0x1D, 0x70, 0x1E, 0x7B, 0x20, 0xA7, 0x21, 0x92, 0x30, 0x64, 0x3B, 0x88, 0x4D, 0x8B, 0x4D, 0xA4, 0x5A, 0x66, 0x5F, 0xF9, 0x6D, 0xA3, 0x74, 0x92, 0x7D, 0xB0, 0x7E, 0x8C, 0x89, 0x93, 0x9C, 0xAB, 0xA8, 0xE2, 0xB0, 0xEA, 0xBE, 0xF2, 0xC5, 0xE5, 0xCB, 0xEB, 0xD6, 0xFE, 0xDB, 0xE4, // BIN 723: 31 pairs
-  0x12, 0x05, 0xD1, 0x0B, 0x3A, 0x11, 0x58, 0x12, 0xA5, 0x1A, 0xE9, 0x27, 0xFD, 0x2F, 0x75, 0x34, 0x64, 0x37, 0x64, 0x48, 0xC5, 0x49, 0x7C, 0x61, 0x9F, 0x8D, 0xD8, 0xA4, 0xD6, 0xBF, 0xF2, 0xCA, 0xF5, 0xD5, 0xED, 0xE0, 0xFA, // BIN 724: 18 pairs
-  0x21, 0x01, 0x40, 0x08, 0x72, 0x0F, 0x37, 0x1A, 0x26, 0x1A, 0x2F, 0x1F, 0xF9, 0x20, 0x3A, 0x23, 0x47, 0x23, 0x65, 0x2B, 0xA8, 0x2C, 0x58, 0x2D, 0x6A, 0x2E, 0x7B, 0x34, 0x63, 0x34, 0x6A, 0x38, 0x6C, 0x3C, 0xEF, 0x43, 0x8B, 0x49, 0x93, 0x4A, 0x7C, 0x4F, 0x8A, 0x63, 0xCD, 0x68, 0xF4, 0x80, 0xD3, 0x84, 0xB1, 0x89, 0xBB, 0x97, 0xB6, 0xA9, 0xEE, 0xC5, 0xDE, 0xCA, 0xDC, 0xDD, 0xE9, 0xDE, 0xEA, 0xE7, 0xF0, // BIN 725: 33 pairs
-  0x20, 0x02, 0x2E, 0x10, 0xFB, 0x1E, 0x77, 0x23, 0x64, 0x44, 0x6F, 0x4B, 0x80, 0x55, 0x99, 0x56, 0xAA, 0x5A, 0x8A, 0x5E, 0xF4, 0x64, 0x8E, 0x6F, 0x70, 0x73, 0xB8, 0x75, 0xDD, 0x76, 0xBE, 0x77, 0xC1, 0x7A, 0xDB, 0x7A, 0xF9, 0x7E, 0x86, 0x81, 0x87, 0x82, 0xDB, 0x90, 0xDE, 0x95, 0xF8, 0xA5, 0xE5, 0xAE, 0xF8, 0xB5, 0xC9, 0xB5, 0xFF, 0xB7, 0xE9, 0xC4, 0xF5, 0xC6, 0xFB, 0xCB, 0xFA, 0xD5, 0xEE, // BIN 726: 32 pairs
-  0x24, 0x00, 0xC7, 0x05, 0x9E, 0x06, 0x32, 0x0A, 0xD1, 0x0F, 0x34, 0x17, 0xBE, 0x17, 0xED, 0x1A, 0xEE, 0x1E, 0x65, 0x25, 0xFA, 0x28, 0x63, 0x33, 0x5E, 0x38, 0x6E, 0x39, 0x9C, 0x49, 0x8F, 0x55, 0x9A, 0x5C, 0xF7, 0x5F, 0xC8, 0x68, 0x83, 0x6F, 0xAE, 0x79, 0xD0, 0x7C, 0xCD, 0x84, 0xE0, 0x87, 0x9E, 0x89, 0xC4, 0x8A, 0x90, 0x8A, 0xDA, 0x96, 0xC8, 0xAD, 0xDC, 0xAD, 0xF6, 0xB6, 0xD9, 0xB8, 0xF2, 0xC4, 0xF2, 0xC5, 0xFB, 0xD6, 0xF8, 0xD8, 0xE4, // BIN 727: 36 pairs
-  0x1F, 0x01, 0x44, 0x01, 0x50, 0x07, 0x41, 0x10, 0x38, 0x13, 0x22, 0x17, 0xE9, 0x1B, 0xD3, 0x1B, 0xD5, 0x21, 0x4E, 0x27, 0x8C, 0x43, 0x52, 0x4A, 0x74, 0x4B, 0x74, 0x54, 0xA1, 0x55, 0x6B, 0x5D, 0x8E, 0x5E, 0xAE, 0x5F, 0xAD, 0x62, 0x71, 0x6B, 0xB8, 0x71, 0xE9, 0x73, 0xB5, 0x77, 0xDC, 0x77, 0xEC, 0x7A, 0xDF, 0x80, 0xB5, 0x83, 0xC0, 0x8F, 0xF9, 0xA6, 0xF9, 0xB7, 0xF1, 0xCA, 0xFB, // BIN 728: 31 pairs
-  0x1B, 0x04, 0xD8, 0x04, 0xFD, 0x06, 0xE6, 0x07, 0x30, 0x09, 0x23, 0x09, 0xCF, 0x09, 0xDB, 0x0B, 0x60, 0x0C, 0x37, 0x10, 0x29, 0x12, 0x2F, 0x1D, 0x39, 0x1F, 0xFB, 0x2C, 0x63, 0x53, 0x9C, 0x5A, 0x8C, 0x5F, 0x9F, 0x61, 0x87, 0x63, 0xC8, 0x6C, 0xA3, 0x6D, 0xD5, 0x78, 0x91, 0x88, 0xCE, 0xBA, 0xE3, 0xC3, 0xD7, 0xC4, 0xFC, 0xC8, 0xDC, // BIN 729: 27 pairs
-  0x21, 0x06, 0xF1, 0x08, 0x6B, 0x0C, 0x34, 0x1A, 0x65, 0x1A, 0xE4, 0x1B, 0xDF, 0x22, 0x41, 0x27, 0xBE, 0x38, 0x68, 0x39, 0x3C, 0x3A, 0x57, 0x3B, 0x4B, 0x3E, 0x65, 0x43, 0x67, 0x45, 0x7D, 0x47, 0xC0, 0x53, 0x92, 0x5C, 0xD1, 0x5E, 0x9F, 0x63, 0x87, 0x66, 0xD7, 0x76, 0x9B, 0x76, 0xAD, 0x80, 0xD4, 0x8A, 0xB8, 0x8F, 0x96, 0x96, 0xCA, 0x98, 0xF6, 0x9B, 0xB5, 0xA9, 0xD7, 0xC6, 0xE5, 0xC8, 0xF5, 0xED, 0xF4, // BIN 730: 33 pairs
-  0x24, 0x04, 0x69, 0x04, 0xC0, 0x0C, 0x82, 0x0F, 0x30, 0x11, 0xF1, 0x15, 0x48, 0x16, 0x51, 0x17, 0x3F, 0x1A, 0xA8, 0x1F, 0x5F, 0x25, 0x4A, 0x30, 0x6A, 0x38, 0x6A, 0x41, 0x80, 0x41, 0x98, 0x47, 0x8A, 0x48, 0x95, 0x4D, 0x99, 0x4D, 0x9A, 0x57, 0x8D, 0x57, 0xEB, 0x5B, 0x6D, 0x5F, 0xCA, 0x5F, 0xEB, 0x6A, 0xB3, 0x75, 0xBF, 0x75, 0xD8, 0x88, 0xAF, 0x8C, 0xED, 0x9C, 0xD6, 0xA0, 0xE8, 0xA1, 0xE8, 0xB4, 0xF9, 0xC3, 0xF1, 0xD1, 0xF1, 0xE5, 0xFF, // BIN 731: 36 pairs
-  0x1F, 0x04, 0x05, 0x06, 0x90, 0x0A, 0x37, 0x13, 0x42, 0x1A, 0x8C, 0x1B, 0x2C, 0x20, 0xA0, 0x20, 0xCC, 0x22, 0x48, 0x24, 0x55, 0x27, 0x4B, 0x28, 0x5C, 0x30, 0x5F, 0x32, 0x47, 0x39, 0x93, 0x42, 0x7B, 0x51, 0x69, 0x55, 0x5C, 0x56, 0x6A, 0x57, 0xBB, 0x5F, 0xF6, 0x67, 0x9E, 0x81, 0xE0, 0x84, 0xB0, 0x9F, 0xEA, 0xB6, 0xF1, 0xBB, 0xFC, 0xC6, 0xDE, 0xCC, 0xF5, 0xD7, 0xD9, 0xDE, 0xF6, // BIN 732: 31 pairs
-  0x1C, 0x00, 0x9E, 0x01, 0xB8, 0x04, 0x99, 0x04, 0x9A, 0x05, 0x28, 0x0C, 0x30, 0x11, 0xE1, 0x14, 0x1D, 0x19, 0x31, 0x1E, 0xBE, 0x21, 0x46, 0x24, 0x67, 0x27, 0x3E, 0x40, 0x48, 0x47, 0x7E, 0x4E, 0x7B, 0x67, 0x69, 0x69, 0xD7, 0x82, 0xDF, 0x8B, 0xB5, 0x8C, 0x9F, 0x90, 0xED, 0xAA, 0xDE, 0xB8, 0xCF, 0xBD, 0xF1, 0xD1, 0xE8, 0xDA, 0xE4, 0xDF, 0xE4, // BIN 733: 28 pairs
-  0x1D, 0x00, 0x35, 0x04, 0x6C, 0x08, 0x2D, 0x08, 0x42, 0x0C, 0xCA, 0x10, 0xD1, 0x1D, 0x9E, 0x1F, 0x5E, 0x20, 0x98, 0x21, 0x62, 0x2A, 0x65, 0x2A, 0x66, 0x33, 0x66, 0x38, 0x6F, 0x46, 0x76, 0x48, 0xF6, 0x4B, 0x8F, 0x54, 0x83, 0x57, 0xA2, 0x63, 0xCA, 0x7C, 0xB5, 0xA9, 0xC0, 0xBA, 0xDC, 0xC1, 0xF5, 0xC8, 0xFB, 0xD1, 0xF5, 0xD6, 0xEF, 0xDB, 0xFE, 0xE3, 0xF4, // BIN 734: 29 pairs
-  0x1E, 0x00, 0xF4, 0x04, 0xD3, 0x05, 0xA5, 0x07, 0x1E, 0x07, 0x2D, 0x09, 0x85, 0x0A, 0xDC, 0x0C, 0xC8, 0x0C, 0xDB, 0x12, 0xBE, 0x1C, 0x5A, 0x26, 0x75, 0x28, 0x65, 0x29, 0x6E, 0x35, 0x48, 0x3D, 0x48, 0x60, 0x8D, 0x61, 0xBA, 0x6C, 0xD3, 0x71, 0xDC, 0x75, 0xDA, 0x76, 0x7A, 0x78, 0xAB, 0x78, 0xD8, 0x7C, 0xCF, 0x7F, 0xF9, 0x86, 0xB1, 0x92, 0xF6, 0xA8, 0xFA, 0xAD, 0xF4, // BIN 735: 30 pairs
-  0x14, 0x05, 0x3D, 0x07, 0x34, 0x0C, 0x55, 0x19, 0xD1, 0x1E, 0x72, 0x20, 0xC0, 0x24, 0xA5, 0x2E, 0x43, 0x43, 0x80, 0x48, 0xA0, 0x55, 0xA4, 0x5B, 0x82, 0x65, 0xB3, 0x7B, 0x7E, 0x8B, 0xCE, 0xA3, 0xE7, 0xA9, 0xCF, 0xB3, 0xD2, 0xB4, 0xF3, 0xDD, 0xFE, // BIN 736: 20 pairs
-  0x17, 0x00, 0xA5, 0x1D, 0xE1, 0x1E, 0xEC, 0x24, 0xFD, 0x2D, 0x59, 0x3F, 0x7A, 0x45, 0x74, 0x45, 0x81, 0x4B, 0x93, 0x54, 0x94, 0x58, 0xE4, 0x5B, 0x91, 0x60, 0x80, 0x67, 0x6C, 0x6C, 0xC4, 0x70, 0x8D, 0x72, 0xC2, 0x83, 0xC3, 0x8D, 0xD6, 0x8E, 0xD5, 0x9B, 0xF4, 0xA0, 0xF9, 0xAC, 0xBC, // BIN 737: 23 pairs
-  0x15, 0x07, 0x38, 0x09, 0x30, 0x0B, 0x46, 0x1A, 0xED, 0x1F, 0x61, 0x2B, 0x4A, 0x30, 0x63, 0x36, 0x82, 0x40, 0x56, 0x44, 0x9E, 0x47, 0xF4, 0x4D, 0x92, 0x61, 0xAD, 0x72, 0x8A, 0x74, 0x98, 0x81, 0xB1, 0xAA, 0xE7, 0xB1, 0xED, 0xBC, 0xF0, 0xC1, 0xF3, 0xCD, 0xDC, // BIN 738: 21 pairs
-  0x1B, 0x01, 0x23, 0x04, 0x4C, 0x04, 0x56, 0x09, 0x34, 0x09, 0xDA, 0x36, 0xA4, 0x3F, 0x78, 0x49, 0x80, 0x49, 0x9C, 0x52, 0x5D, 0x53, 0x8A, 0x58, 0xEC, 0x67, 0x95, 0x70, 0xAB, 0x75, 0xB7, 0x76, 0xA6, 0x7B, 0xCB, 0x7C, 0x86, 0x7C, 0x8C, 0x87, 0xC0, 0x9D, 0xE6, 0xA0, 0xF4, 0xA1, 0xC2, 0xB7, 0xED, 0xBD, 0xE6, 0xBF, 0xF9, 0xCF, 0xF2, // BIN 739: 27 pairs
-  0x15, 0x02, 0xDE, 0x04, 0x63, 0x09, 0x7A, 0x0A, 0xD9, 0x10, 0x70, 0x18, 0xE4, 0x20, 0x32, 0x2B, 0xFA, 0x2D, 0x6B, 0x2E, 0x9E, 0x47, 0xCC, 0x4F, 0x65, 0x53, 0x83, 0x5A, 0x6D, 0x66, 0xAF, 0x83, 0xCB, 0x9E, 0xCE, 0xB0, 0xED, 0xBE, 0xE7, 0xC3, 0xCA, 0xCE, 0xF7, // BIN 740: 21 pairs
-  0x18, 0x04, 0x75, 0x09, 0x37, 0x0A, 0x42, 0x0C, 0xDA, 0x0F, 0xDB, 0x15, 0xF5, 0x18, 0x3F, 0x21, 0xFB, 0x3B, 0x53, 0x43, 0x7C, 0x45, 0x7F, 0x48, 0x7E, 0x51, 0x66, 0x62, 0x7B, 0x63, 0x8E, 0x67, 0xA8, 0x70, 0xEC, 0x77, 0xBC, 0x8D, 0xA8, 0xA3, 0xE8, 0xA7, 0xC2, 0xA9, 0xD4, 0xC3, 0xC8, 0xC7, 0xFE, // BIN 741: 24 pairs
-  0x18, 0x02, 0x13, 0x04, 0xCA, 0x09, 0xE0, 0x0F, 0xF1, 0x1B, 0x37, 0x1D, 0x6B, 0x1E, 0x5B, 0x31, 0x67, 0x3C, 0xE1, 0x53, 0x99, 0x53, 0x9A, 0x56, 0x83, 0x58, 0xA9, 0x74, 0x7F, 0x91, 0xDE, 0x96, 0xD3, 0xA2, 0xE8, 0xAD, 0xE3, 0xB9, 0xCE, 0xBF, 0xEE, 0xC3, 0xD0, 0xD1, 0xE0, 0xDC, 0xFB, 0xE1, 0xF5, // BIN 742: 24 pairs
-  0x1F, 0x06, 0x2D, 0x09, 0x45, 0x0F, 0xBB, 0x0F, 0xE8, 0x12, 0x64, 0x13, 0xFE, 0x1F, 0x5A, 0x20, 0xA1, 0x21, 0xC9, 0x22, 0x54, 0x25, 0xB3, 0x36, 0xF9, 0x38, 0x6D, 0x4B, 0x7E, 0x4F, 0x6A, 0x51, 0x7B, 0x56, 0x65, 0x56, 0x8D, 0x5E, 0xD3, 0x61, 0x74, 0x68, 0xDD, 0x7D, 0x89, 0x89, 0x99, 0x89, 0x9A, 0x8E, 0xA5, 0x8E, 0xD4, 0x9C, 0xE8, 0xAA, 0xB8, 0xAB, 0xED, 0xBF, 0xF5, 0xCD, 0xF2, // BIN 743: 31 pairs
-  0x25, 0x07, 0x37, 0x09, 0xCD, 0x19, 0xC7, 0x1D, 0x4B, 0x1D, 0x5B, 0x2B, 0x90, 0x31, 0x65, 0x33, 0x6A, 0x3D, 0x56, 0x3F, 0x7D, 0x41, 0xA0, 0x49, 0xA4, 0x54, 0xA7, 0x59, 0xCC, 0x5B, 0x90, 0x61, 0x8E, 0x61, 0xCF, 0x65, 0x6E, 0x6A, 0x78, 0x6F, 0xAF, 0x74, 0xB5, 0x7C, 0xD0, 0x81, 0xB0, 0x87, 0xC7, 0x96, 0xC0, 0x97, 0xE5, 0x99, 0xCE, 0x9A, 0xCE, 0x9B, 0x9D, 0xA1, 0xF4, 0xA1, 0xF9, 0xAB, 0xEC, 0xAF, 0xC7, 0xAF, 0xF8, 0xC2, 0xF5, 0xD6, 0xFD, 0xF3, 0xF7, // BIN 744: 37 pairs
-  0x1F, 0x02, 0x0C, 0x04, 0x7D, 0x04, 0xC8, 0x06, 0x07, 0x0C, 0x9B, 0x0F, 0xA0, 0x0F, 0xD5, 0x0F, 0xDA, 0x1B, 0xF3, 0x1C, 0x4D, 0x31, 0x75, 0x35, 0x41, 0x39, 0xB9, 0x3F, 0x81, 0x42, 0x76, 0x48, 0xA1, 0x4D, 0x73, 0x4F, 0xA0, 0x53, 0x5C, 0x53, 0xA4, 0x57, 0x67, 0x5F, 0xD0, 0x62, 0x98, 0x69, 0xA3, 0x7B, 0x7C, 0x80, 0x90, 0xA6, 0xB8, 0xA9, 0xDF, 0xB4, 0xF1, 0xE4, 0xFB, 0xF7, 0xFB, // BIN 745: 31 pairs
-  0x1C, 0x0C, 0xD5, 0x11, 0x52, 0x14, 0x6E, 0x14, 0x9C, 0x1B, 0xDA, 0x27, 0xFA, 0x2D, 0x57, 0x39, 0xF9, 0x3F, 0x5C, 0x45, 0x84, 0x48, 0xA7, 0x4A, 0x80, 0x51, 0x6C, 0x58, 0xC3, 0x76, 0xC3, 0x7C, 0xBC, 0x7F, 0xAB, 0x83, 0xBD, 0x85, 0xE0, 0x88, 0xAE, 0x8A, 0xC2, 0xA5, 0xE6, 0xAD, 0xD9, 0xBC, 0xEB, 0xCE, 0xFA, 0xCF, 0xDC, 0xD3, 0xED, 0xE6, 0xFF, // BIN 746: 28 pairs
-  0x10, 0x03, 0x45, 0x03, 0xA2, 0x07, 0x47, 0x08, 0xE5, 0x0A, 0x33, 0x0E, 0xE1, 0x14, 0x46, 0x2A, 0x5C, 0x59, 0xBB, 0x63, 0xB6, 0x85, 0xAB, 0x87, 0xAC, 0x8E, 0xD8, 0x97, 0xC4, 0xAC, 0xF3, 0xBD, 0xDE, // BIN 747: 16 pairs
-  0x11, 0x09, 0xC0, 0x11, 0x3F, 0x11, 0xF3, 0x1A, 0x3F, 0x1B, 0x34, 0x20, 0x8B, 0x21, 0x9B, 0x27, 0x49, 0x33, 0x58, 0x46, 0x47, 0x6F, 0xB9, 0x99, 0xE8, 0x9A, 0xE8, 0x9D, 0xD3, 0xA0, 0xC2, 0xC2, 0xC9, 0xE0, 0xFD, // BIN 748: 17 pairs
-  0x16, 0x03, 0x94, 0x09, 0xD0, 0x16, 0x29, 0x1B, 0xDB, 0x1D, 0x49, 0x2B, 0x73, 0x41, 0x7C, 0x41, 0x95, 0x43, 0xF9, 0x44, 0x56, 0x51, 0x7E, 0x61, 0xCD, 0x63, 0xAE, 0x67, 0xA5, 0x6B, 0xC3, 0x78, 0xDA, 0x8A, 0xDB, 0x8B, 0xEB, 0x95, 0x97, 0xAE, 0xF6, 0xC3, 0xD4, 0xCE, 0xF0, // BIN 749: 22 pairs
-  0x1E, 0x06, 0xDE, 0x0C, 0x23, 0x13, 0x74, 0x1F, 0x63, 0x2E, 0xF7, 0x44, 0x8C, 0x46, 0x57, 0x54, 0x73, 0x5B, 0x8B, 0x60, 0xF0, 0x63, 0xD0, 0x63, 0xEB, 0x63, 0xF9, 0x67, 0x7F, 0x71, 0xAB, 0x75, 0xDF, 0x7D, 0xF4, 0x80, 0xD7, 0x83, 0xC8, 0x93, 0xD6, 0x97, 0xE2, 0x9B, 0xA9, 0x9D, 0xD8, 0xA1, 0xE2, 0xB2, 0xF9, 0xB7, 0xF4, 0xB8, 0xFA, 0xBB, 0xC3, 0xCA, 0xF2, 0xE6, 0xF8, // BIN 750: 30 pairs
-  0x22, 0x04, 0x61, 0x06, 0x52, 0x0E, 0x50, 0x0F, 0xF5, 0x17, 0xE4, 0x2C, 0x64, 0x31, 0x6F, 0x36, 0x9C, 0x3B, 0x3E, 0x3B, 0x49, 0x3B, 0x55, 0x41, 0xA7, 0x46, 0x7B, 0x47, 0x94, 0x55, 0x87, 0x56, 0x74, 0x60, 0xE1, 0x63, 0xB2, 0x64, 0xB8, 0x64, 0xC3, 0x6B, 0xEF, 0x74, 0xB8, 0x75, 0xDB, 0x78, 0xDD, 0x79, 0x90, 0x8B, 0xC1, 0x8E, 0xD7, 0x92, 0x9D, 0xA3, 0xEA, 0xA6, 0xDE, 0xB7, 0xF3, 0xB8, 0xC0, 0xBD, 0xE5, 0xF9, 0xFD, // BIN 751: 34 pairs
-  0x1C, 0x03, 0xAE, 0x03, 0xF1, 0x08, 0x60, 0x0A, 0xB3, 0x18, 0x6B, 0x25, 0xA8, 0x31, 0x60, 0x3D, 0x41, 0x40, 0x41, 0x4F, 0x50, 0x53, 0x6B, 0x5A, 0x82, 0x5F, 0xB6, 0x67, 0x7A, 0x67, 0x9F, 0x69, 0xD3, 0x70, 0x7E, 0x74, 0x7A, 0x76, 0x85, 0x88, 0x8B, 0x99, 0xBC, 0x9A, 0xBC, 0x9D, 0xC8, 0xA4, 0xAB, 0xA9, 0xCC, 0xAE, 0xF4, 0xBA, 0xFC, 0xD3, 0xEE, // BIN 752: 28 pairs
-  0x1A, 0x04, 0x93, 0x05, 0x2C, 0x05, 0x40, 0x0A, 0xC7, 0x0D, 0x30, 0x10, 0xC7, 0x14, 0x7A, 0x15, 0x53, 0x19, 0x65, 0x4F, 0xA1, 0x57, 0xCF, 0x59, 0xF9, 0x5B, 0x75, 0x5D, 0xF8, 0x61, 0xC8, 0x66, 0xD3, 0x6E, 0xD4, 0x6F, 0x7B, 0x6F, 0x97, 0x76, 0xBC, 0x78, 0x96, 0x8A, 0xDD, 0x91, 0xC8, 0x9F, 0xA8, 0xA9, 0xDD, 0xAF, 0xD1, // BIN 753: 26 pairs
-  0x16, 0x01, 0xC2, 0x05, 0x58, 0x05, 0xC7, 0x0C, 0x92, 0x0F, 0xAA, 0x0F, 0xD3, 0x35, 0x77, 0x41, 0xA1, 0x4B, 0x9C, 0x52, 0x89, 0x5D, 0xC9, 0x63, 0xB4, 0x74, 0xBE, 0x85, 0xD2, 0x87, 0xC8, 0x8F, 0xBC, 0x91, 0xE4, 0x9D, 0xCA, 0x9D, 0xED, 0x9E, 0xE5, 0xA0, 0xE2, 0xA8, 0xD2, // BIN 754: 22 pairs
-  0x1C, 0x18, 0x7B, 0x1B, 0x30, 0x28, 0x5E, 0x2F, 0x6F, 0x33, 0x69, 0x3E, 0x93, 0x3F, 0x84, 0x43, 0x9B, 0x46, 0x61, 0x4A, 0x73, 0x50, 0xA8, 0x50, 0xF0, 0x52, 0x56, 0x54, 0x76, 0x54, 0x8D, 0x5A, 0x90, 0x63, 0x74, 0x69, 0xC4, 0x6A, 0x9F, 0x6C, 0xD5, 0x70, 0x7C, 0x8B, 0xE0, 0x8E, 0xD1, 0x90, 0xAF, 0x96, 0xD0, 0xCC, 0xE3, 0xD5, 0xE9, 0xDB, 0xEC, // BIN 755: 28 pairs
-  0x26, 0x01, 0x72, 0x01, 0xE7, 0x02, 0x28, 0x06, 0xFB, 0x08, 0xE6, 0x09, 0x5D, 0x0F, 0xA1, 0x14, 0xAC, 0x17, 0x45, 0x19, 0x26, 0x27, 0x36, 0x39, 0x8F, 0x40, 0x86, 0x4C, 0x9B, 0x58, 0x87, 0x5A, 0x91, 0x6A, 0x82, 0x74, 0x8F, 0x76, 0xB7, 0x76, 0xC7, 0x77, 0xE9, 0x82, 0xD2, 0x83, 0xB3, 0x83, 0xCA, 0x83, 0xCE, 0x8A, 0xD6, 0x8E, 0x9E, 0x94, 0xEB, 0x95, 0xC2, 0x96, 0xCD, 0x9B, 0xE8, 0xB2, 0xF3, 0xB3, 0xE7, 0xB8, 0xCC, 0xC8, 0xF2, 0xD4, 0xD9, 0xDA, 0xFE, 0xDD, 0xE4, // BIN 756: 38 pairs
-  0x20, 0x05, 0x30, 0x09, 0xD5, 0x0C, 0xA7, 0x19, 0x2F, 0x1C, 0x5B, 0x1F, 0xF8, 0x20, 0xCF, 0x2A, 0x67, 0x2C, 0x6A, 0x36, 0x93, 0x3A, 0x61, 0x3E, 0xA4, 0x44, 0x48, 0x45, 0x73, 0x47, 0xFC, 0x4B, 0x73, 0x4C, 0xF8, 0x4E, 0x79, 0x4E, 0x7C, 0x4F, 0xBD, 0x51, 0x83, 0x55, 0x95, 0x5B, 0x5E, 0x5E, 0xD5, 0x61, 0xCA, 0x63, 0xF6, 0x8E, 0xB9, 0x91, 0xCA, 0xB5, 0xF2, 0xB9, 0xFB, 0xBB, 0xE3, 0xBE, 0xFE, // BIN 757: 32 pairs
-  0x16, 0x00, 0xB3, 0x0C, 0xD3, 0x16, 0x90, 0x1A, 0x5A, 0x32, 0x59, 0x39, 0x99, 0x39, 0x9A, 0x40, 0x6F, 0x45, 0x79, 0x55, 0x8D, 0x56, 0xEA, 0x5E, 0xAF, 0x5F, 0x87, 0x5F, 0xB2, 0x61, 0x6A, 0x75, 0x89, 0x80, 0xD5, 0x86, 0xED, 0x96, 0xD8, 0xBC, 0xF7, 0xD7, 0xEE, 0xE3, 0xFC, // BIN 758: 22 pairs
-  0x13, 0x06, 0x42, 0x09, 0x7F, 0x13, 0x76, 0x25, 0x4B, 0x2A, 0x69, 0x45, 0x85, 0x48, 0x67, 0x49, 0x74, 0x49, 0x7E, 0x54, 0xF8, 0x5B, 0x7A, 0x5C, 0xA9, 0x5D, 0x9F, 0x5F, 0xAE, 0x62, 0x9B, 0x87, 0xCA, 0x9C, 0xFC, 0xAF, 0xF4, 0xBC, 0xF3, // BIN 759: 19 pairs
-  0x27, 0x02, 0xD9, 0x08, 0x3A, 0x0C, 0xE0, 0x0F, 0x23, 0x0F, 0x98, 0x1D, 0x65, 0x20, 0xAA, 0x24, 0xE1, 0x25, 0x3E, 0x27, 0x53, 0x3E, 0x9C, 0x40, 0x5D, 0x41, 0xEB, 0x42, 0x59, 0x49, 0x99, 0x49, 0x9A, 0x4A, 0x7E, 0x57, 0xCD, 0x5D, 0x89, 0x5F, 0xB4, 0x7D, 0xE0, 0x86, 0x9F, 0x8B, 0xF8, 0x8C, 0xDE, 0x8F, 0xD6, 0x92, 0xC1, 0x9F, 0xD9, 0x9F, 0xEB, 0xA5, 0xB0, 0xB9, 0xE7, 0xBE, 0xD2, 0xC0, 0xFB, 0xC1, 0xFA, 0xC9, 0xF5, 0xD6, 0xF7, 0xD7, 0xED, 0xDF, 0xEC, 0xF6, 0xFD, 0xF8, 0xFE, // BIN 760: 39 pairs
-  0x13, 0x0E, 0x58, 0x12, 0x14, 0x13, 0xC1, 0x1D, 0xA5, 0x21, 0x42, 0x2F, 0x67, 0x37, 0x5E, 0x3F, 0x7F, 0x44, 0x5D, 0x61, 0x76, 0x62, 0x96, 0x66, 0x8E, 0x68, 0xDA, 0x7B, 0xA3, 0x87, 0xA4, 0x90, 0x94, 0xAF, 0xF6, 0xC3, 0xCD, 0xF0, 0xF1, // BIN 761: 19 pairs
-  0x18, 0x07, 0x3E, 0x0E, 0x3F, 0x12, 0x71, 0x14, 0x42, 0x15, 0x4F, 0x15, 0xF9, 0x16, 0xF2, 0x17, 0xF2, 0x1A, 0x45, 0x26, 0xF8, 0x3E, 0x6A, 0x43, 0x50, 0x4A, 0x8F, 0x4B, 0xA4, 0x57, 0x83, 0x5A, 0x5E, 0x6F, 0xAB, 0x77, 0xA3, 0x7B, 0xE3, 0x87, 0xBE, 0x8D, 0xDA, 0xA6, 0xE7, 0xAB, 0xB9, 0xC2, 0xFD, // BIN 762: 24 pairs
-  0x16, 0x04, 0xFA, 0x0C, 0xBB, 0x0D, 0xF5, 0x18, 0xB3, 0x1C, 0x53, 0x1F, 0x5B, 0x20, 0xA6, 0x22, 0x62, 0x22, 0xFD, 0x4F, 0xA7, 0x54, 0xBD, 0x5E, 0x83, 0x68, 0xA3, 0x6F, 0x90, 0x73, 0xC7, 0x76, 0xAA, 0x76, 0xC2, 0x77, 0x79, 0x91, 0xE3, 0xBD, 0xFB, 0xC4, 0xED, 0xE8, 0xF7, // BIN 763: 22 pairs
-  0x1F, 0x01, 0xFB, 0x02, 0x35, 0x04, 0x38, 0x04, 0x49, 0x05, 0x2A, 0x0A, 0xE5, 0x0F, 0xA6, 0x13, 0xDE, 0x14, 0x85, 0x18, 0x45, 0x1E, 0x86, 0x33, 0x64, 0x36, 0xB9, 0x3A, 0x70, 0x3C, 0x4C, 0x4A, 0x5C, 0x57, 0xBA, 0x5A, 0x75, 0x65, 0xBE, 0x6D, 0xDD, 0x86, 0xCE, 0x88, 0x95, 0x8B, 0xD6, 0x8E, 0xBE, 0x91, 0xC0, 0x97, 0xE6, 0x98, 0xC2, 0xA3, 0xEB, 0xB2, 0xF1, 0xC3, 0xF5, 0xC7, 0xE0, // BIN 764: 31 pairs
-  0x22, 0x07, 0x19, 0x0A, 0x50, 0x0A, 0xE6, 0x0B, 0x30, 0x0D, 0x2C, 0x0D, 0x34, 0x11, 0x36, 0x12, 0x4E, 0x18, 0x77, 0x24, 0x62, 0x28, 0x58, 0x2F, 0x81, 0x35, 0x56, 0x3A, 0x6F, 0x3C, 0xBE, 0x4A, 0x93, 0x4C, 0x74, 0x54, 0x60, 0x5C, 0x8E, 0x66, 0x87, 0x68, 0xD8, 0x6B, 0x8A, 0x72, 0xD9, 0x72, 0xF7, 0x76, 0xA7, 0x84, 0xD2, 0x85, 0xF4, 0x90, 0xA2, 0x9F, 0xC7, 0xB3, 0xF2, 0xB7, 0xBE, 0xC1, 0xEB, 0xC7, 0xE8, 0xD0, 0xD9, // BIN 765: 34 pairs
-  0x1A, 0x04, 0x33, 0x0E, 0x36, 0x1A, 0xD1, 0x1F, 0x66, 0x22, 0x6B, 0x24, 0xFA, 0x28, 0x67, 0x37, 0x66, 0x48, 0x8A, 0x4C, 0x8A, 0x51, 0x5E, 0x52, 0x83, 0x58, 0xB8, 0x5B, 0x7F, 0x61, 0xF9, 0x62, 0x99, 0x62, 0x9A, 0x67, 0x6D, 0x6E, 0xC4, 0x74, 0xB0, 0x7E, 0xD3, 0x87, 0xD2, 0x89, 0xD2, 0x9F, 0xDC, 0xB0, 0xEC, 0xBB, 0xDC, // BIN 766: 26 pairs
-  0x16, 0x02, 0x2D, 0x05, 0x3A, 0x07, 0x43, 0x07, 0xDF, 0x07, 0xED, 0x12, 0xF1, 0x13, 0x46, 0x18, 0xF2, 0x2B, 0x4B, 0x37, 0x6B, 0x3A, 0x72, 0x3B, 0x4D, 0x3D, 0x86, 0x5E, 0xC4, 0x5F, 0x8E, 0x66, 0xC4, 0x68, 0xDF, 0x6F, 0x86, 0x7E, 0xC1, 0x96, 0xD5, 0xB1, 0xEC, 0xE3, 0xEB, // BIN 767: 22 pairs
-  0x1B, 0x08, 0xDE, 0x16, 0x65, 0x26, 0x81, 0x27, 0xB3, 0x2C, 0x5E, 0x2F, 0x65, 0x3E, 0x79, 0x3E, 0x8F, 0x40, 0x76, 0x41, 0xC9, 0x45, 0x6B, 0x45, 0x82, 0x4B, 0x8B, 0x59, 0xF6, 0x61, 0xAE, 0x61, 0xB6, 0x67, 0x75, 0x68, 0x8E, 0x6A, 0xBE, 0x6F, 0xB2, 0x78, 0xDB, 0x8B, 0x97, 0x92, 0xF9, 0x9D, 0xD5, 0xA2, 0xF8, 0xA7, 0xE7, 0xC4, 0xD1, // BIN 768: 27 pairs
-  0x1D, 0x00, 0x09, 0x01, 0x6B, 0x02, 0x3B, 0x04, 0x2C, 0x05, 0xE8, 0x08, 0xB8, 0x10, 0x31, 0x14, 0xF5, 0x1B, 0xD8, 0x20, 0x62, 0x20, 0xCD, 0x23, 0x5D, 0x28, 0x66, 0x3D, 0x5D, 0x44, 0x88, 0x44, 0xA5, 0x4F, 0xC6, 0x54, 0xA6, 0x57, 0xC8, 0x59, 0x74, 0x5A, 0x8B, 0x73, 0x92, 0x8A, 0xDF, 0x8C, 0xB7, 0x8F, 0xF4, 0xAA, 0xE6, 0xB9, 0xE2, 0xD8, 0xEC, 0xDA, 0xEC, // BIN 769: 29 pairs
-  0x1B, 0x07, 0x1A, 0x07, 0xE6, 0x09, 0xCA, 0x0E, 0xE4, 0x10, 0x26, 0x14, 0x2E, 0x16, 0xD9, 0x1B, 0x79, 0x1E, 0x4A, 0x24, 0x86, 0x32, 0x57, 0x34, 0x6B, 0x42, 0xFF, 0x4C, 0x60, 0x4E, 0x69, 0x56, 0xC9, 0x5F, 0xD4, 0x66, 0xD5, 0x7E, 0xB8, 0x87, 0xBD, 0x8F, 0xCE, 0x92, 0xB5, 0x95, 0xB8, 0x9C, 0xCE, 0xC7, 0xF1, 0xCC, 0xF2, 0xE5, 0xF8, // BIN 770: 27 pairs
-  0x21, 0x01, 0x32, 0x05, 0x34, 0x05, 0xB3, 0x06, 0x72, 0x07, 0x32, 0x07, 0x48, 0x07, 0xDD, 0x17, 0x6B, 0x2A, 0x68, 0x32, 0x70, 0x34, 0x5E, 0x37, 0x6F, 0x39, 0x67, 0x3C, 0x88, 0x3C, 0x90, 0x47, 0xCF, 0x49, 0x8B, 0x5B, 0x68, 0x61, 0xB2, 0x63, 0x76, 0x66, 0x67, 0x69, 0xD5, 0x70, 0xDC, 0x75, 0xB1, 0x77, 0xCB, 0x79, 0xB5, 0x96, 0xCF, 0x96, 0xE2, 0x98, 0xF9, 0xA5, 0xB1, 0xAC, 0xE2, 0xBA, 0xD9, 0xF9, 0xFA, // BIN 771: 33 pairs
-  0x1B, 0x09, 0xC8, 0x0F, 0xE0, 0x10, 0xE3, 0x1B, 0xB6, 0x2E, 0x4F, 0x2E, 0xA5, 0x30, 0x6B, 0x3E, 0x60, 0x47, 0xBB, 0x4C, 0x95, 0x57, 0xCA, 0x59, 0x6A, 0x5A, 0x7A, 0x61, 0xEB, 0x65, 0xA9, 0x65, 0xFF, 0x67, 0xA9, 0x79, 0xBC, 0x83, 0xCC, 0x92, 0xCB, 0xA7, 0xDE, 0xBC, 0xF5, 0xC1, 0xFF, 0xC3, 0xCF, 0xCA, 0xD9, 0xD1, 0xD8, 0xE1, 0xF1, // BIN 772: 27 pairs
-  0x26, 0x01, 0x52, 0x04, 0x23, 0x04, 0x3F, 0x08, 0x46, 0x08, 0xF1, 0x0A, 0x29, 0x0D, 0x88, 0x10, 0xA8, 0x11, 0xE4, 0x1A, 0xC7, 0x1C, 0x71, 0x21, 0x35, 0x27, 0x4D, 0x33, 0x6C, 0x33, 0x6F, 0x35, 0x7B, 0x38, 0x58, 0x43, 0x7E, 0x4B, 0x99, 0x4B, 0x9A, 0x51, 0x80, 0x61, 0xD0, 0x62, 0x86, 0x6B, 0xB5, 0x73, 0xB0, 0x74, 0xA1, 0x7A, 0xAB, 0x7B, 0xB0, 0x88, 0xAD, 0x92, 0xA9, 0xA1, 0xB8, 0xA4, 0xCE, 0xB7, 0xF6, 0xC4, 0xC7, 0xC4, 0xE4, 0xC4, 0xFB, 0xCB, 0xFD, 0xD5, 0xE4, // BIN 773: 38 pairs
-  0x21, 0x00, 0x2D, 0x01, 0x07, 0x05, 0xDE, 0x1E, 0x3E, 0x24, 0x4C, 0x2B, 0x3E, 0x2B, 0x88, 0x3A, 0x71, 0x3E, 0xF8, 0x40, 0x9E, 0x4D, 0x76, 0x50, 0x89, 0x51, 0x6D, 0x52, 0x87, 0x62, 0x9C, 0x68, 0xDB, 0x72, 0xA3, 0x74, 0x85, 0x76, 0xB2, 0x78, 0xDF, 0x7F, 0xD2, 0x81, 0xD2, 0x8B, 0xCB, 0x94, 0xC3, 0x98, 0xE8, 0x9D, 0xD0, 0x9E, 0xE6, 0xA2, 0xE5, 0xAA, 0xE5, 0xAE, 0xC7, 0xBF, 0xEC, 0xCE, 0xF6, 0xD3, 0xE9, // BIN 774: 33 pairs
-  0x25, 0x06, 0x3A, 0x09, 0xD3, 0x11, 0x4E, 0x14, 0xFE, 0x15, 0xF7, 0x1B, 0x80, 0x25, 0x49, 0x26, 0xF9, 0x32, 0x71, 0x33, 0x68, 0x35, 0x73, 0x3D, 0x6F, 0x43, 0xEA, 0x45, 0x64, 0x59, 0x87, 0x61, 0xB4, 0x61, 0xF6, 0x63, 0x6A, 0x66, 0xF4, 0x6A, 0x95, 0x6C, 0x74, 0x75, 0xB0, 0x75, 0xF4, 0x77, 0x80, 0x7F, 0x91, 0x7F, 0xE0, 0x83, 0xA5, 0x88, 0xF7, 0x96, 0xCC, 0x9D, 0xF7, 0xA2, 0xE6, 0xA4, 0xF3, 0xC4, 0xE9, 0xC7, 0xF5, 0xC8, 0xD9, 0xDF, 0xFA, 0xF6, 0xFA, // BIN 775: 37 pairs
-  0x1D, 0x01, 0xE2, 0x07, 0x16, 0x0A, 0x46, 0x0B, 0x2C, 0x0C, 0xD8, 0x0D, 0x28, 0x0D, 0x37, 0x10, 0x4E, 0x14, 0x3D, 0x17, 0x7B, 0x1A, 0x5B, 0x25, 0x90, 0x27, 0x39, 0x27, 0xA8, 0x29, 0x60, 0x29, 0x65, 0x2E, 0x86, 0x33, 0x6E, 0x3F, 0x85, 0x4D, 0xB9, 0x5E, 0xDD, 0x69, 0x74, 0x6D, 0xD8, 0x70, 0xE9, 0x75, 0x76, 0x83, 0xCD, 0x91, 0xD3, 0x93, 0xCE, 0xA8, 0xFD, // BIN 776: 29 pairs
-  0x24, 0x06, 0x6B, 0x07, 0xE0, 0x0D, 0x97, 0x0F, 0xD8, 0x14, 0x7F, 0x1B, 0x94, 0x1E, 0x36, 0x20, 0xD4, 0x27, 0x62, 0x2A, 0x6C, 0x2C, 0x66, 0x2E, 0x54, 0x2E, 0x73, 0x2F, 0x84, 0x34, 0x66, 0x3A, 0x5F, 0x4F, 0xC5, 0x59, 0xBA, 0x63, 0xD4, 0x64, 0x7C, 0x6C, 0x76, 0x6D, 0xDA, 0x6D, 0xF4, 0x83, 0xC9, 0x90, 0xAE, 0x93, 0xBC, 0x96, 0xF0, 0x9F, 0xE5, 0xA2, 0xE7, 0xA8, 0xBF, 0xB3, 0xBF, 0xB5, 0xBD, 0xB7, 0xEE, 0xC0, 0xF5, 0xCB, 0xEA, 0xDE, 0xF9, // BIN 777: 36 pairs
-  0x22, 0x03, 0xAF, 0x05, 0x09, 0x09, 0x2D, 0x09, 0xD8, 0x0B, 0x34, 0x1C, 0x43, 0x20, 0x95, 0x27, 0x55, 0x2E, 0xEF, 0x3A, 0x73, 0x3D, 0x9E, 0x41, 0x7E, 0x46, 0x63, 0x49, 0x92, 0x4D, 0x8A, 0x4E, 0x66, 0x52, 0xA8, 0x55, 0x9B, 0x58, 0xD9, 0x59, 0x9F, 0x59, 0xCF, 0x5A, 0x68, 0x5D, 0x60, 0x60, 0xA9, 0x67, 0x92, 0x6F, 0xBD, 0x74, 0xA0, 0x74, 0xB1, 0x79, 0xD3, 0x7E, 0xD4, 0x98, 0xF4, 0xA3, 0xBE, 0xB0, 0xE1, 0xC2, 0xF3, // BIN 778: 34 pairs
-  0x18, 0x00, 0x32, 0x04, 0x85, 0x10, 0xD9, 0x10, 0xF1, 0x13, 0xCB, 0x1F, 0xFE, 0x2F, 0x7D, 0x3A, 0x63, 0x3B, 0x76, 0x41, 0x44, 0x48, 0xA6, 0x54, 0xC6, 0x59, 0xEB, 0x63, 0xAF, 0x6F, 0x71, 0x71, 0x8D, 0xAC, 0xE7, 0xB1, 0xF1, 0xB5, 0xC5, 0xB9, 0xF1, 0xC0, 0xE3, 0xCB, 0xFF, 0xCC, 0xDC, 0xEB, 0xEE, // BIN 779: 24 pairs
-  0x18, 0x0A, 0xE7, 0x0F, 0xBA, 0x10, 0x7B, 0x16, 0x31, 0x20, 0x51, 0x25, 0x73, 0x26, 0x84, 0x27, 0x73, 0x2B, 0x62, 0x2F, 0x60, 0x38, 0x64, 0x4C, 0x98, 0x4F, 0x74, 0x5A, 0x7F, 0x69, 0x76, 0x6E, 0xD7, 0x73, 0x98, 0x73, 0xC3, 0x74, 0x9B, 0x76, 0x7D, 0x80, 0xD2, 0x83, 0x9E, 0x9D, 0xC0, 0x9D, 0xCD, // BIN 780: 24 pairs
-  0x15, 0x01, 0x97, 0x02, 0x2A, 0x03, 0x2A, 0x05, 0x14, 0x0C, 0x0E, 0x15, 0xFF, 0x29, 0x75, 0x2B, 0xEC, 0x39, 0xAC, 0x47, 0xCD, 0x48, 0xC9, 0x79, 0xD4, 0x7D, 0xD2, 0x83, 0xC5, 0x87, 0xCD, 0x87, 0xD1, 0x8A, 0x8C, 0xAD, 0xF9, 0xC4, 0xEE, 0xE8, 0xEF, 0xEE, 0xF6, // BIN 781: 21 pairs
-  0x1D, 0x02, 0x3C, 0x06, 0xB8, 0x09, 0xE7, 0x0B, 0x28, 0x0B, 0xE5, 0x0C, 0xA0, 0x29, 0x67, 0x2F, 0x7A, 0x36, 0x8F, 0x36, 0x99, 0x36, 0x9A, 0x3A, 0x74, 0x45, 0x7C, 0x4A, 0x9C, 0x4F, 0x94, 0x50, 0x5D, 0x51, 0x88, 0x55, 0x64, 0x64, 0x7E, 0x68, 0x87, 0x6F, 0x8C, 0x80, 0xC1, 0x87, 0xCC, 0x89, 0x9C, 0x89, 0xD9, 0x91, 0xCD, 0x9F, 0xE6, 0xB7, 0xEC, 0xB8, 0xF1, // BIN 782: 29 pairs
-  0x14, 0x02, 0x32, 0x05, 0x44, 0x13, 0x67, 0x17, 0xB3, 0x1E, 0xB3, 0x25, 0x36, 0x30, 0x5E, 0x42, 0x47, 0x4B, 0x92, 0x66, 0xA3, 0x6C, 0x89, 0x76, 0xC1, 0x83, 0xC6, 0x91, 0xD0, 0xA0, 0xB8, 0xA5, 0xE2, 0xA7, 0xB8, 0xAC, 0xCB, 0xAE, 0xD1, 0xB1, 0xEE, // BIN 783: 20 pairs
-  0x24, 0x00, 0xF9, 0x03, 0x38, 0x05, 0x37, 0x05, 0xE2, 0x05, 0xF4, 0x06, 0xE7, 0x0C, 0x2D, 0x0E, 0x52, 0x14, 0x24, 0x14, 0xC6, 0x17, 0xF5, 0x19, 0x3F, 0x1F, 0xF6, 0x23, 0x67, 0x25, 0xEC, 0x2B, 0x49, 0x2D, 0x61, 0x34, 0x6F, 0x37, 0x69, 0x41, 0xFC, 0x46, 0x5F, 0x4B, 0x5C, 0x50, 0xBE, 0x57, 0xD0, 0x58, 0x83, 0x59, 0xCD, 0x5F, 0x74, 0x67, 0x85, 0x6F, 0xB4, 0x82, 0xF6, 0x89, 0xC0, 0x8D, 0xDB, 0x90, 0xD6, 0xB9, 0xBC, 0xDB, 0xFA, 0xDD, 0xEC, // BIN 784: 36 pairs
-  0x19, 0x04, 0x0A, 0x04, 0x54, 0x0C, 0xAA, 0x14, 0x4E, 0x1B, 0x6F, 0x1C, 0x4C, 0x23, 0x59, 0x2B, 0x74, 0x32, 0x72, 0x36, 0x67, 0x3C, 0xA8, 0x43, 0xF6, 0x4D, 0xAC, 0x4E, 0x6C, 0x4E, 0x86, 0x54, 0xAA, 0x5D, 0xC0, 0x74, 0x75, 0x9C, 0xBC, 0xB1, 0xE1, 0xB5, 0xF1, 0xB7, 0xF8, 0xCB, 0xF4, 0xD2, 0xE1, 0xD4, 0xEE, // BIN 785: 25 pairs
-  0x1C, 0x07, 0x0B, 0x0F, 0x2D, 0x14, 0x51, 0x15, 0x1B, 0x15, 0x47, 0x19, 0x90, 0x1F, 0x68, 0x20, 0xD0, 0x23, 0x57, 0x25, 0x53, 0x3D, 0x76, 0x3E, 0x99, 0x3E, 0x9A, 0x41, 0xA6, 0x43, 0xBD, 0x5B, 0x96, 0x6A, 0xA3, 0x6B, 0xAB, 0x71, 0xC1, 0x72, 0x9F, 0x73, 0xB1, 0x77, 0xB0, 0x7B, 0xB1, 0x9F, 0xD1, 0xBC, 0xEA, 0xC5, 0xF5, 0xD8, 0xFE, 0xE9, 0xFC, // BIN 786: 28 pairs
-  0x19, 0x03, 0xBF, 0x07, 0x08, 0x07, 0xE5, 0x10, 0x2F, 0x14, 0x93, 0x14, 0x99, 0x14, 0x9A, 0x17, 0x77, 0x1E, 0xEE, 0x22, 0x71, 0x26, 0x7D, 0x42, 0x86, 0x4E, 0x88, 0x54, 0xC5, 0x59, 0xAD, 0x6D, 0xBF, 0x6E, 0xD3, 0x82, 0xE0, 0x83, 0xCF, 0x88, 0xEC, 0x91, 0x93, 0xB0, 0xEE, 0xB5, 0xC6, 0xC7, 0xD8, 0xD4, 0xED, // BIN 787: 25 pairs
-  0x23, 0x02, 0x2C, 0x02, 0xEB, 0x02, 0xF8, 0x09, 0x22, 0x11, 0x45, 0x12, 0xFC, 0x14, 0x40, 0x20, 0xF3, 0x2A, 0x58, 0x2B, 0x53, 0x42, 0x57, 0x43, 0x98, 0x48, 0xAA, 0x4E, 0x7E, 0x51, 0x87, 0x53, 0x95, 0x55, 0x98, 0x57, 0xAD, 0x5C, 0x7C, 0x5E, 0xFC, 0x62, 0x9F, 0x62, 0xA0, 0x65, 0x8B, 0x6D, 0xDF, 0x7B, 0xED, 0x7D, 0xAB, 0x80, 0xD8, 0x83, 0xB9, 0x83, 0xD0, 0x8E, 0xDA, 0x9E, 0xB0, 0xC6, 0xF5, 0xCD, 0xD9, 0xD1, 0xDB, 0xD3, 0xE4, // BIN 788: 35 pairs
-  0x19, 0x01, 0x2D, 0x04, 0x7A, 0x15, 0xF2, 0x1D, 0x4D, 0x21, 0x6F, 0x30, 0x66, 0x31, 0x81, 0x49, 0x73, 0x4E, 0x83, 0x50, 0xB3, 0x56, 0x76, 0x61, 0x65, 0x62, 0xA1, 0x78, 0xF6, 0x7A, 0xE0, 0x90, 0xBF, 0x96, 0xE9, 0x97, 0xEE, 0x99, 0xFC, 0x9A, 0xFC, 0x9F, 0xE8, 0xC3, 0xFE, 0xD2, 0xFA, 0xEF, 0xF3, 0xF5, 0xFF, // BIN 789: 25 pairs
-  0x18, 0x08, 0x97, 0x09, 0x53, 0x0B, 0x37, 0x0C, 0xFE, 0x10, 0xDC, 0x18, 0x86, 0x19, 0x5A, 0x1B, 0xB4, 0x20, 0x22, 0x20, 0xC8, 0x22, 0xFE, 0x25, 0xFE, 0x33, 0x6D, 0x36, 0xF6, 0x41, 0xF4, 0x4A, 0xA4, 0x58, 0xE9, 0x59, 0xC8, 0x5F, 0xAF, 0x77, 0x8A, 0x80, 0x8C, 0x87, 0xD0, 0xB0, 0xF1, 0xB7, 0xF2, // BIN 790: 24 pairs
-  0x1C, 0x07, 0x24, 0x0C, 0xA1, 0x0D, 0xB8, 0x14, 0x17, 0x14, 0xC5, 0x1D, 0xEC, 0x20, 0xBB, 0x20, 0xCA, 0x21, 0xA7, 0x2A, 0x6D, 0x35, 0x74, 0x36, 0x3B, 0x3C, 0x76, 0x3F, 0x74, 0x49, 0xB9, 0x55, 0x94, 0x6C, 0xDD, 0x6D, 0xDB, 0x79, 0x86, 0x79, 0x8C, 0x7C, 0xD3, 0x84, 0x89, 0x89, 0xC8, 0x8E, 0xD9, 0x9D, 0xDA, 0xA6, 0xE6, 0xCE, 0xFD, 0xEA, 0xFE, // BIN 791: 28 pairs
-  0x17, 0x03, 0x8A, 0x03, 0xF5, 0x09, 0x6E, 0x0B, 0xE6, 0x15, 0x55, 0x18, 0x72, 0x19, 0xF2, 0x22, 0xF7, 0x2A, 0x6E, 0x39, 0xF6, 0x43, 0xC6, 0x4F, 0xA6, 0x4F, 0xEA, 0x61, 0x73, 0x69, 0x89, 0x83, 0xD2, 0x85, 0x91, 0x88, 0xE3, 0x93, 0xE8, 0x98, 0xB8, 0x98, 0xE2, 0xA8, 0xAF, 0xD1, 0xDA, // BIN 792: 23 pairs
-  0x1B, 0x00, 0x28, 0x03, 0x80, 0x0A, 0x71, 0x11, 0x39, 0x18, 0xF5, 0x1B, 0xE0, 0x21, 0x8B, 0x3C, 0xB3, 0x41, 0xAA, 0x48, 0xEB, 0x4A, 0x8B, 0x51, 0x86, 0x53, 0x87, 0x54, 0x87, 0x67, 0x8F, 0x6E, 0xEB, 0x73, 0x7F, 0x77, 0x9F, 0x7F, 0x96, 0x86, 0x8A, 0x87, 0xC9, 0x87, 0xCF, 0x8A, 0xEA, 0x8C, 0xEE, 0x97, 0xBA, 0xAC, 0xC1, 0xB2, 0xC7, // BIN 793: 27 pairs
-  0x16, 0x0A, 0x38, 0x0A, 0x5C, 0x1C, 0x55, 0x27, 0x90, 0x28, 0x69, 0x3E, 0xB9, 0x42, 0x61, 0x43, 0x95, 0x4B, 0x76, 0x55, 0xAC, 0x59, 0x76, 0x59, 0xCA, 0x5D, 0xEA, 0x6A, 0xAB, 0x6F, 0xB6, 0x76, 0xB4, 0x7A, 0xF4, 0x80, 0x86, 0x9D, 0xCF, 0xA1, 0xDE, 0xCE, 0xFE, 0xD7, 0xE9, // BIN 794: 22 pairs
-  0x25, 0x01, 0x42, 0x02, 0x0F, 0x04, 0xBB, 0x05, 0x33, 0x09, 0x8F, 0x0D, 0x4E, 0x0E, 0x39, 0x13, 0x32, 0x13, 0xE5, 0x1B, 0xC4, 0x1E, 0x8C, 0x21, 0x98, 0x25, 0x62, 0x26, 0x7A, 0x34, 0x69, 0x3B, 0xFD, 0x3F, 0x82, 0x41, 0x8A, 0x47, 0xC8, 0x48, 0x52, 0x50, 0x83, 0x56, 0x73, 0x59, 0x65, 0x59, 0x8E, 0x67, 0xA3, 0x6E, 0x91, 0x72, 0xE4, 0x7A, 0xD2, 0x81, 0xFC, 0x88, 0xE9, 0x91, 0xD8, 0x93, 0x96, 0x9B, 0xE2, 0xA6, 0xE5, 0xCB, 0xFE, 0xCE, 0xFB, 0xDF, 0xFD, // BIN 795: 37 pairs
-  0x1B, 0x07, 0xDB, 0x09, 0x1C, 0x10, 0x60, 0x1B, 0x8A, 0x1B, 0xAD, 0x1C, 0x70, 0x20, 0x6F, 0x20, 0xD7, 0x28, 0x64, 0x43, 0x65, 0x4A, 0x76, 0x50, 0x56, 0x51, 0x68, 0x52, 0x7C, 0x5B, 0x7D, 0x67, 0x7D, 0x74, 0xAE, 0x76, 0x93, 0x79, 0x7B, 0x7E, 0xD7, 0x89, 0xCA, 0x8D, 0xDD, 0x92, 0xF4, 0x96, 0xD7, 0x96, 0xE5, 0xBF, 0xFC, 0xD6, 0xF0, // BIN 796: 27 pairs
-  0x22, 0x04, 0x4B, 0x06, 0x60, 0x07, 0x3F, 0x09, 0xFD, 0x0B, 0x1F, 0x0C, 0xA6, 0x12, 0xB3, 0x13, 0x89, 0x1A, 0x90, 0x1C, 0x21, 0x1D, 0x53, 0x1E, 0xE9, 0x21, 0xA0, 0x22, 0x56, 0x24, 0x43, 0x30, 0x6F, 0x37, 0x6E, 0x52, 0xF0, 0x57, 0x9F, 0x5C, 0x7E, 0x5E, 0xDA, 0x5F, 0xD7, 0x74, 0x7D, 0x74, 0xAF, 0x91, 0x99, 0x91, 0x9A, 0x91, 0xCF, 0x97, 0xA6, 0x9F, 0xB3, 0xC0, 0xDC, 0xCF, 0xD9, 0xD2, 0xFE, 0xDD, 0xFA, 0xEE, 0xF9, // BIN 797: 34 pairs
-  0x21, 0x00, 0x14, 0x00, 0x58, 0x04, 0x30, 0x08, 0xC2, 0x0B, 0xB8, 0x0C, 0x98, 0x13, 0xF2, 0x1D, 0x7B, 0x1E, 0x4B, 0x20, 0x4E, 0x22, 0x70, 0x22, 0xF0, 0x2C, 0x69, 0x31, 0x6A, 0x47, 0xCA, 0x53, 0x64, 0x5B, 0x85, 0x60, 0xC7, 0x61, 0xAF, 0x66, 0xDD, 0x6D, 0x89, 0x6D, 0xB7, 0x70, 0xC1, 0x76, 0xD1, 0x7A, 0x91, 0x7B, 0x9F, 0x7F, 0xF4, 0x8A, 0xE0, 0x90, 0xEE, 0x91, 0xCC, 0x96, 0xD4, 0xB2, 0xD1, 0xB4, 0xC7, // BIN 798: 33 pairs
-  0x19, 0x04, 0x34, 0x06, 0x46, 0x0A, 0x14, 0x0C, 0xBA, 0x19, 0x45, 0x1D, 0x72, 0x1D, 0x77, 0x2D, 0x5F, 0x35, 0xF0, 0x40, 0x8C, 0x44, 0xF0, 0x4A, 0x6B, 0x50, 0x87, 0x51, 0x89, 0x53, 0x8D, 0x5E, 0xDF, 0x68, 0xBF, 0x6D, 0x76, 0x7C, 0xD4, 0x7E, 0xD2, 0x88, 0xB2, 0x96, 0xEF, 0x9E, 0xB1, 0xA4, 0xBC, 0xC3, 0xCC, // BIN 799: 25 pairs
-  0x23, 0x03, 0x79, 0x08, 0x30, 0x0B, 0xF1, 0x10, 0x77, 0x12, 0x3F, 0x14, 0xF1, 0x16, 0xDC, 0x17, 0xFB, 0x18, 0xA8, 0x1B, 0xB2, 0x25, 0x4D, 0x2C, 0x6B, 0x31, 0x7D, 0x31, 0x84, 0x32, 0xFF, 0x38, 0x75, 0x43, 0xC5, 0x4D, 0x83, 0x51, 0x78, 0x55, 0x89, 0x55, 0xB9, 0x56, 0xF9, 0x5D, 0xBB, 0x5F, 0x76, 0x68, 0xFC, 0x6D, 0x74, 0x74, 0xA6, 0x77, 0xB1, 0x7E, 0xD5, 0x96, 0xDA, 0x9B, 0xC2, 0x9D, 0xE0, 0xAB, 0xEE, 0xB8, 0xFD, 0xC0, 0xC3, // BIN 800: 35 pairs
-  0x1F, 0x01, 0x60, 0x02, 0x30, 0x0D, 0x65, 0x1C, 0x65, 0x1E, 0x39, 0x22, 0x67, 0x24, 0xFE, 0x29, 0x6F, 0x2A, 0x6A, 0x2E, 0x74, 0x2F, 0x78, 0x31, 0x7A, 0x4A, 0x99, 0x4A, 0x9A, 0x4C, 0x73, 0x4E, 0x5E, 0x56, 0x87, 0x5F, 0x6A, 0x61, 0xD4, 0x6C, 0xD8, 0x71, 0x7E, 0x79, 0xD7, 0x84, 0xFC, 0x86, 0xDE, 0x91, 0xD5, 0x91, 0xF0, 0x96, 0x99, 0x96, 0x9A, 0xA0, 0xDE, 0xA5, 0xD6, 0xAF, 0xF1, // BIN 801: 31 pairs
-  0x1C, 0x04, 0x37, 0x12, 0xD1, 0x16, 0x26, 0x1B, 0xA2, 0x22, 0xFA, 0x23, 0x6B, 0x25, 0x55, 0x2B, 0x36, 0x2B, 0x55, 0x2F, 0xF8, 0x37, 0x6C, 0x45, 0x58, 0x4D, 0x5C, 0x4F, 0xF9, 0x53, 0x9B, 0x56, 0xA2, 0x62, 0x8C, 0x63, 0xA3, 0x64, 0x8D, 0x6B, 0xF7, 0x73, 0x7A, 0x74, 0xC7, 0x7C, 0xC1, 0x7E, 0xCE, 0x80, 0xCE, 0x81, 0x89, 0x9F, 0xE7, 0xB4, 0xD1, // BIN 802: 28 pairs
-  0x21, 0x02, 0x29, 0x04, 0x4D, 0x06, 0xC2, 0x08, 0xFB, 0x0E, 0xF9, 0x12, 0x70, 0x14, 0xBD, 0x16, 0xE3, 0x1B, 0x62, 0x1C, 0x6B, 0x25, 0x39, 0x26, 0x6F, 0x27, 0xFE, 0x31, 0x5C, 0x32, 0x61, 0x36, 0xAC, 0x3E, 0x7C, 0x47, 0xD0, 0x4F, 0x83, 0x50, 0xE1, 0x55, 0x72, 0x57, 0xD4, 0x5E, 0xD8, 0x61, 0x89, 0x6C, 0xDA, 0x70, 0x79, 0x71, 0xED, 0x73, 0xD1, 0x7C, 0xB8, 0x83, 0xC7, 0x87, 0xC5, 0x88, 0xBF, 0xC2, 0xC5, // BIN 803: 33 pairs
-  0x1A, 0x0A, 0x26, 0x0B, 0xDE, 0x0E, 0x45, 0x12, 0xF3, 0x15, 0xF3, 0x16, 0x2F, 0x1F, 0x69, 0x21, 0x3D, 0x21, 0x5A, 0x2D, 0x63, 0x33, 0x6B, 0x3F, 0x79, 0x41, 0x67, 0x4F, 0xAA, 0x63, 0xD7, 0x64, 0xE4, 0x6E, 0xB7, 0x73, 0x8F, 0x97, 0x98, 0x9D, 0xCC, 0x9D, 0xD7, 0x9D, 0xDB, 0xA7, 0xE6, 0xAD, 0xF3, 0xAF, 0xF3, 0xE9, 0xF4, // BIN 804: 26 pairs
-  0x1B, 0x04, 0x4A, 0x04, 0x7F, 0x0B, 0x97, 0x18, 0xD1, 0x1E, 0xED, 0x23, 0xFF, 0x28, 0x6A, 0x35, 0x5D, 0x46, 0x86, 0x4D, 0x9B, 0x53, 0xAC, 0x53, 0xB9, 0x5A, 0x96, 0x63, 0x73, 0x63, 0x89, 0x6F, 0xB0, 0x6F, 0xBB, 0x71, 0x7C, 0x7B, 0x80, 0x89, 0xD6, 0x90, 0xD2, 0x96, 0xFF, 0xA1, 0xE7, 0xA2, 0xDC, 0xAE, 0xF9, 0xBB, 0xD9, 0xDA, 0xFA, // BIN 805: 27 pairs
-  0x1F, 0x00, 0x3D, 0x01, 0xF3, 0x0A, 0x52, 0x0A, 0x64, 0x0E, 0x4E, 0x10, 0x86, 0x1F, 0x62, 0x23, 0x6A, 0x28, 0x68, 0x2B, 0x4D, 0x39, 0x79, 0x40, 0xA5, 0x4C, 0xA0, 0x50, 0x97, 0x57, 0xB6, 0x60, 0x8A, 0x65, 0x94, 0x69, 0xDD, 0x6C, 0xBF, 0x6C, 0xF4, 0x71, 0xE3, 0x74, 0xAD, 0x77, 0xE3, 0x78, 0xF9, 0x80, 0xB8, 0x87, 0xC6, 0x8D, 0xB3, 0x97, 0xA1, 0xBA, 0xF5, 0xD1, 0xDF, 0xEF, 0xFB, // BIN 806: 31 pairs
-  0x1D, 0x00, 0xF6, 0x02, 0x26, 0x02, 0xD1, 0x05, 0x29, 0x0D, 0x1F, 0x19, 0x5B, 0x1C, 0xE1, 0x1E, 0x49, 0x1E, 0xA8, 0x21, 0xA1, 0x24, 0x8C, 0x26, 0xFC, 0x2F, 0x7F, 0x39, 0x3B, 0x43, 0xA0, 0x44, 0x90, 0x48, 0x94, 0x49, 0xAC, 0x4D, 0x95, 0x7E, 0xCB, 0x82, 0xBC, 0x82, 0xF9, 0x84, 0xAB, 0x97, 0xAA, 0x9F, 0xE3, 0xB6, 0xFC, 0xBB, 0xF5, 0xC7, 0xDB, 0xDB, 0xFD, // BIN 807: 29 pairs
-  0x21, 0x03, 0x28, 0x04, 0x12, 0x04, 0xE6, 0x0D, 0x33, 0x12, 0x51, 0x1E, 0xE4, 0x20, 0x46, 0x22, 0x6A, 0x25, 0x88, 0x30, 0x69, 0x37, 0x68, 0x3C, 0x43, 0x46, 0xFF, 0x47, 0xBA, 0x59, 0xD0, 0x5A, 0x7D, 0x5D, 0xAD, 0x5E, 0xDB, 0x62, 0x90, 0x63, 0x65, 0x65, 0x78, 0x72, 0xC1, 0x7E, 0xC2, 0x82, 0x9D, 0x85, 0x96, 0x89, 0xE1, 0x8D, 0xDF, 0x96, 0xEC, 0xA0, 0xE7, 0xA9, 0xC9, 0xA9, 0xE8, 0xAE, 0xF3, 0xBB, 0xFB, // BIN 808: 33 pairs
-  0x15, 0x06, 0x30, 0x07, 0x3A, 0x08, 0x88, 0x0C, 0x11, 0x11, 0x3E, 0x11, 0x5C, 0x21, 0x40, 0x2C, 0x6F, 0x35, 0x9E, 0x38, 0x6B, 0x3D, 0xF0, 0x74, 0xC3, 0x78, 0xD2, 0x86, 0xB7, 0x8E, 0xDB, 0x90, 0xAD, 0xA3, 0xE4, 0xAD, 0xC7, 0xBD, 0xC2, 0xC1, 0xFD, 0xC7, 0xDA, // BIN 809: 21 pairs
-  0x19, 0x04, 0x1C, 0x07, 0xE2, 0x08, 0x2C, 0x21, 0xCC, 0x24, 0xBE, 0x27, 0xEC, 0x34, 0x6E, 0x3B, 0xFA, 0x3D, 0x8C, 0x3D, 0xA5, 0x3F, 0x64, 0x43, 0x6A, 0x45, 0x80, 0x4A, 0x92, 0x62, 0xA2, 0x67, 0xA2, 0x6F, 0xBA, 0x71, 0xBC, 0x87, 0xD3, 0x95, 0xF6, 0x9D, 0xD4, 0xA7, 0xE5, 0xC9, 0xF2, 0xDC, 0xF4, 0xEC, 0xFC, // BIN 810: 25 pairs
-  0x12, 0x06, 0x1F, 0x06, 0xF3, 0x0D, 0x2A, 0x0E, 0xF4, 0x17, 0x86, 0x2B, 0xFE, 0x3F, 0x73, 0x47, 0xD4, 0x5E, 0x8E, 0x62, 0xA4, 0x69, 0x6A, 0x69, 0xF4, 0x6F, 0xB1, 0x79, 0xD5, 0x99, 0xCB, 0x9A, 0xCB, 0xA2, 0xD9, 0xB1, 0xF3, // BIN 811: 18 pairs
-  0x1C, 0x04, 0xE2, 0x06, 0xE2, 0x0B, 0x88, 0x13, 0xBC, 0x13, 0xE6, 0x14, 0x18, 0x16, 0xF5, 0x17, 0x36, 0x17, 0x72, 0x1C, 0x9E, 0x21, 0x5B, 0x28, 0x6C, 0x2A, 0x64, 0x3F, 0x6B, 0x45, 0x76, 0x4B, 0xB9, 0x57, 0xF4, 0x5A, 0x85, 0x6E, 0xD5, 0x96, 0xE6, 0x9E, 0xE2, 0xA3, 0xA5, 0xAA, 0xC3, 0xAE, 0xF1, 0xC0, 0xF2, 0xC2, 0xC6, 0xD9, 0xFB, 0xEB, 0xED, // BIN 812: 28 pairs
-  0x25, 0x02, 0x34, 0x05, 0x42, 0x08, 0x34, 0x09, 0xBB, 0x0A, 0xA8, 0x0D, 0xE5, 0x18, 0x65, 0x1A, 0x6A, 0x1D, 0xBE, 0x21, 0xC0, 0x27, 0x74, 0x2E, 0x48, 0x34, 0x6C, 0x39, 0x65, 0x3E, 0x80, 0x43, 0x8A, 0x4B, 0x6B, 0x4C, 0xA1, 0x4E, 0x6D, 0x4E, 0x80, 0x51, 0x75, 0x52, 0x97, 0x56, 0xC0, 0x67, 0xB3, 0x6C, 0xB7, 0x6F, 0xA9, 0x6F, 0xC6, 0x72, 0xBC, 0x73, 0xA1, 0x75, 0xE0, 0x7B, 0x8A, 0x89, 0xAC, 0x99, 0xC1, 0x9A, 0xC1, 0xA8, 0xE7, 0xAB, 0xEF, 0xB6, 0xC7, // BIN 813: 37 pairs
-  0x15, 0x03, 0x33, 0x0F, 0x8B, 0x14, 0x1E, 0x1B, 0xE8, 0x1E, 0x6A, 0x2D, 0x70, 0x2E, 0xFD, 0x40, 0xF0, 0x52, 0x79, 0x59, 0xB6, 0x73, 0xE1, 0x76, 0xB6, 0x94, 0xF8, 0xAD, 0xF1, 0xAF, 0xB3, 0xB3, 0xFE, 0xBE, 0xBF, 0xC1, 0xEA, 0xC2, 0xFE, 0xD1, 0xD5, 0xE2, 0xFF, // BIN 814: 21 pairs
-  0x15, 0x07, 0xDA, 0x11, 0x51, 0x12, 0xE3, 0x13, 0x4E, 0x15, 0x54, 0x18, 0x8C, 0x18, 0xFB, 0x25, 0x74, 0x29, 0x5C, 0x52, 0xBE, 0x53, 0x98, 0x5C, 0xC3, 0x5D, 0xCC, 0x5E, 0xA3, 0x61, 0xA3, 0x66, 0xDA, 0x67, 0x98, 0x6A, 0x6C, 0x83, 0xD3, 0x96, 0xC9, 0xD7, 0xE4, // BIN 815: 21 pairs
-  0x1B, 0x00, 0x2C, 0x06, 0x2C, 0x08, 0x28, 0x0E, 0x3E, 0x14, 0x78, 0x2B, 0xC7, 0x2E, 0xE1, 0x2F, 0x85, 0x32, 0x73, 0x36, 0xFC, 0x39, 0x92, 0x43, 0xA1, 0x49, 0x5C, 0x4F, 0x8D, 0x57, 0xB2, 0x57, 0xB4, 0x64, 0xB5, 0x6C, 0xDF, 0x6F, 0xC5, 0x70, 0xBC, 0x87, 0xD6, 0x96, 0xDB, 0x97, 0xA0, 0xAA, 0xF3, 0xB6, 0xD1, 0xD5, 0xEC, 0xDD, 0xFD, // BIN 816: 27 pairs
-  0x23, 0x08, 0xE7, 0x09, 0x78, 0x18, 0x5A, 0x18, 0xC7, 0x19, 0xD9, 0x1B, 0x23, 0x20, 0xDD, 0x26, 0x67, 0x2A, 0x6F, 0x2C, 0x68, 0x2C, 0x6C, 0x2E, 0x8C, 0x31, 0x78, 0x45, 0x7E, 0x46, 0x6E, 0x4E, 0x87, 0x4F, 0x60, 0x52, 0xB3, 0x59, 0x73, 0x5B, 0x97, 0x5C, 0xB8, 0x64, 0xD9, 0x66, 0xD8, 0x6A, 0x7F, 0x73, 0xC2, 0x73, 0xFF, 0x7A, 0x96, 0x80, 0xCB, 0x88, 0xB4, 0x8A, 0xC3, 0x8F, 0x9D, 0x90, 0xE5, 0xA6, 0xC3, 0xAF, 0xF9, 0xD5, 0xFE, // BIN 817: 35 pairs
-  0x1E, 0x01, 0x3A, 0x06, 0x28, 0x0B, 0x2A, 0x15, 0xF6, 0x1C, 0xFB, 0x2D, 0x71, 0x39, 0xEA, 0x42, 0x63, 0x49, 0xF8, 0x4D, 0x6B, 0x58, 0x6F, 0x59, 0xAE, 0x5B, 0x94, 0x64, 0x79, 0x69, 0xD8, 0x6A, 0xFF, 0x6C, 0xDB, 0x6E, 0xB1, 0x6E, 0xBF, 0x72, 0x94, 0x73, 0xA0, 0x73, 0xAF, 0x7B, 0xCE, 0x7C, 0xD7, 0x86, 0xEE, 0x8F, 0xC1, 0xA2, 0xF6, 0xAD, 0xD1, 0xAF, 0xE4, 0xD2, 0xEF, // BIN 818: 30 pairs
-  0x18, 0x03, 0xD2, 0x07, 0x35, 0x0A, 0x31, 0x0B, 0x33, 0x0B, 0xFB, 0x10, 0x51, 0x1B, 0x2D, 0x34, 0x68, 0x43, 0xA7, 0x47, 0xA2, 0x52, 0x7E, 0x59, 0xB2, 0x5E, 0x87, 0x5F, 0xA3, 0x5F, 0xD3, 0x69, 0xDA, 0x6E, 0xB0, 0x80, 0xDA, 0x89, 0xCD, 0x91, 0xFF, 0xA8, 0xAE, 0xB5, 0xFA, 0xB9, 0xCB, 0xD1, 0xD3, // BIN 819: 24 pairs
-  0x17, 0x01, 0x88, 0x05, 0xF9, 0x0F, 0x95, 0x1F, 0x6C, 0x29, 0x81, 0x2C, 0x6E, 0x2F, 0x6A, 0x32, 0x6F, 0x37, 0x6D, 0x4C, 0x76, 0x4C, 0x83, 0x4F, 0x73, 0x57, 0xAE, 0x67, 0x68, 0x68, 0xB7, 0x6A, 0x7A, 0x73, 0xAE, 0x81, 0xAB, 0x83, 0xBE, 0x91, 0xE2, 0x9C, 0xF3, 0xBA, 0xFB, 0xD0, 0xED, // BIN 820: 23 pairs
-  0x15, 0x04, 0x22, 0x11, 0x9E, 0x13, 0x3A, 0x16, 0x5A, 0x17, 0xA8, 0x26, 0x78, 0x26, 0x7F, 0x27, 0x88, 0x2B, 0x39, 0x2B, 0xD1, 0x32, 0x5F, 0x3E, 0xAC, 0x4B, 0x8A, 0x57, 0x87, 0x66, 0x74, 0x70, 0x80, 0x8C, 0x94, 0xBC, 0xFA, 0xBF, 0xFB, 0xC9, 0xE3, 0xD4, 0xE9, // BIN 821: 21 pairs
-  0x1D, 0x00, 0x30, 0x00, 0x40, 0x04, 0x45, 0x06, 0x34, 0x06, 0x97, 0x09, 0x32, 0x09, 0x55, 0x0C, 0xF2, 0x17, 0xD1, 0x1D, 0xEE, 0x20, 0x79, 0x26, 0x65, 0x2E, 0x41, 0x36, 0x65, 0x3C, 0x54, 0x55, 0x8E, 0x55, 0xA0, 0x56, 0xF6, 0x59, 0xB4, 0x5E, 0x67, 0x66, 0xDF, 0x8C, 0xAF, 0x8D, 0xC7, 0x93, 0xFC, 0x9D, 0xEE, 0xB7, 0xF5, 0xB8, 0xC9, 0xBA, 0xF2, 0xEB, 0xFD, // BIN 822: 29 pairs
-  0x1A, 0x09, 0x0A, 0x0E, 0x0F, 0x10, 0x8C, 0x12, 0xC7, 0x15, 0xF4, 0x1B, 0x7C, 0x1F, 0xFD, 0x24, 0x73, 0x2F, 0xF9, 0x32, 0x74, 0x40, 0x88, 0x42, 0x5F, 0x4A, 0x64, 0x4C, 0xBD, 0x4E, 0x89, 0x73, 0x9B, 0x74, 0xA7, 0x87, 0xB9, 0x90, 0xB2, 0x94, 0xE2, 0xAC, 0xF1, 0xAC, 0xFB, 0xB1, 0xF4, 0xBD, 0xF5, 0xCE, 0xFC, 0xD0, 0xEE, // BIN 823: 26 pairs
-  0x1B, 0x00, 0x2A, 0x02, 0x33, 0x07, 0xF7, 0x08, 0x1F, 0x0C, 0x22, 0x0D, 0xE6, 0x10, 0x6B, 0x13, 0x23, 0x17, 0x5A, 0x1A, 0xF2, 0x30, 0x6E, 0x32, 0x63, 0x3E, 0x92, 0x49, 0x76, 0x4B, 0xAC, 0x63, 0xD3, 0x64, 0xEC, 0x69, 0xBF, 0x6A, 0xA2, 0x73, 0x85, 0x7C, 0xD5, 0x8D, 0xE0, 0x96, 0xE0, 0xA5, 0xF2, 0xB0, 0xF3, 0xB1, 0xF2, 0xEB, 0xFA, // BIN 824: 27 pairs
-  0x12, 0x00, 0xC3, 0x04, 0xBA, 0x08, 0x37, 0x0F, 0x3A, 0x15, 0x58, 0x17, 0x3E, 0x1D, 0x55, 0x29, 0xF8, 0x3B, 0xC7, 0x4C, 0xA7, 0x4D, 0x98, 0x57, 0x74, 0x5C, 0x79, 0x71, 0xCB, 0x74, 0xAA, 0x7E, 0xD8, 0x89, 0xCC, 0xD8, 0xFA, // BIN 825: 18 pairs
-  0x1A, 0x02, 0x37, 0x02, 0xBE, 0x07, 0x2E, 0x1F, 0x6D, 0x1F, 0xF4, 0x22, 0x47, 0x26, 0x85, 0x30, 0x6C, 0x35, 0x86, 0x36, 0xEA, 0x41, 0x52, 0x42, 0x9E, 0x53, 0x94, 0x5D, 0xBA, 0x65, 0x82, 0x69, 0x73, 0x6C, 0x73, 0x76, 0x99, 0x76, 0x9A, 0x89, 0xD0, 0x8B, 0xC2, 0x96, 0xBD, 0xAB, 0xF0, 0xB8, 0xF5, 0xD1, 0xDD, 0xD2, 0xFD, // BIN 826: 26 pairs
-  0x11, 0x02, 0xE0, 0x0C, 0x32, 0x17, 0x65, 0x18, 0x36, 0x28, 0x6D, 0x28, 0x6E, 0x31, 0x7F, 0x39, 0xFC, 0x3F, 0x58, 0x4E, 0x8C, 0x4F, 0x76, 0x63, 0xC4, 0x6A, 0x92, 0x6E, 0x96, 0x8E, 0xDD, 0x8F, 0xCB, 0xC7, 0xDF, // BIN 827: 17 pairs
-  0x17, 0x04, 0xE5, 0x07, 0x0D, 0x07, 0xB9, 0x0A, 0xDE, 0x0C, 0x3A, 0x2D, 0x72, 0x35, 0xF7, 0x41, 0xC0, 0x55, 0xA1, 0x61, 0xD7, 0x66, 0xDB, 0x67, 0xAB, 0x72, 0xB0, 0x89, 0xBD, 0x8B, 0xB8, 0x8E, 0xDC, 0x91, 0xEF, 0x97, 0xBB, 0x9D, 0xE7, 0xB4, 0xFC, 0xC7, 0xD5, 0xCC, 0xD9, 0xDA, 0xFD, // BIN 828: 23 pairs
-  0x1A, 0x04, 0x8F, 0x09, 0x12, 0x0B, 0x4E, 0x0D, 0xDE, 0x0F, 0x32, 0x10, 0xF3, 0x20, 0xBA, 0x21, 0xAA, 0x26, 0xF6, 0x3B, 0xEC, 0x40, 0x59, 0x41, 0x94, 0x48, 0xFC, 0x57, 0x6A, 0x57, 0xD7, 0x5F, 0xC4, 0x66, 0x76, 0x6B, 0xC2, 0x6F, 0xC0, 0x73, 0xBC, 0x91, 0xD4, 0x91, 0xD7, 0xA7, 0xF3, 0xD7, 0xFE, 0xDC, 0xEB, 0xE3, 0xF6, // BIN 829: 26 pairs
-  0x1C, 0x00, 0xA8, 0x05, 0x26, 0x0B, 0xC2, 0x21, 0xA6, 0x26, 0x60, 0x2D, 0xFF, 0x3C, 0x4F, 0x3E, 0xF9, 0x3F, 0x7C, 0x42, 0x8C, 0x48, 0x50, 0x53, 0x72, 0x5F, 0xF4, 0x60, 0xEF, 0x62, 0xA7, 0x69, 0xDF, 0x74, 0x93, 0x78, 0xE0, 0x8C, 0xA2, 0x8E, 0xDE, 0x94, 0xDE, 0xA4, 0xE2, 0xB7, 0xE1, 0xBC, 0xFF, 0xC3, 0xF3, 0xC7, 0xD3, 0xCE, 0xF9, 0xED, 0xF6, // BIN 830: 28 pairs
-  0x1A, 0x04, 0x2D, 0x0A, 0x2F, 0x0D, 0xC2, 0x0E, 0x21, 0x13, 0x2D, 0x15, 0xF1, 0x16, 0x3F, 0x1B, 0xAE, 0x2B, 0xE4, 0x30, 0x68, 0x34, 0x6D, 0x3E, 0x8B, 0x48, 0xF4, 0x49, 0x8A, 0x4C, 0x94, 0x4F, 0xF6, 0x54, 0xEA, 0x5A, 0x97, 0x60, 0xD1, 0x62, 0xA6, 0x69, 0xB7, 0x6D, 0xB1, 0x79, 0xC1, 0x7C, 0xD2, 0xA4, 0xE7, 0xBB, 0xF2, // BIN 831: 26 pairs
-  0x16, 0x12, 0x45, 0x21, 0x95, 0x29, 0x84, 0x29, 0xF9, 0x4E, 0x68, 0x50, 0xEF, 0x56, 0x60, 0x59, 0xD4, 0x5C, 0x8D, 0x5F, 0x65, 0x6E, 0xF6, 0x73, 0xAD, 0x88, 0xDE, 0x89, 0xA4, 0x89, 0xCF, 0x91, 0xE9, 0x9E, 0xD6, 0xA5, 0xFE, 0xB0, 0xF2, 0xB6, 0xF5, 0xB7, 0xF9, 0xE7, 0xFF, // BIN 832: 22 pairs
-  0x14, 0x12, 0x60, 0x21, 0xF3, 0x2C, 0x6D, 0x2D, 0x6F, 0x31, 0xF8, 0x42, 0x88, 0x4B, 0x83, 0x4F, 0xC9, 0x5F, 0x73, 0x5F, 0x89, 0x68, 0xE0, 0x76, 0x84, 0x7D, 0x91, 0x80, 0xC2, 0x91, 0xC9, 0x9D, 0xDF, 0xA2, 0xE3, 0xA5, 0xB7, 0xBC, 0xF4, 0xE1, 0xE8, // BIN 833: 20 pairs
-  0x16, 0x01, 0xB5, 0x04, 0x5D, 0x06, 0x37, 0x09, 0xFA, 0x19, 0x6A, 0x23, 0x61, 0x2F, 0x5C, 0x36, 0x79, 0x3C, 0xFD, 0x50, 0x7C, 0x52, 0x91, 0x57, 0x8E, 0x69, 0xDB, 0x77, 0xED, 0x7E, 0xA8, 0x89, 0xDC, 0x8C, 0xD6, 0x8F, 0xB5, 0x92, 0xE8, 0x98, 0xDE, 0x9B, 0xB8, 0xC1, 0xF4, // BIN 834: 22 pairs
-  0x21, 0x00, 0x34, 0x00, 0x3A, 0x01, 0x46, 0x01, 0xCB, 0x03, 0xE7, 0x09, 0x3A, 0x09, 0x9B, 0x10, 0x14, 0x17, 0xC7, 0x19, 0xF5, 0x20, 0xDF, 0x21, 0xCF, 0x29, 0x6A, 0x29, 0x7D, 0x3B, 0xD1, 0x47, 0x67, 0x47, 0xD7, 0x4C, 0xC6, 0x4D, 0xF8, 0x51, 0x8C, 0x5D, 0xAE, 0x6D, 0xB0, 0x74, 0xBC, 0x76, 0xCB, 0x88, 0x98, 0x8E, 0xDF, 0x95, 0xE2, 0xA1, 0xE6, 0xA4, 0xFB, 0xB6, 0xF2, 0xB9, 0xC1, 0xD3, 0xEC, 0xDE, 0xF8, // BIN 835: 33 pairs
-  0x14, 0x07, 0xEC, 0x0D, 0x51, 0x13, 0x5A, 0x18, 0x5B, 0x1D, 0x4C, 0x23, 0xFD, 0x25, 0xC7, 0x31, 0x85, 0x3A, 0xFF, 0x3D, 0x59, 0x56, 0x8E, 0x56, 0xCC, 0x6E, 0xF9, 0x73, 0x75, 0x75, 0xAB, 0x89, 0xD3, 0x9E, 0xA3, 0xAB, 0xEB, 0xC4, 0xEC, 0xCE, 0xF8, // BIN 836: 20 pairs
-  0x16, 0x02, 0x3A, 0x08, 0xE2, 0x09, 0xA7, 0x10, 0xFC, 0x12, 0xD9, 0x14, 0xC9, 0x17, 0x4A, 0x17, 0x8C, 0x18, 0x3E, 0x20, 0x42, 0x20, 0x80, 0x41, 0xCC, 0x48, 0xC0, 0x52, 0x59, 0x58, 0x8E, 0x5B, 0x8F, 0x5F, 0xD5, 0x74, 0xC2, 0x79, 0xD2, 0x7C, 0xCE, 0x97, 0xA7, 0xB0, 0xF4, // BIN 837: 22 pairs
-  0x1D, 0x05, 0xA8, 0x07, 0xD7, 0x11, 0xA5, 0x14, 0x44, 0x16, 0x5B, 0x17, 0x39, 0x1C, 0xEC, 0x1D, 0x43, 0x27, 0x4C, 0x3A, 0x77, 0x3B, 0x4C, 0x3D, 0x88, 0x3E, 0x7E, 0x48, 0x65, 0x51, 0x7A, 0x5B, 0x95, 0x73, 0xA6, 0x90, 0xB4, 0x90, 0xE6, 0x91, 0x9C, 0x91, 0xBD, 0x91, 0xDA, 0x99, 0xE2, 0x99, 0xF3, 0x9A, 0xE2, 0x9A, 0xF3, 0x9D, 0xDD, 0x9E, 0xFE, 0xBE, 0xF5, // BIN 838: 29 pairs
-  0x17, 0x11, 0x64, 0x15, 0xF0, 0x1C, 0xA5, 0x22, 0xEF, 0x25, 0xD1, 0x25, 0xE4, 0x29, 0x7A, 0x3A, 0x66, 0x44, 0x59, 0x4A, 0xB9, 0x56, 0xBB, 0x5A, 0x94, 0x5B, 0x9E, 0x70, 0xA3, 0x75, 0xD2, 0x8E, 0xE0, 0x8F, 0xA9, 0x93, 0xC1, 0xA0, 0xE6, 0xA1, 0xE5, 0xA2, 0xC7, 0xC1, 0xFE, 0xCB, 0xFB, // BIN 839: 23 pairs
+  0x01, 0x81, 0x84, // BIN 26: 1 pair
+  0x02, 0x30, 0x34, 0x34, 0x37, // BIN 27: 2 pairs
+  0x01, 0xB0, 0xB1, // BIN 28: 1 pair
+  0x01, 0xCD, 0xCF, // BIN 29: 1 pair
+  0x00, // BIN 30: 0 pairs
+  0x00, // BIN 31: 0 pairs
+  0x00, // BIN 32: 0 pairs
+  0x00, // BIN 33: 0 pairs
+  0x00, // BIN 34: 0 pairs
+  0x00, // BIN 35: 0 pairs
+  0x01, 0x69, 0x6C, // BIN 36: 1 pair
+  0x01, 0x3D, 0x40, // BIN 37: 1 pair
+  0x00, // BIN 38: 0 pairs
+  0x00, // BIN 39: 0 pairs
+  0x01, 0xB2, 0xB4, // BIN 40: 1 pair
+  0x01, 0xE5, 0xE6, // BIN 41: 1 pair
+  0x00, // BIN 42: 0 pairs
+  0x02, 0x17, 0x18, 0x5A, 0x5B, // BIN 43: 2 pairs
+  0x00, // BIN 44: 0 pairs
+  0x02, 0xB4, 0xB6, 0xDA, 0xDB, // BIN 45: 2 pairs
+  0x00, // BIN 46: 0 pairs
+  0x01, 0x61, 0x63, // BIN 47: 1 pair
+  0x01, 0xDD, 0xDF, // BIN 48: 1 pair
+  0x01, 0xCD, 0xD0, // BIN 49: 1 pair
+  0x00, // BIN 50: 0 pairs
+  0x00, // BIN 51: 0 pairs
+  0x01, 0xCA, 0xCD, // BIN 52: 1 pair
+  0x02, 0x7A, 0x7F, 0xA6, 0xAA, // BIN 53: 2 pairs
+  0x03, 0x25, 0x27, 0x30, 0x37, 0xD4, 0xD7, // BIN 54: 3 pairs
+  0x00, // BIN 55: 0 pairs
+  0x02, 0x2C, 0x30, 0x4A, 0x4B, // BIN 56: 2 pairs
+  0x02, 0x36, 0x39, 0xC8, 0xCD, // BIN 57: 2 pairs
+  0x02, 0x5F, 0x63, 0xDB, 0xDF, // BIN 58: 2 pairs
+  0x01, 0x6C, 0x6D, // BIN 59: 1 pair
+  0x00, // BIN 60: 0 pairs
+  0x01, 0xAE, 0xAF, // BIN 61: 1 pair
+  0x02, 0x2F, 0x31, 0xCF, 0xD0, // BIN 62: 2 pairs
+  0x02, 0x2C, 0x34, 0x9E, 0xA5, // BIN 63: 2 pairs
+  0x01, 0xCA, 0xD0, // BIN 64: 1 pair
+  0x00, // BIN 65: 0 pairs
+  0x01, 0xD3, 0xD5, // BIN 66: 1 pair
+  0x03, 0x25, 0x2B, 0x49, 0x4B, 0x7F, 0x85, // BIN 67: 3 pairs
+  0x00, // BIN 68: 0 pairs
+  0x01, 0xCC, 0xCF, // BIN 69: 1 pair
+  0x03, 0x28, 0x2A, 0x7C, 0x7E, 0xAD, 0xAE, // BIN 70: 3 pairs
+  0x00, // BIN 71: 0 pairs
+  0x01, 0x08, 0x0B, // BIN 72: 1 pair
+  0x01, 0x19, 0x1A, // BIN 73: 1 pair
+  0x01, 0xBD, 0xC6, // BIN 74: 1 pair
+  0x02, 0xBA, 0xBB, 0xBD, 0xC5, // BIN 75: 2 pairs
+  0x01, 0xC8, 0xD0, // BIN 76: 1 pair
+  0x00, // BIN 77: 0 pairs
+  0x02, 0x0E, 0x11, 0xDB, 0xDD, // BIN 78: 2 pairs
+  0x01, 0x42, 0x46, // BIN 79: 1 pair
+  0x01, 0xA6, 0xA7, // BIN 80: 1 pair
+  0x03, 0x2C, 0x37, 0xCA, 0xCF, 0xCC, 0xCD, // BIN 81: 3 pairs
+  0x02, 0x99, 0x9C, 0xC7, 0xD1, // BIN 82: 2 pairs
+  0x05, 0x33, 0x37, 0x53, 0x55, 0x9A, 0x9C, 0xA7, 0xAA, 0xB2, 0xB6, // BIN 83: 5 pairs
+  0x02, 0x69, 0x6D, 0x7D, 0x85, // BIN 84: 2 pairs
+  0x03, 0x4E, 0x51, 0x7A, 0x85, 0xD8, 0xDA, // BIN 85: 3 pairs
+  0x03, 0x5F, 0x61, 0x98, 0xA0, 0xC8, 0xCF, // BIN 86: 3 pairs
+  0x03, 0x2D, 0x32, 0x86, 0x8C, 0x98, 0xA1, // BIN 87: 3 pairs
+  0x04, 0x2C, 0x33, 0x93, 0x99, 0x93, 0x9A, 0xA1, 0xA6, // BIN 88: 4 pairs
+  0x00, // BIN 89: 0 pairs
+  0x04, 0x41, 0x48, 0x4B, 0x4D, 0x50, 0x52, 0x77, 0x7B, // BIN 90: 4 pairs
+  0x02, 0x7A, 0x7D, 0xC0, 0xCC, // BIN 91: 2 pairs
+  0x02, 0xA0, 0xA7, 0xD5, 0xD7, // BIN 92: 2 pairs
+  0x02, 0x06, 0x08, 0xD5, 0xD8, // BIN 93: 2 pairs
+  0x03, 0x16, 0x19, 0x33, 0x34, 0xDA, 0xDD, // BIN 94: 3 pairs
+  0x02, 0x0B, 0x0D, 0xDA, 0xDF, // BIN 95: 2 pairs
+  0x01, 0x33, 0x38, // BIN 96: 1 pair
+  0x00, // BIN 97: 0 pairs
+  0x03, 0x01, 0x06, 0x28, 0x2C, 0xA0, 0xA6, // BIN 98: 3 pairs
+  0x01, 0xA1, 0xA7, // BIN 99: 1 pair
+  0x04, 0x29, 0x31, 0x66, 0x69, 0x91, 0x96, 0xFA, 0xFD, // BIN 100: 4 pairs
+  0x03, 0x0C, 0x0F, 0x73, 0x74, 0xAD, 0xB2, // BIN 101: 3 pairs
+  0x02, 0x27, 0x2B, 0x9C, 0xA4, // BIN 102: 2 pairs
+  0x01, 0x9B, 0xA0, // BIN 103: 1 pair
+  0x02, 0x49, 0x4A, 0x5E, 0x68, // BIN 104: 2 pairs
+  0x02, 0x79, 0x7C, 0xC1, 0xCB, // BIN 105: 2 pairs
+  0x00, // BIN 106: 0 pairs
+  0x03, 0x59, 0x61, 0x70, 0x71, 0x98, 0x9B, // BIN 107: 3 pairs
+  0x02, 0x7B, 0x86, 0x7D, 0x84, // BIN 108: 2 pairs
+  0x01, 0x40, 0x44, // BIN 109: 1 pair
+  0x03, 0x26, 0x2F, 0x3F, 0x45, 0xD3, 0xD7, // BIN 110: 3 pairs
+  0x04, 0x32, 0x3A, 0x49, 0x4D, 0x66, 0x68, 0xD0, 0xD4, // BIN 111: 4 pairs
+  0x03, 0x78, 0x82, 0x79, 0x80, 0xAE, 0xB2, // BIN 112: 3 pairs
+  0x04, 0x2A, 0x33, 0x30, 0x33, 0x57, 0x59, 0x5E, 0x66, // BIN 113: 4 pairs
+  0x02, 0x75, 0x7D, 0xC5, 0xC9, // BIN 114: 2 pairs
+  0x00, // BIN 115: 0 pairs
+  0x02, 0x29, 0x2F, 0xC8, 0xCC, // BIN 116: 2 pairs
+  0x01, 0xF6, 0xF9, // BIN 117: 1 pair
+  0x01, 0xCA, 0xCC, // BIN 118: 1 pair
+  0x03, 0x66, 0x6D, 0x6D, 0x75, 0x83, 0x87, // BIN 119: 3 pairs
+  0x01, 0x7D, 0x7F, // BIN 120: 1 pair
+  0x01, 0x66, 0x6C, // BIN 121: 1 pair
+  0x05, 0x01, 0x08, 0x7D, 0x81, 0x9B, 0xA1, 0xD5, 0xDA, 0xE9, 0xEC, // BIN 122: 5 pairs
+  0x00, // BIN 123: 0 pairs
+  0x02, 0xD8, 0xDB, 0xDB, 0xE0, // BIN 124: 2 pairs
+  0x00, // BIN 125: 0 pairs
+  0x03, 0x2A, 0x2C, 0x59, 0x5F, 0x68, 0x6D, // BIN 126: 3 pairs
+  0x02, 0x93, 0x9C, 0xA4, 0xAC, // BIN 127: 2 pairs
+  0x03, 0x26, 0x29, 0x75, 0x7A, 0xCC, 0xD0, // BIN 128: 3 pairs
+  0x03, 0xAD, 0xAF, 0xB3, 0xBE, 0xBB, 0xC0, // BIN 129: 3 pairs
+  0x02, 0x5C, 0x64, 0xBC, 0xC1, // BIN 130: 2 pairs
+  0x01, 0xC6, 0xC9, // BIN 131: 1 pair
+  0x01, 0x4C, 0x4F, // BIN 132: 1 pair
+  0x03, 0x8C, 0x90, 0x8F, 0x92, 0xDF, 0xE0, // BIN 133: 3 pairs
+  0x00, // BIN 134: 0 pairs
+  0x06, 0x5F, 0x66, 0xA1, 0xAA, 0xB6, 0xBA, 0xCF, 0xD4, 0xD3, 0xD4, 0xED, 0xEE, // BIN 135: 6 pairs
+  0x01, 0xAF, 0xB2, // BIN 136: 1 pair
+  0x02, 0x2D, 0x30, 0xAD, 0xB4, // BIN 137: 2 pairs
+  0x06, 0x00, 0x05, 0x28, 0x33, 0x57, 0x5F, 0x59, 0x63, 0xC0, 0xC8, 0xC9, 0xCC, // BIN 138: 6 pairs
+  0x04, 0x06, 0x0B, 0x7E, 0x80, 0xD3, 0xD8, 0xD4, 0xD5, // BIN 139: 4 pairs
+  0x01, 0x40, 0x42, // BIN 140: 1 pair
+  0x02, 0xA0, 0xAA, 0xC0, 0xCD, // BIN 141: 2 pairs
+  0x01, 0x3D, 0x44, // BIN 142: 1 pair
+  0x01, 0x4D, 0x53, // BIN 143: 1 pair
+  0x03, 0x4A, 0x4D, 0x4F, 0x54, 0x78, 0x7F, // BIN 144: 3 pairs
+  0x03, 0x63, 0x69, 0x7C, 0x80, 0xCD, 0xD4, // BIN 145: 3 pairs
+  0x02, 0x08, 0x0D, 0xC0, 0xCF, // BIN 146: 2 pairs
+  0x01, 0xC0, 0xCA, // BIN 147: 1 pair
+  0x04, 0x10, 0x12, 0x54, 0x56, 0xC0, 0xC9, 0xD0, 0xD3, // BIN 148: 4 pairs
+  0x02, 0x6C, 0x75, 0xD0, 0xD7, // BIN 149: 2 pairs
+  0x02, 0x2D, 0x3A, 0xB1, 0xB7, // BIN 150: 2 pairs
+  0x03, 0x2B, 0x3B, 0x9B, 0xA7, 0xD9, 0xDC, // BIN 151: 3 pairs
+  0x02, 0x8F, 0x93, 0xAE, 0xB4, // BIN 152: 2 pairs
+  0x03, 0x28, 0x30, 0x5F, 0x69, 0x79, 0x7E, // BIN 153: 3 pairs
+  0x06, 0x3B, 0x3C, 0x43, 0x48, 0x87, 0x89, 0xA8, 0xB3, 0xAC, 0xB9, 0xBB, 0xC8, // BIN 154: 6 pairs
+  0x02, 0x24, 0x2E, 0xEF, 0xF7, // BIN 155: 2 pairs
+  0x01, 0x20, 0x21, // BIN 156: 1 pair
+  0x05, 0x26, 0x31, 0x2E, 0x35, 0x92, 0x9B, 0xBD, 0xC9, 0xE9, 0xED, // BIN 157: 5 pairs
+  0x05, 0x05, 0x0A, 0x1C, 0x1D, 0x37, 0x38, 0x4C, 0x4D, 0x70, 0x77, // BIN 158: 5 pairs
+  0x00, // BIN 159: 0 pairs
+  0x05, 0x29, 0x2A, 0x2D, 0x34, 0x95, 0x98, 0x9C, 0xAC, 0xEF, 0xF0, // BIN 160: 5 pairs
+  0x03, 0x28, 0x34, 0x78, 0x7A, 0xA4, 0xB9, // BIN 161: 3 pairs
+  0x03, 0x3D, 0x42, 0x4F, 0x56, 0xDA, 0xE0, // BIN 162: 3 pairs
+  0x01, 0x1D, 0x1E, // BIN 163: 1 pair
+  0x01, 0x1A, 0x1E, // BIN 164: 1 pair
+  0x05, 0x24, 0x27, 0x45, 0x4A, 0x63, 0x66, 0x7F, 0x82, 0xCB, 0xCE, // BIN 165: 5 pairs
+  0x06, 0x04, 0x09, 0x16, 0x1A, 0x2A, 0x38, 0xBB, 0xCA, 0xD5, 0xDB, 0xDC, 0xE3, // BIN 166: 6 pairs
+  0x03, 0x39, 0x3E, 0x67, 0x6A, 0xE4, 0xE9, // BIN 167: 3 pairs
+  0x02, 0x3E, 0x49, 0x84, 0x85, // BIN 168: 2 pairs
+  0x02, 0x74, 0x76, 0xAD, 0xB6, // BIN 169: 2 pairs
+  0x01, 0xE2, 0xE6, // BIN 170: 1 pair
+  0x01, 0x68, 0x6C, // BIN 171: 1 pair
+  0x01, 0xAF, 0xB4, // BIN 172: 1 pair
+  0x01, 0x75, 0x81, // BIN 173: 1 pair
+  0x07, 0x2C, 0x2D, 0x35, 0x3D, 0x68, 0x69, 0x92, 0x98, 0x98, 0xA6, 0xB8, 0xC3, 0xD7, 0xDA, // BIN 174: 7 pairs
+  0x04, 0x23, 0x2D, 0x28, 0x37, 0xBA, 0xC8, 0xCA, 0xD4, // BIN 175: 4 pairs
+  0x04, 0x2A, 0x34, 0x65, 0x6A, 0x75, 0x84, 0xD2, 0xD6, // BIN 176: 4 pairs
+  0x04, 0x42, 0x44, 0x99, 0xA4, 0x9A, 0xA4, 0xD8, 0xDD, // BIN 177: 4 pairs
+  0x05, 0x31, 0x38, 0x34, 0x38, 0x77, 0x86, 0x98, 0xA7, 0xB0, 0xB7, // BIN 178: 5 pairs
+  0x01, 0xD8, 0xDF, // BIN 179: 1 pair
+  0x08, 0x2A, 0x30, 0x2A, 0x37, 0x49, 0x4C, 0x63, 0x6C, 0xB4, 0xBA, 0xD5, 0xDD, 0xD7, 0xD8, 0xDD, 0xE0, // BIN 180: 8 pairs
+  0x02, 0x75, 0x7F, 0xE2, 0xE5, // BIN 181: 2 pairs
+  0x01, 0x6B, 0x72, // BIN 182: 1 pair
+  0x03, 0x2D, 0x37, 0x99, 0xAC, 0x9A, 0xAC, // BIN 183: 3 pairs
+  0x06, 0x18, 0x1A, 0x56, 0x59, 0x57, 0x61, 0x75, 0x85, 0x9F, 0xA3, 0xBA, 0xCA, // BIN 184: 6 pairs
+  0x05, 0x2C, 0x38, 0x69, 0x75, 0x8B, 0x95, 0xCF, 0xD7, 0xD7, 0xDD, // BIN 185: 5 pairs
+  0x03, 0x18, 0x19, 0x4B, 0x53, 0x57, 0x63, // BIN 186: 3 pairs
+  0x03, 0x43, 0x4F, 0xC8, 0xD4, 0xD3, 0xDA, // BIN 187: 3 pairs
+  0x01, 0xCA, 0xD3, // BIN 188: 1 pair
+  0x05, 0x18, 0x1E, 0x36, 0x3E, 0x85, 0x8F, 0x85, 0x93, 0xC0, 0xD0, // BIN 189: 5 pairs
+  0x03, 0x4C, 0x54, 0x5F, 0x6C, 0x81, 0x85, // BIN 190: 3 pairs
+  0x03, 0x61, 0x69, 0xB7, 0xBF, 0xCD, 0xD7, // BIN 191: 3 pairs
+  0x02, 0x30, 0x3A, 0xEA, 0xEB, // BIN 192: 2 pairs
+  0x05, 0x01, 0x0B, 0x43, 0x4C, 0x94, 0x95, 0xBC, 0xCB, 0xBF, 0xC4, // BIN 193: 5 pairs
+  0x02, 0x9F, 0xA2, 0xD0, 0xD5, // BIN 194: 2 pairs
+  0x05, 0x41, 0x43, 0x41, 0x47, 0x7B, 0x8C, 0x9B, 0xA6, 0xAE, 0xB6, // BIN 195: 5 pairs
+  0x02, 0x34, 0x3A, 0xCD, 0xD3, // BIN 196: 2 pairs
+  0x00, // BIN 197: 0 pairs
+  0x06, 0x48, 0x4F, 0xBA, 0xC0, 0xBB, 0xCC, 0xBB, 0xCD, 0xCC, 0xD4, 0xE4, 0xEC, // BIN 198: 6 pairs
+  0x03, 0x7A, 0x84, 0xC8, 0xD3, 0xF4, 0xF6, // BIN 199: 3 pairs
+  0x03, 0x37, 0x3A, 0xB8, 0xC2, 0xF1, 0xF5, // BIN 200: 3 pairs
+  0x01, 0x70, 0x7B, // BIN 201: 1 pair
+  0x02, 0x22, 0x23, 0xC9, 0xCF, // BIN 202: 2 pairs
+  0x03, 0x30, 0x38, 0x5E, 0x6D, 0x82, 0x8F, // BIN 203: 3 pairs
+  0x04, 0x17, 0x1E, 0x71, 0x7B, 0x73, 0x76, 0x80, 0x8A, // BIN 204: 4 pairs
+  0x02, 0x30, 0x32, 0xD5, 0xDF, // BIN 205: 2 pairs
+  0x01, 0x25, 0x3B, // BIN 206: 1 pair
+  0x04, 0x27, 0x3B, 0x96, 0x9D, 0xB6, 0xBB, 0xCF, 0xD3, // BIN 207: 4 pairs
+  0x04, 0x71, 0x77, 0x7F, 0x8F, 0xB5, 0xB8, 0xC1, 0xC2, // BIN 208: 4 pairs
+  0x04, 0x5E, 0x5F, 0x86, 0x90, 0xD7, 0xDB, 0xDE, 0xE5, // BIN 209: 4 pairs
+  0x02, 0x61, 0x66, 0x7A, 0x82, // BIN 210: 2 pairs
+  0x05, 0x2A, 0x31, 0x4A, 0x53, 0x78, 0x85, 0x87, 0x8E, 0xD8, 0xE0, // BIN 211: 5 pairs
+  0x03, 0x35, 0x40, 0x5E, 0x69, 0xCA, 0xD7, // BIN 212: 3 pairs
+  0x02, 0x68, 0x75, 0x7A, 0x81, // BIN 213: 2 pairs
+  0x03, 0x24, 0x25, 0x29, 0x38, 0xB2, 0xBA, // BIN 214: 3 pairs
+  0x02, 0x82, 0x85, 0xB6, 0xC4, // BIN 215: 2 pairs
+  0x02, 0x8D, 0x8E, 0xB5, 0xC2, // BIN 216: 2 pairs
+  0x02, 0x4B, 0x4C, 0xAC, 0xBD, // BIN 217: 2 pairs
+  0x05, 0x28, 0x38, 0x4D, 0x55, 0x8F, 0x99, 0x8F, 0x9A, 0xAF, 0xB6, // BIN 218: 5 pairs
+  0x04, 0x40, 0x46, 0x56, 0x5D, 0xBB, 0xCF, 0xE6, 0xE7, // BIN 219: 4 pairs
+  0x02, 0x27, 0x3C, 0xC9, 0xCD, // BIN 220: 2 pairs
+  0x05, 0x2E, 0x3C, 0x3F, 0x4A, 0x45, 0x4B, 0x9D, 0xA9, 0xC4, 0xD3, // BIN 221: 5 pairs
+  0x03, 0x32, 0x34, 0x7F, 0x84, 0x92, 0x95, // BIN 222: 3 pairs
+  0x04, 0x28, 0x29, 0x98, 0xAA, 0xC8, 0xD7, 0xF0, 0xFF, // BIN 223: 4 pairs
+  0x04, 0x32, 0x35, 0x3E, 0x4B, 0x57, 0x66, 0xF1, 0xF3, // BIN 224: 4 pairs
+  0x04, 0x17, 0x1A, 0x46, 0x4E, 0x5F, 0x6D, 0x61, 0x6C, // BIN 225: 4 pairs
+  0x06, 0x47, 0x48, 0x5E, 0x6C, 0x84, 0x93, 0x8A, 0x94, 0xD7, 0xDF, 0xEC, 0xED, // BIN 226: 6 pairs
+  0x04, 0x3E, 0x4A, 0x63, 0x6D, 0x9B, 0xAA, 0xA5, 0xBE, // BIN 227: 4 pairs
+  0x01, 0xD4, 0xDA, // BIN 228: 1 pair
+  0x04, 0x19, 0x1E, 0x6D, 0x7D, 0x93, 0xA4, 0xBA, 0xCD, // BIN 229: 4 pairs
+  0x05, 0x11, 0x12, 0x17, 0x19, 0x57, 0x5E, 0xBB, 0xD0, 0xF2, 0xF5, // BIN 230: 5 pairs
+  0x07, 0x06, 0x0D, 0x09, 0x0C, 0x23, 0x32, 0x8F, 0x9B, 0x97, 0x9D, 0xBA, 0xC4, 0xD4, 0xD8, // BIN 231: 7 pairs
+  0x03, 0x95, 0xA1, 0xD3, 0xDB, 0xD4, 0xDD, // BIN 232: 3 pairs
+  0x03, 0x29, 0x33, 0x39, 0x43, 0x72, 0x77, // BIN 233: 3 pairs
+  0x01, 0x47, 0x57, // BIN 234: 1 pair
+  0x02, 0x12, 0x17, 0x7D, 0x93, // BIN 235: 2 pairs
+  0x04, 0x13, 0xFF, 0x5D, 0x61, 0x92, 0xA0, 0xDE, 0xE2, // BIN 236: 4 pairs
+  0x05, 0x2B, 0x3C, 0x31, 0x3F, 0x38, 0x3F, 0x59, 0x5D, 0x84, 0x9C, // BIN 237: 5 pairs
+  0x04, 0x31, 0x33, 0x60, 0x65, 0x70, 0x72, 0xB4, 0xC4, // BIN 238: 4 pairs
+  0x05, 0x32, 0x37, 0x66, 0x75, 0xA5, 0xB3, 0xAF, 0xB7, 0xC2, 0xC3, // BIN 239: 5 pairs
+  0x07, 0x1B, 0x20, 0x2F, 0x38, 0x3D, 0x46, 0x49, 0x53, 0x7F, 0x81, 0x95, 0xA0, 0xCE, 0xD6, // BIN 240: 7 pairs
+  0x02, 0x10, 0x18, 0x6D, 0x81, // BIN 241: 2 pairs
+  0x07, 0x10, 0x17, 0x17, 0x1D, 0x3E, 0x3F, 0x8A, 0x8D, 0xC1, 0xCE, 0xCD, 0xD5, 0xE2, 0xE7, // BIN 242: 7 pairs
+  0x01, 0xDE, 0xE6, // BIN 243: 1 pair
+  0x04, 0x0A, 0x12, 0x28, 0x2D, 0x44, 0x46, 0x6D, 0x7A, // BIN 244: 4 pairs
+  0x05, 0x5F, 0x68, 0xBE, 0xE1, 0xCA, 0xD5, 0xD3, 0xDD, 0xE1, 0xF0, // BIN 245: 5 pairs
+  0x03, 0x03, 0x1B, 0x56, 0x57, 0xBC, 0xCE, // BIN 246: 3 pairs
+  0x06, 0x68, 0x81, 0x7F, 0x93, 0x8B, 0x92, 0xA2, 0xAD, 0xC4, 0xCA, 0xCF, 0xD5, // BIN 247: 6 pairs
+  0x06, 0x2C, 0x3A, 0x6C, 0x6E, 0x82, 0x92, 0x92, 0xA1, 0xBA, 0xD0, 0xC4, 0xC8, // BIN 248: 6 pairs
+  0x05, 0x0A, 0x10, 0x1E, 0x25, 0x54, 0x5D, 0x58, 0x64, 0xC0, 0xC5, // BIN 249: 5 pairs
+  0x04, 0x2D, 0x33, 0x2E, 0x3D, 0xB4, 0xBB, 0xCC, 0xD7, // BIN 250: 4 pairs
+  0x02, 0x16, 0x18, 0xC8, 0xC9, // BIN 251: 2 pairs
+  0x07, 0x2C, 0x32, 0x45, 0x49, 0x69, 0x6E, 0x78, 0x7D, 0x81, 0x93, 0xAB, 0xB0, 0xBA, 0xCC, // BIN 252: 7 pairs
+  0x01, 0xC5, 0xCC, // BIN 253: 1 pair
+  0x04, 0x23, 0x2C, 0x6A, 0x73, 0x81, 0x9C, 0xB5, 0xC1, // BIN 254: 4 pairs
+  0x03, 0x23, 0x30, 0x25, 0x3C, 0xC9, 0xCA, // BIN 255: 3 pairs
+  0x06, 0x5E, 0x63, 0x6D, 0x84, 0x95, 0x9B, 0x9C, 0xB9, 0xBA, 0xCF, 0xC8, 0xD5, // BIN 256: 6 pairs
+  0x05, 0x23, 0x28, 0x7A, 0x8F, 0xA5, 0xA8, 0xB3, 0xC7, 0xFD, 0xFE, // BIN 257: 5 pairs
+  0x03, 0x18, 0x1D, 0x59, 0x66, 0xBD, 0xC0, // BIN 258: 3 pairs
+  0x03, 0x12, 0x18, 0x2A, 0x2F, 0x65, 0x67, // BIN 259: 3 pairs
+  0x04, 0x44, 0x50, 0x6C, 0x7A, 0x94, 0xA2, 0xE5, 0xE7, // BIN 260: 4 pairs
+  0x04, 0x1E, 0x27, 0x75, 0x78, 0xB9, 0xBD, 0xF4, 0xF9, // BIN 261: 4 pairs
+  0x07, 0x2F, 0x3F, 0x6E, 0x78, 0x77, 0x8C, 0x92, 0x93, 0xA2, 0xAE, 0xC2, 0xCB, 0xF0, 0xF7, // BIN 262: 7 pairs
+  0x01, 0xD4, 0xDB, // BIN 263: 1 pair
+  0x04, 0x64, 0x6B, 0x6C, 0x7D, 0xAC, 0xC6, 0xC9, 0xD0, // BIN 264: 4 pairs
+  0x06, 0x01, 0x0D, 0x1D, 0x24, 0x27, 0x2E, 0x83, 0x8E, 0xB9, 0xC6, 0xBF, 0xD2, // BIN 265: 6 pairs
+  0x04, 0x58, 0x5C, 0x7E, 0x8A, 0x93, 0xAC, 0xC0, 0xC6, // BIN 266: 4 pairs
+  0x02, 0x24, 0x2B, 0xF6, 0xF8, // BIN 267: 2 pairs
+  0x05, 0x24, 0x3C, 0x48, 0x56, 0x4D, 0x54, 0x83, 0x89, 0xC4, 0xD0, // BIN 268: 5 pairs
+  0x03, 0x3A, 0x46, 0x99, 0x9B, 0x9A, 0x9B, // BIN 269: 3 pairs
+  0x06, 0x3F, 0x4B, 0x4B, 0x55, 0x68, 0x84, 0x7D, 0x8F, 0x8A, 0x8B, 0xC6, 0xCC, // BIN 270: 6 pairs
+  0x04, 0x2F, 0x36, 0x3E, 0x43, 0x63, 0x6E, 0x90, 0x97, // BIN 271: 4 pairs
+  0x03, 0x0D, 0x16, 0x4A, 0x4C, 0xD3, 0xDF, // BIN 272: 3 pairs
+  0x07, 0x1C, 0x22, 0x1E, 0x24, 0x56, 0x61, 0x6A, 0x74, 0xA8, 0xBE, 0xA9, 0xB5, 0xBE, 0xC7, // BIN 273: 7 pairs
+  0x04, 0x3A, 0x42, 0x3E, 0x4C, 0x3F, 0x49, 0x61, 0x6D, // BIN 274: 4 pairs
+  0x07, 0x63, 0x68, 0x7A, 0x93, 0xAC, 0xC5, 0xAD, 0xBA, 0xB2, 0xC4, 0xB5, 0xBC, 0xCC, 0xD3, // BIN 275: 7 pairs
+  0x09, 0x59, 0x69, 0x64, 0x70, 0x84, 0xA4, 0x85, 0x99, 0x85, 0x9A, 0xBB, 0xC9, 0xD4, 0xDF, 0xF8, 0xF9, 0xFB, 0xFC, // BIN 276: 9 pairs
+  0x01, 0x3E, 0x4D, // BIN 277: 1 pair
+  0x03, 0x26, 0x36, 0x8F, 0x9C, 0xC4, 0xD5, // BIN 278: 3 pairs
+  0x04, 0x00, 0x02, 0x60, 0x6B, 0x8B, 0x94, 0xAB, 0xB1, // BIN 279: 4 pairs
+  0x08, 0x44, 0x52, 0x4C, 0x53, 0x4D, 0x4F, 0x61, 0x6E, 0x84, 0x99, 0x84, 0x9A, 0xB2, 0xBB, 0xE1, 0xEF, // BIN 280: 8 pairs
+  0x05, 0x29, 0x2C, 0x4C, 0x56, 0x5D, 0x63, 0xC0, 0xD4, 0xD5, 0xE0, // BIN 281: 5 pairs
+  0x07, 0x28, 0x31, 0x2E, 0x40, 0x57, 0x69, 0x89, 0x8E, 0x93, 0x9B, 0xB9, 0xC5, 0xD9, 0xE4, // BIN 282: 7 pairs
+  0x06, 0x23, 0x34, 0x33, 0x3A, 0x82, 0x8B, 0x85, 0x9C, 0xD0, 0xD8, 0xE7, 0xE8, // BIN 283: 6 pairs
+  0x03, 0x00, 0xFD, 0x5C, 0x60, 0x9E, 0xBE, // BIN 284: 3 pairs
+  0x04, 0x1A, 0x25, 0x78, 0x8F, 0x7D, 0x82, 0x81, 0xA4, // BIN 285: 4 pairs
+  0x03, 0x26, 0x2A, 0x41, 0x4F, 0xB4, 0xBF, // BIN 286: 3 pairs
+  0x04, 0x35, 0x3A, 0x48, 0x4C, 0x88, 0x90, 0xE9, 0xEE, // BIN 287: 4 pairs
+  0x01, 0xBD, 0xCC, // BIN 288: 1 pair
+  0x03, 0x00, 0x0A, 0x7E, 0x8D, 0x91, 0x9D, // BIN 289: 3 pairs
+  0x06, 0x36, 0x43, 0x3E, 0x45, 0x42, 0x4E, 0x83, 0x8D, 0xBB, 0xC4, 0xD1, 0xD9, // BIN 290: 6 pairs
+  0x01, 0x0E, 0x12, // BIN 291: 1 pair
+  0x01, 0x8F, 0x98, // BIN 292: 1 pair
+  0x04, 0x16, 0x17, 0x68, 0x7D, 0xB6, 0xC8, 0xC4, 0xCD, // BIN 293: 4 pairs
+  0x03, 0x4A, 0x55, 0x5E, 0x61, 0x89, 0x91, // BIN 294: 3 pairs
+  0x02, 0x2A, 0x2D, 0x6C, 0x81, // BIN 295: 2 pairs
+  0x05, 0x43, 0x49, 0x69, 0x7A, 0x7D, 0x9C, 0x94, 0x9F, 0xB6, 0xBF, // BIN 296: 5 pairs
+  0x01, 0xCE, 0xD2, // BIN 297: 1 pair
+  0x03, 0x6D, 0x7F, 0xAE, 0xB7, 0xC4, 0xD8, // BIN 298: 3 pairs
+  0x07, 0x0B, 0x16, 0x2F, 0x33, 0x2F, 0x3E, 0x35, 0x42, 0x6D, 0x6E, 0x92, 0x99, 0x92, 0x9A, // BIN 299: 7 pairs
+  0x04, 0x24, 0x35, 0x69, 0x7D, 0xB6, 0xCA, 0xEA, 0xF8, // BIN 300: 4 pairs
+  0x04, 0x10, 0x16, 0x2D, 0x35, 0x3C, 0x3D, 0xAA, 0xBB, // BIN 301: 4 pairs
+  0x03, 0x81, 0x99, 0x81, 0x9A, 0xB2, 0xBF, // BIN 302: 3 pairs
+  0x05, 0x6D, 0x85, 0x6E, 0x75, 0x95, 0xA6, 0x9E, 0xB3, 0xA2, 0xAF, // BIN 303: 5 pairs
+  0x01, 0x71, 0x86, // BIN 304: 1 pair
+  0x03, 0x01, 0xF7, 0xDC, 0xE4, 0xDE, 0xE3, // BIN 305: 3 pairs
+  0x08, 0x22, 0x35, 0x3C, 0x44, 0x59, 0x5E, 0x7E, 0x83, 0x92, 0xA7, 0xA3, 0xB0, 0xA9, 0xB8, 0xF4, 0xFC, // BIN 306: 8 pairs
+  0x03, 0x46, 0x51, 0x6C, 0x84, 0xEB, 0xF6, // BIN 307: 3 pairs
+  0x04, 0x45, 0x4D, 0x53, 0x54, 0x8B, 0x98, 0xAF, 0xB1, // BIN 308: 4 pairs
+  0x05, 0x5E, 0x75, 0xB2, 0xB7, 0xBE, 0xD1, 0xC9, 0xD4, 0xD0, 0xDA, // BIN 309: 5 pairs
+  0x05, 0x23, 0x37, 0x3C, 0x40, 0x56, 0x5F, 0x70, 0x86, 0x9E, 0xA8, // BIN 310: 5 pairs
+  0x05, 0x1E, 0x2B, 0x2C, 0x31, 0x49, 0x4F, 0x57, 0x68, 0xD9, 0xE3, // BIN 311: 5 pairs
+  0x04, 0x38, 0x45, 0x59, 0x6C, 0x7D, 0x99, 0x7D, 0x9A, // BIN 312: 4 pairs
+  0x04, 0x6C, 0x7F, 0x99, 0xB9, 0x9A, 0xB9, 0xA3, 0xAF, // BIN 313: 4 pairs
+  0x05, 0x35, 0x44, 0x54, 0x55, 0x56, 0x63, 0x7B, 0x90, 0xC3, 0xC7, // BIN 314: 5 pairs
+  0x07, 0x0F, 0x20, 0x10, 0x19, 0x22, 0x2D, 0x32, 0x3D, 0x39, 0x49, 0xA2, 0xA6, 0xF1, 0xF2, // BIN 315: 7 pairs
+  0x0D, 0x22, 0x32, 0x29, 0x37, 0x2F, 0x39, 0x32, 0x33, 0x3A, 0x3D, 0x48, 0x57, 0x6E, 0x7A, 0x79, 0x8A, 0x7C, 0x8A, 0xAA, 0xAD, 0xC5, 0xCF, 0xCC, 0xD5, 0xFA, 0xFE, // BIN 316: 13 pairs
+  0x03, 0x57, 0x6C, 0x64, 0x71, 0x85, 0x92, // BIN 317: 3 pairs
+  0x02, 0x5D, 0x5F, 0xA3, 0xB1, // BIN 318: 2 pairs
+  0x06, 0x0F, 0x1B, 0x25, 0x2E, 0x84, 0x8F, 0xAE, 0xBA, 0xAF, 0xBF, 0xB4, 0xB7, // BIN 319: 6 pairs
+  0x04, 0x1A, 0x1D, 0x31, 0x37, 0xBC, 0xC2, 0xC4, 0xCF, // BIN 320: 4 pairs
+  0x07, 0x1A, 0x2B, 0x1C, 0x1E, 0x29, 0x34, 0x49, 0x55, 0x5C, 0x6B, 0x61, 0x68, 0xB3, 0xD1, // BIN 321: 7 pairs
+  0x01, 0x7F, 0x92, // BIN 322: 1 pair
+  0x04, 0x6B, 0x70, 0x72, 0x7B, 0xA2, 0xA3, 0xE4, 0xED, // BIN 323: 4 pairs
+  0x08, 0x16, 0x1E, 0x1A, 0x27, 0x23, 0x3A, 0x26, 0x38, 0x54, 0x59, 0x5F, 0x6E, 0xE3, 0xE9, 0xF3, 0xFB, // BIN 324: 8 pairs
+  0x04, 0x21, 0x41, 0xAF, 0xB0, 0xC3, 0xD9, 0xEC, 0xEE, // BIN 325: 4 pairs
+  0x06, 0x31, 0x36, 0x31, 0x3E, 0x43, 0x54, 0x69, 0x81, 0x87, 0x8D, 0xAA, 0xBA, // BIN 326: 6 pairs
+  0x04, 0x23, 0x2A, 0x67, 0x74, 0x82, 0x93, 0xAD, 0xBB, // BIN 327: 4 pairs
+  0x06, 0x28, 0x2F, 0x47, 0x5E, 0xBA, 0xD3, 0xC3, 0xD1, 0xC4, 0xD7, 0xCA, 0xD8, // BIN 328: 6 pairs
+  0x04, 0x28, 0x32, 0x63, 0x75, 0xA6, 0xAD, 0xF3, 0xF5, // BIN 329: 4 pairs
+  0x06, 0x02, 0xFE, 0x32, 0x42, 0x3A, 0x40, 0x6C, 0x85, 0x95, 0xA2, 0xC0, 0xD7, // BIN 330: 6 pairs
+  0x04, 0x13, 0x9E, 0x29, 0x30, 0x8F, 0xA0, 0x94, 0x98, // BIN 331: 4 pairs
+  0x05, 0x31, 0x34, 0x43, 0x56, 0x80, 0x8B, 0x95, 0xA7, 0xCD, 0xD8, // BIN 332: 5 pairs
+  0x09, 0x09, 0x0F, 0x26, 0x39, 0x33, 0x3F, 0x48, 0x54, 0x5B, 0x62, 0x66, 0x81, 0x75, 0x82, 0xC0, 0xD3, 0xC6, 0xCF, // BIN 333: 9 pairs
+  0x0A, 0x43, 0x4D, 0x47, 0x59, 0x4C, 0x55, 0x4F, 0x59, 0x92, 0xA6, 0xB6, 0xC0, 0xC4, 0xD4, 0xC5, 0xCD, 0xD0, 0xDD, 0xD7, 0xE0, // BIN 334: 10 pairs
+  0x07, 0x02, 0x05, 0x22, 0x2E, 0x29, 0x3F, 0x35, 0x3C, 0x7F, 0x99, 0x7F, 0x9A, 0x8A, 0x95, // BIN 335: 7 pairs
+  0x03, 0x51, 0x5A, 0x8C, 0xA8, 0xA3, 0xAE, // BIN 336: 3 pairs
+  0x03, 0x24, 0x3B, 0xA1, 0xA2, 0xB1, 0xBF, // BIN 337: 3 pairs
+  0x03, 0x5F, 0x75, 0xA4, 0xBD, 0xB4, 0xC8, // BIN 338: 3 pairs
+  0x07, 0x2D, 0x38, 0x57, 0x6D, 0x68, 0x7A, 0x69, 0x84, 0xB0, 0xBC, 0xC8, 0xD8, 0xCF, 0xD8, // BIN 339: 7 pairs
+  0x04, 0x32, 0x40, 0x45, 0x53, 0xBB, 0xD3, 0xBB, 0xD4, // BIN 340: 4 pairs
+  0x03, 0x8B, 0x8F, 0x90, 0xA8, 0xD2, 0xD8, // BIN 341: 3 pairs
+  0x04, 0x6C, 0x78, 0xA2, 0xAA, 0xB1, 0xBC, 0xD6, 0xE2, // BIN 342: 4 pairs
+  0x05, 0x23, 0x33, 0x28, 0x3A, 0x38, 0x3A, 0xD3, 0xE0, 0xEB, 0xF4, // BIN 343: 5 pairs
+  0x06, 0x17, 0x1C, 0x1D, 0x27, 0x66, 0x7D, 0x80, 0x8D, 0xA3, 0xAB, 0xE3, 0xED, // BIN 344: 6 pairs
+  0x07, 0x26, 0x28, 0x49, 0x54, 0x6E, 0x7F, 0x71, 0x72, 0x81, 0x8F, 0x88, 0x8C, 0xB4, 0xCA, // BIN 345: 7 pairs
+  0x04, 0x22, 0x24, 0x31, 0x45, 0x39, 0x4C, 0x7C, 0x83, // BIN 346: 4 pairs
+  0x07, 0x0A, 0x11, 0x0D, 0xFF, 0x8F, 0xA1, 0x99, 0xA7, 0x9A, 0xA7, 0xA2, 0xB2, 0xBA, 0xC9, // BIN 347: 7 pairs
+  0x06, 0x03, 0x0F, 0x32, 0x46, 0x4B, 0x4F, 0x5E, 0x81, 0x60, 0x64, 0xE3, 0xE4, // BIN 348: 6 pairs
+  0x04, 0x2B, 0x2E, 0x69, 0x7F, 0x75, 0x93, 0x7F, 0x9C, // BIN 349: 4 pairs
+  0x07, 0x30, 0x31, 0x57, 0x5D, 0x66, 0x6E, 0x97, 0xA9, 0xB6, 0xCD, 0xD0, 0xDB, 0xF9, 0xFC, // BIN 350: 7 pairs
+  0x07, 0x36, 0x49, 0x59, 0x6D, 0x64, 0x72, 0x9B, 0x9C, 0xAF, 0xBA, 0xC4, 0xD2, 0xC6, 0xCD, // BIN 351: 7 pairs
+  0x06, 0x2E, 0x3B, 0x2E, 0x44, 0x66, 0x84, 0x86, 0x88, 0x9F, 0xAE, 0xA6, 0xBB, // BIN 352: 6 pairs
+  0x06, 0x19, 0x25, 0x20, 0x47, 0x41, 0x56, 0x41, 0x57, 0x6D, 0x78, 0xB6, 0xB7, // BIN 353: 6 pairs
+  0x04, 0x1C, 0x24, 0x48, 0x59, 0x8F, 0x95, 0xE3, 0xE5, // BIN 354: 4 pairs
+  0x03, 0x0A, 0x0E, 0xBD, 0xCF, 0xC7, 0xD9, // BIN 355: 3 pairs
+  0x06, 0x4B, 0x54, 0x78, 0x92, 0x95, 0xAA, 0xB5, 0xCB, 0xCD, 0xDA, 0xCF, 0xDA, // BIN 356: 6 pairs
+  0x05, 0x1D, 0x25, 0x4F, 0x5D, 0x98, 0xA2, 0xA0, 0xA2, 0xB6, 0xD0, // BIN 357: 5 pairs
+  0x0B, 0x39, 0x41, 0x43, 0x4B, 0x5D, 0x6E, 0x67, 0x73, 0x99, 0xA0, 0x9A, 0xA0, 0xA7, 0xBB, 0xAA, 0xB6, 0xAE, 0xBF, 0xB7, 0xC4, 0xBA, 0xD4, // BIN 358: 11 pairs
+  0x05, 0x26, 0x33, 0x78, 0x84, 0x7C, 0x8D, 0xAD, 0xB7, 0xBB, 0xBD, // BIN 359: 5 pairs
+  0x05, 0x08, 0xFF, 0x3F, 0x4D, 0x7D, 0xA4, 0xAA, 0xC0, 0xE0, 0xE8, // BIN 360: 5 pairs
+  0x04, 0x1D, 0x22, 0x77, 0x90, 0x7A, 0x99, 0x7A, 0x9A, // BIN 361: 4 pairs
+  0x06, 0x35, 0x46, 0x4F, 0x57, 0x7A, 0x9C, 0x9F, 0xAF, 0xB5, 0xC3, 0xEC, 0xEF, // BIN 362: 6 pairs
+  0x03, 0x41, 0x4C, 0x5A, 0x62, 0x76, 0x89, // BIN 363: 3 pairs
+  0x06, 0x10, 0x1A, 0x47, 0x5F, 0x58, 0x71, 0x59, 0x68, 0x66, 0x7A, 0xC9, 0xD7, // BIN 364: 6 pairs
+  0x08, 0x1F, 0x29, 0x23, 0x35, 0x39, 0x48, 0xAA, 0xB2, 0xB0, 0xBF, 0xC4, 0xCC, 0xC5, 0xC8, 0xCA, 0xDA, // BIN 365: 8 pairs
+  0x05, 0x0D, 0x19, 0x1F, 0x26, 0x85, 0xA4, 0x8D, 0x94, 0xDC, 0xE9, // BIN 366: 5 pairs
+  0x05, 0x2C, 0x2F, 0x31, 0x39, 0x69, 0x85, 0xBB, 0xC5, 0xC0, 0xC4, // BIN 367: 5 pairs
+  0x08, 0x26, 0x3E, 0x40, 0x50, 0x8B, 0x9B, 0xAB, 0xBC, 0xAE, 0xB1, 0xAF, 0xC4, 0xCF, 0xDD, 0xEA, 0xF6, // BIN 368: 8 pairs
+  0x02, 0xBD, 0xCD, 0xC5, 0xCA, // BIN 369: 2 pairs
+  0x01, 0xAA, 0xB4, // BIN 370: 1 pair
+  0x07, 0x00, 0xFA, 0x08, 0x16, 0x21, 0x47, 0x47, 0x56, 0x69, 0x78, 0x99, 0xBD, 0x9A, 0xBD, // BIN 371: 7 pairs
+  0x09, 0x01, 0xFF, 0x26, 0x3F, 0x2A, 0x3A, 0x2F, 0x45, 0x5E, 0x84, 0x6E, 0x82, 0x75, 0x8F, 0xD1, 0xE1, 0xEF, 0xFF, // BIN 372: 9 pairs
+  0x06, 0x61, 0x75, 0x98, 0x99, 0x98, 0x9A, 0x9C, 0xBD, 0xA6, 0xBA, 0xB3, 0xE1, // BIN 373: 6 pairs
+  0x09, 0x04, 0x0C, 0x18, 0x1C, 0x77, 0x88, 0x78, 0x81, 0x78, 0x93, 0xA4, 0xC6, 0xA8, 0xC7, 0xAB, 0xB5, 0xD0, 0xDF, // BIN 374: 9 pairs
+  0x0B, 0x2E, 0x32, 0x36, 0x3F, 0x42, 0x51, 0x7A, 0x92, 0x88, 0x97, 0x92, 0x9C, 0x92, 0xAA, 0x9F, 0xAD, 0xAC, 0xC9, 0xAD, 0xC4, 0xEC, 0xF7, // BIN 375: 11 pairs
+  0x0B, 0x0B, 0x10, 0x19, 0x1D, 0x2A, 0x32, 0x43, 0x47, 0x8F, 0xA7, 0x93, 0x98, 0x94, 0xA1, 0xAE, 0xC4, 0xB2, 0xC8, 0xB8, 0xC1, 0xCD, 0xDD, // BIN 376: 11 pairs
+  0x09, 0x10, 0x11, 0x13, 0xA5, 0x29, 0x36, 0x4F, 0x53, 0x68, 0x85, 0xA7, 0xBD, 0xC4, 0xDA, 0xC8, 0xDA, 0xDC, 0xDE, // BIN 377: 9 pairs
+  0x05, 0x04, 0xF9, 0x51, 0x5B, 0xB4, 0xC0, 0xBB, 0xD7, 0xC5, 0xD0, // BIN 378: 5 pairs
+  0x08, 0x39, 0x4B, 0x5B, 0x67, 0x99, 0xA1, 0x9A, 0xA1, 0x9B, 0xAC, 0xAE, 0xBB, 0xB6, 0xCF, 0xD1, 0xE4, // BIN 379: 8 pairs
+  0x02, 0x37, 0x3F, 0x78, 0x8B, // BIN 380: 2 pairs
+  0x04, 0x19, 0x2B, 0x2F, 0x37, 0x3E, 0x4F, 0x8F, 0xA4, // BIN 381: 4 pairs
+  0x05, 0x39, 0x3F, 0x93, 0xA0, 0x93, 0xB9, 0xBA, 0xBF, 0xC6, 0xC8, // BIN 382: 5 pairs
+  0x04, 0x1F, 0x28, 0x82, 0x84, 0xBB, 0xC6, 0xC0, 0xD5, // BIN 383: 4 pairs
+  0x05, 0x2A, 0x3F, 0x6E, 0x7D, 0xA2, 0xB4, 0xAE, 0xB0, 0xB2, 0xCA, // BIN 384: 5 pairs
+  0x05, 0x13, 0xF0, 0x65, 0x6B, 0xAA, 0xAE, 0xB6, 0xCC, 0xCB, 0xD6, // BIN 385: 5 pairs
+  0x05, 0x05, 0x12, 0x59, 0x6E, 0x71, 0x8C, 0xA7, 0xAC, 0xC6, 0xCA, // BIN 386: 5 pairs
+  0x04, 0x40, 0x52, 0xA4, 0xC5, 0xBA, 0xD7, 0xD4, 0xE0, // BIN 387: 4 pairs
+  0x06, 0x0B, 0xFF, 0x84, 0xAC, 0x96, 0x97, 0xA3, 0xAD, 0xBF, 0xD3, 0xEE, 0xFA, // BIN 388: 6 pairs
+  0x03, 0x06, 0x10, 0x42, 0x52, 0xBD, 0xC8, // BIN 389: 3 pairs
+  0x06, 0x1F, 0x2A, 0x60, 0x6A, 0x6B, 0x77, 0x89, 0x96, 0xA6, 0xB2, 0xEB, 0xF8, // BIN 390: 6 pairs
+  0x04, 0x47, 0x4F, 0x68, 0x7F, 0x93, 0xA7, 0x94, 0xA0, // BIN 391: 4 pairs
+  0x07, 0x0B, 0x19, 0x20, 0x41, 0x39, 0x4A, 0x8E, 0x91, 0xAD, 0xBF, 0xE8, 0xF1, 0xF5, 0xFB, // BIN 392: 7 pairs
+  0x09, 0x05, 0x0E, 0x2F, 0x34, 0x96, 0xA9, 0xA5, 0xE1, 0xA6, 0xB6, 0xA7, 0xC0, 0xB6, 0xD3, 0xC7, 0xE1, 0xE3, 0xE6, // BIN 393: 9 pairs
+  0x09, 0x11, 0x17, 0x19, 0x27, 0x1B, 0x21, 0x44, 0x4E, 0x54, 0x57, 0x8B, 0xA1, 0xA7, 0xBA, 0xBA, 0xD5, 0xCF, 0xDB, // BIN 394: 9 pairs
+  0x06, 0x47, 0x66, 0x8B, 0xA0, 0xA2, 0xA7, 0xA3, 0xB7, 0xBD, 0xCA, 0xC6, 0xD0, // BIN 395: 6 pairs
+  0x07, 0x4E, 0x5A, 0x5E, 0x7D, 0x76, 0x87, 0xA6, 0xAE, 0xB4, 0xCD, 0xCD, 0xDB, 0xF6, 0xFC, // BIN 396: 7 pairs
+  0x06, 0x32, 0x38, 0x54, 0x61, 0x70, 0x8C, 0x7B, 0x88, 0xB9, 0xC9, 0xCA, 0xDD, // BIN 397: 6 pairs
+  0x02, 0x01, 0xF0, 0x58, 0x70, // BIN 398: 2 pairs
+  0x06, 0x03, 0xF8, 0x06, 0xF7, 0x36, 0x4C, 0x82, 0x95, 0x8F, 0xAC, 0xA7, 0xAD, // BIN 399: 6 pairs
+  0x06, 0x0C, 0x20, 0x3D, 0x50, 0x6F, 0x79, 0x82, 0x9B, 0xA6, 0xB4, 0xD6, 0xDE, // BIN 400: 6 pairs
+  0x09, 0x1B, 0x47, 0x43, 0x4A, 0x4D, 0x56, 0x6E, 0x85, 0x72, 0x86, 0x75, 0x9C, 0x7D, 0x92, 0x81, 0xAC, 0xB4, 0xD0, // BIN 401: 9 pairs
+  0x05, 0x1D, 0x2E, 0x2D, 0x3D, 0x93, 0xA1, 0xA1, 0xAD, 0xAA, 0xBD, // BIN 402: 5 pairs
+  0x0A, 0x12, 0x19, 0x1A, 0x24, 0x24, 0x3D, 0x33, 0x45, 0x3C, 0x50, 0x42, 0x50, 0x4E, 0x52, 0x81, 0x82, 0xB7, 0xD2, 0xBB, 0xD5, // BIN 403: 10 pairs
+  0x05, 0x00, 0xFE, 0x36, 0x41, 0x4A, 0x4F, 0x86, 0xA8, 0x8C, 0x97, // BIN 404: 5 pairs
+  0x03, 0x34, 0x3F, 0x39, 0x4F, 0xD9, 0xE9, // BIN 405: 3 pairs
+  0x01, 0x5C, 0x70, // BIN 406: 1 pair
+  0x05, 0x05, 0x10, 0x3E, 0x53, 0xCA, 0xDB, 0xD2, 0xE0, 0xF2, 0xFE, // BIN 407: 5 pairs
+  0x07, 0x2D, 0x42, 0x82, 0x99, 0x82, 0x9A, 0xA9, 0xAB, 0xC8, 0xDD, 0xCC, 0xD8, 0xD2, 0xDA, // BIN 408: 7 pairs
+  0x04, 0x2E, 0x42, 0x2F, 0x30, 0xB2, 0xC0, 0xC9, 0xD3, // BIN 409: 4 pairs
+  0x01, 0x26, 0x2C, // BIN 410: 1 pair
+  0x07, 0x36, 0x4B, 0x4A, 0x54, 0x4F, 0x55, 0xB7, 0xBC, 0xBF, 0xD8, 0xCF, 0xDF, 0xE7, 0xF1, // BIN 411: 7 pairs
+  0x06, 0x01, 0xEF, 0x02, 0xFD, 0x39, 0x4D, 0x46, 0x52, 0x5D, 0x69, 0x76, 0x83, // BIN 412: 6 pairs
+  0x07, 0x06, 0x16, 0x65, 0x73, 0x6F, 0x7C, 0x85, 0x9B, 0xA2, 0xB6, 0xA6, 0xC0, 0xE1, 0xFF, // BIN 413: 7 pairs
+  0x07, 0x29, 0x3E, 0x41, 0x59, 0x45, 0x55, 0x79, 0x8B, 0x92, 0x94, 0xD2, 0xD3, 0xD2, 0xD5, // BIN 414: 7 pairs
+  0x04, 0x21, 0x48, 0x72, 0x88, 0xC5, 0xD4, 0xE8, 0xF3, // BIN 415: 4 pairs
+  0x06, 0x05, 0x11, 0x2D, 0x46, 0x87, 0x91, 0xAF, 0xBB, 0xBD, 0xD0, 0xF7, 0xFF, // BIN 416: 6 pairs
+  0x06, 0x08, 0xF7, 0x36, 0x4A, 0x47, 0x63, 0x5A, 0x67, 0x94, 0xA6, 0xCD, 0xDF, // BIN 417: 6 pairs
+  0x09, 0x05, 0xFD, 0x12, 0x16, 0x36, 0x48, 0x47, 0x61, 0x66, 0x7F, 0x7E, 0x87, 0x82, 0x98, 0x8C, 0xA5, 0xB1, 0xB2, // BIN 418: 9 pairs
+  0x05, 0x03, 0x0C, 0x40, 0x4E, 0x68, 0x6E, 0xA0, 0xAD, 0xC8, 0xDB, // BIN 419: 5 pairs
+  0x05, 0x08, 0x10, 0x0C, 0x1B, 0x0F, 0x21, 0x9C, 0xA7, 0xC4, 0xDB, // BIN 420: 5 pairs
+  0x03, 0x80, 0x94, 0x8C, 0x9E, 0xF3, 0xFC, // BIN 421: 3 pairs
+  0x06, 0x18, 0x25, 0x27, 0x35, 0x2C, 0x3F, 0x3D, 0x52, 0x66, 0x85, 0x9E, 0xE1, // BIN 422: 6 pairs
+  0x07, 0x09, 0x14, 0x41, 0x54, 0x6B, 0x71, 0x99, 0xA6, 0x9A, 0xA6, 0xCC, 0xDA, 0xEB, 0xF9, // BIN 423: 7 pairs
+  0x05, 0x3A, 0x44, 0x64, 0x77, 0x9C, 0xC6, 0xB4, 0xCF, 0xD2, 0xDB, // BIN 424: 5 pairs
+  0x09, 0x1D, 0x2B, 0x3E, 0x48, 0x3F, 0x53, 0x75, 0x99, 0x75, 0x9A, 0x79, 0x8D, 0x84, 0xB9, 0xF3, 0xF4, 0xF5, 0xFE, // BIN 425: 9 pairs
+  0x04, 0x0C, 0x14, 0x29, 0x39, 0x2D, 0x40, 0x8F, 0xA6, // BIN 426: 4 pairs
+  0x06, 0x0D, 0x10, 0x22, 0x3A, 0x52, 0x60, 0x62, 0x6F, 0x8D, 0x9F, 0xC2, 0xCE, // BIN 427: 6 pairs
+  0x04, 0x16, 0x25, 0x1E, 0x2E, 0x99, 0xAA, 0x9A, 0xAA, // BIN 428: 4 pairs
+  0x0A, 0x06, 0x0A, 0x10, 0x1E, 0x30, 0x35, 0x81, 0xB9, 0x86, 0x9E, 0xAB, 0xB7, 0xBF, 0xD5, 0xC6, 0xD4, 0xCC, 0xDD, 0xDF, 0xE8, // BIN 429: 10 pairs
+  0x03, 0x63, 0x7A, 0x91, 0x97, 0xB4, 0xD3, // BIN 430: 3 pairs
+  0x04, 0x12, 0x1A, 0x45, 0x4C, 0x5B, 0x65, 0xB4, 0xCC, // BIN 431: 4 pairs
+  0x08, 0x0E, 0x10, 0x14, 0x21, 0x30, 0x3F, 0x47, 0x68, 0x4F, 0x61, 0x9A, 0xC6, 0xD6, 0xE0, 0xEE, 0xF2, // BIN 432: 8 pairs
+  0x06, 0x11, 0x18, 0x37, 0x45, 0x6A, 0x6B, 0x99, 0xC6, 0xBF, 0xD6, 0xC3, 0xDC, // BIN 433: 6 pairs
+  0x06, 0x0D, 0x1A, 0x24, 0x40, 0x48, 0x49, 0x7F, 0xA4, 0xB2, 0xCD, 0xBA, 0xBD, // BIN 434: 6 pairs
+  0x08, 0x06, 0xFF, 0x22, 0x30, 0x38, 0x3E, 0x3B, 0x44, 0x9B, 0xA4, 0x9C, 0xC5, 0xCA, 0xDF, 0xE1, 0xF7, // BIN 435: 8 pairs
+  0x02, 0x37, 0x46, 0xA1, 0xBB, // BIN 436: 2 pairs
+  0x06, 0x04, 0xFC, 0x5E, 0x7A, 0x6A, 0x76, 0x94, 0x9B, 0xA0, 0xAC, 0xBF, 0xCE, // BIN 437: 6 pairs
+  0x04, 0x31, 0x4A, 0x7A, 0xA4, 0xAD, 0xB1, 0xB1, 0xB4, // BIN 438: 4 pairs
+  0x0E, 0x12, 0x1D, 0x12, 0x1E, 0x4C, 0x5D, 0x7F, 0x8B, 0x7F, 0x9B, 0x86, 0xA5, 0x9C, 0xA0, 0xA0, 0xBB, 0xA7, 0xB6, 0xB0, 0xB2, 0xBF, 0xCA, 0xD1, 0xDC, 0xDE, 0xE7, 0xE4, 0xEF, // BIN 439: 14 pairs
+  0x09, 0x23, 0x38, 0x2F, 0x49, 0x4E, 0x5B, 0x56, 0x66, 0x6C, 0x82, 0x80, 0x83, 0xAA, 0xC9, 0xB2, 0xD0, 0xBF, 0xC8, // BIN 440: 9 pairs
+  0x08, 0x5D, 0x6C, 0x6D, 0x82, 0x99, 0xC5, 0x9A, 0xC5, 0xA6, 0xBD, 0xBA, 0xC5, 0xC9, 0xD5, 0xCB, 0xDE, // BIN 441: 8 pairs
+  0x04, 0x29, 0x45, 0x2F, 0x4A, 0x46, 0x50, 0x85, 0xAC, // BIN 442: 4 pairs
+  0x07, 0x18, 0x27, 0x26, 0x37, 0x34, 0x46, 0x54, 0x63, 0x5C, 0x71, 0x8E, 0x96, 0xA7, 0xC5, // BIN 443: 7 pairs
+  0x04, 0x63, 0x7D, 0xA3, 0xB2, 0xC2, 0xD9, 0xCE, 0xDE, // BIN 444: 4 pairs
+  0x04, 0x2D, 0x2E, 0x2E, 0x3A, 0x48, 0x4D, 0xE3, 0xEC, // BIN 445: 4 pairs
+  0x07, 0x16, 0x2B, 0x32, 0x44, 0x34, 0x35, 0x5D, 0x66, 0x97, 0xA8, 0xA7, 0xC9, 0xAA, 0xAF, // BIN 446: 7 pairs
+  0x0A, 0x15, 0x1F, 0x17, 0x25, 0x22, 0x2C, 0x28, 0x3F, 0x50, 0x60, 0x65, 0x74, 0xB7, 0xCE, 0xC8, 0xDF, 0xDC, 0xED, 0xE3, 0xEE, // BIN 447: 10 pairs
+  0x05, 0x3C, 0x42, 0x3D, 0x4E, 0x5A, 0x65, 0xAD, 0xC8, 0xC1, 0xC3, // BIN 448: 5 pairs
+  0x08, 0x26, 0x34, 0x30, 0x46, 0x48, 0x5F, 0x54, 0x5F, 0x5F, 0x7A, 0xA7, 0xB2, 0xA7, 0xC6, 0xAA, 0xAC, // BIN 449: 8 pairs
+  0x07, 0x1C, 0x2E, 0x39, 0x45, 0x79, 0x83, 0x7E, 0x8E, 0x9B, 0xA2, 0xA8, 0xD1, 0xB8, 0xBC, // BIN 450: 7 pairs
+  0x0A, 0x13, 0xE1, 0x31, 0x49, 0x3F, 0x4C, 0x82, 0x9C, 0x84, 0x92, 0x95, 0x9F, 0x9B, 0xBD, 0xB8, 0xC7, 0xD6, 0xD8, 0xE2, 0xE8, // BIN 451: 10 pairs
+  0x08, 0x3B, 0x50, 0x3E, 0x41, 0x5C, 0x72, 0x5F, 0x7D, 0x75, 0xA4, 0xA9, 0xC2, 0xAA, 0xC8, 0xAA, 0xCC, // BIN 452: 8 pairs
+  0x07, 0x08, 0xF0, 0x36, 0x4D, 0x3B, 0x3D, 0x7B, 0x9E, 0xA7, 0xB4, 0xB8, 0xCB, 0xBB, 0xBF, // BIN 453: 7 pairs
+  0x06, 0x1C, 0x23, 0x1F, 0x2F, 0x36, 0x45, 0x50, 0x5C, 0xAD, 0xB0, 0xAD, 0xC0, // BIN 454: 6 pairs
+  0x07, 0x15, 0x1C, 0x29, 0x2D, 0x3A, 0x4E, 0x55, 0x5D, 0x8A, 0x9F, 0xC4, 0xDD, 0xE4, 0xEE, // BIN 455: 7 pairs
+  0x0A, 0x1E, 0x3B, 0x43, 0x57, 0x51, 0x52, 0x53, 0x56, 0x7D, 0xAC, 0x89, 0x8D, 0x8F, 0xAA, 0x98, 0x9C, 0xA1, 0xAC, 0xF1, 0xFB, // BIN 456: 10 pairs
+  0x07, 0x38, 0x4A, 0x56, 0x69, 0x57, 0x6E, 0x8A, 0x8E, 0xA6, 0xAF, 0xAD, 0xCA, 0xBA, 0xC6, // BIN 457: 7 pairs
+  0x07, 0x11, 0x1C, 0x3B, 0x40, 0x49, 0x56, 0x4F, 0x5F, 0x57, 0x75, 0xBA, 0xD8, 0xE1, 0xE4, // BIN 458: 7 pairs
+  0x08, 0x18, 0x24, 0x22, 0x28, 0x26, 0x30, 0x34, 0x45, 0x62, 0x67, 0x6D, 0x93, 0x9C, 0xA1, 0xB6, 0xD5, // BIN 459: 8 pairs
+  0x0E, 0x03, 0x20, 0x55, 0x56, 0x5F, 0x81, 0x92, 0xAC, 0x93, 0xBD, 0xA0, 0xBD, 0xA1, 0xBA, 0xAA, 0xC5, 0xAC, 0xC0, 0xB0, 0xB4, 0xB6, 0xD4, 0xBF, 0xD0, 0xCC, 0xDB, 0xEA, 0xF9, // BIN 460: 14 pairs
+  0x05, 0x35, 0x37, 0x4C, 0x59, 0x93, 0xA6, 0xC7, 0xE4, 0xDB, 0xE8, // BIN 461: 5 pairs
+  0x0F, 0x0A, 0x17, 0x0F, 0x14, 0x22, 0x34, 0x37, 0x42, 0x48, 0x61, 0x59, 0x75, 0x60, 0x72, 0x66, 0x78, 0x78, 0x99, 0x78, 0x9A, 0x7C, 0x87, 0x7E, 0x8B, 0x9F, 0xB2, 0xB2, 0xCF, 0xCB, 0xD2, // BIN 462: 15 pairs
+  0x05, 0x1F, 0x31, 0x21, 0x43, 0x36, 0x4F, 0x5E, 0x6E, 0xB1, 0xCE, // BIN 463: 5 pairs
+  0x07, 0x08, 0x19, 0x17, 0x24, 0x17, 0x27, 0x34, 0x42, 0x3E, 0x54, 0xAA, 0xCA, 0xF4, 0xF8, // BIN 464: 7 pairs
+  0x04, 0x0B, 0x1A, 0x23, 0x2E, 0x30, 0x42, 0xA1, 0xAE, // BIN 465: 4 pairs
+  0x04, 0x71, 0x9E, 0x94, 0xAA, 0xA6, 0xAC, 0xB2, 0xCC, // BIN 466: 4 pairs
+  0x05, 0x16, 0x1D, 0x21, 0x39, 0xA0, 0xBA, 0xA7, 0xAE, 0xBD, 0xD4, // BIN 467: 5 pairs
+  0x05, 0x0E, 0x15, 0x98, 0xAD, 0xAA, 0xC6, 0xBE, 0xF0, 0xDC, 0xEC, // BIN 468: 5 pairs
+  0x05, 0x43, 0x53, 0x63, 0x81, 0x68, 0x78, 0xB0, 0xC1, 0xC5, 0xD7, // BIN 469: 5 pairs
+  0x08, 0x11, 0x15, 0x1A, 0x3B, 0x43, 0x59, 0x61, 0x7A, 0x83, 0x8A, 0xA9, 0xC3, 0xB2, 0xD3, 0xDD, 0xE8, // BIN 470: 8 pairs
+  0x07, 0x0E, 0x17, 0x1B, 0x5E, 0x27, 0x3D, 0x2F, 0x4B, 0x4F, 0x63, 0x85, 0x8B, 0xAB, 0xC1, // BIN 471: 7 pairs
+  0x08, 0x63, 0x78, 0x69, 0x82, 0x94, 0xA7, 0xA1, 0xB2, 0xB1, 0xC1, 0xC0, 0xD8, 0xC4, 0xDF, 0xD0, 0xE0, // BIN 472: 8 pairs
+  0x09, 0x04, 0x0F, 0x18, 0x2B, 0x1A, 0x1C, 0x2A, 0x45, 0x4E, 0x50, 0x56, 0x5E, 0x6B, 0x73, 0x88, 0x91, 0xA1, 0xBD, // BIN 473: 9 pairs
+  0x06, 0x0A, 0x18, 0x16, 0x27, 0x31, 0x4B, 0x80, 0x95, 0xB0, 0xCE, 0xCC, 0xDF, // BIN 474: 6 pairs
+  0x08, 0x1C, 0x27, 0x2C, 0x35, 0x6E, 0x81, 0x6E, 0x84, 0x72, 0x8C, 0x8B, 0xA6, 0x92, 0xA4, 0x93, 0xAA, // BIN 475: 8 pairs
+  0x03, 0x12, 0x1C, 0x6B, 0x7B, 0xD9, 0xEC, // BIN 476: 3 pairs
+  0x0A, 0x19, 0x24, 0x1E, 0x3C, 0x21, 0x36, 0x23, 0x29, 0x25, 0x35, 0x64, 0x7B, 0x7B, 0xA5, 0xB1, 0xB6, 0xB6, 0xD7, 0xE9, 0xEF, // BIN 477: 10 pairs
+  0x08, 0x44, 0x51, 0x5F, 0x84, 0x7C, 0x8B, 0x81, 0x92, 0x9F, 0xB0, 0xB7, 0xBA, 0xBB, 0xD8, 0xC1, 0xD6, // BIN 478: 8 pairs
+  0x05, 0x20, 0x48, 0x3C, 0x52, 0x72, 0x73, 0xA4, 0xA7, 0xD2, 0xDF, // BIN 479: 5 pairs
+  0x0B, 0x02, 0x0A, 0x22, 0x3D, 0x5E, 0x85, 0x63, 0x7F, 0x6F, 0x7E, 0x86, 0x97, 0x8A, 0xA2, 0x93, 0x95, 0x94, 0xA3, 0xA1, 0xB6, 0xC2, 0xDC, // BIN 480: 11 pairs
+  0x03, 0x1F, 0x2C, 0x85, 0x98, 0x8C, 0xB3, // BIN 481: 3 pairs
+  0x04, 0x26, 0x45, 0x47, 0x69, 0xA5, 0xC7, 0xB6, 0xC9, // BIN 482: 4 pairs
+  0x0B, 0x10, 0x1D, 0x1F, 0x23, 0x2E, 0x46, 0x4B, 0x56, 0x63, 0x84, 0xA0, 0xAE, 0xA0, 0xC0, 0xA3, 0xB4, 0xA7, 0xCC, 0xBC, 0xD6, 0xC6, 0xD7, // BIN 483: 11 pairs
+  0x07, 0x0C, 0x21, 0x2D, 0x31, 0x35, 0x3B, 0x98, 0xAC, 0xA1, 0xB4, 0xB8, 0xD1, 0xEE, 0xFD, // BIN 484: 7 pairs
+  0x04, 0x48, 0x63, 0x82, 0xA0, 0x9F, 0xB1, 0xEA, 0xF4, // BIN 485: 4 pairs
+  0x08, 0x09, 0xF9, 0x48, 0x5D, 0x8B, 0xA7, 0x8E, 0x9F, 0xA0, 0xB2, 0xA1, 0xC0, 0xAA, 0xCD, 0xBF, 0xCD, // BIN 486: 8 pairs
+  0x07, 0x01, 0x10, 0x30, 0x45, 0x78, 0x9C, 0x7A, 0x9B, 0x7D, 0x9B, 0xAE, 0xC8, 0xC6, 0xEA, // BIN 487: 7 pairs
+  0x03, 0x22, 0x37, 0x61, 0x7D, 0xE0, 0xE2, // BIN 488: 3 pairs
+  0x08, 0x0B, 0xF7, 0x2C, 0x45, 0x36, 0x38, 0x3E, 0x55, 0x48, 0x4B, 0x7A, 0x8B, 0x91, 0xA9, 0xBC, 0xD2, // BIN 489: 8 pairs
+  0x05, 0x01, 0x16, 0x5E, 0x7F, 0xA6, 0xC9, 0xB5, 0xCE, 0xF2, 0xFA, // BIN 490: 5 pairs
+  0x07, 0x04, 0x07, 0x06, 0xF0, 0x41, 0x49, 0x53, 0x5D, 0x7E, 0x94, 0x9D, 0xB5, 0xB8, 0xD9, // BIN 491: 7 pairs
+  0x09, 0x24, 0x44, 0x41, 0x5F, 0x52, 0x5C, 0x67, 0x76, 0x6D, 0x8F, 0x8B, 0x93, 0xA0, 0xB6, 0xA2, 0xBA, 0xDC, 0xE5, // BIN 492: 9 pairs
+  0x07, 0x27, 0x40, 0x55, 0x62, 0x56, 0x6C, 0x6D, 0x9C, 0x7B, 0xA8, 0xC3, 0xCB, 0xC5, 0xEA, // BIN 493: 7 pairs
+  0x04, 0x02, 0x0E, 0x47, 0x54, 0x7F, 0x98, 0xA4, 0xC9, // BIN 494: 4 pairs
+  0x08, 0x04, 0xF6, 0x0A, 0x0B, 0x4C, 0x57, 0x8A, 0x98, 0xAE, 0xCA, 0xB4, 0xD5, 0xD6, 0xDA, 0xD6, 0xDB, // BIN 495: 8 pairs
+  0x0A, 0x24, 0x32, 0x5B, 0x6A, 0x68, 0x93, 0x68, 0x9C, 0x82, 0xA1, 0x8B, 0xA2, 0x90, 0x9D, 0x90, 0xB3, 0xBF, 0xDA, 0xE6, 0xE8, // BIN 496: 10 pairs
+  0x08, 0x0B, 0x18, 0x13, 0xBE, 0x5D, 0x6D, 0x60, 0x67, 0x75, 0x92, 0x90, 0xA5, 0xA0, 0xB4, 0xE2, 0xE3, // BIN 497: 8 pairs
+  0x07, 0x14, 0x20, 0x1C, 0x25, 0x1E, 0x22, 0xC0, 0xDA, 0xC4, 0xC9, 0xE9, 0xF7, 0xED, 0xFA, // BIN 498: 7 pairs
+  0x08, 0x05, 0xFA, 0x6C, 0x93, 0x9C, 0xA6, 0x9C, 0xAA, 0x9D, 0xAB, 0xAA, 0xCF, 0xBF, 0xD7, 0xD2, 0xDD, // BIN 499: 8 pairs
+  0x04, 0x06, 0x19, 0x95, 0x99, 0x95, 0x9A, 0x96, 0xAB, // BIN 500: 4 pairs
+  0x0B, 0x11, 0x1D, 0x30, 0x3D, 0x4D, 0x5D, 0x5F, 0x7F, 0x61, 0x78, 0x78, 0x9B, 0xA7, 0xC8, 0xB0, 0xB6, 0xC4, 0xE0, 0xD2, 0xE2, 0xD6, 0xE5, // BIN 501: 11 pairs
+  0x07, 0x0D, 0x18, 0x17, 0x2B, 0x87, 0x96, 0x94, 0xAD, 0x9F, 0xB4, 0xB4, 0xD4, 0xB6, 0xD8, // BIN 502: 7 pairs
+  0x07, 0x08, 0x0A, 0x08, 0xEF, 0x1F, 0x33, 0x68, 0xA4, 0xA6, 0xC5, 0xAC, 0xCC, 0xE0, 0xE7, // BIN 503: 7 pairs
+  0x09, 0x2B, 0x35, 0x2C, 0x46, 0x3F, 0x55, 0x47, 0x4C, 0x8A, 0x92, 0xA6, 0xC8, 0xAD, 0xCD, 0xD6, 0xE6, 0xE1, 0xEC, // BIN 504: 9 pairs
+  0x06, 0x0D, 0xF0, 0x40, 0x51, 0xA6, 0xCC, 0xBC, 0xBF, 0xD2, 0xD7, 0xDD, 0xEB, // BIN 505: 6 pairs
+  0x05, 0x63, 0x85, 0x7F, 0xAC, 0x84, 0x9B, 0xC7, 0xDC, 0xDA, 0xE8, // BIN 506: 5 pairs
+  0x04, 0x00, 0x0E, 0x0C, 0xF8, 0x38, 0x4B, 0xF4, 0xFB, // BIN 507: 4 pairs
+  0x08, 0x0B, 0xF0, 0x1D, 0x35, 0x3F, 0x43, 0x48, 0x5E, 0x88, 0x9D, 0x9B, 0xBB, 0xAE, 0xC0, 0xB1, 0xC4, // BIN 508: 8 pairs
+  0x08, 0x0E, 0x18, 0x38, 0x49, 0x5F, 0x78, 0x9F, 0xA6, 0xB0, 0xB5, 0xB1, 0xD2, 0xCE, 0xE2, 0xE7, 0xF2, // BIN 509: 8 pairs
+  0x05, 0x01, 0x0A, 0x34, 0x3D, 0x78, 0x95, 0xA6, 0xC6, 0xAF, 0xC8, // BIN 510: 5 pairs
+  0x07, 0x02, 0xFA, 0x06, 0xEF, 0x1C, 0x35, 0x22, 0x27, 0x33, 0x46, 0x70, 0x90, 0x8B, 0x8D, // BIN 511: 7 pairs
+  0x05, 0x0D, 0x13, 0x41, 0x5E, 0x47, 0x6C, 0x6F, 0x80, 0x80, 0x82, // BIN 512: 5 pairs
+  0x09, 0x05, 0x06, 0x47, 0x6D, 0x58, 0x6B, 0x71, 0xA5, 0x9D, 0xB8, 0xA0, 0xA4, 0xA7, 0xCA, 0xB1, 0xCB, 0xE4, 0xF7, // BIN 513: 9 pairs
+  0x07, 0x23, 0x3D, 0x45, 0x51, 0x71, 0x90, 0x90, 0x9E, 0xBF, 0xCF, 0xC0, 0xDD, 0xD9, 0xDE, // BIN 514: 7 pairs
+  0x06, 0x7C, 0x8E, 0x88, 0x96, 0x9E, 0xFF, 0xB0, 0xCB, 0xBA, 0xDA, 0xBF, 0xD4, // BIN 515: 6 pairs
+  0x08, 0x27, 0x44, 0x29, 0x3A, 0x31, 0x3A, 0x37, 0x3D, 0x61, 0x81, 0x6C, 0x8F, 0x85, 0xA0, 0xA6, 0xCA, // BIN 516: 8 pairs
+  0x07, 0x22, 0x40, 0x41, 0x4D, 0x56, 0x6E, 0x7D, 0xB9, 0x92, 0xA2, 0xAF, 0xCA, 0xB4, 0xD7, // BIN 517: 7 pairs
+  0x06, 0x41, 0x61, 0x61, 0x7F, 0xA8, 0xE1, 0xAD, 0xD0, 0xCF, 0xE0, 0xEC, 0xF0, // BIN 518: 6 pairs
+  0x08, 0x0F, 0xF8, 0x30, 0x40, 0x3A, 0x51, 0x5C, 0x65, 0x95, 0xAD, 0xB3, 0xC3, 0xB9, 0xC0, 0xCD, 0xE0, // BIN 519: 8 pairs
+  0x02, 0x5F, 0x85, 0xF2, 0xF3, // BIN 520: 2 pairs
+  0x06, 0x25, 0x3D, 0x2C, 0x42, 0x52, 0x5A, 0x93, 0xC6, 0x9F, 0xAB, 0xF2, 0xFD, // BIN 521: 6 pairs
+  0x0C, 0x07, 0xFB, 0x15, 0x22, 0x19, 0x1C, 0x38, 0x39, 0x70, 0x88, 0x7A, 0xAC, 0x7F, 0x95, 0x9B, 0xAD, 0x9F, 0xA1, 0xA2, 0xBB, 0xBD, 0xD7, 0xC5, 0xD3, // BIN 522: 12 pairs
+  0x02, 0x94, 0xAE, 0xA9, 0xBC, // BIN 523: 2 pairs
+  0x07, 0x00, 0x12, 0x0B, 0x12, 0x0E, 0x1C, 0x98, 0xBB, 0x99, 0xC9, 0x9A, 0xC9, 0xAD, 0xCC, // BIN 524: 7 pairs
+  0x0A, 0x1D, 0x3C, 0x23, 0x24, 0x26, 0x49, 0x2B, 0x3D, 0x3A, 0x3F, 0x5D, 0x5E, 0x9B, 0xC5, 0xAA, 0xD0, 0xBB, 0xDA, 0xBE, 0xEF, // BIN 525: 10 pairs
+  0x0D, 0x06, 0x12, 0x34, 0x40, 0x5A, 0x6A, 0x6D, 0xA4, 0x98, 0x9F, 0x9B, 0xC6, 0xA1, 0xAF, 0xB1, 0xB5, 0xB4, 0xC9, 0xC4, 0xD6, 0xC9, 0xDD, 0xCA, 0xE0, 0xD9, 0xED, // BIN 526: 13 pairs
+  0x0A, 0x04, 0xF8, 0x33, 0x3E, 0x39, 0x54, 0x3C, 0x46, 0x43, 0x55, 0x85, 0xB9, 0x8B, 0xAA, 0x98, 0xAE, 0xA9, 0xC1, 0xC9, 0xEA, // BIN 527: 10 pairs
+  0x0A, 0x19, 0x3B, 0x6D, 0x99, 0x6D, 0x9A, 0x78, 0x98, 0x9F, 0xB7, 0xA3, 0xB6, 0xA7, 0xAF, 0xA7, 0xCD, 0xB9, 0xEA, 0xDF, 0xEB, // BIN 528: 10 pairs
+  0x05, 0x0B, 0x17, 0x22, 0x2A, 0x8F, 0xB9, 0x93, 0xC5, 0x9B, 0xC0, // BIN 529: 5 pairs
+  0x07, 0x28, 0x45, 0x2A, 0x36, 0x37, 0x40, 0x43, 0x45, 0x61, 0x84, 0xA0, 0xC5, 0xA2, 0xB7, // BIN 530: 7 pairs
+  0x06, 0x85, 0x95, 0x9C, 0xC9, 0xA5, 0xD1, 0xAD, 0xCF, 0xBF, 0xDB, 0xC1, 0xD2, // BIN 531: 6 pairs
+  0x06, 0x1B, 0x68, 0x2D, 0x44, 0x74, 0x89, 0x81, 0x9B, 0xB4, 0xD8, 0xB7, 0xC1, // BIN 532: 6 pairs
+  0x07, 0x05, 0xFE, 0x50, 0x51, 0x79, 0x94, 0x9B, 0xB9, 0xA7, 0xB9, 0xB0, 0xD2, 0xDC, 0xE6, // BIN 533: 7 pairs
+  0x0D, 0x00, 0x10, 0x1B, 0x41, 0x29, 0x32, 0x2A, 0x3E, 0x2F, 0x43, 0x38, 0x46, 0x3D, 0x51, 0x41, 0x63, 0x6A, 0x72, 0x85, 0xA1, 0xA0, 0xC6, 0xA1, 0xA4, 0xAB, 0xAF, // BIN 534: 13 pairs
+  0x0B, 0x07, 0xFC, 0x0D, 0xF7, 0x1F, 0x30, 0x56, 0x6D, 0x69, 0x93, 0x83, 0x91, 0x98, 0xBD, 0xAC, 0xBB, 0xB2, 0xD5, 0xB9, 0xCC, 0xC9, 0xD8, // BIN 535: 11 pairs
+  0x07, 0x22, 0x33, 0x48, 0x66, 0x82, 0x8A, 0xA5, 0xF0, 0xB0, 0xC4, 0xC1, 0xDE, 0xE5, 0xE8, // BIN 536: 7 pairs
+  0x08, 0x08, 0x1A, 0x0A, 0x16, 0x65, 0x72, 0x6E, 0x8F, 0x8D, 0x95, 0x9E, 0xF0, 0x9F, 0xAA, 0xB6, 0xD2, // BIN 537: 8 pairs
+  0x0C, 0x15, 0x23, 0x29, 0x4A, 0x48, 0x4A, 0x8E, 0xA3, 0xA0, 0xC9, 0xA7, 0xCF, 0xB4, 0xD2, 0xC0, 0xDB, 0xC6, 0xD3, 0xC8, 0xE0, 0xC9, 0xDA, 0xD5, 0xD6, // BIN 538: 12 pairs
+  0x08, 0x0D, 0x17, 0x23, 0x31, 0x3B, 0x52, 0x4A, 0x56, 0x77, 0x9E, 0x7F, 0xA0, 0xA6, 0xCD, 0xB7, 0xD6, // BIN 539: 8 pairs
+  0x02, 0x26, 0x4A, 0x86, 0xB3, // BIN 540: 2 pairs
+  0x0B, 0x1A, 0x3C, 0x25, 0x40, 0x2B, 0x40, 0x33, 0x35, 0x43, 0x5D, 0x45, 0x4E, 0x72, 0x90, 0x79, 0x82, 0x80, 0x8E, 0xD6, 0xDF, 0xE5, 0xED, // BIN 541: 11 pairs
+  0x0D, 0x00, 0x11, 0x1F, 0x38, 0x2D, 0x2F, 0x33, 0x42, 0x3A, 0x45, 0x3B, 0x58, 0x6C, 0x9C, 0x7C, 0x94, 0x98, 0xA4, 0x9F, 0xA0, 0x9F, 0xB6, 0xA1, 0xC5, 0xA5, 0xFF, // BIN 542: 13 pairs
+  0x07, 0x3E, 0x56, 0x87, 0x8A, 0x8B, 0x99, 0x8B, 0x9A, 0x8E, 0x94, 0x97, 0xB8, 0xB2, 0xD4, // BIN 543: 7 pairs
+  0x0A, 0x1F, 0x34, 0x28, 0x35, 0x2B, 0x44, 0x56, 0x68, 0x8F, 0x94, 0x9E, 0xC7, 0xA0, 0xAF, 0xA2, 0xB1, 0xAE, 0xCD, 0xB7, 0xCB, // BIN 544: 10 pairs
+  0x06, 0x13, 0xEF, 0x23, 0x40, 0x80, 0x87, 0x98, 0xB2, 0x9B, 0xBA, 0xAF, 0xC0, // BIN 545: 6 pairs
+  0x06, 0x7A, 0x98, 0x8D, 0xA2, 0xA1, 0xC6, 0xA1, 0xC9, 0xD0, 0xD2, 0xD2, 0xD4, // BIN 546: 6 pairs
+  0x05, 0x52, 0x65, 0x68, 0x82, 0x88, 0x89, 0x98, 0xBA, 0xD1, 0xE9, // BIN 547: 5 pairs
+  0x05, 0x29, 0x49, 0x61, 0x85, 0x74, 0x83, 0xA2, 0xB0, 0xAA, 0xC4, // BIN 548: 5 pairs
+  0x03, 0x68, 0x99, 0x68, 0x9A, 0x82, 0xA4, // BIN 549: 3 pairs
+  0x06, 0x2F, 0x4D, 0x47, 0x5D, 0x85, 0xA7, 0xBF, 0xC0, 0xC5, 0xD5, 0xED, 0xF2, // BIN 550: 6 pairs
+  0x07, 0x1D, 0x3B, 0x41, 0x4B, 0x58, 0x60, 0x82, 0xA7, 0x8D, 0xA3, 0xA4, 0xAA, 0xD6, 0xE7, // BIN 551: 7 pairs
+  0x08, 0x24, 0x2D, 0x33, 0x4A, 0x39, 0x53, 0x52, 0x5B, 0x69, 0x8F, 0xA6, 0xCF, 0xAE, 0xD0, 0xC2, 0xC7, // BIN 552: 8 pairs
+  0x0C, 0x0A, 0xFD, 0x1A, 0x2E, 0x32, 0x4E, 0x39, 0x47, 0x58, 0x77, 0x5C, 0x77, 0x73, 0x89, 0x74, 0x87, 0x7D, 0x8B, 0x82, 0x94, 0xB7, 0xBB, 0xD1, 0xEC, // BIN 553: 12 pairs
+  0x04, 0x09, 0xF8, 0x4C, 0x61, 0x57, 0x81, 0xBC, 0xC3, // BIN 554: 4 pairs
+  0x07, 0x22, 0x3C, 0x2C, 0x3D, 0x31, 0x32, 0x78, 0x80, 0x7F, 0xA1, 0xD3, 0xD6, 0xD4, 0xEB, // BIN 555: 7 pairs
+  0x07, 0x2E, 0x50, 0x32, 0x3C, 0x5E, 0x78, 0x66, 0x82, 0x9B, 0xC9, 0xC2, 0xD1, 0xCB, 0xDC, // BIN 556: 7 pairs
+  0x07, 0x22, 0x25, 0x31, 0x4D, 0x5D, 0x68, 0x60, 0x70, 0xB2, 0xC9, 0xBF, 0xCC, 0xC0, 0xDF, // BIN 557: 7 pairs
+  0x05, 0x1F, 0x37, 0x25, 0x44, 0xAB, 0xCB, 0xB2, 0xD7, 0xCA, 0xD2, // BIN 558: 5 pairs
+  0x05, 0x70, 0x9E, 0x75, 0xAC, 0x76, 0x88, 0xBD, 0xEA, 0xE6, 0xF2, // BIN 559: 5 pairs
+  0x07, 0x00, 0x06, 0x23, 0x42, 0x41, 0x66, 0x64, 0x65, 0xA4, 0xA6, 0xBA, 0xDB, 0xD7, 0xEB, // BIN 560: 7 pairs
+  0x08, 0x02, 0x11, 0x39, 0x56, 0x7D, 0x98, 0x98, 0xB4, 0x98, 0xB6, 0xB2, 0xD2, 0xB6, 0xBD, 0xED, 0xF7, // BIN 561: 8 pairs
+  0x0A, 0x08, 0x18, 0x10, 0x1C, 0x1D, 0x23, 0x78, 0x79, 0x94, 0xAF, 0x95, 0xAE, 0xBB, 0xDD, 0xE5, 0xEE, 0xE7, 0xF3, 0xEC, 0xFA, // BIN 562: 10 pairs
+  0x0D, 0x0A, 0x19, 0x2D, 0x3F, 0x33, 0x36, 0x35, 0x50, 0x45, 0x4F, 0x48, 0x53, 0x68, 0x8F, 0x8A, 0xA1, 0x8F, 0xBD, 0xAD, 0xD3, 0xBD, 0xD3, 0xC2, 0xDE, 0xE6, 0xED, // BIN 563: 13 pairs
+  0x03, 0x0C, 0xF9, 0x24, 0x42, 0x26, 0x4B, // BIN 564: 3 pairs
+  0x07, 0x08, 0x12, 0x26, 0x43, 0x73, 0x88, 0x79, 0x87, 0xBA, 0xDD, 0xC6, 0xD5, 0xC8, 0xD2, // BIN 565: 7 pairs
+  0x02, 0x1C, 0x2B, 0x20, 0x43, // BIN 566: 2 pairs
+  0x09, 0x04, 0x14, 0x06, 0x18, 0x57, 0x7D, 0x59, 0x7A, 0x6B, 0x74, 0x6B, 0x86, 0x77, 0xA5, 0xA3, 0xBF, 0xAF, 0xCD, // BIN 567: 9 pairs
+  0x05, 0x1E, 0x35, 0x37, 0x4E, 0x58, 0x7B, 0xA8, 0xC3, 0xE4, 0xF0, // BIN 568: 5 pairs
+  0x09, 0x16, 0x24, 0x1B, 0x57, 0x41, 0x5D, 0x53, 0x62, 0x58, 0x72, 0x66, 0x93, 0xAB, 0xB8, 0xAB, 0xC2, 0xBB, 0xDB, // BIN 569: 9 pairs
+  0x09, 0x0B, 0xEF, 0x60, 0x73, 0x98, 0xC0, 0xAF, 0xD0, 0xB2, 0xD8, 0xBE, 0xFF, 0xC9, 0xDB, 0xD8, 0xE8, 0xF7, 0xFA, // BIN 570: 9 pairs
+  0x05, 0x03, 0xB9, 0x11, 0x1E, 0xA7, 0xD0, 0xAC, 0xCF, 0xDC, 0xEE, // BIN 571: 5 pairs
+  0x08, 0x08, 0x13, 0x6C, 0x99, 0x6C, 0x9A, 0x7E, 0x89, 0xAE, 0xCC, 0xAE, 0xCF, 0xB7, 0xD3, 0xE7, 0xF5, // BIN 572: 8 pairs
+  0x08, 0x29, 0x4B, 0x79, 0x95, 0x8A, 0xA0, 0x8C, 0xBE, 0x99, 0xC0, 0x9A, 0xC0, 0xB6, 0xDA, 0xC9, 0xDF, // BIN 573: 8 pairs
+  0x0A, 0x01, 0x05, 0x06, 0x1A, 0x13, 0x71, 0x2C, 0x40, 0x2F, 0x4C, 0xA0, 0xCC, 0xB6, 0xC5, 0xD1, 0xEF, 0xD6, 0xDD, 0xE6, 0xEE, // BIN 574: 10 pairs
+  0x06, 0x0D, 0x12, 0x2A, 0x39, 0x57, 0x84, 0x69, 0x9C, 0x8B, 0x9F, 0xBF, 0xE0, // BIN 575: 6 pairs
+  0x09, 0x03, 0xEA, 0x0E, 0x1D, 0x38, 0x42, 0x45, 0x54, 0x59, 0x7D, 0x5D, 0x75, 0x78, 0xA4, 0x7A, 0x95, 0xD2, 0xDE, // BIN 576: 9 pairs
+  0x06, 0x0A, 0x0D, 0x31, 0x43, 0x43, 0x61, 0x57, 0x7A, 0x80, 0x92, 0xA1, 0xCC, // BIN 577: 6 pairs
+  0x08, 0x2E, 0x30, 0x2F, 0x3A, 0x77, 0xA8, 0x97, 0xB3, 0xA6, 0xD0, 0xBE, 0xC3, 0xBF, 0xCB, 0xCB, 0xE2, // BIN 578: 8 pairs
+  0x03, 0x3F, 0x4F, 0x4F, 0x66, 0xE6, 0xF1, // BIN 579: 3 pairs
+  0x07, 0x23, 0x46, 0x43, 0x5F, 0x89, 0x9D, 0xAE, 0xD3, 0xB8, 0xDC, 0xE1, 0xE9, 0xE5, 0xF2, // BIN 580: 7 pairs
+  0x0E, 0x01, 0x19, 0x0B, 0x13, 0x20, 0x57, 0x20, 0x5E, 0x24, 0x3A, 0x5A, 0x60, 0x5B, 0x60, 0x63, 0x82, 0x6C, 0xA4, 0x71, 0x88, 0x72, 0x74, 0x95, 0x9C, 0xDB, 0xEB, 0xED, 0xEF, // BIN 581: 14 pairs
+  0x0A, 0x07, 0x09, 0x13, 0xB3, 0x26, 0x2D, 0x36, 0x54, 0x54, 0x66, 0x7B, 0x97, 0x7F, 0xA7, 0x92, 0xBD, 0xAF, 0xD3, 0xBA, 0xD2, // BIN 582: 10 pairs
+  0x05, 0x22, 0x42, 0x82, 0xA6, 0xAC, 0xCD, 0xAF, 0xD2, 0xD4, 0xEA, // BIN 583: 5 pairs
+  0x06, 0x1B, 0x66, 0x34, 0x4E, 0x7E, 0x95, 0x91, 0xAB, 0xC3, 0xE4, 0xCC, 0xE0, // BIN 584: 6 pairs
+  0x09, 0x13, 0x58, 0x16, 0x3B, 0x1C, 0x32, 0x23, 0x2F, 0x4D, 0x59, 0x50, 0x64, 0x9B, 0xB2, 0x9B, 0xB6, 0xD9, 0xE1, // BIN 585: 9 pairs
+  0x06, 0x64, 0x86, 0x98, 0xAF, 0x9B, 0xAE, 0xA1, 0xC8, 0xAB, 0xAE, 0xB7, 0xC8, // BIN 586: 6 pairs
+  0x0B, 0x1C, 0x2D, 0x1F, 0x2D, 0x35, 0x4E, 0x4C, 0x5F, 0x59, 0x81, 0x66, 0x9C, 0x8A, 0x9B, 0xA0, 0xC8, 0xA4, 0xC0, 0xBE, 0xE4, 0xBF, 0xDD, // BIN 587: 11 pairs
+  0x07, 0x04, 0xF4, 0x54, 0x69, 0x6B, 0x88, 0x7A, 0xA0, 0x9F, 0xA7, 0xB7, 0xCA, 0xD1, 0xE3, // BIN 588: 7 pairs
+  0x03, 0x5E, 0xA4, 0xBF, 0xDF, 0xCD, 0xD2, // BIN 589: 3 pairs
+  0x07, 0x36, 0x53, 0x4F, 0x5E, 0x6E, 0x93, 0x7D, 0xA0, 0xA0, 0xB9, 0xAA, 0xB9, 0xB6, 0xC6, // BIN 590: 7 pairs
+  0x0B, 0x06, 0x17, 0x08, 0x17, 0x23, 0x26, 0x37, 0x4A, 0x49, 0x5D, 0x4B, 0x5D, 0x5E, 0x9C, 0x78, 0xA0, 0x82, 0xAC, 0x9E, 0xD1, 0xA6, 0xC4, // BIN 591: 11 pairs
+  0x03, 0x37, 0x3E, 0x45, 0x46, 0xCB, 0xD9, // BIN 592: 3 pairs
+  0x05, 0x0D, 0xEF, 0x3B, 0x42, 0x67, 0x6B, 0xE8, 0xF5, 0xEE, 0xF7, // BIN 593: 5 pairs
+  0x06, 0x35, 0x52, 0x84, 0x98, 0x9B, 0xB4, 0xAB, 0xCE, 0xAD, 0xC9, 0xEE, 0xFE, // BIN 594: 6 pairs
+  0x05, 0x0D, 0x1E, 0x4C, 0x63, 0x7F, 0xB9, 0xBE, 0xD9, 0xCC, 0xEA, // BIN 595: 5 pairs
+  0x05, 0x14, 0x1F, 0x3A, 0x3C, 0x41, 0x4A, 0xAF, 0xCF, 0xC3, 0xE3, // BIN 596: 5 pairs
+  0x06, 0x17, 0x22, 0x2A, 0x35, 0x38, 0x4D, 0x75, 0x9B, 0xAC, 0xC8, 0xDA, 0xEB, // BIN 597: 6 pairs
+  0x0E, 0x28, 0x36, 0x2E, 0x34, 0x30, 0x4E, 0x31, 0x4C, 0x36, 0x47, 0x3F, 0x51, 0x7A, 0xB9, 0xA1, 0xCA, 0xB3, 0xF0, 0xB9, 0xCF, 0xBA, 0xDF, 0xBD, 0xD5, 0xC1, 0xDC, 0xED, 0xFD, // BIN 598: 14 pairs
+  0x07, 0x05, 0x08, 0x09, 0xF6, 0x2B, 0x50, 0x48, 0x69, 0x5E, 0x93, 0x67, 0x6F, 0xA0, 0xCA, // BIN 599: 7 pairs
+  0x06, 0x33, 0x3D, 0x50, 0x65, 0xB3, 0xB8, 0xB4, 0xBD, 0xBB, 0xDF, 0xC4, 0xCE, // BIN 600: 6 pairs
+  0x06, 0x00, 0x01, 0x33, 0x39, 0x54, 0x6E, 0x73, 0x87, 0x75, 0xB9, 0x9C, 0xC0, // BIN 601: 6 pairs
+  0x05, 0x16, 0xFF, 0x70, 0xA5, 0x79, 0x8E, 0xB7, 0xD8, 0xBF, 0xC1, // BIN 602: 5 pairs
+  0x06, 0x09, 0xFC, 0x28, 0x46, 0x33, 0x4B, 0x51, 0x53, 0x94, 0xB2, 0xAF, 0xCC, // BIN 603: 6 pairs
+  0x09, 0x1B, 0x48, 0x21, 0x57, 0x50, 0x58, 0x76, 0x8E, 0x78, 0xA1, 0xA8, 0xB8, 0xAC, 0xCA, 0xDC, 0xE2, 0xE9, 0xFA, // BIN 604: 9 pairs
+  0x0A, 0x01, 0x13, 0x03, 0x5E, 0x28, 0x3E, 0x2A, 0x4A, 0x32, 0x3F, 0x48, 0x55, 0x59, 0x84, 0x66, 0xA4, 0x7A, 0xA1, 0x84, 0xBD, // BIN 605: 10 pairs
+  0x0A, 0x15, 0x1D, 0x21, 0x4F, 0x2D, 0x4E, 0x33, 0x49, 0x51, 0x55, 0x76, 0x91, 0xB4, 0xDA, 0xC6, 0xEB, 0xC9, 0xEB, 0xDB, 0xE2, // BIN 606: 10 pairs
+  0x10, 0x05, 0x0B, 0x11, 0x19, 0x2D, 0x45, 0x43, 0x63, 0x48, 0x68, 0x4A, 0x51, 0x51, 0x62, 0x69, 0x99, 0x69, 0x9A, 0x92, 0xB9, 0x98, 0xC5, 0xAC, 0xBA, 0xC1, 0xD9, 0xD1, 0xF0, 0xD7, 0xEA, 0xE3, 0xE7, // BIN 607: 16 pairs
+  0x0E, 0x19, 0x3C, 0x59, 0x78, 0x5C, 0x7B, 0x65, 0x76, 0x6E, 0x8B, 0x84, 0xA0, 0x85, 0xA6, 0x8D, 0x91, 0x90, 0xBE, 0x97, 0xB5, 0xC2, 0xE3, 0xC5, 0xEB, 0xCF, 0xEA, 0xDE, 0xED, // BIN 608: 14 pairs
+  0x07, 0x16, 0x1C, 0x2E, 0x52, 0x37, 0x51, 0x7D, 0xA1, 0x98, 0xC6, 0xA1, 0xB9, 0xCF, 0xD2, // BIN 609: 7 pairs
+  0x07, 0x09, 0x20, 0x4F, 0x69, 0x50, 0x5A, 0xB1, 0xBA, 0xB3, 0xD9, 0xC4, 0xC5, 0xDD, 0xEA, // BIN 610: 7 pairs
+  0x07, 0x38, 0x4E, 0x66, 0x8F, 0x69, 0xA4, 0x8A, 0x8F, 0x93, 0xC9, 0x95, 0xB2, 0xE8, 0xF4, // BIN 611: 7 pairs
+  0x06, 0x20, 0x39, 0x3B, 0x5C, 0x46, 0x5A, 0x61, 0x82, 0x90, 0xA9, 0xA6, 0xB9, // BIN 612: 6 pairs
+  0x09, 0x0A, 0x1A, 0x18, 0x2E, 0x22, 0x2B, 0x2C, 0x3E, 0x3F, 0x4E, 0x73, 0x83, 0x90, 0x96, 0x9A, 0xBB, 0xE5, 0xE9, // BIN 613: 9 pairs
+  0x0A, 0x05, 0x17, 0x2E, 0x37, 0x2F, 0x32, 0x33, 0x40, 0x34, 0x3E, 0x7C, 0x89, 0x99, 0xBB, 0xAB, 0xBF, 0xB1, 0xD6, 0xB8, 0xCE, // BIN 614: 10 pairs
+  0x08, 0x41, 0x68, 0x5F, 0x82, 0x68, 0xB9, 0x75, 0x8B, 0x78, 0x8A, 0x8B, 0x9C, 0x95, 0xAF, 0x9B, 0xCC, // BIN 615: 8 pairs
+  0x07, 0x03, 0x09, 0x03, 0x21, 0x30, 0x44, 0x7B, 0xB3, 0x7D, 0x95, 0xB4, 0xC5, 0xE5, 0xF1, // BIN 616: 7 pairs
+  0x0C, 0x11, 0x1A, 0x17, 0x2E, 0x1F, 0x36, 0x2A, 0x46, 0x34, 0x4A, 0x6D, 0x92, 0x7C, 0x95, 0x7D, 0xA7, 0x84, 0xA7, 0xA0, 0xCD, 0xA1, 0xCD, 0xB9, 0xCD, // BIN 617: 12 pairs
+  0x0D, 0x0B, 0x1E, 0x18, 0x22, 0x27, 0x50, 0x28, 0x42, 0x35, 0x38, 0x59, 0x7F, 0x6E, 0x92, 0x77, 0x97, 0x81, 0xBD, 0x90, 0x91, 0xB6, 0xDB, 0xB7, 0xD5, 0xC5, 0xDD, // BIN 618: 13 pairs
+  0x07, 0x36, 0x56, 0x3F, 0x54, 0x83, 0x96, 0x86, 0xBE, 0xA2, 0xBF, 0xB9, 0xBB, 0xDF, 0xE7, // BIN 619: 7 pairs
+  0x08, 0x22, 0x44, 0x2C, 0x2E, 0x34, 0x44, 0x52, 0x64, 0x5D, 0x78, 0x71, 0xA8, 0x81, 0x98, 0xCE, 0xE5, // BIN 620: 8 pairs
+  0x08, 0x0A, 0xFA, 0x54, 0x5E, 0x72, 0x76, 0x8A, 0xA6, 0x98, 0xC9, 0xCB, 0xE3, 0xF1, 0xFE, 0xF2, 0xFB, // BIN 621: 8 pairs
+  0x0B, 0x1C, 0x3C, 0x32, 0x51, 0x37, 0x44, 0xA2, 0xC4, 0xA7, 0xC4, 0xB2, 0xBD, 0xB7, 0xD0, 0xCF, 0xEB, 0xDF, 0xE2, 0xF3, 0xF6, 0xFB, 0xFE, // BIN 622: 11 pairs
+  0x07, 0x01, 0x12, 0x54, 0x6C, 0x55, 0x59, 0x82, 0xAA, 0xAE, 0xD2, 0xC7, 0xEF, 0xF9, 0xFB, // BIN 623: 7 pairs
+  0x02, 0x0F, 0xF9, 0x18, 0x3B, // BIN 624: 2 pairs
+  0x08, 0x33, 0x4E, 0x62, 0x6A, 0x6F, 0x83, 0xA3, 0xA6, 0xA3, 0xBC, 0xAD, 0xD4, 0xBD, 0xC4, 0xDE, 0xE9, // BIN 625: 8 pairs
+  0x05, 0x21, 0x3E, 0x80, 0x98, 0x95, 0xA3, 0xA4, 0xCC, 0xF8, 0xFC, // BIN 626: 5 pairs
+  0x08, 0x03, 0x68, 0x19, 0x2E, 0x1B, 0xF8, 0x3F, 0x46, 0x84, 0xA1, 0xA0, 0xCF, 0xC4, 0xC6, 0xDB, 0xE7, // BIN 627: 8 pairs
+  0x09, 0x1F, 0x22, 0x20, 0x36, 0x34, 0x51, 0x6E, 0x79, 0x7A, 0xA7, 0x88, 0xA8, 0x8A, 0xA3, 0x9B, 0x9F, 0xD5, 0xE8, // BIN 628: 9 pairs
+  0x0C, 0x13, 0xF7, 0x22, 0x46, 0x2B, 0x58, 0x47, 0x75, 0x68, 0xAC, 0xA1, 0xCF, 0xAD, 0xD5, 0xC7, 0xE9, 0xD6, 0xD7, 0xE9, 0xF0, 0xF1, 0xFC, 0xF7, 0xFD, // BIN 629: 12 pairs
+  0x09, 0x05, 0x18, 0x38, 0x51, 0x39, 0x55, 0x57, 0x7F, 0x8C, 0x9D, 0xA9, 0xCB, 0xC6, 0xDD, 0xD5, 0xEB, 0xE0, 0xE6, // BIN 630: 9 pairs
+  0x05, 0x53, 0x59, 0x96, 0xB5, 0xAC, 0xD0, 0xB4, 0xC6, 0xBC, 0xDE, // BIN 631: 5 pairs
+  0x09, 0x22, 0x38, 0x66, 0x99, 0x66, 0x9A, 0x8F, 0xC6, 0xAA, 0xD4, 0xC7, 0xEC, 0xCC, 0xEB, 0xDA, 0xE2, 0xF5, 0xFD, // BIN 632: 9 pairs
+  0x07, 0x27, 0x42, 0x81, 0xA0, 0x85, 0xAA, 0x95, 0xAC, 0xA2, 0xC0, 0xB0, 0xD6, 0xE0, 0xEB, // BIN 633: 7 pairs
+  0x06, 0x03, 0x47, 0x41, 0x69, 0x48, 0x6C, 0x60, 0x74, 0x7F, 0xA6, 0xB0, 0xBA, // BIN 634: 6 pairs
+  0x0A, 0x03, 0xA4, 0x13, 0xA8, 0x32, 0x45, 0x4D, 0x57, 0x84, 0x8B, 0x99, 0xCC, 0x9A, 0xCC, 0xAD, 0xBD, 0xD8, 0xE2, 0xF5, 0xFA, // BIN 635: 10 pairs
+  0x07, 0x26, 0x4D, 0x60, 0x71, 0x6C, 0x92, 0x7C, 0x82, 0x95, 0xB4, 0xD6, 0xE8, 0xF5, 0xFC, // BIN 636: 7 pairs
+  0x0A, 0x2C, 0x36, 0x2D, 0x3C, 0x8F, 0xC5, 0x94, 0xB4, 0xA9, 0xB0, 0xAF, 0xBC, 0xC7, 0xF0, 0xCD, 0xEA, 0xCE, 0xD8, 0xCE, 0xE6, // BIN 637: 10 pairs
+  0x04, 0x24, 0x46, 0x26, 0x4C, 0x27, 0x32, 0x30, 0x3E, // BIN 638: 4 pairs
+  0x04, 0x11, 0x16, 0x98, 0xB9, 0xB6, 0xDD, 0xB7, 0xCD, // BIN 639: 4 pairs
+  0x09, 0x03, 0xF9, 0x1D, 0x32, 0x2C, 0x4A, 0x49, 0x59, 0x74, 0x88, 0x78, 0xAC, 0xA3, 0xAA, 0xBB, 0xD2, 0xC5, 0xDA, // BIN 640: 9 pairs
+  0x0B, 0x01, 0xE1, 0x25, 0x50, 0x28, 0x3D, 0x2A, 0x42, 0x2A, 0x49, 0x50, 0x5B, 0x5E, 0x82, 0x81, 0xA7, 0x97, 0xC3, 0xAA, 0xD3, 0xC2, 0xD6, // BIN 641: 11 pairs
+  0x09, 0x36, 0x37, 0x57, 0x85, 0x59, 0x85, 0xB0, 0xC2, 0xB2, 0xC5, 0xB5, 0xB7, 0xB5, 0xD9, 0xD9, 0xE5, 0xE8, 0xF2, // BIN 642: 9 pairs
+  0x08, 0x10, 0x25, 0x26, 0x3A, 0x41, 0x53, 0x55, 0x5A, 0x56, 0x75, 0x6D, 0xAC, 0x92, 0xAD, 0xE6, 0xE9, // BIN 643: 8 pairs
+  0x0B, 0x28, 0x39, 0x3E, 0x47, 0x4A, 0x5D, 0x6F, 0x74, 0xAE, 0xD5, 0xAF, 0xD5, 0xB9, 0xC8, 0xC5, 0xD8, 0xCB, 0xE5, 0xEB, 0xFC, 0xF1, 0xF4, // BIN 644: 11 pairs
+  0x0B, 0x14, 0x26, 0x1B, 0x5F, 0x30, 0x4A, 0x30, 0x51, 0x37, 0x4B, 0x5D, 0x7A, 0x8F, 0xA2, 0xA8, 0xA9, 0xAD, 0xD7, 0xD0, 0xEB, 0xDF, 0xEA, // BIN 645: 11 pairs
+  0x06, 0x4F, 0x6C, 0x85, 0xBD, 0x96, 0xA3, 0x9B, 0xC8, 0xA5, 0xEF, 0xB2, 0xDA, // BIN 646: 6 pairs
+  0x08, 0x2C, 0x4E, 0x57, 0x78, 0x6B, 0x8C, 0x95, 0xB6, 0x9B, 0xAF, 0x9F, 0xBA, 0xDE, 0xE4, 0xEE, 0xEF, // BIN 647: 8 pairs
+  0x07, 0x01, 0xFA, 0x0F, 0x47, 0x55, 0x5B, 0x83, 0x94, 0x84, 0xC6, 0x8E, 0x9D, 0xD0, 0xEA, // BIN 648: 7 pairs
+  0x07, 0x14, 0x36, 0x29, 0x43, 0x31, 0x53, 0x4B, 0x51, 0x5E, 0x99, 0x5E, 0x9A, 0x79, 0x92, // BIN 649: 7 pairs
+  0x06, 0x0E, 0x1E, 0x1D, 0x3D, 0x7E, 0x82, 0x80, 0x8F, 0xB9, 0xCA, 0xCD, 0xEB, // BIN 650: 6 pairs
+  0x06, 0x09, 0x1B, 0x2A, 0x4B, 0x5C, 0x6A, 0xB1, 0xC2, 0xB4, 0xDB, 0xF6, 0xFB, // BIN 651: 6 pairs
+  0x07, 0x00, 0x08, 0x17, 0x3B, 0x38, 0x53, 0x78, 0xA7, 0x9D, 0xA8, 0xAE, 0xC9, 0xB3, 0xEF, // BIN 652: 7 pairs
+  0x09, 0x15, 0x28, 0x2F, 0x53, 0x4A, 0x4E, 0x76, 0x7E, 0x81, 0xA1, 0x95, 0xBB, 0x9C, 0xCC, 0xE2, 0xF1, 0xE8, 0xEB, // BIN 653: 9 pairs
+  0x09, 0x01, 0x1A, 0x02, 0x12, 0x23, 0x44, 0x48, 0x6D, 0x62, 0x65, 0xAA, 0xBF, 0xAB, 0xAD, 0xAC, 0xEA, 0xC6, 0xDA, // BIN 654: 9 pairs
+  0x0A, 0x37, 0x49, 0x46, 0x5B, 0x76, 0x7C, 0x8D, 0x96, 0x8E, 0xA2, 0x92, 0xC6, 0x93, 0xC0, 0xAD, 0xD2, 0xAE, 0xD4, 0xD7, 0xE8, // BIN 655: 10 pairs
+  0x07, 0x06, 0x13, 0x0C, 0xF6, 0x0D, 0x2B, 0x21, 0x4C, 0x29, 0x4D, 0x6B, 0x76, 0xA3, 0xBA, // BIN 656: 7 pairs
+  0x0C, 0x1B, 0x6D, 0x33, 0x51, 0x34, 0x36, 0x38, 0x3D, 0x78, 0x94, 0x80, 0x9F, 0x92, 0xC5, 0x9C, 0xBB, 0xB2, 0xC6, 0xC3, 0xCE, 0xE0, 0xE5, 0xF3, 0xF9, // BIN 657: 12 pairs
+  0x06, 0x0D, 0x25, 0x60, 0x77, 0x9B, 0xCA, 0xA1, 0xD0, 0xB5, 0xC7, 0xEC, 0xFD, // BIN 658: 6 pairs
+  0x09, 0x04, 0xFB, 0x43, 0x5E, 0x81, 0x8B, 0x81, 0xC6, 0x9E, 0xEF, 0xA0, 0xD0, 0xA1, 0xA3, 0xC6, 0xD8, 0xD9, 0xEE, // BIN 659: 9 pairs
+  0x08, 0x01, 0xFD, 0x09, 0x21, 0x24, 0x50, 0x47, 0x49, 0x6D, 0xB9, 0xC0, 0xEA, 0xC7, 0xE3, 0xEE, 0xF5, // BIN 660: 8 pairs
+  0x09, 0x01, 0x18, 0x84, 0xC5, 0x8E, 0xAB, 0x94, 0xB6, 0x98, 0xCC, 0x9D, 0xC3, 0xB3, 0xE4, 0xB9, 0xD0, 0xC0, 0xE0, // BIN 661: 9 pairs
+  0x08, 0x1A, 0x22, 0x21, 0x5E, 0x26, 0x32, 0x3F, 0x48, 0x42, 0x5A, 0x64, 0x6A, 0x8A, 0xA7, 0xA9, 0xB1, // BIN 662: 8 pairs
+  0x0C, 0x03, 0xF6, 0x0A, 0x1E, 0x18, 0x3C, 0x21, 0x26, 0x28, 0x40, 0x3A, 0x52, 0x42, 0x45, 0x47, 0x4D, 0x95, 0xBA, 0xA2, 0xAB, 0xA4, 0xBB, 0xCE, 0xDC, // BIN 663: 12 pairs
+  0x09, 0x06, 0xFD, 0x12, 0x15, 0x1D, 0x2D, 0x6E, 0x6F, 0x78, 0x7C, 0x7F, 0xAA, 0x92, 0xBB, 0xB6, 0xDF, 0xCE, 0xE0, // BIN 664: 9 pairs
+  0x07, 0x3C, 0x58, 0x4D, 0x61, 0x75, 0x98, 0x92, 0x9F, 0xAB, 0xB2, 0xAF, 0xD8, 0xDA, 0xE7, // BIN 665: 7 pairs
+  0x06, 0x38, 0x40, 0x5E, 0x8F, 0xA2, 0xC8, 0xAD, 0xC5, 0xC5, 0xDF, 0xDD, 0xE7, // BIN 666: 6 pairs
+  0x04, 0x06, 0xFA, 0x2D, 0x51, 0x41, 0x6C, 0x4B, 0x59, // BIN 667: 4 pairs
+  0x07, 0x22, 0x3B, 0x58, 0x86, 0x9B, 0xCD, 0xAF, 0xD4, 0xB7, 0xCF, 0xBA, 0xE0, 0xDD, 0xE2, // BIN 668: 7 pairs
+  0x09, 0x1B, 0x81, 0x20, 0x68, 0x28, 0x4A, 0x6E, 0x80, 0x7D, 0xBD, 0xAD, 0xD8, 0xB9, 0xF8, 0xC5, 0xDB, 0xD2, 0xE6, // BIN 669: 9 pairs
+  0x0B, 0x34, 0x4B, 0x35, 0x51, 0x36, 0x55, 0x3B, 0x46, 0x54, 0x6D, 0x9F, 0xBF, 0xA9, 0xC7, 0xAA, 0xB7, 0xAE, 0xD7, 0xB7, 0xC0, 0xCB, 0xE6, // BIN 670: 11 pairs
+  0x0B, 0x03, 0x81, 0x13, 0x7B, 0x2C, 0x44, 0x4E, 0x53, 0x52, 0x58, 0x69, 0x92, 0xA3, 0xC4, 0xCC, 0xD2, 0xD2, 0xE5, 0xD3, 0xEB, 0xDE, 0xEE, // BIN 671: 11 pairs
+  0x07, 0x01, 0xEC, 0x10, 0x27, 0x1F, 0x32, 0x47, 0x81, 0x81, 0xC5, 0xC3, 0xDE, 0xD8, 0xEB, // BIN 672: 7 pairs
+  0x0B, 0x2F, 0x41, 0x3A, 0x50, 0x55, 0x61, 0x64, 0x8C, 0x84, 0x95, 0x8A, 0xAA, 0x93, 0x94, 0x97, 0xC7, 0x98, 0xC8, 0x9D, 0xC2, 0xA7, 0xD4, // BIN 673: 11 pairs
+  0x07, 0x1F, 0x39, 0x21, 0x56, 0x49, 0x57, 0x4F, 0x68, 0x7F, 0x80, 0xAA, 0xD7, 0xAE, 0xD8, // BIN 674: 7 pairs
+  0x07, 0x00, 0x0B, 0x1C, 0x3D, 0x7E, 0x9F, 0x99, 0xBA, 0x9A, 0xBA, 0x9B, 0xCF, 0xB4, 0xDD, // BIN 675: 7 pairs
+  0x07, 0x1E, 0x3D, 0x26, 0x41, 0x2F, 0x4F, 0x30, 0x36, 0x70, 0xA8, 0x95, 0xA4, 0xA2, 0xCA, // BIN 676: 7 pairs
+  0x07, 0x1C, 0x3B, 0x20, 0x4F, 0x23, 0x3F, 0x6E, 0x99, 0x6E, 0x9A, 0x6E, 0x9C, 0xD4, 0xD6, // BIN 677: 7 pairs
+  0x07, 0x2C, 0x39, 0x2F, 0x48, 0x37, 0x39, 0x45, 0x48, 0x89, 0x97, 0xAF, 0xD7, 0xC6, 0xDF, // BIN 678: 7 pairs
+  0x09, 0x14, 0x39, 0x22, 0x29, 0x28, 0x2E, 0x4F, 0x6E, 0x63, 0x93, 0x7D, 0xA6, 0xA0, 0xA3, 0xA1, 0xC4, 0xD9, 0xEF, // BIN 679: 9 pairs
+  0x0E, 0x02, 0x07, 0x0E, 0x19, 0x12, 0x25, 0x34, 0x49, 0x39, 0x57, 0x41, 0x6D, 0x43, 0x66, 0x73, 0x77, 0x7B, 0xBE, 0x80, 0xA2, 0x98, 0xA3, 0xAD, 0xC6, 0xBD, 0xDD, 0xBE, 0xF7, // BIN 680: 14 pairs
+  0x0C, 0x13, 0x70, 0x16, 0x3C, 0x17, 0x3C, 0x25, 0x42, 0x2A, 0x3D, 0x2B, 0x42, 0x38, 0x4C, 0x4E, 0x55, 0x6F, 0x76, 0x97, 0xA5, 0xBD, 0xEB, 0xD2, 0xE7, // BIN 681: 12 pairs
+  0x04, 0x0A, 0x1D, 0x1B, 0x59, 0xB7, 0xD7, 0xC6, 0xDB, // BIN 682: 4 pairs
+  0x09, 0x1B, 0x69, 0x20, 0x66, 0x23, 0x3C, 0x4F, 0x6D, 0x58, 0x9E, 0x7A, 0xA6, 0xBB, 0xE0, 0xC1, 0xE2, 0xD9, 0xE6, // BIN 683: 9 pairs
+  0x08, 0x10, 0x2B, 0x1D, 0x40, 0x2B, 0x52, 0x3C, 0x5C, 0x5F, 0x93, 0xA6, 0xD4, 0xB1, 0xBB, 0xDE, 0xE8, // BIN 684: 8 pairs
+  0x06, 0x53, 0x5A, 0x5D, 0x7F, 0x92, 0xC0, 0x98, 0xCA, 0xAC, 0xD4, 0xAF, 0xCE, // BIN 685: 6 pairs
+  0x08, 0x01, 0x17, 0x20, 0x59, 0x5D, 0x7D, 0x5E, 0xB9, 0xA6, 0xBF, 0xC1, 0xE3, 0xE7, 0xEE, 0xEB, 0xF3, // BIN 686: 8 pairs
+  0x05, 0x63, 0x8F, 0x89, 0x8A, 0xB3, 0xFF, 0xB5, 0xD1, 0xB8, 0xBE, // BIN 687: 5 pairs
+  0x0B, 0x14, 0x1B, 0x47, 0x6E, 0x54, 0x68, 0x84, 0xA6, 0x91, 0xA3, 0x93, 0xBB, 0xA0, 0xC4, 0xA4, 0xEA, 0xA6, 0xB7, 0xB7, 0xDA, 0xBF, 0xC9, // BIN 688: 11 pairs
+  0x0D, 0x08, 0x1E, 0x12, 0x24, 0x23, 0x27, 0x24, 0x30, 0x29, 0x4C, 0x41, 0x55, 0x4E, 0x62, 0x78, 0x7E, 0x87, 0x9F, 0x90, 0xC7, 0xB9, 0xD4, 0xCA, 0xEA, 0xDB, 0xEA, // BIN 689: 13 pairs
+  0x05, 0x2C, 0x51, 0x78, 0xA6, 0x9F, 0xBB, 0xB2, 0xDB, 0xE4, 0xE5, // BIN 690: 5 pairs
+  0x0A, 0x05, 0x16, 0x0A, 0xFE, 0x19, 0xFF, 0x2C, 0x4B, 0x2E, 0x33, 0x3F, 0x42, 0x52, 0x6B, 0x87, 0x94, 0x8D, 0x98, 0xCE, 0xE3, // BIN 691: 10 pairs
+  0x0B, 0x03, 0x84, 0x25, 0x32, 0x50, 0x6B, 0x94, 0x99, 0x94, 0x9A, 0xA6, 0xD3, 0xAB, 0xB4, 0xAF, 0xC9, 0xB7, 0xD4, 0xBD, 0xD8, 0xD5, 0xEA, // BIN 692: 11 pairs
+  0x04, 0x0E, 0x1A, 0x1B, 0x6C, 0x53, 0x61, 0xDA, 0xEA, // BIN 693: 4 pairs
+  0x0F, 0x13, 0x86, 0x1B, 0x84, 0x33, 0x4D, 0x34, 0x39, 0x3F, 0x41, 0x4D, 0x51, 0x5D, 0x6F, 0x68, 0x92, 0x79, 0x7F, 0xA4, 0xCF, 0xB5, 0xDC, 0xB9, 0xBA, 0xC8, 0xEA, 0xC9, 0xE0, 0xD3, 0xE8, // BIN 694: 15 pairs
+  0x06, 0x15, 0x17, 0x2C, 0x49, 0x53, 0x5B, 0x6C, 0xAC, 0xBD, 0xDA, 0xBE, 0xEC, // BIN 695: 6 pairs
+  0x08, 0x1C, 0x3A, 0x20, 0x5F, 0x21, 0x59, 0x25, 0x58, 0x26, 0x48, 0x44, 0x5A, 0x7F, 0x94, 0x95, 0xBD, // BIN 696: 8 pairs
+  0x06, 0x05, 0x0D, 0x27, 0x52, 0x47, 0x84, 0xA7, 0xD3, 0xBC, 0xC4, 0xE6, 0xF5, // BIN 697: 6 pairs
+  0x09, 0x03, 0x04, 0x2E, 0x4E, 0x30, 0x4B, 0x80, 0x9B, 0x87, 0x88, 0xAE, 0xBC, 0xB4, 0xDF, 0xD0, 0xD6, 0xDE, 0xE0, // BIN 698: 9 pairs
+  0x0B, 0x08, 0xE1, 0x12, 0x27, 0x2A, 0x40, 0x4B, 0x4E, 0x81, 0x95, 0x92, 0xBA, 0x96, 0xB8, 0xB7, 0xCC, 0xC0, 0xD2, 0xC3, 0xE1, 0xCE, 0xDA, // BIN 699: 11 pairs
+  0x0F, 0x10, 0x24, 0x1E, 0x23, 0x1F, 0x3F, 0x44, 0x5C, 0x5D, 0x62, 0x75, 0xA0, 0x7D, 0xAA, 0x7F, 0x8A, 0x80, 0x89, 0x83, 0x9F, 0x84, 0xAA, 0xCA, 0xEB, 0xD2, 0xE8, 0xD8, 0xE7, 0xDC, 0xE1, // BIN 700: 15 pairs
+  0x0D, 0x02, 0xF5, 0x3C, 0x4E, 0x44, 0x60, 0x67, 0x72, 0x76, 0x8D, 0x86, 0x9D, 0x88, 0xA9, 0x92, 0xAE, 0x92, 0xC9, 0xAE, 0xBD, 0xD1, 0xED, 0xD6, 0xE3, 0xE2, 0xF2, // BIN 701: 13 pairs
+  0x08, 0x1B, 0x63, 0x1C, 0x28, 0x27, 0x2D, 0x53, 0x57, 0x8B, 0xAD, 0x8F, 0xC9, 0xD4, 0xE8, 0xEF, 0xFA, // BIN 702: 8 pairs
+  0x06, 0x15, 0x2A, 0x1C, 0x30, 0x39, 0x59, 0x75, 0x95, 0x98, 0xCD, 0xB9, 0xEB, // BIN 703: 6 pairs
+  0x0A, 0x0F, 0xF6, 0x1A, 0x35, 0x33, 0x44, 0x45, 0x56, 0x79, 0x8F, 0x85, 0xC6, 0x99, 0xCF, 0x9A, 0xCF, 0xAA, 0xD5, 0xE9, 0xFD, // BIN 704: 10 pairs
+  0x07, 0x1E, 0x40, 0x32, 0x50, 0x38, 0x43, 0x3B, 0x64, 0x42, 0x5B, 0x77, 0xB3, 0x87, 0x9D, // BIN 705: 7 pairs
+  0x07, 0x0E, 0x16, 0x55, 0x57, 0x5B, 0x74, 0x5F, 0x8F, 0x76, 0x96, 0x80, 0xA1, 0xA3, 0xA7, // BIN 706: 7 pairs
+  0x0A, 0x0F, 0x41, 0x30, 0x49, 0x31, 0x4F, 0x3A, 0x4A, 0x7F, 0xBD, 0x82, 0xB9, 0x97, 0xBE, 0xA4, 0xCD, 0xC8, 0xEB, 0xCE, 0xD3, // BIN 707: 10 pairs
+  0x06, 0x32, 0x3B, 0x65, 0x70, 0x8B, 0xAC, 0xB0, 0xBB, 0xCE, 0xDB, 0xE9, 0xF2, // BIN 708: 6 pairs
+  0x08, 0x00, 0xF7, 0x1C, 0x2C, 0x20, 0x56, 0x28, 0x49, 0x7E, 0x92, 0x8C, 0xC7, 0x99, 0xCD, 0x9A, 0xCD, // BIN 709: 8 pairs
+  0x0C, 0x0D, 0x27, 0x11, 0x22, 0x27, 0x3A, 0x32, 0x52, 0x4B, 0x57, 0x4C, 0x66, 0x4D, 0x62, 0x4D, 0x63, 0x7A, 0x80, 0x7A, 0xAA, 0x99, 0xC8, 0x9A, 0xC8, // BIN 710: 12 pairs
+  0x08, 0x24, 0x34, 0x27, 0x46, 0x31, 0x46, 0x49, 0x51, 0x4D, 0x5F, 0x71, 0xB3, 0xB6, 0xE0, 0xCE, 0xD5, // BIN 711: 8 pairs
+  0x06, 0x03, 0x66, 0x15, 0x2D, 0x1C, 0x40, 0x3E, 0x59, 0x51, 0x65, 0x80, 0xA0, // BIN 712: 6 pairs
+  0x06, 0x03, 0xAC, 0x81, 0xA6, 0x85, 0x94, 0x85, 0xC5, 0xB4, 0xD6, 0xB6, 0xD6, // BIN 713: 6 pairs
+  0x0B, 0x30, 0x39, 0x3E, 0x5D, 0x47, 0x4B, 0x62, 0x74, 0x6F, 0x8A, 0x98, 0xCF, 0x9B, 0xD0, 0xA3, 0xB5, 0xA3, 0xBB, 0xC0, 0xEB, 0xE7, 0xED, // BIN 714: 11 pairs
+  0x0B, 0x06, 0x1E, 0x0B, 0x25, 0x13, 0x16, 0x13, 0x8C, 0x21, 0x2F, 0x5F, 0x9C, 0x6D, 0x9B, 0x9A, 0xA2, 0xA9, 0xB3, 0xB2, 0xDD, 0xD1, 0xF7, // BIN 715: 11 pairs
+  0x0D, 0x0A, 0x1C, 0x16, 0x2E, 0x1F, 0x3A, 0x28, 0x4B, 0x5C, 0x86, 0x5E, 0xAC, 0x8F, 0xC0, 0x95, 0xC0, 0x97, 0xAB, 0x99, 0xA2, 0xAC, 0xB6, 0xB4, 0xCE, 0xD3, 0xEA, // BIN 716: 13 pairs
+  0x07, 0x5B, 0x6F, 0x75, 0xA1, 0x8B, 0xA4, 0x94, 0xBA, 0xA2, 0xCC, 0xA2, 0xCD, 0xB0, 0xB8, // BIN 717: 7 pairs
+  0x08, 0x3E, 0x57, 0x59, 0x82, 0x6C, 0xB9, 0x70, 0x73, 0x79, 0x89, 0x92, 0xB2, 0x97, 0x9E, 0xCA, 0xD6, // BIN 718: 8 pairs
+  0x03, 0x79, 0x98, 0x9D, 0xBC, 0xA7, 0xD7, // BIN 719: 3 pairs
+  0x08, 0x0B, 0x2B, 0x55, 0x63, 0x63, 0x9C, 0x7D, 0xC6, 0x8F, 0xBB, 0x93, 0xCC, 0x99, 0xCA, 0x9A, 0xCA, // BIN 720: 8 pairs
+  0x06, 0x02, 0x10, 0x05, 0x19, 0x6C, 0x8B, 0xB1, 0xD3, 0xB2, 0xBC, 0xEE, 0xF1, // BIN 721: 6 pairs
+  0x09, 0x15, 0x2C, 0x4C, 0x5E, 0x52, 0x6A, 0x6B, 0x90, 0x79, 0x7A, 0x7C, 0x92, 0x9C, 0xCF, 0xDD, 0xF4, 0xE2, 0xED, // BIN 722: 9 pairs
+  0x0B, 0x24, 0x2C, 0x25, 0x52, 0x47, 0x7D, 0x4A, 0x59, 0x61, 0x93, 0x9C, 0xBA, 0xA4, 0xC8, 0xB2, 0xCE, 0xB7, 0xDB, 0xDF, 0xF4, 0xE3, 0xF2, // BIN 723: 11 pairs
+  0x07, 0x03, 0x9C, 0x27, 0x58, 0x31, 0x48, 0x41, 0x45, 0x66, 0xB9, 0x6D, 0x8B, 0xC2, 0xD2, // BIN 724: 7 pairs
+  0x09, 0x09, 0xF4, 0x2B, 0x32, 0x31, 0x41, 0x74, 0x7C, 0x81, 0xAA, 0x8B, 0x8E, 0x96, 0x9F, 0xE1, 0xED, 0xE4, 0xE6, // BIN 725: 9 pairs
+  0x0B, 0x1B, 0x61, 0x24, 0x52, 0x26, 0x4F, 0x38, 0x55, 0x61, 0x8F, 0x8A, 0xAD, 0xA8, 0xD9, 0xC2, 0xE4, 0xC3, 0xE9, 0xC8, 0xD6, 0xCE, 0xD9, // BIN 726: 11 pairs
+  0x0E, 0x19, 0x22, 0x1B, 0xB9, 0x69, 0xAC, 0x78, 0xAA, 0x80, 0x85, 0x83, 0x8B, 0x9F, 0xC4, 0xA3, 0xA9, 0xA6, 0xD7, 0xA8, 0xF0, 0xBD, 0xDB, 0xD5, 0xE2, 0xE5, 0xF5, 0xED, 0xFE, // BIN 727: 14 pairs
+  0x08, 0x1B, 0x43, 0x66, 0xAC, 0x82, 0xA2, 0x92, 0xB6, 0x94, 0xBB, 0xA9, 0xD1, 0xBC, 0xDC, 0xBD, 0xDF, // BIN 728: 8 pairs
+  0x03, 0x5D, 0x85, 0xAE, 0xC5, 0xB4, 0xBC, // BIN 729: 3 pairs
+  0x07, 0x07, 0x14, 0x49, 0x61, 0x54, 0x62, 0x75, 0xA7, 0x7A, 0xBD, 0x8E, 0x95, 0xB5, 0xD6, // BIN 730: 7 pairs
+  0x0E, 0x02, 0xFB, 0x1C, 0x34, 0x24, 0x37, 0x31, 0x55, 0x4E, 0x65, 0x5D, 0x82, 0x6E, 0x7C, 0x7D, 0xC5, 0x91, 0xB5, 0x93, 0xA2, 0x9C, 0xCD, 0xA4, 0xCA, 0xB1, 0xC8, 0xB7, 0xC2, // BIN 731: 14 pairs
+  0x06, 0x14, 0x41, 0x3F, 0x56, 0x5B, 0x73, 0x92, 0xB4, 0xB6, 0xCE, 0xE5, 0xEC, // BIN 732: 6 pairs
+  0x06, 0x06, 0x11, 0x12, 0x2B, 0x43, 0x69, 0x8D, 0x92, 0xC6, 0xF8, 0xD6, 0xDC, // BIN 733: 6 pairs
+  0x0C, 0x02, 0xF2, 0x1B, 0x75, 0x1F, 0x3E, 0x21, 0x49, 0x36, 0x57, 0xA4, 0xBA, 0xB1, 0xB8, 0xB1, 0xCA, 0xB2, 0xD6, 0xB8, 0xE3, 0xEC, 0xFF, 0xF3, 0xFE, // BIN 734: 12 pairs
+  0x07, 0x06, 0xE1, 0x21, 0x5F, 0x37, 0x4D, 0x6A, 0x6F, 0x6F, 0x87, 0xA7, 0xBF, 0xAB, 0xC3, // BIN 735: 7 pairs
+  0x05, 0x2F, 0x55, 0x44, 0x5B, 0x5D, 0x81, 0x90, 0xB8, 0xAB, 0xB6, // BIN 736: 5 pairs
+  0x0A, 0x0D, 0x1D, 0x13, 0x77, 0x15, 0x18, 0x4C, 0x69, 0x64, 0x73, 0x66, 0x92, 0x78, 0xB9, 0x8C, 0xA9, 0x97, 0xC2, 0xBC, 0xD9, // BIN 737: 10 pairs
+  0x09, 0x0A, 0xF7, 0x2A, 0x2E, 0x2A, 0x4E, 0x4E, 0x60, 0x5F, 0xA4, 0x7E, 0xA2, 0x85, 0x8A, 0xB2, 0xDF, 0xBE, 0xDC, // BIN 738: 9 pairs
+  0x0B, 0x23, 0x25, 0x29, 0x46, 0x2A, 0x4D, 0x46, 0x4A, 0x60, 0x7B, 0x71, 0xBE, 0x74, 0x7E, 0x8C, 0x91, 0x9C, 0xC8, 0xAC, 0xD7, 0xB4, 0xE0, // BIN 739: 11 pairs
+  0x0C, 0x03, 0xEB, 0x0D, 0xE1, 0x1B, 0xA4, 0x1E, 0x32, 0x48, 0x6E, 0x52, 0x67, 0x53, 0x63, 0x55, 0x5F, 0x9D, 0xC1, 0xA2, 0xD0, 0xE8, 0xFB, 0xED, 0xF0, // BIN 740: 12 pairs
+  0x0A, 0x17, 0x35, 0x22, 0x31, 0x23, 0x45, 0x7C, 0x9F, 0x8A, 0xAE, 0x8C, 0x96, 0x96, 0xB0, 0xA2, 0xBD, 0xA2, 0xCF, 0xAE, 0xCE, // BIN 741: 10 pairs
+  0x0A, 0x2B, 0x5C, 0x7E, 0x98, 0x8B, 0xAE, 0x8D, 0xA1, 0x91, 0x9F, 0xAD, 0xDA, 0xB9, 0xD7, 0xBE, 0xE9, 0xDC, 0xEF, 0xF4, 0xF5, // BIN 742: 10 pairs
+  0x07, 0x05, 0xF7, 0x0C, 0x47, 0x56, 0x7A, 0xAE, 0xC6, 0xC1, 0xE5, 0xCD, 0xD6, 0xE2, 0xEE, // BIN 743: 7 pairs
+  0x0B, 0x18, 0x35, 0x28, 0x4E, 0x33, 0x53, 0x5A, 0x74, 0x6C, 0x9B, 0x6F, 0x73, 0x99, 0xAD, 0x9A, 0xAD, 0xAF, 0xD6, 0xBC, 0xE2, 0xC5, 0xF8, // BIN 744: 11 pairs
+  0x06, 0x69, 0xB9, 0x6E, 0xA4, 0x98, 0xD0, 0x9D, 0xA3, 0xAB, 0xD2, 0xAF, 0xDA, // BIN 745: 6 pairs
+  0x09, 0x14, 0x2F, 0x1D, 0x3A, 0x58, 0xA5, 0x7A, 0x8A, 0x93, 0xBA, 0xAC, 0xAD, 0xB1, 0xD8, 0xCE, 0xE7, 0xD9, 0xE2, // BIN 746: 9 pairs
+  0x05, 0x0B, 0x1D, 0x21, 0x54, 0x38, 0x44, 0x5D, 0x84, 0x6A, 0x70, // BIN 747: 5 pairs
+  0x09, 0x4B, 0x62, 0x51, 0x67, 0x58, 0x8C, 0x64, 0x88, 0x7A, 0x94, 0x9C, 0xCA, 0xAC, 0xB4, 0xB8, 0xDE, 0xDE, 0xEC, // BIN 748: 9 pairs
+  0x0A, 0x03, 0x6D, 0x0B, 0x11, 0x12, 0x22, 0x1A, 0xFF, 0x26, 0x53, 0x29, 0x53, 0x51, 0x60, 0x87, 0xA3, 0xB0, 0xD3, 0xE0, 0xF3, // BIN 749: 10 pairs
+  0x05, 0x00, 0x17, 0x4B, 0x61, 0x76, 0x79, 0x8F, 0xAD, 0xAF, 0xBD, // BIN 750: 5 pairs
+  0x06, 0x20, 0x4C, 0x21, 0x66, 0x3A, 0x3B, 0x4D, 0x4E, 0x9D, 0xB0, 0xA2, 0xC9, // BIN 751: 6 pairs
+  0x0C, 0x08, 0xFA, 0x0B, 0xE1, 0x1E, 0x44, 0x57, 0x82, 0x63, 0x99, 0x63, 0x9A, 0x63, 0xA4, 0x69, 0x8B, 0xA3, 0xC1, 0xAE, 0xDA, 0xB5, 0xDE, 0xDC, 0xE7, // BIN 752: 12 pairs
+  0x0B, 0x15, 0x30, 0x1D, 0x44, 0x53, 0x5F, 0x79, 0x85, 0x97, 0xD1, 0xA7, 0xB7, 0xB3, 0xC2, 0xC4, 0xCB, 0xDB, 0xE6, 0xE0, 0xF1, 0xE4, 0xFA, // BIN 753: 11 pairs
+  0x08, 0x08, 0xFD, 0x1C, 0x1F, 0x20, 0x63, 0x4A, 0x62, 0x5F, 0x99, 0x5F, 0x9A, 0xA4, 0xD0, 0xAA, 0xB1, // BIN 754: 8 pairs
+  0x03, 0x31, 0x42, 0xA6, 0xD5, 0xD8, 0xEA, // BIN 755: 3 pairs
+  0x07, 0x14, 0x29, 0x25, 0x2D, 0x29, 0x35, 0x43, 0x68, 0x72, 0x97, 0x73, 0x91, 0x8D, 0xA0, // BIN 756: 7 pairs
+  0x0B, 0x00, 0xEE, 0x1C, 0x37, 0x47, 0x7A, 0x49, 0x4E, 0x5A, 0x6F, 0xA7, 0xD5, 0xA9, 0xCE, 0xB0, 0xC8, 0xB8, 0xE4, 0xBA, 0xD6, 0xEC, 0xF2, // BIN 757: 11 pairs
+  0x05, 0x45, 0x5A, 0x56, 0x7D, 0x99, 0xD0, 0x9A, 0xD0, 0xEA, 0xFC, // BIN 758: 5 pairs
+  0x09, 0x06, 0xEC, 0x36, 0x59, 0x3A, 0x3E, 0x6F, 0x78, 0x8B, 0xA3, 0x99, 0xB6, 0x9A, 0xB6, 0xA5, 0xC3, 0xB6, 0xBC, // BIN 759: 9 pairs
+  0x0D, 0x15, 0x1E, 0x21, 0x68, 0x25, 0x46, 0x2B, 0x46, 0x8A, 0x93, 0xB0, 0xCA, 0xB3, 0xDC, 0xC1, 0xC7, 0xC1, 0xD1, 0xCE, 0xDF, 0xCF, 0xD6, 0xDF, 0xE6, 0xE6, 0xEC, // BIN 760: 13 pairs
+  0x09, 0x07, 0xF9, 0x30, 0x3C, 0x34, 0x4D, 0x6E, 0x95, 0x6E, 0x9B, 0x6F, 0x8D, 0x92, 0xAF, 0xAC, 0xB2, 0xB7, 0xE0, // BIN 761: 9 pairs
+  0x09, 0x15, 0x29, 0x20, 0x61, 0x39, 0x5D, 0x88, 0xA5, 0x89, 0x9F, 0xA0, 0xD4, 0xA1, 0xB7, 0xB5, 0xD2, 0xE6, 0xF3, // BIN 762: 9 pairs
+  0x09, 0x28, 0x44, 0x3A, 0x4B, 0x40, 0x5A, 0x47, 0x4A, 0x84, 0xC9, 0xA1, 0xD4, 0xA6, 0xB1, 0xAF, 0xC1, 0xC2, 0xE2, // BIN 763: 9 pairs
+  0x0E, 0x00, 0x18, 0x03, 0x57, 0x0B, 0x27, 0x10, 0xFF, 0x13, 0xC7, 0x20, 0x3E, 0x25, 0x3A, 0x2F, 0x54, 0x56, 0x78, 0x64, 0x9E, 0x73, 0x7B, 0x74, 0x8E, 0x98, 0xC4, 0x9D, 0xB3, // BIN 764: 14 pairs
+  0x04, 0x06, 0x0E, 0x72, 0x9E, 0x94, 0xB0, 0xAD, 0xBC, // BIN 765: 4 pairs
+  0x0D, 0x0E, 0x22, 0x11, 0x24, 0x15, 0x32, 0x24, 0x28, 0x49, 0x5F, 0x4A, 0x57, 0x65, 0x77, 0x6A, 0x77, 0x7F, 0xC6, 0x82, 0xBD, 0x88, 0x9E, 0x8F, 0xBA, 0xB1, 0xD5, // BIN 766: 13 pairs
+  0x09, 0x0D, 0x3B, 0x1B, 0x56, 0x5A, 0x73, 0x61, 0x9C, 0x6A, 0x88, 0x79, 0x9F, 0x95, 0xC5, 0xBF, 0xE2, 0xE0, 0xEA, // BIN 767: 9 pairs
+  0x02, 0x74, 0x91, 0x94, 0xB1, // BIN 768: 2 pairs
+  0x09, 0x00, 0x0D, 0x04, 0x20, 0x2D, 0x4A, 0x31, 0x4E, 0x43, 0x6C, 0x47, 0x53, 0x96, 0xB1, 0xAA, 0xB0, 0xB5, 0xBF, // BIN 769: 9 pairs
+  0x0A, 0x13, 0x64, 0x2A, 0x51, 0x37, 0x53, 0x77, 0xBE, 0x90, 0xD1, 0x92, 0xCC, 0x95, 0xC6, 0xB1, 0xD0, 0xC2, 0xE5, 0xC7, 0xF7, // BIN 770: 10 pairs
+  0x08, 0x54, 0x75, 0x56, 0x81, 0x68, 0x9B, 0x7C, 0x98, 0xA1, 0xBF, 0xC1, 0xE6, 0xD3, 0xE2, 0xEF, 0xFD, // BIN 771: 8 pairs
+  0x04, 0x05, 0x1A, 0x2E, 0x38, 0x2F, 0x46, 0x5C, 0x73, // BIN 772: 4 pairs
+  0x08, 0x03, 0xC6, 0x1C, 0x2A, 0x49, 0x63, 0x4C, 0x6C, 0x58, 0xFF, 0x9B, 0xC4, 0xD9, 0xF0, 0xDF, 0xF3, // BIN 773: 8 pairs
+  0x0A, 0x29, 0x42, 0x2D, 0x3E, 0x48, 0x75, 0x55, 0x6F, 0x60, 0x76, 0x70, 0x97, 0x8D, 0xAE, 0x94, 0x9C, 0x9B, 0xA3, 0xB0, 0xD8, // BIN 774: 10 pairs
+  0x07, 0x00, 0xF2, 0x1B, 0x7D, 0x34, 0x3C, 0x75, 0xBD, 0x7F, 0xC5, 0x8A, 0xAF, 0xAF, 0xC5, // BIN 775: 7 pairs
+  0x07, 0x15, 0x34, 0x31, 0x51, 0x50, 0x6A, 0x81, 0xC9, 0x8D, 0xAB, 0xA6, 0xB0, 0xB2, 0xE0, // BIN 776: 7 pairs
+  0x07, 0x16, 0xF0, 0x21, 0x31, 0x33, 0x4C, 0x5C, 0x67, 0x82, 0x8D, 0xA1, 0xD3, 0xE3, 0xEF, // BIN 777: 7 pairs
+  0x0A, 0x10, 0xFD, 0x19, 0x35, 0x1E, 0x2D, 0x80, 0xA6, 0x86, 0xC7, 0x95, 0xC9, 0xAA, 0xD8, 0xB7, 0xDD, 0xDB, 0xE5, 0xE8, 0xFC, // BIN 778: 10 pairs
+  0x0A, 0x10, 0xF7, 0x13, 0xD1, 0x23, 0x4E, 0x31, 0x35, 0x6E, 0x7E, 0x94, 0xB7, 0x9D, 0xB1, 0xA0, 0xB7, 0xAC, 0xD3, 0xE0, 0xF4, // BIN 779: 10 pairs
+  0x09, 0x03, 0x41, 0x69, 0x9B, 0x74, 0x77, 0x8D, 0xA6, 0x9C, 0xD0, 0xA0, 0xD3, 0xD9, 0xF7, 0xDE, 0xF2, 0xED, 0xF5, // BIN 780: 9 pairs
+  0x06, 0x04, 0x1B, 0x29, 0x41, 0x90, 0xC3, 0xA2, 0xAC, 0xA3, 0xCE, 0xB7, 0xDF, // BIN 781: 6 pairs
+  0x0C, 0x0C, 0xFC, 0x20, 0x69, 0x2C, 0x4D, 0x76, 0x77, 0x79, 0x9B, 0x99, 0xB4, 0x9A, 0xB4, 0xA8, 0xFF, 0xAF, 0xCB, 0xC3, 0xEC, 0xD5, 0xE7, 0xDB, 0xF4, // BIN 782: 12 pairs
+  0x0B, 0x28, 0x51, 0x58, 0x65, 0x6F, 0x8B, 0x70, 0xB3, 0x88, 0xB3, 0x89, 0xA9, 0x8D, 0xAD, 0xC7, 0xED, 0xCB, 0xD1, 0xDA, 0xE6, 0xE8, 0xF6, // BIN 783: 11 pairs
+  0x0A, 0x08, 0x11, 0x20, 0x6D, 0x2E, 0x51, 0x3C, 0x51, 0x4C, 0x6E, 0x62, 0x73, 0x89, 0xA3, 0x9C, 0xEA, 0xA0, 0xBF, 0xA8, 0xC2, // BIN 784: 10 pairs
+  0x0B, 0x20, 0xF8, 0x64, 0x90, 0x6D, 0x98, 0x71, 0x97, 0x86, 0x91, 0x99, 0xB2, 0x9A, 0xB2, 0xA8, 0xB5, 0xB1, 0xCD, 0xD1, 0xFF, 0xE2, 0xE9, // BIN 785: 11 pairs
+  0x06, 0x08, 0x25, 0x2D, 0x3B, 0x31, 0x54, 0x7A, 0xC6, 0x8C, 0xD1, 0xCE, 0xDD, // BIN 786: 6 pairs
+  0x05, 0x0E, 0xFD, 0x21, 0x61, 0x45, 0x5B, 0x95, 0xB9, 0xAD, 0xDB, // BIN 787: 5 pairs
+  0x12, 0x0C, 0x41, 0x0F, 0x5E, 0x13, 0x19, 0x16, 0xF7, 0x1A, 0x3D, 0x22, 0x2F, 0x30, 0x4D, 0x37, 0x3C, 0x4A, 0x5A, 0x7E, 0x8F, 0x83, 0xA3, 0xAB, 0xC4, 0xAE, 0xD6, 0xAF, 0xDB, 0xBB, 0xEA, 0xC1, 0xC4, 0xDD, 0xF6, 0xDF, 0xE5, // BIN 788: 18 pairs
+  0x0E, 0x1B, 0x4F, 0x21, 0x63, 0x23, 0x2B, 0x2A, 0x43, 0x2B, 0x3A, 0x3A, 0x49, 0x56, 0x84, 0x7C, 0x8F, 0x89, 0x90, 0x8D, 0xAF, 0x93, 0xAD, 0x93, 0xCF, 0xA5, 0xF7, 0xAF, 0xC6, // BIN 789: 14 pairs
+  0x0A, 0x03, 0x75, 0x03, 0xC5, 0x08, 0xEC, 0x15, 0x24, 0x15, 0x33, 0x22, 0x26, 0x29, 0x48, 0x2D, 0x50, 0x3B, 0x60, 0x6E, 0x98, // BIN 790: 10 pairs
+  0x06, 0x08, 0x2B, 0x21, 0x29, 0x56, 0x7F, 0x75, 0xA6, 0x76, 0x80, 0xE4, 0xFF, // BIN 791: 6 pairs
+  0x08, 0x03, 0x7D, 0x1D, 0x30, 0x29, 0x4F, 0x2D, 0x52, 0x40, 0x45, 0x8B, 0xAF, 0x93, 0xC8, 0xC5, 0xE0, // BIN 792: 8 pairs
+  0x10, 0x01, 0xE9, 0x17, 0x23, 0x2B, 0x2D, 0x3C, 0x64, 0x46, 0x4B, 0x4B, 0x5F, 0x57, 0x93, 0x6E, 0x8A, 0x79, 0xA2, 0x7C, 0x7F, 0x8D, 0x9B, 0x8F, 0xCC, 0x93, 0xCD, 0xA2, 0xC5, 0xB3, 0xEC, 0xF1, 0xFA, // BIN 793: 16 pairs
+  0x08, 0x0F, 0x48, 0x21, 0x4D, 0x33, 0x43, 0x7D, 0x80, 0x8E, 0xA9, 0x91, 0xB8, 0xA9, 0xD9, 0xB0, 0xD5, // BIN 794: 8 pairs
+  0x0B, 0x0B, 0x0E, 0x43, 0x6D, 0x4B, 0x63, 0x7C, 0xA2, 0x9D, 0xC7, 0x9E, 0xF7, 0xAD, 0xCE, 0xAE, 0xDB, 0xC7, 0xCB, 0xD8, 0xE6, 0xE1, 0xE3, // BIN 795: 11 pairs
+  0x0C, 0x12, 0xFD, 0x2A, 0x44, 0x4E, 0x67, 0x4F, 0x75, 0x55, 0x6E, 0x7A, 0xC5, 0x86, 0x96, 0x8B, 0xB2, 0x8C, 0xE1, 0x9C, 0xA2, 0xBD, 0xF8, 0xC7, 0xFF, // BIN 796: 12 pairs
+  0x05, 0x34, 0x53, 0x5E, 0x92, 0x6F, 0x82, 0x72, 0xA5, 0xA8, 0xEF, // BIN 797: 5 pairs
+  0x0F, 0x03, 0x6C, 0x1C, 0x33, 0x1C, 0x44, 0x3D, 0x45, 0x61, 0x99, 0x61, 0x9A, 0x7B, 0x9D, 0x7D, 0x94, 0x83, 0x88, 0x88, 0x8E, 0x8F, 0x9F, 0xA3, 0xD2, 0xB0, 0xD0, 0xBF, 0xC5, 0xE2, 0xF3, // BIN 798: 15 pairs
+  0x0B, 0x03, 0x69, 0x04, 0xEB, 0x3D, 0x5A, 0x41, 0x6E, 0x41, 0x75, 0x44, 0x58, 0x47, 0x55, 0x61, 0xA4, 0x63, 0x92, 0x6A, 0x89, 0x8E, 0xB0, // BIN 799: 11 pairs
+  0x07, 0x0F, 0xEA, 0x32, 0x4A, 0x3E, 0x51, 0x73, 0x86, 0x85, 0xC9, 0xB3, 0xB5, 0xDD, 0xF3, // BIN 800: 7 pairs
+  0x09, 0x0B, 0xFD, 0x14, 0x31, 0x15, 0x26, 0x15, 0x37, 0x21, 0x4B, 0x2A, 0x4C, 0x83, 0x95, 0xD1, 0xDE, 0xE5, 0xF3, // BIN 801: 9 pairs
+  0x0D, 0x01, 0x1E, 0x04, 0xEA, 0x0C, 0xEA, 0x1D, 0x42, 0x24, 0x33, 0x79, 0xA1, 0x80, 0x93, 0x93, 0xCA, 0xA4, 0xD4, 0xC9, 0xF8, 0xCB, 0xD8, 0xCE, 0xD7, 0xDF, 0xF6, // BIN 802: 13 pairs
+  0x09, 0x00, 0x16, 0x20, 0x6C, 0x40, 0x5C, 0x8A, 0x99, 0x8A, 0x9A, 0x92, 0xC8, 0xA2, 0xC6, 0xB9, 0xD3, 0xD7, 0xE2, // BIN 803: 9 pairs
+  0x0A, 0x14, 0x47, 0x38, 0x4F, 0x5C, 0x8C, 0x65, 0x71, 0x80, 0xA7, 0xA2, 0xD3, 0xA9, 0xB7, 0xD0, 0xE8, 0xDB, 0xDE, 0xE2, 0xF5, // BIN 804: 10 pairs
+  0x09, 0x03, 0x14, 0x03, 0xBD, 0x0D, 0x11, 0x28, 0x4D, 0x72, 0xA8, 0x79, 0xA0, 0x89, 0xAB, 0xAB, 0xD6, 0xC6, 0xE0, // BIN 805: 9 pairs
+  0x12, 0x03, 0x99, 0x0B, 0xFA, 0x14, 0x43, 0x40, 0x5B, 0x45, 0x5D, 0x45, 0x62, 0x47, 0x85, 0x4C, 0x68, 0x57, 0x9C, 0x95, 0xC8, 0x96, 0xBC, 0xA4, 0xF8, 0xA5, 0xE4, 0xB1, 0xC0, 0xBD, 0xBF, 0xC2, 0xE6, 0xD8, 0xDE, 0xF1, 0xFD, // BIN 806: 18 pairs
+  0x10, 0x03, 0x5F, 0x03, 0x9A, 0x10, 0x15, 0x1B, 0x9C, 0x1F, 0x45, 0x4A, 0x61, 0x64, 0x67, 0x67, 0x83, 0x6C, 0x98, 0x73, 0x8E, 0x95, 0xCC, 0x9F, 0xBC, 0xA0, 0xD7, 0xA1, 0xD7, 0xDA, 0xE5, 0xEE, 0xF0, // BIN 807: 16 pairs
+  0x09, 0x1D, 0x2C, 0x20, 0x54, 0x25, 0x5C, 0x2C, 0x3C, 0x3C, 0x60, 0x49, 0x62, 0x74, 0x79, 0xB3, 0xF7, 0xDD, 0xE6, // BIN 808: 9 pairs
+  0x09, 0x2A, 0x53, 0x3F, 0x40, 0x4A, 0x5B, 0x5B, 0x6B, 0x9F, 0xC0, 0xA8, 0xE4, 0xAD, 0xDD, 0xBC, 0xE3, 0xC9, 0xD2, // BIN 809: 9 pairs
+  0x0B, 0x07, 0x0C, 0x1C, 0x42, 0x39, 0x5F, 0x39, 0x61, 0x3D, 0x3F, 0x47, 0x7F, 0x50, 0x67, 0x59, 0x93, 0x71, 0xFF, 0x87, 0x8B, 0x9B, 0xD4, // BIN 810: 11 pairs
+  0x06, 0x2D, 0x36, 0x40, 0x60, 0x4B, 0x5A, 0x79, 0x7D, 0x7E, 0x7F, 0xBF, 0xC2, // BIN 811: 6 pairs
+  0x04, 0x1A, 0x40, 0x35, 0x3F, 0x4C, 0x6D, 0xB0, 0xCD, // BIN 812: 4 pairs
+  0x0A, 0x07, 0x15, 0x0E, 0xFE, 0x3E, 0x61, 0x42, 0x60, 0x75, 0xAA, 0x7E, 0x91, 0x8F, 0xAE, 0x9A, 0xAE, 0xA3, 0xCB, 0xBB, 0xD6, // BIN 813: 10 pairs
+  0x0B, 0x08, 0x1D, 0x42, 0x4A, 0x57, 0xA4, 0x6A, 0x83, 0x89, 0x94, 0x94, 0xAB, 0x99, 0xAE, 0x9C, 0xAD, 0xAC, 0xEB, 0xB1, 0xCF, 0xDA, 0xF4, // BIN 814: 11 pairs
+  0x05, 0x8F, 0xB6, 0x92, 0xCA, 0x94, 0xAC, 0xBF, 0xC6, 0xD8, 0xE5, // BIN 815: 5 pairs
+  0x0B, 0x0A, 0x15, 0x14, 0x48, 0x18, 0x23, 0x33, 0x55, 0x75, 0x79, 0x75, 0x80, 0x9C, 0xB6, 0xAC, 0xAE, 0xAC, 0xD5, 0xBA, 0xCE, 0xDF, 0xF1, // BIN 816: 11 pairs
+  0x0E, 0x23, 0x3B, 0x2F, 0x42, 0x46, 0x53, 0x4D, 0x5A, 0x7D, 0x8A, 0x7E, 0xA1, 0x8B, 0xBD, 0x8F, 0xB2, 0x91, 0xB0, 0x94, 0xC0, 0xB6, 0xB9, 0xBE, 0xC2, 0xCB, 0xE0, 0xDC, 0xF7, // BIN 817: 14 pairs
+  0x08, 0x01, 0xE4, 0x05, 0x1E, 0x1D, 0x28, 0x27, 0x5C, 0x64, 0xA5, 0x6D, 0xA0, 0x95, 0xCA, 0xB7, 0xC9, // BIN 818: 8 pairs
+  0x06, 0x1D, 0x34, 0x36, 0x5D, 0x4C, 0x62, 0x73, 0x7C, 0xE3, 0xF7, 0xED, 0xF1, // BIN 819: 6 pairs
+  0x0C, 0x11, 0x25, 0x16, 0x22, 0x20, 0x26, 0x56, 0x85, 0x5A, 0x6B, 0x70, 0x74, 0x86, 0xA9, 0x93, 0xB6, 0xA5, 0xD9, 0xAC, 0xC4, 0xBF, 0xDE, 0xCB, 0xE7, // BIN 820: 12 pairs
+  0x08, 0x6D, 0x95, 0x77, 0x9D, 0x8B, 0xB4, 0x8E, 0x97, 0x8E, 0xB1, 0xA3, 0xC8, 0xAC, 0xF8, 0xC4, 0xE2, // BIN 821: 8 pairs
+  0x07, 0x75, 0xC6, 0x7E, 0x9B, 0x9E, 0xC3, 0x9F, 0xC8, 0xDA, 0xDE, 0xDB, 0xF3, 0xDE, 0xF1, // BIN 822: 7 pairs
+  0x0A, 0x07, 0xFE, 0x08, 0x0E, 0x09, 0xFB, 0x1B, 0xEA, 0x2B, 0x64, 0x2F, 0x4E, 0x83, 0x9D, 0xAF, 0xDD, 0xBC, 0xD8, 0xE7, 0xE9, // BIN 823: 10 pairs
+  0x0A, 0x05, 0x1D, 0x2D, 0x4B, 0x44, 0x65, 0x5F, 0x92, 0x70, 0xBE, 0x7A, 0x7C, 0x7E, 0xA0, 0xAE, 0xC1, 0xAE, 0xDD, 0xB3, 0xE9, // BIN 824: 10 pairs
+  0x12, 0x06, 0x1D, 0x11, 0x27, 0x1B, 0x39, 0x29, 0x4E, 0x30, 0x53, 0x3B, 0x4E, 0x46, 0x60, 0x59, 0x8F, 0x71, 0x73, 0x7E, 0xA3, 0x80, 0xA3, 0x87, 0x97, 0x8F, 0xB4, 0x92, 0xCD, 0x98, 0xB7, 0xAD, 0xD6, 0xB5, 0xE3, 0xCC, 0xD6, // BIN 825: 18 pairs
+  0x0A, 0x01, 0x11, 0x04, 0x21, 0x0C, 0xF4, 0x11, 0xFD, 0x2F, 0x51, 0x35, 0x45, 0x6A, 0x87, 0x72, 0x89, 0x7D, 0xC9, 0xAA, 0xDA, // BIN 826: 10 pairs
+  0x07, 0x01, 0xEE, 0x15, 0x35, 0x3D, 0x5C, 0x62, 0x79, 0x8A, 0xB2, 0x8D, 0xAA, 0xA1, 0xB1, // BIN 827: 7 pairs
+  0x0C, 0x0D, 0x24, 0x10, 0x22, 0x13, 0x90, 0x26, 0x54, 0x32, 0x3E, 0x4B, 0x5B, 0x73, 0x7E, 0x8B, 0xBB, 0xA3, 0xCA, 0xA6, 0xD8, 0xB9, 0xD5, 0xE1, 0xEE, // BIN 828: 12 pairs
+  0x07, 0x00, 0xF5, 0x2C, 0x53, 0x68, 0x8B, 0x86, 0xE1, 0x99, 0xD4, 0x9A, 0xD4, 0xBC, 0xE5, // BIN 829: 7 pairs
+  0x08, 0x01, 0xED, 0x03, 0x93, 0x13, 0x1A, 0x1A, 0x58, 0x44, 0x64, 0x4D, 0x5B, 0x64, 0x74, 0xDE, 0xDF, // BIN 830: 8 pairs
+  0x10, 0x0D, 0x58, 0x21, 0x4A, 0x24, 0x2A, 0x29, 0x3D, 0x29, 0x55, 0x37, 0x4C, 0x3E, 0x4E, 0x57, 0x8F, 0x6C, 0x95, 0x80, 0xAA, 0x8E, 0xAF, 0x92, 0xCF, 0x9F, 0xCA, 0xB0, 0xC0, 0xB1, 0xDA, 0xBB, 0xEB, // BIN 831: 16 pairs
+  0x0B, 0x10, 0xFA, 0x31, 0x3D, 0x36, 0x3A, 0x3E, 0x5F, 0x66, 0x9B, 0x78, 0xBD, 0x8B, 0xB6, 0x8C, 0xB8, 0xB1, 0xD7, 0xCE, 0xD0, 0xF0, 0xFA, // BIN 832: 11 pairs
+  0x07, 0x02, 0x06, 0x1B, 0xF9, 0x26, 0x55, 0x51, 0x6A, 0x8E, 0xAE, 0x92, 0xA3, 0xA5, 0xB8, // BIN 833: 7 pairs
+  0x0C, 0x5A, 0x5C, 0x75, 0xC5, 0x82, 0xC6, 0x85, 0xA2, 0x96, 0xA8, 0x99, 0xEA, 0x9A, 0xEA, 0xA9, 0xBE, 0xAD, 0xDF, 0xAF, 0xB5, 0xCA, 0xCE, 0xD1, 0xEE, // BIN 834: 12 pairs
+  0x06, 0x07, 0xF4, 0x10, 0x3B, 0x83, 0xA2, 0x96, 0xC2, 0xC2, 0xE9, 0xE3, 0xFA, // BIN 835: 6 pairs
+  0x0A, 0x08, 0x27, 0x1E, 0x3A, 0x44, 0x45, 0x61, 0x92, 0x62, 0x7C, 0x6D, 0xA1, 0xA7, 0xB1, 0xA7, 0xD8, 0xD6, 0xD9, 0xDD, 0xE5, // BIN 836: 10 pairs
+  0x0A, 0x0D, 0x9E, 0x12, 0x2E, 0x16, 0x58, 0x1E, 0x42, 0x2D, 0x49, 0x60, 0x86, 0x73, 0x90, 0x7F, 0xA2, 0xB8, 0xD6, 0xD7, 0xE7, // BIN 837: 10 pairs
+  0x0A, 0x14, 0x3E, 0x27, 0x30, 0x2F, 0x56, 0x37, 0x55, 0x6E, 0xAC, 0x74, 0x8D, 0x84, 0xC0, 0x8D, 0xA7, 0xA1, 0xB0, 0xCF, 0xE8, // BIN 838: 10 pairs
+  0x0C, 0x05, 0x1C, 0x06, 0x25, 0x2F, 0x35, 0x39, 0x63, 0x46, 0x49, 0x66, 0x8B, 0x93, 0xB2, 0x93, 0xB4, 0xA1, 0xD5, 0xC8, 0xCE, 0xD3, 0xE7, 0xE8, 0xEA, // BIN 839: 12 pairs
+  0x08, 0x15, 0x2E, 0x1A, 0x44, 0x78, 0xA2, 0x82, 0xC5, 0xA4, 0xB6, 0xAF, 0xDF, 0xB2, 0xC1, 0xD7, 0xF4, // BIN 840: 8 pairs
+  0x0B, 0x0B, 0x3B, 0x13, 0x5C, 0x29, 0x51, 0x3D, 0x5B, 0x4D, 0x66, 0x56, 0x62, 0x62, 0x76, 0x68, 0xBD, 0x9C, 0xD4, 0xB0, 0xCF, 0xCE, 0xD4, // BIN 841: 11 pairs
+  0x12, 0x07, 0xF3, 0x0E, 0x24, 0x1F, 0x21, 0x59, 0x9C, 0x5B, 0x5C, 0x69, 0x98, 0x82, 0x9F, 0x87, 0xAB, 0x93, 0xD0, 0x95, 0xCD, 0x9C, 0xB4, 0xA0, 0xD5, 0xA3, 0xC0, 0xAE, 0xCB, 0xB1, 0xCC, 0xB1, 0xD4, 0xB4, 0xCB, 0xF1, 0xF6, // BIN 842: 18 pairs
+  0x08, 0x00, 0x19, 0x23, 0x51, 0x31, 0x40, 0x53, 0x6E, 0x73, 0x8C, 0x8B, 0xBA, 0xB2, 0xCB, 0xB7, 0xB8, // BIN 843: 8 pairs
+  0x09, 0x19, 0x58, 0x1D, 0x37, 0x3D, 0x60, 0x43, 0x6E, 0x7C, 0x9B, 0x85, 0xC0, 0x9B, 0xD3, 0xB8, 0xE1, 0xE2, 0xE4, // BIN 844: 9 pairs
+  0x08, 0x46, 0x55, 0x67, 0x87, 0x77, 0x91, 0x8F, 0xC8, 0x91, 0xB1, 0x9D, 0xCB, 0xAE, 0xDF, 0xB4, 0xC1, // BIN 845: 8 pairs
+  0x10, 0x03, 0x48, 0x18, 0xFF, 0x1B, 0xAC, 0x21, 0x69, 0x29, 0x40, 0x37, 0x52, 0x61, 0x6F, 0x6C, 0xA0, 0x6D, 0xA7, 0x76, 0x90, 0x7A, 0x7E, 0x87, 0xA2, 0x90, 0xE1, 0xA0, 0xB1, 0xCD, 0xE8, 0xEB, 0xFB, // BIN 846: 16 pairs
+  0x02, 0x11, 0x23, 0x98, 0xBF, // BIN 847: 2 pairs
+  0x06, 0x1B, 0x7A, 0x1F, 0x35, 0x8D, 0x8F, 0x90, 0xB5, 0x9C, 0xB2, 0xBA, 0xEA, // BIN 848: 6 pairs
+  0x08, 0x1B, 0x36, 0x21, 0x3F, 0x3A, 0x4D, 0x7C, 0xA1, 0x8A, 0x91, 0x94, 0xBD, 0x98, 0xD4, 0xE9, 0xFF, // BIN 849: 8 pairs
+  0x0C, 0x06, 0x2B, 0x07, 0x0E, 0x22, 0x4E, 0x3E, 0x63, 0x4A, 0x5F, 0x63, 0x8B, 0x6C, 0x79, 0x7C, 0x85, 0x8D, 0xB0, 0xA7, 0xB0, 0xD4, 0xF4, 0xEC, 0xFE, // BIN 850: 12 pairs
+  0x13, 0x07, 0xF5, 0x09, 0xEA, 0x0F, 0x68, 0x2D, 0x39, 0x34, 0x52, 0x3A, 0x53, 0x3A, 0x5A, 0x4A, 0x63, 0x67, 0x89, 0x6A, 0x71, 0x6F, 0x89, 0x73, 0x96, 0x78, 0x8D, 0x9E, 0xE4, 0xA2, 0xD4, 0xBD, 0xE0, 0xC3, 0xD6, 0xC3, 0xED, 0xE4, 0xFD, // BIN 851: 19 pairs
+  0x07, 0x24, 0x4E, 0x4C, 0x51, 0x68, 0x98, 0x79, 0x93, 0x8C, 0xC3, 0x95, 0xB7, 0xDB, 0xF1, // BIN 852: 7 pairs
+  0x05, 0x23, 0x36, 0x30, 0x52, 0x6E, 0xA0, 0xB4, 0xB9, 0xDD, 0xF1, // BIN 853: 5 pairs
+  0x0B, 0x01, 0x0E, 0x10, 0x2E, 0x20, 0x49, 0x47, 0x78, 0x48, 0x81, 0x65, 0x88, 0x76, 0x9D, 0x86, 0xD1, 0x8B, 0xB9, 0xBC, 0xE6, 0xCB, 0xE4, // BIN 854: 11 pairs
+  0x0B, 0x34, 0x4C, 0x38, 0x54, 0x4D, 0x69, 0x57, 0x99, 0x57, 0x9A, 0x5D, 0x79, 0x65, 0x7B, 0x70, 0x76, 0x76, 0x7B, 0x7C, 0xA0, 0x81, 0xC0, // BIN 855: 11 pairs
+  0x08, 0x1B, 0x85, 0x32, 0x4B, 0x5C, 0x74, 0x7B, 0x91, 0x8F, 0xCA, 0x95, 0xCF, 0xA4, 0xD7, 0xC6, 0xF6, // BIN 856: 8 pairs
+  0x0F, 0x04, 0xF3, 0x0D, 0x0E, 0x0F, 0x57, 0x20, 0x81, 0x42, 0x5C, 0x60, 0x88, 0x65, 0x6F, 0x6A, 0x7B, 0x8D, 0x9D, 0x8F, 0xCD, 0x93, 0xAE, 0x96, 0xC3, 0xA0, 0xB0, 0xC7, 0xDE, 0xD4, 0xE2, // BIN 857: 15 pairs
+  0x08, 0x00, 0xED, 0x23, 0x3E, 0x26, 0x46, 0x38, 0x48, 0x53, 0x6F, 0x8F, 0xCF, 0xB0, 0xC3, 0xC3, 0xE5, // BIN 858: 8 pairs
+  0x0C, 0x03, 0x63, 0x05, 0x15, 0x27, 0x34, 0x28, 0x43, 0x5F, 0xB9, 0x7F, 0xC9, 0x96, 0xC1, 0x9B, 0xD7, 0xA4, 0xAD, 0xB0, 0xDA, 0xDC, 0xF0, 0xE7, 0xFB, // BIN 859: 12 pairs
+  0x0F, 0x02, 0x15, 0x03, 0x85, 0x07, 0xF6, 0x41, 0x81, 0x4D, 0x6E, 0x54, 0x78, 0x5F, 0xAC, 0x6D, 0xBD, 0x76, 0x97, 0x95, 0xC4, 0x97, 0xC1, 0xAA, 0xDD, 0xB0, 0xD7, 0xBC, 0xD3, 0xDB, 0xF6, // BIN 860: 15 pairs
+  0x0C, 0x03, 0xF4, 0x15, 0x31, 0x19, 0x3D, 0x3F, 0x5D, 0x50, 0x70, 0x54, 0x7A, 0x55, 0x69, 0x60, 0x62, 0x87, 0x95, 0x8E, 0xAD, 0xAF, 0xE0, 0xC4, 0xE8, // BIN 861: 12 pairs
+  0x10, 0x0A, 0xFF, 0x0B, 0xEC, 0x15, 0x3A, 0x16, 0xEF, 0x18, 0x3D, 0x3F, 0x5A, 0x54, 0x6F, 0x5C, 0x88, 0x67, 0x7C, 0x72, 0x91, 0x84, 0x94, 0x8A, 0xB4, 0x9D, 0x9F, 0xC5, 0xF6, 0xCB, 0xDA, 0xD4, 0xF6, // BIN 862: 16 pairs
+  0x08, 0x21, 0x6D, 0x22, 0x50, 0x37, 0x43, 0x39, 0x3A, 0x59, 0xA4, 0x6C, 0xA1, 0x74, 0x7B, 0xC0, 0xD6, // BIN 863: 8 pairs
+  0x0B, 0x00, 0xEF, 0x1A, 0x23, 0x46, 0x4D, 0x4F, 0x62, 0x69, 0x95, 0x76, 0x86, 0x7B, 0xC7, 0x80, 0x99, 0x80, 0x9A, 0xA4, 0xEB, 0xB6, 0xCB, // BIN 864: 11 pairs
+  0x0D, 0x12, 0xFA, 0x26, 0x47, 0x34, 0x55, 0x36, 0x5F, 0x37, 0x50, 0x50, 0x72, 0x7E, 0x85, 0x98, 0xD3, 0x9D, 0xD1, 0xB1, 0xDB, 0xCA, 0xE8, 0xE9, 0xFE, 0xF2, 0xFC, // BIN 865: 13 pairs
+  0x0D, 0x01, 0xBE, 0x22, 0x3F, 0x2C, 0x4C, 0x30, 0x50, 0x36, 0x61, 0x4D, 0x5E, 0x4E, 0x6A, 0x69, 0x79, 0x6E, 0xA1, 0x8D, 0xB1, 0xD7, 0xF6, 0xDA, 0xF3, 0xEB, 0xF1, // BIN 866: 13 pairs
+  0x08, 0x17, 0x3D, 0x34, 0x50, 0x39, 0x5E, 0x3E, 0x46, 0x3F, 0x44, 0x74, 0x96, 0x7C, 0x91, 0x94, 0xA4, // BIN 867: 8 pairs
+  0x0B, 0x00, 0xEC, 0x0B, 0x24, 0x13, 0x2B, 0x1C, 0x46, 0x2F, 0x47, 0x42, 0x4B, 0x63, 0x6F, 0x75, 0x8A, 0xB0, 0xCC, 0xBC, 0xC7, 0xEA, 0xF3, // BIN 868: 11 pairs
+  0x08, 0x0F, 0xFC, 0x15, 0x38, 0x16, 0x35, 0x28, 0x53, 0x33, 0x3C, 0x74, 0x80, 0xA2, 0xA4, 0xCB, 0xDB, // BIN 869: 8 pairs
+  0x10, 0x19, 0xF0, 0x1D, 0x46, 0x28, 0x4C, 0x31, 0x56, 0x52, 0x72, 0x5B, 0x76, 0x63, 0xAC, 0x7B, 0xE1, 0x92, 0xD0, 0xA4, 0xB4, 0xAA, 0xDB, 0xAD, 0xB9, 0xB0, 0xD4, 0xB9, 0xF6, 0xE7, 0xF4, 0xE8, 0xF9, // BIN 870: 16 pairs
+  0x0C, 0x15, 0x2F, 0x20, 0x2F, 0x68, 0xC6, 0x6C, 0x80, 0x6F, 0x8E, 0x85, 0xBB, 0xA2, 0xD5, 0xAB, 0xBA, 0xB1, 0xC3, 0xCD, 0xCE, 0xCE, 0xE8, 0xE4, 0xF2, // BIN 871: 12 pairs
+  0x0B, 0x0B, 0x1C, 0x10, 0xF0, 0x11, 0xFE, 0x21, 0x6C, 0x38, 0x41, 0x97, 0xBC, 0xB2, 0xB9, 0xB6, 0xC1, 0xB9, 0xDD, 0xC1, 0xD8, 0xCB, 0xD3, // BIN 872: 11 pairs
+  0x06, 0x03, 0x59, 0x0D, 0xA5, 0x76, 0x8A, 0x8F, 0xAF, 0xAC, 0xAF, 0xBE, 0xE3, // BIN 873: 6 pairs
+  0x06, 0x0D, 0x1C, 0x68, 0xA0, 0x99, 0xAF, 0x9A, 0xAF, 0xBA, 0xBC, 0xDD, 0xDE, // BIN 874: 6 pairs
+  0x09, 0x0F, 0x43, 0x5C, 0x9E, 0x5E, 0x9B, 0x61, 0x8B, 0x8E, 0x98, 0x91, 0xA8, 0x94, 0xC4, 0x95, 0xB1, 0xD2, 0xE3, // BIN 875: 9 pairs
+  0x0A, 0x08, 0x9E, 0x24, 0x58, 0x27, 0x2C, 0x32, 0x49, 0x55, 0x66, 0x56, 0x82, 0xAD, 0xE0, 0xAE, 0xE0, 0xBC, 0xD1, 0xCB, 0xD5, // BIN 876: 10 pairs
+  0x0B, 0x02, 0xEE, 0x0C, 0x48, 0x27, 0x37, 0x48, 0x84, 0x75, 0x94, 0x79, 0xA6, 0x98, 0xB1, 0x9F, 0xCD, 0xA2, 0xD7, 0xA8, 0xDC, 0xC8, 0xE8, // BIN 877: 11 pairs
+  0x0F, 0x0E, 0xFA, 0x1B, 0xF6, 0x1E, 0x50, 0x29, 0x54, 0x2C, 0x43, 0x49, 0x5A, 0x58, 0x90, 0x77, 0x96, 0x7B, 0x96, 0x8B, 0xC0, 0x8D, 0xB2, 0x95, 0xB0, 0xA6, 0xDA, 0xA7, 0xDA, 0xBA, 0xEB, // BIN 878: 15 pairs
+  0x0A, 0x01, 0x02, 0x03, 0x7A, 0x06, 0xE9, 0x28, 0x3C, 0x62, 0x6E, 0x6C, 0xA7, 0x8A, 0x9C, 0x9E, 0xD9, 0xA3, 0xCD, 0xFB, 0xFD, // BIN 879: 10 pairs
+  0x0B, 0x01, 0x9E, 0x05, 0xEE, 0x32, 0x36, 0x46, 0x65, 0x59, 0x99, 0x59, 0x9A, 0x63, 0xB9, 0x71, 0xE1, 0x94, 0xBF, 0x9B, 0xBF, 0xBC, 0xD5, // BIN 880: 11 pairs
+  0x0C, 0x0F, 0x39, 0x19, 0xF7, 0x30, 0x4C, 0x48, 0x7D, 0x7E, 0xA6, 0x94, 0xC8, 0x95, 0xD0, 0x9B, 0xB7, 0x9F, 0xA9, 0xA4, 0xB2, 0xB7, 0xE2, 0xF1, 0xF9, // BIN 881: 12 pairs
+  0x08, 0x0F, 0x36, 0x11, 0x2B, 0x14, 0x2A, 0x40, 0x58, 0x47, 0xA4, 0x69, 0xA0, 0xB7, 0xDE, 0xC1, 0xE4, // BIN 882: 8 pairs
+  0x0E, 0x17, 0x32, 0x20, 0x75, 0x2B, 0xFF, 0x34, 0x43, 0x6B, 0x9E, 0x6D, 0x79, 0x7E, 0x96, 0x89, 0x8C, 0x99, 0xD7, 0x9A, 0xD7, 0xA3, 0xD0, 0xD4, 0xF8, 0xDA, 0xF6, 0xF7, 0xFE, // BIN 883: 14 pairs
+  0x0C, 0x0A, 0xEF, 0x12, 0x3B, 0x17, 0xFF, 0x19, 0x40, 0x20, 0x84, 0x26, 0x35, 0x3F, 0x47, 0x52, 0x62, 0x53, 0x69, 0x7A, 0xC9, 0x9C, 0xAE, 0xA2, 0xD2, // BIN 884: 12 pairs
+  0x0B, 0x0F, 0xF4, 0x1B, 0x93, 0x21, 0x5D, 0x2A, 0x55, 0x2E, 0x58, 0x41, 0x84, 0x4E, 0x5C, 0x7D, 0xC0, 0x82, 0xAD, 0xBB, 0xCE, 0xC9, 0xF6, // BIN 885: 11 pairs
+  0x0D, 0x06, 0x27, 0x09, 0xEB, 0x54, 0x7D, 0x68, 0xC5, 0x6E, 0x94, 0x76, 0x8C, 0x98, 0xB0, 0xA2, 0xBC, 0xA9, 0xDC, 0xB9, 0xC4, 0xD5, 0xE6, 0xDC, 0xF2, 0xE0, 0xF6, // BIN 886: 13 pairs
+  0x07, 0x26, 0x56, 0x5D, 0x8F, 0x68, 0xA7, 0x8A, 0xB6, 0xC4, 0xEB, 0xD5, 0xF4, 0xDD, 0xF8, // BIN 887: 7 pairs
+  0x0B, 0x02, 0x17, 0x06, 0xEE, 0x14, 0x15, 0x1D, 0x2A, 0x45, 0x59, 0x53, 0x66, 0x81, 0x94, 0x9F, 0xCC, 0xCC, 0xF8, 0xE3, 0xE8, 0xE3, 0xF1, // BIN 888: 11 pairs
+  0x05, 0x0A, 0x25, 0x1B, 0x99, 0x1B, 0x9A, 0x84, 0xCC, 0xBC, 0xE0, // BIN 889: 5 pairs
+  0x0E, 0x03, 0xC9, 0x0C, 0x5E, 0x0C, 0xEB, 0x0E, 0x23, 0x1F, 0x49, 0x24, 0x38, 0x25, 0x64, 0x49, 0x66, 0x4D, 0x6C, 0x5F, 0x8B, 0xA3, 0xD3, 0xAD, 0xC1, 0xD4, 0xE7, 0xF3, 0xF8, // BIN 890: 14 pairs
+  0x09, 0x15, 0x1A, 0x1B, 0x4C, 0x42, 0x65, 0x7A, 0xA2, 0x84, 0xBB, 0x8A, 0x96, 0xA5, 0xEC, 0xAA, 0xD2, 0xF0, 0xFD, // BIN 891: 9 pairs
+  0x0F, 0x0D, 0x3C, 0x13, 0x3B, 0x18, 0x40, 0x1A, 0x32, 0x1B, 0x7F, 0x25, 0x30, 0x30, 0x55, 0x3F, 0x5B, 0x55, 0x6C, 0x69, 0x80, 0x87, 0xA9, 0x8B, 0xC5, 0x8B, 0xC6, 0x94, 0xCA, 0xB0, 0xDB, // BIN 892: 15 pairs
+  0x0C, 0x03, 0x61, 0x10, 0x3C, 0x13, 0xEC, 0x50, 0x71, 0x52, 0x70, 0x68, 0xA1, 0x7C, 0xA3, 0x9D, 0xBE, 0x9F, 0xD0, 0xB1, 0xE0, 0xB5, 0xBE, 0xC3, 0xEF, // BIN 893: 12 pairs
+  0x0B, 0x11, 0x2E, 0x2F, 0x3D, 0x48, 0x7A, 0x80, 0x84, 0x88, 0xBE, 0x98, 0xD7, 0x9F, 0xB5, 0xA3, 0xC2, 0xAC, 0xDD, 0xAE, 0xB5, 0xCE, 0xCF, // BIN 894: 11 pairs
+  0x0B, 0x0D, 0xFD, 0x1B, 0x54, 0x1C, 0x38, 0x23, 0x4A, 0x36, 0x63, 0x3A, 0x5B, 0x42, 0x53, 0x74, 0x86, 0x78, 0xC6, 0x9C, 0xD7, 0x9E, 0xB8, // BIN 895: 11 pairs
+  0x0C, 0x18, 0x32, 0x1D, 0x33, 0x1F, 0x4A, 0x3D, 0x58, 0x46, 0x5C, 0x49, 0x5B, 0x63, 0x79, 0x99, 0x9F, 0x9A, 0x9F, 0xB8, 0xE9, 0xBC, 0xDA, 0xD2, 0xDC, // BIN 896: 12 pairs
+  0x0B, 0x01, 0xA5, 0x05, 0xEF, 0x0B, 0x9E, 0x26, 0x42, 0x61, 0x79, 0x6D, 0x80, 0x77, 0x89, 0x79, 0xA7, 0x7F, 0xC0, 0xDA, 0xF1, 0xFC, 0xFE, // BIN 897: 11 pairs
+  0x07, 0x00, 0x1A, 0x0D, 0xFA, 0x17, 0x40, 0x29, 0x2E, 0xBE, 0xED, 0xCC, 0xE8, 0xF8, 0xFB, // BIN 898: 7 pairs
+  0x07, 0x0E, 0x25, 0x2E, 0x5C, 0x6E, 0xB9, 0xAA, 0xDF, 0xC3, 0xE6, 0xD5, 0xDE, 0xD8, 0xF4, // BIN 899: 7 pairs
+  0x0B, 0x10, 0xEF, 0x13, 0xE4, 0x20, 0x4D, 0x22, 0x52, 0x2C, 0x55, 0x33, 0x4F, 0x49, 0x5E, 0x69, 0xA1, 0x6D, 0xC6, 0x86, 0x89, 0x9D, 0xA5, // BIN 900: 11 pairs
+  0x07, 0x0F, 0x66, 0x23, 0x39, 0x39, 0x66, 0x41, 0x7D, 0x4F, 0x7A, 0x62, 0x7E, 0xC3, 0xE2, // BIN 901: 7 pairs
+  0x09, 0x02, 0xF1, 0x08, 0xA5, 0x12, 0xF7, 0x20, 0x5D, 0x67, 0x7E, 0x6F, 0x7F, 0x93, 0x9F, 0xA4, 0xD3, 0xD9, 0xE7, // BIN 902: 9 pairs
+  0x0B, 0x06, 0xFE, 0x0E, 0x27, 0x66, 0x98, 0x73, 0x8D, 0x78, 0xC5, 0x91, 0x94, 0x91, 0xBC, 0x9B, 0xD5, 0x9F, 0xCF, 0xA5, 0xA9, 0xAD, 0xCB, // BIN 903: 11 pairs
+  0x0B, 0x06, 0xED, 0x3A, 0x55, 0x45, 0x47, 0x47, 0x9C, 0x58, 0x6A, 0x7B, 0xFF, 0x81, 0xCC, 0x84, 0x8A, 0x99, 0xC4, 0x9A, 0xC4, 0xA7, 0xDD, // BIN 904: 11 pairs
+  0x0E, 0x08, 0xBE, 0x17, 0x2D, 0x1F, 0x43, 0x27, 0x4E, 0x2F, 0x40, 0x3B, 0x51, 0x56, 0x6F, 0x73, 0x79, 0x82, 0xC9, 0x8F, 0xD0, 0x99, 0xD3, 0x9A, 0xD3, 0xD7, 0xF8, 0xDD, 0xF9, // BIN 905: 14 pairs
+  0x09, 0x0A, 0xF0, 0x30, 0x43, 0x3B, 0x71, 0x54, 0x7F, 0x82, 0xBB, 0x94, 0xC9, 0xC1, 0xE0, 0xCF, 0xF8, 0xE2, 0xEC, // BIN 906: 9 pairs
+  0x06, 0x1C, 0x29, 0x27, 0x64, 0x6F, 0x7A, 0xA3, 0xCF, 0xB8, 0xD2, 0xD5, 0xE5, // BIN 907: 6 pairs
+  0x0B, 0x08, 0x3B, 0x1D, 0x1F, 0x4C, 0x4E, 0x59, 0x6F, 0x68, 0x95, 0x6D, 0xA6, 0x94, 0xCC, 0xA3, 0xCC, 0xB1, 0xDE, 0xB9, 0xDA, 0xE5, 0xFA, // BIN 908: 11 pairs
+  0x0B, 0x01, 0x25, 0x14, 0xF9, 0x25, 0xFF, 0x2C, 0x52, 0x54, 0x81, 0x5A, 0x76, 0x93, 0xEA, 0x9C, 0xF8, 0xAC, 0xD8, 0xB3, 0xE3, 0xE6, 0xFA, // BIN 909: 11 pairs
+  0x09, 0x01, 0xFE, 0x0D, 0xEC, 0x0F, 0xEB, 0x19, 0x44, 0x1E, 0x58, 0x4F, 0x7D, 0x69, 0x6F, 0x81, 0xBB, 0x85, 0xCC, // BIN 910: 9 pairs
+  0x09, 0x07, 0x0F, 0x08, 0xE9, 0x13, 0x25, 0x51, 0x54, 0x67, 0x88, 0x6C, 0x6F, 0x6E, 0xA7, 0x7C, 0x7D, 0x95, 0xBF, // BIN 911: 9 pairs
+  0x0C, 0x03, 0x7F, 0x06, 0xE4, 0x12, 0xFF, 0x1E, 0x46, 0x3F, 0x59, 0x4F, 0x81, 0x67, 0x70, 0x6C, 0xBD, 0x8E, 0xA1, 0xAC, 0xDA, 0xB7, 0xBD, 0xC4, 0xEA, // BIN 912: 12 pairs
+  0x0E, 0x05, 0xF2, 0x11, 0xFA, 0x14, 0x28, 0x1E, 0x30, 0x25, 0x34, 0x30, 0x3B, 0x42, 0x49, 0x67, 0x79, 0x6D, 0xC5, 0x82, 0xC0, 0xA1, 0xD8, 0xA3, 0xB8, 0xA6, 0xDD, 0xBC, 0xDB, // BIN 913: 14 pairs
+  0x0B, 0x01, 0x2B, 0x02, 0x18, 0x1E, 0xFF, 0x23, 0x50, 0x2D, 0x4D, 0x43, 0x75, 0x46, 0x62, 0x5C, 0x90, 0x80, 0x81, 0xDF, 0xF8, 0xE3, 0xF0, // BIN 914: 11 pairs
+  0x07, 0x0E, 0x1F, 0x12, 0xFE, 0x2A, 0x4F, 0x69, 0xA7, 0x93, 0xD4, 0xA2, 0xD8, 0xE7, 0xFE, // BIN 915: 7 pairs
+  0x0F, 0x0A, 0x27, 0x11, 0x1F, 0x12, 0x3C, 0x21, 0x45, 0x36, 0x5E, 0x3F, 0x62, 0x49, 0x69, 0x5D, 0x93, 0x79, 0x84, 0x7D, 0xA2, 0x7E, 0xA7, 0x7F, 0xBB, 0x94, 0xC5, 0x96, 0xB7, 0xC7, 0xEE, // BIN 916: 15 pairs
+  0x08, 0x0D, 0xBE, 0x32, 0x39, 0x53, 0x6C, 0x57, 0xB9, 0x63, 0x9B, 0x70, 0xFF, 0xA0, 0xD8, 0xBF, 0xE8, // BIN 917: 8 pairs
+  0x0E, 0x01, 0x1D, 0x0F, 0xB9, 0x61, 0xAC, 0x7C, 0xA6, 0x86, 0xFF, 0x88, 0xB8, 0x8D, 0xB4, 0x93, 0xAF, 0x94, 0x96, 0xB0, 0xDE, 0xB7, 0xC5, 0xCB, 0xE9, 0xD0, 0xE2, 0xDF, 0xF9, // BIN 918: 14 pairs
+  0x08, 0x13, 0x72, 0x1B, 0x5D, 0x73, 0x97, 0x74, 0x90, 0x86, 0xB8, 0xB0, 0xE0, 0xC2, 0xEC, 0xCB, 0xDF, // BIN 919: 8 pairs
+  0x0C, 0x15, 0x19, 0x1A, 0x50, 0x20, 0x4B, 0x22, 0x45, 0x58, 0x88, 0x60, 0x8C, 0x64, 0x76, 0x72, 0x96, 0x75, 0x7C, 0x96, 0xA2, 0xB9, 0xD8, 0xB9, 0xDF, // BIN 920: 12 pairs
+  0x07, 0x31, 0x47, 0x4B, 0x66, 0x51, 0x5C, 0x72, 0x9D, 0x94, 0xC6, 0xA6, 0xDB, 0xA7, 0xDB, // BIN 921: 7 pairs
+  0x08, 0x18, 0x2D, 0x2C, 0x50, 0x6A, 0x86, 0x79, 0x99, 0x79, 0x9A, 0x8B, 0xC9, 0xB5, 0xE4, 0xFA, 0xFB, // BIN 922: 8 pairs
+  0x0B, 0x07, 0x11, 0x21, 0xF8, 0x33, 0x52, 0x4C, 0x75, 0x7D, 0xBB, 0x80, 0x91, 0x81, 0xEA, 0x92, 0xC4, 0x9F, 0xD2, 0xB1, 0xDD, 0xB1, 0xDF, // BIN 923: 11 pairs
+  0x0D, 0x02, 0x08, 0x0C, 0x36, 0x12, 0x23, 0x41, 0x7A, 0x42, 0x55, 0x47, 0x93, 0x5E, 0x8B, 0x6B, 0xA5, 0x80, 0xAD, 0x83, 0xAB, 0x8A, 0xAB, 0xA3, 0xD6, 0xC5, 0xD2, // BIN 924: 13 pairs
+  0x0C, 0x0A, 0x24, 0x14, 0xF8, 0x1D, 0x50, 0x1F, 0x4B, 0x22, 0x51, 0x54, 0x84, 0x5A, 0x64, 0x5E, 0xBD, 0x5F, 0x6F, 0x85, 0xBA, 0x9E, 0xEC, 0xC1, 0xE7, // BIN 925: 12 pairs
+  0x0B, 0x08, 0xE4, 0x26, 0x4E, 0x27, 0x28, 0x31, 0x44, 0x45, 0x57, 0x7B, 0xA9, 0x94, 0xCD, 0xB5, 0xE2, 0xC4, 0xDE, 0xCF, 0xF6, 0xE4, 0xE7, // BIN 926: 11 pairs
+  0x09, 0x0B, 0x58, 0x4F, 0x78, 0x5B, 0x64, 0x61, 0x62, 0x71, 0x74, 0x81, 0x8A, 0x84, 0xEA, 0x98, 0xD5, 0xC2, 0xED, // BIN 927: 9 pairs
+  0x0E, 0x0B, 0xA5, 0x15, 0x27, 0x2B, 0x30, 0x34, 0x3B, 0x40, 0x65, 0x55, 0x5E, 0x61, 0xB9, 0x6B, 0x89, 0x8E, 0xB7, 0x9C, 0xD3, 0x9D, 0xB7, 0xA2, 0xB9, 0xBD, 0xF6, 0xC2, 0xE1, // BIN 928: 14 pairs
+  0x0C, 0x0C, 0x39, 0x19, 0x23, 0x23, 0x52, 0x25, 0x2C, 0x2E, 0x31, 0x3E, 0x5E, 0x6D, 0xAA, 0x80, 0x9C, 0x8C, 0xFF, 0x8E, 0xA0, 0xA4, 0xAE, 0xC1, 0xD3, // BIN 929: 12 pairs
+  0x06, 0x53, 0x5E, 0x58, 0xA8, 0x79, 0xAA, 0x7A, 0xC0, 0xA6, 0xD2, 0xB9, 0xF9, // BIN 930: 6 pairs
+  0x08, 0x25, 0x37, 0x40, 0x64, 0x7D, 0x7E, 0xCC, 0xF6, 0xD1, 0xE5, 0xD3, 0xDE, 0xD5, 0xF6, 0xE7, 0xEC, // BIN 931: 8 pairs
+  0x0D, 0x21, 0x53, 0x2A, 0x3C, 0x4F, 0x84, 0x5C, 0xA5, 0x5D, 0x80, 0x71, 0xF0, 0x75, 0xC9, 0x79, 0xA3, 0x8A, 0xB0, 0x9F, 0xD3, 0xB9, 0xDB, 0xE3, 0xFD, 0xF5, 0xF6, // BIN 932: 13 pairs
+  0x0D, 0x0A, 0x2B, 0x20, 0x31, 0x20, 0xF9, 0x26, 0x51, 0x2A, 0x41, 0x3B, 0x6B, 0x3B, 0x70, 0x3E, 0x42, 0x67, 0x77, 0x6F, 0x94, 0x79, 0x81, 0xD3, 0xE6, 0xE3, 0xF5, // BIN 933: 13 pairs
+  0x09, 0x06, 0x1C, 0x1B, 0x6E, 0x5F, 0x9B, 0x74, 0x8C, 0x7E, 0xAA, 0x9F, 0xBD, 0xBF, 0xE5, 0xBF, 0xE6, 0xE8, 0xEE, // BIN 934: 9 pairs
+  0x0A, 0x2A, 0x48, 0x4D, 0x6D, 0x52, 0x71, 0x55, 0x67, 0x66, 0xA0, 0x8E, 0xA6, 0x91, 0xC2, 0x9F, 0xC1, 0xB7, 0xC6, 0xCD, 0xF8, // BIN 935: 10 pairs
+  0x10, 0x08, 0x1C, 0x1A, 0x2D, 0x1A, 0xF0, 0x1E, 0x2C, 0x59, 0x62, 0x7B, 0xD1, 0x85, 0xAD, 0x86, 0xC3, 0x89, 0xA2, 0x91, 0xA2, 0x9F, 0xC9, 0xA4, 0xD5, 0xA7, 0xEA, 0xC3, 0xF0, 0xDE, 0xF5, 0xE7, 0xEB, // BIN 936: 16 pairs
+  0x06, 0x07, 0x1F, 0x2B, 0x60, 0x3F, 0x57, 0x64, 0xA8, 0x72, 0xB3, 0x90, 0xC2, // BIN 937: 6 pairs
+  0x11, 0x02, 0x0B, 0x10, 0x13, 0x10, 0xFE, 0x1E, 0x34, 0x24, 0x51, 0x29, 0x44, 0x2B, 0x4E, 0x2D, 0x53, 0x59, 0x92, 0x65, 0x86, 0x6B, 0x97, 0x6C, 0xA6, 0x7B, 0x89, 0x8E, 0x92, 0x97, 0xD9, 0xC1, 0xDA, 0xE9, 0xF5, // BIN 938: 17 pairs
+  0x07, 0x38, 0x3C, 0x4B, 0x5E, 0x4B, 0x69, 0x62, 0x80, 0x6A, 0x7C, 0x82, 0xAE, 0xAE, 0xB9, // BIN 939: 7 pairs
+  0x0D, 0x00, 0xE9, 0x00, 0xF0, 0x08, 0x24, 0x24, 0x5C, 0x57, 0xAC, 0x63, 0x80, 0x66, 0x95, 0x7C, 0x93, 0x7E, 0x93, 0x8A, 0xB1, 0xBF, 0xE7, 0xC1, 0xD5, 0xCE, 0xD1, // BIN 940: 13 pairs
+  0x0A, 0x18, 0x44, 0x37, 0x3B, 0x42, 0x4D, 0x45, 0x52, 0x7C, 0x96, 0x8A, 0xBA, 0x8D, 0xB7, 0x9D, 0x9E, 0xC6, 0xD2, 0xEE, 0xF3, // BIN 941: 10 pairs
+  0x09, 0x3E, 0x66, 0x54, 0x85, 0x7F, 0x8D, 0x80, 0xAE, 0xA9, 0xAF, 0xAC, 0xDF, 0xB2, 0xB5, 0xCF, 0xF4, 0xD3, 0xF4, // BIN 942: 9 pairs
+  0x07, 0x37, 0x5A, 0x4D, 0x68, 0x5D, 0x7C, 0x83, 0x97, 0xAB, 0xBB, 0xAC, 0xDB, 0xD8, 0xF3, // BIN 943: 7 pairs
+  0x0A, 0x1F, 0x2E, 0x28, 0x55, 0x32, 0x4D, 0x38, 0x52, 0x66, 0xBD, 0x69, 0xBD, 0x72, 0x87, 0x87, 0x90, 0x9C, 0xAF, 0xBC, 0xCA, // BIN 944: 10 pairs
+  0x0B, 0x05, 0xFF, 0x16, 0x3D, 0x33, 0x50, 0x7D, 0xCC, 0x82, 0xBA, 0x8E, 0xB2, 0x94, 0xCF, 0xC0, 0xF8, 0xDC, 0xFA, 0xF2, 0xF4, 0xF5, 0xF9, // BIN 945: 11 pairs
+  0x09, 0x0C, 0x43, 0x23, 0x4B, 0x33, 0x48, 0x47, 0xB9, 0x49, 0x6E, 0x55, 0x6D, 0xA7, 0xDF, 0xBC, 0xC8, 0xC6, 0xF9, // BIN 946: 9 pairs
+  0x0C, 0x12, 0x35, 0x20, 0x29, 0x2B, 0x34, 0x40, 0x4A, 0x48, 0x7F, 0x61, 0x80, 0x96, 0xAF, 0x9C, 0xC4, 0x9F, 0xCE, 0xA6, 0xAB, 0xA8, 0xEC, 0xB1, 0xE2, // BIN 947: 12 pairs
+  0x0E, 0x0B, 0xBE, 0x20, 0x7D, 0x38, 0x5A, 0x3B, 0xFF, 0x5E, 0xC6, 0x75, 0x7E, 0x7C, 0xA7, 0x91, 0xC3, 0xA4, 0xC4, 0xBB, 0xBC, 0xC6, 0xF4, 0xC9, 0xF4, 0xCB, 0xDD, 0xD0, 0xF8, // BIN 948: 14 pairs
+  0x0D, 0x05, 0xF0, 0x06, 0x9E, 0x08, 0xEE, 0x23, 0x49, 0x54, 0x5A, 0x54, 0x5B, 0x78, 0x9F, 0x8A, 0xBB, 0x9B, 0xB1, 0xA3, 0xD5, 0xC1, 0xDB, 0xC4, 0xE7, 0xD6, 0xF1, // BIN 949: 13 pairs
+  0x0B, 0x1A, 0x42, 0x21, 0x2A, 0x25, 0x4E, 0x32, 0x5A, 0x4B, 0x6E, 0x4F, 0x7F, 0x6F, 0x75, 0x82, 0x83, 0xB8, 0xE5, 0xC5, 0xF4, 0xED, 0xFF, // BIN 950: 11 pairs
+  0x0D, 0x0F, 0x5F, 0x33, 0x54, 0x47, 0x82, 0x6E, 0xA6, 0x77, 0xC7, 0x97, 0xE1, 0x99, 0xD5, 0x9A, 0xD5, 0xA6, 0xDF, 0xB0, 0xDD, 0xB0, 0xDF, 0xCC, 0xCE, 0xE7, 0xFA, // BIN 951: 13 pairs
+  0x0F, 0x08, 0xED, 0x0C, 0x68, 0x17, 0x44, 0x27, 0x33, 0x44, 0x6B, 0x49, 0x6C, 0x5D, 0x8B, 0x5F, 0x79, 0x84, 0xA2, 0xA5, 0xE9, 0xA8, 0xF7, 0xAA, 0xAB, 0xAA, 0xEA, 0xD0, 0xF6, 0xD3, 0xE5, // BIN 952: 15 pairs
+  0x07, 0x00, 0x1E, 0x15, 0x25, 0x21, 0x38, 0x57, 0x92, 0x8D, 0xB6, 0xC5, 0xF9, 0xE0, 0xF5, // BIN 953: 7 pairs
+  0x0A, 0x1A, 0xF7, 0x32, 0x53, 0x36, 0x66, 0x66, 0xA1, 0x6C, 0xC6, 0x8C, 0xF0, 0xAF, 0xC2, 0xBD, 0xD2, 0xC3, 0xD2, 0xD0, 0xF4, // BIN 954: 10 pairs
+  0x0F, 0x02, 0xF3, 0x06, 0xBE, 0x20, 0x4A, 0x29, 0x56, 0x3D, 0x4A, 0x3D, 0x64, 0x6C, 0x7C, 0x6C, 0x8A, 0x7A, 0xBB, 0x84, 0xBA, 0x9C, 0xEB, 0x9E, 0xA9, 0xB1, 0xC9, 0xCD, 0xF6, 0xE6, 0xFE, // BIN 955: 15 pairs
+  0x0D, 0x00, 0x07, 0x05, 0xEC, 0x0C, 0x57, 0x19, 0xEF, 0x1E, 0x52, 0x33, 0x41, 0x52, 0x73, 0x5E, 0x98, 0x8A, 0xAC, 0xB8, 0xBF, 0xB8, 0xEC, 0xC7, 0xCE, 0xFA, 0xFF, // BIN 956: 13 pairs
+  0x0B, 0x1E, 0x28, 0x37, 0x4F, 0x48, 0x78, 0x61, 0x9B, 0x68, 0xA6, 0x71, 0x76, 0x89, 0x8B, 0x94, 0xD0, 0x96, 0xB3, 0xCA, 0xE2, 0xD7, 0xE6, // BIN 957: 11 pairs
+  0x09, 0x01, 0x27, 0x05, 0xF5, 0x0B, 0x3C, 0x48, 0x85, 0x6F, 0x95, 0x7F, 0xAD, 0x84, 0xCF, 0xB4, 0xB5, 0xB8, 0xE2, // BIN 958: 9 pairs
+  0x09, 0x26, 0x3D, 0x2C, 0x3B, 0x66, 0xA7, 0x77, 0xE1, 0x91, 0xC1, 0x97, 0xCB, 0xA3, 0xD8, 0xB3, 0xC1, 0xF3, 0xFD, // BIN 959: 9 pairs
+  0x05, 0x35, 0x5A, 0x83, 0x98, 0x9B, 0xB0, 0xBA, 0xCB, 0xBC, 0xD0, // BIN 960: 5 pairs
+  0x05, 0x0E, 0x2B, 0x39, 0x69, 0x73, 0x80, 0x9D, 0xCE, 0xA1, 0xDA, // BIN 961: 5 pairs
+  0x0A, 0x00, 0x15, 0x09, 0x47, 0x1E, 0x37, 0x38, 0x56, 0x6C, 0xAA, 0x8C, 0xB5, 0xB5, 0xE5, 0xC9, 0xD6, 0xCC, 0xF4, 0xD8, 0xF1, // BIN 962: 10 pairs
+  0x0A, 0x00, 0x1D, 0x13, 0x27, 0x1B, 0x3E, 0x27, 0xFF, 0x34, 0x5A, 0x58, 0xBE, 0x8E, 0xB5, 0xA0, 0xDA, 0xB5, 0xC4, 0xD8, 0xF6, // BIN 963: 10 pairs
+  0x0E, 0x19, 0x32, 0x2B, 0x37, 0x39, 0x51, 0x3D, 0x65, 0x5E, 0xC5, 0x6D, 0x6F, 0x81, 0xF8, 0x82, 0xB2, 0x8F, 0xA3, 0x96, 0xCB, 0x97, 0xB0, 0xAD, 0xB5, 0xB0, 0xE2, 0xB7, 0xC3, // BIN 964: 14 pairs
+  0x08, 0x08, 0x58, 0x35, 0x5C, 0x4C, 0x5A, 0x88, 0xC7, 0xA5, 0xDC, 0xC1, 0xE9, 0xDB, 0xF8, 0xF3, 0xFA, // BIN 965: 8 pairs
+  0x10, 0x00, 0xFB, 0x0E, 0x2E, 0x13, 0x18, 0x18, 0xF7, 0x1B, 0xC6, 0x58, 0xF0, 0x65, 0x89, 0x73, 0x9D, 0x79, 0x91, 0x7F, 0xCC, 0x86, 0xF0, 0x92, 0xD4, 0xBC, 0xD7, 0xC0, 0xCE, 0xCB, 0xED, 0xE1, 0xFA, // BIN 966: 16 pairs
+  0x10, 0x02, 0xFC, 0x14, 0x38, 0x16, 0x40, 0x20, 0xB9, 0x53, 0x6D, 0x5C, 0x76, 0x62, 0x63, 0x66, 0x79, 0x6A, 0x7E, 0x6C, 0xC5, 0x77, 0xA9, 0x7F, 0xBA, 0xA9, 0xBF, 0xC8, 0xE2, 0xCB, 0xD7, 0xCD, 0xE2, // BIN 967: 16 pairs
+  0x0D, 0x07, 0xF1, 0x0D, 0x2E, 0x2B, 0x2C, 0x36, 0x51, 0x39, 0x68, 0x47, 0x99, 0x47, 0x9A, 0x5B, 0x72, 0x6B, 0xA8, 0x6D, 0x8A, 0x71, 0xC7, 0x84, 0xCD, 0xCD, 0xF4, // BIN 968: 13 pairs
+  0x0C, 0x0F, 0x59, 0x0F, 0x81, 0x11, 0x35, 0x20, 0xA4, 0x3A, 0x4C, 0x8B, 0xCC, 0x93, 0xD7, 0x9C, 0xD5, 0xA7, 0xD2, 0xBC, 0xDF, 0xCE, 0xE4, 0xE5, 0xFE, // BIN 969: 12 pairs
+  0x05, 0x2E, 0x3F, 0x6F, 0x85, 0x94, 0xB9, 0x95, 0xAB, 0xE9, 0xF1, // BIN 970: 5 pairs
+  0x07, 0x21, 0x81, 0x4F, 0x51, 0x68, 0xAA, 0x69, 0x7C, 0x7C, 0xAA, 0x83, 0x92, 0xF2, 0xF7, // BIN 971: 7 pairs
+  0x09, 0x05, 0xED, 0x06, 0xA5, 0x21, 0x75, 0x3E, 0x62, 0x45, 0x61, 0x54, 0x82, 0x81, 0xCF, 0x88, 0xB5, 0xD1, 0xE6, // BIN 972: 9 pairs
+  0x08, 0x00, 0xFF, 0x02, 0xF7, 0x26, 0x40, 0x42, 0x58, 0x63, 0x98, 0x77, 0xFF, 0x9F, 0xAC, 0xA8, 0xE9, // BIN 973: 8 pairs
+  0x08, 0x03, 0xFC, 0x1F, 0x24, 0x1F, 0x41, 0x29, 0x47, 0x50, 0x62, 0x7F, 0x9F, 0xCF, 0xE2, 0xD0, 0xE7, // BIN 974: 8 pairs
+  0x0C, 0x03, 0x43, 0x03, 0x8F, 0x06, 0x3B, 0x38, 0x50, 0x4B, 0x6C, 0x4C, 0x5B, 0x4D, 0x6F, 0x69, 0xA6, 0x81, 0xBA, 0xD3, 0xF6, 0xD7, 0xF3, 0xDA, 0xF8, // BIN 975: 12 pairs
+  0x0C, 0x00, 0x1C, 0x13, 0x6B, 0x4F, 0x85, 0x5D, 0x92, 0x62, 0x83, 0x66, 0xC6, 0x82, 0xB6, 0x84, 0xC8, 0x8A, 0xB7, 0x93, 0xC4, 0x97, 0xA3, 0xDB, 0xF9, // BIN 976: 12 pairs
+  0x0A, 0x05, 0x07, 0x06, 0x24, 0x09, 0x1F, 0x0F, 0x6D, 0x3C, 0x5A, 0x41, 0x7F, 0x5E, 0xA0, 0x84, 0xF8, 0x8E, 0xAA, 0xA2, 0xCE, // BIN 977: 10 pairs
+  0x0C, 0x25, 0x28, 0x42, 0x62, 0x4A, 0x66, 0x5D, 0x9C, 0x80, 0xAF, 0x81, 0xA2, 0x99, 0xF8, 0x9A, 0xF8, 0xD4, 0xF9, 0xD5, 0xF3, 0xE0, 0xF2, 0xE7, 0xFC, // BIN 978: 12 pairs
+  0x0A, 0x0F, 0xA4, 0x70, 0x9D, 0x70, 0xE1, 0x74, 0x97, 0x78, 0xC9, 0x82, 0xB4, 0x85, 0xCF, 0x8B, 0xC8, 0x9C, 0x9F, 0xA8, 0xC1, // BIN 979: 10 pairs
+  0x10, 0x19, 0x50, 0x4E, 0x54, 0x58, 0xB3, 0x59, 0xB9, 0x63, 0x95, 0x79, 0x9C, 0x7B, 0xF0, 0x85, 0x8D, 0x8A, 0xA4, 0x8E, 0x9B, 0x96, 0xAE, 0xB0, 0xC9, 0xB6, 0xEA, 0xBA, 0xC1, 0xC9, 0xE8, 0xD7, 0xE5, // BIN 980: 16 pairs
+  0x0C, 0x09, 0x41, 0x0C, 0xB9, 0x14, 0x3F, 0x1F, 0x20, 0x30, 0x5A, 0x34, 0x4F, 0x41, 0x85, 0x7D, 0xBA, 0x85, 0x9F, 0x85, 0xC8, 0xA3, 0xD4, 0xB3, 0xED, // BIN 981: 12 pairs
+  0x05, 0x01, 0xD1, 0x1F, 0x46, 0x59, 0x8B, 0x69, 0x8A, 0xE8, 0xED, // BIN 982: 5 pairs
+  0x10, 0x10, 0x35, 0x14, 0x33, 0x14, 0x4F, 0x1A, 0x3A, 0x1B, 0xC5, 0x1C, 0x31, 0x1F, 0x3D, 0x2E, 0x45, 0x44, 0x4A, 0x5A, 0x72, 0x6F, 0x92, 0x74, 0x8A, 0x81, 0xCD, 0x85, 0xCD, 0xA3, 0xC9, 0xD7, 0xF9, // BIN 983: 16 pairs
+  0x12, 0x0A, 0xEE, 0x0B, 0xE9, 0x1B, 0xBD, 0x2A, 0x54, 0x37, 0x5B, 0x64, 0xFF, 0x6A, 0x8C, 0x80, 0x96, 0x8D, 0xA9, 0x9B, 0xD8, 0x9D, 0xD9, 0x9F, 0xC5, 0xC0, 0xE8, 0xC3, 0xEE, 0xD7, 0xDE, 0xD9, 0xFF, 0xE0, 0xE3, 0xE6, 0xFD, // BIN 984: 18 pairs
+  0x0B, 0x2B, 0x71, 0x38, 0x5B, 0x3E, 0x69, 0x49, 0x68, 0x69, 0xC6, 0x7E, 0xAD, 0x84, 0xCA, 0x8E, 0xB4, 0xAA, 0xE0, 0xBC, 0xE7, 0xEC, 0xF5, // BIN 985: 11 pairs
+  0x0A, 0x03, 0x56, 0x13, 0x1E, 0x16, 0x44, 0x1B, 0xEB, 0x28, 0x4F, 0x33, 0x5A, 0x55, 0x68, 0x58, 0x73, 0x59, 0xAC, 0xC9, 0xF9, // BIN 986: 10 pairs
+  0x09, 0x2E, 0x2F, 0x42, 0x64, 0x7A, 0x8D, 0xA2, 0xDA, 0xCA, 0xF8, 0xCB, 0xE8, 0xD2, 0xD9, 0xD5, 0xF8, 0xE5, 0xFD, // BIN 987: 9 pairs
+  0x10, 0x0A, 0x22, 0x15, 0x16, 0x17, 0x3A, 0x2C, 0x4F, 0x2F, 0x44, 0x36, 0x4E, 0x6D, 0x7C, 0x6E, 0xAA, 0x85, 0xB6, 0x90, 0xAB, 0x91, 0xB7, 0x93, 0xD3, 0x95, 0xD4, 0xA4, 0xAF, 0xB8, 0xE6, 0xBC, 0xDD, // BIN 988: 16 pairs
+  0x09, 0x14, 0x4C, 0x14, 0xFC, 0x27, 0x2A, 0x36, 0x46, 0x5B, 0x5D, 0x5E, 0xA7, 0x95, 0xD3, 0xA3, 0xD7, 0xAC, 0xBF, // BIN 989: 9 pairs
+  0x0A, 0x17, 0xF7, 0x1F, 0x42, 0x24, 0x29, 0x2F, 0x57, 0x35, 0x4A, 0x39, 0x4E, 0x46, 0x67, 0x5E, 0xF8, 0x97, 0xB1, 0xBC, 0xCD, // BIN 990: 10 pairs
+  0x0D, 0x07, 0xF8, 0x21, 0x55, 0x27, 0x51, 0x65, 0x83, 0x66, 0x80, 0x66, 0xC5, 0x6D, 0x94, 0x85, 0xCA, 0x88, 0xAB, 0x8B, 0xCA, 0x8F, 0xD4, 0xC4, 0xE6, 0xC8, 0xF8, // BIN 991: 13 pairs
+  0x0B, 0x0F, 0x4F, 0x1D, 0x38, 0x1D, 0x52, 0x27, 0x60, 0x49, 0x6D, 0x56, 0x93, 0x9E, 0xE9, 0x9F, 0xCB, 0xA1, 0xAB, 0xA5, 0xC2, 0xEA, 0xFB, // BIN 992: 11 pairs
+  0x0E, 0x0F, 0x84, 0x2E, 0x60, 0x35, 0x58, 0x59, 0x79, 0x5F, 0x80, 0x68, 0xF8, 0x6C, 0x94, 0x81, 0xC8, 0x82, 0x8E, 0x82, 0xCC, 0xA0, 0xDD, 0xA1, 0xDD, 0xAF, 0xB9, 0xCA, 0xCB, // BIN 993: 14 pairs
+  0x0E, 0x01, 0xB3, 0x32, 0x5B, 0x3C, 0x6B, 0x47, 0x8F, 0x4A, 0x5E, 0x52, 0x74, 0x6C, 0x7E, 0x7E, 0xAE, 0x89, 0x95, 0x8D, 0x93, 0xA9, 0xAE, 0xB5, 0xB6, 0xCB, 0xD0, 0xFD, 0xFF, // BIN 994: 14 pairs
+  0x0B, 0x08, 0xFE, 0x13, 0xE9, 0x14, 0x49, 0x1B, 0x78, 0x20, 0x3F, 0x3C, 0x65, 0x70, 0x91, 0x78, 0x83, 0x9F, 0xC6, 0xB5, 0xE6, 0xC2, 0xE7, // BIN 995: 11 pairs
+  0x0C, 0x25, 0x60, 0x4A, 0x69, 0x53, 0x68, 0x5F, 0x98, 0x68, 0xC9, 0x6F, 0x7D, 0x6F, 0x8F, 0x78, 0xAD, 0x7A, 0xCC, 0x8F, 0xC4, 0xA6, 0xEA, 0xBC, 0xD4, // BIN 996: 12 pairs
+  0x0E, 0x0B, 0xE4, 0x39, 0x6C, 0x44, 0x6A, 0x5E, 0xA1, 0x75, 0xC0, 0x82, 0xAF, 0x85, 0xB2, 0x91, 0xAF, 0x99, 0xEB, 0x9A, 0xEB, 0x9F, 0xD5, 0xC2, 0xC4, 0xC7, 0xE5, 0xC8, 0xCB, // BIN 997: 14 pairs
+  0x0B, 0x21, 0x84, 0x44, 0x67, 0x5D, 0x99, 0x5D, 0x9A, 0x61, 0x7C, 0x63, 0x7C, 0x69, 0xC5, 0x88, 0x8D, 0xA9, 0xD6, 0xDE, 0xF3, 0xE0, 0xF9, // BIN 998: 11 pairs
+  0x08, 0x18, 0x3A, 0x2F, 0x59, 0x37, 0x54, 0x56, 0x8F, 0x69, 0xAA, 0x85, 0xAE, 0x8E, 0x90, 0xAB, 0xDE, // BIN 999: 8 pairs
+  0x0D, 0x2D, 0x55, 0x45, 0x50, 0x50, 0x73, 0x66, 0x6F, 0x78, 0xC0, 0x7E, 0x99, 0x7E, 0x9A, 0x89, 0xB0, 0x92, 0xB7, 0x9F, 0xD4, 0xB6, 0xEB, 0xC4, 0xE5, 0xDA, 0xF9, // BIN 1000: 13 pairs
+  0x12, 0x02, 0xED, 0x0F, 0x69, 0x15, 0x3D, 0x1F, 0x4C, 0x1F, 0x4D, 0x2D, 0x5A, 0x3B, 0x65, 0x41, 0x78, 0x53, 0x67, 0x5A, 0x5D, 0x60, 0x90, 0x65, 0x87, 0x81, 0xCA, 0x92, 0xD3, 0x98, 0xD8, 0x9B, 0xEA, 0xAB, 0xD3, 0xC1, 0xDF, // BIN 1001: 18 pairs
+  0x06, 0x28, 0x41, 0x3F, 0x52, 0x40, 0x4B, 0x74, 0x9D, 0x96, 0xC7, 0xDF, 0xFC, // BIN 1002: 6 pairs
+  0x0E, 0x0C, 0x66, 0x18, 0xF0, 0x1C, 0x26, 0x1C, 0x50, 0x35, 0x5B, 0x43, 0x81, 0x4A, 0x6E, 0x71, 0x9D, 0x78, 0xBB, 0x85, 0xB4, 0x87, 0xB0, 0x8E, 0xA7, 0xA4, 0xDD, 0xEE, 0xFF, // BIN 1003: 14 pairs
+  0x08, 0x20, 0xF6, 0x34, 0x5B, 0x4F, 0x6F, 0x50, 0x77, 0x72, 0xBE, 0xD2, 0xEB, 0xD6, 0xED, 0xE8, 0xF8, // BIN 1004: 8 pairs
+  0x0D, 0x14, 0x2C, 0x1A, 0x52, 0x28, 0x48, 0x3F, 0x61, 0x67, 0x80, 0x6A, 0x79, 0x7C, 0x99, 0x7C, 0x9A, 0x83, 0xA9, 0x88, 0xC3, 0xA1, 0xDB, 0xAB, 0xC8, 0xCA, 0xF6, // BIN 1005: 13 pairs
+  0x09, 0x16, 0xFD, 0x19, 0x2D, 0x25, 0x33, 0x30, 0x4F, 0x39, 0x46, 0x5D, 0x7E, 0x6E, 0x8D, 0x72, 0x83, 0xCB, 0xD4, // BIN 1006: 9 pairs
+  0x06, 0x20, 0x7A, 0x28, 0x52, 0x43, 0x51, 0xA0, 0xDB, 0xC0, 0xF6, 0xE8, 0xFE, // BIN 1007: 6 pairs
+  0x0B, 0x0F, 0x26, 0x13, 0x17, 0x16, 0xE1, 0x21, 0x28, 0x68, 0x79, 0x7A, 0xAD, 0x7A, 0xBA, 0x91, 0xB3, 0xCE, 0xE9, 0xDD, 0xFC, 0xE7, 0xFD, // BIN 1008: 11 pairs
+  0x0A, 0x0A, 0xEC, 0x0F, 0x63, 0x11, 0x2D, 0x4E, 0x64, 0x5E, 0x95, 0x7D, 0xAD, 0xAB, 0xCA, 0xAC, 0xF6, 0xD4, 0xF3, 0xD9, 0xFA, // BIN 1009: 10 pairs
+  0x09, 0x1A, 0x5C, 0x1B, 0x8F, 0x32, 0x55, 0x35, 0x60, 0x47, 0xAC, 0x61, 0x98, 0x6A, 0x90, 0x6A, 0x91, 0x6B, 0x91, // BIN 1010: 9 pairs
+  0x0C, 0x0D, 0x71, 0x17, 0xFD, 0x1F, 0x40, 0x3D, 0x4B, 0x43, 0x62, 0x46, 0x4C, 0x61, 0x95, 0x65, 0x8C, 0x8B, 0xCD, 0xA9, 0xD2, 0xAB, 0xD9, 0xD4, 0xE6, // BIN 1011: 12 pairs
+  0x0A, 0x0F, 0x6C, 0x26, 0x57, 0x2E, 0x64, 0x3E, 0x5A, 0x5F, 0x95, 0x69, 0x7E, 0xA0, 0xAB, 0xB3, 0xCB, 0xBC, 0xE4, 0xC8, 0xF6, // BIN 1012: 10 pairs
+  0x06, 0x21, 0x33, 0x2F, 0x5D, 0x5F, 0x62, 0xA3, 0xBD, 0xA9, 0xDE, 0xB9, 0xF4, // BIN 1013: 6 pairs
+  0x0C, 0x0B, 0x2E, 0x12, 0xF0, 0x2D, 0x4C, 0x3C, 0x5B, 0x45, 0x5F, 0x75, 0xA2, 0x7D, 0xCF, 0xB8, 0xED, 0xCA, 0xF4, 0xD3, 0xF8, 0xD9, 0xF2, 0xEB, 0xF5, // BIN 1014: 12 pairs
+  0x06, 0x18, 0x58, 0x67, 0x71, 0x7C, 0x84, 0x92, 0xD7, 0x9D, 0xAF, 0xAB, 0xC7, // BIN 1015: 6 pairs
+  0x11, 0x03, 0xCC, 0x0F, 0x56, 0x10, 0x23, 0x1F, 0x48, 0x28, 0x50, 0x36, 0x69, 0x37, 0x48, 0x45, 0x63, 0x58, 0xE1, 0x84, 0xAD, 0x84, 0xD0, 0x89, 0xB5, 0xA2, 0xC1, 0xAE, 0xC2, 0xBC, 0xCF, 0xBD, 0xF9, 0xDF, 0xF5, // BIN 1016: 17 pairs
+  0x05, 0x02, 0x16, 0x20, 0x6E, 0x87, 0x98, 0xA1, 0xD2, 0xBE, 0xEE, // BIN 1017: 5 pairs
+  0x0C, 0x02, 0x1C, 0x0B, 0xEE, 0x18, 0xFD, 0x36, 0x68, 0x4B, 0x6D, 0x4E, 0x6B, 0x57, 0x6F, 0x63, 0xA0, 0x6D, 0xC9, 0xAB, 0xD8, 0xD5, 0xF1, 0xEF, 0xFE, // BIN 1018: 12 pairs
+  0x06, 0x39, 0x6D, 0x68, 0x80, 0x7F, 0xAE, 0x92, 0xBF, 0x9F, 0xD7, 0xE3, 0xFE, // BIN 1019: 6 pairs
+  0x06, 0x14, 0xF6, 0x4B, 0x68, 0x7D, 0xCD, 0x83, 0xA1, 0x90, 0xD9, 0xA0, 0xEA, // BIN 1020: 6 pairs
+  0x05, 0x0C, 0x26, 0x15, 0x2B, 0x70, 0x89, 0x98, 0xAB, 0xCF, 0xE7, // BIN 1021: 5 pairs
+  0x11, 0x09, 0xF3, 0x1C, 0x2F, 0x1E, 0x33, 0x28, 0x2B, 0x2B, 0x51, 0x30, 0x5B, 0x33, 0x3B, 0x3E, 0x6C, 0x42, 0x67, 0x4C, 0x6F, 0x5D, 0xA4, 0x7E, 0xAF, 0x7F, 0xB6, 0x82, 0xA3, 0xA4, 0xF6, 0xBA, 0xE8, 0xCD, 0xE7, // BIN 1022: 17 pairs
+  0x0B, 0x00, 0xF1, 0x0C, 0x1F, 0x16, 0x23, 0x18, 0x42, 0x19, 0x42, 0x7D, 0xC8, 0x8B, 0xCF, 0x9B, 0xDA, 0x9E, 0xDC, 0xBD, 0xF4, 0xC8, 0xF4, // BIN 1023: 11 pairs
+  0x11, 0x01, 0xC7, 0x0B, 0xED, 0x11, 0x3C, 0x26, 0x2E, 0x34, 0x54, 0x43, 0x7D, 0x4C, 0x7A, 0x66, 0xA6, 0x67, 0x7B, 0x6D, 0x7E, 0x77, 0xD1, 0x80, 0xB2, 0x89, 0xB1, 0x91, 0xAE, 0xA2, 0xB5, 0xCB, 0xEC, 0xE0, 0xF8, // BIN 1024: 17 pairs
+  0x0E, 0x17, 0x42, 0x1B, 0x49, 0x20, 0xEA, 0x2C, 0x5A, 0x33, 0x5B, 0x3E, 0x68, 0x51, 0x6B, 0x69, 0x94, 0x6B, 0x87, 0x7F, 0xB2, 0x87, 0xB1, 0x9F, 0xD8, 0xC3, 0xF7, 0xD6, 0xE9, // BIN 1025: 14 pairs
+  0x0F, 0x03, 0x4F, 0x11, 0x32, 0x1A, 0xEF, 0x43, 0x84, 0x46, 0x64, 0x56, 0x9C, 0x7B, 0xB8, 0x8B, 0xB7, 0x8E, 0xB6, 0xA5, 0xB5, 0xA7, 0xAB, 0xB4, 0xEA, 0xBE, 0xC1, 0xC1, 0xDD, 0xCA, 0xE7, // BIN 1026: 15 pairs
+  0x0C, 0x11, 0x3B, 0x1E, 0x2A, 0x28, 0x3B, 0x2A, 0x52, 0x2B, 0x70, 0x3C, 0x71, 0x47, 0xF8, 0x64, 0xB3, 0x7A, 0x9F, 0xB6, 0xE2, 0xDC, 0xE8, 0xE4, 0xFE, // BIN 1027: 12 pairs
+  0x09, 0x08, 0x3C, 0x0C, 0xFB, 0x0F, 0x61, 0x1A, 0x46, 0x20, 0x9C, 0x57, 0x8B, 0xA0, 0xD2, 0xA4, 0xDA, 0xC1, 0xED, // BIN 1028: 9 pairs
+  0x06, 0x2C, 0x48, 0x52, 0x77, 0x8E, 0xBC, 0xA4, 0xD8, 0xBB, 0xE8, 0xC1, 0xD7, // BIN 1029: 6 pairs
+  0x11, 0x01, 0x1C, 0x08, 0xB3, 0x0D, 0xE4, 0x37, 0x41, 0x3A, 0x43, 0x43, 0x7A, 0x46, 0x58, 0x71, 0xD1, 0x7D, 0xEA, 0x8C, 0xC2, 0x8D, 0x99, 0x8D, 0x9A, 0x90, 0xF0, 0x90, 0xFF, 0x95, 0xD7, 0xCE, 0xED, 0xD6, 0xE4, // BIN 1030: 17 pairs
+  0x0D, 0x01, 0x3B, 0x02, 0x0D, 0x13, 0xD9, 0x17, 0x30, 0x4A, 0x6C, 0x4E, 0x4F, 0x7F, 0xC8, 0x80, 0xA4, 0x81, 0xD0, 0x8A, 0xBD, 0x8A, 0xC0, 0xA2, 0xDB, 0xB7, 0xE5, // BIN 1031: 13 pairs
+  0x09, 0x12, 0xEF, 0x20, 0x53, 0x20, 0x85, 0x55, 0x75, 0x7D, 0xCA, 0x83, 0xA0, 0x85, 0xD0, 0xBB, 0xCB, 0xCB, 0xCD, // BIN 1032: 9 pairs
+  0x0B, 0x0D, 0xE9, 0x1D, 0x29, 0x24, 0x31, 0x31, 0x57, 0x70, 0x96, 0x7E, 0x84, 0x7F, 0xB4, 0xA0, 0xDF, 0xA1, 0xDF, 0xA1, 0xEA, 0xC1, 0xCA, // BIN 1033: 11 pairs
+  0x0A, 0x0D, 0xB3, 0x3E, 0x5B, 0x51, 0x6F, 0x62, 0x6B, 0x7C, 0x81, 0x7F, 0xCF, 0x8B, 0xB0, 0x8B, 0xB1, 0xA8, 0xE3, 0xE0, 0xFC, // BIN 1034: 10 pairs
+  0x11, 0x0B, 0xFE, 0x0E, 0x35, 0x25, 0x51, 0x26, 0x59, 0x27, 0x38, 0x2C, 0x41, 0x31, 0x5D, 0x40, 0x53, 0x46, 0x6A, 0x63, 0xA1, 0x68, 0xEA, 0x79, 0xAD, 0x93, 0xF8, 0x96, 0xAD, 0xB4, 0xE2, 0xD4, 0xE5, 0xE6, 0xFB, // BIN 1035: 17 pairs
+  0x0F, 0x02, 0x19, 0x16, 0x50, 0x16, 0xFA, 0x17, 0xF0, 0x31, 0x59, 0x34, 0x48, 0x5F, 0xA0, 0x79, 0x96, 0x7F, 0xCD, 0x80, 0xAC, 0x87, 0x8C, 0x93, 0xD5, 0xA6, 0xE0, 0xC1, 0xC8, 0xD1, 0xE2, // BIN 1036: 15 pairs
+  0x0A, 0x03, 0xC0, 0x14, 0x57, 0x15, 0x40, 0x23, 0x4D, 0x44, 0x4B, 0x6A, 0x8E, 0x75, 0xBB, 0x77, 0x87, 0x8D, 0x97, 0xD4, 0xDE, // BIN 1037: 10 pairs
+  0x0F, 0x09, 0x36, 0x3F, 0x5F, 0x4C, 0x7D, 0x5C, 0xFF, 0x70, 0xC7, 0x8D, 0xBA, 0x99, 0xA3, 0x9A, 0xA3, 0xA9, 0xE3, 0xB1, 0xBD, 0xB7, 0xE6, 0xC7, 0xE6, 0xC8, 0xE7, 0xCF, 0xF9, 0xD7, 0xF1, // BIN 1038: 15 pairs
+  0x0C, 0x03, 0x78, 0x05, 0xE9, 0x4C, 0x78, 0x4D, 0x75, 0x4F, 0x82, 0x58, 0x67, 0x70, 0xF0, 0x7B, 0xC3, 0x82, 0xC8, 0x84, 0xB6, 0xA7, 0xE0, 0xCC, 0xF9, // BIN 1039: 12 pairs
+  0x06, 0x07, 0xFD, 0x19, 0x5C, 0x24, 0x64, 0x2C, 0x54, 0x81, 0xAD, 0x87, 0xAE, // BIN 1040: 6 pairs
+  0x08, 0x2B, 0x33, 0x51, 0x64, 0x7C, 0xAD, 0x87, 0xAF, 0xB2, 0xC2, 0xC1, 0xD0, 0xD6, 0xF2, 0xEC, 0xF1, // BIN 1041: 8 pairs
+  0x0A, 0x25, 0x2A, 0x3C, 0x70, 0x64, 0x97, 0x7F, 0xCA, 0x94, 0xD3, 0x99, 0xD8, 0x9A, 0xD8, 0xAF, 0xB8, 0xE1, 0xFD, 0xED, 0xF3, // BIN 1042: 10 pairs
+  0x0C, 0x21, 0xF9, 0x2A, 0x50, 0x40, 0x49, 0x4B, 0x6F, 0x66, 0xAA, 0x8F, 0xD7, 0x9B, 0xDD, 0xA3, 0xDA, 0xA9, 0xE1, 0xB5, 0xE9, 0xCC, 0xE2, 0xEE, 0xFB, // BIN 1043: 12 pairs
+  0x0A, 0x17, 0x2C, 0x2D, 0x43, 0x2D, 0x5B, 0x2E, 0x5A, 0x35, 0x3E, 0x44, 0x62, 0x4C, 0x81, 0xAB, 0xD5, 0xAB, 0xDC, 0xD8, 0xF8, // BIN 1044: 10 pairs
+  0x0A, 0x0F, 0x3E, 0x17, 0x28, 0x56, 0xA4, 0x8B, 0xC4, 0x8F, 0xD3, 0xB4, 0xEB, 0xBA, 0xE2, 0xD3, 0xF3, 0xD6, 0xF3, 0xDC, 0xFD, // BIN 1045: 10 pairs
+  0x0A, 0x07, 0xF2, 0x13, 0x3C, 0x15, 0x3C, 0x16, 0x9E, 0x36, 0x42, 0x50, 0x74, 0x57, 0x62, 0x64, 0xBE, 0x78, 0xBA, 0xA7, 0xEB, // BIN 1046: 10 pairs
+  0x0B, 0x03, 0x6E, 0x05, 0x25, 0x13, 0x88, 0x35, 0x4B, 0x3F, 0x63, 0x6E, 0xBD, 0x87, 0x92, 0x88, 0xD1, 0xA2, 0xD6, 0xA8, 0xCB, 0xAA, 0xEB, // BIN 1047: 11 pairs
+  0x0C, 0x13, 0x97, 0x1B, 0x4D, 0x34, 0x41, 0x44, 0x53, 0x59, 0x80, 0x63, 0x7E, 0x82, 0x87, 0xAB, 0xD0, 0xB4, 0xC2, 0xC0, 0xF4, 0xC2, 0xEE, 0xD5, 0xF9, // BIN 1048: 12 pairs
+  0x08, 0x11, 0x28, 0x1D, 0x58, 0x86, 0xB5, 0x92, 0xB1, 0x98, 0xDA, 0xA2, 0xDD, 0xA9, 0xE4, 0xDE, 0xFA, // BIN 1049: 8 pairs
+  0x0A, 0x04, 0xF5, 0x0F, 0x75, 0x21, 0x7D, 0x3D, 0x49, 0x61, 0x7E, 0x99, 0xDD, 0x9A, 0xDD, 0xA2, 0xA9, 0xB3, 0xBC, 0xBF, 0xC3, // BIN 1050: 10 pairs
+  0x13, 0x16, 0x5C, 0x18, 0x30, 0x1E, 0x5C, 0x30, 0x54, 0x36, 0x6C, 0x3D, 0x3E, 0x3E, 0x40, 0x71, 0x91, 0x78, 0xAE, 0x82, 0xCA, 0x86, 0x87, 0x99, 0xBF, 0x9A, 0xBF, 0x9D, 0xA2, 0xA3, 0xC5, 0xA4, 0xDF, 0xB1, 0xC5, 0xB5, 0xE1, 0xB9, 0xE0, // BIN 1051: 19 pairs
+  0x0E, 0x0C, 0x5F, 0x0F, 0x1F, 0x25, 0x71, 0x3D, 0x53, 0x51, 0x5D, 0x52, 0x55, 0x7D, 0xB6, 0x7E, 0x81, 0x83, 0xAE, 0x85, 0xEA, 0x8B, 0xD0, 0x8F, 0xEA, 0xA8, 0xBC, 0xDD, 0xF5, // BIN 1052: 14 pairs
+  0x0D, 0x28, 0x54, 0x42, 0x6A, 0x43, 0x4E, 0x5F, 0xA1, 0x7C, 0xAE, 0x96, 0xCE, 0x9C, 0xDD, 0xA8, 0xAB, 0xAB, 0xD1, 0xD6, 0xEE, 0xDB, 0xF5, 0xDC, 0xF1, 0xE7, 0xF6, // BIN 1053: 13 pairs
+  0x0F, 0x02, 0x1D, 0x0C, 0xA4, 0x20, 0x45, 0x3E, 0x6D, 0x3F, 0x50, 0x4F, 0x5A, 0x55, 0x78, 0x59, 0x9B, 0x5F, 0x7C, 0x67, 0x8E, 0x75, 0xCC, 0x83, 0x90, 0x95, 0xD5, 0xBB, 0xC1, 0xBC, 0xC0, // BIN 1054: 15 pairs
+  0x0B, 0x09, 0x39, 0x17, 0x58, 0x32, 0x4C, 0x57, 0x9B, 0x79, 0xAE, 0x82, 0xCD, 0x93, 0xA3, 0xA2, 0xCB, 0xCB, 0xCF, 0xD2, 0xF1, 0xEA, 0xF1, // BIN 1055: 11 pairs
+  0x0B, 0x01, 0x58, 0x19, 0x3A, 0x22, 0x36, 0x3B, 0x72, 0x3E, 0x6E, 0x63, 0xA7, 0x83, 0x9B, 0x9E, 0xC2, 0x9F, 0xA4, 0xC5, 0xE8, 0xE2, 0xEB, // BIN 1056: 11 pairs
+  0x0D, 0x06, 0x58, 0x08, 0xD1, 0x0E, 0x2D, 0x20, 0x7F, 0x4A, 0x52, 0x52, 0x53, 0x8C, 0xD9, 0x8E, 0x8F, 0x92, 0xB0, 0x99, 0xDA, 0x9A, 0xDA, 0xA4, 0xDB, 0xB8, 0xEF, // BIN 1057: 13 pairs
+  0x0F, 0x01, 0x24, 0x14, 0x4B, 0x16, 0x32, 0x1B, 0x26, 0x1B, 0x82, 0x22, 0x3E, 0x33, 0x56, 0x3B, 0x5A, 0x61, 0xA0, 0x63, 0x8A, 0x80, 0xB4, 0x82, 0xCF, 0x9D, 0xAE, 0xBF, 0xEB, 0xEF, 0xF2, // BIN 1058: 15 pairs
+  0x07, 0x12, 0x32, 0x14, 0x34, 0x17, 0x34, 0x30, 0x48, 0x4F, 0x5B, 0x51, 0x56, 0x7D, 0x8D, // BIN 1059: 7 pairs
+  0x0C, 0x05, 0xFB, 0x1C, 0x52, 0x21, 0x6E, 0x40, 0x6B, 0x5E, 0xA6, 0x76, 0x94, 0x83, 0xAF, 0x85, 0xAF, 0x92, 0xD5, 0xB0, 0xBD, 0xB2, 0xE2, 0xDB, 0xFC, // BIN 1060: 12 pairs
+  0x0B, 0x03, 0xCF, 0x0A, 0xED, 0x0F, 0xAC, 0x14, 0x30, 0x18, 0x50, 0x48, 0x62, 0x53, 0x75, 0x77, 0xF0, 0x84, 0xB4, 0x9C, 0xD8, 0xAB, 0xCD, // BIN 1061: 11 pairs
+  0x08, 0x14, 0x37, 0x65, 0x90, 0x81, 0xB6, 0x84, 0xB2, 0xA9, 0xAD, 0xB2, 0xEA, 0xBC, 0xCC, 0xE2, 0xF4, // BIN 1062: 8 pairs
+  0x0C, 0x0A, 0xF2, 0x0C, 0x81, 0x0F, 0x9C, 0x1A, 0x64, 0x26, 0x44, 0x4C, 0x84, 0x50, 0x7B, 0x83, 0xB0, 0x8C, 0xEF, 0x91, 0xCB, 0xC1, 0xEC, 0xCB, 0xEE, // BIN 1063: 12 pairs
+  0x0F, 0x0F, 0x4C, 0x12, 0x2D, 0x15, 0x36, 0x19, 0xFD, 0x2B, 0x6B, 0x56, 0x99, 0x56, 0x9A, 0x5C, 0xA8, 0x62, 0x87, 0x73, 0x8A, 0x7A, 0xCF, 0x87, 0xAD, 0x8D, 0xBB, 0x9B, 0xDB, 0xA3, 0xC6, // BIN 1064: 15 pairs
+  0x0D, 0x04, 0xF1, 0x18, 0xEF, 0x40, 0x55, 0x48, 0x82, 0x5E, 0xEA, 0x6B, 0x83, 0x7D, 0x9F, 0x7E, 0xAB, 0x83, 0xA6, 0xC1, 0xD4, 0xC2, 0xD8, 0xC6, 0xE8, 0xD6, 0xEB, // BIN 1065: 13 pairs
+  0x0D, 0x03, 0x39, 0x14, 0x4A, 0x18, 0x2C, 0x19, 0x52, 0x2C, 0x5B, 0x39, 0x42, 0x7A, 0xC8, 0x7D, 0xB2, 0x7E, 0x9C, 0xB0, 0xDC, 0xBE, 0xCB, 0xD0, 0xF9, 0xE0, 0xFB, // BIN 1066: 13 pairs
+  0x0D, 0x00, 0xE4, 0x0C, 0x59, 0x1D, 0xFF, 0x78, 0x8E, 0x7C, 0x9C, 0x83, 0x8F, 0x83, 0xAD, 0x9F, 0xD6, 0xAC, 0xB7, 0xAC, 0xE0, 0xB1, 0xC6, 0xB1, 0xDC, 0xCD, 0xF9, // BIN 1067: 13 pairs
+  0x0C, 0x09, 0x26, 0x38, 0x47, 0x44, 0x55, 0x4A, 0x6F, 0x5F, 0xA7, 0x7A, 0xB6, 0x7A, 0xCD, 0x87, 0xA1, 0x94, 0xD4, 0x97, 0xDC, 0xAA, 0xD6, 0xB9, 0xBF, // BIN 1068: 12 pairs
+  0x08, 0x02, 0xEC, 0x62, 0x69, 0x7D, 0xB4, 0x7D, 0xD0, 0x96, 0xA5, 0x9C, 0xDA, 0xA9, 0xB2, 0xDF, 0xF2, // BIN 1069: 8 pairs
+  0x09, 0x0B, 0xB3, 0x17, 0xFA, 0x1E, 0x1F, 0x30, 0x41, 0x56, 0x79, 0x62, 0x78, 0x6C, 0xC9, 0x7A, 0xAE, 0xAB, 0xC0, // BIN 1070: 9 pairs
+  0x05, 0x03, 0x9B, 0x18, 0x28, 0x66, 0x7C, 0xB6, 0xE8, 0xE5, 0xFB, // BIN 1071: 5 pairs
+  0x05, 0x09, 0x48, 0x1A, 0x30, 0x21, 0x2C, 0x36, 0x6D, 0x4C, 0x7F, // BIN 1072: 5 pairs
+  0x0C, 0x05, 0x27, 0x0A, 0x13, 0x18, 0xFA, 0x31, 0x5A, 0x51, 0x74, 0x55, 0x65, 0x5E, 0xAA, 0x61, 0x8A, 0x7A, 0xB2, 0x84, 0xD4, 0x96, 0xD1, 0xC2, 0xE0, // BIN 1073: 12 pairs
+  0x0A, 0x13, 0xC3, 0x4E, 0x58, 0x61, 0xA1, 0x76, 0xA9, 0x78, 0xB2, 0x7D, 0xAE, 0x91, 0xC7, 0xB0, 0xD9, 0xBB, 0xF8, 0xDF, 0xFB, // BIN 1074: 10 pairs
+  0x0D, 0x03, 0x82, 0x04, 0x1F, 0x05, 0x24, 0x0C, 0x4F, 0x14, 0x23, 0x17, 0x1F, 0x26, 0x5D, 0x35, 0x49, 0x4A, 0x6D, 0x91, 0xAD, 0xA4, 0xF9, 0xB0, 0xC5, 0xDC, 0xE0, // BIN 1075: 13 pairs
+  0x0E, 0x0A, 0x2E, 0x1B, 0xF4, 0x4A, 0x68, 0x5E, 0x79, 0x5E, 0xC9, 0x5F, 0xBD, 0x66, 0x8A, 0x78, 0xCC, 0x7A, 0xCA, 0xA2, 0xDF, 0xAC, 0xF9, 0xC1, 0xCD, 0xC5, 0xD6, 0xDE, 0xE1, // BIN 1076: 14 pairs
+  0x0B, 0x02, 0x1A, 0x0C, 0x6D, 0x14, 0x5E, 0x24, 0x60, 0x2A, 0x56, 0x39, 0x6E, 0x40, 0x4D, 0x6E, 0x83, 0x93, 0xEB, 0xA3, 0xC3, 0xB6, 0xC2, // BIN 1077: 11 pairs
+  0x0B, 0x0D, 0x64, 0x18, 0x34, 0x41, 0xA4, 0x43, 0x78, 0x6B, 0x96, 0x71, 0x96, 0x9F, 0xC2, 0xD0, 0xDE, 0xD0, 0xE6, 0xDC, 0xFF, 0xE2, 0xFA, // BIN 1078: 11 pairs
+  0x09, 0x07, 0x0A, 0x0E, 0x28, 0x1F, 0x4F, 0x58, 0x74, 0x7F, 0xAF, 0x98, 0xDD, 0xAA, 0xBC, 0xB1, 0xD9, 0xB1, 0xE5, // BIN 1079: 9 pairs
+  0x0A, 0x06, 0xD1, 0x0E, 0x32, 0x20, 0xAC, 0x22, 0x4A, 0x23, 0x53, 0x42, 0x6B, 0x57, 0x79, 0x7A, 0xB4, 0x80, 0xB6, 0xD8, 0xF9, // BIN 1080: 10 pairs
+  0x09, 0x11, 0xF7, 0x14, 0x45, 0x15, 0x3F, 0x20, 0x55, 0x67, 0x8D, 0x68, 0x8A, 0x71, 0xEF, 0xB7, 0xE7, 0xD4, 0xF1, // BIN 1081: 9 pairs
+  0x09, 0x01, 0xD9, 0x06, 0xB3, 0x0F, 0x7D, 0x17, 0x50, 0x2A, 0x3B, 0x43, 0x7F, 0x68, 0x6F, 0x79, 0xA4, 0xDE, 0xEF, // BIN 1082: 9 pairs
+  0x0A, 0x16, 0x64, 0x27, 0x71, 0x78, 0xB6, 0x7C, 0xAF, 0x83, 0xB1, 0x87, 0xA0, 0x96, 0xB2, 0xA3, 0xDB, 0xAD, 0xC2, 0xAF, 0xE2, // BIN 1083: 10 pairs
+  0x0E, 0x0A, 0x3B, 0x14, 0x56, 0x15, 0x42, 0x17, 0x37, 0x19, 0x64, 0x2A, 0x2B, 0x38, 0x62, 0x3D, 0x55, 0x44, 0x49, 0x56, 0x5B, 0x7B, 0x87, 0x81, 0xB4, 0x84, 0xAE, 0xB2, 0xEB, // BIN 1084: 14 pairs
+  0x0C, 0x0C, 0x84, 0x0D, 0x5C, 0x12, 0x13, 0x2E, 0x5B, 0x42, 0x4C, 0x51, 0x73, 0x6A, 0x80, 0x7D, 0xF8, 0x7F, 0xD0, 0x81, 0xD4, 0x86, 0xEF, 0xD3, 0xF1, // BIN 1085: 12 pairs
+  0x0E, 0x03, 0x36, 0x0D, 0xED, 0x0F, 0x2F, 0x1B, 0x4B, 0x49, 0x6F, 0x54, 0x79, 0x62, 0x6C, 0x68, 0x94, 0x76, 0x9F, 0x7E, 0xB2, 0x81, 0xB2, 0x9B, 0xDF, 0x9E, 0xB5, 0xAA, 0xCE, // BIN 1086: 14 pairs
+  0x10, 0x03, 0xCD, 0x06, 0x3C, 0x08, 0x2E, 0x12, 0x3D, 0x14, 0x4D, 0x35, 0x64, 0x3A, 0x60, 0x56, 0x5A, 0x58, 0x5A, 0x63, 0xBD, 0x67, 0x86, 0x8A, 0x9D, 0x96, 0xBE, 0xB8, 0xF0, 0xBB, 0xE2, 0xCC, 0xE7, // BIN 1087: 16 pairs
+  0x04, 0x24, 0x2F, 0x3D, 0x4D, 0x78, 0xB4, 0x89, 0xB8, // BIN 1088: 4 pairs
+  0x04, 0x25, 0x38, 0x68, 0xC0, 0xA3, 0xAC, 0xE6, 0xF4, // BIN 1089: 4 pairs
+  0x0F, 0x02, 0x1E, 0x08, 0xC7, 0x11, 0x2C, 0x29, 0x3C, 0x40, 0x67, 0x48, 0xA4, 0x66, 0xF8, 0x6F, 0x98, 0x7E, 0x9D, 0x97, 0x9F, 0x9D, 0xDC, 0x9F, 0xB8, 0xAB, 0xCF, 0xC1, 0xE8, 0xC9, 0xCE, // BIN 1090: 15 pairs
+  0x0B, 0x05, 0x2B, 0x0D, 0xEE, 0x3B, 0x5B, 0x3B, 0x77, 0x3D, 0x6B, 0x6B, 0xB3, 0x79, 0xAF, 0x89, 0xAF, 0x94, 0x9D, 0xB0, 0xC6, 0xE5, 0xEF, // BIN 1091: 11 pairs
+  0x12, 0x0D, 0x22, 0x16, 0xA5, 0x1B, 0xC9, 0x1D, 0x4E, 0x59, 0x7C, 0x6E, 0xA2, 0x77, 0xB8, 0x8E, 0xB8, 0x90, 0xC1, 0x98, 0xDB, 0x98, 0xEA, 0x99, 0xDB, 0x9A, 0xDB, 0xB0, 0xE5, 0xB7, 0xE8, 0xC6, 0xD6, 0xD1, 0xD6, 0xD3, 0xF9, // BIN 1092: 18 pairs
+  0x09, 0x03, 0x92, 0x1C, 0x4E, 0x20, 0x93, 0x38, 0x3B, 0x55, 0x6A, 0x8B, 0xAB, 0xB1, 0xE6, 0xC7, 0xE2, 0xDB, 0xF2, // BIN 1093: 9 pairs
+  0x0C, 0x03, 0xD4, 0x0E, 0xF7, 0x17, 0xEF, 0x52, 0x7B, 0x6D, 0xC0, 0x8A, 0xBF, 0x8B, 0xBF, 0x99, 0xB7, 0x9A, 0xB7, 0xA6, 0xBC, 0xBC, 0xE9, 0xDD, 0xFB, // BIN 1094: 12 pairs
+  0x08, 0x0C, 0x3E, 0x25, 0x70, 0x5B, 0x7C, 0x60, 0x6F, 0x67, 0x91, 0x75, 0xEA, 0x8D, 0xBF, 0xA9, 0xB4, // BIN 1095: 8 pairs
+  0x0A, 0x18, 0x46, 0x1A, 0x34, 0x21, 0x37, 0x5D, 0x8A, 0x6B, 0x9D, 0x75, 0xBA, 0x91, 0x95, 0xA6, 0xEB, 0xC2, 0xEF, 0xDA, 0xFC, // BIN 1096: 10 pairs
+  0x0D, 0x12, 0x1F, 0x17, 0x46, 0x1A, 0x2C, 0x2A, 0x5A, 0x38, 0x5D, 0x3C, 0xFF, 0x41, 0x9C, 0x5E, 0x80, 0x61, 0xA7, 0x91, 0xA5, 0x99, 0xDF, 0x9A, 0xDF, 0xD2, 0xEA, // BIN 1097: 13 pairs
+  0x0C, 0x40, 0x62, 0x43, 0x85, 0x46, 0x6B, 0x55, 0x7A, 0x98, 0xD2, 0xB5, 0xD8, 0xB7, 0xDC, 0xBF, 0xDC, 0xD0, 0xE5, 0xDA, 0xF5, 0xDB, 0xE3, 0xE5, 0xF7, // BIN 1098: 12 pairs
+  0x0E, 0x03, 0xA7, 0x19, 0xE1, 0x1E, 0xF0, 0x21, 0x7A, 0x3C, 0x45, 0x40, 0x6A, 0x48, 0x9C, 0x58, 0x5B, 0x89, 0xA8, 0x8F, 0xD5, 0x97, 0xCE, 0xB4, 0xE8, 0xBF, 0xEA, 0xDC, 0xF5, // BIN 1099: 14 pairs
+  0x0B, 0x0B, 0x71, 0x1D, 0x31, 0x2B, 0xF0, 0x32, 0x43, 0x3A, 0x4F, 0x60, 0x9E, 0x66, 0xC9, 0x79, 0xAC, 0x8A, 0xC4, 0x94, 0xBC, 0xE8, 0xE9, // BIN 1100: 11 pairs
+  0x12, 0x0E, 0x3C, 0x11, 0x30, 0x16, 0x2D, 0x19, 0x46, 0x19, 0xFA, 0x24, 0x3F, 0x48, 0x93, 0x4C, 0x85, 0x78, 0x87, 0x87, 0xB5, 0x89, 0xAE, 0x9C, 0xDB, 0x9C, 0xDF, 0xA5, 0xE3, 0xC1, 0xCF, 0xE2, 0xFB, 0xE3, 0xF3, 0xE4, 0xF5, // BIN 1101: 18 pairs
+  0x10, 0x0C, 0x69, 0x49, 0x75, 0x4B, 0x52, 0x69, 0xC9, 0x6A, 0x8D, 0x6E, 0xC6, 0x6F, 0x84, 0x71, 0x89, 0x72, 0xA9, 0x80, 0xAB, 0x82, 0xD0, 0x8A, 0xC5, 0x94, 0xD7, 0xAB, 0xDA, 0xAE, 0xB8, 0xF4, 0xFE, // BIN 1102: 16 pairs
+  0x0A, 0x18, 0x37, 0x1B, 0x2F, 0x2F, 0x61, 0x5F, 0x7E, 0x65, 0x7C, 0x7E, 0x88, 0x8A, 0xC8, 0x96, 0x9E, 0x9C, 0xBF, 0xAB, 0xE2, // BIN 1103: 10 pairs
+  0x0B, 0x10, 0x3D, 0x22, 0x39, 0x29, 0x57, 0x35, 0x36, 0x53, 0x78, 0x55, 0x79, 0x6A, 0x96, 0x70, 0xD1, 0x87, 0xA6, 0x9F, 0xDA, 0xC0, 0xE2, // BIN 1104: 11 pairs
+  0x0D, 0x0A, 0xE9, 0x0E, 0x3B, 0x1E, 0xF7, 0x41, 0x82, 0x44, 0x4D, 0x44, 0x70, 0x5F, 0x8A, 0x6D, 0xF8, 0x85, 0xD4, 0x8A, 0xC6, 0x8E, 0xBF, 0xA5, 0xED, 0xE2, 0xFE, // BIN 1105: 13 pairs
+  0x09, 0x0C, 0x2F, 0x0F, 0xC6, 0x16, 0x71, 0x21, 0x34, 0x3A, 0x62, 0x60, 0x89, 0xA6, 0xD6, 0xB4, 0xDE, 0xBF, 0xE3, // BIN 1106: 9 pairs
+  0x0D, 0x0B, 0x22, 0x16, 0x42, 0x1F, 0x53, 0x20, 0x2A, 0x20, 0x99, 0x20, 0x9A, 0x31, 0x5B, 0x56, 0x92, 0x8A, 0xB9, 0x96, 0xBF, 0xB0, 0xE6, 0xB3, 0xEE, 0xCA, 0xDE, // BIN 1107: 13 pairs
+  0x0E, 0x05, 0x22, 0x0C, 0x56, 0x0D, 0x70, 0x20, 0x38, 0x24, 0xFF, 0x31, 0x3C, 0x3C, 0x3F, 0x66, 0x94, 0x72, 0x8E, 0x75, 0x8D, 0x81, 0xAE, 0x8A, 0xC9, 0x94, 0xD5, 0xF1, 0xF8, // BIN 1108: 14 pairs
+  0x0A, 0x3E, 0x44, 0x78, 0xAF, 0x8D, 0x9C, 0x9D, 0xBF, 0xB6, 0xDE, 0xBE, 0xDE, 0xC3, 0xE7, 0xC3, 0xFF, 0xD8, 0xE3, 0xD9, 0xFD, // BIN 1109: 10 pairs
+  0x06, 0x03, 0x5D, 0x21, 0xA4, 0x3B, 0x7B, 0x5B, 0x79, 0x8F, 0xB7, 0xCE, 0xEE, // BIN 1110: 6 pairs
+  0x13, 0x0C, 0x63, 0x0D, 0xD1, 0x24, 0x26, 0x41, 0x93, 0x59, 0x98, 0x5E, 0x6F, 0x5F, 0xC6, 0x6F, 0x81, 0x7B, 0xEF, 0x81, 0xEB, 0x8C, 0x8E, 0x8F, 0xBF, 0x92, 0xEA, 0x95, 0x96, 0x9B, 0xAB, 0xAB, 0xB3, 0xAB, 0xD7, 0xCB, 0xCC, 0xDD, 0xF2, // BIN 1111: 19 pairs
+  0x07, 0x08, 0x71, 0x37, 0x56, 0x63, 0xA6, 0x6E, 0xC5, 0x76, 0x8B, 0xAF, 0xDE, 0xBD, 0xD6, // BIN 1112: 7 pairs
+  0x0D, 0x11, 0x2A, 0x18, 0x1F, 0x54, 0x8F, 0x66, 0x7E, 0x68, 0x7C, 0x83, 0xAA, 0x84, 0xEB, 0x88, 0xC2, 0x8B, 0x91, 0xA6, 0xCE, 0xAB, 0xCC, 0xC0, 0xF9, 0xD1, 0xFA, // BIN 1113: 13 pairs
+  0x08, 0x0C, 0x6C, 0x10, 0xEC, 0x15, 0x46, 0x2F, 0x5F, 0x7F, 0x83, 0x84, 0x9F, 0xAD, 0xEA, 0xB3, 0xDE, // BIN 1114: 8 pairs
+  0x0B, 0x02, 0xE9, 0x13, 0x60, 0x29, 0x59, 0x2F, 0x5A, 0x4E, 0x6F, 0x5D, 0x95, 0x77, 0xC3, 0x8A, 0xCA, 0x93, 0xBF, 0xC8, 0xDE, 0xD2, 0xF3, // BIN 1115: 11 pairs
+  0x0B, 0x01, 0xA8, 0x0A, 0xF5, 0x0B, 0xD1, 0x17, 0x2A, 0x1E, 0x38, 0x23, 0x43, 0x28, 0x5A, 0x5D, 0x9B, 0x75, 0xF8, 0x7A, 0xEA, 0xA4, 0xBF, // BIN 1116: 11 pairs
+  0x08, 0x04, 0x47, 0x19, 0x9E, 0x21, 0xB9, 0x4E, 0x74, 0x59, 0x95, 0x86, 0xC2, 0x87, 0x9B, 0xBC, 0xE8, // BIN 1117: 8 pairs
+  0x0F, 0x01, 0xE3, 0x03, 0xD0, 0x09, 0x43, 0x10, 0xE1, 0x1F, 0x44, 0x23, 0x4C, 0x3A, 0x54, 0x46, 0x54, 0x7A, 0xD0, 0x83, 0xA7, 0x8D, 0xB5, 0x9B, 0xD2, 0x9C, 0xA3, 0xCA, 0xF9, 0xDF, 0xE3, // BIN 1118: 15 pairs
+  0x09, 0x13, 0xED, 0x1A, 0x37, 0x31, 0x52, 0x75, 0xAD, 0x7F, 0xEA, 0x96, 0xB4, 0xB5, 0xBA, 0xB5, 0xEC, 0xE7, 0xEA, // BIN 1119: 9 pairs
+  0x0E, 0x06, 0xC7, 0x12, 0x40, 0x21, 0x30, 0x35, 0x53, 0x4E, 0x73, 0x77, 0x83, 0x8C, 0xAB, 0x98, 0xDF, 0xA1, 0xE0, 0xC0, 0xCB, 0xD0, 0xF3, 0xDA, 0xE3, 0xE4, 0xF1, 0xE6, 0xEF, // BIN 1120: 14 pairs
+  0x0D, 0x0F, 0xC5, 0x0F, 0xFB, 0x15, 0x39, 0x1A, 0x28, 0x25, 0xF0, 0x4D, 0x78, 0x54, 0x93, 0x6D, 0xEA, 0x70, 0xA9, 0x90, 0xBC, 0x95, 0xD8, 0x9D, 0xAD, 0xCA, 0xE6, // BIN 1121: 13 pairs
+  0x0D, 0x09, 0x5E, 0x0F, 0x54, 0x27, 0x70, 0x2B, 0x38, 0x39, 0x62, 0x43, 0x46, 0x57, 0x98, 0x7E, 0xB4, 0x80, 0xBB, 0x9F, 0xB9, 0xAB, 0xD4, 0xD6, 0xF5, 0xE6, 0xF7, // BIN 1122: 13 pairs
+  0x11, 0x01, 0xDC, 0x03, 0x54, 0x0D, 0xA8, 0x10, 0x32, 0x24, 0x45, 0x3A, 0x5C, 0x6F, 0x93, 0x75, 0xCF, 0x80, 0xBA, 0x8A, 0xCC, 0x90, 0xEF, 0x9C, 0xF6, 0xA0, 0xE0, 0xA2, 0xE0, 0xB2, 0xDE, 0xCE, 0xEC, 0xDE, 0xF7, // BIN 1123: 17 pairs
+  0x0E, 0x0D, 0x35, 0x13, 0x24, 0x16, 0x52, 0x1E, 0x4E, 0x1E, 0x64, 0x44, 0x72, 0x47, 0x92, 0x4A, 0x50, 0x4B, 0x75, 0x53, 0x65, 0x71, 0xA9, 0xC2, 0xDA, 0xC7, 0xD6, 0xC8, 0xF9, // BIN 1124: 14 pairs
+  0x09, 0x07, 0xFA, 0x15, 0x3B, 0x1F, 0x4E, 0x21, 0xF6, 0x44, 0x71, 0x5B, 0x70, 0x5F, 0xC5, 0x91, 0x9E, 0xAE, 0xE2, // BIN 1125: 9 pairs
+  0x09, 0x01, 0xF2, 0x0E, 0x2C, 0x51, 0x58, 0x56, 0x8B, 0x63, 0xC6, 0x93, 0xD8, 0xA3, 0xDD, 0xBD, 0xE8, 0xCD, 0xDE, // BIN 1126: 9 pairs
+  0x0C, 0x02, 0xEF, 0x06, 0x2E, 0x14, 0x54, 0x14, 0x59, 0x1A, 0xFD, 0x29, 0x5D, 0x57, 0x80, 0x58, 0xEF, 0x84, 0xD7, 0x9D, 0xE1, 0xBC, 0xBE, 0xDB, 0xFB, // BIN 1127: 12 pairs
+  0x07, 0x11, 0x34, 0x2A, 0x47, 0x3D, 0x67, 0x4E, 0x56, 0x5F, 0xA6, 0x8E, 0xC1, 0xCD, 0xE6, // BIN 1128: 7 pairs
+  0x09, 0x0C, 0x61, 0x0C, 0xAC, 0x1B, 0x4A, 0x4D, 0x7A, 0x63, 0x94, 0x68, 0xCC, 0x88, 0xE1, 0x97, 0xE4, 0xBB, 0xF6, // BIN 1129: 9 pairs
+  0x0A, 0x11, 0x3D, 0x25, 0x6B, 0x3D, 0x62, 0x62, 0x66, 0x78, 0xC8, 0x7A, 0xAF, 0x7E, 0xB0, 0x86, 0xD9, 0xE5, 0xF4, 0xE8, 0xFA, // BIN 1130: 10 pairs
+  0x0A, 0x0D, 0xFE, 0x1C, 0x3F, 0x35, 0x4D, 0x4E, 0x5D, 0x75, 0xCD, 0x78, 0xA3, 0x80, 0xB0, 0xA8, 0xED, 0xC2, 0xD3, 0xC2, 0xDB, // BIN 1131: 10 pairs
+  0x08, 0x00, 0xF3, 0x0D, 0xC7, 0x5A, 0x70, 0x85, 0xF8, 0x91, 0xB2, 0xC1, 0xE1, 0xC8, 0xE6, 0xE7, 0xF9, // BIN 1132: 8 pairs
+  0x0E, 0x03, 0x4C, 0x03, 0xC8, 0x03, 0xD7, 0x17, 0x33, 0x22, 0x4B, 0x6F, 0x9B, 0x7C, 0x88, 0x8D, 0xBC, 0x8E, 0xBA, 0x9B, 0xEB, 0xAB, 0xDB, 0xB1, 0xE3, 0xB7, 0xD9, 0xCF, 0xE6, // BIN 1133: 14 pairs
+  0x09, 0x03, 0xCA, 0x10, 0x40, 0x36, 0x6E, 0x3B, 0x9E, 0x50, 0x55, 0x5D, 0xAC, 0x6D, 0xA2, 0x89, 0xAD, 0xC1, 0xEE, // BIN 1134: 9 pairs
+  0x0D, 0x07, 0x12, 0x0F, 0x29, 0x21, 0x85, 0x3D, 0x6A, 0x55, 0x7F, 0x61, 0xBD, 0x75, 0xC8, 0x7C, 0xAB, 0x7D, 0xAF, 0x7D, 0xD4, 0xA0, 0xEB, 0xB5, 0xD3, 0xCF, 0xF3, // BIN 1135: 13 pairs
+  0x0E, 0x0A, 0x3C, 0x1B, 0xFC, 0x20, 0x78, 0x2A, 0x5B, 0x34, 0x56, 0x37, 0x62, 0x3C, 0x72, 0x48, 0x51, 0x53, 0x7A, 0x65, 0x7E, 0x76, 0xA3, 0x79, 0xB2, 0xB0, 0xE3, 0xDA, 0xF2, // BIN 1136: 14 pairs
+  0x0E, 0x08, 0xA8, 0x11, 0x3A, 0x1D, 0x26, 0x32, 0x60, 0x50, 0x53, 0x5A, 0x7C, 0x62, 0x89, 0x87, 0xB7, 0x91, 0xBE, 0x93, 0xDD, 0xA9, 0xB6, 0xB2, 0xE8, 0xDE, 0xFD, 0xE3, 0xFF, // BIN 1137: 14 pairs
+  0x0B, 0x09, 0x15, 0x0C, 0x4C, 0x10, 0x58, 0x11, 0xFF, 0x2F, 0x63, 0x35, 0x65, 0x97, 0xB7, 0xA3, 0xDF, 0xBA, 0xF8, 0xC2, 0xD5, 0xCF, 0xDE, // BIN 1138: 11 pairs
+  0x0F, 0x07, 0x21, 0x19, 0x71, 0x1F, 0x27, 0x27, 0x6B, 0x31, 0x61, 0x35, 0x39, 0x38, 0x59, 0x39, 0x75, 0x5B, 0x83, 0x63, 0xAA, 0x63, 0xC5, 0x6A, 0x97, 0xAC, 0xF4, 0xB7, 0xE3, 0xCA, 0xE5, // BIN 1139: 15 pairs
+  0x09, 0x0E, 0x2A, 0x1B, 0x92, 0x2D, 0x4F, 0x41, 0xB9, 0x5C, 0x62, 0x80, 0xB1, 0x81, 0xD7, 0x83, 0x8C, 0xA3, 0xE0, // BIN 1140: 9 pairs
+  0x0D, 0x10, 0x2D, 0x18, 0x2A, 0x18, 0x52, 0x22, 0x49, 0x45, 0x66, 0x46, 0x4F, 0x5D, 0x67, 0x62, 0x82, 0x78, 0xCA, 0x81, 0x9F, 0x92, 0xD8, 0xD7, 0xFC, 0xF2, 0xF6, // BIN 1141: 13 pairs
+  0x14, 0x0A, 0xE1, 0x0E, 0x30, 0x15, 0x44, 0x19, 0x30, 0x1A, 0x71, 0x1F, 0x47, 0x26, 0x61, 0x32, 0x5C, 0x55, 0x7D, 0x56, 0x80, 0x62, 0x8A, 0x6C, 0xC0, 0x6D, 0xBB, 0x78, 0xCD, 0x78, 0xCF, 0x7C, 0xB2, 0x8C, 0xE4, 0x90, 0xE4, 0xB5, 0xED, 0xE6, 0xEB, // BIN 1142: 20 pairs
+  0x0A, 0x0C, 0x9C, 0x26, 0x5F, 0x36, 0x3D, 0x4F, 0x93, 0x6B, 0xBE, 0x6F, 0x91, 0x7E, 0xB1, 0x86, 0x8E, 0x93, 0xDA, 0x9E, 0xED, // BIN 1143: 10 pairs
+  0x06, 0x00, 0xE1, 0x09, 0xB9, 0x0C, 0x29, 0x4D, 0x67, 0x66, 0xEA, 0x75, 0xCA, // BIN 1144: 6 pairs
+  0x0C, 0x03, 0xA0, 0x0B, 0xC7, 0x0F, 0xBD, 0x1D, 0x2F, 0x6D, 0xCC, 0x84, 0xAF, 0x89, 0x98, 0x93, 0xB7, 0x94, 0xD2, 0xA7, 0xD6, 0xB8, 0xEE, 0xF0, 0xFE, // BIN 1145: 12 pairs
+  0x0B, 0x04, 0x41, 0x07, 0x20, 0x0F, 0x99, 0x0F, 0x9A, 0x2B, 0x9E, 0x2C, 0x56, 0x62, 0x6D, 0x84, 0x8D, 0xA1, 0xEB, 0xD6, 0xEC, 0xE1, 0xE5, // BIN 1146: 11 pairs
+  0x10, 0x0E, 0xFB, 0x0F, 0x31, 0x17, 0xFE, 0x28, 0x56, 0x2E, 0x4A, 0x48, 0x8F, 0x57, 0x95, 0x59, 0x7E, 0x67, 0x8C, 0x8A, 0xCD, 0x8B, 0x96, 0x9F, 0xDB, 0xAB, 0xE0, 0xB2, 0xB8, 0xCB, 0xE1, 0xCD, 0xE5, // BIN 1147: 16 pairs
+  0x0A, 0x13, 0x1D, 0x14, 0xF4, 0x23, 0x55, 0x2F, 0x5B, 0x5C, 0xB3, 0x68, 0x7E, 0x7C, 0x9D, 0x7F, 0xA3, 0x91, 0xD1, 0xB8, 0xC4, // BIN 1148: 10 pairs
+  0x0C, 0x0C, 0x75, 0x16, 0x3A, 0x27, 0x29, 0x58, 0x97, 0x5D, 0x98, 0x7E, 0xB6, 0x80, 0xBD, 0x83, 0x86, 0x87, 0xAA, 0x91, 0xCE, 0x94, 0xA9, 0xC8, 0xE5, // BIN 1149: 12 pairs
+  0x0A, 0x0C, 0xC6, 0x29, 0x5A, 0x36, 0x40, 0x3A, 0x65, 0x41, 0x62, 0x60, 0xA5, 0x7A, 0x83, 0x85, 0xA3, 0x8D, 0xC4, 0x9D, 0xB2, // BIN 1150: 10 pairs
+  0x10, 0x01, 0x3C, 0x02, 0x04, 0x14, 0x2D, 0x21, 0x7F, 0x29, 0x52, 0x33, 0x62, 0x43, 0x5A, 0x4C, 0x82, 0x4D, 0x52, 0x5A, 0x79, 0x5B, 0x7E, 0x6C, 0xA2, 0x87, 0xB2, 0x89, 0xB7, 0xBA, 0xE7, 0xE2, 0xFD, // BIN 1151: 16 pairs
+  0x0C, 0x13, 0xDC, 0x2B, 0x65, 0x33, 0x47, 0x38, 0x57, 0x57, 0xBD, 0x5F, 0xAA, 0x70, 0x87, 0x87, 0x8F, 0xAB, 0xE3, 0xC0, 0xC1, 0xC1, 0xCC, 0xCD, 0xF3, // BIN 1152: 12 pairs
+  0x0C, 0x05, 0xE4, 0x07, 0xEB, 0x31, 0x50, 0x31, 0x5F, 0x31, 0x62, 0x45, 0x5E, 0x4D, 0x7D, 0x61, 0xA6, 0x68, 0xBB, 0xAD, 0xEB, 0xB5, 0xE0, 0xBC, 0xED, // BIN 1153: 12 pairs
+  0x0B, 0x0F, 0x49, 0x18, 0x33, 0x1A, 0x9E, 0x2E, 0x65, 0x41, 0xF8, 0x4A, 0x67, 0x61, 0x94, 0x6F, 0x9F, 0xCF, 0xE5, 0xD4, 0xFC, 0xFC, 0xFD, // BIN 1154: 11 pairs
+  0x0C, 0x05, 0xF1, 0x06, 0xF2, 0x0A, 0x23, 0x11, 0x37, 0x14, 0xFB, 0x52, 0x76, 0x53, 0x6A, 0x64, 0xF0, 0x72, 0xFF, 0x75, 0x9F, 0x9E, 0xE3, 0xDE, 0xFE, // BIN 1155: 12 pairs
+  0x0A, 0x0D, 0x7B, 0x45, 0x67, 0x48, 0x99, 0x48, 0x9A, 0x59, 0xA0, 0x64, 0xE1, 0xA9, 0xC4, 0xAD, 0xE2, 0xB5, 0xD5, 0xCE, 0xF1, // BIN 1156: 10 pairs
+  0x0C, 0x03, 0xBB, 0x1B, 0x9B, 0x28, 0x5B, 0x3F, 0x5E, 0x56, 0xB9, 0x5D, 0xB9, 0x65, 0x91, 0x7B, 0xB5, 0x85, 0xC4, 0x89, 0xBC, 0x8B, 0xD4, 0xBA, 0xDE, // BIN 1157: 12 pairs
+  0x0A, 0x13, 0x50, 0x3F, 0x66, 0x4F, 0x8F, 0x55, 0x7C, 0x57, 0xA0, 0x62, 0x72, 0x7F, 0x8E, 0x88, 0xA3, 0x9C, 0xB7, 0xC2, 0xF0, // BIN 1158: 10 pairs
+  0x06, 0x0F, 0x85, 0x12, 0x28, 0x36, 0x62, 0x5C, 0xBE, 0x85, 0xD7, 0xBB, 0xF4, // BIN 1159: 6 pairs
+  0x0F, 0x03, 0xAA, 0x0F, 0x7A, 0x17, 0x52, 0x1A, 0xE1, 0x1F, 0x51, 0x34, 0x62, 0x41, 0x99, 0x41, 0x9A, 0x55, 0x82, 0x56, 0x7C, 0x6B, 0x6F, 0x6C, 0xF8, 0x83, 0xB2, 0xAC, 0xD2, 0xDC, 0xFE, // BIN 1160: 15 pairs
+  0x06, 0x0F, 0x93, 0x10, 0xEE, 0x16, 0xEC, 0x45, 0x69, 0x49, 0x52, 0x94, 0xD8, // BIN 1161: 6 pairs
+  0x07, 0x21, 0x9C, 0x54, 0x9C, 0x57, 0xF8, 0x65, 0x79, 0x7F, 0xD4, 0xB4, 0xB8, 0xBF, 0xD9, // BIN 1162: 7 pairs
+  0x09, 0x1D, 0x5C, 0x30, 0x56, 0x43, 0x5B, 0x4B, 0x67, 0x77, 0x8E, 0xA1, 0xBC, 0xA7, 0xBC, 0xAE, 0xDE, 0xD8, 0xF5, // BIN 1163: 9 pairs
+  0x0E, 0x18, 0xFE, 0x1B, 0x31, 0x1F, 0x3C, 0x20, 0x28, 0x76, 0xAB, 0x84, 0xD3, 0x87, 0xA7, 0x8A, 0xCF, 0xB6, 0xE7, 0xC0, 0xE7, 0xC4, 0xF4, 0xDD, 0xE3, 0xE8, 0xFD, 0xF2, 0xF9, // BIN 1164: 14 pairs
+  0x0D, 0x03, 0xA1, 0x0C, 0xC5, 0x19, 0x2C, 0x1B, 0x53, 0x35, 0x55, 0x45, 0x6E, 0x48, 0xB9, 0x58, 0x76, 0x83, 0x85, 0x96, 0xB6, 0xA7, 0xF8, 0xB0, 0xC7, 0xB1, 0xE7, // BIN 1165: 13 pairs
+  0x07, 0x04, 0x15, 0x15, 0x3E, 0x19, 0xA5, 0x67, 0x90, 0x90, 0xDC, 0xAE, 0xEA, 0xB5, 0xE7, // BIN 1166: 7 pairs
+  0x0D, 0x0C, 0x31, 0x11, 0x40, 0x14, 0x5F, 0x19, 0x34, 0x45, 0x6F, 0x4F, 0x9C, 0x54, 0x7C, 0x5F, 0x94, 0x67, 0x8A, 0x75, 0xB6, 0x8B, 0xD3, 0x8D, 0xC0, 0xC9, 0xE2, // BIN 1167: 13 pairs
+  0x0A, 0x01, 0x71, 0x09, 0x2F, 0x0B, 0x35, 0x0E, 0x34, 0x12, 0x3A, 0x14, 0x68, 0x1A, 0xFA, 0x2F, 0x3C, 0x69, 0xF8, 0xED, 0xFB, // BIN 1168: 10 pairs
+  0x11, 0x05, 0x13, 0x16, 0xBE, 0x20, 0x33, 0x20, 0xEB, 0x56, 0xAC, 0x5C, 0x97, 0x62, 0x8D, 0x79, 0xB4, 0x7C, 0xA4, 0x7E, 0xA4, 0x81, 0x8D, 0x81, 0xAF, 0x8F, 0xB1, 0x91, 0xB4, 0xA7, 0xCE, 0xB7, 0xB9, 0xDA, 0xFB, // BIN 1169: 17 pairs
+  0x09, 0x3B, 0xF0, 0x3E, 0x75, 0x41, 0x8F, 0x54, 0x80, 0x60, 0x87, 0x73, 0xA8, 0x7E, 0xAC, 0xB5, 0xDA, 0xF5, 0xF7, // BIN 1170: 9 pairs
+  0x0C, 0x05, 0xE1, 0x0B, 0xA8, 0x39, 0x3D, 0x3C, 0x6A, 0x50, 0x86, 0x5E, 0x8A, 0x64, 0x89, 0x82, 0xC4, 0x8D, 0xAC, 0xA4, 0xF4, 0xAD, 0xB8, 0xD8, 0xDC, // BIN 1171: 12 pairs
+  0x05, 0x26, 0x63, 0x48, 0x6F, 0x4B, 0x50, 0x4D, 0x81, 0x97, 0xF0, // BIN 1172: 5 pairs
+  0x07, 0x11, 0x33, 0x3B, 0x6A, 0x53, 0x7D, 0x59, 0xA1, 0x61, 0xC6, 0x8E, 0xBB, 0x95, 0xD2, // BIN 1173: 7 pairs
+  0x06, 0x04, 0xB9, 0x0B, 0x64, 0x1C, 0x51, 0x2B, 0x72, 0x4D, 0x7F, 0x7B, 0x83, // BIN 1174: 6 pairs
+  0x06, 0x08, 0x22, 0x14, 0x66, 0x21, 0xEA, 0x23, 0x5A, 0x31, 0x63, 0x39, 0x40, // BIN 1175: 6 pairs
+  0x0C, 0x15, 0x45, 0x1D, 0x51, 0x27, 0xF0, 0x2F, 0x62, 0x53, 0x7F, 0x57, 0xA1, 0x5E, 0xC0, 0x69, 0xC0, 0x7A, 0xF8, 0x92, 0xAB, 0x95, 0xDA, 0xD9, 0xE8, // BIN 1176: 12 pairs
+  0x0F, 0x00, 0x25, 0x03, 0x98, 0x03, 0xDD, 0x0C, 0x7D, 0x12, 0x30, 0x1E, 0x29, 0x29, 0x50, 0x4F, 0xA4, 0x6F, 0xA0, 0x6F, 0xA1, 0x80, 0xB9, 0x9C, 0xF9, 0x9F, 0xDD, 0xAC, 0xB1, 0xB3, 0xCE, // BIN 1177: 15 pairs
+  0x09, 0x06, 0xD9, 0x12, 0x2C, 0x57, 0xC6, 0x75, 0xB2, 0x7C, 0xB4, 0x85, 0xD3, 0x8F, 0xB0, 0xAF, 0xC3, 0xBB, 0xE7, // BIN 1178: 9 pairs
+  0x0D, 0x09, 0x29, 0x0D, 0x3D, 0x2D, 0x54, 0x2F, 0x52, 0x39, 0x5A, 0x59, 0x8A, 0x72, 0xC7, 0x7C, 0xAC, 0x81, 0xD3, 0x8A, 0xD0, 0x93, 0xDB, 0xA4, 0xE0, 0xDB, 0xDC, // BIN 1179: 13 pairs
+  0x12, 0x03, 0xA6, 0x04, 0xE8, 0x10, 0x44, 0x13, 0xB8, 0x61, 0xAA, 0x62, 0x75, 0x6C, 0xEA, 0x75, 0xD0, 0x80, 0xB7, 0x8E, 0xC2, 0x91, 0xBF, 0x92, 0xDA, 0xB1, 0xC7, 0xBA, 0xF6, 0xC2, 0xDF, 0xCC, 0xF3, 0xD2, 0xED, 0xE5, 0xEB, // BIN 1180: 18 pairs
+  0x0D, 0x0B, 0x15, 0x0B, 0x5C, 0x12, 0x44, 0x20, 0xFC, 0x4A, 0x75, 0x57, 0x7C, 0x5E, 0x7C, 0x60, 0x83, 0x84, 0xC4, 0xB4, 0xE7, 0xD5, 0xFC, 0xD8, 0xFC, 0xEB, 0xF2, // BIN 1181: 13 pairs
+  0x10, 0x08, 0xD9, 0x09, 0x57, 0x09, 0x68, 0x0E, 0xFF, 0x1A, 0x33, 0x2B, 0x77, 0x53, 0x79, 0x5A, 0x83, 0x90, 0xCB, 0x96, 0xD9, 0x99, 0xF6, 0x9A, 0xB1, 0x9A, 0xF6, 0x9D, 0xB4, 0xA0, 0xBC, 0xE1, 0xE6, // BIN 1182: 16 pairs
+  0x0B, 0x1F, 0x25, 0x2F, 0x5E, 0x55, 0x85, 0x57, 0xA7, 0x6E, 0x9F, 0x75, 0xAE, 0x75, 0xB4, 0x83, 0xB7, 0x99, 0xB1, 0xE0, 0xEE, 0xE6, 0xFC, // BIN 1183: 11 pairs
+  0x07, 0x0C, 0xF3, 0x1B, 0x29, 0x30, 0x62, 0x32, 0x4F, 0x3A, 0x48, 0x9B, 0xE0, 0xD6, 0xEA, // BIN 1184: 7 pairs
+  0x0A, 0x16, 0x46, 0x1E, 0xEF, 0x69, 0xA2, 0x8F, 0xD8, 0x93, 0xDF, 0xA2, 0xC2, 0xA3, 0xA4, 0xB0, 0xE7, 0xB8, 0xE7, 0xCA, 0xF3, // BIN 1185: 10 pairs
+  0x0C, 0x03, 0x07, 0x06, 0x22, 0x19, 0x28, 0x29, 0x5B, 0x5E, 0x94, 0x62, 0x7A, 0x66, 0xC0, 0x6C, 0xBB, 0x72, 0xE1, 0x74, 0x94, 0xB0, 0xD1, 0xB5, 0xDB, // BIN 1186: 12 pairs
+  0x0F, 0x13, 0xFA, 0x27, 0x31, 0x43, 0x6F, 0x55, 0x81, 0x61, 0xC5, 0x6C, 0x8D, 0x70, 0xEF, 0x71, 0xC3, 0x73, 0xA9, 0x76, 0xA8, 0x8F, 0xF8, 0xD0, 0xF1, 0xD2, 0xF2, 0xD2, 0xF4, 0xD8, 0xF2, // BIN 1187: 15 pairs
+  0x08, 0x15, 0xFE, 0x16, 0x70, 0x24, 0x5A, 0x3F, 0x69, 0x43, 0x82, 0x54, 0xA4, 0x94, 0xB5, 0xBA, 0xC2, // BIN 1188: 8 pairs
+  0x0C, 0x06, 0x15, 0x26, 0x5E, 0x2B, 0x7B, 0x2B, 0xF7, 0x48, 0x4E, 0x4D, 0x84, 0x54, 0x67, 0x58, 0xF7, 0x7D, 0xD7, 0x89, 0x92, 0x89, 0xA1, 0xA4, 0xB7, // BIN 1189: 12 pairs
+  0x0F, 0x0E, 0x3A, 0x18, 0x5C, 0x19, 0x37, 0x1A, 0x2A, 0x1C, 0x45, 0x1F, 0x54, 0x1F, 0x55, 0x62, 0x8B, 0x78, 0xD0, 0x79, 0xB6, 0x7A, 0xD4, 0x80, 0x9D, 0x80, 0xC0, 0xC7, 0xFA, 0xD1, 0xE7, // BIN 1190: 15 pairs
+  0x06, 0x0A, 0x35, 0x42, 0x43, 0x59, 0xA7, 0x82, 0xD4, 0xD6, 0xF4, 0xE0, 0xED, // BIN 1191: 6 pairs
+  0x08, 0x0D, 0x50, 0x13, 0xEE, 0x20, 0xF4, 0x36, 0x75, 0x71, 0xF7, 0x87, 0xB4, 0xAB, 0xDF, 0xC9, 0xE7, // BIN 1192: 8 pairs
+  0x06, 0x57, 0xC5, 0x6F, 0xA2, 0xA1, 0xD6, 0xB8, 0xF7, 0xBC, 0xEC, 0xC4, 0xF6, // BIN 1193: 6 pairs
+  0x0D, 0x0E, 0xF5, 0x1C, 0x58, 0x25, 0xF7, 0x33, 0x5D, 0x5A, 0x7E, 0x67, 0x96, 0x6E, 0x87, 0x8A, 0xA9, 0x9D, 0xD2, 0xA1, 0xCE, 0xAE, 0xEB, 0xBC, 0xC9, 0xE9, 0xF3, // BIN 1194: 13 pairs
+  0x07, 0x0C, 0xBD, 0x0E, 0x37, 0x7B, 0x8E, 0x7F, 0xF8, 0x85, 0x8E, 0xB5, 0xBB, 0xDA, 0xDC, // BIN 1195: 7 pairs
+  0x13, 0x0D, 0x40, 0x0D, 0x86, 0x27, 0x65, 0x28, 0x47, 0x2D, 0x48, 0x42, 0x54, 0x45, 0x6C, 0x47, 0xEA, 0x54, 0x99, 0x54, 0x9A, 0x5B, 0x77, 0x6C, 0xCC, 0x77, 0xEF, 0x86, 0xAB, 0xA9, 0xE9, 0xAB, 0xDD, 0xAC, 0xB0, 0xB6, 0xB8, 0xC8, 0xF3, // BIN 1196: 19 pairs
+  0x10, 0x0D, 0x44, 0x0F, 0x5D, 0x27, 0x5A, 0x45, 0x65, 0x5B, 0x87, 0x5F, 0xF8, 0x68, 0xCF, 0x79, 0xAB, 0x99, 0xB0, 0x9A, 0xB0, 0x9B, 0xF8, 0xA5, 0xC1, 0xAB, 0xE5, 0xCE, 0xF2, 0xD2, 0xE4, 0xEA, 0xF5, // BIN 1197: 16 pairs
+  0x0F, 0x04, 0x36, 0x36, 0x5A, 0x3B, 0xA5, 0x69, 0xEA, 0x71, 0xB8, 0x7F, 0xC4, 0x87, 0xB8, 0x8C, 0xC1, 0x9F, 0xDF, 0xA9, 0xE2, 0xAA, 0xF8, 0xAF, 0xEA, 0xB6, 0xE6, 0xBA, 0xF4, 0xFA, 0xFC, // BIN 1198: 15 pairs
+  0x10, 0x06, 0xA8, 0x0A, 0xE4, 0x0B, 0x70, 0x0E, 0x3D, 0x1B, 0x55, 0x25, 0x9E, 0x2B, 0x5A, 0x62, 0x7F, 0x7C, 0xB0, 0x86, 0xE4, 0x8E, 0xC4, 0x92, 0xDD, 0xB1, 0xD1, 0xD2, 0xE9, 0xD9, 0xF1, 0xF5, 0xF8, // BIN 1199: 16 pairs
+  0x07, 0x00, 0xE3, 0x3C, 0x77, 0x49, 0x7A, 0x4E, 0x72, 0x55, 0x84, 0x83, 0xB4, 0x8E, 0x93, // BIN 1200: 7 pairs
+  0x0E, 0x0F, 0x7F, 0x25, 0x29, 0x2E, 0x3E, 0x39, 0x5B, 0x41, 0x51, 0x52, 0x86, 0x54, 0x8B, 0x6E, 0xC9, 0x74, 0x8B, 0x81, 0xC4, 0x82, 0x89, 0x8B, 0xD7, 0x9D, 0xD6, 0xBE, 0xFA, // BIN 1201: 14 pairs
+  0x0B, 0x1B, 0x3F, 0x2E, 0x6B, 0x32, 0x58, 0x47, 0x9B, 0x47, 0xBD, 0x50, 0x76, 0x59, 0xBD, 0x7A, 0xA3, 0xAA, 0xC1, 0xCC, 0xE6, 0xD5, 0xE3, // BIN 1202: 11 pairs
+  0x07, 0x06, 0xE3, 0x16, 0xFE, 0x20, 0x8F, 0x7C, 0xB6, 0x7E, 0xB7, 0x84, 0xD5, 0xB6, 0xE5, // BIN 1203: 7 pairs
+  0x09, 0x06, 0x71, 0x2E, 0x4B, 0x6D, 0x8D, 0x6D, 0xBA, 0x7A, 0x8E, 0xA0, 0xD6, 0xC2, 0xE8, 0xC5, 0xCE, 0xE8, 0xEC, // BIN 1204: 9 pairs
+  0x0B, 0x00, 0x27, 0x11, 0x29, 0x12, 0x34, 0x40, 0x70, 0x41, 0xAC, 0x49, 0x78, 0x6B, 0xFF, 0x83, 0xB5, 0x89, 0xA0, 0xB4, 0xE6, 0xD9, 0xE0, // BIN 1205: 11 pairs
+  0x0C, 0x00, 0x13, 0x01, 0x2E, 0x0D, 0x77, 0x1A, 0xA5, 0x20, 0xC6, 0x51, 0x72, 0x62, 0x64, 0x6F, 0x99, 0x6F, 0x9A, 0xB9, 0xD2, 0xCC, 0xDE, 0xE2, 0xFC, // BIN 1206: 12 pairs
+  0x0C, 0x0E, 0x33, 0x1E, 0xFD, 0x25, 0x65, 0x2B, 0xA5, 0x2D, 0x41, 0x55, 0x80, 0x7E, 0xBA, 0x87, 0xBC, 0x8C, 0xDC, 0x8C, 0xF7, 0x8D, 0xA4, 0xDC, 0xDF, // BIN 1207: 12 pairs
+  0x0B, 0x08, 0x64, 0x0C, 0x54, 0x3A, 0x41, 0x55, 0x74, 0x5B, 0x6E, 0x68, 0xA2, 0x6B, 0x8E, 0x76, 0x95, 0x98, 0xE0, 0xAA, 0xCB, 0xD1, 0xFD, // BIN 1208: 11 pairs
+  0x0D, 0x03, 0x3E, 0x04, 0xFE, 0x0F, 0x4D, 0x53, 0x81, 0x5A, 0x77, 0xA0, 0xCE, 0xAD, 0xDE, 0xB1, 0xE8, 0xB4, 0xE5, 0xB5, 0xC8, 0xB5, 0xCA, 0xC2, 0xDD, 0xE4, 0xE8, // BIN 1209: 13 pairs
+  0x0A, 0x04, 0x26, 0x1E, 0x51, 0x22, 0x58, 0x3B, 0x86, 0x4D, 0x85, 0x5D, 0xA0, 0x64, 0x91, 0x68, 0xCD, 0x6A, 0x9D, 0x77, 0xB5, // BIN 1210: 10 pairs
+  0x0D, 0x0A, 0xFB, 0x1A, 0x70, 0x47, 0xC6, 0x4B, 0x78, 0x4F, 0x79, 0x4F, 0x99, 0x4F, 0x9A, 0x65, 0x8E, 0x6E, 0x8E, 0x7D, 0xC4, 0x8D, 0xC8, 0xA8, 0xCE, 0xA8, 0xDE, // BIN 1211: 13 pairs
+  0x0B, 0x00, 0x24, 0x1C, 0xFF, 0x32, 0x54, 0x3A, 0x58, 0x53, 0x82, 0x54, 0x92, 0x5E, 0xCC, 0x69, 0x8D, 0x7C, 0xB1, 0xB2, 0xE7, 0xBB, 0xDE, // BIN 1212: 11 pairs
+  0x0A, 0x2F, 0x66, 0x47, 0x62, 0x59, 0x5B, 0x5B, 0x71, 0x81, 0xF6, 0x88, 0x9F, 0x89, 0xB2, 0x8D, 0x90, 0x8F, 0xEB, 0xC4, 0xF8, // BIN 1213: 10 pairs
+  0x10, 0x02, 0xF0, 0x08, 0x70, 0x0F, 0xC9, 0x10, 0xED, 0x19, 0x70, 0x21, 0x78, 0x2F, 0x50, 0x3C, 0x67, 0x6D, 0xCF, 0x7D, 0xEB, 0x7F, 0x87, 0x8F, 0xDA, 0x98, 0xEB, 0xBA, 0xE6, 0xC2, 0xF7, 0xF0, 0xF2, // BIN 1214: 16 pairs
+  0x0E, 0x03, 0xDF, 0x09, 0xF5, 0x1B, 0x1F, 0x21, 0x93, 0x2C, 0x62, 0x32, 0x62, 0x39, 0x81, 0x7E, 0xBB, 0x7F, 0xD7, 0x8D, 0xBD, 0x91, 0xB6, 0x95, 0xDD, 0xCF, 0xF1, 0xDE, 0xF0, // BIN 1215: 14 pairs
+  0x0C, 0x06, 0xDC, 0x0C, 0x49, 0x12, 0xEC, 0x20, 0x82, 0x49, 0x7D, 0x5A, 0x71, 0x60, 0x97, 0x89, 0xA6, 0x99, 0xE0, 0x9A, 0xE0, 0xA5, 0xEE, 0xAF, 0xEB, // BIN 1216: 12 pairs
+  0x0A, 0x0D, 0x15, 0x13, 0x2E, 0x42, 0x4F, 0x4B, 0x7A, 0x6F, 0x72, 0x73, 0x9E, 0x7D, 0xD3, 0x81, 0xD5, 0x95, 0xBC, 0xAF, 0xE8, // BIN 1217: 10 pairs
+  0x07, 0x26, 0x3C, 0x3F, 0x6E, 0x48, 0xAC, 0x5B, 0x80, 0x7B, 0xD9, 0x98, 0xBC, 0xC9, 0xF3, // BIN 1218: 7 pairs
+  0x0D, 0x00, 0x2B, 0x04, 0x39, 0x1B, 0xA7, 0x23, 0x5B, 0x2D, 0x60, 0x40, 0x4C, 0x40, 0x71, 0x68, 0xBA, 0x8E, 0xCB, 0x9D, 0xE4, 0xA6, 0xC1, 0xAB, 0xC9, 0xD5, 0xF5, // BIN 1219: 13 pairs
+  0x08, 0x0E, 0xF2, 0x14, 0x61, 0x29, 0x61, 0x53, 0x85, 0x83, 0x93, 0x94, 0xCE, 0x95, 0xDB, 0xCB, 0xF2, // BIN 1220: 8 pairs
+  0x0A, 0x00, 0xFC, 0x0F, 0x4B, 0x32, 0x65, 0x5E, 0x7E, 0x69, 0xBB, 0x8F, 0xDD, 0x92, 0xDB, 0xAB, 0xE6, 0xC6, 0xCE, 0xE2, 0xEA, // BIN 1221: 10 pairs
+  0x10, 0x07, 0x26, 0x07, 0xEA, 0x0E, 0x29, 0x11, 0xEF, 0x14, 0x63, 0x36, 0x44, 0x36, 0x5B, 0x56, 0x7E, 0x59, 0x5A, 0x5B, 0x89, 0x5E, 0x62, 0x88, 0xBC, 0x8D, 0xCA, 0x97, 0xFF, 0xA9, 0xE5, 0xAB, 0xBE, // BIN 1222: 16 pairs
+  0x0C, 0x08, 0x5C, 0x09, 0x3E, 0x12, 0xEE, 0x14, 0x22, 0x20, 0xC5, 0x22, 0x4D, 0x53, 0x84, 0x74, 0xA9, 0x84, 0xF6, 0x9F, 0xE0, 0xCC, 0xE5, 0xE5, 0xFC, // BIN 1223: 12 pairs
+  0x15, 0x03, 0xD5, 0x05, 0x2E, 0x09, 0x31, 0x11, 0xF0, 0x14, 0xEA, 0x1D, 0x3F, 0x1D, 0xF7, 0x20, 0xBD, 0x49, 0x81, 0x4D, 0x50, 0x55, 0x60, 0x5B, 0x61, 0x5D, 0x94, 0x5D, 0xA1, 0x6D, 0xCD, 0x7B, 0xC2, 0x80, 0xC5, 0x80, 0xC6, 0x89, 0xC2, 0x93, 0xB1, 0xA3, 0xDE, // BIN 1224: 21 pairs
+  0x11, 0x0D, 0x8C, 0x10, 0xE9, 0x11, 0xFB, 0x21, 0xAC, 0x2B, 0xEF, 0x3F, 0x6C, 0x5C, 0xF0, 0x6A, 0x8A, 0x70, 0x83, 0x79, 0xBB, 0x85, 0xD5, 0x86, 0xF7, 0x91, 0x98, 0x9C, 0xE0, 0xBD, 0xCE, 0xBE, 0xE5, 0xD1, 0xD2, // BIN 1225: 17 pairs
+  0x08, 0x0C, 0x99, 0x0C, 0x9A, 0x17, 0x5C, 0x1B, 0xCC, 0x26, 0x5A, 0x37, 0x47, 0x68, 0xC8, 0xBA, 0xE5, // BIN 1226: 8 pairs
+  0x0A, 0x12, 0x2A, 0x1A, 0x1F, 0x3D, 0x4C, 0x3D, 0x70, 0x68, 0xEB, 0x88, 0xC1, 0x9D, 0xB6, 0xC4, 0xE3, 0xCD, 0xF1, 0xD2, 0xEE, // BIN 1227: 10 pairs
+  0x0D, 0x08, 0x15, 0x15, 0xFD, 0x1A, 0x4E, 0x24, 0x5B, 0x2E, 0xFF, 0x47, 0xC5, 0x49, 0x67, 0x55, 0x7E, 0x58, 0xC7, 0x69, 0xCC, 0x70, 0xB8, 0x94, 0xDA, 0xA2, 0xB8, // BIN 1228: 13 pairs
+  0x15, 0x03, 0xD3, 0x07, 0x1C, 0x10, 0x3A, 0x13, 0xFD, 0x17, 0x38, 0x20, 0x2C, 0x29, 0x5F, 0x2D, 0x5C, 0x3C, 0x7B, 0x48, 0xF8, 0x49, 0x50, 0x51, 0x59, 0x79, 0xBA, 0x79, 0xBD, 0x89, 0xC1, 0x94, 0xC1, 0x97, 0xEF, 0xA3, 0xB9, 0xB5, 0xD0, 0xBE, 0xCE, 0xC2, 0xD7, // BIN 1229: 21 pairs
+  0x10, 0x07, 0x1B, 0x14, 0x53, 0x3E, 0x52, 0x47, 0xF9, 0x56, 0x9B, 0x60, 0xA8, 0x65, 0x97, 0x7F, 0xD3, 0x85, 0xEB, 0x8E, 0x99, 0x8E, 0x9A, 0x96, 0x98, 0xA6, 0xCB, 0xB2, 0xE6, 0xCB, 0xF1, 0xE2, 0xF6, // BIN 1230: 16 pairs
+  0x08, 0x03, 0xBA, 0x25, 0x5A, 0x26, 0x66, 0x2C, 0x47, 0x31, 0x5E, 0x66, 0xCC, 0x87, 0xB6, 0x8B, 0xD5, // BIN 1231: 8 pairs
+  0x09, 0x08, 0xDC, 0x09, 0xF1, 0x12, 0x37, 0x2A, 0x5D, 0x40, 0x72, 0x4D, 0x82, 0x5A, 0x6E, 0x6D, 0xC8, 0xB2, 0xE5, // BIN 1232: 9 pairs
+  0x0A, 0x10, 0x1F, 0x1B, 0xC0, 0x2E, 0x49, 0x47, 0x8B, 0x54, 0x7E, 0x57, 0x7E, 0x5F, 0xC9, 0x79, 0xB9, 0xB0, 0xE8, 0xD9, 0xF5, // BIN 1233: 10 pairs
+  0x0A, 0x09, 0x66, 0x22, 0x5C, 0x2B, 0x5B, 0x33, 0x59, 0x68, 0xCA, 0x70, 0xC3, 0x7D, 0x83, 0x7D, 0xA3, 0x88, 0x8A, 0x97, 0xE3, // BIN 1234: 10 pairs
+  0x0F, 0x08, 0xE3, 0x1D, 0xFD, 0x27, 0x3F, 0x27, 0x5B, 0x38, 0x61, 0x44, 0x73, 0x59, 0xC6, 0x6F, 0x96, 0x82, 0xEA, 0x90, 0xB0, 0x96, 0xA6, 0x9D, 0xDE, 0xA6, 0xF8, 0xAE, 0xE8, 0xD3, 0xE3, // BIN 1235: 15 pairs
+  0x0A, 0x04, 0x48, 0x0B, 0x3D, 0x0E, 0x40, 0x13, 0x52, 0x16, 0x30, 0x1F, 0x56, 0x37, 0x5D, 0x62, 0x68, 0xAD, 0xE8, 0xC3, 0xC4, // BIN 1236: 10 pairs
+  0x12, 0x02, 0xE7, 0x08, 0xF2, 0x1A, 0x60, 0x23, 0x4F, 0x4A, 0x65, 0x5A, 0x61, 0x64, 0x9D, 0x6D, 0xAD, 0x73, 0xA5, 0x79, 0x88, 0x7E, 0x97, 0x82, 0xB7, 0x83, 0xB6, 0x8C, 0xBC, 0x90, 0xA3, 0x93, 0xB0, 0xBB, 0xF9, 0xD7, 0xF5, // BIN 1237: 18 pairs
+  0x0B, 0x02, 0xF4, 0x0B, 0x7B, 0x14, 0x32, 0x1E, 0x31, 0x21, 0x99, 0x21, 0x9A, 0x24, 0x71, 0x3D, 0x71, 0x45, 0x68, 0x79, 0xB0, 0x80, 0x88, // BIN 1238: 11 pairs
+  0x11, 0x08, 0x7B, 0x09, 0xA4, 0x0E, 0xEF, 0x25, 0xEF, 0x39, 0x84, 0x45, 0x6D, 0x47, 0x6F, 0x4B, 0x7D, 0x53, 0x7C, 0x67, 0x6E, 0x71, 0x87, 0x76, 0xA2, 0x82, 0xD3, 0xA0, 0xF8, 0xAE, 0xC3, 0xC6, 0xFC, 0xD3, 0xFC, // BIN 1239: 17 pairs
+  0x0A, 0x08, 0x35, 0x25, 0x31, 0x3B, 0x67, 0x51, 0x76, 0x5A, 0x87, 0x62, 0x8E, 0x6F, 0x88, 0x74, 0x9F, 0x7A, 0xC4, 0xD1, 0xF2, // BIN 1240: 10 pairs
+  0x0F, 0x12, 0x42, 0x1F, 0x2B, 0x21, 0x23, 0x22, 0x5A, 0x25, 0x72, 0x29, 0x3B, 0x6D, 0xCA, 0x81, 0xF9, 0x89, 0xC3, 0xB5, 0xD7, 0xB5, 0xDF, 0xC2, 0xCA, 0xC4, 0xF3, 0xD2, 0xF5, 0xE5, 0xF0, // BIN 1241: 15 pairs
+  0x0C, 0x05, 0x3B, 0x15, 0x21, 0x18, 0xE1, 0x6E, 0xC0, 0x75, 0xD4, 0x7B, 0xF7, 0x88, 0xB0, 0x92, 0xDF, 0x96, 0xA1, 0x97, 0xAF, 0x99, 0xF9, 0xC4, 0xDC, // BIN 1242: 12 pairs
+  0x0D, 0x00, 0x22, 0x1D, 0xF0, 0x27, 0x2F, 0x39, 0x44, 0x49, 0x84, 0x57, 0x8A, 0x60, 0x91, 0x6F, 0x9C, 0x82, 0xD7, 0x96, 0xD2, 0x9A, 0xF9, 0xB7, 0xEB, 0xC5, 0xFC, // BIN 1243: 13 pairs
+  0x0A, 0x13, 0xE3, 0x29, 0x2B, 0x34, 0x47, 0x43, 0xA4, 0x66, 0xBB, 0x75, 0xAF, 0x79, 0x9D, 0x7A, 0xD7, 0xB8, 0xFF, 0xC2, 0xC8, // BIN 1244: 10 pairs
+  0x0E, 0x0C, 0x93, 0x27, 0x45, 0x27, 0xF7, 0x2A, 0x57, 0x2D, 0x62, 0x33, 0x57, 0x3A, 0x56, 0x5E, 0xF9, 0x63, 0xC9, 0x6C, 0xBA, 0x7E, 0xA9, 0x89, 0xB3, 0xAF, 0xE5, 0xF9, 0xFE, // BIN 1245: 14 pairs
+  0x0E, 0x11, 0x44, 0x19, 0xFE, 0x1B, 0xA0, 0x1E, 0x60, 0x21, 0x2D, 0x2A, 0x59, 0x35, 0x6B, 0x39, 0x7D, 0x5E, 0xBB, 0x63, 0xF8, 0x8D, 0xC1, 0x8E, 0xCE, 0x91, 0xA1, 0xA9, 0xEC, // BIN 1246: 14 pairs
+  0x0B, 0x12, 0x58, 0x18, 0x64, 0x1E, 0x71, 0x27, 0x9E, 0x48, 0x5A, 0x49, 0x7F, 0x57, 0xA6, 0x65, 0x96, 0x91, 0xA6, 0x9D, 0xE3, 0xC7, 0xD2, // BIN 1247: 11 pairs
+  0x0E, 0x1D, 0x64, 0x29, 0x62, 0x2E, 0x71, 0x3A, 0x67, 0x3F, 0x68, 0x43, 0x93, 0x65, 0x80, 0x79, 0xB1, 0x80, 0xC9, 0x89, 0x9B, 0xAF, 0xE6, 0xBC, 0xE1, 0xC2, 0xD0, 0xC9, 0xCB, // BIN 1248: 14 pairs
+  0x09, 0x0B, 0xD9, 0x1B, 0x45, 0x25, 0x77, 0x41, 0x4E, 0x59, 0xA6, 0x59, 0xC5, 0x5C, 0x89, 0xB8, 0xD8, 0xCF, 0xFC, // BIN 1249: 9 pairs
+  0x09, 0x03, 0xFB, 0x18, 0x38, 0x2A, 0x62, 0x3B, 0x45, 0x93, 0xF6, 0x9E, 0xEE, 0xC9, 0xFC, 0xCA, 0xF1, 0xD8, 0xFB, // BIN 1250: 9 pairs
+  0x0D, 0x02, 0x1F, 0x02, 0xFF, 0x04, 0x5E, 0x0C, 0xC9, 0x0F, 0x4A, 0x0F, 0x6E, 0x19, 0x33, 0x43, 0x9C, 0x5C, 0xE1, 0x8A, 0xBC, 0xA5, 0xCB, 0xDC, 0xDD, 0xFE, 0xFF, // BIN 1251: 13 pairs
+  0x08, 0x03, 0xDA, 0x05, 0xF3, 0x17, 0x29, 0x20, 0x37, 0x3E, 0x6F, 0x87, 0xA8, 0x9C, 0xB1, 0xB3, 0xE5, // BIN 1252: 8 pairs
+  0x11, 0x0C, 0x85, 0x0E, 0xF0, 0x19, 0xBE, 0x19, 0xEC, 0x22, 0x53, 0x32, 0x48, 0x3A, 0x64, 0x48, 0x5B, 0x4B, 0x81, 0x7A, 0x87, 0x84, 0xF9, 0x89, 0xB4, 0x8F, 0xDB, 0x95, 0xDF, 0x95, 0xEA, 0xC4, 0xF1, 0xD9, 0xFE, // BIN 1253: 17 pairs
+  0x0B, 0x07, 0xE8, 0x14, 0x3A, 0x29, 0x63, 0x44, 0x4C, 0x44, 0x77, 0x66, 0xA2, 0x72, 0xD1, 0x99, 0xD2, 0x9A, 0xD2, 0xBC, 0xEE, 0xC0, 0xDE, // BIN 1254: 11 pairs
+  0x0A, 0x03, 0xDB, 0x25, 0x7B, 0x2E, 0x36, 0x35, 0x4C, 0x75, 0x83, 0x78, 0x89, 0x7C, 0xBA, 0x8D, 0xCC, 0xA1, 0xF8, 0xBB, 0xE6, // BIN 1255: 10 pairs
+  0x0B, 0x0B, 0x40, 0x19, 0x2A, 0x21, 0xFC, 0x24, 0x6B, 0x3C, 0x4A, 0x52, 0x6F, 0x5E, 0xEB, 0x6E, 0xBB, 0x9F, 0xC3, 0xB5, 0xCD, 0xB5, 0xEF, // BIN 1256: 11 pairs
+  0x0A, 0x02, 0x22, 0x0C, 0x7A, 0x0E, 0x14, 0x31, 0x66, 0x5E, 0xF6, 0x74, 0xA8, 0x92, 0xEB, 0xA9, 0xE6, 0xC7, 0xE7, 0xD7, 0xFB, // BIN 1257: 10 pairs
+  0x0C, 0x0F, 0x3F, 0x1C, 0xFD, 0x23, 0x41, 0x26, 0x5B, 0x39, 0x7A, 0x50, 0x8C, 0x68, 0xD0, 0x6E, 0xAD, 0x6F, 0xA6, 0x89, 0xAA, 0xC5, 0xF3, 0xD5, 0xF2, // BIN 1258: 12 pairs
+  0x0E, 0x1B, 0x98, 0x24, 0x65, 0x25, 0xA5, 0x27, 0x72, 0x41, 0x6F, 0x42, 0x72, 0x4B, 0x65, 0x68, 0xF6, 0x68, 0xF9, 0x7C, 0xBB, 0xA8, 0xEE, 0xAF, 0xE7, 0xD0, 0xFC, 0xE1, 0xF2, // BIN 1259: 14 pairs
+  0x07, 0x02, 0x09, 0x05, 0x23, 0x12, 0xE1, 0x16, 0x2C, 0x3D, 0x72, 0x5A, 0x80, 0x73, 0x94, // BIN 1260: 7 pairs
+  0x0F, 0x04, 0xC6, 0x07, 0x10, 0x11, 0x26, 0x16, 0x34, 0x1E, 0xFA, 0x31, 0x3B, 0x37, 0x60, 0x4D, 0x65, 0x59, 0x94, 0x5B, 0x88, 0x7D, 0xD5, 0x96, 0xA0, 0x9E, 0xC1, 0xC6, 0xF3, 0xE2, 0xEF, // BIN 1261: 15 pairs
+  0x14, 0x0F, 0xF3, 0x10, 0x28, 0x23, 0x48, 0x34, 0x5D, 0x38, 0x5F, 0x3B, 0x3F, 0x45, 0x60, 0x46, 0x56, 0x4B, 0x7F, 0x53, 0x60, 0x62, 0x7D, 0x85, 0x87, 0x8D, 0xCD, 0x8E, 0xC3, 0x90, 0xB1, 0x96, 0xAA, 0xA3, 0xE2, 0xB5, 0xDD, 0xBB, 0xC2, 0xC8, 0xF1, // BIN 1262: 20 pairs
+  0x0B, 0x02, 0xE4, 0x10, 0x30, 0x11, 0xF5, 0x20, 0x34, 0x3F, 0x6D, 0x5A, 0x89, 0x64, 0x96, 0x78, 0xEA, 0x7A, 0xD3, 0xD5, 0xDC, 0xEC, 0xF3, // BIN 1263: 11 pairs
+  0x0E, 0x0A, 0x1F, 0x0B, 0x44, 0x10, 0x42, 0x10, 0x9E, 0x2E, 0x70, 0x36, 0x81, 0x3F, 0x67, 0x42, 0x70, 0x5D, 0xA7, 0x62, 0x85, 0x92, 0xD2, 0x98, 0xCE, 0xB5, 0xEE, 0xDC, 0xF3, // BIN 1264: 14 pairs
+  0x09, 0x0E, 0xEE, 0x11, 0x38, 0x4A, 0x78, 0x5D, 0x83, 0x6C, 0xCF, 0x91, 0xA0, 0x96, 0xC4, 0xB9, 0xFC, 0xBE, 0xE6, // BIN 1265: 9 pairs
+  0x0A, 0x08, 0x86, 0x09, 0x4F, 0x12, 0x33, 0x30, 0x47, 0x6C, 0xAD, 0x6F, 0xA7, 0x82, 0xBF, 0x8F, 0xDF, 0xC0, 0xE6, 0xC2, 0xD4, // BIN 1266: 10 pairs
+  0x09, 0x00, 0xE6, 0x1B, 0xA1, 0x25, 0x5B, 0x2F, 0x69, 0x57, 0xAA, 0x7B, 0xE4, 0x8A, 0xD3, 0x8D, 0xC9, 0x8E, 0xA8, // BIN 1267: 9 pairs
+  0x0A, 0x11, 0x42, 0x4C, 0x67, 0x4F, 0x92, 0x5B, 0x63, 0x65, 0x9E, 0x8C, 0xEC, 0x9C, 0xB0, 0xA8, 0xB0, 0xBB, 0xE5, 0xF6, 0xFE, // BIN 1268: 10 pairs
+  0x0D, 0x0D, 0xD9, 0x0E, 0x26, 0x26, 0x52, 0x32, 0x41, 0x34, 0x60, 0x3F, 0x6F, 0x48, 0x92, 0x72, 0xF0, 0x7C, 0xB7, 0x88, 0xFF, 0x8D, 0xB8, 0x9C, 0xF4, 0xCC, 0xFC, // BIN 1269: 13 pairs
+  0x10, 0x24, 0x70, 0x32, 0x64, 0x3E, 0x81, 0x44, 0x74, 0x46, 0x48, 0x59, 0xF8, 0x5F, 0xEA, 0x83, 0x99, 0x83, 0x9A, 0x88, 0xB1, 0xB5, 0xD4, 0xB7, 0xEA, 0xB8, 0xE0, 0xB9, 0xE8, 0xCC, 0xF1, 0xEF, 0xF5, // BIN 1270: 16 pairs
+  0x0D, 0x00, 0xE5, 0x03, 0x49, 0x04, 0xC5, 0x09, 0xC6, 0x10, 0x2C, 0x1D, 0x45, 0x2E, 0x53, 0x4B, 0x84, 0x72, 0x8D, 0xA9, 0xBA, 0xCB, 0xEF, 0xE0, 0xE9, 0xE6, 0xF0, // BIN 1271: 13 pairs
+  0x0F, 0x0B, 0x86, 0x14, 0x69, 0x26, 0x27, 0x4A, 0x7A, 0x4C, 0x79, 0x4C, 0x93, 0x4E, 0x70, 0x58, 0xD1, 0x6D, 0x9F, 0x6D, 0xD0, 0x82, 0xB1, 0xC0, 0xF3, 0xC5, 0xE2, 0xE6, 0xF6, 0xE7, 0xF7, // BIN 1272: 15 pairs
+  0x0D, 0x01, 0x70, 0x0C, 0x15, 0x13, 0x9D, 0x30, 0x60, 0x4D, 0x79, 0x72, 0x7E, 0x7E, 0xBD, 0x90, 0xF7, 0x91, 0xD9, 0x94, 0xDB, 0xB2, 0xC3, 0xB6, 0xF8, 0xCE, 0xF3, // BIN 1273: 13 pairs
+  0x0B, 0x0B, 0x50, 0x56, 0x95, 0x59, 0xAA, 0x6C, 0xCD, 0x72, 0xB8, 0x78, 0xC4, 0x78, 0xD4, 0x84, 0xA3, 0x98, 0xD6, 0xCD, 0xFC, 0xD5, 0xFB, // BIN 1274: 11 pairs
+  0x07, 0x1A, 0x38, 0x38, 0x63, 0x55, 0x73, 0x57, 0xEA, 0x5D, 0x8D, 0x67, 0x97, 0x7D, 0x8E, // BIN 1275: 7 pairs
+  0x0A, 0x01, 0x7B, 0x03, 0x26, 0x19, 0x1F, 0x35, 0x62, 0x4F, 0xB9, 0x63, 0x8D, 0x82, 0xB0, 0x8A, 0x97, 0x92, 0xF8, 0xE2, 0xF7, // BIN 1276: 10 pairs
+  0x07, 0x06, 0x35, 0x17, 0xE1, 0x1B, 0xCF, 0x20, 0x30, 0x72, 0x7C, 0x80, 0xC8, 0xC3, 0xE0, // BIN 1277: 7 pairs
+  0x11, 0x00, 0xE7, 0x0C, 0x4D, 0x11, 0xF2, 0x16, 0xB3, 0x19, 0x60, 0x27, 0x77, 0x2B, 0x31, 0x49, 0x85, 0x51, 0x61, 0x5E, 0xCF, 0x84, 0xDD, 0x88, 0xD9, 0xA2, 0xEA, 0xAA, 0xB5, 0xB7, 0xC7, 0xD4, 0xF5, 0xDE, 0xFB, // BIN 1278: 17 pairs
+  0x0D, 0x01, 0x22, 0x04, 0xF2, 0x13, 0xA9, 0x1C, 0x36, 0x3E, 0x7A, 0x47, 0xF6, 0x50, 0x88, 0x52, 0x88, 0x64, 0x87, 0x65, 0x8D, 0x7F, 0xD5, 0x91, 0xAA, 0x96, 0xDC, // BIN 1279: 13 pairs
+  0x0B, 0x07, 0x29, 0x09, 0x81, 0x14, 0x6D, 0x16, 0x28, 0x46, 0x72, 0x4C, 0x8F, 0x6C, 0x9F, 0x6C, 0xC8, 0x6D, 0xB6, 0x94, 0xCB, 0x97, 0xA2, // BIN 1280: 11 pairs
+  0x08, 0x18, 0x29, 0x69, 0xBA, 0x86, 0xDC, 0x89, 0xA7, 0x8D, 0xC5, 0x95, 0x9D, 0xBE, 0xFD, 0xC1, 0xEF, // BIN 1281: 8 pairs
+  0x0B, 0x04, 0xDD, 0x09, 0x5F, 0x0D, 0x52, 0x56, 0x98, 0x5A, 0x63, 0x80, 0xCC, 0x94, 0xDD, 0xB4, 0xC3, 0xD2, 0xF6, 0xD4, 0xFB, 0xE1, 0xFE, // BIN 1282: 11 pairs
+  0x12, 0x01, 0xF5, 0x0C, 0x4B, 0x10, 0x50, 0x16, 0x7B, 0x16, 0xE9, 0x26, 0x62, 0x2B, 0x86, 0x2C, 0x5D, 0x3E, 0x7D, 0x45, 0x6A, 0x53, 0x74, 0x61, 0xF8, 0x6B, 0xA9, 0x75, 0xEB, 0xA5, 0xBC, 0xA6, 0xB5, 0xC2, 0xCD, 0xC5, 0xE7, // BIN 1283: 18 pairs
+  0x0E, 0x08, 0x8C, 0x09, 0xC5, 0x0F, 0x2A, 0x16, 0x37, 0x2F, 0x68, 0x47, 0x98, 0x5B, 0x7B, 0x64, 0xC7, 0x8C, 0xCB, 0x8D, 0xCF, 0x96, 0xD6, 0xB5, 0xCF, 0xC7, 0xFD, 0xD8, 0xD9, // BIN 1284: 14 pairs
+  0x13, 0x02, 0xE6, 0x03, 0xF3, 0x04, 0x43, 0x10, 0xE4, 0x17, 0x64, 0x22, 0x5B, 0x2B, 0xE1, 0x3C, 0x9E, 0x43, 0x8F, 0x4E, 0x76, 0x53, 0x80, 0x85, 0xBF, 0x86, 0xC1, 0x9B, 0xBC, 0xAB, 0xBD, 0xC0, 0xE5, 0xD3, 0xF5, 0xE7, 0xF8, 0xF1, 0xF7, // BIN 1285: 19 pairs
+  0x0B, 0x01, 0x15, 0x0C, 0x2A, 0x1E, 0x26, 0x1E, 0x2F, 0x61, 0x8D, 0x68, 0xAD, 0x7C, 0x97, 0x8D, 0xD0, 0xA7, 0xC1, 0xC6, 0xE2, 0xD7, 0xE3, // BIN 1286: 11 pairs
+  0x0C, 0x15, 0xFB, 0x2D, 0x58, 0x2E, 0x4D, 0x50, 0x9E, 0x89, 0xA5, 0x8D, 0xC6, 0x97, 0xAE, 0x9D, 0xC4, 0xA4, 0xD2, 0xB7, 0xD1, 0xC1, 0xC9, 0xD3, 0xDC, // BIN 1287: 12 pairs
+  0x11, 0x1C, 0x5C, 0x24, 0x4A, 0x27, 0x7B, 0x36, 0x84, 0x3B, 0x8C, 0x3E, 0x50, 0x46, 0x73, 0x4F, 0x8B, 0x52, 0x8C, 0x5A, 0x88, 0x79, 0xC0, 0x80, 0xCA, 0x81, 0xDD, 0x8E, 0xC0, 0x90, 0xEC, 0xA9, 0xF0, 0xCE, 0xEB, // BIN 1288: 17 pairs
+  0x05, 0x04, 0xA4, 0x25, 0x3F, 0x28, 0x62, 0x4F, 0x80, 0x6C, 0xCA, // BIN 1289: 5 pairs
+  0x0E, 0x01, 0x86, 0x10, 0x34, 0x13, 0x44, 0x30, 0x5D, 0x3B, 0xF7, 0x8A, 0xB5, 0x8A, 0xD4, 0x97, 0xDE, 0xA1, 0xC1, 0xA8, 0xB1, 0xAE, 0xE5, 0xB1, 0xB9, 0xBA, 0xF9, 0xDE, 0xEB, // BIN 1290: 14 pairs
+  0x0B, 0x09, 0x59, 0x0B, 0x77, 0x1B, 0xAA, 0x42, 0x71, 0x73, 0x8B, 0x73, 0x9F, 0x76, 0x82, 0x77, 0xC2, 0xAE, 0xE6, 0xC3, 0xD8, 0xE1, 0xE2, // BIN 1291: 11 pairs
+  0x10, 0x03, 0x4D, 0x04, 0xDF, 0x12, 0xED, 0x14, 0xEB, 0x1F, 0x3B, 0x26, 0x68, 0x2E, 0x39, 0x37, 0x59, 0x3E, 0x84, 0x50, 0xFF, 0x61, 0xC9, 0x6B, 0x7C, 0x79, 0xB7, 0x83, 0xBC, 0xA7, 0xCB, 0xAE, 0xE7, // BIN 1292: 16 pairs
+  0x0A, 0x05, 0x3C, 0x27, 0xEF, 0x29, 0x5E, 0x5E, 0xCD, 0x76, 0x9E, 0xA9, 0xEF, 0xAB, 0xE4, 0xB3, 0xE6, 0xB5, 0xF0, 0xE7, 0xEF, // BIN 1293: 10 pairs
+  0x0B, 0x01, 0x64, 0x02, 0xE8, 0x0C, 0x5D, 0x21, 0x3A, 0x26, 0x69, 0x7E, 0xC0, 0x87, 0xC1, 0x9C, 0xD2, 0xBF, 0xF1, 0xC6, 0xE7, 0xDE, 0xF4, // BIN 1294: 11 pairs
+  0x13, 0x0B, 0xF2, 0x0D, 0x23, 0x16, 0xE4, 0x23, 0x54, 0x2D, 0x56, 0x2D, 0x65, 0x37, 0x65, 0x3F, 0x65, 0x4A, 0x7D, 0x56, 0x8A, 0x6D, 0xB2, 0x70, 0x8E, 0x7C, 0xBD, 0x80, 0xC4, 0x82, 0xD5, 0x85, 0xB7, 0x97, 0xE9, 0x9B, 0xD6, 0xA4, 0xB1, // BIN 1295: 19 pairs
+  0x0B, 0x06, 0xF5, 0x0B, 0x8C, 0x14, 0x6C, 0x4F, 0x7C, 0x51, 0x70, 0x5A, 0x7B, 0x7B, 0xAB, 0x84, 0xD8, 0x89, 0xB6, 0xD7, 0xF2, 0xEE, 0xFC, // BIN 1296: 11 pairs
+  0x12, 0x0C, 0x3F, 0x0C, 0x7F, 0x0E, 0x38, 0x11, 0x14, 0x11, 0xEE, 0x15, 0x4A, 0x18, 0x9E, 0x25, 0x2F, 0x41, 0x92, 0x4A, 0x6A, 0x4B, 0x85, 0x4D, 0x6A, 0x69, 0xCF, 0x6D, 0xB4, 0x75, 0xD7, 0x80, 0xBF, 0x96, 0xBA, 0xCE, 0xE1, // BIN 1297: 18 pairs
+  0x0B, 0x00, 0xDC, 0x01, 0x8C, 0x08, 0x77, 0x09, 0xAC, 0x0F, 0x8F, 0x10, 0xF2, 0x26, 0x50, 0x4C, 0x9C, 0x6A, 0x9E, 0x7F, 0xEB, 0x89, 0x8F, // BIN 1298: 11 pairs
+  0x0C, 0x02, 0xE5, 0x11, 0x31, 0x16, 0xEE, 0x25, 0x45, 0x36, 0x7D, 0x46, 0x74, 0x56, 0x67, 0x66, 0xCF, 0x70, 0xF7, 0x7A, 0xEB, 0x88, 0xF0, 0x98, 0xF8, // BIN 1299: 12 pairs
+  0x09, 0x10, 0xA5, 0x12, 0xF2, 0x19, 0x4E, 0x1B, 0xA6, 0x28, 0x5D, 0x6C, 0x83, 0x74, 0xA3, 0x84, 0xDA, 0x95, 0xCE, // BIN 1300: 9 pairs
+  0x0F, 0x04, 0x68, 0x09, 0x2A, 0x0A, 0x32, 0x14, 0x5D, 0x1B, 0xCD, 0x1D, 0xFA, 0x35, 0x67, 0x46, 0x5D, 0x46, 0x70, 0x4E, 0x59, 0x68, 0xD4, 0x6B, 0x7E, 0x81, 0xA3, 0x89, 0x9E, 0x8B, 0xD8, // BIN 1301: 15 pairs
+  0x0D, 0x03, 0xD8, 0x05, 0x1F, 0x05, 0xFC, 0x06, 0x64, 0x09, 0x84, 0x0A, 0x2D, 0x1A, 0xFE, 0x69, 0xAD, 0x6B, 0xE1, 0x6D, 0xAE, 0x6E, 0x74, 0x76, 0xA5, 0x87, 0x93, // BIN 1302: 13 pairs
+  0x0B, 0x0B, 0xDC, 0x13, 0x1C, 0x21, 0x82, 0x2F, 0x6C, 0x3A, 0x6A, 0x42, 0x73, 0x4F, 0xAC, 0x6E, 0xBA, 0x93, 0xE0, 0xB8, 0xD3, 0xBC, 0xC5, // BIN 1303: 11 pairs
+  0x09, 0x14, 0x55, 0x16, 0x60, 0x54, 0xB9, 0x57, 0x94, 0x79, 0xC6, 0x93, 0xF9, 0xB0, 0xB3, 0xD9, 0xDB, 0xDF, 0xEE, // BIN 1304: 9 pairs
+  0x0F, 0x01, 0xC3, 0x1A, 0xBE, 0x1E, 0x70, 0x1E, 0x9E, 0x21, 0xF4, 0x47, 0xA0, 0x57, 0xC9, 0x6F, 0xA3, 0x77, 0xD9, 0x79, 0xC5, 0x8C, 0xE9, 0x94, 0x97, 0x97, 0xEC, 0xA7, 0xF6, 0xB6, 0xF6, // BIN 1305: 15 pairs
+  0x0A, 0x02, 0xF9, 0x03, 0x95, 0x06, 0x70, 0x43, 0x99, 0x43, 0x9A, 0x44, 0x7B, 0x51, 0x57, 0x94, 0xD6, 0xA1, 0xCB, 0xC2, 0xF2, // BIN 1306: 10 pairs
+  0x0D, 0x0B, 0xE3, 0x27, 0xA5, 0x31, 0x69, 0x3B, 0xEF, 0x3E, 0x78, 0x5B, 0x5F, 0x5D, 0x6A, 0x63, 0xA2, 0x66, 0xBA, 0x69, 0xCD, 0x8F, 0xAB, 0xAB, 0xC5, 0xBC, 0xBD, // BIN 1307: 13 pairs
+  0x0D, 0x08, 0x3D, 0x09, 0x6D, 0x14, 0x1C, 0x1C, 0x3E, 0x5D, 0xA6, 0x66, 0x8D, 0x76, 0x78, 0x8E, 0xC8, 0xA0, 0xC1, 0xAD, 0xC3, 0xB5, 0xC0, 0xC2, 0xCF, 0xDB, 0xEE, // BIN 1308: 13 pairs
+  0x0E, 0x0B, 0x23, 0x12, 0x46, 0x34, 0x65, 0x37, 0x57, 0x4C, 0x52, 0x4C, 0xA4, 0x53, 0x7E, 0x63, 0xEA, 0x68, 0xB6, 0x6E, 0x76, 0x7C, 0xA9, 0x90, 0xE9, 0x9B, 0xCE, 0xBF, 0xF4, // BIN 1309: 14 pairs
+  0x0F, 0x0C, 0x4A, 0x22, 0x60, 0x35, 0x6A, 0x39, 0x7F, 0x4A, 0x81, 0x4B, 0x6A, 0x54, 0xAC, 0x65, 0xA5, 0x6F, 0xAA, 0x81, 0xD8, 0x8E, 0x9C, 0x97, 0xBF, 0xA5, 0xAB, 0xB6, 0xF4, 0xC4, 0xF9, // BIN 1310: 15 pairs
+  0x0A, 0x0F, 0x78, 0x15, 0x49, 0x18, 0x4E, 0x21, 0xEB, 0x39, 0x78, 0x5D, 0x74, 0x6E, 0xCC, 0x7A, 0xD5, 0x83, 0xB8, 0xB0, 0xB9, // BIN 1311: 10 pairs
+  0x0C, 0x09, 0x4C, 0x0A, 0xF1, 0x2E, 0x55, 0x36, 0x7A, 0x3C, 0x4B, 0x5E, 0xA2, 0x5E, 0xC8, 0x66, 0xCD, 0x6D, 0xEB, 0x6E, 0xAE, 0x81, 0xDA, 0xAD, 0xE7, // BIN 1312: 12 pairs
+  0x10, 0x04, 0x2F, 0x07, 0x23, 0x07, 0x28, 0x22, 0x4C, 0x2B, 0x3F, 0x47, 0xA7, 0x69, 0x9F, 0x7E, 0xB9, 0x91, 0x92, 0x96, 0xA7, 0xA4, 0xB0, 0xB6, 0xC3, 0xB8, 0xDA, 0xBD, 0xFC, 0xCE, 0xF5, 0xE5, 0xF6, // BIN 1313: 16 pairs
+  0x0F, 0x03, 0x8B, 0x04, 0x29, 0x13, 0xC2, 0x16, 0x77, 0x1A, 0x51, 0x21, 0x8F, 0x24, 0xF0, 0x47, 0x79, 0x5C, 0x91, 0x5E, 0xBA, 0x64, 0xEF, 0x69, 0xC8, 0x86, 0xEC, 0x94, 0xDF, 0xD6, 0xF6, // BIN 1314: 15 pairs
+  0x0D, 0x06, 0x5C, 0x07, 0x17, 0x17, 0x4E, 0x22, 0x55, 0x28, 0x57, 0x34, 0x59, 0x40, 0x43, 0x41, 0x46, 0x57, 0x5B, 0x74, 0x9E, 0x80, 0xCD, 0x9E, 0xCB, 0xDB, 0xED, // BIN 1315: 13 pairs
+  0x10, 0x10, 0x37, 0x11, 0x13, 0x16, 0xED, 0x25, 0xE1, 0x2B, 0x45, 0x30, 0x5C, 0x35, 0x43, 0x5F, 0xC0, 0x69, 0x83, 0x6C, 0xB6, 0x85, 0xD8, 0x87, 0xBF, 0x87, 0xC2, 0xB8, 0xD5, 0xC1, 0xF2, 0xD9, 0xDA, // BIN 1316: 16 pairs
+  0x07, 0x05, 0xE3, 0x09, 0x56, 0x12, 0x50, 0x1D, 0xEF, 0x28, 0x59, 0x74, 0x95, 0x7F, 0xB7, // BIN 1317: 7 pairs
+  0x11, 0x0E, 0x31, 0x0E, 0x44, 0x15, 0x4E, 0x22, 0x43, 0x37, 0x5C, 0x3C, 0xF0, 0x3D, 0x43, 0x49, 0x82, 0x4A, 0x7F, 0x71, 0x83, 0x71, 0xE4, 0x7C, 0xB9, 0x7F, 0xBF, 0x8E, 0xCA, 0xB3, 0xFA, 0xB4, 0xF8, 0xB8, 0xBA, // BIN 1318: 17 pairs
+  0x0D, 0x01, 0x5C, 0x02, 0x24, 0x11, 0x2F, 0x30, 0x65, 0x34, 0x5C, 0x43, 0xB9, 0x5A, 0x5F, 0x5E, 0xCA, 0xAA, 0xF6, 0xC3, 0xF2, 0xDF, 0xED, 0xE3, 0xFB, 0xE6, 0xEA, // BIN 1319: 13 pairs
+  0x0A, 0x0E, 0xFC, 0x60, 0xFF, 0x68, 0x8D, 0x6A, 0xA8, 0x72, 0xC3, 0x99, 0xF4, 0x9A, 0xF4, 0xA9, 0xED, 0xBC, 0xC6, 0xCA, 0xFC, // BIN 1320: 10 pairs
+  0x0A, 0x02, 0xE3, 0x2F, 0x3B, 0x63, 0xC0, 0x71, 0xD9, 0x77, 0xAB, 0x8C, 0x8D, 0xC9, 0xE6, 0xD2, 0xEC, 0xD3, 0xF2, 0xE2, 0xF9, // BIN 1321: 10 pairs
+  0x0F, 0x12, 0xE9, 0x18, 0x71, 0x1A, 0x6B, 0x2C, 0x59, 0x42, 0x74, 0x4F, 0x67, 0x57, 0x5A, 0x60, 0x96, 0x67, 0x9D, 0x73, 0xB3, 0x8D, 0xCE, 0xAB, 0xC6, 0xB8, 0xDB, 0xC4, 0xD9, 0xC7, 0xF2, // BIN 1322: 15 pairs
+  0x0E, 0x04, 0xBD, 0x0D, 0x32, 0x18, 0xEC, 0x1B, 0xD4, 0x25, 0x26, 0x2B, 0x6A, 0x39, 0x85, 0x4B, 0x82, 0x69, 0xCA, 0x6C, 0xD0, 0x77, 0xF7, 0xA0, 0xCB, 0xAC, 0xD6, 0xBF, 0xF3, // BIN 1323: 14 pairs
+  0x0B, 0x10, 0xBE, 0x19, 0x7B, 0x21, 0x32, 0x24, 0x3E, 0x41, 0xF9, 0x47, 0xA1, 0x66, 0xC8, 0x75, 0x8E, 0x86, 0xBC, 0x91, 0xA7, 0xB1, 0xB3, // BIN 1324: 11 pairs
+  0x08, 0x04, 0xC9, 0x0C, 0x28, 0x15, 0xFA, 0x1E, 0xE1, 0x51, 0x63, 0x8D, 0xB9, 0xAD, 0xE6, 0xBD, 0xE2, // BIN 1325: 8 pairs
+  0x12, 0x04, 0x0E, 0x06, 0x7B, 0x09, 0x28, 0x0F, 0x38, 0x11, 0x46, 0x49, 0x65, 0x4E, 0x71, 0x5F, 0x8D, 0x64, 0x83, 0x75, 0xC4, 0x84, 0xDF, 0x85, 0xDD, 0x8A, 0xD7, 0x8E, 0xD2, 0x96, 0xE1, 0xAD, 0xE5, 0xB5, 0xCC, 0xE9, 0xFB, // BIN 1326: 18 pairs
+  0x0F, 0x07, 0x2A, 0x09, 0xBD, 0x0A, 0x3D, 0x17, 0x31, 0x1A, 0xEC, 0x1B, 0x8B, 0x1F, 0x57, 0x29, 0x66, 0x6C, 0xB2, 0x6D, 0xD4, 0x78, 0xD7, 0x80, 0xA9, 0x83, 0xBA, 0x8D, 0xCB, 0xAC, 0xE8, // BIN 1327: 15 pairs
+  0x0A, 0x08, 0x40, 0x0F, 0x28, 0x41, 0x5A, 0x4A, 0x84, 0x67, 0x8B, 0x75, 0xA3, 0x75, 0xD3, 0x88, 0xCB, 0x93, 0xD2, 0x95, 0xA9, // BIN 1328: 10 pairs
+  0x09, 0x04, 0xAC, 0x13, 0x65, 0x1D, 0x60, 0x26, 0x6C, 0x2C, 0x60, 0x2F, 0x6D, 0x6C, 0xAE, 0xAA, 0xE8, 0xC8, 0xFC, // BIN 1329: 9 pairs
+  0x10, 0x09, 0xE8, 0x0F, 0xCC, 0x1C, 0xFE, 0x23, 0x5C, 0x2E, 0x6A, 0x3B, 0xE1, 0x3E, 0x7F, 0x48, 0x79, 0x60, 0x7C, 0x6D, 0x83, 0x78, 0xD3, 0x80, 0xCF, 0x84, 0xDB, 0x91, 0xC4, 0x91, 0xD2, 0xC3, 0xFA, // BIN 1330: 16 pairs
+  0x11, 0x04, 0x57, 0x05, 0x35, 0x2C, 0x57, 0x31, 0x68, 0x33, 0x61, 0x34, 0x57, 0x55, 0x76, 0x56, 0xA0, 0x65, 0x9D, 0x68, 0xB4, 0x6A, 0xA5, 0x7D, 0xF6, 0x84, 0xBF, 0x89, 0xCB, 0x8D, 0xC2, 0x90, 0xE3, 0x95, 0xE0, // BIN 1331: 17 pairs
+  0x0E, 0x03, 0x2F, 0x03, 0x4B, 0x07, 0x2F, 0x0F, 0x45, 0x10, 0x2A, 0x1C, 0x39, 0x20, 0xC9, 0x3C, 0x86, 0x66, 0xCA, 0x6C, 0xB4, 0x7C, 0xC0, 0x91, 0x9B, 0x92, 0x96, 0xE0, 0xE4, // BIN 1332: 14 pairs
+  0x0F, 0x0E, 0x42, 0x1A, 0x7B, 0x1C, 0xF7, 0x33, 0x60, 0x47, 0x95, 0x55, 0x8F, 0x68, 0xB2, 0x74, 0xA5, 0x74, 0xAB, 0x76, 0xB5, 0x83, 0x84, 0x85, 0xDA, 0x87, 0xBA, 0xA5, 0xDE, 0xC9, 0xF1, // BIN 1333: 15 pairs
+  0x0C, 0x08, 0x44, 0x09, 0x69, 0x09, 0x9C, 0x0E, 0x2F, 0x1C, 0xFA, 0x32, 0x56, 0x73, 0xAB, 0x7D, 0x87, 0x8A, 0xD5, 0x90, 0xCE, 0xBD, 0xF3, 0xC1, 0xF1, // BIN 1334: 12 pairs
+  0x0F, 0x02, 0x25, 0x07, 0x22, 0x0D, 0x6B, 0x0D, 0xDC, 0x0F, 0x15, 0x12, 0xF5, 0x15, 0x4B, 0x3C, 0x62, 0x40, 0x54, 0x46, 0x71, 0x48, 0x8B, 0x55, 0x8B, 0x6F, 0xA4, 0x73, 0xA3, 0xA9, 0xD8, // BIN 1335: 15 pairs
+  0x0E, 0x1B, 0x38, 0x1B, 0xD0, 0x20, 0x92, 0x2B, 0x2F, 0x41, 0x5B, 0x4A, 0x60, 0x5F, 0xA2, 0x66, 0xEB, 0x6E, 0xB2, 0x78, 0xF8, 0x8B, 0x9D, 0x90, 0x9F, 0x96, 0x9B, 0xD9, 0xDF, // BIN 1336: 14 pairs
+  0x07, 0x08, 0x50, 0x0D, 0x42, 0x10, 0x46, 0x79, 0xC9, 0x81, 0xDF, 0xA3, 0xD9, 0xAF, 0xDC, // BIN 1337: 7 pairs
+  0x03, 0x32, 0x67, 0x4D, 0x7C, 0x97, 0xD6, // BIN 1338: 3 pairs
+  0x0A, 0x17, 0x9E, 0x38, 0x60, 0x3A, 0x5D, 0x42, 0x56, 0x7E, 0xBF, 0x89, 0xBF, 0xA1, 0xB5, 0xC9, 0xDE, 0xD3, 0xFB, 0xD4, 0xE3, // BIN 1339: 10 pairs
+  0x0D, 0x07, 0x36, 0x09, 0x63, 0x0D, 0x72, 0x0D, 0x90, 0x40, 0x73, 0x46, 0x6F, 0x50, 0x6F, 0x5E, 0xD0, 0x61, 0x83, 0x61, 0xA2, 0x6B, 0xC7, 0x82, 0xF8, 0xAB, 0xE7, // BIN 1340: 13 pairs
+  0x12, 0x00, 0xD9, 0x03, 0xE0, 0x13, 0x3D, 0x13, 0x40, 0x1A, 0x29, 0x1E, 0x3F, 0x30, 0x59, 0x38, 0x65, 0x42, 0x48, 0x4C, 0x99, 0x4C, 0x9A, 0x54, 0x8A, 0x60, 0xB3, 0x88, 0x94, 0x92, 0xE0, 0x95, 0xB5, 0xBE, 0xE2, 0xC2, 0xFF, // BIN 1341: 18 pairs
+  0x08, 0x01, 0x77, 0x17, 0xEC, 0x1B, 0xC8, 0x47, 0xC9, 0x65, 0xA8, 0x76, 0xB3, 0x81, 0xDB, 0x83, 0x9C, // BIN 1342: 8 pairs
+  0x0A, 0x0F, 0x53, 0x12, 0x29, 0x18, 0xA5, 0x1B, 0xBB, 0x31, 0x6C, 0x43, 0xF8, 0x5D, 0xAA, 0x63, 0x83, 0x8D, 0xD2, 0xDA, 0xEE, // BIN 1343: 10 pairs
+  0x14, 0x0C, 0x38, 0x1B, 0x2A, 0x1B, 0xCA, 0x1D, 0xFE, 0x24, 0x4B, 0x3C, 0x53, 0x54, 0x9B, 0x5C, 0x87, 0x62, 0x8F, 0x64, 0xD1, 0x71, 0xB5, 0x74, 0x78, 0x74, 0x82, 0x91, 0xBA, 0x95, 0xD6, 0xA9, 0xBB, 0xB5, 0xE8, 0xC9, 0xE5, 0xD4, 0xF2, 0xE4, 0xF3, // BIN 1344: 20 pairs
+  0x07, 0x09, 0x6C, 0x16, 0x86, 0x19, 0x38, 0x6E, 0x89, 0x6E, 0xB6, 0x8F, 0xD2, 0xC3, 0xDA, // BIN 1345: 7 pairs
+  0x0B, 0x0E, 0xEC, 0x16, 0x33, 0x19, 0x6B, 0x2E, 0x67, 0x45, 0x75, 0x7E, 0xC5, 0x87, 0x99, 0x87, 0x9A, 0x8D, 0xD3, 0x9E, 0xBC, 0xDA, 0xED, // BIN 1346: 11 pairs
+  0x0F, 0x16, 0x6B, 0x17, 0x26, 0x19, 0x77, 0x22, 0x64, 0x3F, 0x60, 0x51, 0x5F, 0x53, 0x73, 0x56, 0xA1, 0x6B, 0x8D, 0x89, 0xC7, 0x95, 0xC1, 0x98, 0xC1, 0xA2, 0xEB, 0xBD, 0xE7, 0xC3, 0xDB, // BIN 1347: 15 pairs
+  0x0D, 0x02, 0x14, 0x1C, 0x4A, 0x25, 0x86, 0x2A, 0x61, 0x3C, 0x3E, 0x3C, 0xA5, 0x50, 0xA5, 0x52, 0x9E, 0x7D, 0xBF, 0x7E, 0xC6, 0x86, 0x8D, 0xA5, 0xFA, 0xA6, 0xA9, // BIN 1348: 13 pairs
+  0x0B, 0x06, 0x86, 0x15, 0xFC, 0x16, 0xA8, 0x23, 0x58, 0x35, 0x71, 0x3D, 0x54, 0x4C, 0x7C, 0x62, 0x88, 0x78, 0xB7, 0x7D, 0xDD, 0xF4, 0xFD, // BIN 1349: 11 pairs
+  0x0A, 0x10, 0x5C, 0x14, 0x81, 0x16, 0x2A, 0x26, 0x6D, 0x66, 0xF9, 0x6B, 0xF0, 0x6E, 0xB4, 0xA3, 0xDC, 0xB3, 0xE2, 0xBB, 0xF3, // BIN 1350: 10 pairs
+  0x0D, 0x04, 0xDB, 0x07, 0x1D, 0x1A, 0x77, 0x1E, 0xFE, 0x40, 0x4F, 0x5D, 0xBD, 0x80, 0x97, 0x97, 0xAD, 0xA9, 0xD3, 0xB0, 0xE4, 0xB4, 0xF6, 0xD7, 0xDC, 0xE6, 0xF9, // BIN 1351: 13 pairs
+  0x0A, 0x02, 0x27, 0x04, 0xD4, 0x2E, 0x72, 0x35, 0x70, 0x3C, 0x49, 0x3E, 0x85, 0x7D, 0xD8, 0x80, 0xD0, 0xB2, 0xF8, 0xDD, 0xEE, // BIN 1352: 10 pairs
+  0x12, 0x09, 0xC9, 0x09, 0xFE, 0x0C, 0x6E, 0x0D, 0xE3, 0x15, 0x43, 0x18, 0x31, 0x4A, 0x85, 0x61, 0x67, 0x61, 0xEA, 0x66, 0xAD, 0x68, 0xAE, 0x69, 0xB6, 0x81, 0x83, 0x81, 0xBF, 0x83, 0xBF, 0x8B, 0xDA, 0xB4, 0xF4, 0xC3, 0xE8, // BIN 1353: 18 pairs
+  0x09, 0x11, 0xEC, 0x2F, 0x6E, 0x44, 0x54, 0x4B, 0x79, 0x4E, 0x61, 0x62, 0x81, 0x68, 0xD7, 0x77, 0x8D, 0xC0, 0xFC, // BIN 1354: 9 pairs
+  0x0C, 0x23, 0x60, 0x2B, 0x8C, 0x3A, 0x6B, 0x3B, 0x73, 0x40, 0x77, 0x41, 0xEA, 0x54, 0x6A, 0x5D, 0x65, 0x62, 0x84, 0x83, 0xBB, 0xB1, 0xE4, 0xC1, 0xF0, // BIN 1355: 12 pairs
+  0x05, 0x07, 0x18, 0x30, 0x57, 0x33, 0x65, 0x69, 0xD0, 0xE5, 0xEA, // BIN 1356: 5 pairs
+  0x11, 0x09, 0x61, 0x0B, 0x32, 0x24, 0xF7, 0x2D, 0x64, 0x33, 0x5F, 0x37, 0x67, 0x47, 0x51, 0x47, 0x80, 0x60, 0x7E, 0x62, 0x70, 0x66, 0xF6, 0x77, 0xE4, 0x8A, 0xD2, 0x8B, 0xD2, 0x8B, 0xEA, 0xA9, 0xAA, 0xD8, 0xED, // BIN 1357: 17 pairs
+  0x08, 0x06, 0x3D, 0x51, 0x71, 0x59, 0xC9, 0x67, 0x78, 0x68, 0x9F, 0x70, 0xB5, 0x85, 0xB1, 0xB9, 0xD6, // BIN 1358: 8 pairs
+  0x15, 0x01, 0x35, 0x0A, 0x40, 0x0C, 0xCC, 0x15, 0x20, 0x16, 0x1F, 0x19, 0xB3, 0x1E, 0xA5, 0x24, 0x36, 0x3D, 0x4F, 0x4C, 0x80, 0x5C, 0x9D, 0x86, 0xE9, 0x87, 0xC3, 0x8E, 0xAC, 0x96, 0xBB, 0xA0, 0xB5, 0xA3, 0xC7, 0xA7, 0xB5, 0xBF, 0xD1, 0xC0, 0xF1, 0xCB, 0xF0, // BIN 1359: 21 pairs
+  0x09, 0x04, 0xD7, 0x10, 0x33, 0x62, 0x94, 0x66, 0xD0, 0x76, 0x92, 0x7E, 0x90, 0x84, 0x8E, 0xBF, 0xF6, 0xC2, 0xCC, // BIN 1360: 9 pairs
+  0x0B, 0x21, 0xC6, 0x4F, 0x7E, 0x51, 0x6E, 0x54, 0x65, 0x7D, 0xF9, 0x7E, 0xC4, 0x97, 0xD2, 0x9D, 0xF0, 0x9E, 0xFA, 0xC0, 0xC2, 0xE0, 0xFE, // BIN 1361: 11 pairs
+  0x09, 0x00, 0x2E, 0x02, 0x23, 0x1B, 0x95, 0x54, 0x95, 0x60, 0x9D, 0x62, 0x92, 0x75, 0x87, 0xBA, 0xF3, 0xC5, 0xCB, // BIN 1362: 9 pairs
+  0x14, 0x02, 0xF6, 0x03, 0xB6, 0x04, 0xE0, 0x06, 0x8C, 0x09, 0x49, 0x0E, 0xED, 0x0F, 0xC0, 0x12, 0x38, 0x52, 0x54, 0x5F, 0xCC, 0x6D, 0xAF, 0x76, 0xB0, 0x76, 0xB8, 0x7E, 0xC9, 0x82, 0xAB, 0x8E, 0xCD, 0x9D, 0xBA, 0x9E, 0xAB, 0xBF, 0xC7, 0xEC, 0xFB, // BIN 1363: 20 pairs
+  0x0F, 0x04, 0x66, 0x0A, 0x58, 0x0B, 0x52, 0x0D, 0x60, 0x10, 0xF5, 0x2A, 0x5F, 0x38, 0x5E, 0x69, 0xB2, 0x7A, 0xBF, 0x7D, 0xDA, 0x9D, 0xA6, 0xA6, 0xF6, 0xB3, 0xD6, 0xD8, 0xEE, 0xEF, 0xF1, // BIN 1364: 15 pairs
+  0x0A, 0x07, 0x31, 0x17, 0x71, 0x1B, 0xD7, 0x2B, 0xBE, 0x36, 0x7F, 0x38, 0x67, 0x69, 0xAE, 0x72, 0xB5, 0xC3, 0xD3, 0xEE, 0xF4, // BIN 1365: 10 pairs
+  0x0C, 0x04, 0x31, 0x0F, 0xCF, 0x10, 0x52, 0x39, 0x6F, 0x43, 0x44, 0x50, 0x90, 0x58, 0x9D, 0x63, 0xBB, 0x8C, 0xB0, 0xA8, 0xE5, 0xCB, 0xF5, 0xCB, 0xF7, // BIN 1366: 12 pairs
+  0x0E, 0x0F, 0x82, 0x13, 0x35, 0x17, 0x2F, 0x36, 0x78, 0x61, 0xC0, 0x6E, 0xA3, 0x7A, 0xB7, 0x7B, 0xEC, 0x7F, 0x89, 0x83, 0xA8, 0x8C, 0xE3, 0xA3, 0xA8, 0xD6, 0xFB, 0xDD, 0xED, // BIN 1367: 14 pairs
+  0x13, 0x00, 0x3B, 0x09, 0x0E, 0x0F, 0x33, 0x1F, 0x59, 0x26, 0x2B, 0x26, 0x3B, 0x4B, 0x60, 0x5F, 0xBB, 0x69, 0xB4, 0x6D, 0xF6, 0x76, 0x98, 0x7D, 0xB7, 0x85, 0xB0, 0x85, 0xDB, 0x87, 0xBB, 0x99, 0xAB, 0x9A, 0xAB, 0x9B, 0xF6, 0xC3, 0xD5, // BIN 1368: 19 pairs
+  0x0F, 0x0E, 0x13, 0x24, 0x49, 0x3C, 0x55, 0x48, 0x9B, 0x4D, 0x80, 0x59, 0xEA, 0x5B, 0x86, 0x6E, 0xAF, 0x7B, 0xDC, 0x7E, 0xC8, 0x7F, 0xD8, 0x85, 0xF6, 0x98, 0xCB, 0xAA, 0xE2, 0xAF, 0xD9, // BIN 1369: 15 pairs
+  0x0B, 0x04, 0x81, 0x0D, 0x2D, 0x27, 0x6A, 0x27, 0xE1, 0x56, 0xA7, 0x72, 0x79, 0x75, 0xD5, 0x7C, 0xC5, 0x7C, 0xC6, 0x84, 0xB7, 0x8C, 0xA3, // BIN 1370: 11 pairs
+  0x0F, 0x01, 0xE5, 0x20, 0x9B, 0x33, 0x63, 0x40, 0x74, 0x47, 0xEB, 0x55, 0x93, 0x71, 0x8E, 0x7F, 0xB1, 0x86, 0xCB, 0x89, 0xBE, 0x8E, 0xCC, 0x94, 0xE0, 0xCB, 0xF3, 0xEA, 0xF2, 0xF4, 0xFA, // BIN 1371: 15 pairs
+  0x09, 0x1E, 0x6B, 0x2C, 0x5C, 0x2C, 0x65, 0x31, 0x6D, 0x43, 0xAC, 0x62, 0x95, 0x63, 0xCC, 0x6C, 0xEB, 0x8B, 0xBC, // BIN 1372: 9 pairs
+  0x09, 0x0F, 0xD4, 0x12, 0xFB, 0x4E, 0x57, 0x5C, 0x96, 0x5D, 0x76, 0x60, 0x8E, 0x75, 0xF6, 0x85, 0xDF, 0xB8, 0xDF, // BIN 1373: 9 pairs
+  0x06, 0x0A, 0xBE, 0x3F, 0x75, 0x6D, 0xF9, 0x91, 0xDC, 0x94, 0xC2, 0xD5, 0xD9, // BIN 1374: 6 pairs
+  0x08, 0x14, 0x84, 0x14, 0xB9, 0x19, 0xE9, 0x1E, 0x45, 0x78, 0xBF, 0x8A, 0xC1, 0x95, 0xEB, 0xA7, 0xE8, // BIN 1375: 8 pairs
+  0x13, 0x03, 0x4A, 0x04, 0xDA, 0x08, 0x23, 0x09, 0x75, 0x34, 0x67, 0x36, 0x85, 0x38, 0x66, 0x3D, 0x73, 0x44, 0xFF, 0x49, 0x6A, 0x4A, 0x82, 0x5C, 0x6F, 0x5E, 0xD4, 0x60, 0xBE, 0x6B, 0x79, 0x6E, 0xC8, 0x8F, 0xE0, 0x97, 0xB2, 0x9D, 0xE9, // BIN 1376: 19 pairs
+  0x08, 0x0C, 0x33, 0x1C, 0xF0, 0x1F, 0x50, 0x21, 0xBD, 0x36, 0x52, 0x52, 0xFF, 0x8E, 0xBD, 0xAF, 0xE3, // BIN 1377: 8 pairs
+  0x0C, 0x07, 0xE7, 0x0A, 0x9E, 0x0C, 0x45, 0x18, 0x26, 0x1F, 0x52, 0x21, 0xC5, 0x3B, 0xBE, 0x3C, 0x73, 0x53, 0x8F, 0x91, 0xD6, 0x98, 0xB5, 0xD9, 0xDD, // BIN 1378: 12 pairs
+  0x10, 0x06, 0x40, 0x0A, 0x28, 0x16, 0x4E, 0x25, 0x6A, 0x3D, 0x77, 0x59, 0x67, 0x5C, 0x83, 0x6E, 0xCF, 0x79, 0xC8, 0x79, 0xCC, 0x7F, 0xB0, 0x82, 0xD8, 0x8E, 0xD0, 0xB4, 0xDC, 0xBD, 0xCB, 0xC6, 0xCB, // BIN 1379: 16 pairs
+  0x07, 0x15, 0x51, 0x16, 0xD1, 0x2E, 0x62, 0x42, 0x5D, 0x6C, 0xD4, 0x91, 0xE1, 0x94, 0xB8, // BIN 1380: 7 pairs
+  0x09, 0x03, 0xC4, 0x14, 0x75, 0x19, 0xEE, 0x32, 0x6A, 0x3E, 0x67, 0x4D, 0x8F, 0x6D, 0xD7, 0x7E, 0xCA, 0xA6, 0xE8, // BIN 1381: 9 pairs
+  0x0A, 0x03, 0x1F, 0x07, 0x39, 0x1C, 0x64, 0x29, 0x69, 0x41, 0x8B, 0x49, 0x79, 0x4C, 0x50, 0x5B, 0x69, 0x6E, 0xCD, 0xA9, 0xD5, // BIN 1382: 10 pairs
+  0x0A, 0x06, 0x23, 0x0D, 0xF2, 0x13, 0xB5, 0x27, 0x86, 0x31, 0x6E, 0x41, 0x42, 0x5A, 0x86, 0x74, 0xA2, 0x96, 0xDE, 0xD0, 0xE3, // BIN 1383: 10 pairs
+  0x0F, 0x08, 0xC3, 0x08, 0xF5, 0x0C, 0xD4, 0x10, 0x64, 0x2A, 0x63, 0x44, 0x4F, 0x56, 0xBD, 0x5D, 0x87, 0x71, 0xEC, 0x78, 0xB1, 0x78, 0xD5, 0x81, 0x8E, 0x9D, 0xAA, 0xD2, 0xF8, 0xE1, 0xE7, // BIN 1384: 15 pairs
+  0x13, 0x04, 0x3E, 0x09, 0xDD, 0x0C, 0x8F, 0x15, 0x50, 0x17, 0xA5, 0x19, 0x51, 0x35, 0xFF, 0x37, 0x61, 0x39, 0x52, 0x47, 0xA6, 0x56, 0xF8, 0x5B, 0x8D, 0x7F, 0xDD, 0x82, 0x91, 0x95, 0xCB, 0x97, 0xF7, 0x98, 0x9D, 0x9D, 0xA1, 0xD0, 0xF5, // BIN 1385: 19 pairs
+  0x0C, 0x41, 0x9B, 0x4C, 0x92, 0x5C, 0xEF, 0x6E, 0xCA, 0x7E, 0xCC, 0x81, 0xF4, 0xA1, 0xA9, 0xA2, 0xC3, 0xA2, 0xE2, 0xB2, 0xDC, 0xB5, 0xF7, 0xC2, 0xF1, // BIN 1386: 12 pairs
+  0x0B, 0x00, 0xD1, 0x02, 0x2B, 0x06, 0x77, 0x35, 0x4F, 0x3C, 0x4D, 0x3F, 0x6A, 0x54, 0x98, 0x83, 0xC1, 0x8A, 0xD8, 0x8B, 0xDD, 0xF2, 0xFF, // BIN 1387: 11 pairs
+  0x0C, 0x03, 0xE8, 0x11, 0xED, 0x4D, 0x60, 0x4D, 0x93, 0x4F, 0x9B, 0x5E, 0xAD, 0x63, 0x67, 0x76, 0xB1, 0x78, 0xB0, 0x79, 0x97, 0x8E, 0xCF, 0xC1, 0xF7, // BIN 1388: 12 pairs
+  0x14, 0x00, 0x23, 0x00, 0xBE, 0x04, 0x9C, 0x08, 0x90, 0x0C, 0xCF, 0x0E, 0x46, 0x19, 0xE4, 0x24, 0x72, 0x41, 0xF6, 0x4C, 0x8B, 0x52, 0x90, 0x59, 0x8D, 0x66, 0xB6, 0x67, 0x94, 0x6F, 0xAC, 0x7F, 0xDA, 0xA0, 0xF6, 0xAA, 0xF4, 0xB2, 0xF6, 0xB9, 0xF3, // BIN 1389: 20 pairs
+  0x08, 0x01, 0xE6, 0x04, 0x84, 0x39, 0xF8, 0x69, 0xEB, 0x6A, 0x6E, 0x6C, 0xAF, 0xA7, 0xF4, 0xE0, 0xEC, // BIN 1390: 8 pairs
+  0x0F, 0x09, 0x38, 0x16, 0x8C, 0x2B, 0x67, 0x4A, 0x79, 0x62, 0x77, 0x66, 0x9F, 0x71, 0xC2, 0x75, 0xF9, 0x79, 0xCA, 0x87, 0xCB, 0x92, 0xBC, 0xA9, 0xC8, 0xCE, 0xEA, 0xD3, 0xD9, 0xDB, 0xE9, // BIN 1391: 15 pairs
+  0x0B, 0x30, 0x67, 0x4E, 0x77, 0x64, 0xA9, 0x67, 0x82, 0x8C, 0xB1, 0x9E, 0xDE, 0x9F, 0xDE, 0xB1, 0xEB, 0xC3, 0xDF, 0xC5, 0xF1, 0xE5, 0xF9, // BIN 1392: 11 pairs
+  0x0F, 0x01, 0x90, 0x09, 0x3F, 0x0C, 0xDD, 0x0E, 0xF1, 0x19, 0x86, 0x58, 0x91, 0x70, 0xD9, 0x7C, 0xC9, 0x93, 0xAB, 0xA7, 0xF9, 0xA9, 0xCA, 0xB2, 0xF4, 0xB4, 0xE3, 0xB8, 0xBB, 0xD0, 0xFB, // BIN 1393: 15 pairs
+  0x0B, 0x03, 0x31, 0x06, 0x44, 0x0F, 0xCD, 0x18, 0x70, 0x48, 0x80, 0x60, 0x79, 0x7B, 0x8D, 0x7B, 0xC1, 0x81, 0xB7, 0x84, 0xF4, 0xB6, 0xDC, // BIN 1394: 11 pairs
+  0x0B, 0x04, 0x11, 0x0F, 0x55, 0x10, 0x71, 0x12, 0x52, 0x18, 0x2F, 0x20, 0x23, 0x29, 0x68, 0x58, 0x89, 0x5D, 0xC6, 0x93, 0xF4, 0xB8, 0xCA, // BIN 1395: 11 pairs
+  0x0B, 0x12, 0xE4, 0x1D, 0x71, 0x32, 0x6B, 0x47, 0xAA, 0x57, 0xF9, 0x64, 0xF7, 0x65, 0x8A, 0x87, 0xB3, 0x89, 0xCE, 0xAE, 0xDC, 0xBC, 0xF1, // BIN 1396: 11 pairs
+  0x1A, 0x00, 0x1F, 0x04, 0xCC, 0x0B, 0x2D, 0x0B, 0x42, 0x18, 0x51, 0x23, 0x56, 0x30, 0x58, 0x36, 0xF8, 0x43, 0x79, 0x55, 0x83, 0x6E, 0xEA, 0x79, 0xA9, 0x7C, 0x90, 0x7D, 0xDB, 0x7D, 0xDF, 0x8B, 0xDB, 0x8D, 0xD4, 0x9D, 0xEF, 0xA3, 0xD1, 0xA3, 0xE5, 0xAB, 0xAC, 0xAD, 0xF8, 0xB8, 0xC8, 0xBE, 0xD6, 0xCF, 0xFB, 0xD2, 0xF9, // BIN 1397: 26 pairs
+  0x0C, 0x07, 0xEE, 0x09, 0x7D, 0x11, 0xFC, 0x16, 0x72, 0x16, 0xC7, 0x18, 0xEE, 0x3D, 0xFF, 0x41, 0xBD, 0x64, 0x6F, 0x8E, 0xB3, 0xB7, 0xE4, 0xC6, 0xF1, // BIN 1398: 12 pairs
+  0x0E, 0x0C, 0xC0, 0x13, 0x73, 0x1A, 0x72, 0x2D, 0x67, 0x33, 0x5C, 0x35, 0x54, 0x53, 0x8B, 0x5A, 0x69, 0x5F, 0x83, 0x73, 0x95, 0x8F, 0xF6, 0xAA, 0xC2, 0xBF, 0xF8, 0xC1, 0xC5, // BIN 1399: 14 pairs
+  0x04, 0x1C, 0x4B, 0x5B, 0x8E, 0xB8, 0xDD, 0xCE, 0xEF, // BIN 1400: 4 pairs
+  0x0A, 0x17, 0x51, 0x1A, 0x31, 0x24, 0x39, 0x4E, 0x63, 0x57, 0xC0, 0x6C, 0x8E, 0x7A, 0xD8, 0x7E, 0xB5, 0xB3, 0xFD, 0xB6, 0xE3, // BIN 1401: 10 pairs
+  0x0F, 0x09, 0xDF, 0x0A, 0xA5, 0x1B, 0x33, 0x3A, 0x47, 0x41, 0x79, 0x42, 0x6F, 0x7C, 0xBF, 0x88, 0xEF, 0x91, 0xBB, 0xA1, 0xF6, 0xA9, 0xFF, 0xB0, 0xBE, 0xD1, 0xFE, 0xD4, 0xDC, 0xDF, 0xE9, // BIN 1402: 15 pairs
+  0x0F, 0x04, 0xCF, 0x05, 0xDC, 0x05, 0xE6, 0x06, 0xC3, 0x0A, 0xE3, 0x0F, 0xD7, 0x1B, 0x28, 0x20, 0x2D, 0x2D, 0x47, 0x33, 0x67, 0x5B, 0x6C, 0x5B, 0x78, 0x6E, 0xF8, 0x8A, 0xCE, 0xB8, 0xE8, // BIN 1403: 15 pairs
+  0x15, 0x00, 0xE8, 0x03, 0x29, 0x03, 0x53, 0x03, 0xB4, 0x0C, 0xF1, 0x0F, 0xDD, 0x17, 0xEE, 0x19, 0xED, 0x1B, 0xFB, 0x1C, 0x49, 0x26, 0x6E, 0x43, 0x92, 0x4C, 0x65, 0x55, 0x8A, 0x56, 0x94, 0x5D, 0x73, 0x6E, 0x73, 0x82, 0xEB, 0x98, 0xA9, 0xAB, 0xE9, 0xBF, 0xE4, // BIN 1404: 21 pairs
+  0x0D, 0x05, 0xE5, 0x09, 0x33, 0x09, 0x54, 0x19, 0x29, 0x3B, 0x4A, 0x40, 0x7B, 0x41, 0xC6, 0x58, 0x62, 0x5C, 0xC7, 0x68, 0xD3, 0x9D, 0xA0, 0xAC, 0xFC, 0xB8, 0xD7, // BIN 1405: 13 pairs
+  0x0E, 0x04, 0xE7, 0x34, 0x58, 0x40, 0xFF, 0x53, 0x93, 0x66, 0xD4, 0x72, 0xAB, 0x79, 0xC4, 0x88, 0xA2, 0x8E, 0xA4, 0x8E, 0xC9, 0x97, 0xB4, 0xA0, 0xA9, 0xB2, 0xE3, 0xE2, 0xF0, // BIN 1406: 14 pairs
+  0x0C, 0x02, 0xE1, 0x0A, 0x2C, 0x0B, 0x90, 0x1A, 0xB3, 0x42, 0x77, 0x48, 0xF9, 0x4C, 0xB9, 0x5E, 0x8D, 0x5E, 0xB6, 0x7A, 0x89, 0xA8, 0xE6, 0xAB, 0xE1, // BIN 1407: 12 pairs
+  0x0E, 0x18, 0x60, 0x1A, 0x86, 0x3D, 0x74, 0x4D, 0x7E, 0x51, 0x77, 0x52, 0xA5, 0x55, 0x92, 0x5D, 0xC5, 0x66, 0xB2, 0x70, 0xE4, 0x85, 0xF9, 0x89, 0xBA, 0xBC, 0xEF, 0xD6, 0xFC, // BIN 1408: 14 pairs
+  0x16, 0x07, 0x2C, 0x0C, 0x78, 0x0C, 0xD7, 0x0D, 0x3A, 0x13, 0x6A, 0x14, 0xF3, 0x1D, 0x36, 0x25, 0xBE, 0x27, 0x4A, 0x34, 0x61, 0x35, 0x72, 0x53, 0x76, 0x66, 0xB4, 0x74, 0xB3, 0x87, 0xC4, 0x90, 0xB7, 0x94, 0xEA, 0x9F, 0xE2, 0xB8, 0xD0, 0xBC, 0xF2, 0xBD, 0xC1, 0xF2, 0xF8, // BIN 1409: 22 pairs
+  0x09, 0x0A, 0x30, 0x0A, 0xF3, 0x0F, 0x2C, 0x22, 0xFF, 0x79, 0xBF, 0x7A, 0xDD, 0x9D, 0xEC, 0xA3, 0xE6, 0xD6, 0xFA, // BIN 1410: 9 pairs
+  0x07, 0x0A, 0x3A, 0x1F, 0xFC, 0x5B, 0x8A, 0x61, 0xBB, 0x69, 0xD4, 0x9B, 0xC1, 0xCF, 0xF5, // BIN 1411: 7 pairs
+  0x17, 0x05, 0xBE, 0x0C, 0x2C, 0x12, 0x9E, 0x19, 0x72, 0x24, 0x9E, 0x37, 0x58, 0x47, 0x4E, 0x6B, 0xD1, 0x6C, 0x87, 0x72, 0x80, 0x72, 0xEF, 0x77, 0x7E, 0x7E, 0xCD, 0x82, 0xDA, 0x8D, 0xD5, 0x8E, 0xD3, 0xA2, 0xDE, 0xA6, 0xC2, 0xA6, 0xE2, 0xA9, 0xE0, 0xCA, 0xE3, 0xD9, 0xF3, 0xEB, 0xFE, // BIN 1412: 23 pairs
+  0x09, 0x06, 0x50, 0x0F, 0x9B, 0x25, 0xFD, 0x2E, 0x4C, 0x3C, 0x8C, 0x7C, 0xC8, 0xA9, 0xDA, 0xAA, 0xF9, 0xBA, 0xF1, // BIN 1413: 9 pairs
+  0x05, 0x0A, 0x44, 0x0C, 0xF5, 0x2D, 0x5D, 0x68, 0xAF, 0x85, 0x89, // BIN 1414: 5 pairs
+  0x09, 0x09, 0x99, 0x09, 0x9A, 0x18, 0xBE, 0x38, 0x69, 0x44, 0x86, 0x47, 0x7C, 0x56, 0xC6, 0xBB, 0xF1, 0xED, 0xFC, // BIN 1415: 9 pairs
+  0x13, 0x05, 0x2D, 0x0C, 0x53, 0x0D, 0x46, 0x15, 0x41, 0x36, 0x6F, 0x37, 0x5F, 0x48, 0xEA, 0x4B, 0x7C, 0x4C, 0x7E, 0x4F, 0xF8, 0x6A, 0x8B, 0x73, 0xBE, 0x79, 0xCD, 0x7C, 0xC4, 0x8B, 0xA9, 0xA4, 0xFC, 0xA5, 0xCE, 0xC1, 0xC6, 0xDE, 0xFC, // BIN 1416: 19 pairs
+  0x06, 0x05, 0xE7, 0x66, 0x83, 0xA5, 0xFD, 0xB6, 0xF9, 0xD8, 0xE9, 0xDA, 0xE9, // BIN 1417: 6 pairs
+  0x10, 0x01, 0xDE, 0x0C, 0xCD, 0x0F, 0xD0, 0x12, 0x26, 0x14, 0xA4, 0x15, 0x4D, 0x23, 0x62, 0x28, 0x61, 0x29, 0x6C, 0x48, 0xBD, 0x7A, 0xDA, 0x88, 0xDC, 0x9D, 0xE2, 0xA8, 0xD6, 0xB1, 0xEA, 0xCD, 0xFB, // BIN 1418: 16 pairs
+  0x0A, 0x0C, 0xDF, 0x1B, 0xBA, 0x1D, 0x3E, 0x25, 0x8C, 0x2C, 0x61, 0x3B, 0x90, 0x54, 0x74, 0x66, 0xAE, 0x6D, 0x8E, 0xAC, 0xCE, // BIN 1419: 10 pairs
+  0x0A, 0x00, 0xDE, 0x24, 0x53, 0x24, 0xEF, 0x3E, 0x82, 0x61, 0xCC, 0x6D, 0xD3, 0x88, 0xB7, 0xA4, 0xE8, 0xB0, 0xEB, 0xB1, 0xBE, // BIN 1420: 10 pairs
+  0x0D, 0x09, 0x2C, 0x0E, 0xF3, 0x1B, 0xDD, 0x39, 0x82, 0x3B, 0x62, 0x41, 0xC5, 0x4E, 0x5F, 0x5A, 0x6C, 0x7B, 0xE9, 0x7E, 0xBC, 0x83, 0xC2, 0xA8, 0xB7, 0xC8, 0xE3, // BIN 1421: 13 pairs
+  0x0A, 0x0F, 0x92, 0x15, 0x52, 0x2E, 0x77, 0x63, 0x9F, 0x7A, 0xF6, 0x82, 0xDD, 0x87, 0x9C, 0xC5, 0xE6, 0xD6, 0xE1, 0xF0, 0xF5, // BIN 1422: 10 pairs
+  0x05, 0x04, 0x5F, 0x19, 0xA8, 0x48, 0x7C, 0x62, 0x91, 0x8D, 0xD7, // BIN 1423: 5 pairs
+  0x0D, 0x04, 0x2A, 0x05, 0x32, 0x3B, 0x74, 0x3C, 0xF7, 0x6C, 0xF6, 0x6F, 0x77, 0x7A, 0xB1, 0x7C, 0xCC, 0x88, 0xE4, 0x96, 0xE4, 0xA9, 0xD0, 0xCD, 0xF5, 0xD6, 0xF9, // BIN 1424: 13 pairs
+  0x0F, 0x11, 0x50, 0x27, 0x67, 0x36, 0x50, 0x4D, 0x74, 0x63, 0xBA, 0x69, 0x8E, 0x70, 0xC2, 0x7C, 0xCA, 0x7F, 0xDB, 0x82, 0x96, 0x89, 0xD1, 0x9B, 0xCB, 0x9E, 0xFD, 0xC2, 0xFA, 0xC3, 0xDD, // BIN 1425: 15 pairs
+  0x0C, 0x00, 0x3C, 0x04, 0xD5, 0x09, 0xD4, 0x3B, 0xA8, 0x3D, 0x7B, 0x45, 0x5C, 0x56, 0xA6, 0x69, 0xAF, 0x8B, 0xDF, 0x99, 0xD6, 0x9A, 0xD6, 0xBA, 0xC3, // BIN 1426: 12 pairs
+  0x0D, 0x04, 0x6D, 0x20, 0xFB, 0x21, 0x51, 0x24, 0x77, 0x28, 0x60, 0x37, 0x63, 0x45, 0x78, 0x4C, 0x6A, 0x4D, 0x9C, 0x57, 0xF6, 0x77, 0x7C, 0x83, 0xAC, 0x83, 0xC4, // BIN 1427: 13 pairs
+  0x07, 0x03, 0xB2, 0x08, 0x32, 0x08, 0x52, 0x36, 0x3C, 0x4F, 0x52, 0x6C, 0xF9, 0xBF, 0xED, // BIN 1428: 7 pairs
+  0x0A, 0x09, 0x4B, 0x12, 0x31, 0x1C, 0x60, 0x3A, 0x59, 0x5A, 0x8D, 0x5E, 0xD7, 0x5F, 0xBA, 0x6A, 0xA9, 0x7E, 0xCF, 0xA7, 0xA9, // BIN 1429: 10 pairs
+  0x0E, 0x00, 0x04, 0x01, 0x3D, 0x09, 0x11, 0x13, 0x96, 0x24, 0x4D, 0x38, 0x5C, 0x56, 0xC5, 0x69, 0x87, 0x79, 0xCF, 0x84, 0x87, 0x96, 0xE3, 0xAE, 0xD9, 0xBF, 0xE9, 0xC3, 0xFD, // BIN 1430: 14 pairs
+  0x0F, 0x0B, 0x6B, 0x21, 0x22, 0x48, 0xC6, 0x58, 0x96, 0x59, 0x83, 0x5E, 0xB4, 0x6E, 0xD0, 0x76, 0xA1, 0x9D, 0xBB, 0xB0, 0xE9, 0xB1, 0xE9, 0xCC, 0xFB, 0xCD, 0xE3, 0xCE, 0xF4, 0xD0, 0xDC, // BIN 1431: 15 pairs
+  0x0B, 0x03, 0x55, 0x04, 0x4F, 0x0B, 0x72, 0x0E, 0xE9, 0x5F, 0xCF, 0x6F, 0x9D, 0x7A, 0xB0, 0x7B, 0xBC, 0x7F, 0xDF, 0x8E, 0xD6, 0xAE, 0xE3, // BIN 1432: 11 pairs
+  0x0D, 0x00, 0xE2, 0x04, 0xCD, 0x05, 0xD9, 0x0B, 0xF5, 0x1D, 0x4A, 0x44, 0x76, 0x55, 0x9C, 0x5A, 0x78, 0x5B, 0x66, 0x69, 0xF6, 0x69, 0xF9, 0x6D, 0xC4, 0xA9, 0xDB, // BIN 1433: 13 pairs
+  0x0A, 0x0F, 0xDF, 0x1F, 0x5D, 0x49, 0x60, 0x51, 0x79, 0x5E, 0xB2, 0x6B, 0x80, 0x6C, 0xD7, 0xA3, 0xE3, 0xB4, 0xD9, 0xE2, 0xF8, // BIN 1434: 10 pairs
+  0x11, 0x02, 0xE2, 0x0C, 0xE8, 0x14, 0x35, 0x22, 0x4F, 0x24, 0x6A, 0x28, 0x5F, 0x37, 0x6A, 0x4C, 0xAC, 0x76, 0xAF, 0x7D, 0xB1, 0x7F, 0xF6, 0x86, 0xA3, 0x87, 0xCE, 0x9D, 0xFF, 0xAB, 0xE8, 0xB2, 0xD9, 0xDF, 0xFE, // BIN 1435: 17 pairs
+  0x08, 0x04, 0xD0, 0x17, 0x70, 0x30, 0x61, 0x39, 0xA4, 0x3B, 0xB3, 0x3C, 0x74, 0x6F, 0xAD, 0xC6, 0xE6, // BIN 1436: 8 pairs
+  0x0B, 0x01, 0xF1, 0x03, 0xAD, 0x0C, 0xD0, 0x39, 0x50, 0x45, 0x7A, 0x4F, 0x95, 0x51, 0x7C, 0x68, 0xD5, 0x76, 0xAE, 0x8E, 0xC5, 0xA9, 0xE7, // BIN 1437: 11 pairs
+  0x0A, 0x0A, 0x34, 0x2C, 0x67, 0x63, 0xAD, 0x6A, 0x94, 0x8F, 0x91, 0x92, 0xCE, 0xA6, 0xF4, 0xB6, 0xF3, 0xD2, 0xFC, 0xDE, 0xFF, // BIN 1438: 10 pairs
+  0x0F, 0x09, 0x4D, 0x0D, 0xC3, 0x15, 0x4C, 0x16, 0x38, 0x17, 0x60, 0x1C, 0xEF, 0x2B, 0xB3, 0x32, 0x5D, 0x34, 0x5F, 0x48, 0x98, 0x5F, 0x67, 0x86, 0xE3, 0xA7, 0xE2, 0xB8, 0xD4, 0xD2, 0xFB, // BIN 1439: 15 pairs
+  0x0A, 0x07, 0x33, 0x09, 0xD7, 0x12, 0x5C, 0x18, 0xE9, 0x46, 0x77, 0x57, 0xCC, 0x78, 0xEB, 0x8C, 0xCE, 0xB8, 0xCD, 0xC9, 0xFB, // BIN 1440: 10 pairs
+  0x09, 0x2A, 0x60, 0x2E, 0xF0, 0x47, 0x5A, 0x63, 0xCF, 0x6D, 0x87, 0x76, 0x8F, 0x8A, 0xCB, 0x92, 0xD6, 0xA9, 0xF7, // BIN 1441: 9 pairs
+  0x0E, 0x04, 0x28, 0x04, 0x59, 0x06, 0xE5, 0x09, 0xCC, 0x25, 0x67, 0x2A, 0x5E, 0x54, 0xA0, 0x59, 0xC0, 0x5B, 0x8C, 0x87, 0xA5, 0x8E, 0xC7, 0xA3, 0xB3, 0xB3, 0xB7, 0xD0, 0xF2, // BIN 1442: 14 pairs
+  0x10, 0x0F, 0xCA, 0x18, 0xED, 0x24, 0x7B, 0x29, 0x6D, 0x46, 0x59, 0x47, 0x5B, 0x4F, 0x98, 0x5A, 0x8E, 0x5F, 0xCD, 0x68, 0xC4, 0x73, 0x82, 0x76, 0xA0, 0x80, 0xBC, 0x8D, 0xC3, 0x97, 0xED, 0xCF, 0xE3, // BIN 1443: 16 pairs
+  0x0E, 0x09, 0xF2, 0x0B, 0xC3, 0x0F, 0xC8, 0x19, 0x8C, 0x2C, 0x5F, 0x4E, 0x6E, 0x50, 0x54, 0x62, 0x93, 0x73, 0x78, 0x73, 0xA2, 0x76, 0x7F, 0x86, 0xB0, 0x9D, 0xE5, 0xA9, 0xCD, // BIN 1444: 14 pairs
+  0x0E, 0x09, 0x93, 0x0A, 0x2A, 0x0A, 0xFC, 0x14, 0x7D, 0x1E, 0x5A, 0x22, 0x65, 0x2B, 0xFD, 0x59, 0xA2, 0x5D, 0xA2, 0x7E, 0xD0, 0x83, 0xA4, 0x8E, 0xC6, 0x9B, 0xF9, 0x9D, 0xA7, // BIN 1445: 14 pairs
+  0x0E, 0x03, 0x3F, 0x11, 0xE9, 0x13, 0x91, 0x1D, 0x5A, 0x1E, 0x7B, 0x20, 0xA7, 0x30, 0x64, 0x4D, 0x8B, 0x4D, 0xA4, 0x6D, 0xA3, 0x7D, 0xB0, 0x9C, 0xAB, 0xB0, 0xEA, 0xDB, 0xE4, // BIN 1446: 14 pairs
+  0x11, 0x02, 0xDC, 0x09, 0x4A, 0x0F, 0xA7, 0x10, 0xB3, 0x1D, 0x70, 0x21, 0x92, 0x3B, 0x88, 0x5A, 0x66, 0x5F, 0xF9, 0x74, 0x92, 0x7E, 0x8C, 0x89, 0x93, 0xA8, 0xE2, 0xBE, 0xF2, 0xC5, 0xE5, 0xCB, 0xEB, 0xD6, 0xFE, // BIN 1447: 17 pairs
+  0x0D, 0x05, 0xD1, 0x0B, 0x3A, 0x11, 0x58, 0x12, 0xA5, 0x1A, 0xE9, 0x27, 0xFD, 0x2F, 0x75, 0x37, 0x64, 0x48, 0xC5, 0x8D, 0xD8, 0xBF, 0xF2, 0xCA, 0xF5, 0xD5, 0xED, // BIN 1448: 13 pairs
+  0x05, 0x34, 0x64, 0x49, 0x7C, 0x61, 0x9F, 0xA4, 0xD6, 0xE0, 0xFA, // BIN 1449: 5 pairs
+  0x10, 0x01, 0x40, 0x1A, 0x2F, 0x20, 0x3A, 0x2B, 0xA8, 0x2C, 0x58, 0x2E, 0x7B, 0x34, 0x6A, 0x43, 0x8B, 0x4A, 0x7C, 0x4F, 0x8A, 0x68, 0xF4, 0x97, 0xB6, 0xC5, 0xDE, 0xDD, 0xE9, 0xDE, 0xEA, 0xE7, 0xF0, // BIN 1450: 16 pairs
+  0x11, 0x08, 0x72, 0x0F, 0x37, 0x1A, 0x26, 0x1F, 0xF9, 0x23, 0x47, 0x23, 0x65, 0x2D, 0x6A, 0x34, 0x63, 0x38, 0x6C, 0x3C, 0xEF, 0x49, 0x93, 0x63, 0xCD, 0x80, 0xD3, 0x84, 0xB1, 0x89, 0xBB, 0xA9, 0xEE, 0xCA, 0xDC, // BIN 1451: 17 pairs
+  0x0B, 0x10, 0xFB, 0x1E, 0x77, 0x6F, 0x70, 0x75, 0xDD, 0x76, 0xBE, 0x81, 0x87, 0x82, 0xDB, 0xB5, 0xFF, 0xC4, 0xF5, 0xC6, 0xFB, 0xCB, 0xFA, // BIN 1452: 11 pairs
+  0x15, 0x02, 0x2E, 0x23, 0x64, 0x44, 0x6F, 0x4B, 0x80, 0x55, 0x99, 0x56, 0xAA, 0x5A, 0x8A, 0x5E, 0xF4, 0x64, 0x8E, 0x73, 0xB8, 0x77, 0xC1, 0x7A, 0xDB, 0x7A, 0xF9, 0x7E, 0x86, 0x90, 0xDE, 0x95, 0xF8, 0xA5, 0xE5, 0xAE, 0xF8, 0xB5, 0xC9, 0xB7, 0xE9, 0xD5, 0xEE, // BIN 1453: 21 pairs
+  0x17, 0x00, 0xC7, 0x05, 0x9E, 0x06, 0x32, 0x0A, 0xD1, 0x17, 0xBE, 0x17, 0xED, 0x1A, 0xEE, 0x25, 0xFA, 0x33, 0x5E, 0x55, 0x9A, 0x5C, 0xF7, 0x5F, 0xC8, 0x79, 0xD0, 0x7C, 0xCD, 0x84, 0xE0, 0x8A, 0xDA, 0xAD, 0xF6, 0xB6, 0xD9, 0xB8, 0xF2, 0xC4, 0xF2, 0xC5, 0xFB, 0xD6, 0xF8, 0xD8, 0xE4, // BIN 1454: 23 pairs
+  0x0D, 0x0F, 0x34, 0x1E, 0x65, 0x28, 0x63, 0x38, 0x6E, 0x39, 0x9C, 0x49, 0x8F, 0x68, 0x83, 0x6F, 0xAE, 0x87, 0x9E, 0x89, 0xC4, 0x8A, 0x90, 0x96, 0xC8, 0xAD, 0xDC, // BIN 1455: 13 pairs
+  0x0B, 0x01, 0x50, 0x07, 0x41, 0x27, 0x8C, 0x4A, 0x74, 0x55, 0x6B, 0x5E, 0xAE, 0x5F, 0xAD, 0x77, 0xDC, 0x80, 0xB5, 0x8F, 0xF9, 0xA6, 0xF9, // BIN 1456: 11 pairs
+  0x14, 0x01, 0x44, 0x10, 0x38, 0x13, 0x22, 0x17, 0xE9, 0x1B, 0xD3, 0x1B, 0xD5, 0x21, 0x4E, 0x43, 0x52, 0x4B, 0x74, 0x54, 0xA1, 0x5D, 0x8E, 0x62, 0x71, 0x6B, 0xB8, 0x71, 0xE9, 0x73, 0xB5, 0x77, 0xEC, 0x7A, 0xDF, 0x83, 0xC0, 0xB7, 0xF1, 0xCA, 0xFB, // BIN 1457: 20 pairs
+  0x0A, 0x04, 0xD8, 0x04, 0xFD, 0x07, 0x30, 0x09, 0xDB, 0x10, 0x29, 0x5A, 0x8C, 0x5F, 0x9F, 0x6C, 0xA3, 0xBA, 0xE3, 0xC8, 0xDC, // BIN 1458: 10 pairs
+  0x11, 0x06, 0xE6, 0x09, 0x23, 0x09, 0xCF, 0x0B, 0x60, 0x0C, 0x37, 0x12, 0x2F, 0x1D, 0x39, 0x1F, 0xFB, 0x2C, 0x63, 0x53, 0x9C, 0x61, 0x87, 0x63, 0xC8, 0x6D, 0xD5, 0x78, 0x91, 0x88, 0xCE, 0xC3, 0xD7, 0xC4, 0xFC, // BIN 1459: 17 pairs
+  0x10, 0x06, 0xF1, 0x08, 0x6B, 0x1A, 0xE4, 0x1B, 0xDF, 0x22, 0x41, 0x27, 0xBE, 0x38, 0x68, 0x39, 0x3C, 0x3A, 0x57, 0x3B, 0x4B, 0x3E, 0x65, 0x53, 0x92, 0x5E, 0x9F, 0x66, 0xD7, 0x76, 0x9B, 0xC8, 0xF5, // BIN 1460: 16 pairs
+  0x11, 0x0C, 0x34, 0x1A, 0x65, 0x43, 0x67, 0x45, 0x7D, 0x47, 0xC0, 0x5C, 0xD1, 0x63, 0x87, 0x76, 0xAD, 0x80, 0xD4, 0x8A, 0xB8, 0x8F, 0x96, 0x96, 0xCA, 0x98, 0xF6, 0x9B, 0xB5, 0xA9, 0xD7, 0xC6, 0xE5, 0xED, 0xF4, // BIN 1461: 17 pairs
+  0x12, 0x04, 0x69, 0x11, 0xF1, 0x15, 0x48, 0x25, 0x4A, 0x41, 0x80, 0x41, 0x98, 0x48, 0x95, 0x57, 0x8D, 0x5B, 0x6D, 0x5F, 0xCA, 0x5F, 0xEB, 0x6A, 0xB3, 0x75, 0xD8, 0x88, 0xAF, 0x9C, 0xD6, 0xA1, 0xE8, 0xD1, 0xF1, 0xE5, 0xFF, // BIN 1462: 18 pairs
+  0x12, 0x04, 0xC0, 0x0C, 0x82, 0x0F, 0x30, 0x16, 0x51, 0x17, 0x3F, 0x1A, 0xA8, 0x1F, 0x5F, 0x30, 0x6A, 0x38, 0x6A, 0x47, 0x8A, 0x4D, 0x99, 0x4D, 0x9A, 0x57, 0xEB, 0x75, 0xBF, 0x8C, 0xED, 0xA0, 0xE8, 0xB4, 0xF9, 0xC3, 0xF1, // BIN 1463: 18 pairs
+  0x10, 0x04, 0x05, 0x06, 0x90, 0x1A, 0x8C, 0x20, 0xCC, 0x24, 0x55, 0x28, 0x5C, 0x39, 0x93, 0x51, 0x69, 0x57, 0xBB, 0x5F, 0xF6, 0x67, 0x9E, 0x84, 0xB0, 0x9F, 0xEA, 0xB6, 0xF1, 0xCC, 0xF5, 0xD7, 0xD9, // BIN 1464: 16 pairs
+  0x0F, 0x0A, 0x37, 0x13, 0x42, 0x1B, 0x2C, 0x20, 0xA0, 0x22, 0x48, 0x27, 0x4B, 0x30, 0x5F, 0x32, 0x47, 0x42, 0x7B, 0x55, 0x5C, 0x56, 0x6A, 0x81, 0xE0, 0xBB, 0xFC, 0xC6, 0xDE, 0xDE, 0xF6, // BIN 1465: 15 pairs
+  0x0F, 0x04, 0x99, 0x04, 0x9A, 0x05, 0x28, 0x0C, 0x30, 0x14, 0x1D, 0x27, 0x3E, 0x47, 0x7E, 0x4E, 0x7B, 0x67, 0x69, 0x69, 0xD7, 0x8C, 0x9F, 0x90, 0xED, 0xBD, 0xF1, 0xD1, 0xE8, 0xDF, 0xE4, // BIN 1466: 15 pairs
+  0x0D, 0x00, 0x9E, 0x01, 0xB8, 0x11, 0xE1, 0x19, 0x31, 0x1E, 0xBE, 0x21, 0x46, 0x24, 0x67, 0x40, 0x48, 0x82, 0xDF, 0x8B, 0xB5, 0xAA, 0xDE, 0xB8, 0xCF, 0xDA, 0xE4, // BIN 1467: 13 pairs
+  0x0B, 0x08, 0x2D, 0x08, 0x42, 0x1D, 0x9E, 0x21, 0x62, 0x46, 0x76, 0x57, 0xA2, 0x63, 0xCA, 0xC1, 0xF5, 0xC8, 0xFB, 0xD1, 0xF5, 0xDB, 0xFE, // BIN 1468: 11 pairs
+  0x12, 0x00, 0x35, 0x04, 0x6C, 0x0C, 0xCA, 0x10, 0xD1, 0x1F, 0x5E, 0x20, 0x98, 0x2A, 0x65, 0x2A, 0x66, 0x33, 0x66, 0x38, 0x6F, 0x48, 0xF6, 0x4B, 0x8F, 0x54, 0x83, 0x7C, 0xB5, 0xA9, 0xC0, 0xBA, 0xDC, 0xD6, 0xEF, 0xE3, 0xF4, // BIN 1469: 18 pairs
+  0x12, 0x00, 0xF4, 0x04, 0xD3, 0x05, 0xA5, 0x07, 0x1E, 0x09, 0x85, 0x0C, 0xDB, 0x12, 0xBE, 0x26, 0x75, 0x28, 0x65, 0x35, 0x48, 0x3D, 0x48, 0x61, 0xBA, 0x71, 0xDC, 0x76, 0x7A, 0x78, 0xAB, 0x78, 0xD8, 0x7C, 0xCF, 0x92, 0xF6, // BIN 1470: 18 pairs
+  0x0C, 0x07, 0x2D, 0x0A, 0xDC, 0x0C, 0xC8, 0x1C, 0x5A, 0x29, 0x6E, 0x60, 0x8D, 0x6C, 0xD3, 0x75, 0xDA, 0x7F, 0xF9, 0x86, 0xB1, 0xA8, 0xFA, 0xAD, 0xF4, // BIN 1471: 12 pairs
+  0x0D, 0x07, 0x34, 0x0C, 0x55, 0x19, 0xD1, 0x1E, 0x72, 0x24, 0xA5, 0x43, 0x80, 0x48, 0xA0, 0x55, 0xA4, 0x5B, 0x82, 0x65, 0xB3, 0x7B, 0x7E, 0xA9, 0xCF, 0xB4, 0xF3, // BIN 1472: 13 pairs
+  0x07, 0x05, 0x3D, 0x20, 0xC0, 0x2E, 0x43, 0x8B, 0xCE, 0xA3, 0xE7, 0xB3, 0xD2, 0xDD, 0xFE, // BIN 1473: 7 pairs
+  0x09, 0x00, 0xA5, 0x1E, 0xEC, 0x45, 0x74, 0x45, 0x81, 0x4B, 0x93, 0x54, 0x94, 0x83, 0xC3, 0x9B, 0xF4, 0xA0, 0xF9, // BIN 1474: 9 pairs
+  0x0E, 0x1D, 0xE1, 0x24, 0xFD, 0x2D, 0x59, 0x3F, 0x7A, 0x58, 0xE4, 0x5B, 0x91, 0x60, 0x80, 0x67, 0x6C, 0x6C, 0xC4, 0x70, 0x8D, 0x72, 0xC2, 0x8D, 0xD6, 0x8E, 0xD5, 0xAC, 0xBC, // BIN 1475: 14 pairs
+  0x08, 0x0B, 0x46, 0x1F, 0x61, 0x44, 0x9E, 0x4D, 0x92, 0x61, 0xAD, 0x72, 0x8A, 0x81, 0xB1, 0xAA, 0xE7, // BIN 1476: 8 pairs
+  0x0D, 0x07, 0x38, 0x09, 0x30, 0x1A, 0xED, 0x2B, 0x4A, 0x30, 0x63, 0x36, 0x82, 0x40, 0x56, 0x47, 0xF4, 0x74, 0x98, 0xB1, 0xED, 0xBC, 0xF0, 0xC1, 0xF3, 0xCD, 0xDC, // BIN 1477: 13 pairs
+  0x0D, 0x01, 0x23, 0x04, 0x56, 0x09, 0x34, 0x49, 0x80, 0x49, 0x9C, 0x52, 0x5D, 0x76, 0xA6, 0x7C, 0x86, 0x7C, 0x8C, 0x87, 0xC0, 0xA1, 0xC2, 0xB7, 0xED, 0xBF, 0xF9, // BIN 1478: 13 pairs
+  0x0E, 0x04, 0x4C, 0x09, 0xDA, 0x36, 0xA4, 0x3F, 0x78, 0x53, 0x8A, 0x58, 0xEC, 0x67, 0x95, 0x70, 0xAB, 0x75, 0xB7, 0x7B, 0xCB, 0x9D, 0xE6, 0xA0, 0xF4, 0xBD, 0xE6, 0xCF, 0xF2, // BIN 1479: 14 pairs
+  0x05, 0x09, 0x7A, 0x18, 0xE4, 0x66, 0xAF, 0x9E, 0xCE, 0xC3, 0xCA, // BIN 1480: 5 pairs
+  0x10, 0x02, 0xDE, 0x04, 0x63, 0x0A, 0xD9, 0x10, 0x70, 0x20, 0x32, 0x2B, 0xFA, 0x2D, 0x6B, 0x2E, 0x9E, 0x47, 0xCC, 0x4F, 0x65, 0x53, 0x83, 0x5A, 0x6D, 0x83, 0xCB, 0xB0, 0xED, 0xBE, 0xE7, 0xCE, 0xF7, // BIN 1481: 16 pairs
+  0x08, 0x09, 0x37, 0x45, 0x7F, 0x51, 0x66, 0x62, 0x7B, 0x63, 0x8E, 0xA7, 0xC2, 0xA9, 0xD4, 0xC7, 0xFE, // BIN 1482: 8 pairs
+  0x10, 0x04, 0x75, 0x0A, 0x42, 0x0C, 0xDA, 0x0F, 0xDB, 0x15, 0xF5, 0x18, 0x3F, 0x21, 0xFB, 0x3B, 0x53, 0x43, 0x7C, 0x48, 0x7E, 0x67, 0xA8, 0x70, 0xEC, 0x77, 0xBC, 0x8D, 0xA8, 0xA3, 0xE8, 0xC3, 0xC8, // BIN 1483: 16 pairs
+  0x0D, 0x02, 0x13, 0x04, 0xCA, 0x09, 0xE0, 0x0F, 0xF1, 0x1B, 0x37, 0x1D, 0x6B, 0x1E, 0x5B, 0x31, 0x67, 0x3C, 0xE1, 0x56, 0x83, 0x91, 0xDE, 0xA2, 0xE8, 0xB9, 0xCE, // BIN 1484: 13 pairs
+  0x0B, 0x53, 0x99, 0x53, 0x9A, 0x58, 0xA9, 0x74, 0x7F, 0x96, 0xD3, 0xAD, 0xE3, 0xBF, 0xEE, 0xC3, 0xD0, 0xD1, 0xE0, 0xDC, 0xFB, 0xE1, 0xF5, // BIN 1485: 11 pairs
+  0x0D, 0x13, 0xFE, 0x20, 0xA1, 0x22, 0x54, 0x38, 0x6D, 0x4B, 0x7E, 0x4F, 0x6A, 0x51, 0x7B, 0x56, 0x65, 0x56, 0x8D, 0x5E, 0xD3, 0x61, 0x74, 0x89, 0x9A, 0x8E, 0xD4, // BIN 1486: 13 pairs
+  0x12, 0x06, 0x2D, 0x09, 0x45, 0x0F, 0xBB, 0x0F, 0xE8, 0x12, 0x64, 0x1F, 0x5A, 0x21, 0xC9, 0x25, 0xB3, 0x36, 0xF9, 0x68, 0xDD, 0x7D, 0x89, 0x89, 0x99, 0x8E, 0xA5, 0x9C, 0xE8, 0xAA, 0xB8, 0xAB, 0xED, 0xBF, 0xF5, 0xCD, 0xF2, // BIN 1487: 18 pairs
+  0x11, 0x09, 0xCD, 0x19, 0xC7, 0x1D, 0x4B, 0x1D, 0x5B, 0x2B, 0x90, 0x31, 0x65, 0x49, 0xA4, 0x65, 0x6E, 0x74, 0xB5, 0x87, 0xC7, 0x96, 0xC0, 0x99, 0xCE, 0x9A, 0xCE, 0xA1, 0xF9, 0xAB, 0xEC, 0xAF, 0xC7, 0xD6, 0xFD, // BIN 1488: 17 pairs
+  0x14, 0x07, 0x37, 0x33, 0x6A, 0x3D, 0x56, 0x3F, 0x7D, 0x41, 0xA0, 0x54, 0xA7, 0x59, 0xCC, 0x5B, 0x90, 0x61, 0x8E, 0x61, 0xCF, 0x6A, 0x78, 0x6F, 0xAF, 0x7C, 0xD0, 0x81, 0xB0, 0x97, 0xE5, 0x9B, 0x9D, 0xA1, 0xF4, 0xAF, 0xF8, 0xC2, 0xF5, 0xF3, 0xF7, // BIN 1489: 20 pairs
+  0x0F, 0x02, 0x0C, 0x04, 0xC8, 0x06, 0x07, 0x0C, 0x9B, 0x0F, 0xD5, 0x1B, 0xF3, 0x31, 0x75, 0x35, 0x41, 0x3F, 0x81, 0x42, 0x76, 0x48, 0xA1, 0x4D, 0x73, 0x4F, 0xA0, 0x80, 0x90, 0xA9, 0xDF, // BIN 1490: 15 pairs
+  0x10, 0x04, 0x7D, 0x0F, 0xA0, 0x0F, 0xDA, 0x1C, 0x4D, 0x39, 0xB9, 0x53, 0x5C, 0x53, 0xA4, 0x57, 0x67, 0x5F, 0xD0, 0x62, 0x98, 0x69, 0xA3, 0x7B, 0x7C, 0xA6, 0xB8, 0xB4, 0xF1, 0xE4, 0xFB, 0xF7, 0xFB, // BIN 1491: 16 pairs
+  0x0A, 0x14, 0x6E, 0x27, 0xFA, 0x2D, 0x57, 0x45, 0x84, 0x4A, 0x80, 0x76, 0xC3, 0x7C, 0xBC, 0x7F, 0xAB, 0xCE, 0xFA, 0xE6, 0xFF, // BIN 1492: 10 pairs
+  0x12, 0x0C, 0xD5, 0x11, 0x52, 0x14, 0x9C, 0x1B, 0xDA, 0x39, 0xF9, 0x3F, 0x5C, 0x48, 0xA7, 0x51, 0x6C, 0x58, 0xC3, 0x83, 0xBD, 0x85, 0xE0, 0x88, 0xAE, 0x8A, 0xC2, 0xA5, 0xE6, 0xAD, 0xD9, 0xBC, 0xEB, 0xCF, 0xDC, 0xD3, 0xED, // BIN 1493: 18 pairs
+  0x0C, 0x07, 0x47, 0x08, 0xE5, 0x0A, 0x33, 0x0E, 0xE1, 0x14, 0x46, 0x59, 0xBB, 0x63, 0xB6, 0x85, 0xAB, 0x87, 0xAC, 0x8E, 0xD8, 0xAC, 0xF3, 0xBD, 0xDE, // BIN 1494: 12 pairs
+  0x04, 0x03, 0x45, 0x03, 0xA2, 0x2A, 0x5C, 0x97, 0xC4, // BIN 1495: 4 pairs
+  0x0A, 0x11, 0x3F, 0x11, 0xF3, 0x1A, 0x3F, 0x1B, 0x34, 0x27, 0x49, 0x33, 0x58, 0x46, 0x47, 0x6F, 0xB9, 0xC2, 0xC9, 0xE0, 0xFD, // BIN 1496: 10 pairs
+  0x07, 0x09, 0xC0, 0x20, 0x8B, 0x21, 0x9B, 0x99, 0xE8, 0x9A, 0xE8, 0x9D, 0xD3, 0xA0, 0xC2, // BIN 1497: 7 pairs
+  0x0C, 0x09, 0xD0, 0x16, 0x29, 0x1B, 0xDB, 0x41, 0x7C, 0x41, 0x95, 0x43, 0xF9, 0x61, 0xCD, 0x67, 0xA5, 0x6B, 0xC3, 0x78, 0xDA, 0x8B, 0xEB, 0x95, 0x97, // BIN 1498: 12 pairs
+  0x0A, 0x03, 0x94, 0x1D, 0x49, 0x2B, 0x73, 0x44, 0x56, 0x51, 0x7E, 0x63, 0xAE, 0x8A, 0xDB, 0xAE, 0xF6, 0xC3, 0xD4, 0xCE, 0xF0, // BIN 1499: 10 pairs
+  0x0F, 0x13, 0x74, 0x46, 0x57, 0x54, 0x73, 0x5B, 0x8B, 0x60, 0xF0, 0x63, 0xD0, 0x63, 0xF9, 0x71, 0xAB, 0x75, 0xDF, 0x7D, 0xF4, 0x80, 0xD7, 0x97, 0xE2, 0xA1, 0xE2, 0xB8, 0xFA, 0xBB, 0xC3, // BIN 1500: 15 pairs
+  0x0F, 0x06, 0xDE, 0x0C, 0x23, 0x1F, 0x63, 0x2E, 0xF7, 0x44, 0x8C, 0x63, 0xEB, 0x67, 0x7F, 0x83, 0xC8, 0x93, 0xD6, 0x9B, 0xA9, 0x9D, 0xD8, 0xB2, 0xF9, 0xB7, 0xF4, 0xCA, 0xF2, 0xE6, 0xF8, // BIN 1501: 15 pairs
+  0x13, 0x04, 0x61, 0x0E, 0x50, 0x2C, 0x64, 0x31, 0x6F, 0x36, 0x9C, 0x3B, 0x49, 0x41, 0xA7, 0x55, 0x87, 0x56, 0x74, 0x60, 0xE1, 0x6B, 0xEF, 0x74, 0xB8, 0x75, 0xDB, 0x78, 0xDD, 0x79, 0x90, 0x8B, 0xC1, 0xA3, 0xEA, 0xBD, 0xE5, 0xF9, 0xFD, // BIN 1502: 19 pairs
+  0x0F, 0x06, 0x52, 0x0F, 0xF5, 0x17, 0xE4, 0x3B, 0x3E, 0x3B, 0x55, 0x46, 0x7B, 0x47, 0x94, 0x63, 0xB2, 0x64, 0xB8, 0x64, 0xC3, 0x8E, 0xD7, 0x92, 0x9D, 0xA6, 0xDE, 0xB7, 0xF3, 0xB8, 0xC0, // BIN 1503: 15 pairs
+  0x12, 0x08, 0x60, 0x0A, 0xB3, 0x3D, 0x41, 0x40, 0x41, 0x4F, 0x50, 0x53, 0x6B, 0x5A, 0x82, 0x5F, 0xB6, 0x69, 0xD3, 0x70, 0x7E, 0x74, 0x7A, 0x76, 0x85, 0x88, 0x8B, 0x9D, 0xC8, 0xA4, 0xAB, 0xA9, 0xCC, 0xBA, 0xFC, 0xD3, 0xEE, // BIN 1504: 18 pairs
+  0x0A, 0x03, 0xAE, 0x03, 0xF1, 0x18, 0x6B, 0x25, 0xA8, 0x31, 0x60, 0x67, 0x7A, 0x67, 0x9F, 0x99, 0xBC, 0x9A, 0xBC, 0xAE, 0xF4, // BIN 1505: 10 pairs
+  0x0E, 0x05, 0x2C, 0x05, 0x40, 0x0D, 0x30, 0x14, 0x7A, 0x15, 0x53, 0x4F, 0xA1, 0x5D, 0xF8, 0x61, 0xC8, 0x6E, 0xD4, 0x76, 0xBC, 0x78, 0x96, 0x9F, 0xA8, 0xA9, 0xDD, 0xAF, 0xD1, // BIN 1506: 14 pairs
+  0x0C, 0x04, 0x93, 0x0A, 0xC7, 0x10, 0xC7, 0x19, 0x65, 0x57, 0xCF, 0x59, 0xF9, 0x5B, 0x75, 0x66, 0xD3, 0x6F, 0x7B, 0x6F, 0x97, 0x8A, 0xDD, 0x91, 0xC8, // BIN 1507: 12 pairs
+  0x0F, 0x01, 0xC2, 0x05, 0x58, 0x0C, 0x92, 0x0F, 0xAA, 0x35, 0x77, 0x41, 0xA1, 0x4B, 0x9C, 0x52, 0x89, 0x74, 0xBE, 0x85, 0xD2, 0x87, 0xC8, 0x91, 0xE4, 0x9D, 0xCA, 0x9E, 0xE5, 0xA8, 0xD2, // BIN 1508: 15 pairs
+  0x07, 0x05, 0xC7, 0x0F, 0xD3, 0x5D, 0xC9, 0x63, 0xB4, 0x8F, 0xBC, 0x9D, 0xED, 0xA0, 0xE2, // BIN 1509: 7 pairs
+  0x0F, 0x18, 0x7B, 0x33, 0x69, 0x3F, 0x84, 0x46, 0x61, 0x4A, 0x73, 0x50, 0xA8, 0x50, 0xF0, 0x54, 0x8D, 0x5A, 0x90, 0x70, 0x7C, 0x8B, 0xE0, 0x8E, 0xD1, 0x96, 0xD0, 0xD5, 0xE9, 0xDB, 0xEC, // BIN 1510: 15 pairs
+  0x0D, 0x1B, 0x30, 0x28, 0x5E, 0x2F, 0x6F, 0x3E, 0x93, 0x43, 0x9B, 0x52, 0x56, 0x54, 0x76, 0x63, 0x74, 0x69, 0xC4, 0x6A, 0x9F, 0x6C, 0xD5, 0x90, 0xAF, 0xCC, 0xE3, // BIN 1511: 13 pairs
+  0x12, 0x01, 0x72, 0x01, 0xE7, 0x09, 0x5D, 0x0F, 0xA1, 0x14, 0xAC, 0x19, 0x26, 0x39, 0x8F, 0x4C, 0x9B, 0x74, 0x8F, 0x77, 0xE9, 0x83, 0xCA, 0x83, 0xCE, 0x8A, 0xD6, 0x8E, 0x9E, 0x95, 0xC2, 0xB2, 0xF3, 0xB3, 0xE7, 0xDD, 0xE4, // BIN 1512: 18 pairs
+  0x14, 0x02, 0x28, 0x06, 0xFB, 0x08, 0xE6, 0x17, 0x45, 0x27, 0x36, 0x40, 0x86, 0x58, 0x87, 0x5A, 0x91, 0x6A, 0x82, 0x76, 0xB7, 0x76, 0xC7, 0x82, 0xD2, 0x83, 0xB3, 0x94, 0xEB, 0x96, 0xCD, 0x9B, 0xE8, 0xB8, 0xCC, 0xC8, 0xF2, 0xD4, 0xD9, 0xDA, 0xFE, // BIN 1513: 20 pairs
+  0x0E, 0x0C, 0xA7, 0x1C, 0x5B, 0x20, 0xCF, 0x2C, 0x6A, 0x3A, 0x61, 0x45, 0x73, 0x47, 0xFC, 0x4F, 0xBD, 0x55, 0x95, 0x5B, 0x5E, 0x5E, 0xD5, 0x63, 0xF6, 0x8E, 0xB9, 0x91, 0xCA, // BIN 1514: 14 pairs
+  0x12, 0x05, 0x30, 0x09, 0xD5, 0x19, 0x2F, 0x1F, 0xF8, 0x2A, 0x67, 0x36, 0x93, 0x3E, 0xA4, 0x44, 0x48, 0x4B, 0x73, 0x4C, 0xF8, 0x4E, 0x79, 0x4E, 0x7C, 0x51, 0x83, 0x61, 0xCA, 0xB5, 0xF2, 0xB9, 0xFB, 0xBB, 0xE3, 0xBE, 0xFE, // BIN 1515: 18 pairs
+  0x08, 0x1A, 0x5A, 0x39, 0x99, 0x39, 0x9A, 0x40, 0x6F, 0x45, 0x79, 0x75, 0x89, 0x86, 0xED, 0x96, 0xD8, // BIN 1516: 8 pairs
+  0x0E, 0x00, 0xB3, 0x0C, 0xD3, 0x16, 0x90, 0x32, 0x59, 0x55, 0x8D, 0x56, 0xEA, 0x5E, 0xAF, 0x5F, 0x87, 0x5F, 0xB2, 0x61, 0x6A, 0x80, 0xD5, 0xBC, 0xF7, 0xD7, 0xEE, 0xE3, 0xFC, // BIN 1517: 14 pairs
+  0x08, 0x09, 0x7F, 0x2A, 0x69, 0x45, 0x85, 0x5B, 0x7A, 0x62, 0x9B, 0x87, 0xCA, 0x9C, 0xFC, 0xAF, 0xF4, // BIN 1518: 8 pairs
+  0x0B, 0x06, 0x42, 0x13, 0x76, 0x25, 0x4B, 0x48, 0x67, 0x49, 0x74, 0x49, 0x7E, 0x54, 0xF8, 0x5C, 0xA9, 0x5D, 0x9F, 0x5F, 0xAE, 0xBC, 0xF3, // BIN 1519: 11 pairs
+  0x0E, 0x02, 0xD9, 0x08, 0x3A, 0x0F, 0x98, 0x24, 0xE1, 0x25, 0x3E, 0x41, 0xEB, 0x49, 0x99, 0x4A, 0x7E, 0x5D, 0x89, 0x8C, 0xDE, 0x92, 0xC1, 0xA5, 0xB0, 0xD7, 0xED, 0xF8, 0xFE, // BIN 1520: 14 pairs
+  0x19, 0x0C, 0xE0, 0x0F, 0x23, 0x1D, 0x65, 0x20, 0xAA, 0x27, 0x53, 0x3E, 0x9C, 0x40, 0x5D, 0x42, 0x59, 0x49, 0x9A, 0x57, 0xCD, 0x5F, 0xB4, 0x7D, 0xE0, 0x86, 0x9F, 0x8B, 0xF8, 0x8F, 0xD6, 0x9F, 0xD9, 0x9F, 0xEB, 0xB9, 0xE7, 0xBE, 0xD2, 0xC0, 0xFB, 0xC1, 0xFA, 0xC9, 0xF5, 0xD6, 0xF7, 0xDF, 0xEC, 0xF6, 0xFD, // BIN 1521: 25 pairs
+  0x0C, 0x12, 0x14, 0x1D, 0xA5, 0x21, 0x42, 0x37, 0x5E, 0x3F, 0x7F, 0x44, 0x5D, 0x66, 0x8E, 0x7B, 0xA3, 0x90, 0x94, 0xAF, 0xF6, 0xC3, 0xCD, 0xF0, 0xF1, // BIN 1522: 12 pairs
+  0x07, 0x0E, 0x58, 0x13, 0xC1, 0x2F, 0x67, 0x61, 0x76, 0x62, 0x96, 0x68, 0xDA, 0x87, 0xA4, // BIN 1523: 7 pairs
+  0x0E, 0x07, 0x3E, 0x0E, 0x3F, 0x12, 0x71, 0x14, 0x42, 0x15, 0x4F, 0x16, 0xF2, 0x3E, 0x6A, 0x43, 0x50, 0x4B, 0xA4, 0x57, 0x83, 0x77, 0xA3, 0x7B, 0xE3, 0x87, 0xBE, 0x8D, 0xDA, // BIN 1524: 14 pairs
+  0x0A, 0x15, 0xF9, 0x17, 0xF2, 0x1A, 0x45, 0x26, 0xF8, 0x4A, 0x8F, 0x5A, 0x5E, 0x6F, 0xAB, 0xA6, 0xE7, 0xAB, 0xB9, 0xC2, 0xFD, // BIN 1525: 10 pairs
+  0x0C, 0x04, 0xFA, 0x0C, 0xBB, 0x1C, 0x53, 0x1F, 0x5B, 0x20, 0xA6, 0x22, 0xFD, 0x4F, 0xA7, 0x54, 0xBD, 0x5E, 0x83, 0x73, 0xC7, 0x76, 0xAA, 0xC4, 0xED, // BIN 1526: 12 pairs
+  0x0A, 0x0D, 0xF5, 0x18, 0xB3, 0x22, 0x62, 0x68, 0xA3, 0x6F, 0x90, 0x76, 0xC2, 0x77, 0x79, 0x91, 0xE3, 0xBD, 0xFB, 0xE8, 0xF7, // BIN 1527: 10 pairs
+  0x10, 0x04, 0x38, 0x04, 0x49, 0x0F, 0xA6, 0x13, 0xDE, 0x14, 0x85, 0x1E, 0x86, 0x3C, 0x4C, 0x6D, 0xDD, 0x86, 0xCE, 0x88, 0x95, 0x8B, 0xD6, 0x8E, 0xBE, 0x97, 0xE6, 0xA3, 0xEB, 0xB2, 0xF1, 0xC3, 0xF5, // BIN 1528: 16 pairs
+  0x0F, 0x01, 0xFB, 0x02, 0x35, 0x05, 0x2A, 0x0A, 0xE5, 0x18, 0x45, 0x33, 0x64, 0x36, 0xB9, 0x3A, 0x70, 0x4A, 0x5C, 0x57, 0xBA, 0x5A, 0x75, 0x65, 0xBE, 0x91, 0xC0, 0x98, 0xC2, 0xC7, 0xE0, // BIN 1529: 15 pairs
+  0x12, 0x0A, 0x50, 0x0A, 0xE6, 0x0D, 0x34, 0x11, 0x36, 0x35, 0x56, 0x3A, 0x6F, 0x4A, 0x93, 0x54, 0x60, 0x5C, 0x8E, 0x68, 0xD8, 0x6B, 0x8A, 0x76, 0xA7, 0x84, 0xD2, 0x85, 0xF4, 0x90, 0xA2, 0xB7, 0xBE, 0xC1, 0xEB, 0xC7, 0xE8, // BIN 1530: 18 pairs
+  0x10, 0x07, 0x19, 0x0B, 0x30, 0x0D, 0x2C, 0x12, 0x4E, 0x18, 0x77, 0x24, 0x62, 0x28, 0x58, 0x2F, 0x81, 0x3C, 0xBE, 0x4C, 0x74, 0x66, 0x87, 0x72, 0xD9, 0x72, 0xF7, 0x9F, 0xC7, 0xB3, 0xF2, 0xD0, 0xD9, // BIN 1531: 16 pairs
+  0x10, 0x04, 0x33, 0x0E, 0x36, 0x1F, 0x66, 0x24, 0xFA, 0x28, 0x67, 0x37, 0x66, 0x4C, 0x8A, 0x51, 0x5E, 0x58, 0xB8, 0x5B, 0x7F, 0x62, 0x99, 0x62, 0x9A, 0x67, 0x6D, 0x74, 0xB0, 0x89, 0xD2, 0xB0, 0xEC, // BIN 1532: 16 pairs
+  0x0A, 0x1A, 0xD1, 0x22, 0x6B, 0x48, 0x8A, 0x52, 0x83, 0x61, 0xF9, 0x6E, 0xC4, 0x7E, 0xD3, 0x87, 0xD2, 0x9F, 0xDC, 0xBB, 0xDC, // BIN 1533: 10 pairs
+  0x0B, 0x07, 0xED, 0x12, 0xF1, 0x2B, 0x4B, 0x3A, 0x72, 0x3B, 0x4D, 0x3D, 0x86, 0x5F, 0x8E, 0x66, 0xC4, 0x96, 0xD5, 0xB1, 0xEC, 0xE3, 0xEB, // BIN 1534: 11 pairs
+  0x0B, 0x02, 0x2D, 0x05, 0x3A, 0x07, 0x43, 0x07, 0xDF, 0x13, 0x46, 0x18, 0xF2, 0x37, 0x6B, 0x5E, 0xC4, 0x68, 0xDF, 0x6F, 0x86, 0x7E, 0xC1, // BIN 1535: 11 pairs
+  0x0D, 0x3E, 0x79, 0x40, 0x76, 0x41, 0xC9, 0x45, 0x6B, 0x59, 0xF6, 0x68, 0x8E, 0x6A, 0xBE, 0x6F, 0xB2, 0x78, 0xDB, 0x8B, 0x97, 0x9D, 0xD5, 0xA2, 0xF8, 0xA7, 0xE7, // BIN 1536: 13 pairs
+  0x0E, 0x08, 0xDE, 0x16, 0x65, 0x26, 0x81, 0x27, 0xB3, 0x2C, 0x5E, 0x2F, 0x65, 0x3E, 0x8F, 0x45, 0x82, 0x4B, 0x8B, 0x61, 0xAE, 0x61, 0xB6, 0x67, 0x75, 0x92, 0xF9, 0xC4, 0xD1, // BIN 1537: 14 pairs
+  0x0A, 0x00, 0x09, 0x02, 0x3B, 0x20, 0x62, 0x23, 0x5D, 0x44, 0x88, 0x57, 0xC8, 0x73, 0x92, 0x8F, 0xF4, 0xB9, 0xE2, 0xDA, 0xEC, // BIN 1538: 10 pairs
+  0x13, 0x01, 0x6B, 0x04, 0x2C, 0x05, 0xE8, 0x08, 0xB8, 0x10, 0x31, 0x14, 0xF5, 0x1B, 0xD8, 0x20, 0xCD, 0x28, 0x66, 0x3D, 0x5D, 0x44, 0xA5, 0x4F, 0xC6, 0x54, 0xA6, 0x59, 0x74, 0x5A, 0x8B, 0x8A, 0xDF, 0x8C, 0xB7, 0xAA, 0xE6, 0xD8, 0xEC, // BIN 1539: 19 pairs
+  0x0D, 0x07, 0x1A, 0x09, 0xCA, 0x14, 0x2E, 0x16, 0xD9, 0x1E, 0x4A, 0x24, 0x86, 0x56, 0xC9, 0x5F, 0xD4, 0x8F, 0xCE, 0x95, 0xB8, 0x9C, 0xCE, 0xC7, 0xF1, 0xCC, 0xF2, // BIN 1540: 13 pairs
+  0x0E, 0x07, 0xE6, 0x0E, 0xE4, 0x10, 0x26, 0x1B, 0x79, 0x32, 0x57, 0x34, 0x6B, 0x42, 0xFF, 0x4C, 0x60, 0x4E, 0x69, 0x66, 0xD5, 0x7E, 0xB8, 0x87, 0xBD, 0x92, 0xB5, 0xE5, 0xF8, // BIN 1541: 14 pairs
+  0x15, 0x01, 0x32, 0x05, 0x34, 0x05, 0xB3, 0x17, 0x6B, 0x2A, 0x68, 0x32, 0x70, 0x3C, 0x88, 0x3C, 0x90, 0x49, 0x8B, 0x5B, 0x68, 0x63, 0x76, 0x66, 0x67, 0x75, 0xB1, 0x77, 0xCB, 0x96, 0xCF, 0x96, 0xE2, 0x98, 0xF9, 0xA5, 0xB1, 0xAC, 0xE2, 0xBA, 0xD9, 0xF9, 0xFA, // BIN 1542: 21 pairs
+  0x0C, 0x06, 0x72, 0x07, 0x32, 0x07, 0x48, 0x07, 0xDD, 0x34, 0x5E, 0x37, 0x6F, 0x39, 0x67, 0x47, 0xCF, 0x61, 0xB2, 0x69, 0xD5, 0x70, 0xDC, 0x79, 0xB5, // BIN 1543: 12 pairs
+  0x0E, 0x09, 0xC8, 0x0F, 0xE0, 0x10, 0xE3, 0x1B, 0xB6, 0x2E, 0x4F, 0x2E, 0xA5, 0x30, 0x6B, 0x5A, 0x7A, 0x65, 0xA9, 0x65, 0xFF, 0x67, 0xA9, 0x92, 0xCB, 0xD1, 0xD8, 0xE1, 0xF1, // BIN 1544: 14 pairs
+  0x0D, 0x3E, 0x60, 0x47, 0xBB, 0x4C, 0x95, 0x57, 0xCA, 0x59, 0x6A, 0x61, 0xEB, 0x79, 0xBC, 0x83, 0xCC, 0xA7, 0xDE, 0xBC, 0xF5, 0xC1, 0xFF, 0xC3, 0xCF, 0xCA, 0xD9, // BIN 1545: 13 pairs
+  0x12, 0x01, 0x52, 0x08, 0xF1, 0x10, 0xA8, 0x11, 0xE4, 0x1A, 0xC7, 0x33, 0x6C, 0x35, 0x7B, 0x38, 0x58, 0x51, 0x80, 0x74, 0xA1, 0x7A, 0xAB, 0x7B, 0xB0, 0x88, 0xAD, 0x92, 0xA9, 0xC4, 0xC7, 0xC4, 0xE4, 0xC4, 0xFB, 0xCB, 0xFD, // BIN 1546: 18 pairs
+  0x14, 0x04, 0x23, 0x04, 0x3F, 0x08, 0x46, 0x0A, 0x29, 0x0D, 0x88, 0x1C, 0x71, 0x21, 0x35, 0x27, 0x4D, 0x33, 0x6F, 0x43, 0x7E, 0x4B, 0x99, 0x4B, 0x9A, 0x61, 0xD0, 0x62, 0x86, 0x6B, 0xB5, 0x73, 0xB0, 0xA1, 0xB8, 0xA4, 0xCE, 0xB7, 0xF6, 0xD5, 0xE4, // BIN 1547: 20 pairs
+  0x12, 0x05, 0xDE, 0x2B, 0x3E, 0x3A, 0x71, 0x3E, 0xF8, 0x50, 0x89, 0x52, 0x87, 0x62, 0x9C, 0x68, 0xDB, 0x72, 0xA3, 0x76, 0xB2, 0x78, 0xDF, 0x7F, 0xD2, 0x8B, 0xCB, 0x94, 0xC3, 0x9D, 0xD0, 0x9E, 0xE6, 0xA2, 0xE5, 0xD3, 0xE9, // BIN 1548: 18 pairs
+  0x0F, 0x00, 0x2D, 0x01, 0x07, 0x1E, 0x3E, 0x24, 0x4C, 0x2B, 0x88, 0x40, 0x9E, 0x4D, 0x76, 0x51, 0x6D, 0x74, 0x85, 0x81, 0xD2, 0x98, 0xE8, 0xAA, 0xE5, 0xAE, 0xC7, 0xBF, 0xEC, 0xCE, 0xF6, // BIN 1549: 15 pairs
+  0x11, 0x14, 0xFE, 0x1B, 0x80, 0x25, 0x49, 0x32, 0x71, 0x35, 0x73, 0x3D, 0x6F, 0x43, 0xEA, 0x45, 0x64, 0x59, 0x87, 0x61, 0xB4, 0x7F, 0x91, 0x7F, 0xE0, 0x88, 0xF7, 0x96, 0xCC, 0xA4, 0xF3, 0xC7, 0xF5, 0xDF, 0xFA, // BIN 1550: 17 pairs
+  0x14, 0x06, 0x3A, 0x09, 0xD3, 0x11, 0x4E, 0x15, 0xF7, 0x26, 0xF9, 0x33, 0x68, 0x61, 0xF6, 0x63, 0x6A, 0x66, 0xF4, 0x6A, 0x95, 0x6C, 0x74, 0x75, 0xB0, 0x75, 0xF4, 0x77, 0x80, 0x83, 0xA5, 0x9D, 0xF7, 0xA2, 0xE6, 0xC4, 0xE9, 0xC8, 0xD9, 0xF6, 0xFA, // BIN 1551: 20 pairs
+  0x13, 0x01, 0xE2, 0x0A, 0x46, 0x0B, 0x2C, 0x0C, 0xD8, 0x0D, 0x28, 0x1A, 0x5B, 0x25, 0x90, 0x27, 0xA8, 0x29, 0x60, 0x33, 0x6E, 0x4D, 0xB9, 0x5E, 0xDD, 0x69, 0x74, 0x6D, 0xD8, 0x70, 0xE9, 0x75, 0x76, 0x83, 0xCD, 0x91, 0xD3, 0x93, 0xCE, // BIN 1552: 19 pairs
+  0x0A, 0x07, 0x16, 0x0D, 0x37, 0x10, 0x4E, 0x14, 0x3D, 0x17, 0x7B, 0x27, 0x39, 0x29, 0x65, 0x2E, 0x86, 0x3F, 0x85, 0xA8, 0xFD, // BIN 1553: 10 pairs
+  0x10, 0x06, 0x6B, 0x0D, 0x97, 0x1B, 0x94, 0x1E, 0x36, 0x20, 0xD4, 0x2E, 0x54, 0x2F, 0x84, 0x4F, 0xC5, 0x63, 0xD4, 0x6D, 0xDA, 0x83, 0xC9, 0x93, 0xBC, 0xA2, 0xE7, 0xA8, 0xBF, 0xB5, 0xBD, 0xB7, 0xEE, // BIN 1554: 16 pairs
+  0x14, 0x07, 0xE0, 0x0F, 0xD8, 0x14, 0x7F, 0x27, 0x62, 0x2A, 0x6C, 0x2C, 0x66, 0x2E, 0x73, 0x34, 0x66, 0x3A, 0x5F, 0x59, 0xBA, 0x64, 0x7C, 0x6C, 0x76, 0x6D, 0xF4, 0x90, 0xAE, 0x96, 0xF0, 0x9F, 0xE5, 0xB3, 0xBF, 0xC0, 0xF5, 0xCB, 0xEA, 0xDE, 0xF9, // BIN 1555: 20 pairs
+  0x11, 0x03, 0xAF, 0x05, 0x09, 0x1C, 0x43, 0x27, 0x55, 0x2E, 0xEF, 0x3A, 0x73, 0x41, 0x7E, 0x4D, 0x8A, 0x4E, 0x66, 0x52, 0xA8, 0x55, 0x9B, 0x58, 0xD9, 0x59, 0x9F, 0x67, 0x92, 0x74, 0xA0, 0x7E, 0xD4, 0xB0, 0xE1, // BIN 1556: 17 pairs
+  0x11, 0x09, 0x2D, 0x09, 0xD8, 0x0B, 0x34, 0x20, 0x95, 0x3D, 0x9E, 0x46, 0x63, 0x49, 0x92, 0x59, 0xCF, 0x5A, 0x68, 0x5D, 0x60, 0x60, 0xA9, 0x6F, 0xBD, 0x74, 0xB1, 0x79, 0xD3, 0x98, 0xF4, 0xA3, 0xBE, 0xC2, 0xF3, // BIN 1557: 17 pairs
+  0x09, 0x04, 0x85, 0x10, 0xF1, 0x2F, 0x7D, 0x3A, 0x63, 0x3B, 0x76, 0x41, 0x44, 0xB1, 0xF1, 0xB5, 0xC5, 0xEB, 0xEE, // BIN 1558: 9 pairs
+  0x0F, 0x00, 0x32, 0x10, 0xD9, 0x13, 0xCB, 0x1F, 0xFE, 0x48, 0xA6, 0x54, 0xC6, 0x59, 0xEB, 0x63, 0xAF, 0x6F, 0x71, 0x71, 0x8D, 0xAC, 0xE7, 0xB9, 0xF1, 0xC0, 0xE3, 0xCB, 0xFF, 0xCC, 0xDC, // BIN 1559: 15 pairs
+  0x0C, 0x0A, 0xE7, 0x0F, 0xBA, 0x20, 0x51, 0x27, 0x73, 0x38, 0x64, 0x4F, 0x74, 0x5A, 0x7F, 0x6E, 0xD7, 0x73, 0x98, 0x76, 0x7D, 0x9D, 0xC0, 0x9D, 0xCD, // BIN 1560: 12 pairs
+  0x0C, 0x10, 0x7B, 0x16, 0x31, 0x25, 0x73, 0x26, 0x84, 0x2B, 0x62, 0x2F, 0x60, 0x4C, 0x98, 0x69, 0x76, 0x73, 0xC3, 0x74, 0x9B, 0x80, 0xD2, 0x83, 0x9E, // BIN 1561: 12 pairs
+  0x09, 0x01, 0x97, 0x03, 0x2A, 0x05, 0x14, 0x0C, 0x0E, 0x48, 0xC9, 0x79, 0xD4, 0x83, 0xC5, 0x87, 0xCD, 0x8A, 0x8C, // BIN 1562: 9 pairs
+  0x0C, 0x02, 0x2A, 0x15, 0xFF, 0x29, 0x75, 0x2B, 0xEC, 0x39, 0xAC, 0x47, 0xCD, 0x7D, 0xD2, 0x87, 0xD1, 0xAD, 0xF9, 0xC4, 0xEE, 0xE8, 0xEF, 0xEE, 0xF6, // BIN 1563: 12 pairs
+  0x0B, 0x02, 0x3C, 0x06, 0xB8, 0x0C, 0xA0, 0x2F, 0x7A, 0x36, 0x99, 0x36, 0x9A, 0x3A, 0x74, 0x80, 0xC1, 0x87, 0xCC, 0x89, 0x9C, 0xB7, 0xEC, // BIN 1564: 11 pairs
+  0x12, 0x09, 0xE7, 0x0B, 0x28, 0x0B, 0xE5, 0x29, 0x67, 0x36, 0x8F, 0x45, 0x7C, 0x4A, 0x9C, 0x4F, 0x94, 0x50, 0x5D, 0x51, 0x88, 0x55, 0x64, 0x64, 0x7E, 0x68, 0x87, 0x6F, 0x8C, 0x89, 0xD9, 0x91, 0xCD, 0x9F, 0xE6, 0xB8, 0xF1, // BIN 1565: 18 pairs
+  0x09, 0x02, 0x32, 0x05, 0x44, 0x13, 0x67, 0x1E, 0xB3, 0x30, 0x5E, 0x4B, 0x92, 0x66, 0xA3, 0x76, 0xC1, 0x91, 0xD0, // BIN 1566: 9 pairs
+  0x0B, 0x17, 0xB3, 0x25, 0x36, 0x42, 0x47, 0x6C, 0x89, 0x83, 0xC6, 0xA0, 0xB8, 0xA5, 0xE2, 0xA7, 0xB8, 0xAC, 0xCB, 0xAE, 0xD1, 0xB1, 0xEE, // BIN 1567: 11 pairs
+  0x14, 0x00, 0xF9, 0x05, 0xF4, 0x06, 0xE7, 0x0C, 0x2D, 0x0E, 0x52, 0x14, 0x24, 0x14, 0xC6, 0x19, 0x3F, 0x1F, 0xF6, 0x2D, 0x61, 0x37, 0x69, 0x46, 0x5F, 0x50, 0xBE, 0x57, 0xD0, 0x58, 0x83, 0x5F, 0x74, 0x8D, 0xDB, 0x90, 0xD6, 0xB9, 0xBC, 0xDD, 0xEC, // BIN 1568: 20 pairs
+  0x10, 0x03, 0x38, 0x05, 0x37, 0x05, 0xE2, 0x17, 0xF5, 0x23, 0x67, 0x25, 0xEC, 0x2B, 0x49, 0x34, 0x6F, 0x41, 0xFC, 0x4B, 0x5C, 0x59, 0xCD, 0x67, 0x85, 0x6F, 0xB4, 0x82, 0xF6, 0x89, 0xC0, 0xDB, 0xFA, // BIN 1569: 16 pairs
+  0x0D, 0x04, 0x54, 0x14, 0x4E, 0x23, 0x59, 0x2B, 0x74, 0x32, 0x72, 0x4D, 0xAC, 0x4E, 0x86, 0x54, 0xAA, 0x9C, 0xBC, 0xB1, 0xE1, 0xB5, 0xF1, 0xB7, 0xF8, 0xCB, 0xF4, // BIN 1570: 13 pairs
+  0x0C, 0x04, 0x0A, 0x0C, 0xAA, 0x1B, 0x6F, 0x1C, 0x4C, 0x36, 0x67, 0x3C, 0xA8, 0x43, 0xF6, 0x4E, 0x6C, 0x5D, 0xC0, 0x74, 0x75, 0xD2, 0xE1, 0xD4, 0xEE, // BIN 1571: 12 pairs
+  0x0D, 0x14, 0x51, 0x15, 0x1B, 0x1F, 0x68, 0x20, 0xD0, 0x23, 0x57, 0x3D, 0x76, 0x43, 0xBD, 0x6B, 0xAB, 0x71, 0xC1, 0xBC, 0xEA, 0xC5, 0xF5, 0xD8, 0xFE, 0xE9, 0xFC, // BIN 1572: 13 pairs
+  0x0F, 0x07, 0x0B, 0x0F, 0x2D, 0x15, 0x47, 0x19, 0x90, 0x25, 0x53, 0x3E, 0x99, 0x3E, 0x9A, 0x41, 0xA6, 0x5B, 0x96, 0x6A, 0xA3, 0x72, 0x9F, 0x73, 0xB1, 0x77, 0xB0, 0x7B, 0xB1, 0x9F, 0xD1, // BIN 1573: 15 pairs
+  0x0F, 0x03, 0xBF, 0x07, 0x08, 0x07, 0xE5, 0x10, 0x2F, 0x14, 0x93, 0x17, 0x77, 0x22, 0x71, 0x42, 0x86, 0x54, 0xC5, 0x82, 0xE0, 0x88, 0xEC, 0xB0, 0xEE, 0xB5, 0xC6, 0xC7, 0xD8, 0xD4, 0xED, // BIN 1574: 15 pairs
+  0x0A, 0x14, 0x99, 0x14, 0x9A, 0x1E, 0xEE, 0x26, 0x7D, 0x4E, 0x88, 0x59, 0xAD, 0x6D, 0xBF, 0x6E, 0xD3, 0x83, 0xCF, 0x91, 0x93, // BIN 1575: 10 pairs
+  0x15, 0x09, 0x22, 0x12, 0xFC, 0x14, 0x40, 0x20, 0xF3, 0x2A, 0x58, 0x42, 0x57, 0x43, 0x98, 0x48, 0xAA, 0x4E, 0x7E, 0x51, 0x87, 0x53, 0x95, 0x55, 0x98, 0x62, 0xA0, 0x65, 0x8B, 0x6D, 0xDF, 0x80, 0xD8, 0x83, 0xD0, 0x8E, 0xDA, 0xCD, 0xD9, 0xD1, 0xDB, 0xD3, 0xE4, // BIN 1576: 21 pairs
+  0x0E, 0x02, 0x2C, 0x02, 0xEB, 0x02, 0xF8, 0x11, 0x45, 0x2B, 0x53, 0x57, 0xAD, 0x5C, 0x7C, 0x5E, 0xFC, 0x62, 0x9F, 0x7B, 0xED, 0x7D, 0xAB, 0x83, 0xB9, 0x9E, 0xB0, 0xC6, 0xF5, // BIN 1577: 14 pairs
+  0x11, 0x01, 0x2D, 0x04, 0x7A, 0x1D, 0x4D, 0x31, 0x81, 0x56, 0x76, 0x61, 0x65, 0x62, 0xA1, 0x78, 0xF6, 0x7A, 0xE0, 0x90, 0xBF, 0x96, 0xE9, 0x97, 0xEE, 0x99, 0xFC, 0x9A, 0xFC, 0xC3, 0xFE, 0xD2, 0xFA, 0xEF, 0xF3, // BIN 1578: 17 pairs
+  0x08, 0x15, 0xF2, 0x21, 0x6F, 0x30, 0x66, 0x49, 0x73, 0x4E, 0x83, 0x50, 0xB3, 0x9F, 0xE8, 0xF5, 0xFF, // BIN 1579: 8 pairs
+  0x0C, 0x0B, 0x37, 0x18, 0x86, 0x22, 0xFE, 0x25, 0xFE, 0x33, 0x6D, 0x4A, 0xA4, 0x58, 0xE9, 0x5F, 0xAF, 0x77, 0x8A, 0x80, 0x8C, 0xB0, 0xF1, 0xB7, 0xF2, // BIN 1580: 12 pairs
+  0x0C, 0x08, 0x97, 0x09, 0x53, 0x0C, 0xFE, 0x10, 0xDC, 0x19, 0x5A, 0x1B, 0xB4, 0x20, 0x22, 0x20, 0xC8, 0x36, 0xF6, 0x41, 0xF4, 0x59, 0xC8, 0x87, 0xD0, // BIN 1581: 12 pairs
+  0x09, 0x1D, 0xEC, 0x21, 0xA7, 0x55, 0x94, 0x79, 0x86, 0x79, 0x8C, 0x7C, 0xD3, 0x84, 0x89, 0xA6, 0xE6, 0xCE, 0xFD, // BIN 1582: 9 pairs
+  0x13, 0x07, 0x24, 0x0C, 0xA1, 0x0D, 0xB8, 0x14, 0x17, 0x14, 0xC5, 0x20, 0xBB, 0x20, 0xCA, 0x2A, 0x6D, 0x35, 0x74, 0x36, 0x3B, 0x3C, 0x76, 0x3F, 0x74, 0x49, 0xB9, 0x6C, 0xDD, 0x6D, 0xDB, 0x89, 0xC8, 0x8E, 0xD9, 0x9D, 0xDA, 0xEA, 0xFE, // BIN 1583: 19 pairs
+  0x0B, 0x09, 0x6E, 0x0B, 0xE6, 0x18, 0x72, 0x39, 0xF6, 0x4F, 0xA6, 0x61, 0x73, 0x69, 0x89, 0x83, 0xD2, 0x98, 0xB8, 0xA8, 0xAF, 0xD1, 0xDA, // BIN 1584: 11 pairs
+  0x0C, 0x03, 0x8A, 0x03, 0xF5, 0x15, 0x55, 0x19, 0xF2, 0x22, 0xF7, 0x2A, 0x6E, 0x43, 0xC6, 0x4F, 0xEA, 0x85, 0x91, 0x88, 0xE3, 0x93, 0xE8, 0x98, 0xE2, // BIN 1585: 12 pairs
+  0x0F, 0x03, 0x80, 0x0A, 0x71, 0x41, 0xAA, 0x4A, 0x8B, 0x51, 0x86, 0x53, 0x87, 0x54, 0x87, 0x67, 0x8F, 0x6E, 0xEB, 0x73, 0x7F, 0x77, 0x9F, 0x86, 0x8A, 0x87, 0xCF, 0x97, 0xBA, 0xAC, 0xC1, // BIN 1586: 15 pairs
+  0x0C, 0x00, 0x28, 0x11, 0x39, 0x18, 0xF5, 0x1B, 0xE0, 0x21, 0x8B, 0x3C, 0xB3, 0x48, 0xEB, 0x7F, 0x96, 0x87, 0xC9, 0x8A, 0xEA, 0x8C, 0xEE, 0xB2, 0xC7, // BIN 1587: 12 pairs
+  0x08, 0x0A, 0x5C, 0x1C, 0x55, 0x42, 0x61, 0x43, 0x95, 0x55, 0xAC, 0x5D, 0xEA, 0x76, 0xB4, 0xD7, 0xE9, // BIN 1588: 8 pairs
+  0x0E, 0x0A, 0x38, 0x27, 0x90, 0x28, 0x69, 0x3E, 0xB9, 0x4B, 0x76, 0x59, 0x76, 0x59, 0xCA, 0x6A, 0xAB, 0x6F, 0xB6, 0x7A, 0xF4, 0x80, 0x86, 0x9D, 0xCF, 0xA1, 0xDE, 0xCE, 0xFE, // BIN 1589: 14 pairs
+  0x0C, 0x04, 0xBB, 0x05, 0x33, 0x0E, 0x39, 0x13, 0xE5, 0x1E, 0x8C, 0x26, 0x7A, 0x3B, 0xFD, 0x47, 0xC8, 0x56, 0x73, 0x59, 0x8E, 0x6E, 0x91, 0xDF, 0xFD, // BIN 1590: 12 pairs
+  0x19, 0x01, 0x42, 0x02, 0x0F, 0x09, 0x8F, 0x0D, 0x4E, 0x13, 0x32, 0x1B, 0xC4, 0x21, 0x98, 0x25, 0x62, 0x34, 0x69, 0x3F, 0x82, 0x41, 0x8A, 0x48, 0x52, 0x50, 0x83, 0x59, 0x65, 0x67, 0xA3, 0x72, 0xE4, 0x7A, 0xD2, 0x81, 0xFC, 0x88, 0xE9, 0x91, 0xD8, 0x93, 0x96, 0x9B, 0xE2, 0xA6, 0xE5, 0xCB, 0xFE, 0xCE, 0xFB, // BIN 1591: 25 pairs
+  0x0B, 0x07, 0xDB, 0x1B, 0xAD, 0x50, 0x56, 0x51, 0x68, 0x5B, 0x7D, 0x7E, 0xD7, 0x89, 0xCA, 0x8D, 0xDD, 0x92, 0xF4, 0xBF, 0xFC, 0xD6, 0xF0, // BIN 1592: 11 pairs
+  0x10, 0x09, 0x1C, 0x10, 0x60, 0x1B, 0x8A, 0x1C, 0x70, 0x20, 0x6F, 0x20, 0xD7, 0x28, 0x64, 0x43, 0x65, 0x4A, 0x76, 0x52, 0x7C, 0x67, 0x7D, 0x74, 0xAE, 0x76, 0x93, 0x79, 0x7B, 0x96, 0xD7, 0x96, 0xE5, // BIN 1593: 16 pairs
+  0x13, 0x04, 0x4B, 0x09, 0xFD, 0x0C, 0xA6, 0x12, 0xB3, 0x13, 0x89, 0x1A, 0x90, 0x1E, 0xE9, 0x21, 0xA0, 0x22, 0x56, 0x30, 0x6F, 0x52, 0xF0, 0x5E, 0xDA, 0x5F, 0xD7, 0x74, 0xAF, 0x91, 0xCF, 0x9F, 0xB3, 0xCF, 0xD9, 0xD2, 0xFE, 0xEE, 0xF9, // BIN 1594: 19 pairs
+  0x0F, 0x06, 0x60, 0x07, 0x3F, 0x0B, 0x1F, 0x1C, 0x21, 0x1D, 0x53, 0x24, 0x43, 0x37, 0x6E, 0x57, 0x9F, 0x5C, 0x7E, 0x74, 0x7D, 0x91, 0x99, 0x91, 0x9A, 0x97, 0xA6, 0xC0, 0xDC, 0xDD, 0xFA, // BIN 1595: 15 pairs
+  0x10, 0x00, 0x14, 0x04, 0x30, 0x0B, 0xB8, 0x1E, 0x4B, 0x20, 0x4E, 0x22, 0x70, 0x47, 0xCA, 0x53, 0x64, 0x60, 0xC7, 0x66, 0xDD, 0x6D, 0x89, 0x70, 0xC1, 0x76, 0xD1, 0x7A, 0x91, 0x90, 0xEE, 0x91, 0xCC, // BIN 1596: 16 pairs
+  0x11, 0x00, 0x58, 0x08, 0xC2, 0x0C, 0x98, 0x13, 0xF2, 0x1D, 0x7B, 0x22, 0xF0, 0x2C, 0x69, 0x31, 0x6A, 0x5B, 0x85, 0x61, 0xAF, 0x6D, 0xB7, 0x7B, 0x9F, 0x7F, 0xF4, 0x8A, 0xE0, 0x96, 0xD4, 0xB2, 0xD1, 0xB4, 0xC7, // BIN 1597: 17 pairs
+  0x0B, 0x06, 0x46, 0x0A, 0x14, 0x0C, 0xBA, 0x19, 0x45, 0x1D, 0x77, 0x35, 0xF0, 0x50, 0x87, 0x51, 0x89, 0x53, 0x8D, 0x7E, 0xD2, 0x88, 0xB2, // BIN 1598: 11 pairs
+  0x0E, 0x04, 0x34, 0x1D, 0x72, 0x2D, 0x5F, 0x40, 0x8C, 0x44, 0xF0, 0x4A, 0x6B, 0x5E, 0xDF, 0x68, 0xBF, 0x6D, 0x76, 0x7C, 0xD4, 0x96, 0xEF, 0x9E, 0xB1, 0xA4, 0xBC, 0xC3, 0xCC, // BIN 1599: 14 pairs
+  0x18, 0x0B, 0xF1, 0x10, 0x77, 0x12, 0x3F, 0x16, 0xDC, 0x17, 0xFB, 0x18, 0xA8, 0x1B, 0xB2, 0x25, 0x4D, 0x38, 0x75, 0x4D, 0x83, 0x51, 0x78, 0x55, 0x89, 0x55, 0xB9, 0x56, 0xF9, 0x5D, 0xBB, 0x5F, 0x76, 0x68, 0xFC, 0x6D, 0x74, 0x77, 0xB1, 0x7E, 0xD5, 0x96, 0xDA, 0x9B, 0xC2, 0xAB, 0xEE, 0xB8, 0xFD, // BIN 1600: 24 pairs
+  0x0B, 0x03, 0x79, 0x08, 0x30, 0x14, 0xF1, 0x2C, 0x6B, 0x31, 0x7D, 0x31, 0x84, 0x32, 0xFF, 0x43, 0xC5, 0x74, 0xA6, 0x9D, 0xE0, 0xC0, 0xC3, // BIN 1601: 11 pairs
+  0x0F, 0x02, 0x30, 0x0D, 0x65, 0x1E, 0x39, 0x22, 0x67, 0x29, 0x6F, 0x2A, 0x6A, 0x2E, 0x74, 0x2F, 0x78, 0x4E, 0x5E, 0x61, 0xD4, 0x71, 0x7E, 0x86, 0xDE, 0x91, 0xF0, 0xA0, 0xDE, 0xA5, 0xD6, // BIN 1602: 15 pairs
+  0x10, 0x01, 0x60, 0x1C, 0x65, 0x24, 0xFE, 0x31, 0x7A, 0x4A, 0x99, 0x4A, 0x9A, 0x4C, 0x73, 0x56, 0x87, 0x5F, 0x6A, 0x6C, 0xD8, 0x79, 0xD7, 0x84, 0xFC, 0x91, 0xD5, 0x96, 0x99, 0x96, 0x9A, 0xAF, 0xF1, // BIN 1603: 16 pairs
+  0x0E, 0x16, 0x26, 0x1B, 0xA2, 0x2B, 0x36, 0x37, 0x6C, 0x4D, 0x5C, 0x4F, 0xF9, 0x53, 0x9B, 0x56, 0xA2, 0x63, 0xA3, 0x64, 0x8D, 0x7E, 0xCE, 0x80, 0xCE, 0x81, 0x89, 0xB4, 0xD1, // BIN 1604: 14 pairs
+  0x0E, 0x04, 0x37, 0x12, 0xD1, 0x22, 0xFA, 0x23, 0x6B, 0x25, 0x55, 0x2B, 0x55, 0x2F, 0xF8, 0x45, 0x58, 0x62, 0x8C, 0x6B, 0xF7, 0x73, 0x7A, 0x74, 0xC7, 0x7C, 0xC1, 0x9F, 0xE7, // BIN 1605: 14 pairs
+  0x0F, 0x02, 0x29, 0x04, 0x4D, 0x06, 0xC2, 0x08, 0xFB, 0x0E, 0xF9, 0x12, 0x70, 0x1B, 0x62, 0x32, 0x61, 0x36, 0xAC, 0x47, 0xD0, 0x57, 0xD4, 0x70, 0x79, 0x71, 0xED, 0x87, 0xC5, 0x88, 0xBF, // BIN 1606: 15 pairs
+  0x12, 0x14, 0xBD, 0x16, 0xE3, 0x1C, 0x6B, 0x25, 0x39, 0x26, 0x6F, 0x27, 0xFE, 0x31, 0x5C, 0x3E, 0x7C, 0x4F, 0x83, 0x50, 0xE1, 0x55, 0x72, 0x5E, 0xD8, 0x61, 0x89, 0x6C, 0xDA, 0x73, 0xD1, 0x7C, 0xB8, 0x83, 0xC7, 0xC2, 0xC5, // BIN 1607: 18 pairs
+  0x0D, 0x0A, 0x26, 0x15, 0xF3, 0x1F, 0x69, 0x3F, 0x79, 0x63, 0xD7, 0x64, 0xE4, 0x6E, 0xB7, 0x73, 0x8F, 0x9D, 0xD7, 0x9D, 0xDB, 0xAD, 0xF3, 0xAF, 0xF3, 0xE9, 0xF4, // BIN 1608: 13 pairs
+  0x0D, 0x0B, 0xDE, 0x0E, 0x45, 0x12, 0xF3, 0x16, 0x2F, 0x21, 0x3D, 0x21, 0x5A, 0x2D, 0x63, 0x33, 0x6B, 0x41, 0x67, 0x4F, 0xAA, 0x97, 0x98, 0x9D, 0xCC, 0xA7, 0xE6, // BIN 1609: 13 pairs
+  0x0C, 0x0B, 0x97, 0x28, 0x6A, 0x63, 0x73, 0x6F, 0xB0, 0x6F, 0xBB, 0x7B, 0x80, 0x89, 0xD6, 0x90, 0xD2, 0xA2, 0xDC, 0xAE, 0xF9, 0xBB, 0xD9, 0xDA, 0xFA, // BIN 1610: 12 pairs
+  0x0F, 0x04, 0x4A, 0x04, 0x7F, 0x18, 0xD1, 0x1E, 0xED, 0x23, 0xFF, 0x35, 0x5D, 0x46, 0x86, 0x4D, 0x9B, 0x53, 0xAC, 0x53, 0xB9, 0x5A, 0x96, 0x63, 0x89, 0x71, 0x7C, 0x96, 0xFF, 0xA1, 0xE7, // BIN 1611: 15 pairs
+  0x13, 0x00, 0x3D, 0x0A, 0x52, 0x10, 0x86, 0x1F, 0x62, 0x23, 0x6A, 0x28, 0x68, 0x2B, 0x4D, 0x4C, 0xA0, 0x60, 0x8A, 0x65, 0x94, 0x6C, 0xBF, 0x6C, 0xF4, 0x71, 0xE3, 0x74, 0xAD, 0x77, 0xE3, 0x87, 0xC6, 0x8D, 0xB3, 0x97, 0xA1, 0xEF, 0xFB, // BIN 1612: 19 pairs
+  0x0C, 0x01, 0xF3, 0x0A, 0x64, 0x0E, 0x4E, 0x39, 0x79, 0x40, 0xA5, 0x50, 0x97, 0x57, 0xB6, 0x69, 0xDD, 0x78, 0xF9, 0x80, 0xB8, 0xBA, 0xF5, 0xD1, 0xDF, // BIN 1613: 12 pairs
+  0x0B, 0x00, 0xF6, 0x02, 0xD1, 0x1E, 0x49, 0x39, 0x3B, 0x43, 0xA0, 0x48, 0x94, 0x49, 0xAC, 0x82, 0xF9, 0x9F, 0xE3, 0xB6, 0xFC, 0xDB, 0xFD, // BIN 1614: 11 pairs
+  0x12, 0x02, 0x26, 0x05, 0x29, 0x0D, 0x1F, 0x19, 0x5B, 0x1C, 0xE1, 0x1E, 0xA8, 0x21, 0xA1, 0x24, 0x8C, 0x26, 0xFC, 0x2F, 0x7F, 0x44, 0x90, 0x4D, 0x95, 0x7E, 0xCB, 0x82, 0xBC, 0x84, 0xAB, 0x97, 0xAA, 0xBB, 0xF5, 0xC7, 0xDB, // BIN 1615: 18 pairs
+  0x0D, 0x03, 0x28, 0x04, 0x12, 0x04, 0xE6, 0x0D, 0x33, 0x12, 0x51, 0x1E, 0xE4, 0x22, 0x6A, 0x25, 0x88, 0x5D, 0xAD, 0x5E, 0xDB, 0x72, 0xC1, 0x7E, 0xC2, 0xA0, 0xE7, // BIN 1616: 13 pairs
+  0x14, 0x20, 0x46, 0x30, 0x69, 0x37, 0x68, 0x3C, 0x43, 0x46, 0xFF, 0x47, 0xBA, 0x59, 0xD0, 0x5A, 0x7D, 0x62, 0x90, 0x63, 0x65, 0x65, 0x78, 0x82, 0x9D, 0x85, 0x96, 0x89, 0xE1, 0x8D, 0xDF, 0x96, 0xEC, 0xA9, 0xC9, 0xA9, 0xE8, 0xAE, 0xF3, 0xBB, 0xFB, // BIN 1617: 20 pairs
+  0x0C, 0x06, 0x30, 0x07, 0x3A, 0x0C, 0x11, 0x11, 0x3E, 0x11, 0x5C, 0x38, 0x6B, 0x86, 0xB7, 0x8E, 0xDB, 0x90, 0xAD, 0xAD, 0xC7, 0xBD, 0xC2, 0xC1, 0xFD, // BIN 1618: 12 pairs
+  0x09, 0x08, 0x88, 0x21, 0x40, 0x2C, 0x6F, 0x35, 0x9E, 0x3D, 0xF0, 0x74, 0xC3, 0x78, 0xD2, 0xA3, 0xE4, 0xC7, 0xDA, // BIN 1619: 9 pairs
+  0x0C, 0x04, 0x1C, 0x07, 0xE2, 0x21, 0xCC, 0x3D, 0x8C, 0x3F, 0x64, 0x4A, 0x92, 0x62, 0xA2, 0x67, 0xA2, 0x71, 0xBC, 0xA7, 0xE5, 0xC9, 0xF2, 0xEC, 0xFC, // BIN 1620: 12 pairs
+  0x0D, 0x08, 0x2C, 0x24, 0xBE, 0x27, 0xEC, 0x34, 0x6E, 0x3B, 0xFA, 0x3D, 0xA5, 0x43, 0x6A, 0x45, 0x80, 0x6F, 0xBA, 0x87, 0xD3, 0x95, 0xF6, 0x9D, 0xD4, 0xDC, 0xF4, // BIN 1621: 13 pairs
+  0x08, 0x06, 0x1F, 0x0D, 0x2A, 0x0E, 0xF4, 0x3F, 0x73, 0x47, 0xD4, 0x5E, 0x8E, 0x62, 0xA4, 0xA2, 0xD9, // BIN 1622: 8 pairs
+  0x0A, 0x06, 0xF3, 0x17, 0x86, 0x2B, 0xFE, 0x69, 0x6A, 0x69, 0xF4, 0x6F, 0xB1, 0x79, 0xD5, 0x99, 0xCB, 0x9A, 0xCB, 0xB1, 0xF3, // BIN 1623: 10 pairs
+  0x0E, 0x06, 0xE2, 0x13, 0xBC, 0x17, 0x36, 0x17, 0x72, 0x21, 0x5B, 0x3F, 0x6B, 0x45, 0x76, 0x4B, 0xB9, 0x5A, 0x85, 0x6E, 0xD5, 0xA3, 0xA5, 0xAE, 0xF1, 0xC2, 0xC6, 0xD9, 0xFB, // BIN 1624: 14 pairs
+  0x0E, 0x04, 0xE2, 0x0B, 0x88, 0x13, 0xE6, 0x14, 0x18, 0x16, 0xF5, 0x1C, 0x9E, 0x28, 0x6C, 0x2A, 0x64, 0x57, 0xF4, 0x96, 0xE6, 0x9E, 0xE2, 0xAA, 0xC3, 0xC0, 0xF2, 0xEB, 0xED, // BIN 1625: 14 pairs
+  0x13, 0x05, 0x42, 0x0A, 0xA8, 0x18, 0x65, 0x1D, 0xBE, 0x27, 0x74, 0x4E, 0x6D, 0x51, 0x75, 0x52, 0x97, 0x56, 0xC0, 0x67, 0xB3, 0x6C, 0xB7, 0x72, 0xBC, 0x73, 0xA1, 0x75, 0xE0, 0x7B, 0x8A, 0x99, 0xC1, 0x9A, 0xC1, 0xA8, 0xE7, 0xAB, 0xEF, // BIN 1626: 19 pairs
+  0x12, 0x02, 0x34, 0x08, 0x34, 0x09, 0xBB, 0x0D, 0xE5, 0x1A, 0x6A, 0x21, 0xC0, 0x2E, 0x48, 0x34, 0x6C, 0x39, 0x65, 0x3E, 0x80, 0x43, 0x8A, 0x4B, 0x6B, 0x4C, 0xA1, 0x4E, 0x80, 0x6F, 0xA9, 0x6F, 0xC6, 0x89, 0xAC, 0xB6, 0xC7, // BIN 1627: 18 pairs
+  0x0C, 0x0F, 0x8B, 0x1B, 0xE8, 0x1E, 0x6A, 0x2E, 0xFD, 0x40, 0xF0, 0x76, 0xB6, 0xAD, 0xF1, 0xAF, 0xB3, 0xB3, 0xFE, 0xBE, 0xBF, 0xC1, 0xEA, 0xC2, 0xFE, // BIN 1628: 12 pairs
+  0x09, 0x03, 0x33, 0x14, 0x1E, 0x2D, 0x70, 0x52, 0x79, 0x59, 0xB6, 0x73, 0xE1, 0x94, 0xF8, 0xD1, 0xD5, 0xE2, 0xFF, // BIN 1629: 9 pairs
+  0x0A, 0x07, 0xDA, 0x11, 0x51, 0x13, 0x4E, 0x15, 0x54, 0x25, 0x74, 0x53, 0x98, 0x5E, 0xA3, 0x66, 0xDA, 0x83, 0xD3, 0x96, 0xC9, // BIN 1630: 10 pairs
+  0x0B, 0x12, 0xE3, 0x18, 0x8C, 0x18, 0xFB, 0x29, 0x5C, 0x52, 0xBE, 0x5C, 0xC3, 0x5D, 0xCC, 0x61, 0xA3, 0x67, 0x98, 0x6A, 0x6C, 0xD7, 0xE4, // BIN 1631: 11 pairs
+  0x10, 0x00, 0x2C, 0x08, 0x28, 0x0E, 0x3E, 0x2F, 0x85, 0x36, 0xFC, 0x43, 0xA1, 0x49, 0x5C, 0x4F, 0x8D, 0x57, 0xB2, 0x6C, 0xDF, 0x6F, 0xC5, 0x70, 0xBC, 0x87, 0xD6, 0x96, 0xDB, 0xAA, 0xF3, 0xD5, 0xEC, // BIN 1632: 16 pairs
+  0x0B, 0x06, 0x2C, 0x14, 0x78, 0x2B, 0xC7, 0x2E, 0xE1, 0x32, 0x73, 0x39, 0x92, 0x57, 0xB4, 0x64, 0xB5, 0x97, 0xA0, 0xB6, 0xD1, 0xDD, 0xFD, // BIN 1633: 11 pairs
+  0x10, 0x08, 0xE7, 0x19, 0xD9, 0x20, 0xDD, 0x26, 0x67, 0x2C, 0x6C, 0x2E, 0x8C, 0x31, 0x78, 0x46, 0x6E, 0x4E, 0x87, 0x52, 0xB3, 0x59, 0x73, 0x5C, 0xB8, 0x64, 0xD9, 0x6A, 0x7F, 0x73, 0xC2, 0xA6, 0xC3, // BIN 1634: 16 pairs
+  0x13, 0x09, 0x78, 0x18, 0x5A, 0x18, 0xC7, 0x1B, 0x23, 0x2A, 0x6F, 0x2C, 0x68, 0x45, 0x7E, 0x4F, 0x60, 0x5B, 0x97, 0x66, 0xD8, 0x73, 0xFF, 0x7A, 0x96, 0x80, 0xCB, 0x88, 0xB4, 0x8A, 0xC3, 0x8F, 0x9D, 0x90, 0xE5, 0xAF, 0xF9, 0xD5, 0xFE, // BIN 1635: 19 pairs
+  0x0C, 0x06, 0x28, 0x0B, 0x2A, 0x1C, 0xFB, 0x42, 0x63, 0x58, 0x6F, 0x5B, 0x94, 0x69, 0xD8, 0x6A, 0xFF, 0x6E, 0xB1, 0x72, 0x94, 0x7B, 0xCE, 0xAD, 0xD1, // BIN 1636: 12 pairs
+  0x12, 0x01, 0x3A, 0x15, 0xF6, 0x2D, 0x71, 0x39, 0xEA, 0x49, 0xF8, 0x4D, 0x6B, 0x59, 0xAE, 0x64, 0x79, 0x6C, 0xDB, 0x6E, 0xBF, 0x73, 0xA0, 0x73, 0xAF, 0x7C, 0xD7, 0x86, 0xEE, 0x8F, 0xC1, 0xA2, 0xF6, 0xAF, 0xE4, 0xD2, 0xEF, // BIN 1637: 18 pairs
+  0x0B, 0x03, 0xD2, 0x07, 0x35, 0x0B, 0xFB, 0x10, 0x51, 0x52, 0x7E, 0x5F, 0xA3, 0x69, 0xDA, 0x6E, 0xB0, 0x89, 0xCD, 0xA8, 0xAE, 0xD1, 0xD3, // BIN 1638: 11 pairs
+  0x0D, 0x0A, 0x31, 0x0B, 0x33, 0x1B, 0x2D, 0x34, 0x68, 0x43, 0xA7, 0x47, 0xA2, 0x59, 0xB2, 0x5E, 0x87, 0x5F, 0xD3, 0x80, 0xDA, 0x91, 0xFF, 0xB5, 0xFA, 0xB9, 0xCB, // BIN 1639: 13 pairs
+  0x0A, 0x01, 0x88, 0x0F, 0x95, 0x32, 0x6F, 0x37, 0x6D, 0x4F, 0x73, 0x67, 0x68, 0x73, 0xAE, 0x83, 0xBE, 0x9C, 0xF3, 0xD0, 0xED, // BIN 1640: 10 pairs
+  0x0D, 0x05, 0xF9, 0x1F, 0x6C, 0x29, 0x81, 0x2C, 0x6E, 0x2F, 0x6A, 0x4C, 0x76, 0x4C, 0x83, 0x57, 0xAE, 0x68, 0xB7, 0x6A, 0x7A, 0x81, 0xAB, 0x91, 0xE2, 0xBA, 0xFB, // BIN 1641: 13 pairs
+  0x0B, 0x04, 0x22, 0x11, 0x9E, 0x13, 0x3A, 0x17, 0xA8, 0x27, 0x88, 0x2B, 0x39, 0x2B, 0xD1, 0x32, 0x5F, 0x4B, 0x8A, 0x8C, 0x94, 0xBF, 0xFB, // BIN 1642: 11 pairs
+  0x0A, 0x16, 0x5A, 0x26, 0x78, 0x26, 0x7F, 0x3E, 0xAC, 0x57, 0x87, 0x66, 0x74, 0x70, 0x80, 0xBC, 0xFA, 0xC9, 0xE3, 0xD4, 0xE9, // BIN 1643: 10 pairs
+  0x0F, 0x00, 0x30, 0x00, 0x40, 0x04, 0x45, 0x06, 0x34, 0x09, 0x32, 0x0C, 0xF2, 0x17, 0xD1, 0x36, 0x65, 0x56, 0xF6, 0x59, 0xB4, 0x66, 0xDF, 0x8D, 0xC7, 0x9D, 0xEE, 0xB7, 0xF5, 0xB8, 0xC9, // BIN 1644: 15 pairs
+  0x0E, 0x06, 0x97, 0x09, 0x55, 0x1D, 0xEE, 0x20, 0x79, 0x26, 0x65, 0x2E, 0x41, 0x3C, 0x54, 0x55, 0x8E, 0x55, 0xA0, 0x5E, 0x67, 0x8C, 0xAF, 0x93, 0xFC, 0xBA, 0xF2, 0xEB, 0xFD, // BIN 1645: 14 pairs
+  0x0D, 0x09, 0x0A, 0x12, 0xC7, 0x15, 0xF4, 0x1B, 0x7C, 0x24, 0x73, 0x40, 0x88, 0x42, 0x5F, 0x4A, 0x64, 0x74, 0xA7, 0x90, 0xB2, 0x94, 0xE2, 0xAC, 0xFB, 0xB1, 0xF4, // BIN 1646: 13 pairs
+  0x0D, 0x0E, 0x0F, 0x10, 0x8C, 0x1F, 0xFD, 0x2F, 0xF9, 0x32, 0x74, 0x4C, 0xBD, 0x4E, 0x89, 0x73, 0x9B, 0x87, 0xB9, 0xAC, 0xF1, 0xBD, 0xF5, 0xCE, 0xFC, 0xD0, 0xEE, // BIN 1647: 13 pairs
+  0x0D, 0x00, 0x2A, 0x07, 0xF7, 0x10, 0x6B, 0x13, 0x23, 0x17, 0x5A, 0x30, 0x6E, 0x63, 0xD3, 0x64, 0xEC, 0x6A, 0xA2, 0x96, 0xE0, 0xA5, 0xF2, 0xB0, 0xF3, 0xB1, 0xF2, // BIN 1648: 13 pairs
+  0x0E, 0x02, 0x33, 0x08, 0x1F, 0x0C, 0x22, 0x0D, 0xE6, 0x1A, 0xF2, 0x32, 0x63, 0x3E, 0x92, 0x49, 0x76, 0x4B, 0xAC, 0x69, 0xBF, 0x73, 0x85, 0x7C, 0xD5, 0x8D, 0xE0, 0xEB, 0xFA, // BIN 1649: 14 pairs
+  0x09, 0x00, 0xC3, 0x04, 0xBA, 0x15, 0x58, 0x17, 0x3E, 0x1D, 0x55, 0x29, 0xF8, 0x3B, 0xC7, 0x4D, 0x98, 0x89, 0xCC, // BIN 1650: 9 pairs
+  0x09, 0x08, 0x37, 0x0F, 0x3A, 0x4C, 0xA7, 0x57, 0x74, 0x5C, 0x79, 0x71, 0xCB, 0x74, 0xAA, 0x7E, 0xD8, 0xD8, 0xFA, // BIN 1651: 9 pairs
+  0x0E, 0x02, 0xBE, 0x07, 0x2E, 0x1F, 0x6D, 0x1F, 0xF4, 0x35, 0x86, 0x36, 0xEA, 0x42, 0x9E, 0x53, 0x94, 0x5D, 0xBA, 0x65, 0x82, 0x6C, 0x73, 0x89, 0xD0, 0xAB, 0xF0, 0xB8, 0xF5, // BIN 1652: 14 pairs
+  0x0C, 0x02, 0x37, 0x22, 0x47, 0x26, 0x85, 0x30, 0x6C, 0x41, 0x52, 0x69, 0x73, 0x76, 0x99, 0x76, 0x9A, 0x8B, 0xC2, 0x96, 0xBD, 0xD1, 0xDD, 0xD2, 0xFD, // BIN 1653: 12 pairs
+  0x0B, 0x0C, 0x32, 0x17, 0x65, 0x18, 0x36, 0x28, 0x6D, 0x28, 0x6E, 0x31, 0x7F, 0x39, 0xFC, 0x6A, 0x92, 0x6E, 0x96, 0x8F, 0xCB, 0xC7, 0xDF, // BIN 1654: 11 pairs
+  0x06, 0x02, 0xE0, 0x3F, 0x58, 0x4E, 0x8C, 0x4F, 0x76, 0x63, 0xC4, 0x8E, 0xDD, // BIN 1655: 6 pairs
+  0x0E, 0x04, 0xE5, 0x07, 0x0D, 0x07, 0xB9, 0x0A, 0xDE, 0x2D, 0x72, 0x35, 0xF7, 0x41, 0xC0, 0x55, 0xA1, 0x61, 0xD7, 0x66, 0xDB, 0x67, 0xAB, 0x72, 0xB0, 0x8E, 0xDC, 0x97, 0xBB, // BIN 1656: 14 pairs
+  0x09, 0x0C, 0x3A, 0x89, 0xBD, 0x8B, 0xB8, 0x91, 0xEF, 0x9D, 0xE7, 0xB4, 0xFC, 0xC7, 0xD5, 0xCC, 0xD9, 0xDA, 0xFD, // BIN 1657: 9 pairs
+  0x0F, 0x04, 0x8F, 0x09, 0x12, 0x0D, 0xDE, 0x0F, 0x32, 0x3B, 0xEC, 0x41, 0x94, 0x57, 0x6A, 0x5F, 0xC4, 0x66, 0x76, 0x6B, 0xC2, 0x73, 0xBC, 0x91, 0xD4, 0x91, 0xD7, 0xA7, 0xF3, 0xE3, 0xF6, // BIN 1658: 15 pairs
+  0x0B, 0x0B, 0x4E, 0x10, 0xF3, 0x20, 0xBA, 0x21, 0xAA, 0x26, 0xF6, 0x40, 0x59, 0x48, 0xFC, 0x57, 0xD7, 0x6F, 0xC0, 0xD7, 0xFE, 0xDC, 0xEB, // BIN 1659: 11 pairs
+  0x0D, 0x00, 0xA8, 0x0B, 0xC2, 0x2D, 0xFF, 0x3C, 0x4F, 0x3E, 0xF9, 0x60, 0xEF, 0x78, 0xE0, 0x8C, 0xA2, 0x8E, 0xDE, 0xA4, 0xE2, 0xB7, 0xE1, 0xC3, 0xF3, 0xED, 0xF6, // BIN 1660: 13 pairs
+  0x0F, 0x05, 0x26, 0x21, 0xA6, 0x26, 0x60, 0x3F, 0x7C, 0x42, 0x8C, 0x48, 0x50, 0x53, 0x72, 0x5F, 0xF4, 0x62, 0xA7, 0x69, 0xDF, 0x74, 0x93, 0x94, 0xDE, 0xBC, 0xFF, 0xC7, 0xD3, 0xCE, 0xF9, // BIN 1661: 15 pairs
+  0x0F, 0x04, 0x2D, 0x0E, 0x21, 0x13, 0x2D, 0x15, 0xF1, 0x16, 0x3F, 0x1B, 0xAE, 0x49, 0x8A, 0x4F, 0xF6, 0x54, 0xEA, 0x5A, 0x97, 0x60, 0xD1, 0x69, 0xB7, 0x6D, 0xB1, 0x7C, 0xD2, 0xBB, 0xF2, // BIN 1662: 15 pairs
+  0x0B, 0x0A, 0x2F, 0x0D, 0xC2, 0x2B, 0xE4, 0x30, 0x68, 0x34, 0x6D, 0x3E, 0x8B, 0x48, 0xF4, 0x4C, 0x94, 0x62, 0xA6, 0x79, 0xC1, 0xA4, 0xE7, // BIN 1663: 11 pairs
+  0x09, 0x12, 0x45, 0x50, 0xEF, 0x59, 0xD4, 0x5C, 0x8D, 0x89, 0xA4, 0xB0, 0xF2, 0xB6, 0xF5, 0xB7, 0xF9, 0xE7, 0xFF, // BIN 1664: 9 pairs
+  0x0D, 0x21, 0x95, 0x29, 0x84, 0x29, 0xF9, 0x4E, 0x68, 0x56, 0x60, 0x5F, 0x65, 0x6E, 0xF6, 0x73, 0xAD, 0x88, 0xDE, 0x89, 0xCF, 0x91, 0xE9, 0x9E, 0xD6, 0xA5, 0xFE, // BIN 1665: 13 pairs
+  0x09, 0x12, 0x60, 0x2D, 0x6F, 0x5F, 0x73, 0x76, 0x84, 0x7D, 0x91, 0x80, 0xC2, 0x9D, 0xDF, 0xA2, 0xE3, 0xBC, 0xF4, // BIN 1666: 9 pairs
+  0x0B, 0x21, 0xF3, 0x2C, 0x6D, 0x31, 0xF8, 0x42, 0x88, 0x4B, 0x83, 0x4F, 0xC9, 0x5F, 0x89, 0x68, 0xE0, 0x91, 0xC9, 0xA5, 0xB7, 0xE1, 0xE8, // BIN 1667: 11 pairs
+  0x0E, 0x01, 0xB5, 0x04, 0x5D, 0x09, 0xFA, 0x2F, 0x5C, 0x36, 0x79, 0x3C, 0xFD, 0x52, 0x91, 0x69, 0xDB, 0x77, 0xED, 0x89, 0xDC, 0x92, 0xE8, 0x98, 0xDE, 0x9B, 0xB8, 0xC1, 0xF4, // BIN 1668: 14 pairs
+  0x08, 0x06, 0x37, 0x19, 0x6A, 0x23, 0x61, 0x50, 0x7C, 0x57, 0x8E, 0x7E, 0xA8, 0x8C, 0xD6, 0x8F, 0xB5, // BIN 1669: 8 pairs
+  0x0F, 0x00, 0x3A, 0x01, 0x46, 0x09, 0x3A, 0x10, 0x14, 0x17, 0xC7, 0x20, 0xDF, 0x21, 0xCF, 0x47, 0x67, 0x51, 0x8C, 0x5D, 0xAE, 0x76, 0xCB, 0xB6, 0xF2, 0xB9, 0xC1, 0xD3, 0xEC, 0xDE, 0xF8, // BIN 1670: 15 pairs
+  0x12, 0x00, 0x34, 0x01, 0xCB, 0x03, 0xE7, 0x09, 0x9B, 0x19, 0xF5, 0x29, 0x6A, 0x29, 0x7D, 0x3B, 0xD1, 0x47, 0xD7, 0x4C, 0xC6, 0x4D, 0xF8, 0x6D, 0xB0, 0x74, 0xBC, 0x88, 0x98, 0x8E, 0xDF, 0x95, 0xE2, 0xA1, 0xE6, 0xA4, 0xFB, // BIN 1671: 18 pairs
+  0x09, 0x0D, 0x51, 0x13, 0x5A, 0x3A, 0xFF, 0x3D, 0x59, 0x56, 0xCC, 0x75, 0xAB, 0x9E, 0xA3, 0xAB, 0xEB, 0xC4, 0xEC, // BIN 1672: 9 pairs
+  0x0B, 0x07, 0xEC, 0x18, 0x5B, 0x1D, 0x4C, 0x23, 0xFD, 0x25, 0xC7, 0x31, 0x85, 0x56, 0x8E, 0x6E, 0xF9, 0x73, 0x75, 0x89, 0xD3, 0xCE, 0xF8, // BIN 1673: 11 pairs
+  0x0A, 0x02, 0x3A, 0x10, 0xFC, 0x14, 0xC9, 0x20, 0x42, 0x20, 0x80, 0x52, 0x59, 0x5F, 0xD5, 0x79, 0xD2, 0x7C, 0xCE, 0xB0, 0xF4, // BIN 1674: 10 pairs
+  0x0C, 0x08, 0xE2, 0x09, 0xA7, 0x12, 0xD9, 0x17, 0x4A, 0x17, 0x8C, 0x18, 0x3E, 0x41, 0xCC, 0x48, 0xC0, 0x58, 0x8E, 0x5B, 0x8F, 0x74, 0xC2, 0x97, 0xA7, // BIN 1675: 12 pairs
+  0x11, 0x05, 0xA8, 0x07, 0xD7, 0x14, 0x44, 0x16, 0x5B, 0x1C, 0xEC, 0x27, 0x4C, 0x3A, 0x77, 0x3D, 0x88, 0x3E, 0x7E, 0x51, 0x7A, 0x5B, 0x95, 0x73, 0xA6, 0x90, 0xE6, 0x91, 0xBD, 0x91, 0xDA, 0x99, 0xE2, 0x9A, 0xE2, // BIN 1676: 17 pairs
+  0x0C, 0x11, 0xA5, 0x17, 0x39, 0x1D, 0x43, 0x3B, 0x4C, 0x48, 0x65, 0x90, 0xB4, 0x91, 0x9C, 0x99, 0xF3, 0x9A, 0xF3, 0x9D, 0xDD, 0x9E, 0xFE, 0xBE, 0xF5, // BIN 1677: 12 pairs
+  0x0A, 0x1C, 0xA5, 0x22, 0xEF, 0x44, 0x59, 0x56, 0xBB, 0x5A, 0x94, 0x70, 0xA3, 0x75, 0xD2, 0x93, 0xC1, 0xA2, 0xC7, 0xC1, 0xFE, // BIN 1678: 10 pairs
+  0x0D, 0x11, 0x64, 0x15, 0xF0, 0x25, 0xD1, 0x25, 0xE4, 0x29, 0x7A, 0x3A, 0x66, 0x4A, 0xB9, 0x5B, 0x9E, 0x8E, 0xE0, 0x8F, 0xA9, 0xA0, 0xE6, 0xA1, 0xE5, 0xCB, 0xFB, // BIN 1679: 13 pairs
 };
+
+const size_t bytestream_len = sizeof(catalog_bytestream);
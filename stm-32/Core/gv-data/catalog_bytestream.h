@@ -1,9 +1,18 @@
 #ifndef CATALOG_BYTESTREAM_H
 #define CATALOG_BYTESTREAM_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 extern const uint8_t catalog_bytestream[];
 extern const size_t bytestream_len;
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif // CATALOG_BYTESTREAM_H
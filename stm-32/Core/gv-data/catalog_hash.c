@@ -0,0 +1,909 @@
+// AUTO-GENERATED GEOMETRIC HASH
+#include "catalog_hash.h"
+
+const uint16_t hash_start[HASH_SIZE + 1] = {
+    0, 10, 12, 13, 14, 23, 23, 23, 33, 33, 34, 34, 
+    34, 39, 40, 46, 50, 50, 52, 63, 63, 63, 71, 74, 
+    74, 78, 80, 81, 82, 84, 85, 96, 106, 106, 109, 109, 
+    112, 114, 115, 117, 117, 124, 124, 127, 129, 131, 131, 131, 
+    133, 135, 140, 141, 142, 144, 145, 149, 150, 154, 155, 155, 
+    161, 166, 166, 170, 170, 170, 170, 173, 176, 176, 183, 183, 
+    183, 183, 185, 186, 186, 186, 190, 190, 194, 199, 204, 204, 
+    206, 208, 211, 212, 212, 217, 219, 221, 224, 228, 231, 234, 
+    242, 245, 246, 249, 256, 256, 257, 257, 266, 269, 270, 270, 
+    270, 270, 275, 281, 283, 285, 287, 289, 289, 292, 292, 304, 
+    305, 306, 306, 312, 315, 316, 319, 319, 320, 320, 321, 324, 
+    336, 340, 344, 344, 344, 349, 349, 352, 354, 356, 363, 363, 
+    363, 366, 367, 372, 375, 381, 385, 385, 389, 389, 398, 404, 
+    404, 405, 407, 411, 411, 416, 423, 424, 425, 427, 430, 430, 
+    433, 436, 440, 441, 441, 443, 446, 446, 446, 451, 454, 457, 
+    461, 464, 464, 469, 473, 475, 476, 478, 489, 502, 504, 507, 
+    508, 509, 514, 515, 519, 524, 528, 534, 546, 548, 549, 549, 
+    556, 557, 560, 563, 570, 577, 580, 580, 581, 585, 589, 597, 
+    598, 602, 602, 614, 615, 616, 617, 627, 633, 641, 644, 646, 
+    653, 656, 660, 661, 663, 666, 667, 672, 676, 678, 681, 688, 
+    692, 692, 693, 694, 694, 697, 697, 700, 701, 707, 711, 714, 
+    715, 716, 721, 721, 721, 721, 726, 726, 728, 728, 730, 743, 
+    753, 757, 757, 757, 758, 761, 764, 765, 767, 768, 768, 768, 
+    768, 769, 771, 775, 779, 779, 782, 787, 789, 792, 800, 805, 
+    808, 809, 809, 813, 817, 817, 821, 821, 823, 825, 827, 833, 
+    835, 836, 837, 839, 841, 843, 844, 857, 857, 861, 862, 862, 
+    862, 864, 866, 866, 870, 873, 874, 881, 884, 895, 895, 896, 
+    901, 903, 903, 905, 905, 906, 908, 908, 911, 914, 917, 922, 
+    925, 925, 929, 935, 935, 937, 937, 940, 944, 947, 953, 954, 
+    960, 960, 960, 966, 970, 970, 974, 976, 981, 986, 990, 990, 
+    992, 996, 1004, 1004, 1004, 1004, 1004, 1016, 1022, 1025, 1028, 1029, 
+    1030, 1034, 1041, 1043, 1047, 1056, 1056, 1056, 1056, 1058, 1062, 1062, 
+    1065, 1068, 1075, 1077, 1079, 1079, 1081, 1084, 1086, 1087, 1088, 1090, 
+    1095, 1097, 1099, 1099, 1099, 1102, 1104, 1111, 1116, 1116, 1117, 1123, 
+    1123, 1126, 1126, 1126, 1135, 1143, 1143, 1144, 1146, 1146, 1147, 1149, 
+    1151, 1154, 1155, 1157, 1159, 1160, 1162, 1168, 1169, 1175, 1175, 1178, 
+    1182, 1182, 1195, 1198, 1199, 1203, 1203, 1205, 1209, 1209, 1209, 1209, 
+    1214, 1225, 1229, 1234, 1236, 1239, 1241, 1241, 1244, 1245, 1248, 1252, 
+    1255, 1255, 1255, 1261, 1261, 1263, 1268, 1270, 1274, 1275, 1275, 1276, 
+    1279, 1280, 1284, 1288, 1293, 1295, 1304, 1304, 1304, 1306, 1307, 1309, 
+    1313, 1313, 1314, 1319, 1325, 1331, 1334, 1336, 1338, 1340, 1344, 1344, 
+    1346, 1354, 1358, 1362, 1362, 1363, 1365, 1365, 1365, 1367, 1367, 1372, 
+    1374, 1378, 1378, 1380, 1380, 1380, 1385, 1385, 1389, 1404, 1405, 1405, 
+    1405, 1411, 1411, 1411, 1411, 1413, 1415, 1429, 1429, 1430, 1434, 1438, 
+    1441, 1441, 1448, 1449, 1454, 1454, 1455, 1459, 1469, 1469, 1475, 1477, 
+    1479, 1481, 1481, 1481, 1481, 1481, 1486, 1492, 1493, 1493, 1495, 1496, 
+    1503, 1510, 1512, 1512, 1519, 1520, 1520, 1522, 1528, 1538, 1540, 1542, 
+    1545, 1553, 1553, 1553, 1553, 1556, 1562, 1564, 1564, 1564, 1564, 1569, 
+    1575, 1575, 1579, 1583, 1584, 1584, 1586, 1587, 1593, 1594, 1599, 1599, 
+    1605, 1607, 1607, 1609, 1613, 1617, 1622, 1624, 1625, 1626, 1627, 1628, 
+    1631, 1636, 1644, 1647, 1650, 1655, 1658, 1659, 1659, 1662, 1666, 1667, 
+    1667, 1670, 1670, 1675, 1676, 1681, 1684, 1685, 1688, 1693, 1694, 1694, 
+    1694, 1695, 1698, 1701, 1703, 1703, 1706, 1706, 1709, 1710, 1713, 1715, 
+    1717, 1717, 1717, 1720, 1728, 1731, 1734, 1736, 1738, 1740, 1741, 1744, 
+    1746, 1747, 1749, 1754, 1760, 1764, 1767, 1773, 1776, 1778, 1778, 1780, 
+    1782, 1785, 1788, 1791, 1794, 1797, 1802, 1806, 1806, 1807, 1812, 1812, 
+    1812, 1821, 1821, 1822, 1824, 1826, 1827, 1827, 1836, 1838, 1840, 1840, 
+    1841, 1843, 1843, 1849, 1857, 1861, 1861, 1862, 1862, 1864, 1873, 1882, 
+    1884, 1884, 1888, 1888, 1888, 1888, 1891, 1894, 1901, 1904, 1904, 1905, 
+    1908, 1911, 1918, 1921, 1927, 1929, 1929, 1936, 1942, 1947, 1951, 1953, 
+    1955, 1958, 1964, 1964, 1964, 1967, 1971, 1973, 1976, 1976, 1976, 1977, 
+    1986, 2003, 2003, 2008, 2008, 2016, 2016, 2016, 2017, 2017, 2017, 2019, 
+    2020, 2024, 2029, 2037, 2039, 2042, 2051, 2052, 2054, 2058, 2061, 2067, 
+    2071, 2073, 2075, 2077, 2077, 2079, 2083, 2088, 2099, 2100, 2103, 2106, 
+    2111, 2111, 2113, 2119, 2120, 2120, 2124, 2133, 2133, 2137, 2137, 2137, 
+    2137, 2144, 2148, 2150, 2154, 2157, 2157, 2157, 2161, 2165, 2177, 2179, 
+    2183, 2185, 2185, 2186, 2188, 2191, 2195, 2204, 2208, 2216, 2216, 2216, 
+    2218, 2223, 2223, 2229, 2231, 2232, 2235, 2238, 2238, 2244, 2251, 2252, 
+    2253, 2256, 2257, 2265, 2270, 2270, 2273, 2274, 2278, 2279, 2279, 2281, 
+    2283, 2285, 2289, 2291, 2304, 2304, 2304, 2305, 2305, 2307, 2311, 2311, 
+    2315, 2317, 2318, 2318, 2322, 2329, 2330, 2334, 2335, 2338, 2338, 2342, 
+    2348, 2350, 2353, 2357, 2366, 2369, 2370, 2374, 2377, 2379, 2380, 2382, 
+    2384, 2389, 2390, 2396, 2398, 2403, 2408, 2412, 2415, 2415, 2415, 2420, 
+    2420, 2423, 2428, 2430, 2432, 2434, 2438, 2441, 2441, 2445, 2447, 2451, 
+    2457, 2459, 2460, 2462, 2464, 2466, 2474, 2477, 2479, 2479, 2485, 2489, 
+    2495, 2497, 2500, 2500, 2501, 2505, 2505, 2507, 2510, 2512, 2512, 2514, 
+    2516, 2519, 2519, 2524, 2525, 2526, 2530, 2537, 2539, 2540, 2541, 2543, 
+    2547, 2548, 2549, 2553, 2554, 2560, 2561, 2562, 2563, 2565, 2566, 2570, 
+    2573, 2573, 2579, 2592, 2599, 2603, 2604, 2605, 2609, 2610, 2613, 2616, 
+    2617, 2618, 2619, 2619, 2623, 2624, 2625, 2625, 2627, 2629, 2633, 2633, 
+    2633, 2633, 2633, 2636, 2636, 2640, 2643, 2645, 2648, 2656, 2659, 2660, 
+    2660, 2666, 2668, 2670, 2676, 2676, 2679, 2682, 2688, 2691, 2691, 2703, 
+    2705, 2708, 2714, 2715, 2715, 2718, 2720, 2720, 2721, 2725, 2731, 2736, 
+    2740, 2740, 2742, 2743, 2749, 2754, 2754, 2755, 2759, 2761, 2762, 2764, 
+    2767, 2773, 2777, 2777, 2778, 2779, 2781, 2781, 2781, 2782, 2786, 2786, 
+    2792, 2794, 2794, 2799, 2801, 2804, 2805, 2805, 2816, 2820, 2825, 2826, 
+    2826, 2826, 2830, 2834, 2837, 2839, 2846, 2851, 2851, 2851, 2853, 2859, 
+    2868, 2870, 2875, 2876, 2877, 2882, 2883, 2886, 2888, 2888, 2888, 2889, 
+    2893, 2893, 2895, 2898, 2898, 2900, 2905, 2914, 2917, 2917, 2917, 2917, 
+    2918, 2918, 2924, 2940, 2941, 2943, 2943, 2946, 2948, 2948, 2948, 2953, 
+    2966, 2968, 2970, 2972, 2973, 2974, 2980, 2980, 2980, 2980, 2992, 2999, 
+    3000, 3004, 3004, 3010, 3015, 3024, 3026, 3026, 3027, 3035, 3043, 3053, 
+    3053, 3053, 3059, 3059, 3060, 3061, 3064, 3065, 3066, 3067, 3070, 3075, 
+    3075, 3077, 3077, 3084, 3095, 3099, 3101, 3103, 3105, 3108, 3109, 3113, 
+    3115, 3119, 3121, 3128, 3132, 3135, 3138, 3139, 3143, 3149, 3157, 3158, 
+    3159, 3161, 3164, 3164, 3170, 3174, 3175, 3176, 3189, 3200, 3200, 3201, 
+    3201, 3201, 3204, 3206, 3206, 3212, 3213, 3222, 3225, 3230, 3232, 3233, 
+    3234, 3234, 3239, 3243, 3248, 3249, 3251, 3254, 3256, 3259, 3266, 3268, 
+    3270, 3271, 3273, 3275, 3276, 3278, 3279, 3281, 3290, 3295, 3295, 3301, 
+    3303, 3305, 3305, 3311, 3311, 3315, 3321, 3323, 3326, 3332, 3335, 3336, 
+    3338, 3341, 3343, 3345, 3353, 3353, 3353, 3354, 3364, 3364, 3364, 3366, 
+    3370, 3371, 3372, 3372, 3372, 3374, 3380, 3380, 3383, 3383, 3386, 3392, 
+    3393, 3396, 3398, 3401, 3401, 3403, 3405, 3408, 3408, 3409, 3410, 3414, 
+    3414, 3414, 3420, 3420, 3421, 3428, 3431, 3438, 3441, 3441, 3444, 3448, 
+    3455, 3459, 3463, 3465, 3465, 3469, 3470, 3471, 3473, 3474, 3476, 3480, 
+    3481, 3484, 3484, 3485, 3487, 3490, 3497, 3498, 3499, 3501, 3502, 3506, 
+    3517, 3517, 3518, 3518, 3519, 3530, 3535, 3543, 3543, 3543, 3546, 3557, 
+    3563, 3564, 3571, 3574, 3574, 3575, 3575, 3576, 3580, 3584, 3587, 3589, 
+    3589, 3592, 3592, 3593, 3604, 3609, 3611, 3615, 3618, 3619, 3624, 3629, 
+    3631, 3631, 3635, 3636, 3640, 3640, 3640, 3642, 3646, 3651, 3652, 3654, 
+    3656, 3658, 3659, 3662, 3662, 3666, 3678, 3683, 3688, 3692, 3693, 3693, 
+    3701, 3704, 3713, 3717, 3718, 3722, 3722, 3722, 3729, 3737, 3741, 3741, 
+    3742, 3749, 3751, 3751, 3752, 3762, 3763, 3765, 3771, 3771, 3773, 3775, 
+    3777, 3778, 3778, 3781, 3786, 3786, 3791, 3791, 3794, 3795, 3795, 3796, 
+    3803, 3808, 3809, 3811, 3813, 3815, 3817, 3817, 3822, 3822, 3823, 3829, 
+    3829, 3832, 3840, 3842, 3847, 3848, 3850, 3853, 3856, 3858, 3859, 3865, 
+    3869, 3869, 3876, 3877, 3877, 3885, 3888, 3888, 3891, 3892, 3893, 3894, 
+    3898, 3898, 3901, 3902, 3905, 3909, 3916, 3916, 3916, 3923, 3926, 3932, 
+    3936, 3937, 3938, 3939, 3940, 3947, 3950, 3953, 3959, 3961, 3965, 3965, 
+    3966, 3968, 3970, 3970, 3974, 3981, 3986, 3987, 3992, 3996, 3997, 4000, 
+    4009, 4009, 4010, 4019, 4022, 4025, 4028, 4029, 4029, 4035, 4043, 4044, 
+    4047, 4047, 4048, 4052, 4053, 4059, 4066, 4069, 4070, 4072, 4073, 4075, 
+    4076, 4084, 4085, 4087, 4092, 4093, 4096, 4096, 4098, 4100, 4101, 4105, 
+    4106, 4107, 4107, 4109, 4111, 4111, 4114, 4118, 4122, 4123, 4125, 4125, 
+    4125, 4125, 4125, 4127, 4130, 4132, 4132, 4135, 4138, 4141, 4144, 4147, 
+    4147, 4153, 4156, 4159, 4162, 4162, 4167, 4170, 4173, 4176, 4179, 4179, 
+    4179, 4179, 4184, 4187, 4190, 4192, 4193, 4197, 4200, 4200, 4202, 4205, 
+    4206, 4208, 4212, 4212, 4215, 4216, 4217, 4217, 4222, 4226, 4228, 4234, 
+    4245, 4245, 4245, 4245, 4245, 4248, 4253, 4254, 4258, 4259, 4265, 4265, 
+    4270, 4271, 4274, 4284, 4285, 4285, 4285, 4287, 4288, 4290, 4291, 4298, 
+    4304, 4305, 4307, 4309, 4310, 4316, 4318, 4318, 4318, 4319, 4319, 4320, 
+    4322, 4323, 4326, 4332, 4335, 4336, 4339, 4342, 4346, 4349, 4351, 4352, 
+    4352, 4353, 4353, 4356, 4358, 4359, 4365, 4366, 4366, 4371, 4372, 4373, 
+    4373, 4374, 4375, 4381, 4387, 4389, 4390, 4398, 4398, 4399, 4405, 4405, 
+    4408, 4410, 4410, 4418, 4420, 4421, 4430, 4439, 4440, 4445, 4445, 4445, 
+    4447, 4455, 4458, 4458, 4463, 4464, 4466, 4467, 4470, 4477, 4481, 4484, 
+    4484, 4487, 4487, 4491, 4497, 4503, 4503, 4504, 4511, 4515, 4522, 4525, 
+    4527, 4530, 4536, 4538, 4539, 4541, 4542, 4544, 4544, 4544, 4549, 4554, 
+    4554, 4562, 4566, 4566, 4567, 4567, 4567, 4577, 4583, 4583, 4585, 4587, 
+    4592, 4593, 4595, 4596, 4605, 4611, 4615, 4615, 4623, 4626, 4632, 4633, 
+    4637, 4644, 4648, 4658, 4659, 4662, 4663, 4668, 4672, 4672, 4679, 4680, 
+    4680, 4685, 4687, 4687, 4687, 4688, 4690, 4693, 4693, 4696, 4702, 4702, 
+    4705, 4708, 4708, 4709, 4714, 4718, 4734, 4745, 4747, 4749, 4754, 4755, 
+    4760, 4762, 4766, 4767, 4767, 4775, 4778, 4779, 4780, 4790, 4790, 4790, 
+    4790, 4795, 4800, 4801, 4803, 4810, 4811, 4815, 4815, 4817, 4817, 4819, 
+    4820, 4826, 4831, 4834, 4838, 4839, 4846, 4851, 4851, 4851, 4852, 4855, 
+    4860, 4863, 4870, 4871, 4877, 4877, 4880, 4880, 4880, 4881, 4885, 4886, 
+    4895, 4898, 4907, 4907, 4907, 4907, 4914, 4916, 4921, 4923, 4924, 4928, 
+    4929, 4932, 4933, 4935, 4935, 4936, 4940, 4942, 4943, 4945, 4947, 4950, 
+    4954, 4957, 4957, 4962, 4966, 4967, 4967, 4972, 4973, 4975, 4976, 4979, 
+    4982, 4986, 4993, 4993, 4994, 4994, 4994, 5000, 5005, 5009, 5016, 5016, 
+    5019, 5024, 5024, 5025, 5028, 5031, 5034, 5036, 5039, 5039, 5039, 5042, 
+    5045, 5054, 5066, 5066, 5066, 5068, 5076, 5078, 5081, 5081, 5083, 5089, 
+    5093, 5094, 5094, 5096, 5101, 5102, 5105, 5107, 5109, 5112, 5113, 5115, 
+    5117, 5128, 5130, 5132, 5132, 5139, 5140, 5142, 5143, 5143, 5146, 5146, 
+    5148, 5154, 5154, 5155, 5156, 5165, 5171, 5181, 5181, 5186, 5194, 5196, 
+    5200, 5200, 5200, 5208, 5209, 5213, 5215, 5218, 5223, 5223, 5224, 5228, 
+    5231, 5237, 5242, 5248, 5251, 5252, 5255, 5260, 5260, 5260, 5263, 5270, 
+    5270, 5272, 5272, 5273, 5278, 5279, 5279, 5279, 5285, 5289, 5295, 5297, 
+    5297, 5298, 5298, 5298, 5301, 5301, 5306, 5310, 5311, 5316, 5316, 5322, 
+    5327, 5327, 5328, 5331, 5331, 5336, 5339, 5340, 5343, 5348, 5351, 5352, 
+    5352, 5357, 5361, 5363, 5369, 5371, 5374, 5374, 5378, 5379, 5380, 5381, 
+    5381, 5383, 5383, 5384, 5390, 5391, 5395, 5403, 5405, 5412, 5413, 5417, 
+    5417, 5417, 5421, 5423, 5424, 5425, 5426, 5426, 5426, 5431, 5431, 5434, 
+    5437, 5437, 5442, 5448, 5452, 5454, 5462, 5466, 5468, 5470, 5472, 5476, 
+    5478, 5479, 5481, 5488, 5493, 5493, 5495, 5497, 5498, 5503, 5503, 5507, 
+    5511, 5514, 5517, 5522, 5523, 5523, 5524, 5527, 5532, 5540, 5540, 5541, 
+    5541, 5543, 5545, 5545, 5550, 5555, 5559, 5560, 5562, 5567, 5568, 5568, 
+    5570, 5575, 5578, 5579, 5580, 5581, 5583, 5584, 5585, 5586, 5586, 5588, 
+    5589, 5590, 5597, 5597, 5599, 5599, 5603, 5605, 5606, 5608, 5614, 5616, 
+    5621, 5623, 5623, 5624, 5627, 5627, 5632, 5634, 5640
+};
+
+const uint8_t hash_entries[] = {
+    16, 18, 41, 56, 68, 122, 166, 170, 202, 221, 15, 254, 
+    21, 124, 24, 76, 87, 96, 149, 183, 198, 249, 252, 98, 
+    99, 122, 128, 170, 191, 192, 211, 222, 223, 159, 33, 138, 
+    151, 190, 247, 203, 54, 61, 66, 68, 139, 215, 33, 205, 
+    245, 251, 17, 128, 74, 92, 99, 108, 137, 144, 177, 202, 
+    215, 220, 247, 27, 33, 70, 71, 82, 149, 165, 255, 51, 
+    213, 218, 97, 182, 218, 241, 1, 203, 158, 232, 96, 171, 
+    98, 6, 19, 51, 103, 158, 160, 161, 166, 167, 177, 217, 
+    18, 54, 62, 64, 71, 75, 83, 86, 120, 149, 45, 95, 
+    140, 126, 137, 168, 190, 198, 136, 4, 124, 22, 41, 49, 
+    56, 68, 84, 164, 21, 202, 250, 49, 143, 24, 87, 17, 
+    81, 43, 60, 1, 12, 41, 81, 173, 4, 136, 13, 37, 
+    160, 232, 241, 245, 253, 243, 16, 18, 43, 183, 0, 1, 
+    15, 102, 108, 155, 254, 37, 76, 101, 183, 184, 4, 21, 
+    232, 235, 125, 156, 210, 158, 219, 228, 38, 147, 155, 172, 
+    179, 187, 233, 87, 97, 80, 93, 141, 230, 231, 43, 49, 
+    73, 118, 34, 81, 158, 227, 241, 66, 83, 105, 170, 216, 
+    35, 196, 129, 136, 10, 17, 141, 52, 58, 121, 155, 174, 
+    215, 72, 123, 86, 220, 12, 17, 151, 103, 118, 142, 231, 
+    242, 248, 254, 131, 210, 211, 26, 29, 36, 62, 185, 197, 
+    203, 240, 207, 208, 210, 159, 84, 162, 188, 28, 48, 85, 
+    92, 174, 212, 215, 245, 1, 94, 113, 184, 189, 190, 194, 
+    203, 236, 3, 27, 88, 255, 79, 103, 116, 201, 227, 37, 
+    135, 142, 157, 181, 194, 103, 251, 174, 200, 65, 191, 140, 
+    233, 9, 98, 247, 1, 6, 12, 42, 112, 129, 138, 174, 
+    194, 197, 199, 254, 127, 235, 50, 63, 69, 76, 186, 224, 
+    22, 88, 108, 80, 5, 181, 192, 7, 236, 168, 199, 254, 
+    8, 11, 22, 25, 49, 53, 56, 76, 106, 119, 146, 164, 
+    39, 119, 120, 130, 61, 98, 105, 108, 62, 69, 86, 127, 
+    201, 176, 187, 219, 179, 190, 144, 157, 17, 80, 133, 136, 
+    179, 204, 207, 1, 131, 230, 102, 42, 173, 187, 198, 229, 
+    135, 148, 249, 36, 53, 120, 135, 189, 242, 61, 66, 164, 
+    195, 4, 19, 90, 91, 29, 44, 103, 106, 166, 167, 200, 
+    204, 243, 23, 50, 72, 138, 236, 241, 23, 91, 171, 143, 
+    145, 150, 250, 66, 105, 153, 154, 221, 26, 36, 56, 110, 
+    142, 226, 231, 239, 230, 23, 110, 10, 46, 55, 52, 207, 
+    234, 78, 85, 151, 83, 134, 144, 238, 12, 48, 159, 73, 
+    104, 132, 15, 85, 121, 124, 250, 65, 82, 108, 205, 237, 
+    238, 10, 29, 206, 240, 7, 64, 89, 10, 137, 233, 237, 
+    238, 31, 82, 83, 150, 153, 154, 253, 153, 154, 22, 26, 
+    30, 62, 66, 79, 80, 86, 88, 110, 139, 7, 29, 38, 
+    100, 101, 144, 165, 179, 188, 190, 211, 212, 231, 26, 187, 
+    2, 81, 247, 21, 197, 7, 58, 67, 72, 96, 255, 0, 
+    5, 19, 238, 34, 44, 163, 202, 209, 8, 45, 147, 215, 
+    14, 63, 69, 78, 142, 145, 9, 28, 33, 68, 98, 103, 
+    104, 116, 132, 164, 231, 237, 34, 184, 25, 14, 45, 95, 
+    170, 182, 216, 251, 109, 35, 226, 245, 107, 111, 139, 140, 
+    160, 161, 162, 235, 244, 246, 16, 18, 27, 93, 206, 222, 
+    226, 197, 198, 232, 141, 75, 97, 118, 220, 69, 166, 169, 
+    252, 39, 60, 64, 70, 94, 113, 134, 193, 14, 11, 25, 
+    75, 91, 14, 78, 99, 105, 131, 156, 160, 161, 166, 167, 
+    178, 191, 111, 9, 177, 36, 45, 71, 72, 106, 172, 185, 
+    236, 239, 245, 34, 135, 144, 163, 181, 233, 77, 101, 117, 
+    120, 128, 201, 215, 243, 64, 68, 193, 85, 248, 57, 77, 
+    125, 204, 215, 242, 254, 141, 142, 209, 31, 90, 118, 196, 
+    5, 50, 88, 119, 134, 229, 219, 129, 132, 170, 212, 235, 
+    40, 43, 126, 174, 9, 111, 158, 177, 217, 1, 6, 12, 
+    13, 129, 194, 222, 79, 184, 187, 224, 249, 151, 64, 88, 
+    178, 66, 80, 186, 87, 174, 207, 209, 210, 214, 238, 33, 
+    114, 183, 226, 33, 127, 204, 57, 228, 22, 79, 83, 84, 
+    116, 18, 93, 222, 226, 254, 121, 124, 111, 235, 32, 51, 
+    79, 83, 86, 118, 133, 147, 152, 153, 154, 156, 161, 6, 
+    34, 40, 137, 159, 169, 173, 217, 233, 246, 37, 39, 232, 
+    243, 158, 6, 163, 245, 125, 158, 204, 21, 70, 86, 28, 
+    46, 115, 118, 98, 140, 162, 244, 15, 84, 163, 251, 145, 
+    232, 248, 5, 45, 66, 197, 198, 129, 132, 45, 72, 147, 
+    6, 11, 40, 54, 105, 107, 126, 139, 0, 79, 182, 217, 
+    224, 118, 180, 254, 243, 100, 107, 148, 249, 25, 26, 32, 
+    75, 36, 53, 135, 189, 92, 238, 157, 197, 234, 246, 28, 
+    77, 114, 123, 125, 215, 2, 3, 177, 14, 32, 54, 75, 
+    165, 232, 239, 165, 8, 27, 32, 40, 43, 49, 53, 54, 
+    126, 146, 174, 183, 195, 31, 90, 118, 232, 86, 171, 239, 
+    241, 250, 30, 143, 144, 157, 14, 80, 254, 178, 50, 72, 
+    86, 100, 110, 183, 248, 5, 57, 250, 30, 53, 62, 79, 
+    119, 134, 184, 189, 203, 229, 249, 90, 23, 50, 205, 241, 
+    253, 17, 136, 71, 196, 33, 1, 131, 31, 171, 250, 56, 
+    66, 119, 100, 144, 188, 90, 91, 95, 175, 223, 47, 68, 
+    112, 28, 62, 90, 101, 5, 35, 115, 120, 193, 244, 55, 
+    234, 0, 52, 207, 3, 66, 186, 221, 47, 102, 144, 114, 
+    194, 222, 236, 237, 246, 254, 8, 13, 77, 170, 215, 223, 
+    50, 94, 113, 128, 130, 134, 75, 202, 215, 223, 39, 57, 
+    74, 151, 127, 213, 4, 11, 12, 84, 250, 20, 166, 221, 
+    223, 235, 39, 94, 150, 193, 2, 245, 131, 144, 181, 246, 
+    104, 121, 129, 157, 175, 187, 196, 233, 21, 22, 44, 51, 
+    122, 125, 153, 154, 166, 167, 204, 216, 29, 36, 143, 172, 
+    185, 239, 67, 72, 112, 7, 49, 197, 253, 235, 104, 153, 
+    154, 164, 3, 20, 99, 202, 208, 210, 223, 33, 237, 68, 
+    81, 226, 247, 36, 38, 95, 110, 142, 173, 175, 185, 224, 
+    199, 209, 122, 156, 216, 219, 5, 159, 184, 81, 185, 209, 
+    38, 58, 60, 121, 155, 174, 227, 235, 252, 129, 242, 171, 
+    253, 36, 203, 240, 115, 129, 155, 81, 210, 246, 76, 136, 
+    172, 195, 224, 20, 110, 172, 250, 47, 102, 125, 14, 159, 
+    12, 17, 28, 135, 137, 151, 168, 44, 69, 73, 130, 133, 
+    41, 22, 82, 106, 116, 145, 150, 16, 206, 225, 57, 101, 
+    112, 152, 159, 164, 210, 227, 229, 8, 15, 79, 117, 147, 
+    155, 201, 209, 229, 10, 65, 31, 17, 80, 50, 247, 5, 
+    41, 117, 129, 66, 221, 52, 226, 15, 179, 242, 48, 123, 
+    174, 203, 212, 215, 140, 30, 39, 118, 130, 189, 214, 14, 
+    97, 145, 96, 145, 179, 225, 44, 55, 85, 100, 110, 122, 
+    139, 166, 170, 188, 190, 199, 202, 58, 87, 159, 108, 7, 
+    28, 118, 228, 169, 255, 58, 65, 67, 123, 12, 44, 55, 
+    200, 219, 38, 41, 42, 89, 104, 117, 163, 201, 209, 227, 
+    251, 29, 33, 206, 247, 1, 32, 169, 195, 203, 42, 174, 
+    78, 181, 249, 30, 143, 50, 119, 134, 105, 62, 241, 247, 
+    25, 62, 127, 149, 26, 73, 133, 4, 22, 35, 115, 124, 
+    181, 86, 149, 32, 80, 96, 184, 194, 8, 124, 9, 19, 
+    186, 226, 27, 183, 196, 248, 251, 203, 99, 140, 180, 182, 
+    9, 173, 211, 222, 24, 67, 87, 149, 246, 17, 53, 26, 
+    37, 111, 145, 157, 181, 186, 194, 253, 101, 214, 229, 103, 
+    254, 71, 236, 237, 243, 200, 50, 94, 128, 130, 246, 54, 
+    70, 188, 230, 231, 240, 5, 45, 54, 75, 90, 152, 44, 
+    82, 95, 17, 81, 113, 126, 81, 189, 11, 25, 40, 173, 
+    208, 228, 49, 56, 136, 151, 169, 221, 249, 252, 13, 19, 
+    217, 250, 27, 90, 98, 255, 216, 47, 63, 6, 235, 61, 
+    95, 175, 202, 219, 109, 216, 7, 76, 149, 203, 136, 162, 
+    28, 34, 78, 199, 253, 20, 24, 87, 98, 29, 36, 49, 
+    83, 87, 97, 105, 108, 134, 146, 170, 185, 216, 240, 247, 
+    81, 10, 46, 69, 93, 141, 242, 12, 33, 106, 255, 19, 
+    38, 91, 143, 146, 147, 158, 172, 179, 187, 228, 248, 251, 
+    252, 62, 131, 137, 198, 210, 26, 34, 73, 133, 81, 103, 
+    118, 95, 99, 105, 137, 175, 178, 200, 119, 97, 125, 134, 
+    152, 156, 250, 58, 67, 183, 197, 68, 77, 117, 120, 128, 
+    141, 142, 157, 215, 231, 34, 158, 184, 227, 244, 246, 35, 
+    226, 114, 195, 17, 118, 42, 97, 135, 173, 233, 5, 45, 
+    69, 143, 180, 201, 200, 53, 157, 224, 27, 45, 46, 59, 
+    172, 185, 239, 12, 17, 19, 146, 151, 190, 242, 101, 252, 
+    61, 74, 79, 84, 86, 162, 188, 116, 145, 180, 31, 88, 
+    207, 208, 210, 214, 8, 11, 19, 25, 48, 75, 204, 212, 
+    213, 215, 63, 69, 85, 219, 33, 79, 143, 28, 61, 82, 
+    105, 108, 181, 229, 251, 176, 184, 255, 27, 76, 79, 143, 
+    188, 236, 148, 244, 103, 116, 177, 227, 252, 6, 12, 43, 
+    112, 194, 230, 74, 127, 132, 215, 78, 187, 189, 195, 201, 
+    64, 144, 177, 13, 61, 66, 68, 82, 138, 171, 16, 18, 
+    197, 209, 232, 23, 50, 138, 201, 211, 212, 54, 75, 65, 
+    222, 98, 145, 150, 250, 64, 83, 120, 205, 3, 88, 158, 
+    219, 255, 36, 142, 21, 86, 158, 251, 5, 121, 217, 40, 
+    126, 174, 187, 189, 54, 92, 137, 139, 166, 202, 208, 221, 
+    73, 104, 128, 220, 235, 247, 70, 138, 165, 190, 240, 108, 
+    174, 215, 19, 59, 143, 243, 4, 15, 84, 250, 175, 49, 
+    169, 252, 14, 65, 89, 102, 123, 37, 36, 126, 137, 247, 
+    253, 178, 182, 218, 135, 11, 25, 148, 18, 43, 63, 93, 
+    155, 4, 207, 16, 18, 183, 0, 176, 177, 37, 80, 34, 
+    163, 209, 14, 78, 145, 31, 4, 72, 237, 25, 241, 12, 
+    21, 81, 235, 244, 64, 68, 74, 78, 89, 124, 151, 157, 
+    19, 81, 91, 34, 139, 151, 111, 141, 153, 154, 35, 246, 
+    176, 43, 73, 223, 118, 220, 0, 131, 191, 8, 77, 96, 
+    108, 215, 78, 105, 156, 166, 167, 178, 58, 84, 143, 183, 
+    50, 63, 69, 46, 68, 69, 132, 134, 164, 98, 129, 224, 
+    57, 242, 31, 33, 2, 243, 9, 103, 116, 127, 210, 211, 
+    103, 163, 176, 44, 71, 245, 7, 28, 219, 16, 27, 64, 
+    93, 206, 66, 170, 182, 216, 249, 24, 60, 97, 119, 134, 
+    44, 55, 88, 166, 167, 187, 200, 224, 233, 244, 132, 176, 
+    158, 217, 234, 6, 12, 13, 25, 103, 138, 193, 194, 222, 
+    57, 175, 91, 114, 242, 122, 223, 32, 62, 64, 149, 196, 
+    253, 9, 58, 117, 121, 142, 174, 201, 215, 114, 124, 183, 
+    226, 171, 5, 80, 85, 111, 137, 184, 209, 228, 244, 246, 
+    248, 1, 13, 59, 77, 94, 99, 113, 128, 192, 207, 210, 
+    95, 175, 212, 223, 122, 221, 223, 87, 141, 245, 32, 59, 
+    66, 121, 148, 175, 186, 145, 232, 238, 179, 36, 69, 86, 
+    179, 190, 193, 27, 33, 42, 73, 174, 204, 211, 21, 82, 
+    212, 1, 140, 148, 162, 191, 203, 1, 11, 53, 103, 106, 
+    108, 146, 164, 180, 14, 36, 120, 130, 168, 244, 170, 171, 
+    192, 211, 212, 72, 197, 198, 200, 15, 243, 96, 171, 22, 
+    69, 106, 39, 41, 74, 164, 203, 236, 204, 207, 255, 23, 
+    143, 144, 193, 159, 234, 96, 175, 182, 27, 53, 59, 62, 
+    119, 120, 131, 135, 176, 230, 17, 56, 61, 66, 76, 106, 
+    119, 125, 136, 151, 164, 168, 181, 199, 204, 224, 249, 15, 
+    88, 163, 195, 227, 1, 41, 104, 155, 156, 164, 173, 241, 
+    150, 83, 90, 242, 26, 62, 230, 244, 10, 66, 153, 154, 
+    221, 1, 22, 102, 106, 110, 168, 181, 199, 129, 184, 10, 
+    29, 240, 23, 29, 31, 48, 55, 162, 205, 231, 232, 92, 
+    25, 72, 88, 100, 110, 162, 134, 153, 154, 26, 56, 86, 
+    224, 234, 251, 38, 100, 188, 190, 14, 234, 165, 179, 160, 
+    161, 83, 195, 41, 49, 56, 229, 10, 69, 131, 206, 249, 
+    27, 50, 77, 97, 114, 123, 125, 134, 152, 195, 215, 98, 
+    38, 137, 239, 11, 25, 75, 48, 136, 151, 197, 205, 59, 
+    234, 62, 100, 108, 140, 169, 188, 14, 25, 75, 80, 255, 
+    47, 63, 96, 112, 197, 198, 200, 202, 214, 145, 194, 236, 
+    253, 42, 73, 75, 122, 174, 211, 215, 97, 163, 209, 227, 
+    28, 32, 53, 71, 148, 196, 193, 194, 222, 62, 129, 180, 
+    242, 8, 13, 215, 245, 17, 50, 94, 101, 112, 113, 123, 
+    128, 130, 136, 151, 214, 103, 115, 21, 78, 197, 233, 186, 
+    220, 171, 35, 115, 48, 55, 205, 45, 122, 152, 229, 1, 
+    66, 99, 140, 162, 186, 191, 203, 221, 14, 32, 145, 238, 
+    5, 14, 60, 63, 93, 136, 157, 196, 131, 246, 4, 19, 
+    143, 144, 193, 71, 90, 104, 175, 187, 243, 80, 103, 7, 
+    100, 110, 162, 114, 160, 161, 20, 95, 122, 147, 156, 216, 
+    98, 108, 109, 199, 209, 219, 234, 251, 112, 4, 29, 30, 
+    209, 39, 50, 57, 74, 77, 125, 204, 215, 85, 169, 181, 
+    235, 252, 90, 98, 193, 151, 21, 95, 173, 175, 197, 210, 
+    217, 127, 216, 14, 31, 49, 153, 154, 164, 49, 176, 51, 
+    90, 91, 122, 125, 147, 152, 153, 154, 160, 161, 167, 216, 
+    158, 86, 158, 6, 58, 87, 163, 28, 61, 145, 150, 93, 
+    220, 19, 38, 42, 89, 104, 38, 101, 137, 177, 210, 217, 
+    239, 15, 99, 205, 223, 248, 86, 34, 169, 252, 54, 132, 
+    139, 176, 21, 89, 104, 155, 156, 164, 50, 150, 5, 7, 
+    238, 115, 126, 220, 234, 44, 51, 55, 133, 153, 154, 156, 
+    166, 167, 2, 77, 84, 81, 11, 25, 40, 173, 37, 39, 
+    157, 195, 250, 210, 98, 234, 20, 243, 58, 65, 67, 165, 
+    191, 54, 39, 74, 112, 152, 164, 203, 114, 148, 69, 73, 
+    130, 132, 180, 173, 186, 198, 214, 253, 24, 43, 67, 191, 
+    47, 102, 117, 26, 53, 59, 80, 135, 41, 57, 135, 66, 
+    100, 110, 186, 249, 31, 150, 1, 13, 30, 143, 100, 107, 
+    238, 248, 18, 138, 190, 26, 136, 176, 187, 105, 178, 38, 
+    58, 121, 174, 25, 62, 86, 143, 148, 149, 148, 165, 15, 
+    114, 244, 53, 146, 166, 167, 7, 8, 54, 112, 123, 124, 
+    127, 255, 86, 129, 145, 109, 117, 8, 40, 97, 126, 174, 
+    207, 12, 33, 194, 220, 35, 115, 176, 177, 181, 229, 174, 
+    248, 9, 234, 251, 86, 50, 72, 123, 214, 30, 143, 36, 
+    142, 244, 43, 169, 5, 236, 38, 249, 25, 26, 115, 23, 
+    50, 157, 208, 253, 220, 176, 4, 90, 108, 109, 26, 30, 
+    46, 62, 172, 185, 239, 53, 184, 101, 90, 196, 232, 80, 
+    85, 169, 183, 3, 252, 13, 121, 136, 148, 222, 65, 68, 
+    137, 226, 228, 230, 235, 3, 253, 180, 182, 221, 20, 109, 
+    216, 219, 67, 76, 149, 50, 94, 128, 130, 200, 202, 28, 
+    34, 44, 60, 63, 70, 75, 92, 93, 199, 204, 213, 255, 
+    5, 7, 61, 66, 74, 79, 120, 54, 126, 148, 188, 103, 
+    113, 47, 89, 102, 125, 132, 36, 185, 247, 12, 242, 250, 
+    162, 150, 178, 20, 54, 75, 81, 47, 213, 151, 169, 9, 
+    245, 6, 63, 93, 237, 79, 143, 172, 115, 118, 172, 224, 
+    22, 106, 116, 81, 229, 51, 160, 213, 57, 72, 76, 79, 
+    143, 188, 227, 237, 137, 217, 225, 224, 6, 40, 74, 105, 
+    124, 229, 0, 28, 118, 253, 6, 20, 51, 160, 167, 218, 
+    81, 209, 236, 11, 227, 251, 8, 117, 143, 147, 198, 201, 
+    139, 171, 198, 6, 11, 40, 95, 122, 140, 147, 173, 192, 
+    238, 245, 251, 118, 230, 81, 159, 200, 36, 137, 146, 237, 
+    240, 247, 242, 44, 95, 109, 135, 230, 155, 85, 179, 190, 
+    199, 12, 17, 19, 22, 56, 151, 44, 55, 109, 111, 219, 
+    5, 45, 237, 239, 28, 249, 179, 30, 97, 118, 130, 228, 
+    235, 44, 55, 166, 200, 202, 247, 17, 28, 171, 239, 160, 
+    161, 249, 226, 230, 221, 241, 245, 99, 127, 223, 238, 242, 
+    252, 137, 145, 146, 230, 198, 206, 236, 245, 2, 19, 48, 
+    212, 215, 5, 45, 143, 146, 180, 237, 3, 53, 31, 100, 
+    139, 188, 225, 118, 233, 8, 228, 236, 171, 26, 56, 76, 
+    86, 119, 142, 149, 172, 224, 229, 244, 61, 168, 176, 230, 
+    70, 78, 85, 101, 214, 20, 78, 187, 189, 241, 3, 141, 
+    190, 247, 22, 69, 206, 199, 248, 61, 64, 100, 105, 139, 
+    171, 188, 92, 100, 140, 198, 230, 226, 230, 87, 89, 128, 
+    201, 211, 212, 22, 42, 106, 110, 168, 181, 187, 189, 199, 
+    199, 244, 64, 67, 149, 172, 229, 214, 20, 197, 204, 228, 
+    233, 255, 20, 48, 132, 201, 101, 214, 64, 23, 85, 190, 
+    229, 69, 185, 11, 48, 230, 145, 248, 23, 106, 168, 181, 
+    199, 46, 53, 60, 100, 140, 146, 149, 198, 240, 139, 225, 
+    231, 70, 56, 61, 66, 106, 132, 224, 10, 16, 27, 64, 
+    68, 77, 87, 89, 97, 120, 128, 134, 141, 157, 206, 211, 
+    88, 82, 232, 36, 69, 86, 55, 207, 10, 16, 83, 206, 
+    225, 29, 73, 89, 94, 104, 106, 121, 132, 155, 168, 179, 
+    185, 243, 150, 250, 83, 105, 36, 130, 135, 78, 10, 96, 
+    141, 169, 231, 252, 38, 41, 42, 76, 146, 164, 172, 179, 
+    187, 197, 241, 252, 2, 119, 134, 153, 154, 165, 179, 33, 
+    98, 137, 210, 248, 68, 74, 103, 124, 157, 231, 160, 161, 
+    197, 235, 244, 50, 95, 97, 125, 134, 152, 175, 178, 223, 
+    163, 176, 0, 27, 71, 112, 114, 153, 154, 194, 195, 25, 
+    41, 73, 94, 102, 104, 121, 178, 34, 35, 53, 72, 146, 
+    158, 163, 184, 227, 237, 3, 19, 81, 91, 97, 134, 83, 
+    182, 46, 69, 93, 38, 118, 137, 26, 42, 175, 15, 37, 
+    75, 127, 250, 126, 198, 14, 113, 117, 176, 222, 224, 232, 
+    58, 67, 68, 101, 123, 143, 183, 195, 214, 226, 230, 17, 
+    87, 200, 255, 104, 253, 3, 252, 116, 251, 84, 188, 250, 
+    181, 31, 105, 178, 208, 141, 145, 8, 42, 173, 213, 135, 
+    227, 2, 184, 218, 221, 223, 244, 246, 39, 74, 114, 226, 
+    46, 59, 121, 115, 138, 150, 234, 3, 55, 167, 241, 76, 
+    94, 120, 130, 140, 188, 40, 45, 126, 180, 201, 224, 233, 
+    255, 27, 19, 53, 196, 54, 148, 242, 49, 52, 64, 65, 
+    180, 223, 74, 127, 139, 170, 195, 239, 8, 14, 75, 78, 
+    85, 111, 158, 204, 209, 213, 223, 228, 242, 23, 35, 61, 
+    74, 79, 86, 120, 138, 144, 157, 176, 20, 1, 11, 25, 
+    37, 39, 32, 121, 168, 175, 182, 217, 15, 39, 56, 72, 
+    73, 74, 116, 119, 151, 203, 23, 205, 225, 1, 148, 191, 
+    203, 220, 195, 227, 37, 124, 18, 114, 138, 165, 190, 27, 
+    208, 219, 221, 77, 84, 99, 128, 201, 25, 27, 241, 13, 
+    17, 18, 135, 175, 2, 33, 150, 8, 38, 177, 212, 213, 
+    216, 239, 138, 240, 80, 88, 87, 165, 234, 31, 159, 244, 
+    21, 139, 255, 37, 98, 92, 107, 159, 165, 170, 201, 211, 
+    212, 243, 97, 123, 125, 134, 152, 4, 32, 129, 131, 179, 
+    183, 41, 102, 54, 126, 96, 136, 178, 182, 218, 219, 92, 
+    107, 137, 142, 41, 104, 156, 164, 173, 193, 13, 18, 57, 
+    242, 249, 71, 108, 114, 127, 174, 195, 83, 176, 177, 71, 
+    15, 195, 142, 191, 231, 82, 232, 40, 49, 6, 53, 59, 
+    77, 143, 146, 192, 216, 163, 11, 18, 43, 63, 65, 93, 
+    114, 123, 180, 238, 34, 148, 13, 49, 126, 234, 200, 234, 
+    78, 180, 101, 107, 183, 195, 214, 226, 5, 170, 182, 58, 
+    84, 183, 34, 113, 184, 228, 244, 246, 70, 64, 120, 130, 
+    7, 13, 100, 188, 193, 60, 196, 116, 249, 208, 220, 229, 
+    10, 244, 35, 133, 182, 184, 48, 55, 116, 158, 205, 217, 
+    52, 6, 13, 17, 25, 59, 72, 151, 33, 80, 92, 29, 
+    100, 110, 162, 231, 240, 242, 19, 91, 92, 47, 73, 211, 
+    37, 44, 75, 88, 9, 46, 68, 69, 132, 134, 181, 95, 
+    99, 175, 212, 149, 177, 196, 252, 23, 111, 23, 35, 43, 
+    245, 122, 9, 176, 184, 236, 132, 225, 136, 151, 198, 243, 
+    64, 146, 175, 186, 103, 193, 222, 106, 148, 162, 39, 56, 
+    74, 111, 187, 200, 233, 91, 24, 45, 59, 171, 97, 122, 
+    166, 171, 32, 34, 41, 42, 94, 115, 138, 164, 172, 224, 
+    246, 69, 171, 51, 61, 85, 105, 131, 137, 166, 167, 178, 
+    218, 221, 78, 103, 144, 193, 209, 107, 108, 114, 117, 142, 
+    163, 201, 239, 220, 231, 253, 8, 38, 42, 59, 89, 104, 
+    108, 117, 119, 127, 155, 88, 100, 110, 138, 162, 240, 7, 
+    44, 112, 202, 204, 206, 207, 208, 15, 116, 238, 24, 217, 
+    166, 167, 195, 221, 12, 58, 144, 193, 220, 227, 228, 81, 
+    209, 13, 61, 80, 235, 10, 29, 32, 44, 109, 112, 179, 
+    202, 207, 219, 240, 47, 73, 204, 210, 211, 12, 224, 30, 
+    112, 130, 199, 220, 227, 228, 132, 85, 138, 180, 190, 199, 
+    89, 104, 156, 164, 193, 164, 224, 104, 146, 164, 175, 162, 
+    115, 150, 220, 234, 5, 238, 80, 136, 150, 151, 38, 48, 
+    55, 205, 239, 187, 52, 243, 99, 135, 92, 222, 191, 38, 
+    92, 229, 7, 58, 112, 123, 40, 44, 55, 95, 107, 109, 
+    114, 124, 136, 163, 173, 200, 102, 116, 117, 233, 242, 9, 
+    57, 58, 67, 191, 24, 70, 97, 222, 145, 42, 69, 111, 
+    112, 120, 130, 152, 198, 28, 186, 198, 9, 32, 39, 57, 
+    73, 74, 132, 168, 203, 48, 109, 117, 205, 145, 71, 148, 
+    149, 221, 23, 50, 100, 188, 190, 193, 230, 11, 22, 40, 
+    106, 116, 126, 173, 186, 38, 41, 42, 120, 214, 6, 25, 
+    148, 187, 196, 220, 233, 141, 194, 251, 11, 40, 94, 112, 
+    113, 123, 124, 126, 127, 211, 208, 32, 88, 44, 75, 122, 
+    166, 200, 215, 67, 159, 133, 182, 31, 108, 255, 111, 225, 
+    234, 139, 148, 176, 186, 240, 0, 1, 191, 203, 220, 88, 
+    169, 171, 122, 97, 5, 43, 57, 73, 112, 124, 165, 115, 
+    138, 193, 222, 253, 7, 129, 227, 92, 107, 176, 177, 160, 
+    161, 2, 12, 103, 115, 236, 77, 13, 85, 157, 169, 234, 
+    242, 47, 108, 109, 17, 39, 74, 95, 122, 140, 147, 156, 
+    63, 93, 26, 29, 30, 56, 90, 238, 197, 210, 53, 146, 
+    230, 4, 13, 40, 0, 96, 90, 89, 95, 173, 175, 192, 
+    201, 59, 94, 113, 130, 23, 60, 63, 93, 157, 196, 255, 
+    246, 51, 91, 122, 125, 160, 167, 216, 218, 49, 174, 248, 
+    128, 200, 202, 252, 136, 25, 35, 101, 106, 194, 71, 114, 
+    245, 28, 3, 4, 251, 54, 137, 139, 248, 50, 76, 125, 
+    140, 159, 178, 188, 73, 94, 102, 104, 121, 155, 178, 107, 
+    198, 251, 71, 168, 179, 185, 236, 245, 83, 120, 238, 251, 
+    21, 2, 237, 57, 14, 131, 147, 152, 160, 161, 213, 115, 
+    128, 176, 16, 18, 84, 34, 168, 169, 173, 223, 252, 61, 
+    68, 34, 57, 168, 199, 35, 110, 131, 98, 234, 46, 53, 
+    60, 146, 19, 54, 55, 81, 133, 156, 167, 65, 99, 205, 
+    219, 223, 163, 11, 87, 158, 160, 161, 21, 118, 241, 245, 
+    158, 22, 56, 116, 8, 95, 122, 147, 177, 192, 213, 216, 
+    217, 238, 3, 19, 37, 88, 101, 171, 214, 225, 236, 138, 
+    190, 240, 67, 143, 172, 121, 244, 247, 111, 40, 45, 126, 
+    180, 235, 237, 6, 11, 35, 148, 165, 192, 200, 216, 253, 
+    3, 54, 139, 53, 45, 119, 152, 210, 176, 45, 51, 76, 
+    146, 218, 237, 65, 72, 96, 123, 140, 214, 255, 148, 210, 
+    244, 2, 229, 249, 111, 16, 84, 31, 6, 114, 137, 141, 
+    145, 160, 167, 217, 59, 105, 178, 47, 165, 248, 251, 252, 
+    249, 43, 47, 165, 247, 248, 115, 253, 30, 55, 178, 207, 
+    218, 247, 4, 131, 233, 136, 186, 99, 127, 170, 85, 169, 
+    181, 234, 119, 157, 220, 239, 9, 83, 90, 7, 28, 48, 
+    219, 228, 27, 183, 14, 214, 252, 100, 140, 198, 135, 200, 
+    202, 115, 135, 236, 97, 142, 221, 28, 70, 78, 108, 109, 
+    219, 46, 63, 169, 90, 228, 249, 73, 133, 197, 52, 75, 
+    204, 213, 242, 49, 151, 169, 148, 188, 232, 12, 98, 103, 
+    35, 106, 176, 47, 113, 137, 217, 222, 89, 192, 216, 48, 
+    127, 132, 182, 230, 82, 67, 76, 149, 237, 109, 125, 204, 
+    130, 194, 70, 209, 217, 57, 0, 96, 31, 74, 105, 124, 
+    9, 71, 245, 21, 3, 60, 63, 70, 93, 194, 61, 66, 
+    74, 79, 180, 182, 73, 89, 94, 104, 121, 125, 53, 72, 
+    92, 100, 113, 140, 146, 149, 198, 237, 240, 22, 116, 118, 
+    35, 88, 112, 184, 194, 162, 158, 163, 211, 227, 197, 37, 
+    43, 75, 121, 155, 174, 101, 153, 154, 165, 179, 177, 45, 
+    86, 231, 38, 41, 42, 69, 164, 172, 179, 187, 197, 233, 
+    14, 19, 58, 17, 184, 194, 103, 73, 88, 101, 133, 195, 
+    214, 226, 34, 113, 126, 184, 210, 222, 97, 125, 178, 119, 
+    134, 218, 83, 93, 196, 230, 231, 240, 27, 124, 255, 114, 
+    27, 241, 177, 171, 182, 239, 34, 81, 115, 138, 144, 181, 
+    106, 197, 204, 159, 87, 186, 208, 78, 85, 209, 74, 99, 
+    131, 144, 181, 242, 254, 84, 188, 7, 184, 158, 177, 228, 
+    3, 107, 116, 2, 23, 35, 80, 157, 222, 189, 39, 49, 
+    52, 74, 124, 107, 227, 82, 9, 99, 127, 128, 136, 191, 
+    201, 1, 120, 129, 130, 142, 196, 20, 111, 1, 22, 29, 
+    100, 110, 133, 139, 188, 206, 33, 92, 144, 190, 199, 241, 
+    245, 2, 232, 253, 65, 191, 15, 26, 30, 79, 86, 149, 
+    172, 254, 228, 233, 107, 61, 76, 149, 159, 168, 183, 199, 
+    229, 254, 8, 20, 70, 85, 98, 122, 192, 213, 216, 232, 
+    1, 159, 190, 203, 236, 31, 228, 23, 50, 78, 79, 85, 
+    170, 201, 211, 19, 71, 176, 22, 56, 71, 103, 116, 22, 
+    17, 247, 64, 3, 202, 250, 49, 56, 76, 119, 149, 171, 
+    172, 199, 213, 249, 252, 27, 33, 251, 65, 72, 123, 82, 
+    232, 248, 251, 40, 43, 49, 121, 155, 202, 53, 61, 66, 
+    106, 132, 146, 243, 10, 16, 27, 83, 97, 206, 225, 29, 
+    83, 105, 185, 6, 51, 160, 161, 166, 167, 218, 55, 135, 
+    207, 34, 241, 10, 141, 231, 36, 46, 60, 96, 136, 189, 
+    23, 162, 2, 15, 254, 235, 41, 102, 39, 76, 130, 131, 
+    183, 45, 96, 147, 225, 231, 6, 41, 45, 95, 173, 192, 
+    216, 223, 69, 86, 149, 240, 205, 46, 56, 106, 132, 160, 
+    161, 168, 179, 185, 226, 10, 16, 56, 110, 119, 206, 174, 
+    208, 22, 24, 91, 100, 133, 182, 188, 160, 109, 120, 3, 
+    60, 64, 70, 94, 113, 120, 130, 134, 196, 68, 101, 183, 
+    195, 214, 226, 36, 187, 220, 233, 15, 29, 101, 121, 124, 
+    231, 240, 250, 9, 169, 252, 37, 44, 75, 78, 127, 202, 
+    70, 10, 113, 228, 233, 7, 33, 92, 135, 144, 237, 238, 
+    6, 11, 13, 78, 45, 47, 92, 95, 107, 140, 170, 174, 
+    182, 254, 23, 135, 155, 233, 9, 68, 104, 132, 181, 231, 
+    37, 142, 181, 194, 35, 111, 119, 134, 184, 229, 243, 116, 
+    41, 102, 158, 178, 217, 52, 220, 42, 38, 239, 39, 74, 
+    166, 3, 64, 171, 9, 76, 98, 146, 186, 224, 1, 129, 
+    140, 232, 248, 249, 196, 17, 33, 85, 151, 255, 14, 78, 
+    209, 248, 20, 23, 35, 51, 72, 105, 138, 160, 161, 166, 
+    167, 178, 193, 218, 236, 245, 26, 29, 36, 56, 80, 88, 
+    90, 103, 118, 195, 203, 64, 238, 68, 141, 108, 117, 127, 
+    180, 201, 33, 8, 127, 170, 212, 213, 5, 84, 61, 142, 
+    144, 157, 236, 41, 42, 76, 79, 164, 172, 224, 225, 2, 
+    199, 254, 19, 111, 39, 61, 64, 94, 105, 115, 138, 150, 
+    193, 246, 40, 82, 84, 126, 201, 80, 140, 177, 214, 220, 
+    135, 187, 198, 18, 54, 71, 107, 114, 139, 165, 7, 64, 
+    82, 91, 150, 8, 200, 13, 111, 235, 4, 91, 98, 101, 
+    180, 214, 7, 37, 168, 177, 217, 23, 71, 255, 97, 122, 
+    166, 170, 165, 37, 39, 79, 83, 87, 129, 132, 101, 167, 
+    204, 214, 221, 139, 98, 165, 225, 105, 182, 218, 219, 221, 
+    57, 205, 242, 77, 87, 89, 120, 128, 201, 211, 168, 8, 
+    13, 18, 42, 173, 187, 138, 141, 190, 80, 85, 92, 237, 
+    238, 83, 13, 18, 43, 92, 99, 108, 137, 142, 191, 107, 
+    163, 198, 21, 64, 87, 89, 128, 211, 212, 237, 238, 71, 
+    72, 150, 236, 241, 247, 250, 26, 42, 32, 43, 60, 179, 
+    183, 66, 187, 193, 52, 178, 207, 234, 126, 126, 231, 240, 
+    4, 75, 80, 49, 151, 159, 177, 190, 235, 244, 54, 72, 
+    143, 85, 141, 0, 150, 238, 107, 142, 148, 231, 73, 104, 
+    132, 18, 25, 114, 222, 226, 34, 52, 163, 219, 7, 99, 
+    144, 157, 170, 171, 33, 57, 177, 91, 139, 186, 226, 95, 
+    175, 219, 5, 107, 194, 246, 6, 32, 72, 75, 195, 196, 
+    203, 105, 52, 71, 114, 236, 237, 245, 39, 94, 113, 134, 
+    193, 92, 186, 226, 239, 22, 115, 131, 157, 189, 253, 254, 
+    13, 28, 166, 44, 75, 95, 200, 215, 90, 107, 111, 139, 
+    96, 140, 165, 40, 126, 249, 54, 90, 66, 133, 182, 68, 
+    112, 193, 52, 207, 214, 37, 129, 130, 132, 135, 181, 194, 
+    197, 247, 33, 89, 95, 135, 162, 173, 175, 192, 216, 230, 
+    237, 244, 13, 105, 51, 122, 125, 167, 204, 216, 218, 221, 
+    159, 210, 0, 96, 178, 28, 240, 11, 63, 79, 83, 84, 
+    87, 47, 127, 204, 235, 12, 3, 202, 16, 18, 206, 222, 
+    226, 241, 119, 134, 229, 35, 106, 49, 56, 98, 122, 156, 
+    12, 39, 74, 107, 163, 4, 23, 29, 36, 56, 121, 124, 
+    157, 187, 196, 233, 181, 246, 43, 49, 31, 127, 128, 202, 
+    208, 235, 250, 198, 217, 233, 98, 24, 229, 232, 209, 217, 
+    8, 213, 216, 220, 227, 228, 251, 199, 85, 88, 110, 138, 
+    139, 190, 199, 241, 250, 45, 72, 76, 79, 112, 224, 23, 
+    44, 148, 202, 207, 208, 219, 231, 235, 253, 10, 29, 112, 
+    206, 240, 8, 66, 108, 117, 118, 150, 155, 182, 159, 250, 
+    73, 104, 116, 185, 104, 111, 121, 129, 138, 164, 175, 240, 
+    248, 76, 146, 164, 224, 102, 178, 92, 107, 140, 45, 72, 
+    110, 119, 152, 243, 32, 60, 112, 179, 14, 47, 174, 44, 
+    115, 133, 202, 204, 207, 30, 39, 119, 130, 242, 70, 173, 
+    193, 220, 227, 228, 32, 81, 209, 2, 92, 144, 222, 6, 
+    11, 77, 192, 216, 38, 48, 244, 9, 12, 15, 57, 65, 
+    123, 140, 180, 232, 111, 19, 28, 101, 168, 214, 52, 0, 
+    22, 106, 116, 141, 217, 50, 134, 230, 238, 123, 125, 171, 
+    221, 225, 243, 100, 188, 190, 32, 36, 203, 24, 70, 97, 
+    222, 232, 32, 96, 251, 255, 239, 3, 9, 57, 168, 226, 
+    44, 55, 122, 166, 170, 200, 71, 88, 90, 118, 245, 7, 
+    31, 157, 222, 9, 19, 71, 80, 245, 27, 32, 195, 246, 
+    14, 202, 232, 88, 186, 236, 237, 243, 115, 138, 253, 205, 
+    2, 180, 182, 223, 253, 28, 50, 78, 228, 111, 123, 11, 
+    40, 126, 127, 173, 211, 200, 247, 144, 181, 249, 5, 56, 
+    119, 221, 32, 254, 197, 1, 228, 250, 3, 4, 27, 55, 
+    88, 207, 83, 71, 182, 183, 225, 40, 43, 67, 73, 124, 
+    149, 159, 173, 9, 234, 47, 57, 113, 149, 184, 222, 240, 
+    61, 99, 208, 219, 223, 79, 89, 192, 201, 10, 65, 255, 
+    3, 224, 35, 101, 106, 188, 229, 17, 52, 223, 45, 90, 
+    147, 30, 76, 79, 149, 203, 70, 136, 141, 194, 230, 231, 
+    218, 221, 223, 246, 92, 144, 22, 147, 151, 152, 161, 169, 
+    249, 252, 2, 78, 113, 241, 162, 185, 129, 233, 70, 189, 
+    40, 43, 121, 155, 217, 235, 90, 53, 146, 94, 109, 113, 
+    125, 130, 184, 194, 0, 95, 96, 175, 223, 21, 125, 57, 
+    159, 210, 41, 42, 69, 120, 130, 34, 128, 168, 199, 16, 
+    84, 110, 131, 83, 120, 159, 133, 156, 252, 38, 42, 112, 
+    120, 152, 54, 21, 115, 129, 254, 46, 168, 179, 185, 248, 
+    43, 121, 125, 155, 178, 204, 241, 254, 158, 158, 217, 177, 
+    248, 15, 54, 68, 116, 139, 34, 57, 168, 169, 246, 61, 
+    68, 102, 155, 35, 58, 246, 36, 46, 60, 189, 195, 12, 
+    131, 162, 0, 35, 107, 145, 165, 82, 183, 210, 234, 203, 
+    124, 7, 37, 145, 169, 219, 107, 229, 227, 247, 37, 41, 
+    49, 117, 172, 183, 201, 81, 169, 21, 25, 114, 124, 47, 
+    165, 254, 47, 165, 38, 41, 42, 89, 104, 117, 246, 247, 
+    11, 40, 124, 126, 136, 58, 67, 108, 58, 123, 159, 145, 
+    177, 189, 210, 248, 2, 241, 16, 18, 68, 84, 111, 116
+    
+};
+
+const uint16_t hash_pattern[][HASH_NN] = {
+    { 3464, 6976, 7104, 7242 },
+    { 2458, 3074, 4847, 6631 },
+    { 6976, 8258, 8389, 10309 },
+    { 6171, 8703, 9982, 10488 },
+    { 4174, 9373, 9456, 10929 },
+    { 3464, 3968, 8389, 9666 },
+    { 2340, 2458, 3490, 5788 },
+    { 12298, 13062, 13394, 14552 },
+    { 1808, 2340, 3074, 3663 },
+    { 4174, 5787, 8331, 10598 },
+    { 3968, 6104, 6230, 7242 },
+    { 1808, 2400, 3490, 4847 },
+    { 2545, 5787, 9373, 10008 },
+    { 2400, 3663, 5788, 6631 },
+    { 1966, 7276, 8891, 9830 },
+    { 2545, 7876, 7982, 8331 },
+    { 3712, 6034, 6063, 6230 },
+    { 1966, 5768, 8697, 9440 },
+    { 3712, 5768, 5877, 6104 },
+    { 5921, 8289, 9443, 9636 },
+    { 10598, 10671, 10820, 11556 },
+    { 11192, 11394, 11724, 11750 },
+    { 2368, 4154, 6282, 6800 },
+    { 1096, 5115, 5630, 5767 },
+    { 1096, 4611, 4671, 4743 },
+    { 1848, 2368, 4671, 5742 },
+    { 1848, 4113, 4154, 4611 },
+    { 6005, 6171, 7982, 9875 },
+    { 3958, 6825, 8027, 8624 },
+    { 3958, 4081, 6074, 6466 },
+    { 4081, 4113, 4743, 5115 },
+    { 9146, 9150, 9579, 9755 },
+    { 3922, 6005, 7876, 8833 },
+    { 3922, 8134, 9291, 9875 },
+    { 5068, 6825, 7657, 7877 },
+    { 4393, 5068, 5794, 6370 },
+    { 3880, 4144, 5351, 6650 },
+    { 1360, 1697, 5166, 5351 },
+    { 2768, 3206, 3926, 6951 },
+    { 1360, 2554, 4144, 5176 },
+    { 1765, 2471, 3457, 3850 },
+    { 2501, 2912, 3206, 4007 },
+    { 1765, 2834, 3155, 4007 },
+    { 1697, 2554, 3789, 5945 },
+    { 1409, 1583, 2046, 2225 },
+    { 2178, 3433, 3765, 4021 },
+    { 3880, 3948, 5546, 6266 },
+    { 1561, 2768, 2912, 6022 },
+    { 693, 1368, 1409, 2838 },
+    { 1561, 2501, 3926, 4465 },
+    { 2178, 2779, 5131, 5570 },
+    { 2092, 2225, 2356, 2421 },
+    { 678, 693, 1583, 2356 },
+    { 3948, 4373, 5301, 5612 },
+    { 1436, 4748, 6776, 6951 },
+    { 678, 1368, 2046, 2092 },
+    { 2421, 3960, 4167, 4465 },
+    { 1436, 4196, 5836, 7896 },
+    { 2779, 3765, 4815, 4911 },
+    { 3789, 3867, 5166, 5176 },
+    { 3867, 5523, 5546, 5945 },
+    { 933, 3571, 4069, 4373 },
+    { 4196, 4202, 4748, 5600 },
+    { 2750, 5548, 5926, 5943 },
+    { 933, 2732, 3516, 5301 },
+    { 2267, 4887, 4899, 7173 },
+    { 1977, 3516, 4069, 4426 },
+    { 3851, 4682, 4837, 4887 },
+    { 2732, 3571, 4426, 6120 },
+    { 2750, 4130, 5541, 6322 },
+    { 1977, 5493, 5634, 6014 },
+    { 4899, 5665, 5857, 8207 },
+    { 2267, 3851, 4952, 5665 },
+    { 1682, 2616, 2785, 4202 },
+    { 1417, 2616, 3608, 4130 },
+    { 1417, 1682, 2264, 4672 },
+    { 3309, 3964, 4501, 4763 },
+    { 2264, 2785, 3577, 3608 },
+    { 2150, 5634, 7267, 9871 },
+    { 3309, 3605, 4072, 4682 },
+    { 2253, 6503, 9222, 10004 },
+    { 2150, 7687, 8411, 9391 },
+    { 2253, 7009, 9695, 9728 },
+    { 2093, 3577, 4672, 5293 },
+    { 3605, 3706, 4763, 6238 },
+    { 2093, 5450, 6759, 7364 },
+    { 3706, 4072, 4601, 5481 },
+    { 2832, 3469, 4600, 4668 },
+    { 6245, 6670, 9111, 9971 },
+    { 2694, 2832, 3170, 3458 },
+    { 1097, 8411, 9094, 9914 },
+    { 1097, 8332, 9472, 9496 },
+    { 3262, 6670, 7123, 8036 },
+    { 5481, 5901, 5947, 6238 },
+    { 2601, 2831, 5076, 5225 },
+    { 1457, 2159, 3170, 3381 },
+    { 5957, 6992, 7123, 8708 },
+    { 1195, 2159, 2694, 4600 },
+    { 8332, 9094, 10690, 11491 },
+    { 1195, 1457, 3458, 3631 },
+    { 3262, 6245, 6611, 6906 },
+    { 4419, 5957, 6481, 9645 },
+    { 2517, 2786, 2831, 2993 },
+    { 4176, 6481, 8181, 8964 },
+    { 2601, 2786, 3151, 4277 },
+    { 908, 2124, 2517, 3631 },
+    { 4176, 4419, 6359, 6828 },
+    { 4575, 6611, 6992, 8036 },
+    { 908, 1489, 3026, 3748 },
+    { 1489, 2124, 2993, 2999 },
+    { 6218, 6309, 6557, 6780 },
+    { 10008, 10326, 10690, 12017 },
+    { 2687, 3952, 5044, 5974 },
+    { 2687, 5114, 5217, 7623 },
+    { 4575, 5835, 5974, 8099 },
+    { 2547, 5118, 6359, 8964 },
+    { 2547, 4226, 6828, 8181 },
+    { 2874, 2999, 3202, 3748 },
+    { 4226, 5118, 9091, 9924 },
+    { 2266, 3952, 4470, 5217 },
+    { 2813, 3606, 4043, 5278 },
+    { 2625, 2818, 3836, 7922 },
+    { 1341, 2135, 2283, 3202 },
+    { 2266, 2715, 4891, 5044 },
+    { 1757, 2625, 3647, 7907 },
+    { 2121, 2283, 2701, 2874 },
+    { 1757, 3481, 3836, 6654 },
+    { 1341, 1683, 3007, 3606 },
+    { 2818, 3481, 3647, 5113 },
+    { 660, 3065, 4340, 4756 },
+    { 2813, 4149, 5083, 5261 },
+    { 2985, 6641, 6708, 7263 },
+    { 660, 2701, 4210, 4420 },
+    { 1683, 2121, 2135, 4210 },
+    { 2181, 2715, 4470, 5231 },
+    { 2985, 3867, 5276, 8157 },
+    { 7177, 8632, 8822, 9351 },
+    { 3867, 6708, 7050, 7353 },
+    { 5113, 5655, 6051, 6654 },
+    { 4629, 6196, 6773, 6978 },
+    { 2181, 3338, 4891, 6570 },
+    { 5413, 6051, 7225, 7263 },
+    { 5276, 5413, 6641, 7050 },
+    { 3330, 3816, 4737, 5083 },
+    { 3338, 5231, 6798, 7177 },
+    { 2515, 7234, 7353, 9810 },
+    { 3330, 3926, 4374, 5557 },
+    { 2209, 2210, 3191, 3816 },
+    { 4843, 5655, 6518, 6978 },
+    { 4017, 4629, 4843, 5557 },
+    { 2515, 5184, 9725, 9767 },
+    { 5778, 6798, 8760, 9394 },
+    { 2172, 2193, 2676, 4017 },
+    { 3, 2074, 2209, 4431 },
+    { 3, 2076, 2210, 4433 },
+    { 2580, 2676, 3052, 3781 },
+    { 2074, 2076, 2571, 3191 },
+    { 5184, 5541, 5778, 7234 },
+    { 1595, 7106, 7589, 7764 },
+    { 4607, 4870, 7418, 8819 },
+    { 518, 2172, 2309, 2461 },
+    { 518, 2193, 2206, 2496 },
+    { 4870, 6181, 6518, 6560 },
+    { 4607, 7665, 7833, 7957 },
+    { 2571, 3198, 4028, 4431 },
+    { 1595, 5694, 5994, 6437 },
+    { 1326, 2025, 2206, 2461 },
+    { 2025, 2098, 2309, 2496 },
+    { 3870, 6437, 6835, 7764 },
+    { 5541, 6848, 7660, 8760 },
+    { 1326, 2098, 3392, 3530 },
+    { 6300, 6997, 8603, 9206 },
+    { 3198, 3871, 4011, 4577 },
+    { 1754, 2526, 3244, 3428 },
+    { 1529, 1754, 2805, 3815 },
+    { 1529, 3244, 3416, 4308 },
+    { 703, 4450, 6300, 7665 },
+    { 703, 3751, 6997, 7717 },
+    { 1014, 2098, 2526, 2805 },
+    { 3248, 3870, 5994, 6428 },
+    { 1014, 1146, 3428, 3815 },
+    { 5205, 5413, 6361, 6848 },
+    { 1146, 2098, 3400, 4249 },
+    { 3751, 4450, 4794, 5995 },
+    { 4351, 5021, 5205, 7660 },
+    { 3871, 4028, 6402, 6543 },
+    { 1885, 3400, 4378, 4522 },
+    { 1885, 3229, 3865, 4160 },
+    { 3255, 4841, 6169, 6898 },
+    { 1872, 1890, 3945, 5437 },
+    { 3248, 5694, 6132, 6835 },
+    { 4794, 4833, 6633, 7169 },
+    { 2299, 3229, 3460, 3545 },
+    { 2630, 3255, 5225, 6060 },
+    { 5021, 5225, 5413, 5985 },
+    { 4351, 5985, 7864, 8131 },
+    { 4833, 5397, 5550, 5788 },
+    { 424, 1890, 2870, 6236 },
+    { 424, 1872, 3286, 6612 },
+    { 2059, 6428, 6844, 7864 },
+    { 299, 1442, 1906, 2166 },
+    { 2870, 3286, 3471, 3723 },
+    { 299, 1300, 1621, 2036 },
+    { 2630, 4134, 4841, 6574 },
+    { 1727, 2043, 2299, 2919 },
+    { 736, 1230, 1300, 1442 },
+    { 4134, 6022, 6060, 6169 },
+    { 736, 1558, 1727, 2036 },
+    { 1230, 1558, 1621, 1906 },
+    { 2059, 7265, 7734, 8047 },
+    { 4413, 6633, 7427, 8545 },
+    { 1668, 2770, 3399, 3499 },
+    { 1362, 2779, 3387, 3399 },
+    { 1668, 2303, 2335, 3059 },
+    { 4413, 6022, 8564, 9639 },
+    { 1362, 2303, 2770, 3726 },
+    { 2133, 2335, 3101, 3499 },
+    { 3776, 7057, 7265, 7781 },
+    { 1128, 2133, 2358, 2388 },
+    { 1128, 1471, 1966, 3101 },
+    { 3776, 4163, 7647, 9157 },
+    { 1203, 1966, 2358, 4434 },
+    { 5247, 5919, 6093, 7638 },
+    { 1203, 1471, 2388, 3339 },
+    { 3115, 3339, 4058, 4501 },
+    { 6132, 6148, 7002, 9319 },
+    { 4260, 4548, 5919, 6053 },
+    { 4163, 7638, 7781, 8119 },
+    { 4197, 4966, 7057, 7647 },
+    { 1035, 4548, 5247, 6510 },
+    { 1035, 4260, 5478, 6093 },
+    { 5478, 6053, 6510, 7082 },
+    { 7082, 9023, 9816, 10382 },
+    { 3067, 3947, 4197, 7193 },
+    { 4809, 7516, 9225, 11520 },
+    { 4809, 7685, 8590, 9772 },
+    { 3067, 4966, 5674, 8135 },
+    { 3392, 3947, 5674, 8097 },
+    { 3392, 7193, 8135, 9712 },
+    { 3891, 4018, 7002, 9053 },
+    { 4018, 5576, 6148, 6565 },
+    { 5014, 5608, 7882, 9816 },
+    { 5762, 7882, 10180, 10808 },
+    { 5608, 8124, 8234, 10382 },
+    { 4976, 6548, 7672, 8590 },
+    { 5014, 5762, 8234, 9819 },
+    { 2939, 4976, 6692, 7685 },
+    { 3891, 6565, 7640, 9385 },
+    { 6692, 6917, 7516, 9772 },
+    { 2939, 6548, 6917, 8753 },
+    { 2507, 7913, 9279, 9712 },
+    { 6909, 8124, 9819, 11405 },
+    { 6909, 7672, 8753, 9905 },
+    { 2507, 6440, 7104, 10309 },
+    { 6440, 7913, 8258, 10100 },
+    { 5576, 5921, 8681, 9021 },
+};
@@ -0,0 +1,33 @@
+#ifndef CATALOG_HASH_H
+#define CATALOG_HASH_H
+
+#include <stdint.h>
+#include "catalog_luts.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// geometric hash: every catalog star keyed on the angles to two of its
+// HASH_NN nearest catalog stars (every choice of two), quantized
+// to HASH_CELL_MDEG. A star is filed in every cell a pattern +/-
+// HASH_TOL_MDEG touches, so a pattern measured that closely needs one probe.
+#define HASH_CELL_MDEG 200
+#define HASH_TOL_MDEG 100
+#define HASH_SIZE 2048
+#define HASH_NN 4
+#define HASH_CELL(q1, q2) \
+    ((((uint32_t)(q1) * 2654435761u) ^ ((uint32_t)(q2) * 40503u)) & (HASH_SIZE - 1))
+
+// bucket h holds hash_entries[hash_start[h] .. hash_start[h+1]) (catalog indices)
+extern const uint16_t hash_start[HASH_SIZE + 1];
+extern const uint8_t hash_entries[];
+// each star's HASH_NN nearest-neighbour angles, ascending, in
+// CATALOG_PAIR_ANGLE_LSB_MDEG units
+extern const uint16_t hash_pattern[][HASH_NN];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CATALOG_HASH_H
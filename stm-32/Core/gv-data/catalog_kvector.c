@@ -0,0 +1,1255 @@
+// AUTO-GENERATED K-VECTOR ANGLE INDEX
+#include "catalog_kvector.h"
+
+const uint16_t kvector_k[KVECTOR_N] = {
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+    2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
+    3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+    4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 
+    5, 5, 6, 6, 6, 6, 6, 7, 7, 7, 7, 8, 
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 
+    11, 11, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
+    13, 13, 13, 13, 13, 13, 13, 15, 15, 15, 15, 15, 
+    15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 
+    16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
+    17, 17, 17, 17, 17, 17, 18, 18, 18, 19, 19, 19, 
+    19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 
+    20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 
+    21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 23, 
+    23, 23, 23, 23, 23, 24, 25, 25, 26, 26, 26, 26, 
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 
+    27, 27, 28, 28, 28, 28, 28, 28, 29, 29, 29, 30, 
+    30, 30, 30, 30, 31, 31, 31, 31, 31, 32, 32, 32, 
+    32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
+    33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 
+    34, 34, 34, 34, 35, 36, 36, 36, 36, 36, 36, 36, 
+    36, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 
+    38, 38, 38, 39, 39, 39, 39, 39, 39, 39, 39, 39, 
+    39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 
+    41, 42, 42, 42, 42, 42, 43, 43, 43, 43, 43, 43, 
+    43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44, 
+    44, 44, 45, 46, 46, 46, 47, 47, 47, 47, 47, 47, 
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 48, 48, 48, 
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 
+    49, 49, 49, 49, 49, 49, 49, 49, 50, 50, 50, 50, 
+    50, 51, 51, 52, 52, 52, 52, 52, 53, 53, 53, 53, 
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 
+    53, 53, 53, 53, 53, 53, 55, 55, 55, 55, 56, 56, 
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 
+    56, 56, 56, 57, 57, 57, 57, 58, 58, 59, 60, 60, 
+    60, 60, 60, 61, 61, 61, 61, 61, 62, 63, 63, 63, 
+    63, 63, 63, 65, 65, 67, 67, 67, 67, 67, 67, 67, 
+    67, 68, 69, 69, 69, 70, 71, 71, 71, 71, 71, 72, 
+    72, 72, 72, 73, 73, 74, 74, 75, 75, 76, 76, 77, 
+    77, 77, 77, 78, 78, 78, 78, 79, 79, 81, 81, 81, 
+    81, 81, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 
+    83, 83, 83, 83, 84, 86, 86, 86, 86, 86, 86, 87, 
+    87, 87, 87, 87, 87, 88, 89, 89, 90, 90, 90, 90, 
+    90, 90, 90, 90, 90, 90, 91, 92, 92, 92, 92, 92, 
+    92, 93, 94, 94, 94, 95, 95, 95, 95, 95, 95, 95, 
+    96, 96, 96, 96, 96, 97, 97, 97, 97, 97, 97, 97, 
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 
+    98, 99, 99, 100, 100, 100, 101, 101, 101, 101, 101, 101, 
+    101, 101, 101, 102, 102, 103, 103, 104, 104, 104, 105, 106, 
+    106, 106, 107, 107, 107, 107, 107, 107, 107, 109, 109, 109, 
+    110, 110, 110, 110, 110, 110, 111, 111, 111, 112, 112, 112, 
+    112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 114, 114, 
+    114, 115, 115, 116, 116, 116, 116, 116, 116, 116, 116, 116, 
+    116, 116, 116, 116, 116, 116, 116, 117, 117, 117, 117, 118, 
+    118, 118, 119, 119, 120, 120, 120, 120, 120, 121, 121, 121, 
+    121, 121, 121, 122, 122, 122, 122, 122, 122, 122, 123, 123, 
+    123, 123, 123, 123, 124, 125, 125, 125, 127, 127, 128, 129, 
+    129, 129, 129, 129, 129, 130, 130, 130, 131, 131, 132, 132, 
+    132, 132, 132, 134, 135, 136, 136, 136, 136, 136, 136, 136, 
+    136, 136, 136, 136, 136, 137, 138, 138, 138, 138, 138, 138, 
+    138, 138, 138, 138, 138, 138, 138, 138, 139, 139, 140, 140, 
+    140, 140, 140, 140, 140, 141, 141, 141, 141, 141, 141, 141, 
+    141, 141, 141, 141, 142, 142, 142, 142, 142, 142, 143, 143, 
+    144, 144, 144, 145, 145, 146, 146, 146, 146, 146, 146, 146, 
+    147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 148, 148, 
+    149, 149, 150, 151, 151, 152, 152, 152, 152, 152, 152, 152, 
+    152, 152, 152, 153, 153, 153, 153, 153, 154, 154, 154, 154, 
+    154, 154, 154, 154, 154, 154, 154, 154, 154, 155, 156, 156, 
+    156, 156, 156, 156, 157, 157, 157, 157, 157, 157, 157, 158, 
+    158, 158, 159, 160, 160, 161, 162, 162, 162, 162, 162, 162, 
+    162, 163, 163, 163, 163, 163, 164, 164, 165, 165, 166, 166, 
+    166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168, 168, 
+    168, 168, 168, 168, 168, 169, 169, 169, 169, 169, 169, 169, 
+    169, 170, 170, 170, 172, 172, 172, 172, 172, 172, 172, 172, 
+    172, 172, 172, 172, 172, 172, 172, 173, 173, 174, 174, 176, 
+    176, 177, 178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 
+    180, 180, 181, 181, 181, 181, 181, 181, 181, 181, 182, 184, 
+    184, 185, 186, 187, 187, 187, 187, 188, 189, 189, 190, 190, 
+    190, 191, 191, 191, 191, 191, 191, 192, 192, 192, 192, 192, 
+    193, 193, 193, 193, 193, 193, 194, 194, 194, 194, 194, 194, 
+    194, 194, 194, 195, 195, 196, 196, 196, 196, 196, 196, 196, 
+    196, 196, 196, 198, 199, 199, 199, 199, 199, 199, 199, 199, 
+    200, 200, 200, 200, 200, 201, 202, 202, 203, 203, 203, 203, 
+    204, 204, 204, 204, 204, 204, 204, 204, 205, 205, 205, 205, 
+    205, 206, 206, 207, 207, 208, 208, 208, 208, 209, 210, 210, 
+    210, 210, 210, 210, 210, 210, 211, 212, 212, 212, 212, 212, 
+    213, 213, 213, 213, 214, 214, 215, 215, 215, 216, 216, 216, 
+    216, 216, 216, 216, 216, 216, 218, 218, 218, 218, 218, 218, 
+    218, 218, 219, 219, 219, 220, 220, 222, 222, 222, 222, 222, 
+    223, 225, 227, 227, 227, 228, 228, 228, 228, 229, 229, 229, 
+    229, 229, 229, 229, 229, 229, 229, 229, 230, 230, 232, 232, 
+    232, 232, 232, 232, 233, 234, 235, 236, 236, 237, 238, 239, 
+    239, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 
+    240, 240, 240, 241, 242, 242, 243, 244, 245, 245, 246, 246, 
+    246, 247, 247, 248, 248, 248, 248, 248, 248, 249, 249, 249, 
+    249, 250, 251, 251, 251, 252, 252, 252, 252, 252, 252, 252, 
+    252, 252, 252, 252, 253, 253, 253, 253, 253, 253, 253, 255, 
+    256, 256, 256, 256, 257, 258, 258, 259, 259, 260, 261, 261, 
+    262, 263, 264, 265, 265, 265, 265, 265, 265, 265, 267, 267, 
+    268, 268, 268, 269, 269, 269, 269, 269, 269, 270, 270, 270, 
+    270, 270, 270, 270, 270, 271, 271, 271, 271, 272, 272, 272, 
+    272, 272, 272, 273, 273, 273, 273, 273, 273, 273, 273, 273, 
+    273, 273, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 
+    274, 274, 275, 275, 275, 276, 276, 277, 278, 278, 279, 279, 
+    279, 280, 282, 283, 283, 283, 283, 283, 284, 284, 285, 286, 
+    286, 286, 286, 286, 287, 287, 290, 290, 291, 291, 292, 294, 
+    294, 294, 294, 294, 294, 295, 295, 295, 295, 296, 297, 297, 
+    299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 300, 304, 
+    304, 304, 305, 306, 306, 306, 307, 308, 308, 309, 309, 309, 
+    309, 309, 309, 309, 310, 310, 310, 310, 310, 310, 310, 310, 
+    310, 311, 312, 313, 314, 314, 314, 314, 314, 314, 315, 317, 
+    317, 318, 319, 319, 319, 319, 319, 320, 320, 321, 322, 322, 
+    322, 322, 322, 324, 325, 325, 325, 325, 325, 325, 325, 326, 
+    328, 328, 328, 329, 330, 330, 330, 331, 331, 331, 331, 331, 
+    331, 331, 331, 331, 331, 331, 331, 332, 332, 332, 332, 333, 
+    333, 334, 334, 337, 338, 338, 339, 339, 339, 340, 340, 340, 
+    340, 341, 341, 341, 341, 341, 341, 342, 343, 343, 343, 343, 
+    343, 344, 344, 345, 345, 345, 345, 345, 345, 345, 346, 347, 
+    348, 349, 349, 350, 351, 351, 351, 351, 351, 351, 351, 352, 
+    352, 352, 352, 352, 353, 354, 356, 356, 356, 357, 357, 357, 
+    357, 358, 358, 358, 358, 359, 359, 359, 359, 359, 359, 359, 
+    359, 359, 359, 359, 360, 360, 361, 362, 362, 363, 364, 365, 
+    365, 366, 366, 366, 367, 367, 367, 367, 367, 368, 368, 368, 
+    369, 369, 370, 370, 370, 371, 371, 371, 371, 371, 371, 371, 
+    371, 372, 372, 372, 372, 372, 372, 372, 372, 373, 374, 374, 
+    375, 376, 376, 377, 377, 377, 377, 377, 377, 377, 377, 377, 
+    377, 377, 380, 381, 381, 381, 381, 381, 382, 382, 382, 382, 
+    382, 382, 383, 383, 383, 383, 383, 383, 383, 384, 384, 384, 
+    385, 385, 385, 386, 386, 387, 387, 388, 388, 388, 390, 390, 
+    390, 390, 390, 391, 391, 391, 393, 393, 394, 394, 394, 394, 
+    394, 395, 395, 396, 396, 396, 398, 398, 398, 398, 398, 398, 
+    399, 401, 401, 401, 401, 401, 402, 403, 403, 405, 405, 406, 
+    406, 406, 406, 406, 406, 406, 407, 407, 407, 407, 408, 408, 
+    408, 408, 408, 410, 410, 410, 411, 411, 411, 411, 411, 411, 
+    411, 411, 412, 412, 412, 412, 412, 413, 413, 413, 413, 413, 
+    413, 415, 415, 415, 415, 415, 415, 415, 416, 417, 417, 417, 
+    417, 417, 419, 420, 422, 422, 422, 422, 422, 422, 422, 422, 
+    423, 424, 424, 424, 424, 425, 425, 426, 426, 426, 427, 427, 
+    427, 427, 427, 427, 428, 428, 428, 428, 428, 428, 430, 430, 
+    431, 432, 433, 433, 434, 434, 435, 435, 435, 436, 436, 437, 
+    437, 437, 438, 438, 438, 439, 439, 440, 441, 441, 442, 443, 
+    444, 444, 444, 444, 444, 444, 445, 445, 446, 447, 447, 448, 
+    448, 448, 448, 449, 450, 450, 450, 451, 451, 451, 454, 455, 
+    455, 456, 456, 456, 457, 458, 458, 458, 458, 458, 458, 458, 
+    458, 459, 459, 459, 459, 460, 460, 460, 460, 460, 461, 461, 
+    462, 463, 463, 464, 464, 465, 466, 467, 468, 468, 469, 470, 
+    470, 471, 472, 474, 474, 475, 475, 475, 475, 475, 475, 475, 
+    476, 477, 477, 477, 478, 478, 478, 479, 480, 481, 481, 481, 
+    481, 481, 481, 482, 482, 482, 482, 482, 482, 482, 484, 484, 
+    484, 484, 484, 484, 484, 484, 484, 485, 485, 485, 486, 486, 
+    486, 487, 488, 488, 489, 490, 490, 490, 490, 490, 491, 493, 
+    493, 493, 493, 494, 494, 494, 496, 496, 496, 497, 497, 498, 
+    498, 500, 500, 500, 501, 502, 502, 502, 503, 504, 505, 506, 
+    506, 506, 509, 509, 509, 509, 509, 510, 510, 511, 511, 511, 
+    511, 513, 513, 513, 515, 516, 516, 517, 517, 518, 518, 518, 
+    518, 518, 518, 518, 519, 519, 519, 519, 520, 520, 521, 521, 
+    521, 522, 523, 523, 524, 524, 525, 525, 525, 527, 527, 528, 
+    528, 528, 528, 528, 529, 529, 529, 531, 531, 532, 534, 535, 
+    535, 535, 535, 536, 537, 537, 537, 538, 538, 539, 539, 539, 
+    542, 543, 543, 543, 543, 544, 544, 546, 546, 546, 547, 548, 
+    548, 548, 548, 548, 549, 550, 551, 552, 552, 552, 552, 553, 
+    553, 553, 554, 554, 554, 554, 555, 556, 558, 559, 559, 559, 
+    559, 560, 561, 561, 561, 561, 561, 561, 562, 562, 562, 562, 
+    562, 562, 562, 564, 564, 564, 565, 566, 566, 566, 566, 566, 
+    566, 567, 568, 569, 569, 569, 572, 573, 573, 573, 573, 574, 
+    575, 575, 575, 576, 577, 577, 579, 579, 580, 580, 580, 580, 
+    580, 581, 581, 581, 581, 583, 583, 583, 583, 583, 584, 584, 
+    584, 585, 586, 586, 586, 586, 587, 587, 587, 588, 588, 589, 
+    589, 590, 590, 591, 592, 592, 592, 592, 593, 593, 594, 594, 
+    594, 595, 596, 596, 597, 597, 600, 601, 601, 601, 601, 602, 
+    602, 602, 602, 602, 602, 602, 602, 602, 602, 604, 604, 606, 
+    606, 606, 606, 607, 609, 609, 609, 610, 610, 610, 611, 612, 
+    614, 614, 614, 614, 614, 614, 616, 616, 616, 616, 616, 616, 
+    617, 617, 618, 618, 618, 618, 618, 620, 622, 622, 623, 623, 
+    623, 624, 625, 625, 625, 625, 625, 625, 625, 626, 626, 626, 
+    626, 629, 629, 630, 631, 631, 632, 632, 633, 634, 634, 634, 
+    634, 634, 635, 636, 637, 638, 638, 638, 638, 639, 639, 639, 
+    639, 640, 642, 642, 642, 643, 644, 644, 645, 646, 646, 646, 
+    646, 646, 646, 646, 646, 646, 650, 651, 652, 653, 653, 653, 
+    653, 653, 655, 657, 657, 658, 660, 662, 664, 664, 666, 666, 
+    666, 666, 666, 667, 667, 667, 667, 667, 667, 667, 668, 668, 
+    668, 668, 668, 668, 670, 670, 670, 671, 672, 672, 672, 672, 
+    672, 673, 674, 674, 675, 675, 675, 676, 677, 679, 680, 681, 
+    682, 682, 682, 683, 683, 683, 685, 686, 686, 688, 688, 688, 
+    691, 692, 692, 692, 693, 694, 694, 694, 696, 697, 697, 698, 
+    699, 699, 699, 700, 700, 702, 702, 702, 702, 702, 702, 703, 
+    703, 703, 704, 704, 704, 704, 704, 706, 707, 707, 707, 707, 
+    707, 707, 707, 707, 709, 710, 710, 711, 711, 712, 713, 713, 
+    714, 714, 714, 715, 715, 715, 715, 715, 715, 715, 715, 715, 
+    716, 716, 716, 717, 717, 717, 718, 718, 718, 718, 719, 719, 
+    719, 721, 723, 724, 724, 724, 725, 725, 725, 725, 725, 725, 
+    725, 725, 725, 725, 725, 726, 726, 726, 726, 726, 726, 726, 
+    727, 727, 729, 729, 729, 730, 730, 730, 730, 730, 731, 731, 
+    731, 731, 732, 732, 733, 733, 733, 733, 734, 734, 734, 734, 
+    734, 735, 735, 735, 736, 736, 737, 738, 739, 740, 740, 740, 
+    741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 742, 
+    742, 744, 744, 744, 744, 744, 745, 745, 746, 748, 748, 751, 
+    751, 751, 751, 751, 751, 751, 752, 753, 755, 755, 755, 755, 
+    755, 755, 756, 758, 758, 758, 758, 758, 759, 759, 759, 759, 
+    759, 760, 761, 762, 762, 763, 763, 763, 763, 763, 765, 766, 
+    767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 768, 768, 
+    768, 768, 768, 769, 770, 770, 770, 771, 771, 772, 773, 775, 
+    775, 776, 776, 776, 779, 779, 779, 779, 781, 782, 782, 782, 
+    782, 782, 782, 782, 783, 783, 783, 783, 786, 786, 786, 786, 
+    786, 786, 787, 787, 788, 788, 790, 791, 791, 791, 793, 793, 
+    794, 795, 795, 796, 796, 797, 799, 799, 799, 799, 799, 800, 
+    800, 801, 801, 801, 804, 804, 804, 804, 805, 805, 805, 806, 
+    807, 808, 808, 809, 809, 809, 809, 809, 810, 810, 810, 811, 
+    812, 813, 814, 814, 815, 816, 817, 818, 818, 819, 820, 821, 
+    821, 822, 822, 824, 824, 825, 829, 830, 831, 834, 834, 834, 
+    834, 834, 835, 835, 836, 837, 837, 838, 838, 839, 839, 839, 
+    839, 839, 839, 839, 840, 840, 841, 842, 843, 845, 845, 845, 
+    845, 846, 847, 847, 847, 847, 847, 847, 847, 849, 850, 851, 
+    852, 853, 854, 854, 855, 856, 856, 856, 856, 856, 856, 857, 
+    857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 859, 
+    861, 861, 864, 864, 864, 864, 865, 867, 867, 869, 869, 871, 
+    872, 873, 873, 873, 873, 873, 873, 875, 876, 877, 877, 878, 
+    878, 878, 878, 880, 880, 882, 883, 883, 883, 883, 883, 883, 
+    883, 885, 885, 886, 886, 887, 888, 889, 889, 889, 889, 889, 
+    891, 891, 891, 893, 893, 893, 893, 893, 893, 895, 895, 895, 
+    898, 899, 899, 899, 899, 899, 899, 900, 901, 902, 903, 903, 
+    904, 905, 905, 905, 906, 906, 907, 908, 908, 909, 910, 914, 
+    914, 915, 916, 916, 917, 917, 919, 919, 920, 921, 921, 923, 
+    924, 926, 927, 928, 930, 930, 931, 931, 932, 933, 934, 934, 
+    934, 934, 934, 935, 936, 937, 937, 937, 937, 938, 939, 939, 
+    939, 939, 939, 940, 940, 940, 940, 940, 940, 942, 942, 942, 
+    943, 943, 944, 945, 945, 946, 946, 947, 948, 949, 950, 950, 
+    950, 951, 951, 951, 951, 952, 953, 954, 954, 954, 954, 955, 
+    955, 955, 955, 957, 957, 957, 957, 957, 957, 957, 958, 959, 
+    959, 960, 961, 961, 961, 961, 962, 965, 965, 966, 966, 966, 
+    968, 968, 968, 968, 970, 970, 971, 972, 972, 973, 975, 975, 
+    976, 977, 977, 977, 979, 980, 980, 980, 981, 982, 982, 982, 
+    982, 983, 984, 986, 987, 987, 987, 987, 987, 987, 989, 991, 
+    993, 994, 994, 994, 995, 995, 996, 996, 997, 997, 998, 998, 
+    998, 998, 998, 1000, 1000, 1000, 1002, 1003, 1004, 1005, 1005, 1007, 
+    1007, 1007, 1009, 1009, 1009, 1009, 1010, 1012, 1013, 1014, 1014, 1014, 
+    1014, 1014, 1015, 1015, 1015, 1018, 1020, 1020, 1021, 1023, 1024, 1025, 
+    1025, 1025, 1025, 1026, 1026, 1027, 1027, 1027, 1028, 1029, 1029, 1029, 
+    1030, 1030, 1031, 1031, 1031, 1031, 1031, 1032, 1033, 1033, 1034, 1035, 
+    1036, 1036, 1036, 1036, 1036, 1037, 1039, 1039, 1040, 1040, 1040, 1041, 
+    1042, 1043, 1044, 1044, 1046, 1046, 1046, 1047, 1048, 1051, 1054, 1054, 
+    1055, 1055, 1055, 1056, 1056, 1056, 1057, 1058, 1059, 1060, 1060, 1060, 
+    1060, 1060, 1062, 1062, 1063, 1064, 1065, 1065, 1065, 1067, 1068, 1068, 
+    1068, 1068, 1068, 1069, 1069, 1070, 1070, 1071, 1071, 1072, 1073, 1074, 
+    1075, 1075, 1076, 1076, 1076, 1076, 1077, 1078, 1078, 1078, 1079, 1079, 
+    1079, 1082, 1083, 1083, 1083, 1083, 1084, 1085, 1086, 1088, 1089, 1089, 
+    1089, 1089, 1092, 1094, 1094, 1095, 1096, 1096, 1096, 1096, 1097, 1097, 
+    1098, 1099, 1099, 1100, 1100, 1100, 1100, 1101, 1102, 1103, 1104, 1105, 
+    1105, 1106, 1106, 1107, 1107, 1108, 1110, 1111, 1111, 1111, 1111, 1112, 
+    1112, 1112, 1112, 1112, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 
+    1113, 1114, 1114, 1114, 1114, 1114, 1116, 1119, 1120, 1120, 1121, 1122, 
+    1123, 1123, 1123, 1123, 1127, 1128, 1129, 1129, 1129, 1131, 1131, 1131, 
+    1131, 1133, 1135, 1136, 1136, 1138, 1139, 1139, 1140, 1141, 1141, 1144, 
+    1145, 1146, 1146, 1151, 1151, 1152, 1155, 1155, 1155, 1155, 1156, 1158, 
+    1158, 1160, 1162, 1163, 1164, 1166, 1168, 1168, 1170, 1170, 1170, 1172, 
+    1174, 1175, 1175, 1175, 1175, 1176, 1178, 1178, 1178, 1178, 1179, 1180, 
+    1181, 1181, 1183, 1185, 1186, 1186, 1186, 1188, 1188, 1188, 1188, 1188, 
+    1188, 1188, 1189, 1189, 1189, 1190, 1190, 1192, 1192, 1192, 1192, 1193, 
+    1193, 1194, 1194, 1195, 1195, 1197, 1197, 1198, 1198, 1198, 1198, 1199, 
+    1199, 1202, 1202, 1202, 1202, 1202, 1203, 1203, 1203, 1203, 1204, 1205, 
+    1205, 1207, 1207, 1208, 1208, 1208, 1208, 1208, 1208, 1209, 1210, 1212, 
+    1213, 1213, 1214, 1214, 1214, 1215, 1216, 1216, 1218, 1218, 1218, 1218, 
+    1218, 1219, 1219, 1219, 1219, 1219, 1221, 1222, 1222, 1223, 1223, 1224, 
+    1225, 1225, 1225, 1226, 1227, 1228, 1230, 1230, 1230, 1230, 1230, 1231, 
+    1231, 1231, 1231, 1232, 1233, 1233, 1234, 1234, 1236, 1237, 1237, 1238, 
+    1238, 1238, 1239, 1239, 1240, 1240, 1240, 1241, 1241, 1241, 1242, 1243, 
+    1244, 1245, 1247, 1248, 1248, 1250, 1253, 1253, 1254, 1254, 1255, 1255, 
+    1257, 1257, 1258, 1260, 1260, 1260, 1262, 1264, 1264, 1265, 1266, 1266, 
+    1268, 1270, 1271, 1271, 1272, 1272, 1272, 1272, 1273, 1275, 1275, 1275, 
+    1277, 1277, 1277, 1277, 1281, 1282, 1282, 1282, 1284, 1284, 1284, 1285, 
+    1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1286, 1287, 1287, 1288, 
+    1289, 1289, 1291, 1291, 1292, 1292, 1293, 1293, 1296, 1297, 1299, 1299, 
+    1299, 1299, 1299, 1299, 1300, 1302, 1304, 1305, 1306, 1307, 1307, 1308, 
+    1308, 1309, 1309, 1309, 1309, 1311, 1312, 1312, 1313, 1313, 1313, 1314, 
+    1316, 1316, 1316, 1318, 1319, 1319, 1322, 1325, 1326, 1326, 1326, 1326, 
+    1328, 1328, 1328, 1328, 1328, 1328, 1328, 1329, 1329, 1329, 1330, 1330, 
+    1331, 1331, 1331, 1331, 1331, 1331, 1332, 1332, 1332, 1332, 1332, 1333, 
+    1333, 1333, 1334, 1334, 1335, 1337, 1337, 1339, 1339, 1339, 1340, 1340, 
+    1341, 1341, 1342, 1344, 1344, 1344, 1344, 1344, 1346, 1348, 1348, 1348, 
+    1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1350, 1350, 1350, 
+    1352, 1352, 1352, 1354, 1355, 1356, 1356, 1357, 1358, 1359, 1359, 1360, 
+    1360, 1360, 1361, 1363, 1364, 1365, 1366, 1368, 1368, 1368, 1369, 1369, 
+    1371, 1372, 1373, 1374, 1374, 1374, 1375, 1376, 1376, 1376, 1376, 1378, 
+    1378, 1379, 1379, 1380, 1380, 1380, 1381, 1381, 1382, 1383, 1383, 1384, 
+    1384, 1385, 1386, 1386, 1388, 1389, 1389, 1390, 1390, 1390, 1391, 1392, 
+    1394, 1394, 1397, 1398, 1398, 1399, 1400, 1401, 1401, 1401, 1401, 1401, 
+    1401, 1402, 1404, 1404, 1406, 1406, 1406, 1407, 1407, 1407, 1409, 1409, 
+    1410, 1411, 1411, 1411, 1411, 1412, 1412, 1413, 1414, 1414, 1414, 1414, 
+    1415, 1417, 1418, 1418, 1418, 1418, 1418, 1420, 1420, 1421, 1421, 1421, 
+    1421, 1423, 1424, 1426, 1427, 1427, 1428, 1428, 1429, 1429, 1429, 1431, 
+    1431, 1432, 1432, 1432, 1434, 1435, 1437, 1438, 1438, 1439, 1441, 1441, 
+    1441, 1441, 1441, 1442, 1443, 1443, 1443, 1445, 1445, 1445, 1445, 1445, 
+    1446, 1448, 1449, 1450, 1451, 1451, 1451, 1452, 1453, 1453, 1454, 1454, 
+    1455, 1455, 1455, 1455, 1456, 1458, 1458, 1458, 1460, 1463, 1465, 1465, 
+    1466, 1467, 1467, 1468, 1468, 1468, 1468, 1468, 1469, 1469, 1470, 1470, 
+    1472, 1472, 1472, 1472, 1472, 1472, 1474, 1475, 1476, 1477, 1478, 1478, 
+    1479, 1479, 1481, 1482, 1486, 1486, 1486, 1486, 1486, 1486, 1487, 1488, 
+    1488, 1489, 1491, 1491, 1491, 1491, 1491, 1493, 1495, 1495, 1498, 1498, 
+    1498, 1498, 1498, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1501, 1502, 
+    1502, 1502, 1503, 1504, 1504, 1504, 1506, 1507, 1507, 1507, 1509, 1509, 
+    1510, 1510, 1511, 1511, 1511, 1511, 1512, 1512, 1514, 1516, 1518, 1519, 
+    1521, 1521, 1523, 1525, 1526, 1526, 1527, 1529, 1530, 1530, 1532, 1534, 
+    1535, 1536, 1537, 1540, 1540, 1541, 1541, 1541, 1543, 1543, 1543, 1546, 
+    1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1548, 1548, 1548, 1549, 
+    1549, 1549, 1554, 1554, 1555, 1555, 1555, 1556, 1556, 1557, 1557, 1557, 
+    1558, 1558, 1560, 1560, 1561, 1561, 1561, 1562, 1562, 1562, 1562, 1563, 
+    1564, 1565, 1566, 1567, 1567, 1567, 1568, 1569, 1571, 1573, 1573, 1573, 
+    1574, 1576, 1578, 1579, 1579, 1579, 1579, 1581, 1581, 1582, 1583, 1584, 
+    1585, 1589, 1589, 1589, 1589, 1590, 1591, 1591, 1591, 1592, 1592, 1592, 
+    1593, 1593, 1594, 1594, 1595, 1596, 1599, 1600, 1600, 1601, 1602, 1605, 
+    1606, 1607, 1608, 1609, 1610, 1611, 1613, 1613, 1613, 1614, 1614, 1617, 
+    1619, 1619, 1621, 1621, 1621, 1622, 1622, 1623, 1624, 1624, 1625, 1626, 
+    1626, 1626, 1627, 1627, 1628, 1630, 1630, 1631, 1631, 1632, 1632, 1633, 
+    1633, 1634, 1636, 1637, 1638, 1640, 1640, 1640, 1642, 1643, 1644, 1647, 
+    1647, 1647, 1647, 1649, 1649, 1650, 1651, 1653, 1654, 1654, 1654, 1655, 
+    1655, 1657, 1659, 1659, 1661, 1661, 1662, 1662, 1662, 1662, 1662, 1663, 
+    1666, 1667, 1669, 1670, 1672, 1672, 1672, 1674, 1674, 1676, 1679, 1681, 
+    1683, 1683, 1684, 1684, 1684, 1685, 1687, 1687, 1688, 1689, 1692, 1695, 
+    1697, 1701, 1702, 1703, 1703, 1703, 1704, 1704, 1705, 1705, 1705, 1707, 
+    1707, 1708, 1708, 1708, 1708, 1710, 1710, 1711, 1713, 1714, 1714, 1715, 
+    1715, 1715, 1716, 1716, 1716, 1717, 1717, 1719, 1719, 1719, 1720, 1720, 
+    1722, 1722, 1722, 1722, 1723, 1723, 1723, 1723, 1726, 1726, 1727, 1727, 
+    1728, 1728, 1728, 1729, 1729, 1730, 1730, 1730, 1731, 1731, 1732, 1734, 
+    1734, 1736, 1736, 1738, 1738, 1738, 1738, 1738, 1739, 1741, 1741, 1741, 
+    1743, 1744, 1745, 1746, 1746, 1746, 1748, 1749, 1749, 1749, 1750, 1752, 
+    1752, 1753, 1756, 1756, 1757, 1758, 1758, 1758, 1759, 1760, 1761, 1761, 
+    1761, 1764, 1764, 1765, 1765, 1766, 1767, 1767, 1770, 1771, 1771, 1773, 
+    1774, 1774, 1774, 1775, 1776, 1776, 1777, 1778, 1779, 1781, 1781, 1782, 
+    1783, 1784, 1784, 1784, 1785, 1785, 1786, 1786, 1786, 1786, 1787, 1788, 
+    1790, 1791, 1792, 1793, 1793, 1793, 1796, 1797, 1797, 1802, 1803, 1803, 
+    1804, 1804, 1805, 1805, 1805, 1806, 1806, 1806, 1806, 1807, 1807, 1807, 
+    1810, 1810, 1812, 1814, 1814, 1815, 1817, 1819, 1819, 1821, 1821, 1821, 
+    1821, 1822, 1822, 1822, 1823, 1824, 1824, 1824, 1824, 1824, 1825, 1825, 
+    1826, 1826, 1827, 1828, 1829, 1829, 1830, 1830, 1832, 1834, 1837, 1839, 
+    1839, 1839, 1839, 1840, 1843, 1843, 1844, 1845, 1845, 1846, 1846, 1848, 
+    1848, 1848, 1849, 1849, 1849, 1849, 1850, 1850, 1851, 1853, 1854, 1854, 
+    1855, 1856, 1856, 1857, 1858, 1858, 1859, 1859, 1861, 1861, 1864, 1864, 
+    1865, 1865, 1865, 1865, 1865, 1866, 1866, 1867, 1868, 1868, 1869, 1870, 
+    1870, 1871, 1872, 1874, 1875, 1876, 1876, 1878, 1879, 1879, 1879, 1879, 
+    1881, 1881, 1881, 1881, 1882, 1882, 1882, 1886, 1887, 1887, 1887, 1887, 
+    1888, 1889, 1892, 1893, 1893, 1895, 1895, 1895, 1897, 1898, 1900, 1901, 
+    1901, 1901, 1901, 1902, 1902, 1903, 1904, 1904, 1904, 1904, 1905, 1907, 
+    1908, 1908, 1908, 1909, 1910, 1911, 1911, 1912, 1913, 1914, 1916, 1916, 
+    1916, 1919, 1919, 1922, 1923, 1923, 1925, 1925, 1926, 1926, 1926, 1927, 
+    1927, 1929, 1930, 1932, 1933, 1934, 1935, 1935, 1936, 1936, 1937, 1937, 
+    1940, 1940, 1940, 1941, 1942, 1943, 1945, 1945, 1945, 1946, 1948, 1949, 
+    1949, 1949, 1950, 1950, 1952, 1952, 1953, 1953, 1953, 1955, 1955, 1955, 
+    1957, 1958, 1959, 1960, 1963, 1964, 1965, 1966, 1966, 1966, 1966, 1966, 
+    1969, 1970, 1971, 1973, 1973, 1974, 1975, 1976, 1977, 1978, 1978, 1978, 
+    1979, 1981, 1982, 1984, 1985, 1986, 1986, 1986, 1987, 1988, 1988, 1989, 
+    1989, 1991, 1991, 1992, 1992, 1994, 1994, 1995, 1995, 1996, 1997, 1998, 
+    1998, 1998, 1998, 1998, 1998, 1999, 1999, 1999, 2000, 2001, 2001, 2004, 
+    2005, 2005, 2006, 2007, 2007, 2007, 2009, 2009, 2010, 2010, 2011, 2012, 
+    2013, 2015, 2016, 2018, 2018, 2018, 2019, 2021, 2021, 2021, 2022, 2023, 
+    2023, 2023, 2024, 2024, 2026, 2026, 2027, 2027, 2028, 2030, 2030, 2031, 
+    2033, 2033, 2033, 2033, 2034, 2034, 2034, 2034, 2036, 2036, 2036, 2038, 
+    2039, 2040, 2042, 2043, 2044, 2046, 2047, 2050, 2050, 2050, 2050, 2050, 
+    2050, 2051, 2051, 2052, 2052, 2052, 2052, 2053, 2055, 2057, 2057, 2057, 
+    2057, 2057, 2059, 2063, 2064, 2065, 2065, 2065, 2067, 2067, 2068, 2068, 
+    2068, 2069, 2071, 2071, 2072, 2074, 2074, 2074, 2075, 2076, 2076, 2078, 
+    2078, 2078, 2079, 2079, 2081, 2085, 2085, 2085, 2085, 2085, 2086, 2086, 
+    2087, 2087, 2087, 2087, 2087, 2088, 2088, 2088, 2089, 2090, 2091, 2091, 
+    2091, 2092, 2093, 2093, 2094, 2094, 2098, 2100, 2103, 2103, 2103, 2104, 
+    2105, 2106, 2107, 2107, 2107, 2107, 2108, 2108, 2108, 2108, 2109, 2111, 
+    2111, 2111, 2113, 2113, 2115, 2115, 2115, 2115, 2117, 2117, 2120, 2120, 
+    2121, 2122, 2123, 2125, 2126, 2128, 2131, 2133, 2135, 2135, 2136, 2137, 
+    2138, 2140, 2140, 2142, 2145, 2145, 2145, 2145, 2147, 2148, 2148, 2150, 
+    2150, 2152, 2153, 2155, 2155, 2157, 2158, 2159, 2159, 2159, 2160, 2160, 
+    2161, 2162, 2163, 2163, 2163, 2166, 2166, 2167, 2167, 2168, 2169, 2170, 
+    2171, 2171, 2171, 2173, 2175, 2175, 2175, 2175, 2176, 2176, 2176, 2177, 
+    2177, 2179, 2179, 2182, 2182, 2182, 2182, 2182, 2182, 2183, 2184, 2185, 
+    2186, 2186, 2187, 2189, 2192, 2193, 2194, 2194, 2195, 2198, 2199, 2202, 
+    2202, 2204, 2205, 2206, 2208, 2210, 2211, 2213, 2213, 2213, 2213, 2214, 
+    2216, 2217, 2218, 2219, 2219, 2220, 2222, 2223, 2224, 2224, 2225, 2225, 
+    2227, 2227, 2228, 2229, 2235, 2236, 2236, 2237, 2238, 2239, 2239, 2239, 
+    2242, 2243, 2244, 2245, 2246, 2246, 2248, 2248, 2248, 2248, 2248, 2248, 
+    2249, 2250, 2250, 2250, 2250, 2250, 2250, 2251, 2255, 2256, 2258, 2258, 
+    2259, 2259, 2261, 2262, 2267, 2267, 2269, 2269, 2271, 2272, 2274, 2274, 
+    2275, 2275, 2276, 2277, 2280, 2280, 2281, 2281, 2281, 2282, 2283, 2284, 
+    2285, 2287, 2291, 2291, 2291, 2291, 2291, 2291, 2291, 2291, 2292, 2292, 
+    2294, 2297, 2297, 2298, 2298, 2300, 2301, 2301, 2301, 2301, 2302, 2303, 
+    2303, 2303, 2306, 2306, 2306, 2306, 2306, 2308, 2309, 2310, 2310, 2310, 
+    2311, 2312, 2312, 2313, 2313, 2313, 2313, 2313, 2313, 2314, 2314, 2316, 
+    2316, 2316, 2317, 2317, 2318, 2320, 2320, 2320, 2320, 2320, 2322, 2323, 
+    2323, 2324, 2325, 2326, 2327, 2327, 2328, 2328, 2330, 2330, 2330, 2331, 
+    2331, 2332, 2334, 2335, 2336, 2338, 2340, 2341, 2342, 2344, 2346, 2347, 
+    2348, 2349, 2349, 2350, 2351, 2352, 2353, 2353, 2353, 2353, 2353, 2355, 
+    2355, 2356, 2357, 2359, 2359, 2359, 2360, 2360, 2362, 2364, 2364, 2364, 
+    2365, 2366, 2367, 2367, 2367, 2367, 2368, 2370, 2370, 2372, 2372, 2373, 
+    2373, 2374, 2374, 2375, 2377, 2377, 2377, 2378, 2378, 2378, 2379, 2380, 
+    2380, 2380, 2380, 2381, 2381, 2382, 2383, 2384, 2385, 2385, 2387, 2387, 
+    2388, 2389, 2390, 2390, 2391, 2392, 2392, 2394, 2396, 2396, 2398, 2399, 
+    2399, 2399, 2403, 2403, 2404, 2406, 2406, 2407, 2408, 2408, 2409, 2412, 
+    2413, 2414, 2414, 2417, 2420, 2422, 2422, 2422, 2422, 2423, 2424, 2424, 
+    2424, 2424, 2425, 2425, 2426, 2426, 2427, 2427, 2430, 2430, 2430, 2431, 
+    2431, 2432, 2433, 2433, 2433, 2433, 2433, 2433, 2434, 2434, 2435, 2436, 
+    2436, 2436, 2437, 2438, 2441, 2441, 2443, 2443, 2444, 2444, 2446, 2447, 
+    2448, 2448, 2448, 2448, 2448, 2451, 2452, 2452, 2454, 2455, 2457, 2457, 
+    2457, 2457, 2457, 2459, 2460, 2462, 2463, 2465, 2466, 2466, 2466, 2467, 
+    2468, 2469, 2469, 2469, 2470, 2471, 2471, 2471, 2472, 2475, 2477, 2477, 
+    2477, 2477, 2477, 2479, 2480, 2481, 2482, 2484, 2485, 2485, 2486, 2487, 
+    2487, 2488, 2491, 2492, 2495, 2496, 2496, 2496, 2496, 2497, 2498, 2499, 
+    2499, 2500, 2501, 2501, 2502, 2502, 2503, 2503, 2505, 2506, 2506, 2506, 
+    2508, 2510, 2511, 2512, 2513, 2514, 2514, 2517, 2517, 2517, 2518, 2518, 
+    2518, 2518, 2518, 2519, 2521, 2523, 2525, 2526, 2526, 2526, 2526, 2526, 
+    2526, 2527, 2528, 2529, 2529, 2529, 2529, 2529, 2530, 2531, 2533, 2535, 
+    2535, 2535, 2535, 2538, 2538, 2542, 2545, 2546, 2546, 2547, 2548, 2550, 
+    2550, 2552, 2552, 2552, 2554, 2555, 2555, 2558, 2559, 2560, 2560, 2561, 
+    2561, 2564, 2564, 2565, 2565, 2565, 2565, 2566, 2567, 2567, 2567, 2569, 
+    2569, 2570, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2578, 2579, 2579, 
+    2580, 2581, 2582, 2583, 2585, 2586, 2586, 2586, 2586, 2587, 2589, 2590, 
+    2591, 2591, 2593, 2595, 2597, 2597, 2598, 2599, 2600, 2600, 2602, 2602, 
+    2604, 2604, 2604, 2604, 2604, 2605, 2605, 2605, 2605, 2607, 2607, 2607, 
+    2608, 2609, 2609, 2609, 2609, 2611, 2613, 2614, 2615, 2615, 2617, 2617, 
+    2618, 2619, 2622, 2622, 2623, 2625, 2625, 2627, 2627, 2627, 2627, 2627, 
+    2627, 2628, 2628, 2630, 2630, 2631, 2631, 2631, 2631, 2632, 2633, 2633, 
+    2633, 2634, 2635, 2635, 2637, 2637, 2638, 2639, 2639, 2641, 2641, 2641, 
+    2641, 2642, 2643, 2644, 2644, 2646, 2646, 2646, 2646, 2648, 2648, 2649, 
+    2649, 2649, 2649, 2649, 2652, 2652, 2653, 2653, 2654, 2655, 2655, 2657, 
+    2660, 2662, 2663, 2664, 2664, 2664, 2665, 2667, 2672, 2672, 2672, 2672, 
+    2673, 2674, 2674, 2675, 2675, 2678, 2679, 2679, 2680, 2681, 2681, 2681, 
+    2682, 2682, 2682, 2684, 2686, 2687, 2687, 2687, 2688, 2688, 2688, 2688, 
+    2688, 2688, 2689, 2689, 2691, 2691, 2693, 2694, 2694, 2696, 2696, 2696, 
+    2697, 2697, 2699, 2699, 2699, 2700, 2703, 2703, 2704, 2705, 2705, 2706, 
+    2708, 2708, 2711, 2713, 2714, 2714, 2714, 2717, 2717, 2718, 2719, 2720, 
+    2721, 2722, 2723, 2724, 2724, 2726, 2727, 2729, 2731, 2733, 2733, 2734, 
+    2736, 2739, 2740, 2743, 2744, 2745, 2750, 2752, 2754, 2754, 2754, 2757, 
+    2757, 2758, 2758, 2761, 2761, 2762, 2763, 2763, 2763, 2765, 2765, 2766, 
+    2767, 2767, 2767, 2768, 2771, 2772, 2772, 2774, 2774, 2774, 2775, 2776, 
+    2776, 2777, 2778, 2779, 2780, 2782, 2782, 2783, 2783, 2783, 2784, 2784, 
+    2785, 2786, 2786, 2786, 2787, 2788, 2788, 2789, 2792, 2792, 2796, 2797, 
+    2798, 2799, 2799, 2800, 2800, 2802, 2804, 2804, 2805, 2805, 2806, 2806, 
+    2806, 2808, 2810, 2813, 2815, 2816, 2816, 2817, 2817, 2818, 2818, 2819, 
+    2820, 2822, 2823, 2825, 2826, 2828, 2830, 2831, 2831, 2831, 2833, 2836, 
+    2838, 2839, 2839, 2840, 2841, 2842, 2844, 2844, 2847, 2847, 2848, 2849, 
+    2850, 2851, 2851, 2852, 2852, 2853, 2854, 2854, 2854, 2854, 2855, 2859, 
+    2859, 2861, 2862, 2862, 2862, 2864, 2865, 2867, 2867, 2869, 2870, 2872, 
+    2872, 2872, 2873, 2876, 2876, 2877, 2878, 2879, 2880, 2882, 2882, 2885, 
+    2885, 2885, 2885, 2885, 2886, 2886, 2886, 2886, 2886, 2886, 2887, 2887, 
+    2888, 2888, 2889, 2889, 2889, 2893, 2893, 2894, 2895, 2895, 2895, 2895, 
+    2895, 2895, 2896, 2897, 2897, 2900, 2902, 2902, 2903, 2903, 2903, 2904, 
+    2905, 2905, 2907, 2910, 2911, 2912, 2913, 2913, 2916, 2916, 2917, 2917, 
+    2917, 2920, 2921, 2922, 2923, 2924, 2925, 2927, 2929, 2929, 2931, 2933, 
+    2933, 2935, 2936, 2936, 2938, 2938, 2938, 2939, 2940, 2941, 2942, 2942, 
+    2942, 2943, 2943, 2945, 2946, 2946, 2949, 2950, 2951, 2952, 2952, 2952, 
+    2953, 2954, 2954, 2955, 2955, 2955, 2957, 2957, 2960, 2961, 2962, 2963, 
+    2963, 2964, 2965, 2965, 2965, 2966, 2966, 2969, 2969, 2970, 2973, 2973, 
+    2973, 2974, 2976, 2978, 2978, 2978, 2978, 2979, 2981, 2981, 2981, 2982, 
+    2983, 2983, 2984, 2986, 2987, 2991, 2992, 2992, 2992, 2993, 2993, 2993, 
+    2993, 2994, 2996, 2996, 2996, 2998, 2998, 2998, 2998, 3000, 3000, 3000, 
+    3000, 3000, 3000, 3000, 3000, 3001, 3004, 3004, 3005, 3005, 3008, 3009, 
+    3009, 3011, 3012, 3014, 3016, 3017, 3019, 3020, 3022, 3022, 3023, 3023, 
+    3023, 3025, 3027, 3029, 3029, 3029, 3033, 3033, 3035, 3037, 3037, 3037, 
+    3037, 3038, 3041, 3041, 3044, 3044, 3045, 3045, 3045, 3045, 3048, 3051, 
+    3053, 3053, 3057, 3057, 3058, 3058, 3058, 3060, 3060, 3060, 3060, 3061, 
+    3061, 3062, 3062, 3064, 3066, 3066, 3066, 3066, 3068, 3069, 3072, 3072, 
+    3073, 3073, 3075, 3075, 3077, 3077, 3078, 3079, 3079, 3080, 3081, 3081, 
+    3082, 3083, 3085, 3086, 3086, 3086, 3087, 3087, 3088, 3091, 3092, 3092, 
+    3092, 3093, 3093, 3093, 3093, 3094, 3095, 3095, 3095, 3097, 3097, 3098, 
+    3099, 3099, 3099, 3100, 3100, 3101, 3102, 3103, 3105, 3106, 3107, 3108, 
+    3109, 3109, 3111, 3112, 3113, 3115, 3115, 3115, 3115, 3116, 3117, 3118, 
+    3121, 3122, 3122, 3124, 3124, 3124, 3125, 3125, 3126, 3126, 3131, 3131, 
+    3133, 3136, 3136, 3137, 3139, 3139, 3140, 3140, 3140, 3142, 3142, 3143, 
+    3144, 3147, 3147, 3150, 3150, 3151, 3153, 3153, 3153, 3153, 3153, 3155, 
+    3157, 3158, 3159, 3159, 3160, 3162, 3163, 3164, 3165, 3166, 3167, 3168, 
+    3168, 3169, 3169, 3170, 3170, 3171, 3172, 3172, 3174, 3176, 3178, 3179, 
+    3181, 3183, 3183, 3184, 3184, 3185, 3185, 3186, 3187, 3188, 3189, 3189, 
+    3190, 3191, 3193, 3195, 3196, 3197, 3200, 3200, 3201, 3202, 3203, 3203, 
+    3206, 3207, 3209, 3209, 3211, 3213, 3214, 3214, 3214, 3215, 3216, 3217, 
+    3218, 3218, 3220, 3221, 3221, 3221, 3221, 3221, 3222, 3223, 3224, 3224, 
+    3225, 3226, 3227, 3228, 3228, 3228, 3229, 3230, 3230, 3231, 3231, 3231, 
+    3231, 3231, 3231, 3232, 3234, 3235, 3235, 3235, 3238, 3238, 3239, 3240, 
+    3240, 3240, 3242, 3246, 3247, 3247, 3251, 3253, 3254, 3255, 3255, 3255, 
+    3255, 3255, 3258, 3259, 3262, 3263, 3263, 3264, 3265, 3266, 3266, 3269, 
+    3269, 3269, 3270, 3270, 3272, 3272, 3273, 3274, 3276, 3279, 3279, 3279, 
+    3280, 3283, 3284, 3285, 3286, 3287, 3288, 3288, 3289, 3290, 3291, 3291, 
+    3292, 3294, 3294, 3294, 3295, 3295, 3295, 3296, 3297, 3299, 3300, 3301, 
+    3303, 3303, 3303, 3305, 3305, 3307, 3308, 3308, 3308, 3309, 3309, 3309, 
+    3311, 3311, 3314, 3315, 3315, 3316, 3316, 3318, 3319, 3319, 3321, 3322, 
+    3322, 3322, 3322, 3322, 3324, 3326, 3327, 3327, 3328, 3330, 3331, 3333, 
+    3334, 3336, 3338, 3338, 3339, 3341, 3343, 3345, 3347, 3347, 3348, 3349, 
+    3349, 3351, 3353, 3356, 3357, 3357, 3358, 3358, 3358, 3359, 3360, 3360, 
+    3360, 3361, 3362, 3363, 3363, 3363, 3365, 3366, 3367, 3368, 3370, 3371, 
+    3373, 3373, 3374, 3374, 3374, 3376, 3376, 3378, 3381, 3381, 3382, 3384, 
+    3384, 3384, 3384, 3384, 3384, 3384, 3384, 3385, 3385, 3387, 3387, 3388, 
+    3392, 3392, 3393, 3393, 3393, 3395, 3397, 3397, 3397, 3397, 3397, 3398, 
+    3400, 3402, 3404, 3407, 3407, 3407, 3408, 3408, 3409, 3410, 3413, 3415, 
+    3417, 3418, 3420, 3421, 3422, 3423, 3423, 3425, 3426, 3426, 3426, 3426, 
+    3426, 3426, 3427, 3427, 3429, 3430, 3430, 3431, 3433, 3433, 3438, 3440, 
+    3440, 3441, 3442, 3443, 3446, 3446, 3447, 3448, 3448, 3448, 3449, 3449, 
+    3450, 3450, 3451, 3451, 3452, 3453, 3456, 3457, 3459, 3459, 3463, 3464, 
+    3466, 3468, 3469, 3469, 3469, 3469, 3470, 3470, 3471, 3472, 3472, 3472, 
+    3474, 3477, 3478, 3479, 3480, 3480, 3480, 3481, 3481, 3481, 3482, 3482, 
+    3483, 3485, 3486, 3486, 3488, 3488, 3489, 3490, 3490, 3491, 3491, 3493, 
+    3495, 3497, 3498, 3498, 3499, 3501, 3503, 3505, 3506, 3506, 3508, 3510, 
+    3511, 3513, 3514, 3515, 3516, 3519, 3521, 3522, 3524, 3525, 3525, 3525, 
+    3528, 3530, 3532, 3534, 3534, 3535, 3536, 3536, 3536, 3538, 3541, 3541, 
+    3542, 3542, 3543, 3544, 3544, 3546, 3546, 3547, 3548, 3548, 3549, 3552, 
+    3553, 3555, 3556, 3557, 3557, 3558, 3558, 3560, 3560, 3561, 3562, 3563, 
+    3564, 3564, 3565, 3566, 3566, 3567, 3567, 3567, 3569, 3570, 3570, 3572, 
+    3573, 3573, 3575, 3577, 3578, 3578, 3579, 3580, 3581, 3583, 3585, 3585, 
+    3585, 3586, 3586, 3587, 3588, 3588, 3588, 3589, 3590, 3593, 3593, 3593, 
+    3595, 3596, 3596, 3596, 3597, 3600, 3601, 3601, 3604, 3605, 3606, 3608, 
+    3611, 3611, 3611, 3611, 3612, 3612, 3612, 3615, 3616, 3617, 3617, 3617, 
+    3620, 3620, 3621, 3621, 3621, 3622, 3622, 3623, 3624, 3624, 3626, 3626, 
+    3627, 3627, 3628, 3630, 3631, 3632, 3633, 3635, 3635, 3636, 3638, 3639, 
+    3640, 3640, 3643, 3643, 3646, 3646, 3646, 3648, 3651, 3655, 3656, 3658, 
+    3658, 3660, 3661, 3662, 3663, 3663, 3664, 3664, 3665, 3666, 3666, 3666, 
+    3667, 3668, 3670, 3670, 3670, 3674, 3675, 3677, 3678, 3678, 3678, 3679, 
+    3679, 3679, 3679, 3681, 3681, 3681, 3681, 3681, 3681, 3681, 3682, 3682, 
+    3684, 3686, 3686, 3687, 3688, 3689, 3689, 3689, 3689, 3690, 3694, 3694, 
+    3694, 3695, 3695, 3696, 3698, 3698, 3700, 3700, 3701, 3704, 3704, 3705, 
+    3705, 3706, 3707, 3707, 3711, 3713, 3713, 3715, 3715, 3715, 3715, 3716, 
+    3720, 3721, 3722, 3722, 3722, 3722, 3723, 3724, 3724, 3724, 3727, 3730, 
+    3730, 3731, 3733, 3734, 3734, 3736, 3736, 3737, 3739, 3742, 3742, 3744, 
+    3744, 3746, 3750, 3752, 3752, 3752, 3755, 3756, 3756, 3757, 3758, 3761, 
+    3762, 3762, 3762, 3764, 3764, 3764, 3765, 3765, 3765, 3766, 3767, 3767, 
+    3767, 3767, 3767, 3769, 3771, 3771, 3771, 3772, 3772, 3773, 3774, 3775, 
+    3776, 3777, 3777, 3779, 3780, 3782, 3788, 3789, 3789, 3790, 3791, 3792, 
+    3793, 3793, 3793, 3794, 3794, 3795, 3795, 3796, 3797, 3798, 3799, 3800, 
+    3800, 3800, 3804, 3806, 3808, 3808, 3810, 3810, 3812, 3812, 3812, 3812, 
+    3812, 3814, 3815, 3816, 3817, 3818, 3819, 3819, 3819, 3821, 3822, 3822, 
+    3822, 3823, 3824, 3824, 3824, 3825, 3826, 3828, 3830, 3832, 3832, 3834, 
+    3834, 3834, 3834, 3834, 3835, 3836, 3840, 3841, 3842, 3843, 3845, 3846, 
+    3846, 3846, 3848, 3848, 3850, 3851, 3854, 3854, 3855, 3856, 3858, 3859, 
+    3860, 3861, 3863, 3866, 3867, 3868, 3869, 3873, 3873, 3876, 3876, 3876, 
+    3877, 3877, 3877, 3879, 3882, 3882, 3882, 3884, 3884, 3886, 3888, 3889, 
+    3889, 3889, 3889, 3889, 3891, 3892, 3893, 3895, 3896, 3897, 3898, 3899, 
+    3900, 3902, 3903, 3905, 3905, 3905, 3906, 3907, 3909, 3909, 3909, 3909, 
+    3911, 3912, 3912, 3913, 3915, 3915, 3915, 3916, 3919, 3919, 3920, 3921, 
+    3922, 3922, 3923, 3923, 3923, 3924, 3924, 3924, 3927, 3927, 3929, 3930, 
+    3931, 3932, 3933, 3933, 3933, 3933, 3933, 3938, 3940, 3940, 3941, 3942, 
+    3943, 3943, 3943, 3943, 3943, 3944, 3944, 3946, 3948, 3949, 3949, 3949, 
+    3949, 3950, 3950, 3951, 3951, 3952, 3955, 3959, 3959, 3959, 3961, 3962, 
+    3962, 3964, 3964, 3966, 3971, 3971, 3972, 3973, 3973, 3975, 3976, 3977, 
+    3978, 3982, 3982, 3982, 3982, 3982, 3983, 3984, 3985, 3985, 3985, 3985, 
+    3986, 3987, 3987, 3987, 3987, 3988, 3988, 3988, 3990, 3991, 3991, 3991, 
+    3993, 3995, 3995, 3995, 3996, 3996, 3997, 3997, 4001, 4004, 4005, 4006, 
+    4007, 4007, 4008, 4008, 4008, 4008, 4009, 4010, 4012, 4014, 4015, 4015, 
+    4016, 4017, 4018, 4020, 4020, 4020, 4022, 4022, 4024, 4025, 4026, 4028, 
+    4028, 4032, 4033, 4035, 4036, 4038, 4038, 4041, 4042, 4042, 4042, 4042, 
+    4043, 4045, 4046, 4046, 4047, 4048, 4049, 4050, 4052, 4052, 4053, 4054, 
+    4054, 4055, 4057, 4058, 4060, 4062, 4064, 4067, 4070, 4071, 4072, 4072, 
+    4072, 4074, 4074, 4076, 4076, 4077, 4078, 4078, 4078, 4078, 4078, 4078, 
+    4079, 4080, 4080, 4081, 4082, 4088, 4088, 4090, 4091, 4093, 4095, 4097, 
+    4097, 4098, 4100, 4100, 4101, 4101, 4101, 4102, 4102, 4102, 4102, 4102, 
+    4102, 4102, 4102, 4102, 4102, 4104, 4105, 4106, 4107, 4109, 4111, 4111, 
+    4112, 4113, 4114, 4115, 4116, 4117, 4119, 4121, 4123, 4124, 4125, 4126, 
+    4128, 4129, 4129, 4129, 4129, 4130, 4130, 4131, 4132, 4133, 4133, 4133, 
+    4133, 4133, 4135, 4135, 4136, 4137, 4137, 4139, 4139, 4140, 4141, 4142, 
+    4144, 4144, 4145, 4147, 4149, 4149, 4151, 4151, 4153, 4153, 4154, 4154, 
+    4154, 4155, 4156, 4157, 4158, 4158, 4160, 4162, 4163, 4163, 4164, 4165, 
+    4165, 4165, 4165, 4168, 4170, 4171, 4172, 4172, 4172, 4172, 4173, 4173, 
+    4175, 4175, 4177, 4177, 4179, 4180, 4182, 4182, 4184, 4184, 4185, 4186, 
+    4188, 4191, 4192, 4192, 4192, 4193, 4193, 4193, 4194, 4198, 4199, 4201, 
+    4201, 4202, 4202, 4204, 4205, 4205, 4207, 4207, 4207, 4207, 4209, 4211, 
+    4212, 4213, 4214, 4215, 4217, 4217, 4219, 4222, 4223, 4225, 4225, 4227, 
+    4228, 4229, 4230, 4230, 4232, 4234, 4235, 4237, 4239, 4239, 4239, 4240, 
+    4240, 4242, 4246, 4248, 4248, 4250, 4250, 4250, 4251, 4251, 4251, 4252, 
+    4254, 4255, 4255, 4255, 4256, 4257, 4257, 4257, 4258, 4259, 4260, 4260, 
+    4260, 4261, 4262, 4265, 4266, 4268, 4269, 4270, 4273, 4276, 4276, 4277, 
+    4281, 4282, 4286, 4288, 4290, 4291, 4291, 4293, 4294, 4296, 4297, 4299, 
+    4300, 4300, 4300, 4301, 4302, 4304, 4304, 4309, 4309, 4309, 4309, 4309, 
+    4309, 4310, 4310, 4311, 4311, 4311, 4311, 4313, 4314, 4315, 4316, 4317, 
+    4319, 4322, 4323, 4324, 4328, 4328, 4329, 4333, 4334, 4335, 4335, 4336, 
+    4336, 4337, 4339, 4340, 4341, 4342, 4344, 4347, 4347, 4348, 4349, 4349, 
+    4349, 4351, 4353, 4353, 4354, 4357, 4360, 4361, 4361, 4361, 4364, 4366, 
+    4366, 4366, 4366, 4366, 4366, 4367, 4367, 4368, 4371, 4372, 4374, 4376, 
+    4380, 4381, 4384, 4384, 4384, 4385, 4385, 4387, 4389, 4389, 4390, 4391, 
+    4393, 4395, 4396, 4397, 4397, 4400, 4400, 4401, 4401, 4402, 4403, 4404, 
+    4405, 4405, 4405, 4407, 4410, 4410, 4410, 4411, 4412, 4414, 4414, 4418, 
+    4421, 4423, 4423, 4424, 4425, 4425, 4426, 4426, 4427, 4429, 4432, 4432, 
+    4433, 4434, 4436, 4436, 4437, 4439, 4439, 4440, 4443, 4443, 4443, 4445, 
+    4445, 4446, 4446, 4447, 4449, 4450, 4453, 4453, 4456, 4456, 4456, 4458, 
+    4458, 4462, 4464, 4465, 4467, 4473, 4476, 4476, 4478, 4479, 4482, 4483, 
+    4485, 4487, 4487, 4488, 4490, 4490, 4490, 4491, 4493, 4495, 4496, 4498, 
+    4498, 4498, 4500, 4501, 4503, 4504, 4504, 4505, 4505, 4509, 4510, 4511, 
+    4513, 4514, 4515, 4515, 4516, 4517, 4517, 4518, 4519, 4520, 4521, 4521, 
+    4521, 4522, 4522, 4523, 4523, 4523, 4525, 4525, 4525, 4525, 4526, 4526, 
+    4529, 4530, 4530, 4532, 4533, 4533, 4535, 4536, 4538, 4538, 4539, 4540, 
+    4541, 4543, 4545, 4547, 4547, 4548, 4548, 4549, 4549, 4551, 4551, 4552, 
+    4552, 4553, 4554, 4554, 4557, 4558, 4558, 4558, 4560, 4563, 4564, 4566, 
+    4566, 4567, 4568, 4572, 4573, 4574, 4576, 4577, 4578, 4578, 4580, 4581, 
+    4581, 4582, 4582, 4585, 4585, 4585, 4586, 4587, 4589, 4589, 4589, 4590, 
+    4591, 4591, 4592, 4594, 4595, 4596, 4599, 4600, 4600, 4603, 4603, 4605, 
+    4606, 4606, 4606, 4608, 4610, 4611, 4611, 4611, 4614, 4614, 4615, 4615, 
+    4615, 4617, 4617, 4618, 4619, 4620, 4623, 4624, 4625, 4625, 4627, 4627, 
+    4628, 4630, 4631, 4632, 4633, 4634, 4634, 4635, 4637, 4638, 4639, 4640, 
+    4647, 4650, 4652, 4655, 4655, 4655, 4656, 4658, 4659, 4660, 4661, 4661, 
+    4662, 4664, 4665, 4666, 4667, 4668, 4668, 4670, 4671, 4672, 4673, 4673, 
+    4673, 4675, 4676, 4677, 4679, 4680, 4680, 4680, 4682, 4686, 4686, 4687, 
+    4688, 4689, 4689, 4689, 4690, 4692, 4693, 4693, 4696, 4697, 4697, 4698, 
+    4699, 4699, 4700, 4700, 4705, 4706, 4706, 4708, 4713, 4714, 4716, 4716, 
+    4718, 4720, 4722, 4722, 4723, 4724, 4725, 4725, 4726, 4729, 4730, 4730, 
+    4731, 4731, 4732, 4733, 4734, 4734, 4737, 4738, 4741, 4743, 4743, 4744, 
+    4745, 4746, 4746, 4746, 4748, 4748, 4748, 4750, 4750, 4750, 4750, 4752, 
+    4753, 4753, 4756, 4756, 4756, 4756, 4760, 4760, 4762, 4763, 4763, 4765, 
+    4767, 4768, 4769, 4770, 4771, 4772, 4774, 4774, 4775, 4777, 4778, 4779, 
+    4780, 4780, 4782, 4783, 4784, 4786, 4789, 4790, 4790, 4790, 4794, 4795, 
+    4795, 4795, 4795, 4796, 4797, 4798, 4798, 4799, 4804, 4804, 4805, 4806, 
+    4807, 4808, 4810, 4812, 4812, 4813, 4817, 4818, 4819, 4821, 4824, 4826, 
+    4829, 4829, 4833, 4833, 4833, 4836, 4836, 4838, 4838, 4839, 4839, 4839, 
+    4839, 4840, 4840, 4843, 4844, 4846, 4846, 4848, 4849, 4850, 4850, 4850, 
+    4850, 4853, 4855, 4856, 4856, 4859, 4859, 4860, 4862, 4864, 4865, 4866, 
+    4870, 4871, 4872, 4872, 4873, 4873, 4873, 4873, 4874, 4874, 4874, 4874, 
+    4875, 4877, 4877, 4877, 4878, 4878, 4879, 4880, 4881, 4882, 4882, 4883, 
+    4883, 4885, 4885, 4887, 4888, 4888, 4888, 4890, 4890, 4893, 4895, 4896, 
+    4899, 4900, 4904, 4904, 4904, 4905, 4906, 4911, 4915, 4916, 4919, 4919, 
+    4920, 4920, 4920, 4920, 4922, 4925, 4926, 4926, 4926, 4927, 4927, 4927, 
+    4928, 4928, 4929, 4930, 4931, 4932, 4936, 4936, 4936, 4939, 4939, 4941, 
+    4942, 4943, 4944, 4945, 4946, 4946, 4950, 4951, 4952, 4952, 4953, 4955, 
+    4956, 4956, 4958, 4958, 4960, 4961, 4961, 4962, 4964, 4967, 4969, 4969, 
+    4971, 4971, 4972, 4976, 4977, 4979, 4979, 4979, 4981, 4982, 4983, 4984, 
+    4984, 4984, 4984, 4984, 4986, 4989, 4991, 4994, 4995, 4996, 4997, 5002, 
+    5003, 5004, 5005, 5007, 5009, 5009, 5011, 5013, 5014, 5016, 5017, 5017, 
+    5019, 5020, 5021, 5022, 5025, 5026, 5031, 5033, 5033, 5033, 5034, 5037, 
+    5039, 5039, 5039, 5040, 5042, 5042, 5043, 5045, 5046, 5047, 5047, 5049, 
+    5052, 5053, 5054, 5055, 5055, 5057, 5058, 5061, 5063, 5065, 5066, 5066, 
+    5068, 5068, 5069, 5072, 5074, 5077, 5080, 5081, 5081, 5082, 5082, 5084, 
+    5085, 5085, 5086, 5087, 5088, 5090, 5090, 5091, 5091, 5092, 5092, 5093, 
+    5093, 5094, 5097, 5099, 5101, 5102, 5103, 5106, 5107, 5108, 5108, 5108, 
+    5108, 5110, 5111, 5111, 5113, 5114, 5115, 5116, 5119, 5122, 5123, 5127, 
+    5127, 5127, 5131, 5133, 5135, 5135, 5135, 5136, 5138, 5140, 5140, 5140, 
+    5142, 5144, 5147, 5149, 5149, 5150, 5150, 5150, 5152, 5152, 5152, 5153, 
+    5155, 5155, 5155, 5156, 5158, 5158, 5158, 5158, 5160, 5161, 5161, 5161, 
+    5162, 5164, 5167, 5169, 5170, 5171, 5171, 5171, 5171, 5173, 5176, 5178, 
+    5179, 5180, 5180, 5181, 5181, 5181, 5183, 5183, 5184, 5185, 5189, 5189, 
+    5190, 5190, 5192, 5194, 5196, 5197, 5199, 5201, 5203, 5205, 5206, 5206, 
+    5207, 5210, 5212, 5212, 5213, 5214, 5215, 5217, 5217, 5217, 5219, 5221, 
+    5222, 5222, 5225, 5227, 5228, 5228, 5228, 5230, 5232, 5233, 5235, 5235, 
+    5237, 5239, 5240, 5240, 5240, 5240, 5242, 5242, 5242, 5245, 5245, 5248, 
+    5248, 5251, 5253, 5256, 5257, 5257, 5260, 5261, 5262, 5263, 5263, 5267, 
+    5268, 5268, 5272, 5272, 5272, 5274, 5274, 5276, 5279, 5279, 5282, 5282, 
+    5282, 5284, 5287, 5288, 5290, 5291, 5293, 5293, 5295, 5297, 5297, 5299, 
+    5299, 5301, 5301, 5301, 5302, 5303, 5304, 5305, 5307, 5308, 5308, 5309, 
+    5310, 5311, 5312, 5315, 5316, 5316, 5317, 5319, 5320, 5321, 5321, 5321, 
+    5321, 5321, 5324, 5325, 5327, 5328, 5328, 5329, 5331, 5334, 5335, 5336, 
+    5337, 5339, 5342, 5342, 5342, 5342, 5344, 5344, 5347, 5348, 5349, 5349, 
+    5349, 5351, 5354, 5357, 5359, 5359, 5361, 5363, 5366, 5367, 5368, 5368, 
+    5370, 5371, 5373, 5377, 5378, 5379, 5379, 5379, 5380, 5381, 5382, 5384, 
+    5385, 5385, 5387, 5388, 5388, 5389, 5390, 5393, 5395, 5398, 5398, 5398, 
+    5399, 5401, 5402, 5404, 5405, 5406, 5408, 5411, 5411, 5411, 5412, 5413, 
+    5416, 5417, 5418, 5419, 5419, 5421, 5421, 5423, 5423, 5423, 5424, 5424, 
+    5424, 5424, 5425, 5428, 5429, 5430, 5430, 5431, 5431, 5432, 5433, 5437, 
+    5440, 5441, 5441, 5441, 5441, 5441, 5442, 5443, 5444, 5445, 5446, 5448, 
+    5448, 5449, 5450, 5451, 5451, 5452, 5452, 5452, 5453, 5457, 5457, 5457, 
+    5461, 5462, 5462, 5463, 5465, 5466, 5468, 5468, 5469, 5471, 5476, 5476, 
+    5477, 5477, 5477, 5479, 5479, 5480, 5480, 5482, 5482, 5482, 5486, 5487, 
+    5493, 5495, 5496, 5496, 5496, 5497, 5499, 5499, 5501, 5501, 5503, 5503, 
+    5504, 5504, 5504, 5506, 5508, 5508, 5508, 5509, 5513, 5513, 5514, 5514, 
+    5514, 5517, 5518, 5519, 5521, 5524, 5526, 5526, 5526, 5528, 5528, 5529, 
+    5530, 5530, 5531, 5531, 5531, 5534, 5536, 5537, 5538, 5539, 5540, 5540, 
+    5540, 5541, 5542, 5543, 5543, 5547, 5548, 5549, 5550, 5551, 5551, 5551, 
+    5554, 5557, 5557, 5561, 5562, 5563, 5565, 5568, 5569, 5569, 5569, 5574, 
+    5576, 5580, 5581, 5581, 5581, 5581, 5583, 5584, 5584, 5585, 5586, 5587, 
+    5587, 5588, 5588, 5589, 5592, 5592, 5593, 5596, 5597, 5600, 5600, 5603, 
+    5605, 5606, 5607, 5608, 5610, 5611, 5612, 5612, 5612, 5613, 5615, 5615, 
+    5617, 5620, 5620, 5621, 5623, 5624, 5625, 5626, 5629, 5630, 5631, 5632, 
+    5632, 5633, 5633, 5634, 5635, 5636, 5641, 5643, 5643, 5643, 5644, 5645, 
+    5648, 5648, 5648, 5649, 5649, 5652, 5652, 5653, 5653, 5654, 5655, 5656, 
+    5656, 5656, 5659, 5661, 5662, 5663, 5664, 5664, 5664, 5665, 5665, 5666, 
+    5666, 5667, 5671, 5671, 5674, 5675, 5677, 5678, 5679, 5680, 5683, 5685, 
+    5686, 5688, 5688, 5690, 5692, 5693, 5694, 5695, 5695, 5697, 5700, 5700, 
+    5702, 5702, 5703, 5707, 5707, 5708, 5708, 5708, 5711, 5711, 5713, 5714, 
+    5715, 5716, 5717, 5719, 5720, 5720, 5723, 5724, 5724, 5726, 5728, 5728, 
+    5732, 5734, 5734, 5737, 5737, 5737, 5739, 5740, 5741, 5745, 5746, 5746, 
+    5747, 5748, 5748, 5749, 5751, 5751, 5751, 5752, 5753, 5755, 5756, 5756, 
+    5757, 5757, 5759, 5760, 5760, 5762, 5763, 5764, 5767, 5768, 5769, 5769, 
+    5770, 5772, 5775, 5776, 5776, 5777, 5779, 5782, 5784, 5784, 5786, 5786, 
+    5787, 5790, 5792, 5793, 5793, 5794, 5795, 5795, 5796, 5798, 5800, 5800, 
+    5801, 5801, 5804, 5805, 5805, 5807, 5807, 5811, 5814, 5815, 5815, 5819, 
+    5820, 5821, 5822, 5823, 5823, 5823, 5824, 5824, 5825, 5826, 5827, 5828, 
+    5832, 5832, 5832, 5835, 5836, 5838, 5839, 5844, 5845, 5845, 5847, 5847, 
+    5847, 5848, 5849, 5851, 5851, 5854, 5855, 5857, 5860, 5860, 5860, 5861, 
+    5863, 5865, 5866, 5866, 5867, 5868, 5870, 5871, 5872, 5874, 5874, 5875, 
+    5876, 5878, 5878, 5879, 5883, 5883, 5883, 5883, 5883, 5883, 5884, 5887, 
+    5887, 5889, 5889, 5889, 5890, 5891, 5894, 5896, 5896, 5897, 5898, 5899, 
+    5900, 5902, 5903, 5906, 5907, 5907, 5907, 5908, 5910, 5911, 5911, 5914, 
+    5915, 5916, 5916, 5916, 5918, 5919, 5920, 5920, 5921, 5922, 5923, 5925, 
+    5926, 5926, 5929, 5931, 5934, 5937, 5939, 5939, 5939, 5940, 5941, 5944, 
+    5946, 5946, 5949, 5950, 5950, 5953, 5953, 5955, 5958, 5959, 5959, 5961, 
+    5963, 5963, 5964, 5966, 5968, 5968, 5970, 5970, 5973, 5973, 5974, 5975, 
+    5976, 5981, 5982, 5984, 5984, 5988, 5992, 5993, 5994, 5996, 5997, 5997, 
+    5999, 6000, 6001, 6002, 6004, 6004, 6004, 6004, 6005, 6006, 6007, 6008, 
+    6009, 6011, 6011, 6011, 6012, 6015, 6016, 6018, 6019, 6020, 6023, 6026, 
+    6026, 6028, 6029, 6030, 6033, 6034, 6034, 6035, 6035, 6039, 6043, 6043, 
+    6043, 6043, 6044, 6046, 6048, 6048, 6052, 6054, 6054, 6054, 6056, 6056, 
+    6057, 6058, 6059, 6062, 6062, 6063, 6065, 6065, 6068, 6068, 6068, 6068, 
+    6070, 6071, 6072, 6073, 6074, 6074, 6074, 6075, 6075, 6075, 6075, 6076, 
+    6078, 6078, 6078, 6078, 6078, 6079, 6081, 6081, 6082, 6084, 6084, 6084, 
+    6085, 6085, 6085, 6088, 6090, 6092, 6092, 6094, 6095, 6095, 6097, 6097, 
+    6100, 6101, 6102, 6104, 6105, 6108, 6109, 6111, 6113, 6115, 6116, 6116, 
+    6117, 6119, 6120, 6122, 6122, 6122, 6122, 6124, 6124, 6124, 6127, 6132, 
+    6134, 6137, 6137, 6137, 6138, 6140, 6141, 6145, 6146, 6148, 6148, 6150, 
+    6151, 6153, 6158, 6158, 6159, 6160, 6162, 6163, 6164, 6167, 6169, 6169, 
+    6171, 6173, 6175, 6177, 6177, 6179, 6180, 6181, 6181, 6181, 6182, 6183, 
+    6185, 6185, 6186, 6186, 6186, 6186, 6187, 6188, 6189, 6189, 6189, 6190, 
+    6190, 6193, 6193, 6193, 6195, 6197, 6198, 6200, 6201, 6201, 6202, 6203, 
+    6204, 6204, 6204, 6205, 6206, 6207, 6208, 6209, 6210, 6213, 6214, 6214, 
+    6214, 6215, 6217, 6217, 6217, 6218, 6220, 6223, 6223, 6224, 6227, 6227, 
+    6230, 6230, 6231, 6231, 6231, 6233, 6234, 6236, 6238, 6239, 6243, 6244, 
+    6247, 6249, 6249, 6250, 6250, 6251, 6252, 6252, 6254, 6254, 6258, 6259, 
+    6263, 6263, 6263, 6264, 6264, 6267, 6269, 6269, 6270, 6270, 6271, 6274, 
+    6274, 6274, 6278, 6280, 6280, 6282, 6284, 6287, 6288, 6289, 6291, 6293, 
+    6295, 6295, 6296, 6298, 6300, 6301, 6302, 6302, 6302, 6303, 6304, 6304, 
+    6304, 6305, 6306, 6306, 6307, 6308, 6309, 6313, 6314, 6315, 6318, 6321, 
+    6322, 6323, 6326, 6329, 6329, 6332, 6335, 6337, 6339, 6341, 6341, 6341, 
+    6343, 6345, 6346, 6347, 6347, 6350, 6351, 6353, 6357, 6359, 6360, 6361, 
+    6362, 6362, 6362, 6362, 6364, 6364, 6365, 6366, 6369, 6369, 6369, 6371, 
+    6371, 6371, 6374, 6374, 6377, 6378, 6380, 6383, 6383, 6385, 6387, 6388, 
+    6390, 6391, 6392, 6392, 6393, 6394, 6396, 6398, 6399, 6400, 6402, 6402, 
+    6403, 6404, 6405, 6406, 6408, 6409, 6410, 6413, 6415, 6417, 6417, 6419, 
+    6419, 6420, 6421, 6422, 6422, 6423, 6424, 6427, 6429, 6430, 6431, 6431, 
+    6434, 6437, 6438, 6438, 6441, 6442, 6444, 6445, 6448, 6448, 6449, 6453, 
+    6454, 6455, 6458, 6458, 6458, 6460, 6461, 6462, 6464, 6468, 6468, 6469, 
+    6469, 6470, 6473, 6474, 6476, 6477, 6477, 6478, 6481, 6481, 6483, 6485, 
+    6488, 6493, 6494, 6494, 6495, 6495, 6496, 6498, 6500, 6500, 6502, 6503, 
+    6504, 6505, 6506, 6507, 6507, 6509, 6510, 6510, 6510, 6511, 6513, 6514, 
+    6515, 6519, 6519, 6520, 6524, 6524, 6524, 6526, 6527, 6528, 6528, 6532, 
+    6532, 6537, 6541, 6541, 6542, 6545, 6546, 6546, 6547, 6549, 6549, 6550, 
+    6550, 6551, 6551, 6555, 6556, 6557, 6559, 6559, 6561, 6564, 6565, 6565, 
+    6565, 6566, 6567, 6567, 6567, 6569, 6571, 6572, 6573, 6574, 6577, 6580, 
+    6581, 6582, 6583, 6584, 6586, 6587, 6589, 6590, 6591, 6591, 6591, 6592, 
+    6594, 6595, 6596, 6597, 6598, 6598, 6598, 6598, 6598, 6601, 6601, 6601, 
+    6601, 6604, 6605, 6607, 6607, 6609, 6609, 6611, 6612, 6614, 6615, 6617, 
+    6617, 6617, 6618, 6620, 6620, 6623, 6623, 6626, 6626, 6629, 6630, 6630, 
+    6630, 6630, 6632, 6632, 6632, 6634, 6638, 6639, 6641, 6641, 6643, 6643, 
+    6643, 6644, 6644, 6644, 6644, 6647, 6651, 6653, 6653, 6655, 6656, 6656, 
+    6657, 6658, 6658, 6659, 6659, 6660, 6660, 6663, 6663, 6664, 6665, 6666, 
+    6666, 6671, 6671, 6671, 6672, 6673, 6673, 6674, 6675, 6676, 6677, 6679, 
+    6681, 6681, 6682, 6684, 6686, 6688, 6690, 6691, 6694, 6695, 6696, 6697, 
+    6698, 6699, 6699, 6699, 6699, 6699, 6702, 6703, 6704, 6704, 6706, 6707, 
+    6710, 6712, 6712, 6713, 6714, 6714, 6715, 6716, 6716, 6717, 6717, 6717, 
+    6718, 6719, 6720, 6721, 6722, 6723, 6723, 6724, 6726, 6726, 6727, 6727, 
+    6728, 6728, 6728, 6728, 6728, 6732, 6733, 6734, 6737, 6742, 6742, 6743, 
+    6744, 6745, 6748, 6750, 6751, 6752, 6753, 6755, 6755, 6756, 6757, 6760, 
+    6762, 6764, 6764, 6768, 6769, 6771, 6772, 6774, 6779, 6779, 6779, 6782, 
+    6782, 6784, 6785, 6787, 6788, 6789, 6790, 6792, 6794, 6794, 6795, 6800, 
+    6801, 6802, 6805, 6805, 6808, 6808, 6809, 6810, 6811, 6814, 6814, 6814, 
+    6815, 6818, 6820, 6821, 6821, 6823, 6823, 6823, 6823, 6825, 6825, 6825, 
+    6825, 6827, 6827, 6828, 6830, 6833, 6837, 6839, 6839, 6841, 6842, 6843, 
+    6846, 6849, 6849, 6850, 6850, 6851, 6852, 6854, 6856, 6858, 6860, 6861, 
+    6864, 6865, 6865, 6866, 6867, 6868, 6869, 6869, 6871, 6872, 6874, 6875, 
+    6875, 6876, 6878, 6879, 6882, 6884, 6885, 6885, 6888, 6888, 6889, 6889, 
+    6890, 6891, 6892, 6893, 6898, 6900, 6901, 6903, 6905, 6908, 6910, 6910, 
+    6911, 6911, 6914, 6915, 6918, 6919, 6921, 6921, 6923, 6929, 6929, 6929, 
+    6931, 6931, 6931, 6933, 6934, 6934, 6937, 6940, 6941, 6942, 6944, 6945, 
+    6946, 6947, 6948, 6950, 6952, 6953, 6954, 6955, 6958, 6959, 6959, 6960, 
+    6961, 6961, 6961, 6962, 6964, 6964, 6965, 6965, 6965, 6966, 6967, 6968, 
+    6969, 6970, 6971, 6974, 6975, 6977, 6978, 6979, 6980, 6981, 6981, 6981, 
+    6983, 6985, 6986, 6986, 6987, 6988, 6991, 6992, 6993, 6996, 6997, 6998, 
+    6998, 7002, 7002, 7003, 7004, 7004, 7006, 7007, 7009, 7009, 7011, 7011, 
+    7013, 7013, 7014, 7015, 7015, 7017, 7018, 7018, 7021, 7024, 7024, 7024, 
+    7027, 7028, 7029, 7030, 7032, 7034, 7035, 7035, 7035, 7035, 7035, 7035, 
+    7035, 7037, 7039, 7041, 7045, 7047, 7048, 7049, 7050, 7051, 7052, 7053, 
+    7054, 7055, 7055, 7057, 7060, 7061, 7061, 7062, 7062, 7063, 7065, 7065, 
+    7065, 7069, 7074, 7075, 7076, 7078, 7081, 7084, 7086, 7087, 7087, 7090, 
+    7093, 7094, 7096, 7097, 7097, 7099, 7100, 7100, 7103, 7104, 7105, 7106, 
+    7106, 7107, 7111, 7112, 7115, 7117, 7118, 7118, 7121, 7124, 7124, 7127, 
+    7127, 7129, 7131, 7131, 7133, 7135, 7135, 7137, 7137, 7137, 7140, 7142, 
+    7144, 7144, 7146, 7146, 7148, 7151, 7152, 7152, 7154, 7156, 7158, 7158, 
+    7159, 7161, 7163, 7166, 7168, 7172, 7172, 7174, 7174, 7176, 7176, 7177, 
+    7178, 7178, 7180, 7180, 7181, 7183, 7183, 7183, 7183, 7184, 7186, 7186, 
+    7186, 7188, 7191, 7194, 7197, 7197, 7199, 7200, 7201, 7204, 7204, 7205, 
+    7205, 7207, 7207, 7207, 7208, 7210, 7210, 7211, 7211, 7211, 7215, 7218, 
+    7220, 7220, 7221, 7222, 7222, 7223, 7224, 7227, 7229, 7231, 7232, 7233, 
+    7234, 7238, 7240, 7241, 7242, 7245, 7248, 7250, 7250, 7250, 7251, 7252, 
+    7253, 7255, 7258, 7260, 7262, 7262, 7263, 7263, 7267, 7267, 7268, 7269, 
+    7270, 7273, 7274, 7277, 7277, 7278, 7280, 7280, 7280, 7282, 7284, 7285, 
+    7287, 7288, 7289, 7291, 7292, 7293, 7294, 7295, 7297, 7297, 7297, 7298, 
+    7300, 7300, 7300, 7303, 7305, 7305, 7305, 7306, 7308, 7309, 7310, 7310, 
+    7310, 7311, 7311, 7311, 7311, 7314, 7314, 7314, 7316, 7316, 7316, 7316, 
+    7316, 7318, 7318, 7319, 7319, 7320, 7324, 7327, 7327, 7329, 7329, 7331, 
+    7331, 7331, 7331, 7335, 7336, 7336, 7337, 7338, 7339, 7342, 7342, 7345, 
+    7346, 7347, 7350, 7350, 7352, 7352, 7354, 7354, 7355, 7358, 7359, 7360, 
+    7363, 7365, 7367, 7368, 7369, 7371, 7372, 7372, 7374, 7377, 7378, 7378, 
+    7379, 7382, 7383, 7383, 7385, 7386, 7387, 7388, 7389, 7390, 7390, 7390, 
+    7392, 7392, 7392, 7393, 7395, 7398, 7400, 7400, 7401, 7402, 7402, 7405, 
+    7405, 7406, 7408, 7409, 7409, 7410, 7410, 7413, 7414, 7417, 7417, 7418, 
+    7420, 7421, 7422, 7422, 7423, 7425, 7426, 7426, 7426, 7429, 7429, 7429, 
+    7430, 7432, 7434, 7434, 7435, 7436, 7439, 7442, 7442, 7447, 7449, 7449, 
+    7450, 7451, 7451, 7452, 7453, 7454, 7455, 7456, 7457, 7458, 7458, 7461, 
+    7464, 7466, 7466, 7468, 7472, 7472, 7474, 7475, 7477, 7477, 7479, 7479, 
+    7481, 7485, 7486, 7488, 7491, 7491, 7493, 7493, 7493, 7496, 7496, 7496, 
+    7497, 7497, 7497, 7497, 7497, 7497, 7498, 7500, 7500, 7500, 7501, 7501, 
+    7503, 7504, 7504, 7505, 7509, 7511, 7513, 7516, 7517, 7519, 7523, 7524, 
+    7525, 7525, 7525, 7525, 7527, 7527, 7531, 7532, 7534, 7534, 7535, 7539, 
+    7543, 7545, 7545, 7546, 7549, 7549, 7551, 7551, 7552, 7554, 7554, 7555, 
+    7557, 7560, 7561, 7563, 7563, 7564, 7565, 7566, 7567, 7569, 7569, 7569, 
+    7570, 7571, 7571, 7571, 7572, 7577, 7577, 7578, 7580, 7581, 7582, 7582, 
+    7583, 7584, 7585, 7587, 7587, 7589, 7590, 7590, 7590, 7594, 7597, 7597, 
+    7601, 7602, 7603, 7605, 7605, 7608, 7608, 7609, 7612, 7612, 7612, 7614, 
+    7615, 7619, 7619, 7621, 7623, 7624, 7626, 7626, 7630, 7630, 7632, 7634, 
+    7634, 7634, 7637, 7638, 7641, 7644, 7648, 7649, 7649, 7651, 7652, 7653, 
+    7656, 7657, 7658, 7659, 7659, 7662, 7664, 7668, 7669, 7669, 7669, 7669, 
+    7671, 7671, 7674, 7678, 7679, 7680, 7680, 7683, 7685, 7687, 7687, 7687, 
+    7688, 7689, 7689, 7691, 7691, 7692, 7696, 7697, 7700, 7701, 7702, 7702, 
+    7703, 7704, 7706, 7707, 7708, 7709, 7710, 7711, 7714, 7715, 7716, 7718, 
+    7719, 7723, 7724, 7724, 7728, 7728, 7730, 7731, 7731, 7732, 7733, 7737, 
+    7738, 7740, 7741, 7742, 7742, 7744, 7744, 7747, 7747, 7748, 7748, 7751, 
+    7751, 7751, 7752, 7754, 7754, 7754, 7754, 7756, 7760, 7763, 7765, 7766, 
+    7766, 7769, 7770, 7772, 7773, 7773, 7774, 7774, 7774, 7776, 7777, 7779, 
+    7780, 7782, 7783, 7783, 7784, 7785, 7787, 7789, 7791, 7793, 7795, 7796, 
+    7797, 7798, 7798, 7800, 7800, 7800, 7801, 7802, 7804, 7804, 7806, 7806, 
+    7806, 7808, 7811, 7812, 7812, 7814, 7818, 7819, 7819, 7820, 7821, 7821, 
+    7823, 7824, 7824, 7824, 7825, 7825, 7826, 7827, 7830, 7832, 7834, 7835, 
+    7836, 7840, 7842, 7844, 7844, 7845, 7846, 7846, 7847, 7847, 7847, 7849, 
+    7853, 7855, 7855, 7855, 7857, 7857, 7859, 7860, 7865, 7866, 7867, 7869, 
+    7869, 7870, 7870, 7872, 7874, 7874, 7877, 7879, 7880, 7882, 7885, 7887, 
+    7888, 7891, 7892, 7893, 7893, 7893, 7896, 7900, 7900, 7905, 7908, 7908, 
+    7909, 7910, 7912, 7912, 7914, 7914, 7915, 7916, 7920, 7921, 7924, 7924, 
+    7927, 7929, 7929, 7930, 7932, 7933, 7933, 7935, 7935, 7935, 7936, 7939, 
+    7941, 7943, 7943, 7943, 7944, 7944, 7946, 7947, 7948, 7950, 7952, 7953, 
+    7953, 7953, 7956, 7956, 7958, 7958, 7961, 7961, 7962, 7962, 7962, 7963, 
+    7964, 7964, 7965, 7966, 7968, 7968, 7969, 7971, 7971, 7972, 7974, 7974, 
+    7976, 7977, 7977, 7979, 7981, 7982, 7982, 7983, 7985, 7988, 7988, 7989, 
+    7991, 7992, 7994, 7996, 7997, 7997, 7998, 7998, 7998, 7998, 7998, 8000, 
+    8002, 8003, 8006, 8007, 8010, 8011, 8011, 8013, 8014, 8016, 8016, 8017, 
+    8018, 8019, 8021, 8021, 8023, 8023, 8024, 8026, 8028, 8030, 8032, 8033, 
+    8033, 8035, 8037, 8037, 8039, 8039, 8039, 8040, 8041, 8044, 8048, 8051, 
+    8053, 8055, 8055, 8056, 8057, 8061, 8061, 8063, 8064, 8065, 8069, 8070, 
+    8070, 8071, 8072, 8073, 8074, 8075, 8078, 8081, 8083, 8084, 8085, 8086, 
+    8086, 8088, 8090, 8090, 8090, 8093, 8094, 8095, 8095, 8096, 8099, 8101, 
+    8103, 8106, 8106, 8107, 8107, 8107, 8110, 8112, 8114, 8117, 8118, 8121, 
+    8125, 8126, 8127, 8131, 8132, 8132, 8134, 8134, 8134, 8137, 8139, 8140, 
+    8141, 8142, 8143, 8144, 8146, 8146, 8146, 8147, 8147, 8147, 8148, 8148, 
+    8149, 8150, 8154, 8157, 8158, 8158, 8160, 8160, 8162, 8163, 8164, 8165, 
+    8166, 8166, 8167, 8169, 8171, 8173, 8175, 8175, 8176, 8179, 8179, 8181, 
+    8185, 8187, 8187, 8188, 8189, 8190, 8192, 8195, 8196, 8197, 8197, 8197, 
+    8198, 8201, 8202, 8204, 8206, 8209, 8209, 8210, 8210, 8210, 8213, 8213, 
+    8214, 8214, 8217, 8219, 8220, 8221, 8221, 8224, 8224, 8227, 8230, 8232, 
+    8235, 8235, 8236, 8236, 8239, 8241, 8242, 8245, 8245, 8247, 8249, 8251, 
+    8252, 8254, 8255, 8257, 8257, 8258, 8259, 8260, 8260, 8263, 8263, 8268, 
+    8269, 8270, 8270, 8270, 8272, 8275, 8275, 8276, 8277, 8280, 8281, 8281, 
+    8281, 8282, 8284, 8285, 8285, 8288, 8290, 8291, 8292, 8292, 8293, 8296, 
+    8297, 8299, 8299, 8301, 8301, 8301, 8304, 8306, 8306, 8307, 8310, 8310, 
+    8313, 8314, 8314, 8314, 8315, 8317, 8318, 8319, 8320, 8320, 8320, 8320, 
+    8320, 8320, 8324, 8326, 8328, 8330, 8331, 8332, 8334, 8335, 8336, 8336, 
+    8337, 8337, 8337, 8339, 8340, 8341, 8341, 8343, 8344, 8344, 8344, 8345, 
+    8345, 8345, 8346, 8348, 8349, 8351, 8353, 8354, 8356, 8356, 8357, 8357, 
+    8357, 8358, 8360, 8361, 8361, 8364, 8366, 8370, 8370, 8372, 8374, 8374, 
+    8376, 8378, 8378, 8378, 8384, 8384, 8384, 8385, 8386, 8386, 8386, 8387, 
+    8388, 8389, 8391, 8393, 8398, 8399, 8402, 8402, 8403, 8403, 8403, 8404, 
+    8404, 8405, 8406, 8406, 8407, 8408, 8409, 8411, 8413, 8414, 8416, 8417, 
+    8419, 8422, 8425, 8425, 8429, 8431, 8431, 8431, 8434, 8434, 8434, 8437, 
+    8437, 8438, 8440, 8442, 8443, 8443, 8445, 8446, 8448, 8449, 8451, 8452, 
+    8453, 8453, 8454, 8455, 8455, 8455, 8457, 8457, 8457, 8459, 8459, 8459, 
+    8462, 8463, 8463, 8463, 8463, 8464, 8465, 8467, 8467, 8468, 8469, 8469, 
+    8470, 8470, 8470, 8471, 8472, 8472, 8472, 8474, 8474, 8475, 8476, 8476, 
+    8477, 8479, 8481, 8481, 8481, 8485, 8485, 8487, 8489, 8490, 8491, 8494, 
+    8495, 8498, 8499, 8501, 8503, 8503, 8506, 8506, 8507, 8507, 8507, 8507, 
+    8508, 8510, 8512, 8513, 8514, 8514, 8516, 8518, 8518, 8521, 8524, 8526, 
+    8528, 8528, 8533, 8535, 8538, 8539, 8542, 8543, 8545, 8547, 8548, 8549, 
+    8549, 8551, 8553, 8554, 8556, 8558, 8559, 8564, 8564, 8564, 8565, 8565, 
+    8569, 8572, 8573, 8578, 8579, 8579, 8580, 8581, 8582, 8583, 8583, 8583, 
+    8583, 8583, 8583, 8584, 8585, 8587, 8590, 8590, 8591, 8592, 8593, 8593, 
+    8594, 8597, 8597, 8597, 8600, 8603, 8603, 8605, 8607, 8609, 8609, 8609, 
+    8610, 8612, 8614, 8615, 8615, 8617, 8617, 8620, 8623, 8624, 8627, 8628, 
+    8629, 8629, 8630, 8631, 8632, 8634, 8634, 8636, 8637, 8637, 8639, 8639, 
+    8639, 8640, 8642, 8645, 8647, 8648, 8649, 8650, 8650, 8652, 8653, 8657, 
+    8660, 8662, 8663, 8663, 8664, 8664, 8664, 8665, 8665, 8668, 8668, 8670, 
+    8671, 8672, 8672, 8673, 8674, 8674, 8676, 8676, 8676, 8676, 8677, 8677, 
+    8679, 8680, 8680, 8681, 8682, 8685, 8686, 8687, 8688, 8692, 8693, 8693, 
+    8695, 8695, 8697, 8698, 8698, 8699, 8699, 8699, 8701, 8702, 8705, 8705, 
+    8709, 8711, 8711, 8713, 8716, 8719, 8721, 8721, 8723, 8723, 8726, 8727, 
+    8729, 8730, 8734, 8737, 8740, 8740, 8742, 8743, 8744, 8745, 8750, 8752, 
+    8752, 8752, 8755, 8758, 8761, 8762, 8763, 8765, 8767, 8768, 8768, 8769, 
+    8769, 8771, 8771, 8772, 8773, 8774, 8775, 8776, 8776, 8777, 8779, 8782, 
+    8785, 8787, 8789, 8789, 8791, 8794, 8794, 8794, 8795, 8795, 8798, 8800, 
+    8801, 8802, 8802, 8802, 8802, 8803, 8803, 8805, 8805, 8807, 8808, 8811, 
+    8814, 8814, 8814, 8814, 8815, 8815, 8816, 8817, 8819, 8820, 8821, 8822, 
+    8823, 8823, 8823, 8827, 8828, 8828, 8830, 8831, 8832, 8833, 8835, 8836, 
+    8839, 8841, 8841, 8842, 8844, 8844, 8845, 8847, 8850, 8851, 8854, 8855, 
+    8857, 8857, 8858, 8859, 8861, 8862, 8863, 8865, 8867, 8870, 8871, 8871, 
+    8871, 8873, 8875, 8876, 8876, 8877, 8877, 8881, 8882, 8882, 8883, 8885, 
+    8886, 8888, 8888, 8891, 8891, 8893, 8894, 8895, 8898, 8898, 8900, 8903, 
+    8904, 8907, 8907, 8908, 8908, 8909, 8910, 8911, 8913, 8915, 8917, 8917, 
+    8917, 8917, 8919, 8920, 8923, 8926, 8927, 8929, 8929, 8934, 8934, 8936, 
+    8936, 8938, 8939, 8941, 8943, 8943, 8944, 8947, 8951, 8951, 8953, 8953, 
+    8953, 8955, 8956, 8957, 8959, 8961, 8964, 8967, 8969, 8970, 8970, 8971, 
+    8971, 8971, 8971, 8971, 8971, 8972, 8972, 8972, 8973, 8977, 8978, 8980, 
+    8981, 8983, 8985, 8985, 8986, 8988, 8988, 8990, 8992, 8992, 8993, 8994, 
+    8996, 8996, 8997, 8997, 8998, 8999, 9001, 9004, 9004, 9004, 9006, 9007, 
+    9008, 9008, 9011, 9014, 9014, 9014, 9018, 9021, 9022, 9025, 9025, 9025, 
+    9028, 9028, 9029, 9029, 9029, 9033, 9035, 9037, 9041, 9042, 9046, 9046, 
+    9051, 9052, 9054, 9055, 9058, 9061, 9063, 9064, 9066, 9066, 9069, 9073, 
+    9074, 9074, 9079, 9080, 9080, 9082, 9082, 9083, 9083, 9083, 9083, 9085, 
+    9086, 9087, 9088, 9088, 9091, 9093, 9093, 9093, 9094, 9097, 9100, 9101, 
+    9101, 9102, 9102, 9105, 9106, 9110, 9111, 9114, 9115, 9116, 9120, 9121, 
+    9127, 9128, 9130, 9131, 9136, 9138, 9139, 9141, 9142, 9143, 9143, 9143, 
+    9144, 9145, 9145, 9145, 9146, 9150, 9150, 9151, 9153, 9153, 9153, 9154, 
+    9155, 9155, 9158, 9160, 9161, 9162, 9163, 9164, 9165, 9167, 9167, 9168, 
+    9169, 9170, 9174, 9174, 9176, 9177, 9178, 9178, 9178, 9180, 9181, 9183, 
+    9184, 9184, 9187, 9187, 9191, 9193, 9194, 9195, 9195, 9196, 9196, 9198, 
+    9200, 9202, 9203, 9204, 9206, 9210, 9212, 9217, 9217, 9217, 9218, 9222, 
+    9223, 9224, 9224, 9226, 9228, 9229, 9232, 9232, 9233, 9234, 9234, 9234, 
+    9235, 9238, 9242, 9243, 9246, 9247, 9250, 9251, 9252, 9254, 9255, 9255, 
+    9256, 9259, 9260, 9261, 9263, 9264, 9268, 9268, 9269, 9269, 9270, 9274, 
+    9276, 9278, 9280, 9281, 9283, 9284, 9284, 9286, 9287, 9289, 9291, 9292, 
+    9293, 9295, 9297, 9299, 9299, 9299, 9301, 9302, 9305, 9306, 9306, 9307, 
+    9308, 9310, 9310, 9312, 9312, 9314, 9315, 9316, 9318, 9319, 9323, 9325, 
+    9325, 9325, 9327, 9327, 9328, 9331, 9331, 9334, 9339, 9339, 9340, 9343, 
+    9345, 9345, 9346, 9349, 9350, 9350, 9350, 9352, 9352, 9355, 9356, 9357, 
+    9359, 9361, 9364, 9364, 9366, 9367, 9368, 9370, 9371, 9371, 9371, 9373, 
+    9374, 9375, 9376, 9377, 9377, 9378, 9379, 9380, 9382, 9383, 9384, 9385, 
+    9387, 9388, 9390, 9391, 9391, 9394, 9395, 9396, 9397, 9398, 9399, 9399, 
+    9401, 9402, 9402, 9403, 9405, 9406, 9409, 9410, 9411, 9413, 9415, 9420, 
+    9420, 9424, 9425, 9426, 9426, 9427, 9429, 9430, 9431, 9432, 9432, 9433, 
+    9434, 9435, 9437, 9440, 9441, 9441, 9441, 9445, 9445, 9445, 9446, 9448, 
+    9450, 9452, 9452, 9453, 9454, 9455, 9457, 9458, 9459, 9460, 9461, 9463, 
+    9463, 9467, 9468, 9469, 9470, 9472, 9473, 9474, 9474, 9476, 9480, 9482, 
+    9483, 9485, 9486, 9486, 9487, 9488, 9490, 9490, 9491, 9492, 9493, 9494, 
+    9494, 9495, 9496, 9498, 9499, 9502, 9503, 9504, 9504, 9506, 9508, 9511, 
+    9516, 9516, 9517, 9521, 9524, 9528, 9528, 9529, 9531, 9532, 9534, 9535, 
+    9537, 9538, 9539, 9540, 9541, 9542, 9543, 9544, 9547, 9548, 9551, 9552, 
+    9553, 9555, 9555, 9558, 9559, 9559, 9559, 9559, 9560, 9562, 9564, 9564, 
+    9566, 9566, 9566, 9570, 9570, 9570, 9572, 9574, 9574, 9575, 9575, 9575, 
+    9579, 9581, 9582, 9583, 9583, 9584, 9584, 9584, 9584, 9589, 9590, 9590, 
+    9591, 9592, 9595, 9597, 9599, 9599, 9600, 9602, 9604, 9604, 9606, 9606, 
+    9610, 9612, 9616, 9619, 9620, 9620, 9621, 9622, 9622, 9624, 9628, 9628, 
+    9629, 9630, 9631, 9633, 9636, 9639, 9640, 9641, 9642, 9645, 9646, 9646, 
+    9648, 9651, 9651, 9653, 9655, 9657, 9659, 9660, 9661, 9663, 9664, 9664, 
+    9665, 9666, 9667, 9668, 9669, 9669, 9673, 9674, 9675, 9675, 9677, 9678, 
+    9679, 9679, 9681, 9681, 9682, 9684, 9686, 9688, 9689, 9691, 9691, 9691, 
+    9691, 9694, 9694, 9696, 9696, 9697, 9697, 9698, 9698, 9698, 9700, 9702, 
+    9703, 9703, 9705, 9707, 9708, 9708, 9713, 9717, 9719, 9719, 9719, 9719, 
+    9722, 9723, 9725, 9728, 9728, 9728, 9729, 9731, 9734, 9735, 9735, 9737, 
+    9738, 9739, 9741, 9741, 9742, 9742, 9744, 9746, 9747, 9747, 9749, 9751, 
+    9753, 9753, 9754, 9755, 9756, 9757, 9758, 9761, 9761, 9764, 9770, 9770, 
+    9771, 9773, 9774, 9777, 9777, 9779, 9780, 9782, 9782, 9787, 9790, 9790, 
+    9791, 9792, 9794, 9797, 9799, 9804, 9804, 9804, 9808, 9810, 9812, 9813, 
+    9813, 9815, 9817, 9817, 9818, 9820, 9820, 9822, 9822, 9823, 9824, 9828, 
+    9830, 9831, 9832, 9832, 9832, 9836, 9838, 9843, 9843, 9845, 9845, 9846, 
+    9849, 9849, 9849, 9849, 9849, 9850, 9850, 9853, 9853, 9854, 9855, 9855, 
+    9855, 9859, 9860, 9862, 9864, 9868, 9871, 9872, 9872, 9872, 9872, 9874, 
+    9875, 9877, 9877, 9879, 9881, 9881, 9887, 9887, 9887, 9889, 9892, 9894, 
+    9895, 9896, 9899, 9900, 9901, 9901, 9903, 9904, 9905, 9906, 9907, 9907, 
+    9909, 9909, 9912, 9912, 9915, 9916, 9921, 9922, 9923, 9925, 9927, 9931, 
+    9931, 9933, 9935, 9937, 9937, 9941, 9941, 9941, 9941, 9946, 9946, 9946, 
+    9947, 9948, 9953, 9955, 9956, 9958, 9959, 9961, 9964, 9966, 9970, 9970, 
+    9970, 9972, 9972, 9973, 9974, 9976, 9979, 9979, 9980, 9981, 9984, 9985, 
+    9985, 9987, 9987, 9988, 9988, 9989, 9991, 9994, 9995, 9996, 9996, 9996, 
+    9997, 9999, 10001, 10001, 10003, 10005, 10009, 10011, 10011, 10013, 10014, 10015, 
+    10016, 10017, 10018, 10021, 10023, 10024, 10025, 10026, 10027, 10029, 10029, 10031, 
+    10032, 10034, 10035, 10038, 10038, 10038, 10039, 10039, 10040, 10041, 10042, 10045, 
+    10046, 10050, 10051, 10053, 10055, 10055, 10056, 10059, 10060, 10060, 10061, 10064, 
+    10065, 10067, 10068, 10069, 10069, 10069, 10069, 10071, 10072, 10072, 10074, 10075, 
+    10077, 10082, 10082, 10084, 10085, 10086, 10089, 10092, 10093, 10094, 10095, 10095, 
+    10099, 10101, 10104, 10104, 10108, 10109, 10109, 10109, 10110, 10110, 10113, 10115, 
+    10116, 10119, 10120, 10123, 10124, 10125, 10127, 10129, 10130, 10131, 10131, 10133, 
+    10134, 10135, 10136, 10138, 10138, 10140, 10142, 10143, 10143, 10143, 10146, 10147, 
+    10148, 10150, 10151, 10153, 10158, 10161, 10161, 10162, 10164, 10164, 10167, 10169, 
+    10173, 10174, 10177, 10177, 10177, 10179, 10180, 10180, 10180, 10180, 10184, 10188, 
+    10189, 10190, 10193, 10197, 10197, 10200, 10201, 10203, 10203, 10206, 10207, 10207, 
+    10207, 10209, 10209, 10210, 10210, 10211, 10212, 10217, 10218, 10220, 10223, 10225, 
+    10227, 10229, 10229, 10230, 10230, 10230, 10232, 10232, 10238, 10239, 10239, 10240, 
+    10241, 10244, 10248, 10251, 10251, 10251, 10251, 10253, 10253, 10253, 10253, 10255, 
+    10256, 10256, 10257, 10257, 10260, 10262, 10263, 10265, 10267, 10268, 10269, 10271, 
+    10273, 10273, 10275, 10276, 10278, 10282, 10283, 10286, 10287, 10289, 10289, 10289, 
+    10290, 10295, 10296, 10297, 10298, 10299, 10300, 10303, 10303, 10303, 10303, 10305, 
+    10307, 10309, 10310, 10310, 10310, 10311, 10311, 10311, 10311, 10313, 10318, 10322, 
+    10323, 10326, 10328, 10331, 10333, 10335, 10338, 10338, 10340, 10341, 10341, 10342, 
+    10344, 10346, 10349, 10350, 10351, 10352, 10353, 10354, 10354, 10354, 10354, 10355, 
+    10357, 10358, 10359, 10360, 10362, 10363, 10363, 10364, 10366, 10368, 10369, 10369, 
+    10371, 10374, 10376, 10380, 10380, 10383, 10384, 10389, 10393, 10394, 10396, 10396, 
+    10396, 10397, 10398, 10401, 10403, 10405, 10406, 10409, 10410, 10410, 10411, 10413, 
+    10415, 10418, 10420, 10421, 10423, 10425, 10425, 10425, 10426, 10429, 10431, 10432, 
+    10433, 10434, 10437, 10438, 10441, 10441, 10443, 10446, 10446, 10448, 10448, 10452, 
+    10454, 10454, 10456, 10456, 10459, 10461, 10463, 10464, 10466, 10467, 10468, 10468, 
+    10468, 10469, 10470, 10471, 10471, 10473, 10473, 10473, 10473, 10473, 10475, 10475, 
+    10475, 10476, 10476, 10477, 10478, 10480, 10480, 10480, 10483, 10485, 10485, 10486, 
+    10487, 10489, 10490, 10491, 10493, 10494, 10495, 10498, 10499, 10502, 10504, 10507, 
+    10508, 10509, 10510, 10513, 10515, 10517, 10517, 10519, 10519, 10520, 10521, 10522, 
+    10522, 10523, 10525, 10525, 10525, 10525, 10527, 10531, 10531, 10533, 10534, 10535, 
+    10537, 10542, 10542, 10543, 10544, 10545, 10550, 10552, 10555, 10556, 10556, 10558, 
+    10559, 10560, 10560, 10560, 10562, 10562, 10565, 10565, 10567, 10569, 10570, 10571, 
+    10571, 10573, 10573, 10576, 10578, 10581, 10582, 10584, 10585, 10586, 10588, 10589, 
+    10590, 10592, 10593, 10593, 10595, 10598, 10600, 10601, 10602, 10604, 10604, 10606, 
+    10607, 10609, 10610, 10612, 10612, 10614, 10614, 10615, 10618, 10620, 10621, 10622, 
+    10622, 10622, 10625, 10627, 10627, 10629, 10629, 10632, 10632, 10632, 10635, 10635, 
+    10638, 10638, 10638, 10640, 10640, 10642, 10644, 10645, 10646, 10650, 10653, 10656, 
+    10657, 10660, 10662, 10663, 10663, 10664, 10665, 10665, 10665, 10668, 10670, 10670, 
+    10670, 10672, 10672, 10674, 10675, 10677, 10680, 10682, 10682, 10682, 10684, 10686, 
+    10687, 10687, 10687, 10687, 10688, 10689, 10689, 10689, 10692, 10692, 10695, 10697, 
+    10697, 10700, 10703, 10705, 10706, 10708, 10709, 10709, 10712, 10714, 10714, 10714, 
+    10714, 10715, 10716, 10719, 10723, 10727, 10731, 10732, 10733, 10734, 10736, 10737, 
+    10738, 10738, 10738, 10741, 10743, 10743, 10744, 10744, 10748, 10748, 10748, 10748, 
+    10748, 10751, 10753, 10754, 10755, 10757, 10759, 10762, 10762, 10762, 10762, 10763, 
+    10764, 10766, 10770, 10771, 10774, 10775, 10776, 10780, 10782, 10784, 10785, 10787, 
+    10790, 10790, 10792, 10795, 10795, 10796, 10799, 10799, 10800, 10801, 10803, 10806, 
+    10807, 10807, 10808, 10809, 10809, 10810, 10810, 10811, 10814, 10816, 10816, 10820, 
+    10821, 10822, 10823, 10824, 10827, 10829, 10829, 10831, 10834, 10836, 10837, 10840, 
+    10841, 10843, 10843, 10846, 10848, 10851, 10855, 10855, 10858, 10860, 10861, 10862, 
+    10863, 10866, 10868, 10869, 10871, 10872, 10872, 10873, 10875, 10877, 10880, 10880, 
+    10880, 10881, 10884, 10884, 10885, 10885, 10885, 10890, 10892, 10896, 10897, 10897, 
+    10899, 10902, 10903, 10903, 10903, 10903, 10905, 10905, 10905, 10905, 10907, 10908, 
+    10909, 10911, 10912, 10913, 10913, 10914, 10914, 10915, 10916, 10917, 10917, 10918, 
+    10919, 10922, 10922, 10924, 10924, 10924, 10924, 10926, 10927, 10928, 10930, 10933, 
+    10935, 10937, 10939, 10942, 10944, 10946, 10948, 10949, 10949, 10950, 10950, 10951, 
+    10951, 10954, 10954, 10957, 10957, 10957, 10957, 10960, 10964, 10965, 10965, 10966, 
+    10967, 10968, 10969, 10970, 10973, 10978, 10980, 10980, 10982, 10984, 10984, 10984, 
+    10986, 10986, 10988, 10988, 10988, 10989, 10990, 10991, 10992, 10994, 10994, 10996, 
+    10997, 10998, 10998, 11002, 11002, 11003, 11003, 11004, 11004, 11005, 11007, 11009, 
+    11011, 11012, 11012, 11012, 11013, 11015, 11016, 11017, 11019, 11021, 11021, 11022, 
+    11026, 11028, 11029, 11030, 11032, 11033, 11036, 11039, 11040, 11041, 11043, 11044, 
+    11047, 11050, 11052, 11054, 11056, 11057, 11057, 11060, 11061, 11063, 11064, 11065, 
+    11067, 11070, 11070, 11071, 11071, 11072, 11072, 11075, 11075, 11076, 11076, 11076, 
+    11079, 11083, 11084, 11085, 11086, 11087, 11088, 11089, 11096, 11096, 11100, 11105, 
+    11106, 11107, 11107, 11107, 11109, 11111, 11112, 11112, 11113, 11115, 11115, 11115, 
+    11115, 11116, 11117, 11119, 11121, 11126, 11129, 11129, 11130, 11130, 11130, 11132, 
+    11134, 11135, 11138, 11138, 11141, 11141, 11143, 11145, 11147, 11150, 11151, 11153, 
+    11156, 11156, 11158, 11159, 11160, 11163, 11163, 11166, 11167, 11167, 11167, 11168, 
+    11171, 11172, 11174, 11175, 11176, 11177, 11177, 11178, 11178, 11179, 11181, 11181, 
+    11182, 11183, 11183, 11185, 11190, 11191, 11195, 11198, 11201, 11204, 11210, 11213, 
+    11214, 11215, 11220, 11222, 11225, 11225, 11225, 11226, 11226, 11227, 11227, 11230, 
+    11230, 11231, 11234, 11234, 11236, 11237, 11240, 11241, 11242, 11243, 11243, 11243, 
+    11244, 11244, 11245, 11245, 11245, 11246, 11248, 11250, 11250, 11252, 11254, 11254, 
+    11255, 11255, 11259, 11261, 11263, 11264, 11265, 11266, 11268, 11270, 11272, 11274, 
+    11275, 11278, 11280, 11280, 11282, 11282, 11284, 11286, 11290, 11292, 11294, 11298, 
+    11300, 11302, 11304, 11306, 11306, 11308, 11311, 11312, 11312, 11315, 11317, 11318, 
+    11319, 11321, 11321, 11323, 11325, 11326, 11329, 11330, 11331, 11333, 11333, 11335, 
+    11336, 11337, 11337, 11337, 11341, 11344, 11345, 11346, 11348, 11350, 11352, 11354, 
+    11356, 11356, 11358, 11359, 11361, 11363, 11365, 11370, 11373, 11373, 11376, 11378, 
+    11381, 11382, 11382, 11382, 11383, 11385, 11386, 11386, 11389, 11390, 11391, 11392, 
+    11393, 11393, 11395, 11395, 11395, 11395, 11398, 11400, 11401, 11403, 11404, 11407, 
+    11410, 11417, 11417, 11420, 11423, 11423, 11425, 11426, 11426, 11426, 11427, 11429, 
+    11431, 11431, 11432, 11432, 11432, 11434, 11434, 11434, 11434, 11434, 11436, 11436, 
+    11437, 11437, 11438, 11440, 11441, 11441, 11444, 11445, 11447, 11448, 11451, 11455, 
+    11455, 11457, 11459, 11462, 11464, 11465, 11466, 11466, 11466, 11466, 11466, 11468, 
+    11468, 11469, 11470, 11473, 11474, 11474, 11476, 11478, 11484, 11486, 11487, 11489, 
+    11489, 11490, 11490, 11492, 11494, 11494, 11496, 11499, 11500, 11500, 11501, 11501, 
+    11501, 11501, 11503, 11505, 11506, 11507, 11508, 11509, 11513, 11513, 11515, 11516, 
+    11517, 11517, 11519, 11520, 11520, 11524, 11524, 11527, 11527, 11527, 11527, 11527, 
+    11529, 11529, 11529, 11529, 11531, 11532, 11534, 11536, 11537, 11539, 11539, 11541, 
+    11543, 11543, 11545, 11545, 11549, 11549, 11549, 11551, 11554, 11554, 11556, 11560, 
+    11560, 11563, 11566, 11566, 11567, 11567, 11571, 11572, 11572, 11576, 11576, 11577, 
+    11578, 11578, 11583, 11584, 11585, 11586, 11586, 11587, 11587, 11588, 11589, 11589, 
+    11591, 11592, 11593, 11595, 11596, 11596, 11596, 11597, 11599, 11600, 11602, 11603, 
+    11604, 11606, 11607, 11609, 11612, 11614, 11615, 11616, 11616, 11618, 11620, 11624, 
+    11626, 11628, 11630, 11631, 11631, 11632, 11634, 11635, 11636, 11637, 11638, 11638, 
+    11640, 11642, 11643, 11644, 11647, 11649, 11649, 11651, 11652, 11653, 11655, 11655, 
+    11657, 11658, 11659, 11660, 11661, 11662, 11663, 11665, 11666, 11669, 11670, 11671, 
+    11674, 11677, 11680, 11680, 11681, 11684, 11686, 11690, 11690, 11690, 11690, 11690, 
+    11690, 11690, 11690, 11695, 11695, 11695, 11695, 11696, 11699, 11699, 11701, 11702, 
+    11703, 11703, 11705, 11707, 11707, 11708, 11710, 11711, 11712, 11717, 11717, 11718, 
+    11720, 11722, 11723, 11726, 11727, 11727, 11729, 11729, 11730, 11732, 11732, 11733, 
+    11734, 11736, 11737, 11738, 11740, 11740, 11741, 11742, 11745, 11745, 11746, 11747, 
+    11748, 11751, 11752, 11755, 11755, 11757, 11759, 11760, 11762, 11764, 11768, 11771, 
+    11772, 11773, 11773, 11775, 11777, 11778, 11779, 11781, 11783, 11783, 11786, 11787, 
+    11789, 11790, 11793, 11795, 11797, 11799, 11800, 11800, 11802, 11803, 11803, 11805, 
+    11807, 11809, 11810, 11811, 11813, 11814, 11816, 11818, 11818, 11822, 11823, 11825, 
+    11826, 11827, 11831, 11832, 11836, 11837, 11838, 11839, 11839, 11841, 11843, 11843, 
+    11846, 11847, 11847, 11850, 11850, 11851, 11851, 11852, 11852, 11852, 11852, 11854, 
+    11855, 11857, 11857, 11861, 11863, 11865, 11868, 11870, 11872, 11873, 11877, 11879, 
+    11879, 11881, 11883, 11885, 11888, 11889, 11889, 11891, 11892, 11893, 11893, 11894, 
+    11896, 11898, 11900, 11903, 11906, 11909, 11911, 11914, 11914, 11918, 11921, 11922, 
+    11927, 11930, 11931, 11933, 11937, 11939, 11940, 11941, 11943, 11945, 11947, 11947, 
+    11949, 11952, 11953, 11953, 11954, 11955, 11958, 11959, 11960, 11961, 11961, 11963, 
+    11964, 11965, 11968, 11970, 11974, 11976, 11978, 11979, 11981, 11984, 11985, 11989, 
+    11990, 11990, 11991, 11993, 11993, 11994, 11994, 11995, 11997, 12003, 12003, 12003, 
+    12007, 12009, 12011, 12013, 12013, 12015, 12017, 12018, 12018, 12018, 12018, 12025, 
+    12030, 12032, 12035, 12038, 12038, 12039, 12039, 12041, 12043, 12045, 12048, 12049, 
+    12051, 12052, 12053, 12053, 12056, 12062, 12067, 12068, 12068, 12072, 12074, 12075, 
+    12075, 12075, 12077, 12082, 12084, 12086, 12087, 12088, 12091, 12092, 12093, 12097, 
+    12099, 12099, 12099, 12100, 12102, 12104, 12108, 12108, 12111, 12111, 12112, 12113, 
+    12115, 12117, 12121, 12124, 12125, 12128, 12130, 12131, 12131, 12132, 12133, 12135, 
+    12139, 12139, 12139, 12140, 12140, 12140, 12140, 12146, 12148, 12149, 12150, 12150, 
+    12153, 12154, 12155, 12156, 12157, 12159, 12162, 12165, 12169, 12170, 12174, 12176, 
+    12177, 12180, 12182, 12184, 12185, 12188, 12192, 12192, 12192, 12192, 12195, 12195, 
+    12195, 12197, 12198, 12200, 12201, 12204, 12206, 12207, 12208, 12209, 12210, 12211, 
+    12213, 12214, 12214, 12214, 12216, 12216, 12218, 12218, 12218, 12219, 12220, 12223, 
+    12223, 12226, 12226, 12227, 12227, 12230, 12230, 12231, 12231, 12232, 12236, 12237, 
+    12239, 12240, 12241, 12242, 12242, 12245, 12246, 12246, 12249, 12249, 12249, 12250, 
+    12253, 12255, 12255, 12256, 12258, 12260, 12260, 12262, 12263, 12266, 12267, 12268, 
+    12268, 12269, 12273, 12275, 12275, 12275, 12277, 12278, 12281, 12283, 12283, 12285, 
+    12288, 12289, 12290, 12290, 12292, 12292, 12292, 12292, 12294, 12294, 12294, 12295, 
+    12298, 12298, 12302, 12302, 12305, 12307, 12309, 12310, 12311, 12312, 12313, 12314, 
+    12316, 12316, 12316, 12318, 12318, 12321, 12325, 12326, 12329, 12329, 12329, 12331, 
+    12334, 12336, 12337, 12338, 12340, 12341, 12342, 12342, 12345, 12345, 12348, 12350, 
+    12350, 12351, 12351, 12351, 12352, 12354, 12358, 12360, 12360, 12362, 12364, 12364, 
+    12365, 12367, 12369, 12369, 12373, 12375, 12375, 12377, 12378, 12381, 12385, 12387, 
+    12389, 12390, 12393, 12395, 12396, 12397, 12400, 12401, 12403, 12406, 12407, 12407, 
+    12409, 12411, 12416, 12422, 12422, 12424, 12426, 12428, 12429, 12431, 12432, 12434, 
+    12436, 12440, 12440, 12441, 12441, 12442, 12443, 12446, 12450, 12451, 12452, 12455, 
+    12456, 12457, 12459, 12461, 12462, 12463, 12466, 12466, 12466, 12467, 12469, 12469, 
+    12472, 12473, 12477, 12478, 12480, 12483, 12485, 12486, 12488, 12489, 12490, 12492, 
+    12495, 12495, 12497, 12497, 12497, 12498, 12498, 12498, 12498, 12500, 12500, 12501, 
+    12501, 12501, 12502, 12502, 12504, 12504, 12506, 12507, 12509, 12511, 12511, 12513, 
+    12514, 12516, 12516, 12516, 12517, 12517, 12518, 12519, 12521, 12522, 12523, 12524, 
+    12526, 12529, 12530, 12530, 12532, 12532, 12533, 12533, 12535, 12537, 12539, 12540, 
+    12540, 12540, 12540, 12541, 12546, 12546, 12548, 12550, 12551, 12558, 12558, 12559, 
+    12561, 12562, 12565, 12566, 12569, 12570, 12571, 12574, 12576, 12579, 12580, 12581, 
+    12585, 12588, 12588, 12591, 12593, 12595, 12596, 12597, 12600, 12601, 12602, 12603, 
+    12607, 12612, 12612, 12613, 12616, 12618, 12620, 12620, 12622, 12625, 12626, 12626, 
+    12626, 12627, 12627, 12629, 12632, 12632, 12633, 12636, 12637, 12640, 12642, 12643, 
+    12644, 12645, 12646, 12648, 12648, 12651, 12651, 12652, 12653, 12653, 12655, 12658, 
+    12661, 12663, 12664, 12667, 12668, 12671, 12672, 12673, 12673, 12673, 12675, 12676, 
+    12677, 12677, 12677, 12678, 12678, 12680, 12686, 12686, 12687, 12687, 12689, 12691, 
+    12692, 12694, 12696, 12697, 12698, 12700, 12701, 12701, 12701, 12702, 12706, 12710, 
+    12712, 12713, 12714, 12716, 12721, 12722, 12724, 12725, 12726, 12729, 12730, 12732, 
+    12736, 12742, 12743, 12743, 12745, 12747, 12750, 12752, 12752, 12754, 12757, 12757, 
+    12758, 12760, 12761, 12765, 12766, 12770, 12771, 12772, 12776, 12777, 12778, 12778, 
+    12780, 12780, 12781, 12782, 12782, 12785, 12786, 12786, 12787, 12787, 12789, 12791, 
+    12794, 12797, 12797, 12798, 12800, 12801, 12801, 12803, 12803, 12805, 12806, 12807, 
+    12807, 12808, 12808, 12810, 12810, 12810, 12810, 12812, 12815, 12817, 12819, 12820, 
+    12821, 12823, 12824, 12824, 12826, 12829, 12830, 12834, 12837, 12840, 12843, 12845, 
+    12847, 12848, 12851, 12852, 12859, 12860, 12861, 12863, 12863, 12868, 12869, 12870, 
+    12870, 12871, 12871, 12871, 12871, 12874, 12874, 12875, 12876, 12877, 12878, 12881, 
+    12881, 12882, 12883, 12885, 12886, 12889, 12890, 12892, 12893, 12895, 12895, 12896, 
+    12898, 12899, 12901, 12901, 12902, 12903, 12904, 12907, 12908, 12911, 12912, 12912, 
+    12913, 12913, 12913, 12913, 12914, 12917, 12917, 12919, 12920, 12923, 12923, 12929, 
+    12930, 12931, 12933, 12934, 12936, 12936, 12937, 12940, 12943, 12946, 12950, 12950, 
+    12950, 12952, 12952, 12953, 12954, 12956, 12960, 12960, 12964, 12966, 12967, 12968, 
+    12972, 12974, 12974, 12979, 12980, 12982, 12982, 12983, 12985, 12988, 12989, 12991, 
+    12991, 12994, 12995, 12996, 13001, 13001, 13003, 13005, 13005, 13007, 13008, 13009, 
+    13011, 13012, 13012, 13014, 13015, 13018, 13018, 13019, 13021, 13023, 13023, 13024, 
+    13026, 13027, 13029, 13031, 13033, 13035, 13036, 13036, 13036, 13036, 13036, 13037, 
+    13042, 13042, 13043, 13043, 13044, 13048, 13051, 13052, 13053, 13055, 13058, 13059, 
+    13060, 13063, 13063, 13063, 13065, 13067, 13067, 13068, 13071, 13071, 13071, 13072, 
+    13073, 13077, 13080, 13081, 13082, 13083, 13087, 13089, 13091, 13095, 13096, 13098, 
+    13099, 13099, 13102, 13103, 13105, 13105, 13105, 13109, 13109, 13110, 13111, 13118, 
+    13118, 13118, 13119, 13121, 13123, 13126, 13126, 13131, 13132, 13134, 13137, 13139, 
+    13141, 13142, 13145, 13146, 13146, 13149, 13150, 13151, 13152, 13153, 13153, 13156, 
+    13159, 13160, 13162, 13163, 13163, 13166, 13167, 13168, 13169, 13172, 13173, 13175, 
+    13176, 13176, 13178, 13181, 13183, 13184, 13186, 13190, 13191, 13192, 13193, 13196, 
+    13200, 13203, 13204, 13206, 13206, 13211, 13214, 13217, 13217, 13220, 13223, 13225, 
+    13226, 13227, 13228, 13231, 13231, 13236, 13238, 13239, 13241, 13242, 13244, 13246, 
+    13248, 13249, 13250, 13253, 13254, 13256, 13258, 13262, 13264, 13264, 13266, 13267, 
+    13272, 13272, 13273, 13276, 13278, 13282, 13286, 13286, 13287, 13288, 13291, 13293, 
+    13293, 13295, 13298, 13303, 13306, 13307, 13308, 13309, 13309, 13309, 13312, 13313, 
+    13315, 13316, 13316, 13316, 13318, 13320, 13323, 13325, 13328, 13330, 13332, 13335, 
+    13335, 13336, 13339, 13342, 13342, 13346, 13351, 13352, 13352, 13354, 13359, 13359, 
+    13361, 13361, 13365, 13367, 13368, 13369, 13370, 13370, 13372, 13376, 13379, 13382, 
+    13384, 13386, 13386, 13388, 13389, 13389, 13390, 13391, 13392, 13394, 13395, 13396, 
+    13396, 13398, 13398, 13401, 13404, 13405, 13408, 13410, 13410, 13412, 13415, 13417, 
+    13418, 13419, 13420, 13420, 13422, 13424, 13425, 13425, 13425, 13427, 13428, 13431, 
+    13433, 13434, 13436, 13436, 13438, 13440, 13441, 13441, 13442, 13443, 13444, 13445, 
+    13447, 13447, 13447, 13449, 13449, 13452, 13455, 13455, 13457, 13459, 13459, 13461, 
+    13461, 13461, 13463, 13465, 13466, 13468, 13469, 13471, 13473, 13478, 13481, 13481, 
+    13483, 13485, 13485, 13485, 13487, 13487, 13487, 13492, 13493, 13493, 13493, 13496, 
+    13497, 13499, 13500, 13501, 13503, 13503, 13504, 13507, 13508, 13511, 13516, 13518, 
+    13519, 13519, 13521, 13522, 13525, 13528, 13528, 13529, 13531, 13533, 13537, 13537, 
+    13539, 13540, 13543, 13543, 13543, 13544, 13552, 13552, 13552, 13552, 13553, 13556, 
+    13558, 13560, 13561, 13562, 13562, 13563, 13565, 13565, 13566, 13567, 13567, 13569, 
+    13570, 13574, 13575, 13576, 13578, 13581, 13584, 13586, 13588, 13589, 13590, 13592, 
+    13593, 13594, 13598, 13599, 13600, 13602, 13603, 13605, 13606, 13608, 13609, 13610, 
+    13610, 13612, 13612, 13612, 13615, 13618, 13618, 13618, 13621, 13623, 13625, 13628, 
+    13629, 13632, 13633, 13640, 13640, 13642, 13644, 13646, 13647, 13649, 13649, 13651, 
+    13653, 13653, 13656, 13658, 13659, 13659, 13659, 13663, 13665, 13670, 13670, 13671, 
+    13672, 13672, 13673, 13675, 13677, 13678, 13678, 13679, 13683, 13684, 13686, 13686, 
+    13686, 13689, 13690, 13693, 13694, 13695, 13696, 13698, 13700, 13700, 13701, 13701, 
+    13703, 13705, 13705, 13706, 13706, 13707, 13709, 13710, 13710, 13712, 13717, 13720, 
+    13720, 13722, 13722, 13724, 13724, 13727, 13730, 13732, 13735, 13737, 13737, 13739, 
+    13740, 13740, 13740, 13741, 13743, 13745, 13748, 13751, 13751, 13752, 13752, 13753, 
+    13755, 13756, 13756, 13759, 13759, 13761, 13762, 13764, 13767, 13769, 13771, 13772, 
+    13772, 13775, 13776, 13778, 13779, 13780, 13780, 13781, 13782, 13782, 13782, 13782, 
+    13783, 13787, 13788, 13789, 13790, 13791, 13794, 13794, 13797, 13798, 13801, 13803, 
+    13804, 13806, 13806, 13807, 13808, 13810, 13812, 13812, 13814, 13821, 13824, 13825, 
+    13828, 13831, 13831, 13835, 13838, 13839, 13841, 13841, 13843, 13844, 13847, 13847, 
+    13847, 13847, 13851, 13853, 13855, 13858, 13858, 13858, 13860, 13861, 13863, 13866, 
+    13866, 13871, 13873, 13876, 13877, 13878, 13880, 13884, 13889, 13891, 13893, 13893, 
+    13894, 13896, 13897, 13899, 13900, 13903, 13907, 13908, 13909, 13912, 13912, 13914, 
+    13914, 13915, 13917, 13919, 13923, 13924, 13925, 13926, 13929, 13930, 13931, 13933, 
+    13935, 13935, 13937, 13939, 13940, 13942, 13943, 13943, 13944, 13945, 13947, 13951, 
+    13953, 13954, 13955, 13956, 13958, 13960, 13963, 13967, 13970, 13972, 13976, 13977, 
+    13980, 13981, 13984, 13986, 13986, 13987, 13988, 13988, 13991, 13991, 13993, 13996, 
+    13997, 13999, 14002, 14003, 14005, 14007, 14008, 14008, 14008, 14008, 14012, 14014, 
+    14016, 14019, 14020, 14022, 14024, 14025, 14026, 14028, 14029, 14031, 14031, 14034, 
+    14037, 14038, 14039, 14040, 14043, 14045, 14046, 14047, 14047, 14051, 14052, 14055, 
+    14056, 14059, 14061, 14062, 14064, 14065, 14066, 14067, 14069, 14071, 14074, 14076, 
+    14077, 14079, 14081, 14084, 14086, 14088, 14090, 14091, 14091, 14091, 14094, 14098, 
+    14098, 14098, 14098, 14101, 14101, 14103, 14105, 14105, 14106, 14110, 14111, 14114, 
+    14114, 14115, 14115, 14116, 14119, 14119, 14122, 14125, 14126, 14130, 14131, 14131, 
+    14133, 14134, 14137, 14138, 14138, 14142, 14143, 14143, 14143, 14146, 14146, 14149, 
+    14154, 14158, 14159, 14161, 14167, 14167, 14167, 14168, 14168, 14169, 14169, 14170, 
+    14172, 14174, 14174, 14175, 14175, 14177, 14179, 14185, 14186, 14186, 14190, 14193, 
+    14194, 14195, 14196, 14198, 14198, 14198, 14202, 14203, 14204, 14205, 14205, 14209, 
+    14211, 14215, 14217, 14218, 14221, 14221, 14223, 14225, 14230, 14231, 14233, 14236, 
+    14237, 14237, 14237, 14237, 14241, 14243, 14243, 14243, 14243, 14246, 14247, 14248, 
+    14250, 14251, 14252, 14252, 14255, 14256, 14256, 14256, 14257, 14261, 14263, 14263, 
+    14266, 14267, 14269, 14271, 14272, 14274, 14274, 14276, 14277, 14277, 14279, 14280, 
+    14280, 14280, 14280, 14283, 14283, 14283, 14285, 14286, 14286, 14286, 14286, 14290, 
+    14291, 14293, 14294, 14297, 14297, 14298, 14301, 14302, 14303, 14305, 14305, 14308, 
+    14310, 14311, 14314, 14315, 14315, 14316, 14318, 14319, 14320, 14323, 14325, 14328, 
+    14331, 14332, 14335, 14338, 14340, 14342, 14342, 14344, 14345, 14347, 14349, 14350, 
+    14352, 14354, 14359, 14361, 14364, 14365, 14365, 14367, 14368, 14369, 14371, 14372, 
+    14374, 14375, 14375, 14376, 14377, 14378, 14379, 14379, 14381, 14382, 14386, 14386, 
+    14387, 14387, 14388, 14388, 14390, 14391, 14392, 14394, 14397, 14398, 14399, 14399, 
+    14399, 14399, 14402, 14404, 14406, 14406, 14409, 14414, 14414, 14415, 14418, 14418, 
+    14419, 14420, 14422, 14423, 14423, 14426, 14426, 14428, 14430, 14433, 14435, 14437, 
+    14439, 14441, 14442, 14442, 14445, 14446, 14449, 14450, 14453, 14454, 14456, 14463, 
+    14464, 14464, 14464, 14465, 14468, 14471, 14472, 14474, 14476, 14476, 14476, 14478, 
+    14480, 14482, 14485, 14486, 14489, 14490, 14494, 14494, 14494, 14495, 14495, 14496, 
+    14496, 14498, 14500, 14501, 14504, 14506, 14508, 14509, 14509, 14510, 14512, 14514, 
+    14515, 14517, 14518, 14519, 14520, 14521, 14522, 14522, 14523, 14525, 14528, 14528, 
+    14530, 14532, 14532, 14535, 14536, 14536, 14537, 14541, 14542, 14544, 14544, 14547, 
+    14548, 14550, 14552, 14552, 14552, 14554, 14556, 14556, 14557, 14558, 14559, 14561, 
+    14562, 14562, 14562, 14565, 14565, 14566, 14569, 14572, 14574, 14574, 14576, 14579, 
+    14582, 14585, 14587, 14588, 14589, 14589, 14591, 14591, 14591, 14594, 14595, 14596, 
+    14596, 14597, 14599, 14600, 14604, 14605, 14605, 14607, 14610, 14611, 14614, 14615, 
+    14617, 14617, 14619, 14620, 14621, 14621, 14623, 14626, 14628, 14630, 14631, 14631, 
+    14634, 14638, 14639, 14639, 14639, 14640, 14644, 14644, 14645, 14646, 14647, 14649, 
+    14649, 14651, 14651, 14651, 14653, 14653, 14654, 14654, 14654, 14655, 14657, 14659, 
+    14661, 14664, 14666, 14667, 14668, 14670, 14670, 14671, 14671, 14675, 14676, 14681, 
+    14682, 14682, 14682, 14682, 14684, 14684, 14688, 14688, 14689, 14691, 14692, 14693, 
+    14698, 14698, 14698, 14699, 14701, 14701, 14703, 14703, 14703, 14703, 14704, 14704, 
+    14705, 14707, 14708, 14710, 14712, 14714, 14715, 14716, 14718, 14718, 14720, 14722, 
+    14722, 14722, 14724, 14724, 14726, 14728, 14728, 14728, 14732, 14736, 14736, 14739, 
+    14741, 14741, 14743, 14743, 14743, 14743, 14746, 14748, 14751, 14752, 14752, 14752, 
+    14754, 14756, 14758, 14758, 14759, 14759, 14761, 14766, 14767, 14767, 14769, 14772, 
+    14773, 14776, 14778, 14779, 14780, 14781, 14782, 14784, 14785, 14788, 14789, 14790, 
+    14791, 14793, 14795, 14798, 14799, 14801, 14801, 14802, 14803, 14805, 14806, 14806, 
+    14808, 14808, 14809, 14809, 14810, 14811, 14812, 14814, 14815, 14818, 14818, 14821, 
+    14823, 14825, 14825, 14826, 14828, 14830, 14830, 14831, 14831, 14833, 14834, 14836, 
+    14837, 14837, 14837, 14840, 14841, 14843, 14844, 14846, 14847, 14848, 14849, 14849, 
+    14851, 14856, 14858, 14858, 14859, 14860, 14861, 14862, 14864, 14865, 14865, 14865, 
+    14866, 14868, 14868, 14870, 14871, 14872, 14874, 14876, 14877, 14878, 14878, 14879, 
+    14880, 14883, 14886, 14888, 14891, 14894, 14897, 14897, 14899, 14901, 14903, 14905, 
+    14905, 14905, 14908, 14909, 14910, 14911, 14912, 14914, 14914, 14915, 14915, 14915, 
+    14917, 14917, 14918, 14919, 14922, 14925, 14927, 14927, 14927, 14929, 14930, 14930, 
+    14932, 14933, 14935, 14935, 14937, 14942, 14942, 14943, 14946, 14946, 14946, 14947, 
+    14949, 14951, 14951, 14952, 14957, 14958, 14960, 14962, 14965, 14965, 14968, 14969, 
+    14970, 14971, 14973, 14973, 14974, 14976, 14977, 14979, 14981, 14981, 14981, 14981, 
+    14981, 14984, 14987, 14988, 14990, 14992, 14993, 14994, 14994, 14995, 14999
+};
@@ -0,0 +1,23 @@
+#ifndef CATALOG_KVECTOR_H
+#define CATALOG_KVECTOR_H
+
+#include <stdint.h>
+#include "tab_cat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// k-vector angle index over tab_cat[] (sorted by angle):
+// kvector_k[j] = number of pairs with angle <= KVECTOR_M * j + KVECTOR_Q
+#define KVECTOR_N N_PAIRS
+#define KVECTOR_M 2.800106681
+#define KVECTOR_Q 2.500000000
+
+extern const uint16_t kvector_k[KVECTOR_N];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CATALOG_KVECTOR_H
@@ -1,6 +1,6 @@
 // catalog_luts.c - LUT data for star tracker catalog
 
-#include <stdint.h>
+#include "catalog_luts.h"
 
 const uint8_t catalog[] = {
     //Catalog stored as:
@@ -263,7 +263,7 @@ const uint8_t catalog[] = {
     0xFF, 0x9B, 0x7D, 0xFC,
 };
 
-const int index_to_hip_ID_lut[] = {
+const uint32_t index_to_hip_ID_lut[] = {
     0x02A5, 0x02EA, 0x042B, 0x07E5, 0x0821, 0x0C14, 0x0C6B, 0x0D5B, 
     0x114B, 0x142D, 0x1547, 0x1A1E, 0x1DA4, 0x22B6, 0x22C7, 0x2414, 
     0x25A8, 0x269C, 0x2750, 0x2DF7, 0x3617, 0x3737, 0x37F8, 0x3812, 
@@ -298,114 +298,312 @@ const int index_to_hip_ID_lut[] = {
     0x1AE32, 0x1B5FA, 0x1B61E, 0x1B9F0, 0x1BAD8, 0x1BCD9, 0x1BD2B, 0x1C7F7
     
 };
-const uint16_t index_count = sizeof(index_to_hip_ID_lut) / sizeof(index_to_hip_ID_lut[0]);
+const size_t index_count = sizeof(index_to_hip_ID_lut) / sizeof(index_to_hip_ID_lut[0]);
+
+const int16_t index_to_vmag_lut[] = {
+    207, 228, 283, 282, 240, 327, 224, 204, 215, 332, 207, 266, 
+    45, 335, 264, 286, 210, 201, 300, 197, 288, 254, 291, 332, 
+    209, 179, 301, 326, 285, 284, 290, 297, 333, 330, 87, 319, 
+    269, 303, 319, 318, 278, 329, 18, 8, 335, 164, 165, 281, 
+    225, 258, 339, 275, 169, 297, 265, 174, 207, 312, 45, 190, 
+    265, 331, 302, 198, 287, -62, 193, 317, 306, -144, 335, 324, 
+    294, 150, 302, 183, 271, 245, 289, 325, 158, 40, 116, 334, 
+    221, 283, 175, 186, 335, 193, 338, 311, 312, 223, 167, 221, 
+    314, 247, 199, 316, 317, 297, 292, 136, 329, 339, 201, 306, 
+    330, 274, 269, 311, 234, 181, 300, 256, 333, 311, 214, 241, 
+    258, 302, 279, 332, 258, 77, 294, 159, 265, 269, 220, 274, 
+    304, 125, 176, 339, 289, 285, 299, 275, 223, 98, 338, 229, 
+    185, 268, 255, 61, 325, 206, -5, 304, 233, 135, -1, 230, 
+    318, 235, 207, 275, 268, 313, 325, 261, 287, 300, 322, 337, 
+    329, 222, 280, 263, 283, 289, 229, 256, 273, 323, 290, 273, 
+    106, 278, 282, 254, 281, 191, 229, 300, 319, 312, 317, 243, 
+    332, 278, 312, 316, 327, 284, 331, 279, 270, 284, 162, 208, 
+    186, 239, 276, 299, 319, 224, 332, 298, 310, 272, 323, 179, 
+    282, 3, 317, 205, 325, 260, 299, 332, 288, 307, 336, 305, 
+    286, 272, 76, 324, 305, 223, 194, 311, 125, 248, 321, 245, 
+    323, 290, 238, 285, 300, 295, 173, 339, 287, 207, 293, 327, 
+    117, 244, 249, 321
+};
 
 const uint16_t bin_angle_to_address_lut[] = {
-    0x0000, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x000A, 0x000B, 
-    0x000C, 0x000F, 0x0010, 0x0013, 0x0014, 0x0015, 0x001C, 0x0021, 
-    0x0022, 0x0023, 0x0024, 0x0029, 0x002A, 0x002F, 0x0034, 0x0039, 
-    0x003C, 0x0041, 0x0042, 0x0049, 0x0050, 0x0059, 0x0060, 0x0063, 
-    0x006C, 0x006F, 0x0078, 0x007B, 0x0082, 0x0087, 0x008E, 0x0091, 
-    0x0098, 0x00A1, 0x00B0, 0x00BB, 0x00C8, 0x00D1, 0x00DE, 0x00E7, 
-    0x00F2, 0x00F5, 0x00FE, 0x010D, 0x0114, 0x011D, 0x0124, 0x012B, 
-    0x013A, 0x0149, 0x014E, 0x0155, 0x015E, 0x0163, 0x016E, 0x0173, 
-    0x017E, 0x018B, 0x0192, 0x019B, 0x01A8, 0x01AF, 0x01C4, 0x01CB, 
-    0x01D0, 0x01DD, 0x01E4, 0x01F1, 0x01FC, 0x0207, 0x0218, 0x0225, 
-    0x0230, 0x0241, 0x024A, 0x0257, 0x026A, 0x0273, 0x0278, 0x027D, 
-    0x0294, 0x02A5, 0x02B2, 0x02C7, 0x02D0, 0x02E7, 0x02F4, 0x0301, 
-    0x030E, 0x031D, 0x032C, 0x0331, 0x0344, 0x034D, 0x0358, 0x0365, 
-    0x0370, 0x0381, 0x0390, 0x039B, 0x03A6, 0x03AF, 0x03C2, 0x03D1, 
-    0x03E0, 0x03F1, 0x0406, 0x0411, 0x042A, 0x0437, 0x043E, 0x0451, 
-    0x0464, 0x0477, 0x0488, 0x049B, 0x04AE, 0x04C5, 0x04D2, 0x04E3, 
-    0x04F2, 0x0509, 0x0516, 0x0527, 0x0538, 0x054D, 0x055A, 0x056B, 
-    0x0580, 0x0595, 0x05AC, 0x05C1, 0x05D0, 0x05EB, 0x0606, 0x0615, 
-    0x0624, 0x062D, 0x063C, 0x0647, 0x0652, 0x065F, 0x0674, 0x0685, 
-    0x0696, 0x069F, 0x06B6, 0x06C9, 0x06DE, 0x06EF, 0x0708, 0x0729, 
-    0x073A, 0x0751, 0x075C, 0x0775, 0x078A, 0x079F, 0x07B4, 0x07D1, 
-    0x07F4, 0x0801, 0x0816, 0x0825, 0x0838, 0x0853, 0x086A, 0x087F, 
-    0x089C, 0x08B5, 0x08C4, 0x08DB, 0x08FC, 0x090F, 0x0922, 0x093F, 
-    0x0954, 0x0969, 0x097A, 0x0999, 0x09C2, 0x09EB, 0x0A06, 0x0A13, 
-    0x0A26, 0x0A3B, 0x0A4E, 0x0A61, 0x0A76, 0x0A97, 0x0AB6, 0x0AD1, 
-    0x0AE2, 0x0B01, 0x0B20, 0x0B31, 0x0B3E, 0x0B55, 0x0B66, 0x0B81, 
-    0x0B98, 0x0BB1, 0x0BCE, 0x0BDF, 0x0BFA, 0x0C17, 0x0C2C, 0x0C49, 
-    0x0C58, 0x0C75, 0x0C92, 0x0CA3, 0x0CC8, 0x0CEB, 0x0D02, 0x0D13, 
-    0x0D36, 0x0D51, 0x0D74, 0x0D93, 0x0DAE, 0x0DD1, 0x0DF0, 0x0E17, 
-    0x0E40, 0x0E57, 0x0E6A, 0x0E7F, 0x0E9E, 0x0EC1, 0x0EDE, 0x0EF9, 
-    0x0F14, 0x0F31, 0x0F50, 0x0F67, 0x0F86, 0x0F9D, 0x0FB6, 0x0FD7, 
-    0x0FF0, 0x1015, 0x1034, 0x1053, 0x1070, 0x108F, 0x10A2, 0x10C3, 
-    0x10DC, 0x10F9, 0x1114, 0x1133, 0x1150, 0x1161, 0x117E, 0x11A1, 
-    0x11D0, 0x11EF, 0x120A, 0x1225, 0x1256, 0x1275, 0x129E, 0x12B9, 
-    0x12E2, 0x1303, 0x131A, 0x132B, 0x1346, 0x136F, 0x1386, 0x13A3, 
-    0x13B8, 0x13D7, 0x1406, 0x141B, 0x1432, 0x144F, 0x146C, 0x148D, 
-    0x14AE, 0x14CD, 0x14E4, 0x150F, 0x152E, 0x154D, 0x1570, 0x1585, 
-    0x15AA, 0x15BB, 0x15D2, 0x15E9, 0x1614, 0x162D, 0x1644, 0x166B, 
-    0x16A0, 0x16CB, 0x16E8, 0x1707, 0x172C, 0x1753, 0x177C, 0x179D, 
-    0x17C2, 0x17D7, 0x17F2, 0x181D, 0x183A, 0x185B, 0x187C, 0x189F, 
-    0x18B0, 0x18D9, 0x18FC, 0x1929, 0x1946, 0x1963, 0x197C, 0x199D, 
-    0x19C4, 0x19EB, 0x1A0A, 0x1A2D, 0x1A56, 0x1A77, 0x1A8C, 0x1AAD, 
-    0x1ADA, 0x1AFF, 0x1B1C, 0x1B39, 0x1B5A, 0x1B8F, 0x1BAA, 0x1BC7, 
-    0x1BE2, 0x1C13, 0x1C32, 0x1C51, 0x1C7C, 0x1C99, 0x1CC2, 0x1CFB, 
-    0x1D18, 0x1D3B, 0x1D5E, 0x1D7B, 0x1DA4, 0x1DBD, 0x1DEA, 0x1E13, 
-    0x1E2A, 0x1E47, 0x1E70, 0x1E91, 0x1EC4, 0x1EDB, 0x1F06, 0x1F1F, 
-    0x1F46, 0x1F65, 0x1F8E, 0x1FBB, 0x1FDE, 0x2001, 0x201E, 0x2045, 
-    0x205C, 0x208B, 0x20A2, 0x20C7, 0x20E4, 0x2111, 0x2136, 0x215B, 
-    0x2188, 0x219F, 0x21C4, 0x21DD, 0x2200, 0x221D, 0x2246, 0x2265, 
-    0x2294, 0x22BF, 0x22D6, 0x2317, 0x2338, 0x2369, 0x2390, 0x23B3, 
-    0x23E8, 0x2409, 0x2436, 0x245D, 0x24A2, 0x24C7, 0x24EA, 0x2507, 
-    0x2528, 0x255B, 0x2578, 0x25A1, 0x25C4, 0x25FD, 0x2620, 0x2647, 
-    0x2678, 0x269D, 0x26C2, 0x26EB, 0x2718, 0x273F, 0x2774, 0x2797, 
-    0x27BC, 0x27D9, 0x2818, 0x2831, 0x285E, 0x288D, 0x28B6, 0x28ED, 
-    0x291E, 0x294F, 0x297A, 0x29A1, 0x29DA, 0x29FD, 0x2A1C, 0x2A47, 
-    0x2A7A, 0x2AA9, 0x2AD6, 0x2B05, 0x2B2E, 0x2B4F, 0x2B7E, 0x2BB5, 
-    0x2BE2, 0x2C11, 0x2C2E, 0x2C53, 0x2C7C, 0x2CAF, 0x2CCE, 0x2CFB, 
-    0x2D20, 0x2D55, 0x2D7A, 0x2DA9, 0x2DD6, 0x2DFD, 0x2E24, 0x2E57, 
-    0x2E80, 0x2EB5, 0x2ED2, 0x2F07, 0x2F2E, 0x2F5B, 0x2F8C, 0x2FBB, 
-    0x2FDC, 0x3007, 0x3032, 0x3069, 0x309A, 0x30C7, 0x30FA, 0x312B, 
-    0x3150, 0x3165, 0x318E, 0x31BB, 0x31FC, 0x322F, 0x3248, 0x326B, 
-    0x3294, 0x32C1, 0x32EE, 0x3327, 0x3352, 0x338D, 0x33B4, 0x33E7, 
-    0x3416, 0x3449, 0x347C, 0x34B1, 0x34D8, 0x3517, 0x3540, 0x356B, 
-    0x358A, 0x35B5, 0x35E0, 0x3601, 0x3626, 0x3653, 0x3678, 0x368F, 
-    0x36C8, 0x3707, 0x373E, 0x375D, 0x379A, 0x37C3, 0x37FA, 0x382D, 
-    0x3864, 0x3881, 0x38AE, 0x38D7, 0x3902, 0x392B, 0x3966, 0x399D, 
-    0x39D2, 0x3A03, 0x3A30, 0x3A5F, 0x3A88, 0x3AC1, 0x3AF6, 0x3B1F, 
-    0x3B3C, 0x3B5F, 0x3B8E, 0x3BC1, 0x3BEA, 0x3C11, 0x3C38, 0x3C6D, 
-    0x3CAA, 0x3CBB, 0x3CF0, 0x3D27, 0x3D50, 0x3D7F, 0x3DB4, 0x3DEF, 
-    0x3E24, 0x3E55, 0x3E82, 0x3EB3, 0x3EE6, 0x3F0F, 0x3F36, 0x3F5D, 
-    0x3F8E, 0x3FC5, 0x4002, 0x4031, 0x405C, 0x407D, 0x40A6, 0x40D3, 
-    0x4100, 0x4139, 0x416E, 0x419B, 0x41D8, 0x41FD, 0x4234, 0x4261, 
-    0x4296, 0x42C7, 0x42F6, 0x4323, 0x4344, 0x436F, 0x4390, 0x43C7, 
-    0x43F0, 0x4427, 0x4452, 0x446B, 0x4484, 0x44BB, 0x44E8, 0x4527, 
-    0x455E, 0x4581, 0x45B8, 0x45E1, 0x460C, 0x4629, 0x4652, 0x4699, 
-    0x46D8, 0x4703, 0x4728, 0x4751, 0x4782, 0x47B3, 0x47E2, 0x480D, 
-    0x484A, 0x4877, 0x48A0, 0x48C5, 0x48FE, 0x494B, 0x4970, 0x49B5, 
-    0x49E6, 0x4A0D, 0x4A40, 0x4A79, 0x4AB2, 0x4AE5, 0x4B18, 0x4B49, 
-    0x4B7C, 0x4BAB, 0x4BD8, 0x4C0B, 0x4C36, 0x4C61, 0x4C96, 0x4CC3, 
-    0x4D02, 0x4D31, 0x4D58, 0x4D87, 0x4DC2, 0x4DFB, 0x4E20, 0x4E43, 
-    0x4E80, 0x4EA7, 0x4EE2, 0x4F25, 0x4F54, 0x4F81, 0x4FB4, 0x4FE9, 
-    0x5026, 0x5061, 0x5090, 0x50C1, 0x50F2, 0x5123, 0x5152, 0x5189, 
-    0x51BC, 0x51F5, 0x522E, 0x525D, 0x529A, 0x52C3, 0x52FE, 0x5325, 
-    0x5368, 0x538F, 0x53D2, 0x540D, 0x5444, 0x546F, 0x548A, 0x54C9, 
-    0x54EE, 0x5525, 0x555A, 0x558B, 0x55BA, 0x55F3, 0x561E, 0x564B, 
-    0x5686, 0x56AF, 0x56EA, 0x571D, 0x5752, 0x5797, 0x57CC, 0x57F1, 
-    0x580E, 0x5845, 0x587E, 0x589F, 0x58C8, 0x590D, 0x593C, 0x597D, 
-    0x59AC, 0x59E1, 0x5A0E, 0x5A59, 0x5A8E, 0x5AAB, 0x5AE8, 0x5B2D, 
-    0x5B62, 0x5BAB, 0x5BCC, 0x5C0D, 0x5C2A, 0x5C5D, 0x5C92, 0x5CC1, 
-    0x5CE0, 0x5D19, 0x5D4C, 0x5D6F, 0x5DAA, 0x5DDB, 0x5E12, 0x5E39, 
-    0x5E6C, 0x5E93, 0x5ED0, 0x5F09, 0x5F48, 0x5F6D, 0x5FB0, 0x5FF1, 
-    0x603A, 0x6079, 0x60B0, 0x60F3, 0x613C, 0x617B, 0x61B4, 0x61EF, 
-    0x622C, 0x6255, 0x6284, 0x62AF, 0x62E6, 0x6311, 0x6342, 0x6373, 
-    0x63B2, 0x63FD, 0x643C, 0x6475, 0x6496, 0x64B9, 0x64E6, 0x6523, 
-    0x6568, 0x65A1, 0x65D6, 0x6603, 0x663C, 0x6689, 0x66CA, 0x66F7, 
-    0x671E, 0x676D, 0x6794, 0x67C5, 0x67F2, 0x6831, 0x6876, 0x68AB, 
-    0x68D8, 0x690F, 0x694A, 0x6981, 0x69C4, 0x69FB, 0x6A48, 0x6A8B, 
-    0x6AD6, 0x6B11, 0x6B5A, 0x6B9F, 0x6BD0, 0x6C01, 0x6C2C, 0x6C67, 
-    0x6C90, 0x6CD9, 0x6D0C, 0x6D45, 0x6D78, 0x6DBF, 0x6DF2, 0x6E23, 
-    0x6E5C, 0x6E8B, 0x6EC2, 0x6EEF, 0x6F3A, 0x6F71, 0x6FB6, 0x6FF9, 
-    0x702C, 0x7073, 0x70B2, 0x70EB, 0x712E, 0x7163, 0x719A, 0x71D9, 
-    0x7214, 0x7257, 0x7282, 0x72B5, 0x72DA, 0x7313, 0x735E, 0x7389, 
-    0x73B4, 0x73EB, 0x7432, 0x746F, 0x74A0, 0x74CF, 0x74FA, 0x7535, 
-    0x756A, 0x75A1, 0x75C6, 0x75FB, 0x761E, 0x764D, 0x7682, 0x76BB, 
-    0x76F0, 0x771D, 0x7746, 0x7773, 0x77B6, 0x77DF, 0x780C, 0x7847
+    0x0000, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 
+    0x000A, 0x000B, 0x000C, 0x000D, 0x0010, 0x0011, 0x0012, 0x0013, 
+    0x0014, 0x0017, 0x0018, 0x0019, 0x001A, 0x001D, 0x001E, 0x001F, 
+    0x0020, 0x0021, 0x0022, 0x0025, 0x002A, 0x002D, 0x0030, 0x0031, 
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0039, 0x003C, 0x003D, 
+    0x003E, 0x0041, 0x0044, 0x0045, 0x004A, 0x004B, 0x0050, 0x0051, 
+    0x0054, 0x0057, 0x005A, 0x005B, 0x005C, 0x005F, 0x0064, 0x006B, 
+    0x006C, 0x0071, 0x0076, 0x007B, 0x007E, 0x007F, 0x0082, 0x0087, 
+    0x008C, 0x008F, 0x0090, 0x0093, 0x009A, 0x009B, 0x009E, 0x00A5, 
+    0x00A6, 0x00A9, 0x00AC, 0x00AF, 0x00B4, 0x00B7, 0x00B8, 0x00BD, 
+    0x00C0, 0x00C3, 0x00CA, 0x00CF, 0x00DA, 0x00DF, 0x00E6, 0x00ED, 
+    0x00F4, 0x00FD, 0x00FE, 0x0107, 0x010C, 0x0111, 0x0116, 0x011D, 
+    0x0122, 0x0125, 0x0126, 0x012D, 0x0130, 0x0139, 0x0140, 0x0145, 
+    0x0148, 0x014D, 0x0152, 0x0153, 0x015A, 0x015F, 0x0162, 0x0169, 
+    0x0172, 0x0179, 0x0182, 0x0187, 0x0188, 0x018D, 0x0190, 0x0193, 
+    0x019A, 0x019D, 0x01A0, 0x01AB, 0x01AC, 0x01B1, 0x01B2, 0x01B9, 
+    0x01BE, 0x01C5, 0x01CC, 0x01D1, 0x01D4, 0x01D7, 0x01DE, 0x01DF, 
+    0x01EC, 0x01EF, 0x01F4, 0x0201, 0x020A, 0x020D, 0x0212, 0x0215, 
+    0x0218, 0x021F, 0x0226, 0x022B, 0x022E, 0x0237, 0x023C, 0x0241, 
+    0x0248, 0x024D, 0x0254, 0x0261, 0x0266, 0x0269, 0x0274, 0x027F, 
+    0x0280, 0x028B, 0x0292, 0x0299, 0x029C, 0x029F, 0x02AA, 0x02B7, 
+    0x02BE, 0x02C3, 0x02C8, 0x02CB, 0x02CE, 0x02D1, 0x02D4, 0x02E3, 
+    0x02EC, 0x02F5, 0x02FE, 0x0309, 0x030C, 0x031D, 0x0322, 0x0325, 
+    0x032C, 0x0339, 0x0344, 0x034B, 0x0352, 0x0355, 0x0360, 0x0367, 
+    0x036E, 0x0373, 0x037E, 0x0383, 0x038E, 0x0393, 0x0394, 0x03A1, 
+    0x03A8, 0x03AF, 0x03B2, 0x03B7, 0x03BE, 0x03C7, 0x03CC, 0x03CF, 
+    0x03D8, 0x03E1, 0x03EA, 0x03EF, 0x03FA, 0x0401, 0x0406, 0x040D, 
+    0x0412, 0x0417, 0x041C, 0x0427, 0x0430, 0x0435, 0x0440, 0x0447, 
+    0x0450, 0x0459, 0x0462, 0x046F, 0x0478, 0x047B, 0x0484, 0x048F, 
+    0x049E, 0x04A5, 0x04AC, 0x04AF, 0x04B4, 0x04BD, 0x04C8, 0x04D1, 
+    0x04DC, 0x04EB, 0x04F0, 0x04FF, 0x0502, 0x050B, 0x0516, 0x051D, 
+    0x052A, 0x0537, 0x0542, 0x054B, 0x0550, 0x055F, 0x0562, 0x056B, 
+    0x0572, 0x057F, 0x058A, 0x0591, 0x0598, 0x05A1, 0x05AA, 0x05B9, 
+    0x05BC, 0x05C5, 0x05D2, 0x05DB, 0x05E0, 0x05EB, 0x05F2, 0x05FF, 
+    0x0608, 0x060F, 0x061E, 0x0627, 0x0636, 0x0649, 0x064C, 0x0653, 
+    0x065C, 0x066D, 0x0678, 0x0687, 0x0694, 0x069B, 0x06A4, 0x06AB, 
+    0x06B4, 0x06B7, 0x06BE, 0x06CB, 0x06CE, 0x06D1, 0x06DA, 0x06E1, 
+    0x06E6, 0x06F1, 0x06F4, 0x06FB, 0x070A, 0x0713, 0x071C, 0x0723, 
+    0x072E, 0x0731, 0x0738, 0x0749, 0x0750, 0x0759, 0x0764, 0x076F, 
+    0x077A, 0x0783, 0x078C, 0x0797, 0x07A6, 0x07C1, 0x07C8, 0x07CD, 
+    0x07DA, 0x07E3, 0x07F2, 0x07F5, 0x07FE, 0x080F, 0x0818, 0x0825, 
+    0x082E, 0x083B, 0x0844, 0x0851, 0x085A, 0x0865, 0x0878, 0x088D, 
+    0x089C, 0x08A3, 0x08AA, 0x08B1, 0x08C0, 0x08C9, 0x08D0, 0x08D9, 
+    0x08E4, 0x08F1, 0x0900, 0x0909, 0x0918, 0x0925, 0x092E, 0x093D, 
+    0x094C, 0x0959, 0x0966, 0x096F, 0x0976, 0x0983, 0x098E, 0x09A5, 
+    0x09B0, 0x09BB, 0x09C4, 0x09D1, 0x09D8, 0x09E5, 0x09F6, 0x0A01, 
+    0x0A0C, 0x0A1D, 0x0A22, 0x0A25, 0x0A34, 0x0A47, 0x0A54, 0x0A67, 
+    0x0A7E, 0x0A95, 0x0AA8, 0x0AB3, 0x0AC4, 0x0AC9, 0x0AD2, 0x0ADD, 
+    0x0AE6, 0x0AF1, 0x0AFC, 0x0B07, 0x0B10, 0x0B1D, 0x0B24, 0x0B31, 
+    0x0B3A, 0x0B49, 0x0B5C, 0x0B6F, 0x0B7C, 0x0B8B, 0x0B98, 0x0B9D, 
+    0x0BAA, 0x0BB7, 0x0BCA, 0x0BD5, 0x0BEA, 0x0BF5, 0x0BFC, 0x0BFF, 
+    0x0C0A, 0x0C19, 0x0C22, 0x0C25, 0x0C34, 0x0C41, 0x0C50, 0x0C5F, 
+    0x0C68, 0x0C75, 0x0C82, 0x0C95, 0x0CA0, 0x0CAB, 0x0CB2, 0x0CBF, 
+    0x0CCE, 0x0CD9, 0x0CEC, 0x0CF5, 0x0D02, 0x0D0B, 0x0D20, 0x0D27, 
+    0x0D30, 0x0D41, 0x0D4E, 0x0D5B, 0x0D6C, 0x0D71, 0x0D7E, 0x0D87, 
+    0x0DA4, 0x0DB7, 0x0DC8, 0x0DD1, 0x0DE0, 0x0DE9, 0x0DF2, 0x0E01, 
+    0x0E16, 0x0E21, 0x0E32, 0x0E41, 0x0E56, 0x0E67, 0x0E76, 0x0E83, 
+    0x0E92, 0x0EA7, 0x0EB6, 0x0EC5, 0x0ED6, 0x0EF3, 0x0EFE, 0x0F1D, 
+    0x0F28, 0x0F37, 0x0F40, 0x0F49, 0x0F54, 0x0F5F, 0x0F6A, 0x0F7B, 
+    0x0F8A, 0x0F9B, 0x0FAE, 0x0FBB, 0x0FCC, 0x0FD3, 0x0FE8, 0x0FF9, 
+    0x1004, 0x101B, 0x1022, 0x102B, 0x1042, 0x1051, 0x105A, 0x106B, 
+    0x107A, 0x1081, 0x1092, 0x109D, 0x10AC, 0x10BF, 0x10CE, 0x10D7, 
+    0x10E8, 0x10FD, 0x110E, 0x111D, 0x112E, 0x1137, 0x114E, 0x115D, 
+    0x116C, 0x117F, 0x118C, 0x1197, 0x11A0, 0x11B1, 0x11C2, 0x11CD, 
+    0x11DC, 0x11E7, 0x11FA, 0x1209, 0x1216, 0x1227, 0x1236, 0x1243, 
+    0x1254, 0x1259, 0x1266, 0x127F, 0x1284, 0x1293, 0x12A8, 0x12C3, 
+    0x12D8, 0x12ED, 0x12F8, 0x1307, 0x1314, 0x1321, 0x1330, 0x134B, 
+    0x1362, 0x1371, 0x1382, 0x139B, 0x13AC, 0x13B1, 0x13C8, 0x13E3, 
+    0x13F2, 0x1407, 0x1414, 0x1421, 0x142C, 0x1437, 0x143E, 0x144B, 
+    0x145A, 0x146B, 0x1484, 0x148D, 0x149C, 0x14AB, 0x14BA, 0x14C5, 
+    0x14D0, 0x14DF, 0x14F0, 0x1505, 0x1520, 0x1527, 0x1536, 0x153B, 
+    0x154E, 0x1559, 0x156C, 0x157F, 0x158A, 0x159B, 0x15AC, 0x15C1, 
+    0x15CE, 0x15E1, 0x15EE, 0x15FF, 0x1606, 0x1615, 0x1632, 0x1647, 
+    0x1652, 0x165F, 0x1672, 0x167F, 0x1696, 0x16A5, 0x16AC, 0x16BB, 
+    0x16D2, 0x16D9, 0x16E4, 0x16F1, 0x16FC, 0x1707, 0x1714, 0x1731, 
+    0x1740, 0x174D, 0x175A, 0x1765, 0x1772, 0x1785, 0x179A, 0x17AF, 
+    0x17D0, 0x17ED, 0x17FC, 0x180B, 0x181A, 0x1827, 0x183A, 0x184F, 
+    0x1860, 0x186F, 0x1888, 0x18A3, 0x18B2, 0x18C3, 0x18D4, 0x18EB, 
+    0x18FA, 0x18FF, 0x1910, 0x191B, 0x192C, 0x193F, 0x1958, 0x196B, 
+    0x1976, 0x1989, 0x1998, 0x19A5, 0x19BA, 0x19C9, 0x19DE, 0x19E7, 
+    0x19F0, 0x1A03, 0x1A1A, 0x1A2D, 0x1A3E, 0x1A55, 0x1A6C, 0x1A79, 
+    0x1A8A, 0x1A99, 0x1AA8, 0x1AB5, 0x1AC2, 0x1AD1, 0x1AE4, 0x1AF7, 
+    0x1B0C, 0x1B1B, 0x1B34, 0x1B41, 0x1B54, 0x1B65, 0x1B78, 0x1B89, 
+    0x1BA2, 0x1BB5, 0x1BC4, 0x1BD1, 0x1BDA, 0x1BE9, 0x1BFC, 0x1C13, 
+    0x1C2A, 0x1C39, 0x1C50, 0x1C5F, 0x1C6E, 0x1C7D, 0x1C8C, 0x1C9B, 
+    0x1CAE, 0x1CCB, 0x1CE4, 0x1CED, 0x1D00, 0x1D11, 0x1D1E, 0x1D2F, 
+    0x1D3A, 0x1D51, 0x1D6C, 0x1D77, 0x1D8C, 0x1DA3, 0x1DAC, 0x1DCB, 
+    0x1DD8, 0x1DE9, 0x1DF6, 0x1E09, 0x1E20, 0x1E3F, 0x1E5A, 0x1E6B, 
+    0x1E78, 0x1E8D, 0x1E9C, 0x1EAB, 0x1EC0, 0x1ECD, 0x1EDE, 0x1EF7, 
+    0x1F08, 0x1F15, 0x1F22, 0x1F39, 0x1F50, 0x1F6B, 0x1F7A, 0x1F8B, 
+    0x1F92, 0x1FA3, 0x1FB0, 0x1FC3, 0x1FDA, 0x1FE9, 0x1FFC, 0x2013, 
+    0x2030, 0x2041, 0x2048, 0x2057, 0x2074, 0x2081, 0x208E, 0x20A7, 
+    0x20B6, 0x20C1, 0x20D6, 0x20E9, 0x2100, 0x2119, 0x212E, 0x2143, 
+    0x2152, 0x2169, 0x2176, 0x2189, 0x2194, 0x21A7, 0x21BC, 0x21C7, 
+    0x21D4, 0x21ED, 0x2204, 0x2215, 0x221C, 0x222B, 0x2242, 0x224D, 
+    0x2260, 0x227B, 0x228E, 0x22A1, 0x22B4, 0x22D1, 0x22DA, 0x22F5, 
+    0x2308, 0x230D, 0x2320, 0x2335, 0x2346, 0x234F, 0x2360, 0x2375, 
+    0x2384, 0x2393, 0x23A2, 0x23B7, 0x23CC, 0x23DF, 0x23EC, 0x2405, 
+    0x241C, 0x2431, 0x2448, 0x2455, 0x2460, 0x2485, 0x24A2, 0x24B7, 
+    0x24C4, 0x24D5, 0x24F6, 0x2507, 0x251E, 0x2537, 0x2542, 0x2561, 
+    0x2578, 0x2587, 0x259A, 0x25B5, 0x25C8, 0x25DD, 0x25F0, 0x2615, 
+    0x2636, 0x2649, 0x265C, 0x2673, 0x2680, 0x2689, 0x269E, 0x26B5, 
+    0x26C0, 0x26D7, 0x26F4, 0x2705, 0x2712, 0x272B, 0x273C, 0x274B, 
+    0x2760, 0x2775, 0x279A, 0x27AF, 0x27BE, 0x27D7, 0x27E6, 0x27F7, 
+    0x2818, 0x282F, 0x283E, 0x2857, 0x2864, 0x2879, 0x288E, 0x28A3, 
+    0x28BC, 0x28CD, 0x28E4, 0x2909, 0x291A, 0x292D, 0x293E, 0x295F, 
+    0x2964, 0x2971, 0x2982, 0x299B, 0x29C2, 0x29D1, 0x29DC, 0x29F3, 
+    0x2A0A, 0x2A1B, 0x2A3A, 0x2A4B, 0x2A64, 0x2A83, 0x2A9C, 0x2ABD, 
+    0x2ACE, 0x2AE5, 0x2B00, 0x2B1B, 0x2B2C, 0x2B43, 0x2B54, 0x2B75, 
+    0x2B8E, 0x2BA5, 0x2BB2, 0x2BBF, 0x2BD2, 0x2BE7, 0x2BFE, 0x2C1D, 
+    0x2C32, 0x2C49, 0x2C62, 0x2C73, 0x2C90, 0x2CA9, 0x2CC0, 0x2CDB, 
+    0x2CEA, 0x2D01, 0x2D0C, 0x2D29, 0x2D3C, 0x2D5B, 0x2D74, 0x2D8B, 
+    0x2DA2, 0x2DBB, 0x2DD2, 0x2DE1, 0x2DF0, 0x2E07, 0x2E16, 0x2E29, 
+    0x2E40, 0x2E57, 0x2E74, 0x2E87, 0x2E94, 0x2EAB, 0x2EC2, 0x2ED5, 
+    0x2EE8, 0x2F01, 0x2F1E, 0x2F35, 0x2F44, 0x2F63, 0x2F74, 0x2F91, 
+    0x2FA2, 0x2FBB, 0x2FCA, 0x2FDB, 0x2FF2, 0x300D, 0x3026, 0x303D, 
+    0x3050, 0x306D, 0x3086, 0x3093, 0x30A4, 0x30BF, 0x30DA, 0x30ED, 
+    0x3102, 0x3123, 0x3130, 0x3153, 0x3162, 0x317D, 0x3192, 0x31A5, 
+    0x31B4, 0x31C9, 0x31E0, 0x31F3, 0x320C, 0x3229, 0x3244, 0x325B, 
+    0x3276, 0x3295, 0x32A4, 0x32B9, 0x32D8, 0x32F3, 0x330A, 0x331D, 
+    0x3330, 0x333B, 0x3346, 0x335B, 0x3370, 0x338D, 0x339E, 0x33BF, 
+    0x33E0, 0x33FB, 0x3414, 0x341F, 0x342E, 0x3441, 0x3452, 0x3463, 
+    0x347C, 0x3495, 0x34AA, 0x34C3, 0x34D8, 0x34F9, 0x3512, 0x351D, 
+    0x353E, 0x3563, 0x357A, 0x358F, 0x35A2, 0x35C3, 0x35D6, 0x35EB, 
+    0x3606, 0x361D, 0x363A, 0x3657, 0x366E, 0x3687, 0x36A4, 0x36BB, 
+    0x36CC, 0x36E7, 0x370C, 0x3719, 0x3736, 0x3747, 0x3762, 0x3775, 
+    0x3782, 0x3799, 0x37AE, 0x37C1, 0x37DA, 0x37EF, 0x37FC, 0x3815, 
+    0x3822, 0x3845, 0x3850, 0x3869, 0x3876, 0x3883, 0x388E, 0x38B1, 
+    0x38C8, 0x38EB, 0x3908, 0x3927, 0x3940, 0x3953, 0x3960, 0x3983, 
+    0x399E, 0x39B1, 0x39C8, 0x39DD, 0x3A00, 0x3A1F, 0x3A34, 0x3A53, 
+    0x3A6C, 0x3A79, 0x3A8A, 0x3A9F, 0x3AB8, 0x3ACD, 0x3AE2, 0x3AF7, 
+    0x3B0E, 0x3B27, 0x3B38, 0x3B4D, 0x3B74, 0x3B91, 0x3BAC, 0x3BCB, 
+    0x3BE2, 0x3BF9, 0x3C14, 0x3C33, 0x3C42, 0x3C5B, 0x3C72, 0x3C83, 
+    0x3C9C, 0x3CBB, 0x3CD6, 0x3CF1, 0x3D0C, 0x3D25, 0x3D36, 0x3D49, 
+    0x3D54, 0x3D5F, 0x3D78, 0x3D8D, 0x3DA8, 0x3DC5, 0x3DDC, 0x3DF3, 
+    0x3E06, 0x3E1B, 0x3E2E, 0x3E41, 0x3E56, 0x3E73, 0x3E8C, 0x3EA9, 
+    0x3ECA, 0x3ED3, 0x3EDC, 0x3EFB, 0x3F12, 0x3F37, 0x3F4A, 0x3F63, 
+    0x3F74, 0x3F89, 0x3FA4, 0x3FBD, 0x3FDA, 0x3FF1, 0x4016, 0x4037, 
+    0x404C, 0x4063, 0x407E, 0x4091, 0x40AC, 0x40C9, 0x40DE, 0x40EB, 
+    0x4112, 0x4121, 0x413C, 0x414D, 0x4164, 0x417B, 0x418C, 0x41AB, 
+    0x41BE, 0x41DB, 0x41F6, 0x4211, 0x4234, 0x4251, 0x4264, 0x4277, 
+    0x4290, 0x429F, 0x42B2, 0x42C7, 0x42DC, 0x42ED, 0x430A, 0x431D, 
+    0x4338, 0x4355, 0x4372, 0x4389, 0x43A8, 0x43BB, 0x43D6, 0x43FF, 
+    0x4414, 0x4421, 0x443A, 0x4451, 0x4472, 0x4487, 0x44A0, 0x44B5, 
+    0x44D6, 0x44EF, 0x4508, 0x451F, 0x4538, 0x454D, 0x4566, 0x457B, 
+    0x4588, 0x45A7, 0x45B4, 0x45C3, 0x45D6, 0x45F3, 0x460E, 0x461D, 
+    0x4638, 0x464D, 0x4670, 0x4683, 0x469C, 0x46A7, 0x46B6, 0x46C3, 
+    0x46D0, 0x46E9, 0x4708, 0x471B, 0x4736, 0x475B, 0x4776, 0x4797, 
+    0x47AE, 0x47BD, 0x47D2, 0x47EB, 0x480A, 0x481B, 0x4834, 0x4853, 
+    0x4860, 0x4871, 0x487E, 0x4899, 0x48A8, 0x48CF, 0x48F0, 0x490F, 
+    0x4930, 0x493F, 0x495C, 0x4973, 0x4982, 0x4995, 0x49AC, 0x49C5, 
+    0x49DE, 0x49F5, 0x4A10, 0x4A25, 0x4A40, 0x4A57, 0x4A6C, 0x4A8D, 
+    0x4AAA, 0x4AC3, 0x4AD8, 0x4AE7, 0x4B02, 0x4B13, 0x4B28, 0x4B49, 
+    0x4B62, 0x4B8D, 0x4BB0, 0x4BC1, 0x4BD6, 0x4BF1, 0x4C1C, 0x4C3D, 
+    0x4C4E, 0x4C61, 0x4C76, 0x4C8B, 0x4CAA, 0x4CBF, 0x4CE4, 0x4CFB, 
+    0x4D1E, 0x4D33, 0x4D52, 0x4D6B, 0x4D86, 0x4D9B, 0x4DB8, 0x4DD5, 
+    0x4DEC, 0x4E09, 0x4E1C, 0x4E2F, 0x4E4A, 0x4E5B, 0x4E7E, 0x4E95, 
+    0x4EAA, 0x4EC1, 0x4ED6, 0x4EEF, 0x4F0C, 0x4F1B, 0x4F3A, 0x4F63, 
+    0x4F7A, 0x4F97, 0x4FAA, 0x4FBF, 0x4FD2, 0x4FE7, 0x5002, 0x5023, 
+    0x503E, 0x505D, 0x5078, 0x508F, 0x509E, 0x50B3, 0x50C2, 0x50E5, 
+    0x5100, 0x5117, 0x5128, 0x513F, 0x5164, 0x5181, 0x51A8, 0x51BF, 
+    0x51D8, 0x51FB, 0x5206, 0x5223, 0x523A, 0x525B, 0x5270, 0x5287, 
+    0x52AE, 0x52C5, 0x52EA, 0x5301, 0x531A, 0x532D, 0x534C, 0x5367, 
+    0x537E, 0x5391, 0x53B0, 0x53C5, 0x53E0, 0x53FB, 0x5418, 0x5437, 
+    0x544C, 0x5465, 0x5486, 0x54A5, 0x54C0, 0x54E1, 0x54F0, 0x5513, 
+    0x552E, 0x5543, 0x5558, 0x5577, 0x5594, 0x55AB, 0x55BC, 0x55E1, 
+    0x5600, 0x5615, 0x5628, 0x5649, 0x566C, 0x5689, 0x56A8, 0x56C1, 
+    0x56E0, 0x56FD, 0x570C, 0x5713, 0x5728, 0x5743, 0x5768, 0x5779, 
+    0x578E, 0x57B7, 0x57C6, 0x57DD, 0x57FC, 0x5817, 0x582E, 0x5843, 
+    0x585E, 0x5873, 0x5898, 0x58AB, 0x58C4, 0x58CF, 0x58F2, 0x5903, 
+    0x592E, 0x5941, 0x5958, 0x596B, 0x5994, 0x59B3, 0x59C8, 0x59E1, 
+    0x59FE, 0x5A25, 0x5A44, 0x5A5B, 0x5A7A, 0x5A8D, 0x5AA0, 0x5AAD, 
+    0x5ABE, 0x5AE5, 0x5AF6, 0x5B0F, 0x5B30, 0x5B3F, 0x5B52, 0x5B67, 
+    0x5B7C, 0x5B9B, 0x5BC2, 0x5BDB, 0x5BF2, 0x5C0B, 0x5C34, 0x5C45, 
+    0x5C64, 0x5C7B, 0x5C9A, 0x5CB1, 0x5CC8, 0x5CDF, 0x5D14, 0x5D2D, 
+    0x5D4A, 0x5D53, 0x5D68, 0x5D87, 0x5DA6, 0x5DD1, 0x5DEC, 0x5E09, 
+    0x5E22, 0x5E3F, 0x5E6C, 0x5E7F, 0x5E8E, 0x5EBD, 0x5ED0, 0x5EDB, 
+    0x5EEE, 0x5F15, 0x5F22, 0x5F43, 0x5F58, 0x5F6D, 0x5F88, 0x5F9D, 
+    0x5FA8, 0x5FC3, 0x5FE2, 0x5FFB, 0x6016, 0x6025, 0x603A, 0x6057, 
+    0x6076, 0x608D, 0x60A8, 0x60BD, 0x60E0, 0x60F1, 0x6108, 0x611D, 
+    0x613C, 0x6151, 0x6164, 0x6181, 0x61A2, 0x61BF, 0x61DC, 0x61F9, 
+    0x621C, 0x6237, 0x6242, 0x6263, 0x6286, 0x629D, 0x62C8, 0x62F7, 
+    0x6312, 0x6329, 0x6352, 0x6367, 0x638A, 0x63AB, 0x63CE, 0x63F3, 
+    0x6418, 0x6439, 0x6458, 0x6477, 0x6492, 0x64A9, 0x64CE, 0x64F3, 
+    0x650C, 0x6527, 0x6536, 0x6549, 0x6566, 0x6577, 0x6592, 0x65AD, 
+    0x65CA, 0x65D5, 0x65F6, 0x6607, 0x6628, 0x6643, 0x665A, 0x6675, 
+    0x669A, 0x66BD, 0x66E6, 0x6705, 0x6726, 0x673B, 0x6760, 0x6779, 
+    0x6782, 0x6797, 0x67A6, 0x67BF, 0x67D4, 0x67F3, 0x6812, 0x6839, 
+    0x6858, 0x687D, 0x6892, 0x68AF, 0x68C8, 0x68E7, 0x68F6, 0x6915, 
+    0x6930, 0x6955, 0x697E, 0x699B, 0x69C0, 0x69D1, 0x69EE, 0x69FF, 
+    0x6A16, 0x6A33, 0x6A66, 0x6A7F, 0x6A8E, 0x6AAB, 0x6AC0, 0x6AD9, 
+    0x6AEE, 0x6B0F, 0x6B2E, 0x6B53, 0x6B74, 0x6B95, 0x6BAA, 0x6BC1, 
+    0x6BD8, 0x6BF3, 0x6C10, 0x6C25, 0x6C4C, 0x6C67, 0x6C84, 0x6CAF, 
+    0x6CC8, 0x6CE5, 0x6D00, 0x6D25, 0x6D4E, 0x6D73, 0x6D92, 0x6DB5, 
+    0x6DDE, 0x6E05, 0x6E1A, 0x6E3B, 0x6E64, 0x6E87, 0x6EAA, 0x6EBD, 
+    0x6EDC, 0x6EF5, 0x6F0E, 0x6F21, 0x6F3A, 0x6F51, 0x6F76, 0x6F89, 
+    0x6FA0, 0x6FC9, 0x6FEA, 0x7005, 0x701E, 0x7039, 0x7058, 0x7077, 
+    0x708C, 0x70B7, 0x70D4, 0x70F7, 0x7108, 0x7121, 0x713A, 0x714D, 
+    0x7174, 0x718B, 0x71A4, 0x71C3, 0x71DC, 0x71ED, 0x720A, 0x7223, 
+    0x7256, 0x726D, 0x728E, 0x72B5, 0x72D4, 0x72F5, 0x7318, 0x732F, 
+    0x734C, 0x737D, 0x7394, 0x73B3, 0x73D4, 0x73F1, 0x740E, 0x742D, 
+    0x7452, 0x746D, 0x7488, 0x74A1, 0x74C0, 0x74E7, 0x7500, 0x7517, 
+    0x753C, 0x7557, 0x7580, 0x7599, 0x75AC, 0x75C5, 0x75E0, 0x75F1, 
+    0x7606, 0x7623, 0x7640, 0x7667, 0x768C, 0x76A5, 0x76B8, 0x76CD, 
+    0x76E4, 0x7705, 0x771C, 0x773D, 0x7764, 0x777D, 0x77A2, 0x77B9, 
+    0x77D4, 0x77E9, 0x7804, 0x781B, 0x7830, 0x784F, 0x786C, 0x7887, 
+    0x78A2, 0x78BD, 0x78DA, 0x78ED, 0x7900, 0x791D, 0x7936, 0x794D, 
+    0x795A, 0x7977, 0x798A, 0x79A9, 0x79C0, 0x79DB, 0x79FA, 0x7A19, 
+    0x7A30, 0x7A43, 0x7A5E, 0x7A71, 0x7A88, 0x7AA5, 0x7AB6, 0x7AD5, 
+    0x7AFA, 0x7B0D, 0x7B24, 0x7B39, 0x7B52, 0x7B75, 0x7B8E, 0x7BA3
     
 };
-const uint16_t bin_count = sizeof(bin_angle_to_address_lut) / sizeof(bin_angle_to_address_lut[0]);
+const size_t bin_count = sizeof(bin_angle_to_address_lut) / sizeof(bin_angle_to_address_lut[0]);
+
+const gv_real chord_to_mdeg_lut[CHORD_LUT_SIZE + 1] = {
+    0.0000, 149.7593, 299.5188, 449.2788, 599.0396, 748.8014, 898.5645, 1048.3291, 
+    1198.0956, 1347.8640, 1497.6348, 1647.4081, 1797.1843, 1946.9635, 2096.7460, 2246.5322, 
+    2396.3221, 2546.1162, 2695.9146, 2845.7176, 2995.5255, 3145.3385, 3295.1569, 3444.9809, 
+    3594.8108, 3744.6469, 3894.4893, 4044.3384, 4194.1945, 4344.0577, 4493.9284, 4643.8067, 
+    4793.6930, 4943.5875, 5093.4905, 5243.4021, 5393.3228, 5543.2527, 5693.1921, 5843.1413, 
+    5993.1004, 6143.0699, 6293.0499, 6443.0406, 6593.0425, 6743.0556, 6893.0803, 7043.1168, 
+    7193.1654, 7343.2264, 7493.3000, 7643.3865, 7793.4860, 7943.5990, 8093.7257, 8243.8662, 
+    8394.0209, 8544.1901, 8694.3740, 8844.5728, 8994.7869, 9145.0164, 9295.2618, 9445.5231, 
+    9595.8007, 9746.0948, 9896.4058, 10046.7338, 10197.0792, 10347.4421, 10497.8230, 10648.2219, 
+    10798.6393, 10949.0753, 11099.5303, 11250.0044, 11400.4980, 11551.0114, 11701.5447, 11852.0983, 
+    12002.6725, 12153.2674, 12303.8834, 12454.5208, 12605.1798, 12755.8606, 12906.5636, 13057.2891, 
+    13208.0372, 13358.8083, 13509.6026, 13660.4204, 13811.2620, 13962.1276, 14113.0176, 14263.9322, 
+    14414.8716, 14565.8362, 14716.8263, 14867.8420, 15018.8836, 15169.9516, 15321.0460, 15472.1673, 
+    15623.3156, 15774.4913, 15925.6947, 16076.9259, 16228.1853, 16379.4732, 16530.7899, 16682.1356, 
+    16833.5106, 16984.9152, 17136.3496, 17287.8143, 17439.3093, 17590.8351, 17742.3919, 17893.9800, 
+    18045.5997, 18197.2512, 18348.9349, 18500.6510, 18652.3999, 18804.1817, 18955.9969, 19107.8456, 
+    19259.7282, 19411.6450, 19563.5962, 19715.5822, 19867.6032, 20019.6595, 20171.7515, 20323.8793, 
+    20476.0434, 20628.2440, 20780.4814, 20932.7558, 21085.0677, 21237.4173, 21389.8048, 21542.2306, 
+    21694.6950, 21847.1983, 21999.7407, 22152.3227, 22304.9444, 22457.6062, 22610.3084, 22763.0513, 
+    22915.8352, 23068.6603, 23221.5271, 23374.4358, 23527.3867, 23680.3802, 23833.4164, 23986.4959, 
+    24139.6187, 24292.7854, 24445.9961, 24599.2512, 24752.5510, 24905.8958, 25059.2859, 25212.7217, 
+    25366.2035, 25519.7315, 25673.3061, 25826.9277, 25980.5965, 26134.3128, 26288.0770, 26441.8894, 
+    26595.7503, 26749.6600, 26903.6190, 27057.6274, 27211.6856, 27365.7940, 27519.9529, 27674.1625, 
+    27828.4233, 27982.7356, 28137.0996, 28291.5158, 28445.9844, 28600.5058, 28755.0804, 28909.7084, 
+    29064.3903, 29219.1262, 29373.9167, 29528.7620, 29683.6624, 29838.6184, 29993.6302, 30148.6982, 
+    30303.8227, 30459.0041, 30614.2428, 30769.5390, 30924.8932, 31080.3057, 31235.7767, 31391.3068, 
+    31546.8962, 31702.5453, 31858.2545, 32014.0241, 32169.8544, 32325.7459, 32481.6988, 32637.7137, 
+    32793.7907, 32949.9303, 33106.1328, 33262.3987, 33418.7282, 33575.1218, 33731.5798, 33888.1026, 
+    34044.6906, 34201.3441, 34358.0635, 34514.8492, 34671.7016, 34828.6210, 34985.6078, 35142.6625, 
+    35299.7853, 35456.9767, 35614.2371, 35771.5669, 35928.9664, 36086.4360, 36243.9761, 36401.5871, 
+    36559.2695, 36717.0236, 36874.8497, 37032.7484, 37190.7200, 37348.7648, 37506.8834, 37665.0761, 
+    37823.3433, 37981.6854, 38140.1029, 38298.5961, 38457.1655, 38615.8114, 38774.5344, 38933.3347, 
+    39092.2129, 39251.1693, 39410.2043, 39569.3185, 39728.5122, 39887.7858, 40047.1397, 40206.5745, 
+    40366.0905, 40525.6882, 40685.3680, 40845.1303, 41004.9756, 41164.9044, 41324.9169, 41485.0138, 
+    41645.1955, 41805.4623, 41965.8148, 42126.2534, 42286.7786, 42447.3908, 42608.0904, 42768.8780, 
+    42929.7539, 43090.7188, 43251.7729, 43412.9169, 43574.1510, 43735.4760, 43896.8921, 44058.3999, 
+    44219.9999, 44381.6925, 44543.4782, 44705.3575, 44867.3309, 45029.3989, 45191.5620, 45353.8206, 
+    45516.1753, 45678.6265, 45841.1748, 46003.8206, 46166.5645, 46329.4070, 46492.3485, 46655.3896, 
+    46818.5308, 46981.7727, 47145.1157, 47308.5603, 47472.1071, 47635.7566, 47799.5093, 47963.3658, 
+    48127.3266, 48291.3922, 48455.5632, 48619.8401, 48784.2234, 48948.7138, 49113.3117, 49278.0177, 
+    49442.8323, 49607.7562, 49772.7898, 49937.9338, 50103.1886, 50268.5549, 50434.0333, 50599.6243, 
+    50765.3284, 50931.1463, 51097.0786, 51263.1258, 51429.2886, 51595.5674, 51761.9630, 51928.4758, 
+    52095.1066, 52261.8559, 52428.7243, 52595.7124, 52762.8209, 52930.0504, 53097.4014, 53264.8746, 
+    53432.4706, 53600.1902, 53768.0338, 53936.0021, 54104.0958, 54272.3155, 54440.6619, 54609.1356, 
+    54777.7372, 54946.4675, 55115.3271, 55284.3166, 55453.4367, 55622.6881, 55792.0715, 55961.5875, 
+    56131.2369, 56301.0203, 56470.9384, 56640.9919, 56811.1815, 56981.5079, 57151.9719, 57322.5741, 
+    57493.3152, 57664.1960, 57835.2171, 58006.3794, 58177.6836, 58349.1303, 58520.7204, 58692.4545, 
+    58864.3335, 59036.3580, 59208.5289, 59380.8469, 59553.3127, 59725.9272, 59898.6912, 60071.6053, 
+    60244.6704, 60417.8873, 60591.2568, 60764.7797, 60938.4567, 61112.2888, 61286.2766, 61460.4212, 
+    61634.7231, 61809.1834, 61983.8029, 62158.5823, 62333.5225, 62508.6244, 62683.8888, 62859.3167, 
+    63034.9088, 63210.6661, 63386.5894, 63562.6797, 63738.9377, 63915.3645, 64091.9609, 64268.7278, 
+    64445.6661, 64622.7768, 64800.0609, 64977.5191, 65155.1525, 65332.9621, 65510.9487, 65689.1133, 
+    65867.4570, 66045.9806, 66224.6852, 66403.5718, 66582.6412, 66761.8947, 66941.3330, 67120.9574, 
+    67300.7687, 67480.7680, 67660.9564, 67841.3349, 68021.9045, 68202.6664, 68383.6215, 68564.7709, 
+    68746.1158, 68927.6572, 69109.3962, 69291.3339, 69473.4715, 69655.8100, 69838.3506, 70021.0944, 
+    70204.0426, 70387.1963, 70570.5568, 70754.1250, 70937.9023, 71121.8899, 71306.0888, 71490.5005, 
+    71675.1259, 71859.9665, 72045.0233, 72230.2978, 72415.7910, 72601.5044, 72787.4391, 72973.5964, 
+    73159.9777, 73346.5842, 73533.4173, 73720.4783, 73907.7685, 74095.2893, 74283.0419, 74471.0279, 
+    74659.2486, 74847.7053, 75036.3995, 75225.3326, 75414.5059, 75603.9211, 75793.5794, 75983.4823, 
+    76173.6314, 76364.0281, 76554.6739, 76745.5703, 76936.7189, 77128.1211, 77319.7786, 77511.6928, 
+    77703.8654, 77896.2980, 78088.9921, 78281.9494, 78475.1715, 78668.6600, 78862.4167, 79056.4431, 
+    79250.7409, 79445.3120, 79640.1579, 79835.2805, 80030.6814, 80226.3625, 80422.3255, 80618.5722, 
+    80815.1045, 81011.9241, 81209.0329, 81406.4328, 81604.1257, 81802.1134, 82000.3978, 82198.9810, 
+    82397.8649, 82597.0514, 82796.5425, 82996.3402, 83196.4466, 83396.8637, 83597.5935, 83798.6383, 
+    84000.0000
+};
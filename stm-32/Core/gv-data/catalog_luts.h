@@ -1,12 +1,45 @@
 #ifndef CATALOG_LUTS_H
 #define CATALOG_LUTS_H
 
+#include <stddef.h>
 #include <stdint.h>
+#include "gv_real.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 extern const uint8_t catalog[];
-extern const uint16_t index_to_hip_ID_lut[];
+extern const uint32_t index_to_hip_ID_lut[];
+extern const int16_t index_to_vmag_lut[];   // V magnitude x 100
 extern const uint16_t bin_angle_to_address_lut[];
 extern const size_t index_count;
 extern const size_t bin_count;
 
+// packed catalog pair: two catalog indices + their angle
+typedef struct {
+    uint8_t a;
+    uint8_t b;
+    uint16_t angle;   // in units of CATALOG_PAIR_ANGLE_LSB_MDEG
+} catalog_pair_t;
+
+#define CATALOG_PAIR_ANGLE_LSB_MDEG 2
+
+// angular width of one bytestream bin
+#define CATALOG_BIN_WIDTH_MDEG 50
+
+// widest pair angle the catalog tables hold
+#define CATALOG_MAX_ANGLE_MDEG 84000
+
+// chord -> angle: chord_to_mdeg_lut[k] is the angle (mdeg) of two unit
+// vectors k * CHORD_LUT_MAX / CHORD_LUT_SIZE apart; CHORD_LUT_MAX is the
+// chord of CATALOG_MAX_ANGLE_MDEG
+#define CHORD_LUT_SIZE 512
+#define CHORD_LUT_MAX 1.338261213
+extern const gv_real chord_to_mdeg_lut[CHORD_LUT_SIZE + 1];
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif // CATALOG_LUTS_H
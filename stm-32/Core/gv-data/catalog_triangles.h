@@ -0,0 +1,30 @@
+#ifndef CATALOG_TRIANGLES_H
+#define CATALOG_TRIANGLES_H
+
+#include <stdint.h>
+#include "catalog_luts.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// every catalog triangle whose sides all fit TRI_MAX_SIDE_MDEG (the
+// camera FOV), labelled by side: a-b longest, b-c middle, c-a shortest
+typedef struct {
+    uint8_t a;
+    uint8_t b;
+    uint8_t c;
+} catalog_tri_t;
+
+#define TRI_MAX_SIDE_MDEG 46000
+#define N_TRIS 58692
+
+extern const catalog_tri_t tri_cat[N_TRIS];
+// a-b side of tri_cat[i], in CATALOG_PAIR_ANGLE_LSB_MDEG units, ascending
+extern const uint16_t tri_key[N_TRIS];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CATALOG_TRIANGLES_H
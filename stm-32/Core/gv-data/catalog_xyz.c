@@ -1,8 +1,9 @@
 // catalog_xyz.c - Auto-generated unit vector catalog
 // Each row: { HIP_ID, x, y, z }
 
-#define CATALOG_SIZE 256
-double const cat[CATALOG_SIZE][4] = {
+#include "catalog_xyz.h"
+
+const gv_real cat[CATALOG_SIZE][4] = {
     { 0, 0.87326512, 0.03196827, 0.48619550 },
     { 1, 0.51237873, 0.02050796, 0.85851468 },
     { 2, 0.96348243, 0.05570519, 0.26191322 },
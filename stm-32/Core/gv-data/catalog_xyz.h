@@ -1,7 +1,17 @@
 #ifndef CATALOG_XYZ_H
 #define CATALOG_XYZ_H
 
+#include "gv_real.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #define CATALOG_SIZE 256
-extern const double cat[CATALOG_SIZE][4];
+extern const gv_real cat[CATALOG_SIZE][4];
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif
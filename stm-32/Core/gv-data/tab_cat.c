@@ -1,15006 +1,15005 @@
-// Automatically generated on 2025-06-05
-#include <stddef.h>
+// Automatically generated on 2026-10-17
+// Each row: { index1, index2, angle / CATALOG_PAIR_ANGLE_LSB_MDEG }, ascending angle
+#include "tab_cat.h"
 
-#define N_PAIRS 14999
-
-const double tab_cat[14999][3] = {
-    { 677, 746, 30.059688 },
-    { 677, 1067, 13.952150 },
-    { 677, 2081, 71.514949 },
-    { 677, 3092, 6.928628 },
-    { 677, 3179, 28.028190 },
-    { 677, 3419, 47.838406 },
-    { 677, 4427, 32.645510 },
-    { 677, 5165, 76.922808 },
-    { 677, 5447, 14.483826 },
-    { 677, 6686, 33.762863 },
-    { 677, 8886, 38.499569 },
-    { 677, 8903, 25.398863 },
-    { 677, 9640, 26.735877 },
-    { 677, 9884, 27.139302 },
-    { 677, 10064, 26.236131 },
-    { 677, 11767, 60.313627 },
-    { 677, 13847, 79.800464 },
-    { 677, 14135, 48.147955 },
-    { 677, 14328, 40.176302 },
-    { 677, 14354, 37.542744 },
-    { 677, 14576, 38.206773 },
-    { 677, 15863, 42.151039 },
-    { 677, 17358, 44.908971 },
-    { 677, 17702, 48.803146 },
-    { 677, 18246, 48.161528 },
-    { 677, 18532, 47.660968 },
-    { 677, 18543, 69.874403 },
-    { 677, 21421, 62.153943 },
-    { 677, 22449, 69.486018 },
-    { 677, 23015, 60.647580 },
-    { 677, 23416, 58.880726 },
-    { 677, 23767, 60.281843 },
-    { 677, 23875, 79.389081 },
-    { 677, 24436, 82.415185 },
-    { 677, 24608, 60.954238 },
-    { 677, 25281, 81.609592 },
-    { 677, 25336, 77.483828 },
-    { 677, 25428, 68.104632 },
-    { 677, 25930, 82.207305 },
-    { 677, 26207, 77.976664 },
-    { 677, 26311, 83.566914 },
-    { 677, 26451, 73.479292 },
-    { 677, 27989, 83.533809 },
-    { 677, 28360, 68.446422 },
-    { 677, 28380, 71.316105 },
-    { 677, 29655, 80.604581 },
-    { 677, 30343, 82.248947 },
-    { 677, 41704, 79.859658 },
-    { 677, 72607, 73.350387 },
-    { 677, 75097, 73.741806 },
-    { 677, 75458, 83.001212 },
-    { 677, 80331, 75.878035 },
-    { 677, 83895, 69.466217 },
-    { 677, 84380, 82.533748 },
-    { 677, 85670, 72.746008 },
-    { 677, 87833, 69.360472 },
-    { 677, 91262, 67.096609 },
-    { 677, 93194, 64.943442 },
-    { 677, 93747, 71.008974 },
-    { 677, 94376, 57.214981 },
-    { 677, 95501, 71.670245 },
-    { 677, 95947, 60.045067 },
-    { 677, 97165, 53.361077 },
-    { 677, 97278, 63.557755 },
-    { 677, 97649, 63.385600 },
-    { 677, 99473, 63.927428 },
-    { 677, 100345, 70.240784 },
-    { 677, 100453, 47.009170 },
-    { 677, 102098, 43.428594 },
-    { 677, 102488, 42.928786 },
-    { 677, 104732, 37.893694 },
-    { 677, 105199, 43.242673 },
-    { 677, 106032, 47.040047 },
-    { 677, 106278, 51.191464 },
-    { 677, 107315, 38.792063 },
-    { 677, 107556, 56.649498 },
-    { 677, 108085, 73.541536 },
-    { 677, 109074, 41.492649 },
-    { 677, 109268, 80.738186 },
-    { 677, 109492, 35.467024 },
-    { 677, 112122, 78.401814 },
-    { 677, 112158, 18.557249 },
-    { 677, 113136, 48.313251 },
-    { 677, 113368, 61.090258 },
-    { 677, 113881, 14.208941 },
-    { 677, 113963, 20.200603 },
-    { 677, 116727, 48.655731 },
-    { 746, 1067, 43.973035 },
-    { 746, 3092, 28.745712 },
-    { 746, 3179, 4.916158 },
-    { 746, 3419, 77.459340 },
-    { 746, 4427, 6.147565 },
-    { 746, 5447, 25.526475 },
-    { 746, 6686, 9.694935 },
-    { 746, 8886, 13.261055 },
-    { 746, 8903, 42.738993 },
-    { 746, 9640, 24.397925 },
-    { 746, 9884, 41.303432 },
-    { 746, 10064, 31.156450 },
-    { 746, 11767, 30.254598 },
-    { 746, 14135, 64.303125 },
-    { 746, 14328, 24.508149 },
-    { 746, 14354, 34.338039 },
-    { 746, 14576, 33.095121 },
-    { 746, 15863, 29.060047 },
-    { 746, 17358, 32.743819 },
-    { 746, 17702, 51.543945 },
-    { 746, 18246, 45.938663 },
-    { 746, 18532, 40.103084 },
-    { 746, 21421, 63.989531 },
-    { 746, 22449, 73.933803 },
-    { 746, 23015, 52.942037 },
-    { 746, 23416, 45.460724 },
-    { 746, 23767, 47.933052 },
-    { 746, 24608, 45.700245 },
-    { 746, 25336, 78.914447 },
-    { 746, 25428, 60.343448 },
-    { 746, 26207, 77.124555 },
-    { 746, 26451, 67.961142 },
-    { 746, 27989, 81.852966 },
-    { 746, 28360, 51.554975 },
-    { 746, 28380, 57.585573 },
-    { 746, 29655, 71.528557 },
-    { 746, 30343, 72.527881 },
-    { 746, 31681, 79.555837 },
-    { 746, 32246, 72.875214 },
-    { 746, 32362, 83.503200 },
-    { 746, 36850, 72.844947 },
-    { 746, 37826, 77.349345 },
-    { 746, 41704, 52.844564 },
-    { 746, 44127, 65.998874 },
-    { 746, 45860, 80.176294 },
-    { 746, 46853, 64.741945 },
-    { 746, 50801, 76.951044 },
-    { 746, 53910, 63.692587 },
-    { 746, 54061, 58.440251 },
-    { 746, 54539, 75.627315 },
-    { 746, 58001, 67.112779 },
-    { 746, 59774, 63.810547 },
-    { 746, 62956, 64.542622 },
-    { 746, 63125, 82.046932 },
-    { 746, 65378, 64.945545 },
-    { 746, 67301, 69.694393 },
-    { 746, 71075, 78.139529 },
-    { 746, 72607, 44.007217 },
-    { 746, 75097, 44.885336 },
-    { 746, 75458, 55.807099 },
-    { 746, 80331, 49.741424 },
-    { 746, 80816, 83.405474 },
-    { 746, 81693, 73.352496 },
-    { 746, 83895, 43.312797 },
-    { 746, 84379, 75.419394 },
-    { 746, 84380, 65.270948 },
-    { 746, 85670, 51.204482 },
-    { 746, 86032, 83.557005 },
-    { 746, 87833, 49.134528 },
-    { 746, 91262, 54.121825 },
-    { 746, 93194, 56.174300 },
-    { 746, 93747, 70.933673 },
-    { 746, 94376, 32.080293 },
-    { 746, 95501, 77.640855 },
-    { 746, 95947, 55.922844 },
-    { 746, 97165, 40.947605 },
-    { 746, 97278, 68.573178 },
-    { 746, 97649, 69.532116 },
-    { 746, 99473, 75.629720 },
-    { 746, 100453, 39.696593 },
-    { 746, 102098, 33.644277 },
-    { 746, 102488, 41.511292 },
-    { 746, 104732, 41.357092 },
-    { 746, 105199, 20.648458 },
-    { 746, 106032, 19.937637 },
-    { 746, 106278, 71.879414 },
-    { 746, 107315, 56.312245 },
-    { 746, 107556, 80.652686 },
-    { 746, 109074, 64.185771 },
-    { 746, 109492, 15.279979 },
-    { 746, 112158, 32.406063 },
-    { 746, 113136, 76.499235 },
-    { 746, 113881, 33.042746 },
-    { 746, 113963, 45.525203 },
-    { 746, 116727, 18.648808 },
-    { 1067, 2081, 57.567244 },
-    { 1067, 3092, 16.777122 },
-    { 1067, 3179, 41.679053 },
-    { 1067, 3419, 34.002791 },
-    { 1067, 4427, 46.208998 },
-    { 1067, 5165, 63.033760 },
-    { 1067, 5447, 24.028777 },
-    { 1067, 6686, 46.949258 },
-    { 1067, 7588, 74.516987 },
-    { 1067, 8886, 51.554425 },
-    { 1067, 8903, 24.726926 },
-    { 1067, 9236, 79.555276 },
-    { 1067, 9640, 36.072288 },
-    { 1067, 9884, 28.065040 },
-    { 1067, 10064, 32.731863 },
-    { 1067, 11767, 74.211362 },
-    { 1067, 13847, 67.426124 },
-    { 1067, 14135, 43.020023 },
-    { 1067, 14328, 50.869877 },
-    { 1067, 14354, 44.425752 },
-    { 1067, 14576, 45.707436 },
-    { 1067, 15863, 51.803581 },
-    { 1067, 17358, 53.883909 },
-    { 1067, 17702, 50.935170 },
-    { 1067, 18246, 52.717313 },
-    { 1067, 18532, 54.543289 },
-    { 1067, 18543, 62.556810 },
-    { 1067, 21421, 62.894435 },
-    { 1067, 22449, 68.117162 },
-    { 1067, 23015, 65.976757 },
-    { 1067, 23416, 66.771106 },
-    { 1067, 23685, 80.769464 },
-    { 1067, 23767, 67.607079 },
-    { 1067, 23875, 75.680537 },
-    { 1067, 24305, 80.331134 },
-    { 1067, 24436, 78.192764 },
-    { 1067, 24608, 69.381450 },
-    { 1067, 25281, 78.892789 },
-    { 1067, 25336, 76.772493 },
-    { 1067, 25428, 72.677789 },
-    { 1067, 25930, 80.135903 },
-    { 1067, 26207, 78.317833 },
-    { 1067, 26241, 82.492439 },
-    { 1067, 26311, 81.390696 },
-    { 1067, 26451, 76.485350 },
-    { 1067, 26727, 82.683671 },
-    { 1067, 27989, 83.735331 },
-    { 1067, 28360, 76.946773 },
-    { 1067, 28380, 78.246731 },
-    { 1067, 83895, 82.612337 },
-    { 1067, 87833, 80.713065 },
-    { 1067, 91262, 76.012173 },
-    { 1067, 93194, 72.399755 },
-    { 1067, 93747, 74.084086 },
-    { 1067, 94141, 82.762261 },
-    { 1067, 94376, 70.358192 },
-    { 1067, 95501, 71.756301 },
-    { 1067, 95947, 66.074696 },
-    { 1067, 97165, 63.195904 },
-    { 1067, 97278, 64.990054 },
-    { 1067, 97649, 64.273693 },
-    { 1067, 99473, 61.856519 },
-    { 1067, 100345, 64.729270 },
-    { 1067, 100453, 55.788652 },
-    { 1067, 101772, 78.868374 },
-    { 1067, 102098, 53.469812 },
-    { 1067, 102488, 50.075396 },
-    { 1067, 104732, 43.885879 },
-    { 1067, 105199, 56.362243 },
-    { 1067, 106032, 60.734483 },
-    { 1067, 106278, 45.102083 },
-    { 1067, 107315, 36.714441 },
-    { 1067, 107556, 47.775056 },
-    { 1067, 108085, 61.920419 },
-    { 1067, 109074, 35.096033 },
-    { 1067, 109268, 68.181070 },
-    { 1067, 109492, 48.673728 },
-    { 1067, 110130, 78.895937 },
-    { 1067, 112122, 65.318063 },
-    { 1067, 112158, 25.584300 },
-    { 1067, 113136, 36.575300 },
-    { 1067, 113368, 48.372521 },
-    { 1067, 113881, 20.617177 },
-    { 1067, 113963, 16.516199 },
-    { 1067, 116727, 62.594009 },
-    { 2021, 2081, 34.949974 },
-    { 2021, 3419, 59.311141 },
-    { 2021, 5165, 30.800242 },
-    { 2021, 7588, 20.976062 },
-    { 2021, 9236, 17.405323 },
-    { 2021, 13847, 40.251435 },
-    { 2021, 17678, 12.341302 },
-    { 2021, 18543, 69.105770 },
-    { 2021, 19780, 23.045654 },
-    { 2021, 21281, 30.842332 },
-    { 2021, 23685, 63.822165 },
-    { 2021, 23875, 80.813730 },
-    { 2021, 24305, 70.226386 },
-    { 2021, 24436, 78.122730 },
-    { 2021, 25606, 66.619006 },
-    { 2021, 25985, 69.720873 },
-    { 2021, 26241, 81.481495 },
-    { 2021, 26634, 54.345578 },
-    { 2021, 27366, 78.484933 },
-    { 2021, 27628, 53.336438 },
-    { 2021, 30122, 60.457866 },
-    { 2021, 30324, 72.338425 },
-    { 2021, 30438, 39.029392 },
-    { 2021, 31685, 48.765857 },
-    { 2021, 32349, 74.779293 },
-    { 2021, 32607, 31.729489 },
-    { 2021, 32768, 42.349759 },
-    { 2021, 33579, 63.590893 },
-    { 2021, 33977, 68.816196 },
-    { 2021, 34444, 66.613083 },
-    { 2021, 35264, 56.693950 },
-    { 2021, 35904, 64.605811 },
-    { 2021, 36377, 51.319644 },
-    { 2021, 38170, 70.208423 },
-    { 2021, 39429, 56.154248 },
-    { 2021, 39757, 71.640892 },
-    { 2021, 39953, 49.325446 },
-    { 2021, 41037, 38.200936 },
-    { 2021, 42913, 43.660626 },
-    { 2021, 44816, 55.504913 },
-    { 2021, 45238, 30.251321 },
-    { 2021, 45556, 40.378269 },
-    { 2021, 45941, 44.682500 },
-    { 2021, 46701, 42.995650 },
-    { 2021, 48002, 35.620770 },
-    { 2021, 50099, 31.396790 },
-    { 2021, 50371, 39.987337 },
-    { 2021, 51576, 39.948103 },
-    { 2021, 52419, 37.472748 },
-    { 2021, 52727, 52.379427 },
-    { 2021, 56561, 39.513065 },
-    { 2021, 59196, 51.993659 },
-    { 2021, 59316, 80.097999 },
-    { 2021, 59747, 43.986142 },
-    { 2021, 60718, 39.645833 },
-    { 2021, 61084, 45.629619 },
-    { 2021, 61359, 79.339771 },
-    { 2021, 61585, 33.599137 },
-    { 2021, 61932, 53.760433 },
-    { 2021, 62322, 34.603292 },
-    { 2021, 62434, 43.012927 },
-    { 2021, 64962, 79.255681 },
-    { 2021, 65109, 65.715302 },
-    { 2021, 66657, 48.760288 },
-    { 2021, 68002, 54.662501 },
-    { 2021, 68702, 41.527443 },
-    { 2021, 68895, 74.954496 },
-    { 2021, 68933, 65.309724 },
-    { 2021, 71352, 58.891934 },
-    { 2021, 71681, 40.349899 },
-    { 2021, 71683, 40.353571 },
-    { 2021, 71860, 53.551526 },
-    { 2021, 71908, 36.232779 },
-    { 2021, 73273, 57.290714 },
-    { 2021, 73334, 58.288203 },
-    { 2021, 73714, 74.760391 },
-    { 2021, 74946, 31.761412 },
-    { 2021, 75141, 59.015637 },
-    { 2021, 75264, 54.997830 },
-    { 2021, 76297, 58.024201 },
-    { 2021, 77952, 35.697802 },
-    { 2021, 78265, 71.884774 },
-    { 2021, 78401, 75.254622 },
-    { 2021, 78820, 77.803490 },
-    { 2021, 80112, 71.427309 },
-    { 2021, 80763, 70.232264 },
-    { 2021, 81266, 68.188298 },
-    { 2021, 82273, 28.559651 },
-    { 2021, 82396, 61.589798 },
-    { 2021, 82514, 57.859121 },
-    { 2021, 83081, 40.290550 },
-    { 2021, 84012, 78.705947 },
-    { 2021, 84143, 51.866604 },
-    { 2021, 84970, 69.060317 },
-    { 2021, 85258, 39.501657 },
-    { 2021, 85267, 38.699163 },
-    { 2021, 85696, 56.676304 },
-    { 2021, 85792, 44.542034 },
-    { 2021, 85927, 56.716377 },
-    { 2021, 86228, 50.847189 },
-    { 2021, 86670, 54.399946 },
-    { 2021, 87073, 53.078941 },
-    { 2021, 87261, 55.931370 },
-    { 2021, 88048, 81.930939 },
-    { 2021, 88635, 61.480253 },
-    { 2021, 89642, 54.721614 },
-    { 2021, 89931, 61.232757 },
-    { 2021, 90185, 56.656968 },
-    { 2021, 90496, 65.120664 },
-    { 2021, 92041, 62.625762 },
-    { 2021, 92855, 62.768538 },
-    { 2021, 93506, 58.893793 },
-    { 2021, 93864, 60.794587 },
-    { 2021, 94141, 67.088907 },
-    { 2021, 99473, 83.563073 },
-    { 2021, 100345, 69.406372 },
-    { 2021, 100751, 28.831468 },
-    { 2021, 101772, 37.045247 },
-    { 2021, 106278, 75.291724 },
-    { 2021, 107556, 64.272911 },
-    { 2021, 108085, 43.094010 },
-    { 2021, 109074, 79.267255 },
-    { 2021, 109268, 33.156643 },
-    { 2021, 110130, 19.963161 },
-    { 2021, 112122, 32.026276 },
-    { 2021, 113136, 62.506217 },
-    { 2021, 113368, 48.707158 },
-    { 2081, 3092, 73.227888 },
-    { 2081, 3419, 24.595847 },
-    { 2081, 5165, 8.347053 },
-    { 2081, 5447, 78.556339 },
-    { 2081, 7588, 18.746238 },
-    { 2081, 8903, 66.329247 },
-    { 2081, 9236, 23.691427 },
-    { 2081, 9884, 69.772252 },
-    { 2081, 10064, 80.821818 },
-    { 2081, 13847, 28.374992 },
-    { 2081, 14135, 58.312334 },
-    { 2081, 17678, 39.080970 },
-    { 2081, 17702, 81.006875 },
-    { 2081, 18543, 53.798598 },
-    { 2081, 19780, 38.476586 },
-    { 2081, 21281, 41.318602 },
-    { 2081, 21421, 82.118053 },
-    { 2081, 22449, 77.389599 },
-    { 2081, 23685, 60.502631 },
-    { 2081, 23875, 72.128817 },
-    { 2081, 24305, 65.714849 },
-    { 2081, 24436, 71.249843 },
-    { 2081, 25281, 76.996398 },
-    { 2081, 25336, 83.144809 },
-    { 2081, 25606, 65.680575 },
-    { 2081, 25930, 79.803670 },
-    { 2081, 25985, 68.344290 },
-    { 2081, 26241, 76.633361 },
-    { 2081, 26311, 79.958089 },
-    { 2081, 26634, 59.941159 },
-    { 2081, 26727, 80.289609 },
-    { 2081, 27366, 76.406573 },
-    { 2081, 27628, 60.951640 },
-    { 2081, 30122, 69.277031 },
-    { 2081, 30324, 77.379422 },
-    { 2081, 30438, 57.320331 },
-    { 2081, 31685, 64.295923 },
-    { 2081, 32349, 82.224049 },
-    { 2081, 32607, 55.891256 },
-    { 2081, 32768, 61.844387 },
-    { 2081, 33579, 76.407360 },
-    { 2081, 33977, 80.562005 },
-    { 2081, 34444, 79.737291 },
-    { 2081, 35264, 73.969847 },
-    { 2081, 35904, 80.302155 },
-    { 2081, 36377, 71.600364 },
-    { 2081, 39429, 78.503257 },
-    { 2081, 39953, 73.936184 },
-    { 2081, 41037, 66.563027 },
-    { 2081, 42913, 72.138167 },
-    { 2081, 44816, 83.427814 },
-    { 2081, 45238, 62.568027 },
-    { 2081, 45556, 71.195449 },
-    { 2081, 45941, 75.104747 },
-    { 2081, 46701, 74.092586 },
-    { 2081, 48002, 68.230671 },
-    { 2081, 50099, 65.088910 },
-    { 2081, 50371, 73.101605 },
-    { 2081, 51576, 73.473565 },
-    { 2081, 52419, 71.380037 },
-    { 2081, 56561, 74.192554 },
-    { 2081, 59747, 78.919542 },
-    { 2081, 60718, 74.595803 },
-    { 2081, 61084, 80.577012 },
-    { 2081, 61585, 68.540997 },
-    { 2081, 62322, 69.522620 },
-    { 2081, 62434, 77.910521 },
-    { 2081, 66657, 82.930500 },
-    { 2081, 68702, 75.398747 },
-    { 2081, 71681, 73.337739 },
-    { 2081, 71683, 73.340356 },
-    { 2081, 71908, 69.469950 },
-    { 2081, 74946, 64.477840 },
-    { 2081, 77952, 66.464701 },
-    { 2081, 82273, 58.726709 },
-    { 2081, 82396, 82.505221 },
-    { 2081, 82514, 79.535081 },
-    { 2081, 83081, 66.199889 },
-    { 2081, 84143, 73.151672 },
-    { 2081, 85258, 63.587307 },
-    { 2081, 85267, 63.066433 },
-    { 2081, 85696, 74.531522 },
-    { 2081, 85792, 66.264200 },
-    { 2081, 85927, 74.236289 },
-    { 2081, 86228, 69.858597 },
-    { 2081, 86670, 71.654739 },
-    { 2081, 87073, 70.198581 },
-    { 2081, 87261, 71.816989 },
-    { 2081, 88635, 73.503997 },
-    { 2081, 89642, 67.637661 },
-    { 2081, 89931, 71.337826 },
-    { 2081, 90185, 68.006615 },
-    { 2081, 90496, 72.910920 },
-    { 2081, 92041, 68.830967 },
-    { 2081, 92855, 67.553864 },
-    { 2081, 93506, 64.116134 },
-    { 2081, 93864, 64.649445 },
-    { 2081, 94141, 68.181896 },
-    { 2081, 95501, 81.250379 },
-    { 2081, 97278, 82.842948 },
-    { 2081, 97649, 80.816580 },
-    { 2081, 99473, 70.318726 },
-    { 2081, 100345, 59.006751 },
-    { 2081, 100751, 40.124195 },
-    { 2081, 101772, 39.961072 },
-    { 2081, 106278, 53.296392 },
-    { 2081, 107315, 63.997368 },
-    { 2081, 107556, 42.885872 },
-    { 2081, 108085, 29.411120 },
-    { 2081, 109074, 52.508284 },
-    { 2081, 109268, 24.788062 },
-    { 2081, 110130, 26.396091 },
-    { 2081, 112122, 18.911275 },
-    { 2081, 112158, 76.321814 },
-    { 2081, 113136, 32.971820 },
-    { 2081, 113368, 21.857054 },
-    { 2081, 113881, 72.912884 },
-    { 2081, 113963, 60.496911 },
-    { 3092, 3179, 25.677013 },
-    { 3092, 3419, 48.858644 },
-    { 3092, 4427, 29.994149 },
-    { 3092, 5165, 77.814681 },
-    { 3092, 5447, 7.936991 },
-    { 3092, 6686, 30.378922 },
-    { 3092, 8886, 34.891163 },
-    { 3092, 8903, 19.659246 },
-    { 3092, 9640, 20.394752 },
-    { 3092, 9884, 20.846682 },
-    { 3092, 10064, 19.331186 },
-    { 3092, 11767, 58.490374 },
-    { 3092, 13847, 78.101611 },
-    { 3092, 14135, 42.981088 },
-    { 3092, 14328, 34.566135 },
-    { 3092, 14354, 30.746507 },
-    { 3092, 14576, 31.510883 },
-    { 3092, 15863, 36.079440 },
-    { 3092, 17358, 38.620196 },
-    { 3092, 17702, 41.970482 },
-    { 3092, 18246, 41.235711 },
-    { 3092, 18532, 40.918221 },
-    { 3092, 18543, 65.146180 },
-    { 3092, 21421, 55.400842 },
-    { 3092, 22449, 63.003317 },
-    { 3092, 23015, 53.777861 },
-    { 3092, 23416, 52.378485 },
-    { 3092, 23685, 83.057631 },
-    { 3092, 23767, 53.668819 },
-    { 3092, 23875, 73.332886 },
-    { 3092, 24305, 80.777227 },
-    { 3092, 24436, 76.465451 },
-    { 3092, 24608, 54.593387 },
-    { 3092, 25281, 75.303528 },
-    { 3092, 25336, 70.844737 },
-    { 3092, 25428, 61.201807 },
-    { 3092, 25930, 75.767490 },
-    { 3092, 26207, 71.202402 },
-    { 3092, 26241, 79.504682 },
-    { 3092, 26311, 77.137960 },
-    { 3092, 26451, 66.552570 },
-    { 3092, 26727, 78.493748 },
-    { 3092, 27989, 76.754668 },
-    { 3092, 28360, 62.137296 },
-    { 3092, 28380, 64.673190 },
-    { 3092, 29655, 73.692349 },
-    { 3092, 30343, 75.345004 },
-    { 3092, 31681, 81.336703 },
-    { 3092, 32246, 78.332379 },
-    { 3092, 41704, 75.402601 },
-    { 3092, 72607, 72.748484 },
-    { 3092, 75097, 73.534722 },
-    { 3092, 75458, 83.824308 },
-    { 3092, 80331, 77.120377 },
-    { 3092, 83895, 70.628361 },
-    { 3092, 85670, 75.496214 },
-    { 3092, 87833, 72.402485 },
-    { 3092, 91262, 71.679887 },
-    { 3092, 93194, 70.195840 },
-    { 3092, 93747, 77.434344 },
-    { 3092, 94376, 58.560392 },
-    { 3092, 95501, 78.499413 },
-    { 3092, 95947, 65.850952 },
-    { 3092, 97165, 57.679737 },
-    { 3092, 97278, 70.281519 },
-    { 3092, 97649, 70.169806 },
-    { 3092, 99473, 70.856026 },
-    { 3092, 100345, 76.972385 },
-    { 3092, 100453, 51.987368 },
-    { 3092, 102098, 47.833570 },
-    { 3092, 102488, 48.629963 },
-    { 3092, 104732, 44.030592 },
-    { 3092, 105199, 44.894011 },
-    { 3092, 106032, 47.459429 },
-    { 3092, 106278, 57.757515 },
-    { 3092, 107315, 45.692286 },
-    { 3092, 107556, 62.618651 },
-    { 3092, 108085, 78.413153 },
-    { 3092, 109074, 47.933620 },
-    { 3092, 109492, 37.188444 },
-    { 3092, 112122, 82.075600 },
-    { 3092, 112158, 24.983719 },
-    { 3092, 113136, 53.030445 },
-    { 3092, 113368, 65.137868 },
-    { 3092, 113881, 20.941596 },
-    { 3092, 113963, 26.699260 },
-    { 3092, 116727, 47.261054 },
-    { 3179, 3419, 74.526910 },
-    { 3179, 4427, 4.679132 },
-    { 3179, 5447, 21.493008 },
-    { 3179, 6686, 6.980667 },
-    { 3179, 8886, 11.575597 },
-    { 3179, 8903, 38.274071 },
-    { 3179, 9640, 19.485799 },
-    { 3179, 9884, 36.656841 },
-    { 3179, 10064, 26.306765 },
-    { 3179, 11767, 32.813367 },
-    { 3179, 14135, 59.497902 },
-    { 3179, 14328, 20.653965 },
-    { 3179, 14354, 29.550943 },
-    { 3179, 14576, 28.386025 },
-    { 3179, 15863, 25.012210 },
-    { 3179, 17358, 28.708434 },
-    { 3179, 17702, 46.716249 },
-    { 3179, 18246, 41.283292 },
-    { 3179, 18532, 35.752259 },
-    { 3179, 18543, 81.131013 },
-    { 3179, 21421, 59.301978 },
-    { 3179, 22449, 69.190822 },
-    { 3179, 23015, 48.864366 },
-    { 3179, 23416, 41.970982 },
-    { 3179, 23767, 44.338857 },
-    { 3179, 23875, 81.831584 },
-    { 3179, 24608, 42.516676 },
-    { 3179, 25281, 81.689774 },
-    { 3179, 25336, 74.379364 },
-    { 3179, 25428, 56.394088 },
-    { 3179, 25930, 80.908942 },
-    { 3179, 26207, 72.738004 },
-    { 3179, 26311, 82.233920 },
-    { 3179, 26451, 63.883295 },
-    { 3179, 26727, 83.467683 },
-    { 3179, 27989, 77.584109 },
-    { 3179, 28360, 48.794355 },
-    { 3179, 28380, 54.389763 },
-    { 3179, 29655, 67.902250 },
-    { 3179, 30343, 68.998131 },
-    { 3179, 31681, 75.996318 },
-    { 3179, 32246, 69.706090 },
-    { 3179, 32362, 79.923054 },
-    { 3179, 36850, 70.656672 },
-    { 3179, 37826, 75.157314 },
-    { 3179, 41704, 52.888088 },
-    { 3179, 44127, 65.755261 },
-    { 3179, 45860, 79.751102 },
-    { 3179, 46853, 65.106843 },
-    { 3179, 50801, 77.724008 },
-    { 3179, 53910, 65.335902 },
-    { 3179, 54061, 60.209167 },
-    { 3179, 54539, 77.178286 },
-    { 3179, 58001, 69.355262 },
-    { 3179, 59774, 66.317730 },
-    { 3179, 62956, 67.469443 },
-    { 3179, 65378, 68.187758 },
-    { 3179, 67301, 73.237829 },
-    { 3179, 71075, 82.256819 },
-    { 3179, 72607, 47.495225 },
-    { 3179, 75097, 48.617506 },
-    { 3179, 75458, 59.957763 },
-    { 3179, 80331, 54.147532 },
-    { 3179, 81693, 78.244393 },
-    { 3179, 83895, 47.773057 },
-    { 3179, 84379, 80.321057 },
-    { 3179, 84380, 70.183261 },
-    { 3179, 85670, 56.041536 },
-    { 3179, 87833, 54.025625 },
-    { 3179, 91262, 58.945474 },
-    { 3179, 93194, 60.800145 },
-    { 3179, 93747, 75.051395 },
-    { 3179, 94376, 36.788900 },
-    { 3179, 95501, 81.215731 },
-    { 3179, 95947, 60.198571 },
-    { 3179, 97165, 45.634623 },
-    { 3179, 97278, 72.120544 },
-    { 3179, 97649, 72.960072 },
-    { 3179, 99473, 78.416331 },
-    { 3179, 100453, 43.962176 },
-    { 3179, 102098, 37.989286 },
-    { 3179, 102488, 45.206043 },
-    { 3179, 104732, 44.438499 },
-    { 3179, 105199, 25.564108 },
-    { 3179, 106032, 24.553827 },
-    { 3179, 106278, 73.045076 },
-    { 3179, 107315, 57.770890 },
-    { 3179, 107556, 81.178772 },
-    { 3179, 109074, 64.800196 },
-    { 3179, 109492, 19.981065 },
-    { 3179, 112158, 33.373836 },
-    { 3179, 113136, 75.671754 },
-    { 3179, 113881, 33.227898 },
-    { 3179, 113963, 45.159727 },
-    { 3179, 116727, 21.750282 },
-    { 3419, 4427, 78.747967 },
-    { 3419, 5165, 29.103787 },
-    { 3419, 5447, 53.964342 },
-    { 3419, 6686, 78.689366 },
-    { 3419, 7588, 40.526521 },
-    { 3419, 8886, 82.811901 },
-    { 3419, 8903, 42.522934 },
-    { 3419, 9236, 45.554562 },
-    { 3419, 9640, 63.097389 },
-    { 3419, 9884, 46.199027 },
-    { 3419, 10064, 56.769320 },
-    { 3419, 13847, 36.542180 },
-    { 3419, 14135, 40.694026 },
-    { 3419, 14328, 77.678319 },
-    { 3419, 14354, 65.780724 },
-    { 3419, 14576, 67.812282 },
-    { 3419, 15863, 76.564380 },
-    { 3419, 17358, 77.028638 },
-    { 3419, 17678, 61.514737 },
-    { 3419, 17702, 61.493621 },
-    { 3419, 18246, 67.598092 },
-    { 3419, 18532, 73.527856 },
-    { 3419, 18543, 46.874697 },
-    { 3419, 19780, 57.305740 },
-    { 3419, 21281, 56.971032 },
-    { 3419, 21421, 66.773678 },
-    { 3419, 22449, 65.658882 },
-    { 3419, 23015, 79.154321 },
-    { 3419, 23685, 61.137420 },
-    { 3419, 23875, 65.687271 },
-    { 3419, 24305, 64.016516 },
-    { 3419, 24436, 66.378100 },
-    { 3419, 25281, 70.459901 },
-    { 3419, 25336, 73.550757 },
-    { 3419, 25428, 82.619593 },
-    { 3419, 25606, 66.635007 },
-    { 3419, 25930, 72.910423 },
-    { 3419, 25985, 68.282957 },
-    { 3419, 26207, 77.150162 },
-    { 3419, 26241, 72.000521 },
-    { 3419, 26311, 73.619643 },
-    { 3419, 26451, 81.931460 },
-    { 3419, 26634, 67.048050 },
-    { 3419, 26727, 74.466085 },
-    { 3419, 27366, 73.857646 },
-    { 3419, 27628, 69.135571 },
-    { 3419, 27989, 80.911246 },
-    { 3419, 30122, 76.222907 },
-    { 3419, 30324, 79.773191 },
-    { 3419, 30438, 72.845395 },
-    { 3419, 31685, 76.762164 },
-    { 3419, 32607, 74.721279 },
-    { 3419, 32768, 77.176381 },
-    { 3419, 82273, 82.836627 },
-    { 3419, 90185, 83.801386 },
-    { 3419, 92041, 81.500755 },
-    { 3419, 92855, 79.616667 },
-    { 3419, 93506, 77.160606 },
-    { 3419, 93864, 76.756842 },
-    { 3419, 94141, 77.762486 },
-    { 3419, 95501, 81.029628 },
-    { 3419, 97278, 78.720354 },
-    { 3419, 97649, 77.056825 },
-    { 3419, 99473, 68.924278 },
-    { 3419, 100345, 62.738563 },
-    { 3419, 100751, 61.123597 },
-    { 3419, 101772, 57.677714 },
-    { 3419, 102098, 83.699517 },
-    { 3419, 102488, 76.723772 },
-    { 3419, 104732, 69.941695 },
-    { 3419, 106278, 48.446894 },
-    { 3419, 107315, 52.312474 },
-    { 3419, 107556, 42.139723 },
-    { 3419, 108085, 41.797636 },
-    { 3419, 109074, 42.595945 },
-    { 3419, 109268, 43.002698 },
-    { 3419, 109492, 82.443514 },
-    { 3419, 110130, 49.569673 },
-    { 3419, 112122, 38.086698 },
-    { 3419, 112158, 56.270747 },
-    { 3419, 113136, 26.124240 },
-    { 3419, 113368, 26.788336 },
-    { 3419, 113881, 52.015092 },
-    { 3419, 113963, 41.164641 },
-    { 4427, 5447, 25.182454 },
-    { 4427, 6686, 3.615486 },
-    { 4427, 8886, 7.326466 },
-    { 4427, 8903, 41.188993 },
-    { 4427, 9640, 21.009786 },
-    { 4427, 9884, 39.202221 },
-    { 4427, 10064, 28.262369 },
-    { 4427, 11767, 28.611207 },
-    { 4427, 14135, 61.401312 },
-    { 4427, 14328, 18.588924 },
-    { 4427, 14354, 29.577496 },
-    { 4427, 14576, 28.116812 },
-    { 4427, 15863, 23.229579 },
-    { 4427, 17358, 26.881944 },
-    { 4427, 17702, 46.813478 },
-    { 4427, 18246, 40.741305 },
-    { 4427, 18532, 34.477530 },
-    { 4427, 18543, 82.494678 },
-    { 4427, 21421, 58.790476 },
-    { 4427, 22449, 68.840259 },
-    { 4427, 23015, 47.043746 },
-    { 4427, 23416, 39.345356 },
-    { 4427, 23767, 41.837847 },
-    { 4427, 23875, 81.634829 },
-    { 4427, 24608, 39.553345 },
-    { 4427, 25281, 81.087654 },
-    { 4427, 25336, 73.406288 },
-    { 4427, 25428, 54.360975 },
-    { 4427, 25930, 80.088349 },
-    { 4427, 26207, 71.436681 },
-    { 4427, 26311, 81.375915 },
-    { 4427, 26451, 62.038640 },
-    { 4427, 26727, 82.560165 },
-    { 4427, 27989, 76.047264 },
-    { 4427, 28360, 45.439907 },
-    { 4427, 28380, 51.438115 },
-    { 4427, 29655, 65.424311 },
-    { 4427, 30343, 66.404744 },
-    { 4427, 31681, 73.435039 },
-    { 4427, 32246, 66.728123 },
-    { 4427, 32362, 77.384539 },
-    { 4427, 36850, 66.895354 },
-    { 4427, 37826, 71.401716 },
-    { 4427, 41704, 48.256631 },
-    { 4427, 44127, 61.182971 },
-    { 4427, 45860, 75.230149 },
-    { 4427, 46853, 60.445446 },
-    { 4427, 50801, 73.045237 },
-    { 4427, 53910, 60.735693 },
-    { 4427, 54061, 55.640035 },
-    { 4427, 54539, 72.553539 },
-    { 4427, 58001, 64.905103 },
-    { 4427, 59774, 61.971469 },
-    { 4427, 62956, 63.322206 },
-    { 4427, 63125, 80.964907 },
-    { 4427, 65378, 64.231966 },
-    { 4427, 67301, 69.492818 },
-    { 4427, 71075, 79.069719 },
-    { 4427, 72607, 43.804071 },
-    { 4427, 75097, 45.140158 },
-    { 4427, 75458, 56.898642 },
-    { 4427, 80331, 51.507066 },
-    { 4427, 81693, 76.998658 },
-    { 4427, 83895, 45.270423 },
-    { 4427, 84379, 79.870691 },
-    { 4427, 84380, 69.236155 },
-    { 4427, 85670, 54.537452 },
-    { 4427, 87833, 52.876283 },
-    { 4427, 91262, 59.104326 },
-    { 4427, 93194, 61.635082 },
-    { 4427, 93747, 76.878317 },
-    { 4427, 94376, 34.955439 },
-    { 4427, 95501, 83.766718 },
-    { 4427, 95947, 61.782476 },
-    { 4427, 97165, 46.347017 },
-    { 4427, 97278, 74.705574 },
-    { 4427, 97649, 75.675555 },
-    { 4427, 99473, 81.727147 },
-    { 4427, 100453, 45.595843 },
-    { 4427, 102098, 39.501582 },
-    { 4427, 102488, 47.633477 },
-    { 4427, 104732, 47.485765 },
-    { 4427, 105199, 25.185591 },
-    { 4427, 106032, 22.678180 },
-    { 4427, 106278, 77.303524 },
-    { 4427, 107315, 61.887297 },
-    { 4427, 109074, 69.242572 },
-    { 4427, 109492, 20.861958 },
-    { 4427, 112158, 37.649681 },
-    { 4427, 113136, 80.349867 },
-    { 4427, 113881, 37.740984 },
-    { 4427, 113963, 49.791683 },
-    { 4427, 116727, 18.042955 },
-    { 5165, 5447, 82.343395 },
-    { 5165, 7588, 11.573025 },
-    { 5165, 8903, 68.412419 },
-    { 5165, 9236, 16.662753 },
-    { 5165, 9884, 71.528195 },
-    { 5165, 10064, 82.942735 },
-    { 5165, 13847, 21.195470 },
-    { 5165, 14135, 56.914216 },
-    { 5165, 17678, 32.576527 },
-    { 5165, 17702, 79.653450 },
-    { 5165, 18543, 48.875788 },
-    { 5165, 19780, 30.533779 },
-    { 5165, 21281, 33.005892 },
-    { 5165, 21421, 78.834429 },
-    { 5165, 22449, 72.966560 },
-    { 5165, 23685, 53.447293 },
-    { 5165, 23875, 66.333218 },
-    { 5165, 24305, 58.991429 },
-    { 5165, 24436, 65.087140 },
-    { 5165, 25281, 71.077773 },
-    { 5165, 25336, 77.876674 },
-    { 5165, 25606, 58.434538 },
-    { 5165, 25930, 73.895659 },
-    { 5165, 25985, 61.224121 },
-    { 5165, 26207, 82.217499 },
-    { 5165, 26241, 70.262218 },
-    { 5165, 26311, 73.905698 },
-    { 5165, 26634, 51.902468 },
-    { 5165, 26727, 74.102020 },
-    { 5165, 27366, 69.586496 },
-    { 5165, 27628, 52.798166 },
-    { 5165, 27989, 83.501877 },
-    { 5165, 30122, 61.156997 },
-    { 5165, 30324, 69.686524 },
-    { 5165, 30438, 49.078581 },
-    { 5165, 31685, 55.949728 },
-    { 5165, 32349, 74.380854 },
-    { 5165, 32607, 48.119061 },
-    { 5165, 32768, 53.609131 },
-    { 5165, 33579, 68.151948 },
-    { 5165, 33977, 72.389770 },
-    { 5165, 34444, 71.492154 },
-    { 5165, 35264, 65.623353 },
-    { 5165, 35904, 71.978808 },
-    { 5165, 36377, 63.321397 },
-    { 5165, 38170, 79.078632 },
-    { 5165, 39429, 70.269450 },
-    { 5165, 39757, 82.294894 },
-    { 5165, 39953, 65.899326 },
-    { 5165, 41037, 59.105836 },
-    { 5165, 42913, 64.597125 },
-    { 5165, 44816, 75.641971 },
-    { 5165, 45238, 56.103724 },
-    { 5165, 45556, 64.131290 },
-    { 5165, 45941, 67.880499 },
-    { 5165, 46701, 67.044479 },
-    { 5165, 48002, 61.741321 },
-    { 5165, 50099, 59.114848 },
-    { 5165, 50371, 66.715152 },
-    { 5165, 51576, 67.265722 },
-    { 5165, 52419, 65.409280 },
-    { 5165, 52727, 79.232337 },
-    { 5165, 56561, 68.804051 },
-    { 5165, 59196, 81.767017 },
-    { 5165, 59747, 74.011812 },
-    { 5165, 60718, 69.902511 },
-    { 5165, 61084, 75.914318 },
-    { 5165, 61585, 64.022469 },
-    { 5165, 62322, 65.113190 },
-    { 5165, 62434, 73.526463 },
-    { 5165, 66657, 79.557092 },
-    { 5165, 68702, 72.266083 },
-    { 5165, 71681, 70.784114 },
-    { 5165, 71683, 70.787372 },
-    { 5165, 71860, 83.591662 },
-    { 5165, 71908, 66.738561 },
-    { 5165, 74946, 61.991142 },
-    { 5165, 75264, 83.764775 },
-    { 5165, 77952, 64.901867 },
-    { 5165, 82273, 57.228349 },
-    { 5165, 82514, 81.357971 },
-    { 5165, 83081, 66.358366 },
-    { 5165, 84143, 74.899441 },
-    { 5165, 85258, 64.215761 },
-    { 5165, 85267, 63.593626 },
-    { 5165, 85696, 77.246450 },
-    { 5165, 85792, 67.662816 },
-    { 5165, 85927, 77.027761 },
-    { 5165, 86228, 72.116589 },
-    { 5165, 86670, 74.427701 },
-    { 5165, 87073, 72.955335 },
-    { 5165, 87261, 74.936643 },
-    { 5165, 88635, 77.587341 },
-    { 5165, 89642, 71.311213 },
-    { 5165, 89931, 75.768588 },
-    { 5165, 90185, 72.047220 },
-    { 5165, 90496, 77.877383 },
-    { 5165, 92041, 73.977547 },
-    { 5165, 92855, 72.931906 },
-    { 5165, 93506, 69.288102 },
-    { 5165, 93864, 70.103059 },
-    { 5165, 94141, 74.249992 },
-    { 5165, 99473, 78.293796 },
-    { 5165, 100345, 66.508595 },
-    { 5165, 100751, 42.553314 },
-    { 5165, 101772, 44.302212 },
-    { 5165, 106278, 61.621870 },
-    { 5165, 107315, 72.241723 },
-    { 5165, 107556, 51.123358 },
-    { 5165, 108085, 36.279792 },
-    { 5165, 109074, 60.777727 },
-    { 5165, 109268, 29.999840 },
-    { 5165, 110130, 27.716359 },
-    { 5165, 112122, 24.327993 },
-    { 5165, 112158, 83.441073 },
-    { 5165, 113136, 41.187807 },
-    { 5165, 113368, 30.157803 },
-    { 5165, 113881, 79.743381 },
-    { 5165, 113963, 67.660896 },
-    { 5447, 6686, 24.750802 },
-    { 5447, 8886, 28.869951 },
-    { 5447, 8903, 17.781972 },
-    { 5447, 9640, 12.460636 },
-    { 5447, 9884, 17.394010 },
-    { 5447, 10064, 12.207770 },
-    { 5447, 11767, 53.690391 },
-    { 5447, 13847, 79.923663 },
-    { 5447, 14135, 40.840338 },
-    { 5447, 14328, 26.873415 },
-    { 5447, 14354, 23.106336 },
-    { 5447, 14576, 23.723328 },
-    { 5447, 15863, 28.179136 },
-    { 5447, 17358, 30.683591 },
-    { 5447, 17702, 35.814021 },
-    { 5447, 18246, 34.129805 },
-    { 5447, 18532, 33.183717 },
-    { 5447, 18543, 63.214719 },
-    { 5447, 21421, 49.445039 },
-    { 5447, 22449, 57.784844 },
-    { 5447, 23015, 46.285976 },
-    { 5447, 23416, 44.474899 },
-    { 5447, 23685, 80.430291 },
-    { 5447, 23767, 45.817335 },
-    { 5447, 23875, 68.964518 },
-    { 5447, 24305, 77.392417 },
-    { 5447, 24436, 72.272130 },
-    { 5447, 24608, 46.660540 },
-    { 5447, 25281, 70.387271 },
-    { 5447, 25336, 65.135679 },
-    { 5447, 25428, 53.833083 },
-    { 5447, 25606, 83.150575 },
-    { 5447, 25930, 70.539228 },
-    { 5447, 25985, 81.976027 },
-    { 5447, 26207, 65.061117 },
-    { 5447, 26241, 74.727619 },
-    { 5447, 26311, 71.924053 },
-    { 5447, 26451, 59.564186 },
-    { 5447, 26727, 73.274593 },
-    { 5447, 27366, 79.471670 },
-    { 5447, 27989, 70.565620 },
-    { 5447, 28360, 54.201390 },
-    { 5447, 28380, 56.843389 },
-    { 5447, 29655, 66.361171 },
-    { 5447, 30343, 67.963546 },
-    { 5447, 31681, 74.155564 },
-    { 5447, 32246, 70.730381 },
-    { 5447, 32362, 77.624161 },
-    { 5447, 36850, 76.530802 },
-    { 5447, 37826, 80.637922 },
-    { 5447, 41704, 68.213853 },
-    { 5447, 44127, 79.441285 },
-    { 5447, 46853, 80.666029 },
-    { 5447, 54061, 79.338571 },
-    { 5447, 72607, 68.927774 },
-    { 5447, 75097, 70.108546 },
-    { 5447, 75458, 81.326631 },
-    { 5447, 80331, 75.206229 },
-    { 5447, 83895, 68.744561 },
-    { 5447, 85670, 75.396057 },
-    { 5447, 87833, 72.724544 },
-    { 5447, 91262, 74.070791 },
-    { 5447, 93194, 73.598263 },
-    { 5447, 93747, 82.837686 },
-    { 5447, 94376, 57.144985 },
-    { 5447, 95947, 70.199918 },
-    { 5447, 97165, 59.959319 },
-    { 5447, 97278, 76.462559 },
-    { 5447, 97649, 76.534259 },
-    { 5447, 99473, 78.029502 },
-    { 5447, 100453, 55.294992 },
-    { 5447, 102098, 50.457705 },
-    { 5447, 102488, 53.064655 },
-    { 5447, 104732, 49.242079 },
-    { 5447, 105199, 44.232237 },
-    { 5447, 106032, 45.303285 },
-    { 5447, 106278, 65.620243 },
-    { 5447, 107315, 53.153897 },
-    { 5447, 107556, 70.541684 },
-    { 5447, 109074, 55.836417 },
-    { 5447, 109492, 36.930445 },
-    { 5447, 112158, 31.078519 },
-    { 5447, 113136, 60.570335 },
-    { 5447, 113368, 72.263894 },
-    { 5447, 113881, 27.657087 },
-    { 5447, 113963, 34.570358 },
-    { 5447, 116727, 43.142905 },
-    { 6686, 8886, 4.799728 },
-    { 6686, 8903, 39.756740 },
-    { 6686, 9640, 18.825120 },
-    { 6686, 9884, 37.474763 },
-    { 6686, 10064, 26.222122 },
-    { 6686, 11767, 29.059697 },
-    { 6686, 14135, 59.078547 },
-    { 6686, 14328, 14.983932 },
-    { 6686, 14354, 26.451496 },
-    { 6686, 14576, 24.886656 },
-    { 6686, 15863, 19.642145 },
-    { 6686, 17358, 23.283735 },
-    { 6686, 17702, 43.629210 },
-    { 6686, 18246, 37.362714 },
-    { 6686, 18532, 30.941698 },
-    { 6686, 18543, 79.786104 },
-    { 6686, 21421, 55.383548 },
-    { 6686, 22449, 65.462975 },
-    { 6686, 23015, 43.433966 },
-    { 6686, 23416, 35.765990 },
-    { 6686, 23767, 38.244455 },
-    { 6686, 23875, 78.284818 },
-    { 6686, 24436, 81.809367 },
-    { 6686, 24608, 36.040005 },
-    { 6686, 25281, 77.632094 },
-    { 6686, 25336, 69.881248 },
-    { 6686, 25428, 50.745519 },
-    { 6686, 25930, 76.586887 },
-    { 6686, 26207, 67.863140 },
-    { 6686, 26241, 81.989721 },
-    { 6686, 26311, 77.866223 },
-    { 6686, 26451, 58.425312 },
-    { 6686, 26727, 79.040425 },
-    { 6686, 27989, 72.448117 },
-    { 6686, 28360, 42.061250 },
-    { 6686, 28380, 47.930353 },
-    { 6686, 29655, 61.837031 },
-    { 6686, 30343, 62.833002 },
-    { 6686, 31681, 69.860912 },
-    { 6686, 32246, 63.234990 },
-    { 6686, 32362, 73.808412 },
-    { 6686, 36188, 82.976403 },
-    { 6686, 36850, 63.742001 },
-    { 6686, 37826, 68.246014 },
-    { 6686, 41704, 46.388622 },
-    { 6686, 44127, 59.070940 },
-    { 6686, 45860, 72.967630 },
-    { 6686, 46853, 58.735611 },
-    { 6686, 50801, 71.560298 },
-    { 6686, 53910, 59.966447 },
-    { 6686, 54061, 55.009301 },
-    { 6686, 54539, 71.639563 },
-    { 6686, 58001, 64.597201 },
-    { 6686, 59774, 61.914192 },
-    { 6686, 62956, 63.634272 },
-    { 6686, 63125, 81.256061 },
-    { 6686, 65378, 64.838570 },
-    { 6686, 67301, 70.362867 },
-    { 6686, 71075, 80.518532 },
-    { 6686, 72607, 44.867251 },
-    { 6686, 75097, 46.442411 },
-    { 6686, 75458, 58.554956 },
-    { 6686, 80331, 53.542082 },
-    { 6686, 81693, 79.818610 },
-    { 6686, 83895, 47.442695 },
-    { 6686, 84379, 83.032208 },
-    { 6686, 84380, 72.215684 },
-    { 6686, 85670, 57.289289 },
-    { 6686, 87833, 55.808812 },
-    { 6686, 91262, 62.494381 },
-    { 6686, 93194, 65.167392 },
-    { 6686, 93747, 80.493645 },
-    { 6686, 94376, 37.625535 },
-    { 6686, 95947, 65.392983 },
-    { 6686, 97165, 49.874030 },
-    { 6686, 97278, 78.266425 },
-    { 6686, 97649, 79.213892 },
-    { 6686, 100453, 49.210269 },
-    { 6686, 102098, 43.113963 },
-    { 6686, 102488, 51.206113 },
-    { 6686, 104732, 50.928567 },
-    { 6686, 105199, 28.529777 },
-    { 6686, 106032, 25.448836 },
-    { 6686, 106278, 80.012902 },
-    { 6686, 107315, 64.750964 },
-    { 6686, 109074, 71.686883 },
-    { 6686, 109492, 24.453762 },
-    { 6686, 112158, 40.346721 },
-    { 6686, 113136, 81.906218 },
-    { 6686, 113881, 40.077662 },
-    { 6686, 113963, 51.768776 },
-    { 6686, 116727, 19.439935 },
-    { 7588, 8903, 78.125715 },
-    { 7588, 9236, 5.090852 },
-    { 7588, 9884, 80.937131 },
-    { 7588, 13847, 21.342292 },
-    { 7588, 14135, 63.673648 },
-    { 7588, 17678, 21.023285 },
-    { 7588, 18543, 51.167531 },
-    { 7588, 19780, 20.015622 },
-    { 7588, 21281, 24.219200 },
-    { 7588, 21421, 82.485498 },
-    { 7588, 22449, 75.089330 },
-    { 7588, 23685, 51.054046 },
-    { 7588, 23875, 66.269179 },
-    { 7588, 24305, 57.209523 },
-    { 7588, 24436, 64.326754 },
-    { 7588, 25281, 70.603908 },
-    { 7588, 25336, 78.400162 },
-    { 7588, 25606, 55.322632 },
-    { 7588, 25930, 73.348233 },
-    { 7588, 25985, 58.357841 },
-    { 7588, 26207, 82.725346 },
-    { 7588, 26241, 68.878037 },
-    { 7588, 26311, 73.068790 },
-    { 7588, 26634, 46.213377 },
-    { 7588, 26727, 72.981208 },
-    { 7588, 27366, 67.201662 },
-    { 7588, 27628, 46.469079 },
-    { 7588, 27989, 82.890258 },
-    { 7588, 30122, 54.798858 },
-    { 7588, 30324, 64.865223 },
-    { 7588, 30438, 39.409387 },
-    { 7588, 31685, 47.341281 },
-    { 7588, 32349, 68.921036 },
-    { 7588, 32607, 37.188063 },
-    { 7588, 32768, 43.862555 },
-    { 7588, 33579, 60.811867 },
-    { 7588, 33977, 65.516457 },
-    { 7588, 34444, 64.172686 },
-    { 7588, 35264, 56.913459 },
-    { 7588, 35904, 63.922151 },
-    { 7588, 36377, 53.750336 },
-    { 7588, 38170, 70.809163 },
-    { 7588, 39429, 60.404931 },
-    { 7588, 39757, 73.615133 },
-    { 7588, 39953, 55.416438 },
-    { 7588, 41037, 47.833311 },
-    { 7588, 42913, 53.396069 },
-    { 7588, 44816, 64.704369 },
-    { 7588, 45238, 44.532721 },
-    { 7588, 45556, 52.648313 },
-    { 7588, 45941, 56.468025 },
-    { 7588, 46701, 55.558226 },
-    { 7588, 48002, 50.168561 },
-    { 7588, 50099, 47.615373 },
-    { 7588, 50371, 55.145064 },
-    { 7588, 51576, 55.711530 },
-    { 7588, 52419, 53.899071 },
-    { 7588, 52727, 67.659670 },
-    { 7588, 56561, 57.465550 },
-    { 7588, 59196, 70.485341 },
-    { 7588, 59747, 62.859888 },
-    { 7588, 60718, 58.884917 },
-    { 7588, 61084, 64.874771 },
-    { 7588, 61585, 53.150790 },
-    { 7588, 61932, 73.168372 },
-    { 7588, 62322, 54.299062 },
-    { 7588, 62434, 62.657946 },
-    { 7588, 66657, 69.296088 },
-    { 7588, 68002, 75.409361 },
-    { 7588, 68702, 62.278154 },
-    { 7588, 71352, 79.867908 },
-    { 7588, 71681, 61.300397 },
-    { 7588, 71683, 61.304158 },
-    { 7588, 71860, 74.527416 },
-    { 7588, 71908, 57.171135 },
-    { 7588, 73273, 78.210559 },
-    { 7588, 73334, 79.199123 },
-    { 7588, 74946, 52.737127 },
-    { 7588, 75141, 79.720005 },
-    { 7588, 75264, 75.740999 },
-    { 7588, 76297, 78.553210 },
-    { 7588, 77952, 56.476884 },
-    { 7588, 82273, 49.084789 },
-    { 7588, 82396, 79.904817 },
-    { 7588, 82514, 76.343840 },
-    { 7588, 83081, 59.773639 },
-    { 7588, 84143, 69.991565 },
-    { 7588, 85258, 58.265314 },
-    { 7588, 85267, 57.542034 },
-    { 7588, 85696, 73.556176 },
-    { 7588, 85792, 62.551586 },
-    { 7588, 85927, 73.451453 },
-    { 7588, 86228, 67.976377 },
-    { 7588, 86670, 70.914371 },
-    { 7588, 87073, 69.470853 },
-    { 7588, 87261, 71.897124 },
-    { 7588, 88635, 75.896517 },
-    { 7588, 89642, 69.216383 },
-    { 7588, 89931, 74.690643 },
-    { 7588, 90185, 70.486027 },
-    { 7588, 90496, 77.612142 },
-    { 7588, 92041, 74.154003 },
-    { 7588, 92855, 73.549059 },
-    { 7588, 93506, 69.674851 },
-    { 7588, 93864, 70.953175 },
-    { 7588, 94141, 76.099936 },
-    { 7588, 100345, 71.771139 },
-    { 7588, 100751, 40.114690 },
-    { 7588, 101772, 44.545643 },
-    { 7588, 106278, 70.225205 },
-    { 7588, 107315, 82.224426 },
-    { 7588, 107556, 59.228904 },
-    { 7588, 108085, 41.306269 },
-    { 7588, 109074, 70.700412 },
-    { 7588, 109268, 32.847341 },
-    { 7588, 110130, 25.388722 },
-    { 7588, 112122, 28.239272 },
-    { 7588, 113136, 51.419980 },
-    { 7588, 113368, 39.110156 },
-    { 7588, 113963, 79.069092 },
-    { 8886, 8903, 42.861867 },
-    { 8886, 9640, 21.384638 },
-    { 8886, 9884, 40.263438 },
-    { 8886, 10064, 28.777322 },
-    { 8886, 11767, 25.604021 },
-    { 8886, 14135, 60.852132 },
-    { 8886, 14328, 13.600408 },
-    { 8886, 14354, 26.973601 },
-    { 8886, 14576, 25.145030 },
-    { 8886, 15863, 18.310650 },
-    { 8886, 17358, 21.715757 },
-    { 8886, 17702, 43.729949 },
-    { 8886, 18246, 36.891347 },
-    { 8886, 18532, 29.792195 },
-    { 8886, 18543, 80.754145 },
-    { 8886, 21421, 54.645615 },
-    { 8886, 22449, 64.781448 },
-    { 8886, 23015, 41.422250 },
-    { 8886, 23416, 32.936206 },
-    { 8886, 23767, 35.529217 },
-    { 8886, 23875, 77.639210 },
-    { 8886, 24436, 81.134383 },
-    { 8886, 24608, 32.819632 },
-    { 8886, 25281, 76.575728 },
-    { 8886, 25336, 68.509272 },
-    { 8886, 25428, 48.423547 },
-    { 8886, 25930, 75.315699 },
-    { 8886, 26207, 66.168665 },
-    { 8886, 26241, 80.843675 },
-    { 8886, 26311, 76.546470 },
-    { 8886, 26451, 56.239709 },
-    { 8886, 26727, 77.660973 },
-    { 8886, 27989, 70.477977 },
-    { 8886, 28360, 38.372171 },
-    { 8886, 28380, 44.643382 },
-    { 8886, 29655, 58.971323 },
-    { 8886, 30343, 59.844541 },
-    { 8886, 31681, 66.873229 },
-    { 8886, 32246, 59.857388 },
-    { 8886, 32362, 70.826697 },
-    { 8886, 36188, 79.556440 },
-    { 8886, 36850, 59.605476 },
-    { 8886, 37279, 83.643667 },
-    { 8886, 37826, 64.111330 },
-    { 8886, 41704, 41.589394 },
-    { 8886, 44127, 54.286370 },
-    { 8886, 45860, 68.214452 },
-    { 8886, 46853, 53.943674 },
-    { 8886, 47908, 80.118983 },
-    { 8886, 50801, 66.794753 },
-    { 8886, 53910, 55.446947 },
-    { 8886, 54061, 50.569033 },
-    { 8886, 54539, 67.040580 },
-    { 8886, 58001, 60.319447 },
-    { 8886, 59774, 57.809133 },
-    { 8886, 62956, 59.803958 },
-    { 8886, 63125, 77.353413 },
-    { 8886, 65378, 61.257548 },
-    { 8886, 67301, 67.008507 },
-    { 8886, 71075, 77.746871 },
-    { 8886, 72607, 41.863054 },
-    { 8886, 75097, 43.697526 },
-    { 8886, 75458, 56.157393 },
-    { 8886, 80331, 51.706088 },
-    { 8886, 81693, 79.181300 },
-    { 8886, 83895, 45.868789 },
-    { 8886, 84379, 83.186884 },
-    { 8886, 84380, 71.970493 },
-    { 8886, 85670, 56.649135 },
-    { 8886, 87833, 55.560506 },
-    { 8886, 91262, 63.464826 },
-    { 8886, 93194, 66.757867 },
-    { 8886, 93747, 82.910729 },
-    { 8886, 94376, 37.023623 },
-    { 8886, 95947, 67.677822 },
-    { 8886, 97165, 51.513265 },
-    { 8886, 97278, 81.396259 },
-    { 8886, 97649, 82.458717 },
-    { 8886, 100453, 51.670760 },
-    { 8886, 102098, 45.537225 },
-    { 8886, 102488, 54.321485 },
-    { 8886, 104732, 54.550879 },
-    { 8886, 105199, 29.664278 },
-    { 8886, 106032, 25.286794 },
-    { 8886, 107315, 69.199049 },
-    { 8886, 109074, 76.374829 },
-    { 8886, 109492, 26.771195 },
-    { 8886, 112158, 44.901233 },
-    { 8886, 113881, 44.789670 },
-    { 8886, 113963, 56.557970 },
-    { 8886, 116727, 17.362530 },
-    { 8903, 9236, 82.382392 },
-    { 8903, 9640, 21.609456 },
-    { 8903, 9884, 3.932704 },
-    { 8903, 10064, 14.552859 },
-    { 8903, 11767, 68.465530 },
-    { 8903, 13847, 62.884210 },
-    { 8903, 14135, 23.448857 },
-    { 8903, 14328, 35.345079 },
-    { 8903, 14354, 23.555912 },
-    { 8903, 14576, 25.473155 },
-    { 8903, 15863, 34.042788 },
-    { 8903, 17358, 34.678226 },
-    { 8903, 17702, 26.235276 },
-    { 8903, 18246, 28.846993 },
-    { 8903, 18532, 32.503227 },
-    { 8903, 18543, 45.784691 },
-    { 8903, 21281, 83.103688 },
-    { 8903, 21421, 38.346085 },
-    { 8903, 22449, 44.538947 },
-    { 8903, 23015, 42.103809 },
-    { 8903, 23416, 44.978147 },
-    { 8903, 23685, 63.480552 },
-    { 8903, 23767, 45.185326 },
-    { 8903, 23875, 53.994508 },
-    { 8903, 24305, 61.121493 },
-    { 8903, 24436, 57.019670 },
-    { 8903, 24608, 48.050738 },
-    { 8903, 25281, 56.342821 },
-    { 8903, 25336, 52.895634 },
-    { 8903, 25428, 48.319987 },
-    { 8903, 25606, 66.720280 },
-    { 8903, 25930, 57.107642 },
-    { 8903, 25985, 65.935760 },
-    { 8903, 26207, 54.001230 },
-    { 8903, 26241, 60.389844 },
-    { 8903, 26311, 58.444560 },
-    { 8903, 26451, 51.771687 },
-    { 8903, 26634, 76.637361 },
-    { 8903, 26727, 59.788634 },
-    { 8903, 27366, 64.859918 },
-    { 8903, 27628, 79.509217 },
-    { 8903, 27989, 59.508008 },
-    { 8903, 28360, 55.287475 },
-    { 8903, 28380, 55.062529 },
-    { 8903, 29655, 59.991353 },
-    { 8903, 30122, 81.622762 },
-    { 8903, 30324, 76.247799 },
-    { 8903, 30343, 61.814936 },
-    { 8903, 31681, 66.691830 },
-    { 8903, 32246, 65.930756 },
-    { 8903, 32349, 80.494770 },
-    { 8903, 32362, 69.462837 },
-    { 8903, 36188, 80.683093 },
-    { 8903, 36850, 75.109430 },
-    { 8903, 37826, 78.436492 },
-    { 8903, 41704, 76.168751 },
-    { 8903, 94376, 74.710026 },
-    { 8903, 97165, 77.058069 },
-    { 8903, 100453, 71.625181 },
-    { 8903, 102098, 67.307711 },
-    { 8903, 102488, 68.194350 },
-    { 8903, 104732, 63.292550 },
-    { 8903, 105199, 61.999628 },
-    { 8903, 106032, 62.673012 },
-    { 8903, 106278, 69.675883 },
-    { 8903, 107315, 61.017500 },
-    { 8903, 107556, 71.077511 },
-    { 8903, 108085, 81.148064 },
-    { 8903, 109074, 59.722131 },
-    { 8903, 109492, 54.707871 },
-    { 8903, 112122, 80.314682 },
-    { 8903, 112158, 43.926280 },
-    { 8903, 113136, 57.375621 },
-    { 8903, 113368, 66.014609 },
-    { 8903, 113881, 39.360955 },
-    { 8903, 113963, 40.662978 },
-    { 8903, 116727, 59.113850 },
-    { 9236, 13847, 23.111071 },
-    { 9236, 14135, 66.794319 },
-    { 9236, 17678, 15.963662 },
-    { 9236, 18543, 52.623337 },
-    { 9236, 19780, 15.752707 },
-    { 9236, 21281, 21.043091 },
-    { 9236, 22449, 76.093242 },
-    { 9236, 23685, 50.447911 },
-    { 9236, 23875, 66.438842 },
-    { 9236, 24305, 56.762885 },
-    { 9236, 24436, 64.217883 },
-    { 9236, 25281, 70.527190 },
-    { 9236, 25336, 78.655912 },
-    { 9236, 25606, 54.302784 },
-    { 9236, 25930, 73.199663 },
-    { 9236, 25985, 57.397669 },
-    { 9236, 26207, 82.916755 },
-    { 9236, 26241, 68.421412 },
-    { 9236, 26311, 72.795647 },
-    { 9236, 26634, 44.140338 },
-    { 9236, 26727, 72.583072 },
-    { 9236, 27366, 66.320849 },
-    { 9236, 27628, 44.073312 },
-    { 9236, 27989, 82.584291 },
-    { 9236, 30122, 52.254915 },
-    { 9236, 30324, 62.907232 },
-    { 9236, 30438, 35.364365 },
-    { 9236, 31685, 43.773725 },
-    { 9236, 32349, 66.618899 },
-    { 9236, 32607, 32.444023 },
-    { 9236, 32768, 39.731415 },
-    { 9236, 33579, 57.723228 },
-    { 9236, 33977, 62.598738 },
-    { 9236, 34444, 61.059640 },
-    { 9236, 35264, 53.200698 },
-    { 9236, 35904, 60.464098 },
-    { 9236, 36377, 49.635130 },
-    { 9236, 38170, 67.198290 },
-    { 9236, 39429, 56.107604 },
-    { 9236, 39757, 69.798178 },
-    { 9236, 39953, 50.838347 },
-    { 9236, 41037, 42.878199 },
-    { 9236, 42913, 48.469249 },
-    { 9236, 44816, 59.885359 },
-    { 9236, 45238, 39.447689 },
-    { 9236, 45556, 47.589457 },
-    { 9236, 45941, 51.439149 },
-    { 9236, 46701, 50.497201 },
-    { 9236, 48002, 45.080603 },
-    { 9236, 50099, 42.584550 },
-    { 9236, 50371, 50.060757 },
-    { 9236, 51576, 50.640587 },
-    { 9236, 52419, 48.858690 },
-    { 9236, 52727, 62.569584 },
-    { 9236, 56561, 52.527164 },
-    { 9236, 59196, 65.566684 },
-    { 9236, 59747, 58.019669 },
-    { 9236, 60718, 54.125004 },
-    { 9236, 61084, 60.091911 },
-    { 9236, 61585, 48.486231 },
-    { 9236, 61932, 68.390292 },
-    { 9236, 62322, 49.663410 },
-    { 9236, 62434, 57.970601 },
-    { 9236, 65109, 81.412212 },
-    { 9236, 66657, 64.902940 },
-    { 9236, 68002, 71.139875 },
-    { 9236, 68702, 58.053225 },
-    { 9236, 68933, 82.048125 },
-    { 9236, 71352, 76.005238 },
-    { 9236, 71681, 57.340320 },
-    { 9236, 71683, 57.344315 },
-    { 9236, 71860, 70.696255 },
-    { 9236, 71908, 53.194196 },
-    { 9236, 73273, 74.599209 },
-    { 9236, 73334, 75.605730 },
-    { 9236, 74946, 48.959454 },
-    { 9236, 75141, 76.418200 },
-    { 9236, 75264, 72.396703 },
-    { 9236, 76297, 75.422191 },
-    { 9236, 77952, 53.098292 },
-    { 9236, 82273, 45.936161 },
-    { 9236, 82396, 78.046707 },
-    { 9236, 82514, 74.393841 },
-    { 9236, 83081, 57.278650 },
-    { 9236, 84143, 68.166555 },
-    { 9236, 85258, 56.099734 },
-    { 9236, 85267, 55.337388 },
-    { 9236, 85696, 72.246395 },
-    { 9236, 85792, 60.728794 },
-    { 9236, 85927, 72.195016 },
-    { 9236, 86228, 66.533694 },
-    { 9236, 86670, 69.720300 },
-    { 9236, 87073, 68.309638 },
-    { 9236, 87261, 70.905775 },
-    { 9236, 88635, 75.458816 },
-    { 9236, 89642, 68.690665 },
-    { 9236, 89931, 74.543124 },
-    { 9236, 90185, 70.181946 },
-    { 9236, 90496, 77.785300 },
-    { 9236, 92041, 74.569577 },
-    { 9236, 92855, 74.166703 },
-    { 9236, 93506, 70.246563 },
-    { 9236, 93864, 71.709275 },
-    { 9236, 94141, 77.220849 },
-    { 9236, 100345, 74.396676 },
-    { 9236, 100751, 40.016169 },
-    { 9236, 101772, 45.524326 },
-    { 9236, 106278, 74.215090 },
-    { 9236, 107556, 63.103407 },
-    { 9236, 108085, 44.280332 },
-    { 9236, 109074, 75.199045 },
-    { 9236, 109268, 35.245657 },
-    { 9236, 110130, 25.998205 },
-    { 9236, 112122, 31.205851 },
-    { 9236, 113136, 56.097938 },
-    { 9236, 113368, 43.457947 },
-    { 9640, 9884, 18.879318 },
-    { 9640, 10064, 7.424320 },
-    { 9640, 11767, 46.939795 },
-    { 9640, 13847, 83.545726 },
-    { 9640, 14135, 40.391891 },
-    { 9640, 14328, 15.071123 },
-    { 9640, 14354, 12.126290 },
-    { 9640, 14576, 12.067403 },
-    { 9640, 15863, 15.776352 },
-    { 9640, 17358, 18.228446 },
-    { 9640, 17702, 28.106131 },
-    { 9640, 18246, 24.188486 },
-    { 9640, 18532, 21.469042 },
-    { 9640, 18543, 61.690861 },
-    { 9640, 21421, 41.421115 },
-    { 9640, 22449, 50.849851 },
-    { 9640, 23015, 35.018580 },
-    { 9640, 23416, 32.156157 },
-    { 9640, 23685, 77.067305 },
-    { 9640, 23767, 33.646631 },
-    { 9640, 23875, 63.132045 },
-    { 9640, 24305, 72.909737 },
-    { 9640, 24436, 66.623549 },
-    { 9640, 24608, 34.237432 },
-    { 9640, 25281, 63.564517 },
-    { 9640, 25336, 57.062270 },
-    { 9640, 25428, 42.743136 },
-    { 9640, 25606, 78.723377 },
-    { 9640, 25930, 63.169641 },
-    { 9640, 25985, 76.986244 },
-    { 9640, 26207, 56.196981 },
-    { 9640, 26241, 68.012665 },
-    { 9640, 26311, 64.540335 },
-    { 9640, 26451, 49.183257 },
-    { 9640, 26727, 65.844450 },
-    { 9640, 27366, 72.854838 },
-    { 9640, 27989, 61.492542 },
-    { 9640, 28360, 41.760764 },
-    { 9640, 28380, 44.693396 },
-    { 9640, 29655, 55.212010 },
-    { 9640, 30343, 56.701330 },
-    { 9640, 31681, 63.218851 },
-    { 9640, 32246, 59.015369 },
-    { 9640, 32362, 66.880835 },
-    { 9640, 36188, 77.650024 },
-    { 9640, 36850, 64.166162 },
-    { 9640, 37279, 81.941056 },
-    { 9640, 37826, 68.330623 },
-    { 9640, 41704, 56.917544 },
-    { 9640, 44127, 67.503701 },
-    { 9640, 45860, 79.697248 },
-    { 9640, 46853, 69.219752 },
-    { 9640, 50801, 82.430528 },
-    { 9640, 53910, 74.099697 },
-    { 9640, 54061, 69.759678 },
-    { 9640, 58001, 80.004138 },
-    { 9640, 59774, 78.058963 },
-    { 9640, 62956, 80.603731 },
-    { 9640, 65378, 82.372273 },
-    { 9640, 72607, 63.245810 },
-    { 9640, 75097, 65.027855 },
-    { 9640, 75458, 77.323227 },
-    { 9640, 80331, 72.354541 },
-    { 9640, 83895, 66.206306 },
-    { 9640, 85670, 75.391110 },
-    { 9640, 87833, 73.489117 },
-    { 9640, 91262, 77.974987 },
-    { 9640, 93194, 79.064412 },
-    { 9640, 94376, 55.914130 },
-    { 9640, 95947, 77.201450 },
-    { 9640, 97165, 64.263641 },
-    { 9640, 100453, 61.299379 },
-    { 9640, 102098, 55.715776 },
-    { 9640, 102488, 60.738013 },
-    { 9640, 104732, 58.093918 },
-    { 9640, 105199, 45.030244 },
-    { 9640, 106032, 43.618856 },
-    { 9640, 106278, 77.921939 },
-    { 9640, 107315, 64.905140 },
-    { 9640, 107556, 82.999108 },
-    { 9640, 109074, 68.214736 },
-    { 9640, 109492, 38.990666 },
-    { 9640, 112158, 41.613102 },
-    { 9640, 113136, 72.622773 },
-    { 9640, 113368, 83.740917 },
-    { 9640, 113881, 38.926806 },
-    { 9640, 113963, 46.924529 },
-    { 9640, 116727, 38.219037 },
-    { 9884, 10064, 11.536139 },
-    { 9884, 11767, 65.805624 },
-    { 9884, 13847, 64.868073 },
-    { 9884, 14135, 23.500639 },
-    { 9884, 14328, 31.952249 },
-    { 9884, 14354, 19.705643 },
-    { 9884, 14576, 21.664428 },
-    { 9884, 15863, 30.397858 },
-    { 9884, 17358, 30.883844 },
-    { 9884, 17702, 22.926950 },
-    { 9884, 18246, 25.052663 },
-    { 9884, 18532, 28.570528 },
-    { 9884, 18543, 45.844059 },
-    { 9884, 21421, 35.529809 },
-    { 9884, 22449, 42.359531 },
-    { 9884, 23015, 38.338717 },
-    { 9884, 23416, 41.046283 },
-    { 9884, 23685, 63.079838 },
-    { 9884, 23767, 41.268536 },
-    { 9884, 23875, 52.491981 },
-    { 9884, 24305, 60.270638 },
-    { 9884, 24436, 55.650104 },
-    { 9884, 24608, 44.118493 },
-    { 9884, 25281, 54.501214 },
-    { 9884, 25336, 50.487043 },
-    { 9884, 25428, 44.711250 },
-    { 9884, 25606, 65.973872 },
-    { 9884, 25930, 55.068312 },
-    { 9884, 25985, 64.969927 },
-    { 9884, 26207, 51.311775 },
-    { 9884, 26241, 58.671800 },
-    { 9884, 26311, 56.427613 },
-    { 9884, 26451, 48.467465 },
-    { 9884, 26634, 76.529793 },
-    { 9884, 26727, 57.780907 },
-    { 9884, 27366, 63.262194 },
-    { 9884, 27628, 79.394591 },
-    { 9884, 27989, 56.854481 },
-    { 9884, 28360, 51.357353 },
-    { 9884, 28380, 51.212068 },
-    { 9884, 29655, 56.549176 },
-    { 9884, 30122, 80.941487 },
-    { 9884, 30324, 74.846332 },
-    { 9884, 30343, 58.356161 },
-    { 9884, 31681, 63.432299 },
-    { 9884, 32246, 62.345684 },
-    { 9884, 32349, 78.857951 },
-    { 9884, 32362, 66.323360 },
-    { 9884, 36188, 77.578107 },
-    { 9884, 36850, 71.297569 },
-    { 9884, 37279, 81.543415 },
-    { 9884, 37826, 74.682855 },
-    { 9884, 41704, 72.413653 },
-    { 9884, 44127, 80.908683 },
-    { 9884, 46853, 83.996273 },
-    { 9884, 72607, 82.121244 },
-    { 9884, 75097, 83.862282 },
-    { 9884, 94376, 73.383398 },
-    { 9884, 97165, 77.314705 },
-    { 9884, 100453, 72.347015 },
-    { 9884, 102098, 67.725670 },
-    { 9884, 102488, 69.425765 },
-    { 9884, 104732, 64.863776 },
-    { 9884, 105199, 61.124237 },
-    { 9884, 106032, 61.201376 },
-    { 9884, 106278, 73.143771 },
-    { 9884, 107315, 63.927224 },
-    { 9884, 107556, 74.848924 },
-    { 9884, 109074, 63.152883 },
-    { 9884, 109492, 54.071703 },
-    { 9884, 112158, 45.670888 },
-    { 9884, 113136, 61.280970 },
-    { 9884, 113368, 69.930518 },
-    { 9884, 113881, 41.309455 },
-    { 9884, 113963, 43.635667 },
-    { 9884, 116727, 56.912349 },
-    { 10064, 11767, 54.280240 },
-    { 10064, 13847, 76.123697 },
-    { 10064, 14135, 33.222706 },
-    { 10064, 14328, 20.912672 },
-    { 10064, 14354, 11.754126 },
-    { 10064, 14576, 12.980746 },
-    { 10064, 15863, 20.177693 },
-    { 10064, 17358, 21.552262 },
-    { 10064, 17702, 23.828129 },
-    { 10064, 18246, 21.976051 },
-    { 10064, 18532, 21.970366 },
-    { 10064, 18543, 54.894657 },
-    { 10064, 21421, 37.476264 },
-    { 10064, 22449, 46.227132 },
-    { 10064, 23015, 34.468428 },
-    { 10064, 23416, 34.046235 },
-    { 10064, 23685, 70.917013 },
-    { 10064, 23767, 34.982842 },
-    { 10064, 23875, 57.964520 },
-    { 10064, 24305, 67.170664 },
-    { 10064, 24436, 61.382591 },
-    { 10064, 24608, 36.663856 },
-    { 10064, 25281, 58.941905 },
-    { 10064, 25336, 53.222127 },
-    { 10064, 25428, 41.871192 },
-    { 10064, 25606, 72.991757 },
-    { 10064, 25930, 58.879343 },
-    { 10064, 25985, 71.488644 },
-    { 10064, 26207, 52.958105 },
-    { 10064, 26241, 63.348292 },
-    { 10064, 26311, 60.264780 },
-    { 10064, 26451, 47.390866 },
-    { 10064, 26727, 61.603811 },
-    { 10064, 27366, 68.156581 },
-    { 10064, 27989, 58.437251 },
-    { 10064, 28360, 44.220655 },
-    { 10064, 28380, 45.819662 },
-    { 10064, 29655, 54.368658 },
-    { 10064, 30324, 80.005915 },
-    { 10064, 30343, 56.014961 },
-    { 10064, 31681, 62.066512 },
-    { 10064, 32246, 59.057066 },
-    { 10064, 32349, 83.249725 },
-    { 10064, 32362, 65.481470 },
-    { 10064, 36188, 76.598741 },
-    { 10064, 36850, 65.885883 },
-    { 10064, 37279, 80.818788 },
-    { 10064, 37826, 69.774912 },
-    { 10064, 41704, 62.358079 },
-    { 10064, 44127, 72.024532 },
-    { 10064, 45860, 83.319416 },
-    { 10064, 46853, 74.384102 },
-    { 10064, 53910, 80.344935 },
-    { 10064, 54061, 76.234273 },
-    { 10064, 72607, 70.638739 },
-    { 10064, 75097, 72.445560 },
-    { 10064, 80331, 79.714020 },
-    { 10064, 83895, 73.524256 },
-    { 10064, 85670, 82.348136 },
-    { 10064, 87833, 80.265025 },
-    { 10064, 91262, 83.796055 },
-    { 10064, 94376, 63.016848 },
-    { 10064, 95947, 81.555836 },
-    { 10064, 97165, 69.846596 },
-    { 10064, 100453, 66.100844 },
-    { 10064, 102098, 60.831029 },
-    { 10064, 102488, 64.619773 },
-    { 10064, 104732, 61.184874 },
-    { 10064, 105199, 51.616853 },
-    { 10064, 106032, 50.729800 },
-    { 10064, 106278, 76.705803 },
-    { 10064, 107315, 65.022586 },
-    { 10064, 107556, 80.471505 },
-    { 10064, 109074, 66.750074 },
-    { 10064, 109492, 45.144337 },
-    { 10064, 112158, 43.280731 },
-    { 10064, 113136, 68.673538 },
-    { 10064, 113368, 78.849562 },
-    { 10064, 113881, 39.824643 },
-    { 10064, 113963, 45.761888 },
-    { 10064, 116727, 45.635710 },
-    { 11767, 14328, 35.765443 },
-    { 11767, 14354, 50.431483 },
-    { 11767, 14576, 48.317845 },
-    { 11767, 15863, 39.422441 },
-    { 11767, 17358, 41.512147 },
-    { 11767, 17702, 65.198899 },
-    { 11767, 18246, 57.427841 },
-    { 11767, 18532, 49.305691 },
-    { 11767, 21421, 72.860084 },
-    { 11767, 22449, 82.432593 },
-    { 11767, 23015, 56.241925 },
-    { 11767, 23416, 45.594955 },
-    { 11767, 23767, 48.192568 },
-    { 11767, 24608, 43.449670 },
-    { 11767, 25336, 83.115303 },
-    { 11767, 25428, 60.860713 },
-    { 11767, 26207, 79.553607 },
-    { 11767, 26451, 68.351519 },
-    { 11767, 27989, 82.128720 },
-    { 11767, 28360, 44.601833 },
-    { 11767, 28380, 52.336281 },
-    { 11767, 29655, 67.080629 },
-    { 11767, 30343, 67.095373 },
-    { 11767, 31681, 73.250340 },
-    { 11767, 32246, 64.536966 },
-    { 11767, 32362, 76.775059 },
-    { 11767, 36188, 81.506447 },
-    { 11767, 36850, 57.932425 },
-    { 11767, 37826, 61.827950 },
-    { 11767, 41704, 29.285124 },
-    { 11767, 43109, 83.629726 },
-    { 11767, 44127, 42.050680 },
-    { 11767, 45860, 55.767542 },
-    { 11767, 46853, 38.520759 },
-    { 11767, 47908, 66.461281 },
-    { 11767, 49669, 78.334662 },
-    { 11767, 50583, 70.494085 },
-    { 11767, 50801, 48.845159 },
-    { 11767, 53910, 34.070172 },
-    { 11767, 54061, 28.707162 },
-    { 11767, 54539, 45.971952 },
-    { 11767, 54872, 69.955666 },
-    { 11767, 54879, 75.049996 },
-    { 11767, 57632, 75.986227 },
-    { 11767, 58001, 36.875727 },
-    { 11767, 59774, 33.579058 },
-    { 11767, 62956, 34.711259 },
-    { 11767, 63125, 52.354924 },
-    { 11767, 63608, 79.721360 },
-    { 11767, 65378, 35.778985 },
-    { 11767, 67301, 41.409089 },
-    { 11767, 67927, 72.327694 },
-    { 11767, 69673, 71.546782 },
-    { 11767, 71075, 52.427978 },
-    { 11767, 72105, 63.660475 },
-    { 11767, 72607, 16.577988 },
-    { 11767, 75097, 18.885794 },
-    { 11767, 75458, 31.750548 },
-    { 11767, 76267, 63.993581 },
-    { 11767, 80331, 29.137222 },
-    { 11767, 80816, 69.150570 },
-    { 11767, 81693, 59.020406 },
-    { 11767, 83000, 81.216957 },
-    { 11767, 83895, 24.859300 },
-    { 11767, 84345, 76.168005 },
-    { 11767, 84379, 65.718281 },
-    { 11767, 84380, 53.749250 },
-    { 11767, 85670, 38.225012 },
-    { 11767, 86032, 77.953092 },
-    { 11767, 87833, 38.975652 },
-    { 11767, 91262, 51.573420 },
-    { 11767, 93194, 57.603001 },
-    { 11767, 93747, 76.408103 },
-    { 11767, 94376, 22.598108 },
-    { 11767, 95947, 62.236381 },
-    { 11767, 97165, 45.023100 },
-    { 11767, 97278, 79.532791 },
-    { 11767, 97649, 81.264288 },
-    { 11767, 100453, 49.777984 },
-    { 11767, 102098, 44.693466 },
-    { 11767, 102488, 55.987443 },
-    { 11767, 104732, 59.644170 },
-    { 11767, 105199, 27.274130 },
-    { 11767, 106032, 19.271255 },
-    { 11767, 107315, 79.897123 },
-    { 11767, 109492, 31.496816 },
-    { 11767, 112158, 59.381982 },
-    { 11767, 113881, 61.466115 },
-    { 11767, 113963, 74.339927 },
-    { 11767, 116727, 11.841328 },
-    { 13847, 14135, 44.404232 },
-    { 13847, 14354, 79.161031 },
-    { 13847, 14576, 81.291573 },
-    { 13847, 17678, 34.415101 },
-    { 13847, 17702, 65.421769 },
-    { 13847, 18246, 73.337007 },
-    { 13847, 18532, 81.454397 },
-    { 13847, 18543, 29.825793 },
-    { 13847, 19780, 24.934477 },
-    { 13847, 21281, 21.639683 },
-    { 13847, 21421, 61.185907 },
-    { 13847, 22449, 53.797002 },
-    { 13847, 23015, 78.420080 },
-    { 13847, 23685, 32.268498 },
-    { 13847, 23875, 45.674894 },
-    { 13847, 24305, 37.813704 },
-    { 13847, 24436, 44.148284 },
-    { 13847, 25281, 50.273295 },
-    { 13847, 25336, 57.587012 },
-    { 13847, 25428, 77.001639 },
-    { 13847, 25606, 37.340336 },
-    { 13847, 25930, 53.078122 },
-    { 13847, 25985, 40.071489 },
-    { 13847, 26207, 61.941484 },
-    { 13847, 26241, 49.181205 },
-    { 13847, 26311, 52.987188 },
-    { 13847, 26451, 71.772682 },
-    { 13847, 26634, 32.452079 },
-    { 13847, 26727, 53.100290 },
-    { 13847, 27366, 48.391370 },
-    { 13847, 27628, 33.967691 },
-    { 13847, 27989, 62.708239 },
-    { 13847, 29655, 77.691795 },
-    { 13847, 30122, 41.947512 },
-    { 13847, 30324, 49.088630 },
-    { 13847, 30343, 78.813768 },
-    { 13847, 30438, 36.608491 },
-    { 13847, 31681, 76.205932 },
-    { 13847, 31685, 40.301875 },
-    { 13847, 32246, 83.846896 },
-    { 13847, 32349, 54.071000 },
-    { 13847, 32362, 74.743212 },
-    { 13847, 32607, 40.212541 },
-    { 13847, 32768, 40.802755 },
-    { 13847, 33579, 49.759598 },
-    { 13847, 33977, 53.306004 },
-    { 13847, 34444, 52.941250 },
-    { 13847, 35264, 49.464505 },
-    { 13847, 35904, 54.393571 },
-    { 13847, 36188, 78.526907 },
-    { 13847, 36377, 49.167109 },
-    { 13847, 37279, 78.606475 },
-    { 13847, 38170, 61.508068 },
-    { 13847, 39429, 56.367314 },
-    { 13847, 39757, 65.241928 },
-    { 13847, 39953, 54.216636 },
-    { 13847, 41037, 51.865279 },
-    { 13847, 42913, 56.356264 },
-    { 13847, 44816, 65.089819 },
-    { 13847, 45238, 53.876963 },
-    { 13847, 45556, 58.393597 },
-    { 13847, 45941, 61.019582 },
-    { 13847, 46701, 61.103181 },
-    { 13847, 48002, 58.760922 },
-    { 13847, 50099, 58.413264 },
-    { 13847, 50371, 63.627732 },
-    { 13847, 51576, 64.813288 },
-    { 13847, 52419, 64.026898 },
-    { 13847, 52727, 74.627752 },
-    { 13847, 56561, 69.087755 },
-    { 13847, 59196, 81.684202 },
-    { 13847, 59747, 75.320851 },
-    { 13847, 60718, 72.263141 },
-    { 13847, 61084, 77.789807 },
-    { 13847, 61585, 67.500269 },
-    { 13847, 62322, 68.794019 },
-    { 13847, 62434, 76.449575 },
-    { 13847, 68702, 78.704464 },
-    { 13847, 71681, 78.784319 },
-    { 13847, 71683, 78.788828 },
-    { 13847, 71908, 74.675459 },
-    { 13847, 74946, 70.947636 },
-    { 13847, 77952, 75.648112 },
-    { 13847, 82273, 68.770162 },
-    { 13847, 83081, 80.379234 },
-    { 13847, 85258, 79.194094 },
-    { 13847, 85267, 78.437484 },
-    { 13847, 85792, 83.717300 },
-    { 13847, 100751, 61.214407 },
-    { 13847, 101772, 64.616657 },
-    { 13847, 106278, 80.056154 },
-    { 13847, 107556, 70.463135 },
-    { 13847, 108085, 57.429162 },
-    { 13847, 109074, 76.994052 },
-    { 13847, 109268, 51.007297 },
-    { 13847, 110130, 46.257833 },
-    { 13847, 112122, 45.452279 },
-    { 13847, 113136, 57.781034 },
-    { 13847, 113368, 49.484504 },
-    { 13847, 113963, 77.512717 },
-    { 14135, 14328, 49.419224 },
-    { 14135, 14354, 34.756839 },
-    { 14135, 14576, 36.889469 },
-    { 14135, 15863, 46.008461 },
-    { 14135, 17358, 44.562699 },
-    { 14135, 17678, 78.632999 },
-    { 14135, 17702, 22.787504 },
-    { 14135, 18246, 30.339553 },
-    { 14135, 18532, 38.049166 },
-    { 14135, 18543, 22.384732 },
-    { 14135, 19780, 67.971078 },
-    { 14135, 21281, 62.104184 },
-    { 14135, 21421, 26.119565 },
-    { 14135, 22449, 26.912443 },
-    { 14135, 23015, 39.506986 },
-    { 14135, 23416, 47.693156 },
-    { 14135, 23685, 40.076544 },
-    { 14135, 23767, 46.403309 },
-    { 14135, 23875, 32.672789 },
-    { 14135, 24305, 38.145237 },
-    { 14135, 24436, 35.194732 },
-    { 14135, 24608, 51.066211 },
-    { 14135, 25281, 36.113597 },
-    { 14135, 25336, 35.629171 },
-    { 14135, 25428, 42.049698 },
-    { 14135, 25606, 43.567908 },
-    { 14135, 25930, 37.657911 },
-    { 14135, 25985, 43.080903 },
-    { 14135, 26207, 38.348397 },
-    { 14135, 26241, 39.520329 },
-    { 14135, 26311, 38.819344 },
-    { 14135, 26451, 41.380915 },
-    { 14135, 26634, 53.201372 },
-    { 14135, 26727, 40.050971 },
-    { 14135, 27366, 43.452850 },
-    { 14135, 27628, 56.072911 },
-    { 14135, 27989, 43.116292 },
-    { 14135, 28360, 56.253181 },
-    { 14135, 28380, 52.332875 },
-    { 14135, 29655, 50.051250 },
-    { 14135, 30122, 58.343715 },
-    { 14135, 30324, 54.083777 },
-    { 14135, 30343, 51.866289 },
-    { 14135, 30438, 70.825397 },
-    { 14135, 31681, 54.233070 },
-    { 14135, 31685, 67.670995 },
-    { 14135, 32246, 57.118667 },
-    { 14135, 32349, 58.830015 },
-    { 14135, 32362, 55.730130 },
-    { 14135, 32607, 78.687484 },
-    { 14135, 32768, 73.118979 },
-    { 14135, 33579, 65.558802 },
-    { 14135, 33977, 64.861521 },
-    { 14135, 34444, 66.781067 },
-    { 14135, 35264, 71.984015 },
-    { 14135, 35904, 70.947197 },
-    { 14135, 36188, 65.901093 },
-    { 14135, 36377, 76.245139 },
-    { 14135, 36850, 69.277709 },
-    { 14135, 37279, 69.004272 },
-    { 14135, 37826, 71.116579 },
-    { 14135, 38170, 75.322179 },
-    { 14135, 39429, 81.506358 },
-    { 14135, 39757, 79.298592 },
-    { 14135, 41704, 82.522792 },
-    { 14135, 106032, 83.950822 },
-    { 14135, 106278, 83.133417 },
-    { 14135, 107315, 78.993882 },
-    { 14135, 107556, 80.436810 },
-    { 14135, 108085, 82.307205 },
-    { 14135, 109074, 74.189430 },
-    { 14135, 109268, 81.889591 },
-    { 14135, 109492, 77.552435 },
-    { 14135, 112122, 76.285267 },
-    { 14135, 112158, 66.258602 },
-    { 14135, 113136, 64.375968 },
-    { 14135, 113368, 67.478656 },
-    { 14135, 113881, 61.409884 },
-    { 14135, 113963, 59.404910 },
-    { 14135, 116727, 78.176844 },
-    { 14328, 14354, 14.666060 },
-    { 14328, 14576, 12.563613 },
-    { 14328, 15863, 4.735616 },
-    { 14328, 17358, 8.307907 },
-    { 14328, 17702, 30.479160 },
-    { 14328, 18246, 23.368288 },
-    { 14328, 18532, 16.212443 },
-    { 14328, 18543, 67.977780 },
-    { 14328, 21421, 41.045406 },
-    { 14328, 22449, 51.181420 },
-    { 14328, 23015, 28.457636 },
-    { 14328, 23416, 21.426815 },
-    { 14328, 23685, 80.240226 },
-    { 14328, 23767, 23.717020 },
-    { 14328, 23875, 64.038926 },
-    { 14328, 24305, 74.942802 },
-    { 14328, 24436, 67.534133 },
-    { 14328, 24608, 22.349423 },
-    { 14328, 25281, 63.025116 },
-    { 14328, 25336, 55.068019 },
-    { 14328, 25428, 35.838918 },
-    { 14328, 25606, 80.459078 },
-    { 14328, 25930, 61.835676 },
-    { 14328, 25985, 78.098754 },
-    { 14328, 26207, 52.920921 },
-    { 14328, 26241, 67.322263 },
-    { 14328, 26311, 63.088162 },
-    { 14328, 26451, 43.463832 },
-    { 14328, 26727, 64.231347 },
-    { 14328, 27366, 71.990062 },
-    { 14328, 27989, 57.465259 },
-    { 14328, 28360, 29.268511 },
-    { 14328, 28380, 34.060715 },
-    { 14328, 29655, 47.251278 },
-    { 14328, 30324, 83.120659 },
-    { 14328, 30343, 48.368240 },
-    { 14328, 31681, 55.353722 },
-    { 14328, 32246, 49.313939 },
-    { 14328, 32362, 59.275022 },
-    { 14328, 36188, 68.953225 },
-    { 14328, 36850, 51.805464 },
-    { 14328, 37279, 73.197302 },
-    { 14328, 37826, 56.208733 },
-    { 14328, 41704, 41.852613 },
-    { 14328, 43109, 82.166501 },
-    { 14328, 43813, 83.826914 },
-    { 14328, 44127, 52.590046 },
-    { 14328, 45860, 65.208840 },
-    { 14328, 46853, 54.151008 },
-    { 14328, 47908, 76.872885 },
-    { 14328, 50801, 67.365156 },
-    { 14328, 53910, 59.434418 },
-    { 14328, 54061, 55.349598 },
-    { 14328, 54539, 69.903222 },
-    { 14328, 58001, 65.728473 },
-    { 14328, 59774, 64.197342 },
-    { 14328, 62956, 67.294681 },
-    { 14328, 65378, 69.589175 },
-    { 14328, 67301, 75.894721 },
-    { 14328, 72607, 52.315867 },
-    { 14328, 75097, 54.628112 },
-    { 14328, 75458, 67.454197 },
-    { 14328, 80331, 63.914602 },
-    { 14328, 83895, 58.458706 },
-    { 14328, 85670, 69.915681 },
-    { 14328, 87833, 69.021542 },
-    { 14328, 91262, 77.010319 },
-    { 14328, 93194, 80.041456 },
-    { 14328, 94376, 50.412391 },
-    { 14328, 95947, 80.369489 },
-    { 14328, 97165, 64.750795 },
-    { 14328, 100453, 64.170926 },
-    { 14328, 102098, 58.085999 },
-    { 14328, 102488, 65.843507 },
-    { 14328, 104732, 64.978059 },
-    { 14328, 105199, 43.105528 },
-    { 14328, 106032, 38.861248 },
-    { 14328, 107315, 76.226854 },
-    { 14328, 109074, 81.262295 },
-    { 14328, 109492, 39.435452 },
-    { 14328, 112158, 51.816738 },
-    { 14328, 113881, 50.300246 },
-    { 14328, 113963, 60.150057 },
-    { 14328, 116727, 30.139403 },
-    { 14354, 14576, 2.191650 },
-    { 14354, 15863, 11.533836 },
-    { 14354, 17358, 11.260582 },
-    { 14354, 17702, 17.247982 },
-    { 14354, 18246, 12.148599 },
-    { 14354, 18532, 10.230449 },
-    { 14354, 18543, 53.786017 },
-    { 14354, 21421, 29.861936 },
-    { 14354, 22449, 39.651941 },
-    { 14354, 23015, 23.216283 },
-    { 14354, 23416, 22.359385 },
-    { 14354, 23685, 67.379155 },
-    { 14354, 23767, 23.229525 },
-    { 14354, 23875, 52.286666 },
-    { 14354, 24305, 62.633001 },
-    { 14354, 24436, 55.814441 },
-    { 14354, 24608, 25.104069 },
-    { 14354, 25281, 52.222266 },
-    { 14354, 25336, 45.286250 },
-    { 14354, 25428, 30.850069 },
-    { 14354, 25606, 68.366347 },
-    { 14354, 25930, 51.599701 },
-    { 14354, 25985, 66.352106 },
-    { 14354, 26207, 44.197298 },
-    { 14354, 26241, 56.663983 },
-    { 14354, 26311, 52.951357 },
-    { 14354, 26451, 37.084041 },
-    { 14354, 26634, 81.215952 },
-    { 14354, 26727, 54.225527 },
-    { 14354, 27366, 61.493838 },
-    { 14354, 27628, 83.850072 },
-    { 14354, 27989, 49.433641 },
-    { 14354, 28360, 32.611346 },
-    { 14354, 28380, 34.083056 },
-    { 14354, 29655, 43.373611 },
-    { 14354, 30122, 82.531060 },
-    { 14354, 30324, 73.199627 },
-    { 14354, 30343, 44.931291 },
-    { 14354, 31681, 51.292336 },
-    { 14354, 32246, 47.628213 },
-    { 14354, 32349, 75.665581 },
-    { 14354, 32362, 54.890327 },
-    { 14354, 33977, 83.765852 },
-    { 14354, 36188, 65.787667 },
-    { 14354, 36850, 54.131765 },
-    { 14354, 37279, 70.062376 },
-    { 14354, 37826, 58.033273 },
-    { 14354, 41704, 52.783928 },
-    { 14354, 43109, 82.404387 },
-    { 14354, 44127, 61.319814 },
-    { 14354, 45860, 71.955973 },
-    { 14354, 46853, 64.290695 },
-    { 14354, 47908, 82.704921 },
-    { 14354, 50801, 77.122991 },
-    { 14354, 53910, 71.813912 },
-    { 14354, 54061, 68.275123 },
-    { 14354, 54539, 81.233015 },
-    { 14354, 58001, 78.705871 },
-    { 14354, 59774, 77.680173 },
-    { 14354, 62956, 81.190816 },
-    { 14354, 65378, 83.762213 },
-    { 14354, 72607, 66.977621 },
-    { 14354, 75097, 69.291254 },
-    { 14354, 75458, 82.107218 },
-    { 14354, 80331, 78.375775 },
-    { 14354, 83895, 72.735155 },
-    { 14354, 85670, 83.544225 },
-    { 14354, 87833, 82.228547 },
-    { 14354, 94376, 63.870843 },
-    { 14354, 97165, 75.162295 },
-    { 14354, 100453, 72.870145 },
-    { 14354, 102098, 67.110619 },
-    { 14354, 102488, 72.721129 },
-    { 14354, 104732, 70.213601 },
-    { 14354, 105199, 54.712262 },
-    { 14354, 106032, 51.835594 },
-    { 14354, 107315, 76.258417 },
-    { 14354, 109074, 78.457975 },
-    { 14354, 109492, 49.530810 },
-    { 14354, 112158, 53.536295 },
-    { 14354, 113136, 80.007026 },
-    { 14354, 113881, 50.566877 },
-    { 14354, 113963, 57.375904 },
-    { 14354, 116727, 44.229248 },
-    { 14576, 15863, 9.342364 },
-    { 14576, 17358, 9.221712 },
-    { 14576, 17702, 18.747105 },
-    { 14576, 18246, 12.931623 },
-    { 14576, 18532, 9.486628 },
-    { 14576, 18543, 55.673619 },
-    { 14576, 21421, 30.915958 },
-    { 14576, 22449, 40.840435 },
-    { 14576, 23015, 22.951934 },
-    { 14576, 23416, 21.101343 },
-    { 14576, 23685, 68.935165 },
-    { 14576, 23767, 22.190056 },
-    { 14576, 23875, 53.567729 },
-    { 14576, 24305, 64.058746 },
-    { 14576, 24436, 57.097945 },
-    { 14576, 24608, 23.683387 },
-    { 14576, 25281, 53.303801 },
-    { 14576, 25336, 46.132881 },
-    { 14576, 25428, 30.676818 },
-    { 14576, 25606, 69.756442 },
-    { 14576, 25930, 52.564534 },
-    { 14576, 25985, 67.665860 },
-    { 14576, 26207, 44.831118 },
-    { 14576, 26241, 57.730971 },
-    { 14576, 26311, 53.901676 },
-    { 14576, 26451, 37.228902 },
-    { 14576, 26634, 82.728038 },
-    { 14576, 26727, 55.154887 },
-    { 14576, 27366, 62.543634 },
-    { 14576, 27989, 49.966907 },
-    { 14576, 28360, 31.240751 },
-    { 14576, 28380, 33.165833 },
-    { 14576, 29655, 43.146776 },
-    { 14576, 30122, 83.760445 },
-    { 14576, 30324, 74.173366 },
-    { 14576, 30343, 44.645940 },
-    { 14576, 31681, 51.152482 },
-    { 14576, 32246, 47.091447 },
-    { 14576, 32349, 76.459533 },
-    { 14576, 32362, 54.824748 },
-    { 14576, 36188, 65.585163 },
-    { 14576, 36850, 53.068965 },
-    { 14576, 37279, 69.875110 },
-    { 14576, 37826, 57.059801 },
-    { 14576, 41704, 50.762888 },
-    { 14576, 43109, 81.765403 },
-    { 14576, 43813, 83.699572 },
-    { 14576, 44127, 59.525125 },
-    { 14576, 45860, 70.413952 },
-    { 14576, 46853, 62.362829 },
-    { 14576, 47908, 81.308254 },
-    { 14576, 50801, 75.257715 },
-    { 14576, 53910, 69.704449 },
-    { 14576, 54061, 66.126896 },
-    { 14576, 54539, 79.219794 },
-    { 14576, 58001, 76.559630 },
-    { 14576, 59774, 75.505608 },
-    { 14576, 62956, 79.002017 },
-    { 14576, 65378, 81.570701 },
-    { 14576, 72607, 64.851013 },
-    { 14576, 75097, 67.188404 },
-    { 14576, 75458, 80.017784 },
-    { 14576, 80331, 76.381425 },
-    { 14576, 83895, 70.798150 },
-    { 14576, 85670, 81.780273 },
-    { 14576, 87833, 80.558516 },
-    { 14576, 94376, 62.125101 },
-    { 14576, 97165, 74.016708 },
-    { 14576, 100453, 72.012030 },
-    { 14576, 102098, 66.177838 },
-    { 14576, 102488, 72.162375 },
-    { 14576, 104732, 69.906216 },
-    { 14576, 105199, 53.298297 },
-    { 14576, 106032, 50.167075 },
-    { 14576, 107315, 76.770086 },
-    { 14576, 109074, 79.385463 },
-    { 14576, 109492, 48.349480 },
-    { 14576, 112158, 53.678543 },
-    { 14576, 113136, 81.554047 },
-    { 14576, 113881, 50.906926 },
-    { 14576, 113963, 58.205096 },
-    { 14576, 116727, 42.320037 },
-    { 15863, 17358, 3.696798 },
-    { 15863, 17702, 26.149095 },
-    { 15863, 18246, 18.816994 },
-    { 15863, 18532, 11.483827 },
-    { 15863, 18543, 63.802388 },
-    { 15863, 21421, 36.351286 },
-    { 15863, 22449, 46.487346 },
-    { 15863, 23015, 23.889213 },
-    { 15863, 23416, 17.660094 },
-    { 15863, 23685, 75.637760 },
-    { 15863, 23767, 19.731160 },
-    { 15863, 23875, 59.341467 },
-    { 15863, 24305, 70.278108 },
-    { 15863, 24436, 62.830872 },
-    { 15863, 24608, 19.095384 },
-    { 15863, 25281, 58.291727 },
-    { 15863, 25336, 50.337311 },
-    { 15863, 25428, 31.381891 },
-    { 15863, 25606, 75.769092 },
-    { 15863, 25930, 57.101086 },
-    { 15863, 25985, 73.388006 },
-    { 15863, 26207, 48.225399 },
-    { 15863, 26241, 62.586796 },
-    { 15863, 26311, 58.355085 },
-    { 15863, 26451, 38.913675 },
-    { 15863, 26727, 59.501010 },
-    { 15863, 27366, 67.255090 },
-    { 15863, 27989, 52.823621 },
-    { 15863, 28360, 26.409332 },
-    { 15863, 28380, 30.439105 },
-    { 15863, 29655, 43.051363 },
-    { 15863, 30324, 78.404085 },
-    { 15863, 30343, 44.249124 },
-    { 15863, 31681, 51.182234 },
-    { 15863, 32246, 45.526932 },
-    { 15863, 32349, 79.904290 },
-    { 15863, 32362, 55.075350 },
-    { 15863, 36188, 65.018308 },
-    { 15863, 36850, 49.004154 },
-    { 15863, 37279, 69.291216 },
-    { 15863, 37826, 53.312527 },
-    { 15863, 41704, 42.227441 },
-    { 15863, 43109, 79.050596 },
-    { 15863, 43813, 80.798766 },
-    { 15863, 44127, 52.002633 },
-    { 15863, 45860, 63.934112 },
-    { 15863, 46853, 54.206543 },
-    { 15863, 47908, 75.353547 },
-    { 15863, 50583, 83.471463 },
-    { 15863, 50801, 67.315534 },
-    { 15863, 53910, 60.705135 },
-    { 15863, 54061, 56.961346 },
-    { 15863, 54539, 70.619434 },
-    { 15863, 58001, 67.394924 },
-    { 15863, 59774, 66.224236 },
-    { 15863, 62956, 69.666334 },
-    { 15863, 65378, 72.231447 },
-    { 15863, 67301, 78.675838 },
-    { 15863, 72607, 55.852541 },
-    { 15863, 75097, 58.303121 },
-    { 15863, 75458, 71.172663 },
-    { 15863, 80331, 67.985730 },
-    { 15863, 83895, 62.691925 },
-    { 15863, 85670, 74.402617 },
-    { 15863, 87833, 73.608270 },
-    { 15863, 91262, 81.743352 },
-    { 15863, 94376, 54.979132 },
-    { 15863, 97165, 69.465277 },
-    { 15863, 100453, 68.755133 },
-    { 15863, 102098, 62.689149 },
-    { 15863, 102488, 70.205149 },
-    { 15863, 104732, 69.071482 },
-    { 15863, 105199, 47.840884 },
-    { 15863, 106032, 43.534024 },
-    { 15863, 107315, 79.275727 },
-    { 15863, 109074, 83.585694 },
-    { 15863, 109492, 44.091121 },
-    { 15863, 112158, 55.089742 },
-    { 15863, 113881, 53.201670 },
-    { 15863, 113963, 62.323104 },
-    { 15863, 116727, 34.566547 },
-    { 17358, 17702, 23.699719 },
-    { 17358, 18246, 16.045975 },
-    { 17358, 18532, 8.226594 },
-    { 17358, 18543, 61.388501 },
-    { 17358, 21421, 33.121502 },
-    { 17358, 22449, 43.241580 },
-    { 17358, 23015, 20.199372 },
-    { 17358, 23416, 14.289515 },
-    { 17358, 23685, 72.568699 },
-    { 17358, 23767, 16.212962 },
-    { 17358, 23875, 56.072269 },
-    { 17358, 24305, 67.085262 },
-    { 17358, 24436, 59.541070 },
-    { 17358, 24608, 16.055643 },
-    { 17358, 25281, 54.866514 },
-    { 17358, 25336, 46.814346 },
-    { 17358, 25428, 27.685930 },
-    { 17358, 25606, 72.508787 },
-    { 17358, 25930, 53.606435 },
-    { 17358, 25985, 70.066778 },
-    { 17358, 26207, 44.616235 },
-    { 17358, 26241, 59.127920 },
-    { 17358, 26311, 54.845328 },
-    { 17358, 26451, 35.222343 },
-    { 17358, 26727, 55.973853 },
-    { 17358, 27366, 63.763086 },
-    { 17358, 27989, 49.165454 },
-    { 17358, 28360, 23.541457 },
-    { 17358, 28380, 27.064472 },
-    { 17358, 29655, 39.401231 },
-    { 17358, 30324, 74.829629 },
-    { 17358, 30343, 40.623311 },
-    { 17358, 31681, 47.536332 },
-    { 17358, 32246, 42.031638 },
-    { 17358, 32349, 76.256565 },
-    { 17358, 32362, 51.420125 },
-    { 17358, 36188, 61.443586 },
-    { 17358, 36850, 46.031690 },
-    { 17358, 37279, 65.724503 },
-    { 17358, 37826, 50.269776 },
-    { 17358, 41704, 41.542155 },
-    { 17358, 43109, 75.833339 },
-    { 17358, 43813, 77.624417 },
-    { 17358, 44127, 50.510287 },
-    { 17358, 45860, 61.888562 },
-    { 17358, 46853, 53.176723 },
-    { 17358, 47908, 73.098154 },
-    { 17358, 50583, 81.391098 },
-    { 17358, 50801, 66.129258 },
-    { 17358, 53910, 60.579557 },
-    { 17358, 54061, 57.136885 },
-    { 17358, 54539, 69.998467 },
-    { 17358, 58001, 67.554026 },
-    { 17358, 59774, 66.691688 },
-    { 17358, 62956, 70.413197 },
-    { 17358, 65378, 73.206082 },
-    { 17358, 67301, 79.748730 },
-    { 17358, 72607, 57.736199 },
-    { 17358, 75097, 60.313657 },
-    { 17358, 75458, 73.182456 },
-    { 17358, 80331, 70.386489 },
-    { 17358, 83895, 65.294593 },
-    { 17358, 85670, 77.316831 },
-    { 17358, 87833, 76.680829 },
-    { 17358, 94376, 58.042613 },
-    { 17358, 97165, 73.046477 },
-    { 17358, 100453, 72.434860 },
-    { 17358, 102098, 66.362393 },
-    { 17358, 102488, 73.897891 },
-    { 17358, 104732, 72.715043 },
-    { 17358, 105199, 51.341360 },
-    { 17358, 106032, 46.801413 },
-    { 17358, 107315, 82.492000 },
-    { 17358, 109492, 47.737482 },
-    { 17358, 112158, 58.449151 },
-    { 17358, 113881, 56.395232 },
-    { 17358, 113963, 65.109570 },
-    { 17358, 116727, 37.488744 },
-    { 17678, 18543, 60.750223 },
-    { 17678, 19780, 12.010630 },
-    { 17678, 21281, 19.749011 },
-    { 17678, 22449, 81.779536 },
-    { 17678, 23685, 52.916319 },
-    { 17678, 23875, 70.165208 },
-    { 17678, 24305, 59.243073 },
-    { 17678, 24436, 67.240303 },
-    { 17678, 25281, 73.287249 },
-    { 17678, 25336, 81.994906 },
-    { 17678, 25606, 55.191725 },
-    { 17678, 25930, 75.596392 },
-    { 17678, 25985, 58.248832 },
-    { 17678, 26241, 70.140282 },
-    { 17678, 26311, 74.833623 },
-    { 17678, 26634, 42.467321 },
-    { 17678, 26727, 74.248747 },
-    { 17678, 27366, 66.843968 },
-    { 17678, 27628, 41.271393 },
-    { 17678, 30122, 48.188031 },
-    { 17678, 30324, 60.139917 },
-    { 17678, 30438, 26.730743 },
-    { 17678, 31685, 36.443023 },
-    { 17678, 32349, 62.458924 },
-    { 17678, 32607, 20.072666 },
-    { 17678, 32768, 30.201169 },
-    { 17678, 33579, 51.270209 },
-    { 17678, 33977, 56.491349 },
-    { 17678, 34444, 54.319016 },
-    { 17678, 35264, 44.565072 },
-    { 17678, 35904, 52.443964 },
-    { 17678, 36377, 39.463950 },
-    { 17678, 38170, 58.271189 },
-    { 17678, 39429, 44.798565 },
-    { 17678, 39757, 59.971690 },
-    { 17678, 39953, 38.388279 },
-    { 17678, 41037, 28.464524 },
-    { 17678, 42913, 34.123937 },
-    { 17678, 44816, 45.951905 },
-    { 17678, 45238, 23.557290 },
-    { 17678, 45556, 32.272832 },
-    { 17678, 45941, 36.341600 },
-    { 17678, 46390, 80.335269 },
-    { 17678, 46701, 35.137427 },
-    { 17678, 48002, 29.212877 },
-    { 17678, 50099, 26.634675 },
-    { 17678, 50371, 34.156374 },
-    { 17678, 51576, 34.690187 },
-    { 17678, 52419, 32.899135 },
-    { 17678, 52727, 46.720044 },
-    { 17678, 52943, 78.563832 },
-    { 17678, 56561, 36.730866 },
-    { 17678, 59196, 49.784340 },
-    { 17678, 59316, 77.069661 },
-    { 17678, 59747, 42.438527 },
-    { 17678, 59803, 82.316858 },
-    { 17678, 60718, 38.782461 },
-    { 17678, 61084, 44.647587 },
-    { 17678, 61359, 77.523053 },
-    { 17678, 61585, 33.492848 },
-    { 17678, 61932, 52.917046 },
-    { 17678, 62322, 34.745588 },
-    { 17678, 62434, 42.802482 },
-    { 17678, 64962, 79.661091 },
-    { 17678, 65109, 66.381554 },
-    { 17678, 66657, 50.510892 },
-    { 17678, 68002, 57.019085 },
-    { 17678, 68702, 44.295782 },
-    { 17678, 68895, 77.725954 },
-    { 17678, 68933, 68.118701 },
-    { 17678, 71352, 62.975611 },
-    { 17678, 71681, 44.455876 },
-    { 17678, 71683, 44.460518 },
-    { 17678, 71860, 57.872251 },
-    { 17678, 71908, 40.385307 },
-    { 17678, 73273, 62.338810 },
-    { 17678, 73334, 63.373829 },
-    { 17678, 73714, 80.226465 },
-    { 17678, 74946, 37.009645 },
-    { 17678, 75141, 65.030464 },
-    { 17678, 75264, 60.998667 },
-    { 17678, 76297, 64.576000 },
-    { 17678, 77952, 42.324852 },
-    { 17678, 78265, 79.628476 },
-    { 17678, 78401, 83.115520 },
-    { 17678, 80112, 80.011943 },
-    { 17678, 80763, 79.089325 },
-    { 17678, 81266, 77.229430 },
-    { 17678, 82273, 36.399289 },
-    { 17678, 82396, 70.959319 },
-    { 17678, 82514, 67.189207 },
-    { 17678, 83081, 49.219856 },
-    { 17678, 84143, 61.651609 },
-    { 17678, 84970, 79.554614 },
-    { 17678, 85258, 49.189898 },
-    { 17678, 85267, 48.349638 },
-    { 17678, 85696, 67.123716 },
-    { 17678, 85792, 54.635387 },
-    { 17678, 85927, 67.240271 },
-    { 17678, 86228, 61.304666 },
-    { 17678, 86670, 65.091336 },
-    { 17678, 87073, 63.861029 },
-    { 17678, 87261, 66.842118 },
-    { 17678, 88635, 72.863084 },
-    { 17678, 89642, 66.198419 },
-    { 17678, 89931, 72.894563 },
-    { 17678, 90185, 68.291715 },
-    { 17678, 90496, 76.955369 },
-    { 17678, 92041, 74.664997 },
-    { 17678, 92855, 74.911574 },
-    { 17678, 93506, 71.067048 },
-    { 17678, 93864, 73.019218 },
-    { 17678, 94141, 79.371377 },
-    { 17678, 100345, 81.428491 },
-    { 17678, 100751, 41.168292 },
-    { 17678, 101772, 49.304189 },
-    { 17678, 107556, 74.508773 },
-    { 17678, 108085, 53.816536 },
-    { 17678, 109268, 43.915415 },
-    { 17678, 110130, 31.354694 },
-    { 17678, 112122, 41.669145 },
-    { 17678, 113136, 70.236077 },
-    { 17678, 113368, 56.831947 },
-    { 17702, 18246, 7.915237 },
-    { 17702, 18532, 16.053939 },
-    { 17702, 18543, 37.701569 },
-    { 17702, 21281, 79.775725 },
-    { 17702, 21421, 13.650308 },
-    { 17702, 22449, 22.743985 },
-    { 17702, 23015, 17.702646 },
-    { 17702, 23416, 24.921103 },
-    { 17702, 23685, 50.188063 },
-    { 17702, 23767, 23.761229 },
-    { 17702, 23875, 35.148284 },
-    { 17702, 24305, 45.385770 },
-    { 17702, 24436, 38.665957 },
-    { 17702, 24608, 28.303470 },
-    { 17702, 25281, 35.466475 },
-    { 17702, 25336, 29.394313 },
-    { 17702, 25428, 22.544015 },
-    { 17702, 25606, 51.126313 },
-    { 17702, 25930, 35.178691 },
-    { 17702, 25985, 49.159082 },
-    { 17702, 26207, 29.286104 },
-    { 17702, 26241, 39.912471 },
-    { 17702, 26311, 36.559386 },
-    { 17702, 26451, 25.551942 },
-    { 17702, 26634, 63.991367 },
-    { 17702, 26727, 37.884491 },
-    { 17702, 27366, 44.753706 },
-    { 17702, 27628, 66.610322 },
-    { 17702, 27989, 34.820807 },
-    { 17702, 28360, 33.873521 },
-    { 17702, 28380, 31.100805 },
-    { 17702, 29655, 33.783408 },
-    { 17702, 30122, 65.407135 },
-    { 17702, 30324, 56.579159 },
-    { 17702, 30343, 35.618774 },
-    { 17702, 31681, 40.507017 },
-    { 17702, 31685, 77.847375 },
-    { 17702, 32246, 39.934182 },
-    { 17702, 32349, 59.537086 },
-    { 17702, 32362, 43.422128 },
-    { 17702, 33579, 70.200163 },
-    { 17702, 33977, 67.417439 },
-    { 17702, 34444, 70.029211 },
-    { 17702, 35264, 78.595819 },
-    { 17702, 35904, 74.557683 },
-    { 17702, 36188, 54.686747 },
-    { 17702, 36850, 50.180458 },
-    { 17702, 37279, 58.701443 },
-    { 17702, 37826, 53.033678 },
-    { 17702, 38170, 76.306131 },
-    { 17702, 39757, 79.439229 },
-    { 17702, 41704, 59.746974 },
-    { 17702, 43109, 73.552947 },
-    { 17702, 43813, 75.706988 },
-    { 17702, 44127, 64.449847 },
-    { 17702, 45860, 71.496794 },
-    { 17702, 46853, 69.115713 },
-    { 17702, 47908, 80.177489 },
-    { 17702, 50801, 80.382137 },
-    { 17702, 53910, 79.688004 },
-    { 17702, 54061, 77.368590 },
-    { 17702, 72607, 81.298504 },
-    { 17702, 75097, 83.949190 },
-    { 17702, 94376, 80.753128 },
-    { 17702, 102098, 83.820503 },
-    { 17702, 105199, 71.960201 },
-    { 17702, 106032, 68.887055 },
-    { 17702, 109492, 66.667005 },
-    { 17702, 112158, 66.748155 },
-    { 17702, 113136, 81.815331 },
-    { 17702, 113881, 62.909021 },
-    { 17702, 113963, 66.514018 },
-    { 17702, 116727, 60.618563 },
-    { 18246, 18532, 8.161298 },
-    { 18246, 18543, 45.401507 },
-    { 18246, 21421, 18.062152 },
-    { 18246, 22449, 28.102586 },
-    { 18246, 23015, 13.299863 },
-    { 18246, 23416, 17.875715 },
-    { 18246, 23685, 56.875387 },
-    { 18246, 23767, 17.229055 },
-    { 18246, 23875, 40.924493 },
-    { 18246, 24305, 51.665518 },
-    { 18246, 24436, 44.447551 },
-    { 18246, 24608, 21.259300 },
-    { 18246, 25281, 40.428263 },
-    { 18246, 25336, 33.209262 },
-    { 18246, 25428, 20.131929 },
-    { 18246, 25606, 57.263914 },
-    { 18246, 25930, 39.637749 },
-    { 18246, 25985, 55.036947 },
-    { 18246, 26207, 32.049333 },
-    { 18246, 26241, 44.842169 },
-    { 18246, 26311, 40.972250 },
-    { 18246, 26451, 25.436154 },
-    { 18246, 26634, 70.477686 },
-    { 18246, 26727, 42.223508 },
-    { 18246, 27366, 49.642435 },
-    { 18246, 27628, 72.984858 },
-    { 18246, 27989, 37.306781 },
-    { 18246, 28360, 27.577703 },
-    { 18246, 28380, 26.277454 },
-    { 18246, 29655, 32.509355 },
-    { 18246, 30122, 70.986073 },
-    { 18246, 30324, 61.244796 },
-    { 18246, 30343, 34.208539 },
-    { 18246, 31681, 40.104143 },
-    { 18246, 31685, 83.898351 },
-    { 18246, 32246, 37.669425 },
-    { 18246, 32349, 63.561471 },
-    { 18246, 32362, 43.506390 },
-    { 18246, 33579, 74.987393 },
-    { 18246, 33977, 71.695381 },
-    { 18246, 34444, 74.421754 },
-    { 18246, 35264, 83.690835 },
-    { 18246, 35904, 78.910060 },
-    { 18246, 36188, 54.631130 },
-    { 18246, 36850, 46.262587 },
-    { 18246, 37279, 58.844252 },
-    { 18246, 37826, 49.636936 },
-    { 18246, 38170, 79.795331 },
-    { 18246, 39757, 82.549351 },
-    { 18246, 41704, 52.460308 },
-    { 18246, 43109, 72.333252 },
-    { 18246, 43813, 74.407079 },
-    { 18246, 44127, 58.161548 },
-    { 18246, 45860, 66.476539 },
-    { 18246, 46853, 62.408454 },
-    { 18246, 47908, 76.054254 },
-    { 18246, 50801, 74.220269 },
-    { 18246, 53910, 72.363291 },
-    { 18246, 54061, 69.811596 },
-    { 18246, 54539, 79.968126 },
-    { 18246, 58001, 79.929607 },
-    { 18246, 59774, 79.863745 },
-    { 18246, 72607, 73.434266 },
-    { 18246, 75097, 76.116772 },
-    { 18246, 83895, 81.338774 },
-    { 18246, 94376, 73.775131 },
-    { 18246, 102098, 79.108540 },
-    { 18246, 104732, 82.256392 },
-    { 18246, 105199, 65.891328 },
-    { 18246, 106032, 62.176984 },
-    { 18246, 109492, 61.214343 },
-    { 18246, 112158, 65.093738 },
-    { 18246, 113881, 61.783942 },
-    { 18246, 113963, 67.227458 },
-    { 18246, 116727, 53.377976 },
-    { 18532, 18543, 53.518533 },
-    { 18532, 21421, 24.912760 },
-    { 18532, 22449, 35.041967 },
-    { 18532, 23015, 13.676608 },
-    { 18532, 23416, 12.498182 },
-    { 18532, 23685, 64.342338 },
-    { 18532, 23767, 13.064615 },
-    { 18532, 23875, 47.886026 },
-    { 18532, 24305, 58.871772 },
-    { 18532, 24436, 51.366579 },
-    { 18532, 24608, 15.554964 },
-    { 18532, 25281, 46.815163 },
-    { 18532, 25336, 38.940259 },
-    { 18532, 25428, 21.437437 },
-    { 18532, 25606, 64.320480 },
-    { 18532, 25930, 45.666524 },
-    { 18532, 25985, 61.913710 },
-    { 18532, 26207, 37.021954 },
-    { 18532, 26241, 51.123641 },
-    { 18532, 26311, 46.935036 },
-    { 18532, 26451, 28.404418 },
-    { 18532, 26634, 77.721529 },
-    { 18532, 26727, 48.101082 },
-    { 18532, 27366, 55.813168 },
-    { 18532, 27628, 80.125173 },
-    { 18532, 27989, 41.835524 },
-    { 18532, 28360, 22.828702 },
-    { 18532, 28380, 23.853263 },
-    { 18532, 29655, 33.803291 },
-    { 18532, 30122, 77.477781 },
-    { 18532, 30324, 67.065429 },
-    { 18532, 30343, 35.255050 },
-    { 18532, 31681, 41.868715 },
-    { 18532, 32246, 37.605409 },
-    { 18532, 32349, 68.792005 },
-    { 18532, 32362, 45.608689 },
-    { 18532, 33579, 80.746943 },
-    { 18532, 33977, 77.037374 },
-    { 18532, 34444, 79.832282 },
-    { 18532, 36188, 56.225184 },
-    { 18532, 36850, 43.930800 },
-    { 18532, 37279, 60.521770 },
-    { 18532, 37826, 47.805903 },
-    { 18532, 41704, 45.534188 },
-    { 18532, 43109, 72.292438 },
-    { 18532, 43813, 74.237508 },
-    { 18532, 44127, 52.576359 },
-    { 18532, 45860, 62.341418 },
-    { 18532, 46853, 56.215566 },
-    { 18532, 47908, 72.789970 },
-    { 18532, 50583, 81.442022 },
-    { 18532, 50801, 68.600939 },
-    { 18532, 53910, 65.257849 },
-    { 18532, 54061, 62.381698 },
-    { 18532, 54539, 73.606665 },
-    { 18532, 58001, 72.644508 },
-    { 18532, 59774, 72.303586 },
-    { 18532, 62956, 76.426613 },
-    { 18532, 65378, 79.534951 },
-    { 18532, 72607, 65.273381 },
-    { 18532, 75097, 67.962656 },
-    { 18532, 75458, 80.787680 },
-    { 18532, 80331, 78.336844 },
-    { 18532, 83895, 73.382146 },
-    { 18532, 94376, 66.269023 },
-    { 18532, 97165, 80.815410 },
-    { 18532, 100453, 79.712228 },
-    { 18532, 102098, 73.713707 },
-    { 18532, 102488, 80.568081 },
-    { 18532, 104732, 78.767439 },
-    { 18532, 105199, 59.297436 },
-    { 18532, 106032, 54.977958 },
-    { 18532, 109492, 55.298098 },
-    { 18532, 112158, 63.054178 },
-    { 18532, 113881, 60.373321 },
-    { 18532, 113963, 67.582798 },
-    { 18532, 116727, 45.708791 },
-    { 18543, 19780, 49.052976 },
-    { 18543, 21281, 42.124888 },
-    { 18543, 21421, 31.443393 },
-    { 18543, 22449, 24.174284 },
-    { 18543, 23015, 48.749435 },
-    { 18543, 23416, 59.159387 },
-    { 18543, 23685, 18.300902 },
-    { 18543, 23767, 56.986169 },
-    { 18543, 23875, 19.158035 },
-    { 18543, 24305, 18.292155 },
-    { 18543, 24436, 19.509961 },
-    { 18543, 24608, 62.093207 },
-    { 18543, 25281, 24.082465 },
-    { 18543, 25336, 29.357096 },
-    { 18543, 25428, 47.214007 },
-    { 18543, 25606, 22.710992 },
-    { 18543, 25930, 26.755527 },
-    { 18543, 25985, 23.182189 },
-    { 18543, 26207, 33.616439 },
-    { 18543, 26241, 25.152939 },
-    { 18543, 26311, 27.231093 },
-    { 18543, 26451, 42.412739 },
-    { 18543, 26634, 30.864245 },
-    { 18543, 26727, 27.908858 },
-    { 18543, 27366, 27.129350 },
-    { 18543, 27628, 33.735330 },
-    { 18543, 27989, 35.818622 },
-    { 18543, 28360, 64.615290 },
-    { 18543, 28380, 58.232366 },
-    { 18543, 29655, 49.199755 },
-    { 18543, 30122, 36.725269 },
-    { 18543, 30324, 35.041274 },
-    { 18543, 30343, 50.573153 },
-    { 18543, 30438, 48.729315 },
-    { 18543, 31681, 49.501335 },
-    { 18543, 31685, 45.297126 },
-    { 18543, 32246, 55.920359 },
-    { 18543, 32349, 40.393680 },
-    { 18543, 32362, 49.135857 },
-    { 18543, 32607, 57.104517 },
-    { 18543, 32768, 50.806593 },
-    { 18543, 33579, 44.513985 },
-    { 18543, 33977, 44.810290 },
-    { 18543, 34444, 46.271084 },
-    { 18543, 35264, 50.081547 },
-    { 18543, 35904, 50.060856 },
-    { 18543, 36188, 56.290744 },
-    { 18543, 36377, 53.983249 },
-    { 18543, 36850, 68.887151 },
-    { 18543, 37279, 58.016948 },
-    { 18543, 37826, 68.904126 },
-    { 18543, 38170, 55.381469 },
-    { 18543, 39429, 59.547724 },
-    { 18543, 39757, 59.537023 },
-    { 18543, 39953, 61.823410 },
-    { 18543, 41037, 66.359590 },
-    { 18543, 42913, 68.448564 },
-    { 18543, 43109, 74.367418 },
-    { 18543, 43813, 76.300493 },
-    { 18543, 44816, 71.728820 },
-    { 18543, 45238, 73.464689 },
-    { 18543, 45556, 73.198030 },
-    { 18543, 45941, 73.836200 },
-    { 18543, 46390, 80.649734 },
-    { 18543, 46701, 75.065165 },
-    { 18543, 48002, 76.623127 },
-    { 18543, 50099, 78.649198 },
-    { 18543, 50371, 80.432209 },
-    { 18543, 51576, 82.098070 },
-    { 18543, 52419, 82.600106 },
-    { 18543, 108085, 82.649925 },
-    { 18543, 109268, 78.448056 },
-    { 18543, 110130, 75.767858 },
-    { 18543, 112122, 72.594719 },
-    { 18543, 113136, 72.994539 },
-    { 18543, 113368, 70.557319 },
-    { 18543, 113881, 82.370477 },
-    { 18543, 113963, 77.989207 },
-    { 19780, 21281, 7.844967 },
-    { 19780, 21421, 79.097405 },
-    { 19780, 22449, 69.769309 },
-    { 19780, 23685, 41.032867 },
-    { 19780, 23875, 58.230736 },
-    { 19780, 24305, 47.398411 },
-    { 19780, 24436, 55.369080 },
-    { 19780, 25281, 61.481997 },
-    { 19780, 25336, 70.150432 },
-    { 19780, 25606, 43.594193 },
-    { 19780, 25930, 63.861246 },
-    { 19780, 25985, 46.688891 },
-    { 19780, 26207, 74.080056 },
-    { 19780, 26241, 58.494223 },
-    { 19780, 26311, 63.157542 },
-    { 19780, 26634, 31.407251 },
-    { 19780, 26727, 62.641311 },
-    { 19780, 27366, 55.439282 },
-    { 19780, 27628, 30.620620 },
-    { 19780, 27989, 72.518482 },
-    { 19780, 30122, 38.243343 },
-    { 19780, 30324, 49.763490 },
-    { 19780, 30438, 19.623767 },
-    { 19780, 31681, 83.735791 },
-    { 19780, 31685, 28.339099 },
-    { 19780, 32349, 52.747635 },
-    { 19780, 32362, 80.883488 },
-    { 19780, 32607, 17.666914 },
-    { 19780, 32768, 23.978997 },
-    { 19780, 33579, 42.738478 },
-    { 19780, 33977, 47.797607 },
-    { 19780, 34444, 46.009532 },
-    { 19780, 35264, 37.586312 },
-    { 19780, 35904, 45.030812 },
-    { 19780, 36188, 79.800526 },
-    { 19780, 36377, 33.883141 },
-    { 19780, 37279, 78.026978 },
-    { 19780, 38170, 51.614152 },
-    { 19780, 39429, 40.415299 },
-    { 19780, 39757, 54.095116 },
-    { 19780, 39953, 35.466244 },
-    { 19780, 41037, 29.052554 },
-    { 19780, 42913, 34.340026 },
-    { 19780, 44816, 45.122424 },
-    { 19780, 45238, 29.061158 },
-    { 19780, 45556, 34.837369 },
-    { 19780, 45941, 38.141953 },
-    { 19780, 46390, 76.924942 },
-    { 19780, 46701, 37.707223 },
-    { 19780, 48002, 34.172397 },
-    { 19780, 50099, 33.488859 },
-    { 19780, 50371, 39.147665 },
-    { 19780, 51576, 40.192298 },
-    { 19780, 52419, 39.203395 },
-    { 19780, 52727, 50.858531 },
-    { 19780, 52943, 79.663727 },
-    { 19780, 56561, 44.159188 },
-    { 19780, 59196, 56.843451 },
-    { 19780, 59316, 82.256312 },
-    { 19780, 59747, 50.387311 },
-    { 19780, 60718, 47.404180 },
-    { 19780, 61084, 52.865870 },
-    { 19780, 61359, 83.747233 },
-    { 19780, 61585, 42.893346 },
-    { 19780, 61932, 60.842605 },
-    { 19780, 62322, 44.205067 },
-    { 19780, 62434, 51.615749 },
-    { 19780, 65109, 74.859427 },
-    { 19780, 66657, 60.155737 },
-    { 19780, 68002, 66.800284 },
-    { 19780, 68702, 54.654998 },
-    { 19780, 68933, 77.875281 },
-    { 19780, 71352, 73.499586 },
-    { 19780, 71681, 55.375351 },
-    { 19780, 71683, 55.380255 },
-    { 19780, 71860, 68.598856 },
-    { 19780, 71908, 51.423365 },
-    { 19780, 73273, 73.299194 },
-    { 19780, 73334, 74.334373 },
-    { 19780, 74946, 48.472226 },
-    { 19780, 75141, 76.327703 },
-    { 19780, 75264, 72.335767 },
-    { 19780, 76297, 76.058555 },
-    { 19780, 77952, 54.044560 },
-    { 19780, 82273, 48.357263 },
-    { 19780, 82396, 82.965904 },
-    { 19780, 82514, 79.196082 },
-    { 19780, 83081, 61.223202 },
-    { 19780, 84143, 73.654154 },
-    { 19780, 85258, 61.187896 },
-    { 19780, 85267, 60.349002 },
-    { 19780, 85696, 79.053238 },
-    { 19780, 85792, 66.603338 },
-    { 19780, 85927, 79.154123 },
-    { 19780, 86228, 73.223806 },
-    { 19780, 86670, 76.961025 },
-    { 19780, 87073, 75.702646 },
-    { 19780, 87261, 78.646140 },
-    { 19780, 89642, 77.718652 },
-    { 19780, 90185, 79.693148 },
-    { 19780, 93506, 81.707784 },
-    { 19780, 93864, 83.506148 },
-    { 19780, 100751, 51.270702 },
-    { 19780, 101772, 58.461679 },
-    { 19780, 107556, 78.849120 },
-    { 19780, 108085, 59.643204 },
-    { 19780, 109268, 50.235937 },
-    { 19780, 110130, 39.278955 },
-    { 19780, 112122, 46.672266 },
-    { 19780, 113136, 71.372594 },
-    { 19780, 113368, 59.093226 },
-    { 21281, 21421, 71.555937 },
-    { 21281, 22449, 62.094325 },
-    { 21281, 23685, 33.199525 },
-    { 21281, 23875, 50.422317 },
-    { 21281, 24305, 39.557632 },
-    { 21281, 24436, 47.534560 },
-    { 21281, 25281, 53.638250 },
-    { 21281, 25336, 62.311951 },
-    { 21281, 25606, 35.776965 },
-    { 21281, 25930, 56.016970 },
-    { 21281, 25985, 38.878745 },
-    { 21281, 26207, 66.235192 },
-    { 21281, 26241, 50.659848 },
-    { 21281, 26311, 55.318091 },
-    { 21281, 26451, 77.392681 },
-    { 21281, 26634, 23.876186 },
-    { 21281, 26727, 54.811969 },
-    { 21281, 27366, 47.665428 },
-    { 21281, 27628, 23.368322 },
-    { 21281, 27989, 64.708555 },
-    { 21281, 29655, 80.496944 },
-    { 21281, 30122, 31.346331 },
-    { 21281, 30324, 42.478445 },
-    { 21281, 30343, 80.982598 },
-    { 21281, 30438, 16.268898 },
-    { 21281, 31681, 76.109324 },
-    { 21281, 31685, 23.182831 },
-    { 21281, 32349, 45.813271 },
-    { 21281, 32362, 73.357819 },
-    { 21281, 32607, 18.581739 },
-    { 21281, 32768, 20.786108 },
-    { 21281, 33579, 36.707604 },
-    { 21281, 33977, 41.556021 },
-    { 21281, 34444, 40.054848 },
-    { 21281, 35264, 32.821852 },
-    { 21281, 35904, 39.704374 },
-    { 21281, 36188, 72.871322 },
-    { 21281, 36377, 30.343529 },
-    { 21281, 37279, 71.379179 },
-    { 21281, 38170, 46.622107 },
-    { 21281, 39429, 37.377141 },
-    { 21281, 39757, 49.552617 },
-    { 21281, 39953, 33.742086 },
-    { 21281, 41037, 30.226940 },
-    { 21281, 42913, 34.823821 },
-    { 21281, 43109, 80.496155 },
-    { 21281, 43813, 81.212251 },
-    { 21281, 44816, 44.278049 },
-    { 21281, 45238, 33.138227 },
-    { 21281, 45556, 36.779246 },
-    { 21281, 45941, 39.391529 },
-    { 21281, 46390, 73.427844 },
-    { 21281, 46701, 39.468965 },
-    { 21281, 48002, 37.597937 },
-    { 21281, 50099, 38.035801 },
-    { 21281, 50371, 42.319972 },
-    { 21281, 51576, 43.624365 },
-    { 21281, 52419, 43.161354 },
-    { 21281, 52727, 53.006348 },
-    { 21281, 52943, 78.983555 },
-    { 21281, 56561, 48.610864 },
-    { 21281, 59196, 60.706356 },
-    { 21281, 59747, 54.990432 },
-    { 21281, 60718, 52.510730 },
-    { 21281, 61084, 57.585397 },
-    { 21281, 61585, 48.594752 },
-    { 21281, 61932, 65.196861 },
-    { 21281, 62322, 49.914519 },
-    { 21281, 62434, 56.752926 },
-    { 21281, 65109, 79.355794 },
-    { 21281, 66657, 65.715502 },
-    { 21281, 68002, 72.371653 },
-    { 21281, 68702, 60.798917 },
-    { 21281, 68933, 83.296609 },
-    { 21281, 71352, 79.578471 },
-    { 21281, 71681, 61.927697 },
-    { 21281, 71683, 61.932758 },
-    { 21281, 71860, 74.885061 },
-    { 21281, 71908, 58.101963 },
-    { 21281, 73273, 79.745944 },
-    { 21281, 73334, 80.774099 },
-    { 21281, 74946, 55.508831 },
-    { 21281, 75141, 83.059910 },
-    { 21281, 75264, 79.126311 },
-    { 21281, 76297, 82.972494 },
-    { 21281, 77952, 61.285568 },
-    { 21281, 82273, 55.898309 },
-    { 21281, 83081, 68.851448 },
-    { 21281, 84143, 81.382181 },
-    { 21281, 85258, 68.929189 },
-    { 21281, 85267, 68.087490 },
-    { 21281, 85792, 74.384187 },
-    { 21281, 86228, 81.036419 },
-    { 21281, 87073, 83.538509 },
-    { 21281, 100751, 58.777295 },
-    { 21281, 101772, 65.592500 },
-    { 21281, 107556, 83.357648 },
-    { 21281, 108085, 65.278884 },
-    { 21281, 109268, 56.277621 },
-    { 21281, 110130, 46.175851 },
-    { 21281, 112122, 52.185838 },
-    { 21281, 113136, 74.153556 },
-    { 21281, 113368, 62.843941 },
-    { 21421, 22449, 10.136357 },
-    { 21421, 23015, 17.321233 },
-    { 21421, 23416, 27.865719 },
-    { 21421, 23685, 39.547184 },
-    { 21421, 23767, 25.589490 },
-    { 21421, 23875, 22.993628 },
-    { 21421, 24305, 33.964064 },
-    { 21421, 24436, 26.493511 },
-    { 21421, 24608, 30.690372 },
-    { 21421, 25281, 22.387904 },
-    { 21421, 25336, 15.754055 },
-    { 21421, 25428, 16.755939 },
-    { 21421, 25606, 39.417818 },
-    { 21421, 25930, 21.765723 },
-    { 21421, 25985, 37.071503 },
-    { 21421, 26207, 15.830932 },
-    { 21421, 26241, 26.818281 },
-    { 21421, 26311, 23.129580 },
-    { 21421, 26451, 15.313256 },
-    { 21421, 26634, 52.811259 },
-    { 21421, 26727, 24.426199 },
-    { 21421, 27366, 31.639380 },
-    { 21421, 27628, 55.215662 },
-    { 21421, 27989, 21.389120 },
-    { 21421, 28360, 33.417633 },
-    { 21421, 28380, 27.754891 },
-    { 21421, 29655, 24.043979 },
-    { 21421, 30122, 52.927623 },
-    { 21421, 30324, 43.343792 },
-    { 21421, 30343, 25.887046 },
-    { 21421, 30438, 73.043271 },
-    { 21421, 31681, 29.172824 },
-    { 21421, 31685, 65.922509 },
-    { 21421, 32246, 31.043060 },
-    { 21421, 32349, 46.022099 },
-    { 21421, 32362, 31.457949 },
-    { 21421, 32607, 82.695301 },
-    { 21421, 32768, 73.282513 },
-    { 21421, 33579, 57.063138 },
-    { 21421, 33977, 54.010305 },
-    { 21421, 34444, 56.677216 },
-    { 21421, 35264, 65.683657 },
-    { 21421, 35904, 61.195503 },
-    { 21421, 36188, 42.522434 },
-    { 21421, 36377, 71.780015 },
-    { 21421, 36850, 43.192076 },
-    { 21421, 37279, 46.293143 },
-    { 21421, 37826, 45.014245 },
-    { 21421, 38170, 62.694049 },
-    { 21421, 39429, 74.316299 },
-    { 21421, 39757, 65.792564 },
-    { 21421, 39953, 79.723532 },
-    { 21421, 41704, 60.509375 },
-    { 21421, 43109, 62.060338 },
-    { 21421, 43813, 64.250942 },
-    { 21421, 44127, 61.715236 },
-    { 21421, 45860, 65.519537 },
-    { 21421, 46390, 76.369771 },
-    { 21421, 46853, 67.390778 },
-    { 21421, 47908, 72.258443 },
-    { 21421, 49669, 80.131665 },
-    { 21421, 50583, 80.841062 },
-    { 21421, 50801, 76.652532 },
-    { 21421, 53910, 79.819852 },
-    { 21421, 54061, 78.731775 },
-    { 21421, 105199, 83.909406 },
-    { 21421, 106032, 79.882223 },
-    { 21421, 109492, 79.258404 },
-    { 21421, 112158, 80.291497 },
-    { 21421, 113881, 76.330427 },
-    { 21421, 113963, 79.009006 },
-    { 21421, 116727, 70.506687 },
-    { 22449, 23015, 26.257419 },
-    { 22449, 23416, 36.957794 },
-    { 22449, 23685, 29.580569 },
-    { 22449, 23767, 34.473910 },
-    { 22449, 23875, 12.858687 },
-    { 22449, 24305, 23.861152 },
-    { 22449, 24436, 16.365304 },
-    { 22449, 24608, 39.465889 },
-    { 22449, 25281, 12.739471 },
-    { 22449, 25336, 8.785558 },
-    { 22449, 25428, 23.295894 },
-    { 22449, 25606, 29.282052 },
-    { 22449, 25930, 12.780300 },
-    { 22449, 25985, 26.950973 },
-    { 22449, 26207, 11.588782 },
-    { 22449, 26241, 17.177111 },
-    { 22449, 26311, 14.159799 },
-    { 22449, 26451, 18.294793 },
-    { 22449, 26634, 42.696137 },
-    { 22449, 26727, 15.514865 },
-    { 22449, 27366, 22.015139 },
-    { 22449, 27628, 45.083257 },
-    { 22449, 27989, 16.210953 },
-    { 22449, 28360, 40.893726 },
-    { 22449, 28380, 34.172172 },
-    { 22449, 29655, 25.709472 },
-    { 22449, 30122, 42.920806 },
-    { 22449, 30324, 33.854526 },
-    { 22449, 30343, 27.286936 },
-    { 22449, 30438, 62.924796 },
-    { 22449, 31681, 28.004796 },
-    { 22449, 31685, 55.811449 },
-    { 22449, 32246, 32.748564 },
-    { 22449, 32349, 37.059473 },
-    { 22449, 32362, 29.021627 },
-    { 22449, 32607, 72.599128 },
-    { 22449, 32768, 63.149562 },
-    { 22449, 33579, 47.456220 },
-    { 22449, 33977, 44.769254 },
-    { 22449, 34444, 47.337268 },
-    { 22449, 35264, 55.900032 },
-    { 22449, 35904, 51.865589 },
-    { 22449, 36188, 38.988679 },
-    { 22449, 36377, 61.869649 },
-    { 22449, 36850, 45.712450 },
-    { 22449, 37279, 42.151437 },
-    { 22449, 37826, 46.479656 },
-    { 22449, 38170, 54.026771 },
-    { 22449, 39429, 64.751501 },
-    { 22449, 39757, 57.417483 },
-    { 22449, 39953, 69.881807 },
-    { 22449, 41037, 78.610582 },
-    { 22449, 41704, 67.453562 },
-    { 22449, 42913, 78.529537 },
-    { 22449, 43109, 58.794628 },
-    { 22449, 43813, 60.966834 },
-    { 22449, 44127, 66.536557 },
-    { 22449, 44816, 76.906224 },
-    { 22449, 45860, 67.797699 },
-    { 22449, 45941, 83.494912 },
-    { 22449, 46390, 70.948825 },
-    { 22449, 46853, 72.667415 },
-    { 22449, 47908, 72.591319 },
-    { 22449, 49669, 78.472009 },
-    { 22449, 50583, 80.649726 },
-    { 22449, 50801, 80.251835 },
-    { 22449, 113881, 83.668809 },
-    { 22449, 116727, 80.563028 },
-    { 23015, 23416, 10.701178 },
-    { 23015, 23685, 55.573693 },
-    { 23015, 23767, 8.287269 },
-    { 23015, 23875, 38.338880 },
-    { 23015, 24305, 49.518077 },
-    { 23015, 24436, 41.577698 },
-    { 23015, 24608, 13.375168 },
-    { 23015, 25281, 36.150784 },
-    { 23015, 25336, 27.601126 },
-    { 23015, 25428, 7.760866 },
-    { 23015, 25606, 54.438783 },
-    { 23015, 25930, 34.465098 },
-    { 23015, 25985, 51.697832 },
-    { 23015, 26207, 24.834949 },
-    { 23015, 26241, 40.126270 },
-    { 23015, 26311, 35.589856 },
-    { 23015, 26451, 15.025042 },
-    { 23015, 26634, 67.982224 },
-    { 23015, 26727, 36.596433 },
-    { 23015, 27366, 44.508493 },
-    { 23015, 27628, 70.081846 },
-    { 23015, 27989, 29.069976 },
-    { 23015, 28360, 16.860245 },
-    { 23015, 28380, 13.420548 },
-    { 23015, 29655, 20.195997 },
-    { 23015, 30122, 66.229995 },
-    { 23015, 30324, 55.066355 },
-    { 23015, 30343, 21.720325 },
-    { 23015, 31681, 28.214675 },
-    { 23015, 31685, 79.761677 },
-    { 23015, 32246, 24.609275 },
-    { 23015, 32349, 56.167829 },
-    { 23015, 32362, 31.934474 },
-    { 23015, 33579, 68.493760 },
-    { 23015, 33977, 64.420754 },
-    { 23015, 34444, 67.247804 },
-    { 23015, 35264, 77.484901 },
-    { 23015, 35904, 71.521362 },
-    { 23015, 36188, 42.634120 },
-    { 23015, 36850, 33.048553 },
-    { 23015, 37279, 46.923257 },
-    { 23015, 37826, 36.344143 },
-    { 23015, 38170, 71.045785 },
-    { 23015, 39757, 73.208706 },
-    { 23015, 41704, 43.801441 },
-    { 23015, 43109, 59.418101 },
-    { 23015, 43813, 61.446479 },
-    { 23015, 44127, 47.004303 },
-    { 23015, 45860, 53.857505 },
-    { 23015, 46390, 76.564760 },
-    { 23015, 46853, 52.013970 },
-    { 23015, 47908, 62.964907 },
-    { 23015, 49669, 73.389908 },
-    { 23015, 50583, 71.799780 },
-    { 23015, 50801, 62.809007 },
-    { 23015, 53910, 63.527232 },
-    { 23015, 54061, 61.948313 },
-    { 23015, 54539, 69.485610 },
-    { 23015, 54872, 82.338609 },
-    { 23015, 58001, 71.384691 },
-    { 23015, 59774, 72.174405 },
-    { 23015, 62956, 77.037819 },
-    { 23015, 65378, 80.791281 },
-    { 23015, 72607, 70.636298 },
-    { 23015, 75097, 73.649866 },
-    { 23015, 83895, 81.092799 },
-    { 23015, 94376, 76.001078 },
-    { 23015, 105199, 71.024477 },
-    { 23015, 106032, 65.723229 },
-    { 23015, 109492, 67.867267 },
-    { 23015, 112158, 76.630404 },
-    { 23015, 113881, 73.777464 },
-    { 23015, 113963, 80.162510 },
-    { 23015, 116727, 55.436437 },
-    { 23416, 23685, 66.199020 },
-    { 23416, 23767, 2.720684 },
-    { 23416, 23875, 48.927564 },
-    { 23416, 24305, 60.081138 },
-    { 23416, 24436, 52.102948 },
-    { 23416, 24608, 3.394249 },
-    { 23416, 25281, 46.495470 },
-    { 23416, 25336, 37.816815 },
-    { 23416, 25428, 15.974948 },
-    { 23416, 25606, 64.863199 },
-    { 23416, 25930, 44.629348 },
-    { 23416, 25985, 62.047062 },
-    { 23416, 26207, 34.645204 },
-    { 23416, 26241, 50.304235 },
-    { 23416, 26311, 45.672554 },
-    { 23416, 26451, 23.860727 },
-    { 23416, 26634, 78.369182 },
-    { 23416, 26727, 46.584155 },
-    { 23416, 27366, 54.494916 },
-    { 23416, 27628, 80.367814 },
-    { 23416, 27989, 38.229913 },
-    { 23416, 28360, 10.331373 },
-    { 23416, 28380, 12.785522 },
-    { 23416, 29655, 26.085059 },
-    { 23416, 30122, 76.030323 },
-    { 23416, 30324, 64.486291 },
-    { 23416, 30343, 27.070742 },
-    { 23416, 31681, 34.095804 },
-    { 23416, 32246, 27.911746 },
-    { 23416, 32349, 64.975284 },
-    { 23416, 32362, 38.042481 },
-    { 23416, 33579, 77.539493 },
-    { 23416, 33977, 73.129261 },
-    { 23416, 34444, 75.959473 },
-    { 23416, 35904, 80.031402 },
-    { 23416, 36188, 47.526538 },
-    { 23416, 36850, 32.061273 },
-    { 23416, 37279, 51.771652 },
-    { 23416, 37826, 36.177738 },
-    { 23416, 38170, 78.657748 },
-    { 23416, 39757, 80.299270 },
-    { 23416, 41704, 34.829803 },
-    { 23416, 43109, 61.560577 },
-    { 23416, 43813, 63.371746 },
-    { 23416, 44127, 40.437797 },
-    { 23416, 45860, 49.843273 },
-    { 23416, 46390, 79.557241 },
-    { 23416, 46853, 44.535326 },
-    { 23416, 47908, 60.368345 },
-    { 23416, 49669, 72.113710 },
-    { 23416, 50583, 68.979455 },
-    { 23416, 50801, 56.508639 },
-    { 23416, 53910, 54.770557 },
-    { 23416, 54061, 52.602392 },
-    { 23416, 54539, 62.092412 },
-    { 23416, 54872, 78.053408 },
-    { 23416, 54879, 81.546559 },
-    { 23416, 58001, 62.472352 },
-    { 23416, 59774, 62.790074 },
-    { 23416, 62956, 67.412690 },
-    { 23416, 63125, 80.845470 },
-    { 23416, 65378, 70.973507 },
-    { 23416, 67301, 77.639675 },
-    { 23416, 72607, 59.961654 },
-    { 23416, 75097, 62.962135 },
-    { 23416, 75458, 75.273000 },
-    { 23416, 80331, 74.382384 },
-    { 23416, 83895, 70.454066 },
-    { 23416, 85670, 83.679463 },
-    { 23416, 87833, 83.956147 },
-    { 23416, 94376, 65.821996 },
-    { 23416, 97165, 83.964122 },
-    { 23416, 102098, 78.471169 },
-    { 23416, 105199, 61.975707 },
-    { 23416, 106032, 56.090481 },
-    { 23416, 109492, 59.707392 },
-    { 23416, 112158, 72.722625 },
-    { 23416, 113881, 70.672494 },
-    { 23416, 113963, 79.041871 },
-    { 23416, 116727, 45.455724 },
-    { 23685, 23767, 63.605968 },
-    { 23685, 23875, 17.294247 },
-    { 23685, 24305, 6.412151 },
-    { 23685, 24436, 14.336258 },
-    { 23685, 24608, 68.417380 },
-    { 23685, 25281, 20.500227 },
-    { 23685, 25336, 29.121403 },
-    { 23685, 25428, 51.225439 },
-    { 23685, 25606, 5.536617 },
-    { 23685, 25930, 22.998109 },
-    { 23685, 25985, 7.851276 },
-    { 23685, 26207, 33.113610 },
-    { 23685, 26241, 17.981099 },
-    { 23685, 26311, 22.450635 },
-    { 23685, 26451, 44.215459 },
-    { 23685, 26634, 13.902800 },
-    { 23685, 26727, 22.154561 },
-    { 23685, 27366, 16.249999 },
-    { 23685, 27628, 16.655553 },
-    { 23685, 27989, 32.170229 },
-    { 23685, 28360, 68.439583 },
-    { 23685, 28380, 60.939257 },
-    { 23685, 29655, 47.954135 },
-    { 23685, 30122, 18.433256 },
-    { 23685, 30324, 18.640080 },
-    { 23685, 30343, 48.688652 },
-    { 23685, 30438, 33.836591 },
-    { 23685, 31681, 44.865763 },
-    { 23685, 31685, 28.269118 },
-    { 23685, 32246, 53.168184 },
-    { 23685, 32349, 24.126126 },
-    { 23685, 32362, 42.920567 },
-    { 23685, 32607, 43.292482 },
-    { 23685, 32768, 34.812530 },
-    { 23685, 33579, 26.268029 },
-    { 23685, 33977, 27.025793 },
-    { 23685, 34444, 28.211997 },
-    { 23685, 35264, 31.928032 },
-    { 23685, 35904, 31.832225 },
-    { 23685, 36188, 46.304586 },
-    { 23685, 36377, 36.304729 },
-    { 23685, 36850, 64.934611 },
-    { 23685, 37279, 46.654045 },
-    { 23685, 37826, 63.461379 },
-    { 23685, 38170, 37.472549 },
-    { 23685, 39429, 41.441623 },
-    { 23685, 39757, 41.656613 },
-    { 23685, 39953, 44.351428 },
-    { 23685, 41037, 50.641884 },
-    { 23685, 42913, 51.790698 },
-    { 23685, 43109, 61.301470 },
-    { 23685, 43813, 62.935728 },
-    { 23685, 44816, 53.773836 },
-    { 23685, 45238, 59.481797 },
-    { 23685, 45556, 57.156277 },
-    { 23685, 45860, 83.065511 },
-    { 23685, 45941, 57.118369 },
-    { 23685, 46390, 64.154152 },
-    { 23685, 46701, 58.637814 },
-    { 23685, 47908, 82.261573 },
-    { 23685, 48002, 61.587161 },
-    { 23685, 49669, 81.715203 },
-    { 23685, 50099, 64.635257 },
-    { 23685, 50371, 64.729387 },
-    { 23685, 51576, 66.495084 },
-    { 23685, 52419, 67.517548 },
-    { 23685, 52727, 70.240442 },
-    { 23685, 52943, 80.359618 },
-    { 23685, 56561, 73.510885 },
-    { 23685, 59196, 82.185972 },
-    { 23685, 59747, 79.528737 },
-    { 23685, 60718, 78.792422 },
-    { 23685, 61084, 82.173274 },
-    { 23685, 61585, 76.860722 },
-    { 23685, 62322, 78.093206 },
-    { 23685, 62434, 82.694179 },
-    { 23685, 109268, 82.980571 },
-    { 23685, 110130, 76.282664 },
-    { 23685, 112122, 77.580402 },
-    { 23685, 113368, 80.751418 },
-    { 23767, 23875, 46.321912 },
-    { 23767, 24305, 57.459308 },
-    { 23767, 24436, 49.470669 },
-    { 23767, 24608, 5.107105 },
-    { 23767, 25281, 43.822968 },
-    { 23767, 25336, 35.131039 },
-    { 23767, 25428, 13.255290 },
-    { 23767, 25606, 62.198665 },
-    { 23767, 25930, 41.933731 },
-    { 23767, 25985, 59.368977 },
-    { 23767, 26207, 31.931090 },
-    { 23767, 26241, 47.607614 },
-    { 23767, 26311, 42.969136 },
-    { 23767, 26451, 21.143260 },
-    { 23767, 26634, 75.693292 },
-    { 23767, 26727, 43.873940 },
-    { 23767, 27366, 51.782565 },
-    { 23767, 27628, 77.675592 },
-    { 23767, 27989, 35.514094 },
-    { 23767, 28360, 10.351325 },
-    { 23767, 28380, 11.046977 },
-    { 23767, 29655, 23.598318 },
-    { 23767, 30122, 73.309992 },
-    { 23767, 30324, 61.769458 },
-    { 23767, 30343, 24.659310 },
-    { 23767, 31681, 31.662684 },
-    { 23767, 32246, 25.818701 },
-    { 23767, 32349, 62.289428 },
-    { 23767, 32362, 35.597915 },
-    { 23767, 33579, 74.842822 },
-    { 23767, 33977, 70.454709 },
-    { 23767, 34444, 73.286049 },
-    { 23767, 35264, 83.833592 },
-    { 23767, 35904, 77.377410 },
-    { 23767, 36188, 45.297732 },
-    { 23767, 36850, 30.906467 },
-    { 23767, 37279, 49.564953 },
-    { 23767, 37826, 34.870017 },
-    { 23767, 38170, 76.099501 },
-    { 23767, 39757, 77.810288 },
-    { 23767, 41704, 36.224902 },
-    { 23767, 43109, 59.892595 },
-    { 23767, 43813, 61.755308 },
-    { 23767, 44127, 40.948598 },
-    { 23767, 45860, 49.616779 },
-    { 23767, 46390, 77.771984 },
-    { 23767, 46853, 45.380188 },
-    { 23767, 47908, 59.803206 },
-    { 23767, 49669, 71.257962 },
-    { 23767, 50583, 68.505880 },
-    { 23767, 50801, 56.997753 },
-    { 23767, 53910, 56.124195 },
-    { 23767, 54061, 54.199587 },
-    { 23767, 54539, 62.959728 },
-    { 23767, 54872, 78.008363 },
-    { 23767, 54879, 81.318807 },
-    { 23767, 58001, 63.901509 },
-    { 23767, 59774, 64.417344 },
-    { 23767, 62956, 69.152410 },
-    { 23767, 63125, 82.105200 },
-    { 23767, 65378, 72.806565 },
-    { 23767, 67301, 79.455005 },
-    { 23767, 72607, 62.368357 },
-    { 23767, 75097, 65.394460 },
-    { 23767, 75458, 77.610172 },
-    { 23767, 80331, 76.889399 },
-    { 23767, 83895, 73.049812 },
-    { 23767, 94376, 68.531176 },
-    { 23767, 102098, 81.064864 },
-    { 23767, 105199, 64.658557 },
-    { 23767, 106032, 58.806807 },
-    { 23767, 109492, 62.295314 },
-    { 23767, 112158, 74.619597 },
-    { 23767, 113881, 72.401311 },
-    { 23767, 113963, 80.367640 },
-    { 23767, 116727, 48.175960 },
-    { 23875, 24305, 11.188775 },
-    { 23875, 24436, 3.530217 },
-    { 23875, 24608, 51.123160 },
-    { 23875, 25281, 4.942861 },
-    { 23875, 25336, 12.222167 },
-    { 23875, 25428, 33.985242 },
-    { 23875, 25606, 16.436520 },
-    { 23875, 25930, 7.699670 },
-    { 23875, 25985, 14.113631 },
-    { 23875, 26207, 16.486346 },
-    { 23875, 26241, 6.913031 },
-    { 23875, 26311, 8.074402 },
-    { 23875, 26451, 27.227535 },
-    { 23875, 26634, 29.911768 },
-    { 23875, 26727, 8.791765 },
-    { 23875, 27366, 10.901231 },
-    { 23875, 27628, 32.247766 },
-    { 23875, 27989, 17.187887 },
-    { 23875, 28360, 51.355224 },
-    { 23875, 28380, 43.994013 },
-    { 23875, 29655, 32.093227 },
-    { 23875, 30122, 30.260315 },
-    { 23875, 30324, 22.362804 },
-    { 23875, 30343, 33.151312 },
-    { 23875, 30438, 50.118226 },
-    { 23875, 31681, 30.907861 },
-    { 23875, 31685, 42.973870 },
-    { 23875, 32246, 38.184068 },
-    { 23875, 32349, 26.519392 },
-    { 23875, 32362, 30.150278 },
-    { 23875, 32607, 59.830652 },
-    { 23875, 32768, 50.291040 },
-    { 23875, 33579, 35.459211 },
-    { 23875, 33977, 33.457323 },
-    { 23875, 34444, 35.800856 },
-    { 23875, 35264, 43.544568 },
-    { 23875, 35904, 40.272261 },
-    { 23875, 36188, 37.217828 },
-    { 23875, 36377, 49.301493 },
-    { 23875, 36850, 50.849060 },
-    { 23875, 37279, 39.194356 },
-    { 23875, 37826, 50.350854 },
-    { 23875, 38170, 43.454339 },
-    { 23875, 39429, 52.666301 },
-    { 23875, 39757, 47.215424 },
-    { 23875, 39953, 57.385163 },
-    { 23875, 41037, 65.783607 },
-    { 23875, 41704, 76.592778 },
-    { 23875, 42913, 65.865786 },
-    { 23875, 43109, 55.832423 },
-    { 23875, 43813, 57.856301 },
-    { 23875, 44127, 73.229518 },
-    { 23875, 44816, 65.025534 },
-    { 23875, 45238, 75.595299 },
-    { 23875, 45556, 71.778474 },
-    { 23875, 45860, 71.384739 },
-    { 23875, 45941, 70.919436 },
-    { 23875, 46390, 64.498971 },
-    { 23875, 46701, 72.771330 },
-    { 23875, 46853, 79.680252 },
-    { 23875, 47908, 73.531824 },
-    { 23875, 48002, 76.981242 },
-    { 23875, 49669, 76.605029 },
-    { 23875, 50099, 80.626168 },
-    { 23875, 50371, 79.468724 },
-    { 23875, 50583, 80.547404 },
-    { 23875, 51576, 81.280309 },
-    { 23875, 52419, 82.726040 },
-    { 23875, 52727, 82.712257 },
-    { 24305, 24436, 8.013394 },
-    { 24305, 24608, 62.210263 },
-    { 24305, 25281, 14.097525 },
-    { 24305, 25336, 22.756249 },
-    { 24305, 25428, 44.929603 },
-    { 24305, 25606, 5.823412 },
-    { 24305, 25930, 16.587116 },
-    { 24305, 25985, 5.001359 },
-    { 24305, 26207, 26.710810 },
-    { 24305, 26241, 11.678488 },
-    { 24305, 26311, 16.062543 },
-    { 24305, 26451, 37.836615 },
-    { 24305, 26634, 18.850695 },
-    { 24305, 26727, 15.822740 },
-    { 24305, 27366, 10.706068 },
-    { 24305, 27628, 21.319475 },
-    { 24305, 27989, 25.822527 },
-    { 24305, 28360, 62.064675 },
-    { 24305, 28380, 54.543290 },
-    { 24305, 29655, 41.575062 },
-    { 24305, 30122, 20.734578 },
-    { 24305, 30324, 16.758048 },
-    { 24305, 30343, 42.342662 },
-    { 24305, 30438, 39.082606 },
-    { 24305, 31681, 38.731014 },
-    { 24305, 31685, 32.470082 },
-    { 24305, 32246, 46.905372 },
-    { 24305, 32349, 22.104528 },
-    { 24305, 32362, 36.986813 },
-    { 24305, 32607, 48.738304 },
-    { 24305, 32768, 39.533307 },
-    { 24305, 33579, 27.437766 },
-    { 24305, 33977, 26.907492 },
-    { 24305, 34444, 28.673918 },
-    { 24305, 35264, 34.463052 },
-    { 24305, 35904, 32.801962 },
-    { 24305, 36188, 41.266720 },
-    { 24305, 36377, 39.623270 },
-    { 24305, 36850, 58.866496 },
-    { 24305, 37279, 42.068793 },
-    { 24305, 37826, 57.592500 },
-    { 24305, 38170, 37.479187 },
-    { 24305, 39429, 43.920332 },
-    { 24305, 39757, 41.576618 },
-    { 24305, 39953, 47.766420 },
-    { 24305, 41037, 55.227971 },
-    { 24305, 42913, 55.798208 },
-    { 24305, 43109, 57.525637 },
-    { 24305, 43813, 59.304566 },
-    { 24305, 44127, 81.595802 },
-    { 24305, 44816, 56.395555 },
-    { 24305, 45238, 64.667386 },
-    { 24305, 45556, 61.480095 },
-    { 24305, 45860, 77.644235 },
-    { 24305, 45941, 61.011236 },
-    { 24305, 46390, 62.408386 },
-    { 24305, 46701, 62.709761 },
-    { 24305, 47908, 77.677510 },
-    { 24305, 48002, 66.350782 },
-    { 24305, 49669, 78.272439 },
-    { 24305, 50099, 69.754168 },
-    { 24305, 50371, 69.144024 },
-    { 24305, 50583, 83.560530 },
-    { 24305, 51576, 70.940113 },
-    { 24305, 52419, 72.193956 },
-    { 24305, 52727, 73.553702 },
-    { 24305, 52943, 80.127609 },
-    { 24305, 56561, 78.150467 },
-    { 24305, 59747, 83.972478 },
-    { 24305, 60718, 83.591296 },
-    { 24305, 61585, 82.075745 },
-    { 24305, 62322, 83.274073 },
-    { 24305, 110130, 82.515858 },
-    { 24305, 112122, 83.263495 },
-    { 24436, 24608, 54.202806 },
-    { 24436, 25281, 6.309381 },
-    { 24436, 25336, 14.789066 },
-    { 24436, 25428, 36.918627 },
-    { 24436, 25606, 12.986505 },
-    { 24436, 25930, 9.021490 },
-    { 24436, 25985, 10.589590 },
-    { 24436, 26207, 18.846806 },
-    { 24436, 26241, 5.667830 },
-    { 24436, 26311, 8.838911 },
-    { 24436, 26451, 29.887764 },
-    { 24436, 26634, 26.510604 },
-    { 24436, 26727, 9.042518 },
-    { 24436, 27366, 8.333756 },
-    { 24436, 27628, 28.795388 },
-    { 24436, 27989, 18.605904 },
-    { 24436, 28360, 54.106544 },
-    { 24436, 28380, 46.630145 },
-    { 24436, 29655, 34.078830 },
-    { 24436, 30122, 26.741275 },
-    { 24436, 30324, 19.229522 },
-    { 24436, 30343, 34.988390 },
-    { 24436, 30438, 46.684152 },
-    { 24436, 31681, 32.071779 },
-    { 24436, 31685, 39.452116 },
-    { 24436, 32246, 39.808688 },
-    { 24436, 32349, 23.673523 },
-    { 24436, 32362, 30.872748 },
-    { 24436, 32607, 56.419231 },
-    { 24436, 32768, 46.789792 },
-    { 24436, 33579, 32.088563 },
-    { 24436, 33977, 30.292707 },
-    { 24436, 34444, 32.558007 },
-    { 24436, 35264, 40.074993 },
-    { 24436, 35904, 36.997068 },
-    { 24436, 36188, 36.925016 },
-    { 24436, 36377, 45.790150 },
-    { 24436, 36850, 52.199308 },
-    { 24436, 37279, 38.513579 },
-    { 24436, 37826, 51.369272 },
-    { 24436, 38170, 40.451774 },
-    { 24436, 39429, 49.245837 },
-    { 24436, 39757, 44.297495 },
-    { 24436, 39953, 53.882352 },
-    { 24436, 41037, 62.259324 },
-    { 24436, 41704, 78.837070 },
-    { 24436, 42913, 62.340332 },
-    { 24436, 43109, 54.889478 },
-    { 24436, 43813, 56.848119 },
-    { 24436, 44127, 74.791261 },
-    { 24436, 44816, 61.635888 },
-    { 24436, 45238, 72.116039 },
-    { 24436, 45556, 68.248381 },
-    { 24436, 45860, 72.090890 },
-    { 24436, 45941, 67.402651 },
-    { 24436, 46390, 62.502829 },
-    { 24436, 46701, 69.247279 },
-    { 24436, 46853, 81.286805 },
-    { 24436, 47908, 73.482139 },
-    { 24436, 48002, 73.459810 },
-    { 24436, 49669, 75.754148 },
-    { 24436, 50099, 77.133424 },
-    { 24436, 50371, 75.938622 },
-    { 24436, 50583, 80.144499 },
-    { 24436, 51576, 77.750150 },
-    { 24436, 52419, 79.198697 },
-    { 24436, 52727, 79.270617 },
-    { 24436, 52943, 81.783761 },
-    { 24608, 25281, 48.426869 },
-    { 24608, 25336, 39.691338 },
-    { 24608, 25428, 17.493483 },
-    { 24608, 25606, 66.809741 },
-    { 24608, 25930, 46.420928 },
-    { 24608, 25985, 63.924668 },
-    { 24608, 26207, 36.279985 },
-    { 24608, 26241, 52.076894 },
-    { 24608, 26311, 47.397333 },
-    { 24608, 26451, 25.222860 },
-    { 24608, 26634, 80.240863 },
-    { 24608, 26727, 48.236151 },
-    { 24608, 27366, 56.103411 },
-    { 24608, 27628, 82.132298 },
-    { 24608, 27989, 39.473479 },
-    { 24608, 28360, 7.577844 },
-    { 24608, 28380, 11.890980 },
-    { 24608, 29655, 26.293163 },
-    { 24608, 30122, 77.417495 },
-    { 24608, 30324, 65.678588 },
-    { 24608, 30343, 27.061305 },
-    { 24608, 31681, 34.077054 },
-    { 24608, 32246, 27.204120 },
-    { 24608, 32349, 65.826169 },
-    { 24608, 32362, 38.027588 },
-    { 24608, 33579, 78.452822 },
-    { 24608, 33977, 73.883591 },
-    { 24608, 34444, 76.700587 },
-    { 24608, 35904, 80.647906 },
-    { 24608, 36188, 46.943530 },
-    { 24608, 36850, 29.977585 },
-    { 24608, 37279, 51.123907 },
-    { 24608, 37826, 34.238598 },
-    { 24608, 38170, 78.857374 },
-    { 24608, 39757, 80.264179 },
-    { 24608, 41704, 31.458417 },
-    { 24608, 43109, 59.970682 },
-    { 24608, 43813, 61.705642 },
-    { 24608, 44127, 37.145411 },
-    { 24608, 45860, 46.888545 },
-    { 24608, 46390, 78.087286 },
-    { 24608, 46853, 41.161178 },
-    { 24608, 47908, 57.628402 },
-    { 24608, 49669, 69.590237 },
-    { 24608, 50583, 66.157421 },
-    { 24608, 50801, 53.209999 },
-    { 24608, 53910, 51.396942 },
-    { 24608, 54061, 49.289648 },
-    { 24608, 54539, 58.711080 },
-    { 24608, 54872, 74.958170 },
-    { 24608, 54879, 78.548788 },
-    { 24608, 58001, 59.114504 },
-    { 24608, 59774, 59.490549 },
-    { 24608, 62956, 64.161738 },
-    { 24608, 63125, 77.462101 },
-    { 24608, 65378, 67.771883 },
-    { 24608, 67301, 74.429228 },
-    { 24608, 72607, 57.348631 },
-    { 24608, 75097, 60.394058 },
-    { 24608, 75458, 72.543994 },
-    { 24608, 80331, 71.962248 },
-    { 24608, 83895, 68.275864 },
-    { 24608, 85670, 81.655389 },
-    { 24608, 87833, 82.133653 },
-    { 24608, 94376, 64.256537 },
-    { 24608, 97165, 83.178892 },
-    { 24608, 102098, 78.185222 },
-    { 24608, 105199, 61.255022 },
-    { 24608, 106032, 55.016698 },
-    { 24608, 109492, 59.492502 },
-    { 24608, 112158, 74.088207 },
-    { 24608, 113881, 72.296240 },
-    { 24608, 113963, 81.153260 },
-    { 24608, 116727, 44.166158 },
-    { 25281, 25336, 8.748397 },
-    { 25281, 25428, 31.008070 },
-    { 25281, 25606, 18.385051 },
-    { 25281, 25930, 2.818327 },
-    { 25281, 25985, 15.557446 },
-    { 25281, 26207, 12.613730 },
-    { 25281, 26241, 4.449716 },
-    { 25281, 26311, 3.166855 },
-    { 25281, 26451, 23.759361 },
-    { 25281, 26634, 31.874152 },
-    { 25281, 26727, 4.092839 },
-    { 25281, 27366, 9.291862 },
-    { 25281, 27628, 33.931110 },
-    { 25281, 27989, 12.439835 },
-    { 25281, 28360, 47.984389 },
-    { 25281, 28380, 40.446400 },
-    { 25281, 29655, 27.775013 },
-    { 25281, 30122, 30.668706 },
-    { 25281, 30324, 21.116547 },
-    { 25281, 30343, 28.708455 },
-    { 25281, 30438, 51.792435 },
-    { 25281, 31681, 26.084252 },
-    { 25281, 31685, 43.938307 },
-    { 25281, 32246, 33.595477 },
-    { 25281, 32349, 24.457803 },
-    { 25281, 32362, 25.221705 },
-    { 25281, 32607, 61.584733 },
-    { 25281, 32768, 51.483419 },
-    { 25281, 33579, 34.752062 },
-    { 25281, 33977, 32.045308 },
-    { 25281, 34444, 34.599398 },
-    { 25281, 35264, 43.300210 },
-    { 25281, 35904, 39.127302 },
-    { 25281, 36188, 32.395392 },
-    { 25281, 36377, 49.405027 },
-    { 25281, 36850, 46.121061 },
-    { 25281, 37279, 34.524801 },
-    { 25281, 37826, 45.498001 },
-    { 25281, 38170, 41.488471 },
-    { 25281, 39429, 52.042174 },
-    { 25281, 39757, 45.020225 },
-    { 25281, 39953, 57.335660 },
-    { 25281, 41037, 66.573851 },
-    { 25281, 41704, 72.528961 },
-    { 25281, 42913, 66.125252 },
-    { 25281, 43109, 51.254915 },
-    { 25281, 43813, 53.311627 },
-    { 25281, 44127, 68.622747 },
-    { 25281, 44816, 64.167793 },
-    { 25281, 45238, 76.882805 },
-    { 25281, 45556, 72.223713 },
-    { 25281, 45860, 66.470995 },
-    { 25281, 45941, 70.984273 },
-    { 25281, 46390, 60.757273 },
-    { 25281, 46701, 72.965482 },
-    { 25281, 46853, 75.102315 },
-    { 25281, 47908, 68.618409 },
-    { 25281, 48002, 77.788885 },
-    { 25281, 49669, 71.943489 },
-    { 25281, 50099, 81.782470 },
-    { 25281, 50371, 79.885170 },
-    { 25281, 50583, 75.708799 },
-    { 25281, 50801, 80.053753 },
-    { 25281, 51576, 81.701149 },
-    { 25281, 52419, 83.366572 },
-    { 25281, 52727, 82.055067 },
-    { 25281, 52943, 80.966229 },
-    { 25336, 25428, 22.259831 },
-    { 25336, 25606, 27.119753 },
-    { 25336, 25930, 6.866579 },
-    { 25336, 25985, 24.244694 },
-    { 25336, 26207, 4.356488 },
-    { 25336, 26241, 12.526223 },
-    { 25336, 26311, 8.042203 },
-    { 25336, 26451, 15.099742 },
-    { 25336, 26634, 40.569463 },
-    { 25336, 26727, 9.163898 },
-    { 25336, 27366, 16.981675 },
-    { 25336, 27628, 42.554213 },
-    { 25336, 27989, 7.530441 },
-    { 25336, 28360, 39.318347 },
-    { 25336, 28380, 31.853690 },
-    { 25336, 29655, 20.122894 },
-    { 25336, 30122, 38.744469 },
-    { 25336, 30324, 28.152910 },
-    { 25336, 30343, 21.346596 },
-    { 25336, 30438, 60.354729 },
-    { 25336, 31681, 20.406361 },
-    { 25336, 31685, 52.210518 },
-    { 25336, 32246, 26.608413 },
-    { 25336, 32349, 30.385995 },
-    { 25336, 32362, 20.800316 },
-    { 25336, 32607, 70.152737 },
-    { 25336, 32768, 59.835795 },
-    { 25336, 33579, 41.878280 },
-    { 25336, 33977, 38.487541 },
-    { 25336, 34444, 41.213426 },
-    { 25336, 35264, 50.713402 },
-    { 25336, 35904, 45.701231 },
-    { 25336, 36188, 30.311066 },
-    { 25336, 36377, 57.046258 },
-    { 25336, 36850, 39.539615 },
-    { 25336, 37279, 33.386700 },
-    { 25336, 37826, 39.627985 },
-    { 25336, 38170, 46.946789 },
-    { 25336, 39429, 58.976415 },
-    { 25336, 39757, 50.045635 },
-    { 25336, 39953, 64.772132 },
-    { 25336, 41037, 74.613654 },
-    { 25336, 41704, 64.379862 },
-    { 25336, 42913, 73.761781 },
-    { 25336, 43109, 50.077353 },
-    { 25336, 43813, 52.242133 },
-    { 25336, 44127, 61.490868 },
-    { 25336, 44816, 70.700408 },
-    { 25336, 45556, 79.974528 },
-    { 25336, 45860, 60.981451 },
-    { 25336, 45941, 78.415189 },
-    { 25336, 46390, 62.259307 },
-    { 25336, 46701, 80.498932 },
-    { 25336, 46853, 67.870357 },
-    { 25336, 47908, 64.762306 },
-    { 25336, 49669, 69.970432 },
-    { 25336, 50583, 72.555936 },
-    { 25336, 50801, 74.055112 },
-    { 25336, 52943, 83.313650 },
-    { 25336, 53910, 81.493348 },
-    { 25336, 54061, 81.877745 },
-    { 25336, 54539, 82.800705 },
-    { 25336, 116727, 83.036978 },
-    { 25428, 25606, 49.369358 },
-    { 25428, 25930, 28.939302 },
-    { 25428, 25985, 46.456241 },
-    { 25428, 26207, 18.788635 },
-    { 25428, 26241, 34.587939 },
-    { 25428, 26311, 29.904440 },
-    { 25428, 26451, 7.895894 },
-    { 25428, 26634, 62.761520 },
-    { 25428, 26727, 30.746867 },
-    { 25428, 27366, 38.626946 },
-    { 25428, 27628, 64.638816 },
-    { 25428, 27989, 22.268896 },
-    { 25428, 28360, 17.619389 },
-    { 25428, 28380, 11.092108 },
-    { 25428, 29655, 12.531101 },
-    { 25428, 30122, 60.070271 },
-    { 25428, 30324, 48.518537 },
-    { 25428, 30343, 14.144337 },
-    { 25428, 30438, 82.273262 },
-    { 25428, 31681, 20.475733 },
-    { 25428, 31685, 73.656017 },
-    { 25428, 32246, 17.638832 },
-    { 25428, 32349, 49.168008 },
-    { 25428, 32362, 24.175226 },
-    { 25428, 32768, 81.355191 },
-    { 25428, 33579, 61.664906 },
-    { 25428, 33977, 57.377623 },
-    { 25428, 34444, 60.211098 },
-    { 25428, 35264, 70.664142 },
-    { 25428, 35904, 64.386015 },
-    { 25428, 36188, 34.939938 },
-    { 25428, 36377, 77.245470 },
-    { 25428, 36850, 27.802444 },
-    { 25428, 37279, 39.219893 },
-    { 25428, 37826, 30.495269 },
-    { 25428, 38170, 63.565354 },
-    { 25428, 39429, 77.734989 },
-    { 25428, 39757, 65.605004 },
-    { 25428, 41704, 44.279217 },
-    { 25428, 43109, 52.201346 },
-    { 25428, 43813, 54.276730 },
-    { 25428, 44127, 44.975019 },
-    { 25428, 45860, 49.690437 },
-    { 25428, 46390, 69.046237 },
-    { 25428, 46853, 50.640123 },
-    { 25428, 47908, 57.726460 },
-    { 25428, 49669, 67.314281 },
-    { 25428, 50583, 66.535956 },
-    { 25428, 50801, 60.105785 },
-    { 25428, 53910, 63.224805 },
-    { 25428, 54061, 62.443432 },
-    { 25428, 54539, 67.605231 },
-    { 25428, 54872, 77.785984 },
-    { 25428, 54879, 80.103446 },
-    { 25428, 58001, 71.121893 },
-    { 25428, 59774, 72.537538 },
-    { 25428, 62956, 77.690240 },
-    { 25428, 65378, 81.712185 },
-    { 25428, 72607, 74.093456 },
-    { 25428, 75097, 77.214678 },
-    { 25428, 94376, 81.695856 },
-    { 25428, 105199, 77.803458 },
-    { 25428, 106032, 72.058202 },
-    { 25428, 109492, 75.083623 },
-    { 25428, 113881, 81.407176 },
-    { 25428, 116727, 61.418500 },
-    { 25606, 25930, 20.480768 },
-    { 25606, 25985, 3.121725 },
-    { 25606, 26207, 30.740114 },
-    { 25606, 26241, 14.951244 },
-    { 25606, 26311, 19.653786 },
-    { 25606, 26451, 41.964702 },
-    { 25606, 26634, 13.551244 },
-    { 25606, 26727, 19.062494 },
-    { 25606, 27366, 12.043599 },
-    { 25606, 27628, 15.812762 },
-    { 25606, 27989, 28.932628 },
-    { 25606, 28360, 66.093069 },
-    { 25606, 28380, 58.444664 },
-    { 25606, 29655, 44.735952 },
-    { 25606, 30122, 14.972855 },
-    { 25606, 30324, 13.141378 },
-    { 25606, 30343, 45.283854 },
-    { 25606, 30438, 33.697647 },
-    { 25606, 31681, 40.880664 },
-    { 25606, 31685, 26.724029 },
-    { 25606, 32246, 49.436728 },
-    { 25606, 32349, 18.638738 },
-    { 25606, 32362, 38.614252 },
-    { 25606, 32607, 43.437636 },
-    { 25606, 32768, 33.902089 },
-    { 25606, 33579, 22.035338 },
-    { 25606, 33977, 22.111171 },
-    { 25606, 34444, 23.585188 },
-    { 25606, 35264, 28.717848 },
-    { 25606, 35904, 27.510902 },
-    { 25606, 36188, 41.197840 },
-    { 25606, 36377, 33.803023 },
-    { 25606, 36850, 60.720366 },
-    { 25606, 37279, 41.346079 },
-    { 25606, 37826, 58.963386 },
-    { 25606, 38170, 32.672681 },
-    { 25606, 39429, 38.205641 },
-    { 25606, 39757, 36.833632 },
-    { 25606, 39953, 41.945615 },
-    { 25606, 41037, 49.518657 },
-    { 25606, 42913, 49.990846 },
-    { 25606, 43109, 55.791202 },
-    { 25606, 43813, 57.411809 },
-    { 25606, 44127, 83.401763 },
-    { 25606, 44816, 50.671641 },
-    { 25606, 45238, 59.162951 },
-    { 25606, 45556, 55.708144 },
-    { 25606, 45860, 78.090755 },
-    { 25606, 45941, 55.193715 },
-    { 25606, 46390, 58.810709 },
-    { 25606, 46701, 56.904583 },
-    { 25606, 47908, 76.888951 },
-    { 25606, 48002, 60.675107 },
-    { 25606, 49669, 76.179122 },
-    { 25606, 50099, 64.207649 },
-    { 25606, 50371, 63.381209 },
-    { 25606, 50583, 82.075585 },
-    { 25606, 51576, 65.181416 },
-    { 25606, 52419, 66.486206 },
-    { 25606, 52727, 67.747935 },
-    { 25606, 52943, 75.554349 },
-    { 25606, 56561, 72.427204 },
-    { 25606, 59196, 80.137506 },
-    { 25606, 59747, 78.203827 },
-    { 25606, 60718, 77.905416 },
-    { 25606, 61084, 80.793783 },
-    { 25606, 61585, 76.554249 },
-    { 25606, 62322, 77.734061 },
-    { 25606, 62434, 81.628469 },
-    { 25606, 110130, 80.283988 },
-    { 25606, 112122, 82.387807 },
-    { 25930, 25985, 17.524102 },
-    { 25930, 26207, 10.262864 },
-    { 25930, 26241, 5.675575 },
-    { 25930, 26311, 1.385999 },
-    { 25930, 26451, 21.485876 },
-    { 25930, 26634, 33.822384 },
-    { 25930, 26727, 2.736114 },
-    { 25930, 27366, 10.156661 },
-    { 25930, 27628, 35.743064 },
-    { 25930, 27989, 9.630293 },
-    { 25930, 28360, 45.656345 },
-    { 25930, 28380, 38.055713 },
-    { 25930, 29655, 25.081352 },
-    { 25930, 30122, 31.905458 },
-    { 25930, 30324, 21.609689 },
-    { 25930, 30343, 25.967956 },
-    { 25930, 30438, 53.509330 },
-    { 25930, 31681, 23.266792 },
-    { 25930, 31685, 45.349432 },
-    { 25930, 32246, 30.807841 },
-    { 25930, 32349, 24.373288 },
-    { 25930, 32362, 22.453779 },
-    { 25930, 32607, 63.306628 },
-    { 25930, 32768, 52.970056 },
-    { 25930, 33579, 35.350345 },
-    { 25930, 33977, 32.260451 },
-    { 25930, 34444, 34.913396 },
-    { 25930, 35264, 44.086987 },
-    { 25930, 35904, 39.434221 },
-    { 25930, 36188, 29.945302 },
-    { 25930, 36377, 50.343628 },
-    { 25930, 36850, 43.305811 },
-    { 25930, 37279, 32.259823 },
-    { 25930, 37826, 42.685565 },
-    { 25930, 38170, 41.276029 },
-    { 25930, 39429, 52.566647 },
-    { 25930, 39757, 44.637912 },
-    { 25930, 39953, 58.153577 },
-    { 25930, 41037, 67.801064 },
-    { 25930, 41704, 69.885072 },
-    { 25930, 42913, 67.074786 },
-    { 25930, 43109, 49.052529 },
-    { 25930, 43813, 51.137949 },
-    { 25930, 44127, 65.823312 },
-    { 25930, 44816, 64.503911 },
-    { 25930, 45238, 78.332161 },
-    { 25930, 45556, 73.251162 },
-    { 25930, 45860, 63.685626 },
-    { 25930, 45941, 71.811362 },
-    { 25930, 46390, 59.236482 },
-    { 25930, 46701, 73.855883 },
-    { 25930, 46853, 72.307616 },
-    { 25930, 47908, 65.997441 },
-    { 25930, 48002, 78.989504 },
-    { 25930, 49669, 69.633338 },
-    { 25930, 50099, 83.151573 },
-    { 25930, 50371, 80.872632 },
-    { 25930, 50583, 73.199427 },
-    { 25930, 50801, 77.247078 },
-    { 25930, 51576, 82.685301 },
-    { 25930, 52727, 82.441810 },
-    { 25930, 52943, 79.744665 },
-    { 25985, 26207, 27.762821 },
-    { 25985, 26241, 11.930657 },
-    { 25985, 26311, 16.642382 },
-    { 25985, 26451, 38.983481 },
-    { 25985, 26634, 16.325157 },
-    { 25985, 26727, 16.001495 },
-    { 25985, 27366, 8.930539 },
-    { 25985, 27628, 18.395673 },
-    { 25985, 27989, 25.830529 },
-    { 25985, 28360, 63.065829 },
-    { 25985, 28380, 55.401407 },
-    { 25985, 29655, 41.624982 },
-    { 25985, 30122, 16.348060 },
-    { 25985, 30324, 11.886934 },
-    { 25985, 30343, 42.164346 },
-    { 25985, 30438, 36.286538 },
-    { 25985, 31681, 37.776852 },
-    { 25985, 31685, 28.862616 },
-    { 25985, 32246, 46.318725 },
-    { 25985, 32349, 17.318722 },
-    { 25985, 32362, 35.554226 },
-    { 25985, 32607, 46.065803 },
-    { 25985, 32768, 36.226456 },
-    { 25985, 33579, 22.585004 },
-    { 25985, 33977, 21.907819 },
-    { 25985, 34444, 23.706411 },
-    { 25985, 35264, 29.946183 },
-    { 25985, 35904, 27.884458 },
-    { 25985, 36188, 38.468658 },
-    { 25985, 36377, 35.399187 },
-    { 25985, 36850, 57.654195 },
-    { 25985, 37279, 38.811989 },
-    { 25985, 37826, 55.958400 },
-    { 25985, 38170, 32.477922 },
-    { 25985, 39429, 39.318014 },
-    { 25985, 39757, 36.576133 },
-    { 25985, 39953, 43.528671 },
-    { 25985, 41037, 51.670247 },
-    { 25985, 42913, 51.837425 },
-    { 25985, 43109, 53.665137 },
-    { 25985, 43813, 55.356293 },
-    { 25985, 44127, 80.353238 },
-    { 25985, 44816, 51.788542 },
-    { 25985, 45238, 61.587438 },
-    { 25985, 45556, 57.692798 },
-    { 25985, 45860, 75.283561 },
-    { 25985, 45941, 56.954900 },
-    { 25985, 46390, 57.667811 },
-    { 25985, 46701, 58.751876 },
-    { 25985, 47908, 74.434592 },
-    { 25985, 48002, 62.870271 },
-    { 25985, 49669, 74.238014 },
-    { 25985, 50099, 66.578363 },
-    { 25985, 50371, 65.381728 },
-    { 25985, 50583, 79.882823 },
-    { 25985, 51576, 67.191088 },
-    { 25985, 52419, 68.613342 },
-    { 25985, 52727, 69.156196 },
-    { 25985, 52943, 75.149164 },
-    { 25985, 56561, 74.513978 },
-    { 25985, 59196, 81.743587 },
-    { 25985, 59747, 80.167375 },
-    { 25985, 60718, 80.059073 },
-    { 25985, 61084, 82.724782 },
-    { 25985, 61585, 78.936896 },
-    { 25985, 62322, 80.094524 },
-    { 25985, 62434, 83.696359 },
-    { 25985, 110130, 83.370145 },
-    { 26207, 26241, 15.844233 },
-    { 26207, 26311, 11.139297 },
-    { 26207, 26451, 11.224617 },
-    { 26207, 26634, 44.021244 },
-    { 26207, 26727, 11.958881 },
-    { 26207, 27366, 19.853512 },
-    { 26207, 27628, 45.855645 },
-    { 26207, 27989, 5.558378 },
-    { 26207, 28360, 35.405258 },
-    { 26207, 28380, 27.836934 },
-    { 26207, 29655, 15.767026 },
-    { 26207, 30122, 41.447356 },
-    { 26207, 30324, 30.260740 },
-    { 26207, 30343, 17.009454 },
-    { 26207, 30438, 63.496824 },
-    { 26207, 31681, 16.536522 },
-    { 26207, 31685, 55.015185 },
-    { 26207, 32246, 22.308142 },
-    { 26207, 32349, 31.777353 },
-    { 26207, 32362, 17.439779 },
-    { 26207, 32607, 73.277734 },
-    { 26207, 32768, 62.697200 },
-    { 26207, 33579, 43.811073 },
-    { 26207, 33977, 40.016522 },
-    { 26207, 34444, 42.810410 },
-    { 26207, 35264, 52.767330 },
-    { 26207, 35904, 47.212913 },
-    { 26207, 36188, 27.690741 },
-    { 26207, 36377, 59.235427 },
-    { 26207, 36850, 35.272827 },
-    { 26207, 37279, 31.113575 },
-    { 26207, 37826, 35.510332 },
-    { 26207, 38170, 47.746602 },
-    { 26207, 39429, 60.606515 },
-    { 26207, 39757, 50.549250 },
-    { 26207, 39953, 66.744141 },
-    { 26207, 41037, 77.075723 },
-    { 26207, 41704, 60.112549 },
-    { 26207, 42913, 75.851057 },
-    { 26207, 43109, 47.515050 },
-    { 26207, 43813, 49.701283 },
-    { 26207, 44127, 57.141683 },
-    { 26207, 44816, 71.957173 },
-    { 26207, 45556, 82.135465 },
-    { 26207, 45860, 56.885933 },
-    { 26207, 45941, 80.304943 },
-    { 26207, 46390, 60.762428 },
-    { 26207, 46701, 82.464632 },
-    { 26207, 46853, 63.515929 },
-    { 26207, 47908, 61.099860 },
-    { 26207, 49669, 66.926160 },
-    { 26207, 50583, 69.082395 },
-    { 26207, 50801, 69.833130 },
-    { 26207, 52943, 82.038503 },
-    { 26207, 53910, 77.137126 },
-    { 26207, 54061, 77.545807 },
-    { 26207, 54539, 78.530547 },
-    { 26207, 54872, 81.661697 },
-    { 26207, 54879, 82.394208 },
-    { 26207, 116727, 80.073212 },
-    { 26241, 26311, 4.712007 },
-    { 26241, 26451, 27.057935 },
-    { 26241, 26634, 28.181067 },
-    { 26241, 26727, 4.183697 },
-    { 26241, 27366, 4.842430 },
-    { 26241, 27628, 30.071757 },
-    { 26241, 27989, 14.197792 },
-    { 26241, 28360, 51.143948 },
-    { 26241, 28380, 43.493883 },
-    { 26241, 29655, 30.010612 },
-    { 26241, 30122, 26.362962 },
-    { 26241, 30324, 16.679069 },
-    { 26241, 30343, 30.709884 },
-    { 26241, 30438, 47.834898 },
-    { 26241, 31681, 27.110064 },
-    { 26241, 31685, 39.738518 },
-    { 26241, 32246, 35.226932 },
-    { 26241, 32349, 20.193492 },
-    { 26241, 32362, 25.588269 },
-    { 26241, 32607, 57.632468 },
-    { 26241, 32768, 47.336811 },
-    { 26241, 33579, 30.302347 },
-    { 26241, 33977, 27.647131 },
-    { 26241, 34444, 30.176543 },
-    { 26241, 35264, 38.865376 },
-    { 26241, 35904, 34.702519 },
-    { 26241, 36188, 31.262132 },
-    { 26241, 36377, 45.002078 },
-    { 26241, 36850, 47.269522 },
-    { 26241, 37279, 32.864089 },
-    { 26241, 37826, 46.181359 },
-    { 26241, 38170, 37.232818 },
-    { 26241, 39429, 47.592763 },
-    { 26241, 39757, 40.846969 },
-    { 26241, 39953, 52.909260 },
-    { 26241, 41037, 62.280703 },
-    { 26241, 41704, 74.819138 },
-    { 26241, 42913, 61.730002 },
-    { 26241, 43109, 49.308253 },
-    { 26241, 43813, 51.288952 },
-    { 26241, 44127, 69.974346 },
-    { 26241, 44816, 59.730079 },
-    { 26241, 45238, 72.717034 },
-    { 26241, 45556, 67.853010 },
-    { 26241, 45860, 66.672227 },
-    { 26241, 45941, 66.562295 },
-    { 26241, 46390, 57.585940 },
-    { 26241, 46701, 68.557103 },
-    { 26241, 46853, 76.493407 },
-    { 26241, 47908, 67.831309 },
-    { 26241, 48002, 73.486500 },
-    { 26241, 49669, 70.156092 },
-    { 26241, 50099, 77.568074 },
-    { 26241, 50371, 75.503891 },
-    { 26241, 50583, 74.478935 },
-    { 26241, 50801, 80.479901 },
-    { 26241, 51576, 77.319300 },
-    { 26241, 52419, 79.022534 },
-    { 26241, 52727, 77.610008 },
-    { 26241, 52943, 77.386313 },
-    { 26311, 26451, 22.347250 },
-    { 26311, 26634, 32.881952 },
-    { 26311, 26727, 1.356012 },
-    { 26311, 27366, 8.940858 },
-    { 26311, 27628, 34.736511 },
-    { 26311, 27989, 9.821835 },
-    { 26311, 28360, 46.439333 },
-    { 26311, 28380, 38.798931 },
-    { 26311, 29655, 25.512913 },
-    { 26311, 30122, 30.703628 },
-    { 26311, 30324, 20.272798 },
-    { 26311, 30343, 26.310357 },
-    { 26311, 30438, 52.446478 },
-    { 26311, 31681, 23.239953 },
-    { 26311, 31685, 44.185280 },
-    { 26311, 32246, 31.018104 },
-    { 26311, 32349, 22.988810 },
-    { 26311, 32362, 22.188317 },
-    { 26311, 32607, 62.239948 },
-    { 26311, 32768, 51.824729 },
-    { 26311, 33579, 34.016055 },
-    { 26311, 33977, 30.887895 },
-    { 26311, 34444, 33.547637 },
-    { 26311, 35264, 42.777111 },
-    { 26311, 35904, 38.066523 },
-    { 26311, 36188, 29.231924 },
-    { 26311, 36377, 49.058604 },
-    { 26311, 36850, 43.360434 },
-    { 26311, 37279, 31.403333 },
-    { 26311, 37826, 42.582300 },
-    { 26311, 38170, 39.890521 },
-    { 26311, 39429, 51.216910 },
-    { 26311, 39757, 43.257685 },
-    { 26311, 39953, 56.843732 },
-    { 26311, 41037, 66.573875 },
-    { 26311, 41704, 70.346600 },
-    { 26311, 42913, 65.786029 },
-    { 26311, 43109, 48.159600 },
-    { 26311, 43813, 50.228016 },
-    { 26311, 44127, 65.963263 },
-    { 26311, 44816, 63.134202 },
-    { 26311, 45238, 77.163344 },
-    { 26311, 45556, 71.976190 },
-    { 26311, 45860, 63.450766 },
-    { 26311, 45941, 70.499403 },
-    { 26311, 46390, 58.047920 },
-    { 26311, 46701, 72.554334 },
-    { 26311, 46853, 72.463956 },
-    { 26311, 47908, 65.461999 },
-    { 26311, 48002, 77.751903 },
-    { 26311, 49669, 68.813874 },
-    { 26311, 50099, 81.957211 },
-    { 26311, 50371, 79.587512 },
-    { 26311, 50583, 72.542382 },
-    { 26311, 50801, 77.094892 },
-    { 26311, 51576, 81.399069 },
-    { 26311, 52419, 83.199149 },
-    { 26311, 52727, 81.074080 },
-    { 26311, 52943, 78.481435 },
-    { 26451, 26634, 55.218703 },
-    { 26451, 26727, 23.097741 },
-    { 26451, 27366, 30.912133 },
-    { 26451, 27628, 56.999150 },
-    { 26451, 27989, 14.373364 },
-    { 26451, 28360, 24.228198 },
-    { 26451, 28380, 16.768126 },
-    { 26451, 29655, 8.746639 },
-    { 26451, 30122, 52.224192 },
-    { 26451, 30324, 40.626275 },
-    { 26451, 30343, 10.602834 },
-    { 26451, 30438, 74.523091 },
-    { 26451, 31681, 14.979119 },
-    { 26451, 31685, 65.808030 },
-    { 26451, 32246, 15.739681 },
-    { 26451, 32349, 41.315708 },
-    { 26451, 32362, 18.131676 },
-    { 26451, 32768, 73.509913 },
-    { 26451, 33579, 53.783172 },
-    { 26451, 33977, 49.542553 },
-    { 26451, 34444, 52.375238 },
-    { 26451, 35264, 62.783845 },
-    { 26451, 35904, 56.589052 },
-    { 26451, 36188, 29.357614 },
-    { 26451, 36377, 69.359173 },
-    { 26451, 36850, 28.168208 },
-    { 26451, 37279, 33.504839 },
-    { 26451, 37826, 29.738313 },
-    { 26451, 38170, 56.026776 },
-    { 26451, 39429, 69.967029 },
-    { 26451, 39757, 58.255049 },
-    { 26451, 39953, 76.524069 },
-    { 26451, 41704, 49.655255 },
-    { 26451, 43109, 48.004774 },
-    { 26451, 43813, 50.163203 },
-    { 26451, 44127, 48.258558 },
-    { 26451, 44816, 80.589026 },
-    { 26451, 45860, 50.524388 },
-    { 26451, 46390, 63.812314 },
-    { 26451, 46853, 54.372694 },
-    { 26451, 47908, 56.945396 },
-    { 26451, 49669, 65.085169 },
-    { 26451, 50583, 65.536754 },
-    { 26451, 50801, 62.325605 },
-    { 26451, 53910, 67.622305 },
-    { 26451, 54061, 67.491668 },
-    { 26451, 54539, 70.499055 },
-    { 26451, 54872, 77.525203 },
-    { 26451, 54879, 79.186247 },
-    { 26451, 58001, 75.421501 },
-    { 26451, 59774, 77.330497 },
-    { 26451, 62956, 82.641119 },
-    { 26451, 72607, 80.969654 },
-    { 26451, 106032, 79.949905 },
-    { 26451, 109492, 82.827729 },
-    { 26451, 116727, 69.279747 },
-    { 26634, 26727, 32.132516 },
-    { 26634, 27366, 24.475195 },
-    { 26634, 27628, 2.871856 },
-    { 26634, 27989, 41.643731 },
-    { 26634, 28360, 79.150106 },
-    { 26634, 28380, 71.439687 },
-    { 26634, 29655, 57.198071 },
-    { 26634, 30122, 9.496289 },
-    { 26634, 30324, 18.767807 },
-    { 26634, 30343, 57.518039 },
-    { 26634, 30438, 20.232379 },
-    { 26634, 31681, 52.333040 },
-    { 26634, 31685, 14.523458 },
-    { 26634, 32246, 61.140798 },
-    { 26634, 32349, 22.741313 },
-    { 26634, 32362, 49.497008 },
-    { 26634, 32607, 29.918907 },
-    { 26634, 32768, 20.917532 },
-    { 26634, 33579, 17.553508 },
-    { 26634, 33977, 20.855406 },
-    { 26634, 34444, 20.594027 },
-    { 26634, 35264, 19.994455 },
-    { 26634, 35904, 22.658998 },
-    { 26634, 36188, 49.431692 },
-    { 26634, 36377, 23.153559 },
-    { 26634, 36850, 71.294412 },
-    { 26634, 37279, 48.400274 },
-    { 26634, 37826, 68.855516 },
-    { 26634, 38170, 29.539086 },
-    { 26634, 39429, 29.122941 },
-    { 26634, 39757, 33.519946 },
-    { 26634, 39953, 30.962587 },
-    { 26634, 41037, 36.741811 },
-    { 26634, 42913, 37.987958 },
-    { 26634, 43109, 59.932689 },
-    { 26634, 43813, 61.108303 },
-    { 26634, 44816, 40.993095 },
-    { 26634, 45238, 45.831831 },
-    { 26634, 45556, 43.263331 },
-    { 26634, 45941, 43.344863 },
-    { 26634, 46390, 57.959315 },
-    { 26634, 46701, 44.796535 },
-    { 26634, 47908, 82.227111 },
-    { 26634, 48002, 47.723894 },
-    { 26634, 49669, 78.575278 },
-    { 26634, 50099, 50.939444 },
-    { 26634, 50371, 50.827032 },
-    { 26634, 51576, 52.592288 },
-    { 26634, 52419, 53.637568 },
-    { 26634, 52727, 56.719030 },
-    { 26634, 52943, 70.821923 },
-    { 26634, 56561, 59.627021 },
-    { 26634, 59196, 68.396924 },
-    { 26634, 59316, 83.447722 },
-    { 26634, 59747, 65.626744 },
-    { 26634, 60718, 64.950638 },
-    { 26634, 61084, 68.270520 },
-    { 26634, 61585, 63.240999 },
-    { 26634, 61932, 73.886949 },
-    { 26634, 62322, 64.447993 },
-    { 26634, 62434, 68.818652 },
-    { 26634, 66657, 78.276682 },
-    { 26634, 68702, 75.754479 },
-    { 26634, 71681, 78.237507 },
-    { 26634, 71683, 78.242803 },
-    { 26634, 71908, 75.118224 },
-    { 26634, 74946, 73.991550 },
-    { 26634, 77952, 80.302551 },
-    { 26634, 82273, 76.468156 },
-    { 26634, 100751, 82.635799 },
-    { 26634, 109268, 79.051826 },
-    { 26634, 110130, 69.879234 },
-    { 26634, 112122, 74.355620 },
-    { 26634, 113368, 81.622344 },
-    { 26727, 27366, 7.920312 },
-    { 26727, 27628, 33.909279 },
-    { 26727, 27989, 10.016974 },
-    { 26727, 28360, 47.075826 },
-    { 26727, 28380, 39.401751 },
-    { 26727, 29655, 25.826925 },
-    { 26727, 30122, 29.645156 },
-    { 26727, 30324, 19.034619 },
-    { 26727, 30343, 26.534135 },
-    { 26727, 30438, 51.542213 },
-    { 26727, 31681, 23.111436 },
-    { 26727, 31685, 43.165467 },
-    { 26727, 32246, 31.100310 },
-    { 26727, 32349, 21.655825 },
-    { 26727, 32362, 21.830840 },
-    { 26727, 32607, 61.327237 },
-    { 26727, 32768, 50.824292 },
-    { 26727, 33579, 32.776344 },
-    { 26727, 33977, 29.584272 },
-    { 26727, 34444, 32.256631 },
-    { 26727, 35264, 41.570777 },
-    { 26727, 35904, 36.771428 },
-    { 26727, 36188, 28.426148 },
-    { 26727, 36377, 47.884769 },
-    { 26727, 36850, 43.270395 },
-    { 26727, 37279, 30.461500 },
-    { 26727, 37826, 42.339597 },
-    { 26727, 38170, 38.542079 },
-    { 26727, 39429, 49.950745 },
-    { 26727, 39757, 41.902716 },
-    { 26727, 39953, 55.634952 },
-    { 26727, 41037, 65.470257 },
-    { 26727, 41704, 70.637886 },
-    { 26727, 42913, 64.604323 },
-    { 26727, 43109, 47.172156 },
-    { 26727, 43813, 49.224479 },
-    { 26727, 44127, 65.936977 },
-    { 26727, 44816, 61.833773 },
-    { 26727, 45238, 76.127792 },
-    { 26727, 45556, 70.811526 },
-    { 26727, 45860, 63.063232 },
-    { 26727, 45941, 69.286029 },
-    { 26727, 46390, 56.807543 },
-    { 26727, 46701, 71.354781 },
-    { 26727, 46853, 72.449581 },
-    { 26727, 47908, 64.790535 },
-    { 26727, 48002, 76.633361 },
-    { 26727, 49669, 67.882962 },
-    { 26727, 50099, 80.890320 },
-    { 26727, 50371, 78.408718 },
-    { 26727, 50583, 71.755927 },
-    { 26727, 50801, 76.778082 },
-    { 26727, 51576, 80.218608 },
-    { 26727, 52419, 82.047503 },
-    { 26727, 52727, 79.776484 },
-    { 26727, 52943, 77.183835 },
-    { 27366, 27628, 26.109860 },
-    { 27366, 27989, 17.176180 },
-    { 27366, 28360, 54.681689 },
-    { 27366, 28380, 46.966257 },
-    { 27366, 29655, 32.855370 },
-    { 27366, 30122, 21.762928 },
-    { 27366, 30324, 11.852063 },
-    { 27366, 30343, 33.319026 },
-    { 27366, 30438, 43.646864 },
-    { 27366, 31681, 28.849668 },
-    { 27366, 31685, 35.254736 },
-    { 27366, 32246, 37.395195 },
-    { 27366, 32349, 15.635032 },
-    { 27366, 32362, 26.706581 },
-    { 27366, 32607, 53.424625 },
-    { 27366, 32768, 42.906932 },
-    { 27366, 33579, 25.460579 },
-    { 27366, 33977, 22.867457 },
-    { 27366, 34444, 25.363232 },
-    { 27366, 35264, 34.050684 },
-    { 27366, 35904, 29.885525 },
-    { 27366, 36188, 30.574684 },
-    { 27366, 36377, 40.232579 },
-    { 27366, 36850, 48.779345 },
-    { 27366, 37279, 31.528757 },
-    { 27366, 37826, 47.214040 },
-    { 27366, 38170, 32.625802 },
-    { 27366, 39429, 42.750366 },
-    { 27366, 39757, 36.336324 },
-    { 27366, 39953, 48.104670 },
-    { 27366, 41037, 57.645451 },
-    { 27366, 41704, 77.324524 },
-    { 27366, 42913, 56.965490 },
-    { 27366, 43109, 47.400814 },
-    { 27366, 43813, 49.275310 },
-    { 27366, 44127, 71.502459 },
-    { 27366, 44816, 54.896660 },
-    { 27366, 45238, 68.227371 },
-    { 27366, 45556, 63.117963 },
-    { 27366, 45860, 66.984454 },
-    { 27366, 45941, 61.761780 },
-    { 27366, 46390, 54.207011 },
-    { 27366, 46701, 63.774043 },
-    { 27366, 46853, 78.020269 },
-    { 27366, 47908, 67.055824 },
-    { 27366, 48002, 68.832854 },
-    { 27366, 49669, 68.261336 },
-    { 27366, 50099, 73.016411 },
-    { 27366, 50371, 70.753387 },
-    { 27366, 50583, 73.168964 },
-    { 27366, 50801, 80.933600 },
-    { 27366, 51576, 72.567620 },
-    { 27366, 52419, 74.316171 },
-    { 27366, 52727, 72.769875 },
-    { 27366, 52943, 73.476759 },
-    { 27366, 56561, 80.035262 },
-    { 27628, 27989, 43.187707 },
-    { 27628, 28360, 80.740034 },
-    { 27628, 28380, 73.010343 },
-    { 27628, 29655, 58.550448 },
-    { 27628, 30122, 8.391766 },
-    { 27628, 30324, 19.149225 },
-    { 27628, 30343, 58.773190 },
-    { 27628, 30438, 17.900258 },
-    { 27628, 31681, 53.330452 },
-    { 27628, 31685, 11.672429 },
-    { 27628, 32246, 62.173637 },
-    { 27628, 32349, 22.545836 },
-    { 27628, 32362, 50.332207 },
-    { 27628, 32607, 27.670830 },
-    { 27628, 32768, 18.255486 },
-    { 27628, 33579, 15.792008 },
-    { 27628, 33977, 19.611753 },
-    { 27628, 34444, 18.994317 },
-    { 27628, 35264, 17.348251 },
-    { 27628, 35904, 20.607562 },
-    { 27628, 36188, 49.538306 },
-    { 27628, 36377, 20.295978 },
-    { 27628, 36850, 71.887429 },
-    { 27628, 37279, 48.231803 },
-    { 27628, 37826, 69.253298 },
-    { 27628, 38170, 27.630953 },
-    { 27628, 39429, 26.353065 },
-    { 27628, 39757, 31.508029 },
-    { 27628, 39953, 28.090758 },
-    { 27628, 41037, 34.045037 },
-    { 27628, 42913, 35.165754 },
-    { 27628, 43109, 58.996311 },
-    { 27628, 43813, 60.069621 },
-    { 27628, 44816, 38.149690 },
-    { 27628, 45238, 43.368433 },
-    { 27628, 45556, 40.505082 },
-    { 27628, 45941, 40.514061 },
-    { 27628, 46390, 56.103260 },
-    { 27628, 46701, 41.992626 },
-    { 27628, 47908, 81.381293 },
-    { 27628, 48002, 45.088274 },
-    { 27628, 49669, 77.153449 },
-    { 27628, 50099, 48.438926 },
-    { 27628, 50371, 48.095867 },
-    { 27628, 51576, 49.869479 },
-    { 27628, 52419, 50.976277 },
-    { 27628, 52727, 53.853631 },
-    { 27628, 52943, 68.341816 },
-    { 27628, 56561, 56.957247 },
-    { 27628, 59196, 65.574387 },
-    { 27628, 59316, 80.662241 },
-    { 27628, 59747, 62.911316 },
-    { 27628, 60718, 62.327733 },
-    { 27628, 61084, 65.546661 },
-    { 27628, 61585, 60.771003 },
-    { 27628, 61932, 71.076955 },
-    { 27628, 62322, 61.962257 },
-    { 27628, 62434, 66.157267 },
-    { 27628, 66657, 75.602642 },
-    { 27628, 68002, 81.672085 },
-    { 27628, 68702, 73.239145 },
-    { 27628, 71681, 75.817830 },
-    { 27628, 71683, 75.823121 },
-    { 27628, 71908, 72.779061 },
-    { 27628, 74946, 71.814788 },
-    { 27628, 77952, 78.157365 },
-    { 27628, 82273, 74.570296 },
-    { 27628, 100751, 81.878290 },
-    { 27628, 109268, 79.208812 },
-    { 27628, 110130, 69.541869 },
-    { 27628, 112122, 74.699929 },
-    { 27628, 113368, 82.743243 },
-    { 27989, 28360, 37.552328 },
-    { 27989, 28380, 29.823656 },
-    { 27989, 29655, 15.827149 },
-    { 27989, 30122, 37.953650 },
-    { 27989, 30324, 26.257420 },
-    { 27989, 30343, 16.520906 },
-    { 27989, 30438, 60.415038 },
-    { 27989, 31681, 13.743724 },
-    { 27989, 31685, 51.519837 },
-    { 27989, 32246, 21.205304 },
-    { 27989, 32349, 27.102537 },
-    { 27989, 32362, 13.494472 },
-    { 27989, 32607, 70.108031 },
-    { 27989, 32768, 59.221347 },
-    { 27989, 33579, 39.459920 },
-    { 27989, 33977, 35.359844 },
-    { 27989, 34444, 38.183681 },
-    { 27989, 35264, 48.460178 },
-    { 27989, 35904, 42.490547 },
-    { 27989, 36188, 22.793493 },
-    { 27989, 36377, 55.017285 },
-    { 27989, 36850, 33.685842 },
-    { 27989, 37279, 25.963553 },
-    { 27989, 37826, 33.199681 },
-    { 27989, 38170, 42.582444 },
-    { 27989, 39429, 55.903186 },
-    { 27989, 39757, 45.243243 },
-    { 27989, 39953, 62.288737 },
-    { 27989, 41037, 73.045104 },
-    { 27989, 41704, 60.621397 },
-    { 27989, 42913, 71.460322 },
-    { 27989, 43109, 42.585253 },
-    { 27989, 43813, 44.756281 },
-    { 27989, 44127, 56.196974 },
-    { 27989, 44816, 66.964785 },
-    { 27989, 45556, 77.784677 },
-    { 27989, 45860, 54.370414 },
-    { 27989, 45941, 75.727360 },
-    { 27989, 46390, 55.308279 },
-    { 27989, 46701, 77.941676 },
-    { 27989, 46853, 62.685909 },
-    { 27989, 47908, 57.500049 },
-    { 27989, 48002, 83.990941 },
-    { 27989, 49669, 62.444585 },
-    { 27989, 50583, 65.153655 },
-    { 27989, 50801, 67.782024 },
-    { 27989, 52943, 76.543133 },
-    { 27989, 53910, 76.469279 },
-    { 27989, 54061, 77.406723 },
-    { 27989, 54539, 76.709851 },
-    { 27989, 54872, 77.835795 },
-    { 27989, 54879, 78.222363 },
-    { 27989, 58001, 83.838552 },
-    { 27989, 116727, 83.611254 },
-    { 28360, 28380, 7.734754 },
-    { 28360, 29655, 22.659607 },
-    { 28360, 30122, 75.160054 },
-    { 28360, 30324, 63.124398 },
-    { 28360, 30343, 22.940709 },
-    { 28360, 31681, 29.655503 },
-    { 28360, 32246, 21.752068 },
-    { 28360, 32349, 62.528577 },
-    { 28360, 32362, 33.502102 },
-    { 28360, 33579, 75.136546 },
-    { 28360, 33977, 70.290557 },
-    { 28360, 34444, 73.049967 },
-    { 28360, 35264, 83.895955 },
-    { 28360, 35904, 76.709413 },
-    { 28360, 36188, 41.266681 },
-    { 28360, 36850, 22.605763 },
-    { 28360, 37279, 45.297291 },
-    { 28360, 37826, 26.960791 },
-    { 28360, 38170, 74.161592 },
-    { 28360, 39757, 75.153870 },
-    { 28360, 41704, 27.108870 },
-    { 28360, 43109, 52.901391 },
-    { 28360, 43813, 54.560554 },
-    { 28360, 44127, 30.637675 },
-    { 28360, 45860, 39.514337 },
-    { 28360, 46390, 71.078285 },
-    { 28360, 46853, 35.283682 },
-    { 28360, 47908, 50.094374 },
-    { 28360, 49669, 62.012498 },
-    { 28360, 50583, 58.668819 },
-    { 28360, 50801, 46.666560 },
-    { 28360, 53910, 46.693563 },
-    { 28360, 54061, 45.325933 },
-    { 28360, 54539, 52.834242 },
-    { 28360, 54872, 67.778098 },
-    { 28360, 54879, 71.222094 },
-    { 28360, 57632, 77.935485 },
-    { 28360, 58001, 54.567893 },
-    { 28360, 59774, 55.527182 },
-    { 28360, 62956, 60.522644 },
-    { 28360, 63125, 72.391607 },
-    { 28360, 65378, 64.420369 },
-    { 28360, 67301, 70.961602 },
-    { 28360, 72607, 56.746952 },
-    { 28360, 75097, 59.902571 },
-    { 28360, 75458, 71.314486 },
-    { 28360, 80331, 71.803412 },
-    { 28360, 83895, 68.902198 },
-    { 28360, 85670, 82.549975 },
-    { 28360, 87833, 83.561547 },
-    { 28360, 94376, 66.548293 },
-    { 28360, 102098, 82.925699 },
-    { 28360, 105199, 65.378556 },
-    { 28360, 106032, 58.527731 },
-    { 28360, 109492, 64.524133 },
-    { 28360, 112158, 81.074266 },
-    { 28360, 113881, 79.505731 },
-    { 28360, 116727, 47.411248 },
-    { 28380, 29655, 15.064711 },
-    { 28380, 30122, 67.448745 },
-    { 28380, 30324, 55.433848 },
-    { 28380, 30343, 15.529321 },
-    { 28380, 31681, 22.441453 },
-    { 28380, 31685, 80.872041 },
-    { 28380, 32246, 15.317611 },
-    { 28380, 32349, 54.977921 },
-    { 28380, 32362, 26.364417 },
-    { 28380, 33579, 67.610533 },
-    { 28380, 33977, 62.838980 },
-    { 28380, 34444, 65.621857 },
-    { 28380, 35264, 76.436311 },
-    { 28380, 35904, 69.392783 },
-    { 28380, 36188, 35.053697 },
-    { 28380, 36377, 83.041523 },
-    { 28380, 36850, 20.188473 },
-    { 28380, 37279, 39.242122 },
-    { 28380, 37826, 23.956191 },
-    { 28380, 38170, 67.211739 },
-    { 28380, 39429, 82.280176 },
-    { 28380, 39757, 68.475384 },
-    { 28380, 41704, 33.283900 },
-    { 28380, 43109, 48.859078 },
-    { 28380, 43813, 50.711650 },
-    { 28380, 44127, 34.201142 },
-    { 28380, 45860, 40.439292 },
-    { 28380, 46390, 66.794259 },
-    { 28380, 46853, 39.674938 },
-    { 28380, 47908, 49.780478 },
-    { 28380, 49669, 60.712188 },
-    { 28380, 50583, 58.591962 },
-    { 28380, 50801, 49.711212 },
-    { 28380, 53910, 52.134913 },
-    { 28380, 54061, 51.396983 },
-    { 28380, 54539, 56.840889 },
-    { 28380, 54872, 68.930488 },
-    { 28380, 54879, 71.805090 },
-    { 28380, 57632, 79.164623 },
-    { 28380, 58001, 60.033468 },
-    { 28380, 59774, 61.463097 },
-    { 28380, 62956, 66.640733 },
-    { 28380, 63125, 77.114839 },
-    { 28380, 65378, 70.696673 },
-    { 28380, 67301, 77.100193 },
-    { 28380, 72607, 64.264877 },
-    { 28380, 75097, 67.435175 },
-    { 28380, 75458, 78.593317 },
-    { 28380, 80331, 79.375026 },
-    { 28380, 83895, 76.598595 },
-    { 28380, 94376, 74.225500 },
-    { 28380, 105199, 72.556683 },
-    { 28380, 106032, 65.922061 },
-    { 28380, 109492, 71.211667 },
-    { 28380, 113881, 83.404226 },
-    { 28380, 116727, 54.858423 },
-    { 29655, 30122, 52.586419 },
-    { 29655, 30324, 40.507901 },
-    { 29655, 30343, 1.866460 },
-    { 29655, 30438, 75.228538 },
-    { 29655, 31681, 8.138260 },
-    { 29655, 31685, 65.913437 },
-    { 29655, 32246, 7.142741 },
-    { 29655, 32349, 39.913422 },
-    { 29655, 32362, 12.027525 },
-    { 29655, 32768, 73.530621 },
-    { 29655, 33579, 52.546112 },
-    { 29655, 33977, 47.794077 },
-    { 29655, 34444, 50.586063 },
-    { 29655, 35264, 61.383680 },
-    { 29655, 35904, 54.422141 },
-    { 29655, 36188, 22.438397 },
-    { 29655, 36377, 67.993494 },
-    { 29655, 36850, 20.008206 },
-    { 29655, 37279, 26.729293 },
-    { 29655, 37826, 21.143357 },
-    { 29655, 38170, 52.614554 },
-    { 29655, 39429, 67.451226 },
-    { 29655, 39757, 54.218359 },
-    { 29655, 39953, 74.462906 },
-    { 29655, 41704, 44.833810 },
-    { 29655, 42913, 83.613164 },
-    { 29655, 43109, 39.961955 },
-    { 29655, 43813, 42.080062 },
-    { 29655, 44127, 41.390688 },
-    { 29655, 44816, 76.983208 },
-    { 29655, 45860, 42.221801 },
-    { 29655, 46390, 56.537710 },
-    { 29655, 46853, 47.750327 },
-    { 29655, 47908, 48.230629 },
-    { 29655, 49669, 56.407863 },
-    { 29655, 50583, 56.797430 },
-    { 29655, 50801, 54.553713 },
-    { 29655, 52943, 77.543020 },
-    { 29655, 53910, 61.377952 },
-    { 29655, 54061, 61.915461 },
-    { 29655, 54539, 63.045808 },
-    { 29655, 54872, 68.841587 },
-    { 29655, 54879, 70.444193 },
-    { 29655, 57632, 78.649761 },
-    { 29655, 58001, 68.982639 },
-    { 29655, 59774, 71.339567 },
-    { 29655, 62956, 76.744620 },
-    { 29655, 63125, 83.806212 },
-    { 29655, 65378, 81.039510 },
-    { 29655, 72607, 77.897483 },
-    { 29655, 75097, 81.088024 },
-    { 29655, 106032, 80.965815 },
-    { 29655, 116727, 69.918469 },
-    { 30122, 30324, 12.119649 },
-    { 30122, 30343, 52.581073 },
-    { 30122, 30438, 22.642180 },
-    { 30122, 31681, 46.651499 },
-    { 30122, 31685, 13.585748 },
-    { 30122, 32246, 55.484118 },
-    { 30122, 32349, 14.508056 },
-    { 30122, 32362, 43.378610 },
-    { 30122, 32607, 32.203491 },
-    { 30122, 32768, 21.286147 },
-    { 30122, 33579, 8.403501 },
-    { 30122, 33977, 11.366675 },
-    { 30122, 34444, 11.200727 },
-    { 30122, 35264, 13.745828 },
-    { 30122, 35904, 13.862702 },
-    { 30122, 36188, 41.578941 },
-    { 30122, 36377, 19.062783 },
-    { 30122, 36850, 64.409009 },
-    { 30122, 37279, 40.045296 },
-    { 30122, 37826, 61.534147 },
-    { 30122, 38170, 20.375359 },
-    { 30122, 39429, 23.246523 },
-    { 30122, 39757, 24.469948 },
-    { 30122, 39953, 27.183451 },
-    { 30122, 41037, 35.917891 },
-    { 30122, 42913, 35.618535 },
-    { 30122, 43109, 50.631119 },
-    { 30122, 43813, 51.738273 },
-    { 30122, 44816, 35.703307 },
-    { 30122, 45238, 46.487248 },
-    { 30122, 45556, 41.610677 },
-    { 30122, 45860, 77.268350 },
-    { 30122, 45941, 40.661675 },
-    { 30122, 46390, 48.629968 },
-    { 30122, 46701, 42.516717 },
-    { 30122, 47908, 73.001721 },
-    { 30122, 48002, 47.126435 },
-    { 30122, 49669, 69.080177 },
-    { 30122, 50099, 51.253627 },
-    { 30122, 50371, 49.293016 },
-    { 30122, 50583, 76.227634 },
-    { 30122, 51576, 51.108582 },
-    { 30122, 52419, 52.705568 },
-    { 30122, 52727, 52.847069 },
-    { 30122, 52943, 62.607621 },
-    { 30122, 56561, 58.516771 },
-    { 30122, 59196, 65.395575 },
-    { 30122, 59316, 76.810264 },
-    { 30122, 59747, 63.998677 },
-    { 30122, 59803, 80.374226 },
-    { 30122, 60718, 64.150402 },
-    { 30122, 60965, 83.809863 },
-    { 30122, 61084, 66.519992 },
-    { 30122, 61359, 81.362685 },
-    { 30122, 61585, 63.548748 },
-    { 30122, 61932, 71.013835 },
-    { 30122, 62322, 64.637271 },
-    { 30122, 62434, 67.643979 },
-    { 30122, 65109, 83.162280 },
-    { 30122, 66657, 76.867168 },
-    { 30122, 68002, 82.465537 },
-    { 30122, 68702, 75.597727 },
-    { 30122, 71681, 78.663312 },
-    { 30122, 71683, 78.668510 },
-    { 30122, 71908, 76.050447 },
-    { 30122, 74946, 75.786820 },
-    { 30122, 77952, 82.182143 },
-    { 30122, 82273, 79.487911 },
-    { 30122, 110130, 77.445182 },
-    { 30122, 112122, 83.037767 },
-    { 30324, 30343, 40.469817 },
-    { 30324, 30438, 34.740666 },
-    { 30324, 31681, 34.553528 },
-    { 30324, 31685, 25.440417 },
-    { 30324, 32246, 43.395960 },
-    { 30324, 32349, 5.500539 },
-    { 30324, 32362, 31.351247 },
-    { 30324, 32607, 44.213731 },
-    { 30324, 32768, 33.107774 },
-    { 30324, 33579, 13.743514 },
-    { 30324, 33977, 11.095300 },
-    { 30324, 34444, 13.517641 },
-    { 30324, 35264, 22.571258 },
-    { 30324, 35904, 18.035659 },
-    { 30324, 36188, 30.691334 },
-    { 30324, 36377, 28.981964 },
-    { 30324, 36850, 52.739533 },
-    { 30324, 37279, 29.909508 },
-    { 30324, 37826, 50.141001 },
-    { 30324, 38170, 21.272404 },
-    { 30324, 39429, 30.973294 },
-    { 30324, 39757, 25.214815 },
-    { 30324, 39953, 36.621267 },
-    { 30324, 41037, 46.853727 },
-    { 30324, 41704, 82.752843 },
-    { 30324, 42913, 45.648379 },
-    { 30324, 43109, 43.102308 },
-    { 30324, 43813, 44.610725 },
-    { 30324, 44127, 74.684972 },
-    { 30324, 44816, 43.051698 },
-    { 30324, 45238, 57.872312 },
-    { 30324, 45556, 51.903030 },
-    { 30324, 45860, 67.362411 },
-    { 30324, 45941, 50.262361 },
-    { 30324, 46390, 45.806873 },
-    { 30324, 46701, 52.351852 },
-    { 30324, 46853, 81.006619 },
-    { 30324, 47908, 64.780605 },
-    { 30324, 48002, 57.903740 },
-    { 30324, 49669, 63.203618 },
-    { 30324, 50099, 62.417896 },
-    { 30324, 50371, 59.449877 },
-    { 30324, 50583, 69.392148 },
-    { 30324, 50801, 81.201325 },
-    { 30324, 51576, 61.254174 },
-    { 30324, 52419, 63.170408 },
-    { 30324, 52727, 60.943564 },
-    { 30324, 52943, 63.456681 },
-    { 30324, 54872, 81.106660 },
-    { 30324, 54879, 79.173149 },
-    { 30324, 56561, 68.748071 },
-    { 30324, 59196, 73.960527 },
-    { 30324, 59316, 80.402513 },
-    { 30324, 59747, 73.750716 },
-    { 30324, 59803, 83.096851 },
-    { 30324, 60718, 74.478311 },
-    { 30324, 61084, 76.125084 },
-    { 30324, 61585, 74.533789 },
-    { 30324, 61932, 79.555117 },
-    { 30324, 62322, 75.544800 },
-    { 30324, 62434, 77.653308 },
-    { 30343, 30438, 75.209879 },
-    { 30343, 31681, 7.032929 },
-    { 30343, 31685, 65.798000 },
-    { 30343, 32246, 5.463197 },
-    { 30343, 32349, 39.601087 },
-    { 30343, 32362, 10.986215 },
-    { 30343, 32768, 73.370929 },
-    { 30343, 33579, 52.197606 },
-    { 30343, 33977, 47.358564 },
-    { 30343, 34444, 50.127834 },
-    { 30343, 35264, 60.963470 },
-    { 30343, 35904, 53.865430 },
-    { 30343, 36188, 20.978015 },
-    { 30343, 36377, 67.557201 },
-    { 30343, 36850, 18.443893 },
-    { 30343, 37279, 25.276935 },
-    { 30343, 37826, 19.389909 },
-    { 30343, 38170, 51.797527 },
-    { 30343, 39429, 66.773435 },
-    { 30343, 39757, 53.261557 },
-    { 30343, 39953, 73.859348 },
-    { 30343, 41704, 44.120806 },
-    { 30343, 42913, 82.974781 },
-    { 30343, 43109, 38.194963 },
-    { 30343, 43813, 40.303736 },
-    { 30343, 44127, 40.155316 },
-    { 30343, 44816, 76.051827 },
-    { 30343, 45860, 40.556141 },
-    { 30343, 46390, 54.903511 },
-    { 30343, 46853, 46.562958 },
-    { 30343, 47908, 46.404887 },
-    { 30343, 49669, 54.541656 },
-    { 30343, 50583, 54.954793 },
-    { 30343, 50801, 53.036587 },
-    { 30343, 52943, 75.842098 },
-    { 30343, 53910, 60.255069 },
-    { 30343, 54061, 60.957278 },
-    { 30343, 54539, 61.606213 },
-    { 30343, 54872, 67.028698 },
-    { 30343, 54879, 68.598548 },
-    { 30343, 57632, 76.815486 },
-    { 30343, 58001, 67.795693 },
-    { 30343, 59774, 70.258504 },
-    { 30343, 62956, 75.675678 },
-    { 30343, 63125, 82.346005 },
-    { 30343, 65378, 79.989758 },
-    { 30343, 72607, 77.479332 },
-    { 30343, 75097, 80.667754 },
-    { 30343, 106032, 81.421944 },
-    { 30343, 116727, 70.330380 },
-    { 30438, 31681, 69.159371 },
-    { 30438, 31685, 9.774228 },
-    { 30438, 32246, 77.948988 },
-    { 30438, 32349, 36.223936 },
-    { 30438, 32362, 65.752675 },
-    { 30438, 32607, 9.798020 },
-    { 30438, 32768, 4.533489 },
-    { 30438, 33579, 24.571911 },
-    { 30438, 33977, 29.802456 },
-    { 30438, 34444, 27.588935 },
-    { 30438, 35264, 18.156288 },
-    { 30438, 35904, 25.879770 },
-    { 30438, 36188, 62.459313 },
-    { 30438, 36377, 14.345634 },
-    { 30438, 37279, 60.084465 },
-    { 30438, 37826, 82.654194 },
-    { 30438, 38170, 32.156084 },
-    { 30438, 39429, 21.190878 },
-    { 30438, 39757, 34.487470 },
-    { 30438, 39953, 17.671713 },
-    { 30438, 41037, 17.693145 },
-    { 30438, 42913, 20.706911 },
-    { 30438, 43109, 66.414943 },
-    { 30438, 43813, 66.826879 },
-    { 30438, 44816, 28.483988 },
-    { 30438, 45238, 25.649175 },
-    { 30438, 45556, 24.607959 },
-    { 30438, 45941, 25.925997 },
-    { 30438, 46390, 57.545340 },
-    { 30438, 46701, 26.743223 },
-    { 30438, 48002, 28.016732 },
-    { 30438, 49669, 80.462590 },
-    { 30438, 50099, 30.798908 },
-    { 30438, 50371, 31.704431 },
-    { 30438, 51576, 33.370448 },
-    { 30438, 52419, 34.000793 },
-    { 30438, 52727, 39.974049 },
-    { 30438, 52943, 62.956013 },
-    { 30438, 56561, 39.984231 },
-    { 30438, 59196, 50.072742 },
-    { 30438, 59316, 70.143744 },
-    { 30438, 59747, 46.204199 },
-    { 30438, 59803, 74.913620 },
-    { 30438, 60718, 45.074446 },
-    { 30438, 60965, 77.811977 },
-    { 30438, 61084, 48.883257 },
-    { 30438, 61359, 73.109634 },
-    { 30438, 61585, 43.045487 },
-    { 30438, 61932, 55.286175 },
-    { 30438, 62322, 44.267618 },
-    { 30438, 62434, 49.078629 },
-    { 30438, 64962, 79.593476 },
-    { 30438, 65109, 69.106510 },
-    { 30438, 66657, 58.548963 },
-    { 30438, 68002, 64.880031 },
-    { 30438, 68702, 55.599820 },
-    { 30438, 68895, 82.925672 },
-    { 30438, 68933, 74.920041 },
-    { 30438, 71352, 73.147137 },
-    { 30438, 71681, 58.008152 },
-    { 30438, 71683, 58.013449 },
-    { 30438, 71860, 69.327227 },
-    { 30438, 71908, 54.898420 },
-    { 30438, 73273, 74.475928 },
-    { 30438, 73334, 75.430448 },
-    { 30438, 74946, 53.939244 },
-    { 30438, 75141, 78.657320 },
-    { 30438, 75264, 75.141734 },
-    { 30438, 76297, 79.302257 },
-    { 30438, 77952, 60.297356 },
-    { 30438, 82273, 57.023282 },
-    { 30438, 83081, 69.903407 },
-    { 30438, 84143, 82.826420 },
-    { 30438, 85258, 71.099266 },
-    { 30438, 85267, 70.264808 },
-    { 30438, 85792, 76.837517 },
-    { 30438, 86228, 83.779700 },
-    { 30438, 100751, 67.762959 },
-    { 30438, 101772, 76.034722 },
-    { 30438, 108085, 79.078250 },
-    { 30438, 109268, 69.482887 },
-    { 30438, 110130, 57.711238 },
-    { 30438, 112122, 66.203684 },
-    { 30438, 113368, 78.496961 },
-    { 31681, 31685, 59.595340 },
-    { 31681, 32246, 8.851656 },
-    { 31681, 32349, 33.163330 },
-    { 31681, 32362, 3.953811 },
-    { 31681, 32607, 78.368991 },
-    { 31681, 32768, 67.067679 },
-    { 31681, 33579, 45.651965 },
-    { 31681, 33977, 40.704731 },
-    { 31681, 34444, 43.437125 },
-    { 31681, 35264, 54.298020 },
-    { 31681, 35904, 47.053968 },
-    { 31681, 36188, 14.534502 },
-    { 31681, 36377, 60.860196 },
-    { 31681, 36850, 20.162998 },
-    { 31681, 37279, 18.781604 },
-    { 31681, 37826, 19.455957 },
-    { 31681, 38170, 44.795933 },
-    { 31681, 39429, 59.843026 },
-    { 31681, 39757, 46.228669 },
-    { 31681, 39953, 66.981743 },
-    { 31681, 41037, 78.845740 },
-    { 31681, 41704, 48.699794 },
-    { 31681, 42913, 76.062885 },
-    { 31681, 43109, 33.106924 },
-    { 31681, 43813, 35.280245 },
-    { 31681, 44127, 42.868345 },
-    { 31681, 44816, 69.019435 },
-    { 31681, 45556, 82.321658 },
-    { 31681, 45860, 40.676867 },
-    { 31681, 45941, 79.442324 },
-    { 31681, 46390, 48.923656 },
-    { 31681, 46701, 81.805451 },
-    { 31681, 46853, 49.389835 },
-    { 31681, 47908, 44.589195 },
-    { 31681, 49669, 51.120118 },
-    { 31681, 50583, 52.692008 },
-    { 31681, 50801, 54.038348 },
-    { 31681, 52943, 70.134423 },
-    { 31681, 53910, 63.200602 },
-    { 31681, 54061, 64.550054 },
-    { 31681, 54539, 62.977551 },
-    { 31681, 54872, 65.196635 },
-    { 31681, 54879, 66.138940 },
-    { 31681, 57632, 74.535844 },
-    { 31681, 58001, 70.389898 },
-    { 31681, 59774, 73.288284 },
-    { 31681, 62956, 78.711101 },
-    { 31681, 63125, 83.398883 },
-    { 31681, 65378, 83.069942 },
-    { 31681, 72607, 82.645932 },
-    { 31681, 116727, 77.054864 },
-    { 31685, 32246, 68.341829 },
-    { 31685, 32349, 26.529415 },
-    { 31685, 32362, 56.118448 },
-    { 31685, 32607, 18.809263 },
-    { 31685, 32768, 7.702625 },
-    { 31685, 33579, 14.827194 },
-    { 31685, 33977, 20.050342 },
-    { 31685, 34444, 17.920903 },
-    { 31685, 35264, 9.674837 },
-    { 31685, 35904, 16.704727 },
-    { 31685, 36188, 52.697151 },
-    { 31685, 36377, 9.363828 },
-    { 31685, 36850, 76.204667 },
-    { 31685, 37279, 50.387056 },
-    { 31685, 37826, 72.894140 },
-    { 31685, 38170, 23.470123 },
-    { 31685, 39429, 16.311630 },
-    { 31685, 39757, 26.388866 },
-    { 31685, 39953, 16.602985 },
-    { 31685, 41037, 22.814093 },
-    { 31685, 42913, 23.521823 },
-    { 31685, 43109, 57.579197 },
-    { 31685, 43813, 58.175150 },
-    { 31685, 44816, 27.093828 },
-    { 31685, 45238, 32.982770 },
-    { 31685, 45556, 29.021440 },
-    { 31685, 45941, 28.854013 },
-    { 31685, 46390, 50.596315 },
-    { 31685, 46701, 30.381704 },
-    { 31685, 47908, 79.696566 },
-    { 31685, 48002, 34.007705 },
-    { 31685, 49669, 73.099776 },
-    { 31685, 50099, 37.844257 },
-    { 31685, 50371, 36.675490 },
-    { 31685, 50583, 81.050856 },
-    { 31685, 51576, 38.470243 },
-    { 31685, 52419, 39.773781 },
-    { 31685, 52727, 42.211545 },
-    { 31685, 52943, 59.395475 },
-    { 31685, 56561, 45.704819 },
-    { 31685, 59196, 53.920538 },
-    { 31685, 59316, 69.866076 },
-    { 31685, 59747, 51.505735 },
-    { 31685, 59803, 74.169457 },
-    { 31685, 60718, 51.208774 },
-    { 31685, 60965, 77.370121 },
-    { 31685, 61084, 54.113038 },
-    { 31685, 61359, 73.640793 },
-    { 31685, 61585, 50.188572 },
-    { 31685, 61932, 59.440673 },
-    { 31685, 62322, 51.315396 },
-    { 31685, 62434, 54.904843 },
-    { 31685, 64962, 81.395177 },
-    { 31685, 65109, 72.507516 },
-    { 31685, 66657, 64.291689 },
-    { 31685, 68002, 70.224729 },
-    { 31685, 68702, 62.430136 },
-    { 31685, 68933, 79.409427 },
-    { 31685, 71352, 78.824171 },
-    { 31685, 71681, 65.317275 },
-    { 31685, 71683, 65.322516 },
-    { 31685, 71860, 75.567258 },
-    { 31685, 71908, 62.578155 },
-    { 31685, 73273, 80.712902 },
-    { 31685, 73334, 81.604569 },
-    { 31685, 74946, 62.208530 },
-    { 31685, 75264, 81.964152 },
-    { 31685, 77952, 68.603830 },
-    { 31685, 82273, 65.969024 },
-    { 31685, 83081, 78.626695 },
-    { 31685, 85258, 80.086753 },
-    { 31685, 85267, 79.264714 },
-    { 31685, 100751, 77.528581 },
-    { 31685, 109268, 78.567981 },
-    { 31685, 110130, 67.178419 },
-    { 31685, 112122, 74.940259 },
-    { 32246, 32349, 41.845357 },
-    { 32246, 32362, 12.239290 },
-    { 32246, 32768, 75.757205 },
-    { 32246, 33579, 54.218257 },
-    { 32246, 33977, 49.182246 },
-    { 32246, 34444, 51.861266 },
-    { 32246, 35264, 62.717632 },
-    { 32246, 35904, 55.281523 },
-    { 32246, 36188, 19.741487 },
-    { 32246, 36377, 69.221258 },
-    { 32246, 36850, 13.006701 },
-    { 32246, 37279, 23.925189 },
-    { 32246, 37826, 14.017133 },
-    { 32246, 38170, 52.430195 },
-    { 32246, 39429, 67.726504 },
-    { 32246, 39757, 53.416185 },
-    { 32246, 39953, 74.992709 },
-    { 32246, 41704, 39.966739 },
-    { 32246, 42913, 83.947196 },
-    { 32246, 43109, 34.818458 },
-    { 32246, 43813, 36.837916 },
-    { 32246, 44127, 35.046588 },
-    { 32246, 44816, 76.125439 },
-    { 32246, 45860, 35.098943 },
-    { 32246, 46390, 52.234903 },
-    { 32246, 46853, 41.511001 },
-    { 32246, 47908, 41.225051 },
-    { 32246, 49669, 49.902023 },
-    { 32246, 50583, 49.864922 },
-    { 32246, 50801, 47.607871 },
-    { 32246, 52943, 72.696479 },
-    { 32246, 53910, 55.275333 },
-    { 32246, 54061, 56.251821 },
-    { 32246, 54539, 56.230970 },
-    { 32246, 54872, 61.785984 },
-    { 32246, 54879, 63.520532 },
-    { 32246, 57632, 71.661821 },
-    { 32246, 58001, 62.709410 },
-    { 32246, 59774, 65.327515 },
-    { 32246, 62956, 70.755301 },
-    { 32246, 63125, 76.947630 },
-    { 32246, 65378, 75.093106 },
-    { 32246, 67301, 80.774601 },
-    { 32246, 72607, 73.817837 },
-    { 32246, 75097, 76.989417 },
-    { 32246, 106032, 79.996188 },
-    { 32246, 116727, 68.843797 },
-    { 32349, 32362, 29.609217 },
-    { 32349, 32607, 45.232031 },
-    { 32349, 32768, 33.914840 },
-    { 32349, 33579, 12.643510 },
-    { 32349, 33977, 8.259952 },
-    { 32349, 34444, 11.081147 },
-    { 32349, 35264, 21.573271 },
-    { 32349, 35904, 15.436142 },
-    { 32349, 36188, 27.073799 },
-    { 32349, 36377, 28.189340 },
-    { 32349, 36850, 50.026331 },
-    { 32349, 37279, 25.701197 },
-    { 32349, 37826, 47.051083 },
-    { 32349, 38170, 17.040468 },
-    { 32349, 39429, 28.839664 },
-    { 32349, 39757, 20.701298 },
-    { 32349, 39953, 35.210611 },
-    { 32349, 41037, 46.324109 },
-    { 32349, 41704, 80.259028 },
-    { 32349, 42913, 44.400129 },
-    { 32349, 43109, 37.935808 },
-    { 32349, 43813, 39.367594 },
-    { 32349, 44127, 71.335832 },
-    { 32349, 44816, 40.319623 },
-    { 32349, 45238, 57.665786 },
-    { 32349, 45556, 50.735952 },
-    { 32349, 45860, 63.130008 },
-    { 32349, 45941, 48.626839 },
-    { 32349, 46390, 40.349090 },
-    { 32349, 46701, 50.839584 },
-    { 32349, 46853, 77.513674 },
-    { 32349, 47908, 59.871323 },
-    { 32349, 48002, 57.057795 },
-    { 32349, 49669, 57.826817 },
-    { 32349, 50099, 61.903906 },
-    { 32349, 50371, 58.065267 },
-    { 32349, 50583, 64.171236 },
-    { 32349, 50801, 76.815068 },
-    { 32349, 51576, 59.836829 },
-    { 32349, 52419, 61.983739 },
-    { 32349, 52727, 58.256174 },
-    { 32349, 52943, 58.368070 },
-    { 32349, 54872, 75.746620 },
-    { 32349, 54879, 73.728365 },
-    { 32349, 56561, 67.306161 },
-    { 32349, 57632, 81.243001 },
-    { 32349, 59196, 71.364825 },
-    { 32349, 59316, 75.805947 },
-    { 32349, 59747, 71.897033 },
-    { 32349, 59803, 78.270346 },
-    { 32349, 60718, 73.051819 },
-    { 32349, 60965, 81.781045 },
-    { 32349, 61084, 74.144324 },
-    { 32349, 61359, 81.055563 },
-    { 32349, 61585, 73.705085 },
-    { 32349, 61932, 76.886637 },
-    { 32349, 62322, 74.627909 },
-    { 32349, 62434, 75.945118 },
-    { 32362, 32607, 74.840217 },
-    { 32362, 32768, 63.518587 },
-    { 32362, 33579, 41.991889 },
-    { 32362, 33977, 36.984216 },
-    { 32362, 34444, 39.688571 },
-    { 32362, 35264, 50.552042 },
-    { 32362, 35904, 43.225932 },
-    { 32362, 36188, 11.267958 },
-    { 32362, 36377, 57.089602 },
-    { 32362, 36850, 22.107722 },
-    { 32362, 37279, 15.373686 },
-    { 32362, 37826, 20.612300 },
-    { 32362, 38170, 40.855569 },
-    { 32362, 39429, 55.939403 },
-    { 32362, 39757, 42.275452 },
-    { 32362, 39953, 63.105297 },
-    { 32362, 41037, 75.022720 },
-    { 32362, 41704, 51.516790 },
-    { 32362, 42913, 72.165644 },
-    { 32362, 43109, 30.606928 },
-    { 32362, 43813, 32.798907 },
-    { 32362, 44127, 44.802048 },
-    { 32362, 44816, 65.065745 },
-    { 32362, 45556, 78.412566 },
-    { 32362, 45860, 41.262455 },
-    { 32362, 45941, 75.505785 },
-    { 32362, 46390, 45.703896 },
-    { 32362, 46701, 77.871299 },
-    { 32362, 46853, 51.316703 },
-    { 32362, 47908, 44.010992 },
-    { 32362, 49669, 49.507412 },
-    { 32362, 50583, 51.759357 },
-    { 32362, 50801, 54.947595 },
-    { 32362, 52727, 81.720976 },
-    { 32362, 52943, 67.020933 },
-    { 32362, 53910, 65.084945 },
-    { 32362, 54061, 66.769923 },
-    { 32362, 54539, 64.011838 },
-    { 32362, 54872, 64.408484 },
-    { 32362, 54879, 64.979772 },
-    { 32362, 57632, 73.423863 },
-    { 32362, 58001, 72.039163 },
-    { 32362, 59774, 75.156756 },
-    { 32362, 62956, 80.552500 },
-    { 32362, 116727, 80.865297 },
-    { 32607, 32768, 11.330099 },
-    { 32607, 33579, 33.014751 },
-    { 32607, 33977, 38.192223 },
-    { 32607, 34444, 35.709621 },
-    { 32607, 35264, 25.249050 },
-    { 32607, 35904, 33.168630 },
-    { 32607, 36188, 70.639330 },
-    { 32607, 36377, 19.597579 },
-    { 32607, 37279, 67.888891 },
-    { 32607, 38170, 38.492171 },
-    { 32607, 39429, 24.733524 },
-    { 32607, 39757, 39.963862 },
-    { 32607, 39953, 18.590883 },
-    { 32607, 41037, 11.714783 },
-    { 32607, 42913, 16.729302 },
-    { 32607, 43109, 72.087015 },
-    { 32607, 43813, 72.169739 },
-    { 32607, 44816, 27.542663 },
-    { 32607, 45238, 16.414747 },
-    { 32607, 45556, 18.202648 },
-    { 32607, 45941, 20.914455 },
-    { 32607, 46390, 60.668886 },
-    { 32607, 46701, 20.890684 },
-    { 32607, 48002, 19.761613 },
-    { 32607, 49669, 83.539856 },
-    { 32607, 50099, 21.617307 },
-    { 32607, 50371, 24.143232 },
-    { 32607, 51576, 25.606849 },
-    { 32607, 52419, 25.652135 },
-    { 32607, 52727, 34.424863 },
-    { 32607, 52943, 61.996970 },
-    { 32607, 56561, 31.489833 },
-    { 32607, 59196, 42.726076 },
-    { 32607, 59316, 65.719945 },
-    { 32607, 59747, 37.862050 },
-    { 32607, 59803, 70.783173 },
-    { 32607, 60718, 36.196042 },
-    { 32607, 60965, 73.328765 },
-    { 32607, 61084, 40.535511 },
-    { 32607, 61359, 67.888413 },
-    { 32607, 61585, 33.628367 },
-    { 32607, 61932, 47.577352 },
-    { 32607, 62322, 34.885344 },
-    { 32607, 62434, 40.330692 },
-    { 32607, 64962, 73.175999 },
-    { 32607, 65109, 61.680181 },
-    { 32607, 66657, 49.725712 },
-    { 32607, 68002, 56.220069 },
-    { 32607, 68702, 46.231259 },
-    { 32607, 68895, 75.187109 },
-    { 32607, 68933, 66.666283 },
-    { 32607, 71352, 64.219613 },
-    { 32607, 71681, 48.432577 },
-    { 32607, 71683, 48.437874 },
-    { 32607, 71860, 60.143423 },
-    { 32607, 71908, 45.215703 },
-    { 32607, 73273, 65.260634 },
-    { 32607, 73334, 66.238433 },
-    { 32607, 73714, 81.996520 },
-    { 32607, 74946, 44.148093 },
-    { 32607, 75141, 69.287338 },
-    { 32607, 75264, 65.676543 },
-    { 32607, 76297, 69.808080 },
-    { 32607, 77952, 50.501643 },
-    { 32607, 82273, 47.309290 },
-    { 32607, 82396, 80.851284 },
-    { 32607, 82514, 77.281610 },
-    { 32607, 83081, 60.137258 },
-    { 32607, 84143, 73.051673 },
-    { 32607, 85258, 61.410183 },
-    { 32607, 85267, 60.580310 },
-    { 32607, 85696, 79.532183 },
-    { 32607, 85792, 67.149703 },
-    { 32607, 85927, 79.810019 },
-    { 32607, 86228, 74.090254 },
-    { 32607, 86670, 78.156409 },
-    { 32607, 87073, 77.197466 },
-    { 32607, 87261, 80.312278 },
-    { 32607, 89642, 81.102752 },
-    { 32607, 90185, 83.550904 },
-    { 32607, 100751, 59.811550 },
-    { 32607, 101772, 68.588281 },
-    { 32607, 108085, 73.864277 },
-    { 32607, 109268, 63.980554 },
-    { 32607, 110130, 51.358980 },
-    { 32607, 112122, 61.524804 },
-    { 32607, 113368, 75.728636 },
-    { 32768, 33579, 21.704216 },
-    { 32768, 33977, 26.901184 },
-    { 32768, 34444, 24.477169 },
-    { 32768, 35264, 14.364085 },
-    { 32768, 35904, 22.258448 },
-    { 32768, 36188, 59.454921 },
-    { 32768, 36377, 9.904632 },
-    { 32768, 36850, 83.092046 },
-    { 32768, 37279, 56.847355 },
-    { 32768, 37826, 79.590449 },
-    { 32768, 38170, 28.180992 },
-    { 32768, 39429, 16.661123 },
-    { 32768, 39757, 30.280497 },
-    { 32768, 39953, 13.421522 },
-    { 32768, 41037, 15.833204 },
-    { 32768, 42913, 17.742560 },
-    { 32768, 43109, 62.356727 },
-    { 32768, 43813, 62.687782 },
-    { 32768, 44816, 24.349895 },
-    { 32768, 45238, 25.400144 },
-    { 32768, 45556, 22.476918 },
-    { 32768, 45941, 23.110520 },
-    { 32768, 46390, 53.057993 },
-    { 32768, 46701, 24.258678 },
-    { 32768, 47908, 83.899011 },
-    { 32768, 48002, 26.833304 },
-    { 32768, 49669, 75.996741 },
-    { 32768, 50099, 30.352691 },
-    { 32768, 50371, 29.951232 },
-    { 32768, 51576, 31.701712 },
-    { 32768, 52419, 32.725603 },
-    { 32768, 52727, 37.030292 },
-    { 32768, 52943, 58.603903 },
-    { 32768, 56561, 38.711774 },
-    { 32768, 59196, 47.873998 },
-    { 32768, 59316, 66.515676 },
-    { 32768, 59747, 44.722208 },
-    { 32768, 59803, 71.172741 },
-    { 32768, 60718, 44.074050 },
-    { 32768, 60965, 74.162277 },
-    { 32768, 61084, 47.373577 },
-    { 32768, 61359, 69.733343 },
-    { 32768, 61585, 42.711533 },
-    { 32768, 61932, 53.255357 },
-    { 32768, 62322, 43.868572 },
-    { 32768, 62434, 47.907545 },
-    { 32768, 64962, 76.671159 },
-    { 32768, 65109, 66.785696 },
-    { 32768, 66657, 57.360928 },
-    { 32768, 68002, 63.488923 },
-    { 32768, 68702, 55.078205 },
-    { 32768, 68895, 80.708679 },
-    { 32768, 68933, 73.119475 },
-    { 32768, 71352, 71.961908 },
-    { 32768, 71681, 57.825183 },
-    { 32768, 71683, 57.830448 },
-    { 32768, 71860, 68.460564 },
-    { 32768, 71908, 54.989784 },
-    { 32768, 73273, 73.618863 },
-    { 32768, 73334, 74.537833 },
-    { 32768, 74946, 54.523412 },
-    { 32768, 75141, 77.995276 },
-    { 32768, 75264, 74.653076 },
-    { 32768, 76297, 78.843937 },
-    { 32768, 77952, 60.918078 },
-    { 32768, 82273, 58.288682 },
-    { 32768, 83081, 70.924700 },
-    { 32768, 84143, 83.763357 },
-    { 32768, 85258, 72.406132 },
-    { 32768, 85267, 71.586377 },
-    { 32768, 85792, 78.136461 },
-    { 32768, 100751, 70.845966 },
-    { 32768, 101772, 79.388754 },
-    { 32768, 108085, 83.182013 },
-    { 32768, 109268, 73.497134 },
-    { 32768, 110130, 61.451171 },
-    { 32768, 112122, 70.394093 },
-    { 32768, 113368, 82.966837 },
-    { 33579, 33977, 5.232227 },
-    { 33579, 34444, 3.364980 },
-    { 33579, 35264, 9.001306 },
-    { 33579, 35904, 5.570710 },
-    { 33579, 36188, 37.890730 },
-    { 33579, 36377, 15.588078 },
-    { 33579, 36850, 61.458062 },
-    { 33579, 37279, 35.571128 },
-    { 33579, 37826, 58.083193 },
-    { 33579, 38170, 12.011756 },
-    { 33579, 39429, 17.295383 },
-    { 33579, 39757, 16.074329 },
-    { 33579, 39953, 22.938885 },
-    { 33579, 41037, 33.706515 },
-    { 33579, 42913, 32.046196 },
-    { 33579, 43109, 43.928868 },
-    { 33579, 43813, 44.809283 },
-    { 33579, 44127, 81.628560 },
-    { 33579, 44816, 29.569108 },
-    { 33579, 45238, 45.023453 },
-    { 33579, 45556, 38.349362 },
-    { 33579, 45860, 71.740183 },
-    { 33579, 45941, 36.549077 },
-    { 33579, 46390, 40.406893 },
-    { 33579, 46701, 38.670085 },
-    { 33579, 47908, 66.327512 },
-    { 33579, 48002, 44.539586 },
-    { 33579, 49669, 61.415600 },
-    { 33579, 50099, 49.299825 },
-    { 33579, 50371, 45.818187 },
-    { 33579, 50583, 68.847905 },
-    { 33579, 51576, 47.613450 },
-    { 33579, 52419, 49.625283 },
-    { 33579, 52727, 47.347849 },
-    { 33579, 52943, 54.309277 },
-    { 33579, 54872, 78.988288 },
-    { 33579, 54879, 75.990175 },
-    { 33579, 56561, 55.107950 },
-    { 33579, 57632, 82.461486 },
-    { 33579, 59196, 60.299903 },
-    { 33579, 59316, 69.149794 },
-    { 33579, 59747, 60.020461 },
-    { 33579, 59803, 72.486076 },
-    { 33579, 60718, 60.849668 },
-    { 33579, 60965, 75.955691 },
-    { 33579, 61084, 62.384368 },
-    { 33579, 61359, 73.912494 },
-    { 33579, 61585, 61.201670 },
-    { 33579, 61932, 65.909456 },
-    { 33579, 62322, 62.159249 },
-    { 33579, 62434, 63.949351 },
-    { 33579, 64962, 83.138640 },
-    { 33579, 65109, 77.148933 },
-    { 33579, 66657, 72.785650 },
-    { 33579, 68002, 77.874490 },
-    { 33579, 68702, 72.561939 },
-    { 33579, 71681, 76.048406 },
-    { 33579, 71683, 76.053406 },
-    { 33579, 71908, 73.928160 },
-    { 33579, 74946, 74.427214 },
-    { 33579, 77952, 80.749320 },
-    { 33579, 82273, 79.153514 },
-    { 33579, 110130, 81.868921 },
-    { 33977, 34444, 2.833488 },
-    { 33977, 35264, 13.605462 },
-    { 33977, 35904, 7.216882 },
-    { 33977, 36188, 32.658677 },
-    { 33977, 36377, 20.202669 },
-    { 33977, 36850, 56.230714 },
-    { 33977, 37279, 30.377513 },
-    { 33977, 37826, 52.851897 },
-    { 33977, 38170, 10.585339 },
-    { 33977, 39429, 20.590193 },
-    { 33977, 39757, 14.727030 },
-    { 33977, 39953, 26.985971 },
-    { 33977, 41037, 38.308218 },
-    { 33977, 42913, 36.184088 },
-    { 33977, 43109, 39.443629 },
-    { 33977, 43813, 40.468469 },
-    { 33977, 44127, 76.458090 },
-    { 33977, 44816, 32.249984 },
-    { 33977, 45238, 49.735372 },
-    { 33977, 45556, 42.523823 },
-    { 33977, 45860, 66.811467 },
-    { 33977, 45941, 40.367882 },
-    { 33977, 46390, 37.709810 },
-    { 33977, 46701, 42.585452 },
-    { 33977, 46853, 82.345485 },
-    { 33977, 47908, 61.857000 },
-    { 33977, 48002, 48.904561 },
-    { 33977, 49669, 57.722281 },
-    { 33977, 50099, 53.838819 },
-    { 33977, 50371, 49.817051 },
-    { 33977, 50583, 64.871430 },
-    { 33977, 50801, 79.967192 },
-    { 33977, 51576, 51.585085 },
-    { 33977, 52419, 53.755375 },
-    { 33977, 52727, 50.194269 },
-    { 33977, 52943, 53.443484 },
-    { 33977, 54872, 75.504700 },
-    { 33977, 54879, 72.813311 },
-    { 33977, 56561, 59.050284 },
-    { 33977, 57632, 79.682890 },
-    { 33977, 59196, 63.281201 },
-    { 33977, 59316, 69.599508 },
-    { 33977, 59747, 63.649268 },
-    { 33977, 59803, 72.529671 },
-    { 33977, 60718, 64.795283 },
-    { 33977, 60965, 76.036342 },
-    { 33977, 61084, 65.911816 },
-    { 33977, 61359, 74.628037 },
-    { 33977, 61585, 65.528925 },
-    { 33977, 61932, 68.835487 },
-    { 33977, 62322, 66.432242 },
-    { 33977, 62434, 67.688594 },
-    { 33977, 65109, 79.317147 },
-    { 33977, 66657, 76.262724 },
-    { 33977, 68002, 81.026922 },
-    { 33977, 68702, 76.544577 },
-    { 33977, 71681, 80.185670 },
-    { 33977, 71683, 80.190561 },
-    { 33977, 71908, 78.264329 },
-    { 33977, 74946, 79.013256 },
-    { 33977, 82273, 83.996948 },
-    { 34444, 35264, 10.863762 },
-    { 34444, 35904, 4.528946 },
-    { 34444, 36188, 34.980339 },
-    { 34444, 36377, 17.431401 },
-    { 34444, 36850, 58.615852 },
-    { 34444, 37279, 32.495602 },
-    { 34444, 37826, 55.138001 },
-    { 34444, 38170, 9.343767 },
-    { 34444, 39429, 17.802065 },
-    { 34444, 39757, 13.518809 },
-    { 34444, 39953, 24.152501 },
-    { 34444, 41037, 35.511558 },
-    { 34444, 42913, 33.350634 },
-    { 34444, 43109, 40.563891 },
-    { 34444, 43813, 41.449054 },
-    { 34444, 44127, 78.483045 },
-    { 34444, 44816, 29.597753 },
-    { 34444, 45238, 46.955855 },
-    { 34444, 45556, 39.690423 },
-    { 34444, 45860, 68.429013 },
-    { 34444, 45941, 37.546880 },
-    { 34444, 46390, 37.429247 },
-    { 34444, 46701, 39.758807 },
-    { 34444, 47908, 62.963314 },
-    { 34444, 48002, 46.076830 },
-    { 34444, 49669, 58.162796 },
-    { 34444, 50099, 51.026559 },
-    { 34444, 50371, 46.987495 },
-    { 34444, 50583, 65.539382 },
-    { 34444, 50801, 81.365441 },
-    { 34444, 51576, 48.757074 },
-    { 34444, 52419, 50.922271 },
-    { 34444, 52727, 47.529166 },
-    { 34444, 52943, 52.150976 },
-    { 34444, 54872, 75.797218 },
-    { 34444, 54879, 72.887701 },
-    { 34444, 56561, 56.225057 },
-    { 34444, 57632, 79.497694 },
-    { 34444, 59196, 60.596611 },
-    { 34444, 59316, 67.732558 },
-    { 34444, 59747, 60.854729 },
-    { 34444, 59803, 70.838361 },
-    { 34444, 60718, 61.970673 },
-    { 34444, 60965, 74.332761 },
-    { 34444, 61084, 63.131434 },
-    { 34444, 61359, 72.659443 },
-    { 34444, 61585, 62.697625 },
-    { 34444, 61932, 66.166043 },
-    { 34444, 61941, 83.371637 },
-    { 34444, 62322, 63.599360 },
-    { 34444, 62434, 64.882382 },
-    { 34444, 64962, 82.120311 },
-    { 34444, 65109, 76.850130 },
-    { 34444, 66657, 73.493172 },
-    { 34444, 68002, 78.316340 },
-    { 34444, 68702, 73.719050 },
-    { 34444, 71681, 77.353461 },
-    { 34444, 71683, 77.358356 },
-    { 34444, 71908, 75.432637 },
-    { 34444, 74946, 76.202461 },
-    { 34444, 77952, 82.466798 },
-    { 34444, 82273, 81.243631 },
-    { 35264, 35904, 7.928419 },
-    { 35264, 36188, 45.447430 },
-    { 35264, 36377, 6.618614 },
-    { 35264, 36850, 69.106606 },
-    { 35264, 37279, 42.639926 },
-    { 35264, 37826, 65.459058 },
-    { 35264, 38170, 14.030497 },
-    { 35264, 39429, 9.525213 },
-    { 35264, 39757, 16.730765 },
-    { 35264, 39953, 14.066794 },
-    { 35264, 41037, 24.754029 },
-    { 35264, 42913, 23.087346 },
-    { 35264, 43109, 48.292655 },
-    { 35264, 43813, 48.772556 },
-    { 35264, 44816, 21.959375 },
-    { 35264, 45238, 36.141588 },
-    { 35264, 45556, 29.370378 },
-    { 35264, 45860, 77.080230 },
-    { 35264, 45941, 27.724508 },
-    { 35264, 46390, 40.973424 },
-    { 35264, 46701, 29.785600 },
-    { 35264, 47908, 70.219170 },
-    { 35264, 48002, 35.538741 },
-    { 35264, 49669, 63.424963 },
-    { 35264, 50099, 40.330860 },
-    { 35264, 50371, 36.882396 },
-    { 35264, 50583, 71.385594 },
-    { 35264, 51576, 38.684886 },
-    { 35264, 52419, 40.646888 },
-    { 35264, 52727, 39.227778 },
-    { 35264, 52943, 51.104392 },
-    { 35264, 54872, 80.179928 },
-    { 35264, 54879, 76.564343 },
-    { 35264, 56561, 46.179655 },
-    { 35264, 57632, 82.087390 },
-    { 35264, 59196, 51.961398 },
-    { 35264, 59316, 63.626017 },
-    { 35264, 59747, 51.227530 },
-    { 35264, 59803, 67.485866 },
-    { 35264, 60718, 51.913700 },
-    { 35264, 60965, 70.847038 },
-    { 35264, 61084, 53.643263 },
-    { 35264, 61359, 67.957762 },
-    { 35264, 61585, 52.200639 },
-    { 35264, 61932, 57.587134 },
-    { 35264, 61941, 82.056819 },
-    { 35264, 62322, 53.158496 },
-    { 35264, 62434, 55.092606 },
-    { 35264, 64962, 76.605804 },
-    { 35264, 65109, 69.456090 },
-    { 35264, 66657, 64.048587 },
-    { 35264, 68002, 69.330585 },
-    { 35264, 68702, 63.605055 },
-    { 35264, 68895, 83.169054 },
-    { 35264, 68933, 77.296669 },
-    { 35264, 71352, 78.078125 },
-    { 35264, 71681, 67.057663 },
-    { 35264, 71683, 67.062676 },
-    { 35264, 71860, 75.601809 },
-    { 35264, 71908, 64.928249 },
-    { 35264, 73273, 80.606871 },
-    { 35264, 73334, 81.395767 },
-    { 35264, 74946, 65.483271 },
-    { 35264, 75264, 82.594826 },
-    { 35264, 77952, 71.788035 },
-    { 35264, 82273, 70.392174 },
-    { 35264, 83081, 82.362707 },
-    { 35264, 85267, 83.564490 },
-    { 35264, 110130, 75.782332 },
-    { 35904, 36188, 37.599734 },
-    { 35904, 36377, 14.036468 },
-    { 35904, 36850, 61.242596 },
-    { 35904, 37279, 34.723491 },
-    { 35904, 37826, 57.553736 },
-    { 35904, 38170, 7.153355 },
-    { 35904, 39429, 13.413547 },
-    { 35904, 39757, 10.900662 },
-    { 35904, 39953, 20.065809 },
-    { 35904, 41037, 31.796888 },
-    { 35904, 42913, 29.255149 },
-    { 35904, 43109, 40.880731 },
-    { 35904, 43813, 41.518926 },
-    { 35904, 44127, 80.236947 },
-    { 35904, 44816, 25.071987 },
-    { 35904, 45238, 43.301004 },
-    { 35904, 45556, 35.589754 },
-    { 35904, 45860, 69.424272 },
-    { 35904, 45941, 33.262038 },
-    { 35904, 46390, 35.547749 },
-    { 35904, 46701, 35.512228 },
-    { 35904, 47908, 63.071142 },
-    { 35904, 48002, 42.087766 },
-    { 35904, 49669, 57.202689 },
-    { 35904, 50099, 47.169242 },
-    { 35904, 50371, 42.763869 },
-    { 35904, 50583, 64.897307 },
-    { 35904, 50801, 81.890169 },
-    { 35904, 51576, 44.516010 },
-    { 35904, 52419, 46.760992 },
-    { 35904, 52727, 43.007695 },
-    { 35904, 52943, 48.763797 },
-    { 35904, 54872, 74.503621 },
-    { 35904, 54879, 71.276968 },
-    { 35904, 56561, 51.956785 },
-    { 35904, 57632, 77.474444 },
-    { 35904, 59196, 56.082596 },
-    { 35904, 59316, 63.668814 },
-    { 35904, 59747, 56.462950 },
-    { 35904, 59803, 66.944851 },
-    { 35904, 60718, 57.695597 },
-    { 35904, 60965, 70.420395 },
-    { 35904, 61084, 58.709285 },
-    { 35904, 61359, 68.495209 },
-    { 35904, 61585, 58.636549 },
-    { 35904, 61932, 61.646660 },
-    { 35904, 61941, 80.046496 },
-    { 35904, 62322, 59.499827 },
-    { 35904, 62434, 60.522600 },
-    { 35904, 64962, 77.837760 },
-    { 35904, 65109, 72.347955 },
-    { 35904, 66657, 69.052234 },
-    { 35904, 68002, 73.816434 },
-    { 35904, 68702, 69.446255 },
-    { 35904, 68933, 80.765778 },
-    { 35904, 71352, 82.512665 },
-    { 35904, 71681, 73.152190 },
-    { 35904, 71683, 73.157020 },
-    { 35904, 71860, 80.588579 },
-    { 35904, 71908, 71.354480 },
-    { 35904, 74946, 72.322829 },
-    { 35904, 77952, 78.529202 },
-    { 35904, 82273, 77.645645 },
-    { 35904, 110130, 83.586746 },
-    { 36188, 36377, 51.593469 },
-    { 36188, 36850, 23.662655 },
-    { 36188, 37279, 4.299210 },
-    { 36188, 37826, 20.197354 },
-    { 36188, 38170, 33.585418 },
-    { 36188, 39429, 49.022016 },
-    { 36188, 39757, 34.051080 },
-    { 36188, 39953, 56.416028 },
-    { 36188, 41037, 68.698287 },
-    { 36188, 41704, 53.736058 },
-    { 36188, 42913, 65.064226 },
-    { 36188, 43109, 19.828658 },
-    { 36188, 43813, 22.012324 },
-    { 36188, 44127, 44.262926 },
-    { 36188, 44816, 56.562567 },
-    { 36188, 45238, 80.112250 },
-    { 36188, 45556, 71.060014 },
-    { 36188, 45860, 36.945384 },
-    { 36188, 45941, 67.702696 },
-    { 36188, 46390, 34.454819 },
-    { 36188, 46701, 70.092970 },
-    { 36188, 46853, 50.455656 },
-    { 36188, 47908, 36.595723 },
-    { 36188, 48002, 77.821542 },
-    { 36188, 49669, 39.813791 },
-    { 36188, 50099, 83.284721 },
-    { 36188, 50371, 77.079869 },
-    { 36188, 50583, 43.329985 },
-    { 36188, 50801, 50.912837 },
-    { 36188, 51576, 78.589895 },
-    { 36188, 52419, 81.325107 },
-    { 36188, 52727, 72.236273 },
-    { 36188, 52943, 55.754788 },
-    { 36188, 53910, 63.601127 },
-    { 36188, 54061, 66.338205 },
-    { 36188, 54539, 60.031408 },
-    { 36188, 54872, 56.025573 },
-    { 36188, 54879, 55.871125 },
-    { 36188, 57632, 64.293381 },
-    { 36188, 58001, 69.621336 },
-    { 36188, 59316, 75.771098 },
-    { 36188, 59774, 73.336700 },
-    { 36188, 59803, 75.786151 },
-    { 36188, 60965, 78.831714 },
-    { 36188, 61359, 81.373274 },
-    { 36188, 61941, 78.965855 },
-    { 36188, 62956, 78.506935 },
-    { 36188, 63090, 81.716503 },
-    { 36188, 63125, 78.784952 },
-    { 36188, 63608, 82.353847 },
-    { 36188, 65378, 82.761500 },
-    { 36377, 36850, 75.200575 },
-    { 36377, 37279, 48.582944 },
-    { 36377, 37826, 71.423901 },
-    { 36377, 38170, 18.894715 },
-    { 36377, 39429, 7.210265 },
-    { 36377, 39757, 20.563010 },
-    { 36377, 39953, 8.143683 },
-    { 36377, 41037, 18.135744 },
-    { 36377, 42913, 16.733187 },
-    { 36377, 43109, 52.734548 },
-    { 36377, 43813, 52.969628 },
-    { 36377, 44816, 17.884123 },
-    { 36377, 45238, 29.532956 },
-    { 36377, 45556, 22.932041 },
-    { 36377, 45860, 81.775881 },
-    { 36377, 45941, 21.629399 },
-    { 36377, 46390, 43.207153 },
-    { 36377, 46701, 23.561983 },
-    { 36377, 47908, 74.059618 },
-    { 36377, 48002, 28.975008 },
-    { 36377, 49669, 66.117046 },
-    { 36377, 50099, 33.717479 },
-    { 36377, 50371, 30.529355 },
-    { 36377, 50583, 74.310981 },
-    { 36377, 51576, 32.341703 },
-    { 36377, 52419, 34.190766 },
-    { 36377, 52727, 33.996026 },
-    { 36377, 52943, 50.238989 },
-    { 36377, 54872, 82.038739 },
-    { 36377, 54879, 78.038949 },
-    { 36377, 56561, 39.821605 },
-    { 36377, 57632, 82.786254 },
-    { 36377, 59196, 46.359973 },
-    { 36377, 59316, 60.588475 },
-    { 36377, 59747, 45.068618 },
-    { 36377, 59803, 64.834144 },
-    { 36377, 60718, 45.533183 },
-    { 36377, 60965, 68.057267 },
-    { 36377, 61084, 47.547486 },
-    { 36377, 61359, 64.490812 },
-    { 36377, 61585, 45.635060 },
-    { 36377, 61932, 51.971425 },
-    { 36377, 61941, 80.371663 },
-    { 36377, 62322, 46.611615 },
-    { 36377, 62434, 48.833777 },
-    { 36377, 64962, 72.545035 },
-    { 36377, 65109, 64.408232 },
-    { 36377, 65474, 81.643156 },
-    { 36377, 66657, 57.930835 },
-    { 36377, 68002, 63.423211 },
-    { 36377, 68702, 57.174659 },
-    { 36377, 68895, 78.284356 },
-    { 36377, 68933, 71.859924 },
-    { 36377, 71352, 72.153049 },
-    { 36377, 71681, 60.550312 },
-    { 36377, 71683, 60.555364 },
-    { 36377, 71860, 69.447314 },
-    { 36377, 71908, 58.352635 },
-    { 36377, 73273, 74.503784 },
-    { 36377, 73334, 75.322969 },
-    { 36377, 74946, 58.865195 },
-    { 36377, 75141, 79.208648 },
-    { 36377, 75264, 76.317022 },
-    { 36377, 76297, 80.480047 },
-    { 36377, 77952, 65.173069 },
-    { 36377, 82273, 63.813967 },
-    { 36377, 83081, 75.744655 },
-    { 36377, 85258, 77.742789 },
-    { 36377, 85267, 76.964934 },
-    { 36377, 85792, 83.360359 },
-    { 36377, 100751, 79.262274 },
-    { 36377, 109268, 83.142782 },
-    { 36377, 110130, 70.818568 },
-    { 36377, 112122, 80.203630 },
-    { 36850, 37279, 26.683908 },
-    { 36850, 37826, 4.506365 },
-    { 36850, 38170, 56.856806 },
-    { 36850, 39429, 72.204673 },
-    { 36850, 39757, 56.741677 },
-    { 36850, 39953, 79.614089 },
-    { 36850, 41704, 30.246552 },
-    { 36850, 43109, 30.535521 },
-    { 36850, 43813, 32.081608 },
-    { 36850, 44127, 22.740202 },
-    { 36850, 44816, 78.293098 },
-    { 36850, 45860, 22.360894 },
-    { 36850, 46390, 48.706926 },
-    { 36850, 46853, 29.264092 },
-    { 36850, 47908, 30.001785 },
-    { 36850, 49669, 40.527071 },
-    { 36850, 50583, 38.837262 },
-    { 36850, 50801, 34.601181 },
-    { 36850, 52943, 67.031330 },
-    { 36850, 53910, 43.066603 },
-    { 36850, 54061, 44.667063 },
-    { 36850, 54539, 43.261675 },
-    { 36850, 54872, 50.005829 },
-    { 36850, 54879, 52.333974 },
-    { 36850, 57632, 60.126225 },
-    { 36850, 58001, 50.229624 },
-    { 36850, 59774, 53.153649 },
-    { 36850, 59803, 83.473615 },
-    { 36850, 61941, 79.575311 },
-    { 36850, 62956, 58.570329 },
-    { 36850, 63090, 79.932018 },
-    { 36850, 63125, 63.951996 },
-    { 36850, 63608, 77.410918 },
-    { 36850, 65378, 62.931222 },
-    { 36850, 67301, 68.325249 },
-    { 36850, 71075, 80.670321 },
-    { 36850, 72607, 64.365841 },
-    { 36850, 75097, 67.437595 },
-    { 36850, 75458, 75.524204 },
-    { 36850, 80331, 78.958477 },
-    { 36850, 83895, 78.425692 },
-    { 36850, 94376, 80.363340 },
-    { 36850, 105199, 83.248948 },
-    { 36850, 106032, 75.531069 },
-    { 36850, 116727, 64.636401 },
-    { 37279, 37826, 22.843506 },
-    { 37279, 38170, 30.185148 },
-    { 37279, 39429, 45.574703 },
-    { 37279, 39757, 30.322014 },
-    { 37279, 39953, 52.985772 },
-    { 37279, 41037, 65.302906 },
-    { 37279, 41704, 56.320521 },
-    { 37279, 42913, 61.464481 },
-    { 37279, 43109, 16.821381 },
-    { 37279, 43813, 18.943751 },
-    { 37279, 44127, 46.092552 },
-    { 37279, 44816, 52.623434 },
-    { 37279, 45238, 76.633566 },
-    { 37279, 45556, 67.365094 },
-    { 37279, 45860, 37.480899 },
-    { 37279, 45941, 63.902424 },
-    { 37279, 46390, 30.353126 },
-    { 37279, 46701, 66.290529 },
-    { 37279, 46853, 52.069544 },
-    { 37279, 47908, 35.645285 },
-    { 37279, 48002, 74.125846 },
-    { 37279, 49669, 37.421463 },
-    { 37279, 50099, 79.628120 },
-    { 37279, 50371, 73.202645 },
-    { 37279, 50583, 41.689765 },
-    { 37279, 50801, 51.291825 },
-    { 37279, 51576, 74.678779 },
-    { 37279, 52419, 77.450920 },
-    { 37279, 52727, 68.054970 },
-    { 37279, 52943, 51.705306 },
-    { 37279, 53910, 64.812308 },
-    { 37279, 54061, 67.901189 },
-    { 37279, 54539, 60.304624 },
-    { 37279, 54872, 54.262008 },
-    { 37279, 54879, 53.693985 },
-    { 37279, 56561, 81.332670 },
-    { 37279, 57632, 62.038993 },
-    { 37279, 58001, 70.408313 },
-    { 37279, 59196, 80.029259 },
-    { 37279, 59316, 71.717225 },
-    { 37279, 59747, 83.823210 },
-    { 37279, 59774, 74.312831 },
-    { 37279, 59803, 71.887132 },
-    { 37279, 60965, 74.990116 },
-    { 37279, 61359, 77.333629 },
-    { 37279, 61941, 75.791610 },
-    { 37279, 62956, 79.343371 },
-    { 37279, 63090, 78.824937 },
-    { 37279, 63125, 78.278345 },
-    { 37279, 63608, 79.920096 },
-    { 37279, 65378, 83.514460 },
-    { 37826, 38170, 52.894734 },
-    { 37826, 39429, 68.161990 },
-    { 37826, 39757, 52.603779 },
-    { 37826, 39953, 75.560301 },
-    { 37826, 41704, 33.559770 },
-    { 37826, 42913, 83.717057 },
-    { 37826, 43109, 26.053937 },
-    { 37826, 43813, 27.633072 },
-    { 37826, 44127, 24.606703 },
-    { 37826, 44816, 73.935030 },
-    { 37826, 45860, 21.377257 },
-    { 37826, 46390, 44.234842 },
-    { 37826, 46853, 31.037920 },
-    { 37826, 47908, 27.366346 },
-    { 37826, 49669, 37.046344 },
-    { 37826, 50583, 36.113828 },
-    { 37826, 50801, 34.582526 },
-    { 37826, 52943, 62.805032 },
-    { 37826, 53910, 44.676461 },
-    { 37826, 54061, 46.788954 },
-    { 37826, 54539, 43.544587 },
-    { 37826, 54872, 47.819001 },
-    { 37826, 54879, 49.744273 },
-    { 37826, 57632, 57.774481 },
-    { 37826, 58001, 51.463516 },
-    { 37826, 59316, 81.483708 },
-    { 37826, 59774, 54.701047 },
-    { 37826, 59803, 79.698497 },
-    { 37826, 60965, 81.948497 },
-    { 37826, 61941, 76.698424 },
-    { 37826, 62956, 60.063756 },
-    { 37826, 63090, 77.437868 },
-    { 37826, 63125, 63.950458 },
-    { 37826, 63608, 75.433225 },
-    { 37826, 65378, 64.415380 },
-    { 37826, 67301, 69.468184 },
-    { 37826, 67927, 83.448463 },
-    { 37826, 71075, 81.318936 },
-    { 37826, 72607, 67.406204 },
-    { 37826, 75097, 70.417114 },
-    { 37826, 75458, 77.819148 },
-    { 37826, 80331, 81.706337 },
-    { 37826, 83895, 81.564979 },
-    { 37826, 106032, 79.707590 },
-    { 37826, 116727, 68.887472 },
-    { 38170, 39429, 15.436862 },
-    { 38170, 39757, 4.185933 },
-    { 38170, 39953, 22.833220 },
-    { 38170, 41037, 35.133337 },
-    { 38170, 42913, 31.559589 },
-    { 38170, 43109, 34.265324 },
-    { 38170, 43813, 34.751046 },
-    { 38170, 44127, 74.574097 },
-    { 38170, 44816, 24.570586 },
-    { 38170, 45238, 46.526861 },
-    { 38170, 45556, 37.687252 },
-    { 38170, 45860, 63.125344 },
-    { 38170, 45941, 34.652576 },
-    { 38170, 46390, 28.472362 },
-    { 38170, 46701, 37.022358 },
-    { 38170, 46853, 79.845256 },
-    { 38170, 47908, 56.235824 },
-    { 38170, 48002, 44.419320 },
-    { 38170, 49669, 50.061659 },
-    { 38170, 50099, 49.804904 },
-    { 38170, 50371, 44.214551 },
-    { 38170, 50583, 57.799843 },
-    { 38170, 50801, 75.223753 },
-    { 38170, 51576, 45.856401 },
-    { 38170, 52419, 48.398337 },
-    { 38170, 52727, 42.164280 },
-    { 38170, 52943, 42.904557 },
-    { 38170, 54539, 83.076622 },
-    { 38170, 54872, 67.354654 },
-    { 38170, 54879, 64.166019 },
-    { 38170, 56561, 53.050239 },
-    { 38170, 57632, 70.484365 },
-    { 38170, 59196, 55.228347 },
-    { 38170, 59316, 59.142945 },
-    { 38170, 59747, 56.812693 },
-    { 38170, 59803, 61.971715 },
-    { 38170, 60718, 58.678310 },
-    { 38170, 60965, 65.481296 },
-    { 38170, 61084, 58.818870 },
-    { 38170, 61359, 64.259725 },
-    { 38170, 61585, 60.472618 },
-    { 38170, 61932, 60.613110 },
-    { 38170, 61941, 74.072536 },
-    { 38170, 62322, 61.188296 },
-    { 38170, 62434, 61.021444 },
-    { 38170, 63090, 79.320138 },
-    { 38170, 64962, 73.999531 },
-    { 38170, 65109, 69.992735 },
-    { 38170, 65474, 79.932067 },
-    { 38170, 66657, 68.902477 },
-    { 38170, 68002, 73.014654 },
-    { 38170, 68702, 70.304638 },
-    { 38170, 68895, 82.621515 },
-    { 38170, 68933, 78.820120 },
-    { 38170, 71352, 81.520770 },
-    { 38170, 71681, 74.291397 },
-    { 38170, 71683, 74.295909 },
-    { 38170, 71860, 80.238291 },
-    { 38170, 71908, 72.985976 },
-    { 38170, 74946, 74.580080 },
-    { 38170, 77952, 80.551153 },
-    { 38170, 82273, 80.587216 },
-    { 39429, 39757, 15.720809 },
-    { 39429, 39953, 7.411484 },
-    { 39429, 41037, 19.732457 },
-    { 39429, 42913, 16.231480 },
-    { 39429, 43109, 47.478909 },
-    { 39429, 43813, 47.474641 },
-    { 39429, 44816, 12.476632 },
-    { 39429, 45238, 31.090764 },
-    { 39429, 45556, 22.481287 },
-    { 39429, 45860, 76.513338 },
-    { 39429, 45941, 19.888304 },
-    { 39429, 46390, 36.509970 },
-    { 39429, 46701, 22.174172 },
-    { 39429, 47908, 68.085775 },
-    { 39429, 48002, 29.141282 },
-    { 39429, 49669, 59.489142 },
-    { 39429, 50099, 34.444680 },
-    { 39429, 50371, 29.435893 },
-    { 39429, 50583, 67.760517 },
-    { 39429, 51576, 31.166646 },
-    { 39429, 52419, 33.500864 },
-    { 39429, 52727, 30.064923 },
-    { 39429, 52943, 43.101855 },
-    { 39429, 54872, 75.044070 },
-    { 39429, 54879, 70.957742 },
-    { 39429, 56561, 38.576810 },
-    { 39429, 57632, 75.590437 },
-    { 39429, 59196, 43.006400 },
-    { 39429, 59316, 54.326468 },
-    { 39429, 59747, 43.059199 },
-    { 39429, 59803, 58.351529 },
-    { 39429, 60718, 44.307885 },
-    { 39429, 60965, 61.656829 },
-    { 39429, 61084, 45.329536 },
-    { 39429, 61359, 58.531907 },
-    { 39429, 61585, 45.483979 },
-    { 39429, 61932, 48.614310 },
-    { 39429, 61941, 73.490163 },
-    { 39429, 62322, 46.291052 },
-    { 39429, 62434, 47.109518 },
-    { 39429, 63090, 79.315929 },
-    { 39429, 64962, 67.088131 },
-    { 39429, 65109, 60.080984 },
-    { 39429, 65474, 75.538198 },
-    { 39429, 66657, 55.696006 },
-    { 39429, 68002, 60.622011 },
-    { 39429, 68702, 56.055335 },
-    { 39429, 68895, 73.719879 },
-    { 39429, 68933, 68.109705 },
-    { 39429, 71352, 69.352869 },
-    { 39429, 71681, 59.811095 },
-    { 39429, 71683, 59.815866 },
-    { 39429, 71860, 67.248810 },
-    { 39429, 71908, 58.149297 },
-    { 39429, 73273, 72.135753 },
-    { 39429, 73334, 72.870469 },
-    { 39429, 74946, 59.407049 },
-    { 39429, 75141, 76.982895 },
-    { 39429, 75264, 74.464114 },
-    { 39429, 76297, 78.529875 },
-    { 39429, 77952, 65.502030 },
-    { 39429, 82273, 65.203201 },
-    { 39429, 83081, 76.317824 },
-    { 39429, 85258, 78.710142 },
-    { 39429, 85267, 77.981535 },
-    { 39429, 100751, 83.149677 },
-    { 39429, 110130, 75.987879 },
-    { 39757, 39953, 23.035576 },
-    { 39757, 41037, 35.302981 },
-    { 39757, 42913, 31.177039 },
-    { 39757, 43109, 32.177008 },
-    { 39757, 43813, 32.418947 },
-    { 39757, 44127, 73.271589 },
-    { 39757, 44816, 22.794810 },
-    { 39757, 45238, 46.439963 },
-    { 39757, 45556, 37.044300 },
-    { 39757, 45860, 61.235739 },
-    { 39757, 45941, 33.656278 },
-    { 39757, 46390, 24.693666 },
-    { 39757, 46701, 36.046497 },
-    { 39757, 46853, 78.258713 },
-    { 39757, 47908, 53.661808 },
-    { 39757, 48002, 43.805962 },
-    { 39757, 49669, 46.752102 },
-    { 39757, 50099, 49.306656 },
-    { 39757, 50371, 43.084762 },
-    { 39757, 50583, 54.662209 },
-    { 39757, 50801, 72.831612 },
-    { 39757, 51576, 44.640711 },
-    { 39757, 52419, 47.320809 },
-    { 39757, 52727, 39.821846 },
-    { 39757, 52943, 38.729572 },
-    { 39757, 54539, 80.391795 },
-    { 39757, 54872, 63.787303 },
-    { 39757, 54879, 60.442725 },
-    { 39757, 56561, 51.609952 },
-    { 39757, 57632, 66.573803 },
-    { 39757, 59196, 52.748775 },
-    { 39757, 59316, 55.200584 },
-    { 39757, 59747, 54.931019 },
-    { 39757, 59803, 57.917529 },
-    { 39757, 60718, 57.121805 },
-    { 39757, 60965, 61.429952 },
-    { 39757, 61084, 56.793895 },
-    { 39757, 61359, 60.386605 },
-    { 39757, 61585, 59.383915 },
-    { 39757, 61932, 58.007312 },
-    { 39757, 61941, 69.886964 },
-    { 39757, 62322, 60.007512 },
-    { 39757, 62434, 59.182586 },
-    { 39757, 63090, 75.137282 },
-    { 39757, 63608, 80.008510 },
-    { 39757, 64962, 70.221648 },
-    { 39757, 65109, 66.755922 },
-    { 39757, 65474, 75.879473 },
-    { 39757, 66249, 82.272888 },
-    { 39757, 66657, 66.670128 },
-    { 39757, 68002, 70.440335 },
-    { 39757, 68702, 68.586903 },
-    { 39757, 68895, 79.106240 },
-    { 39757, 68933, 75.711583 },
-    { 39757, 71352, 78.812518 },
-    { 39757, 71681, 72.698319 },
-    { 39757, 71683, 72.702624 },
-    { 39757, 71860, 77.837616 },
-    { 39757, 71908, 71.678220 },
-    { 39757, 73273, 82.261246 },
-    { 39757, 73334, 82.821759 },
-    { 39757, 74946, 73.626852 },
-    { 39757, 77952, 79.415963 },
-    { 39757, 82273, 80.012921 },
-    { 39953, 41037, 12.321880 },
-    { 39953, 42913, 9.201224 },
-    { 39953, 43109, 54.383384 },
-    { 39953, 43813, 54.237683 },
-    { 39953, 44816, 10.961898 },
-    { 39953, 45238, 23.699594 },
-    { 39953, 45556, 15.541800 },
-    { 39953, 45860, 83.290252 },
-    { 39953, 45941, 13.658996 },
-    { 39953, 46390, 42.081753 },
-    { 39953, 46701, 15.733806 },
-    { 39953, 47908, 74.349521 },
-    { 39953, 48002, 22.031553 },
-    { 39953, 49669, 64.954760 },
-    { 39953, 50099, 27.205019 },
-    { 39953, 50371, 22.890444 },
-    { 39953, 50583, 73.299019 },
-    { 39953, 51576, 24.680053 },
-    { 39953, 52419, 26.773209 },
-    { 39953, 52727, 25.895238 },
-    { 39953, 52943, 45.294834 },
-    { 39953, 54872, 79.518217 },
-    { 39953, 54879, 75.125834 },
-    { 39953, 56561, 32.172504 },
-    { 39953, 57632, 78.913909 },
-    { 39953, 59196, 38.220197 },
-    { 39953, 59316, 53.544169 },
-    { 39953, 59747, 37.162067 },
-    { 39953, 59803, 58.042974 },
-    { 39953, 60718, 37.916647 },
-    { 39953, 60965, 61.133767 },
-    { 39953, 61084, 39.589074 },
-    { 39953, 61359, 57.121525 },
-    { 39953, 61585, 38.576737 },
-    { 39953, 61932, 43.834400 },
-    { 39953, 61941, 74.215508 },
-    { 39953, 62322, 39.456891 },
-    { 39953, 62434, 41.032345 },
-    { 39953, 63090, 80.161890 },
-    { 39953, 64962, 64.797635 },
-    { 39953, 65109, 56.310106 },
-    { 39953, 65474, 74.325544 },
-    { 39953, 66249, 83.669819 },
-    { 39953, 66657, 49.991975 },
-    { 39953, 68002, 55.363868 },
-    { 39953, 68702, 49.642595 },
-    { 39953, 68895, 70.211314 },
-    { 39953, 68933, 63.716252 },
-    { 39953, 71352, 64.104515 },
-    { 39953, 71681, 53.210973 },
-    { 39953, 71683, 53.215894 },
-    { 39953, 71860, 61.540158 },
-    { 39953, 71908, 51.302864 },
-    { 39953, 73273, 66.557487 },
-    { 39953, 73334, 67.355907 },
-    { 39953, 73714, 80.235662 },
-    { 39953, 74946, 52.297240 },
-    { 39953, 75141, 71.309381 },
-    { 39953, 75264, 68.532787 },
-    { 39953, 76297, 72.669690 },
-    { 39953, 77952, 58.473869 },
-    { 39953, 82273, 57.898175 },
-    { 39953, 82514, 83.914827 },
-    { 39953, 83081, 69.231887 },
-    { 39953, 84143, 81.334186 },
-    { 39953, 85258, 71.517349 },
-    { 39953, 85267, 70.775293 },
-    { 39953, 85792, 77.002080 },
-    { 39953, 86228, 83.615852 },
-    { 39953, 100751, 75.874244 },
-    { 39953, 109268, 82.207245 },
-    { 39953, 110130, 69.258906 },
-    { 39953, 112122, 80.025468 },
-    { 41037, 42913, 5.663506 },
-    { 41037, 43109, 66.105472 },
-    { 41037, 43813, 65.781225 },
-    { 41037, 44816, 17.511041 },
-    { 41037, 45238, 11.510975 },
-    { 41037, 45556, 6.938666 },
-    { 41037, 45941, 9.200038 },
-    { 41037, 46390, 52.319556 },
-    { 41037, 46701, 9.336531 },
-    { 41037, 48002, 11.219319 },
-    { 41037, 49669, 74.593003 },
-    { 41037, 50099, 15.599930 },
-    { 41037, 50371, 14.138613 },
-    { 41037, 50583, 82.907755 },
-    { 41037, 51576, 15.874154 },
-    { 41037, 52419, 16.968042 },
-    { 41037, 52727, 22.885553 },
-    { 41037, 52943, 50.905047 },
-    { 41037, 54879, 82.597230 },
-    { 41037, 56561, 22.925757 },
-    { 41037, 59196, 32.379759 },
-    { 41037, 59316, 54.042614 },
-    { 41037, 59747, 28.889120 },
-    { 41037, 59803, 59.084094 },
-    { 41037, 60718, 28.394824 },
-    { 41037, 60965, 61.669859 },
-    { 41037, 61084, 31.540863 },
-    { 41037, 61359, 56.370261 },
-    { 41037, 61585, 27.703204 },
-    { 41037, 61932, 37.622396 },
-    { 41037, 61941, 76.239567 },
-    { 41037, 62322, 28.753291 },
-    { 41037, 62434, 32.130641 },
-    { 41037, 63090, 82.158845 },
-    { 41037, 64962, 62.170022 },
-    { 41037, 65109, 51.414694 },
-    { 41037, 65474, 73.141271 },
-    { 41037, 66249, 83.450753 },
-    { 41037, 66657, 41.561053 },
-    { 41037, 68002, 47.656009 },
-    { 41037, 68702, 39.692069 },
-    { 41037, 68895, 65.237967 },
-    { 41037, 68933, 57.372979 },
-    { 41037, 71352, 56.148164 },
-    { 41037, 71681, 42.775240 },
-    { 41037, 71683, 42.780405 },
-    { 41037, 71860, 52.762685 },
-    { 41037, 71908, 40.349267 },
-    { 41037, 72622, 79.751213 },
-    { 41037, 73273, 57.913072 },
-    { 41037, 73334, 58.813705 },
-    { 41037, 73714, 73.424568 },
-    { 41037, 74946, 40.729481 },
-    { 41037, 75141, 62.384364 },
-    { 41037, 75264, 59.176313 },
-    { 41037, 76297, 63.371868 },
-    { 41037, 77952, 47.042897 },
-    { 41037, 78265, 78.850530 },
-    { 41037, 78401, 82.093091 },
-    { 41037, 80112, 81.620699 },
-    { 41037, 80763, 81.681772 },
-    { 41037, 81266, 80.696072 },
-    { 41037, 82273, 45.852399 },
-    { 41037, 82396, 76.483184 },
-    { 41037, 82514, 73.218033 },
-    { 41037, 83081, 57.615172 },
-    { 41037, 84143, 70.061617 },
-    { 41037, 85258, 59.675346 },
-    { 41037, 85267, 58.908273 },
-    { 41037, 85696, 76.901089 },
-    { 41037, 85792, 65.261404 },
-    { 41037, 85927, 77.280310 },
-    { 41037, 86228, 72.009107 },
-    { 41037, 86670, 76.070133 },
-    { 41037, 87073, 75.361505 },
-    { 41037, 87261, 78.422650 },
-    { 41037, 89642, 80.322629 },
-    { 41037, 90185, 82.963410 },
-    { 41037, 100751, 63.753920 },
-    { 41037, 101772, 73.154387 },
-    { 41037, 108085, 81.294922 },
-    { 41037, 109268, 71.354663 },
-    { 41037, 110130, 58.125691 },
-    { 41037, 112122, 69.812700 },
-    { 41704, 43109, 54.388419 },
-    { 41704, 43813, 54.977524 },
-    { 41704, 44127, 13.339166 },
-    { 41704, 45860, 27.573789 },
-    { 41704, 46390, 70.295392 },
-    { 41704, 46853, 12.489854 },
-    { 41704, 47908, 39.185948 },
-    { 41704, 49669, 51.964051 },
-    { 41704, 50583, 45.217744 },
-    { 41704, 50801, 25.665025 },
-    { 41704, 52943, 81.821995 },
-    { 41704, 53910, 19.941130 },
-    { 41704, 54061, 18.222424 },
-    { 41704, 54539, 28.457857 },
-    { 41704, 54872, 49.329163 },
-    { 41704, 54879, 53.990235 },
-    { 41704, 57632, 58.289501 },
-    { 41704, 58001, 27.677006 },
-    { 41704, 59774, 28.418531 },
-    { 41704, 61941, 78.401448 },
-    { 41704, 62956, 33.447893 },
-    { 41704, 63090, 75.660611 },
-    { 41704, 63125, 46.037741 },
-    { 41704, 63608, 69.765239 },
-    { 41704, 65378, 37.433141 },
-    { 41704, 66249, 83.779321 },
-    { 41704, 67301, 43.904627 },
-    { 41704, 67927, 69.692275 },
-    { 41704, 69673, 71.575192 },
-    { 41704, 71075, 57.476371 },
-    { 41704, 72105, 68.343868 },
-    { 41704, 72607, 34.188468 },
-    { 41704, 75097, 37.302424 },
-    { 41704, 75458, 46.543417 },
-    { 41704, 76267, 74.281057 },
-    { 41704, 80331, 49.037284 },
-    { 41704, 81693, 76.604776 },
-    { 41704, 83895, 48.184239 },
-    { 41704, 84380, 74.651862 },
-    { 41704, 85670, 61.412682 },
-    { 41704, 87833, 63.647925 },
-    { 41704, 91262, 77.833969 },
-    { 41704, 94376, 50.842342 },
-    { 41704, 97165, 73.750438 },
-    { 41704, 100453, 79.011487 },
-    { 41704, 102098, 73.976898 },
-    { 41704, 105199, 56.353736 },
-    { 41704, 106032, 48.318996 },
-    { 41704, 109492, 59.468644 },
-    { 41704, 116727, 38.656959 },
-    { 42913, 43109, 61.129013 },
-    { 42913, 43813, 60.695179 },
-    { 42913, 44816, 11.893646 },
-    { 42913, 45238, 15.347355 },
-    { 42913, 45556, 6.340622 },
-    { 42913, 45941, 5.387638 },
-    { 42913, 46390, 46.838110 },
-    { 42913, 46701, 6.916640 },
-    { 42913, 47908, 79.574675 },
-    { 42913, 48002, 12.911421 },
-    { 42913, 49669, 68.980529 },
-    { 42913, 50099, 18.245345 },
-    { 42913, 50371, 13.805235 },
-    { 42913, 50583, 77.284340 },
-    { 42913, 51576, 15.614287 },
-    { 42913, 52419, 17.590880 },
-    { 42913, 52727, 19.319892 },
-    { 42913, 52943, 45.407945 },
-    { 42913, 54872, 81.723968 },
-    { 42913, 54879, 76.976554 },
-    { 42913, 56561, 23.103154 },
-    { 42913, 57632, 79.489246 },
-    { 42913, 59196, 30.409380 },
-    { 42913, 59316, 49.686734 },
-    { 42913, 59747, 28.382743 },
-    { 42913, 59803, 54.602107 },
-    { 42913, 60718, 28.829938 },
-    { 42913, 60965, 57.355196 },
-    { 42913, 61084, 30.903618 },
-    { 42913, 61359, 52.437397 },
-    { 42913, 61585, 29.381436 },
-    { 42913, 61932, 35.918887 },
-    { 42913, 61941, 71.577339 },
-    { 42913, 62322, 30.255790 },
-    { 42913, 62434, 32.102859 },
-    { 42913, 63090, 77.531374 },
-    { 42913, 64962, 58.978397 },
-    { 42913, 65109, 49.148420 },
-    { 42913, 65474, 69.468791 },
-    { 42913, 66249, 79.500541 },
-    { 42913, 66657, 41.252091 },
-    { 42913, 68002, 46.908737 },
-    { 42913, 68702, 40.519421 },
-    { 42913, 68895, 63.098779 },
-    { 42913, 68933, 55.887926 },
-    { 42913, 71352, 55.597158 },
-    { 42913, 71681, 44.030281 },
-    { 42913, 71683, 44.035231 },
-    { 42913, 71860, 52.739525 },
-    { 42913, 71908, 42.103551 },
-    { 42913, 72622, 77.843067 },
-    { 42913, 73273, 57.816566 },
-    { 42913, 73334, 58.651733 },
-    { 42913, 73714, 72.272406 },
-    { 42913, 74946, 43.186871 },
-    { 42913, 75141, 62.493147 },
-    { 42913, 75264, 59.584243 },
-    { 42913, 76297, 63.746927 },
-    { 42913, 77952, 49.319889 },
-    { 42913, 78265, 78.793577 },
-    { 42913, 78401, 81.885737 },
-    { 42913, 80112, 81.972588 },
-    { 42913, 80763, 82.234803 },
-    { 42913, 81266, 81.458943 },
-    { 42913, 82273, 49.028668 },
-    { 42913, 82396, 77.793839 },
-    { 42913, 82514, 74.730717 },
-    { 42913, 83081, 60.109717 },
-    { 42913, 84143, 72.142170 },
-    { 42913, 85258, 62.478676 },
-    { 42913, 85267, 61.750775 },
-    { 42913, 85696, 79.050536 },
-    { 42913, 85792, 67.911476 },
-    { 42913, 85927, 79.471198 },
-    { 42913, 86228, 74.476266 },
-    { 42913, 86670, 78.478601 },
-    { 42913, 87073, 77.890631 },
-    { 42913, 87261, 80.886773 },
-    { 42913, 89642, 83.238915 },
-    { 42913, 100751, 68.489145 },
-    { 42913, 101772, 77.988641 },
-    { 42913, 109268, 76.811237 },
-    { 42913, 110130, 63.526509 },
-    { 42913, 112122, 75.396968 },
-    { 43109, 43813, 2.193481 },
-    { 43109, 44127, 41.707730 },
-    { 43109, 44816, 50.082807 },
-    { 43109, 45238, 76.271338 },
-    { 43109, 45556, 65.972655 },
-    { 43109, 45860, 29.072244 },
-    { 43109, 45941, 61.869695 },
-    { 43109, 46390, 18.187446 },
-    { 43109, 46701, 64.100681 },
-    { 43109, 46853, 46.253125 },
-    { 43109, 47908, 22.417539 },
-    { 43109, 48002, 72.360361 },
-    { 43109, 49669, 20.876715 },
-    { 43109, 50099, 77.874854 },
-    { 43109, 50371, 69.995338 },
-    { 43109, 50583, 26.302789 },
-    { 43109, 50801, 41.010489 },
-    { 43109, 51576, 71.089819 },
-    { 43109, 52419, 74.059652 },
-    { 43109, 52727, 61.645403 },
-    { 43109, 52943, 37.881653 },
-    { 43109, 53910, 56.600637 },
-    { 43109, 54061, 60.836051 },
-    { 43109, 54539, 49.171071 },
-    { 43109, 54872, 38.363863 },
-    { 43109, 54879, 37.239132 },
-    { 43109, 56561, 76.462424 },
-    { 43109, 57632, 45.462405 },
-    { 43109, 58001, 60.452655 },
-    { 43109, 59196, 71.668902 },
-    { 43109, 59316, 57.568100 },
-    { 43109, 59747, 77.222383 },
-    { 43109, 59774, 64.816997 },
-    { 43109, 59803, 56.886991 },
-    { 43109, 60718, 80.881624 },
-    { 43109, 60965, 59.727194 },
-    { 43109, 61084, 78.047847 },
-    { 43109, 61359, 63.023057 },
-    { 43109, 61932, 75.238979 },
-    { 43109, 61941, 59.140246 },
-    { 43109, 62434, 81.230443 },
-    { 43109, 62956, 69.182238 },
-    { 43109, 63090, 62.020434 },
-    { 43109, 63125, 64.432389 },
-    { 43109, 63608, 63.178077 },
-    { 43109, 64962, 72.679986 },
-    { 43109, 65109, 76.955813 },
-    { 43109, 65378, 72.934267 },
-    { 43109, 65474, 71.450059 },
-    { 43109, 66249, 72.167427 },
-    { 43109, 67301, 75.501394 },
-    { 43109, 67927, 75.654425 },
-    { 43109, 68895, 83.942129 },
-    { 43109, 69673, 80.576520 },
-    { 43109, 71075, 83.149677 },
-    { 43813, 44127, 42.104713 },
-    { 43813, 44816, 49.460499 },
-    { 43813, 45238, 75.724522 },
-    { 43813, 45556, 65.364290 },
-    { 43813, 45860, 29.059235 },
-    { 43813, 45941, 61.209645 },
-    { 43813, 46390, 16.663388 },
-    { 43813, 46701, 63.403592 },
-    { 43813, 46853, 46.387746 },
-    { 43813, 47908, 21.564327 },
-    { 43813, 48002, 71.660059 },
-    { 43813, 49669, 18.991567 },
-    { 43813, 50099, 77.140837 },
-    { 43813, 50371, 69.128545 },
-    { 43813, 50583, 24.804010 },
-    { 43813, 50801, 40.481594 },
-    { 43813, 51576, 70.168395 },
-    { 43813, 52419, 73.144492 },
-    { 43813, 52727, 60.433670 },
-    { 43813, 52943, 35.897883 },
-    { 43813, 53910, 56.273964 },
-    { 43813, 54061, 60.652563 },
-    { 43813, 54539, 48.415483 },
-    { 43813, 54872, 36.646211 },
-    { 43813, 54879, 35.343538 },
-    { 43813, 56561, 75.352523 },
-    { 43813, 57632, 43.507970 },
-    { 43813, 58001, 59.819438 },
-    { 43813, 59196, 70.173175 },
-    { 43813, 59316, 55.505676 },
-    { 43813, 59747, 75.903637 },
-    { 43813, 59774, 64.230629 },
-    { 43813, 59803, 54.755410 },
-    { 43813, 60718, 79.647822 },
-    { 43813, 60965, 57.575237 },
-    { 43813, 61084, 76.649986 },
-    { 43813, 61359, 60.939415 },
-    { 43813, 61932, 73.619191 },
-    { 43813, 61941, 56.962500 },
-    { 43813, 62434, 79.864343 },
-    { 43813, 62956, 68.463925 },
-    { 43813, 63090, 59.882525 },
-    { 43813, 63125, 63.094074 },
-    { 43813, 63608, 61.138868 },
-    { 43813, 64962, 70.556162 },
-    { 43813, 65109, 75.016165 },
-    { 43813, 65378, 72.128647 },
-    { 43813, 65474, 69.257592 },
-    { 43813, 66249, 70.005325 },
-    { 43813, 66657, 83.780842 },
-    { 43813, 67301, 74.471113 },
-    { 43813, 67927, 73.752778 },
-    { 43813, 68895, 81.828287 },
-    { 43813, 68933, 83.828570 },
-    { 43813, 69673, 78.694407 },
-    { 43813, 71075, 81.751179 },
-    { 43813, 72607, 83.961195 },
-    { 44127, 45860, 14.245053 },
-    { 44127, 46390, 57.047137 },
-    { 44127, 46853, 6.524137 },
-    { 44127, 47908, 25.972059 },
-    { 44127, 49669, 38.859190 },
-    { 44127, 50583, 32.577853 },
-    { 44127, 50801, 16.071631 },
-    { 44127, 52943, 68.802644 },
-    { 44127, 53910, 20.332602 },
-    { 44127, 54061, 22.188464 },
-    { 44127, 54539, 22.646137 },
-    { 44127, 54872, 38.601736 },
-    { 44127, 54879, 42.804440 },
-    { 44127, 57632, 48.359204 },
-    { 44127, 58001, 27.663124 },
-    { 44127, 59316, 82.581552 },
-    { 44127, 59774, 30.420595 },
-    { 44127, 59803, 78.881044 },
-    { 44127, 60965, 79.783200 },
-    { 44127, 61941, 68.981630 },
-    { 44127, 62956, 35.842765 },
-    { 44127, 63090, 67.242807 },
-    { 44127, 63125, 43.143823 },
-    { 44127, 63608, 62.471888 },
-    { 44127, 65378, 40.201741 },
-    { 44127, 65474, 83.242871 },
-    { 44127, 66249, 76.510873 },
-    { 44127, 67301, 45.734370 },
-    { 44127, 67927, 65.733343 },
-    { 44127, 69673, 68.675690 },
-    { 44127, 71075, 58.470194 },
-    { 44127, 72105, 67.951397 },
-    { 44127, 72607, 43.766903 },
-    { 44127, 75097, 46.604181 },
-    { 44127, 75458, 53.230207 },
-    { 44127, 76267, 75.981377 },
-    { 44127, 80331, 57.430261 },
-    { 44127, 81693, 81.700069 },
-    { 44127, 83895, 57.959296 },
-    { 44127, 84380, 81.573268 },
-    { 44127, 85670, 70.257946 },
-    { 44127, 87833, 73.088938 },
-    { 44127, 94376, 62.564896 },
-    { 44127, 105199, 69.304964 },
-    { 44127, 106032, 61.277201 },
-    { 44127, 109492, 72.734846 },
-    { 44127, 116727, 51.921907 },
-    { 44816, 45238, 26.293255 },
-    { 44816, 45556, 15.903819 },
-    { 44816, 45860, 77.882169 },
-    { 44816, 45941, 11.801410 },
-    { 44816, 46390, 35.036418 },
-    { 44816, 46701, 14.087223 },
-    { 44816, 47908, 67.767893 },
-    { 44816, 48002, 22.319838 },
-    { 44816, 49669, 57.088989 },
-    { 44816, 50099, 27.873406 },
-    { 44816, 50371, 20.628080 },
-    { 44816, 50583, 65.398180 },
-    { 44816, 51576, 22.059948 },
-    { 44816, 52419, 24.870313 },
-    { 44816, 52727, 17.945724 },
-    { 44816, 52943, 34.748484 },
-    { 44816, 54872, 70.204648 },
-    { 44816, 54879, 65.571861 },
-    { 44816, 56561, 28.839222 },
-    { 44816, 57632, 68.696705 },
-    { 44816, 59196, 31.046384 },
-    { 44816, 59316, 42.778134 },
-    { 44816, 59747, 32.252972 },
-    { 44816, 59803, 47.167537 },
-    { 44816, 60718, 34.327035 },
-    { 44816, 60965, 50.313076 },
-    { 44816, 61084, 34.251163 },
-    { 44816, 61359, 46.606697 },
-    { 44816, 61585, 36.813322 },
-    { 44816, 61932, 36.586622 },
-    { 44816, 61941, 63.253614 },
-    { 44816, 62322, 37.355791 },
-    { 44816, 62434, 36.477176 },
-    { 44816, 63090, 69.200582 },
-    { 44816, 63608, 76.035253 },
-    { 44816, 64962, 54.802715 },
-    { 44816, 65109, 47.631016 },
-    { 44816, 65474, 63.765378 },
-    { 44816, 66249, 72.862508 },
-    { 44816, 66657, 44.394348 },
-    { 44816, 68002, 48.829260 },
-    { 44816, 68702, 45.826867 },
-    { 44816, 68895, 61.243369 },
-    { 44816, 68933, 55.789537 },
-    { 44816, 71352, 57.487119 },
-    { 44816, 71681, 49.908621 },
-    { 44816, 71683, 49.912956 },
-    { 44816, 71860, 55.821746 },
-    { 44816, 71908, 48.924921 },
-    { 44816, 72622, 75.992082 },
-    { 44816, 73273, 60.532830 },
-    { 44816, 73334, 61.202222 },
-    { 44816, 73714, 72.250392 },
-    { 44816, 74946, 51.106176 },
-    { 44816, 75141, 65.436511 },
-    { 44816, 75264, 63.228202 },
-    { 44816, 76297, 67.172867 },
-    { 44816, 77952, 56.733336 },
-    { 44816, 78265, 80.845128 },
-    { 44816, 78401, 83.529360 },
-    { 44816, 82273, 57.898163 },
-    { 44816, 82396, 82.608206 },
-    { 44816, 82514, 80.019939 },
-    { 44816, 83081, 67.581842 },
-    { 44816, 84143, 78.569299 },
-    { 44816, 85258, 70.425898 },
-    { 44816, 85267, 69.781224 },
-    { 44816, 85792, 75.470464 },
-    { 44816, 86228, 81.559641 },
-    { 44816, 100751, 79.437535 },
-    { 44816, 110130, 75.308300 },
-    { 45238, 45556, 10.450258 },
-    { 45238, 45941, 14.740636 },
-    { 45238, 46390, 61.102953 },
-    { 45238, 46701, 12.834247 },
-    { 45238, 48002, 5.662901 },
-    { 45238, 49669, 82.250479 },
-    { 45238, 50099, 5.202679 },
-    { 45238, 50371, 10.613444 },
-    { 45238, 51576, 11.315545 },
-    { 45238, 52419, 10.151409 },
-    { 45238, 52727, 23.165466 },
-    { 45238, 52943, 55.565315 },
-    { 45238, 56561, 15.482757 },
-    { 45238, 59196, 27.808111 },
-    { 45238, 59316, 53.839578 },
-    { 45238, 59747, 21.878485 },
-    { 45238, 59803, 59.085063 },
-    { 45238, 60718, 19.825428 },
-    { 45238, 60965, 61.055889 },
-    { 45238, 61084, 24.503121 },
-    { 45238, 61359, 54.850482 },
-    { 45238, 61585, 17.409341 },
-    { 45238, 61932, 32.073981 },
-    { 45238, 61941, 76.318377 },
-    { 45238, 62322, 18.620565 },
-    { 45238, 62434, 24.004237 },
-    { 45238, 63090, 81.957564 },
-    { 45238, 64962, 58.567420 },
-    { 45238, 65109, 46.224460 },
-    { 45238, 65474, 70.367768 },
-    { 45238, 66249, 81.129575 },
-    { 45238, 66657, 33.341858 },
-    { 45238, 68002, 39.880795 },
-    { 45238, 68702, 29.951116 },
-    { 45238, 68895, 59.319904 },
-    { 45238, 68933, 50.499164 },
-    { 45238, 71352, 47.806655 },
-    { 45238, 71681, 32.461999 },
-    { 45238, 71683, 32.467281 },
-    { 45238, 71860, 43.759394 },
-    { 45238, 71908, 29.597616 },
-    { 45238, 72622, 73.046132 },
-    { 45238, 73273, 48.890890 },
-    { 45238, 73334, 49.860159 },
-    { 45238, 73714, 65.601635 },
-    { 45238, 74785, 81.532644 },
-    { 45238, 74946, 29.464477 },
-    { 45238, 75141, 53.012524 },
-    { 45238, 75264, 49.498280 },
-    { 45238, 76297, 53.665621 },
-    { 45238, 77952, 35.834495 },
-    { 45238, 78265, 69.434397 },
-    { 45238, 78401, 72.815155 },
-    { 45238, 78820, 75.869727 },
-    { 45238, 80112, 71.711593 },
-    { 45238, 80763, 71.565968 },
-    { 45238, 81266, 70.387321 },
-    { 45238, 82273, 34.344753 },
-    { 45238, 82396, 65.738876 },
-    { 45238, 82514, 62.343513 },
-    { 45238, 83081, 46.253508 },
-    { 45238, 84143, 58.848921 },
-    { 45238, 84970, 76.762717 },
-    { 45238, 85258, 48.211896 },
-    { 45238, 85267, 47.437122 },
-    { 45238, 85696, 65.631772 },
-    { 45238, 85792, 53.829241 },
-    { 45238, 85927, 65.991053 },
-    { 45238, 86228, 60.622642 },
-    { 45238, 86670, 64.696146 },
-    { 45238, 87073, 63.948572 },
-    { 45238, 87261, 67.025095 },
-    { 45238, 88635, 74.302798 },
-    { 45238, 89642, 68.823284 },
-    { 45238, 89931, 75.711277 },
-    { 45238, 90185, 71.458596 },
-    { 45238, 90496, 80.359094 },
-    { 45238, 92041, 79.708998 },
-    { 45238, 92855, 80.828920 },
-    { 45238, 93506, 77.630410 },
-    { 45238, 93864, 79.979507 },
-    { 45238, 100751, 53.256549 },
-    { 45238, 101772, 62.808280 },
-    { 45238, 108085, 72.657499 },
-    { 45238, 109268, 62.885888 },
-    { 45238, 110130, 49.502680 },
-    { 45238, 112122, 62.250078 },
-    { 45238, 113368, 78.870065 },
-    { 45556, 45941, 4.318447 },
-    { 45556, 46390, 50.655833 },
-    { 45556, 46701, 2.914058 },
-    { 45556, 47908, 83.261724 },
-    { 45556, 48002, 6.762536 },
-    { 45556, 49669, 71.994819 },
-    { 45556, 50099, 12.283174 },
-    { 45556, 50371, 7.690268 },
-    { 45556, 50583, 80.164064 },
-    { 45556, 51576, 9.502926 },
-    { 45556, 52419, 11.276709 },
-    { 45556, 52727, 16.235014 },
-    { 45556, 52943, 46.295737 },
-    { 45556, 54872, 83.334568 },
-    { 45556, 54879, 78.414208 },
-    { 45556, 56561, 16.922023 },
-    { 45556, 57632, 80.014237 },
-    { 45556, 59196, 25.486243 },
-    { 45556, 59316, 47.616730 },
-    { 45556, 59747, 22.495758 },
-    { 45556, 59803, 52.735899 },
-    { 45556, 60718, 22.609350 },
-    { 45556, 60965, 55.187276 },
-    { 45556, 61084, 25.092642 },
-    { 45556, 61359, 49.685932 },
-    { 45556, 61585, 23.049009 },
-    { 45556, 61932, 30.795525 },
-    { 45556, 61941, 69.990726 },
-    { 45556, 62322, 23.915623 },
-    { 45556, 62434, 26.035005 },
-    { 45556, 63090, 75.860492 },
-    { 45556, 63608, 83.391337 },
-    { 45556, 64962, 55.260632 },
-    { 45556, 65109, 44.503077 },
-    { 45556, 65474, 66.326526 },
-    { 45556, 66249, 76.721957 },
-    { 45556, 66657, 35.325185 },
-    { 45556, 68002, 41.204253 },
-    { 45556, 68702, 34.246911 },
-    { 45556, 68895, 58.355430 },
-    { 45556, 68933, 50.643720 },
-    { 45556, 71352, 49.811472 },
-    { 45556, 71681, 37.705779 },
-    { 45556, 71683, 37.710751 },
-    { 45556, 71860, 46.724114 },
-    { 45556, 71908, 35.765566 },
-    { 45556, 72622, 72.927562 },
-    { 45556, 73273, 51.837606 },
-    { 45556, 73334, 52.699917 },
-    { 45556, 73714, 66.836632 },
-    { 45556, 74785, 81.933158 },
-    { 45556, 74946, 36.934456 },
-    { 45556, 75141, 56.445860 },
-    { 45556, 75264, 53.438223 },
-    { 45556, 76297, 57.615849 },
-    { 45556, 77952, 43.023868 },
-    { 45556, 78265, 72.827956 },
-    { 45556, 78401, 75.983900 },
-    { 45556, 78820, 79.011441 },
-    { 45556, 80112, 75.869183 },
-    { 45556, 80763, 76.073757 },
-    { 45556, 81266, 75.245150 },
-    { 45556, 82273, 42.983859 },
-    { 45556, 82396, 71.483659 },
-    { 45556, 82514, 68.400813 },
-    { 45556, 83081, 53.837011 },
-    { 45556, 84143, 65.810005 },
-    { 45556, 84970, 82.922488 },
-    { 45556, 85258, 56.272766 },
-    { 45556, 85267, 55.556904 },
-    { 45556, 85696, 72.720761 },
-    { 45556, 85792, 61.660781 },
-    { 45556, 85927, 73.144432 },
-    { 45556, 86228, 68.185106 },
-    { 45556, 86670, 72.175962 },
-    { 45556, 87073, 71.606839 },
-    { 45556, 87261, 74.590429 },
-    { 45556, 88635, 81.981698 },
-    { 45556, 89642, 77.034266 },
-    { 45556, 89931, 83.749408 },
-    { 45556, 90185, 79.731871 },
-    { 45556, 100751, 63.540799 },
-    { 45556, 101772, 73.125550 },
-    { 45556, 108085, 83.057907 },
-    { 45556, 109268, 73.247514 },
-    { 45556, 110130, 59.867825 },
-    { 45556, 112122, 72.399462 },
-    { 45860, 46390, 43.078992 },
-    { 45860, 46853, 17.416663 },
-    { 45860, 47908, 11.913089 },
-    { 45860, 49669, 24.874139 },
-    { 45860, 50583, 19.537461 },
-    { 45860, 50801, 13.984591 },
-    { 45860, 52943, 54.797221 },
-    { 45860, 53910, 27.897692 },
-    { 45860, 54061, 31.831170 },
-    { 45860, 54539, 23.128796 },
-    { 45860, 54872, 28.511514 },
-    { 45860, 54879, 31.713839 },
-    { 45860, 57632, 38.745958 },
-    { 45860, 58001, 32.944335 },
-    { 45860, 59316, 69.730989 },
-    { 45860, 59774, 36.952907 },
-    { 45860, 59803, 66.502630 },
-    { 45860, 60965, 67.855586 },
-    { 45860, 61359, 73.788567 },
-    { 45860, 61941, 59.050637 },
-    { 45860, 62956, 41.884319 },
-    { 45860, 63090, 58.542776 },
-    { 45860, 63125, 42.851494 },
-    { 45860, 63608, 55.332914 },
-    { 45860, 64962, 80.609845 },
-    { 45860, 65378, 46.034632 },
-    { 45860, 65474, 73.576654 },
-    { 45860, 66249, 68.686740 },
-    { 45860, 67301, 50.074500 },
-    { 45860, 67927, 62.196520 },
-    { 45860, 69673, 66.109740 },
-    { 45860, 71075, 60.825057 },
-    { 45860, 72105, 68.145168 },
-    { 45860, 72607, 55.029981 },
-    { 45860, 75097, 57.515334 },
-    { 45860, 75458, 61.522140 },
-    { 45860, 76267, 77.870270 },
-    { 45860, 80331, 67.060863 },
-    { 45860, 83895, 68.828921 },
-    { 45860, 85670, 79.806496 },
-    { 45860, 87833, 83.140903 },
-    { 45860, 94376, 75.116436 },
-    { 45860, 105199, 83.020733 },
-    { 45860, 106032, 75.037820 },
-    { 45860, 116727, 66.032662 },
-    { 45941, 46390, 46.364812 },
-    { 45941, 46701, 2.390301 },
-    { 45941, 47908, 78.949197 },
-    { 45941, 48002, 10.521593 },
-    { 45941, 49669, 67.685061 },
-    { 45941, 50099, 16.083861 },
-    { 45941, 50371, 9.583268 },
-    { 45941, 50583, 75.864946 },
-    { 45941, 51576, 11.285053 },
-    { 45941, 52419, 13.745763 },
-    { 45941, 52727, 14.049947 },
-    { 45941, 52943, 42.311256 },
-    { 45941, 54872, 79.225703 },
-    { 45941, 54879, 74.339235 },
-    { 45941, 56561, 18.694953 },
-    { 45941, 57632, 76.194817 },
-    { 45941, 59196, 25.067629 },
-    { 45941, 59316, 44.892037 },
-    { 45941, 59747, 23.503185 },
-    { 45941, 59803, 49.906691 },
-    { 45941, 60718, 24.434140 },
-    { 45941, 60965, 52.535984 },
-    { 45941, 61084, 25.938252 },
-    { 45941, 61359, 47.390117 },
-    { 45941, 61585, 25.822590 },
-    { 45941, 61932, 30.606553 },
-    { 45941, 61941, 67.042280 },
-    { 45941, 62322, 26.541387 },
-    { 45941, 62434, 27.400744 },
-    { 45941, 63090, 72.965501 },
-    { 45941, 63608, 80.385150 },
-    { 45941, 64962, 53.680844 },
-    { 45941, 65109, 43.762479 },
-    { 45941, 65474, 64.322723 },
-    { 45941, 66249, 74.482224 },
-    { 45941, 66657, 36.337365 },
-    { 45941, 68002, 41.803923 },
-    { 45941, 68702, 36.185118 },
-    { 45941, 68895, 57.714166 },
-    { 45941, 68933, 50.577591 },
-    { 45941, 71352, 50.527025 },
-    { 45941, 71681, 39.924555 },
-    { 45941, 71683, 39.929311 },
-    { 45941, 71860, 47.881884 },
-    { 45941, 71908, 38.366686 },
-    { 45941, 72622, 72.466466 },
-    { 45941, 73273, 52.906872 },
-    { 45941, 73334, 53.712838 },
-    { 45941, 73714, 67.004441 },
-    { 45941, 74785, 81.595085 },
-    { 45941, 74946, 39.994789 },
-    { 45941, 75141, 57.650968 },
-    { 45941, 75264, 54.890084 },
-    { 45941, 76297, 59.018912 },
-    { 45941, 77952, 45.901539 },
-    { 45941, 78265, 73.834036 },
-    { 45941, 78401, 76.864102 },
-    { 45941, 78820, 79.851027 },
-    { 45941, 80112, 77.169796 },
-    { 45941, 80763, 77.521870 },
-    { 45941, 81266, 76.850253 },
-    { 45941, 82273, 46.424715 },
-    { 45941, 82396, 73.500372 },
-    { 45941, 82514, 70.576198 },
-    { 45941, 83081, 56.769120 },
-    { 45941, 84143, 68.391247 },
-    { 45941, 85258, 59.386085 },
-    { 45941, 85267, 58.699586 },
-    { 45941, 85696, 75.310314 },
-    { 45941, 85792, 64.642568 },
-    { 45941, 85927, 75.759533 },
-    { 45941, 86228, 71.010305 },
-    { 45941, 86670, 74.940821 },
-    { 45941, 87073, 74.453900 },
-    { 45941, 87261, 77.379126 },
-    { 45941, 89642, 80.102106 },
-    { 45941, 90185, 82.816111 },
-    { 45941, 100751, 67.667303 },
-    { 45941, 101772, 77.267782 },
-    { 45941, 109268, 77.565778 },
-    { 45941, 110130, 64.185792 },
-    { 45941, 112122, 76.698066 },
-    { 46390, 46701, 48.380894 },
-    { 46390, 46853, 60.348030 },
-    { 46390, 47908, 32.738435 },
-    { 46390, 48002, 56.517102 },
-    { 46390, 49669, 22.982273 },
-    { 46390, 50099, 61.823440 },
-    { 46390, 50371, 53.463330 },
-    { 46390, 50583, 31.281203 },
-    { 46390, 50801, 51.709469 },
-    { 46390, 51576, 54.335985 },
-    { 46390, 52419, 57.308608 },
-    { 46390, 52727, 43.992286 },
-    { 46390, 52943, 21.379044 },
-    { 46390, 53910, 67.893312 },
-    { 46390, 54061, 72.859329 },
-    { 46390, 54539, 57.938555 },
-    { 46390, 54872, 39.208041 },
-    { 46390, 54879, 35.749731 },
-    { 46390, 56561, 59.047975 },
-    { 46390, 57632, 42.069445 },
-    { 46390, 58001, 69.583679 },
-    { 46390, 59196, 53.514521 },
-    { 46390, 59316, 41.372911 },
-    { 46390, 59747, 59.302457 },
-    { 46390, 59774, 74.113549 },
-    { 46390, 59803, 41.816911 },
-    { 46390, 60718, 63.134212 },
-    { 46390, 60965, 45.064754 },
-    { 46390, 61084, 59.998333 },
-    { 46390, 61359, 46.996914 },
-    { 46390, 61585, 67.727837 },
-    { 46390, 61932, 57.057087 },
-    { 46390, 61941, 48.821208 },
-    { 46390, 62322, 67.775691 },
-    { 46390, 62434, 63.226861 },
-    { 46390, 62956, 77.354780 },
-    { 46390, 63090, 53.231521 },
-    { 46390, 63125, 67.480185 },
-    { 46390, 63608, 56.860297 },
-    { 46390, 64962, 57.105272 },
-    { 46390, 65109, 59.536578 },
-    { 46390, 65378, 80.289744 },
-    { 46390, 65474, 58.476927 },
-    { 46390, 66249, 62.027108 },
-    { 46390, 66657, 67.203648 },
-    { 46390, 67301, 80.889981 },
-    { 46390, 67927, 71.191108 },
-    { 46390, 68002, 68.113965 },
-    { 46390, 68702, 72.209627 },
-    { 46390, 68895, 68.030110 },
-    { 46390, 68933, 68.625328 },
-    { 46390, 69673, 76.189176 },
-    { 46390, 71352, 74.564777 },
-    { 46390, 71681, 76.615930 },
-    { 46390, 71683, 76.618503 },
-    { 46390, 71860, 75.921137 },
-    { 46390, 71908, 77.400345 },
-    { 46390, 72622, 78.864542 },
-    { 46390, 73273, 78.805092 },
-    { 46390, 73334, 78.949170 },
-    { 46390, 73714, 81.033423 },
-    { 46390, 74946, 81.149980 },
-    { 46390, 75141, 83.199850 },
-    { 46390, 75264, 83.054843 },
-    { 46701, 47908, 80.867525 },
-    { 46701, 48002, 8.260068 },
-    { 46701, 49669, 69.429273 },
-    { 46701, 50099, 13.791676 },
-    { 46701, 50371, 7.261776 },
-    { 46701, 50583, 77.553916 },
-    { 46701, 51576, 9.003938 },
-    { 46701, 52419, 11.381459 },
-    { 46701, 52727, 13.559820 },
-    { 46701, 52943, 43.426474 },
-    { 46701, 54872, 80.505565 },
-    { 46701, 54879, 75.569924 },
-    { 46701, 56561, 16.468237 },
-    { 46701, 57632, 77.107506 },
-    { 46701, 59196, 23.638882 },
-    { 46701, 59316, 44.846417 },
-    { 46701, 59747, 21.507323 },
-    { 46701, 59803, 49.941153 },
-    { 46701, 60718, 22.215076 },
-    { 46701, 60965, 52.441947 },
-    { 46701, 61084, 24.004603 },
-    { 46701, 61359, 47.048657 },
-    { 46701, 61585, 23.450268 },
-    { 46701, 61932, 29.091847 },
-    { 46701, 61941, 67.173583 },
-    { 46701, 62322, 24.184855 },
-    { 46701, 62434, 25.308298 },
-    { 46701, 63090, 73.058186 },
-    { 46701, 63608, 80.564610 },
-    { 46701, 64962, 52.905298 },
-    { 46701, 65109, 42.530482 },
-    { 46701, 65474, 63.807018 },
-    { 46701, 66249, 74.120979 },
-    { 46701, 66657, 34.372819 },
-    { 46701, 68002, 39.992343 },
-    { 46701, 68702, 33.960740 },
-    { 46701, 68895, 56.450116 },
-    { 46701, 68933, 49.044077 },
-    { 46701, 71352, 48.684111 },
-    { 46701, 71681, 37.644632 },
-    { 46701, 71683, 37.649434 },
-    { 46701, 71860, 45.885752 },
-    { 46701, 71908, 36.022318 },
-    { 46701, 72622, 71.129874 },
-    { 46701, 73273, 50.944390 },
-    { 46701, 73334, 51.769777 },
-    { 46701, 73714, 65.388370 },
-    { 46701, 74785, 80.208765 },
-    { 46701, 74946, 37.608467 },
-    { 46701, 75141, 55.648784 },
-    { 46701, 75264, 52.810651 },
-    { 46701, 76297, 56.956987 },
-    { 46701, 77952, 43.528912 },
-    { 46701, 78265, 71.908678 },
-    { 46701, 78401, 74.984076 },
-    { 46701, 78820, 77.987252 },
-    { 46701, 80112, 75.150771 },
-    { 46701, 80763, 75.458162 },
-    { 46701, 81266, 74.740800 },
-    { 46701, 82273, 44.040144 },
-    { 46701, 82396, 71.283062 },
-    { 46701, 82514, 68.322127 },
-    { 46701, 83081, 54.394067 },
-    { 46701, 84143, 66.061373 },
-    { 46701, 84970, 82.798833 },
-    { 46701, 85258, 56.999538 },
-    { 46701, 85267, 56.311792 },
-    { 46701, 85696, 72.981011 },
-    { 46701, 85792, 62.264682 },
-    { 46701, 85927, 73.426429 },
-    { 46701, 86228, 68.648379 },
-    { 46701, 86670, 72.586814 },
-    { 46701, 87073, 72.090162 },
-    { 46701, 87261, 75.022651 },
-    { 46701, 88635, 82.424594 },
-    { 46701, 89642, 77.719777 },
-    { 46701, 90185, 80.432983 },
-    { 46701, 100751, 65.468795 },
-    { 46701, 101772, 75.077745 },
-    { 46701, 109268, 75.719523 },
-    { 46701, 110130, 62.336465 },
-    { 46701, 112122, 75.020521 },
-    { 46853, 47908, 28.015504 },
-    { 46853, 49669, 40.358385 },
-    { 46853, 50583, 33.145771 },
-    { 46853, 50801, 13.222789 },
-    { 46853, 52943, 69.904607 },
-    { 46853, 53910, 13.811055 },
-    { 46853, 54061, 15.882570 },
-    { 46853, 54539, 17.579818 },
-    { 46853, 54872, 36.866406 },
-    { 46853, 54879, 41.501665 },
-    { 46853, 57632, 46.001699 },
-    { 46853, 58001, 21.234933 },
-    { 46853, 59316, 81.888790 },
-    { 46853, 59774, 23.898453 },
-    { 46853, 59803, 77.787215 },
-    { 46853, 60965, 78.297830 },
-    { 46853, 61941, 66.338499 },
-    { 46853, 62956, 29.322365 },
-    { 46853, 63090, 63.980248 },
-    { 46853, 63125, 37.440225 },
-    { 46853, 63608, 58.587315 },
-    { 46853, 65378, 33.680315 },
-    { 46853, 65474, 80.224697 },
-    { 46853, 66249, 72.687908 },
-    { 46853, 67301, 39.265565 },
-    { 46853, 67927, 60.524292 },
-    { 46853, 69673, 63.166254 },
-    { 46853, 71075, 52.128946 },
-    { 46853, 72105, 61.861699 },
-    { 46853, 72607, 38.213694 },
-    { 46853, 75097, 40.915276 },
-    { 46853, 75458, 46.896166 },
-    { 46853, 76267, 69.616119 },
-    { 46853, 80331, 51.380619 },
-    { 46853, 80816, 81.689868 },
-    { 46853, 81693, 75.180121 },
-    { 46853, 83895, 52.303556 },
-    { 46853, 84380, 75.167732 },
-    { 46853, 85670, 64.235216 },
-    { 46853, 87833, 67.212343 },
-    { 46853, 91262, 81.742497 },
-    { 46853, 94376, 57.805141 },
-    { 46853, 97165, 80.435571 },
-    { 46853, 102098, 82.408924 },
-    { 46853, 105199, 65.701043 },
-    { 46853, 106032, 57.758342 },
-    { 46853, 109492, 69.847152 },
-    { 46853, 116727, 49.213680 },
-    { 47908, 49669, 12.961102 },
-    { 47908, 50583, 8.838659 },
-    { 47908, 50801, 19.289040 },
-    { 47908, 52727, 74.441646 },
-    { 47908, 52943, 42.895636 },
-    { 47908, 53910, 35.434268 },
-    { 47908, 54061, 40.227007 },
-    { 47908, 54539, 26.857805 },
-    { 47908, 54872, 20.670446 },
-    { 47908, 54879, 22.389471 },
-    { 47908, 57632, 30.437098 },
-    { 47908, 58001, 38.333575 },
-    { 47908, 59196, 80.859562 },
-    { 47908, 59316, 58.145168 },
-    { 47908, 59774, 42.788643 },
-    { 47908, 59803, 55.189635 },
-    { 47908, 60965, 56.801801 },
-    { 47908, 61359, 62.434180 },
-    { 47908, 61932, 82.601547 },
-    { 47908, 61941, 49.578810 },
-    { 47908, 62956, 46.910724 },
-    { 47908, 63090, 50.075270 },
-    { 47908, 63125, 42.725273 },
-    { 47908, 63608, 48.309510 },
-    { 47908, 64962, 69.845608 },
-    { 47908, 65109, 78.845626 },
-    { 47908, 65378, 50.567260 },
-    { 47908, 65474, 63.956676 },
-    { 47908, 66249, 60.569260 },
-    { 47908, 67301, 53.117795 },
-    { 47908, 67927, 57.851218 },
-    { 47908, 68895, 80.626651 },
-    { 47908, 69673, 62.362742 },
-    { 47908, 71075, 61.505212 },
-    { 47908, 72105, 66.587305 },
-    { 47908, 72607, 63.425604 },
-    { 47908, 75097, 65.527648 },
-    { 47908, 75458, 67.142484 },
-    { 47908, 76267, 77.229981 },
-    { 47908, 80331, 73.618760 },
-    { 47908, 83895, 76.454853 },
-    { 47908, 116727, 77.213818 },
-    { 48002, 49669, 77.143538 },
-    { 48002, 50099, 5.571569 },
-    { 48002, 50371, 5.033853 },
-    { 48002, 51576, 6.052593 },
-    { 48002, 52419, 5.986069 },
-    { 48002, 52727, 17.507167 },
-    { 48002, 52943, 50.006695 },
-    { 48002, 54879, 82.183426 },
-    { 48002, 56561, 11.969287 },
-    { 48002, 57632, 82.914668 },
-    { 48002, 59196, 23.117227 },
-    { 48002, 59316, 48.355341 },
-    { 48002, 59747, 18.220285 },
-    { 48002, 59803, 53.591838 },
-    { 48002, 60718, 17.242028 },
-    { 48002, 60965, 55.654544 },
-    { 48002, 61084, 20.902641 },
-    { 48002, 61359, 49.581013 },
-    { 48002, 61585, 16.662280 },
-    { 48002, 61932, 27.825467 },
-    { 48002, 61941, 70.861278 },
-    { 48002, 62322, 17.642655 },
-    { 48002, 62434, 21.112003 },
-    { 48002, 63090, 76.554552 },
-    { 48002, 64962, 53.824460 },
-    { 48002, 65109, 41.954682 },
-    { 48002, 65474, 65.447410 },
-    { 48002, 66249, 76.137086 },
-    { 48002, 66657, 30.584454 },
-    { 48002, 68002, 36.864309 },
-    { 48002, 68702, 28.474642 },
-    { 48002, 68895, 55.427403 },
-    { 48002, 68933, 47.021803 },
-    { 48002, 71352, 45.197053 },
-    { 48002, 71681, 31.627786 },
-    { 48002, 71683, 31.632904 },
-    { 48002, 71860, 41.629990 },
-    { 48002, 71908, 29.391031 },
-    { 48002, 72622, 69.575801 },
-    { 48002, 73273, 46.787449 },
-    { 48002, 73334, 47.704586 },
-    { 48002, 73714, 62.714683 },
-    { 48002, 74785, 78.329064 },
-    { 48002, 74946, 30.279334 },
-    { 48002, 75141, 51.204399 },
-    { 48002, 75264, 47.962560 },
-    { 48002, 76297, 52.158431 },
-    { 48002, 77952, 36.443021 },
-    { 48002, 78265, 67.681229 },
-    { 48002, 78401, 70.951934 },
-    { 48002, 78820, 74.003997 },
-    { 48002, 80112, 70.403108 },
-    { 48002, 80763, 70.464473 },
-    { 48002, 81266, 69.494588 },
-    { 48002, 82273, 36.222650 },
-    { 48002, 82396, 65.398094 },
-    { 48002, 82514, 62.203146 },
-    { 48002, 83081, 47.208210 },
-    { 48002, 84143, 59.345007 },
-    { 48002, 84970, 76.730323 },
-    { 48002, 85258, 49.570998 },
-    { 48002, 85267, 48.846547 },
-    { 48002, 85696, 66.237799 },
-    { 48002, 85792, 55.001320 },
-    { 48002, 85927, 66.646280 },
-    { 48002, 86228, 61.585961 },
-    { 48002, 86670, 65.600565 },
-    { 48002, 87073, 64.993545 },
-    { 48002, 87261, 68.000482 },
-    { 48002, 88635, 75.378357 },
-    { 48002, 89642, 70.332794 },
-    { 48002, 89931, 77.080720 },
-    { 48002, 90185, 73.024027 },
-    { 48002, 90496, 81.750434 },
-    { 48002, 92041, 81.507590 },
-    { 48002, 92855, 82.806983 },
-    { 48002, 93506, 79.835280 },
-    { 48002, 93864, 82.221985 },
-    { 48002, 100751, 57.213734 },
-    { 48002, 101772, 66.824936 },
-    { 48002, 108085, 77.554443 },
-    { 48002, 109268, 67.891838 },
-    { 48002, 110130, 54.530758 },
-    { 48002, 112122, 67.522010 },
-    { 49669, 50099, 82.010408 },
-    { 49669, 50371, 73.319781 },
-    { 49669, 50583, 8.352652 },
-    { 49669, 50801, 29.689707 },
-    { 49669, 51576, 73.799889 },
-    { 49669, 52419, 76.644749 },
-    { 49669, 52727, 61.967193 },
-    { 49669, 52943, 29.951693 },
-    { 49669, 53910, 45.603779 },
-    { 49669, 54061, 50.785067 },
-    { 49669, 54539, 35.085595 },
-    { 49669, 54872, 17.928084 },
-    { 49669, 54879, 16.362775 },
-    { 49669, 56561, 76.870740 },
-    { 49669, 57632, 24.625613 },
-    { 49669, 58001, 46.679728 },
-    { 49669, 59196, 67.922626 },
-    { 49669, 59316, 45.668268 },
-    { 49669, 59747, 75.252088 },
-    { 49669, 59774, 51.202084 },
-    { 49669, 59803, 43.133761 },
-    { 49669, 60718, 79.652873 },
-    { 49669, 60965, 45.103585 },
-    { 49669, 61084, 75.092418 },
-    { 49669, 61359, 50.255897 },
-    { 49669, 61932, 69.648735 },
-    { 49669, 61941, 40.360481 },
-    { 49669, 62434, 78.456379 },
-    { 49669, 62956, 54.373134 },
-    { 49669, 63090, 42.252811 },
-    { 49669, 63125, 45.595668 },
-    { 49669, 63608, 42.553191 },
-    { 49669, 64962, 58.370753 },
-    { 49669, 65109, 66.408083 },
-    { 49669, 65378, 57.361496 },
-    { 49669, 65474, 54.060423 },
-    { 49669, 66249, 52.719273 },
-    { 49669, 66657, 79.347680 },
-    { 49669, 67301, 58.336727 },
-    { 49669, 67927, 54.778669 },
-    { 49669, 68002, 77.814918 },
-    { 49669, 68895, 69.479813 },
-    { 49669, 68933, 73.983733 },
-    { 49669, 69673, 59.708506 },
-    { 49669, 71075, 63.789955 },
-    { 49669, 71352, 81.563833 },
-    { 49669, 72105, 66.148970 },
-    { 49669, 72607, 73.245814 },
-    { 49669, 72622, 75.251110 },
-    { 49669, 73714, 81.002551 },
-    { 49669, 74785, 79.588730 },
-    { 49669, 75097, 74.931907 },
-    { 49669, 75458, 74.174735 },
-    { 49669, 76267, 77.220485 },
-    { 49669, 77070, 82.803432 },
-    { 49669, 80331, 81.345337 },
-    { 50099, 50371, 8.712205 },
-    { 50099, 51576, 8.553372 },
-    { 50099, 52419, 6.302774 },
-    { 50099, 52727, 20.989243 },
-    { 50099, 52943, 54.127899 },
-    { 50099, 56561, 10.676598 },
-    { 50099, 59196, 23.474162 },
-    { 50099, 59316, 50.441006 },
-    { 50099, 59747, 16.985933 },
-    { 50099, 59803, 55.686228 },
-    { 50099, 60718, 14.661324 },
-    { 50099, 60965, 57.422390 },
-    { 50099, 61084, 19.554874 },
-    { 50099, 61359, 50.994957 },
-    { 50099, 61585, 12.358853 },
-    { 50099, 61932, 27.366756 },
-    { 50099, 61941, 72.758152 },
-    { 50099, 62322, 13.526428 },
-    { 50099, 62434, 18.865284 },
-    { 50099, 63090, 78.254406 },
-    { 50099, 64962, 54.076942 },
-    { 50099, 65109, 41.451266 },
-    { 50099, 65474, 66.005376 },
-    { 50099, 66249, 76.813843 },
-    { 50099, 66657, 28.158811 },
-    { 50099, 68002, 34.718653 },
-    { 50099, 68702, 24.815690 },
-    { 50099, 68895, 54.338675 },
-    { 50099, 68933, 45.407608 },
-    { 50099, 71352, 42.605634 },
-    { 50099, 71681, 27.479336 },
-    { 50099, 71683, 27.484590 },
-    { 50099, 71860, 38.567521 },
-    { 50099, 71908, 24.816161 },
-    { 50099, 72622, 67.926996 },
-    { 50099, 73273, 43.703774 },
-    { 50099, 73334, 44.669672 },
-    { 50099, 73714, 60.408558 },
-    { 50099, 74785, 76.363379 },
-    { 50099, 74946, 25.176220 },
-    { 50099, 75141, 47.860537 },
-    { 50099, 75264, 44.386624 },
-    { 50099, 76297, 48.564128 },
-    { 50099, 77952, 31.457822 },
-    { 50099, 78265, 64.303060 },
-    { 50099, 78401, 67.669119 },
-    { 50099, 78820, 70.725128 },
-    { 50099, 80112, 66.671010 },
-    { 50099, 80763, 66.577737 },
-    { 50099, 81266, 65.457522 },
-    { 50099, 81377, 82.060199 },
-    { 50099, 82273, 30.784031 },
-    { 50099, 82396, 60.992785 },
-    { 50099, 82514, 57.672596 },
-    { 50099, 83081, 42.099732 },
-    { 50099, 84012, 79.959205 },
-    { 50099, 84143, 54.467082 },
-    { 50099, 84970, 72.157299 },
-    { 50099, 85258, 44.313294 },
-    { 50099, 85267, 43.570275 },
-    { 50099, 85696, 61.317537 },
-    { 50099, 85792, 49.821243 },
-    { 50099, 85927, 61.703494 },
-    { 50099, 86228, 56.499655 },
-    { 50099, 86670, 60.544981 },
-    { 50099, 87073, 59.878626 },
-    { 50099, 87261, 62.918276 },
-    { 50099, 88635, 70.264555 },
-    { 50099, 89642, 65.053595 },
-    { 50099, 89931, 71.857323 },
-    { 50099, 90185, 67.729539 },
-    { 50099, 90496, 76.524368 },
-    { 50099, 92041, 76.150454 },
-    { 50099, 92855, 77.402176 },
-    { 50099, 93506, 74.374749 },
-    { 50099, 93864, 76.755212 },
-    { 50099, 94141, 83.350074 },
-    { 50099, 100751, 51.750485 },
-    { 50099, 101772, 61.366953 },
-    { 50099, 108085, 72.536417 },
-    { 50099, 109268, 62.997137 },
-    { 50099, 110130, 49.699834 },
-    { 50099, 112122, 62.958167 },
-    { 50099, 113368, 80.024487 },
-    { 50371, 50583, 81.176254 },
-    { 50371, 51576, 1.816205 },
-    { 50371, 52419, 4.248323 },
-    { 50371, 52727, 12.617276 },
-    { 50371, 52943, 45.511716 },
-    { 50371, 54872, 82.656353 },
-    { 50371, 54879, 77.602770 },
-    { 50371, 56561, 9.298444 },
-    { 50371, 57632, 78.074377 },
-    { 50371, 59196, 18.593725 },
-    { 50371, 59316, 43.321906 },
-    { 50371, 59747, 14.831106 },
-    { 50371, 59803, 48.558026 },
-    { 50371, 60718, 15.032610 },
-    { 50371, 60965, 50.631960 },
-    { 50371, 61084, 17.452306 },
-    { 50371, 61359, 44.600282 },
-    { 50371, 61585, 16.301630 },
-    { 50371, 61932, 23.613879 },
-    { 50371, 61941, 65.829014 },
-    { 50371, 62322, 16.974872 },
-    { 50371, 62434, 18.351232 },
-    { 50371, 63090, 71.529171 },
-    { 50371, 63608, 79.212487 },
-    { 50371, 64962, 49.111148 },
-    { 50371, 65109, 37.604278 },
-    { 50371, 65474, 60.615824 },
-    { 50371, 66249, 71.259394 },
-    { 50371, 66657, 27.639050 },
-    { 50371, 68002, 33.577412 },
-    { 50371, 68702, 26.752441 },
-    { 50371, 68895, 51.286505 },
-    { 50371, 68933, 43.247411 },
-    { 50371, 71352, 42.148781 },
-    { 50371, 71681, 30.388597 },
-    { 50371, 71683, 30.393419 },
-    { 50371, 71860, 39.036155 },
-    { 50371, 71908, 28.785389 },
-    { 50371, 72622, 65.680934 },
-    { 50371, 73273, 44.147552 },
-    { 50371, 73334, 45.009786 },
-    { 50371, 73714, 59.297129 },
-    { 50371, 74785, 74.591535 },
-    { 50371, 74946, 30.552260 },
-    { 50371, 75141, 48.763946 },
-    { 50371, 75264, 45.792776 },
-    { 50371, 76297, 49.962827 },
-    { 50371, 77952, 36.364873 },
-    { 50371, 78265, 65.138033 },
-    { 50371, 78401, 68.295009 },
-    { 50371, 78820, 71.323883 },
-    { 50371, 80112, 68.206066 },
-    { 50371, 80763, 68.439778 },
-    { 50371, 81266, 67.653710 },
-    { 50371, 81377, 83.128042 },
-    { 50371, 82273, 37.278083 },
-    { 50371, 82396, 64.066175 },
-    { 50371, 82514, 61.076650 },
-    { 50371, 83081, 47.237559 },
-    { 50371, 84012, 82.450406 },
-    { 50371, 84143, 58.809056 },
-    { 50371, 84970, 75.565418 },
-    { 50371, 85258, 49.929319 },
-    { 50371, 85267, 49.260431 },
-    { 50371, 85696, 65.728359 },
-    { 50371, 85792, 55.120618 },
-    { 50371, 85927, 66.176674 },
-    { 50371, 86228, 61.443083 },
-    { 50371, 86670, 65.363952 },
-    { 50371, 87073, 64.889314 },
-    { 50371, 87261, 67.804469 },
-    { 50371, 88635, 75.205907 },
-    { 50371, 89642, 70.599882 },
-    { 50371, 89931, 77.160571 },
-    { 50371, 90185, 73.318451 },
-    { 50371, 90496, 81.811270 },
-    { 50371, 92041, 81.946398 },
-    { 50371, 92855, 83.403191 },
-    { 50371, 93506, 80.669063 },
-    { 50371, 93864, 83.072652 },
-    { 50371, 100751, 59.933528 },
-    { 50371, 101772, 69.540039 },
-    { 50371, 108085, 81.190134 },
-    { 50371, 109268, 71.692327 },
-    { 50371, 110130, 58.407878 },
-    { 50371, 112122, 71.659988 },
-    { 50583, 50801, 21.663375 },
-    { 50583, 51576, 81.562966 },
-    { 50583, 52727, 69.517773 },
-    { 50583, 52943, 36.765074 },
-    { 50583, 53910, 37.366519 },
-    { 50583, 54061, 42.598718 },
-    { 50583, 54539, 26.732944 },
-    { 50583, 54872, 12.717978 },
-    { 50583, 54879, 13.655615 },
-    { 50583, 57632, 21.898756 },
-    { 50583, 58001, 38.333454 },
-    { 50583, 59196, 74.491352 },
-    { 50583, 59316, 50.256615 },
-    { 50583, 59747, 82.098052 },
-    { 50583, 59774, 42.858144 },
-    { 50583, 59803, 46.965404 },
-    { 50583, 60965, 48.369576 },
-    { 50583, 61084, 81.703295 },
-    { 50583, 61359, 54.251134 },
-    { 50583, 61932, 75.670696 },
-    { 50583, 61941, 40.740503 },
-    { 50583, 62956, 46.111572 },
-    { 50583, 63090, 41.342806 },
-    { 50583, 63125, 38.384304 },
-    { 50583, 63608, 39.986439 },
-    { 50583, 64962, 61.268469 },
-    { 50583, 65109, 70.802745 },
-    { 50583, 65378, 49.205594 },
-    { 50583, 65474, 55.123976 },
-    { 50583, 66249, 51.867518 },
-    { 50583, 67301, 50.519426 },
-    { 50583, 67927, 50.520847 },
-    { 50583, 68002, 82.727142 },
-    { 50583, 68895, 71.926274 },
-    { 50583, 68933, 77.596882 },
-    { 50583, 69673, 55.243482 },
-    { 50583, 71075, 56.962826 },
-    { 50583, 72105, 60.544353 },
-    { 50583, 72607, 64.909719 },
-    { 50583, 72622, 75.591534 },
-    { 50583, 73714, 82.438392 },
-    { 50583, 74785, 78.672139 },
-    { 50583, 75097, 66.579906 },
-    { 50583, 75458, 66.034574 },
-    { 50583, 76267, 71.486638 },
-    { 50583, 77070, 79.454797 },
-    { 50583, 80331, 73.114564 },
-    { 50583, 83895, 76.843859 },
-    { 50583, 116727, 81.834203 },
-    { 50801, 52943, 58.038262 },
-    { 50801, 53910, 16.197437 },
-    { 50801, 54061, 21.185858 },
-    { 50801, 54539, 9.149437 },
-    { 50801, 54872, 23.664689 },
-    { 50801, 54879, 28.379387 },
-    { 50801, 57632, 32.829207 },
-    { 50801, 58001, 19.514181 },
-    { 50801, 59316, 68.812126 },
-    { 50801, 59774, 23.815197 },
-    { 50801, 59803, 64.617924 },
-    { 50801, 60965, 65.079415 },
-    { 50801, 61359, 71.743381 },
-    { 50801, 61941, 53.287755 },
-    { 50801, 62956, 28.383583 },
-    { 50801, 63090, 51.255657 },
-    { 50801, 63125, 29.402467 },
-    { 50801, 63608, 46.405184 },
-    { 50801, 64962, 76.506444 },
-    { 50801, 65378, 32.382638 },
-    { 50801, 65474, 67.369584 },
-    { 50801, 66249, 60.439283 },
-    { 50801, 67301, 36.126879 },
-    { 50801, 67927, 50.509214 },
-    { 50801, 69673, 53.907245 },
-    { 50801, 71075, 46.946051 },
-    { 50801, 72105, 54.802512 },
-    { 50801, 72607, 44.190374 },
-    { 50801, 75097, 46.243444 },
-    { 50801, 75458, 48.435187 },
-    { 50801, 76267, 64.153835 },
-    { 50801, 77070, 78.627013 },
-    { 50801, 80331, 54.563313 },
-    { 50801, 80816, 77.364556 },
-    { 50801, 81693, 72.872287 },
-    { 50801, 83895, 57.182632 },
-    { 50801, 84379, 82.909982 },
-    { 50801, 84380, 74.912976 },
-    { 50801, 85670, 67.034148 },
-    { 50801, 87833, 70.608978 },
-    { 50801, 94376, 65.142403 },
-    { 50801, 105199, 75.130650 },
-    { 50801, 106032, 67.518625 },
-    { 50801, 109492, 80.270563 },
-    { 50801, 116727, 60.278277 },
-    { 51576, 52419, 2.978400 },
-    { 51576, 52727, 12.436206 },
-    { 51576, 52943, 45.598974 },
-    { 51576, 54872, 82.641007 },
-    { 51576, 54879, 77.569339 },
-    { 51576, 56561, 7.495349 },
-    { 51576, 57632, 77.768459 },
-    { 51576, 59196, 17.135321 },
-    { 51576, 59316, 42.529958 },
-    { 51576, 59747, 13.044432 },
-    { 51576, 59803, 47.777169 },
-    { 51576, 60718, 13.236745 },
-    { 51576, 60965, 49.744156 },
-    { 51576, 61084, 15.678491 },
-    { 51576, 61359, 43.588234 },
-    { 51576, 61585, 14.763271 },
-    { 51576, 61932, 22.023180 },
-    { 51576, 61941, 65.002997 },
-    { 51576, 62322, 15.369448 },
-    { 51576, 62434, 16.535463 },
-    { 51576, 63090, 70.647176 },
-    { 51576, 63608, 78.353016 },
-    { 51576, 64962, 47.789515 },
-    { 51576, 65109, 36.079636 },
-    { 51576, 65474, 59.394889 },
-    { 51576, 66249, 70.086757 },
-    { 51576, 66657, 25.833721 },
-    { 51576, 68002, 31.803095 },
-    { 51576, 68702, 24.969026 },
-    { 51576, 68895, 49.692669 },
-    { 51576, 68933, 41.554918 },
-    { 51576, 71352, 40.356613 },
-    { 51576, 71681, 28.645001 },
-    { 51576, 71683, 28.649783 },
-    { 51576, 71860, 37.221703 },
-    { 51576, 71908, 27.129583 },
-    { 51576, 72622, 64.024717 },
-    { 51576, 73273, 42.334899 },
-    { 51576, 73334, 43.198968 },
-    { 51576, 73714, 57.550440 },
-    { 51576, 74785, 72.903552 },
-    { 51576, 74946, 29.050447 },
-    { 51576, 75141, 46.948126 },
-    { 51576, 75264, 43.978475 },
-    { 51576, 76297, 48.147708 },
-    { 51576, 77952, 34.777824 },
-    { 51576, 78265, 63.325114 },
-    { 51576, 78401, 66.486056 },
-    { 51576, 78820, 69.516225 },
-    { 51576, 80112, 66.390113 },
-    { 51576, 80763, 66.626297 },
-    { 51576, 81266, 65.845792 },
-    { 51576, 81377, 81.314990 },
-    { 51576, 82273, 35.931366 },
-    { 51576, 82396, 62.288764 },
-    { 51576, 82514, 59.318199 },
-    { 51576, 83081, 45.649577 },
-    { 51576, 84012, 80.645120 },
-    { 51576, 84143, 57.119865 },
-    { 51576, 84970, 73.797510 },
-    { 51576, 85258, 48.398840 },
-    { 51576, 85267, 47.742057 },
-    { 51576, 85696, 64.037606 },
-    { 51576, 85792, 53.538100 },
-    { 51576, 85927, 64.490986 },
-    { 51576, 86228, 59.809524 },
-    { 51576, 86670, 63.712425 },
-    { 51576, 87073, 63.258842 },
-    { 51576, 87261, 66.157175 },
-    { 51576, 88635, 73.556629 },
-    { 51576, 89642, 69.027800 },
-    { 51576, 89931, 75.550134 },
-    { 51576, 90185, 71.748857 },
-    { 51576, 90496, 80.194076 },
-    { 51576, 92041, 80.395974 },
-    { 51576, 92855, 81.881999 },
-    { 51576, 93506, 79.199742 },
-    { 51576, 93864, 81.604557 },
-    { 51576, 100751, 59.036146 },
-    { 51576, 101772, 68.624275 },
-    { 51576, 108085, 80.648202 },
-    { 51576, 109268, 71.248592 },
-    { 51576, 110130, 58.027497 },
-    { 51576, 112122, 71.408957 },
-    { 52419, 52727, 14.982973 },
-    { 52419, 52943, 48.213841 },
-    { 52419, 54879, 80.049736 },
-    { 52419, 56561, 5.997228 },
-    { 52419, 57632, 79.973873 },
-    { 52419, 59196, 17.657343 },
-    { 52419, 59316, 44.171130 },
-    { 52419, 59747, 12.243853 },
-    { 52419, 59803, 49.419128 },
-    { 52419, 60718, 11.452774 },
-    { 52419, 60965, 51.213228 },
-    { 52419, 61084, 14.925721 },
-    { 52419, 61359, 44.865189 },
-    { 52419, 61585, 12.080999 },
-    { 52419, 61932, 22.058153 },
-    { 52419, 61941, 66.535863 },
-    { 52419, 62322, 12.805369 },
-    { 52419, 62434, 15.181948 },
-    { 52419, 63090, 72.079302 },
-    { 52419, 63608, 79.808136 },
-    { 52419, 64962, 48.421387 },
-    { 52419, 65109, 36.219671 },
-    { 52419, 65474, 60.218919 },
-    { 52419, 66249, 70.987823 },
-    { 52419, 66657, 24.641685 },
-    { 52419, 68002, 30.883532 },
-    { 52419, 68702, 22.985905 },
-    { 52419, 68895, 49.554950 },
-    { 52419, 68933, 41.056802 },
-    { 52419, 71352, 39.251539 },
-    { 52419, 71681, 26.439982 },
-    { 52419, 71683, 26.444923 },
-    { 52419, 71860, 35.795430 },
-    { 52419, 71908, 24.653428 },
-    { 52419, 72622, 63.620601 },
-    { 52419, 73273, 40.945071 },
-    { 52419, 73334, 41.846452 },
-    { 52419, 73714, 56.732001 },
-    { 52419, 74785, 72.349817 },
-    { 52419, 74946, 26.309452 },
-    { 52419, 75141, 45.435900 },
-    { 52419, 75264, 42.300188 },
-    { 52419, 76297, 46.490427 },
-    { 52419, 77952, 32.157921 },
-    { 52419, 78265, 61.890968 },
-    { 52419, 78401, 65.125432 },
-    { 52419, 78820, 68.172083 },
-    { 52419, 79593, 83.580899 },
-    { 52419, 79882, 83.108605 },
-    { 52419, 80112, 64.753472 },
-    { 52419, 80763, 64.894642 },
-    { 52419, 81266, 64.016223 },
-    { 52419, 81377, 79.855883 },
-    { 52419, 82273, 33.049632 },
-    { 52419, 82396, 60.208174 },
-    { 52419, 82514, 57.142504 },
-    { 52419, 83081, 43.027781 },
-    { 52419, 84012, 78.769723 },
-    { 52419, 84143, 54.706832 },
-    { 52419, 84970, 71.658139 },
-    { 52419, 85258, 45.691556 },
-    { 52419, 85267, 45.019306 },
-    { 52419, 85696, 61.626027 },
-    { 52419, 85792, 50.905713 },
-    { 52419, 85927, 62.065864 },
-    { 52419, 86228, 57.267199 },
-    { 52419, 86670, 61.206468 },
-    { 52419, 87073, 60.709582 },
-    { 52419, 87261, 63.641509 },
-    { 52419, 88635, 71.043416 },
-    { 52419, 89642, 66.376965 },
-    { 52419, 89931, 72.961243 },
-    { 52419, 90185, 69.093984 },
-    { 52419, 90496, 77.616578 },
-    { 52419, 92041, 77.712849 },
-    { 52419, 92855, 79.160801 },
-    { 52419, 93506, 76.420756 },
-    { 52419, 93864, 78.824332 },
-    { 52419, 100751, 56.064462 },
-    { 52419, 101772, 65.649909 },
-    { 52419, 108085, 77.782057 },
-    { 52419, 109268, 68.436857 },
-    { 52419, 110130, 55.261058 },
-    { 52419, 112122, 68.720940 },
-    { 52727, 52943, 33.231062 },
-    { 52727, 54872, 70.207991 },
-    { 52727, 54879, 65.134367 },
-    { 52727, 56561, 15.151317 },
-    { 52727, 57632, 65.457126 },
-    { 52727, 59196, 13.114373 },
-    { 52727, 59316, 31.427339 },
-    { 52727, 59747, 15.847451 },
-    { 52727, 59803, 36.587343 },
-    { 52727, 60718, 19.238963 },
-    { 52727, 60965, 38.965476 },
-    { 52727, 61084, 17.256863 },
-    { 52727, 61359, 33.488861 },
-    { 52727, 61585, 23.793199 },
-    { 52727, 61932, 18.641249 },
-    { 52727, 61941, 53.879426 },
-    { 52727, 62322, 23.788581 },
-    { 52727, 62434, 20.063585 },
-    { 52727, 63090, 59.707366 },
-    { 52727, 63608, 67.294815 },
-    { 52727, 64962, 39.658530 },
-    { 52727, 65109, 30.415621 },
-    { 52727, 65474, 50.303729 },
-    { 52727, 66249, 60.565200 },
-    { 52727, 66657, 26.851167 },
-    { 52727, 67927, 79.547852 },
-    { 52727, 68002, 30.918126 },
-    { 52727, 68702, 29.534432 },
-    { 52727, 68895, 44.321701 },
-    { 52727, 68933, 38.075409 },
-    { 52727, 69673, 82.720023 },
-    { 52727, 71352, 39.548318 },
-    { 52727, 71681, 33.884550 },
-    { 52727, 71683, 33.888137 },
-    { 52727, 71860, 38.078283 },
-    { 52727, 71908, 33.881746 },
-    { 52727, 72622, 59.155883 },
-    { 52727, 73273, 42.673768 },
-    { 52727, 73334, 43.314335 },
-    { 52727, 73714, 54.605525 },
-    { 52727, 74785, 68.357696 },
-    { 52727, 74946, 37.251722 },
-    { 52727, 75141, 47.590792 },
-    { 52727, 75264, 45.570878 },
-    { 52727, 76297, 49.419838 },
-    { 52727, 77952, 41.903362 },
-    { 52727, 78265, 62.900629 },
-    { 52727, 78401, 65.608679 },
-    { 52727, 78820, 68.462124 },
-    { 52727, 79593, 81.925371 },
-    { 52727, 79882, 81.813044 },
-    { 52727, 80112, 66.831994 },
-    { 52727, 80763, 67.532274 },
-    { 52727, 81266, 67.275190 },
-    { 52727, 81377, 80.439500 },
-    { 52727, 82273, 44.987622 },
-    { 52727, 82396, 65.169228 },
-    { 52727, 82514, 62.826537 },
-    { 52727, 83081, 52.354616 },
-    { 52727, 84012, 81.868080 },
-    { 52727, 84143, 62.101707 },
-    { 52727, 84970, 76.663283 },
-    { 52727, 85258, 55.629645 },
-    { 52727, 85267, 55.108742 },
-    { 52727, 85696, 68.809391 },
-    { 52727, 85792, 60.076975 },
-    { 52727, 85927, 69.336468 },
-    { 52727, 86228, 65.552015 },
-    { 52727, 86670, 69.106730 },
-    { 52727, 87073, 68.958648 },
-    { 52727, 87261, 71.554289 },
-    { 52727, 88635, 78.757546 },
-    { 52727, 89642, 75.326641 },
-    { 52727, 89931, 81.243225 },
-    { 52727, 90185, 78.020174 },
-    { 52727, 100751, 69.893244 },
-    { 52727, 101772, 79.330092 },
-    { 52727, 109268, 83.258116 },
-    { 52727, 110130, 70.171157 },
-    { 52727, 112122, 83.691202 },
-    { 52943, 53910, 72.621816 },
-    { 52943, 54061, 77.995676 },
-    { 52943, 54539, 60.864496 },
-    { 52943, 54872, 37.206702 },
-    { 52943, 54879, 32.202121 },
-    { 52943, 56561, 47.513720 },
-    { 52943, 57632, 34.088364 },
-    { 52943, 58001, 71.235730 },
-    { 52943, 59196, 37.971122 },
-    { 52943, 59316, 20.016714 },
-    { 52943, 59747, 45.384583 },
-    { 52943, 59774, 75.381007 },
-    { 52943, 59803, 20.652037 },
-    { 52943, 60718, 49.842480 },
-    { 52943, 60965, 24.033246 },
-    { 52943, 61084, 45.146674 },
-    { 52943, 61359, 25.628326 },
-    { 52943, 61585, 55.552576 },
-    { 52943, 61932, 39.895230 },
-    { 52943, 61941, 31.282930 },
-    { 52943, 62322, 55.148533 },
-    { 52943, 62434, 48.509027 },
-    { 52943, 62956, 76.750585 },
-    { 52943, 63090, 36.786143 },
-    { 52943, 63125, 62.043623 },
-    { 52943, 63608, 42.571011 },
-    { 52943, 64962, 35.727766 },
-    { 52943, 65109, 39.152035 },
-    { 52943, 65378, 78.277081 },
-    { 52943, 65474, 38.066755 },
-    { 52943, 66249, 43.558505 },
-    { 52943, 66657, 49.824576 },
-    { 52943, 67301, 76.396004 },
-    { 52943, 67927, 57.184998 },
-    { 52943, 68002, 49.194978 },
-    { 52943, 68702, 56.172772 },
-    { 52943, 68895, 46.681212 },
-    { 52943, 68933, 47.935222 },
-    { 52943, 69673, 61.784107 },
-    { 52943, 71075, 75.362536 },
-    { 52943, 71352, 54.521074 },
-    { 52943, 71681, 60.336517 },
-    { 52943, 71683, 60.337805 },
-    { 52943, 71860, 56.697968 },
-    { 52943, 71908, 62.183145 },
-    { 52943, 72105, 71.608987 },
-    { 52943, 72622, 57.713998 },
-    { 52943, 73273, 58.853265 },
-    { 52943, 73334, 58.851565 },
-    { 52943, 73714, 59.665871 },
-    { 52943, 74785, 65.290442 },
-    { 52943, 74946, 66.769884 },
-    { 52943, 75141, 62.911798 },
-    { 52943, 75264, 63.322827 },
-    { 52943, 76267, 81.365189 },
-    { 52943, 76297, 65.517572 },
-    { 52943, 77070, 76.275445 },
-    { 52943, 77952, 69.477025 },
-    { 52943, 78265, 71.806592 },
-    { 52943, 78401, 72.755232 },
-    { 52943, 78820, 74.477440 },
-    { 52943, 79593, 80.508567 },
-    { 52943, 79882, 81.191239 },
-    { 52943, 80112, 76.840823 },
-    { 52943, 80763, 78.468854 },
-    { 52943, 81266, 79.480772 },
-    { 52943, 82273, 74.819787 },
-    { 52943, 82396, 81.069260 },
-    { 52943, 82514, 80.533482 },
-    { 52943, 83081, 77.871483 },
-    { 52943, 84143, 82.969921 },
-    { 52943, 85258, 81.624587 },
-    { 52943, 85267, 81.397512 },
-    { 53910, 54061, 5.374232 },
-    { 53910, 54539, 11.947650 },
-    { 53910, 54872, 35.930878 },
-    { 53910, 54879, 41.020814 },
-    { 53910, 57632, 42.775186 },
-    { 53910, 58001, 7.903185 },
-    { 53910, 59316, 80.313628 },
-    { 53910, 59774, 10.088037 },
-    { 53910, 59803, 75.543194 },
-    { 53910, 60965, 75.202198 },
-    { 53910, 61359, 82.150185 },
-    { 53910, 61941, 61.267158 },
-    { 53910, 62956, 15.511424 },
-    { 53910, 63090, 57.634430 },
-    { 53910, 63125, 26.116872 },
-    { 53910, 63608, 51.050221 },
-    { 53910, 65378, 19.869354 },
-    { 53910, 65474, 73.791013 },
-    { 53910, 66249, 64.765783 },
-    { 53910, 67301, 25.564790 },
-    { 53910, 67927, 49.779702 },
-    { 53910, 69673, 51.650682 },
-    { 53910, 71075, 38.709834 },
-    { 53910, 72105, 48.988601 },
-    { 53910, 72607, 27.998533 },
-    { 53910, 74785, 83.945592 },
-    { 53910, 75097, 30.122988 },
-    { 53910, 75458, 33.831129 },
-    { 53910, 76267, 56.087215 },
-    { 53910, 77070, 73.985595 },
-    { 53910, 80331, 39.163886 },
-    { 53910, 80816, 67.919304 },
-    { 53910, 81693, 61.406300 },
-    { 53910, 83000, 81.628698 },
-    { 53910, 83895, 41.222357 },
-    { 53910, 84345, 79.804627 },
-    { 53910, 84379, 71.281644 },
-    { 53910, 84380, 61.743962 },
-    { 53910, 85670, 51.919036 },
-    { 53910, 87833, 55.248415 },
-    { 53910, 91262, 69.657735 },
-    { 53910, 93194, 77.179481 },
-    { 53910, 94376, 48.955908 },
-    { 53910, 97165, 70.424557 },
-    { 53910, 100453, 77.642848 },
-    { 53910, 102098, 74.157121 },
-    { 53910, 105199, 59.352232 },
-    { 53910, 106032, 51.972367 },
-    { 53910, 109492, 64.962589 },
-    { 53910, 116727, 45.859297 },
-    { 54061, 54539, 17.274410 },
-    { 54061, 54872, 41.266559 },
-    { 54061, 54879, 46.359344 },
-    { 54061, 57632, 47.872672 },
-    { 54061, 58001, 10.434740 },
-    { 54061, 59774, 10.227175 },
-    { 54061, 59803, 80.581175 },
-    { 54061, 60965, 80.113834 },
-    { 54061, 61941, 65.900635 },
-    { 54061, 62956, 15.246814 },
-    { 54061, 63090, 61.998712 },
-    { 54061, 63125, 29.093019 },
-    { 54061, 63608, 55.148840 },
-    { 54061, 65378, 19.335870 },
-    { 54061, 65474, 77.986068 },
-    { 54061, 66249, 68.586460 },
-    { 54061, 67301, 25.708784 },
-    { 54061, 67927, 52.563210 },
-    { 54061, 69673, 53.934743 },
-    { 54061, 71075, 39.261352 },
-    { 54061, 72105, 50.151080 },
-    { 54061, 72607, 23.321836 },
-    { 54061, 75097, 25.696709 },
-    { 54061, 75458, 31.043748 },
-    { 54061, 76267, 56.208654 },
-    { 54061, 77070, 75.024208 },
-    { 54061, 80331, 35.590341 },
-    { 54061, 80816, 67.240369 },
-    { 54061, 81693, 59.933157 },
-    { 54061, 83000, 81.034444 },
-    { 54061, 83895, 36.998310 },
-    { 54061, 84345, 78.632824 },
-    { 54061, 84379, 69.581413 },
-    { 54061, 84380, 59.396888 },
-    { 54061, 85670, 48.443655 },
-    { 54061, 86032, 82.595814 },
-    { 54061, 87833, 51.544844 },
-    { 54061, 91262, 66.057093 },
-    { 54061, 93194, 73.510309 },
-    { 54061, 94376, 44.034946 },
-    { 54061, 95947, 80.625340 },
-    { 54061, 97165, 65.902477 },
-    { 54061, 100453, 72.897717 },
-    { 54061, 102098, 69.203199 },
-    { 54061, 102488, 80.313883 },
-    { 54061, 105199, 54.084483 },
-    { 54061, 106032, 46.644364 },
-    { 54061, 109492, 59.609664 },
-    { 54061, 116727, 40.509254 },
-    { 54539, 54872, 23.992209 },
-    { 54539, 54879, 29.084950 },
-    { 54539, 57632, 31.075004 },
-    { 54539, 58001, 11.669745 },
-    { 54539, 59316, 68.527763 },
-    { 54539, 59774, 16.198885 },
-    { 54539, 59803, 63.850231 },
-    { 54539, 60965, 63.694702 },
-    { 54539, 61359, 70.604956 },
-    { 54539, 61941, 50.310718 },
-    { 54539, 62956, 20.053441 },
-    { 54539, 63090, 47.248328 },
-    { 54539, 63125, 20.773163 },
-    { 54539, 63608, 41.340442 },
-    { 54539, 64962, 73.835973 },
-    { 54539, 65378, 23.773725 },
-    { 54539, 65474, 63.559214 },
-    { 54539, 66249, 55.400810 },
-    { 54539, 67301, 27.072039 },
-    { 54539, 67927, 43.111082 },
-    { 54539, 68895, 81.816120 },
-    { 54539, 69673, 46.049039 },
-    { 54539, 71075, 37.842448 },
-    { 54539, 72105, 46.066077 },
-    { 54539, 72607, 38.257625 },
-    { 54539, 72622, 78.666513 },
-    { 54539, 74785, 77.414840 },
-    { 54539, 75097, 39.850291 },
-    { 54539, 75458, 40.286167 },
-    { 54539, 76267, 55.135873 },
-    { 54539, 77070, 70.337719 },
-    { 54539, 79593, 82.820123 },
-    { 54539, 80331, 46.891381 },
-    { 54539, 80816, 68.258522 },
-    { 54539, 81693, 63.749696 },
-    { 54539, 83000, 81.316124 },
-    { 54539, 83895, 50.208843 },
-    { 54539, 84345, 80.841423 },
-    { 54539, 84379, 73.783294 },
-    { 54539, 84380, 66.013111 },
-    { 54539, 85670, 58.995852 },
-    { 54539, 87833, 62.735025 },
-    { 54539, 91262, 76.563210 },
-    { 54539, 94376, 59.349890 },
-    { 54539, 97165, 79.558222 },
-    { 54539, 105199, 70.633895 },
-    { 54539, 106032, 63.497434 },
-    { 54539, 109492, 76.576355 },
-    { 54539, 116727, 57.782851 },
-    { 54872, 54879, 5.094370 },
-    { 54872, 56561, 83.653335 },
-    { 54872, 57632, 10.235418 },
-    { 54872, 58001, 34.030848 },
-    { 54872, 59196, 72.244009 },
-    { 54872, 59316, 45.255740 },
-    { 54872, 59747, 80.270287 },
-    { 54872, 59774, 38.220390 },
-    { 54872, 59803, 40.962877 },
-    { 54872, 60965, 41.443190 },
-    { 54872, 61084, 79.301764 },
-    { 54872, 61359, 48.079001 },
-    { 54872, 61932, 72.164647 },
-    { 54872, 61941, 30.699548 },
-    { 54872, 62434, 82.466647 },
-    { 54872, 62956, 40.028453 },
-    { 54872, 63090, 30.064698 },
-    { 54872, 63125, 28.274629 },
-    { 54872, 63608, 27.655761 },
-    { 54872, 64962, 53.239841 },
-    { 54872, 65109, 64.551588 },
-    { 54872, 65378, 42.179121 },
-    { 54872, 65474, 45.194439 },
-    { 54872, 66249, 40.351611 },
-    { 54872, 66657, 80.400294 },
-    { 54872, 67301, 41.874844 },
-    { 54872, 67927, 37.817965 },
-    { 54872, 68002, 76.911446 },
-    { 54872, 68895, 63.005632 },
-    { 54872, 68933, 69.982161 },
-    { 54872, 69673, 42.576337 },
-    { 54872, 71075, 45.999226 },
-    { 54872, 71352, 78.013553 },
-    { 54872, 71860, 82.373063 },
-    { 54872, 72105, 48.342749 },
-    { 54872, 72607, 60.854246 },
-    { 54872, 72622, 64.551514 },
-    { 54872, 73273, 81.870392 },
-    { 54872, 73334, 81.325535 },
-    { 54872, 73714, 72.219103 },
-    { 54872, 74785, 66.754399 },
-    { 54872, 75097, 61.852059 },
-    { 54872, 75141, 83.844891 },
-    { 54872, 75458, 58.545636 },
-    { 54872, 76267, 59.386928 },
-    { 54872, 77070, 66.747857 },
-    { 54872, 78265, 83.288407 },
-    { 54872, 78401, 82.031163 },
-    { 54872, 78820, 81.877772 },
-    { 54872, 79593, 77.387494 },
-    { 54872, 79882, 78.680557 },
-    { 54872, 80331, 66.105713 },
-    { 54872, 80816, 72.885306 },
-    { 54872, 81693, 72.690047 },
-    { 54872, 83000, 82.916260 },
-    { 54872, 83895, 70.821337 },
-    { 54872, 84379, 81.729371 },
-    { 54872, 84380, 78.054276 },
-    { 54872, 85670, 76.311306 },
-    { 54872, 87833, 80.396899 },
-    { 54872, 94376, 81.465438 },
-    { 54872, 116727, 81.773637 },
-    { 54879, 56561, 78.562455 },
-    { 54879, 57632, 8.452263 },
-    { 54879, 58001, 39.044101 },
-    { 54879, 59196, 67.208818 },
-    { 54879, 59316, 40.433871 },
-    { 54879, 59747, 75.221478 },
-    { 54879, 59774, 43.181982 },
-    { 54879, 59803, 36.295666 },
-    { 54879, 60718, 79.786451 },
-    { 54879, 60965, 36.994164 },
-    { 54879, 61084, 74.288553 },
-    { 54879, 61359, 43.489393 },
-    { 54879, 61932, 67.237987 },
-    { 54879, 61941, 27.420496 },
-    { 54879, 62434, 77.472516 },
-    { 54879, 62956, 44.787784 },
-    { 54879, 63090, 27.695225 },
-    { 54879, 63125, 32.017430 },
-    { 54879, 63608, 26.629531 },
-    { 54879, 64962, 49.188554 },
-    { 54879, 65109, 60.052928 },
-    { 54879, 65378, 46.738134 },
-    { 54879, 65474, 41.927015 },
-    { 54879, 66249, 38.212873 },
-    { 54879, 66657, 75.639015 },
-    { 54879, 67301, 45.992898 },
-    { 54879, 67927, 38.415931 },
-    { 54879, 68002, 72.361920 },
-    { 54879, 68702, 83.070421 },
-    { 54879, 68895, 59.328422 },
-    { 54879, 68933, 65.866041 },
-    { 54879, 69673, 43.350878 },
-    { 54879, 71075, 48.960568 },
-    { 54879, 71352, 73.875784 },
-    { 54879, 71860, 78.071654 },
-    { 54879, 72105, 50.104643 },
-    { 54879, 72607, 65.781799 },
-    { 54879, 72622, 62.035483 },
-    { 54879, 73273, 77.835454 },
-    { 54879, 73334, 77.340571 },
-    { 54879, 73714, 69.191615 },
-    { 54879, 74785, 65.027983 },
-    { 54879, 75097, 66.694400 },
-    { 54879, 75141, 80.066863 },
-    { 54879, 75264, 82.330555 },
-    { 54879, 75458, 62.862959 },
-    { 54879, 76267, 61.184751 },
-    { 54879, 76297, 82.590458 },
-    { 54879, 77070, 66.656171 },
-    { 54879, 78265, 80.647608 },
-    { 54879, 78401, 79.650204 },
-    { 54879, 78820, 79.743523 },
-    { 54879, 79593, 76.620291 },
-    { 54879, 79882, 77.858356 },
-    { 54879, 80331, 70.497827 },
-    { 54879, 80816, 74.413882 },
-    { 54879, 81693, 75.105072 },
-    { 54879, 83000, 83.567002 },
-    { 54879, 83895, 75.407290 },
-    { 54879, 84379, 83.757066 },
-    { 54879, 84380, 80.985107 },
-    { 54879, 85670, 80.276024 },
-    { 56561, 57632, 77.635408 },
-    { 56561, 59196, 13.053779 },
-    { 56561, 59316, 40.813176 },
-    { 56561, 59747, 6.404129 },
-    { 56561, 59803, 46.004273 },
-    { 56561, 60718, 5.747014 },
-    { 56561, 60965, 47.449545 },
-    { 56561, 61084, 9.057162 },
-    { 56561, 61359, 40.824487 },
-    { 56561, 61585, 8.680955 },
-    { 56561, 61932, 16.690165 },
-    { 56561, 61941, 62.776149 },
-    { 56561, 62322, 8.840895 },
-    { 56561, 62434, 9.205004 },
-    { 56561, 63090, 68.106928 },
-    { 56561, 63608, 75.835024 },
-    { 56561, 64962, 43.429952 },
-    { 56561, 65109, 30.790282 },
-    { 56561, 65474, 55.400287 },
-    { 56561, 66249, 66.220457 },
-    { 56561, 66657, 18.649680 },
-    { 56561, 68002, 24.895810 },
-    { 56561, 68702, 17.494332 },
-    { 56561, 68895, 43.851839 },
-    { 56561, 68933, 35.176465 },
-    { 56561, 71352, 33.256817 },
-    { 56561, 71681, 21.272695 },
-    { 56561, 71683, 21.277341 },
-    { 56561, 71860, 29.871260 },
-    { 56561, 71908, 20.088298 },
-    { 56561, 72622, 57.750568 },
-    { 56561, 73273, 35.010463 },
-    { 56561, 73334, 35.899792 },
-    { 56561, 73714, 50.747125 },
-    { 56561, 74785, 66.417916 },
-    { 56561, 74946, 22.641432 },
-    { 56561, 75141, 39.555410 },
-    { 56561, 75264, 36.516384 },
-    { 56561, 76297, 40.694022 },
-    { 56561, 77070, 83.622452 },
-    { 56561, 77952, 27.954999 },
-    { 56561, 78265, 55.981867 },
-    { 56561, 78401, 59.190056 },
-    { 56561, 78820, 62.232157 },
-    { 56561, 79593, 77.588927 },
-    { 56561, 79882, 77.124186 },
-    { 56561, 80112, 58.949506 },
-    { 56561, 80763, 59.155711 },
-    { 56561, 81266, 58.356122 },
-    { 56561, 81377, 73.962354 },
-    { 56561, 82273, 30.085769 },
-    { 56561, 82396, 54.816084 },
-    { 56561, 82514, 51.882886 },
-    { 56561, 83081, 38.767946 },
-    { 56561, 84012, 73.151973 },
-    { 56561, 84143, 49.872124 },
-    { 56561, 84970, 66.339966 },
-    { 56561, 85258, 41.717594 },
-    { 56561, 85267, 41.109073 },
-    { 56561, 85696, 56.778038 },
-    { 56561, 85792, 46.649810 },
-    { 56561, 85927, 57.245897 },
-    { 56561, 86228, 52.733545 },
-    { 56561, 86670, 56.572699 },
-    { 56561, 87073, 56.187016 },
-    { 56561, 87261, 59.027378 },
-    { 56561, 88048, 83.914777 },
-    { 56561, 88635, 66.411343 },
-    { 56561, 89642, 62.137634 },
-    { 56561, 89931, 68.523249 },
-    { 56561, 90185, 64.861425 },
-    { 56561, 90496, 73.139302 },
-    { 56561, 92041, 73.554749 },
-    { 56561, 92855, 75.134359 },
-    { 56561, 93506, 72.634302 },
-    { 56561, 93864, 75.036813 },
-    { 56561, 94141, 81.322427 },
-    { 56561, 100751, 54.751394 },
-    { 56561, 101772, 64.178776 },
-    { 56561, 108085, 77.567867 },
-    { 56561, 109268, 68.652761 },
-    { 56561, 110130, 55.847678 },
-    { 56561, 112122, 69.589592 },
-    { 57632, 58001, 39.133638 },
-    { 57632, 59196, 65.431533 },
-    { 57632, 59316, 37.547964 },
-    { 57632, 59747, 73.515397 },
-    { 57632, 59774, 42.754758 },
-    { 57632, 59803, 32.784463 },
-    { 57632, 60718, 78.014820 },
-    { 57632, 60965, 32.678421 },
-    { 57632, 61084, 72.217743 },
-    { 57632, 61359, 39.553362 },
-    { 57632, 61932, 64.588134 },
-    { 57632, 61941, 20.644830 },
-    { 57632, 62322, 83.326239 },
-    { 57632, 62434, 75.206083 },
-    { 57632, 62956, 43.227803 },
-    { 57632, 63090, 19.847098 },
-    { 57632, 63125, 27.974689 },
-    { 57632, 63608, 18.182345 },
-    { 57632, 64962, 43.677284 },
-    { 57632, 65109, 55.640101 },
-    { 57632, 65378, 44.348077 },
-    { 57632, 65474, 35.063609 },
-    { 57632, 66249, 30.211378 },
-    { 57632, 66657, 72.065878 },
-    { 57632, 67301, 42.329138 },
-    { 57632, 67927, 30.318229 },
-    { 57632, 68002, 68.027310 },
-    { 57632, 68702, 79.665976 },
-    { 57632, 68895, 53.045661 },
-    { 57632, 68933, 60.410537 },
-    { 57632, 69673, 35.311124 },
-    { 57632, 71075, 43.007493 },
-    { 57632, 71352, 68.435289 },
-    { 57632, 71681, 82.695050 },
-    { 57632, 71683, 82.693829 },
-    { 57632, 71860, 73.000676 },
-    { 57632, 72105, 42.724476 },
-    { 57632, 72607, 64.687911 },
-    { 57632, 72622, 54.341292 },
-    { 57632, 73273, 72.160990 },
-    { 57632, 73334, 71.566969 },
-    { 57632, 73714, 61.995381 },
-    { 57632, 74785, 56.835026 },
-    { 57632, 75097, 65.101818 },
-    { 57632, 75141, 73.904132 },
-    { 57632, 75264, 76.511311 },
-    { 57632, 75458, 59.395566 },
-    { 57632, 76267, 53.739530 },
-    { 57632, 76297, 76.331109 },
-    { 57632, 77070, 58.239944 },
-    { 57632, 78265, 73.067470 },
-    { 57632, 78401, 71.859879 },
-    { 57632, 78820, 71.784464 },
-    { 57632, 79593, 68.180442 },
-    { 57632, 79882, 69.424667 },
-    { 57632, 80112, 77.416555 },
-    { 57632, 80331, 67.133837 },
-    { 57632, 80763, 79.443924 },
-    { 57632, 80816, 66.677701 },
-    { 57632, 81266, 81.444899 },
-    { 57632, 81377, 75.670888 },
-    { 57632, 81693, 68.156757 },
-    { 57632, 83000, 75.325436 },
-    { 57632, 83895, 72.606476 },
-    { 57632, 84345, 78.300301 },
-    { 57632, 84379, 76.370860 },
-    { 57632, 84380, 74.612880 },
-    { 57632, 85670, 75.691772 },
-    { 57632, 86032, 83.515941 },
-    { 57632, 87833, 79.802109 },
-    { 58001, 59316, 76.395955 },
-    { 58001, 59774, 4.531314 },
-    { 58001, 59803, 71.393616 },
-    { 58001, 60965, 70.635709 },
-    { 58001, 61359, 77.589740 },
-    { 58001, 61941, 56.036487 },
-    { 58001, 62956, 8.940237 },
-    { 58001, 63090, 51.868951 },
-    { 58001, 63125, 18.701870 },
-    { 58001, 63608, 44.859980 },
-    { 58001, 64962, 79.039171 },
-    { 58001, 65378, 13.140270 },
-    { 58001, 65474, 67.706905 },
-    { 58001, 66249, 58.180017 },
-    { 58001, 67301, 18.097067 },
-    { 58001, 67927, 42.281047 },
-    { 58001, 69673, 43.918417 },
-    { 58001, 71075, 30.937468 },
-    { 58001, 72105, 41.089889 },
-    { 58001, 72607, 26.986866 },
-    { 58001, 72622, 79.349380 },
-    { 58001, 74785, 76.239184 },
-    { 58001, 75097, 28.351343 },
-    { 58001, 75458, 28.933633 },
-    { 58001, 76267, 48.393238 },
-    { 58001, 77070, 66.085784 },
-    { 58001, 79593, 78.663088 },
-    { 58001, 79882, 80.041733 },
-    { 58001, 80331, 35.294651 },
-    { 58001, 80816, 60.542815 },
-    { 58001, 81693, 54.602394 },
-    { 58001, 83000, 74.157733 },
-    { 58001, 83895, 38.545661 },
-    { 58001, 84345, 72.671437 },
-    { 58001, 84379, 64.592389 },
-    { 58001, 84380, 55.759041 },
-    { 58001, 85670, 47.581927 },
-    { 58001, 86032, 77.123597 },
-    { 58001, 87833, 51.235620 },
-    { 58001, 91262, 65.261641 },
-    { 58001, 93194, 72.808764 },
-    { 58001, 94376, 47.963327 },
-    { 58001, 95947, 80.603748 },
-    { 58001, 97165, 67.888504 },
-    { 58001, 100453, 75.628722 },
-    { 58001, 102098, 72.879225 },
-    { 58001, 102488, 83.407753 },
-    { 58001, 105199, 59.804271 },
-    { 58001, 106032, 53.050578 },
-    { 58001, 109492, 66.178464 },
-    { 58001, 116727, 48.653993 },
-    { 59196, 59316, 28.104729 },
-    { 59196, 59747, 8.085366 },
-    { 59196, 59803, 33.213787 },
-    { 59196, 60718, 12.616723 },
-    { 59196, 60965, 34.478555 },
-    { 59196, 61084, 7.212918 },
-    { 59196, 61359, 27.789342 },
-    { 59196, 61585, 18.733515 },
-    { 59196, 61932, 5.625855 },
-    { 59196, 61941, 49.775425 },
-    { 59196, 62322, 17.993606 },
-    { 59196, 62434, 10.555158 },
-    { 59196, 63090, 55.060810 },
-    { 59196, 63608, 62.786151 },
-    { 59196, 64962, 30.769579 },
-    { 59196, 65109, 19.047726 },
-    { 59196, 65474, 42.577197 },
-    { 59196, 66249, 53.365745 },
-    { 59196, 66657, 14.258059 },
-    { 59196, 67927, 72.968419 },
-    { 59196, 68002, 17.806677 },
-    { 59196, 68702, 18.744236 },
-    { 59196, 68895, 32.869510 },
-    { 59196, 68933, 25.533429 },
-    { 59196, 69673, 75.309689 },
-    { 59196, 71352, 26.440825 },
-    { 59196, 71681, 23.126624 },
-    { 59196, 71683, 23.128995 },
-    { 59196, 71860, 25.091742 },
-    { 59196, 71908, 24.371070 },
-    { 59196, 72622, 47.494529 },
-    { 59196, 73273, 29.584413 },
-    { 59196, 73334, 30.209092 },
-    { 59196, 73714, 42.023560 },
-    { 59196, 74785, 56.572105 },
-    { 59196, 74946, 28.811921 },
-    { 59196, 75141, 34.505702 },
-    { 59196, 75264, 32.633010 },
-    { 59196, 76297, 36.394719 },
-    { 59196, 77070, 73.539612 },
-    { 59196, 77952, 32.025228 },
-    { 59196, 78265, 49.825341 },
-    { 59196, 78401, 52.592964 },
-    { 59196, 78820, 55.483137 },
-    { 59196, 79593, 69.429783 },
-    { 59196, 79882, 69.220965 },
-    { 59196, 80112, 53.718464 },
-    { 59196, 80763, 54.422660 },
-    { 59196, 81266, 54.195427 },
-    { 59196, 81377, 67.472558 },
-    { 59196, 82273, 36.867842 },
-    { 59196, 82396, 52.328564 },
-    { 59196, 82514, 50.178639 },
-    { 59196, 83081, 41.602548 },
-    { 59196, 84012, 68.756942 },
-    { 59196, 84143, 50.039743 },
-    { 59196, 84970, 63.743859 },
-    { 59196, 85258, 45.162535 },
-    { 59196, 85267, 44.771632 },
-    { 59196, 85696, 56.544653 },
-    { 59196, 85792, 48.955961 },
-    { 59196, 85927, 57.095464 },
-    { 59196, 86228, 53.812859 },
-    { 59196, 86670, 57.121440 },
-    { 59196, 87073, 57.132026 },
-    { 59196, 87261, 59.530872 },
-    { 59196, 88048, 80.978774 },
-    { 59196, 88635, 66.542744 },
-    { 59196, 89642, 63.719275 },
-    { 59196, 89931, 69.220762 },
-    { 59196, 90185, 66.350614 },
-    { 59196, 90496, 73.535398 },
-    { 59196, 92041, 74.934808 },
-    { 59196, 92855, 76.845201 },
-    { 59196, 93506, 75.113342 },
-    { 59196, 93864, 77.425572 },
-    { 59196, 94141, 83.034973 },
-    { 59196, 100751, 63.163206 },
-    { 59196, 101772, 72.025593 },
-    { 59196, 109268, 78.947967 },
-    { 59196, 110130, 66.829623 },
-    { 59196, 112122, 80.661148 },
-    { 59316, 59747, 36.140274 },
-    { 59316, 59774, 79.660209 },
-    { 59316, 59803, 5.250016 },
-    { 59316, 60718, 40.574356 },
-    { 59316, 60965, 7.672167 },
-    { 59316, 61084, 34.705751 },
-    { 59316, 61359, 5.636264 },
-    { 59316, 61585, 46.696215 },
-    { 59316, 61932, 27.064041 },
-    { 59316, 61941, 22.513986 },
-    { 59316, 62322, 45.830703 },
-    { 59316, 62434, 37.659438 },
-    { 59316, 62956, 79.131564 },
-    { 59316, 63090, 28.288211 },
-    { 59316, 63125, 61.882860 },
-    { 59316, 63608, 35.918712 },
-    { 59316, 64962, 15.844296 },
-    { 59316, 65109, 20.740701 },
-    { 59316, 65378, 79.140222 },
-    { 59316, 65474, 21.263690 },
-    { 59316, 66249, 30.129320 },
-    { 59316, 66657, 35.221088 },
-    { 59316, 67301, 75.132930 },
-    { 59316, 67927, 48.324334 },
-    { 59316, 68002, 32.470920 },
-    { 59316, 68702, 42.638449 },
-    { 59316, 68895, 26.664797 },
-    { 59316, 68933, 28.685642 },
-    { 59316, 69673, 51.842565 },
-    { 59316, 71075, 69.429717 },
-    { 59316, 71352, 35.972473 },
-    { 59316, 71681, 46.111356 },
-    { 59316, 71683, 46.111019 },
-    { 59316, 71860, 39.117375 },
-    { 59316, 71908, 49.019335 },
-    { 59316, 72105, 62.208127 },
-    { 59316, 72622, 38.372976 },
-    { 59316, 73273, 40.291793 },
-    { 59316, 73334, 40.115548 },
-    { 59316, 73714, 39.660716 },
-    { 59316, 74785, 46.602230 },
-    { 59316, 74946, 54.102376 },
-    { 59316, 75141, 43.872436 },
-    { 59316, 75264, 44.894112 },
-    { 59316, 76267, 69.853144 },
-    { 59316, 76297, 46.521327 },
-    { 59316, 77070, 59.859558 },
-    { 59316, 77952, 55.015844 },
-    { 59316, 78265, 51.792650 },
-    { 59316, 78401, 52.764067 },
-    { 59316, 78820, 54.560064 },
-    { 59316, 79593, 61.927348 },
-    { 59316, 79882, 62.439884 },
-    { 59316, 80112, 56.830107 },
-    { 59316, 80763, 58.474506 },
-    { 59316, 80816, 77.187057 },
-    { 59316, 81266, 59.537618 },
-    { 59316, 81377, 64.620523 },
-    { 59316, 82273, 61.698574 },
-    { 59316, 82396, 61.485004 },
-    { 59316, 82514, 61.284768 },
-    { 59316, 83000, 77.261564 },
-    { 59316, 83081, 61.490133 },
-    { 59316, 84012, 70.533071 },
-    { 59316, 84143, 64.420077 },
-    { 59316, 84345, 83.180471 },
-    { 59316, 84970, 70.312309 },
-    { 59316, 85258, 65.252702 },
-    { 59316, 85267, 65.203460 },
-    { 59316, 85696, 68.988959 },
-    { 59316, 85792, 66.858491 },
-    { 59316, 85927, 69.584374 },
-    { 59316, 86228, 68.985349 },
-    { 59316, 86670, 70.824457 },
-    { 59316, 87073, 71.507341 },
-    { 59316, 87261, 72.736189 },
-    { 59316, 88048, 83.723582 },
-    { 59316, 88635, 77.891943 },
-    { 59316, 89642, 78.113257 },
-    { 59316, 89931, 81.179122 },
-    { 59316, 90185, 80.180460 },
-    { 59747, 59803, 41.207097 },
-    { 59747, 60718, 4.566152 },
-    { 59747, 60965, 42.321161 },
-    { 59747, 61084, 2.682360 },
-    { 59747, 61359, 35.518010 },
-    { 59747, 61585, 10.654505 },
-    { 59747, 61932, 10.521176 },
-    { 59747, 61941, 57.535231 },
-    { 59747, 62322, 9.967542 },
-    { 59747, 62434, 4.269477 },
-    { 59747, 63090, 62.666933 },
-    { 59747, 63608, 70.359537 },
-    { 59747, 64962, 37.346403 },
-    { 59747, 65109, 24.481344 },
-    { 59747, 65474, 49.392566 },
-    { 59747, 66249, 60.217054 },
-    { 59747, 66657, 12.869353 },
-    { 59747, 67927, 79.820218 },
-    { 59747, 68002, 18.767025 },
-    { 59747, 68702, 13.760183 },
-    { 59747, 68895, 37.448213 },
-    { 59747, 68933, 28.816155 },
-    { 59747, 69673, 81.790462 },
-    { 59747, 71352, 27.318637 },
-    { 59747, 71681, 18.061301 },
-    { 59747, 71683, 18.065028 },
-    { 59747, 71860, 24.384146 },
-    { 59747, 71908, 18.144105 },
-    { 59747, 72622, 51.385294 },
-    { 59747, 73273, 29.437661 },
-    { 59747, 73334, 30.268991 },
-    { 59747, 73714, 44.565979 },
-    { 59747, 74785, 60.108780 },
-    { 59747, 74946, 21.942183 },
-    { 59747, 75141, 34.151586 },
-    { 59747, 75264, 31.427028 },
-    { 59747, 76297, 35.532702 },
-    { 59747, 77070, 77.306897 },
-    { 59747, 77952, 26.141118 },
-    { 59747, 78265, 50.410875 },
-    { 59747, 78401, 53.518997 },
-    { 59747, 78820, 56.537072 },
-    { 59747, 79593, 71.609110 },
-    { 59747, 79882, 71.201714 },
-    { 59747, 80112, 53.667205 },
-    { 59747, 80763, 54.030417 },
-    { 59747, 81266, 53.411871 },
-    { 59747, 81377, 68.392735 },
-    { 59747, 82273, 29.924489 },
-    { 59747, 82396, 50.433798 },
-    { 59747, 82514, 47.771412 },
-    { 59747, 83081, 36.508908 },
-    { 59747, 84012, 68.225648 },
-    { 59747, 84143, 46.510864 },
-    { 59747, 84970, 62.009261 },
-    { 59747, 85258, 39.811230 },
-    { 59747, 85267, 39.307925 },
-    { 59747, 85696, 53.313705 },
-    { 59747, 85792, 44.233885 },
-    { 59747, 85927, 53.821138 },
-    { 59747, 86228, 49.807319 },
-    { 59747, 86670, 53.445511 },
-    { 59747, 87073, 53.233219 },
-    { 59747, 87261, 55.902152 },
-    { 59747, 88048, 79.569085 },
-    { 59747, 88635, 63.183516 },
-    { 59747, 89642, 59.526410 },
-    { 59747, 89931, 65.559714 },
-    { 59747, 90185, 62.228920 },
-    { 59747, 90496, 70.075796 },
-    { 59747, 92041, 70.935333 },
-    { 59747, 92855, 72.678426 },
-    { 59747, 93506, 70.524613 },
-    { 59747, 93864, 72.899991 },
-    { 59747, 94141, 78.908247 },
-    { 59747, 100751, 55.847444 },
-    { 59747, 101772, 64.954756 },
-    { 59747, 108085, 79.494327 },
-    { 59747, 109268, 71.114531 },
-    { 59747, 110130, 58.831528 },
-    { 59747, 112122, 72.664843 },
-    { 59774, 59803, 74.574625 },
-    { 59774, 60965, 73.609546 },
-    { 59774, 61359, 80.528484 },
-    { 59774, 61941, 58.721241 },
-    { 59774, 62956, 5.429192 },
-    { 59774, 63090, 54.225353 },
-    { 59774, 63125, 19.873388 },
-    { 59774, 63608, 46.948436 },
-    { 59774, 64962, 81.311481 },
-    { 59774, 65378, 9.782315 },
-    { 59774, 65474, 69.700964 },
-    { 59774, 66249, 59.789403 },
-    { 59774, 67301, 15.705570 },
-    { 59774, 67927, 42.821617 },
-    { 59774, 69673, 43.901149 },
-    { 59774, 71075, 29.145338 },
-    { 59774, 72105, 39.930602 },
-    { 59774, 72607, 22.652459 },
-    { 59774, 72622, 79.899979 },
-    { 59774, 74785, 76.100454 },
-    { 59774, 75097, 23.890947 },
-    { 59774, 75458, 24.650843 },
-    { 59774, 76267, 46.306164 },
-    { 59774, 77070, 64.834275 },
-    { 59774, 79593, 77.310264 },
-    { 59774, 79882, 78.663288 },
-    { 59774, 80331, 30.830802 },
-    { 59774, 80816, 57.879994 },
-    { 59774, 81693, 51.340478 },
-    { 59774, 83000, 71.618657 },
-    { 59774, 83895, 34.014350 },
-    { 59774, 84345, 69.717302 },
-    { 59774, 84379, 61.245081 },
-    { 59774, 84380, 51.966017 },
-    { 59774, 85670, 43.219237 },
-    { 59774, 86032, 73.989981 },
-    { 59774, 86742, 81.825970 },
-    { 59774, 87833, 46.820857 },
-    { 59774, 91262, 60.937968 },
-    { 59774, 93194, 68.489010 },
-    { 59774, 94376, 43.531607 },
-    { 59774, 95947, 76.215697 },
-    { 59774, 97165, 63.359929 },
-    { 59774, 100453, 71.098926 },
-    { 59774, 102098, 68.384249 },
-    { 59774, 102488, 78.882035 },
-    { 59774, 105199, 55.585272 },
-    { 59774, 106032, 49.010707 },
-    { 59774, 109492, 62.118956 },
-    { 59774, 116727, 45.219242 },
-    { 59803, 60718, 45.595431 },
-    { 59803, 60965, 3.513856 },
-    { 59803, 61084, 39.674983 },
-    { 59803, 61359, 7.293039 },
-    { 59803, 61585, 51.701403 },
-    { 59803, 61932, 31.847875 },
-    { 59803, 61941, 17.301188 },
-    { 59803, 62322, 50.798517 },
-    { 59803, 62434, 42.542979 },
-    { 59803, 62956, 73.943792 },
-    { 59803, 63090, 23.126315 },
-    { 59803, 63125, 56.652075 },
-    { 59803, 63608, 30.715775 },
-    { 59803, 64962, 15.814583 },
-    { 59803, 65109, 23.907092 },
-    { 59803, 65378, 73.905293 },
-    { 59803, 65474, 17.962199 },
-    { 59803, 66249, 25.756175 },
-    { 59803, 66657, 39.464327 },
-    { 59803, 67301, 69.884054 },
-    { 59803, 67927, 43.387839 },
-    { 59803, 68002, 36.103651 },
-    { 59803, 68702, 47.002101 },
-    { 59803, 68895, 27.117774 },
-    { 59803, 68933, 30.864691 },
-    { 59803, 69673, 47.071266 },
-    { 59803, 71075, 64.344880 },
-    { 59803, 71352, 38.572109 },
-    { 59803, 71681, 50.263896 },
-    { 59803, 71683, 50.263161 },
-    { 59803, 71860, 42.222420 },
-    { 59803, 71908, 53.372861 },
-    { 59803, 72105, 57.436880 },
-    { 59803, 72622, 37.082279 },
-    { 59803, 73273, 42.798536 },
-    { 59803, 73334, 42.498703 },
-    { 59803, 73714, 39.756054 },
-    { 59803, 74785, 44.695946 },
-    { 59803, 74946, 58.495045 },
-    { 59803, 75141, 45.947196 },
-    { 59803, 75264, 47.413520 },
-    { 59803, 76267, 65.470575 },
-    { 59803, 76297, 48.594461 },
-    { 59803, 77070, 56.762085 },
-    { 59803, 77952, 58.988798 },
-    { 59803, 78265, 52.092947 },
-    { 59803, 78401, 52.668484 },
-    { 59803, 78820, 54.171869 },
-    { 59803, 79593, 59.972060 },
-    { 59803, 79882, 60.609718 },
-    { 59803, 80112, 57.141305 },
-    { 59803, 80763, 58.904112 },
-    { 59803, 80816, 73.499381 },
-    { 59803, 81266, 60.176122 },
-    { 59803, 81377, 63.487684 },
-    { 59803, 81693, 80.353880 },
-    { 59803, 82273, 65.914651 },
-    { 59803, 82396, 62.782612 },
-    { 59803, 82514, 62.957039 },
-    { 59803, 83000, 74.605521 },
-    { 59803, 83081, 64.780304 },
-    { 59803, 84012, 70.112740 },
-    { 59803, 84143, 66.613386 },
-    { 59803, 84345, 80.290875 },
-    { 59803, 84970, 70.830043 },
-    { 59803, 85258, 68.502871 },
-    { 59803, 85267, 68.519547 },
-    { 59803, 85696, 70.685528 },
-    { 59803, 85792, 69.657778 },
-    { 59803, 85927, 71.273159 },
-    { 59803, 86228, 71.209102 },
-    { 59803, 86670, 72.715956 },
-    { 59803, 86742, 83.704519 },
-    { 59803, 87073, 73.512576 },
-    { 59803, 87261, 74.480728 },
-    { 59803, 88048, 83.113343 },
-    { 59803, 88635, 79.135392 },
-    { 59803, 89642, 79.961155 },
-    { 59803, 89931, 82.460909 },
-    { 59803, 90185, 81.865213 },
-    { 60718, 60965, 46.587439 },
-    { 60718, 61084, 6.013217 },
-    { 60718, 61359, 39.723931 },
-    { 60718, 61585, 6.129402 },
-    { 60718, 61932, 14.286045 },
-    { 60718, 61941, 61.713133 },
-    { 60718, 62322, 5.401672 },
-    { 60718, 62434, 4.242453 },
-    { 60718, 63090, 66.722215 },
-    { 60718, 63608, 74.376242 },
-    { 60718, 64962, 40.881663 },
-    { 60718, 65109, 27.651047 },
-    { 60718, 65474, 52.980433 },
-    { 60718, 66249, 63.776389 },
-    { 60718, 66657, 13.530348 },
-    { 60718, 67927, 83.308236 },
-    { 60718, 68002, 20.058215 },
-    { 60718, 68702, 11.751002 },
-    { 60718, 68895, 39.913845 },
-    { 60718, 68933, 30.802350 },
-    { 60718, 71352, 28.081918 },
-    { 60718, 71681, 15.613362 },
-    { 60718, 71683, 15.617858 },
-    { 60718, 71860, 24.388014 },
-    { 60718, 71908, 14.808882 },
-    { 60718, 72622, 53.279919 },
-    { 60718, 73273, 29.545445 },
-    { 60718, 73334, 30.464602 },
-    { 60718, 73714, 45.802138 },
-    { 60718, 74785, 61.707785 },
-    { 60718, 74946, 18.026353 },
-    { 60718, 75141, 33.990717 },
-    { 60718, 75264, 30.855157 },
-    { 60718, 76297, 35.042791 },
-    { 60718, 77070, 78.890160 },
-    { 60718, 77952, 22.806370 },
-    { 60718, 78265, 50.456291 },
-    { 60718, 78401, 53.712872 },
-    { 60718, 78820, 56.763899 },
-    { 60718, 79593, 72.315034 },
-    { 60718, 79882, 71.797311 },
-    { 60718, 80112, 53.305940 },
-    { 60718, 80763, 53.471161 },
-    { 60718, 81266, 52.639211 },
-    { 60718, 81377, 68.410515 },
-    { 60718, 82273, 25.864925 },
-    { 60718, 82396, 49.070631 },
-    { 60718, 82514, 46.152998 },
-    { 60718, 83081, 33.485944 },
-    { 60718, 84012, 67.425577 },
-    { 60718, 84143, 44.266173 },
-    { 60718, 84970, 60.598893 },
-    { 60718, 85258, 36.593154 },
-    { 60718, 85267, 36.029787 },
-    { 60718, 85696, 51.157207 },
-    { 60718, 85792, 41.330544 },
-    { 60718, 85927, 51.634695 },
-    { 60718, 86228, 47.251450 },
-    { 60718, 86670, 51.037296 },
-    { 60718, 87073, 50.702124 },
-    { 60718, 87261, 53.495959 },
-    { 60718, 88048, 78.176587 },
-    { 60718, 88635, 60.860536 },
-    { 60718, 89642, 56.776651 },
-    { 60718, 89931, 63.052486 },
-    { 60718, 90185, 59.496972 },
-    { 60718, 90496, 67.643257 },
-    { 60718, 92041, 68.207209 },
-    { 60718, 92855, 69.850229 },
-    { 60718, 93506, 67.487438 },
-    { 60718, 93864, 69.881966 },
-    { 60718, 94141, 76.062850 },
-    { 60718, 100751, 51.503367 },
-    { 60718, 101772, 60.703893 },
-    { 60718, 108085, 75.019101 },
-    { 60718, 109268, 66.572463 },
-    { 60718, 110130, 54.265381 },
-    { 60718, 112122, 68.098711 },
-    { 60965, 61084, 40.598212 },
-    { 60965, 61359, 6.962911 },
-    { 60965, 61585, 52.632990 },
-    { 60965, 61932, 32.531584 },
-    { 60965, 61941, 15.343062 },
-    { 60965, 62322, 51.659981 },
-    { 60965, 62434, 43.296412 },
-    { 60965, 62956, 72.653870 },
-    { 60965, 63090, 20.903593 },
-    { 60965, 63125, 55.175812 },
-    { 60965, 63608, 28.612482 },
-    { 60965, 64962, 13.308135 },
-    { 60965, 65109, 23.109609 },
-    { 60965, 65378, 72.360041 },
-    { 60965, 65474, 14.450975 },
-    { 60965, 66249, 22.549432 },
-    { 60965, 66657, 39.401623 },
-    { 60965, 67301, 68.042755 },
-    { 60965, 67927, 40.674846 },
-    { 60965, 68002, 35.483128 },
-    { 60965, 68702, 47.016673 },
-    { 60965, 68895, 24.568194 },
-    { 60965, 68933, 29.227310 },
-    { 60965, 69673, 44.170820 },
-    { 60965, 71075, 61.858505 },
-    { 60965, 71352, 37.121250 },
-    { 60965, 71681, 50.024160 },
-    { 60965, 71683, 50.023010 },
-    { 60965, 71860, 41.106362 },
-    { 60965, 71908, 53.337775 },
-    { 60965, 72105, 54.536895 },
-    { 60965, 72622, 33.799805 },
-    { 60965, 73273, 41.245106 },
-    { 60965, 73334, 40.865089 },
-    { 60965, 73714, 36.929566 },
-    { 60965, 74785, 41.265236 },
-    { 60965, 74946, 58.480012 },
-    { 60965, 75141, 44.089795 },
-    { 60965, 75264, 45.833270 },
-    { 60965, 75458, 83.490073 },
-    { 60965, 76267, 62.295843 },
-    { 60965, 76297, 46.718124 },
-    { 60965, 77070, 53.256551 },
-    { 60965, 77952, 58.516163 },
-    { 60965, 78265, 49.291643 },
-    { 60965, 78401, 49.710218 },
-    { 60965, 78820, 51.105722 },
-    { 60965, 79593, 56.518845 },
-    { 60965, 79882, 57.174248 },
-    { 60965, 80112, 54.326017 },
-    { 60965, 80763, 56.131757 },
-    { 60965, 80816, 70.079529 },
-    { 60965, 81266, 57.489045 },
-    { 60965, 81377, 60.187169 },
-    { 60965, 81693, 77.080593 },
-    { 60965, 82273, 65.663977 },
-    { 60965, 82396, 60.398875 },
-    { 60965, 82514, 60.772145 },
-    { 60965, 83000, 71.092386 },
-    { 60965, 83081, 63.669411 },
-    { 60965, 84012, 66.999143 },
-    { 60965, 84143, 64.718921 },
-    { 60965, 84345, 76.779411 },
-    { 60965, 84379, 80.812992 },
-    { 60965, 84970, 68.058310 },
-    { 60965, 85258, 67.342998 },
-    { 60965, 85267, 67.412710 },
-    { 60965, 85696, 68.484031 },
-    { 60965, 85792, 68.153046 },
-    { 60965, 85927, 69.065226 },
-    { 60965, 86032, 80.773361 },
-    { 60965, 86228, 69.314898 },
-    { 60965, 86670, 70.617029 },
-    { 60965, 86742, 80.240717 },
-    { 60965, 87073, 71.477080 },
-    { 60965, 87261, 72.292242 },
-    { 60965, 88048, 79.920674 },
-    { 60965, 88635, 76.669132 },
-    { 60965, 89642, 77.811837 },
-    { 60965, 89931, 80.003591 },
-    { 60965, 90185, 79.618982 },
-    { 60965, 90496, 82.577309 },
-    { 61084, 61359, 33.721028 },
-    { 61084, 61585, 12.041296 },
-    { 61084, 61932, 8.298382 },
-    { 61084, 61941, 55.702569 },
-    { 61084, 62322, 11.126980 },
-    { 61084, 62434, 3.366268 },
-    { 61084, 63090, 60.712686 },
-    { 61084, 63608, 68.372371 },
-    { 61084, 64962, 35.033808 },
-    { 61084, 65109, 21.998803 },
-    { 61084, 65474, 47.114538 },
-    { 61084, 66249, 57.929180 },
-    { 61084, 66657, 10.406073 },
-    { 61084, 67927, 77.504927 },
-    { 61084, 68002, 16.125477 },
-    { 61084, 68702, 12.381865 },
-    { 61084, 68895, 34.816984 },
-    { 61084, 68933, 26.137164 },
-    { 61084, 69673, 79.371438 },
-    { 61084, 71352, 24.724830 },
-    { 61084, 71681, 16.787722 },
-    { 61084, 71683, 16.790897 },
-    { 61084, 71860, 21.967085 },
-    { 61084, 71908, 17.465103 },
-    { 61084, 72622, 48.708167 },
-    { 61084, 73273, 26.969011 },
-    { 61084, 73334, 27.776739 },
-    { 61084, 73714, 41.898422 },
-    { 61084, 74785, 57.426423 },
-    { 61084, 74946, 21.700644 },
-    { 61084, 75141, 31.733503 },
-    { 61084, 75264, 29.139496 },
-    { 61084, 76297, 33.202432 },
-    { 61084, 77070, 74.624620 },
-    { 61084, 77952, 25.322593 },
-    { 61084, 78265, 47.908460 },
-    { 61084, 78401, 50.982160 },
-    { 61084, 78820, 53.990683 },
-    { 61084, 79593, 68.978897 },
-    { 61084, 79882, 68.585502 },
-    { 61084, 80112, 51.257176 },
-    { 61084, 80763, 51.674142 },
-    { 61084, 81266, 51.120796 },
-    { 61084, 81377, 65.876174 },
-    { 61084, 82273, 29.754450 },
-    { 61084, 82396, 48.357867 },
-    { 61084, 82514, 45.808227 },
-    { 61084, 83081, 35.370217 },
-    { 61084, 84012, 65.918318 },
-    { 61084, 84143, 44.851008 },
-    { 61084, 84970, 59.924871 },
-    { 61084, 85258, 38.793494 },
-    { 61084, 85267, 38.338452 },
-    { 61084, 85696, 51.585039 },
-    { 61084, 85792, 42.972822 },
-    { 61084, 85927, 52.106243 },
-    { 61084, 86228, 48.307883 },
-    { 61084, 86670, 51.849962 },
-    { 61084, 87073, 51.707764 },
-    { 61084, 87261, 54.298004 },
-    { 61084, 88048, 77.447119 },
-    { 61084, 88635, 61.514676 },
-    { 61084, 89642, 58.112859 },
-    { 61084, 89931, 63.986372 },
-    { 61084, 90185, 60.796943 },
-    { 61084, 90496, 68.450188 },
-    { 61084, 92041, 69.479554 },
-    { 61084, 92855, 71.281162 },
-    { 61084, 93506, 69.270967 },
-    { 61084, 93864, 71.627602 },
-    { 61084, 94141, 77.508259 },
-    { 61084, 100751, 55.980533 },
-    { 61084, 101772, 64.908043 },
-    { 61084, 108085, 79.879854 },
-    { 61084, 109268, 71.764226 },
-    { 61084, 110130, 59.758355 },
-    { 61084, 112122, 73.579117 },
-    { 61359, 61585, 45.740859 },
-    { 61359, 61932, 25.601984 },
-    { 61359, 61941, 22.017935 },
-    { 61359, 62322, 44.748979 },
-    { 61359, 62434, 36.367915 },
-    { 61359, 62956, 79.466355 },
-    { 61359, 63090, 27.288820 },
-    { 61359, 63125, 61.923428 },
-    { 61359, 63608, 35.021890 },
-    { 61359, 64962, 10.226620 },
-    { 61359, 65109, 16.622671 },
-    { 61359, 65378, 79.039097 },
-    { 61359, 65474, 17.205356 },
-    { 61359, 66249, 27.093187 },
-    { 61359, 66657, 32.514627 },
-    { 61359, 67301, 74.514980 },
-    { 61359, 67927, 46.161809 },
-    { 61359, 68002, 28.873201 },
-    { 61359, 68702, 40.113206 },
-    { 61359, 68895, 21.062450 },
-    { 61359, 68933, 23.744332 },
-    { 61359, 69673, 49.231163 },
-    { 61359, 71075, 67.596389 },
-    { 61359, 71352, 31.345235 },
-    { 61359, 71681, 43.213722 },
-    { 61359, 71683, 43.212753 },
-    { 61359, 71860, 34.930714 },
-    { 61359, 71908, 46.453075 },
-    { 61359, 72105, 59.513353 },
-    { 61359, 72622, 32.868880 },
-    { 61359, 73273, 35.601114 },
-    { 61359, 73334, 35.336668 },
-    { 61359, 73714, 34.038157 },
-    { 61359, 74785, 41.262980 },
-    { 61359, 74946, 51.592160 },
-    { 61359, 75141, 38.902700 },
-    { 61359, 75264, 40.218835 },
-    { 61359, 76267, 66.395489 },
-    { 61359, 76297, 41.555005 },
-    { 61359, 77070, 55.105906 },
-    { 61359, 77952, 51.830708 },
-    { 61359, 78265, 46.203275 },
-    { 61359, 78401, 47.135254 },
-    { 61359, 78820, 48.923854 },
-    { 61359, 79593, 56.561574 },
-    { 61359, 79882, 57.029917 },
-    { 61359, 80112, 51.246383 },
-    { 61359, 80763, 52.911768 },
-    { 61359, 80816, 72.848873 },
-    { 61359, 81266, 54.018358 },
-    { 61359, 81377, 59.039507 },
-    { 61359, 81693, 80.665950 },
-    { 61359, 82273, 58.868570 },
-    { 61359, 82396, 56.167616 },
-    { 61359, 82514, 56.126849 },
-    { 61359, 83000, 72.169292 },
-    { 61359, 83081, 57.487288 },
-    { 61359, 84012, 64.896914 },
-    { 61359, 84143, 59.548035 },
-    { 61359, 84345, 78.204876 },
-    { 61359, 84379, 83.347635 },
-    { 61359, 84970, 64.776100 },
-    { 61359, 85258, 61.210222 },
-    { 61359, 85267, 61.226640 },
-    { 61359, 85696, 63.851307 },
-    { 61359, 85792, 62.415670 },
-    { 61359, 85927, 64.443637 },
-    { 61359, 86032, 81.753399 },
-    { 61359, 86228, 64.136439 },
-    { 61359, 86670, 65.786822 },
-    { 61359, 86742, 80.214711 },
-    { 61359, 87073, 66.532173 },
-    { 61359, 87261, 67.625668 },
-    { 61359, 88048, 78.088372 },
-    { 61359, 88635, 72.571551 },
-    { 61359, 89642, 73.060003 },
-    { 61359, 89931, 75.876240 },
-    { 61359, 90185, 75.048444 },
-    { 61359, 90496, 78.833353 },
-    { 61359, 92041, 81.950695 },
-    { 61585, 61932, 20.182597 },
-    { 61585, 61941, 67.690228 },
-    { 61585, 62322, 1.319983 },
-    { 61585, 62434, 9.512883 },
-    { 61585, 63090, 72.602081 },
-    { 61585, 63608, 80.215440 },
-    { 61585, 64962, 46.394081 },
-    { 61585, 65109, 32.965259 },
-    { 61585, 65474, 58.489064 },
-    { 61585, 66249, 69.224715 },
-    { 61585, 66657, 17.263245 },
-    { 61585, 68002, 23.908104 },
-    { 61585, 68702, 12.605377 },
-    { 61585, 68895, 44.436100 },
-    { 61585, 68933, 34.986551 },
-    { 61585, 71352, 31.044126 },
-    { 61585, 71681, 15.128915 },
-    { 61585, 71683, 15.134152 },
-    { 61585, 71860, 26.622217 },
-    { 61585, 71908, 12.736764 },
-    { 61585, 72622, 57.050677 },
-    { 61585, 73273, 31.690661 },
-    { 61585, 73334, 32.684777 },
-    { 61585, 73714, 48.913184 },
-    { 61585, 74785, 65.058193 },
-    { 61585, 74946, 14.293779 },
-    { 61585, 75141, 35.660394 },
-    { 61585, 75264, 32.096453 },
-    { 61585, 76297, 36.258518 },
-    { 61585, 77070, 82.077373 },
-    { 61585, 77952, 20.079040 },
-    { 61585, 78265, 52.042773 },
-    { 61585, 78401, 55.440471 },
-    { 61585, 78820, 58.491846 },
-    { 61585, 79593, 74.475368 },
-    { 61585, 79882, 73.823276 },
-    { 61585, 80112, 54.319712 },
-    { 61585, 80763, 54.219095 },
-    { 61585, 81266, 53.111985 },
-    { 61585, 81377, 69.729320 },
-    { 61585, 82273, 21.463142 },
-    { 61585, 82396, 48.781674 },
-    { 61585, 82514, 45.549434 },
-    { 61585, 83081, 30.947228 },
-    { 61585, 84012, 67.665061 },
-    { 61585, 84143, 42.761257 },
-    { 61585, 84970, 60.073494 },
-    { 61585, 85258, 33.637956 },
-    { 61585, 85267, 32.978874 },
-    { 61585, 85696, 49.671832 },
-    { 61585, 85792, 38.824796 },
-    { 61585, 85927, 50.096852 },
-    { 61585, 86228, 45.209014 },
-    { 61585, 86670, 49.168469 },
-    { 61585, 87073, 48.646719 },
-    { 61585, 87261, 51.595864 },
-    { 61585, 88048, 77.479519 },
-    { 61585, 88635, 58.996013 },
-    { 61585, 89642, 54.299053 },
-    { 61585, 89931, 60.883180 },
-    { 61585, 90185, 57.017166 },
-    { 61585, 90496, 65.540538 },
-    { 61585, 92041, 65.646928 },
-    { 61585, 92855, 67.119941 },
-    { 61585, 93506, 64.448226 },
-    { 61585, 93864, 66.853358 },
-    { 61585, 94141, 73.254181 },
-    { 61585, 100751, 46.189932 },
-    { 61585, 101772, 55.563176 },
-    { 61585, 108085, 69.337964 },
-    { 61585, 109268, 60.696450 },
-    { 61585, 110130, 48.238202 },
-    { 61585, 112122, 62.066343 },
-    { 61585, 113368, 79.572264 },
-    { 61932, 61941, 47.510374 },
-    { 61932, 62322, 19.157433 },
-    { 61932, 62434, 10.766124 },
-    { 61932, 63090, 52.447004 },
-    { 61932, 63608, 60.092131 },
-    { 61932, 64962, 26.825325 },
-    { 61932, 65109, 14.162643 },
-    { 61932, 65474, 38.875745 },
-    { 61932, 66249, 49.699000 },
-    { 61932, 66657, 10.165840 },
-    { 61932, 67927, 69.299386 },
-    { 61932, 68002, 12.433461 },
-    { 61932, 68702, 16.358206 },
-    { 61932, 68895, 27.673882 },
-    { 61932, 68933, 19.971608 },
-    { 61932, 69673, 71.299132 },
-    { 61932, 71352, 20.934306 },
-    { 61932, 71681, 20.444369 },
-    { 61932, 71683, 20.445580 },
-    { 61932, 71860, 20.003697 },
-    { 61932, 71908, 22.575174 },
-    { 61932, 72105, 80.877947 },
-    { 61932, 72622, 42.134779 },
-    { 61932, 73273, 24.254399 },
-    { 61932, 73334, 24.823454 },
-    { 61932, 73714, 36.425729 },
-    { 61932, 74785, 51.147822 },
-    { 61932, 74946, 27.471691 },
-    { 61932, 75141, 29.173176 },
-    { 61932, 75264, 27.564354 },
-    { 61932, 76297, 31.175576 },
-    { 61932, 77070, 68.198657 },
-    { 61932, 77952, 29.593293 },
-    { 61932, 78265, 44.259548 },
-    { 61932, 78401, 46.992656 },
-    { 61932, 78820, 49.872127 },
-    { 61932, 79593, 63.830452 },
-    { 61932, 79882, 63.609153 },
-    { 61932, 80112, 48.227924 },
-    { 61932, 80763, 48.988928 },
-    { 61932, 81266, 48.842908 },
-    { 61932, 81377, 61.860218 },
-    { 61932, 82273, 35.374545 },
-    { 61932, 82396, 47.291804 },
-    { 61932, 82514, 45.339449 },
-    { 61932, 83000, 80.750390 },
-    { 61932, 83081, 38.313070 },
-    { 61932, 84012, 63.308433 },
-    { 61932, 84143, 45.691878 },
-    { 61932, 84970, 58.594914 },
-    { 61932, 85258, 42.000204 },
-    { 61932, 85267, 41.701447 },
-    { 61932, 85696, 51.994897 },
-    { 61932, 85792, 45.298758 },
-    { 61932, 85927, 52.560897 },
-    { 61932, 86228, 49.673170 },
-    { 61932, 86670, 52.778402 },
-    { 61932, 87073, 52.903241 },
-    { 61932, 87261, 55.144128 },
-    { 61932, 88048, 75.680938 },
-    { 61932, 88635, 61.978043 },
-    { 61932, 89642, 59.592892 },
-    { 61932, 89931, 64.779037 },
-    { 61932, 90185, 62.164663 },
-    { 61932, 90496, 68.972587 },
-    { 61932, 92041, 70.624566 },
-    { 61932, 92855, 72.610616 },
-    { 61932, 93506, 71.129065 },
-    { 61932, 93864, 73.388033 },
-    { 61932, 94141, 78.740688 },
-    { 61932, 100751, 61.796692 },
-    { 61932, 101772, 70.229687 },
-    { 61932, 109268, 78.480442 },
-    { 61932, 110130, 67.009814 },
-    { 61932, 112122, 80.744712 },
-    { 61941, 62322, 66.663286 },
-    { 61941, 62434, 58.251076 },
-    { 61941, 62956, 57.464680 },
-    { 61941, 63090, 5.969204 },
-    { 61941, 63125, 39.905504 },
-    { 61941, 63608, 13.415918 },
-    { 61941, 64962, 23.526434 },
-    { 61941, 65109, 36.391814 },
-    { 61941, 65378, 57.042366 },
-    { 61941, 65474, 14.526018 },
-    { 61941, 66249, 13.282514 },
-    { 61941, 66657, 53.392476 },
-    { 61941, 67301, 52.713965 },
-    { 61941, 67927, 26.765452 },
-    { 61941, 68002, 48.565983 },
-    { 61941, 68702, 61.002754 },
-    { 61941, 68895, 32.406210 },
-    { 61941, 68933, 40.075092 },
-    { 61941, 69673, 30.961136 },
-    { 61941, 71075, 47.197545 },
-    { 61941, 71352, 48.049982 },
-    { 61941, 71681, 63.509269 },
-    { 61941, 71683, 63.507341 },
-    { 61941, 71860, 52.816873 },
-    { 61941, 71908, 67.146956 },
-    { 61941, 72105, 41.163458 },
-    { 61941, 72607, 78.084265 },
-    { 61941, 72622, 35.010216 },
-    { 61941, 73273, 51.643468 },
-    { 61941, 73334, 51.013959 },
-    { 61941, 73714, 41.774007 },
-    { 61941, 74785, 39.429345 },
-    { 61941, 74946, 72.254666 },
-    { 61941, 75097, 77.552989 },
-    { 61941, 75141, 53.263174 },
-    { 61941, 75264, 55.931083 },
-    { 61941, 75458, 68.384683 },
-    { 61941, 76267, 50.283631 },
-    { 61941, 76297, 55.686305 },
-    { 61941, 77070, 46.243466 },
-    { 61941, 77952, 71.356717 },
-    { 61941, 78265, 53.378746 },
-    { 61941, 78401, 52.628765 },
-    { 61941, 78820, 53.043504 },
-    { 61941, 79593, 53.156038 },
-    { 61941, 79882, 54.169133 },
-    { 61941, 80112, 58.021421 },
-    { 61941, 80331, 75.684236 },
-    { 61941, 80763, 60.022724 },
-    { 61941, 80816, 60.299885 },
-    { 61941, 81266, 61.867272 },
-    { 61941, 81377, 59.159774 },
-    { 61941, 81693, 65.564395 },
-    { 61941, 82273, 78.873325 },
-    { 61941, 82396, 66.397607 },
-    { 61941, 82514, 67.760413 },
-    { 61941, 83000, 64.644113 },
-    { 61941, 83081, 74.692814 },
-    { 61941, 83895, 82.007544 },
-    { 61941, 84012, 67.660561 },
-    { 61941, 84143, 72.866465 },
-    { 61941, 84345, 69.353311 },
-    { 61941, 84379, 71.082979 },
-    { 61941, 84380, 73.728190 },
-    { 61941, 84970, 71.379802 },
-    { 61941, 85258, 78.116887 },
-    { 61941, 85267, 78.351867 },
-    { 61941, 85670, 80.389713 },
-    { 61941, 85696, 75.080966 },
-    { 61941, 85792, 77.725307 },
-    { 61941, 85927, 75.607817 },
-    { 61941, 86032, 74.060631 },
-    { 61941, 86228, 77.299830 },
-    { 61941, 86670, 77.629578 },
-    { 61941, 86742, 75.622675 },
-    { 61941, 87073, 78.754786 },
-    { 61941, 87261, 78.808696 },
-    { 61941, 88048, 79.249536 },
-    { 61941, 88635, 81.539181 },
-    { 62322, 62434, 8.420817 },
-    { 62322, 63090, 71.524310 },
-    { 62322, 63608, 79.118566 },
-    { 62322, 64962, 45.217504 },
-    { 62322, 65109, 31.762008 },
-    { 62322, 65474, 57.305684 },
-    { 62322, 66249, 68.025175 },
-    { 62322, 66657, 15.954318 },
-    { 62322, 68002, 22.595311 },
-    { 62322, 68702, 11.347812 },
-    { 62322, 68895, 43.140951 },
-    { 62322, 68933, 33.678695 },
-    { 62322, 71352, 29.729885 },
-    { 62322, 71681, 14.026588 },
-    { 62322, 71683, 14.031778 },
-    { 62322, 71860, 25.330081 },
-    { 62322, 71908, 11.860133 },
-    { 62322, 72622, 55.730840 },
-    { 62322, 73273, 30.408553 },
-    { 62322, 73334, 31.399617 },
-    { 62322, 73714, 47.600273 },
-    { 62322, 74785, 63.742087 },
-    { 62322, 74946, 13.836536 },
-    { 62322, 75141, 34.412812 },
-    { 62322, 75264, 30.878038 },
-    { 62322, 76297, 35.048252 },
-    { 62322, 77070, 80.767295 },
-    { 62322, 77952, 19.408829 },
-    { 62322, 78265, 50.815448 },
-    { 62322, 78401, 54.203911 },
-    { 62322, 78820, 57.256953 },
-    { 62322, 79593, 73.215372 },
-    { 62322, 79882, 72.572549 },
-    { 62322, 80112, 53.146317 },
-    { 62322, 80763, 53.073359 },
-    { 62322, 81266, 51.996167 },
-    { 62322, 81377, 68.536008 },
-    { 62322, 82273, 21.260758 },
-    { 62322, 82396, 47.758043 },
-    { 62322, 82514, 44.566444 },
-    { 62322, 83081, 30.280148 },
-    { 62322, 84012, 66.589282 },
-    { 62322, 84143, 41.919070 },
-    { 62322, 84970, 59.095403 },
-    { 62322, 85258, 33.070967 },
-    { 62322, 85267, 32.432815 },
-    { 62322, 85696, 48.836332 },
-    { 62322, 85792, 38.168976 },
-    { 62322, 85927, 49.271148 },
-    { 62322, 86228, 44.470026 },
-    { 62322, 86670, 48.401960 },
-    { 62322, 87073, 47.915228 },
-    { 62322, 87261, 50.838420 },
-    { 62322, 88048, 76.541741 },
-    { 62322, 88635, 58.240381 },
-    { 62322, 89642, 53.660236 },
-    { 62322, 89931, 60.188499 },
-    { 62322, 90185, 56.381896 },
-    { 62322, 90496, 64.837274 },
-    { 62322, 92041, 65.037426 },
-    { 62322, 92855, 66.548594 },
-    { 62322, 93506, 63.944302 },
-    { 62322, 93864, 66.349153 },
-    { 62322, 94141, 72.705522 },
-    { 62322, 100751, 46.375705 },
-    { 62322, 101772, 55.681218 },
-    { 62322, 108085, 69.714026 },
-    { 62322, 109268, 61.193316 },
-    { 62322, 110130, 48.864511 },
-    { 62322, 112122, 62.697953 },
-    { 62322, 113368, 80.198240 },
-    { 62434, 63090, 63.105492 },
-    { 62434, 63608, 70.707672 },
-    { 62434, 64962, 36.928638 },
-    { 62434, 65109, 23.579255 },
-    { 62434, 65474, 49.030504 },
-    { 62434, 66249, 59.795639 },
-    { 62434, 66657, 9.474356 },
-    { 62434, 67927, 79.273341 },
-    { 62434, 68002, 15.889613 },
-    { 62434, 68702, 9.495184 },
-    { 62434, 68895, 35.677498 },
-    { 62434, 68933, 26.565671 },
-    { 62434, 69673, 80.893917 },
-    { 62434, 71352, 24.085846 },
-    { 62434, 71681, 13.821188 },
-    { 62434, 71683, 13.824793 },
-    { 62434, 71860, 20.692862 },
-    { 62434, 71908, 14.181791 },
-    { 62434, 72622, 49.062185 },
-    { 62434, 73273, 25.820179 },
-    { 62434, 73334, 26.701450 },
-    { 62434, 73714, 41.700120 },
-    { 62434, 74785, 57.538486 },
-    { 62434, 74946, 18.338891 },
-    { 62434, 75141, 30.412718 },
-    { 62434, 75264, 27.502440 },
-    { 62434, 76297, 31.651368 },
-    { 62434, 77070, 74.732458 },
-    { 62434, 77952, 22.105176 },
-    { 62434, 78265, 46.803767 },
-    { 62434, 78401, 49.994327 },
-    { 62434, 78820, 53.033892 },
-    { 62434, 79593, 68.403106 },
-    { 62434, 79882, 67.926659 },
-    { 62434, 80112, 49.870175 },
-    { 62434, 80763, 50.150443 },
-    { 62434, 81266, 49.449623 },
-    { 62434, 81377, 64.791079 },
-    { 62434, 82273, 26.390993 },
-    { 62434, 82396, 46.289807 },
-    { 62434, 82514, 43.570888 },
-    { 62434, 83081, 32.329320 },
-    { 62434, 84012, 64.267585 },
-    { 62434, 84143, 42.242577 },
-    { 62434, 84970, 57.862982 },
-    { 62434, 85258, 35.683866 },
-    { 62434, 85267, 35.203025 },
-    { 62434, 85696, 49.050275 },
-    { 62434, 85792, 40.017294 },
-    { 62434, 85927, 49.556202 },
-    { 62434, 86228, 45.544105 },
-    { 62434, 86670, 49.176307 },
-    { 62434, 87073, 48.967865 },
-    { 62434, 87261, 51.632828 },
-    { 62434, 88048, 75.437808 },
-    { 62434, 88635, 58.914820 },
-    { 62434, 89642, 55.277218 },
-    { 62434, 89931, 61.291805 },
-    { 62434, 90185, 57.976849 },
-    { 62434, 90496, 65.806358 },
-    { 62434, 92041, 66.680455 },
-    { 62434, 92855, 68.434418 },
-    { 62434, 93506, 66.317294 },
-    { 62434, 93864, 68.687468 },
-    { 62434, 94141, 74.664549 },
-    { 62434, 100751, 52.618543 },
-    { 62434, 101772, 61.542654 },
-    { 62434, 108085, 76.543370 },
-    { 62434, 109268, 68.493315 },
-    { 62434, 110130, 56.603040 },
-    { 62434, 112122, 70.407192 },
-    { 62956, 63090, 52.563204 },
-    { 62956, 63125, 17.644769 },
-    { 62956, 63608, 45.028902 },
-    { 62956, 64962, 79.308143 },
-    { 62956, 65378, 4.361531 },
-    { 62956, 65474, 67.436029 },
-    { 62956, 66249, 57.157254 },
-    { 62956, 67301, 10.462028 },
-    { 62956, 67927, 39.266866 },
-    { 62956, 69673, 39.841114 },
-    { 62956, 71075, 24.031009 },
-    { 62956, 72105, 35.085057 },
-    { 62956, 72607, 21.469385 },
-    { 62956, 72622, 76.079942 },
-    { 62956, 74785, 71.750701 },
-    { 62956, 75097, 21.979918 },
-    { 62956, 75458, 20.232955 },
-    { 62956, 76267, 41.006905 },
-    { 62956, 77070, 59.837231 },
-    { 62956, 79593, 72.236728 },
-    { 62956, 79882, 73.575637 },
-    { 62956, 80331, 27.015351 },
-    { 62956, 80816, 52.456910 },
-    { 62956, 81377, 80.939587 },
-    { 62956, 81693, 45.959306 },
-    { 62956, 83000, 66.203312 },
-    { 62956, 83895, 30.978634 },
-    { 62956, 84345, 64.293821 },
-    { 62956, 84379, 55.891562 },
-    { 62956, 84380, 46.836638 },
-    { 62956, 85670, 38.943928 },
-    { 62956, 86032, 68.589516 },
-    { 62956, 86742, 76.404907 },
-    { 62956, 87833, 42.707764 },
-    { 62956, 91262, 56.526529 },
-    { 62956, 93194, 64.059671 },
-    { 62956, 93747, 80.120727 },
-    { 62956, 94376, 41.472014 },
-    { 62956, 95947, 71.959749 },
-    { 62956, 97165, 59.986220 },
-    { 62956, 100453, 67.969277 },
-    { 62956, 102098, 65.738881 },
-    { 62956, 102488, 75.833717 },
-    { 62956, 104732, 81.857614 },
-    { 62956, 105199, 54.296137 },
-    { 62956, 106032, 48.315102 },
-    { 62956, 109492, 61.251955 },
-    { 62956, 116727, 45.907014 },
-    { 63090, 63125, 34.920781 },
-    { 63090, 63608, 7.734921 },
-    { 63090, 64962, 27.170393 },
-    { 63090, 65109, 40.530613 },
-    { 63090, 65378, 51.847110 },
-    { 63090, 65474, 16.313099 },
-    { 63090, 66249, 10.551952 },
-    { 63090, 66657, 57.617297 },
-    { 63090, 67301, 47.228327 },
-    { 63090, 67927, 20.832283 },
-    { 63090, 68002, 52.370639 },
-    { 63090, 68702, 65.148523 },
-    { 63090, 68895, 34.598602 },
-    { 63090, 68933, 43.087674 },
-    { 63090, 69673, 25.133684 },
-    { 63090, 71075, 41.264608 },
-    { 63090, 71352, 50.874203 },
-    { 63090, 71681, 67.332874 },
-    { 63090, 71683, 67.330520 },
-    { 63090, 71860, 55.889472 },
-    { 63090, 71908, 71.127473 },
-    { 63090, 72105, 35.263606 },
-    { 63090, 72607, 72.788092 },
-    { 63090, 72622, 34.494267 },
-    { 63090, 73273, 54.150387 },
-    { 63090, 73334, 53.427166 },
-    { 63090, 73714, 42.337167 },
-    { 63090, 74785, 37.472570 },
-    { 63090, 74946, 76.168459 },
-    { 63090, 75097, 72.109555 },
-    { 63090, 75141, 55.201089 },
-    { 63090, 75264, 58.209330 },
-    { 63090, 75458, 62.612993 },
-    { 63090, 76267, 44.601185 },
-    { 63090, 76297, 57.477210 },
-    { 63090, 77070, 42.106431 },
-    { 63090, 77952, 74.730556 },
-    { 63090, 78265, 53.223946 },
-    { 63090, 78401, 52.034217 },
-    { 63090, 78820, 52.051963 },
-    { 63090, 79593, 50.156068 },
-    { 63090, 79882, 51.274257 },
-    { 63090, 80112, 57.578825 },
-    { 63090, 80331, 69.843823 },
-    { 63090, 80763, 59.605365 },
-    { 63090, 80816, 55.095402 },
-    { 63090, 81266, 61.598500 },
-    { 63090, 81377, 56.870214 },
-    { 63090, 81693, 59.914040 },
-    { 63090, 82273, 82.380311 },
-    { 63090, 82396, 66.684383 },
-    { 63090, 82514, 68.433381 },
-    { 63090, 83000, 60.369131 },
-    { 63090, 83081, 77.075307 },
-    { 63090, 83895, 76.200472 },
-    { 63090, 84012, 65.808313 },
-    { 63090, 84143, 73.940076 },
-    { 63090, 84345, 64.720365 },
-    { 63090, 84379, 65.807437 },
-    { 63090, 84380, 67.972759 },
-    { 63090, 84970, 70.472748 },
-    { 63090, 85258, 80.325423 },
-    { 63090, 85267, 80.639159 },
-    { 63090, 85670, 74.420733 },
-    { 63090, 85696, 75.439292 },
-    { 63090, 85792, 79.361473 },
-    { 63090, 85927, 75.932741 },
-    { 63090, 86032, 69.584244 },
-    { 63090, 86228, 78.219536 },
-    { 63090, 86670, 78.117297 },
-    { 63090, 86742, 71.773689 },
-    { 63090, 87073, 79.336587 },
-    { 63090, 87261, 79.061046 },
-    { 63090, 87833, 78.192065 },
-    { 63090, 88048, 76.682178 },
-    { 63090, 88635, 81.050612 },
-    { 63090, 89962, 81.626536 },
-    { 63125, 63608, 27.393683 },
-    { 63125, 64962, 61.723779 },
-    { 63125, 65109, 75.244388 },
-    { 63125, 65378, 17.263153 },
-    { 63125, 65474, 49.946927 },
-    { 63125, 66249, 39.919293 },
-    { 63125, 67301, 14.354970 },
-    { 63125, 67927, 23.662897 },
-    { 63125, 68895, 67.054565 },
-    { 63125, 68933, 76.449326 },
-    { 63125, 69673, 25.778810 },
-    { 63125, 71075, 18.787253 },
-    { 63125, 71352, 83.596570 },
-    { 63125, 72105, 25.400345 },
-    { 63125, 72607, 38.332705 },
-    { 63125, 72622, 60.660740 },
-    { 63125, 73714, 70.319909 },
-    { 63125, 74785, 57.919642 },
-    { 63125, 75097, 38.133052 },
-    { 63125, 75458, 31.421071 },
-    { 63125, 76267, 35.091632 },
-    { 63125, 77070, 49.590646 },
-    { 63125, 78265, 77.345735 },
-    { 63125, 78401, 74.698120 },
-    { 63125, 78820, 73.140493 },
-    { 63125, 79593, 62.113735 },
-    { 63125, 79882, 63.519556 },
-    { 63125, 80112, 79.939441 },
-    { 63125, 80331, 39.159156 },
-    { 63125, 80763, 81.753220 },
-    { 63125, 80816, 48.632001 },
-    { 63125, 81377, 71.000315 },
-    { 63125, 81693, 45.931139 },
-    { 63125, 83000, 61.102662 },
-    { 63125, 83895, 44.707550 },
-    { 63125, 84012, 80.333723 },
-    { 63125, 84345, 61.352640 },
-    { 63125, 84379, 55.655159 },
-    { 63125, 84380, 50.252636 },
-    { 63125, 85670, 48.268145 },
-    { 63125, 86032, 66.409284 },
-    { 63125, 86742, 72.970943 },
-    { 63125, 87833, 52.380078 },
-    { 63125, 91262, 63.943004 },
-    { 63125, 93194, 70.944931 },
-    { 63125, 93747, 83.257835 },
-    { 63125, 94376, 56.494377 },
-    { 63125, 95947, 79.268696 },
-    { 63125, 97165, 71.209066 },
-    { 63125, 100453, 79.586832 },
-    { 63125, 102098, 78.724303 },
-    { 63125, 105199, 70.127630 },
-    { 63125, 106032, 64.952979 },
-    { 63125, 109492, 77.505468 },
-    { 63125, 116727, 63.454471 },
-    { 63608, 64962, 34.375541 },
-    { 63608, 65109, 47.867814 },
-    { 63608, 65378, 44.175325 },
-    { 63608, 65474, 22.847326 },
-    { 63608, 66249, 14.100856 },
-    { 63608, 66657, 64.925783 },
-    { 63608, 67301, 39.493833 },
-    { 63608, 67927, 14.706031 },
-    { 63608, 68002, 59.450419 },
-    { 63608, 68702, 72.384267 },
-    { 63608, 68895, 40.741047 },
-    { 63608, 68933, 49.707276 },
-    { 63608, 69673, 19.534740 },
-    { 63608, 71075, 33.930702 },
-    { 63608, 71352, 57.270686 },
-    { 63608, 71681, 74.351324 },
-    { 63608, 71683, 74.348689 },
-    { 63608, 71860, 62.432049 },
-    { 63608, 71908, 78.236094 },
-    { 63608, 72105, 29.047651 },
-    { 63608, 72607, 65.074600 },
-    { 63608, 72622, 38.107988 },
-    { 63608, 73273, 60.257227 },
-    { 63608, 73334, 59.463506 },
-    { 63608, 73714, 46.849653 },
-    { 63608, 74785, 39.213667 },
-    { 63608, 74946, 83.212228 },
-    { 63608, 75097, 64.375621 },
-    { 63608, 75141, 60.800892 },
-    { 63608, 75264, 64.077036 },
-    { 63608, 75458, 54.970936 },
-    { 63608, 76267, 39.165558 },
-    { 63608, 76297, 62.913137 },
-    { 63608, 77070, 40.280984 },
-    { 63608, 77952, 81.380755 },
-    { 63608, 78265, 56.725414 },
-    { 63608, 78401, 55.052998 },
-    { 63608, 78820, 54.592778 },
-    { 63608, 79593, 50.000210 },
-    { 63608, 79882, 51.249722 },
-    { 63608, 80112, 60.662393 },
-    { 63608, 80331, 62.274979 },
-    { 63608, 80763, 62.680377 },
-    { 63608, 80816, 50.807505 },
-    { 63608, 81266, 64.811372 },
-    { 63608, 81377, 57.595929 },
-    { 63608, 81693, 54.417020 },
-    { 63608, 82396, 70.447296 },
-    { 63608, 82514, 72.595251 },
-    { 63608, 83000, 57.879657 },
-    { 63608, 83081, 82.857875 },
-    { 63608, 83895, 68.591724 },
-    { 63608, 84012, 66.957533 },
-    { 63608, 84143, 78.457476 },
-    { 63608, 84345, 61.494616 },
-    { 63608, 84379, 61.224340 },
-    { 63608, 84380, 62.088960 },
-    { 63608, 84970, 72.764872 },
-    { 63608, 85670, 67.394304 },
-    { 63608, 85696, 79.155853 },
-    { 63608, 85927, 79.604691 },
-    { 63608, 86032, 66.584839 },
-    { 63608, 86228, 82.519418 },
-    { 63608, 86670, 81.942878 },
-    { 63608, 86742, 69.839101 },
-    { 63608, 87073, 83.251183 },
-    { 63608, 87261, 82.607006 },
-    { 63608, 87833, 71.259246 },
-    { 63608, 88048, 76.645696 },
-    { 63608, 88635, 83.692458 },
-    { 63608, 89962, 80.543780 },
-    { 63608, 91262, 78.275762 },
-    { 63608, 93194, 83.434458 },
-    { 63608, 94376, 80.853602 },
-    { 64962, 65109, 13.545514 },
-    { 64962, 65378, 78.104197 },
-    { 64962, 65474, 12.102824 },
-    { 64962, 66249, 22.898173 },
-    { 64962, 66657, 30.553895 },
-    { 64962, 67301, 72.764936 },
-    { 64962, 67927, 42.477251 },
-    { 64962, 68002, 25.207602 },
-    { 64962, 68702, 38.017913 },
-    { 64962, 68895, 11.309978 },
-    { 64962, 68933, 16.750520 },
-    { 64962, 69673, 44.564827 },
-    { 64962, 71075, 63.830168 },
-    { 64962, 71352, 24.783662 },
-    { 64962, 71681, 40.176954 },
-    { 64962, 71683, 40.174694 },
-    { 64962, 71860, 29.352637 },
-    { 64962, 71908, 43.957294 },
-    { 64962, 72105, 54.376845 },
-    { 64962, 72622, 22.765994 },
-    { 64962, 73273, 28.653106 },
-    { 64962, 73334, 28.152894 },
-    { 64962, 73714, 24.027035 },
-    { 64962, 74785, 31.414286 },
-    { 64962, 74946, 49.001891 },
-    { 64962, 75141, 31.060072 },
-    { 64962, 75264, 33.143866 },
-    { 64962, 76267, 59.709687 },
-    { 64962, 76297, 33.654767 },
-    { 64962, 77070, 46.220740 },
-    { 64962, 77952, 47.836937 },
-    { 64962, 78265, 36.320752 },
-    { 64962, 78401, 37.056274 },
-    { 64962, 78820, 38.754020 },
-    { 64962, 79593, 46.615941 },
-    { 64962, 79882, 47.017727 },
-    { 64962, 80112, 41.372401 },
-    { 64962, 80763, 43.111325 },
-    { 64962, 80816, 64.520854 },
-    { 64962, 81266, 44.362257 },
-    { 64962, 81377, 48.823657 },
-    { 64962, 81693, 73.089124 },
-    { 64962, 82273, 55.387858 },
-    { 64962, 82396, 47.095939 },
-    { 64962, 82514, 47.483067 },
-    { 64962, 83000, 62.599296 },
-    { 64962, 83081, 51.561938 },
-    { 64962, 84012, 54.735032 },
-    { 64962, 84143, 51.581503 },
-    { 64962, 84345, 68.792024 },
-    { 64962, 84379, 74.689731 },
-    { 64962, 84380, 81.779170 },
-    { 64962, 84970, 55.031367 },
-    { 64962, 85258, 55.116140 },
-    { 64962, 85267, 55.275706 },
-    { 64962, 85696, 55.187481 },
-    { 64962, 85792, 55.408336 },
-    { 64962, 85927, 55.767141 },
-    { 64962, 86032, 72.076455 },
-    { 64962, 86228, 56.168163 },
-    { 64962, 86670, 57.351033 },
-    { 64962, 86742, 70.160252 },
-    { 64962, 87073, 58.238949 },
-    { 64962, 87261, 58.997261 },
-    { 64962, 88048, 67.897291 },
-    { 64962, 88635, 63.392058 },
-    { 64962, 89642, 64.524618 },
-    { 64962, 89931, 66.723987 },
-    { 64962, 89962, 75.626282 },
-    { 64962, 90185, 66.313104 },
-    { 64962, 90496, 69.391401 },
-    { 64962, 92041, 72.718448 },
-    { 64962, 92855, 74.975034 },
-    { 64962, 93506, 75.362405 },
-    { 64962, 93864, 76.981515 },
-    { 64962, 94141, 79.895724 },
-    { 64962, 100751, 79.382233 },
-    { 65109, 65474, 25.571802 },
-    { 65109, 66249, 36.263198 },
-    { 65109, 66657, 17.086748 },
-    { 65109, 67927, 55.695115 },
-    { 65109, 68002, 12.391288 },
-    { 65109, 68702, 24.644882 },
-    { 65109, 68895, 13.956333 },
-    { 65109, 68933, 9.257926 },
-    { 65109, 69673, 57.391560 },
-    { 65109, 71075, 76.812662 },
-    { 65109, 71352, 15.414722 },
-    { 65109, 71681, 27.173250 },
-    { 65109, 71683, 27.171587 },
-    { 65109, 71860, 18.400269 },
-    { 65109, 71908, 30.755353 },
-    { 65109, 72105, 66.803964 },
-    { 65109, 72622, 28.762545 },
-    { 65109, 73273, 19.758753 },
-    { 65109, 73334, 19.708903 },
-    { 65109, 73714, 24.832527 },
-    { 65109, 74785, 37.951159 },
-    { 65109, 74946, 35.868114 },
-    { 65109, 75141, 23.776168 },
-    { 65109, 75264, 24.305799 },
-    { 65109, 76267, 70.838018 },
-    { 65109, 76297, 26.369733 },
-    { 65109, 77070, 54.671976 },
-    { 65109, 77952, 35.437400 },
-    { 65109, 78265, 35.109783 },
-    { 65109, 78401, 37.122569 },
-    { 65109, 78820, 39.649265 },
-    { 65109, 79593, 51.726602 },
-    { 65109, 79882, 51.723976 },
-    { 65109, 80112, 39.811581 },
-    { 65109, 80763, 41.077707 },
-    { 65109, 80816, 73.389913 },
-    { 65109, 81266, 41.605186 },
-    { 65109, 81377, 51.303918 },
-    { 65109, 81693, 82.874204 },
-    { 65109, 82273, 42.711531 },
-    { 65109, 82396, 42.185267 },
-    { 65109, 82514, 41.413173 },
-    { 65109, 83000, 68.621166 },
-    { 65109, 83081, 40.897021 },
-    { 65109, 84012, 54.742276 },
-    { 65109, 84143, 43.949131 },
-    { 65109, 84345, 75.106826 },
-    { 65109, 84379, 82.656197 },
-    { 65109, 84970, 52.263432 },
-    { 65109, 85258, 44.635691 },
-    { 65109, 85267, 44.631341 },
-    { 65109, 85696, 48.982577 },
-    { 65109, 85792, 46.118648 },
-    { 65109, 85927, 49.580634 },
-    { 65109, 86032, 77.401692 },
-    { 65109, 86228, 48.467247 },
-    { 65109, 86670, 50.582217 },
-    { 65109, 86742, 73.679137 },
-    { 65109, 87073, 51.151044 },
-    { 65109, 87261, 52.634060 },
-    { 65109, 88048, 67.866188 },
-    { 65109, 88635, 58.377259 },
-    { 65109, 89642, 57.857839 },
-    { 65109, 89931, 61.563378 },
-    { 65109, 89962, 76.407196 },
-    { 65109, 90185, 60.076121 },
-    { 65109, 90496, 65.075406 },
-    { 65109, 92041, 67.678382 },
-    { 65109, 92855, 69.871810 },
-    { 65109, 93506, 69.370970 },
-    { 65109, 93864, 71.343511 },
-    { 65109, 94141, 75.532557 },
-    { 65109, 100751, 67.869975 },
-    { 65109, 101772, 74.925027 },
-    { 65109, 110130, 76.087505 },
-    { 65378, 65474, 66.087202 },
-    { 65378, 66249, 55.565451 },
-    { 65378, 67301, 6.676139 },
-    { 65378, 67927, 36.996344 },
-    { 65378, 68895, 82.115693 },
-    { 65378, 69673, 37.068213 },
-    { 65378, 71075, 20.208370 },
-    { 65378, 72105, 31.516638 },
-    { 65378, 72607, 21.078367 },
-    { 65378, 72622, 73.331405 },
-    { 65378, 73714, 83.035145 },
-    { 65378, 74785, 68.536975 },
-    { 65378, 75097, 20.932633 },
-    { 65378, 75458, 16.829405 },
-    { 65378, 76267, 36.878589 },
-    { 65378, 77070, 56.022953 },
-    { 65378, 78820, 82.266720 },
-    { 65378, 79593, 68.324586 },
-    { 65378, 79882, 69.647410 },
-    { 65378, 80331, 24.067704 },
-    { 65378, 80816, 48.135969 },
-    { 65378, 81377, 76.959703 },
-    { 65378, 81693, 41.605057 },
-    { 65378, 83000, 61.896749 },
-    { 65378, 83895, 28.669324 },
-    { 65378, 84345, 59.935303 },
-    { 65378, 84379, 51.548219 },
-    { 65378, 84380, 42.638431 },
-    { 65378, 85670, 35.458180 },
-    { 65378, 86032, 64.229013 },
-    { 65378, 86742, 72.045123 },
-    { 65378, 87833, 39.336085 },
-    { 65378, 89962, 83.484435 },
-    { 65378, 91262, 52.855841 },
-    { 65378, 93194, 60.355424 },
-    { 65378, 93747, 76.047408 },
-    { 65378, 94376, 39.841625 },
-    { 65378, 95947, 68.367209 },
-    { 65378, 97165, 57.123227 },
-    { 65378, 100453, 65.260255 },
-    { 65378, 102098, 63.424895 },
-    { 65378, 102488, 73.152019 },
-    { 65378, 104732, 79.359637 },
-    { 65378, 105199, 53.159574 },
-    { 65378, 106032, 47.722149 },
-    { 65378, 109492, 60.395863 },
-    { 65378, 116727, 46.455286 },
-    { 65474, 66249, 10.825606 },
-    { 65474, 66657, 42.407173 },
-    { 65474, 67301, 60.674436 },
-    { 65474, 67927, 30.441847 },
-    { 65474, 68002, 36.689390 },
-    { 65474, 68702, 49.729879 },
-    { 65474, 68895, 18.300610 },
-    { 65474, 68933, 26.892293 },
-    { 65474, 69673, 32.798259 },
-    { 65474, 71075, 51.880448 },
-    { 65474, 71352, 34.589778 },
-    { 65474, 71681, 51.532644 },
-    { 65474, 71683, 51.529905 },
-    { 65474, 71860, 39.664310 },
-    { 65474, 71908, 55.457068 },
-    { 65474, 72105, 42.856508 },
-    { 65474, 72622, 21.371270 },
-    { 65474, 73273, 37.838747 },
-    { 65474, 73334, 37.122323 },
-    { 65474, 73714, 27.315280 },
-    { 65474, 74785, 27.552931 },
-    { 65474, 74946, 60.395277 },
-    { 65474, 75141, 39.025889 },
-    { 65474, 75264, 41.930661 },
-    { 65474, 75458, 74.189359 },
-    { 65474, 76267, 49.221695 },
-    { 65474, 76297, 41.374629 },
-    { 65474, 77070, 38.812391 },
-    { 65474, 77952, 58.578327 },
-    { 65474, 78265, 39.154478 },
-    { 65474, 78401, 38.704839 },
-    { 65474, 78820, 39.461160 },
-    { 65474, 79593, 42.545416 },
-    { 65474, 79882, 43.309145 },
-    { 65474, 80112, 43.935402 },
-    { 65474, 80331, 80.649990 },
-    { 65474, 80763, 45.905019 },
-    { 65474, 80816, 55.924770 },
-    { 65474, 81266, 47.650478 },
-    { 65474, 81377, 47.082222 },
-    { 65474, 81693, 63.480637 },
-    { 65474, 82273, 66.274125 },
-    { 65474, 82396, 51.941683 },
-    { 65474, 82514, 53.239560 },
-    { 65474, 83000, 56.674047 },
-    { 65474, 83081, 60.792501 },
-    { 65474, 84012, 54.795761 },
-    { 65474, 84143, 58.359343 },
-    { 65474, 84345, 62.328710 },
-    { 65474, 84379, 66.572776 },
-    { 65474, 84380, 72.152283 },
-    { 65474, 84970, 57.517386 },
-    { 65474, 85258, 64.087601 },
-    { 65474, 85267, 64.380258 },
-    { 65474, 85670, 82.249760 },
-    { 65474, 85696, 60.594726 },
-    { 65474, 85792, 63.376446 },
-    { 65474, 85927, 61.127409 },
-    { 65474, 86032, 66.356776 },
-    { 65474, 86228, 62.779305 },
-    { 65474, 86670, 63.120510 },
-    { 65474, 86742, 66.137833 },
-    { 65474, 87073, 64.235569 },
-    { 65474, 87261, 64.339034 },
-    { 65474, 88048, 67.178325 },
-    { 65474, 88635, 67.341717 },
-    { 65474, 89642, 69.865833 },
-    { 65474, 89931, 70.634475 },
-    { 65474, 89962, 73.777937 },
-    { 65474, 90185, 71.194624 },
-    { 65474, 90496, 72.419720 },
-    { 65474, 92041, 76.236093 },
-    { 65474, 92855, 78.446257 },
-    { 65474, 93506, 79.623531 },
-    { 65474, 93864, 80.850171 },
-    { 65474, 94141, 82.469669 },
-    { 66249, 66657, 52.881400 },
-    { 66249, 67301, 49.985878 },
-    { 66249, 67927, 19.619553 },
-    { 66249, 68002, 46.912670 },
-    { 66249, 68702, 60.041068 },
-    { 66249, 68895, 27.175141 },
-    { 66249, 68933, 36.533450 },
-    { 66249, 69673, 22.191708 },
-    { 66249, 71075, 41.085113 },
-    { 66249, 71352, 43.755401 },
-    { 66249, 71681, 61.518633 },
-    { 66249, 71683, 61.515507 },
-    { 66249, 71860, 49.025489 },
-    { 66249, 71908, 65.541219 },
-    { 66249, 72105, 32.425902 },
-    { 66249, 72607, 75.633170 },
-    { 66249, 72622, 24.317830 },
-    { 66249, 73273, 46.484677 },
-    { 66249, 73334, 45.649703 },
-    { 66249, 73714, 32.783200 },
-    { 66249, 74785, 26.927773 },
-    { 66249, 74946, 70.347815 },
-    { 66249, 75097, 74.389439 },
-    { 66249, 75141, 46.783911 },
-    { 66249, 75264, 50.152852 },
-    { 66249, 75458, 63.377180 },
-    { 66249, 76267, 39.746418 },
-    { 66249, 76297, 48.850894 },
-    { 66249, 77070, 33.082787 },
-    { 66249, 77952, 67.964587 },
-    { 66249, 78265, 43.062322 },
-    { 66249, 78401, 41.682619 },
-    { 66249, 78820, 41.578010 },
-    { 66249, 79593, 39.998633 },
-    { 66249, 79882, 41.056747 },
-    { 66249, 80112, 47.262274 },
-    { 66249, 80331, 69.911775 },
-    { 66249, 80763, 49.290550 },
-    { 66249, 80816, 48.177480 },
-    { 66249, 81266, 51.337498 },
-    { 66249, 81377, 46.411447 },
-    { 66249, 81693, 54.606444 },
-    { 66249, 82273, 75.705899 },
-    { 66249, 82396, 56.682715 },
-    { 66249, 82514, 58.669292 },
-    { 66249, 83000, 51.493105 },
-    { 66249, 83081, 68.853877 },
-    { 66249, 83895, 76.407531 },
-    { 66249, 84012, 55.273825 },
-    { 66249, 84143, 64.433836 },
-    { 66249, 84345, 56.417806 },
-    { 66249, 84379, 59.000860 },
-    { 66249, 84380, 63.130342 },
-    { 66249, 84970, 59.983136 },
-    { 66249, 85258, 71.856469 },
-    { 66249, 85267, 72.257979 },
-    { 66249, 85670, 72.103132 },
-    { 66249, 85696, 65.430303 },
-    { 66249, 85792, 70.300809 },
-    { 66249, 85927, 65.902115 },
-    { 66249, 86032, 60.996121 },
-    { 66249, 86228, 68.562199 },
-    { 66249, 86670, 68.170512 },
-    { 66249, 86742, 62.345362 },
-    { 66249, 87073, 69.441151 },
-    { 66249, 87261, 68.975469 },
-    { 66249, 87833, 75.505672 },
-    { 66249, 88048, 66.341899 },
-    { 66249, 88635, 70.648244 },
-    { 66249, 89642, 74.302473 },
-    { 66249, 89931, 73.778096 },
-    { 66249, 89962, 71.648434 },
-    { 66249, 90185, 75.177803 },
-    { 66249, 90496, 74.710047 },
-    { 66249, 91262, 79.172094 },
-    { 66249, 92041, 78.817808 },
-    { 66249, 92855, 80.904332 },
-    { 66249, 93194, 82.811548 },
-    { 66249, 93506, 82.752137 },
-    { 66249, 93747, 83.037237 },
-    { 66249, 93864, 83.579912 },
-    { 66249, 94141, 83.968768 },
-    { 66657, 67927, 71.935897 },
-    { 66657, 68002, 6.660535 },
-    { 66657, 68702, 7.632702 },
-    { 66657, 68895, 27.231906 },
-    { 66657, 68933, 17.724539 },
-    { 66657, 69673, 73.063724 },
-    { 66657, 71352, 14.612646 },
-    { 66657, 71681, 10.910658 },
-    { 66657, 71683, 10.910612 },
-    { 66657, 71860, 11.564227 },
-    { 66657, 71908, 13.938819 },
-    { 66657, 72105, 81.772196 },
-    { 66657, 72622, 39.921591 },
-    { 66657, 73273, 16.573184 },
-    { 66657, 73334, 17.399642 },
-    { 66657, 73714, 32.271790 },
-    { 66657, 74785, 48.212059 },
-    { 66657, 74946, 19.079548 },
-    { 66657, 75141, 21.328028 },
-    { 66657, 75264, 18.838927 },
-    { 66657, 76267, 83.960986 },
-    { 66657, 76297, 22.844002 },
-    { 66657, 77070, 65.377631 },
-    { 66657, 77952, 19.969208 },
-    { 66657, 78265, 37.541591 },
-    { 66657, 78401, 40.661628 },
-    { 66657, 78820, 43.686511 },
-    { 66657, 79593, 58.939555 },
-    { 66657, 79882, 58.478020 },
-    { 66657, 80112, 40.851486 },
-    { 66657, 80763, 41.284816 },
-    { 66657, 80816, 83.483409 },
-    { 66657, 81266, 40.778671 },
-    { 66657, 81377, 55.524802 },
-    { 66657, 82273, 26.483886 },
-    { 66657, 82396, 38.322818 },
-    { 66657, 82514, 36.009144 },
-    { 66657, 83000, 75.464334 },
-    { 66657, 83081, 28.176613 },
-    { 66657, 84012, 55.554250 },
-    { 66657, 84143, 35.803817 },
-    { 66657, 84345, 81.850597 },
-    { 66657, 84970, 49.840110 },
-    { 66657, 85258, 31.885123 },
-    { 66657, 85267, 31.612949 },
-    { 66657, 85696, 42.286649 },
-    { 66657, 85792, 35.138485 },
-    { 66657, 85927, 42.837453 },
-    { 66657, 86032, 82.727245 },
-    { 66657, 86228, 39.657369 },
-    { 66657, 86670, 42.891074 },
-    { 66657, 86742, 77.017735 },
-    { 66657, 87073, 42.939805 },
-    { 66657, 87261, 45.291096 },
-    { 66657, 88048, 67.274055 },
-    { 66657, 88635, 52.284686 },
-    { 66657, 89642, 49.578322 },
-    { 66657, 89931, 54.973880 },
-    { 66657, 89962, 76.085696 },
-    { 66657, 90185, 52.183019 },
-    { 66657, 90496, 59.277487 },
-    { 66657, 92041, 60.723558 },
-    { 66657, 92855, 62.662973 },
-    { 66657, 93506, 61.060939 },
-    { 66657, 93864, 63.342223 },
-    { 66657, 94141, 68.833061 },
-    { 66657, 100751, 52.621154 },
-    { 66657, 101772, 60.667120 },
-    { 66657, 108085, 76.912940 },
-    { 66657, 109268, 69.984486 },
-    { 66657, 110130, 59.388139 },
-    { 66657, 112122, 72.819712 },
-    { 67301, 67927, 30.948202 },
-    { 67301, 68895, 76.111311 },
-    { 67301, 69673, 30.650682 },
-    { 67301, 71075, 13.595285 },
-    { 67301, 72105, 24.841581 },
-    { 67301, 72607, 25.743023 },
-    { 67301, 72622, 66.844864 },
-    { 67301, 73714, 76.521660 },
-    { 67301, 74785, 61.888558 },
-    { 67301, 75097, 24.882819 },
-    { 67301, 75458, 17.068990 },
-    { 67301, 76267, 30.600870 },
-    { 67301, 77070, 49.423099 },
-    { 67301, 78265, 80.901765 },
-    { 67301, 78401, 77.767452 },
-    { 67301, 78820, 75.598307 },
-    { 67301, 79593, 61.787116 },
-    { 67301, 79882, 63.122165 },
-    { 67301, 80112, 82.348399 },
-    { 67301, 80331, 24.805530 },
-    { 67301, 80763, 83.881344 },
-    { 67301, 80816, 42.448749 },
-    { 67301, 81377, 70.478547 },
-    { 67301, 81693, 36.818875 },
-    { 67301, 83000, 56.095854 },
-    { 67301, 83895, 30.411472 },
-    { 67301, 84012, 78.937868 },
-    { 67301, 84345, 54.608264 },
-    { 67301, 84379, 46.857936 },
-    { 67301, 84380, 39.053197 },
-    { 67301, 85670, 34.461417 },
-    { 67301, 86032, 59.143669 },
-    { 67301, 86742, 66.718750 },
-    { 67301, 87833, 38.532387 },
-    { 67301, 88048, 80.546974 },
-    { 67301, 89962, 78.410451 },
-    { 67301, 91262, 51.018774 },
-    { 67301, 93194, 58.330722 },
-    { 67301, 93747, 72.698687 },
-    { 67301, 94376, 42.348456 },
-    { 67301, 95947, 66.562542 },
-    { 67301, 97165, 57.141593 },
-    { 67301, 97278, 81.764208 },
-    { 67301, 97649, 83.811795 },
-    { 67301, 100453, 65.480446 },
-    { 67301, 102098, 64.409538 },
-    { 67301, 102488, 73.333288 },
-    { 67301, 104732, 79.823294 },
-    { 67301, 105199, 56.150562 },
-    { 67301, 106032, 51.507769 },
-    { 67301, 109492, 63.679736 },
-    { 67301, 116727, 51.513368 },
-    { 67927, 68002, 65.687136 },
-    { 67927, 68702, 78.793347 },
-    { 67927, 68895, 45.169698 },
-    { 67927, 68933, 54.840743 },
-    { 67927, 69673, 5.029079 },
-    { 67927, 71075, 21.511533 },
-    { 67927, 71352, 61.285951 },
-    { 67927, 71681, 79.755089 },
-    { 67927, 71683, 79.751417 },
-    { 67927, 71860, 66.638391 },
-    { 67927, 71908, 83.875213 },
-    { 67927, 72105, 14.467666 },
-    { 67927, 72607, 56.288998 },
-    { 67927, 72622, 37.113561 },
-    { 67927, 73273, 63.258667 },
-    { 67927, 73334, 62.308842 },
-    { 67927, 73714, 46.828791 },
-    { 67927, 74785, 34.413257 },
-    { 67927, 75097, 54.891735 },
-    { 67927, 75141, 62.389444 },
-    { 67927, 75264, 66.202692 },
-    { 67927, 75458, 43.763296 },
-    { 67927, 76267, 24.485015 },
-    { 67927, 76297, 63.958073 },
-    { 67927, 77070, 29.249636 },
-    { 67927, 78265, 53.766318 },
-    { 67927, 78401, 51.236304 },
-    { 67927, 78820, 49.877592 },
-    { 67927, 79593, 40.875515 },
-    { 67927, 79882, 42.255645 },
-    { 67927, 80112, 56.600850 },
-    { 67927, 80331, 50.410048 },
-    { 67927, 80763, 58.479178 },
-    { 67927, 80816, 36.591424 },
-    { 67927, 81266, 60.759989 },
-    { 67927, 81377, 49.445962 },
-    { 67927, 81693, 39.712491 },
-    { 67927, 82396, 67.212719 },
-    { 67927, 82514, 70.104286 },
-    { 67927, 83000, 45.191963 },
-    { 67927, 83081, 83.848380 },
-    { 67927, 83895, 56.896129 },
-    { 67927, 84012, 59.028793 },
-    { 67927, 84143, 76.470348 },
-    { 67927, 84345, 47.983026 },
-    { 67927, 84379, 46.757042 },
-    { 67927, 84380, 47.427758 },
-    { 67927, 84970, 66.542555 },
-    { 67927, 85670, 53.749677 },
-    { 67927, 85696, 75.390142 },
-    { 67927, 85792, 83.362508 },
-    { 67927, 85927, 75.725242 },
-    { 67927, 86032, 53.198157 },
-    { 67927, 86228, 79.848424 },
-    { 67927, 86670, 78.273936 },
-    { 67927, 86742, 57.482304 },
-    { 67927, 87073, 79.709387 },
-    { 67927, 87261, 78.329527 },
-    { 67927, 87833, 57.446107 },
-    { 67927, 88048, 66.512118 },
-    { 67927, 88635, 77.618307 },
-    { 67927, 89642, 82.906054 },
-    { 67927, 89931, 80.198611 },
-    { 67927, 89962, 68.928073 },
-    { 67927, 90185, 82.932160 },
-    { 67927, 90496, 79.566785 },
-    { 67927, 91262, 63.650572 },
-    { 67927, 92041, 83.823428 },
-    { 67927, 93194, 68.728514 },
-    { 67927, 93747, 74.206252 },
-    { 67927, 94376, 69.030682 },
-    { 67927, 95501, 82.096977 },
-    { 67927, 95947, 76.381383 },
-    { 67927, 97165, 75.401326 },
-    { 67927, 100453, 83.272743 },
-    { 67927, 105199, 82.888139 },
-    { 67927, 106032, 80.110866 },
-    { 67927, 116727, 81.982432 },
-    { 68002, 68702, 13.140023 },
-    { 68002, 68895, 20.716122 },
-    { 68002, 68933, 11.113280 },
-    { 68002, 69673, 66.629796 },
-    { 68002, 71352, 8.747923 },
-    { 68002, 71681, 14.971040 },
-    { 68002, 71683, 14.968840 },
-    { 68002, 71860, 7.852464 },
-    { 68002, 71908, 18.785837 },
-    { 68002, 72105, 75.193930 },
-    { 68002, 72622, 33.276738 },
-    { 68002, 73273, 11.820992 },
-    { 68002, 73334, 12.407850 },
-    { 68002, 73714, 25.851754 },
-    { 68002, 74785, 41.652615 },
-    { 68002, 74946, 23.798114 },
-    { 68002, 75141, 16.740714 },
-    { 68002, 75264, 15.305614 },
-    { 68002, 76267, 77.304706 },
-    { 68002, 76297, 18.767604 },
-    { 68002, 77070, 58.843337 },
-    { 68002, 77952, 23.046143 },
-    { 68002, 78265, 32.174346 },
-    { 68002, 78401, 35.094861 },
-    { 68002, 78820, 38.060728 },
-    { 68002, 79593, 52.854554 },
-    { 68002, 79882, 52.472348 },
-    { 68002, 80112, 35.930708 },
-    { 68002, 80763, 36.616005 },
-    { 68002, 80816, 77.079027 },
-    { 68002, 81266, 36.419098 },
-    { 68002, 81377, 50.020526 },
-    { 68002, 82273, 30.362746 },
-    { 68002, 82396, 34.972759 },
-    { 68002, 82514, 33.220687 },
-    { 68002, 83000, 69.566552 },
-    { 68002, 83081, 29.104396 },
-    { 68002, 84012, 50.950478 },
-    { 68002, 84143, 34.254517 },
-    { 68002, 84345, 76.014449 },
-    { 68002, 84970, 46.192686 },
-    { 68002, 85258, 32.881782 },
-    { 68002, 85267, 32.787224 },
-    { 68002, 85696, 40.193135 },
-    { 68002, 85792, 35.082809 },
-    { 68002, 85927, 40.775009 },
-    { 68002, 86032, 77.209094 },
-    { 68002, 86228, 38.511208 },
-    { 68002, 86670, 41.260681 },
-    { 68002, 86742, 71.945394 },
-    { 68002, 87073, 41.555975 },
-    { 68002, 87261, 43.540119 },
-    { 68002, 88048, 63.248747 },
-    { 68002, 88635, 50.091978 },
-    { 68002, 89642, 48.324430 },
-    { 68002, 89931, 53.029270 },
-    { 68002, 89962, 72.068612 },
-    { 68002, 90185, 50.782715 },
-    { 68002, 90496, 57.054146 },
-    { 68002, 92041, 59.006496 },
-    { 68002, 92855, 61.078184 },
-    { 68002, 93506, 59.955038 },
-    { 68002, 93864, 62.118151 },
-    { 68002, 94141, 67.093508 },
-    { 68002, 100345, 83.412200 },
-    { 68002, 100751, 55.553224 },
-    { 68002, 101772, 62.868666 },
-    { 68002, 108085, 79.649869 },
-    { 68002, 109268, 73.517157 },
-    { 68002, 110130, 63.804089 },
-    { 68002, 112122, 76.851504 },
-    { 68702, 68895, 33.693777 },
-    { 68702, 68933, 24.008662 },
-    { 68702, 69673, 79.596589 },
-    { 68702, 71352, 18.845563 },
-    { 68702, 71681, 4.417892 },
-    { 68702, 71683, 4.420792 },
-    { 68702, 71860, 14.113632 },
-    { 68702, 71908, 6.381303 },
-    { 68702, 72622, 45.143688 },
-    { 68702, 73273, 19.117923 },
-    { 68702, 73334, 20.122976 },
-    { 68702, 73714, 36.593735 },
-    { 68702, 74785, 52.785676 },
-    { 68702, 74946, 11.493112 },
-    { 68702, 75141, 23.066258 },
-    { 68702, 75264, 19.580712 },
-    { 68702, 76297, 23.767520 },
-    { 68702, 77070, 69.663177 },
-    { 68702, 77952, 13.344386 },
-    { 68702, 78265, 39.488126 },
-    { 68702, 78401, 42.864132 },
-    { 68702, 78820, 45.918611 },
-    { 68702, 79593, 61.870542 },
-    { 68702, 79882, 61.224740 },
-    { 68702, 80112, 41.958307 },
-    { 68702, 80763, 41.989894 },
-    { 68702, 81266, 41.046253 },
-    { 68702, 81377, 57.274755 },
-    { 68702, 82273, 19.128552 },
-    { 68702, 82396, 37.322330 },
-    { 68702, 82514, 34.412290 },
-    { 68702, 83000, 77.735510 },
-    { 68702, 83081, 23.004170 },
-    { 68702, 84012, 55.784405 },
-    { 68702, 84143, 32.784547 },
-    { 68702, 84345, 83.903888 },
-    { 68702, 84970, 48.847956 },
-    { 68702, 85258, 26.478664 },
-    { 68702, 85267, 26.058101 },
-    { 68702, 85696, 39.622683 },
-    { 68702, 85792, 30.593319 },
-    { 68702, 85927, 40.119715 },
-    { 68702, 86228, 36.048927 },
-    { 68702, 86670, 39.691664 },
-    { 68702, 86742, 77.640032 },
-    { 68702, 87073, 39.473211 },
-    { 68702, 87261, 42.149496 },
-    { 68702, 88048, 66.426537 },
-    { 68702, 88635, 49.449244 },
-    { 68702, 89642, 45.792947 },
-    { 68702, 89931, 51.800583 },
-    { 68702, 89962, 75.079679 },
-    { 68702, 90185, 48.489104 },
-    { 68702, 90496, 56.324483 },
-    { 68702, 92041, 57.189592 },
-    { 68702, 92855, 58.955170 },
-    { 68702, 93506, 56.894498 },
-    { 68702, 93864, 59.255001 },
-    { 68702, 94141, 65.185067 },
-    { 68702, 100345, 79.282608 },
-    { 68702, 100751, 45.489141 },
-    { 68702, 101772, 53.874255 },
-    { 68702, 108085, 69.759343 },
-    { 68702, 109268, 62.545434 },
-    { 68702, 110130, 51.771116 },
-    { 68702, 112122, 65.249256 },
-    { 68702, 113368, 82.294699 },
-    { 68895, 68933, 9.686912 },
-    { 68895, 69673, 45.924733 },
-    { 68895, 71075, 65.268183 },
-    { 68895, 71352, 16.584843 },
-    { 68895, 71681, 34.622417 },
-    { 68895, 71683, 34.618903 },
-    { 68895, 71860, 21.853332 },
-    { 68895, 71908, 38.724114 },
-    { 68895, 72105, 54.552599 },
-    { 68895, 72622, 14.836007 },
-    { 68895, 73273, 19.568340 },
-    { 68895, 73334, 18.829366 },
-    { 68895, 73714, 13.035328 },
-    { 68895, 74785, 24.045201 },
-    { 68895, 74946, 43.361439 },
-    { 68895, 75141, 20.858534 },
-    { 68895, 75264, 23.633660 },
-    { 68895, 76267, 57.470160 },
-    { 68895, 76297, 23.308741 },
-    { 68895, 77070, 40.723272 },
-    { 68895, 77952, 40.790737 },
-    { 68895, 78265, 25.143349 },
-    { 68895, 78401, 26.154782 },
-    { 68895, 78820, 28.129294 },
-    { 68895, 79593, 38.265522 },
-    { 68895, 79882, 38.400022 },
-    { 68895, 80112, 30.189644 },
-    { 68895, 80763, 31.880164 },
-    { 68895, 80816, 59.440162 },
-    { 68895, 81266, 33.074562 },
-    { 68895, 81377, 38.980933 },
-    { 68895, 81693, 69.000133 },
-    { 68895, 82273, 48.531670 },
-    { 68895, 82396, 35.851038 },
-    { 68895, 82514, 36.412709 },
-    { 68895, 83000, 55.010121 },
-    { 68895, 83081, 42.492393 },
-    { 68895, 84012, 44.016690 },
-    { 68895, 84143, 40.875890 },
-    { 68895, 84345, 61.452086 },
-    { 68895, 84379, 68.736662 },
-    { 68895, 84380, 77.449617 },
-    { 68895, 84970, 43.779454 },
-    { 68895, 85258, 45.807879 },
-    { 68895, 85267, 46.088224 },
-    { 68895, 85696, 44.072303 },
-    { 68895, 85792, 45.343641 },
-    { 68895, 85927, 44.644314 },
-    { 68895, 86032, 64.049498 },
-    { 68895, 86228, 45.419744 },
-    { 68895, 86670, 46.333129 },
-    { 68895, 86742, 61.033265 },
-    { 68895, 87073, 47.289511 },
-    { 68895, 87261, 47.883461 },
-    { 68895, 88048, 57.268368 },
-    { 68895, 88635, 52.101484 },
-    { 68895, 89642, 53.431491 },
-    { 68895, 89931, 55.435606 },
-    { 68895, 89962, 65.318365 },
-    { 68895, 90185, 55.136666 },
-    { 68895, 90496, 58.082540 },
-    { 68895, 92041, 61.416319 },
-    { 68895, 92855, 63.672934 },
-    { 68895, 93506, 64.121209 },
-    { 68895, 93747, 83.082682 },
-    { 68895, 93864, 65.705095 },
-    { 68895, 94141, 68.591937 },
-    { 68895, 95501, 82.305879 },
-    { 68895, 100751, 70.470858 },
-    { 68895, 101772, 75.657135 },
-    { 68895, 110130, 81.473414 },
-    { 68933, 69673, 55.596543 },
-    { 68933, 71075, 74.906576 },
-    { 68933, 71352, 8.033276 },
-    { 68933, 71681, 25.025404 },
-    { 68933, 71683, 25.022079 },
-    { 68933, 71860, 12.804967 },
-    { 68933, 71908, 29.098921 },
-    { 68933, 72105, 64.080869 },
-    { 68933, 72622, 22.574147 },
-    { 68933, 73273, 12.022267 },
-    { 68933, 73334, 11.648772 },
-    { 68933, 73714, 16.537390 },
-    { 68933, 74785, 31.348795 },
-    { 68933, 74946, 33.824723 },
-    { 68933, 75141, 15.190330 },
-    { 68933, 75264, 16.606317 },
-    { 68933, 76267, 66.401913 },
-    { 68933, 76297, 17.841466 },
-    { 68933, 77070, 48.519656 },
-    { 68933, 77952, 31.686091 },
-    { 68933, 78265, 25.953055 },
-    { 68933, 78401, 28.135887 },
-    { 68933, 78820, 30.788076 },
-    { 68933, 79593, 43.922007 },
-    { 68933, 79882, 43.758487 },
-    { 68933, 80112, 30.587251 },
-    { 68933, 80763, 31.826215 },
-    { 68933, 80816, 67.056744 },
-    { 68933, 81266, 32.350964 },
-    { 68933, 81377, 42.629905 },
-    { 68933, 81693, 77.004860 },
-    { 68933, 82273, 39.388028 },
-    { 68933, 82396, 33.159634 },
-    { 68933, 82514, 32.661051 },
-    { 68933, 83000, 60.866969 },
-    { 68933, 83081, 34.812097 },
-    { 68933, 84012, 45.582337 },
-    { 68933, 84143, 35.806202 },
-    { 68933, 84345, 67.377386 },
-    { 68933, 84379, 75.613950 },
-    { 68933, 84970, 43.029179 },
-    { 68933, 85258, 38.379538 },
-    { 68933, 85267, 38.528721 },
-    { 68933, 85696, 40.336070 },
-    { 68933, 85792, 38.926335 },
-    { 68933, 85927, 40.932942 },
-    { 68933, 86032, 69.251946 },
-    { 68933, 86228, 40.392754 },
-    { 68933, 86670, 42.138824 },
-    { 68933, 86742, 65.016781 },
-    { 68933, 87073, 42.833460 },
-    { 68933, 87261, 44.065079 },
-    { 68933, 88048, 58.656074 },
-    { 68933, 88635, 49.476759 },
-    { 68933, 89642, 49.427715 },
-    { 68933, 89931, 52.713296 },
-    { 68933, 89962, 67.242664 },
-    { 68933, 90185, 51.514714 },
-    { 68933, 90496, 56.068186 },
-    { 68933, 92041, 58.831150 },
-    { 68933, 92855, 61.049867 },
-    { 68933, 93506, 60.785313 },
-    { 68933, 93864, 62.665815 },
-    { 68933, 94141, 66.577635 },
-    { 68933, 95501, 83.597103 },
-    { 68933, 100751, 62.656801 },
-    { 68933, 101772, 68.754186 },
-    { 68933, 109268, 81.058769 },
-    { 68933, 110130, 72.687097 },
-    { 69673, 71075, 19.449919 },
-    { 69673, 71352, 61.515972 },
-    { 69673, 71681, 80.173171 },
-    { 69673, 71683, 80.169175 },
-    { 69673, 71860, 66.836903 },
-    { 69673, 72105, 10.368460 },
-    { 69673, 72607, 55.178340 },
-    { 69673, 72622, 36.277074 },
-    { 69673, 73273, 63.095921 },
-    { 69673, 73334, 62.109895 },
-    { 69673, 73714, 46.000165 },
-    { 69673, 74785, 32.321523 },
-    { 69673, 75097, 53.491340 },
-    { 69673, 75141, 61.754346 },
-    { 69673, 75264, 65.681639 },
-    { 69673, 75458, 41.715574 },
-    { 69673, 76267, 19.654418 },
-    { 69673, 76297, 63.107042 },
-    { 69673, 77070, 25.035803 },
-    { 69673, 78265, 51.765776 },
-    { 69673, 78401, 49.001688 },
-    { 69673, 78820, 47.371126 },
-    { 69673, 79593, 37.083565 },
-    { 69673, 79882, 38.482753 },
-    { 69673, 80112, 54.180407 },
-    { 69673, 80331, 47.891499 },
-    { 69673, 80763, 55.980423 },
-    { 69673, 80816, 31.564727 },
-    { 69673, 81266, 58.271777 },
-    { 69673, 81377, 45.830310 },
-    { 69673, 81693, 34.951682 },
-    { 69673, 82396, 64.885935 },
-    { 69673, 82514, 67.972807 },
-    { 69673, 83000, 40.349172 },
-    { 69673, 83081, 82.655410 },
-    { 69673, 83895, 54.382960 },
-    { 69673, 84012, 55.358729 },
-    { 69673, 84143, 74.407774 },
-    { 69673, 84345, 42.992817 },
-    { 69673, 84379, 41.772383 },
-    { 69673, 84380, 42.856721 },
-    { 69673, 84970, 63.294829 },
-    { 69673, 85670, 50.111397 },
-    { 69673, 85696, 72.781534 },
-    { 69673, 85792, 81.508703 },
-    { 69673, 85927, 73.077131 },
-    { 69673, 86032, 48.217975 },
-    { 69673, 86228, 77.522308 },
-    { 69673, 86670, 75.658130 },
-    { 69673, 86742, 52.668233 },
-    { 69673, 87073, 77.114504 },
-    { 69673, 87261, 75.527061 },
-    { 69673, 87833, 53.664601 },
-    { 69673, 88048, 62.170170 },
-    { 69673, 88635, 74.291602 },
-    { 69673, 89642, 79.862345 },
-    { 69673, 89931, 76.725992 },
-    { 69673, 89962, 64.230218 },
-    { 69673, 90185, 79.699595 },
-    { 69673, 90496, 75.807389 },
-    { 69673, 91262, 59.114951 },
-    { 69673, 92041, 80.040336 },
-    { 69673, 92855, 81.639298 },
-    { 69673, 93194, 63.980831 },
-    { 69673, 93747, 69.177196 },
-    { 69673, 94141, 82.406782 },
-    { 69673, 94376, 66.321067 },
-    { 69673, 95501, 77.133479 },
-    { 69673, 95947, 71.538791 },
-    { 69673, 97165, 71.221679 },
-    { 69673, 97278, 79.668663 },
-    { 69673, 97649, 81.267310 },
-    { 69673, 100453, 78.944056 },
-    { 69673, 102098, 80.851518 },
-    { 69673, 105199, 79.986032 },
-    { 69673, 106032, 77.789461 },
-    { 69673, 116727, 80.560947 },
-    { 71075, 71352, 80.469410 },
-    { 71075, 72105, 11.555029 },
-    { 71075, 72607, 35.916729 },
-    { 71075, 72622, 54.528106 },
-    { 71075, 73273, 81.662459 },
-    { 71075, 73334, 80.647864 },
-    { 71075, 73714, 64.030411 },
-    { 71075, 74785, 48.829418 },
-    { 71075, 75097, 34.091535 },
-    { 71075, 75141, 79.755089 },
-    { 71075, 75264, 83.778592 },
-    { 71075, 75458, 22.332674 },
-    { 71075, 76267, 17.520595 },
-    { 71075, 76297, 80.766962 },
-    { 71075, 77070, 35.828488 },
-    { 71075, 78265, 67.552349 },
-    { 71075, 78401, 64.351962 },
-    { 71075, 78820, 62.106398 },
-    { 71075, 79593, 48.206451 },
-    { 71075, 79882, 49.547892 },
-    { 71075, 80112, 68.824151 },
-    { 71075, 80331, 28.913262 },
-    { 71075, 80763, 70.327443 },
-    { 71075, 80816, 30.418956 },
-    { 71075, 81266, 72.547719 },
-    { 71075, 81377, 56.931176 },
-    { 71075, 81693, 27.161446 },
-    { 71075, 82396, 79.346508 },
-    { 71075, 82514, 82.849845 },
-    { 71075, 83000, 43.601769 },
-    { 71075, 83895, 35.391744 },
-    { 71075, 84012, 65.531328 },
-    { 71075, 84345, 43.046956 },
-    { 71075, 84379, 36.873966 },
-    { 71075, 84380, 32.069522 },
-    { 71075, 84970, 74.781059 },
-    { 71075, 85670, 33.673722 },
-    { 71075, 86032, 47.963629 },
-    { 71075, 86742, 54.950261 },
-    { 71075, 87833, 37.658501 },
-    { 71075, 88048, 68.058475 },
-    { 71075, 89962, 66.924397 },
-    { 71075, 91262, 46.934952 },
-    { 71075, 93194, 53.427333 },
-    { 71075, 93747, 64.544271 },
-    { 71075, 94376, 47.561869 },
-    { 71075, 95501, 75.041040 },
-    { 71075, 95947, 61.706707 },
-    { 71075, 97165, 56.474462 },
-    { 71075, 97278, 74.493852 },
-    { 71075, 97649, 76.436734 },
-    { 71075, 100453, 64.766319 },
-    { 71075, 102098, 65.295399 },
-    { 71075, 102488, 72.165343 },
-    { 71075, 104732, 78.939888 },
-    { 71075, 105199, 61.479370 },
-    { 71075, 106032, 58.618741 },
-    { 71075, 109492, 69.261428 },
-    { 71075, 116727, 61.122069 },
-    { 71352, 71681, 18.692310 },
-    { 71352, 71683, 18.688118 },
-    { 71352, 71860, 5.352801 },
-    { 71352, 71908, 22.838448 },
-    { 71352, 72105, 69.266513 },
-    { 71352, 72622, 26.323881 },
-    { 71352, 73273, 4.344138 },
-    { 71352, 73334, 4.385006 },
-    { 71352, 73714, 17.873459 },
-    { 71352, 74785, 34.019639 },
-    { 71352, 74946, 27.133532 },
-    { 71352, 75141, 8.725155 },
-    { 71352, 75264, 8.922518 },
-    { 71352, 76267, 70.215157 },
-    { 71352, 76297, 11.167358 },
-    { 71352, 77070, 51.051181 },
-    { 71352, 77952, 24.209794 },
-    { 71352, 78265, 23.433797 },
-    { 71352, 78401, 26.350689 },
-    { 71352, 78820, 29.325179 },
-    { 71352, 79593, 44.334863 },
-    { 71352, 79882, 43.894353 },
-    { 71352, 80112, 27.293688 },
-    { 71352, 80763, 28.083128 },
-    { 71352, 80816, 68.944106 },
-    { 71352, 81266, 28.055575 },
-    { 71352, 81377, 41.276023 },
-    { 71352, 81693, 79.225756 },
-    { 71352, 82273, 31.951293 },
-    { 71352, 82396, 27.392260 },
-    { 71352, 82514, 26.219722 },
-    { 71352, 83000, 60.934612 },
-    { 71352, 83081, 26.778889 },
-    { 71352, 84012, 42.383712 },
-    { 71352, 84143, 28.536551 },
-    { 71352, 84345, 67.357747 },
-    { 71352, 84379, 76.450620 },
-    { 71352, 84970, 38.200354 },
-    { 71352, 85258, 30.354222 },
-    { 71352, 85267, 30.496833 },
-    { 71352, 85696, 33.672716 },
-    { 71352, 85792, 31.087805 },
-    { 71352, 85927, 34.269610 },
-    { 71352, 86032, 68.472272 },
-    { 71352, 86228, 33.064974 },
-    { 71352, 86670, 35.188830 },
-    { 71352, 86742, 63.217784 },
-    { 71352, 87073, 35.738655 },
-    { 71352, 87261, 37.276967 },
-    { 71352, 88048, 54.909656 },
-    { 71352, 88635, 43.252162 },
-    { 71352, 89642, 42.455214 },
-    { 71352, 89931, 46.370699 },
-    { 71352, 89962, 63.700180 },
-    { 71352, 90185, 44.704514 },
-    { 71352, 90496, 50.076859 },
-    { 71352, 92041, 52.465257 },
-    { 71352, 92855, 54.630705 },
-    { 71352, 93506, 53.997135 },
-    { 71352, 93747, 83.403343 },
-    { 71352, 93864, 56.005066 },
-    { 71352, 94141, 60.418168 },
-    { 71352, 95501, 79.271642 },
-    { 71352, 100345, 77.493750 },
-    { 71352, 100751, 54.641923 },
-    { 71352, 101772, 60.746645 },
-    { 71352, 108085, 77.898800 },
-    { 71352, 109268, 73.058477 },
-    { 71352, 110130, 64.975103 },
-    { 71352, 112122, 77.112604 },
-    { 71681, 71683, 0.005298 },
-    { 71681, 71860, 13.455326 },
-    { 71681, 71908, 4.147786 },
-    { 71681, 72622, 44.843491 },
-    { 71681, 73273, 17.931298 },
-    { 71681, 73334, 18.967351 },
-    { 71681, 73714, 35.802963 },
-    { 71681, 74785, 51.921770 },
-    { 71681, 74946, 8.862657 },
-    { 71681, 75141, 21.182565 },
-    { 71681, 75264, 17.359596 },
-    { 71681, 76297, 21.419187 },
-    { 71681, 77070, 68.447368 },
-    { 71681, 77952, 9.155035 },
-    { 71681, 78265, 37.247497 },
-    { 71681, 78401, 40.704475 },
-    { 71681, 78820, 43.732041 },
-    { 71681, 79593, 59.894554 },
-    { 71681, 79882, 59.152451 },
-    { 71681, 80112, 39.262837 },
-    { 71681, 80763, 39.108027 },
-    { 71681, 81266, 37.983071 },
-    { 71681, 81377, 54.721471 },
-    { 71681, 82273, 15.656342 },
-    { 71681, 82396, 33.794400 },
-    { 71681, 82514, 30.704063 },
-    { 71681, 83000, 75.289773 },
-    { 71681, 83081, 18.587833 },
-    { 71681, 84012, 52.564177 },
-    { 71681, 84143, 28.662382 },
-    { 71681, 84345, 81.311210 },
-    { 71681, 84970, 45.218391 },
-    { 71681, 85258, 22.064595 },
-    { 71681, 85267, 21.652088 },
-    { 71681, 85696, 35.545968 },
-    { 71681, 85792, 26.205325 },
-    { 71681, 85927, 36.026482 },
-    { 71681, 86032, 81.184843 },
-    { 71681, 86228, 31.779017 },
-    { 71681, 86670, 35.488338 },
-    { 71681, 86742, 74.445711 },
-    { 71681, 87073, 35.216822 },
-    { 71681, 87261, 37.948277 },
-    { 71681, 88048, 62.748040 },
-    { 71681, 88635, 45.287538 },
-    { 71681, 89642, 41.465799 },
-    { 71681, 89931, 47.562327 },
-    { 71681, 89962, 71.314884 },
-    { 71681, 90185, 44.170002 },
-    { 71681, 90496, 52.117706 },
-    { 71681, 92041, 52.878861 },
-    { 71681, 92855, 54.617377 },
-    { 71681, 93506, 52.508507 },
-    { 71681, 93864, 54.874211 },
-    { 71681, 94141, 60.847311 },
-    { 71681, 95501, 83.842746 },
-    { 71681, 100345, 74.865617 },
-    { 71681, 100751, 41.712418 },
-    { 71681, 101772, 49.856988 },
-    { 71681, 107556, 83.862788 },
-    { 71681, 108085, 66.005184 },
-    { 71681, 109268, 59.142739 },
-    { 71681, 110130, 48.914548 },
-    { 71681, 112122, 62.149005 },
-    { 71681, 113368, 78.946480 },
-    { 71683, 71860, 13.450915 },
-    { 71683, 71908, 4.151877 },
-    { 71683, 72622, 44.838973 },
-    { 71683, 73273, 17.926460 },
-    { 71683, 73334, 18.962515 },
-    { 71683, 73714, 35.798195 },
-    { 71683, 74785, 51.916914 },
-    { 71683, 74946, 8.865385 },
-    { 71683, 75141, 21.177402 },
-    { 71683, 75264, 17.354361 },
-    { 71683, 76297, 21.413915 },
-    { 71683, 77070, 68.442330 },
-    { 71683, 77952, 9.154051 },
-    { 71683, 78265, 37.242220 },
-    { 71683, 78401, 40.699207 },
-    { 71683, 78820, 43.726767 },
-    { 71683, 79593, 59.889304 },
-    { 71683, 79882, 59.147185 },
-    { 71683, 80112, 39.257544 },
-    { 71683, 80763, 39.102754 },
-    { 71683, 81266, 37.977835 },
-    { 71683, 81377, 54.716174 },
-    { 71683, 82273, 15.657231 },
-    { 71683, 82396, 33.789359 },
-    { 71683, 82514, 30.699150 },
-    { 71683, 83000, 75.284475 },
-    { 71683, 83081, 18.584807 },
-    { 71683, 84012, 52.559005 },
-    { 71683, 84143, 28.658009 },
-    { 71683, 84345, 81.305917 },
-    { 71683, 84970, 45.213441 },
-    { 71683, 85258, 22.061902 },
-    { 71683, 85267, 21.649555 },
-    { 71683, 85696, 35.541526 },
-    { 71683, 85792, 26.201897 },
-    { 71683, 85927, 36.022071 },
-    { 71683, 86032, 81.179594 },
-    { 71683, 86228, 31.775025 },
-    { 71683, 86670, 35.484163 },
-    { 71683, 86742, 74.440543 },
-    { 71683, 87073, 35.212793 },
-    { 71683, 87261, 37.944101 },
-    { 71683, 88048, 62.743149 },
-    { 71683, 88635, 45.283281 },
-    { 71683, 89642, 41.462035 },
-    { 71683, 89931, 47.558263 },
-    { 71683, 89962, 71.310079 },
-    { 71683, 90185, 44.166207 },
-    { 71683, 90496, 52.113563 },
-    { 71683, 92041, 52.875040 },
-    { 71683, 92855, 54.613672 },
-    { 71683, 93506, 52.505084 },
-    { 71683, 93864, 54.870751 },
-    { 71683, 94141, 60.843610 },
-    { 71683, 95501, 83.838510 },
-    { 71683, 100345, 74.862810 },
-    { 71683, 100751, 41.712357 },
-    { 71683, 101772, 49.856266 },
-    { 71683, 107556, 83.861603 },
-    { 71683, 108085, 66.005105 },
-    { 71683, 109268, 59.143410 },
-    { 71683, 110130, 48.916184 },
-    { 71683, 112122, 62.150203 },
-    { 71683, 113368, 78.947201 },
-    { 71860, 71908, 17.586603 },
-    { 71860, 72105, 74.465506 },
-    { 71860, 72622, 31.401127 },
-    { 71860, 73273, 5.159161 },
-    { 71860, 73334, 6.103606 },
-    { 71860, 73714, 22.536933 },
-    { 71860, 74785, 38.726132 },
-    { 71860, 74946, 21.790345 },
-    { 71860, 75141, 9.769297 },
-    { 71860, 75264, 7.562455 },
-    { 71860, 76267, 75.051214 },
-    { 71860, 76297, 11.352467 },
-    { 71860, 77070, 55.550502 },
-    { 71860, 77952, 18.961244 },
-    { 71860, 78265, 26.112198 },
-    { 71860, 78401, 29.330563 },
-    { 71860, 78820, 32.379028 },
-    { 71860, 79593, 48.021783 },
-    { 71860, 79882, 47.455531 },
-    { 71860, 80112, 29.291925 },
-    { 71860, 80763, 29.726578 },
-    { 71860, 80816, 73.062264 },
-    { 71860, 81266, 29.273079 },
-    { 71860, 81377, 44.098272 },
-    { 71860, 81693, 83.423663 },
-    { 71860, 82273, 26.695434 },
-    { 71860, 82396, 27.291096 },
-    { 71860, 82514, 25.402525 },
-    { 71860, 83000, 64.257906 },
-    { 71860, 83081, 22.576118 },
-    { 71860, 84012, 44.015208 },
-    { 71860, 84143, 26.470604 },
-    { 71860, 84345, 70.573604 },
-    { 71860, 84379, 80.028158 },
-    { 71860, 84970, 38.654316 },
-    { 71860, 85258, 26.282800 },
-    { 71860, 85267, 26.319488 },
-    { 71860, 85696, 32.341731 },
-    { 71860, 85792, 27.804753 },
-    { 71860, 85927, 32.924190 },
-    { 71860, 86032, 71.260365 },
-    { 71860, 86228, 30.794603 },
-    { 71860, 86670, 33.443382 },
-    { 71860, 86742, 65.456278 },
-    { 71860, 87073, 33.776131 },
-    { 71860, 87261, 35.705820 },
-    { 71860, 88048, 55.927713 },
-    { 71860, 88635, 42.241284 },
-    { 71860, 89642, 40.549670 },
-    { 71860, 89931, 45.177850 },
-    { 71860, 89962, 64.753626 },
-    { 71860, 90185, 42.978876 },
-    { 71860, 90496, 49.207016 },
-    { 71860, 92041, 51.161987 },
-    { 71860, 92855, 53.241629 },
-    { 71860, 93506, 52.182488 },
-    { 71860, 93864, 54.322550 },
-    { 71860, 94141, 59.244696 },
-    { 71860, 95501, 79.553591 },
-    { 71860, 100345, 75.674269 },
-    { 71860, 100751, 50.079448 },
-    { 71860, 101772, 56.664918 },
-    { 71860, 108085, 73.717839 },
-    { 71860, 109268, 68.408675 },
-    { 71860, 110130, 59.891065 },
-    { 71860, 112122, 72.266960 },
-    { 71908, 72622, 48.953549 },
-    { 71908, 73273, 21.956530 },
-    { 71908, 73334, 22.992172 },
-    { 71908, 73714, 39.844194 },
-    { 71908, 74785, 55.918781 },
-    { 71908, 74946, 5.142863 },
-    { 71908, 75141, 24.959609 },
-    { 71908, 75264, 21.033289 },
-    { 71908, 76297, 24.967900 },
-    { 71908, 77070, 72.314667 },
-    { 71908, 77952, 8.022674 },
-    { 71908, 78265, 40.729606 },
-    { 71908, 78401, 44.216255 },
-    { 71908, 78820, 47.215298 },
-    { 71908, 79593, 63.443428 },
-    { 71908, 79882, 62.649974 },
-    { 71908, 80112, 42.428944 },
-    { 71908, 80763, 42.125074 },
-    { 71908, 81266, 40.845206 },
-    { 71908, 81377, 57.922745 },
-    { 71908, 82273, 12.803728 },
-    { 71908, 82396, 36.178421 },
-    { 71908, 82514, 32.869306 },
-    { 71908, 83000, 78.506005 },
-    { 71908, 83081, 18.698977 },
-    { 71908, 84012, 55.185798 },
-    { 71908, 84143, 30.059058 },
-    { 71908, 84970, 47.377356 },
-    { 71908, 85258, 21.790922 },
-    { 71908, 85267, 21.242344 },
-    { 71908, 85696, 36.976721 },
-    { 71908, 85792, 26.569241 },
-    { 71908, 85927, 37.413370 },
-    { 71908, 86228, 32.688611 },
-    { 71908, 86670, 36.583096 },
-    { 71908, 86742, 77.010703 },
-    { 71908, 87073, 36.140397 },
-    { 71908, 87261, 39.027645 },
-    { 71908, 88048, 64.747665 },
-    { 71908, 88635, 46.427110 },
-    { 71908, 89642, 42.050917 },
-    { 71908, 89931, 48.457162 },
-    { 71908, 89962, 73.146528 },
-    { 71908, 90185, 44.774520 },
-    { 71908, 90496, 53.087486 },
-    { 71908, 92041, 53.471973 },
-    { 71908, 92855, 55.076106 },
-    { 71908, 93506, 52.678811 },
-    { 71908, 93864, 55.073876 },
-    { 71908, 94141, 61.279255 },
-    { 71908, 100345, 74.365728 },
-    { 71908, 100751, 39.221907 },
-    { 71908, 101772, 47.776709 },
-    { 71908, 107556, 82.023059 },
-    { 71908, 108085, 63.459306 },
-    { 71908, 109268, 56.166282 },
-    { 71908, 110130, 45.458897 },
-    { 71908, 112122, 58.887606 },
-    { 71908, 113368, 75.913434 },
-    { 72105, 72607, 47.087224 },
-    { 72105, 72622, 43.139486 },
-    { 72105, 73273, 70.277110 },
-    { 72105, 73334, 69.255719 },
-    { 72105, 73714, 52.557609 },
-    { 72105, 74785, 37.274584 },
-    { 72105, 75097, 45.033280 },
-    { 72105, 75141, 68.246707 },
-    { 72105, 75264, 72.278328 },
-    { 72105, 75458, 32.638210 },
-    { 72105, 76267, 11.082225 },
-    { 72105, 76297, 69.223761 },
-    { 72105, 77070, 24.997409 },
-    { 72105, 78265, 56.080908 },
-    { 72105, 78401, 52.927354 },
-    { 72105, 78820, 50.769043 },
-    { 72105, 79593, 37.575109 },
-    { 72105, 79882, 38.956770 },
-    { 72105, 80112, 57.538514 },
-    { 72105, 80331, 38.213893 },
-    { 72105, 80763, 59.109465 },
-    { 72105, 80816, 24.572333 },
-    { 72105, 81266, 61.357163 },
-    { 72105, 81377, 46.442358 },
-    { 72105, 81693, 25.669764 },
-    { 72105, 82396, 68.150912 },
-    { 72105, 82514, 71.581852 },
-    { 72105, 83000, 35.952536 },
-    { 72105, 83895, 44.656976 },
-    { 72105, 84012, 55.460155 },
-    { 72105, 84143, 78.013292 },
-    { 72105, 84345, 37.046675 },
-    { 72105, 84379, 33.678270 },
-    { 72105, 84380, 33.052814 },
-    { 72105, 84970, 64.371512 },
-    { 72105, 85670, 39.753420 },
-    { 72105, 85696, 75.215093 },
-    { 72105, 85927, 75.411048 },
-    { 72105, 86032, 42.277734 },
-    { 72105, 86228, 80.488523 },
-    { 72105, 86670, 78.007165 },
-    { 72105, 86742, 48.087448 },
-    { 72105, 87073, 79.478748 },
-    { 72105, 87261, 77.433562 },
-    { 72105, 87833, 43.296293 },
-    { 72105, 88048, 59.730183 },
-    { 72105, 88635, 74.873619 },
-    { 72105, 89642, 81.065162 },
-    { 72105, 89931, 76.842159 },
-    { 72105, 89962, 60.087833 },
-    { 72105, 90185, 80.410790 },
-    { 72105, 90496, 75.091386 },
-    { 72105, 91262, 49.228898 },
-    { 72105, 92041, 79.155423 },
-    { 72105, 92855, 80.438545 },
-    { 72105, 93194, 54.527038 },
-    { 72105, 93506, 83.870694 },
-    { 72105, 93747, 61.773568 },
-    { 72105, 93864, 83.349578 },
-    { 72105, 94141, 80.084243 },
-    { 72105, 94376, 56.371006 },
-    { 72105, 95501, 70.915251 },
-    { 72105, 95947, 62.366390 },
-    { 72105, 97165, 60.975094 },
-    { 72105, 97278, 72.202893 },
-    { 72105, 97649, 73.959258 },
-    { 72105, 99473, 82.885328 },
-    { 72105, 100453, 68.808276 },
-    { 72105, 102098, 70.541393 },
-    { 72105, 102488, 75.499888 },
-    { 72105, 104732, 82.210039 },
-    { 72105, 105199, 69.869457 },
-    { 72105, 106032, 68.094910 },
-    { 72105, 109492, 77.577329 },
-    { 72105, 116727, 71.755065 },
-    { 72607, 74785, 83.640504 },
-    { 72607, 75097, 3.190572 },
-    { 72607, 75458, 15.528306 },
-    { 72607, 76267, 47.787832 },
-    { 72607, 77070, 68.185852 },
-    { 72607, 79593, 78.899083 },
-    { 72607, 79882, 79.993021 },
-    { 72607, 80331, 15.177382 },
-    { 72607, 80816, 54.346118 },
-    { 72607, 81693, 44.757276 },
-    { 72607, 83000, 67.306704 },
-    { 72607, 83895, 14.211403 },
-    { 72607, 84345, 63.058748 },
-    { 72607, 84379, 52.817099 },
-    { 72607, 84380, 41.145262 },
-    { 72607, 85670, 27.226890 },
-    { 72607, 86032, 65.785045 },
-    { 72607, 86742, 74.036653 },
-    { 72607, 87833, 29.560407 },
-    { 72607, 89962, 83.292614 },
-    { 72607, 91262, 43.956597 },
-    { 72607, 93194, 51.153700 },
-    { 72607, 93747, 69.631544 },
-    { 72607, 94376, 21.107245 },
-    { 72607, 95501, 81.297053 },
-    { 72607, 95947, 57.757514 },
-    { 72607, 97165, 42.584336 },
-    { 72607, 97278, 75.424612 },
-    { 72607, 97649, 77.406632 },
-    { 72607, 100453, 49.647718 },
-    { 72607, 102098, 46.264236 },
-    { 72607, 102488, 57.182372 },
-    { 72607, 104732, 62.518952 },
-    { 72607, 105199, 32.994562 },
-    { 72607, 106032, 26.850544 },
-    { 72607, 109492, 39.796742 },
-    { 72607, 112158, 68.087440 },
-    { 72607, 113881, 71.293325 },
-    { 72607, 113963, 83.866558 },
-    { 72607, 116727, 25.785710 },
-    { 72622, 73273, 27.141403 },
-    { 72622, 73334, 26.123175 },
-    { 72622, 73714, 9.740333 },
-    { 72622, 74785, 9.213343 },
-    { 72622, 74946, 52.825805 },
-    { 72622, 75141, 25.478197 },
-    { 72622, 75264, 29.423240 },
-    { 72622, 75458, 75.331152 },
-    { 72622, 76267, 44.060126 },
-    { 72622, 76297, 26.882885 },
-    { 72622, 77070, 26.063905 },
-    { 72622, 77952, 48.682035 },
-    { 72622, 78265, 18.753451 },
-    { 72622, 78401, 17.638491 },
-    { 72622, 78820, 18.118366 },
-    { 72622, 79593, 23.940812 },
-    { 72622, 79882, 24.276363 },
-    { 72622, 80112, 23.116136 },
-    { 72622, 80331, 79.736333 },
-    { 72622, 80763, 25.137571 },
-    { 72622, 80816, 44.739096 },
-    { 72622, 81266, 27.105247 },
-    { 72622, 81377, 26.406338 },
-    { 72622, 81693, 54.509021 },
-    { 72622, 82273, 56.111840 },
-    { 72622, 82396, 32.377064 },
-    { 72622, 82514, 34.501942 },
-    { 72622, 83000, 40.380020 },
-    { 72622, 83081, 46.743825 },
-    { 72622, 84012, 33.504334 },
-    { 72622, 84143, 40.484456 },
-    { 72622, 84345, 46.764570 },
-    { 72622, 84379, 53.902499 },
-    { 72622, 84380, 62.831572 },
-    { 72622, 84970, 36.371733 },
-    { 72622, 85258, 49.240464 },
-    { 72622, 85267, 49.772085 },
-    { 72622, 85670, 76.568052 },
-    { 72622, 85696, 41.117656 },
-    { 72622, 85792, 46.837160 },
-    { 72622, 85927, 41.586171 },
-    { 72622, 86032, 49.629843 },
-    { 72622, 86228, 44.438642 },
-    { 72622, 86670, 43.871923 },
-    { 72622, 86742, 47.394430 },
-    { 72622, 87073, 45.160451 },
-    { 72622, 87261, 44.658823 },
-    { 72622, 87833, 78.684396 },
-    { 72622, 88048, 46.180120 },
-    { 72622, 88635, 46.642830 },
-    { 72622, 89642, 50.005885 },
-    { 72622, 89931, 49.859103 },
-    { 72622, 89962, 53.356999 },
-    { 72622, 90185, 50.964872 },
-    { 72622, 90496, 51.282993 },
-    { 72622, 91262, 76.098644 },
-    { 72622, 92041, 55.222110 },
-    { 72622, 92855, 57.393482 },
-    { 72622, 93194, 76.686353 },
-    { 72622, 93506, 58.879027 },
-    { 72622, 93747, 69.623766 },
-    { 72622, 93864, 59.917909 },
-    { 72622, 94141, 61.169874 },
-    { 72622, 95501, 70.470411 },
-    { 72622, 95947, 80.716129 },
-    { 72622, 97278, 77.764322 },
-    { 72622, 97649, 78.253734 },
-    { 72622, 99473, 80.265852 },
-    { 72622, 100345, 78.973266 },
-    { 72622, 100751, 73.203342 },
-    { 72622, 101772, 76.060317 },
-    { 73273, 73334, 1.036208 },
-    { 73273, 73714, 17.887986 },
-    { 73273, 74785, 33.991378 },
-    { 73273, 74946, 25.684525 },
-    { 73273, 75141, 4.922738 },
-    { 73273, 75264, 4.617745 },
-    { 73273, 76267, 70.342002 },
-    { 73273, 76297, 7.060433 },
-    { 73273, 77070, 50.634229 },
-    { 73273, 77952, 21.874048 },
-    { 73273, 78265, 20.990642 },
-    { 73273, 78401, 24.181230 },
-    { 73273, 78820, 27.227014 },
-    { 73273, 79593, 42.877643 },
-    { 73273, 79882, 42.301509 },
-    { 73273, 80112, 24.334030 },
-    { 73273, 80763, 24.890902 },
-    { 73273, 80816, 67.979088 },
-    { 73273, 81266, 24.611739 },
-    { 73273, 81377, 38.980718 },
-    { 73273, 81693, 78.355725 },
-    { 73273, 82273, 29.538591 },
-    { 73273, 82396, 23.365635 },
-    { 73273, 82514, 21.996049 },
-    { 73273, 83000, 59.101195 },
-    { 73273, 83081, 23.049427 },
-    { 73273, 84012, 39.224099 },
-    { 73273, 84143, 24.192797 },
-    { 73273, 84345, 65.424060 },
-    { 73273, 84379, 74.870092 },
-    { 73273, 84970, 34.421577 },
-    { 73273, 85258, 26.510749 },
-    { 73273, 85267, 26.716669 },
-    { 73273, 85696, 29.380051 },
-    { 73273, 85792, 26.908782 },
-    { 73273, 85927, 29.975951 },
-    { 73273, 86032, 66.166261 },
-    { 73273, 86228, 28.724676 },
-    { 73273, 86670, 30.856361 },
-    { 73273, 86742, 60.488044 },
-    { 73273, 87073, 31.396438 },
-    { 73273, 87261, 32.960783 },
-    { 73273, 88048, 51.428531 },
-    { 73273, 88635, 39.028164 },
-    { 73273, 89642, 38.117625 },
-    { 73273, 89931, 42.116765 },
-    { 73273, 89962, 60.249577 },
-    { 73273, 90185, 40.380070 },
-    { 73273, 90496, 45.892345 },
-    { 73273, 92041, 48.199029 },
-    { 73273, 92855, 50.352962 },
-    { 73273, 93506, 49.670310 },
-    { 73273, 93747, 80.104308 },
-    { 73273, 93864, 51.691193 },
-    { 73273, 94141, 56.181526 },
-    { 73273, 95501, 75.486887 },
-    { 73273, 97649, 83.991263 },
-    { 73273, 99473, 80.844913 },
-    { 73273, 100345, 73.175475 },
-    { 73273, 100751, 51.030012 },
-    { 73273, 101772, 56.796445 },
-    { 73273, 108085, 73.972228 },
-    { 73273, 109268, 69.478148 },
-    { 73273, 110130, 61.973723 },
-    { 73273, 112122, 73.728802 },
-    { 73334, 73714, 16.852731 },
-    { 73334, 74785, 32.955641 },
-    { 73334, 74946, 26.703238 },
-    { 73334, 75141, 4.412927 },
-    { 73334, 75264, 4.991921 },
-    { 73334, 76267, 69.306498 },
-    { 73334, 76297, 6.784405 },
-    { 73334, 77070, 49.609027 },
-    { 73334, 77952, 22.827608 },
-    { 73334, 78265, 20.142054 },
-    { 73334, 78401, 23.293291 },
-    { 73334, 78820, 26.332679 },
-    { 73334, 79593, 41.918208 },
-    { 73334, 79882, 41.355718 },
-    { 73334, 80112, 23.600284 },
-    { 73334, 80763, 24.219932 },
-    { 73334, 80816, 66.986102 },
-    { 73334, 81266, 24.019705 },
-    { 73334, 81377, 38.127655 },
-    { 73334, 81693, 77.358225 },
-    { 73334, 82273, 30.472432 },
-    { 73334, 82396, 23.043004 },
-    { 73334, 82514, 21.835857 },
-    { 73334, 83000, 58.190692 },
-    { 73334, 83081, 23.699417 },
-    { 73334, 84012, 38.557155 },
-    { 73334, 84143, 24.310494 },
-    { 73334, 84345, 64.528878 },
-    { 73334, 84379, 73.934236 },
-    { 73334, 84970, 33.970181 },
-    { 73334, 85258, 27.106909 },
-    { 73334, 85267, 27.339294 },
-    { 73334, 85696, 29.309193 },
-    { 73334, 85792, 27.304615 },
-    { 73334, 85927, 29.906584 },
-    { 73334, 86032, 65.327604 },
-    { 73334, 86228, 28.869916 },
-    { 73334, 86670, 30.873841 },
-    { 73334, 86742, 59.727282 },
-    { 73334, 87073, 31.461436 },
-    { 73334, 87261, 32.933427 },
-    { 73334, 88048, 50.866658 },
-    { 73334, 88635, 38.867507 },
-    { 73334, 89642, 38.152390 },
-    { 73334, 89931, 41.989781 },
-    { 73334, 89962, 59.680259 },
-    { 73334, 90185, 40.370550 },
-    { 73334, 90496, 45.693319 },
-    { 73334, 92041, 48.087081 },
-    { 73334, 92855, 50.256398 },
-    { 73334, 93506, 49.665255 },
-    { 73334, 93747, 79.492662 },
-    { 73334, 93864, 51.655098 },
-    { 73334, 94141, 56.034092 },
-    { 73334, 95501, 75.049430 },
-    { 73334, 97278, 83.996689 },
-    { 73334, 97649, 83.560971 },
-    { 73334, 99473, 80.595693 },
-    { 73334, 100345, 73.146381 },
-    { 73334, 100751, 51.690065 },
-    { 73334, 101772, 57.314552 },
-    { 73334, 108085, 74.494303 },
-    { 73334, 109268, 70.139071 },
-    { 73334, 110130, 62.788313 },
-    { 73334, 112122, 74.446897 },
-    { 73714, 74785, 16.193521 },
-    { 73714, 74946, 43.455040 },
-    { 73714, 75141, 15.782587 },
-    { 73714, 75264, 19.769719 },
-    { 73714, 76267, 52.518157 },
-    { 73714, 76297, 17.143754 },
-    { 73714, 77070, 33.179603 },
-    { 73714, 77952, 39.066358 },
-    { 73714, 78265, 12.362990 },
-    { 73714, 78401, 13.119747 },
-    { 73714, 78820, 15.177296 },
-    { 73714, 79593, 27.406268 },
-    { 73714, 79882, 27.221660 },
-    { 73714, 80112, 17.397843 },
-    { 73714, 80763, 19.210919 },
-    { 73714, 80816, 51.232349 },
-    { 73714, 81266, 20.673850 },
-    { 73714, 81377, 26.506594 },
-    { 73714, 81693, 61.439887 },
-    { 73714, 82273, 46.425850 },
-    { 73714, 82396, 24.628932 },
-    { 73714, 82514, 26.109612 },
-    { 73714, 83000, 44.340302 },
-    { 73714, 83081, 37.069056 },
-    { 73714, 84012, 30.990336 },
-    { 73714, 84143, 31.671760 },
-    { 73714, 84345, 50.849571 },
-    { 73714, 84379, 59.282875 },
-    { 73714, 84380, 69.327312 },
-    { 73714, 84970, 31.131514 },
-    { 73714, 85258, 39.671123 },
-    { 73714, 85267, 40.173653 },
-    { 73714, 85670, 83.912522 },
-    { 73714, 85696, 33.310078 },
-    { 73714, 85792, 37.599942 },
-    { 73714, 85927, 33.834491 },
-    { 73714, 86032, 52.750094 },
-    { 73714, 86228, 35.888603 },
-    { 73714, 86670, 35.892078 },
-    { 73714, 86742, 48.854264 },
-    { 73714, 87073, 37.061024 },
-    { 73714, 87261, 37.035351 },
-    { 73714, 88048, 44.249331 },
-    { 73714, 88635, 40.234465 },
-    { 73714, 89642, 42.553714 },
-    { 73714, 89931, 43.558684 },
-    { 73714, 89962, 52.386026 },
-    { 73714, 90185, 43.896437 },
-    { 73714, 90496, 45.769119 },
-    { 73714, 91262, 81.108692 },
-    { 73714, 92041, 49.352928 },
-    { 73714, 92855, 51.596921 },
-    { 73714, 93194, 80.532332 },
-    { 73714, 93506, 52.476572 },
-    { 73714, 93747, 70.600285 },
-    { 73714, 93864, 53.842167 },
-    { 73714, 94141, 56.155491 },
-    { 73714, 95501, 69.312193 },
-    { 73714, 95947, 83.329544 },
-    { 73714, 97278, 77.448098 },
-    { 73714, 97649, 77.582356 },
-    { 73714, 99473, 77.733892 },
-    { 73714, 100345, 74.201073 },
-    { 73714, 100751, 63.905323 },
-    { 73714, 101772, 67.381842 },
-    { 73714, 109268, 81.858320 },
-    { 73714, 110130, 76.839053 },
-    { 74785, 74946, 59.297425 },
-    { 74785, 75097, 81.219191 },
-    { 74785, 75141, 31.279574 },
-    { 74785, 75264, 35.328007 },
-    { 74785, 75458, 68.367619 },
-    { 74785, 76267, 36.351863 },
-    { 74785, 76297, 32.035690 },
-    { 74785, 77070, 17.205191 },
-    { 74785, 77952, 54.477224 },
-    { 74785, 78265, 19.448527 },
-    { 74785, 78401, 16.823821 },
-    { 74785, 78820, 15.665925 },
-    { 74785, 79593, 15.329435 },
-    { 74785, 79882, 15.914429 },
-    { 74785, 80112, 22.243783 },
-    { 74785, 80331, 72.102654 },
-    { 74785, 80763, 24.169874 },
-    { 74785, 80816, 35.721409 },
-    { 74785, 81266, 26.429490 },
-    { 74785, 81377, 19.766910 },
-    { 74785, 81693, 45.677380 },
-    { 74785, 82273, 61.478139 },
-    { 74785, 82396, 32.801881 },
-    { 74785, 82514, 35.724787 },
-    { 74785, 83000, 31.296862 },
-    { 74785, 83081, 50.680920 },
-    { 74785, 83895, 77.885803 },
-    { 74785, 84012, 28.353317 },
-    { 74785, 84143, 42.130320 },
-    { 74785, 84345, 37.628062 },
-    { 74785, 84379, 44.705078 },
-    { 74785, 84380, 53.859516 },
-    { 74785, 84970, 33.556105 },
-    { 74785, 85258, 52.585068 },
-    { 74785, 85267, 53.232941 },
-    { 74785, 85670, 67.979198 },
-    { 74785, 85696, 41.084414 },
-    { 74785, 85792, 49.187623 },
-    { 74785, 85927, 41.449253 },
-    { 74785, 86032, 40.679950 },
-    { 74785, 86228, 45.435168 },
-    { 74785, 86670, 43.962634 },
-    { 74785, 86742, 39.066585 },
-    { 74785, 87073, 45.379369 },
-    { 74785, 87261, 44.195083 },
-    { 74785, 87833, 69.895758 },
-    { 74785, 88048, 39.917670 },
-    { 74785, 88635, 44.536174 },
-    { 74785, 89642, 49.083051 },
-    { 74785, 89931, 47.491599 },
-    { 74785, 89962, 46.229061 },
-    { 74785, 90185, 49.493174 },
-    { 74785, 90496, 47.992261 },
-    { 74785, 91262, 66.894213 },
-    { 74785, 92041, 52.171960 },
-    { 74785, 92855, 54.192850 },
-    { 74785, 93194, 67.514128 },
-    { 74785, 93506, 56.315715 },
-    { 74785, 93747, 61.234698 },
-    { 74785, 93864, 56.947299 },
-    { 74785, 94141, 57.048093 },
-    { 74785, 95501, 63.141087 },
-    { 74785, 95947, 71.736897 },
-    { 74785, 97165, 80.994963 },
-    { 74785, 97278, 69.879172 },
-    { 74785, 97649, 70.545731 },
-    { 74785, 99473, 73.662198 },
-    { 74785, 100345, 74.194723 },
-    { 74785, 100751, 75.132609 },
-    { 74785, 101772, 76.444037 },
-    { 74946, 75141, 28.033946 },
-    { 74946, 75264, 23.994822 },
-    { 74946, 76297, 27.597736 },
-    { 74946, 77070, 75.235904 },
-    { 74946, 77952, 6.395366 },
-    { 74946, 78265, 42.982640 },
-    { 74946, 78401, 46.491271 },
-    { 74946, 78820, 49.406243 },
-    { 74946, 79593, 65.651505 },
-    { 74946, 79882, 64.756220 },
-    { 74946, 80112, 44.086651 },
-    { 74946, 80763, 43.534000 },
-    { 74946, 81266, 42.019252 },
-    { 74946, 81377, 59.494182 },
-    { 74946, 82273, 8.056917 },
-    { 74946, 82396, 36.703231 },
-    { 74946, 82514, 33.151821 },
-    { 74946, 83000, 79.968686 },
-    { 74946, 83081, 16.936094 },
-    { 74946, 84012, 55.814938 },
-    { 74946, 84143, 29.384447 },
-    { 74946, 84970, 47.405316 },
-    { 74946, 85258, 19.391334 },
-    { 74946, 85267, 18.710758 },
-    { 74946, 85696, 36.182821 },
-    { 74946, 85792, 24.727332 },
-    { 74946, 85927, 36.554390 },
-    { 74946, 86228, 31.330766 },
-    { 74946, 86670, 35.369825 },
-    { 74946, 86742, 77.378125 },
-    { 74946, 87073, 34.723833 },
-    { 74946, 87261, 37.749465 },
-    { 74946, 88048, 64.373811 },
-    { 74946, 88635, 45.111349 },
-    { 74946, 89642, 40.125100 },
-    { 74946, 89931, 46.815029 },
-    { 74946, 89962, 72.473833 },
-    { 74946, 90185, 42.833210 },
-    { 74946, 90496, 51.483938 },
-    { 74946, 92041, 51.417127 },
-    { 74946, 92855, 52.851380 },
-    { 74946, 93506, 50.154447 },
-    { 74946, 93864, 52.559579 },
-    { 74946, 94141, 58.970266 },
-    { 74946, 95501, 83.003828 },
-    { 74946, 99473, 83.162687 },
-    { 74946, 100345, 71.001389 },
-    { 74946, 100751, 34.426704 },
-    { 74946, 101772, 43.216346 },
-    { 74946, 107556, 77.526229 },
-    { 74946, 108085, 58.575565 },
-    { 74946, 109268, 51.106549 },
-    { 74946, 110130, 40.316188 },
-    { 74946, 112122, 53.756805 },
-    { 74946, 113136, 83.566339 },
-    { 74946, 113368, 70.825133 },
-    { 75097, 75458, 12.874893 },
-    { 75097, 76267, 45.160794 },
-    { 75097, 77070, 65.511274 },
-    { 75097, 79593, 76.028908 },
-    { 75097, 79882, 77.100886 },
-    { 75097, 80331, 11.987280 },
-    { 75097, 80816, 51.322326 },
-    { 75097, 81377, 83.376092 },
-    { 75097, 81693, 41.651848 },
-    { 75097, 83000, 64.197281 },
-    { 75097, 83895, 11.388299 },
-    { 75097, 84345, 59.895216 },
-    { 75097, 84379, 49.638710 },
-    { 75097, 84380, 37.955498 },
-    { 75097, 85670, 24.115171 },
-    { 75097, 86032, 62.597268 },
-    { 75097, 86742, 70.847727 },
-    { 75097, 87833, 26.566104 },
-    { 75097, 89962, 80.119920 },
-    { 75097, 91262, 41.024364 },
-    { 75097, 93194, 48.291750 },
-    { 75097, 93747, 66.660079 },
-    { 75097, 94376, 19.657059 },
-    { 75097, 95501, 78.367143 },
-    { 75097, 95947, 55.065023 },
-    { 75097, 97165, 40.302401 },
-    { 75097, 97278, 72.676499 },
-    { 75097, 97649, 74.675357 },
-    { 75097, 100453, 47.617240 },
-    { 75097, 102098, 44.555344 },
-    { 75097, 102488, 55.270591 },
-    { 75097, 104732, 60.824001 },
-    { 75097, 105199, 32.349334 },
-    { 75097, 106032, 26.823188 },
-    { 75097, 107315, 82.439694 },
-    { 75097, 109492, 39.475430 },
-    { 75097, 112158, 67.442670 },
-    { 75097, 113881, 70.868919 },
-    { 75097, 113963, 83.264676 },
-    { 75097, 116727, 27.110016 },
-    { 75141, 75264, 4.049261 },
-    { 75141, 76267, 67.433329 },
-    { 75141, 76297, 2.652626 },
-    { 75141, 77070, 47.366406 },
-    { 75141, 77952, 23.320570 },
-    { 75141, 78265, 16.481454 },
-    { 75141, 78401, 19.810081 },
-    { 75141, 78820, 22.866821 },
-    { 75141, 79593, 38.832026 },
-    { 75141, 79882, 38.163141 },
-    { 75141, 80112, 19.523712 },
-    { 75141, 80763, 20.005328 },
-    { 75141, 80816, 64.167611 },
-    { 75141, 81266, 19.689780 },
-    { 75141, 81377, 34.420245 },
-    { 75141, 81693, 74.574722 },
-    { 75141, 82273, 30.643886 },
-    { 75141, 82396, 18.667933 },
-    { 75141, 82514, 17.638035 },
-    { 75141, 83000, 54.734285 },
-    { 75141, 83081, 22.070085 },
-    { 75141, 84012, 34.328548 },
-    { 75141, 84143, 20.666345 },
-    { 75141, 84345, 60.982156 },
-    { 75141, 84379, 70.613022 },
-    { 75141, 84380, 81.722116 },
-    { 75141, 84970, 29.558655 },
-    { 75141, 85258, 25.151247 },
-    { 75141, 85267, 25.508572 },
-    { 75141, 85696, 25.227607 },
-    { 75141, 85792, 24.502689 },
-    { 75141, 85927, 25.825695 },
-    { 75141, 86032, 61.531652 },
-    { 75141, 86228, 25.262708 },
-    { 75141, 86670, 26.955488 },
-    { 75141, 86742, 55.689707 },
-    { 75141, 87073, 27.643917 },
-    { 75141, 87261, 28.919233 },
-    { 75141, 88048, 46.508059 },
-    { 75141, 88635, 34.631877 },
-    { 75141, 89642, 34.245992 },
-    { 75141, 89931, 37.795361 },
-    { 75141, 89962, 55.328143 },
-    { 75141, 90185, 36.371244 },
-    { 75141, 90496, 41.406584 },
-    { 75141, 92041, 43.907165 },
-    { 75141, 92855, 46.096605 },
-    { 75141, 93506, 45.657947 },
-    { 75141, 93747, 75.183043 },
-    { 75141, 93864, 47.590032 },
-    { 75141, 94141, 51.800363 },
-    { 75141, 95501, 70.637289 },
-    { 75141, 97278, 79.588863 },
-    { 75141, 97649, 79.148382 },
-    { 75141, 99473, 76.250051 },
-    { 75141, 100345, 69.072478 },
-    { 75141, 100751, 49.844684 },
-    { 75141, 101772, 54.800324 },
-    { 75141, 108085, 71.943401 },
-    { 75141, 109268, 68.225196 },
-    { 75141, 110130, 61.787431 },
-    { 75141, 112122, 72.818404 },
-    { 75264, 76267, 71.457131 },
-    { 75264, 76297, 4.195949 },
-    { 75264, 77070, 51.345182 },
-    { 75264, 77952, 19.300161 },
-    { 75264, 78265, 19.953341 },
-    { 75264, 78401, 23.378619 },
-    { 75264, 78820, 26.420283 },
-    { 75264, 79593, 42.539653 },
-    { 75264, 79882, 41.815069 },
-    { 75264, 80112, 22.453883 },
-    { 75264, 80763, 22.651326 },
-    { 75264, 80816, 67.953456 },
-    { 75264, 81266, 21.987273 },
-    { 75264, 81377, 37.696353 },
-    { 75264, 81693, 78.362891 },
-    { 75264, 82273, 26.692379 },
-    { 75264, 82396, 19.728696 },
-    { 75264, 82514, 17.931380 },
-    { 75264, 83000, 58.164535 },
-    { 75264, 83081, 18.865976 },
-    { 75264, 84012, 36.798657 },
-    { 75264, 84143, 19.659156 },
-    { 75264, 84345, 64.323719 },
-    { 75264, 84379, 74.112504 },
-    { 75264, 84970, 31.113212 },
-    { 75264, 85258, 22.191460 },
-    { 75264, 85267, 22.456197 },
-    { 75264, 85696, 25.090412 },
-    { 75264, 85792, 22.323468 },
-    { 75264, 85927, 25.681738 },
-    { 75264, 86032, 64.620752 },
-    { 75264, 86228, 24.161965 },
-    { 75264, 86670, 26.425050 },
-    { 75264, 86742, 58.459231 },
-    { 75264, 87073, 26.905723 },
-    { 75264, 87261, 28.589641 },
-    { 75264, 88048, 48.456271 },
-    { 75264, 88635, 34.883288 },
-    { 75264, 89642, 33.653470 },
-    { 75264, 89931, 37.897797 },
-    { 75264, 89962, 57.276335 },
-    { 75264, 90185, 35.970573 },
-    { 75264, 90496, 41.813439 },
-    { 75264, 92041, 43.941883 },
-    { 75264, 92855, 46.065834 },
-    { 75264, 93506, 45.245014 },
-    { 75264, 93747, 77.254496 },
-    { 75264, 93864, 47.306977 },
-    { 75264, 94141, 51.979246 },
-    { 75264, 95501, 71.991859 },
-    { 75264, 97278, 81.033229 },
-    { 75264, 97649, 80.457337 },
-    { 75264, 99473, 76.825925 },
-    { 75264, 100345, 68.766284 },
-    { 75264, 100751, 46.837200 },
-    { 75264, 101772, 52.332364 },
-    { 75264, 107556, 82.940834 },
-    { 75264, 108085, 69.512290 },
-    { 75264, 109268, 65.278686 },
-    { 75264, 110130, 58.292738 },
-    { 75264, 112122, 69.683048 },
-    { 75458, 76267, 32.295885 },
-    { 75458, 77070, 52.671932 },
-    { 75458, 78401, 81.915724 },
-    { 75458, 78820, 79.212501 },
-    { 75458, 79593, 63.425785 },
-    { 75458, 79882, 64.542688 },
-    { 75458, 80331, 7.739163 },
-    { 75458, 80816, 39.261203 },
-    { 75458, 81377, 71.052389 },
-    { 75458, 81693, 30.236445 },
-    { 75458, 83000, 52.615674 },
-    { 75458, 83895, 13.670738 },
-    { 75458, 84012, 77.736096 },
-    { 75458, 84345, 48.990604 },
-    { 75458, 84379, 39.209210 },
-    { 75458, 84380, 28.427671 },
-    { 75458, 85670, 18.712187 },
-    { 75458, 86032, 52.356989 },
-    { 75458, 86742, 60.589637 },
-    { 75458, 87833, 22.523216 },
-    { 75458, 88048, 75.402440 },
-    { 75458, 89962, 70.945433 },
-    { 75458, 91262, 36.330163 },
-    { 75458, 93194, 43.875690 },
-    { 75458, 93747, 60.557754 },
-    { 75458, 94376, 25.901154 },
-    { 75458, 95501, 72.371374 },
-    { 75458, 95947, 51.728574 },
-    { 75458, 97165, 40.454490 },
-    { 75458, 97278, 68.327571 },
-    { 75458, 97649, 70.396495 },
-    { 75458, 99473, 81.345012 },
-    { 75458, 100453, 48.698753 },
-    { 75458, 102098, 47.367989 },
-    { 75458, 102488, 56.587064 },
-    { 75458, 104732, 62.956375 },
-    { 75458, 105199, 39.895600 },
-    { 75458, 106032, 36.368132 },
-    { 75458, 109492, 47.609687 },
-    { 75458, 112158, 73.593043 },
-    { 75458, 113881, 77.689087 },
-    { 75458, 116727, 39.116993 },
-    { 76267, 76297, 67.881687 },
-    { 76267, 77070, 20.417124 },
-    { 76267, 78265, 53.148582 },
-    { 76267, 78401, 49.724960 },
-    { 76267, 78820, 47.113849 },
-    { 76267, 79593, 31.883725 },
-    { 76267, 79882, 33.133858 },
-    { 76267, 80112, 53.494895 },
-    { 76267, 80331, 35.773284 },
-    { 76267, 80763, 54.755005 },
-    { 76267, 80816, 13.696862 },
-    { 76267, 81266, 56.861101 },
-    { 76267, 81377, 40.249205 },
-    { 76267, 81693, 15.320648 },
-    { 76267, 82396, 63.574903 },
-    { 76267, 82514, 67.240803 },
-    { 76267, 83000, 26.180611 },
-    { 76267, 83895, 41.702062 },
-    { 76267, 84012, 48.385254 },
-    { 76267, 84143, 73.451981 },
-    { 76267, 84345, 26.369225 },
-    { 76267, 84379, 22.631547 },
-    { 76267, 84380, 23.503199 },
-    { 76267, 84970, 57.830453 },
-    { 76267, 85670, 33.515074 },
-    { 76267, 85696, 69.574311 },
-    { 76267, 85792, 80.890979 },
-    { 76267, 85927, 69.669371 },
-    { 76267, 86032, 31.530574 },
-    { 76267, 86228, 75.202028 },
-    { 76267, 86670, 72.200884 },
-    { 76267, 86742, 37.880904 },
-    { 76267, 87073, 73.643099 },
-    { 76267, 87261, 71.233939 },
-    { 76267, 87833, 36.419508 },
-    { 76267, 88048, 50.573379 },
-    { 76267, 88635, 67.596014 },
-    { 76267, 89642, 74.145448 },
-    { 76267, 89931, 69.140092 },
-    { 76267, 89962, 49.923723 },
-    { 76267, 90185, 73.097886 },
-    { 76267, 90496, 66.798938 },
-    { 76267, 91262, 39.727121 },
-    { 76267, 92041, 70.656633 },
-    { 76267, 92855, 71.696945 },
-    { 76267, 93194, 44.336660 },
-    { 76267, 93506, 75.340396 },
-    { 76267, 93747, 50.692594 },
-    { 76267, 93864, 74.535913 },
-    { 76267, 94141, 70.638590 },
-    { 76267, 94376, 52.183879 },
-    { 76267, 95501, 59.933679 },
-    { 76267, 95947, 51.900426 },
-    { 76267, 97165, 52.490704 },
-    { 76267, 97278, 61.128541 },
-    { 76267, 97649, 62.878603 },
-    { 76267, 99473, 71.857205 },
-    { 76267, 100345, 80.897580 },
-    { 76267, 100453, 59.837345 },
-    { 76267, 102098, 62.343423 },
-    { 76267, 102488, 66.000737 },
-    { 76267, 104732, 72.575214 },
-    { 76267, 105199, 64.662306 },
-    { 76267, 106032, 64.421873 },
-    { 76267, 109492, 72.055044 },
-    { 76267, 116727, 70.116811 },
-    { 76297, 77070, 47.638209 },
-    { 76297, 77952, 22.456151 },
-    { 76297, 78265, 15.830440 },
-    { 76297, 78401, 19.286326 },
-    { 76297, 78820, 22.313148 },
-    { 76297, 79593, 38.493554 },
-    { 76297, 79882, 37.735092 },
-    { 76297, 80112, 18.263248 },
-    { 76297, 80763, 18.503454 },
-    { 76297, 80816, 63.947506 },
-    { 76297, 81266, 17.935964 },
-    { 76297, 81377, 33.507235 },
-    { 76297, 81693, 74.353052 },
-    { 76297, 82273, 29.502059 },
-    { 76297, 82396, 16.305290 },
-    { 76297, 82514, 15.071339 },
-    { 76297, 83000, 53.993579 },
-    { 76297, 83081, 20.100088 },
-    { 76297, 84012, 32.716514 },
-    { 76297, 84143, 18.021005 },
-    { 76297, 84345, 60.136842 },
-    { 76297, 84379, 69.954432 },
-    { 76297, 84380, 81.259593 },
-    { 76297, 84970, 27.425332 },
-    { 76297, 85258, 23.005757 },
-    { 76297, 85267, 23.414333 },
-    { 76297, 85696, 22.614975 },
-    { 76297, 85792, 22.040101 },
-    { 76297, 85927, 23.213105 },
-    { 76297, 86032, 60.427789 },
-    { 76297, 86228, 22.618195 },
-    { 76297, 86670, 24.310723 },
-    { 76297, 86742, 54.310468 },
-    { 76297, 87073, 24.992119 },
-    { 76297, 87261, 26.290531 },
-    { 76297, 88048, 44.590386 },
-    { 76297, 88635, 32.094096 },
-    { 76297, 89642, 31.601499 },
-    { 76297, 89931, 35.233161 },
-    { 76297, 89962, 53.417313 },
-    { 76297, 90185, 33.741450 },
-    { 76297, 90496, 38.909509 },
-    { 76297, 92041, 41.338436 },
-    { 76297, 92855, 43.518698 },
-    { 76297, 93506, 43.031551 },
-    { 76297, 93747, 73.350469 },
-    { 76297, 93864, 44.978238 },
-    { 76297, 94141, 49.263154 },
-    { 76297, 95501, 68.461055 },
-    { 76297, 97278, 77.454583 },
-    { 76297, 97649, 76.958858 },
-    { 76297, 99473, 73.818140 },
-    { 76297, 100345, 66.465917 },
-    { 76297, 100751, 47.647606 },
-    { 76297, 101772, 52.365692 },
-    { 76297, 107556, 81.644632 },
-    { 76297, 108085, 69.482392 },
-    { 76297, 109268, 65.972084 },
-    { 76297, 110130, 59.913136 },
-    { 76297, 112122, 70.664385 },
-    { 77070, 77952, 69.885829 },
-    { 77070, 78265, 32.731471 },
-    { 77070, 78401, 29.311925 },
-    { 77070, 78820, 26.742998 },
-    { 77070, 79593, 12.600527 },
-    { 77070, 79882, 13.994586 },
-    { 77070, 80112, 33.251289 },
-    { 77070, 80331, 55.583283 },
-    { 77070, 80763, 34.632136 },
-    { 77070, 80816, 18.717952 },
-    { 77070, 81266, 36.811481 },
-    { 77070, 81377, 21.496112 },
-    { 77070, 81693, 28.485428 },
-    { 77070, 82273, 76.277316 },
-    { 77070, 82396, 43.596234 },
-    { 77070, 82514, 47.173330 },
-    { 77070, 83000, 18.411159 },
-    { 77070, 83081, 64.274554 },
-    { 77070, 83895, 61.103619 },
-    { 77070, 84012, 30.743088 },
-    { 77070, 84143, 53.509523 },
-    { 77070, 84345, 23.584538 },
-    { 77070, 84379, 28.478419 },
-    { 77070, 84380, 36.769085 },
-    { 77070, 84970, 39.407466 },
-    { 77070, 85258, 65.393234 },
-    { 77070, 85267, 66.149920 },
-    { 77070, 85670, 50.789323 },
-    { 77070, 85696, 50.291128 },
-    { 77070, 85792, 60.950749 },
-    { 77070, 85927, 50.467015 },
-    { 77070, 86032, 27.947933 },
-    { 77070, 86228, 55.679632 },
-    { 77070, 86670, 53.057091 },
-    { 77070, 86742, 29.718257 },
-    { 77070, 87073, 54.526617 },
-    { 77070, 87261, 52.438988 },
-    { 77070, 87833, 52.699150 },
-    { 77070, 88048, 37.266540 },
-    { 77070, 88635, 50.064298 },
-    { 77070, 89642, 56.121291 },
-    { 77070, 89931, 52.224655 },
-    { 77070, 89962, 40.292356 },
-    { 77070, 90185, 55.581304 },
-    { 77070, 90496, 50.944567 },
-    { 77070, 91262, 50.574213 },
-    { 77070, 92041, 55.142836 },
-    { 77070, 92855, 56.672507 },
-    { 77070, 93194, 52.211179 },
-    { 77070, 93506, 59.812045 },
-    { 77070, 93747, 49.964518 },
-    { 77070, 93864, 59.613689 },
-    { 77070, 94141, 57.393382 },
-    { 77070, 94376, 70.386563 },
-    { 77070, 95501, 55.190896 },
-    { 77070, 95947, 57.624386 },
-    { 77070, 97165, 64.661322 },
-    { 77070, 97278, 59.894274 },
-    { 77070, 97649, 61.064921 },
-    { 77070, 99473, 67.016333 },
-    { 77070, 100345, 71.768038 },
-    { 77070, 100453, 70.243613 },
-    { 77070, 101772, 83.617415 },
-    { 77070, 102098, 74.405318 },
-    { 77070, 102488, 74.390348 },
-    { 77070, 104732, 80.017378 },
-    { 77070, 105199, 81.342739 },
-    { 77070, 106032, 82.643889 },
-    { 77952, 78265, 37.320667 },
-    { 77952, 78401, 40.817398 },
-    { 77952, 78820, 43.659569 },
-    { 77952, 79593, 59.839560 },
-    { 77952, 79882, 58.889644 },
-    { 77952, 80112, 38.079332 },
-    { 77952, 80763, 37.421056 },
-    { 77952, 81266, 35.826177 },
-    { 77952, 81377, 53.390260 },
-    { 77952, 82273, 7.741501 },
-    { 77952, 82396, 30.361070 },
-    { 77952, 82514, 26.781317 },
-    { 77952, 83000, 73.781191 },
-    { 77952, 83081, 10.873051 },
-    { 77952, 84012, 49.461111 },
-    { 77952, 84143, 23.026539 },
-    { 77952, 84345, 79.328580 },
-    { 77952, 84970, 41.009982 },
-    { 77952, 85258, 13.790385 },
-    { 77952, 85267, 13.224936 },
-    { 77952, 85696, 29.860023 },
-    { 77952, 85792, 18.760276 },
-    { 77952, 85927, 30.246507 },
-    { 77952, 86032, 78.383950 },
-    { 77952, 86228, 25.161443 },
-    { 77952, 86670, 29.159640 },
-    { 77952, 86742, 70.987487 },
-    { 77952, 87073, 28.587559 },
-    { 77952, 87261, 31.567641 },
-    { 77952, 88048, 58.009126 },
-    { 77952, 88635, 38.957910 },
-    { 77952, 89642, 34.252047 },
-    { 77952, 89931, 40.804141 },
-    { 77952, 89962, 66.164591 },
-    { 77952, 90185, 36.974188 },
-    { 77952, 90496, 45.462011 },
-    { 77952, 92041, 45.639037 },
-    { 77952, 92855, 47.184769 },
-    { 77952, 93506, 44.705165 },
-    { 77952, 93864, 47.104275 },
-    { 77952, 94141, 53.367776 },
-    { 77952, 95501, 77.128869 },
-    { 77952, 99473, 77.959254 },
-    { 77952, 100345, 66.366937 },
-    { 77952, 100751, 32.729909 },
-    { 77952, 101772, 40.715522 },
-    { 77952, 106278, 82.382037 },
-    { 77952, 107556, 74.714751 },
-    { 77952, 108085, 56.996947 },
-    { 77952, 109268, 50.485457 },
-    { 77952, 110130, 41.061491 },
-    { 77952, 112122, 53.846576 },
-    { 77952, 113136, 82.336621 },
-    { 77952, 113368, 70.285002 },
-    { 78265, 78401, 3.508673 },
-    { 78265, 78820, 6.487941 },
-    { 78265, 79593, 22.725601 },
-    { 78265, 79882, 21.922106 },
-    { 78265, 80112, 5.051829 },
-    { 78265, 80763, 6.856169 },
-    { 78265, 80816, 48.207046 },
-    { 78265, 81266, 8.497854 },
-    { 78265, 81377, 17.990077 },
-    { 78265, 81693, 58.597779 },
-    { 78265, 82273, 43.546107 },
-    { 78265, 82396, 13.757925 },
-    { 78265, 82514, 16.351635 },
-    { 78265, 83000, 38.260004 },
-    { 78265, 83081, 31.774947 },
-    { 78265, 84012, 19.634562 },
-    { 78265, 84143, 22.706541 },
-    { 78265, 84345, 44.502141 },
-    { 78265, 84379, 54.172546 },
-    { 78265, 84380, 65.429196 },
-    { 78265, 84970, 18.768631 },
-    { 78265, 85258, 33.347524 },
-    { 78265, 85267, 34.035887 },
-    { 78265, 85670, 80.934909 },
-    { 78265, 85696, 22.430959 },
-    { 78265, 85792, 29.744635 },
-    { 78265, 85927, 22.880304 },
-    { 78265, 86032, 45.185858 },
-    { 78265, 86228, 26.206313 },
-    { 78265, 86670, 25.231742 },
-    { 78265, 86742, 39.792298 },
-    { 78265, 87073, 26.567212 },
-    { 78265, 87261, 25.917509 },
-    { 78265, 87833, 81.807777 },
-    { 78265, 88048, 32.784211 },
-    { 78265, 88635, 28.190703 },
-    { 78265, 89642, 31.253180 },
-    { 78265, 89931, 31.479999 },
-    { 78265, 89962, 41.299608 },
-    { 78265, 90185, 32.268224 },
-    { 78265, 90496, 33.463903 },
-    { 78265, 91262, 74.678743 },
-    { 78265, 92041, 37.140760 },
-    { 78265, 92855, 39.370963 },
-    { 78265, 93194, 72.757251 },
-    { 78265, 93506, 40.474040 },
-    { 78265, 93747, 60.457342 },
-    { 78265, 93864, 41.710082 },
-    { 78265, 94141, 43.805886 },
-    { 78265, 95501, 57.842133 },
-    { 78265, 95947, 74.258421 },
-    { 78265, 97278, 66.326774 },
-    { 78265, 97649, 66.263503 },
-    { 78265, 99473, 65.648352 },
-    { 78265, 100345, 61.849466 },
-    { 78265, 100751, 55.746255 },
-    { 78265, 101772, 57.659954 },
-    { 78265, 106278, 81.436356 },
-    { 78265, 107556, 80.403786 },
-    { 78265, 108085, 73.592893 },
-    { 78265, 109268, 72.744531 },
-    { 78265, 110130, 69.877057 },
-    { 78265, 112122, 78.188240 },
-    { 78401, 78820, 3.057050 },
-    { 78401, 79593, 19.229356 },
-    { 78401, 79882, 18.448817 },
-    { 78401, 80112, 5.609418 },
-    { 78401, 80763, 7.629556 },
-    { 78401, 80816, 44.708399 },
-    { 78401, 81266, 9.778482 },
-    { 78401, 81377, 14.925667 },
-    { 78401, 81693, 55.102946 },
-    { 78401, 82273, 46.982290 },
-    { 78401, 82396, 15.978405 },
-    { 78401, 82514, 18.972597 },
-    { 78401, 83000, 34.942717 },
-    { 78401, 83081, 35.060770 },
-    { 78401, 84012, 17.900836 },
-    { 78401, 84143, 25.417149 },
-    { 78401, 84345, 41.243290 },
-    { 78401, 84379, 50.803077 },
-    { 78401, 84380, 61.988150 },
-    { 78401, 84970, 18.813553 },
-    { 78401, 85258, 36.481543 },
-    { 78401, 85267, 37.192434 },
-    { 78401, 85670, 77.463800 },
-    { 78401, 85696, 24.362082 },
-    { 78401, 85792, 32.627820 },
-    { 78401, 85927, 24.757076 },
-    { 78401, 86032, 42.127485 },
-    { 78401, 86228, 28.613024 },
-    { 78401, 86670, 27.225437 },
-    { 78401, 86742, 37.070585 },
-    { 78401, 87073, 28.621215 },
-    { 78401, 87261, 27.631760 },
-    { 78401, 87833, 78.381975 },
-    { 78401, 88048, 31.166089 },
-    { 78401, 88635, 29.025893 },
-    { 78401, 89642, 32.761608 },
-    { 78401, 89931, 32.225538 },
-    { 78401, 89962, 39.436138 },
-    { 78401, 90185, 33.505941 },
-    { 78401, 90496, 33.723831 },
-    { 78401, 91262, 71.513992 },
-    { 78401, 92041, 37.607229 },
-    { 78401, 92855, 39.793220 },
-    { 78401, 93194, 69.824118 },
-    { 78401, 93506, 41.243792 },
-    { 78401, 93747, 58.174481 },
-    { 78401, 93864, 42.287552 },
-    { 78401, 94141, 43.807443 },
-    { 78401, 95501, 56.254388 },
-    { 78401, 95947, 71.645146 },
-    { 78401, 97278, 64.522339 },
-    { 78401, 97649, 64.580038 },
-    { 78401, 99473, 64.645168 },
-    { 78401, 100345, 61.774881 },
-    { 78401, 100751, 58.338640 },
-    { 78401, 101772, 59.744090 },
-    { 78401, 106278, 81.234766 },
-    { 78401, 107556, 80.894560 },
-    { 78401, 108085, 75.289267 },
-    { 78401, 109268, 74.964073 },
-    { 78401, 110130, 72.679629 },
-    { 78401, 112122, 80.507837 },
-    { 78820, 79593, 16.257215 },
-    { 78820, 79882, 15.434942 },
-    { 78820, 80112, 6.831784 },
-    { 78820, 80331, 81.404647 },
-    { 78820, 80763, 8.615679 },
-    { 78820, 80816, 41.737087 },
-    { 78820, 81266, 10.905403 },
-    { 78820, 81377, 11.989955 },
-    { 78820, 81693, 52.121122 },
-    { 78820, 82273, 49.672595 },
-    { 78820, 82396, 17.551998 },
-    { 78820, 82514, 20.838255 },
-    { 78820, 83000, 31.887921 },
-    { 78820, 83081, 37.532061 },
-    { 78820, 84012, 15.981445 },
-    { 78820, 84143, 27.291119 },
-    { 78820, 84345, 38.197575 },
-    { 78820, 84379, 47.746628 },
-    { 78820, 84380, 58.949800 },
-    { 78820, 84970, 18.424432 },
-    { 78820, 85258, 38.754985 },
-    { 78820, 85267, 39.491303 },
-    { 78820, 85670, 74.446978 },
-    { 78820, 85696, 25.512601 },
-    { 78820, 85792, 34.631320 },
-    { 78820, 85927, 25.852473 },
-    { 78820, 86032, 39.148455 },
-    { 78820, 86228, 30.160168 },
-    { 78820, 86670, 28.396365 },
-    { 78820, 86742, 34.271476 },
-    { 78820, 87073, 29.832939 },
-    { 78820, 87261, 28.541048 },
-    { 78820, 87833, 75.337372 },
-    { 78820, 88048, 29.174189 },
-    { 78820, 88635, 29.129131 },
-    { 78820, 89642, 33.427404 },
-    { 78820, 89931, 32.212129 },
-    { 78820, 89962, 37.211669 },
-    { 78820, 90185, 33.918712 },
-    { 78820, 90496, 33.270162 },
-    { 78820, 91262, 68.488249 },
-    { 78820, 92041, 37.298377 },
-    { 78820, 92855, 39.428790 },
-    { 78820, 93194, 66.886880 },
-    { 78820, 93506, 41.174286 },
-    { 78820, 93747, 55.612368 },
-    { 78820, 93864, 42.041244 },
-    { 78820, 94141, 43.053548 },
-    { 78820, 95501, 54.177287 },
-    { 78820, 95947, 68.869171 },
-    { 78820, 97165, 81.854715 },
-    { 78820, 97278, 62.270948 },
-    { 78820, 97649, 62.413915 },
-    { 78820, 99473, 62.984920 },
-    { 78820, 100345, 60.872281 },
-    { 78820, 100751, 59.935292 },
-    { 78820, 101772, 60.810793 },
-    { 78820, 106278, 80.164930 },
-    { 78820, 107556, 80.410089 },
-    { 78820, 108085, 75.926434 },
-    { 78820, 109268, 76.124382 },
-    { 78820, 110130, 74.478332 },
-    { 78820, 112122, 81.758872 },
-    { 79593, 79882, 1.406873 },
-    { 79593, 80112, 21.960314 },
-    { 79593, 80331, 65.234648 },
-    { 79593, 80763, 23.022242 },
-    { 79593, 80816, 25.481796 },
-    { 79593, 81266, 25.052197 },
-    { 79593, 81377, 8.900844 },
-    { 79593, 81693, 35.873595 },
-    { 79593, 82273, 65.585407 },
-    { 79593, 82396, 31.711873 },
-    { 79593, 82514, 35.406414 },
-    { 79593, 83000, 16.950371 },
-    { 79593, 83081, 53.044252 },
-    { 79593, 83895, 70.112420 },
-    { 79593, 84012, 18.292027 },
-    { 79593, 84143, 41.571622 },
-    { 79593, 84345, 23.460518 },
-    { 79593, 84379, 32.115908 },
-    { 79593, 84380, 42.902801 },
-    { 79593, 84970, 26.807827 },
-    { 79593, 85258, 53.767427 },
-    { 79593, 85267, 54.558276 },
-    { 79593, 85670, 58.268559 },
-    { 79593, 85696, 37.890982 },
-    { 79593, 85792, 49.008053 },
-    { 79593, 85927, 38.035611 },
-    { 79593, 86032, 25.785461 },
-    { 79593, 86228, 43.407368 },
-    { 79593, 86670, 40.610885 },
-    { 79593, 86742, 23.745003 },
-    { 79593, 87073, 42.074582 },
-    { 79593, 87261, 39.900474 },
-    { 79593, 87833, 59.327950 },
-    { 79593, 88048, 26.675659 },
-    { 79593, 88635, 37.499510 },
-    { 79593, 89642, 43.520764 },
-    { 79593, 89931, 39.743672 },
-    { 79593, 89962, 31.698194 },
-    { 79593, 90185, 43.004686 },
-    { 79593, 90496, 38.734786 },
-    { 79593, 91262, 53.716375 },
-    { 79593, 92041, 42.978698 },
-    { 79593, 92855, 44.637009 },
-    { 79593, 93194, 53.300684 },
-    { 79593, 93506, 47.588995 },
-    { 79593, 93747, 45.906786 },
-    { 79593, 93864, 47.567453 },
-    { 79593, 94141, 45.987470 },
-    { 79593, 94376, 77.836765 },
-    { 79593, 95501, 48.241211 },
-    { 79593, 95947, 56.839834 },
-    { 79593, 97165, 67.580111 },
-    { 79593, 97278, 54.639404 },
-    { 79593, 97649, 55.380937 },
-    { 79593, 99473, 59.252335 },
-    { 79593, 100345, 61.680649 },
-    { 79593, 100453, 71.563836 },
-    { 79593, 100751, 72.310489 },
-    { 79593, 101772, 71.049765 },
-    { 79593, 102098, 76.634680 },
-    { 79593, 102488, 74.068062 },
-    { 79593, 104732, 78.705685 },
-    { 79593, 106278, 79.011798 },
-    { 79593, 107315, 83.225720 },
-    { 79593, 107556, 82.423346 },
-    { 79593, 108085, 83.703743 },
-    { 79882, 80112, 20.911446 },
-    { 79882, 80331, 66.215795 },
-    { 79882, 80763, 21.900288 },
-    { 79882, 80816, 26.344099 },
-    { 79882, 81266, 23.890614 },
-    { 79882, 81377, 7.501912 },
-    { 79882, 81693, 36.704849 },
-    { 79882, 82273, 64.533320 },
-    { 79882, 82396, 30.508211 },
-    { 79882, 82514, 34.219633 },
-    { 79882, 83000, 17.147233 },
-    { 79882, 83081, 51.925818 },
-    { 79882, 83895, 71.008085 },
-    { 79882, 84012, 16.887506 },
-    { 79882, 84143, 40.343948 },
-    { 79882, 84345, 23.646620 },
-    { 79882, 84379, 32.591793 },
-    { 79882, 84380, 43.563038 },
-    { 79882, 84970, 25.419003 },
-    { 79882, 85258, 52.583300 },
-    { 79882, 85267, 53.379108 },
-    { 79882, 85670, 59.015512 },
-    { 79882, 85696, 36.568736 },
-    { 79882, 85792, 47.772698 },
-    { 79882, 85927, 36.705502 },
-    { 79882, 86032, 25.689803 },
-    { 79882, 86228, 42.111302 },
-    { 79882, 86670, 39.275999 },
-    { 79882, 86742, 23.193340 },
-    { 79882, 87073, 40.737706 },
-    { 79882, 87261, 38.539757 },
-    { 79882, 87833, 59.975796 },
-    { 79882, 88048, 25.476054 },
-    { 79882, 88635, 36.095028 },
-    { 79882, 89642, 42.128498 },
-    { 79882, 89931, 38.336899 },
-    { 79882, 89962, 30.730804 },
-    { 79882, 90185, 41.601792 },
-    { 79882, 90496, 37.341631 },
-    { 79882, 91262, 53.995800 },
-    { 79882, 92041, 41.587850 },
-    { 79882, 92855, 43.255464 },
-    { 79882, 93194, 53.352061 },
-    { 79882, 93506, 46.193299 },
-    { 79882, 93747, 45.409007 },
-    { 79882, 93864, 46.184238 },
-    { 79882, 94141, 44.661637 },
-    { 79882, 94376, 78.530732 },
-    { 79882, 95501, 47.399824 },
-    { 79882, 95947, 56.664161 },
-    { 79882, 97165, 67.780473 },
-    { 79882, 97278, 53.967849 },
-    { 79882, 97649, 54.658588 },
-    { 79882, 99473, 58.289391 },
-    { 79882, 100345, 60.470206 },
-    { 79882, 100453, 71.569924 },
-    { 79882, 100751, 70.945351 },
-    { 79882, 101772, 69.646162 },
-    { 79882, 102098, 76.727188 },
-    { 79882, 102488, 73.881413 },
-    { 79882, 104732, 78.394455 },
-    { 79882, 106278, 77.940106 },
-    { 79882, 107315, 82.433718 },
-    { 79882, 107556, 81.198972 },
-    { 79882, 108085, 82.310763 },
-    { 80112, 80763, 2.028320 },
-    { 80112, 80816, 47.133363 },
-    { 80112, 81266, 4.196253 },
-    { 80112, 81377, 15.493997 },
-    { 80112, 81693, 57.395716 },
-    { 80112, 82273, 43.627626 },
-    { 80112, 82396, 10.721082 },
-    { 80112, 82514, 14.043411 },
-    { 80112, 83000, 36.077250 },
-    { 80112, 83081, 31.149110 },
-    { 80112, 84012, 15.140603 },
-    { 80112, 84143, 20.483874 },
-    { 80112, 84345, 42.048623 },
-    { 80112, 84379, 52.084002 },
-    { 80112, 84380, 63.677770 },
-    { 80112, 84970, 13.752540 },
-    { 80112, 85258, 32.142037 },
-    { 80112, 85267, 32.899426 },
-    { 80112, 85670, 79.354175 },
-    { 80112, 85696, 18.843506 },
-    { 80112, 85792, 27.856238 },
-    { 80112, 85927, 19.217990 },
-    { 80112, 86032, 42.167951 },
-    { 80112, 86228, 23.342206 },
-    { 80112, 86670, 21.719780 },
-    { 80112, 86742, 36.166612 },
-    { 80112, 87073, 23.135786 },
-    { 80112, 87261, 22.045152 },
-    { 80112, 87833, 79.887032 },
-    { 80112, 88048, 28.071634 },
-    { 80112, 88635, 23.535237 },
-    { 80112, 89642, 27.152340 },
-    { 80112, 89931, 26.775422 },
-    { 80112, 89962, 36.712714 },
-    { 80112, 90185, 27.916078 },
-    { 80112, 90496, 28.537510 },
-    { 80112, 91262, 71.777618 },
-    { 80112, 92041, 32.300844 },
-    { 80112, 92855, 34.514437 },
-    { 80112, 93194, 69.334911 },
-    { 80112, 93506, 35.794956 },
-    { 80112, 93747, 56.167111 },
-    { 80112, 93864, 36.927654 },
-    { 80112, 94141, 38.815156 },
-    { 80112, 95501, 53.041315 },
-    { 80112, 95947, 70.314753 },
-    { 80112, 97278, 61.635350 },
-    { 80112, 97649, 61.500550 },
-    { 80112, 99473, 60.636875 },
-    { 80112, 100345, 56.851141 },
-    { 80112, 100751, 53.118859 },
-    { 80112, 101772, 54.220082 },
-    { 80112, 106278, 76.419947 },
-    { 80112, 107556, 75.604758 },
-    { 80112, 108085, 69.682550 },
-    { 80112, 109268, 69.481856 },
-    { 80112, 110130, 67.646762 },
-    { 80112, 112122, 75.069333 },
-    { 80331, 80816, 40.039028 },
-    { 80331, 81377, 72.127803 },
-    { 80331, 81693, 30.044824 },
-    { 80331, 83000, 52.506191 },
-    { 80331, 83895, 6.496512 },
-    { 80331, 84012, 77.789160 },
-    { 80331, 84345, 47.996387 },
-    { 80331, 84379, 37.687911 },
-    { 80331, 84380, 25.968352 },
-    { 80331, 85670, 12.856508 },
-    { 80331, 86032, 50.613653 },
-    { 80331, 86742, 58.861580 },
-    { 80331, 87833, 16.093367 },
-    { 80331, 88048, 73.680897 },
-    { 80331, 89962, 68.232193 },
-    { 80331, 91262, 30.513345 },
-    { 80331, 93194, 38.019721 },
-    { 80331, 93747, 55.703800 },
-    { 80331, 94376, 18.667696 },
-    { 80331, 95501, 67.524451 },
-    { 80331, 95947, 45.484718 },
-    { 80331, 97165, 33.060552 },
-    { 80331, 97278, 62.636021 },
-    { 80331, 97649, 64.686287 },
-    { 80331, 99473, 75.621162 },
-    { 80331, 100453, 41.202171 },
-    { 80331, 102098, 39.668474 },
-    { 80331, 102488, 49.095741 },
-    { 80331, 104732, 55.374584 },
-    { 80331, 105199, 32.641684 },
-    { 80331, 106032, 29.913220 },
-    { 80331, 107315, 76.588780 },
-    { 80331, 109492, 40.411486 },
-    { 80331, 112158, 65.904520 },
-    { 80331, 113881, 70.057424 },
-    { 80331, 113963, 81.426023 },
-    { 80331, 116727, 34.355936 },
-    { 80763, 80816, 47.922000 },
-    { 80763, 81266, 2.291405 },
-    { 80763, 81377, 15.969961 },
-    { 80763, 81693, 58.103034 },
-    { 80763, 82273, 42.691319 },
-    { 80763, 82396, 9.043360 },
-    { 80763, 82514, 12.542077 },
-    { 80763, 83000, 36.458980 },
-    { 80763, 83081, 30.026677 },
-    { 80763, 84012, 14.337288 },
-    { 80763, 84143, 18.919889 },
-    { 80763, 84345, 42.277275 },
-    { 80763, 84379, 52.440771 },
-    { 80763, 84380, 64.146720 },
-    { 80763, 84970, 11.928914 },
-    { 80763, 85258, 30.818627 },
-    { 80763, 85267, 31.594503 },
-    { 80763, 85670, 79.858579 },
-    { 80763, 85696, 16.921990 },
-    { 80763, 85792, 26.341158 },
-    { 80763, 85927, 17.279846 },
-    { 80763, 86032, 42.119533 },
-    { 80763, 86228, 21.573004 },
-    { 80763, 86670, 19.803796 },
-    { 80763, 86742, 35.809228 },
-    { 80763, 87073, 21.232208 },
-    { 80763, 87261, 20.063414 },
-    { 80763, 87833, 80.247715 },
-    { 80763, 88048, 26.948205 },
-    { 80763, 88635, 21.523582 },
-    { 80763, 89642, 25.137855 },
-    { 80763, 89931, 24.773505 },
-    { 80763, 89962, 35.678285 },
-    { 80763, 90185, 25.887971 },
-    { 80763, 90496, 26.618194 },
-    { 80763, 91262, 71.705151 },
-    { 80763, 92041, 30.338869 },
-    { 80763, 92855, 32.559677 },
-    { 80763, 93194, 68.997314 },
-    { 80763, 93506, 33.790706 },
-    { 80763, 93747, 55.321755 },
-    { 80763, 93864, 34.947356 },
-    { 80763, 94141, 36.950087 },
-    { 80763, 95501, 51.773851 },
-    { 80763, 95947, 69.673776 },
-    { 80763, 97278, 60.464024 },
-    { 80763, 97649, 60.262017 },
-    { 80763, 99473, 59.078796 },
-    { 80763, 100345, 54.994223 },
-    { 80763, 100751, 51.337744 },
-    { 80763, 101772, 52.275869 },
-    { 80763, 106278, 74.585891 },
-    { 80763, 107556, 73.634195 },
-    { 80763, 108085, 67.673305 },
-    { 80763, 109268, 67.558967 },
-    { 80763, 110130, 65.943945 },
-    { 80763, 112122, 73.168748 },
-    { 80763, 113368, 82.857107 },
-    { 80816, 81266, 49.724400 },
-    { 80816, 81377, 32.102012 },
-    { 80816, 81693, 10.409556 },
-    { 80816, 82396, 55.983692 },
-    { 80816, 82514, 59.753895 },
-    { 80816, 83000, 13.795604 },
-    { 80816, 83081, 77.713820 },
-    { 80816, 83895, 44.667287 },
-    { 80816, 84012, 38.495213 },
-    { 80816, 84143, 65.442921 },
-    { 80816, 84345, 12.721417 },
-    { 80816, 84379, 10.826082 },
-    { 80816, 84380, 18.146595 },
-    { 80816, 84970, 48.160003 },
-    { 80816, 85258, 77.907852 },
-    { 80816, 85267, 78.736702 },
-    { 80816, 85670, 32.930494 },
-    { 80816, 85696, 60.490560 },
-    { 80816, 85792, 72.663491 },
-    { 80816, 85927, 60.468360 },
-    { 80816, 86032, 17.839914 },
-    { 80816, 86228, 66.312342 },
-    { 80816, 86670, 62.839253 },
-    { 80816, 86742, 24.532926 },
-    { 80816, 87073, 64.200888 },
-    { 80816, 87261, 61.469975 },
-    { 80816, 87833, 34.375086 },
-    { 80816, 88048, 38.111558 },
-    { 80816, 88635, 56.765198 },
-    { 80816, 89642, 63.523939 },
-    { 80816, 89931, 57.823143 },
-    { 80816, 89962, 36.513130 },
-    { 80816, 90185, 62.093068 },
-    { 80816, 90496, 54.926010 },
-    { 80816, 91262, 32.142862 },
-    { 80816, 92041, 58.515618 },
-    { 80816, 92855, 59.313447 },
-    { 80816, 93194, 34.736932 },
-    { 80816, 93506, 63.101470 },
-    { 80816, 93747, 37.642090 },
-    { 80816, 93864, 62.051578 },
-    { 80816, 94141, 57.653821 },
-    { 80816, 94376, 52.595888 },
-    { 80816, 95501, 46.347086 },
-    { 80816, 95947, 41.267457 },
-    { 80816, 97165, 46.133112 },
-    { 80816, 97278, 48.136052 },
-    { 80816, 97649, 49.781005 },
-    { 80816, 99473, 58.346031 },
-    { 80816, 100345, 67.211998 },
-    { 80816, 100453, 52.192643 },
-    { 80816, 102098, 55.975562 },
-    { 80816, 102488, 57.110917 },
-    { 80816, 104732, 63.228902 },
-    { 80816, 105199, 62.809530 },
-    { 80816, 106032, 64.682413 },
-    { 80816, 106278, 78.527361 },
-    { 80816, 107315, 75.775337 },
-    { 80816, 109492, 69.345545 },
-    { 80816, 112158, 81.976736 },
-    { 80816, 116727, 72.625057 },
-    { 81266, 81377, 17.651347 },
-    { 81266, 81693, 59.831699 },
-    { 81266, 82273, 40.854643 },
-    { 81266, 82396, 6.799343 },
-    { 81266, 82514, 10.382442 },
-    { 81266, 83000, 37.958241 },
-    { 81266, 83081, 28.070648 },
-    { 81266, 84012, 14.818407 },
-    { 81266, 84143, 16.704135 },
-    { 81266, 84345, 43.627305 },
-    { 81266, 84379, 53.885425 },
-    { 81266, 84380, 65.672949 },
-    { 81266, 84970, 10.794934 },
-    { 81266, 85258, 28.722515 },
-    { 81266, 85267, 29.509129 },
-    { 81266, 85670, 81.398710 },
-    { 81266, 85696, 14.654974 },
-    { 81266, 85792, 24.140314 },
-    { 81266, 85927, 15.023937 },
-    { 81266, 86032, 43.208184 },
-    { 81266, 86228, 19.285083 },
-    { 81266, 86670, 17.534159 },
-    { 81266, 86742, 36.601157 },
-    { 81266, 87073, 18.956883 },
-    { 81266, 87261, 17.855309 },
-    { 81266, 87833, 81.660776 },
-    { 81266, 88048, 26.859125 },
-    { 81266, 88635, 19.692914 },
-    { 81266, 89642, 23.005687 },
-    { 81266, 89931, 22.985145 },
-    { 81266, 89962, 35.664096 },
-    { 81266, 90185, 23.860630 },
-    { 81266, 90496, 25.107974 },
-    { 81266, 91262, 72.714330 },
-    { 81266, 92041, 28.691143 },
-    { 81266, 92855, 30.930587 },
-    { 81266, 93194, 69.732805 },
-    { 81266, 93506, 31.976211 },
-    { 81266, 93747, 55.493536 },
-    { 81266, 93864, 33.228925 },
-    { 81266, 94141, 35.551973 },
-    { 81266, 95501, 51.389544 },
-    { 81266, 95947, 70.065989 },
-    { 81266, 97278, 60.198480 },
-    { 81266, 97649, 59.902639 },
-    { 81266, 99473, 58.233296 },
-    { 81266, 100345, 53.588460 },
-    { 81266, 100751, 49.047102 },
-    { 81266, 101772, 50.025843 },
-    { 81266, 106278, 73.212196 },
-    { 81266, 107315, 83.507052 },
-    { 81266, 107556, 71.918418 },
-    { 81266, 108085, 65.516762 },
-    { 81266, 109074, 83.221558 },
-    { 81266, 109268, 65.295162 },
-    { 81266, 110130, 63.663842 },
-    { 81266, 112122, 70.894466 },
-    { 81266, 113368, 80.731826 },
-    { 81377, 81693, 42.180654 },
-    { 81377, 82273, 58.490279 },
-    { 81377, 82396, 23.911122 },
-    { 81377, 82514, 27.677501 },
-    { 81377, 83000, 20.584459 },
-    { 81377, 83081, 45.616365 },
-    { 81377, 83895, 76.508388 },
-    { 81377, 84012, 9.588971 },
-    { 81377, 84143, 33.545341 },
-    { 81377, 84345, 26.631101 },
-    { 81377, 84379, 36.591455 },
-    { 81377, 84380, 48.206395 },
-    { 81377, 84970, 17.929438 },
-    { 81377, 85258, 45.945861 },
-    { 81377, 85267, 46.762673 },
-    { 81377, 85670, 63.904658 },
-    { 81377, 85696, 29.325309 },
-    { 81377, 85792, 40.905123 },
-    { 81377, 85927, 29.426503 },
-    { 81377, 86032, 27.214005 },
-    { 81377, 86228, 34.973979 },
-    { 81377, 86670, 31.971490 },
-    { 81377, 86742, 22.394609 },
-    { 81377, 87073, 33.422553 },
-    { 81377, 87261, 31.132533 },
-    { 81377, 87833, 64.393037 },
-    { 81377, 88048, 20.157437 },
-    { 81377, 88635, 28.607799 },
-    { 81377, 89642, 34.630666 },
-    { 81377, 89931, 30.908787 },
-    { 81377, 89962, 26.950726 },
-    { 81377, 90185, 34.106792 },
-    { 81377, 90496, 30.139520 },
-    { 81377, 91262, 56.691904 },
-    { 81377, 92041, 34.402985 },
-    { 81377, 92855, 36.164940 },
-    { 81377, 93194, 54.903699 },
-    { 81377, 93506, 38.945129 },
-    { 81377, 93747, 44.139392 },
-    { 81377, 93864, 39.070315 },
-    { 81377, 94141, 38.058897 },
-    { 81377, 94376, 83.029135 },
-    { 81377, 95501, 44.066607 },
-    { 81377, 95947, 56.975394 },
-    { 81377, 97165, 69.914432 },
-    { 81377, 97278, 51.553373 },
-    { 81377, 97649, 51.936391 },
-    { 81377, 99473, 54.069599 },
-    { 81377, 100345, 54.632799 },
-    { 81377, 100453, 72.656475 },
-    { 81377, 100751, 63.509536 },
-    { 81377, 101772, 62.153108 },
-    { 81377, 102098, 78.210496 },
-    { 81377, 102488, 73.919869 },
-    { 81377, 104732, 77.711235 },
-    { 81377, 106278, 72.899639 },
-    { 81377, 107315, 79.023065 },
-    { 81377, 107556, 75.177814 },
-    { 81377, 108085, 75.060253 },
-    { 81377, 109074, 82.231001 },
-    { 81377, 109268, 77.379338 },
-    { 81377, 110130, 78.528261 },
-    { 81377, 112122, 83.239065 },
-    { 81693, 82396, 65.927639 },
-    { 81693, 82514, 69.692870 },
-    { 81693, 83000, 22.549553 },
-    { 81693, 83895, 34.369147 },
-    { 81693, 84012, 47.838770 },
-    { 81693, 84143, 75.173557 },
-    { 81693, 84345, 18.827277 },
-    { 81693, 84379, 10.041370 },
-    { 81693, 84380, 8.701657 },
-    { 81693, 84970, 57.431356 },
-    { 81693, 85670, 22.553736 },
-    { 81693, 85696, 69.860292 },
-    { 81693, 85792, 82.247523 },
-    { 81693, 85927, 69.785392 },
-    { 81693, 86032, 22.688421 },
-    { 81693, 86228, 75.697608 },
-    { 81693, 86670, 72.049794 },
-    { 81693, 86742, 30.720312 },
-    { 81693, 87073, 73.353931 },
-    { 81693, 87261, 70.491701 },
-    { 81693, 87833, 24.218793 },
-    { 81693, 88048, 45.365952 },
-    { 81693, 88635, 65.184273 },
-    { 81693, 89642, 71.981638 },
-    { 81693, 89931, 65.832154 },
-    { 81693, 89962, 41.892267 },
-    { 81693, 90185, 70.286517 },
-    { 81693, 90496, 62.454167 },
-    { 81693, 91262, 24.576033 },
-    { 81693, 92041, 65.663517 },
-    { 81693, 92855, 66.132102 },
-    { 81693, 93194, 29.029818 },
-    { 81693, 93506, 70.036040 },
-    { 81693, 93747, 37.412422 },
-    { 81693, 93864, 68.672334 },
-    { 81693, 94141, 63.516003 },
-    { 81693, 94376, 42.232529 },
-    { 81693, 95501, 47.947071 },
-    { 81693, 95947, 36.717122 },
-    { 81693, 97165, 37.872541 },
-    { 81693, 97278, 47.507870 },
-    { 81693, 97649, 49.406124 },
-    { 81693, 99473, 59.277320 },
-    { 81693, 100345, 70.154422 },
-    { 81693, 100453, 44.825056 },
-    { 81693, 102098, 47.803777 },
-    { 81693, 102488, 50.745338 },
-    { 81693, 104732, 57.279860 },
-    { 81693, 105199, 52.868608 },
-    { 81693, 106032, 54.374998 },
-    { 81693, 106278, 78.282370 },
-    { 81693, 107315, 72.735226 },
-    { 81693, 109074, 82.616979 },
-    { 81693, 109492, 59.682609 },
-    { 81693, 112158, 75.032919 },
-    { 81693, 113881, 80.032848 },
-    { 81693, 116727, 62.216540 },
-    { 82273, 82396, 34.735667 },
-    { 82273, 82514, 30.983378 },
-    { 82273, 83000, 78.418639 },
-    { 82273, 83081, 13.085464 },
-    { 82273, 84012, 53.412817 },
-    { 82273, 84143, 25.968750 },
-    { 82273, 84345, 83.546241 },
-    { 82273, 84970, 44.309984 },
-    { 82273, 85258, 14.117824 },
-    { 82273, 85267, 13.298096 },
-    { 82273, 85696, 32.249974 },
-    { 82273, 85792, 19.852132 },
-    { 82273, 85927, 32.511895 },
-    { 82273, 86032, 81.998949 },
-    { 82273, 86228, 26.786884 },
-    { 82273, 86670, 30.861134 },
-    { 82273, 86742, 74.200087 },
-    { 82273, 87073, 29.949622 },
-    { 82273, 87261, 33.063068 },
-    { 82273, 88048, 60.347679 },
-    { 82273, 88635, 40.167954 },
-    { 82273, 89642, 34.488306 },
-    { 82273, 89931, 41.401740 },
-    { 82273, 89962, 67.923743 },
-    { 82273, 90185, 37.114874 },
-    { 82273, 90496, 46.034930 },
-    { 82273, 92041, 45.407904 },
-    { 82273, 92855, 46.620925 },
-    { 82273, 93506, 43.613413 },
-    { 82273, 93864, 46.002131 },
-    { 82273, 94141, 52.574094 },
-    { 82273, 95501, 76.927014 },
-    { 82273, 99473, 76.098387 },
-    { 82273, 100345, 63.507279 },
-    { 82273, 100751, 26.432035 },
-    { 82273, 101772, 35.159435 },
-    { 82273, 106278, 77.980161 },
-    { 82273, 107556, 69.469581 },
-    { 82273, 108085, 50.655596 },
-    { 82273, 109268, 43.502931 },
-    { 82273, 110130, 33.481965 },
-    { 82273, 112122, 46.526281 },
-    { 82273, 113136, 75.784214 },
-    { 82273, 113368, 63.298820 },
-    { 82396, 82514, 3.770343 },
-    { 82396, 83000, 43.703874 },
-    { 82396, 83081, 21.746063 },
-    { 82396, 84012, 19.115507 },
-    { 82396, 84143, 9.913349 },
-    { 82396, 84345, 49.029780 },
-    { 82396, 84379, 59.425916 },
-    { 82396, 84380, 71.337355 },
-    { 82396, 84970, 11.575490 },
-    { 82396, 85258, 22.088144 },
-    { 82396, 85267, 22.892802 },
-    { 82396, 85696, 8.756508 },
-    { 82396, 85792, 17.357140 },
-    { 82396, 85927, 9.249785 },
-    { 82396, 86032, 48.045679 },
-    { 82396, 86228, 12.646639 },
-    { 82396, 86670, 11.497186 },
-    { 82396, 86742, 40.842208 },
-    { 82396, 87073, 12.812482 },
-    { 82396, 87261, 12.416397 },
-    { 82396, 88048, 29.149515 },
-    { 82396, 88635, 16.408247 },
-    { 82396, 89642, 17.924798 },
-    { 82396, 89931, 19.708701 },
-    { 82396, 89962, 37.889447 },
-    { 82396, 90185, 19.361225 },
-    { 82396, 90496, 22.909425 },
-    { 82396, 91262, 77.145148 },
-    { 82396, 92041, 25.790939 },
-    { 82396, 92855, 28.035521 },
-    { 82396, 93194, 73.493900 },
-    { 82396, 93506, 28.271189 },
-    { 82396, 93747, 57.896126 },
-    { 82396, 93864, 29.904491 },
-    { 82396, 94141, 33.423543 },
-    { 82396, 95501, 52.264236 },
-    { 82396, 95947, 72.918966 },
-    { 82396, 97278, 61.305302 },
-    { 82396, 97649, 60.736471 },
-    { 82396, 99473, 57.592395 },
-    { 82396, 100345, 51.118117 },
-    { 82396, 100751, 42.413268 },
-    { 82396, 101772, 43.908864 },
-    { 82396, 106278, 70.655596 },
-    { 82396, 107315, 82.270762 },
-    { 82396, 107556, 68.138180 },
-    { 82396, 108085, 59.903247 },
-    { 82396, 109074, 80.668138 },
-    { 82396, 109268, 59.042370 },
-    { 82396, 110130, 56.930435 },
-    { 82396, 112122, 64.546912 },
-    { 82396, 113136, 82.063948 },
-    { 82396, 113368, 75.222945 },
-    { 82514, 83000, 47.441743 },
-    { 82514, 83081, 17.978222 },
-    { 82514, 84012, 22.691909 },
-    { 82514, 84143, 6.458680 },
-    { 82514, 84345, 52.709149 },
-    { 82514, 84379, 63.121383 },
-    { 82514, 84380, 75.047604 },
-    { 82514, 84970, 14.529353 },
-    { 82514, 85258, 18.363713 },
-    { 82514, 85267, 19.160595 },
-    { 82514, 85696, 7.729303 },
-    { 82514, 85792, 13.816412 },
-    { 82514, 85927, 8.319057 },
-    { 82514, 86032, 51.603855 },
-    { 82514, 86228, 9.942381 },
-    { 82514, 86670, 9.938584 },
-    { 82514, 86742, 44.265387 },
-    { 82514, 87073, 10.997181 },
-    { 82514, 87261, 11.526003 },
-    { 82514, 88048, 32.047069 },
-    { 82514, 88635, 17.034742 },
-    { 82514, 89642, 17.041552 },
-    { 82514, 89931, 20.162255 },
-    { 82514, 89962, 40.667484 },
-    { 82514, 90185, 18.922471 },
-    { 82514, 90496, 23.907717 },
-    { 82514, 91262, 80.534699 },
-    { 82514, 92041, 26.270479 },
-    { 82514, 92855, 28.458734 },
-    { 82514, 93194, 76.666797 },
-    { 82514, 93506, 28.147933 },
-    { 82514, 93747, 60.611663 },
-    { 82514, 93864, 30.004789 },
-    { 82514, 94141, 34.198460 },
-    { 82514, 95501, 54.358715 },
-    { 82514, 95947, 75.751701 },
-    { 82514, 97278, 63.445754 },
-    { 82514, 97649, 62.754386 },
-    { 82514, 99473, 58.904287 },
-    { 82514, 100345, 51.461544 },
-    { 82514, 100751, 39.412124 },
-    { 82514, 101772, 41.558706 },
-    { 82514, 106278, 70.797715 },
-    { 82514, 107315, 83.101269 },
-    { 82514, 107556, 67.520624 },
-    { 82514, 108085, 57.954406 },
-    { 82514, 109074, 80.750555 },
-    { 82514, 109268, 56.483500 },
-    { 82514, 110130, 53.714521 },
-    { 82514, 112122, 61.867859 },
-    { 82514, 113136, 80.860769 },
-    { 82514, 113368, 73.299198 },
-    { 83000, 83081, 65.365410 },
-    { 83000, 83895, 56.372424 },
-    { 83000, 84012, 25.296587 },
-    { 83000, 84143, 52.716917 },
-    { 83000, 84345, 6.510633 },
-    { 83000, 84379, 16.006999 },
-    { 83000, 84380, 27.714995 },
-    { 83000, 84970, 34.882477 },
-    { 83000, 85258, 65.161029 },
-    { 83000, 85267, 66.003363 },
-    { 83000, 85670, 43.441547 },
-    { 83000, 85696, 47.310811 },
-    { 83000, 85792, 59.720202 },
-    { 83000, 85927, 47.236917 },
-    { 83000, 86032, 9.682730 },
-    { 83000, 86228, 53.148070 },
-    { 83000, 86670, 49.514652 },
-    { 83000, 86742, 12.337501 },
-    { 83000, 87073, 50.831722 },
-    { 83000, 87261, 48.005578 },
-    { 83000, 87833, 43.812252 },
-    { 83000, 88048, 24.489644 },
-    { 83000, 88635, 43.031959 },
-    { 83000, 89642, 49.809909 },
-    { 83000, 89931, 44.031089 },
-    { 83000, 89962, 24.182202 },
-    { 83000, 90185, 48.322340 },
-    { 83000, 90496, 41.157173 },
-    { 83000, 91262, 36.858010 },
-    { 83000, 92041, 44.809856 },
-    { 83000, 92855, 45.695857 },
-    { 83000, 93194, 36.410830 },
-    { 83000, 93506, 49.433604 },
-    { 83000, 93747, 31.574998 },
-    { 83000, 93864, 48.485416 },
-    { 83000, 94141, 44.459610 },
-    { 83000, 94376, 62.446036 },
-    { 83000, 95501, 37.239941 },
-    { 83000, 95947, 40.479029 },
-    { 83000, 97165, 50.643623 },
-    { 83000, 97278, 41.495362 },
-    { 83000, 97649, 42.705329 },
-    { 83000, 99473, 49.265975 },
-    { 83000, 100345, 55.879166 },
-    { 83000, 100453, 54.711256 },
-    { 83000, 100751, 78.636789 },
-    { 83000, 101772, 74.669119 },
-    { 83000, 102098, 59.697699 },
-    { 83000, 102488, 57.651499 },
-    { 83000, 104732, 62.730841 },
-    { 83000, 105199, 70.429871 },
-    { 83000, 106032, 73.861513 },
-    { 83000, 106278, 69.846770 },
-    { 83000, 107315, 70.470347 },
-    { 83000, 107556, 75.979765 },
-    { 83000, 108085, 83.313100 },
-    { 83000, 109074, 77.257990 },
-    { 83000, 109492, 75.882417 },
-    { 83000, 112158, 82.153297 },
-    { 83000, 116727, 83.056201 },
-    { 83081, 84012, 40.327658 },
-    { 83081, 84143, 12.934609 },
-    { 83081, 84345, 70.460839 },
-    { 83081, 84379, 80.905134 },
-    { 83081, 84970, 31.282830 },
-    { 83081, 85258, 3.779476 },
-    { 83081, 85267, 3.743710 },
-    { 83081, 85696, 19.460244 },
-    { 83081, 85792, 7.890859 },
-    { 83081, 85927, 19.784167 },
-    { 83081, 86032, 68.971012 },
-    { 83081, 86228, 14.400135 },
-    { 83081, 86670, 18.454961 },
-    { 83081, 86742, 61.254858 },
-    { 83081, 87073, 17.787872 },
-    { 83081, 87261, 20.818569 },
-    { 83081, 88048, 47.708969 },
-    { 83081, 88635, 28.175277 },
-    { 83081, 89642, 23.386772 },
-    { 83081, 89931, 29.940455 },
-    { 83081, 89962, 55.629158 },
-    { 83081, 90185, 26.110090 },
-    { 83081, 90496, 34.602621 },
-    { 83081, 92041, 34.789834 },
-    { 83081, 92855, 36.377178 },
-    { 83081, 93506, 34.035711 },
-    { 83081, 93747, 74.727247 },
-    { 83081, 93864, 36.421581 },
-    { 83081, 94141, 42.581459 },
-    { 83081, 95501, 66.255948 },
-    { 83081, 97278, 75.139718 },
-    { 83081, 97649, 73.969737 },
-    { 83081, 99473, 67.364115 },
-    { 83081, 100345, 56.304034 },
-    { 83081, 100751, 27.990718 },
-    { 83081, 101772, 34.090967 },
-    { 83081, 106278, 73.327429 },
-    { 83081, 107556, 66.711669 },
-    { 83081, 108085, 51.178135 },
-    { 83081, 109074, 82.389529 },
-    { 83081, 109268, 46.439654 },
-    { 83081, 110130, 39.818580 },
-    { 83081, 112122, 50.824291 },
-    { 83081, 113136, 76.389847 },
-    { 83081, 113368, 65.682778 },
-    { 83895, 84012, 81.440337 },
-    { 83895, 84345, 51.333942 },
-    { 83895, 84379, 40.887179 },
-    { 83895, 84380, 28.920040 },
-    { 83895, 85670, 13.687388 },
-    { 83895, 86032, 53.340674 },
-    { 83895, 86742, 61.453836 },
-    { 83895, 87833, 15.467689 },
-    { 83895, 88048, 76.061305 },
-    { 83895, 89962, 69.861645 },
-    { 83895, 91262, 29.758630 },
-    { 83895, 93194, 36.945000 },
-    { 83895, 93747, 55.450526 },
-    { 83895, 94376, 12.264454 },
-    { 83895, 95501, 67.090467 },
-    { 83895, 95947, 43.683186 },
-    { 83895, 97165, 29.384490 },
-    { 83895, 97278, 61.288625 },
-    { 83895, 97649, 63.287072 },
-    { 83895, 99473, 74.067166 },
-    { 83895, 100453, 37.100449 },
-    { 83895, 102098, 34.795903 },
-    { 83895, 102488, 44.921068 },
-    { 83895, 104732, 50.879026 },
-    { 83895, 105199, 26.267479 },
-    { 83895, 106032, 23.441962 },
-    { 83895, 107315, 72.390875 },
-    { 83895, 109074, 83.883270 },
-    { 83895, 109492, 34.014562 },
-    { 83895, 112158, 60.086035 },
-    { 83895, 113881, 64.085824 },
-    { 83895, 113963, 75.756519 },
-    { 83895, 116727, 28.521108 },
-    { 84012, 84143, 27.515952 },
-    { 84012, 84345, 30.133875 },
-    { 84012, 84379, 40.580603 },
-    { 84012, 84380, 52.545850 },
-    { 84012, 84970, 9.665552 },
-    { 84012, 85258, 39.907883 },
-    { 84012, 85267, 40.753025 },
-    { 84012, 85670, 68.165592 },
-    { 84012, 85696, 22.037596 },
-    { 84012, 85792, 34.427319 },
-    { 84012, 85927, 21.989659 },
-    { 84012, 86032, 28.930433 },
-    { 84012, 86228, 27.874073 },
-    { 84012, 86670, 24.344099 },
-    { 84012, 86742, 21.882519 },
-    { 84012, 87073, 25.711150 },
-    { 84012, 87261, 23.044045 },
-    { 84012, 87833, 67.967225 },
-    { 84012, 88048, 13.265286 },
-    { 84012, 88635, 19.418573 },
-    { 84012, 89642, 25.790442 },
-    { 84012, 89931, 21.481928 },
-    { 84012, 89962, 21.665252 },
-    { 84012, 90185, 24.958550 },
-    { 84012, 90496, 20.550606 },
-    { 84012, 91262, 58.149567 },
-    { 84012, 92041, 24.814358 },
-    { 84012, 92855, 26.591653 },
-    { 84012, 93194, 54.933483 },
-    { 84012, 93506, 29.361581 },
-    { 84012, 93747, 41.033621 },
-    { 84012, 93864, 29.489634 },
-    { 84012, 94141, 28.770824 },
-    { 84012, 95501, 38.356300 },
-    { 84012, 95947, 55.343348 },
-    { 84012, 97165, 70.227953 },
-    { 84012, 97278, 46.713046 },
-    { 84012, 97649, 46.708235 },
-    { 84012, 99473, 47.023366 },
-    { 84012, 100345, 45.890446 },
-    { 84012, 100453, 71.533103 },
-    { 84012, 100751, 54.951444 },
-    { 84012, 101772, 52.920384 },
-    { 84012, 102098, 77.451690 },
-    { 84012, 102488, 71.441507 },
-    { 84012, 104732, 74.255885 },
-    { 84012, 106278, 64.740973 },
-    { 84012, 107315, 72.433274 },
-    { 84012, 107556, 66.160753 },
-    { 84012, 108085, 65.482336 },
-    { 84012, 109074, 74.381738 },
-    { 84012, 109268, 68.034077 },
-    { 84012, 110130, 69.971638 },
-    { 84012, 112122, 73.907004 },
-    { 84012, 113136, 82.103125 },
-    { 84012, 113368, 79.605993 },
-    { 84143, 84345, 57.631580 },
-    { 84143, 84379, 68.081300 },
-    { 84143, 84380, 80.050352 },
-    { 84143, 84970, 18.350444 },
-    { 84143, 85258, 12.472558 },
-    { 84143, 85267, 13.307789 },
-    { 84143, 85696, 6.919678 },
-    { 84143, 85792, 7.446681 },
-    { 84143, 85927, 7.374214 },
-    { 84143, 86032, 56.041863 },
-    { 84143, 86228, 4.597635 },
-    { 84143, 86670, 7.090039 },
-    { 84143, 86742, 48.326873 },
-    { 84143, 87073, 7.305528 },
-    { 84143, 87261, 9.491968 },
-    { 84143, 88048, 34.989421 },
-    { 84143, 88635, 16.673685 },
-    { 84143, 89642, 14.079246 },
-    { 84143, 89931, 19.189541 },
-    { 84143, 89962, 43.170449 },
-    { 84143, 90185, 16.535834 },
-    { 84143, 90496, 23.600415 },
-    { 84143, 92041, 24.935929 },
-    { 84143, 92855, 26.924257 },
-    { 84143, 93194, 79.759800 },
-    { 84143, 93506, 25.711900 },
-    { 84143, 93747, 62.708244 },
-    { 84143, 93864, 27.863779 },
-    { 84143, 94141, 33.051628 },
-    { 84143, 95501, 55.213212 },
-    { 84143, 95947, 77.981968 },
-    { 84143, 97278, 64.277901 },
-    { 84143, 97649, 63.348123 },
-    { 84143, 99473, 58.210149 },
-    { 84143, 100345, 49.213488 },
-    { 84143, 100751, 33.046532 },
-    { 84143, 101772, 35.711816 },
-    { 84143, 106278, 67.998292 },
-    { 84143, 107315, 81.298749 },
-    { 84143, 107556, 63.624503 },
-    { 84143, 108085, 52.442706 },
-    { 84143, 109074, 77.769025 },
-    { 84143, 109268, 50.389254 },
-    { 84143, 110130, 47.263080 },
-    { 84143, 112122, 55.670712 },
-    { 84143, 113136, 76.099525 },
-    { 84143, 113368, 67.749777 },
-    { 84345, 84379, 10.449725 },
-    { 84345, 84380, 22.419079 },
-    { 84345, 84970, 39.430614 },
-    { 84345, 85258, 69.956191 },
-    { 84345, 85267, 70.803712 },
-    { 84345, 85670, 38.041874 },
-    { 84345, 85696, 51.824927 },
-    { 84345, 85792, 64.377868 },
-    { 84345, 85927, 51.687210 },
-    { 84345, 86032, 5.259960 },
-    { 84345, 86228, 57.623341 },
-    { 84345, 86670, 53.814795 },
-    { 84345, 86742, 12.119591 },
-    { 84345, 87073, 55.052699 },
-    { 84345, 87261, 52.097857 },
-    { 84345, 87833, 38.045832 },
-    { 84345, 88048, 26.550618 },
-    { 84345, 88635, 46.474711 },
-    { 84345, 89642, 53.262812 },
-    { 84345, 89931, 47.021581 },
-    { 84345, 89962, 23.909791 },
-    { 84345, 90185, 51.499412 },
-    { 84345, 90496, 43.634013 },
-    { 84345, 91262, 30.391856 },
-    { 84345, 92041, 46.908302 },
-    { 84345, 92855, 47.473487 },
-    { 84345, 93194, 29.949750 },
-    { 84345, 93506, 51.349127 },
-    { 84345, 93747, 26.842319 },
-    { 84345, 93864, 50.095208 },
-    { 84345, 94141, 45.306768 },
-    { 84345, 94376, 56.607195 },
-    { 84345, 95501, 34.177831 },
-    { 84345, 95947, 34.344248 },
-    { 84345, 97165, 44.136297 },
-    { 84345, 97278, 37.155962 },
-    { 84345, 97649, 38.580461 },
-    { 84345, 99473, 46.274395 },
-    { 84345, 100345, 54.534789 },
-    { 84345, 100453, 48.261576 },
-    { 84345, 100751, 81.406119 },
-    { 84345, 101772, 76.512172 },
-    { 84345, 102098, 53.198366 },
-    { 84345, 102488, 51.424658 },
-    { 84345, 104732, 56.702991 },
-    { 84345, 105199, 64.090435 },
-    { 84345, 106032, 67.778879 },
-    { 84345, 106278, 66.731720 },
-    { 84345, 107315, 65.821321 },
-    { 84345, 107556, 73.854656 },
-    { 84345, 108085, 83.410819 },
-    { 84345, 109074, 73.423409 },
-    { 84345, 109492, 69.422948 },
-    { 84345, 112158, 76.096004 },
-    { 84345, 113881, 80.936500 },
-    { 84345, 113963, 83.944250 },
-    { 84345, 116727, 77.265188 },
-    { 84379, 84380, 11.969568 },
-    { 84379, 84970, 49.867646 },
-    { 84379, 85258, 80.399362 },
-    { 84379, 85267, 81.247047 },
-    { 84379, 85670, 27.616982 },
-    { 84379, 85696, 62.245459 },
-    { 84379, 85792, 74.808945 },
-    { 84379, 85927, 62.097508 },
-    { 84379, 86032, 13.147916 },
-    { 84379, 86228, 68.031272 },
-    { 84379, 86670, 64.191517 },
-    { 84379, 86742, 21.393410 },
-    { 84379, 87073, 65.407653 },
-    { 84379, 87261, 62.423809 },
-    { 84379, 87833, 27.810379 },
-    { 84379, 88048, 36.236776 },
-    { 84379, 88635, 56.586361 },
-    { 84379, 89642, 63.342180 },
-    { 84379, 89931, 56.911330 },
-    { 84379, 89962, 32.064179 },
-    { 84379, 90185, 61.454151 },
-    { 84379, 90496, 53.263618 },
-    { 84379, 91262, 22.204801 },
-    { 84379, 92041, 56.248472 },
-    { 84379, 92855, 56.571518 },
-    { 84379, 93194, 24.011745 },
-    { 84379, 93506, 60.497048 },
-    { 84379, 93747, 28.177868 },
-    { 84379, 93864, 59.022200 },
-    { 84379, 94141, 53.670428 },
-    { 84379, 94376, 46.440293 },
-    { 84379, 95501, 38.179893 },
-    { 84379, 95947, 30.448235 },
-    { 84379, 97165, 36.318115 },
-    { 84379, 97278, 38.547372 },
-    { 84379, 97649, 40.341444 },
-    { 84379, 99473, 49.762865 },
-    { 84379, 100345, 60.205946 },
-    { 84379, 100453, 41.793146 },
-    { 84379, 102098, 45.963161 },
-    { 84379, 102488, 46.384695 },
-    { 84379, 104732, 52.430444 },
-    { 84379, 105199, 54.816431 },
-    { 84379, 106032, 57.904516 },
-    { 84379, 106278, 69.311397 },
-    { 84379, 107315, 65.340384 },
-    { 84379, 107556, 77.885183 },
-    { 84379, 109074, 74.472698 },
-    { 84379, 109492, 60.712632 },
-    { 84379, 112158, 71.296126 },
-    { 84379, 113881, 76.286374 },
-    { 84379, 113963, 81.407032 },
-    { 84379, 116727, 67.061407 },
-    { 84380, 84970, 61.830405 },
-    { 84380, 85670, 15.727023 },
-    { 84380, 85696, 74.194058 },
-    { 84380, 85927, 74.037672 },
-    { 84380, 86032, 24.655519 },
-    { 84380, 86228, 79.967764 },
-    { 84380, 86670, 76.102040 },
-    { 84380, 86742, 32.894781 },
-    { 84380, 87073, 77.298137 },
-    { 84380, 87261, 74.290894 },
-    { 84380, 87833, 16.426499 },
-    { 84380, 88048, 47.714397 },
-    { 84380, 88635, 68.276818 },
-    { 84380, 89642, 74.985018 },
-    { 84380, 89931, 68.407931 },
-    { 84380, 89962, 42.596752 },
-    { 84380, 90185, 72.989518 },
-    { 84380, 90496, 64.556595 },
-    { 84380, 91262, 16.262503 },
-    { 84380, 92041, 67.264767 },
-    { 84380, 92855, 67.368280 },
-    { 84380, 93194, 21.665478 },
-    { 84380, 93506, 71.297685 },
-    { 84380, 93747, 33.645671 },
-    { 84380, 93864, 69.635042 },
-    { 84380, 94141, 63.850749 },
-    { 84380, 94376, 34.978738 },
-    { 84380, 95501, 45.092528 },
-    { 84380, 95947, 29.801055 },
-    { 84380, 97165, 29.207403 },
-    { 84380, 97278, 42.934762 },
-    { 84380, 97649, 44.950532 },
-    { 84380, 99473, 55.482614 },
-    { 84380, 100345, 67.659502 },
-    { 84380, 100453, 36.343116 },
-    { 84380, 102098, 39.132295 },
-    { 84380, 102488, 42.581065 },
-    { 84380, 104732, 49.230060 },
-    { 84380, 105199, 44.663683 },
-    { 84380, 106032, 46.819956 },
-    { 84380, 106278, 73.168812 },
-    { 84380, 107315, 65.961956 },
-    { 84380, 107556, 83.008005 },
-    { 84380, 109074, 76.411113 },
-    { 84380, 109492, 51.255365 },
-    { 84380, 112158, 66.547030 },
-    { 84380, 113881, 71.531456 },
-    { 84380, 113963, 78.941369 },
-    { 84380, 116727, 55.452021 },
-    { 84970, 85258, 30.536297 },
-    { 84970, 85267, 31.384222 },
-    { 84970, 85670, 77.322828 },
-    { 84970, 85696, 12.436951 },
-    { 84970, 85792, 24.949591 },
-    { 84970, 85927, 12.354601 },
-    { 84970, 86032, 37.692027 },
-    { 84970, 86228, 18.270464 },
-    { 84970, 86670, 14.679511 },
-    { 84970, 86742, 30.022898 },
-    { 84970, 87073, 16.046592 },
-    { 84970, 87261, 13.430011 },
-    { 84970, 87833, 76.866315 },
-    { 84970, 88048, 17.584601 },
-    { 84970, 88635, 11.099600 },
-    { 84970, 89642, 16.719056 },
-    { 84970, 89931, 13.938446 },
-    { 84970, 89962, 26.314207 },
-    { 84970, 90185, 16.408781 },
-    { 84970, 90496, 14.916153 },
-    { 84970, 91262, 66.149012 },
-    { 84970, 92041, 18.879374 },
-    { 84970, 92855, 21.028523 },
-    { 84970, 93194, 62.140838 },
-    { 84970, 93506, 22.798663 },
-    { 84970, 93747, 46.322329 },
-    { 84970, 93864, 23.616920 },
-    { 84970, 94141, 25.068980 },
-    { 84970, 95501, 41.079846 },
-    { 84970, 95947, 61.352343 },
-    { 84970, 97165, 77.322468 },
-    { 84970, 97278, 50.038624 },
-    { 84970, 97649, 49.593500 },
-    { 84970, 99473, 47.462372 },
-    { 84970, 100345, 43.099604 },
-    { 84970, 100453, 77.554359 },
-    { 84970, 100751, 45.632469 },
-    { 84970, 101772, 44.378896 },
-    { 84970, 102098, 83.635268 },
-    { 84970, 102488, 76.326847 },
-    { 84970, 104732, 78.151506 },
-    { 84970, 106278, 62.670113 },
-    { 84970, 107315, 72.712193 },
-    { 84970, 107556, 62.099566 },
-    { 84970, 108085, 58.227019 },
-    { 84970, 109074, 72.646551 },
-    { 84970, 109268, 59.696280 },
-    { 84970, 110130, 60.663392 },
-    { 84970, 112122, 65.523864 },
-    { 84970, 113136, 77.346020 },
-    { 84970, 113368, 72.993591 },
-    { 85258, 85267, 0.847967 },
-    { 85258, 85696, 18.257499 },
-    { 85258, 85792, 5.739611 },
-    { 85258, 85927, 18.479767 },
-    { 85258, 86032, 68.120531 },
-    { 85258, 86228, 12.681393 },
-    { 85258, 86670, 16.747418 },
-    { 85258, 86742, 60.213842 },
-    { 85258, 87073, 15.837823 },
-    { 85258, 87261, 18.949052 },
-    { 85258, 88048, 46.236686 },
-    { 85258, 88635, 26.114103 },
-    { 85258, 89642, 20.762485 },
-    { 85258, 89931, 27.546340 },
-    { 85258, 89962, 53.834285 },
-    { 85258, 90185, 23.459585 },
-    { 85258, 90496, 32.211857 },
-    { 85258, 92041, 32.025904 },
-    { 85258, 92855, 33.483535 },
-    { 85258, 93506, 30.920582 },
-    { 85258, 93747, 72.521216 },
-    { 85258, 93864, 33.321584 },
-    { 85258, 94141, 39.634721 },
-    { 85258, 95501, 63.615574 },
-    { 85258, 97278, 72.391629 },
-    { 85258, 97649, 71.143422 },
-    { 85258, 99473, 64.172659 },
-    { 85258, 100345, 52.809151 },
-    { 85258, 100751, 24.698644 },
-    { 85258, 101772, 30.420362 },
-    { 85258, 106278, 69.618915 },
-    { 85258, 107556, 62.933284 },
-    { 85258, 108085, 47.548977 },
-    { 85258, 109074, 78.635416 },
-    { 85258, 109268, 43.112028 },
-    { 85258, 110130, 37.202219 },
-    { 85258, 112122, 47.673406 },
-    { 85258, 113136, 72.700497 },
-    { 85258, 113368, 62.179048 },
-    { 85267, 85696, 19.103125 },
-    { 85267, 85792, 6.572771 },
-    { 85267, 85927, 19.323112 },
-    { 85267, 86032, 68.967000 },
-    { 85267, 86228, 13.514892 },
-    { 85267, 86670, 17.576105 },
-    { 85267, 86742, 61.057044 },
-    { 85267, 87073, 16.651901 },
-    { 85267, 87261, 19.765015 },
-    { 85267, 88048, 47.065066 },
-    { 85267, 88635, 26.907177 },
-    { 85267, 89642, 21.488745 },
-    { 85267, 89931, 28.299554 },
-    { 85267, 89962, 54.639802 },
-    { 85267, 90185, 24.177533 },
-    { 85267, 90496, 32.961938 },
-    { 85267, 92041, 32.714174 },
-    { 85267, 92855, 34.143286 },
-    { 85267, 93506, 31.526131 },
-    { 85267, 93747, 73.281204 },
-    { 85267, 93864, 33.929422 },
-    { 85267, 94141, 40.278054 },
-    { 85267, 95501, 64.312797 },
-    { 85267, 97278, 73.066025 },
-    { 85267, 97649, 71.801993 },
-    { 85267, 99473, 64.738618 },
-    { 85267, 100345, 53.258912 },
-    { 85267, 100751, 24.385882 },
-    { 85267, 101772, 30.347271 },
-    { 85267, 106278, 69.912452 },
-    { 85267, 107556, 63.087373 },
-    { 85267, 108085, 47.439253 },
-    { 85267, 109074, 78.863748 },
-    { 85267, 109268, 42.822787 },
-    { 85267, 110130, 36.672677 },
-    { 85267, 112122, 47.311932 },
-    { 85267, 113136, 72.646290 },
-    { 85267, 113368, 61.983953 },
-    { 85670, 86032, 39.751095 },
-    { 85670, 86742, 47.810768 },
-    { 85670, 87833, 4.117297 },
-    { 85670, 88048, 62.378038 },
-    { 85670, 88635, 83.086984 },
-    { 85670, 89931, 82.872432 },
-    { 85670, 89962, 56.237934 },
-    { 85670, 90496, 78.735976 },
-    { 85670, 91262, 17.755509 },
-    { 85670, 92041, 80.983847 },
-    { 85670, 92855, 80.760447 },
-    { 85670, 93194, 25.300002 },
-    { 85670, 93747, 42.859004 },
-    { 85670, 93864, 82.713393 },
-    { 85670, 94141, 76.457486 },
-    { 85670, 94376, 19.680176 },
-    { 85670, 95501, 54.672918 },
-    { 85670, 95947, 33.028497 },
-    { 85670, 97165, 23.081001 },
-    { 85670, 97278, 49.888721 },
-    { 85670, 97649, 51.947990 },
-    { 85670, 99473, 62.899508 },
-    { 85670, 100345, 76.523162 },
-    { 85670, 100453, 31.471695 },
-    { 85670, 102098, 31.621686 },
-    { 85670, 102488, 39.176905 },
-    { 85670, 104732, 45.841619 },
-    { 85670, 105199, 31.176325 },
-    { 85670, 106032, 31.869665 },
-    { 85670, 106278, 77.002863 },
-    { 85670, 107315, 66.103263 },
-    { 85670, 109074, 77.505782 },
-    { 85670, 109492, 38.544216 },
-    { 85670, 112158, 59.546514 },
-    { 85670, 113881, 64.209052 },
-    { 85670, 113963, 74.127988 },
-    { 85670, 116727, 39.845026 },
-    { 85696, 85792, 12.581733 },
-    { 85696, 85927, 0.598141 },
-    { 85696, 86032, 49.865946 },
-    { 85696, 86228, 5.837693 },
-    { 85696, 86670, 2.883855 },
-    { 85696, 86742, 41.967204 },
-    { 85696, 87073, 4.332981 },
-    { 85696, 87261, 3.811631 },
-    { 85696, 88048, 28.251699 },
-    { 85696, 88635, 9.998735 },
-    { 85696, 89642, 9.362722 },
-    { 85696, 89931, 12.836146 },
-    { 85696, 89962, 36.304836 },
-    { 85696, 90185, 11.197654 },
-    { 85696, 90496, 16.994437 },
-    { 85696, 91262, 77.589243 },
-    { 85696, 92041, 18.851840 },
-    { 85696, 92855, 20.980963 },
-    { 85696, 93194, 72.943603 },
-    { 85696, 93506, 20.449393 },
-    { 85696, 93747, 55.790128 },
-    { 85696, 93864, 22.363519 },
-    { 85696, 94141, 26.908312 },
-    { 85696, 95501, 48.398427 },
-    { 85696, 95947, 71.064731 },
-    { 85696, 97278, 57.480019 },
-    { 85696, 97649, 56.603377 },
-    { 85696, 99473, 51.915736 },
-    { 85696, 100345, 43.851345 },
-    { 85696, 100751, 34.714339 },
-    { 85696, 101772, 35.383789 },
-    { 85696, 106278, 63.107039 },
-    { 85696, 107315, 75.667308 },
-    { 85696, 107556, 59.835051 },
-    { 85696, 108085, 51.170568 },
-    { 85696, 109074, 73.043834 },
-    { 85696, 109268, 50.640188 },
-    { 85696, 110130, 49.571912 },
-    { 85696, 112122, 56.248786 },
-    { 85696, 113136, 73.423219 },
-    { 85696, 113368, 66.479579 },
-    { 85792, 85927, 12.776191 },
-    { 85792, 86032, 62.440256 },
-    { 85792, 86228, 6.942246 },
-    { 85792, 86670, 11.009274 },
-    { 85792, 86742, 54.501126 },
-    { 85792, 87073, 10.134639 },
-    { 85792, 87261, 13.236133 },
-    { 85792, 88048, 40.497940 },
-    { 85792, 88635, 20.474683 },
-    { 85792, 89642, 15.496088 },
-    { 85792, 89931, 22.089420 },
-    { 85792, 89962, 48.138654 },
-    { 85792, 90185, 18.219576 },
-    { 85792, 90496, 26.757514 },
-    { 85792, 92041, 26.904943 },
-    { 85792, 92855, 28.519824 },
-    { 85792, 93506, 26.303228 },
-    { 85792, 93747, 66.981643 },
-    { 85792, 93864, 28.670252 },
-    { 85792, 94141, 34.735832 },
-    { 85792, 95501, 58.370159 },
-    { 85792, 95947, 82.192779 },
-    { 85792, 97278, 67.248869 },
-    { 85792, 97649, 66.083258 },
-    { 85792, 99473, 59.631784 },
-    { 85792, 100345, 49.002891 },
-    { 85792, 100751, 26.366287 },
-    { 85792, 101772, 30.328765 },
-    { 85792, 106278, 66.695331 },
-    { 85792, 107315, 81.010637 },
-    { 85792, 107556, 60.939747 },
-    { 85792, 108085, 47.445749 },
-    { 85792, 109074, 76.077652 },
-    { 85792, 109268, 44.291472 },
-    { 85792, 110130, 40.137738 },
-    { 85792, 112122, 49.310035 },
-    { 85792, 113136, 72.022556 },
-    { 85792, 113368, 62.533905 },
-    { 85927, 86032, 49.665302 },
-    { 85927, 86228, 5.936562 },
-    { 85927, 86670, 2.600655 },
-    { 85927, 86742, 41.734076 },
-    { 85927, 87073, 4.072722 },
-    { 85927, 87261, 3.241380 },
-    { 85927, 88048, 27.927012 },
-    { 85927, 88635, 9.448192 },
-    { 85927, 89642, 8.798527 },
-    { 85927, 89931, 12.255036 },
-    { 85927, 89962, 35.921556 },
-    { 85927, 90185, 10.604828 },
-    { 85927, 90496, 16.440259 },
-    { 85927, 91262, 77.275943 },
-    { 85927, 92041, 18.261662 },
-    { 85927, 92855, 20.387428 },
-    { 85927, 93194, 72.577593 },
-    { 85927, 93506, 19.852761 },
-    { 85927, 93747, 55.356425 },
-    { 85927, 93864, 21.765378 },
-    { 85927, 94141, 26.323033 },
-    { 85927, 95501, 47.889931 },
-    { 85927, 95947, 70.632588 },
-    { 85927, 97278, 56.967704 },
-    { 85927, 97649, 56.079391 },
-    { 85927, 99473, 51.342493 },
-    { 85927, 100345, 43.253257 },
-    { 85927, 100751, 34.482263 },
-    { 85927, 101772, 35.002118 },
-    { 85927, 106278, 62.510407 },
-    { 85927, 107315, 75.072614 },
-    { 85927, 107556, 59.261040 },
-    { 85927, 108085, 50.713353 },
-    { 85927, 109074, 72.448465 },
-    { 85927, 109268, 50.280247 },
-    { 85927, 110130, 49.371893 },
-    { 85927, 112122, 55.907076 },
-    { 85927, 113136, 72.885908 },
-    { 85927, 113368, 66.013678 },
-    { 86032, 86228, 55.561084 },
-    { 86032, 86670, 51.620608 },
-    { 86032, 86742, 8.267256 },
-    { 86032, 87073, 52.769408 },
-    { 86032, 87261, 49.728059 },
-    { 86032, 87833, 39.175329 },
-    { 86032, 88048, 23.121456 },
-    { 86032, 88635, 43.621322 },
-    { 86032, 89642, 50.336377 },
-    { 86032, 89931, 43.817736 },
-    { 86032, 89962, 19.277181 },
-    { 86032, 90185, 48.380392 },
-    { 86032, 90496, 40.119249 },
-    { 86032, 91262, 29.609794 },
-    { 86032, 92041, 43.116060 },
-    { 86032, 92855, 43.489063 },
-    { 86032, 93194, 27.828904 },
-    { 86032, 93506, 47.406345 },
-    { 86032, 93747, 22.050882 },
-    { 86032, 93864, 45.994783 },
-    { 86032, 94141, 40.870819 },
-    { 86032, 94376, 57.385260 },
-    { 86032, 95501, 28.929972 },
-    { 86032, 95947, 31.086286 },
-    { 86032, 97165, 42.707491 },
-    { 86032, 97278, 32.201305 },
-    { 86032, 97649, 33.549106 },
-    { 86032, 99473, 41.030944 },
-    { 86032, 100345, 49.372161 },
-    { 86032, 100453, 45.922830 },
-    { 86032, 100751, 77.774366 },
-    { 86032, 101772, 72.367077 },
-    { 86032, 102098, 51.229517 },
-    { 86032, 102488, 48.312433 },
-    { 86032, 104732, 53.186456 },
-    { 86032, 105199, 63.580892 },
-    { 86032, 106032, 67.967320 },
-    { 86032, 106278, 61.513567 },
-    { 86032, 107315, 61.046689 },
-    { 86032, 107556, 68.598471 },
-    { 86032, 108085, 78.524188 },
-    { 86032, 109074, 68.348728 },
-    { 86032, 109492, 68.326708 },
-    { 86032, 112158, 72.605970 },
-    { 86032, 113136, 83.977238 },
-    { 86032, 113881, 77.343782 },
-    { 86032, 113963, 79.590283 },
-    { 86032, 116727, 77.971616 },
-    { 86228, 86670, 4.085807 },
-    { 86228, 86742, 47.585139 },
-    { 86228, 87073, 3.453478 },
-    { 86228, 87261, 6.418842 },
-    { 86228, 88048, 33.560808 },
-    { 86228, 88635, 13.796629 },
-    { 86228, 89642, 9.922397 },
-    { 86228, 89931, 15.801060 },
-    { 86228, 89962, 41.279929 },
-    { 86228, 90185, 12.538161 },
-    { 86228, 90496, 20.405817 },
-    { 86228, 91262, 82.889744 },
-    { 86228, 92041, 21.176840 },
-    { 86228, 92855, 23.036181 },
-    { 86228, 93194, 77.960619 },
-    { 86228, 93506, 21.488117 },
-    { 86228, 93747, 60.339923 },
-    { 86228, 93864, 23.718852 },
-    { 86228, 94141, 29.242299 },
-    { 86228, 95501, 52.164857 },
-    { 86228, 95947, 75.594366 },
-    { 86228, 97278, 61.153745 },
-    { 86228, 97649, 60.104968 },
-    { 86228, 99473, 54.399453 },
-    { 86228, 100345, 44.900993 },
-    { 86228, 100751, 29.776720 },
-    { 86228, 101772, 31.622820 },
-    { 86228, 106278, 63.519273 },
-    { 86228, 107315, 77.028962 },
-    { 86228, 107556, 59.028485 },
-    { 86228, 108085, 48.140036 },
-    { 86228, 109074, 73.249263 },
-    { 86228, 109268, 46.557425 },
-    { 86228, 110130, 44.400247 },
-    { 86228, 112122, 51.982489 },
-    { 86228, 113136, 71.568191 },
-    { 86228, 113368, 63.475082 },
-    { 86670, 86742, 43.597432 },
-    { 86670, 87073, 1.472380 },
-    { 86670, 87261, 2.459955 },
-    { 86670, 88048, 29.489314 },
-    { 86670, 88635, 9.844609 },
-    { 86670, 89642, 7.290783 },
-    { 86670, 89931, 12.138611 },
-    { 86670, 89962, 37.198545 },
-    { 86670, 90185, 9.550412 },
-    { 86670, 90496, 16.633734 },
-    { 86670, 91262, 78.808114 },
-    { 86670, 92041, 17.846906 },
-    { 86670, 92855, 19.849584 },
-    { 86670, 93194, 73.881398 },
-    { 86670, 93506, 18.821043 },
-    { 86670, 93747, 56.325982 },
-    { 86670, 93864, 20.896701 },
-    { 86670, 94141, 25.962944 },
-    { 86670, 95501, 48.362312 },
-    { 86670, 95947, 71.591185 },
-    { 86670, 97278, 57.392528 },
-    { 86670, 97649, 56.405043 },
-    { 86670, 99473, 51.120154 },
-    { 86670, 100345, 42.341246 },
-    { 86670, 100751, 31.881620 },
-    { 86670, 101772, 32.518947 },
-    { 86670, 106278, 61.367639 },
-    { 86670, 107315, 74.351418 },
-    { 86670, 107556, 57.646983 },
-    { 86670, 108085, 48.408644 },
-    { 86670, 109074, 71.237299 },
-    { 86670, 109268, 47.762145 },
-    { 86670, 110130, 46.775746 },
-    { 86670, 112122, 53.365788 },
-    { 86670, 113136, 70.940254 },
-    { 86670, 113368, 63.733947 },
-    { 86742, 87073, 44.703891 },
-    { 86742, 87261, 41.636917 },
-    { 86742, 87833, 47.001903 },
-    { 86742, 88048, 14.854377 },
-    { 86742, 88635, 35.396067 },
-    { 86742, 89642, 42.090507 },
-    { 86742, 89931, 35.550827 },
-    { 86742, 89962, 12.044461 },
-    { 86742, 90185, 40.115804 },
-    { 86742, 90496, 31.873941 },
-    { 86742, 91262, 36.305109 },
-    { 86742, 92041, 34.953371 },
-    { 86742, 92855, 35.422275 },
-    { 86742, 93194, 33.189694 },
-    { 86742, 93506, 39.319058 },
-    { 86742, 93747, 22.230436 },
-    { 86742, 93864, 38.005939 },
-    { 86742, 94141, 33.203942 },
-    { 86742, 94376, 64.896089 },
-    { 86742, 95501, 25.488205 },
-    { 86742, 95947, 34.599090 },
-    { 86742, 97165, 48.459554 },
-    { 86742, 97278, 31.001533 },
-    { 86742, 97649, 31.885634 },
-    { 86742, 99473, 37.314758 },
-    { 86742, 100345, 43.561076 },
-    { 86742, 100453, 50.442170 },
-    { 86742, 100751, 69.578605 },
-    { 86742, 101772, 64.422179 },
-    { 86742, 102098, 56.155405 },
-    { 86742, 102488, 51.534670 },
-    { 86742, 104732, 55.527862 },
-    { 86742, 105199, 70.007085 },
-    { 86742, 106032, 74.979126 },
-    { 86742, 106278, 57.838736 },
-    { 86742, 107315, 59.865191 },
-    { 86742, 107556, 63.658140 },
-    { 86742, 108085, 71.572188 },
-    { 86742, 109074, 65.688630 },
-    { 86742, 109268, 77.498612 },
-    { 86742, 109492, 74.084845 },
-    { 86742, 110130, 83.683018 },
-    { 86742, 112122, 83.077458 },
-    { 86742, 112158, 74.649762 },
-    { 86742, 113136, 79.568627 },
-    { 86742, 113368, 82.370852 },
-    { 86742, 113881, 79.101528 },
-    { 86742, 113963, 79.478940 },
-    { 87073, 87261, 3.115412 },
-    { 87073, 88048, 30.459916 },
-    { 87073, 88635, 10.387676 },
-    { 87073, 89642, 6.773978 },
-    { 87073, 89931, 12.351700 },
-    { 87073, 89962, 38.004824 },
-    { 87073, 90185, 9.263919 },
-    { 87073, 90496, 16.952340 },
-    { 87073, 91262, 79.712637 },
-    { 87073, 92041, 17.809744 },
-    { 87073, 92855, 19.723251 },
-    { 87073, 93194, 74.663320 },
-    { 87073, 93506, 18.406380 },
-    { 87073, 93747, 56.939424 },
-    { 87073, 93864, 20.566162 },
-    { 87073, 94141, 25.902961 },
-    { 87073, 95501, 48.711492 },
-    { 87073, 95947, 72.183894 },
-    { 87073, 97278, 57.702732 },
-    { 87073, 97649, 56.661000 },
-    { 87073, 99473, 51.074129 },
-    { 87073, 100345, 41.911957 },
-    { 87073, 100751, 30.409632 },
-    { 87073, 101772, 31.133192 },
-    { 87073, 106278, 60.778409 },
-    { 87073, 107315, 73.993303 },
-    { 87073, 107556, 56.784246 },
-    { 87073, 108085, 47.132623 },
-    { 87073, 109074, 70.599501 },
-    { 87073, 109268, 46.349899 },
-    { 87073, 110130, 45.304255 },
-    { 87073, 112122, 51.937630 },
-    { 87073, 113136, 69.872470 },
-    { 87073, 113368, 62.468315 },
-    { 87261, 88048, 27.348628 },
-    { 87261, 88635, 7.401964 },
-    { 87261, 89642, 5.557824 },
-    { 87261, 89931, 9.700935 },
-    { 87261, 89962, 34.904207 },
-    { 87261, 90185, 7.452163 },
-    { 87261, 90496, 14.175119 },
-    { 87261, 91262, 76.598127 },
-    { 87261, 92041, 15.491058 },
-    { 87261, 92855, 17.538233 },
-    { 87261, 93194, 71.572401 },
-    { 87261, 93506, 16.741417 },
-    { 87261, 93747, 53.924432 },
-    { 87261, 93864, 18.730512 },
-    { 87261, 94141, 23.603490 },
-    { 87261, 95501, 45.902950 },
-    { 87261, 95947, 69.182789 },
-    { 87261, 97278, 54.932582 },
-    { 87261, 97649, 53.947168 },
-    { 87261, 99473, 48.738463 },
-    { 87261, 100345, 40.216791 },
-    { 87261, 100751, 32.413194 },
-    { 87261, 101772, 32.279842 },
-    { 87261, 102488, 82.017603 },
-    { 87261, 104732, 82.363330 },
-    { 87261, 106278, 59.383068 },
-    { 87261, 107315, 72.145918 },
-    { 87261, 107556, 56.023429 },
-    { 87261, 108085, 47.702010 },
-    { 87261, 109074, 69.299249 },
-    { 87261, 109268, 47.621789 },
-    { 87261, 110130, 47.409476 },
-    { 87261, 112122, 53.315315 },
-    { 87261, 113136, 69.669209 },
-    { 87261, 113368, 62.969441 },
-    { 87833, 88048, 61.264537 },
-    { 87833, 88635, 81.937646 },
-    { 87833, 89931, 81.494037 },
-    { 87833, 89962, 54.640148 },
-    { 87833, 90496, 77.219318 },
-    { 87833, 91262, 14.530158 },
-    { 87833, 92041, 79.218980 },
-    { 87833, 92855, 78.849524 },
-    { 87833, 93194, 21.968944 },
-    { 87833, 93506, 82.655652 },
-    { 87833, 93747, 40.094581 },
-    { 87833, 93864, 80.658266 },
-    { 87833, 94141, 74.268057 },
-    { 87833, 94376, 18.638757 },
-    { 87833, 95501, 51.824003 },
-    { 87833, 95947, 29.409748 },
-    { 87833, 97165, 18.977016 },
-    { 87833, 97278, 46.574769 },
-    { 87833, 97649, 48.618655 },
-    { 87833, 99473, 59.541713 },
-    { 87833, 100345, 73.332740 },
-    { 87833, 100453, 27.363839 },
-    { 87833, 102098, 27.671141 },
-    { 87833, 102488, 35.059908 },
-    { 87833, 104732, 41.728661 },
-    { 87833, 105199, 28.717404 },
-    { 87833, 106032, 30.395144 },
-    { 87833, 106278, 73.106874 },
-    { 87833, 107315, 62.014804 },
-    { 87833, 109074, 73.433799 },
-    { 87833, 109492, 35.794298 },
-    { 87833, 112158, 55.688009 },
-    { 87833, 113881, 60.404333 },
-    { 87833, 113963, 70.122945 },
-    { 87833, 116727, 39.252889 },
-    { 88048, 88635, 20.710663 },
-    { 88048, 89642, 27.314284 },
-    { 88048, 89931, 20.700400 },
-    { 88048, 89962, 8.826956 },
-    { 88048, 90185, 25.275393 },
-    { 88048, 90496, 17.089197 },
-    { 88048, 91262, 49.352948 },
-    { 88048, 92041, 20.433937 },
-    { 88048, 92855, 21.213650 },
-    { 88048, 93194, 44.803212 },
-    { 88048, 93506, 24.990609 },
-    { 88048, 93747, 28.807083 },
-    { 88048, 93864, 23.996202 },
-    { 88048, 94141, 20.394549 },
-    { 88048, 94376, 78.554153 },
-    { 88048, 95501, 25.096248 },
-    { 88048, 95947, 43.769738 },
-    { 88048, 97165, 59.869481 },
-    { 88048, 97278, 33.565290 },
-    { 88048, 97649, 33.481722 },
-    { 88048, 99473, 34.086074 },
-    { 88048, 100345, 35.005567 },
-    { 88048, 100453, 59.980988 },
-    { 88048, 100751, 54.858984 },
-    { 88048, 101772, 50.245126 },
-    { 88048, 102098, 66.054305 },
-    { 88048, 102488, 59.037652 },
-    { 88048, 104732, 61.379062 },
-    { 88048, 105199, 81.856383 },
-    { 88048, 106278, 52.775544 },
-    { 88048, 107315, 59.354625 },
-    { 88048, 107556, 55.755554 },
-    { 88048, 108085, 59.360159 },
-    { 88048, 109074, 62.075328 },
-    { 88048, 109268, 64.106023 },
-    { 88048, 110130, 69.205930 },
-    { 88048, 112122, 69.866760 },
-    { 88048, 112158, 78.937488 },
-    { 88048, 113136, 71.993728 },
-    { 88048, 113368, 71.904114 },
-    { 88048, 113881, 82.663968 },
-    { 88048, 113963, 79.714353 },
-    { 88635, 89642, 6.797782 },
-    { 88635, 89931, 3.336867 },
-    { 88635, 89962, 27.769829 },
-    { 88635, 90185, 5.540333 },
-    { 88635, 90496, 6.997039 },
-    { 88635, 91262, 69.585567 },
-    { 88635, 92041, 9.382847 },
-    { 88635, 92855, 11.628024 },
-    { 88635, 93194, 64.353864 },
-    { 88635, 93506, 12.283387 },
-    { 88635, 93747, 46.551997 },
-    { 88635, 93864, 13.629984 },
-    { 88635, 94141, 17.169703 },
-    { 88635, 95501, 38.556665 },
-    { 88635, 95947, 61.799914 },
-    { 88635, 97165, 78.848915 },
-    { 88635, 97278, 47.610148 },
-    { 88635, 97649, 46.675811 },
-    { 88635, 99473, 41.977311 },
-    { 88635, 100345, 34.710451 },
-    { 88635, 100453, 77.428498 },
-    { 88635, 100751, 35.801180 },
-    { 88635, 101772, 33.553571 },
-    { 88635, 102098, 83.549662 },
-    { 88635, 102488, 74.687511 },
-    { 88635, 104732, 75.210335 },
-    { 88635, 106278, 54.256648 },
-    { 88635, 107315, 66.087544 },
-    { 88635, 107556, 52.255332 },
-    { 88635, 108085, 47.133569 },
-    { 88635, 109074, 64.274904 },
-    { 88635, 109268, 48.778584 },
-    { 88635, 110130, 50.747821 },
-    { 88635, 112122, 54.633633 },
-    { 88635, 113136, 66.950325 },
-    { 88635, 113368, 61.968015 },
-    { 89642, 89931, 6.968706 },
-    { 89642, 89962, 33.874801 },
-    { 89642, 90185, 2.723931 },
-    { 89642, 90496, 11.552709 },
-    { 89642, 91262, 75.675285 },
-    { 89642, 92041, 11.431026 },
-    { 89642, 92855, 13.168547 },
-    { 89642, 93194, 70.117943 },
-    { 89642, 93506, 11.632976 },
-    { 89642, 93747, 51.862516 },
-    { 89642, 93864, 13.813769 },
-    { 89642, 94141, 19.395679 },
-    { 89642, 95501, 42.893783 },
-    { 89642, 95947, 66.961905 },
-    { 89642, 97278, 51.753156 },
-    { 89642, 97649, 50.593326 },
-    { 89642, 99473, 44.512263 },
-    { 89642, 100345, 35.140082 },
-    { 89642, 100453, 82.155026 },
-    { 89642, 100751, 29.184001 },
-    { 89642, 101772, 27.751797 },
-    { 89642, 102488, 78.743091 },
-    { 89642, 104732, 78.574561 },
-    { 89642, 106278, 54.082073 },
-    { 89642, 107315, 67.220336 },
-    { 89642, 107556, 50.482294 },
-    { 89642, 108085, 42.540291 },
-    { 89642, 109074, 63.946542 },
-    { 89642, 109268, 43.114365 },
-    { 89642, 110130, 44.188750 },
-    { 89642, 112122, 48.903916 },
-    { 89642, 113136, 64.139705 },
-    { 89642, 113368, 57.726885 },
-    { 89931, 89962, 26.931025 },
-    { 89931, 90185, 4.605676 },
-    { 89931, 90496, 4.669716 },
-    { 89931, 91262, 68.711640 },
-    { 89931, 92041, 6.118955 },
-    { 89931, 92855, 8.341282 },
-    { 89931, 93194, 63.160717 },
-    { 89931, 93506, 9.020930 },
-    { 89931, 93747, 44.984448 },
-    { 89931, 93864, 10.294574 },
-    { 89931, 94141, 14.081518 },
-    { 89931, 95501, 36.376829 },
-    { 89931, 95947, 60.141107 },
-    { 89931, 97165, 77.356580 },
-    { 89931, 97278, 45.353051 },
-    { 89931, 97649, 44.312386 },
-    { 89931, 99473, 39.103317 },
-    { 89931, 100345, 31.427131 },
-    { 89931, 100453, 75.514201 },
-    { 89931, 100751, 34.606086 },
-    { 89931, 101772, 31.516730 },
-    { 89931, 102098, 81.609000 },
-    { 89931, 102488, 72.428734 },
-    { 89931, 104732, 72.666985 },
-    { 89931, 106278, 50.947051 },
-    { 89931, 107315, 62.941785 },
-    { 89931, 107556, 48.941760 },
-    { 89931, 108085, 44.392292 },
-    { 89931, 109074, 60.961384 },
-    { 89931, 109268, 46.554557 },
-    { 89931, 110130, 49.375686 },
-    { 89931, 112122, 52.428963 },
-    { 89931, 113136, 63.725569 },
-    { 89931, 113368, 59.062481 },
-    { 89931, 113963, 81.784395 },
-    { 89962, 90185, 31.494218 },
-    { 89962, 90496, 22.580947 },
-    { 89962, 91262, 41.835637 },
-    { 89962, 92041, 24.788044 },
-    { 89962, 92855, 24.776104 },
-    { 89962, 93194, 36.684954 },
-    { 89962, 93506, 28.703015 },
-    { 89962, 93747, 20.011257 },
-    { 89962, 93864, 27.062891 },
-    { 89962, 94141, 21.624392 },
-    { 89962, 94376, 71.131430 },
-    { 89962, 95501, 17.127446 },
-    { 89962, 95947, 35.084246 },
-    { 89962, 97165, 51.512309 },
-    { 89962, 97278, 25.086237 },
-    { 89962, 97649, 25.208730 },
-    { 89962, 99473, 27.559268 },
-    { 89962, 100345, 31.806693 },
-    { 89962, 100453, 51.252903 },
-    { 89962, 100751, 59.241621 },
-    { 89962, 101772, 53.250758 },
-    { 89962, 102098, 57.348234 },
-    { 89962, 102488, 50.212013 },
-    { 89962, 104732, 52.653295 },
-    { 89962, 105199, 73.491983 },
-    { 89962, 106032, 79.646692 },
-    { 89962, 106278, 47.493963 },
-    { 89962, 107315, 52.099101 },
-    { 89962, 107556, 52.251156 },
-    { 89962, 108085, 59.556909 },
-    { 89962, 109074, 56.147401 },
-    { 89962, 109268, 65.739724 },
-    { 89962, 109492, 76.072319 },
-    { 89962, 110130, 72.731436 },
-    { 89962, 112122, 71.232825 },
-    { 89962, 112158, 70.518292 },
-    { 89962, 113136, 68.374516 },
-    { 89962, 113368, 70.431001 },
-    { 89962, 113881, 74.414104 },
-    { 89962, 113963, 72.379025 },
-    { 90185, 90496, 9.000642 },
-    { 90185, 91262, 73.227006 },
-    { 90185, 92041, 8.713905 },
-    { 90185, 92855, 10.499855 },
-    { 90185, 93194, 67.569307 },
-    { 90185, 93506, 9.294866 },
-    { 90185, 93747, 49.233943 },
-    { 90185, 93864, 11.347535 },
-    { 90185, 94141, 16.716009 },
-    { 90185, 95501, 40.178211 },
-    { 90185, 95947, 64.300837 },
-    { 90185, 97165, 81.595195 },
-    { 90185, 97278, 49.030265 },
-    { 90185, 97649, 47.869577 },
-    { 90185, 99473, 41.862027 },
-    { 90185, 100345, 32.799370 },
-    { 90185, 100453, 79.447326 },
-    { 90185, 100751, 30.371733 },
-    { 90185, 101772, 28.046651 },
-    { 90185, 102488, 76.019566 },
-    { 90185, 104732, 75.876758 },
-    { 90185, 106278, 51.931309 },
-    { 90185, 107315, 64.803497 },
-    { 90185, 107556, 48.789489 },
-    { 90185, 108085, 42.047940 },
-    { 90185, 109074, 61.853029 },
-    { 90185, 109268, 43.314091 },
-    { 90185, 110130, 45.270744 },
-    { 90185, 112122, 49.157579 },
-    { 90185, 113136, 62.852260 },
-    { 90185, 113368, 57.071106 },
-    { 90185, 113963, 82.973028 },
-    { 90496, 91262, 64.238511 },
-    { 90496, 92041, 4.265584 },
-    { 90496, 92855, 6.201590 },
-    { 90496, 93194, 58.577316 },
-    { 90496, 93506, 8.868483 },
-    { 90496, 93747, 40.329746 },
-    { 90496, 93864, 8.997750 },
-    { 90496, 94141, 10.555671 },
-    { 90496, 95501, 31.760130 },
-    { 90496, 95947, 55.474299 },
-    { 90496, 97165, 72.703052 },
-    { 90496, 97278, 40.767053 },
-    { 90496, 97649, 39.772373 },
-    { 90496, 99473, 35.016319 },
-    { 90496, 100345, 28.511756 },
-    { 90496, 100453, 70.854463 },
-    { 90496, 100751, 37.772146 },
-    { 90496, 101772, 33.625839 },
-    { 90496, 102098, 76.953306 },
-    { 90496, 102488, 67.851527 },
-    { 90496, 104732, 68.241804 },
-    { 90496, 106278, 48.143104 },
-    { 90496, 107315, 59.368829 },
-    { 90496, 107556, 47.184364 },
-    { 90496, 108085, 44.969162 },
-    { 90496, 109074, 58.165588 },
-    { 90496, 109268, 48.184294 },
-    { 90496, 110130, 52.223579 },
-    { 90496, 112122, 54.047242 },
-    { 90496, 112158, 82.587703 },
-    { 90496, 113136, 62.537660 },
-    { 90496, 113368, 59.092003 },
-    { 90496, 113963, 78.641568 },
-    { 91262, 92041, 65.805350 },
-    { 91262, 92855, 65.220629 },
-    { 91262, 93194, 7.551232 },
-    { 91262, 93506, 68.923514 },
-    { 91262, 93747, 25.701086 },
-    { 91262, 93864, 66.821540 },
-    { 91262, 94141, 60.299251 },
-    { 91262, 94376, 29.299119 },
-    { 91262, 95501, 37.344887 },
-    { 91262, 95947, 15.562756 },
-    { 91262, 97165, 14.113929 },
-    { 91262, 97278, 32.138051 },
-    { 91262, 97649, 34.195147 },
-    { 91262, 99473, 45.144876 },
-    { 91262, 100345, 58.833277 },
-    { 91262, 100453, 20.284400 },
-    { 91262, 102098, 23.848024 },
-    { 91262, 102488, 26.320201 },
-    { 91262, 104732, 32.989460 },
-    { 91262, 105199, 33.971571 },
-    { 91262, 106032, 38.683000 },
-    { 91262, 106278, 59.965971 },
-    { 91262, 107315, 50.726933 },
-    { 91262, 107556, 70.628645 },
-    { 91262, 109074, 61.696326 },
-    { 91262, 109492, 39.031094 },
-    { 91262, 112158, 50.467739 },
-    { 91262, 113136, 81.201625 },
-    { 91262, 113881, 55.472760 },
-    { 91262, 113963, 62.694285 },
-    { 91262, 116727, 49.205413 },
-    { 92041, 92855, 2.256621 },
-    { 92041, 93194, 59.763938 },
-    { 92041, 93506, 4.715553 },
-    { 92041, 93747, 41.135009 },
-    { 92041, 93864, 4.775340 },
-    { 92041, 94141, 8.116143 },
-    { 92041, 95501, 31.603528 },
-    { 92041, 95947, 56.005245 },
-    { 92041, 97165, 73.377740 },
-    { 92041, 97278, 40.376578 },
-    { 92041, 97649, 39.180017 },
-    { 92041, 99473, 33.280154 },
-    { 92041, 100345, 25.327652 },
-    { 92041, 100453, 70.897022 },
-    { 92041, 100751, 34.667829 },
-    { 92041, 101772, 29.859491 },
-    { 92041, 102098, 76.926727 },
-    { 92041, 102488, 67.324094 },
-    { 92041, 104732, 67.178460 },
-    { 92041, 106278, 44.884057 },
-    { 92041, 107315, 56.846223 },
-    { 92041, 107556, 43.306594 },
-    { 92041, 108085, 40.727254 },
-    { 92041, 109074, 54.906081 },
-    { 92041, 109268, 44.162270 },
-    { 92041, 110130, 48.792602 },
-    { 92041, 112122, 50.008990 },
-    { 92041, 112158, 80.546879 },
-    { 92041, 113136, 58.470868 },
-    { 92041, 113368, 54.828787 },
-    { 92041, 113881, 82.850919 },
-    { 92041, 113963, 75.675654 },
-    { 92855, 93194, 58.992644 },
-    { 92855, 93506, 3.932631 },
-    { 92855, 93747, 40.235991 },
-    { 92855, 93864, 2.941194 },
-    { 92855, 94141, 6.230139 },
-    { 92855, 95501, 30.306128 },
-    { 92855, 95947, 54.921157 },
-    { 92855, 97165, 72.320691 },
-    { 92855, 97278, 38.935088 },
-    { 92855, 97649, 37.660137 },
-    { 92855, 99473, 31.363334 },
-    { 92855, 100345, 23.087509 },
-    { 92855, 100453, 69.559777 },
-    { 92855, 100751, 34.469393 },
-    { 92855, 101772, 29.069462 },
-    { 92855, 102098, 75.549191 },
-    { 92855, 102488, 65.760724 },
-    { 92855, 104732, 65.418576 },
-    { 92855, 106278, 42.631926 },
-    { 92855, 107315, 54.689164 },
-    { 92855, 107556, 41.105320 },
-    { 92855, 108085, 39.137429 },
-    { 92855, 109074, 52.652916 },
-    { 92855, 109268, 43.004823 },
-    { 92855, 110130, 48.264473 },
-    { 92855, 112122, 48.817544 },
-    { 92855, 112158, 78.482363 },
-    { 92855, 113136, 56.354191 },
-    { 92855, 113368, 53.014787 },
-    { 92855, 113881, 80.720895 },
-    { 92855, 113963, 73.443134 },
-    { 93194, 93506, 62.575701 },
-    { 93194, 93747, 18.883503 },
-    { 93194, 93864, 60.389272 },
-    { 93194, 94141, 53.775275 },
-    { 93194, 94376, 35.028081 },
-    { 93194, 95501, 30.222524 },
-    { 93194, 95947, 8.326034 },
-    { 93194, 97165, 15.294550 },
-    { 93194, 97278, 24.616308 },
-    { 93194, 97649, 26.667524 },
-    { 93194, 99473, 37.610081 },
-    { 93194, 100345, 51.365723 },
-    { 93194, 100453, 18.314340 },
-    { 93194, 101772, 82.996580 },
-    { 93194, 102098, 23.405036 },
-    { 93194, 102488, 22.378229 },
-    { 93194, 104732, 28.562709 },
-    { 93194, 105199, 37.135499 },
-    { 93194, 106032, 42.968877 },
-    { 93194, 106278, 52.681461 },
-    { 93194, 107315, 44.321737 },
-    { 93194, 107556, 63.218484 },
-    { 93194, 108085, 81.057106 },
-    { 93194, 109074, 54.966143 },
-    { 93194, 109492, 40.896498 },
-    { 93194, 112158, 47.284924 },
-    { 93194, 113136, 74.294967 },
-    { 93194, 113881, 52.274732 },
-    { 93194, 113963, 58.011595 },
-    { 93194, 116727, 53.920553 },
-    { 93506, 93747, 43.749023 },
-    { 93506, 93864, 2.405187 },
-    { 93506, 94141, 9.002044 },
-    { 93506, 95501, 33.445685 },
-    { 93506, 95947, 58.228366 },
-    { 93506, 97165, 75.627978 },
-    { 93506, 97278, 41.834704 },
-    { 93506, 97649, 40.442133 },
-    { 93506, 99473, 33.335127 },
-    { 93506, 100345, 23.522636 },
-    { 93506, 100453, 72.527522 },
-    { 93506, 100751, 30.539540 },
-    { 93506, 101772, 25.254530 },
-    { 93506, 102098, 78.447162 },
-    { 93506, 102488, 68.376311 },
-    { 93506, 104732, 67.636545 },
-    { 93506, 106278, 42.657655 },
-    { 93506, 107315, 55.587372 },
-    { 93506, 107556, 40.004358 },
-    { 93506, 108085, 36.123588 },
-    { 93506, 109074, 52.602660 },
-    { 93506, 109268, 39.449815 },
-    { 93506, 110130, 44.364092 },
-    { 93506, 112122, 45.294494 },
-    { 93506, 112158, 79.750549 },
-    { 93506, 113136, 54.705970 },
-    { 93506, 113368, 50.419111 },
-    { 93506, 113881, 81.684764 },
-    { 93506, 113963, 73.687088 },
-    { 93747, 93864, 41.535181 },
-    { 93747, 94141, 34.903611 },
-    { 93747, 94376, 53.810329 },
-    { 93747, 95501, 11.837710 },
-    { 93747, 95947, 15.276719 },
-    { 93747, 97165, 32.373311 },
-    { 93747, 97278, 10.494193 },
-    { 93747, 97649, 12.186211 },
-    { 93747, 99473, 21.954048 },
-    { 93747, 100345, 34.208896 },
-    { 93747, 100453, 31.291701 },
-    { 93747, 100751, 72.549622 },
-    { 93747, 101772, 64.538004 },
-    { 93747, 102098, 37.409614 },
-    { 93747, 102488, 30.409094 },
-    { 93747, 104732, 33.597589 },
-    { 93747, 105199, 54.101113 },
-    { 93747, 106032, 60.792209 },
-    { 93747, 106278, 41.138790 },
-    { 93747, 107315, 39.006234 },
-    { 93747, 107556, 49.936832 },
-    { 93747, 108085, 64.732154 },
-    { 93747, 109074, 46.839876 },
-    { 93747, 109268, 73.285090 },
-    { 93747, 109492, 56.172094 },
-    { 93747, 110130, 83.540219 },
-    { 93747, 112122, 77.750336 },
-    { 93747, 112158, 52.483985 },
-    { 93747, 113136, 63.949092 },
-    { 93747, 113368, 70.848440 },
-    { 93747, 113881, 56.881580 },
-    { 93747, 113963, 57.752017 },
-    { 93747, 116727, 71.921637 },
-    { 93864, 94141, 6.677267 },
-    { 93864, 95501, 31.107154 },
-    { 93864, 95947, 55.921064 },
-    { 93864, 97165, 73.314644 },
-    { 93864, 97278, 39.449928 },
-    { 93864, 97649, 38.046428 },
-    { 93864, 99473, 30.961624 },
-    { 93864, 100345, 21.491607 },
-    { 93864, 100453, 70.144225 },
-    { 93864, 100751, 32.252728 },
-    { 93864, 101772, 26.417717 },
-    { 93864, 102098, 76.055367 },
-    { 93864, 102488, 65.971239 },
-    { 93864, 104732, 65.248171 },
-    { 93864, 106278, 40.817548 },
-    { 93864, 107315, 53.455983 },
-    { 93864, 107556, 38.694108 },
-    { 93864, 108085, 36.196512 },
-    { 93864, 109074, 50.803895 },
-    { 93864, 109268, 40.146233 },
-    { 93864, 110130, 45.748597 },
-    { 93864, 112122, 45.943887 },
-    { 93864, 112158, 77.531163 },
-    { 93864, 113136, 53.730252 },
-    { 93864, 113368, 50.119583 },
-    { 93864, 113881, 79.548491 },
-    { 93864, 113963, 71.787458 },
-    { 94141, 95501, 24.443830 },
-    { 94141, 95947, 49.244291 },
-    { 94141, 97165, 66.639203 },
-    { 94141, 97278, 32.882865 },
-    { 94141, 97649, 31.543108 },
-    { 94141, 99473, 25.172155 },
-    { 94141, 100345, 18.045728 },
-    { 94141, 100453, 63.562981 },
-    { 94141, 100751, 38.357138 },
-    { 94141, 101772, 31.697325 },
-    { 94141, 102098, 69.509942 },
-    { 94141, 102488, 59.592979 },
-    { 94141, 104732, 59.188647 },
-    { 94141, 106278, 37.660597 },
-    { 94141, 107315, 48.920243 },
-    { 94141, 107556, 37.498643 },
-    { 94141, 108085, 38.987911 },
-    { 94141, 109074, 47.670631 },
-    { 94141, 109268, 44.300715 },
-    { 94141, 110130, 51.229465 },
-    { 94141, 112122, 49.923086 },
-    { 94141, 112158, 72.461707 },
-    { 94141, 113136, 53.336228 },
-    { 94141, 113368, 51.712368 },
-    { 94141, 113881, 74.847186 },
-    { 94141, 113963, 68.086469 },
-    { 94376, 95501, 64.585127 },
-    { 94376, 95947, 39.796102 },
-    { 94376, 97165, 22.927840 },
-    { 94376, 97278, 57.323004 },
-    { 94376, 97649, 59.142397 },
-    { 94376, 99473, 69.245696 },
-    { 94376, 100345, 83.382318 },
-    { 94376, 100453, 29.016937 },
-    { 94376, 102098, 25.201978 },
-    { 94376, 102488, 36.285495 },
-    { 94376, 104732, 41.428812 },
-    { 94376, 105199, 14.003450 },
-    { 94376, 106032, 12.295808 },
-    { 94376, 106278, 77.231339 },
-    { 94376, 107315, 62.995024 },
-    { 94376, 109074, 74.251840 },
-    { 94376, 109492, 21.753703 },
-    { 94376, 112158, 48.318668 },
-    { 94376, 113881, 52.114792 },
-    { 94376, 113963, 64.108046 },
-    { 94376, 116727, 20.660240 },
-    { 95501, 95947, 24.876358 },
-    { 95501, 97165, 42.233310 },
-    { 95501, 97278, 9.096766 },
-    { 95501, 97649, 8.519041 },
-    { 95501, 99473, 12.105352 },
-    { 95501, 100345, 22.567294 },
-    { 95501, 100453, 39.293508 },
-    { 95501, 100751, 61.084628 },
-    { 95501, 101772, 52.833892 },
-    { 95501, 102098, 45.332518 },
-    { 95501, 102488, 36.133514 },
-    { 95501, 104732, 37.152388 },
-    { 95501, 105199, 63.054682 },
-    { 95501, 106032, 70.323498 },
-    { 95501, 106278, 32.654231 },
-    { 95501, 107315, 35.079621 },
-    { 95501, 107556, 39.919677 },
-    { 95501, 108085, 53.134894 },
-    { 95501, 109074, 40.200456 },
-    { 95501, 109268, 61.505314 },
-    { 95501, 109492, 63.818135 },
-    { 95501, 110130, 71.723414 },
-    { 95501, 112122, 66.081410 },
-    { 95501, 112158, 53.906036 },
-    { 95501, 113136, 55.052184 },
-    { 95501, 113368, 60.325225 },
-    { 95501, 113881, 57.568411 },
-    { 95501, 113963, 55.287421 },
-    { 95501, 116727, 81.452800 },
-    { 95947, 97165, 17.403258 },
-    { 95947, 97278, 17.725699 },
-    { 95947, 97649, 19.668958 },
-    { 95947, 99473, 30.384059 },
-    { 95947, 100345, 44.442817 },
-    { 95947, 100453, 16.238729 },
-    { 95947, 101772, 76.745507 },
-    { 95947, 102098, 22.285441 },
-    { 95947, 102488, 17.229118 },
-    { 95947, 104732, 22.397414 },
-    { 95947, 105199, 38.860859 },
-    { 95947, 106032, 45.732130 },
-    { 95947, 106278, 44.422337 },
-    { 95947, 107315, 36.179808 },
-    { 95947, 107556, 55.070250 },
-    { 95947, 108085, 73.451272 },
-    { 95947, 109074, 46.679691 },
-    { 95947, 109268, 82.916949 },
-    { 95947, 109492, 40.988105 },
-    { 95947, 112158, 41.755219 },
-    { 95947, 113136, 65.971574 },
-    { 95947, 113368, 75.887895 },
-    { 95947, 113881, 46.619708 },
-    { 95947, 113963, 50.960624 },
-    { 95947, 116727, 56.884397 },
-    { 97165, 97278, 34.518526 },
-    { 97165, 97649, 36.284952 },
-    { 97165, 99473, 46.321722 },
-    { 97165, 100345, 60.467796 },
-    { 97165, 100453, 8.394477 },
-    { 97165, 102098, 9.932990 },
-    { 97165, 102488, 16.193178 },
-    { 97165, 104732, 22.778162 },
-    { 97165, 105199, 21.991824 },
-    { 97165, 106032, 28.419207 },
-    { 97165, 106278, 56.028407 },
-    { 97165, 107315, 43.559553 },
-    { 97165, 107556, 67.231836 },
-    { 97165, 109074, 55.074773 },
-    { 97165, 109492, 25.671647 },
-    { 97165, 112158, 37.676243 },
-    { 97165, 113136, 74.570208 },
-    { 97165, 113881, 42.590310 },
-    { 97165, 113963, 51.393045 },
-    { 97165, 116727, 39.555045 },
-    { 97278, 97649, 2.070640 },
-    { 97278, 99473, 13.020690 },
-    { 97278, 100345, 26.814622 },
-    { 97278, 100453, 30.694489 },
-    { 97278, 100751, 67.840382 },
-    { 97278, 101772, 59.023288 },
-    { 97278, 102098, 36.627863 },
-    { 97278, 102488, 27.085168 },
-    { 97278, 104732, 28.120218 },
-    { 97278, 105199, 54.561860 },
-    { 97278, 106032, 62.051200 },
-    { 97278, 106278, 30.804497 },
-    { 97278, 107315, 29.010360 },
-    { 97278, 107556, 40.097526 },
-    { 97278, 108085, 56.543057 },
-    { 97278, 109074, 36.364001 },
-    { 97278, 109268, 65.696906 },
-    { 97278, 109492, 54.917786 },
-    { 97278, 110130, 77.056805 },
-    { 97278, 112122, 69.637257 },
-    { 97278, 112158, 45.434099 },
-    { 97278, 113136, 53.591039 },
-    { 97278, 113368, 61.158475 },
-    { 97278, 113881, 49.361188 },
-    { 97278, 113963, 48.492371 },
-    { 97278, 116727, 73.105169 },
-    { 97649, 99473, 10.955098 },
-    { 97649, 100345, 24.807681 },
-    { 97649, 100453, 32.160596 },
-    { 97649, 100751, 65.995542 },
-    { 97649, 101772, 57.113798 },
-    { 97649, 102098, 38.015153 },
-    { 97649, 102488, 28.151348 },
-    { 97649, 104732, 28.712431 },
-    { 97649, 105199, 56.028317 },
-    { 97649, 106032, 63.598797 },
-    { 97649, 106278, 28.971615 },
-    { 97649, 107315, 27.983533 },
-    { 97649, 107556, 38.110430 },
-    { 97649, 108085, 54.474250 },
-    { 97649, 109074, 34.850613 },
-    { 97649, 109268, 63.641302 },
-    { 97649, 109492, 56.124222 },
-    { 97649, 110130, 75.051190 },
-    { 97649, 112122, 67.568075 },
-    { 97649, 112158, 45.458971 },
-    { 97649, 113136, 51.777950 },
-    { 97649, 113368, 59.157420 },
-    { 97649, 113881, 49.228294 },
-    { 97649, 113963, 47.757829 },
-    { 97649, 116727, 74.609898 },
-    { 99473, 100345, 14.164360 },
-    { 99473, 100453, 41.153670 },
-    { 99473, 100751, 55.987654 },
-    { 99473, 101772, 46.820665 },
-    { 99473, 102098, 46.582550 },
-    { 99473, 102488, 35.743352 },
-    { 99473, 104732, 34.342627 },
-    { 99473, 105199, 64.661836 },
-    { 99473, 106032, 72.513678 },
-    { 99473, 106278, 20.581771 },
-    { 99473, 107315, 25.467660 },
-    { 99473, 107556, 28.122318 },
-    { 99473, 108085, 43.526354 },
-    { 99473, 109074, 28.622690 },
-    { 99473, 109268, 52.698936 },
-    { 99473, 109492, 63.600616 },
-    { 99473, 110130, 64.277346 },
-    { 99473, 112122, 56.621799 },
-    { 99473, 112158, 47.598247 },
-    { 99473, 113136, 42.966520 },
-    { 99473, 113368, 48.911065 },
-    { 99473, 113881, 50.416100 },
-    { 99473, 113963, 45.755385 },
-    { 99473, 116727, 83.233831 },
-    { 100345, 100453, 55.038811 },
-    { 100345, 100751, 41.962781 },
-    { 100345, 101772, 32.692148 },
-    { 100345, 102098, 60.240033 },
-    { 100345, 102488, 49.118758 },
-    { 100345, 104732, 46.713196 },
-    { 100345, 105199, 78.185840 },
-    { 100345, 106278, 19.631440 },
-    { 100345, 107315, 32.136948 },
-    { 100345, 107556, 20.763522 },
-    { 100345, 108085, 30.568277 },
-    { 100345, 109074, 29.654386 },
-    { 100345, 109268, 39.151824 },
-    { 100345, 109492, 76.393413 },
-    { 100345, 110130, 50.243994 },
-    { 100345, 112122, 43.545470 },
-    { 100345, 112158, 56.510329 },
-    { 100345, 113136, 37.012000 },
-    { 100345, 113368, 38.935456 },
-    { 100345, 113881, 58.214778 },
-    { 100345, 113963, 50.361648 },
-    { 100453, 102098, 6.134034 },
-    { 100453, 102488, 7.893803 },
-    { 100453, 104732, 14.386066 },
-    { 100453, 105199, 23.871952 },
-    { 100453, 106032, 31.486322 },
-    { 100453, 106278, 48.522446 },
-    { 100453, 107315, 35.401617 },
-    { 100453, 107556, 59.734443 },
-    { 100453, 108085, 80.417842 },
-    { 100453, 109074, 46.925331 },
-    { 100453, 109492, 24.902613 },
-    { 100453, 112158, 30.212754 },
-    { 100453, 113136, 66.322688 },
-    { 100453, 113368, 78.625346 },
-    { 100453, 113881, 35.208568 },
-    { 100453, 113963, 43.250034 },
-    { 100453, 116727, 42.451348 },
-    { 100751, 101772, 9.617287 },
-    { 100751, 106278, 52.794477 },
-    { 100751, 107315, 68.557415 },
-    { 100751, 107556, 43.423194 },
-    { 100751, 108085, 24.293229 },
-    { 100751, 109074, 59.891168 },
-    { 100751, 109268, 18.449250 },
-    { 100751, 110130, 15.032316 },
-    { 100751, 112122, 23.040109 },
-    { 100751, 113136, 49.606716 },
-    { 100751, 113368, 37.905283 },
-    { 100751, 113963, 79.193815 },
-    { 101772, 102488, 81.284288 },
-    { 101772, 104732, 77.927169 },
-    { 101772, 106278, 43.301619 },
-    { 101772, 107315, 59.058365 },
-    { 101772, 107556, 34.312758 },
-    { 101772, 108085, 17.179943 },
-    { 101772, 109074, 50.748275 },
-    { 101772, 109268, 15.370900 },
-    { 101772, 110130, 19.543455 },
-    { 101772, 112122, 21.154372 },
-    { 101772, 112158, 82.495375 },
-    { 101772, 113136, 42.302001 },
-    { 101772, 113368, 32.213172 },
-    { 101772, 113881, 82.252264 },
-    { 101772, 113963, 70.647470 },
-    { 102098, 102488, 11.347825 },
-    { 102098, 104732, 16.270500 },
-    { 102098, 105199, 18.105021 },
-    { 102098, 106032, 25.937142 },
-    { 102098, 106278, 52.073623 },
-    { 102098, 107315, 37.884600 },
-    { 102098, 107556, 63.187054 },
-    { 102098, 109074, 49.266711 },
-    { 102098, 109492, 18.770929 },
-    { 102098, 112158, 28.102517 },
-    { 102098, 113136, 68.156084 },
-    { 102098, 113368, 81.049993 },
-    { 102098, 113881, 32.927789 },
-    { 102098, 113963, 42.535455 },
-    { 102098, 116727, 36.716735 },
-    { 102488, 104732, 6.783445 },
-    { 102488, 105199, 29.067606 },
-    { 102488, 106032, 37.042680 },
-    { 102488, 106278, 40.968909 },
-    { 102488, 107315, 27.517711 },
-    { 102488, 107556, 52.149492 },
-    { 102488, 108085, 73.053452 },
-    { 102488, 109074, 39.039476 },
-    { 102488, 109268, 83.005500 },
-    { 102488, 109492, 28.063985 },
-    { 102488, 112158, 24.932866 },
-    { 102488, 113136, 58.431114 },
-    { 102488, 113368, 70.766473 },
-    { 102488, 113881, 29.908250 },
-    { 102488, 113963, 36.389450 },
-    { 102488, 116727, 47.538682 },
-    { 104732, 105199, 32.371267 },
-    { 104732, 106032, 40.393460 },
-    { 104732, 106278, 36.075234 },
-    { 104732, 107315, 21.616165 },
-    { 104732, 107556, 47.075551 },
-    { 104732, 108085, 68.269208 },
-    { 104732, 109074, 33.034330 },
-    { 104732, 109268, 78.189392 },
-    { 104732, 109492, 29.692339 },
-    { 104732, 112122, 79.725395 },
-    { 104732, 112158, 19.423535 },
-    { 104732, 113136, 52.155427 },
-    { 104732, 113368, 64.834119 },
-    { 104732, 113881, 24.233825 },
-    { 104732, 113963, 29.711596 },
-    { 104732, 116727, 50.184723 },
-    { 105199, 106032, 8.036242 },
-    { 105199, 106278, 68.201975 },
-    { 105199, 107315, 52.913906 },
-    { 105199, 107556, 78.910974 },
-    { 105199, 109074, 63.529949 },
-    { 105199, 109492, 7.782488 },
-    { 105199, 112158, 35.117639 },
-    { 105199, 113136, 80.641272 },
-    { 105199, 113881, 38.551296 },
-    { 105199, 113963, 50.928392 },
-    { 105199, 116727, 18.614242 },
-    { 106032, 106278, 76.133415 },
-    { 106032, 107315, 60.735095 },
-    { 106032, 109074, 71.144504 },
-    { 106032, 109492, 13.129224 },
-    { 106032, 112158, 41.649347 },
-    { 106032, 113881, 44.552421 },
-    { 106032, 113963, 57.271254 },
-    { 106032, 116727, 11.152913 },
-    { 106278, 107315, 15.763070 },
-    { 106278, 107556, 11.216787 },
-    { 106278, 108085, 32.200758 },
-    { 106278, 109074, 10.027013 },
-    { 106278, 109268, 42.135958 },
-    { 106278, 109492, 64.262559 },
-    { 106278, 110130, 55.409847 },
-    { 106278, 112122, 44.058476 },
-    { 106278, 112158, 39.673762 },
-    { 106278, 113136, 22.810396 },
-    { 106278, 113368, 31.475865 },
-    { 106278, 113881, 40.334559 },
-    { 106278, 113963, 31.058433 },
-    { 107315, 107556, 26.011152 },
-    { 107315, 108085, 47.295002 },
-    { 107315, 109074, 11.524280 },
-    { 107315, 109268, 57.088331 },
-    { 107315, 109492, 48.594978 },
-    { 107315, 110130, 70.467313 },
-    { 107315, 112122, 58.240735 },
-    { 107315, 112158, 24.532175 },
-    { 107315, 113136, 31.056518 },
-    { 107315, 113368, 43.277757 },
-    { 107315, 113881, 26.097434 },
-    { 107315, 113963, 20.360239 },
-    { 107315, 116727, 69.362712 },
-    { 107556, 108085, 21.292751 },
-    { 107556, 109074, 16.468780 },
-    { 107556, 109268, 31.145772 },
-    { 107556, 109492, 74.490255 },
-    { 107556, 110130, 44.500689 },
-    { 107556, 112122, 32.850457 },
-    { 107556, 112158, 48.267600 },
-    { 107556, 113136, 16.248837 },
-    { 107556, 113368, 21.081757 },
-    { 107556, 113881, 47.953240 },
-    { 107556, 113963, 36.738765 },
-    { 108085, 109074, 37.146001 },
-    { 108085, 109268, 9.952241 },
-    { 108085, 110130, 23.225922 },
-    { 108085, 112122, 13.096021 },
-    { 108085, 112158, 68.554884 },
-    { 108085, 113136, 25.384475 },
-    { 108085, 113368, 15.344945 },
-    { 108085, 113881, 67.466803 },
-    { 108085, 113963, 55.148679 },
-    { 109074, 109268, 46.643856 },
-    { 109074, 109492, 58.529740 },
-    { 109074, 110130, 59.990216 },
-    { 109074, 112122, 47.257578 },
-    { 109074, 112158, 31.799672 },
-    { 109074, 113136, 19.637373 },
-    { 109074, 113368, 31.800442 },
-    { 109074, 113881, 31.620569 },
-    { 109074, 113963, 21.292606 },
-    { 109074, 116727, 78.981185 },
-    { 109268, 110130, 13.383300 },
-    { 109268, 112122, 5.877073 },
-    { 109268, 112158, 77.579672 },
-    { 109268, 113136, 32.596581 },
-    { 109268, 113368, 19.810088 },
-    { 109268, 113881, 76.084123 },
-    { 109268, 113963, 63.449990 },
-    { 109492, 112158, 28.521284 },
-    { 109492, 113136, 74.571284 },
-    { 109492, 113881, 31.499031 },
-    { 109492, 113963, 44.159619 },
-    { 109492, 116727, 20.814716 },
-    { 110130, 112122, 13.833510 },
-    { 110130, 113136, 44.921479 },
-    { 110130, 113368, 31.335975 },
-    { 110130, 113963, 76.039313 },
-    { 112122, 112158, 77.105912 },
-    { 112122, 113136, 31.163482 },
-    { 112122, 113368, 17.506075 },
-    { 112122, 113881, 75.118568 },
-    { 112122, 113963, 62.288322 },
-    { 112158, 113136, 46.127459 },
-    { 112158, 113368, 59.944682 },
-    { 112158, 113881, 5.013090 },
-    { 112158, 113963, 15.825055 },
-    { 112158, 116727, 47.842316 },
-    { 113136, 113368, 13.818236 },
-    { 113136, 113881, 43.958730 },
-    { 113136, 113963, 31.126377 },
-    { 113368, 113881, 57.722855 },
-    { 113368, 113963, 44.860031 },
-    { 113881, 113963, 12.879121 },
-    { 113881, 116727, 49.720392 },
-    { 113963, 116727, 62.578365 },
+const catalog_pair_t tab_cat[N_PAIRS] = {
+    { 153, 154, 3 },
+    { 200, 202, 299 },
+    { 197, 198, 424 },
+    { 160, 161, 518 },
+    { 129, 132, 660 },
+    { 52, 55, 678 },
+    { 48, 52, 693 },
+    { 176, 177, 703 },
+    { 205, 207, 736 },
+    { 105, 108, 908 },
+    { 61, 64, 933 },
+    { 178, 180, 1014 },
+    { 229, 230, 1035 },
+    { 23, 24, 1096 },
+    { 90, 91, 1097 },
+    { 218, 219, 1128 },
+    { 180, 182, 1146 },
+    { 97, 99, 1195 },
+    { 221, 223, 1203 },
+    { 205, 208, 1230 },
+    { 202, 205, 1300 },
+    { 166, 170, 1326 },
+    { 122, 127, 1341 },
+    { 37, 39, 1360 },
+    { 212, 215, 1362 },
+    { 48, 55, 1368 },
+    { 44, 48, 1409 },
+    { 74, 75, 1417 },
+    { 54, 57, 1436 },
+    { 200, 205, 1442 },
+    { 95, 99, 1457 },
+    { 219, 223, 1471 },
+    { 108, 109, 1489 },
+    { 174, 175, 1529 },
+    { 207, 208, 1558 },
+    { 47, 49, 1561 },
+    { 44, 52, 1583 },
+    { 158, 165, 1595 },
+    { 202, 208, 1621 },
+    { 211, 213, 1668 },
+    { 73, 75, 1682 },
+    { 127, 133, 1683 },
+    { 37, 43, 1697 },
+    { 204, 207, 1727 },
+    { 173, 174, 1754 },
+    { 124, 126, 1757 },
+    { 40, 42, 1765 },
+    { 8, 11, 1808 },
+    { 25, 26, 1848 },
+    { 189, 198, 1872 },
+    { 186, 187, 1885 },
+    { 189, 197, 1890 },
+    { 200, 208, 1906 },
+    { 14, 17, 1966 },
+    { 219, 221, 1966 },
+    { 66, 70, 1977 },
+    { 166, 167, 2025 },
+    { 202, 207, 2036 },
+    { 204, 205, 2043 },
+    { 44, 55, 2046 },
+    { 199, 209, 2059 },
+    { 153, 156, 2074 },
+    { 154, 156, 2076 },
+    { 51, 55, 2092 },
+    { 83, 85, 2093 },
+    { 167, 170, 2098 },
+    { 178, 182, 2098 },
+    { 125, 133, 2121 },
+    { 105, 109, 2124 },
+    { 216, 218, 2133 },
+    { 122, 133, 2135 },
+    { 78, 81, 2150 },
+    { 95, 97, 2159 },
+    { 200, 207, 2166 },
+    { 152, 160, 2172 },
+    { 45, 50, 2178 },
+    { 134, 140, 2181 },
+    { 152, 161, 2193 },
+    { 161, 166, 2206 },
+    { 147, 153, 2209 },
+    { 147, 154, 2210 },
+    { 44, 51, 2225 },
+    { 80, 82, 2253 },
+    { 75, 77, 2264 },
+    { 119, 123, 2266 },
+    { 65, 72, 2267 },
+    { 122, 125, 2283 },
+    { 192, 204, 2299 },
+    { 213, 215, 2303 },
+    { 160, 167, 2309 },
+    { 213, 216, 2335 },
+    { 6, 8, 2340 },
+    { 51, 52, 2356 },
+    { 218, 221, 2358 },
+    { 22, 25, 2368 },
+    { 218, 223, 2388 },
+    { 11, 13, 2400 },
+    { 51, 56, 2421 },
+    { 1, 6, 2458 },
+    { 160, 166, 2461 },
+    { 40, 44, 2471 },
+    { 161, 167, 2496 },
+    { 41, 49, 2501 },
+    { 250, 253, 2507 },
+    { 145, 150, 2515 },
+    { 102, 105, 2517 },
+    { 173, 178, 2526 },
+    { 12, 15, 2545 },
+    { 115, 116, 2547 },
+    { 39, 43, 2554 },
+    { 156, 164, 2571 },
+    { 155, 160, 2580 },
+    { 94, 104, 2601 },
+    { 73, 74, 2616 },
+    { 121, 124, 2625 },
+    { 193, 203, 2630 },
+    { 152, 155, 2676 },
+    { 112, 113, 2687 },
+    { 89, 97, 2694 },
+    { 125, 132, 2701 },
+    { 123, 134, 2715 },
+    { 64, 68, 2732 },
+    { 63, 69, 2750 },
+    { 38, 47, 2768 },
+    { 211, 215, 2770 },
+    { 50, 58, 2779 },
+    { 208, 212, 2779 },
+    { 73, 77, 2785 },
+    { 102, 104, 2786 },
+    { 174, 178, 2805 },
+    { 120, 130, 2813 },
+    { 121, 128, 2818 },
+    { 94, 102, 2831 },
+    { 87, 89, 2832 },
+    { 42, 51, 2834 },
+    { 48, 51, 2838 },
+    { 197, 201, 2870 },
+    { 117, 125, 2874 },
+    { 41, 47, 2912 },
+    { 200, 204, 2919 },
+    { 246, 249, 2939 },
+    { 202, 204, 2968 },
+    { 131, 135, 2985 },
+    { 102, 109, 2993 },
+    { 109, 117, 2999 },
+    { 125, 127, 3007 },
+    { 102, 108, 3026 },
+    { 155, 161, 3052 },
+    { 213, 218, 3059 },
+    { 125, 129, 3065 },
+    { 233, 236, 3067 },
+    { 1, 8, 3074 },
+    { 216, 219, 3101 },
+    { 219, 224, 3115 },
+    { 104, 109, 3151 },
+    { 42, 44, 3155 },
+    { 89, 95, 3170 },
+    { 147, 156, 3191 },
+    { 164, 172, 3198 },
+    { 117, 122, 3202 },
+    { 38, 41, 3206 },
+    { 204, 208, 3209 },
+    { 187, 192, 3229 },
+    { 173, 175, 3244 },
+    { 179, 190, 3248 },
+    { 188, 193, 3255 },
+    { 92, 100, 3262 },
+    { 198, 201, 3286 },
+    { 76, 79, 3309 },
+    { 143, 146, 3330 },
+    { 140, 144, 3338 },
+    { 223, 224, 3339 },
+    { 95, 102, 3381 },
+    { 207, 212, 3387 },
+    { 161, 170, 3392 },
+    { 237, 238, 3392 },
+    { 211, 212, 3399 },
+    { 182, 186, 3400 },
+    { 175, 178, 3416 },
+    { 173, 180, 3428 },
+    { 45, 48, 3433 },
+    { 40, 51, 3457 },
+    { 89, 99, 3458 },
+    { 192, 200, 3460 },
+    { 0, 5, 3464 },
+    { 87, 95, 3469 },
+    { 201, 204, 3471 },
+    { 126, 128, 3481 },
+    { 212, 213, 3484 },
+    { 6, 11, 3490 },
+    { 211, 216, 3499 },
+    { 64, 66, 3516 },
+    { 160, 170, 3530 },
+    { 192, 205, 3545 },
+    { 61, 68, 3571 },
+    { 77, 83, 3577 },
+    { 79, 84, 3605 },
+    { 120, 127, 3606 },
+    { 74, 77, 3608 },
+    { 99, 105, 3631 },
+    { 205, 212, 3645 },
+    { 124, 128, 3647 },
+    { 192, 207, 3653 },
+    { 8, 13, 3663 },
+    { 192, 202, 3687 },
+    { 208, 211, 3701 },
+    { 84, 86, 3706 },
+    { 16, 18, 3712 },
+    { 192, 201, 3723 },
+    { 208, 215, 3726 },
+    { 108, 117, 3748 },
+    { 177, 183, 3751 },
+    { 45, 58, 3765 },
+    { 217, 220, 3776 },
+    { 155, 167, 3781 },
+    { 43, 59, 3789 },
+    { 174, 180, 3815 },
+    { 143, 147, 3816 },
+    { 121, 126, 3836 },
+    { 95, 105, 3845 },
+    { 40, 48, 3850 },
+    { 67, 72, 3851 },
+    { 187, 200, 3865 },
+    { 59, 60, 3867 },
+    { 135, 137, 3867 },
+    { 168, 179, 3870 },
+    { 172, 185, 3871 },
+    { 36, 46, 3880 },
+    { 239, 247, 3891 },
+    { 32, 33, 3922 },
+    { 38, 49, 3926 },
+    { 146, 155, 3926 },
+    { 189, 201, 3945 },
+    { 233, 237, 3947 },
+    { 46, 53, 3948 },
+    { 112, 119, 3952 },
+    { 28, 29, 3958 },
+    { 55, 56, 3960 },
+    { 76, 77, 3964 },
+    { 5, 10, 3968 },
+    { 41, 42, 4007 },
+    { 156, 172, 4011 },
+    { 149, 152, 4017 },
+    { 239, 240, 4018 },
+    { 45, 52, 4021 },
+    { 164, 185, 4028 },
+    { 40, 52, 4037 },
+    { 120, 122, 4043 },
+    { 218, 224, 4058 },
+    { 61, 66, 4069 },
+    { 79, 86, 4072 },
+    { 29, 30, 4081 },
+    { 26, 30, 4113 },
+    { 69, 74, 4130 },
+    { 99, 102, 4130 },
+    { 203, 206, 4134 },
+    { 36, 39, 4144 },
+    { 127, 130, 4149 },
+    { 22, 26, 4154 },
+    { 187, 202, 4160 },
+    { 220, 227, 4163 },
+    { 42, 56, 4167 },
+    { 213, 219, 4171 },
+    { 4, 9, 4174 },
+    { 103, 106, 4176 },
+    { 57, 62, 4196 },
+    { 228, 233, 4197 },
+    { 62, 73, 4202 },
+    { 132, 133, 4210 },
+    { 116, 118, 4226 },
+    { 173, 182, 4249 },
+    { 226, 230, 4260 },
+    { 104, 108, 4277 },
+    { 175, 180, 4308 },
+    { 117, 129, 4340 },
+    { 184, 195, 4351 },
+    { 104, 105, 4356 },
+    { 215, 218, 4357 },
+    { 152, 166, 4363 },
+    { 53, 61, 4373 },
+    { 44, 45, 4374 },
+    { 146, 152, 4374 },
+    { 186, 200, 4378 },
+    { 35, 45, 4393 },
+    { 40, 55, 4396 },
+    { 202, 212, 4399 },
+    { 210, 214, 4413 },
+    { 42, 52, 4419 },
+    { 101, 106, 4419 },
+    { 117, 132, 4420 },
+    { 66, 68, 4426 },
+    { 153, 164, 4431 },
+    { 154, 164, 4433 },
+    { 216, 221, 4434 },
+    { 176, 183, 4450 },
+    { 152, 167, 4461 },
+    { 49, 56, 4465 },
+    { 52, 56, 4470 },
+    { 119, 134, 4470 },
+    { 216, 223, 4499 },
+    { 215, 216, 4500 },
+    { 73, 76, 4501 },
+    { 221, 224, 4501 },
+    { 99, 108, 4502 },
+    { 213, 221, 4510 },
+    { 42, 48, 4511 },
+    { 42, 55, 4521 },
+    { 180, 186, 4522 },
+    { 117, 127, 4529 },
+    { 226, 229, 4548 },
+    { 107, 114, 4575 },
+    { 154, 172, 4577 },
+    { 153, 172, 4578 },
+    { 45, 55, 4582 },
+    { 87, 97, 4600 },
+    { 86, 89, 4601 },
+    { 117, 133, 4603 },
+    { 159, 163, 4607 },
+    { 24, 26, 4611 },
+    { 186, 202, 4625 },
+    { 139, 149, 4629 },
+    { 207, 215, 4632 },
+    { 44, 56, 4646 },
+    { 215, 221, 4647 },
+    { 105, 117, 4649 },
+    { 87, 99, 4668 },
+    { 24, 25, 4671 },
+    { 75, 83, 4672 },
+    { 200, 212, 4681 },
+    { 67, 79, 4682 },
+    { 211, 218, 4691 },
+    { 202, 211, 4724 },
+    { 133, 143, 4737 },
+    { 24, 30, 4743 },
+    { 192, 208, 4746 },
+    { 54, 62, 4748 },
+    { 133, 147, 4748 },
+    { 95, 108, 4751 },
+    { 129, 133, 4756 },
+    { 76, 84, 4763 },
+    { 205, 215, 4775 },
+    { 97, 105, 4792 },
+    { 183, 191, 4794 },
+    { 234, 235, 4809 },
+    { 48, 58, 4815 },
+    { 191, 196, 4833 },
+    { 67, 76, 4837 },
+    { 188, 203, 4841 },
+    { 148, 149, 4843 },
+    { 1, 11, 4847 },
+    { 208, 213, 4850 },
+    { 159, 162, 4870 },
+    { 155, 166, 4885 },
+    { 65, 67, 4887 },
+    { 174, 182, 4889 },
+    { 123, 140, 4891 },
+    { 65, 71, 4899 },
+    { 52, 58, 4911 },
+    { 205, 211, 4922 },
+    { 72, 79, 4952 },
+    { 186, 192, 4957 },
+    { 204, 212, 4961 },
+    { 228, 236, 4966 },
+    { 187, 205, 4969 },
+    { 187, 204, 4971 },
+    { 244, 246, 4976 },
+    { 122, 132, 4984 },
+    { 200, 211, 4999 },
+    { 55, 58, 5008 },
+    { 241, 245, 5014 },
+    { 184, 194, 5021 },
+    { 112, 123, 5044 },
+    { 201, 207, 5067 },
+    { 34, 35, 5068 },
+    { 94, 109, 5076 },
+    { 48, 56, 5078 },
+    { 130, 143, 5083 },
+    { 128, 138, 5113 },
+    { 113, 123, 5114 },
+    { 23, 30, 5115 },
+    { 115, 118, 5118 },
+    { 48, 50, 5131 },
+    { 213, 223, 5147 },
+    { 37, 59, 5166 },
+    { 39, 59, 5176 },
+    { 150, 157, 5184 },
+    { 182, 187, 5191 },
+    { 207, 211, 5194 },
+    { 127, 143, 5203 },
+    { 181, 184, 5205 },
+    { 113, 119, 5217 },
+    { 94, 95, 5225 },
+    { 193, 194, 5225 },
+    { 134, 144, 5231 },
+    { 222, 229, 5247 },
+    { 215, 219, 5250 },
+    { 97, 102, 5261 },
+    { 122, 130, 5261 },
+    { 135, 142, 5276 },
+    { 120, 133, 5278 },
+    { 216, 224, 5278 },
+    { 74, 83, 5293 },
+    { 42, 49, 5295 },
+    { 53, 64, 5301 },
+    { 202, 215, 5302 },
+    { 94, 105, 5307 },
+    { 122, 129, 5327 },
+    { 104, 117, 5338 },
+    { 36, 37, 5351 },
+    { 41, 56, 5353 },
+    { 178, 186, 5361 },
+    { 130, 133, 5383 },
+    { 182, 196, 5397 },
+    { 141, 142, 5413 },
+    { 181, 194, 5413 },
+    { 75, 76, 5432 },
+    { 172, 189, 5437 },
+    { 77, 85, 5450 },
+    { 40, 56, 5451 },
+    { 175, 182, 5453 },
+    { 143, 153, 5455 },
+    { 143, 154, 5455 },
+    { 230, 231, 5478 },
+    { 86, 93, 5481 },
+    { 64, 70, 5493 },
+    { 187, 207, 5499 },
+    { 201, 205, 5505 },
+    { 39, 60, 5523 },
+    { 69, 75, 5541 },
+    { 157, 169, 5541 },
+    { 46, 60, 5546 },
+    { 63, 74, 5548 },
+    { 196, 211, 5550 },
+    { 146, 149, 5557 },
+    { 127, 132, 5563 },
+    { 50, 52, 5570 },
+    { 240, 255, 5576 },
+    { 152, 170, 5584 },
+    { 40, 41, 5594 },
+    { 200, 215, 5599 },
+    { 62, 75, 5600 },
+    { 241, 243, 5608 },
+    { 87, 102, 5610 },
+    { 50, 53, 5612 },
+    { 23, 26, 5630 },
+    { 70, 78, 5634 },
+    { 95, 109, 5638 },
+    { 97, 108, 5643 },
+    { 138, 148, 5655 },
+    { 94, 108, 5658 },
+    { 71, 72, 5665 },
+    { 132, 147, 5674 },
+    { 215, 223, 5674 },
+    { 236, 237, 5674 },
+    { 155, 170, 5676 },
+    { 62, 74, 5683 },
+    { 99, 109, 5691 },
+    { 165, 190, 5694 },
+    { 212, 218, 5716 },
+    { 109, 125, 5726 },
+    { 25, 30, 5742 },
+    { 147, 164, 5747 },
+    { 186, 205, 5749 },
+    { 87, 94, 5755 },
+    { 242, 245, 5762 },
+    { 187, 208, 5763 },
+    { 23, 25, 5767 },
+    { 17, 18, 5768 },
+    { 212, 216, 5776 },
+    { 151, 157, 5778 },
+    { 143, 155, 5782 },
+    { 9, 12, 5787 },
+    { 6, 13, 5788 },
+    { 186, 196, 5788 },
+    { 35, 50, 5794 },
+    { 211, 219, 5814 },
+    { 212, 221, 5816 },
+    { 149, 161, 5824 },
+    { 114, 119, 5835 },
+    { 57, 67, 5836 },
+    { 41, 51, 5839 },
+    { 71, 87, 5857 },
+    { 125, 147, 5876 },
+    { 18, 23, 5877 },
+    { 93, 97, 5901 },
+    { 146, 160, 5910 },
+    { 222, 226, 5919 },
+    { 19, 255, 5921 },
+    { 56, 63, 5926 },
+    { 132, 156, 5930 },
+    { 49, 63, 5943 },
+    { 43, 60, 5945 },
+    { 89, 93, 5947 },
+    { 96, 101, 5957 },
+    { 180, 196, 5964 },
+    { 49, 51, 5965 },
+    { 112, 114, 5974 },
+    { 50, 55, 5979 },
+    { 102, 117, 5985 },
+    { 194, 195, 5985 },
+    { 165, 179, 5994 },
+    { 175, 183, 5995 },
+    { 27, 32, 6005 },
+    { 73, 83, 6006 },
+    { 149, 160, 6011 },
+    { 61, 70, 6014 },
+    { 127, 129, 6021 },
+    { 47, 56, 6022 },
+    { 206, 214, 6022 },
+    { 16, 24, 6034 },
+    { 109, 129, 6040 },
+    { 138, 141, 6051 },
+    { 226, 231, 6053 },
+    { 62, 63, 6060 },
+    { 193, 206, 6060 },
+    { 16, 23, 6063 },
+    { 205, 213, 6069 },
+    { 23, 29, 6074 },
+    { 222, 230, 6093 },
+    { 10, 18, 6104 },
+    { 40, 45, 6111 },
+    { 68, 70, 6120 },
+    { 109, 122, 6122 },
+    { 202, 213, 6128 },
+    { 190, 225, 6132 },
+    { 95, 104, 6142 },
+    { 211, 221, 6142 },
+    { 225, 240, 6148 },
+    { 86, 87, 6161 },
+    { 188, 206, 6169 },
+    { 3, 27, 6171 },
+    { 207, 213, 6176 },
+    { 196, 202, 6177 },
+    { 104, 129, 6179 },
+    { 162, 173, 6181 },
+    { 127, 147, 6191 },
+    { 139, 146, 6196 },
+    { 146, 161, 6204 },
+    { 186, 208, 6208 },
+    { 130, 146, 6217 },
+    { 108, 110, 6218 },
+    { 196, 200, 6218 },
+    { 44, 58, 6220 },
+    { 10, 16, 6230 },
+    { 192, 197, 6236 },
+    { 84, 93, 6238 },
+    { 88, 100, 6245 },
+    { 30, 37, 6249 },
+    { 45, 51, 6263 },
+    { 46, 61, 6266 },
+    { 204, 215, 6269 },
+    { 180, 187, 6271 },
+    { 22, 24, 6282 },
+    { 200, 201, 6291 },
+    { 171, 176, 6300 },
+    { 129, 147, 6303 },
+    { 44, 50, 6307 },
+    { 120, 125, 6308 },
+    { 105, 110, 6309 },
+    { 69, 73, 6322 },
+    { 186, 204, 6323 },
+    { 197, 204, 6341 },
+    { 106, 115, 6359 },
+    { 181, 193, 6361 },
+    { 129, 156, 6368 },
+    { 35, 44, 6370 },
+    { 201, 202, 6388 },
+    { 35, 48, 6390 },
+    { 37, 60, 6393 },
+    { 149, 155, 6402 },
+    { 156, 185, 6402 },
+    { 109, 132, 6403 },
+    { 186, 207, 6406 },
+    { 94, 99, 6417 },
+    { 200, 213, 6418 },
+    { 179, 199, 6428 },
+    { 35, 40, 6429 },
+    { 122, 143, 6435 },
+    { 165, 168, 6437 },
+    { 253, 254, 6440 },
+    { 89, 102, 6456 },
+    { 24, 29, 6466 },
+    { 189, 192, 6467 },
+    { 101, 103, 6481 },
+    { 18, 24, 6490 },
+    { 42, 47, 6493 },
+    { 68, 80, 6503 },
+    { 229, 231, 6510 },
+    { 148, 162, 6518 },
+    { 108, 122, 6522 },
+    { 117, 120, 6527 },
+    { 30, 39, 6532 },
+    { 185, 189, 6543 },
+    { 244, 249, 6548 },
+    { 110, 120, 6557 },
+    { 162, 174, 6560 },
+    { 240, 247, 6565 },
+    { 119, 140, 6570 },
+    { 146, 147, 6570 },
+    { 47, 63, 6571 },
+    { 194, 203, 6574 },
+    { 212, 219, 6584 },
+    { 100, 107, 6611 },
+    { 172, 198, 6612 },
+    { 108, 125, 6618 },
+    { 201, 208, 6618 },
+    { 39, 46, 6628 },
+    { 1, 13, 6631 },
+    { 191, 210, 6633 },
+    { 131, 142, 6641 },
+    { 185, 198, 6649 },
+    { 29, 36, 6650 },
+    { 126, 138, 6654 },
+    { 192, 198, 6654 },
+    { 88, 92, 6670 },
+    { 147, 172, 6672 },
+    { 36, 43, 6688 },
+    { 246, 248, 6692 },
+    { 77, 84, 6707 },
+    { 131, 137, 6708 },
+    { 36, 60, 6710 },
+    { 72, 86, 6711 },
+    { 196, 208, 6715 },
+    { 154, 155, 6725 },
+    { 153, 155, 6728 },
+    { 58, 70, 6747 },
+    { 198, 204, 6757 },
+    { 63, 75, 6759 },
+    { 75, 85, 6759 },
+    { 104, 132, 6763 },
+    { 125, 143, 6765 },
+    { 138, 139, 6773 },
+    { 47, 54, 6776 },
+    { 99, 110, 6780 },
+    { 62, 67, 6793 },
+    { 144, 151, 6798 },
+    { 13, 22, 6800 },
+    { 74, 76, 6803 },
+    { 211, 223, 6815 },
+    { 28, 34, 6825 },
+    { 106, 116, 6828 },
+    { 86, 97, 6829 },
+    { 168, 190, 6835 },
+    { 30, 36, 6838 },
+    { 190, 199, 6844 },
+    { 169, 181, 6848 },
+    { 58, 66, 6872 },
+    { 63, 73, 6872 },
+    { 62, 76, 6873 },
+    { 97, 109, 6873 },
+    { 178, 196, 6876 },
+    { 173, 186, 6879 },
+    { 122, 147, 6880 },
+    { 172, 197, 6895 },
+    { 99, 104, 6896 },
+    { 181, 188, 6898 },
+    { 204, 211, 6898 },
+    { 89, 105, 6903 },
+    { 100, 112, 6906 },
+    { 212, 223, 6907 },
+    { 187, 201, 6908 },
+    { 251, 252, 6909 },
+    { 133, 153, 6911 },
+    { 133, 154, 6912 },
+    { 248, 249, 6917 },
+    { 132, 164, 6918 },
+    { 62, 77, 6931 },
+    { 38, 54, 6951 },
+    { 143, 156, 6969 },
+    { 196, 213, 6969 },
+    { 0, 2, 6976 },
+    { 139, 148, 6978 },
+    { 96, 107, 6992 },
+    { 171, 177, 6997 },
+    { 225, 239, 7002 },
+    { 68, 82, 7009 },
+    { 132, 153, 7013 },
+    { 76, 83, 7015 },
+    { 132, 154, 7016 },
+    { 77, 79, 7018 },
+    { 178, 187, 7022 },
+    { 97, 110, 7025 },
+    { 76, 86, 7033 },
+    { 192, 212, 7040 },
+    { 213, 224, 7041 },
+    { 93, 99, 7044 },
+    { 41, 44, 7049 },
+    { 137, 142, 7050 },
+    { 40, 49, 7057 },
+    { 147, 155, 7057 },
+    { 217, 228, 7057 },
+    { 185, 197, 7059 },
+    { 87, 105, 7069 },
+    { 46, 64, 7072 },
+    { 35, 52, 7080 },
+    { 130, 139, 7081 },
+    { 231, 232, 7082 },
+    { 208, 216, 7088 },
+    { 133, 156, 7091 },
+    { 51, 58, 7099 },
+    { 0, 253, 7104 },
+    { 158, 190, 7106 },
+    { 92, 96, 7123 },
+    { 120, 143, 7129 },
+    { 125, 130, 7143 },
+    { 26, 37, 7145 },
+    { 129, 164, 7147 },
+    { 38, 42, 7168 },
+    { 180, 191, 7169 },
+    { 65, 79, 7173 },
+    { 136, 144, 7177 },
+    { 72, 76, 7182 },
+    { 53, 58, 7187 },
+    { 233, 238, 7193 },
+    { 189, 204, 7200 },
+    { 126, 141, 7225 },
+    { 145, 157, 7234 },
+    { 0, 10, 7242 },
+    { 62, 69, 7254 },
+    { 54, 67, 7262 },
+    { 131, 141, 7263 },
+    { 187, 196, 7265 },
+    { 209, 217, 7265 },
+    { 66, 78, 7267 },
+    { 14, 18, 7276 },
+    { 143, 152, 7306 },
+    { 182, 200, 7327 },
+    { 104, 125, 7331 },
+    { 22, 23, 7333 },
+    { 196, 205, 7340 },
+    { 137, 145, 7353 },
+    { 74, 85, 7364 },
+    { 94, 97, 7370 },
+    { 108, 129, 7382 },
+    { 42, 45, 7395 },
+    { 125, 156, 7404 },
+    { 182, 191, 7409 },
+    { 67, 73, 7414 },
+    { 105, 122, 7416 },
+    { 148, 159, 7418 },
+    { 206, 210, 7427 },
+    { 196, 216, 7458 },
+    { 109, 127, 7463 },
+    { 174, 183, 7463 },
+    { 47, 51, 7476 },
+    { 146, 154, 7484 },
+    { 47, 62, 7486 },
+    { 146, 153, 7486 },
+    { 53, 66, 7490 },
+    { 109, 110, 7491 },
+    { 11, 22, 7492 },
+    { 182, 202, 7512 },
+    { 36, 53, 7513 },
+    { 105, 125, 7516 },
+    { 234, 248, 7516 },
+    { 60, 61, 7532 },
+    { 16, 22, 7536 },
+    { 170, 187, 7536 },
+    { 45, 53, 7550 },
+    { 129, 153, 7564 },
+    { 129, 154, 7567 },
+    { 178, 191, 7570 },
+    { 110, 117, 7576 },
+    { 158, 179, 7589 },
+    { 162, 175, 7589 },
+    { 109, 133, 7591 },
+    { 149, 166, 7595 },
+    { 113, 134, 7623 },
+    { 222, 227, 7638 },
+    { 1, 247, 7640 },
+    { 220, 228, 7647 },
+    { 146, 167, 7653 },
+    { 34, 53, 7657 },
+    { 60, 68, 7659 },
+    { 169, 184, 7660 },
+    { 163, 176, 7665 },
+    { 126, 131, 7672 },
+    { 244, 252, 7672 },
+    { 89, 94, 7674 },
+    { 108, 132, 7685 },
+    { 235, 246, 7685 },
+    { 70, 81, 7687 },
+    { 139, 152, 7707 },
+    { 175, 177, 7717 },
+    { 69, 77, 7718 },
+    { 83, 84, 7718 },
+    { 190, 209, 7734 },
+    { 94, 117, 7741 },
+    { 208, 218, 7746 },
+    { 178, 183, 7747 },
+    { 201, 212, 7748 },
+    { 112, 134, 7756 },
+    { 35, 55, 7757 },
+    { 158, 168, 7764 },
+    { 60, 64, 7765 },
+    { 86, 95, 7771 },
+    { 30, 43, 7777 },
+    { 44, 49, 7779 },
+    { 217, 227, 7781 },
+    { 73, 79, 7794 },
+    { 87, 104, 7800 },
+    { 89, 108, 7807 },
+    { 125, 153, 7807 },
+    { 125, 154, 7809 },
+    { 56, 69, 7818 },
+    { 153, 185, 7828 },
+    { 154, 185, 7829 },
+    { 163, 175, 7833 },
+    { 108, 127, 7839 },
+    { 123, 144, 7853 },
+    { 84, 85, 7860 },
+    { 195, 199, 7864 },
+    { 86, 99, 7867 },
+    { 53, 68, 7870 },
+    { 15, 32, 7876 },
+    { 34, 45, 7877 },
+    { 241, 242, 7882 },
+    { 50, 61, 7884 },
+    { 16, 25, 7888 },
+    { 162, 166, 7891 },
+    { 57, 73, 7896 },
+    { 204, 213, 7901 },
+    { 47, 57, 7906 },
+    { 124, 138, 7907 },
+    { 41, 55, 7911 },
+    { 250, 254, 7913 },
+    { 58, 61, 7914 },
+    { 34, 50, 7915 },
+    { 170, 173, 7915 },
+    { 72, 87, 7917 },
+    { 197, 207, 7919 },
+    { 50, 51, 7922 },
+    { 121, 138, 7922 },
+    { 110, 122, 7924 },
+    { 87, 108, 7937 },
+    { 100, 113, 7941 },
+    { 133, 146, 7945 },
+    { 93, 95, 7952 },
+    { 163, 177, 7957 },
+    { 132, 143, 7977 },
+    { 15, 27, 7982 },
+    { 180, 183, 7985 },
+    { 37, 46, 7987 },
+    { 174, 186, 7989 },
+    { 175, 191, 7991 },
+    { 49, 55, 8001 },
+    { 188, 194, 8003 },
+    { 26, 29, 8023 },
+    { 196, 207, 8023 },
+    { 28, 30, 8027 },
+    { 26, 43, 8028 },
+    { 41, 52, 8031 },
+    { 92, 107, 8036 },
+    { 73, 85, 8037 },
+    { 97, 104, 8042 },
+    { 179, 209, 8047 },
+    { 127, 146, 8063 },
+    { 162, 163, 8097 },
+    { 228, 237, 8097 },
+    { 107, 112, 8099 },
+    { 114, 123, 8099 },
+    { 35, 58, 8105 },
+    { 22, 30, 8106 },
+    { 26, 39, 8106 },
+    { 84, 89, 8116 },
+    { 95, 110, 8118 },
+    { 227, 233, 8119 },
+    { 243, 251, 8124 },
+    { 38, 56, 8125 },
+    { 175, 176, 8129 },
+    { 195, 217, 8131 },
+    { 33, 65, 8134 },
+    { 236, 238, 8135 },
+    { 105, 129, 8151 },
+    { 170, 186, 8153 },
+    { 67, 84, 8156 },
+    { 135, 141, 8157 },
+    { 49, 54, 8163 },
+    { 49, 62, 8174 },
+    { 173, 187, 8176 },
+    { 130, 147, 8179 },
+    { 103, 116, 8181 },
+    { 35, 42, 8183 },
+    { 186, 211, 8204 },
+    { 196, 215, 8204 },
+    { 71, 94, 8207 },
+    { 195, 209, 8213 },
+    { 40, 47, 8218 },
+    { 202, 216, 8220 },
+    { 99, 117, 8234 },
+    { 243, 245, 8234 },
+    { 166, 173, 8241 },
+    { 40, 50, 8243 },
+    { 2, 254, 8258 },
+    { 58, 64, 8260 },
+    { 50, 66, 8268 },
+    { 108, 133, 8268 },
+    { 192, 215, 8268 },
+    { 149, 162, 8269 },
+    { 143, 160, 8287 },
+    { 19, 158, 8289 },
+    { 148, 152, 8292 },
+    { 41, 48, 8294 },
+    { 67, 86, 8301 },
+    { 149, 167, 8303 },
+    { 128, 139, 8311 },
+    { 205, 216, 8317 },
+    { 49, 52, 8321 },
+    { 198, 207, 8326 },
+    { 38, 57, 8328 },
+    { 9, 15, 8331 },
+    { 72, 84, 8331 },
+    { 102, 129, 8331 },
+    { 91, 98, 8332 },
+    { 192, 211, 8337 },
+    { 51, 63, 8340 },
+    { 117, 130, 8345 },
+    { 67, 77, 8352 },
+    { 182, 192, 8352 },
+    { 215, 224, 8358 },
+    { 196, 212, 8360 },
+    { 71, 89, 8365 },
+    { 76, 85, 8365 },
+    { 79, 89, 8367 },
+    { 146, 166, 8370 },
+    { 208, 221, 8371 },
+    { 197, 205, 8374 },
+    { 138, 149, 8375 },
+    { 34, 46, 8378 },
+    { 41, 63, 8379 },
+    { 53, 60, 8384 },
+    { 2, 5, 8389 },
+    { 127, 153, 8394 },
+    { 127, 154, 8395 },
+    { 81, 90, 8411 },
+    { 163, 174, 8412 },
+    { 140, 168, 8415 },
+    { 161, 162, 8426 },
+    { 36, 59, 8430 },
+    { 177, 191, 8444 },
+    { 95, 117, 8461 },
+    { 180, 200, 8461 },
+    { 164, 189, 8468 },
+    { 176, 188, 8475 },
+    { 207, 216, 8476 },
+    { 87, 109, 8484 },
+    { 105, 132, 8487 },
+    { 45, 56, 8491 },
+    { 104, 122, 8493 },
+    { 200, 216, 8497 },
+    { 50, 64, 8505 },
+    { 187, 211, 8517 },
+    { 69, 83, 8520 },
+    { 187, 212, 8521 },
+    { 144, 168, 8534 },
+    { 139, 143, 8543 },
+    { 210, 216, 8545 },
+    { 214, 226, 8564 },
+    { 108, 120, 8568 },
+    { 162, 170, 8572 },
+    { 177, 188, 8574 },
+    { 211, 224, 8585 },
+    { 56, 58, 8588 },
+    { 35, 51, 8589 },
+    { 235, 244, 8590 },
+    { 40, 58, 8594 },
+    { 128, 141, 8603 },
+    { 163, 171, 8603 },
+    { 29, 39, 8615 },
+    { 227, 237, 8615 },
+    { 102, 125, 8621 },
+    { 23, 28, 8624 },
+    { 110, 127, 8628 },
+    { 129, 143, 8632 },
+    { 136, 140, 8632 },
+    { 113, 114, 8637 },
+    { 180, 202, 8640 },
+    { 38, 40, 8647 },
+    { 73, 84, 8648 },
+    { 124, 131, 8651 },
+    { 49, 69, 8659 },
+    { 34, 36, 8661 },
+    { 57, 76, 8674 },
+    { 154, 167, 8677 },
+    { 186, 201, 8679 },
+    { 153, 167, 8680 },
+    { 13, 255, 8681 },
+    { 10, 17, 8697 },
+    { 162, 178, 8699 },
+    { 143, 161, 8700 },
+    { 227, 228, 8702 },
+    { 3, 15, 8703 },
+    { 94, 129, 8705 },
+    { 96, 100, 8708 },
+    { 75, 79, 8716 },
+    { 50, 70, 8720 },
+    { 105, 127, 8726 },
+    { 127, 156, 8733 },
+    { 43, 46, 8747 },
+    { 117, 147, 8747 },
+    { 249, 252, 8753 },
+    { 102, 110, 8754 },
+    { 87, 93, 8756 },
+    { 151, 169, 8760 },
+    { 48, 49, 8762 },
+    { 182, 205, 8767 },
+    { 208, 219, 8769 },
+    { 175, 186, 8776 },
+    { 54, 73, 8777 },
+    { 198, 205, 8788 },
+    { 100, 114, 8790 },
+    { 196, 210, 8792 },
+    { 155, 156, 8793 },
+    { 89, 109, 8795 },
+    { 46, 59, 8810 },
+    { 46, 68, 8819 },
+    { 159, 174, 8819 },
+    { 166, 187, 8819 },
+    { 102, 132, 8821 },
+    { 134, 136, 8822 },
+    { 182, 183, 8826 },
+    { 109, 120, 8829 },
+    { 25, 37, 8830 },
+    { 32, 71, 8833 },
+    { 65, 86, 8836 },
+    { 65, 87, 8847 },
+    { 28, 36, 8851 },
+    { 143, 149, 8862 },
+    { 227, 229, 8863 },
+    { 72, 89, 8871 },
+    { 199, 217, 8878 },
+    { 10, 14, 8891 },
+    { 189, 207, 8894 },
+    { 75, 84, 8901 },
+    { 120, 146, 8903 },
+    { 207, 218, 8905 },
+    { 181, 203, 8920 },
+    { 149, 170, 8921 },
+    { 205, 218, 8923 },
+    { 182, 208, 8928 },
+    { 152, 162, 8937 },
+    { 29, 37, 8938 },
+    { 79, 93, 8942 },
+    { 160, 162, 8944 },
+    { 57, 65, 8950 },
+    { 174, 191, 8950 },
+    { 67, 75, 8960 },
+    { 186, 212, 8962 },
+    { 154, 160, 8963 },
+    { 103, 115, 8964 },
+    { 183, 196, 8965 },
+    { 153, 160, 8966 },
+    { 167, 187, 8966 },
+    { 170, 182, 8968 },
+    { 93, 110, 8973 },
+    { 124, 141, 8981 },
+    { 187, 189, 8989 },
+    { 38, 51, 8991 },
+    { 173, 183, 8995 },
+    { 120, 132, 8997 },
+    { 170, 192, 9011 },
+    { 125, 164, 9013 },
+    { 63, 77, 9018 },
+    { 8, 255, 9021 },
+    { 224, 232, 9023 },
+    { 29, 34, 9031 },
+    { 122, 153, 9031 },
+    { 122, 154, 9033 },
+    { 119, 144, 9049 },
+    { 236, 239, 9053 },
+    { 159, 175, 9059 },
+    { 53, 70, 9066 },
+    { 79, 87, 9068 },
+    { 122, 156, 9072 },
+    { 181, 195, 9073 },
+    { 65, 76, 9078 },
+    { 118, 137, 9091 },
+    { 90, 98, 9094 },
+    { 71, 95, 9101 },
+    { 102, 122, 9110 },
+    { 201, 215, 9110 },
+    { 88, 113, 9111 },
+    { 16, 26, 9114 },
+    { 89, 104, 9123 },
+    { 57, 72, 9128 },
+    { 197, 200, 9129 },
+    { 202, 218, 9131 },
+    { 170, 178, 9132 },
+    { 196, 204, 9135 },
+    { 31, 41, 9146 },
+    { 176, 191, 9146 },
+    { 35, 53, 9147 },
+    { 31, 38, 9150 },
+    { 141, 148, 9150 },
+    { 13, 25, 9155 },
+    { 220, 233, 9157 },
+    { 133, 164, 9169 },
+    { 192, 196, 9175 },
+    { 105, 133, 9176 },
+    { 187, 197, 9182 },
+    { 44, 47, 9193 },
+    { 49, 57, 9198 },
+    { 139, 155, 9200 },
+    { 207, 221, 9203 },
+    { 171, 188, 9206 },
+    { 175, 196, 9212 },
+    { 38, 62, 9217 },
+    { 64, 80, 9222 },
+    { 174, 177, 9224 },
+    { 234, 246, 9225 },
+    { 189, 205, 9227 },
+    { 197, 202, 9240 },
+    { 170, 180, 9252 },
+    { 0, 250, 9279 },
+    { 33, 71, 9291 },
+    { 154, 189, 9292 },
+    { 8, 22, 9294 },
+    { 153, 189, 9294 },
+    { 71, 86, 9295 },
+    { 105, 120, 9297 },
+    { 42, 58, 9303 },
+    { 239, 255, 9307 },
+    { 94, 132, 9310 },
+    { 47, 69, 9319 },
+    { 209, 225, 9319 },
+    { 38, 63, 9320 },
+    { 110, 130, 9321 },
+    { 1, 255, 9324 },
+    { 117, 143, 9325 },
+    { 166, 186, 9334 },
+    { 179, 225, 9334 },
+    { 152, 154, 9344 },
+    { 152, 153, 9346 },
+    { 97, 117, 9347 },
+    { 156, 189, 9349 },
+    { 119, 136, 9351 },
+    { 164, 198, 9355 },
+    { 168, 199, 9356 },
+    { 171, 181, 9359 },
+    { 208, 223, 9365 },
+    { 120, 129, 9367 },
+    { 120, 147, 9372 },
+    { 4, 12, 9373 },
+    { 24, 28, 9374 },
+    { 159, 173, 9377 },
+    { 172, 201, 9380 },
+    { 54, 63, 9384 },
+    { 122, 146, 9384 },
+    { 146, 170, 9384 },
+    { 173, 196, 9384 },
+    { 236, 247, 9385 },
+    { 66, 81, 9391 },
+    { 146, 156, 9393 },
+    { 46, 50, 9394 },
+    { 136, 151, 9394 },
+    { 67, 71, 9405 },
+    { 174, 196, 9407 },
+    { 25, 29, 9408 },
+    { 205, 221, 9411 },
+    { 11, 16, 9413 },
+    { 184, 193, 9414 },
+    { 148, 161, 9415 },
+    { 143, 167, 9419 },
+    { 178, 200, 9422 },
+    { 42, 50, 9423 },
+    { 147, 152, 9423 },
+    { 41, 54, 9425 },
+    { 200, 218, 9426 },
+    { 104, 133, 9433 },
+    { 167, 189, 9433 },
+    { 16, 17, 9440 },
+    { 196, 218, 9440 },
+    { 220, 222, 9442 },
+    { 19, 165, 9443 },
+    { 79, 83, 9447 },
+    { 4, 249, 9456 },
+    { 180, 192, 9460 },
+    { 187, 215, 9461 },
+    { 81, 91, 9472 },
+    { 197, 208, 9475 },
+    { 182, 207, 9478 },
+    { 154, 161, 9481 },
+    { 155, 172, 9481 },
+    { 153, 161, 9484 },
+    { 174, 187, 9486 },
+    { 209, 228, 9489 },
+    { 91, 103, 9496 },
+    { 57, 75, 9497 },
+    { 55, 63, 9517 },
+    { 120, 139, 9524 },
+    { 47, 55, 9531 },
+    { 62, 79, 9531 },
+    { 143, 164, 9540 },
+    { 25, 43, 9548 },
+    { 198, 200, 9552 },
+    { 186, 191, 9558 },
+    { 147, 160, 9559 },
+    { 147, 185, 9564 },
+    { 57, 63, 9575 },
+    { 31, 40, 9579 },
+    { 130, 132, 9579 },
+    { 187, 198, 9580 },
+    { 192, 213, 9595 },
+    { 162, 180, 9605 },
+    { 178, 202, 9609 },
+    { 42, 63, 9615 },
+    { 174, 176, 9615 },
+    { 110, 125, 9619 },
+    { 19, 240, 9636 },
+    { 203, 214, 9639 },
+    { 170, 174, 9643 },
+    { 182, 204, 9643 },
+    { 101, 107, 9645 },
+    { 167, 172, 9650 },
+    { 89, 110, 9660 },
+    { 198, 202, 9662 },
+    { 5, 18, 9666 },
+    { 113, 140, 9668 },
+    { 186, 215, 9681 },
+    { 64, 82, 9695 },
+    { 164, 197, 9696 },
+    { 212, 224, 9698 },
+    { 132, 172, 9704 },
+    { 191, 211, 9709 },
+    { 238, 250, 9712 },
+    { 11, 255, 9720 },
+    { 163, 173, 9724 },
+    { 150, 151, 9725 },
+    { 66, 82, 9728 },
+    { 189, 200, 9730 },
+    { 6, 16, 9743 },
+    { 31, 42, 9755 },
+    { 107, 119, 9757 },
+    { 166, 178, 9762 },
+    { 137, 150, 9767 },
+    { 96, 106, 9769 },
+    { 235, 248, 9772 },
+    { 104, 127, 9777 },
+    { 148, 160, 9784 },
+    { 147, 167, 9790 },
+    { 71, 79, 9799 },
+    { 57, 74, 9806 },
+    { 142, 145, 9810 },
+    { 32, 65, 9812 },
+    { 232, 241, 9816 },
+    { 173, 191, 9817 },
+    { 245, 251, 9819 },
+    { 11, 25, 9821 },
+    { 47, 52, 9827 },
+    { 150, 169, 9827 },
+    { 165, 225, 9829 },
+    { 5, 14, 9830 },
+    { 167, 192, 9830 },
+    { 227, 230, 9834 },
+    { 199, 225, 9840 },
+    { 166, 182, 9845 },
+    { 182, 211, 9846 },
+    { 17, 23, 9853 },
+    { 139, 161, 9854 },
+    { 186, 213, 9854 },
+    { 207, 219, 9862 },
+    { 167, 186, 9864 },
+    { 25, 39, 9866 },
+    { 84, 87, 9866 },
+    { 68, 78, 9871 },
+    { 27, 33, 9875 },
+    { 139, 160, 9879 },
+    { 71, 102, 9881 },
+    { 163, 183, 9883 },
+    { 198, 208, 9883 },
+    { 162, 167, 9885 },
+    { 189, 202, 9892 },
+    { 180, 205, 9902 },
+    { 166, 174, 9905 },
+    { 246, 252, 9905 },
+    { 94, 125, 9913 },
+    { 78, 90, 9914 },
+    { 118, 135, 9924 },
+    { 205, 219, 9925 },
+    { 185, 201, 9926 },
+    { 202, 221, 9926 },
+    { 50, 56, 9927 },
+    { 112, 140, 9935 },
+    { 123, 136, 9937 },
+    { 84, 97, 9944 },
+    { 1, 240, 9969 },
+    { 88, 112, 9971 },
+    { 167, 173, 9977 },
+    { 3, 248, 9982 },
+    { 143, 172, 9985 },
+    { 130, 149, 9986 },
+    { 6, 247, 9991 },
+    { 54, 76, 9997 },
+    { 130, 155, 10002 },
+    { 166, 180, 10003 },
+    { 61, 80, 10004 },
+    { 214, 222, 10006 },
+    { 12, 32, 10008 },
+    { 111, 121, 10008 },
+    { 67, 74, 10025 },
+    { 114, 134, 10027 },
+    { 125, 146, 10029 },
+    { 110, 133, 10032 },
+    { 180, 208, 10032 },
+    { 77, 86, 10033 },
+    { 27, 71, 10036 },
+    { 129, 172, 10040 },
+    { 117, 156, 10044 },
+    { 170, 189, 10050 },
+    { 45, 61, 10061 },
+    { 147, 161, 10061 },
+    { 29, 46, 10066 },
+    { 161, 173, 10071 },
+    { 183, 210, 10079 },
+    { 66, 80, 10081 },
+    { 187, 213, 10081 },
+    { 18, 25, 10089 },
+    { 129, 130, 10091 },
+    { 60, 80, 10094 },
+    { 51, 69, 10097 },
+    { 36, 61, 10098 },
+    { 78, 82, 10099 },
+    { 0, 254, 10100 },
+    { 26, 36, 10100 },
+    { 74, 79, 10101 },
+    { 140, 151, 10104 },
+    { 54, 65, 10116 },
+    { 134, 168, 10116 },
+    { 52, 63, 10136 },
+    { 217, 233, 10142 },
+    { 57, 79, 10148 },
+    { 92, 112, 10166 },
+    { 242, 254, 10180 },
+    { 62, 83, 10188 },
+    { 202, 219, 10194 },
+    { 5, 16, 10197 },
+    { 210, 224, 10197 },
+    { 45, 66, 10203 },
+    { 204, 216, 10203 },
+    { 169, 171, 10209 },
+    { 210, 218, 10217 },
+    { 130, 153, 10222 },
+    { 130, 154, 10223 },
+    { 200, 221, 10225 },
+    { 201, 211, 10237 },
+    { 46, 66, 10238 },
+    { 47, 48, 10240 },
+    { 178, 192, 10242 },
+    { 38, 44, 10250 },
+    { 191, 216, 10275 },
+    { 79, 85, 10282 },
+    { 207, 223, 10283 },
+    { 231, 241, 10291 },
+    { 183, 188, 10292 },
+    { 74, 84, 10295 },
+    { 54, 75, 10297 },
+    { 57, 77, 10304 },
+    { 70, 82, 10306 },
+    { 2, 253, 10309 },
+    { 93, 105, 10314 },
+    { 118, 131, 10322 },
+    { 1, 239, 10324 },
+    { 111, 124, 10326 },
+    { 6, 22, 10327 },
+    { 225, 255, 10330 },
+    { 166, 192, 10333 },
+    { 101, 115, 10335 },
+    { 162, 182, 10337 },
+    { 133, 155, 10346 },
+    { 210, 213, 10350 },
+    { 69, 85, 10351 },
+    { 65, 89, 10353 },
+    { 210, 211, 10355 },
+    { 146, 148, 10358 },
+    { 41, 62, 10367 },
+    { 121, 139, 10370 },
+    { 197, 212, 10381 },
+    { 232, 243, 10382 },
+    { 114, 136, 10387 },
+    { 33, 72, 10393 },
+    { 45, 70, 10400 },
+    { 247, 255, 10407 },
+    { 189, 208, 10409 },
+    { 135, 145, 10416 },
+    { 175, 187, 10419 },
+    { 5, 17, 10423 },
+    { 54, 74, 10428 },
+    { 148, 166, 10429 },
+    { 8, 247, 10431 },
+    { 90, 103, 10438 },
+    { 71, 99, 10445 },
+    { 205, 223, 10448 },
+    { 102, 127, 10451 },
+    { 126, 135, 10452 },
+    { 18, 22, 10456 },
+    { 177, 178, 10456 },
+    { 71, 97, 10457 },
+    { 54, 72, 10459 },
+    { 140, 165, 10466 },
+    { 130, 152, 10467 },
+    { 5, 253, 10471 },
+    { 3, 12, 10488 },
+    { 64, 78, 10489 },
+    { 200, 219, 10490 },
+    { 104, 110, 10495 },
+    { 160, 173, 10495 },
+    { 8, 16, 10505 },
+    { 12, 27, 10512 },
+    { 196, 219, 10514 },
+    { 156, 167, 10517 },
+    { 15, 33, 10522 },
+    { 128, 148, 10531 },
+    { 140, 158, 10539 },
+    { 243, 252, 10541 },
+    { 24, 37, 10551 },
+    { 158, 225, 10554 },
+    { 102, 133, 10556 },
+    { 44, 63, 10558 },
+    { 39, 53, 10572 },
+    { 61, 82, 10572 },
+    { 235, 249, 10577 },
+    { 204, 218, 10588 },
+    { 154, 166, 10589 },
+    { 153, 166, 10591 },
+    { 107, 113, 10593 },
+    { 65, 84, 10595 },
+    { 9, 20, 10598 },
+    { 58, 68, 10603 },
+    { 210, 219, 10607 },
+    { 180, 207, 10616 },
+    { 100, 119, 10617 },
+    { 156, 198, 10621 },
+    { 29, 43, 10630 },
+    { 132, 185, 10630 },
+    { 121, 141, 10632 },
+    { 63, 83, 10636 },
+    { 117, 153, 10636 },
+    { 117, 154, 10639 },
+    { 62, 72, 10643 },
+    { 243, 244, 10646 },
+    { 245, 254, 10646 },
+    { 41, 57, 10660 },
+    { 143, 166, 10664 },
+    { 12, 20, 10671 },
+    { 45, 64, 10673 },
+    { 141, 159, 10686 },
+    { 82, 96, 10689 },
+    { 98, 111, 10690 },
+    { 13, 16, 10692 },
+    { 34, 58, 10695 },
+    { 194, 206, 10697 },
+    { 154, 170, 10707 },
+    { 153, 170, 10710 },
+    { 22, 37, 10713 },
+    { 30, 46, 10719 },
+    { 129, 185, 10732 },
+    { 16, 30, 10735 },
+    { 134, 158, 10735 },
+    { 191, 213, 10741 },
+    { 48, 53, 10743 },
+    { 198, 212, 10744 },
+    { 204, 221, 10744 },
+    { 223, 232, 10746 },
+    { 6, 10, 10747 },
+    { 171, 183, 10748 },
+    { 99, 122, 10754 },
+    { 145, 151, 10756 },
+    { 180, 211, 10762 },
+    { 18, 26, 10776 },
+    { 91, 101, 10782 },
+    { 69, 76, 10787 },
+    { 180, 204, 10787 },
+    { 14, 16, 10805 },
+    { 48, 63, 10805 },
+    { 238, 242, 10808 },
+    { 71, 104, 10809 },
+    { 214, 224, 10812 },
+    { 79, 97, 10815 },
+    { 20, 33, 10820 },
+    { 154, 198, 10825 },
+    { 153, 198, 10826 },
+    { 55, 69, 10828 },
+    { 17, 24, 10832 },
+    { 106, 107, 10832 },
+    { 191, 214, 10833 },
+    { 195, 220, 10833 },
+    { 127, 164, 10850 },
+    { 72, 73, 10852 },
+    { 13, 26, 10858 },
+    { 36, 64, 10860 },
+    { 178, 205, 10860 },
+    { 186, 189, 10873 },
+    { 6, 255, 10875 },
+    { 59, 68, 10876 },
+    { 225, 247, 10877 },
+    { 56, 62, 10881 },
+    { 34, 48, 10883 },
+    { 202, 223, 10883 },
+    { 155, 164, 10895 },
+    { 156, 197, 10895 },
+    { 55, 70, 10915 },
+    { 161, 187, 10918 },
+    { 148, 155, 10927 },
+    { 4, 252, 10929 },
+    { 160, 172, 10937 },
+    { 94, 122, 10939 },
+    { 191, 206, 10941 },
+    { 106, 118, 10949 },
+    { 177, 180, 10950 },
+    { 49, 74, 10954 },
+    { 173, 177, 10961 },
+    { 122, 164, 10971 },
+    { 222, 231, 10977 },
+    { 156, 160, 10978 },
+    { 76, 93, 10980 },
+    { 176, 178, 10980 },
+    { 127, 155, 10984 },
+    { 209, 220, 10984 },
+    { 18, 30, 10985 },
+    { 18, 29, 10988 },
+    { 134, 165, 10990 },
+    { 167, 182, 10994 },
+    { 191, 202, 10995 },
+    { 228, 239, 10996 },
+    { 160, 187, 10998 },
+    { 127, 139, 10999 },
+    { 78, 91, 11006 },
+    { 35, 56, 11008 },
+    { 128, 131, 11009 },
+    { 108, 130, 11012 },
+    { 86, 102, 11016 },
+    { 47, 73, 11018 },
+    { 191, 200, 11019 },
+    { 170, 201, 11020 },
+    { 178, 208, 11023 },
+    { 203, 222, 11025 },
+    { 109, 130, 11029 },
+    { 93, 108, 11030 },
+    { 154, 197, 11031 },
+    { 153, 197, 11032 },
+    { 166, 189, 11035 },
+    { 186, 197, 11044 },
+    { 201, 213, 11045 },
+    { 41, 69, 11052 },
+    { 133, 172, 11053 },
+    { 70, 80, 11054 },
+    { 47, 74, 11056 },
+    { 38, 55, 11077 },
+    { 84, 99, 11087 },
+    { 52, 70, 11094 },
+    { 92, 113, 11094 },
+    { 24, 39, 11095 },
+    { 142, 150, 11096 },
+    { 167, 197, 11096 },
+    { 194, 217, 11102 },
+    { 99, 125, 11108 },
+    { 206, 222, 11115 },
+    { 163, 178, 11122 },
+    { 72, 77, 11129 },
+    { 45, 46, 11130 },
+    { 46, 58, 11134 },
+    { 227, 236, 11143 },
+    { 50, 68, 11154 },
+    { 170, 175, 11157 },
+    { 93, 102, 11160 },
+    { 167, 201, 11162 },
+    { 151, 168, 11166 },
+    { 52, 53, 11174 },
+    { 22, 43, 11175 },
+    { 23, 37, 11180 },
+    { 80, 96, 11180 },
+    { 40, 63, 11181 },
+    { 200, 223, 11182 },
+    { 220, 237, 11189 },
+    { 21, 31, 11192 },
+    { 34, 44, 11194 },
+    { 101, 116, 11195 },
+    { 183, 206, 11197 },
+    { 227, 238, 11199 },
+    { 90, 101, 11209 },
+    { 193, 195, 11210 },
+    { 173, 200, 11215 },
+    { 61, 78, 11219 },
+    { 60, 66, 11221 },
+    { 38, 52, 11225 },
+    { 48, 70, 11227 },
+    { 167, 178, 11227 },
+    { 167, 198, 11228 },
+    { 170, 172, 11228 },
+    { 72, 95, 11238 },
+    { 84, 95, 11241 },
+    { 95, 122, 11248 },
+    { 121, 131, 11257 },
+    { 168, 209, 11262 },
+    { 155, 162, 11268 },
+    { 28, 46, 11272 },
+    { 57, 69, 11273 },
+    { 126, 142, 11275 },
+    { 184, 188, 11275 },
+    { 184, 199, 11277 },
+    { 226, 232, 11284 },
+    { 63, 76, 11286 },
+    { 149, 159, 11287 },
+    { 130, 156, 11288 },
+    { 155, 189, 11288 },
+    { 214, 216, 11290 },
+    { 49, 73, 11293 },
+    { 132, 146, 11298 },
+    { 19, 225, 11299 },
+    { 59, 80, 11303 },
+    { 95, 125, 11305 },
+    { 170, 200, 11307 },
+    { 170, 204, 11309 },
+    { 169, 194, 11316 },
+    { 62, 65, 11321 },
+    { 117, 164, 11321 },
+    { 92, 114, 11323 },
+    { 123, 158, 11326 },
+    { 167, 180, 11326 },
+    { 54, 77, 11329 },
+    { 59, 61, 11330 },
+    { 8, 240, 11339 },
+    { 184, 203, 11344 },
+    { 187, 191, 11346 },
+    { 173, 192, 11353 },
+    { 31, 47, 11355 },
+    { 173, 176, 11363 },
+    { 80, 92, 11370 },
+    { 54, 69, 11371 },
+    { 28, 35, 11372 },
+    { 41, 45, 11378 },
+    { 138, 159, 11383 },
+    { 228, 238, 11389 },
+    { 21, 28, 11394 },
+    { 58, 78, 11397 },
+    { 85, 93, 11397 },
+    { 196, 221, 11399 },
+    { 125, 172, 11403 },
+    { 241, 251, 11405 },
+    { 67, 87, 11407 },
+    { 30, 59, 11414 },
+    { 161, 172, 11414 },
+    { 83, 86, 11417 },
+    { 152, 156, 11419 },
+    { 81, 82, 11422 },
+    { 143, 170, 11422 },
+    { 137, 141, 11424 },
+    { 166, 175, 11433 },
+    { 56, 74, 11434 },
+    { 173, 202, 11440 },
+    { 87, 110, 11443 },
+    { 86, 105, 11445 },
+    { 186, 198, 11446 },
+    { 138, 142, 11449 },
+    { 186, 216, 11455 },
+    { 17, 28, 11463 },
+    { 87, 117, 11463 },
+    { 225, 228, 11464 },
+    { 79, 95, 11466 },
+    { 73, 86, 11469 },
+    { 59, 64, 11470 },
+    { 24, 36, 11476 },
+    { 98, 103, 11491 },
+    { 109, 147, 11493 },
+    { 182, 213, 11493 },
+    { 52, 69, 11494 },
+    { 156, 161, 11496 },
+    { 34, 40, 11497 },
+    { 38, 48, 11499 },
+    { 147, 189, 11502 },
+    { 170, 197, 11503 },
+    { 182, 212, 11503 },
+    { 176, 180, 11511 },
+    { 172, 192, 11513 },
+    { 85, 86, 11518 },
+    { 204, 219, 11518 },
+    { 234, 249, 11520 },
+    { 161, 186, 11522 },
+    { 191, 208, 11522 },
+    { 3, 32, 11523 },
+    { 146, 172, 11523 },
+    { 95, 129, 11525 },
+    { 160, 189, 11525 },
+    { 147, 166, 11533 },
+    { 199, 228, 11541 },
+    { 76, 89, 11544 },
+    { 219, 232, 11544 },
+    { 53, 55, 11549 },
+    { 89, 117, 11552 },
+    { 10, 23, 11553 },
+    { 72, 97, 11555 },
+    { 126, 139, 11555 },
+    { 15, 20, 11556 },
+    { 55, 66, 11556 },
+    { 159, 178, 11558 },
+    { 102, 120, 11559 },
+    { 203, 210, 11561 },
+    { 120, 153, 11563 },
+    { 124, 135, 11563 },
+    { 96, 114, 11564 },
+    { 120, 154, 11564 },
+    { 34, 52, 11565 },
+    { 178, 207, 11568 },
+    { 54, 79, 11577 },
+    { 94, 110, 11583 },
+    { 31, 49, 11591 },
+    { 33, 67, 11591 },
+    { 177, 206, 11597 },
+    { 170, 202, 11607 },
+    { 23, 36, 11608 },
+    { 244, 248, 11613 },
+    { 8, 25, 11615 },
+    { 23, 39, 11615 },
+    { 52, 66, 11620 },
+    { 62, 84, 11623 },
+    { 48, 66, 11633 },
+    { 11, 26, 11642 },
+    { 161, 174, 11647 },
+    { 35, 46, 11648 },
+    { 148, 170, 11654 },
+    { 166, 172, 11660 },
+    { 113, 158, 11661 },
+    { 178, 204, 11671 },
+    { 160, 186, 11683 },
+    { 22, 29, 11684 },
+    { 33, 57, 11684 },
+    { 167, 174, 11689 },
+    { 189, 212, 11693 },
+    { 220, 236, 11703 },
+    { 170, 198, 11707 },
+    { 152, 173, 11717 },
+    { 190, 240, 11721 },
+    { 14, 21, 11724 },
+    { 99, 129, 11725 },
+    { 176, 193, 11730 },
+    { 197, 215, 11730 },
+    { 67, 83, 11735 },
+    { 104, 120, 11737 },
+    { 17, 21, 11750 },
+    { 97, 122, 11752 },
+    { 169, 195, 11752 },
+    { 67, 89, 11761 },
+    { 221, 232, 11761 },
+    { 131, 138, 11763 },
+    { 178, 211, 11768 },
+    { 26, 59, 11771 },
+    { 14, 23, 11778 },
+    { 27, 94, 11779 },
+    { 79, 99, 11781 },
+    { 133, 139, 11790 },
+    { 171, 193, 11792 },
+    { 47, 75, 11793 },
+    { 39, 61, 11799 },
+    { 161, 178, 11800 },
+    { 192, 216, 11800 },
+    { 208, 224, 11802 },
+    { 105, 130, 11807 },
+    { 196, 223, 11808 },
+    { 148, 167, 11817 },
+    { 99, 120, 11819 },
+    { 177, 193, 11823 },
+    { 78, 80, 11831 },
+    { 136, 145, 11831 },
+    { 107, 115, 11832 },
+    { 42, 69, 11837 },
+    { 24, 43, 11842 },
+    { 4, 15, 11846 },
+    { 26, 28, 11850 },
+    { 86, 94, 11850 },
+    { 161, 189, 11850 },
+    { 49, 75, 11853 },
+    { 22, 39, 11859 },
+    { 204, 223, 11859 },
+    { 10, 24, 11862 },
+    { 128, 149, 11872 },
+    { 176, 206, 11873 },
+    { 44, 53, 11880 },
+    { 28, 39, 11881 },
+    { 147, 170, 11884 },
+    { 114, 140, 11887 },
+    { 139, 166, 11888 },
+    { 110, 132, 11894 },
+    { 110, 129, 11897 },
+    { 146, 164, 11899 },
+    { 107, 123, 11908 },
+    { 18, 28, 11914 },
+    { 217, 236, 11924 },
+    { 30, 60, 11927 },
+    { 37, 53, 11930 },
+    { 182, 215, 11930 },
+    { 35, 41, 11931 },
+    { 233, 239, 11936 },
+    { 33, 54, 11938 },
+    { 25, 36, 11945 },
+    { 123, 165, 11945 },
+    { 177, 182, 11945 },
+    { 100, 123, 11949 },
+    { 124, 139, 11954 },
+    { 129, 146, 11954 },
+    { 187, 216, 11954 },
+    { 193, 214, 11955 },
+    { 183, 186, 11956 },
+    { 95, 132, 11958 },
+    { 68, 81, 11963 },
+    { 159, 176, 11970 },
+    { 60, 82, 11978 },
+    { 32, 72, 11989 },
+    { 114, 115, 11996 },
+    { 164, 167, 11997 },
+    { 210, 223, 11998 },
+    { 94, 133, 12002 },
+    { 99, 127, 12002 },
+    { 147, 149, 12004 },
+    { 194, 220, 12006 },
+    { 161, 182, 12010 },
+    { 2, 10, 12014 },
+    { 138, 162, 12014 },
+    { 134, 151, 12016 },
+    { 111, 126, 12017 },
+    { 34, 61, 12022 },
+    { 148, 163, 12023 },
+    { 140, 179, 12034 },
+    { 31, 44, 12041 },
+    { 133, 152, 12043 },
+    { 165, 199, 12058 },
+    { 38, 69, 12063 },
+    { 182, 201, 12070 },
+    { 71, 105, 12072 },
+    { 75, 86, 12076 },
+    { 167, 204, 12081 },
+    { 163, 180, 12085 },
+    { 31, 35, 12087 },
+    { 46, 70, 12088 },
+    { 198, 215, 12089 },
+    { 160, 174, 12091 },
+    { 188, 214, 12091 },
+    { 99, 132, 12092 },
+    { 16, 29, 12094 },
+    { 160, 192, 12096 },
+    { 152, 172, 12105 },
+    { 184, 209, 12109 },
+    { 12, 33, 12110 },
+    { 161, 180, 12110 },
+    { 53, 59, 12114 },
+    { 238, 253, 12117 },
+    { 45, 49, 12122 },
+    { 130, 160, 12127 },
+    { 72, 99, 12129 },
+    { 159, 177, 12138 },
+    { 234, 244, 12147 },
+    { 139, 167, 12153 },
+    { 161, 192, 12155 },
+    { 170, 205, 12155 },
+    { 142, 159, 12159 },
+    { 9, 249, 12164 },
+    { 160, 178, 12167 },
+    { 191, 205, 12172 },
+    { 72, 93, 12175 },
+    { 174, 200, 12181 },
+    { 120, 156, 12186 },
+    { 48, 69, 12187 },
+    { 122, 155, 12192 },
+    { 198, 234, 12193 },
+    { 125, 155, 12194 },
+    { 1, 16, 12199 },
+    { 34, 55, 12213 },
+    { 97, 125, 12217 },
+    { 224, 226, 12222 },
+    { 11, 247, 12227 },
+    { 44, 69, 12229 },
+    { 62, 85, 12235 },
+    { 54, 56, 12238 },
+    { 72, 75, 12239 },
+    { 122, 139, 12241 },
+    { 145, 169, 12243 },
+    { 188, 210, 12245 },
+    { 166, 201, 12251 },
+    { 94, 127, 12252 },
+    { 1, 22, 12254 },
+    { 181, 206, 12266 },
+    { 242, 250, 12266 },
+    { 6, 240, 12277 },
+    { 126, 148, 12284 },
+    { 83, 93, 12285 },
+    { 65, 73, 12286 },
+    { 157, 181, 12286 },
+    { 184, 217, 12288 },
+    { 4, 7, 12298 },
+    { 82, 92, 12303 },
+    { 65, 95, 12304 },
+    { 36, 68, 12305 },
+    { 160, 182, 12306 },
+    { 220, 229, 12308 },
+    { 103, 118, 12313 },
+    { 162, 186, 12314 },
+    { 109, 143, 12321 },
+    { 139, 147, 12322 },
+    { 123, 168, 12325 },
+    { 109, 156, 12327 },
+    { 195, 203, 12328 },
+    { 39, 64, 12330 },
+    { 86, 108, 12340 },
+    { 85, 98, 12347 },
+    { 197, 234, 12349 },
+    { 127, 152, 12362 },
+    { 2, 14, 12363 },
+    { 164, 201, 12364 },
+    { 71, 84, 12367 },
+    { 10, 11, 12375 },
+    { 76, 87, 12377 },
+    { 174, 202, 12379 },
+    { 180, 213, 12387 },
+    { 214, 219, 12388 },
+    { 138, 152, 12392 },
+    { 4, 246, 12394 },
+    { 214, 218, 12394 },
+    { 91, 106, 12402 },
+    { 144, 179, 12403 },
+    { 230, 232, 12404 },
+    { 191, 218, 12407 },
+    { 104, 147, 12408 },
+    { 104, 156, 12408 },
+    { 130, 161, 12412 },
+    { 139, 162, 12416 },
+    { 36, 50, 12417 },
+    { 144, 157, 12421 },
+    { 19, 190, 12430 },
+    { 93, 109, 12435 },
+    { 96, 103, 12437 },
+    { 226, 227, 12438 },
+    { 144, 165, 12441 },
+    { 11, 24, 12443 },
+    { 160, 180, 12445 },
+    { 117, 146, 12448 },
+    { 233, 247, 12451 },
+    { 30, 34, 12456 },
+    { 28, 37, 12461 },
+    { 237, 250, 12466 },
+    { 20, 32, 12467 },
+    { 192, 218, 12468 },
+    { 196, 201, 12475 },
+    { 191, 215, 12479 },
+    { 156, 166, 12480 },
+    { 156, 170, 12484 },
+    { 108, 147, 12485 },
+    { 5, 250, 12492 },
+    { 210, 221, 12495 },
+    { 170, 207, 12496 },
+    { 157, 171, 12499 },
+    { 6, 25, 12506 },
+    { 149, 154, 12511 },
+    { 149, 153, 12513 },
+    { 150, 171, 12518 },
+    { 17, 29, 12526 },
+    { 176, 182, 12526 },
+    { 97, 120, 12534 },
+    { 196, 224, 12534 },
+    { 77, 93, 12536 },
+    { 48, 61, 12541 },
+    { 214, 229, 12543 },
+    { 167, 200, 12545 },
+    { 95, 127, 12546 },
+    { 120, 155, 12546 },
+    { 210, 226, 12548 },
+    { 23, 43, 12552 },
+    { 182, 216, 12554 },
+    { 135, 150, 12567 },
+    { 159, 180, 12569 },
+    { 180, 212, 12569 },
+    { 148, 173, 12572 },
+    { 13, 24, 12573 },
+    { 31, 51, 12576 },
+    { 166, 197, 12576 },
+    { 172, 204, 12581 },
+    { 224, 231, 12586 },
+    { 104, 164, 12588 },
+    { 8, 10, 12591 },
+    { 8, 239, 12593 },
+    { 225, 236, 12601 },
+    { 138, 146, 12604 },
+    { 214, 230, 12604 },
+    { 63, 85, 12607 },
+    { 43, 53, 12611 },
+    { 44, 70, 12611 },
+    { 166, 200, 12614 },
+    { 173, 205, 12616 },
+    { 71, 76, 12625 },
+    { 221, 235, 12627 },
+    { 166, 204, 12631 },
+    { 64, 81, 12638 },
+    { 210, 215, 12638 },
+    { 13, 240, 12643 },
+    { 188, 191, 12648 },
+    { 199, 220, 12650 },
+    { 99, 133, 12654 },
+    { 127, 172, 12661 },
+    { 218, 232, 12664 },
+    { 132, 155, 12665 },
+    { 56, 75, 12682 },
+    { 244, 251, 12692 },
+    { 12, 248, 12694 },
+    { 0, 14, 12699 },
+    { 72, 94, 12700 },
+    { 136, 157, 12700 },
+    { 155, 187, 12701 },
+    { 174, 192, 12709 },
+    { 177, 196, 12710 },
+    { 29, 53, 12718 },
+    { 63, 67, 12720 },
+    { 11, 240, 12724 },
+    { 56, 73, 12730 },
+    { 231, 242, 12734 },
+    { 14, 24, 12737 },
+    { 177, 210, 12738 },
+    { 159, 166, 12739 },
+    { 176, 181, 12741 },
+    { 95, 120, 12743 },
+    { 206, 226, 12744 },
+    { 166, 198, 12754 },
+    { 52, 61, 12756 },
+    { 175, 200, 12756 },
+    { 1, 10, 12763 },
+    { 120, 149, 12767 },
+    { 28, 53, 12776 },
+    { 6, 239, 12782 },
+    { 112, 144, 12782 },
+    { 139, 141, 12786 },
+    { 2, 250, 12792 },
+    { 51, 70, 12794 },
+    { 34, 39, 12795 },
+    { 128, 130, 12801 },
+    { 13, 19, 12802 },
+    { 71, 108, 12803 },
+    { 111, 128, 12814 },
+    { 65, 94, 12825 },
+    { 71, 109, 12826 },
+    { 88, 107, 12833 },
+    { 157, 184, 12835 },
+    { 228, 247, 12836 },
+    { 5, 6, 12839 },
+    { 167, 202, 12841 },
+    { 160, 164, 12842 },
+    { 177, 203, 12845 },
+    { 113, 165, 12848 },
+    { 69, 81, 12851 },
+    { 217, 222, 12851 },
+    { 113, 144, 12854 },
+    { 35, 61, 12855 },
+    { 191, 207, 12856 },
+    { 192, 221, 12856 },
+    { 144, 158, 12872 },
+    { 124, 142, 12878 },
+    { 136, 150, 12889 },
+    { 158, 255, 12893 },
+    { 176, 203, 12893 },
+    { 186, 218, 12895 },
+    { 191, 212, 12895 },
+    { 39, 68, 12909 },
+    { 133, 160, 12910 },
+    { 41, 58, 12911 },
+    { 97, 129, 12911 },
+    { 55, 61, 12913 },
+    { 166, 202, 12913 },
+    { 49, 58, 12915 },
+    { 108, 143, 12917 },
+    { 146, 162, 12926 },
+    { 175, 202, 12926 },
+    { 125, 185, 12932 },
+    { 65, 77, 12940 },
+    { 34, 64, 12944 },
+    { 180, 215, 12944 },
+    { 86, 110, 12948 },
+    { 168, 225, 12951 },
+    { 207, 224, 12951 },
+    { 173, 208, 12959 },
+    { 65, 97, 12963 },
+    { 97, 127, 12969 },
+    { 236, 240, 12969 },
+    { 149, 173, 12977 },
+    { 205, 224, 12981 },
+    { 58, 81, 12982 },
+    { 48, 64, 12984 },
+    { 179, 195, 12984 },
+    { 185, 192, 12984 },
+    { 92, 101, 12986 },
+    { 15, 248, 12999 },
+    { 242, 243, 13006 },
+    { 95, 133, 13018 },
+    { 82, 90, 13027 },
+    { 147, 198, 13029 },
+    { 159, 171, 13032 },
+    { 44, 66, 13042 },
+    { 37, 61, 13043 },
+    { 242, 253, 13049 },
+    { 56, 57, 13055 },
+    { 162, 187, 13055 },
+    { 189, 215, 13055 },
+    { 155, 173, 13056 },
+    { 197, 211, 13057 },
+    { 112, 136, 13058 },
+    { 21, 34, 13060 },
+    { 7, 251, 13062 },
+    { 159, 161, 13062 },
+    { 127, 149, 13069 },
+    { 122, 172, 13071 },
+    { 25, 28, 13075 },
+    { 148, 174, 13077 },
+    { 169, 188, 13090 },
+    { 154, 201, 13101 },
+    { 153, 201, 13103 },
+    { 173, 204, 13103 },
+    { 152, 187, 13110 },
+    { 11, 18, 13111 },
+    { 0, 18, 13118 },
+    { 14, 28, 13118 },
+    { 35, 36, 13129 },
+    { 58, 63, 13129 },
+    { 38, 73, 13134 },
+    { 190, 239, 13134 },
+    { 187, 218, 13135 },
+    { 29, 60, 13139 },
+    { 155, 197, 13141 },
+    { 170, 208, 13145 },
+    { 43, 61, 13147 },
+    { 93, 94, 13147 },
+    { 90, 106, 13151 },
+    { 201, 221, 13152 },
+    { 6, 18, 13153 },
+    { 52, 64, 13155 },
+    { 109, 164, 13155 },
+    { 196, 214, 13157 },
+    { 155, 198, 13160 },
+    { 217, 237, 13160 },
+    { 152, 159, 13162 },
+    { 202, 224, 13162 },
+    { 161, 175, 13166 },
+    { 180, 201, 13171 },
+    { 177, 181, 13172 },
+    { 152, 174, 13175 },
+    { 57, 84, 13177 },
+    { 51, 62, 13181 },
+    { 60, 70, 13182 },
+    { 201, 234, 13183 },
+    { 139, 170, 13185 },
+    { 169, 193, 13185 },
+    { 67, 85, 13194 },
+    { 133, 185, 13195 },
+    { 4, 248, 13198 },
+    { 159, 183, 13203 },
+    { 25, 59, 13205 },
+    { 223, 235, 13209 },
+    { 167, 175, 13210 },
+    { 167, 205, 13213 },
+    { 163, 182, 13215 },
+    { 185, 234, 13216 },
+    { 109, 153, 13220 },
+    { 120, 152, 13220 },
+    { 109, 154, 13222 },
+    { 11, 23, 13226 },
+    { 155, 192, 13235 },
+    { 147, 197, 13239 },
+    { 143, 185, 13242 },
+    { 34, 42, 13247 },
+    { 162, 183, 13253 },
+    { 42, 54, 13255 },
+    { 160, 197, 13255 },
+    { 40, 69, 13260 },
+    { 67, 69, 13265 },
+    { 55, 64, 13267 },
+    { 97, 132, 13271 },
+    { 193, 210, 13275 },
+    { 133, 149, 13283 },
+    { 165, 209, 13283 },
+    { 173, 207, 13284 },
+    { 156, 201, 13285 },
+    { 191, 219, 13296 },
+    { 45, 68, 13304 },
+    { 180, 216, 13309 },
+    { 129, 155, 13311 },
+    { 116, 137, 13315 },
+    { 183, 193, 13316 },
+    { 27, 104, 13317 },
+    { 121, 148, 13332 },
+    { 220, 230, 13334 },
+    { 176, 210, 13338 },
+    { 80, 81, 13342 },
+    { 167, 185, 13346 },
+    { 155, 185, 13348 },
+    { 5, 254, 13350 },
+    { 133, 161, 13351 },
+    { 161, 164, 13352 },
+    { 56, 70, 13353 },
+    { 41, 50, 13355 },
+    { 160, 198, 13358 },
+    { 47, 67, 13362 },
+    { 27, 65, 13365 },
+    { 61, 81, 13365 },
+    { 106, 114, 13366 },
+    { 0, 16, 13368 },
+    { 42, 62, 13371 },
+    { 171, 175, 13371 },
+    { 65, 99, 13372 },
+    { 105, 147, 13376 },
+    { 31, 48, 13378 },
+    { 201, 216, 13379 },
+    { 131, 145, 13383 },
+    { 13, 247, 13386 },
+    { 86, 109, 13387 },
+    { 178, 213, 13388 },
+    { 152, 189, 13389 },
+    { 172, 187, 13391 },
+    { 185, 204, 13393 },
+    { 7, 252, 13394 },
+    { 176, 196, 13404 },
+    { 229, 232, 13407 },
+    { 34, 51, 13409 },
+    { 165, 240, 13412 },
+    { 130, 138, 13413 },
+    { 72, 102, 13417 },
+    { 193, 222, 13421 },
+    { 158, 240, 13425 },
+    { 110, 143, 13426 },
+    { 101, 114, 13429 },
+    { 182, 210, 13430 },
+    { 10, 22, 13437 },
+    { 8, 26, 13441 },
+    { 159, 170, 13441 },
+    { 141, 149, 13446 },
+    { 72, 74, 13451 },
+    { 201, 218, 13452 },
+    { 167, 207, 13453 },
+    { 41, 74, 13454 },
+    { 160, 201, 13454 },
+    { 198, 211, 13454 },
+    { 200, 224, 13454 },
+    { 21, 35, 13456 },
+    { 192, 219, 13462 },
+    { 142, 163, 13464 },
+    { 213, 214, 13466 },
+    { 180, 210, 13474 },
+    { 35, 49, 13475 },
+    { 183, 214, 13475 },
+    { 166, 205, 13478 },
+    { 59, 82, 13480 },
+    { 127, 160, 13485 },
+    { 13, 23, 13487 },
+    { 74, 86, 13493 },
+    { 119, 158, 13493 },
+    { 134, 179, 13508 },
+    { 38, 74, 13513 },
+    { 51, 53, 13529 },
+    { 43, 64, 13531 },
+    { 214, 223, 13531 },
+    { 26, 60, 13532 },
+    { 121, 130, 13532 },
+    { 37, 64, 13535 },
+    { 114, 144, 13536 },
+    { 69, 78, 13537 },
+    { 229, 237, 13543 },
+    { 67, 93, 13547 },
+    { 128, 142, 13547 },
+    { 58, 69, 13551 },
+    { 159, 182, 13553 },
+    { 161, 197, 13553 },
+    { 59, 88, 13554 },
+    { 51, 66, 13555 },
+    { 165, 255, 13555 },
+    { 124, 148, 13559 },
+    { 45, 47, 13560 },
+    { 31, 56, 13565 },
+    { 108, 156, 13565 },
+    { 152, 164, 13567 },
+    { 0, 17, 13570 },
+    { 159, 160, 13571 },
+    { 178, 212, 13576 },
+    { 151, 184, 13581 },
+    { 135, 138, 13585 },
+    { 139, 154, 13586 },
+    { 139, 153, 13587 },
+    { 142, 148, 13588 },
+    { 62, 86, 13592 },
+    { 43, 68, 13602 },
+    { 86, 104, 13603 },
+    { 183, 203, 13607 },
+    { 162, 177, 13611 },
+    { 158, 199, 13613 },
+    { 174, 205, 13613 },
+    { 40, 53, 13614 },
+    { 160, 175, 13614 },
+    { 31, 52, 13616 },
+    { 143, 148, 13616 },
+    { 19, 239, 13637 },
+    { 35, 64, 13643 },
+    { 128, 135, 13644 },
+    { 155, 186, 13646 },
+    { 175, 192, 13646 },
+    { 152, 178, 13647 },
+    { 161, 201, 13652 },
+    { 210, 212, 13657 },
+    { 141, 162, 13658 },
+    { 122, 152, 13659 },
+    { 161, 198, 13670 },
+    { 208, 210, 13674 },
+    { 209, 233, 13682 },
+    { 82, 101, 13683 },
+    { 104, 130, 13683 },
+    { 152, 186, 13696 },
+    { 136, 137, 13697 },
+    { 97, 133, 13700 },
+    { 162, 176, 13703 },
+    { 116, 131, 13710 },
+    { 170, 196, 13713 },
+    { 41, 73, 13719 },
+    { 130, 164, 13736 },
+    { 104, 153, 13740 },
+    { 104, 154, 13742 },
+    { 133, 167, 13751 },
+    { 47, 77, 13755 },
+    { 191, 192, 13758 },
+    { 237, 242, 13759 },
+    { 71, 93, 13771 },
+    { 197, 213, 13773 },
+    { 141, 163, 13776 },
+    { 214, 231, 13780 },
+    { 130, 167, 13782 },
+    { 88, 96, 13787 },
+    { 29, 59, 13789 },
+    { 65, 75, 13794 },
+    { 164, 170, 13799 },
+    { 36, 45, 13801 },
+    { 194, 199, 13808 },
+    { 57, 83, 13815 },
+    { 174, 208, 13816 },
+    { 82, 91, 13817 },
+    { 105, 143, 13820 },
+    { 166, 207, 13822 },
+    { 51, 74, 13824 },
+    { 125, 139, 13826 },
+    { 115, 137, 13828 },
+    { 10, 253, 13829 },
+    { 92, 119, 13832 },
+    { 57, 71, 13835 },
+    { 209, 236, 13836 },
+    { 130, 148, 13837 },
+    { 88, 119, 13839 },
+    { 183, 187, 13839 },
+    { 26, 46, 13843 },
+    { 50, 78, 13845 },
+    { 116, 135, 13848 },
+    { 87, 129, 13852 },
+    { 188, 195, 13857 },
+    { 9, 248, 13858 },
+    { 76, 97, 13862 },
+    { 212, 235, 13876 },
+    { 34, 60, 13877 },
+    { 49, 50, 13881 },
+    { 211, 214, 13885 },
+    { 44, 61, 13888 },
+    { 127, 161, 13888 },
+    { 120, 128, 13895 },
+    { 46, 80, 13901 },
+    { 155, 201, 13902 },
+    { 94, 120, 13904 },
+    { 194, 209, 13905 },
+    { 102, 130, 13913 },
+    { 203, 220, 13914 },
+    { 50, 60, 13918 },
+    { 178, 201, 13928 },
+    { 192, 223, 13932 },
+    { 34, 37, 13933 },
+    { 93, 104, 13937 },
+    { 191, 204, 13937 },
+    { 49, 77, 13942 },
+    { 96, 112, 13949 },
+    { 31, 55, 13954 },
+    { 37, 68, 13956 },
+    { 178, 215, 13958 },
+    { 202, 210, 13964 },
+    { 171, 203, 13974 },
+    { 117, 172, 13977 },
+    { 118, 136, 13987 },
+    { 230, 242, 13992 },
+    { 189, 234, 13995 },
+    { 112, 158, 13999 },
+    { 35, 66, 14002 },
+    { 65, 102, 14008 },
+    { 100, 101, 14008 },
+    { 0, 6, 14014 },
+    { 164, 166, 14017 },
+    { 186, 219, 14018 },
+    { 215, 235, 14023 },
+    { 152, 182, 14028 },
+    { 237, 247, 14032 },
+    { 2, 17, 14033 },
+    { 182, 189, 14035 },
+    { 178, 210, 14036 },
+    { 125, 152, 14041 },
+    { 152, 180, 14042 },
+    { 57, 86, 14045 },
+    { 29, 35, 14051 },
+    { 236, 250, 14051 },
+    { 120, 121, 14052 },
+    { 16, 28, 14053 },
+    { 8, 24, 14058 },
+    { 229, 238, 14060 },
+    { 231, 243, 14061 },
+    { 148, 175, 14065 },
+    { 149, 174, 14068 },
+    { 187, 221, 14074 },
+    { 45, 63, 14076 },
+    { 138, 161, 14076 },
+    { 230, 237, 14076 },
+    { 104, 143, 14079 },
+    { 53, 80, 14084 },
+    { 143, 189, 14088 },
+    { 189, 211, 14088 },
+    { 194, 222, 14089 },
+    { 10, 25, 14090 },
+    { 72, 83, 14090 },
+    { 51, 54, 14091 },
+    { 69, 79, 14095 },
+    { 173, 211, 14095 },
+    { 38, 75, 14106 },
+    { 36, 66, 14107 },
+    { 12, 249, 14120 },
+    { 200, 210, 14126 },
+    { 8, 18, 14131 },
+    { 38, 67, 14135 },
+    { 186, 221, 14136 },
+    { 115, 136, 14137 },
+    { 121, 135, 14144 },
+    { 198, 213, 14150 },
+    { 28, 43, 14152 },
+    { 32, 67, 14170 },
+    { 119, 165, 14176 },
+    { 163, 191, 14177 },
+    { 4, 20, 14187 },
+    { 107, 116, 14190 },
+    { 89, 122, 14191 },
+    { 107, 134, 14192 },
+    { 6, 24, 14193 },
+    { 87, 125, 14197 },
+    { 175, 205, 14198 },
+    { 30, 53, 14202 },
+    { 88, 123, 14209 },
+    { 228, 240, 14210 },
+    { 55, 78, 14213 },
+    { 168, 195, 14214 },
+    { 22, 36, 14229 },
+    { 88, 114, 14229 },
+    { 187, 219, 14229 },
+    { 27, 87, 14232 },
+    { 83, 98, 14236 },
+    { 102, 147, 14237 },
+    { 171, 194, 14239 },
+    { 65, 93, 14242 },
+    { 171, 184, 14243 },
+    { 96, 115, 14256 },
+    { 216, 232, 14256 },
+    { 201, 219, 14260 },
+    { 190, 255, 14261 },
+    { 247, 250, 14261 },
+    { 11, 239, 14265 },
+    { 152, 192, 14268 },
+    { 178, 216, 14269 },
+    { 175, 208, 14271 },
+    { 3, 185, 14280 },
+    { 220, 238, 14281 },
+    { 17, 30, 14285 },
+    { 172, 207, 14294 },
+    { 167, 208, 14295 },
+    { 183, 211, 14304 },
+    { 8, 19, 14306 },
+    { 126, 137, 14306 },
+    { 174, 204, 14307 },
+    { 174, 207, 14311 },
+    { 231, 245, 14311 },
+    { 108, 153, 14323 },
+    { 108, 154, 14325 },
+    { 138, 160, 14327 },
+    { 154, 192, 14329 },
+    { 153, 192, 14331 },
+    { 140, 190, 14335 },
+    { 201, 223, 14335 },
+    { 41, 75, 14337 },
+    { 121, 149, 14343 },
+    { 182, 218, 14346 },
+    { 214, 221, 14352 },
+    { 6, 26, 14354 },
+    { 19, 113, 14354 },
+    { 44, 64, 14354 },
+    { 230, 238, 14356 },
+    { 47, 76, 14359 },
+    { 209, 239, 14359 },
+    { 182, 197, 14361 },
+    { 160, 204, 14362 },
+    { 1, 5, 14373 },
+    { 87, 132, 14377 },
+    { 139, 159, 14381 },
+    { 191, 224, 14385 },
+    { 13, 18, 14389 },
+    { 105, 156, 14393 },
+    { 42, 57, 14398 },
+    { 210, 222, 14404 },
+    { 120, 164, 14406 },
+    { 122, 149, 14408 },
+    { 89, 125, 14415 },
+    { 3, 234, 14416 },
+    { 69, 84, 14420 },
+    { 93, 117, 14420 },
+    { 14, 29, 14423 },
+    { 56, 66, 14425 },
+    { 67, 97, 14427 },
+    { 49, 67, 14431 },
+    { 10, 13, 14435 },
+    { 161, 204, 14435 },
+    { 128, 146, 14437 },
+    { 87, 122, 14445 },
+    { 151, 179, 14457 },
+    { 166, 208, 14460 },
+    { 190, 195, 14460 },
+    { 191, 203, 14465 },
+    { 203, 226, 14465 },
+    { 47, 58, 14466 },
+    { 119, 168, 14467 },
+    { 46, 48, 14470 },
+    { 230, 241, 14486 },
+    { 79, 102, 14488 },
+    { 63, 79, 14491 },
+    { 229, 242, 14505 },
+    { 225, 233, 14508 },
+    { 35, 70, 14511 },
+    { 67, 95, 14511 },
+    { 174, 211, 14513 },
+    { 184, 220, 14515 },
+    { 137, 157, 14524 },
+    { 108, 164, 14525 },
+    { 32, 87, 14526 },
+    { 1, 25, 14530 },
+    { 11, 19, 14530 },
+    { 91, 96, 14530 },
+    { 32, 94, 14531 },
+    { 237, 239, 14534 },
+    { 36, 58, 14535 },
+    { 219, 235, 14535 },
+    { 90, 96, 14536 },
+    { 114, 116, 14542 },
+    { 99, 130, 14546 },
+    { 113, 136, 14547 },
+    { 149, 156, 14549 },
+    { 7, 9, 14552 },
+    { 146, 189, 14552 },
+    { 38, 45, 14561 },
+    { 54, 84, 14561 },
+    { 175, 211, 14565 },
+    { 19, 179, 14569 },
+    { 127, 167, 14570 },
+    { 84, 102, 14571 },
+    { 123, 151, 14573 },
+    { 186, 210, 14575 },
+    { 172, 205, 14580 },
+    { 34, 66, 14586 },
+    { 130, 166, 14587 },
+    { 175, 210, 14587 },
+    { 212, 234, 14592 },
+    { 195, 228, 14604 },
+    { 27, 102, 14606 },
+    { 126, 149, 14614 },
+    { 52, 78, 14616 },
+    { 204, 224, 14621 },
+    { 145, 171, 14625 },
+    { 77, 89, 14628 },
+    { 80, 100, 14632 },
+    { 22, 59, 14634 },
+    { 155, 182, 14637 },
+    { 35, 47, 14641 },
+    { 19, 88, 14643 },
+    { 28, 50, 14643 },
+    { 155, 178, 14646 },
+    { 217, 225, 14650 },
+    { 161, 200, 14655 },
+    { 171, 174, 14656 },
+    { 100, 134, 14661 },
+    { 152, 175, 14663 },
+    { 183, 200, 14663 },
+    { 155, 174, 14665 },
+    { 138, 155, 14676 },
+    { 31, 45, 14679 },
+    { 53, 78, 14679 },
+    { 191, 221, 14681 },
+    { 76, 95, 14685 },
+    { 160, 200, 14690 },
+    { 89, 129, 14691 },
+    { 164, 192, 14692 },
+    { 190, 228, 14692 },
+    { 102, 156, 14696 },
+    { 28, 45, 14697 },
+    { 107, 136, 14701 },
+    { 209, 227, 14705 },
+    { 4, 244, 14706 },
+    { 159, 167, 14712 },
+    { 183, 202, 14713 },
+    { 84, 105, 14718 },
+    { 122, 160, 14719 },
+    { 94, 164, 14732 },
+    { 191, 223, 14745 },
+    { 205, 210, 14745 },
+    { 170, 185, 14751 },
+    { 182, 198, 14755 },
+    { 79, 94, 14766 },
+    { 110, 147, 14767 },
+    { 160, 185, 14769 },
+    { 54, 83, 14770 },
+    { 125, 160, 14773 },
+    { 6, 23, 14775 },
+    { 166, 196, 14779 },
+    { 158, 209, 14780 },
+    { 73, 93, 14785 },
+    { 8, 23, 14789 },
+    { 35, 38, 14790 },
+    { 55, 74, 14792 },
+    { 120, 160, 14792 },
+    { 130, 172, 14797 },
+    { 75, 93, 14799 },
+    { 94, 156, 14799 },
+    { 69, 70, 14805 },
+    { 203, 217, 14805 },
+    { 55, 62, 14823 },
+    { 232, 245, 14827 },
+    { 59, 66, 14828 },
+    { 13, 239, 14832 },
+    { 103, 107, 14845 },
+    { 238, 247, 14846 },
+    { 238, 254, 14856 },
+    { 171, 206, 14859 },
+    { 155, 180, 14863 },
+    { 132, 152, 14865 },
+    { 53, 82, 14869 },
+    { 173, 201, 14872 },
+    { 127, 185, 14877 },
+    { 190, 217, 14879 },
+    { 204, 234, 14888 },
+    { 76, 99, 14893 },
+    { 13, 30, 14896 },
+    { 65, 74, 14901 },
+    { 195, 227, 14901 },
+    { 58, 60, 14912 },
+    { 20, 31, 14913 },
+    { 175, 207, 14916 },
+    { 172, 200, 14930 },
+    { 218, 235, 14930 },
+    { 23, 34, 14931 },
+    { 117, 155, 14936 },
+    { 56, 77, 14943 },
+    { 42, 53, 14944 },
+    { 46, 52, 14952 },
+    { 186, 223, 14952 },
+    { 161, 202, 14953 },
+    { 237, 253, 14954 },
+    { 63, 81, 14955 },
+    { 40, 54, 14956 },
+    { 179, 240, 14957 },
+    { 54, 71, 14959 },
+    { 122, 185, 14962 },
+    { 189, 213, 14970 },
+    { 48, 78, 14973 },
+    { 49, 76, 14973 },
+    { 185, 207, 14975 },
+    { 193, 220, 14975 },
+    { 72, 105, 14976 },
+    { 94, 147, 14976 },
+    { 103, 111, 14976 },
+    { 160, 202, 14988 },
+    { 43, 80, 14989 },
+    { 5, 8, 14997 },
+    { 9, 246, 15000 },
+    { 80, 101, 15001 },
+    { 187, 223, 15002 },
+    { 51, 61, 15005 },
+    { 196, 206, 15011 },
+    { 180, 189, 15013 },
+    { 179, 184, 15022 },
+    { 0, 1, 15030 },
+    { 156, 192, 15030 },
+    { 84, 110, 15032 },
+    { 115, 135, 15032 },
+    { 51, 57, 15036 },
+    { 117, 185, 15043 },
+    { 112, 165, 15061 },
+    { 121, 142, 15065 },
+    { 191, 193, 15067 },
+    { 22, 255, 15070 },
+    { 183, 216, 15070 },
+    { 40, 70, 15075 },
+    { 9, 252, 15079 },
+    { 175, 204, 15080 },
+    { 51, 75, 15088 },
+    { 81, 83, 15093 },
+    { 148, 178, 15095 },
+    { 27, 72, 15101 },
+    { 120, 161, 15105 },
+    { 118, 142, 15106 },
+    { 233, 250, 15106 },
+    { 220, 226, 15111 },
+    { 33, 87, 15113 },
+    { 168, 184, 15118 },
+    { 80, 88, 15123 },
+    { 172, 202, 15123 },
+    { 3, 94, 15126 },
+    { 1, 19, 15127 },
+    { 89, 132, 15128 },
+    { 40, 62, 15130 },
+    { 50, 63, 15130 },
+    { 122, 161, 15134 },
+    { 72, 85, 15140 },
+    { 102, 164, 15140 },
+    { 132, 189, 15140 },
+    { 42, 74, 15146 },
+    { 51, 73, 15151 },
+    { 219, 226, 15153 },
+    { 45, 78, 15156 },
+    { 118, 145, 15159 },
+    { 81, 85, 15161 },
+    { 201, 235, 15164 },
+    { 180, 218, 15169 },
+    { 21, 29, 15170 },
+    { 33, 79, 15172 },
+    { 198, 235, 15174 },
+    { 72, 104, 15176 },
+    { 81, 98, 15177 },
+    { 152, 197, 15177 },
+    { 146, 185, 15181 },
+    { 172, 186, 15181 },
+    { 215, 234, 15186 },
+    { 5, 11, 15189 },
+    { 74, 81, 15189 },
+    { 67, 99, 15191 },
+    { 227, 231, 15192 },
+    { 45, 69, 15193 },
+    { 105, 153, 15194 },
+    { 193, 217, 15196 },
+    { 105, 154, 15197 },
+    { 209, 240, 15198 },
+    { 17, 25, 15199 },
+    { 132, 160, 15204 },
+    { 89, 120, 15205 },
+    { 207, 234, 15205 },
+    { 222, 237, 15205 },
+    { 133, 166, 15206 },
+    { 144, 190, 15206 },
+    { 110, 139, 15208 },
+    { 151, 181, 15209 },
+    { 92, 123, 15210 },
+    { 197, 235, 15210 },
+    { 101, 118, 15219 },
+    { 25, 60, 15220 },
+    { 141, 145, 15221 },
+    { 194, 227, 15224 },
+    { 207, 210, 15230 },
+    { 55, 81, 15231 },
+    { 125, 161, 15232 },
+    { 161, 185, 15236 },
+    { 22, 28, 15240 },
+    { 46, 82, 15248 },
+    { 152, 198, 15248 },
+    { 177, 186, 15254 },
+    { 179, 217, 15257 },
+    { 79, 105, 15265 },
+    { 9, 32, 15267 },
+    { 80, 90, 15268 },
+    { 196, 197, 15268 },
+    { 221, 234, 15270 },
+    { 105, 164, 15276 },
+    { 138, 143, 15277 },
+    { 232, 244, 15284 },
+    { 56, 78, 15287 },
+    { 102, 143, 15292 },
+    { 149, 178, 15294 },
+    { 147, 201, 15297 },
+    { 144, 169, 15300 },
+    { 70, 90, 15303 },
+    { 97, 130, 15303 },
+    { 32, 57, 15310 },
+    { 59, 92, 15319 },
+    { 166, 185, 15322 },
+    { 144, 150, 15325 },
+    { 44, 62, 15334 },
+    { 24, 46, 15338 },
+    { 10, 26, 15342 },
+    { 34, 43, 15345 },
+    { 63, 78, 15346 },
+    { 229, 233, 15347 },
+    { 115, 131, 15350 },
+    { 154, 187, 15350 },
+    { 52, 62, 15352 },
+    { 153, 187, 15352 },
+    { 51, 64, 15355 },
+    { 124, 137, 15358 },
+    { 184, 206, 15360 },
+    { 177, 214, 15365 },
+    { 47, 50, 15370 },
+    { 171, 191, 15372 },
+    { 5, 23, 15373 },
+    { 46, 55, 15373 },
+    { 139, 156, 15378 },
+    { 120, 138, 15385 },
+    { 104, 185, 15392 },
+    { 149, 175, 15394 },
+    { 117, 139, 15395 },
+    { 155, 204, 15397 },
+    { 95, 130, 15398 },
+    { 65, 104, 15399 },
+    { 3, 9, 15400 },
+    { 125, 149, 15401 },
+    { 229, 241, 15402 },
+    { 48, 68, 15404 },
+    { 180, 197, 15409 },
+    { 123, 179, 15415 },
+    { 3, 33, 15421 },
+    { 23, 46, 15425 },
+    { 125, 167, 15428 },
+    { 160, 205, 15428 },
+    { 185, 205, 15431 },
+    { 31, 54, 15432 },
+    { 124, 149, 15432 },
+    { 42, 70, 15436 },
+    { 161, 205, 15437 },
+    { 132, 167, 15439 },
+    { 17, 26, 15442 },
+    { 109, 146, 15442 },
+    { 52, 74, 15444 },
+    { 89, 127, 15452 },
+    { 39, 80, 15453 },
+    { 40, 66, 15454 },
+    { 183, 213, 15454 },
+    { 53, 56, 15456 },
+    { 24, 34, 15458 },
+    { 110, 146, 15459 },
+    { 197, 221, 15460 },
+    { 182, 219, 15465 },
+    { 119, 151, 15469 },
+    { 11, 30, 15471 },
+    { 129, 189, 15474 },
+    { 144, 145, 15474 },
+    { 54, 86, 15481 },
+    { 131, 150, 15481 },
+    { 223, 231, 15481 },
+    { 63, 84, 15487 },
+    { 134, 190, 15489 },
+    { 185, 187, 15492 },
+    { 162, 191, 15495 },
+    { 206, 229, 15501 },
+    { 44, 46, 15504 },
+    { 52, 68, 15509 },
+    { 82, 100, 15519 },
+    { 34, 68, 15522 },
+    { 113, 168, 15522 },
+    { 129, 152, 15522 },
+    { 93, 120, 15523 },
+    { 242, 251, 15528 },
+    { 241, 254, 15529 },
+    { 138, 166, 15530 },
+    { 114, 118, 15538 },
+    { 10, 250, 15539 },
+    { 203, 227, 15543 },
+    { 152, 201, 15544 },
+    { 84, 94, 15545 },
+    { 28, 60, 15550 },
+    { 55, 68, 15550 },
+    { 223, 226, 15554 },
+    { 50, 81, 15557 },
+    { 167, 196, 15557 },
+    { 251, 254, 15563 },
+    { 162, 196, 15566 },
+    { 183, 208, 15566 },
+    { 207, 235, 15567 },
+    { 243, 246, 15573 },
+    { 178, 189, 15575 },
+    { 1, 18, 15578 },
+    { 249, 251, 15582 },
+    { 84, 108, 15583 },
+    { 174, 210, 15583 },
+    { 130, 170, 15588 },
+    { 199, 239, 15588 },
+    { 85, 89, 15589 },
+    { 15, 249, 15603 },
+    { 24, 59, 15620 },
+    { 173, 212, 15627 },
+    { 51, 78, 15631 },
+    { 163, 166, 15640 },
+    { 98, 106, 15641 },
+    { 111, 131, 15641 },
+    { 189, 196, 15641 },
+    { 222, 233, 15646 },
+    { 163, 188, 15648 },
+    { 164, 204, 15665 },
+    { 248, 252, 15668 },
+    { 33, 62, 15673 },
+    { 128, 152, 15673 },
+    { 149, 163, 15674 },
+    { 63, 70, 15676 },
+    { 27, 248, 15677 },
+    { 219, 231, 15682 },
+    { 25, 46, 15691 },
+    { 196, 198, 15692 },
+    { 3, 104, 15698 },
+    { 160, 207, 15698 },
+    { 132, 161, 15700 },
+    { 155, 159, 15701 },
+    { 52, 81, 15702 },
+    { 32, 54, 15704 },
+    { 138, 163, 15707 },
+    { 136, 168, 15711 },
+    { 110, 121, 15714 },
+    { 122, 167, 15714 },
+    { 213, 232, 15714 },
+    { 31, 34, 15722 },
+    { 34, 70, 15729 },
+    { 43, 88, 15729 },
+    { 104, 172, 15729 },
+    { 161, 207, 15731 },
+    { 199, 233, 15736 },
+    { 241, 252, 15738 },
+    { 173, 213, 15740 },
+    { 233, 240, 15743 },
+    { 71, 117, 15745 },
+    { 214, 215, 15747 },
+    { 19, 247, 15748 },
+    { 247, 253, 15750 },
+    { 57, 85, 15754 },
+    { 5, 24, 15755 },
+    { 140, 157, 15758 },
+    { 213, 235, 15758 },
+    { 198, 221, 15763 },
+    { 56, 81, 15764 },
+    { 169, 203, 15765 },
+    { 87, 127, 15770 },
+    { 224, 230, 15772 },
+    { 83, 89, 15780 },
+    { 150, 181, 15782 },
+    { 172, 208, 15784 },
+    { 188, 222, 15787 },
+    { 180, 198, 15797 },
+    { 170, 212, 15801 },
+    { 218, 226, 15802 },
+    { 143, 198, 15806 },
+    { 245, 253, 15810 },
+    { 199, 236, 15811 },
+    { 204, 235, 15811 },
+    { 102, 153, 15814 },
+    { 102, 154, 15816 },
+    { 34, 56, 15820 },
+    { 133, 170, 15826 },
+    { 39, 66, 15831 },
+    { 162, 192, 15836 },
+    { 149, 172, 15843 },
+    { 129, 160, 15845 },
+    { 176, 214, 15849 },
+    { 224, 235, 15849 },
+    { 72, 108, 15851 },
+    { 65, 105, 15852 },
+    { 176, 186, 15856 },
+    { 96, 116, 15857 },
+    { 3, 71, 15865 },
+    { 127, 166, 15867 },
+    { 19, 168, 15875 },
+    { 216, 226, 15880 },
+    { 3, 164, 15881 },
+    { 132, 139, 15881 },
+    { 173, 189, 15887 },
+    { 154, 204, 15888 },
+    { 50, 69, 15889 },
+    { 153, 204, 15890 },
+    { 77, 87, 15898 },
+    { 245, 250, 15900 },
+    { 245, 252, 15900 },
+    { 108, 146, 15902 },
+    { 214, 232, 15903 },
+    { 149, 180, 15913 },
+    { 38, 77, 15916 },
+    { 96, 113, 15916 },
+    { 124, 130, 15924 },
+    { 45, 60, 15927 },
+    { 199, 240, 15935 },
+    { 44, 54, 15937 },
+    { 206, 216, 15937 },
+    { 148, 180, 15940 },
+    { 205, 234, 15941 },
+    { 169, 176, 15942 },
+    { 143, 197, 15943 },
+    { 206, 230, 15943 },
+    { 175, 188, 15944 },
+    { 48, 62, 15953 },
+    { 38, 76, 15964 },
+    { 39, 50, 15966 },
+    { 36, 70, 15967 },
+    { 17, 22, 15976 },
+    { 152, 185, 15976 },
+    { 183, 205, 15986 },
+    { 182, 221, 15988 },
+    { 116, 136, 16009 },
+    { 3, 249, 16013 },
+    { 120, 172, 16013 },
+    { 197, 218, 16013 },
+    { 163, 170, 16018 },
+    { 44, 74, 16023 },
+    { 73, 89, 16023 },
+    { 187, 210, 16024 },
+    { 29, 50, 16025 },
+    { 37, 80, 16031 },
+    { 194, 214, 16032 },
+    { 151, 195, 16035 },
+    { 42, 66, 16036 },
+    { 94, 130, 16037 },
+    { 1, 225, 16040 },
+    { 80, 91, 16041 },
+    { 42, 73, 16044 },
+    { 40, 61, 16047 },
+    { 170, 211, 16047 },
+    { 129, 167, 16048 },
+    { 89, 133, 16051 },
+    { 181, 183, 16051 },
+    { 176, 194, 16058 },
+    { 87, 133, 16065 },
+    { 54, 55, 16066 },
+    { 232, 242, 16068 },
+    { 217, 229, 16069 },
+    { 178, 197, 16071 },
+    { 181, 217, 16071 },
+    { 16, 37, 16078 },
+    { 65, 83, 16078 },
+    { 109, 172, 16079 },
+    { 230, 233, 16080 },
+    { 38, 58, 16085 },
+    { 86, 117, 16086 },
+    { 146, 173, 16087 },
+    { 85, 90, 16089 },
+    { 241, 244, 16100 },
+    { 111, 116, 16101 },
+    { 203, 229, 16101 },
+    { 62, 71, 16102 },
+    { 175, 213, 16106 },
+    { 197, 216, 16106 },
+    { 235, 252, 16107 },
+    { 174, 213, 16113 },
+    { 40, 57, 16124 },
+    { 74, 93, 16125 },
+    { 185, 200, 16125 },
+    { 93, 122, 16126 },
+    { 223, 234, 16126 },
+    { 55, 75, 16128 },
+    { 48, 74, 16130 },
+    { 48, 81, 16130 },
+    { 20, 38, 16134 },
+    { 173, 215, 16134 },
+    { 27, 95, 16136 },
+    { 143, 162, 16136 },
+    { 208, 235, 16140 },
+    { 168, 169, 16148 },
+    { 178, 218, 16150 },
+    { 150, 163, 16161 },
+    { 133, 189, 16165 },
+    { 79, 108, 16171 },
+    { 155, 200, 16171 },
+    { 149, 182, 16175 },
+    { 165, 239, 16175 },
+    { 238, 239, 16186 },
+    { 222, 228, 16187 },
+    { 159, 186, 16189 },
+    { 87, 120, 16190 },
+    { 155, 175, 16190 },
+    { 107, 140, 16191 },
+    { 44, 78, 16198 },
+    { 1, 250, 16203 },
+    { 131, 148, 16203 },
+    { 208, 234, 16207 },
+    { 85, 91, 16209 },
+    { 142, 157, 16213 },
+    { 132, 198, 16216 },
+    { 15, 71, 16222 },
+    { 20, 54, 16226 },
+    { 94, 153, 16231 },
+    { 94, 154, 16234 },
+    { 41, 67, 16235 },
+    { 121, 146, 16235 },
+    { 49, 83, 16239 },
+    { 75, 81, 16248 },
+    { 14, 30, 16252 },
+    { 29, 61, 16255 },
+    { 185, 202, 16256 },
+    { 128, 143, 16257 },
+    { 205, 235, 16259 },
+    { 126, 130, 16266 },
+    { 42, 75, 16279 },
+    { 180, 219, 16280 },
+    { 9, 27, 16288 },
+    { 92, 106, 16289 },
+    { 177, 194, 16296 },
+    { 246, 251, 16298 },
+    { 23, 59, 16306 },
+    { 56, 83, 16313 },
+    { 174, 201, 16314 },
+    { 120, 167, 16317 },
+    { 157, 168, 16319 },
+    { 179, 239, 16321 },
+    { 0, 8, 16323 },
+    { 226, 241, 16327 },
+    { 74, 78, 16329 },
+    { 149, 187, 16331 },
+    { 21, 40, 16336 },
+    { 47, 83, 16336 },
+    { 118, 126, 16339 },
+    { 129, 161, 16342 },
+    { 156, 204, 16344 },
+    { 232, 235, 16346 },
+    { 198, 218, 16357 },
+    { 170, 191, 16358 },
+    { 72, 109, 16363 },
+    { 172, 234, 16365 },
+    { 2, 18, 16366 },
+    { 171, 173, 16366 },
+    { 98, 101, 16369 },
+    { 1, 26, 16372 },
+    { 35, 68, 16374 },
+    { 174, 212, 16381 },
+    { 55, 73, 16388 },
+    { 118, 124, 16392 },
+    { 142, 162, 16392 },
+    { 147, 192, 16392 },
+    { 173, 210, 16392 },
+    { 146, 198, 16394 },
+    { 70, 91, 16399 },
+    { 141, 150, 16399 },
+    { 215, 232, 16400 },
+    { 41, 77, 16401 },
+    { 163, 186, 16401 },
+    { 6, 19, 16407 },
+    { 13, 43, 16410 },
+    { 33, 76, 16411 },
+    { 107, 118, 16415 },
+    { 12, 246, 16424 },
+    { 243, 249, 16425 },
+    { 56, 61, 16428 },
+    { 51, 81, 16432 },
+    { 128, 159, 16434 },
+    { 120, 148, 16435 },
+    { 156, 187, 16435 },
+    { 52, 54, 16441 },
+    { 146, 197, 16441 },
+    { 224, 229, 16441 },
+    { 195, 206, 16447 },
+    { 27, 109, 16450 },
+    { 178, 198, 16450 },
+    { 155, 202, 16462 },
+    { 236, 253, 16464 },
+    { 181, 199, 16465 },
+    { 161, 208, 16467 },
+    { 13, 37, 16468 },
+    { 96, 119, 16472 },
+    { 161, 163, 16478 },
+    { 160, 208, 16480 },
+    { 198, 216, 16481 },
+    { 129, 139, 16483 },
+    { 4, 251, 16486 },
+    { 129, 198, 16489 },
+    { 67, 94, 16491 },
+    { 217, 238, 16495 },
+    { 158, 239, 16497 },
+    { 9, 33, 16503 },
+    { 71, 73, 16507 },
+    { 199, 227, 16514 },
+    { 238, 245, 16517 },
+    { 1, 253, 16521 },
+    { 192, 234, 16523 },
+    { 36, 80, 16524 },
+    { 109, 185, 16525 },
+    { 157, 195, 16526 },
+    { 192, 224, 16526 },
+    { 179, 228, 16530 },
+    { 152, 204, 16532 },
+    { 185, 208, 16532 },
+    { 132, 197, 16535 },
+    { 148, 182, 16537 },
+    { 142, 171, 16541 },
+    { 1, 24, 16548 },
+    { 66, 90, 16553 },
+    { 63, 72, 16554 },
+    { 38, 50, 16557 },
+    { 26, 34, 16561 },
+    { 169, 177, 16567 },
+    { 33, 94, 16569 },
+    { 138, 167, 16572 },
+    { 100, 106, 16573 },
+    { 40, 64, 16576 },
+    { 164, 187, 16576 },
+    { 3, 246, 16578 },
+    { 149, 186, 16580 },
+    { 66, 69, 16582 },
+    { 24, 60, 16583 },
+    { 71, 77, 16584 },
+    { 162, 171, 16590 },
+    { 10, 30, 16592 },
+    { 206, 220, 16595 },
+    { 33, 38, 16600 },
+    { 58, 82, 16600 },
+    { 127, 170, 16601 },
+    { 206, 224, 16602 },
+    { 29, 45, 16605 },
+    { 120, 124, 16607 },
+    { 146, 187, 16610 },
+    { 18, 21, 16611 },
+    { 6, 253, 16614 },
+    { 182, 223, 16614 },
+    { 110, 111, 16616 },
+    { 171, 178, 16626 },
+    { 117, 152, 16628 },
+    { 77, 97, 16631 },
+    { 175, 216, 16635 },
+    { 146, 159, 16638 },
+    { 218, 231, 16640 },
+    { 60, 88, 16642 },
+    { 162, 200, 16655 },
+    { 56, 64, 16660 },
+    { 197, 223, 16661 },
+    { 221, 231, 16668 },
+    { 94, 143, 16671 },
+    { 173, 197, 16674 },
+    { 75, 89, 16675 },
+    { 65, 108, 16685 },
+    { 6, 250, 16687 },
+    { 45, 81, 16693 },
+    { 34, 59, 16709 },
+    { 183, 207, 16711 },
+    { 186, 224, 16712 },
+    { 175, 212, 16714 },
+    { 155, 205, 16722 },
+    { 221, 226, 16723 },
+    { 88, 134, 16724 },
+    { 40, 74, 16729 },
+    { 173, 216, 16732 },
+    { 185, 248, 16741 },
+    { 210, 230, 16741 },
+    { 197, 219, 16742 },
+    { 125, 189, 16743 },
+    { 32, 104, 16744 },
+    { 110, 128, 16744 },
+    { 27, 129, 16746 },
+    { 84, 109, 16750 },
+    { 59, 70, 16751 },
+    { 53, 81, 16752 },
+    { 159, 191, 16752 },
+    { 174, 215, 16753 },
+    { 170, 183, 16754 },
+    { 169, 199, 16758 },
+    { 54, 85, 16760 },
+    { 183, 192, 16773 },
+    { 52, 75, 16774 },
+    { 203, 230, 16775 },
+    { 211, 235, 16777 },
+    { 163, 196, 16778 },
+    { 82, 88, 16780 },
+    { 204, 210, 16780 },
+    { 210, 229, 16783 },
+    { 105, 146, 16789 },
+    { 19, 123, 16790 },
+    { 78, 83, 16793 },
+    { 44, 68, 16798 },
+    { 222, 238, 16799 },
+    { 3, 129, 16800 },
+    { 31, 50, 16808 },
+    { 216, 235, 16813 },
+    { 71, 129, 16814 },
+    { 129, 197, 16819 },
+    { 1, 236, 16822 },
+    { 16, 39, 16823 },
+    { 195, 222, 16823 },
+    { 138, 170, 16827 },
+    { 167, 212, 16827 },
+    { 85, 97, 16828 },
+    { 152, 200, 16836 },
+    { 151, 199, 16837 },
+    { 132, 149, 16839 },
+    { 157, 194, 16839 },
+    { 100, 140, 16840 },
+    { 58, 80, 16843 },
+    { 147, 148, 16847 },
+    { 47, 65, 16849 },
+    { 73, 87, 16853 },
+    { 79, 104, 16859 },
+    { 127, 128, 16861 },
+    { 174, 216, 16862 },
+    { 31, 57, 16868 },
+    { 33, 86, 16871 },
+    { 170, 215, 16871 },
+    { 0, 11, 16881 },
+    { 155, 207, 16888 },
+    { 28, 61, 16892 },
+    { 154, 186, 16895 },
+    { 180, 221, 16895 },
+    { 153, 186, 16897 },
+    { 126, 159, 16900 },
+    { 30, 61, 16902 },
+    { 47, 79, 16902 },
+    { 48, 54, 16911 },
+    { 149, 164, 16912 },
+    { 112, 168, 16916 },
+    { 162, 202, 16917 },
+    { 38, 65, 16918 },
+    { 35, 63, 16927 },
+    { 28, 59, 16937 },
+    { 212, 214, 16937 },
+    { 110, 156, 16941 },
+    { 32, 79, 16942 },
+    { 110, 153, 16942 },
+    { 110, 154, 16944 },
+    { 47, 72, 16951 },
+    { 55, 57, 16955 },
+    { 69, 72, 16957 },
+    { 175, 215, 16959 },
+    { 137, 151, 16965 },
+    { 198, 223, 16965 },
+    { 44, 57, 16966 },
+    { 99, 147, 16980 },
+    { 34, 41, 16982 },
+    { 20, 57, 16984 },
+    { 161, 196, 16985 },
+    { 217, 239, 16986 },
+    { 40, 46, 16993 },
+    { 125, 166, 16995 },
+    { 160, 163, 16996 },
+    { 79, 110, 16998 },
+    { 65, 109, 17000 },
+    { 2, 7, 17001 },
+    { 67, 102, 17004 },
+    { 123, 190, 17007 },
+    { 190, 247, 17007 },
+    { 52, 73, 17008 },
+    { 152, 163, 17010 },
+    { 115, 119, 17015 },
+    { 173, 198, 17018 },
+    { 189, 221, 17018 },
+    { 128, 162, 17019 },
+    { 14, 25, 17021 },
+    { 18, 37, 17023 },
+    { 57, 87, 17023 },
+    { 56, 76, 17025 },
+    { 78, 85, 17026 },
+    { 22, 60, 17030 },
+    { 19, 112, 17035 },
+    { 42, 61, 17039 },
+    { 43, 66, 17039 },
+    { 23, 60, 17042 },
+    { 210, 231, 17043 },
+    { 111, 118, 17044 },
+    { 189, 235, 17045 },
+    { 151, 165, 17046 },
+    { 37, 66, 17048 },
+    { 183, 215, 17053 },
+    { 27, 89, 17062 },
+    { 10, 29, 17065 },
+    { 198, 219, 17072 },
+    { 122, 166, 17076 },
+    { 27, 105, 17078 },
+    { 32, 102, 17086 },
+    { 35, 60, 17086 },
+    { 193, 226, 17089 },
+    { 88, 158, 17094 },
+    { 79, 109, 17095 },
+    { 217, 230, 17098 },
+    { 187, 224, 17099 },
+    { 60, 92, 17101 },
+    { 29, 64, 17104 },
+    { 222, 232, 17104 },
+    { 177, 187, 17110 },
+    { 16, 43, 17119 },
+    { 43, 82, 17119 },
+    { 95, 147, 17123 },
+    { 166, 212, 17123 },
+    { 93, 127, 17126 },
+    { 172, 212, 17126 },
+    { 146, 192, 17127 },
+    { 83, 90, 17133 },
+    { 152, 202, 17135 },
+    { 175, 206, 17136 },
+    { 235, 243, 17156 },
+    { 93, 125, 17164 },
+    { 166, 191, 17164 },
+    { 1, 23, 17169 },
+    { 32, 89, 17170 },
+    { 231, 238, 17171 },
+    { 94, 185, 17172 },
+    { 193, 227, 17172 },
+    { 179, 255, 17178 },
+    { 184, 190, 17185 },
+    { 99, 143, 17186 },
+    { 137, 138, 17188 },
+    { 181, 209, 17188 },
+    { 183, 218, 17201 },
+    { 132, 166, 17206 },
+    { 147, 187, 17206 },
+    { 145, 163, 17207 },
+    { 20, 27, 17208 },
+    { 166, 183, 17210 },
+    { 160, 196, 17211 },
+    { 71, 110, 17212 },
+    { 164, 234, 17213 },
+    { 191, 201, 17214 },
+    { 84, 104, 17222 },
+    { 78, 98, 17227 },
+    { 144, 199, 17231 },
+    { 41, 76, 17232 },
+    { 36, 48, 17233 },
+    { 18, 36, 17234 },
+    { 219, 234, 17235 },
+    { 35, 39, 17237 },
+    { 8, 30, 17239 },
+    { 120, 126, 17239 },
+    { 202, 234, 17241 },
+    { 65, 85, 17244 },
+    { 185, 212, 17244 },
+    { 135, 159, 17247 },
+    { 159, 187, 17251 },
+    { 120, 166, 17253 },
+    { 178, 219, 17257 },
+    { 228, 229, 17259 },
+    { 44, 81, 17262 },
+    { 63, 66, 17277 },
+    { 5, 22, 17283 },
+    { 25, 255, 17283 },
+    { 10, 254, 17285 },
+    { 82, 107, 17291 },
+    { 46, 51, 17294 },
+    { 141, 152, 17295 },
+    { 135, 148, 17299 },
+    { 44, 75, 17300 },
+    { 206, 227, 17300 },
+    { 80, 107, 17301 },
+    { 189, 216, 17301 },
+    { 3, 132, 17302 },
+    { 213, 234, 17303 },
+    { 148, 154, 17309 },
+    { 148, 153, 17311 },
+    { 183, 212, 17315 },
+    { 166, 211, 17316 },
+    { 171, 180, 17316 },
+    { 175, 201, 17316 },
+    { 37, 50, 17323 },
+    { 83, 97, 17326 },
+    { 218, 234, 17334 },
+    { 14, 26, 17339 },
+    { 27, 108, 17345 },
+    { 51, 77, 17351 },
+    { 121, 127, 17353 },
+    { 211, 232, 17355 },
+    { 19, 134, 17356 },
+    { 200, 234, 17357 },
+    { 104, 146, 17359 },
+    { 77, 81, 17362 },
+    { 164, 207, 17362 },
+    { 52, 57, 17368 },
+    { 181, 220, 17368 },
+    { 185, 186, 17368 },
+    { 201, 224, 17368 },
+    { 63, 65, 17370 },
+    { 27, 132, 17373 },
+    { 93, 111, 17374 },
+    { 44, 73, 17376 },
+    { 83, 91, 17376 },
+    { 21, 23, 17378 },
+    { 108, 172, 17389 },
+    { 189, 218, 17395 },
+    { 190, 236, 17398 },
+    { 38, 72, 17406 },
+    { 149, 189, 17406 },
+    { 127, 148, 17408 },
+    { 68, 90, 17409 },
+    { 28, 58, 17410 },
+    { 33, 89, 17412 },
+    { 37, 88, 17415 },
+    { 32, 95, 17419 },
+    { 230, 245, 17425 },
+    { 39, 82, 17435 },
+    { 188, 196, 17441 },
+    { 167, 211, 17442 },
+    { 71, 132, 17443 },
+    { 5, 13, 17446 },
+    { 208, 214, 17452 },
+    { 222, 224, 17452 },
+    { 48, 75, 17457 },
+    { 135, 136, 17460 },
+    { 128, 155, 17465 },
+    { 46, 78, 17470 },
+    { 174, 188, 17471 },
+    { 180, 223, 17474 },
+    { 3, 4, 17475 },
+    { 150, 184, 17476 },
+    { 206, 218, 17477 },
+    { 8, 225, 17478 },
+    { 146, 186, 17486 },
+    { 183, 204, 17487 },
+    { 195, 225, 17489 },
+    { 75, 78, 17490 },
+    { 18, 39, 17491 },
+    { 129, 149, 17493 },
+    { 42, 64, 17494 },
+    { 192, 210, 17495 },
+    { 202, 235, 17501 },
+    { 210, 232, 17503 },
+    { 117, 160, 17505 },
+    { 131, 159, 17505 },
+    { 216, 231, 17508 },
+    { 16, 36, 17509 },
+    { 128, 137, 17511 },
+    { 220, 225, 17514 },
+    { 127, 138, 17517 },
+    { 93, 98, 17518 },
+    { 30, 35, 17521 },
+    { 31, 63, 17521 },
+    { 125, 170, 17521 },
+    { 68, 92, 17523 },
+    { 132, 170, 17524 },
+    { 60, 78, 17527 },
+    { 174, 189, 17530 },
+    { 209, 237, 17530 },
+    { 118, 141, 17532 },
+    { 226, 242, 17540 },
+    { 146, 201, 17541 },
+    { 214, 227, 17542 },
+    { 103, 114, 17543 },
+    { 134, 157, 17543 },
+    { 136, 169, 17546 },
+    { 146, 174, 17547 },
+    { 2, 245, 17548 },
+    { 68, 96, 17549 },
+    { 139, 173, 17555 },
+    { 239, 250, 17559 },
+    { 39, 45, 17566 },
+    { 83, 87, 17567 },
+    { 27, 99, 17569 },
+    { 143, 201, 17569 },
+    { 212, 232, 17570 },
+    { 28, 40, 17574 },
+    { 185, 235, 17580 },
+    { 57, 89, 17583 },
+    { 117, 149, 17588 },
+    { 28, 48, 17589 },
+    { 152, 205, 17594 },
+    { 21, 42, 17597 },
+    { 133, 198, 17602 },
+    { 233, 253, 17604 },
+    { 69, 86, 17605 },
+    { 154, 207, 17606 },
+    { 153, 207, 17608 },
+    { 26, 53, 17611 },
+    { 121, 143, 17611 },
+    { 51, 68, 17613 },
+    { 170, 213, 17617 },
+    { 15, 246, 17623 },
+    { 56, 67, 17627 },
+    { 30, 64, 17628 },
+    { 135, 157, 17632 },
+    { 50, 80, 17636 },
+    { 66, 91, 17640 },
+    { 59, 100, 17642 },
+    { 119, 179, 17647 },
+    { 85, 87, 17651 },
+    { 118, 150, 17656 },
+    { 95, 143, 17663 },
+    { 163, 167, 17664 },
+    { 128, 161, 17668 },
+    { 91, 116, 17672 },
+    { 14, 22, 17673 },
+    { 48, 73, 17675 },
+    { 58, 74, 17680 },
+    { 15, 65, 17682 },
+    { 127, 189, 17685 },
+    { 164, 205, 17685 },
+    { 130, 185, 17687 },
+    { 200, 235, 17692 },
+    { 151, 190, 17696 },
+    { 206, 211, 17698 },
+    { 49, 79, 17700 },
+    { 233, 242, 17701 },
+    { 50, 59, 17703 },
+    { 176, 187, 17703 },
+    { 206, 219, 17711 },
+    { 101, 112, 17717 },
+    { 139, 172, 17719 },
+    { 140, 199, 17729 },
+    { 40, 73, 17730 },
+    { 28, 44, 17733 },
+    { 32, 86, 17733 },
+    { 0, 247, 17734 },
+    { 126, 146, 17742 },
+    { 154, 205, 17742 },
+    { 153, 205, 17744 },
+    { 50, 82, 17755 },
+    { 75, 87, 17756 },
+    { 77, 99, 17756 },
+    { 39, 58, 17757 },
+    { 122, 128, 17759 },
+    { 13, 39, 17765 },
+    { 17, 34, 17765 },
+    { 122, 170, 17766 },
+    { 76, 102, 17769 },
+    { 154, 200, 17771 },
+    { 153, 200, 17773 },
+    { 77, 98, 17774 },
+    { 206, 213, 17775 },
+    { 182, 224, 17776 },
+    { 49, 70, 17777 },
+    { 73, 81, 17786 },
+    { 36, 52, 17795 },
+    { 77, 95, 17795 },
+    { 113, 179, 17795 },
+    { 39, 70, 17799 },
+    { 128, 160, 17801 },
+    { 28, 64, 17809 },
+    { 62, 89, 17809 },
+    { 3, 102, 17810 },
+    { 21, 45, 17815 },
+    { 81, 101, 17823 },
+    { 129, 166, 17830 },
+    { 182, 214, 17832 },
+    { 133, 148, 17839 },
+    { 180, 214, 17839 },
+    { 133, 197, 17842 },
+    { 3, 172, 17849 },
+    { 62, 93, 17852 },
+    { 155, 208, 17853 },
+    { 71, 75, 17855 },
+    { 192, 235, 17856 },
+    { 163, 181, 17861 },
+    { 163, 187, 17862 },
+    { 111, 138, 17864 },
+    { 152, 207, 17869 },
+    { 48, 57, 17872 },
+    { 231, 237, 17872 },
+    { 98, 116, 17875 },
+    { 6, 30, 17876 },
+    { 11, 37, 17883 },
+    { 19, 22, 17883 },
+    { 95, 156, 17883 },
+    { 169, 179, 17887 },
+    { 33, 47, 17888 },
+    { 19, 140, 17889 },
+    { 178, 221, 17897 },
+    { 209, 247, 17897 },
+    { 109, 155, 17898 },
+    { 154, 162, 17899 },
+    { 40, 75, 17900 },
+    { 153, 162, 17901 },
+    { 211, 234, 17901 },
+    { 143, 192, 17902 },
+    { 149, 192, 17903 },
+    { 180, 206, 17905 },
+    { 10, 28, 17907 },
+    { 31, 58, 17909 },
+    { 172, 182, 17913 },
+    { 151, 171, 17914 },
+    { 94, 172, 17917 },
+    { 22, 46, 17919 },
+    { 92, 134, 17921 },
+    { 148, 186, 17926 },
+    { 139, 164, 17934 },
+    { 176, 184, 17937 },
+    { 162, 204, 17944 },
+    { 162, 205, 17946 },
+    { 91, 111, 17949 },
+    { 117, 161, 17950 },
+    { 151, 158, 17958 },
+    { 62, 87, 17959 },
+    { 89, 130, 17959 },
+    { 121, 137, 17959 },
+    { 202, 214, 17961 },
+    { 112, 115, 17965 },
+    { 146, 178, 17965 },
+    { 108, 185, 17966 },
+    { 157, 188, 17976 },
+    { 167, 215, 17985 },
+    { 121, 152, 17986 },
+    { 143, 187, 18005 },
+    { 99, 156, 18011 },
+    { 154, 202, 18011 },
+    { 153, 202, 18013 },
+    { 125, 198, 18015 },
+    { 11, 43, 18020 },
+    { 85, 99, 18023 },
+    { 147, 204, 18024 },
+    { 2, 16, 18036 },
+    { 238, 241, 18038 },
+    { 178, 188, 18039 },
+    { 5, 25, 18040 },
+    { 108, 139, 18040 },
+    { 177, 211, 18048 },
+    { 124, 146, 18052 },
+    { 21, 44, 18057 },
+    { 82, 106, 18057 },
+    { 221, 244, 18062 },
+    { 107, 144, 18063 },
+    { 226, 237, 18067 },
+    { 121, 122, 18070 },
+    { 156, 207, 18070 },
+    { 76, 94, 18071 },
+    { 36, 44, 18075 },
+    { 183, 219, 18082 },
+    { 178, 206, 18083 },
+    { 37, 82, 18089 },
+    { 156, 186, 18089 },
+    { 227, 242, 18090 },
+    { 164, 200, 18091 },
+    { 74, 89, 18092 },
+    { 97, 147, 18093 },
+    { 71, 125, 18098 },
+    { 223, 244, 18098 },
+    { 109, 139, 18110 },
+    { 102, 185, 18111 },
+    { 39, 88, 18112 },
+    { 65, 69, 18112 },
+    { 49, 72, 18113 },
+    { 3, 156, 18116 },
+    { 194, 210, 18118 },
+    { 129, 170, 18129 },
+    { 139, 142, 18132 },
+    { 150, 159, 18139 },
+    { 9, 244, 18140 },
+    { 43, 50, 18140 },
+    { 228, 230, 18142 },
+    { 49, 65, 18143 },
+    { 225, 237, 18143 },
+    { 116, 124, 18148 },
+    { 38, 79, 18152 },
+    { 200, 214, 18152 },
+    { 206, 217, 18153 },
+    { 194, 228, 18159 },
+    { 138, 173, 18160 },
+    { 168, 217, 18165 },
+    { 56, 85, 18168 },
+    { 97, 143, 18169 },
+    { 27, 97, 18171 },
+    { 36, 82, 18172 },
+    { 195, 233, 18172 },
+    { 25, 34, 18176 },
+    { 163, 169, 18176 },
+    { 105, 172, 18182 },
+    { 229, 245, 18182 },
+    { 128, 133, 18184 },
+    { 168, 240, 18184 },
+    { 159, 196, 18186 },
+    { 166, 215, 18186 },
+    { 213, 226, 18188 },
+    { 189, 219, 18189 },
+    { 237, 254, 18195 },
+    { 131, 139, 18196 },
+    { 120, 170, 18197 },
+    { 27, 185, 18200 },
+    { 188, 220, 18205 },
+    { 148, 187, 18206 },
+    { 146, 182, 18210 },
+    { 169, 209, 18210 },
+    { 189, 223, 18211 },
+    { 130, 162, 18213 },
+    { 27, 67, 18222 },
+    { 102, 172, 18222 },
+    { 180, 188, 18229 },
+    { 93, 133, 18239 },
+    { 174, 197, 18241 },
+    { 122, 189, 18254 },
+    { 84, 98, 18255 },
+    { 181, 214, 18257 },
+    { 117, 167, 18258 },
+    { 142, 149, 18267 },
+    { 7, 20, 18271 },
+    { 73, 97, 18275 },
+    { 164, 202, 18277 },
+    { 28, 52, 18280 },
+    { 177, 200, 18284 },
+    { 2, 251, 18288 },
+    { 49, 85, 18288 },
+    { 156, 205, 18292 },
+    { 93, 130, 18293 },
+    { 110, 124, 18294 },
+    { 145, 181, 18296 },
+    { 183, 194, 18296 },
+    { 125, 197, 18297 },
+    { 147, 162, 18297 },
+    { 36, 55, 18298 },
+    { 78, 101, 18298 },
+    { 182, 206, 18301 },
+    { 20, 65, 18304 },
+    { 146, 180, 18308 },
+    { 63, 86, 18311 },
+    { 229, 236, 18314 },
+    { 91, 115, 18323 },
+    { 6, 17, 18328 },
+    { 18, 43, 18332 },
+    { 198, 248, 18336 },
+    { 67, 105, 18338 },
+    { 214, 220, 18342 },
+    { 141, 146, 18345 },
+    { 164, 186, 18352 },
+    { 177, 184, 18352 },
+    { 177, 202, 18353 },
+    { 33, 73, 18354 },
+    { 178, 214, 18356 },
+    { 2, 242, 18357 },
+    { 236, 255, 18358 },
+    { 184, 227, 18359 },
+    { 31, 62, 18363 },
+    { 27, 117, 18365 },
+    { 243, 254, 18369 },
+    { 54, 87, 18371 },
+    { 106, 111, 18383 },
+    { 171, 195, 18385 },
+    { 55, 77, 18386 },
+    { 33, 95, 18390 },
+    { 111, 135, 18393 },
+    { 6, 225, 18394 },
+    { 167, 191, 18399 },
+    { 171, 182, 18406 },
+    { 93, 129, 18407 },
+    { 144, 184, 18409 },
+    { 47, 85, 18417 },
+    { 68, 91, 18419 },
+    { 188, 217, 18429 },
+    { 102, 146, 18432 },
+    { 100, 115, 18433 },
+    { 120, 185, 18434 },
+    { 151, 194, 18437 },
+    { 19, 119, 18438 },
+    { 140, 169, 18439 },
+    { 76, 105, 18441 },
+    { 21, 24, 18445 },
+    { 13, 29, 18446 },
+    { 42, 46, 18459 },
+    { 42, 78, 18463 },
+    { 133, 138, 18464 },
+    { 178, 223, 18464 },
+    { 10, 247, 18465 },
+    { 126, 162, 18465 },
+    { 95, 164, 18467 },
+    { 190, 220, 18472 },
+    { 78, 96, 18473 },
+    { 180, 224, 18475 },
+    { 96, 123, 18476 },
+    { 35, 37, 18479 },
+    { 172, 215, 18487 },
+    { 156, 200, 18488 },
+    { 70, 74, 18492 },
+    { 41, 70, 18493 },
+    { 116, 126, 18497 },
+    { 140, 145, 18498 },
+    { 42, 77, 18499 },
+    { 113, 190, 18499 },
+    { 27, 164, 18505 },
+    { 232, 251, 18506 },
+    { 30, 50, 18511 },
+    { 83, 99, 18511 },
+    { 13, 225, 18512 },
+    { 72, 110, 18515 },
+    { 162, 208, 18518 },
+    { 237, 240, 18521 },
+    { 85, 95, 18522 },
+    { 3, 235, 18523 },
+    { 82, 103, 18523 },
+    { 157, 193, 18523 },
+    { 138, 174, 18528 },
+    { 35, 69, 18530 },
+    { 162, 207, 18531 },
+    { 140, 150, 18534 },
+    { 162, 189, 18535 },
+    { 174, 206, 18535 },
+    { 34, 49, 18536 },
+    { 124, 159, 18541 },
+    { 23, 53, 18542 },
+    { 150, 176, 18542 },
+    { 190, 233, 18550 },
+    { 145, 159, 18557 },
+    { 185, 215, 18557 },
+    { 126, 152, 18561 },
+    { 139, 174, 18561 },
+    { 141, 161, 18561 },
+    { 220, 239, 18568 },
+    { 173, 218, 18570 },
+    { 43, 92, 18573 },
+    { 244, 245, 18573 },
+    { 226, 238, 18576 },
+    { 193, 229, 18578 },
+    { 86, 122, 18581 },
+    { 5, 247, 18594 },
+    { 12, 71, 18594 },
+    { 174, 198, 18596 },
+    { 205, 214, 18599 },
+    { 197, 248, 18601 },
+    { 111, 115, 18603 },
+    { 175, 214, 18606 },
+    { 40, 78, 18609 },
+    { 108, 155, 18611 },
+    { 24, 53, 18614 },
+    { 51, 83, 18616 },
+    { 90, 116, 18620 },
+    { 188, 226, 18620 },
+    { 154, 173, 18621 },
+    { 153, 173, 18624 },
+    { 110, 164, 18626 },
+    { 171, 210, 18633 },
+    { 157, 163, 18637 },
+    { 152, 208, 18638 },
+    { 105, 185, 18639 },
+    { 175, 218, 18649 },
+    { 88, 165, 18651 },
+    { 29, 58, 18653 },
+    { 206, 231, 18657 },
+    { 172, 173, 18660 },
+    { 147, 186, 18661 },
+    { 20, 47, 18670 },
+    { 177, 216, 18671 },
+    { 217, 226, 18672 },
+    { 122, 138, 18673 },
+    { 93, 132, 18678 },
+    { 11, 29, 18681 },
+    { 106, 112, 18683 },
+    { 33, 84, 18689 },
+    { 56, 68, 18698 },
+    { 222, 236, 18705 },
+    { 184, 222, 18706 },
+    { 156, 202, 18707 },
+    { 81, 103, 18711 },
+    { 172, 180, 18711 },
+    { 75, 98, 18715 },
+    { 88, 140, 18717 },
+    { 100, 136, 18720 },
+    { 122, 148, 18724 },
+    { 3, 109, 18736 },
+    { 38, 83, 18736 },
+    { 135, 163, 18736 },
+    { 11, 17, 18737 },
+    { 18, 34, 18738 },
+    { 41, 83, 18740 },
+    { 81, 96, 18740 },
+    { 26, 255, 18744 },
+    { 224, 243, 18749 },
+    { 176, 211, 18750 },
+    { 175, 189, 18766 },
+    { 0, 23, 18771 },
+    { 143, 173, 18771 },
+    { 75, 97, 18773 },
+    { 118, 121, 18774 },
+    { 58, 59, 18776 },
+    { 157, 176, 18788 },
+    { 32, 76, 18793 },
+    { 33, 102, 18799 },
+    { 77, 78, 18800 },
+    { 162, 201, 18800 },
+    { 105, 139, 18802 },
+    { 30, 68, 18803 },
+    { 99, 164, 18804 },
+    { 174, 218, 18804 },
+    { 220, 231, 18805 },
+    { 87, 130, 18811 },
+    { 11, 225, 18813 },
+    { 163, 193, 18814 },
+    { 181, 222, 18821 },
+    { 99, 153, 18822 },
+    { 8, 250, 18825 },
+    { 99, 154, 18825 },
+    { 21, 48, 18829 },
+    { 151, 209, 18829 },
+    { 121, 133, 18830 },
+    { 219, 230, 18830 },
+    { 224, 241, 18830 },
+    { 29, 68, 18835 },
+    { 228, 250, 18838 },
+    { 83, 95, 18844 },
+    { 179, 194, 18844 },
+    { 196, 203, 18846 },
+    { 167, 183, 18848 },
+    { 28, 31, 18851 },
+    { 95, 153, 18853 },
+    { 32, 99, 18854 },
+    { 74, 98, 18855 },
+    { 95, 154, 18855 },
+    { 170, 177, 18868 },
+    { 8, 253, 18870 },
+    { 164, 208, 18875 },
+    { 216, 234, 18886 },
+    { 49, 66, 18888 },
+    { 166, 213, 18898 },
+    { 20, 41, 18907 },
+    { 37, 45, 18908 },
+    { 115, 145, 18909 },
+    { 41, 53, 18918 },
+    { 141, 160, 18919 },
+    { 114, 151, 18921 },
+    { 67, 104, 18922 },
+    { 71, 122, 18931 },
+    { 184, 228, 18936 },
+    { 169, 206, 18940 },
+    { 90, 111, 18941 },
+    { 28, 55, 18942 },
+    { 236, 242, 18942 },
+    { 73, 78, 18945 },
+    { 176, 200, 18945 },
+    { 186, 214, 18945 },
+    { 0, 238, 18947 },
+    { 167, 213, 18949 },
+    { 234, 252, 18953 },
+    { 86, 125, 18958 },
+    { 69, 90, 18968 },
+    { 154, 208, 18972 },
+    { 153, 208, 18974 },
+    { 139, 163, 18976 },
+    { 58, 62, 18977 },
+    { 165, 195, 18978 },
+    { 182, 188, 18979 },
+    { 111, 120, 18986 },
+    { 154, 182, 18989 },
+    { 153, 182, 18992 },
+    { 54, 89, 18994 },
+    { 6, 236, 18995 },
+    { 207, 214, 19002 },
+    { 206, 223, 19003 },
+    { 230, 236, 19008 },
+    { 138, 147, 19009 },
+    { 179, 220, 19010 },
+    { 43, 70, 19014 },
+    { 33, 104, 19018 },
+    { 176, 202, 19018 },
+    { 37, 70, 19021 },
+    { 193, 199, 19021 },
+    { 193, 209, 19023 },
+    { 223, 230, 19023 },
+    { 21, 30, 19025 },
+    { 48, 60, 19028 },
+    { 183, 224, 19029 },
+    { 146, 175, 19030 },
+    { 52, 77, 19033 },
+    { 111, 141, 19033 },
+    { 110, 149, 19038 },
+    { 110, 155, 19039 },
+    { 172, 178, 19040 },
+    { 7, 249, 19043 },
+    { 137, 159, 19054 },
+    { 230, 243, 19055 },
+    { 181, 210, 19056 },
+    { 160, 212, 19059 },
+    { 161, 183, 19064 },
+    { 136, 165, 19067 },
+    { 32, 97, 19071 },
+    { 21, 41, 19073 },
+    { 57, 93, 19075 },
+    { 161, 212, 19076 },
+    { 166, 177, 19082 },
+    { 132, 201, 19084 },
+    { 194, 226, 19090 },
+    { 40, 68, 19092 },
+    { 58, 75, 19092 },
+    { 71, 74, 19096 },
+    { 64, 90, 19097 },
+    { 175, 193, 19099 },
+    { 3, 87, 19100 },
+    { 152, 196, 19100 },
+    { 0, 24, 19103 },
+    { 47, 84, 19103 },
+    { 116, 142, 19106 },
+    { 100, 158, 19107 },
+    { 157, 179, 19107 },
+    { 16, 255, 19110 },
+    { 86, 120, 19110 },
+    { 115, 123, 19110 },
+    { 19, 199, 19113 },
+    { 37, 58, 19115 },
+    { 11, 39, 19122 },
+    { 32, 62, 19122 },
+    { 114, 158, 19129 },
+    { 173, 188, 19130 },
+    { 148, 176, 19133 },
+    { 6, 14, 19137 },
+    { 74, 87, 19154 },
+    { 130, 189, 19157 },
+    { 143, 186, 19161 },
+    { 136, 158, 19166 },
+    { 101, 119, 19167 },
+    { 106, 119, 19167 },
+    { 177, 213, 19168 },
+    { 17, 36, 19169 },
+    { 36, 40, 19169 },
+    { 127, 198, 19169 },
+    { 14, 34, 19173 },
+    { 21, 50, 19174 },
+    { 73, 95, 19175 },
+    { 191, 226, 19178 },
+    { 224, 234, 19179 },
+    { 90, 115, 19182 },
+    { 97, 156, 19183 },
+    { 13, 59, 19186 },
+    { 121, 159, 19186 },
+    { 149, 197, 19190 },
+    { 106, 136, 19192 },
+    { 27, 86, 19194 },
+    { 148, 177, 19200 },
+    { 116, 145, 19208 },
+    { 49, 78, 19234 },
+    { 67, 108, 19235 },
+    { 4, 32, 19238 },
+    { 150, 177, 19241 },
+    { 45, 74, 19244 },
+    { 71, 83, 19246 },
+    { 170, 176, 19247 },
+    { 181, 191, 19248 },
+    { 0, 13, 19250 },
+    { 146, 204, 19256 },
+    { 42, 81, 19257 },
+    { 19, 100, 19260 },
+    { 149, 198, 19264 },
+    { 144, 209, 19266 },
+    { 177, 208, 19270 },
+    { 55, 83, 19271 },
+    { 199, 247, 19272 },
+    { 119, 190, 19273 },
+    { 194, 229, 19274 },
+    { 239, 253, 19276 },
+    { 211, 226, 19278 },
+    { 161, 191, 19279 },
+    { 104, 155, 19284 },
+    { 124, 152, 19286 },
+    { 84, 117, 19288 },
+    { 86, 129, 19288 },
+    { 193, 230, 19290 },
+    { 92, 115, 19301 },
+    { 47, 70, 19307 },
+    { 5, 26, 19310 },
+    { 46, 56, 19313 },
+    { 155, 196, 19327 },
+    { 88, 255, 19328 },
+    { 28, 42, 19333 },
+    { 73, 99, 19335 },
+    { 76, 108, 19342 },
+    { 217, 240, 19342 },
+    { 223, 243, 19347 },
+    { 3, 198, 19350 },
+    { 141, 174, 19352 },
+    { 112, 151, 19355 },
+    { 72, 117, 19356 },
+    { 148, 156, 19362 },
+    { 155, 163, 19363 },
+    { 85, 111, 19365 },
+    { 41, 66, 19366 },
+    { 176, 216, 19367 },
+    { 45, 62, 19372 },
+    { 96, 118, 19373 },
+    { 138, 175, 19377 },
+    { 175, 197, 19377 },
+    { 117, 189, 19384 },
+    { 27, 125, 19391 },
+    { 0, 242, 19396 },
+    { 127, 197, 19397 },
+    { 52, 60, 19399 },
+    { 49, 81, 19406 },
+    { 141, 171, 19406 },
+    { 178, 224, 19408 },
+    { 21, 52, 19410 },
+    { 129, 201, 19412 },
+    { 166, 176, 19416 },
+    { 80, 106, 19419 },
+    { 92, 103, 19430 },
+    { 227, 239, 19430 },
+    { 22, 240, 19431 },
+    { 51, 76, 19433 },
+    { 161, 211, 19434 },
+    { 130, 141, 19438 },
+    { 33, 49, 19439 },
+    { 128, 166, 19451 },
+    { 170, 216, 19455 },
+    { 25, 53, 19457 },
+    { 16, 253, 19463 },
+    { 149, 201, 19463 },
+    { 219, 229, 19468 },
+    { 232, 252, 19468 },
+    { 30, 45, 19470 },
+    { 134, 199, 19472 },
+    { 183, 221, 19473 },
+    { 157, 177, 19478 },
+    { 172, 211, 19479 },
+    { 110, 126, 19483 },
+    { 19, 209, 19488 },
+    { 148, 183, 19490 },
+    { 160, 183, 19490 },
+    { 49, 53, 19492 },
+    { 35, 78, 19494 },
+    { 224, 244, 19494 },
+    { 16, 247, 19495 },
+    { 222, 242, 19503 },
+    { 141, 166, 19513 },
+    { 156, 208, 19514 },
+    { 160, 211, 19514 },
+    { 3, 65, 19515 },
+    { 217, 247, 19516 },
+    { 105, 155, 19518 },
+    { 237, 245, 19520 },
+    { 116, 119, 19522 },
+    { 144, 195, 19527 },
+    { 162, 172, 19533 },
+    { 163, 206, 19533 },
+    { 183, 223, 19535 },
+    { 4, 27, 19540 },
+    { 41, 65, 19541 },
+    { 154, 180, 19551 },
+    { 213, 231, 19552 },
+    { 153, 180, 19554 },
+    { 12, 252, 19555 },
+    { 168, 255, 19558 },
+    { 121, 155, 19559 },
+    { 44, 77, 19564 },
+    { 195, 236, 19566 },
+    { 118, 119, 19567 },
+    { 219, 244, 19569 },
+    { 32, 105, 19574 },
+    { 175, 203, 19574 },
+    { 111, 139, 19576 },
+    { 232, 246, 19576 },
+    { 141, 173, 19577 },
+    { 136, 179, 19580 },
+    { 112, 179, 19582 },
+    { 137, 169, 19583 },
+    { 199, 237, 19588 },
+    { 203, 209, 19588 },
+    { 218, 230, 19590 },
+    { 88, 101, 19593 },
+    { 40, 81, 19597 },
+    { 8, 17, 19601 },
+    { 32, 109, 19602 },
+    { 98, 115, 19604 },
+    { 168, 194, 19605 },
+    { 137, 163, 19607 },
+    { 46, 81, 19610 },
+    { 156, 234, 19611 },
+    { 160, 191, 19612 },
+    { 76, 110, 19614 },
+    { 60, 81, 19621 },
+    { 109, 152, 19626 },
+    { 209, 255, 19626 },
+    { 154, 178, 19629 },
+    { 113, 151, 19631 },
+    { 153, 178, 19631 },
+    { 168, 181, 19631 },
+    { 100, 144, 19633 },
+    { 134, 145, 19633 },
+    { 177, 205, 19638 },
+    { 32, 248, 19639 },
+    { 226, 233, 19647 },
+    { 122, 198, 19654 },
+    { 45, 59, 19659 },
+    { 49, 84, 19659 },
+    { 206, 221, 19660 },
+    { 140, 209, 19668 },
+    { 8, 37, 19673 },
+    { 14, 253, 19680 },
+    { 69, 91, 19684 },
+    { 173, 219, 19685 },
+    { 149, 185, 19694 },
+    { 33, 97, 19696 },
+    { 26, 61, 19701 },
+    { 55, 60, 19701 },
+    { 126, 143, 19701 },
+    { 171, 196, 19704 },
+    { 12, 65, 19705 },
+    { 187, 234, 19706 },
+    { 34, 47, 19709 },
+    { 19, 25, 19711 },
+    { 175, 219, 19714 },
+    { 131, 163, 19715 },
+    { 193, 196, 19715 },
+    { 48, 77, 19717 },
+    { 22, 247, 19718 },
+    { 174, 214, 19718 },
+    { 74, 90, 19722 },
+    { 15, 94, 19724 },
+    { 221, 246, 19725 },
+    { 223, 229, 19725 },
+    { 42, 67, 19726 },
+    { 86, 132, 19728 },
+    { 58, 73, 19730 },
+    { 141, 175, 19731 },
+    { 27, 79, 19732 },
+    { 124, 143, 19732 },
+    { 35, 43, 19733 },
+    { 33, 99, 19734 },
+    { 43, 58, 19737 },
+    { 147, 207, 19737 },
+    { 165, 247, 19738 },
+    { 147, 173, 19744 },
+    { 175, 198, 19746 },
+    { 137, 144, 19747 },
+    { 3, 197, 19751 },
+    { 8, 236, 19751 },
+    { 21, 36, 19753 },
+    { 3, 117, 19757 },
+    { 59, 96, 19757 },
+    { 21, 51, 19760 },
+    { 41, 72, 19767 },
+    { 45, 80, 19770 },
+    { 34, 38, 19774 },
+    { 110, 152, 19774 },
+    { 8, 43, 19777 },
+    { 118, 128, 19777 },
+    { 117, 166, 19778 },
+    { 228, 255, 19778 },
+    { 33, 41, 19779 },
+    { 86, 127, 19795 },
+    { 64, 69, 19801 },
+    { 147, 200, 19811 },
+    { 41, 79, 19812 },
+    { 45, 82, 19814 },
+    { 197, 224, 19817 },
+    { 29, 48, 19819 },
+    { 3, 125, 19823 },
+    { 139, 175, 19825 },
+    { 23, 35, 19826 },
+    { 110, 138, 19829 },
+    { 143, 204, 19829 },
+    { 121, 162, 19830 },
+    { 141, 155, 19832 },
+    { 179, 236, 19834 },
+    { 162, 197, 19836 },
+    { 60, 100, 19837 },
+    { 124, 127, 19837 },
+    { 241, 250, 19837 },
+    { 70, 75, 19844 },
+    { 75, 95, 19845 },
+    { 43, 45, 19846 },
+    { 87, 147, 19846 },
+    { 147, 205, 19846 },
+    { 1, 233, 19848 },
+    { 33, 77, 19852 },
+    { 145, 184, 19856 },
+    { 125, 128, 19862 },
+    { 169, 217, 19864 },
+    { 15, 72, 19866 },
+    { 51, 67, 19869 },
+    { 176, 213, 19872 },
+    { 142, 169, 19873 },
+    { 199, 203, 19876 },
+    { 157, 199, 19877 },
+    { 11, 14, 19878 },
+    { 124, 162, 19878 },
+    { 75, 99, 19879 },
+    { 216, 230, 19886 },
+    { 67, 109, 19887 },
+    { 173, 206, 19896 },
+    { 174, 219, 19897 },
+    { 158, 247, 19898 },
+    { 225, 227, 19898 },
+    { 42, 68, 19904 },
+    { 122, 197, 19906 },
+    { 139, 178, 19906 },
+    { 78, 103, 19907 },
+    { 189, 248, 19909 },
+    { 79, 117, 19911 },
+    { 85, 110, 19911 },
+    { 18, 253, 19912 },
+    { 134, 150, 19921 },
+    { 140, 225, 19921 },
+    { 156, 162, 19922 },
+    { 199, 255, 19923 },
+    { 114, 165, 19925 },
+    { 94, 146, 19940 },
+    { 52, 83, 19945 },
+    { 111, 130, 19948 },
+    { 168, 239, 19948 },
+    { 176, 208, 19950 },
+    { 131, 136, 19953 },
+    { 191, 197, 19954 },
+    { 28, 51, 19956 },
+    { 61, 69, 19957 },
+    { 125, 148, 19957 },
+    { 163, 210, 19959 },
+    { 136, 142, 19960 },
+    { 226, 243, 19960 },
+    { 143, 159, 19961 },
+    { 97, 153, 19962 },
+    { 97, 154, 19965 },
+    { 123, 157, 19965 },
+    { 28, 68, 19967 },
+    { 3, 108, 19974 },
+    { 4, 235, 19981 },
+    { 61, 90, 19981 },
+    { 71, 85, 19982 },
+    { 68, 88, 19983 },
+    { 65, 110, 19987 },
+    { 65, 117, 19992 },
+    { 106, 137, 19993 },
+    { 3, 105, 19994 },
+    { 99, 146, 19996 },
+    { 97, 164, 19997 },
+    { 142, 176, 19999 },
+    { 221, 243, 20002 },
+    { 15, 234, 20008 },
+    { 50, 74, 20008 },
+    { 133, 201, 20009 },
+    { 115, 134, 20014 },
+    { 179, 181, 20020 },
+    { 62, 81, 20023 },
+    { 21, 55, 20025 },
+    { 33, 75, 20027 },
+    { 20, 49, 20036 },
+    { 42, 76, 20037 },
+    { 21, 38, 20038 },
+    { 131, 149, 20038 },
+    { 11, 253, 20039 },
+    { 209, 222, 20047 },
+    { 229, 243, 20049 },
+    { 1, 30, 20052 },
+    { 29, 66, 20052 },
+    { 12, 234, 20057 },
+    { 128, 147, 20057 },
+    { 121, 161, 20058 },
+    { 206, 215, 20058 },
+    { 147, 202, 20060 },
+    { 203, 216, 20060 },
+    { 4, 234, 20062 },
+    { 36, 51, 20063 },
+    { 164, 212, 20063 },
+    { 201, 248, 20069 },
+    { 223, 246, 20073 },
+    { 64, 92, 20078 },
+    { 185, 211, 20084 },
+    { 138, 154, 20087 },
+    { 162, 198, 20087 },
+    { 0, 22, 20088 },
+    { 138, 153, 20088 },
+    { 215, 226, 20089 },
+    { 32, 108, 20096 },
+    { 146, 200, 20097 },
+    { 226, 245, 20100 },
+    { 92, 140, 20101 },
+    { 20, 71, 20106 },
+    { 208, 232, 20108 },
+    { 128, 167, 20109 },
+    { 101, 113, 20114 },
+    { 56, 79, 20116 },
+    { 162, 211, 20117 },
+    { 219, 222, 20118 },
+    { 169, 183, 20125 },
+    { 3, 20, 20126 },
+    { 13, 17, 20132 },
+    { 40, 77, 20136 },
+    { 198, 224, 20139 },
+    { 137, 171, 20140 },
+    { 114, 168, 20143 },
+    { 3, 189, 20145 },
+    { 121, 160, 20146 },
+    { 171, 214, 20146 },
+    { 20, 67, 20151 },
+    { 165, 228, 20151 },
+    { 64, 91, 20152 },
+    { 164, 248, 20158 },
+    { 69, 93, 20160 },
+    { 189, 191, 20164 },
+    { 71, 133, 20165 },
+    { 76, 104, 20165 },
+    { 216, 222, 20165 },
+    { 241, 253, 20167 },
+    { 149, 200, 20168 },
+    { 194, 230, 20171 },
+    { 177, 192, 20172 },
+    { 11, 250, 20173 },
+    { 3, 153, 20175 },
+    { 69, 98, 20175 },
+    { 87, 156, 20175 },
+    { 150, 188, 20175 },
+    { 115, 142, 20176 },
+    { 3, 154, 20177 },
+    { 108, 152, 20178 },
+    { 100, 103, 20179 },
+    { 103, 131, 20180 },
+    { 74, 97, 20184 },
+    { 161, 215, 20185 },
+    { 218, 229, 20188 },
+    { 3, 95, 20189 },
+    { 159, 188, 20190 },
+    { 160, 215, 20190 },
+    { 27, 156, 20193 },
+    { 16, 21, 20196 },
+    { 149, 204, 20196 },
+    { 31, 69, 20197 },
+    { 238, 240, 20197 },
+    { 73, 98, 20203 },
+    { 179, 247, 20206 },
+    { 32, 84, 20208 },
+    { 29, 44, 20214 },
+    { 116, 121, 20217 },
+    { 37, 92, 20219 },
+    { 60, 96, 20220 },
+    { 221, 230, 20221 },
+    { 44, 60, 20223 },
+    { 42, 83, 20226 },
+    { 168, 228, 20227 },
+    { 74, 91, 20234 },
+    { 63, 64, 20235 },
+    { 173, 221, 20237 },
+    { 188, 227, 20240 },
+    { 91, 107, 20241 },
+    { 159, 192, 20242 },
+    { 201, 210, 20249 },
+    { 57, 95, 20253 },
+    { 28, 66, 20254 },
+    { 61, 63, 20254 },
+    { 113, 255, 20255 },
+    { 57, 97, 20257 },
+    { 89, 147, 20260 },
+    { 7, 12, 20263 },
+    { 80, 103, 20264 },
+    { 135, 139, 20265 },
+    { 71, 127, 20268 },
+    { 155, 212, 20275 },
+    { 64, 96, 20278 },
+    { 75, 90, 20282 },
+    { 45, 54, 20285 },
+    { 121, 125, 20287 },
+    { 191, 194, 20290 },
+    { 126, 127, 20299 },
+    { 176, 205, 20305 },
+    { 26, 64, 20312 },
+    { 53, 63, 20313 },
+    { 76, 109, 20323 },
+    { 14, 254, 20331 },
+    { 62, 97, 20331 },
+    { 143, 174, 20331 },
+    { 187, 214, 20334 },
+    { 126, 145, 20337 },
+    { 66, 96, 20338 },
+    { 163, 203, 20340 },
+    { 7, 21, 20347 },
+    { 117, 170, 20347 },
+    { 154, 174, 20350 },
+    { 66, 74, 20352 },
+    { 153, 174, 20352 },
+    { 172, 235, 20358 },
+    { 148, 171, 20362 },
+    { 218, 244, 20364 },
+    { 87, 164, 20365 },
+    { 156, 173, 20365 },
+    { 177, 207, 20369 },
+    { 106, 131, 20370 },
+    { 8, 29, 20371 },
+    { 137, 148, 20371 },
+    { 191, 198, 20377 },
+    { 216, 229, 20384 },
+    { 146, 202, 20388 },
+    { 143, 182, 20389 },
+    { 148, 172, 20395 },
+    { 20, 72, 20401 },
+    { 172, 213, 20402 },
+    { 117, 121, 20407 },
+    { 172, 174, 20409 },
+    { 223, 241, 20409 },
+    { 117, 128, 20412 },
+    { 10, 21, 20420 },
+    { 24, 35, 20420 },
+    { 186, 206, 20421 },
+    { 51, 85, 20423 },
+    { 156, 182, 20423 },
+    { 143, 178, 20426 },
+    { 182, 185, 20427 },
+    { 70, 83, 20428 },
+    { 126, 161, 20433 },
+    { 203, 224, 20435 },
+    { 145, 176, 20438 },
+    { 148, 192, 20438 },
+    { 47, 66, 20440 },
+    { 77, 90, 20440 },
+    { 125, 138, 20441 },
+    { 190, 194, 20444 },
+    { 35, 59, 20447 },
+    { 220, 247, 20448 },
+    { 139, 189, 20449 },
+    { 183, 201, 20453 },
+    { 100, 165, 20458 },
+    { 5, 30, 20459 },
+    { 29, 40, 20462 },
+    { 149, 202, 20466 },
+    { 109, 160, 20473 },
+    { 1, 228, 20474 },
+    { 39, 92, 20474 },
+    { 115, 124, 20481 },
+    { 237, 241, 20484 },
+    { 29, 52, 20486 },
+    { 76, 98, 20487 },
+    { 227, 247, 20494 },
+    { 54, 93, 20497 },
+    { 134, 169, 20503 },
+    { 90, 107, 20505 },
+    { 172, 196, 20505 },
+    { 112, 116, 20510 },
+    { 165, 217, 20512 },
+    { 203, 231, 20515 },
+    { 32, 38, 20516 },
+    { 86, 133, 20516 },
+    { 191, 222, 20517 },
+    { 17, 37, 20523 },
+    { 22, 34, 20523 },
+    { 147, 182, 20523 },
+    { 109, 149, 20528 },
+    { 142, 177, 20528 },
+    { 172, 248, 20531 },
+    { 139, 180, 20539 },
+    { 196, 226, 20540 },
+    { 163, 200, 20542 },
+    { 142, 151, 20543 },
+    { 119, 157, 20545 },
+    { 126, 155, 20553 },
+    { 219, 243, 20553 },
+    { 117, 198, 20555 },
+    { 159, 200, 20559 },
+    { 218, 222, 20568 },
+    { 222, 241, 20569 },
+    { 158, 195, 20573 },
+    { 231, 233, 20577 },
+    { 188, 216, 20579 },
+    { 43, 100, 20581 },
+    { 7, 254, 20582 },
+    { 131, 157, 20582 },
+    { 27, 234, 20584 },
+    { 175, 221, 20587 },
+    { 8, 14, 20594 },
+    { 9, 251, 20594 },
+    { 47, 78, 20599 },
+    { 179, 233, 20601 },
+    { 95, 146, 20602 },
+    { 122, 124, 20604 },
+    { 45, 75, 20607 },
+    { 112, 190, 20611 },
+    { 68, 101, 20613 },
+    { 5, 29, 20618 },
+    { 174, 193, 20622 },
+    { 174, 221, 20622 },
+    { 126, 160, 20623 },
+    { 89, 143, 20626 },
+    { 146, 205, 20630 },
+    { 70, 96, 20631 },
+    { 128, 163, 20631 },
+    { 135, 151, 20632 },
+    { 41, 78, 20633 },
+    { 59, 78, 20633 },
+    { 113, 115, 20633 },
+    { 126, 163, 20633 },
+    { 17, 39, 20634 },
+    { 181, 227, 20634 },
+    { 27, 57, 20636 },
+    { 48, 83, 20638 },
+    { 152, 183, 20638 },
+    { 204, 214, 20640 },
+    { 6, 29, 20642 },
+    { 143, 180, 20642 },
+    { 173, 214, 20650 },
+    { 1, 17, 20652 },
+    { 12, 244, 20653 },
+    { 17, 253, 20655 },
+    { 53, 69, 20658 },
+    { 4, 33, 20659 },
+    { 125, 201, 20665 },
+    { 170, 218, 20669 },
+    { 114, 137, 20670 },
+    { 106, 135, 20671 },
+    { 47, 81, 20673 },
+    { 161, 177, 20678 },
+    { 1, 238, 20679 },
+    { 98, 121, 20686 },
+    { 138, 178, 20686 },
+    { 141, 170, 20687 },
+    { 21, 53, 20690 },
+    { 61, 92, 20695 },
+    { 185, 213, 20701 },
+    { 166, 216, 20703 },
+    { 19, 144, 20705 },
+    { 139, 187, 20707 },
+    { 13, 36, 20711 },
+    { 16, 34, 20711 },
+    { 225, 238, 20714 },
+    { 38, 84, 20721 },
+    { 115, 126, 20722 },
+    { 50, 62, 20724 },
+    { 75, 91, 20725 },
+    { 163, 202, 20725 },
+    { 104, 139, 20726 },
+    { 154, 212, 20731 },
+    { 153, 212, 20733 },
+    { 134, 225, 20736 },
+    { 44, 83, 20744 },
+    { 0, 245, 20746 },
+    { 188, 229, 20748 },
+    { 100, 116, 20751 },
+    { 1, 237, 20756 },
+    { 19, 26, 20756 },
+    { 68, 100, 20756 },
+    { 77, 91, 20759 },
+    { 3, 147, 20764 },
+    { 222, 223, 20768 },
+    { 26, 88, 20771 },
+    { 108, 149, 20777 },
+    { 33, 74, 20778 },
+    { 128, 170, 20778 },
+    { 146, 207, 20778 },
+    { 187, 235, 20779 },
+    { 87, 143, 20781 },
+    { 55, 76, 20785 },
+    { 176, 192, 20786 },
+    { 41, 61, 20788 },
+    { 41, 85, 20788 },
+    { 36, 42, 20789 },
+    { 62, 78, 20789 },
+    { 142, 175, 20789 },
+    { 159, 202, 20793 },
+    { 177, 218, 20794 },
+    { 13, 88, 20795 },
+    { 120, 189, 20801 },
+    { 177, 215, 20801 },
+    { 139, 182, 20803 },
+    { 140, 184, 20803 },
+    { 62, 95, 20805 },
+    { 16, 250, 20807 },
+    { 49, 61, 20812 },
+    { 102, 155, 20815 },
+    { 206, 208, 20818 },
+    { 54, 58, 20822 },
+    { 240, 250, 20825 },
+    { 146, 163, 20826 },
+    { 165, 184, 20826 },
+    { 38, 85, 20828 },
+    { 27, 249, 20835 },
+    { 2, 6, 20840 },
+    { 142, 174, 20841 },
+    { 81, 106, 20845 },
+    { 133, 162, 20850 },
+    { 130, 198, 20851 },
+    { 169, 190, 20851 },
+    { 90, 92, 20854 },
+    { 173, 223, 20855 },
+    { 153, 234, 20856 },
+    { 154, 234, 20856 },
+    { 150, 168, 20858 },
+    { 117, 197, 20859 },
+    { 209, 238, 20864 },
+    { 202, 206, 20867 },
+    { 175, 181, 20869 },
+    { 227, 250, 20878 },
+    { 16, 59, 20880 },
+    { 150, 194, 20886 },
+    { 131, 162, 20887 },
+    { 194, 233, 20897 },
+    { 7, 244, 20899 },
+    { 97, 146, 20902 },
+    { 167, 216, 20907 },
+    { 98, 124, 20908 },
+    { 167, 177, 20908 },
+    { 221, 229, 20917 },
+    { 30, 58, 20918 },
+    { 214, 217, 20918 },
+    { 8, 39, 20919 },
+    { 68, 69, 20923 },
+    { 109, 161, 20923 },
+    { 22, 88, 20926 },
+    { 215, 231, 20931 },
+    { 13, 158, 20932 },
+    { 30, 66, 20934 },
+    { 18, 46, 20936 },
+    { 115, 144, 20937 },
+    { 45, 73, 20939 },
+    { 96, 134, 20942 },
+    { 184, 214, 20946 },
+    { 127, 162, 20949 },
+    { 55, 85, 20951 },
+    { 110, 172, 20952 },
+    { 207, 232, 20956 },
+    { 161, 176, 20959 },
+    { 132, 192, 20960 },
+    { 116, 141, 20964 },
+    { 141, 167, 20965 },
+    { 39, 48, 20967 },
+    { 47, 86, 20973 },
+    { 20, 62, 20974 },
+    { 102, 139, 20977 },
+    { 147, 178, 20979 },
+    { 232, 234, 20981 },
+    { 47, 53, 20982 },
+    { 200, 206, 20984 },
+    { 5, 28, 20985 },
+    { 6, 37, 20985 },
+    { 211, 231, 20989 },
+    { 147, 180, 20995 },
+    { 161, 213, 20995 },
+    { 57, 99, 20996 },
+    { 70, 73, 20996 },
+    { 130, 197, 21000 },
+    { 164, 182, 21010 },
+    { 120, 162, 21012 },
+    { 26, 68, 21016 },
+    { 175, 223, 21021 },
+    { 178, 193, 21024 },
+    { 215, 244, 21024 },
+    { 19, 92, 21025 },
+    { 21, 46, 21025 },
+    { 156, 212, 21025 },
+    { 11, 59, 21031 },
+    { 41, 81, 21034 },
+    { 98, 118, 21035 },
+    { 176, 207, 21037 },
+    { 61, 91, 21040 },
+    { 86, 98, 21041 },
+    { 77, 102, 21044 },
+    { 206, 212, 21045 },
+    { 104, 189, 21050 },
+    { 14, 36, 21052 },
+    { 89, 156, 21052 },
+    { 91, 92, 21052 },
+    { 135, 171, 21053 },
+    { 177, 204, 21056 },
+    { 160, 213, 21058 },
+    { 180, 203, 21060 },
+    { 31, 33, 21062 },
+    { 156, 180, 21063 },
+    { 174, 203, 21064 },
+    { 177, 212, 21064 },
+    { 163, 192, 21065 },
+    { 130, 159, 21067 },
+    { 241, 246, 21068 },
+    { 149, 205, 21069 },
+    { 7, 243, 21070 },
+    { 105, 152, 21074 },
+    { 147, 208, 21075 },
+    { 0, 25, 21076 },
+    { 35, 81, 21076 },
+    { 49, 64, 21082 },
+    { 83, 110, 21082 },
+    { 178, 203, 21084 },
+    { 115, 140, 21090 },
+    { 183, 184, 21090 },
+    { 139, 186, 21093 },
+    { 67, 110, 21106 },
+    { 61, 96, 21111 },
+    { 124, 155, 21111 },
+    { 29, 55, 21112 },
+    { 25, 88, 21114 },
+    { 184, 225, 21116 },
+    { 226, 228, 21117 },
+    { 133, 192, 21121 },
+    { 155, 211, 21121 },
+    { 103, 135, 21126 },
+    { 145, 177, 21128 },
+    { 70, 85, 21138 },
+    { 157, 203, 21139 },
+    { 180, 193, 21139 },
+    { 119, 145, 21141 },
+    { 143, 200, 21143 },
+    { 174, 223, 21144 },
+    { 109, 167, 21150 },
+    { 160, 177, 21151 },
+    { 235, 251, 21151 },
+    { 97, 111, 21156 },
+    { 24, 255, 21160 },
+    { 33, 105, 21160 },
+    { 122, 126, 21161 },
+    { 27, 172, 21162 },
+    { 118, 144, 21165 },
+    { 108, 160, 21167 },
+    { 135, 162, 21169 },
+    { 55, 82, 21170 },
+    { 41, 64, 21171 },
+    { 205, 232, 21171 },
+    { 144, 225, 21174 },
+    { 3, 72, 21175 },
+    { 17, 35, 21180 },
+    { 152, 191, 21192 },
+    { 141, 143, 21204 },
+    { 31, 53, 21206 },
+    { 186, 234, 21207 },
+    { 156, 178, 21214 },
+    { 27, 122, 21219 },
+    { 144, 181, 21224 },
+    { 233, 255, 21226 },
+    { 152, 212, 21228 },
+    { 27, 54, 21234 },
+    { 33, 63, 21239 },
+    { 138, 145, 21239 },
+    { 58, 77, 21245 },
+    { 148, 189, 21246 },
+    { 124, 161, 21249 },
+    { 6, 43, 21258 },
+    { 62, 99, 21258 },
+    { 7, 14, 21261 },
+    { 34, 78, 21261 },
+    { 74, 95, 21262 },
+    { 99, 139, 21265 },
+    { 108, 121, 21265 },
+    { 236, 254, 21268 },
+    { 167, 176, 21270 },
+    { 212, 244, 21270 },
+    { 124, 133, 21271 },
+    { 141, 176, 21273 },
+    { 9, 234, 21277 },
+    { 45, 57, 21277 },
+    { 103, 137, 21277 },
+    { 162, 212, 21277 },
+    { 111, 137, 21286 },
+    { 115, 150, 21288 },
+    { 120, 141, 21289 },
+    { 52, 82, 21291 },
+    { 58, 83, 21291 },
+    { 189, 224, 21291 },
+    { 195, 237, 21291 },
+    { 15, 104, 21292 },
+    { 158, 228, 21292 },
+    { 58, 90, 21293 },
+    { 74, 99, 21293 },
+    { 228, 253, 21295 },
+    { 7, 245, 21298 },
+    { 195, 214, 21298 },
+    { 106, 113, 21299 },
+    { 104, 152, 21303 },
+    { 149, 183, 21315 },
+    { 219, 241, 21316 },
+    { 36, 78, 21317 },
+    { 121, 147, 21319 },
+    { 140, 195, 21319 },
+    { 76, 81, 21320 },
+    { 221, 241, 21329 },
+    { 110, 160, 21337 },
+    { 48, 82, 21343 },
+    { 180, 185, 21346 },
+    { 35, 54, 21348 },
+    { 188, 230, 21353 },
+    { 134, 209, 21354 },
+    { 203, 228, 21354 },
+    { 72, 129, 21356 },
+    { 139, 185, 21356 },
+    { 118, 157, 21362 },
+    { 71, 120, 21363 },
+    { 101, 136, 21363 },
+    { 1, 14, 21369 },
+    { 32, 73, 21369 },
+    { 16, 46, 21372 },
+    { 56, 84, 21375 },
+    { 118, 123, 21377 },
+    { 129, 192, 21381 },
+    { 77, 105, 21382 },
+    { 87, 153, 21388 },
+    { 112, 118, 21388 },
+    { 52, 76, 21389 },
+    { 93, 121, 21389 },
+    { 87, 154, 21390 },
+    { 101, 123, 21394 },
+    { 124, 160, 21399 },
+    { 27, 133, 21401 },
+    { 92, 116, 21402 },
+    { 50, 75, 21405 },
+    { 123, 145, 21411 },
+    { 198, 246, 21411 },
+    { 149, 207, 21417 },
+    { 164, 215, 21417 },
+    { 143, 202, 21419 },
+    { 96, 136, 21426 },
+    { 141, 157, 21428 },
+    { 150, 195, 21428 },
+    { 106, 123, 21429 },
+    { 199, 222, 21430 },
+    { 13, 14, 21431 },
+    { 147, 174, 21432 },
+    { 66, 92, 21434 },
+    { 15, 87, 21439 },
+    { 160, 176, 21439 },
+    { 4, 243, 21443 },
+    { 143, 205, 21446 },
+    { 32, 129, 21447 },
+    { 212, 226, 21447 },
+    { 101, 111, 21448 },
+    { 176, 195, 21451 },
+    { 83, 111, 21452 },
+    { 56, 72, 21453 },
+    { 35, 62, 21460 },
+    { 38, 70, 21460 },
+    { 0, 237, 21464 },
+    { 195, 229, 21467 },
+    { 143, 207, 21470 },
+    { 231, 251, 21483 },
+    { 220, 240, 21484 },
+    { 39, 52, 21485 },
+    { 127, 201, 21486 },
+    { 40, 67, 21487 },
+    { 155, 215, 21489 },
+    { 176, 218, 21489 },
+    { 5, 21, 21491 },
+    { 164, 173, 21491 },
+    { 95, 185, 21492 },
+    { 150, 193, 21496 },
+    { 3, 99, 21498 },
+    { 7, 246, 21501 },
+    { 176, 215, 21502 },
+    { 219, 246, 21502 },
+    { 84, 120, 21503 },
+    { 77, 110, 21504 },
+    { 118, 151, 21504 },
+    { 3, 133, 21506 },
+    { 2, 21, 21510 },
+    { 95, 172, 21512 },
+    { 109, 189, 21514 },
+    { 149, 196, 21515 },
+    { 170, 221, 21516 },
+    { 188, 211, 21516 },
+    { 65, 129, 21523 },
+    { 151, 193, 21523 },
+    { 25, 61, 21526 },
+    { 63, 93, 21526 },
+    { 175, 224, 21527 },
+    { 84, 122, 21530 },
+    { 142, 173, 21531 },
+    { 80, 112, 21533 },
+    { 96, 98, 21539 },
+    { 21, 49, 21540 },
+    { 85, 105, 21542 },
+    { 135, 149, 21544 },
+    { 3, 244, 21547 },
+    { 196, 232, 21550 },
+    { 63, 90, 21551 },
+    { 84, 111, 21551 },
+    { 22, 239, 21553 },
+    { 114, 145, 21556 },
+    { 138, 180, 21556 },
+    { 197, 246, 21556 },
+    { 11, 236, 21557 },
+    { 212, 246, 21557 },
+    { 21, 58, 21558 },
+    { 203, 218, 21558 },
+    { 103, 124, 21567 },
+    { 132, 148, 21570 },
+    { 157, 159, 21570 },
+    { 10, 255, 21571 },
+    { 92, 136, 21572 },
+    { 24, 61, 21573 },
+    { 33, 109, 21581 },
+    { 55, 67, 21583 },
+    { 192, 214, 21585 },
+    { 116, 123, 21591 },
+    { 89, 164, 21593 },
+    { 57, 58, 21594 },
+    { 34, 80, 21596 },
+    { 108, 161, 21599 },
+    { 79, 98, 21604 },
+    { 182, 203, 21604 },
+    { 128, 154, 21606 },
+    { 128, 153, 21607 },
+    { 164, 235, 21608 },
+    { 123, 199, 21610 },
+    { 70, 77, 21613 },
+    { 118, 134, 21614 },
+    { 0, 239, 21621 },
+    { 26, 35, 21621 },
+    { 105, 149, 21624 },
+    { 233, 254, 21625 },
+    { 152, 211, 21626 },
+    { 202, 232, 21627 },
+    { 177, 219, 21628 },
+    { 52, 85, 21629 },
+    { 80, 114, 21631 },
+    { 54, 95, 21632 },
+    { 55, 80, 21635 },
+    { 242, 252, 21639 },
+    { 18, 250, 21640 },
+    { 38, 71, 21646 },
+    { 126, 133, 21648 },
+    { 157, 209, 21648 },
+    { 44, 76, 21650 },
+    { 77, 94, 21651 },
+    { 235, 241, 21651 },
+    { 48, 80, 21653 },
+    { 218, 243, 21653 },
+    { 141, 177, 21655 },
+    { 1, 190, 21656 },
+    { 110, 161, 21657 },
+    { 215, 246, 21657 },
+    { 105, 121, 21661 },
+    { 78, 106, 21665 },
+    { 34, 63, 21672 },
+    { 54, 97, 21672 },
+    { 116, 150, 21675 },
+    { 52, 80, 21680 },
+    { 148, 164, 21681 },
+    { 57, 94, 21684 },
+    { 23, 61, 21687 },
+    { 62, 70, 21689 },
+    { 124, 145, 21694 },
+    { 63, 68, 21698 },
+    { 176, 204, 21704 },
+    { 28, 70, 21711 },
+    { 234, 243, 21712 },
+    { 99, 111, 21713 },
+    { 0, 236, 21714 },
+    { 117, 138, 21715 },
+    { 11, 36, 21717 },
+    { 47, 71, 21719 },
+    { 66, 75, 21719 },
+    { 188, 199, 21721 },
+    { 19, 43, 21725 },
+    { 21, 56, 21726 },
+    { 40, 83, 21727 },
+    { 162, 164, 21728 },
+    { 15, 252, 21729 },
+    { 22, 53, 21732 },
+    { 116, 128, 21745 },
+    { 203, 219, 21745 },
+    { 51, 60, 21747 },
+    { 185, 246, 21751 },
+    { 29, 70, 21753 },
+    { 91, 118, 21754 },
+    { 170, 219, 21759 },
+    { 176, 212, 21760 },
+    { 231, 244, 21763 },
+    { 49, 86, 21764 },
+    { 99, 172, 21764 },
+    { 123, 225, 21766 },
+    { 25, 240, 21767 },
+    { 164, 180, 21767 },
+    { 146, 208, 21770 },
+    { 40, 76, 21772 },
+    { 82, 114, 21772 },
+    { 173, 185, 21773 },
+    { 232, 249, 21773 },
+    { 111, 142, 21779 },
+    { 162, 213, 21779 },
+    { 228, 242, 21780 },
+    { 206, 232, 21781 },
+    { 177, 195, 21782 },
+    { 21, 47, 21784 },
+    { 104, 198, 21785 },
+    { 133, 187, 21785 },
+    { 108, 128, 21794 },
+    { 32, 47, 21797 },
+    { 171, 186, 21798 },
+    { 205, 206, 21799 },
+    { 151, 188, 21801 },
+    { 185, 221, 21807 },
+    { 16, 240, 21809 },
+    { 203, 211, 21811 },
+    { 33, 108, 21812 },
+    { 178, 185, 21814 },
+    { 182, 193, 21814 },
+    { 11, 28, 21815 },
+    { 193, 216, 21817 },
+    { 17, 254, 21818 },
+    { 56, 65, 21823 },
+    { 3, 89, 21830 },
+    { 172, 175, 21830 },
+    { 118, 138, 21839 },
+    { 190, 227, 21842 },
+    { 143, 175, 21843 },
+    { 13, 165, 21849 },
+    { 104, 160, 21852 },
+    { 186, 188, 21852 },
+    { 154, 175, 21863 },
+    { 13, 28, 21865 },
+    { 153, 175, 21866 },
+    { 221, 222, 21875 },
+    { 142, 152, 21878 },
+    { 149, 177, 21879 },
+    { 94, 155, 21880 },
+    { 97, 139, 21881 },
+    { 145, 168, 21882 },
+    { 92, 158, 21883 },
+    { 210, 227, 21885 },
+    { 15, 67, 21887 },
+    { 148, 196, 21890 },
+    { 36, 88, 21901 },
+    { 8, 158, 21902 },
+    { 85, 102, 21903 },
+    { 173, 224, 21903 },
+    { 174, 224, 21904 },
+    { 50, 73, 21906 },
+    { 188, 209, 21906 },
+    { 203, 213, 21909 },
+    { 39, 44, 21911 },
+    { 86, 130, 21917 },
+    { 117, 148, 21926 },
+    { 200, 232, 21926 },
+    { 12, 72, 21931 },
+    { 72, 132, 21934 },
+    { 121, 166, 21936 },
+    { 159, 205, 21936 },
+    { 39, 55, 21937 },
+    { 168, 220, 21938 },
+    { 2, 238, 21943 },
+    { 152, 177, 21947 },
+    { 162, 215, 21948 },
+    { 123, 150, 21951 },
+    { 88, 144, 21952 },
+    { 166, 218, 21954 },
+    { 186, 235, 21954 },
+    { 27, 246, 21958 },
+    { 119, 150, 21959 },
+    { 41, 84, 21960 },
+    { 149, 176, 21961 },
+    { 14, 250, 21963 },
+    { 73, 90, 21964 },
+    { 30, 80, 21965 },
+    { 141, 178, 21968 },
+    { 44, 67, 21969 },
+    { 167, 218, 21971 },
+    { 139, 192, 21975 },
+    { 158, 217, 21978 },
+    { 138, 156, 21979 },
+    { 251, 253, 21979 },
+    { 6, 233, 21981 },
+    { 163, 205, 21981 },
+    { 1, 2, 21987 },
+    { 108, 167, 21989 },
+    { 3, 122, 21993 },
+    { 98, 110, 21996 },
+    { 40, 60, 21997 },
+    { 1, 158, 22004 },
+    { 70, 101, 22005 },
+    { 148, 191, 22008 },
+    { 155, 191, 22008 },
+    { 50, 54, 22011 },
+    { 5, 238, 22015 },
+    { 89, 153, 22015 },
+    { 188, 213, 22016 },
+    { 113, 225, 22017 },
+    { 89, 154, 22018 },
+    { 99, 185, 22020 },
+    { 241, 249, 22029 },
+    { 159, 169, 22030 },
+    { 149, 208, 22033 },
+    { 183, 226, 22033 },
+    { 148, 200, 22036 },
+    { 15, 57, 22037 },
+    { 72, 125, 22037 },
+    { 48, 76, 22043 },
+    { 164, 178, 22043 },
+    { 126, 166, 22045 },
+    { 25, 247, 22046 },
+    { 155, 183, 22049 },
+    { 17, 43, 22059 },
+    { 64, 88, 22060 },
+    { 193, 228, 22068 },
+    { 15, 54, 22070 },
+    { 183, 222, 22070 },
+    { 20, 42, 22074 },
+    { 71, 164, 22074 },
+    { 105, 160, 22074 },
+    { 32, 117, 22080 },
+    { 247, 254, 22080 },
+    { 218, 246, 22081 },
+    { 43, 255, 22083 },
+    { 154, 215, 22083 },
+    { 126, 150, 22085 },
+    { 153, 215, 22085 },
+    { 109, 121, 22086 },
+    { 137, 140, 22088 },
+    { 52, 67, 22093 },
+    { 212, 248, 22094 },
+    { 107, 158, 22095 },
+    { 163, 208, 22098 },
+    { 23, 50, 22099 },
+    { 32, 132, 22103 },
+    { 63, 71, 22107 },
+    { 83, 105, 22107 },
+    { 38, 53, 22108 },
+    { 156, 174, 22108 },
+    { 18, 59, 22110 },
+    { 23, 255, 22115 },
+    { 10, 239, 22116 },
+    { 82, 98, 22117 },
+    { 122, 201, 22117 },
+    { 25, 64, 22125 },
+    { 162, 210, 22125 },
+    { 130, 173, 22130 },
+    { 78, 92, 22131 },
+    { 125, 192, 22133 },
+    { 187, 206, 22133 },
+    { 65, 132, 22134 },
+    { 33, 93, 22139 },
+    { 15, 244, 22140 },
+    { 46, 88, 22140 },
+    { 201, 246, 22146 },
+    { 27, 147, 22148 },
+    { 42, 85, 22149 },
+    { 224, 246, 22150 },
+    { 9, 235, 22151 },
+    { 84, 125, 22154 },
+    { 185, 196, 22155 },
+    { 213, 230, 22156 },
+    { 104, 197, 22157 },
+    { 110, 148, 22161 },
+    { 220, 242, 22161 },
+    { 152, 176, 22167 },
+    { 169, 220, 22168 },
+    { 6, 39, 22169 },
+    { 162, 188, 22170 },
+    { 118, 140, 22174 },
+    { 38, 86, 22176 },
+    { 138, 182, 22181 },
+    { 221, 248, 22182 },
+    { 196, 235, 22189 },
+    { 104, 167, 22193 },
+    { 213, 244, 22196 },
+    { 93, 143, 22197 },
+    { 69, 89, 22200 },
+    { 204, 248, 22200 },
+    { 20, 21, 22202 },
+    { 83, 102, 22210 },
+    { 227, 241, 22211 },
+    { 2, 23, 22213 },
+    { 129, 148, 22218 },
+    { 6, 238, 22219 },
+    { 159, 204, 22219 },
+    { 227, 232, 22221 },
+    { 29, 42, 22224 },
+    { 27, 153, 22228 },
+    { 27, 154, 22230 },
+    { 188, 224, 22230 },
+    { 132, 204, 22235 },
+    { 10, 37, 22237 },
+    { 243, 248, 22250 },
+    { 173, 193, 22251 },
+    { 95, 139, 22252 },
+    { 36, 56, 22254 },
+    { 212, 231, 22256 },
+    { 31, 73, 22257 },
+    { 77, 108, 22258 },
+    { 12, 94, 22266 },
+    { 37, 100, 22268 },
+    { 163, 211, 22268 },
+    { 14, 35, 22269 },
+    { 73, 102, 22270 },
+    { 3, 201, 22271 },
+    { 12, 235, 22273 },
+    { 240, 253, 22276 },
+    { 165, 236, 22278 },
+    { 21, 26, 22281 },
+    { 138, 150, 22282 },
+    { 27, 76, 22283 },
+    { 122, 162, 22283 },
+    { 132, 187, 22283 },
+    { 66, 101, 22295 },
+    { 170, 210, 22295 },
+    { 105, 128, 22300 },
+    { 19, 59, 22301 },
+    { 135, 169, 22301 },
+    { 63, 91, 22305 },
+    { 26, 50, 22308 },
+    { 37, 48, 22315 },
+    { 139, 198, 22316 },
+    { 139, 197, 22318 },
+    { 48, 85, 22319 },
+    { 176, 219, 22319 },
+    { 85, 108, 22320 },
+    { 13, 60, 22322 },
+    { 148, 202, 22322 },
+    { 24, 64, 22323 },
+    { 27, 127, 22324 },
+    { 157, 190, 22328 },
+    { 159, 208, 22329 },
+    { 177, 224, 22331 },
+    { 195, 239, 22332 },
+    { 80, 113, 22334 },
+    { 181, 190, 22334 },
+    { 104, 161, 22335 },
+    { 82, 112, 22338 },
+    { 3, 97, 22341 },
+    { 16, 60, 22347 },
+    { 19, 236, 22347 },
+    { 124, 163, 22348 },
+    { 152, 215, 22352 },
+    { 206, 207, 22352 },
+    { 163, 194, 22353 },
+    { 172, 221, 22353 },
+    { 136, 190, 22354 },
+    { 174, 181, 22354 },
+    { 17, 46, 22356 },
+    { 72, 122, 22361 },
+    { 47, 61, 22368 },
+    { 159, 181, 22370 },
+    { 128, 132, 22374 },
+    { 28, 56, 22377 },
+    { 58, 91, 22378 },
+    { 158, 184, 22379 },
+    { 35, 74, 22385 },
+    { 120, 198, 22386 },
+    { 156, 215, 22387 },
+    { 116, 134, 22394 },
+    { 13, 253, 22395 },
+    { 54, 99, 22398 },
+    { 66, 83, 22398 },
+    { 27, 84, 22399 },
+    { 70, 92, 22401 },
+    { 210, 220, 22402 },
+    { 31, 74, 22405 },
+    { 73, 91, 22405 },
+    { 188, 218, 22405 },
+    { 184, 233, 22413 },
+    { 24, 50, 22416 },
+    { 61, 88, 22417 },
+    { 154, 159, 22419 },
+    { 29, 51, 22421 },
+    { 153, 159, 22422 },
+    { 99, 121, 22423 },
+    { 127, 192, 22426 },
+    { 119, 137, 22430 },
+    { 252, 254, 22430 },
+    { 38, 66, 22433 },
+    { 109, 128, 22433 },
+    { 11, 158, 22434 },
+    { 218, 241, 22442 },
+    { 1, 165, 22443 },
+    { 97, 121, 22446 },
+    { 5, 239, 22447 },
+    { 121, 167, 22447 },
+    { 204, 232, 22450 },
+    { 13, 250, 22451 },
+    { 0, 26, 22454 },
+    { 190, 237, 22461 },
+    { 248, 251, 22461 },
+    { 41, 46, 22465 },
+    { 23, 64, 22466 },
+    { 195, 230, 22475 },
+    { 216, 244, 22485 },
+    { 46, 92, 22488 },
+    { 14, 37, 22489 },
+    { 170, 223, 22489 },
+    { 213, 222, 22492 },
+    { 110, 185, 22494 },
+    { 51, 79, 22501 },
+    { 105, 161, 22505 },
+    { 34, 82, 22507 },
+    { 44, 85, 22510 },
+    { 109, 198, 22510 },
+    { 19, 228, 22512 },
+    { 73, 94, 22512 },
+    { 134, 137, 22514 },
+    { 16, 239, 22515 },
+    { 32, 77, 22515 },
+    { 157, 165, 22517 },
+    { 98, 126, 22532 },
+    { 79, 122, 22534 },
+    { 65, 125, 22537 },
+    { 15, 102, 22540 },
+    { 35, 57, 22542 },
+    { 57, 102, 22544 },
+    { 195, 226, 22546 },
+    { 2, 241, 22551 },
+    { 103, 126, 22552 },
+    { 164, 211, 22556 },
+    { 32, 93, 22561 },
+    { 8, 165, 22570 },
+    { 18, 247, 22572 },
+    { 147, 159, 22572 },
+    { 217, 231, 22572 },
+    { 111, 127, 22573 },
+    { 6, 254, 22580 },
+    { 159, 207, 22580 },
+    { 165, 169, 22580 },
+    { 120, 197, 22581 },
+    { 145, 148, 22585 },
+    { 155, 213, 22589 },
+    { 14, 39, 22593 },
+    { 173, 203, 22593 },
+    { 145, 188, 22596 },
+    { 115, 141, 22597 },
+    { 102, 152, 22599 },
+    { 6, 237, 22603 },
+    { 129, 204, 22605 },
+    { 154, 196, 22607 },
+    { 71, 156, 22608 },
+    { 88, 106, 22609 },
+    { 132, 138, 22609 },
+    { 153, 196, 22609 },
+    { 123, 255, 22610 },
+    { 69, 71, 22616 },
+    { 58, 85, 22622 },
+    { 167, 221, 22623 },
+    { 115, 121, 22628 },
+    { 8, 190, 22635 },
+    { 215, 248, 22635 },
+    { 47, 64, 22642 },
+    { 154, 211, 22642 },
+    { 23, 45, 22643 },
+    { 153, 211, 22644 },
+    { 143, 208, 22646 },
+    { 86, 111, 22647 },
+    { 221, 249, 22647 },
+    { 31, 67, 22649 },
+    { 39, 78, 22649 },
+    { 59, 81, 22649 },
+    { 130, 201, 22649 },
+    { 10, 240, 22652 },
+    { 207, 248, 22652 },
+    { 193, 224, 22653 },
+    { 59, 113, 22663 },
+    { 84, 127, 22665 },
+    { 226, 236, 22666 },
+    { 130, 187, 22670 },
+    { 148, 201, 22672 },
+    { 48, 67, 22675 },
+    { 213, 229, 22677 },
+    { 184, 210, 22683 },
+    { 39, 100, 22690 },
+    { 163, 207, 22690 },
+    { 111, 122, 22692 },
+    { 28, 41, 22693 },
+    { 29, 31, 22701 },
+    { 89, 111, 22704 },
+    { 104, 149, 22704 },
+    { 185, 218, 22704 },
+    { 177, 222, 22705 },
+    { 148, 204, 22710 },
+    { 229, 250, 22717 },
+    { 109, 166, 22718 },
+    { 163, 204, 22718 },
+    { 8, 59, 22720 },
+    { 76, 78, 22724 },
+    { 20, 249, 22726 },
+    { 37, 255, 22728 },
+    { 156, 248, 22729 },
+    { 230, 250, 22729 },
+    { 1, 37, 22730 },
+    { 90, 118, 22731 },
+    { 172, 216, 22731 },
+    { 84, 129, 22742 },
+    { 179, 227, 22742 },
+    { 147, 234, 22745 },
+    { 44, 82, 22749 },
+    { 105, 111, 22756 },
+    { 15, 235, 22762 },
+    { 1, 254, 22763 },
+    { 25, 68, 22763 },
+    { 30, 88, 22767 },
+    { 79, 125, 22767 },
+    { 13, 236, 22769 },
+    { 133, 204, 22772 },
+    { 129, 187, 22775 },
+    { 7, 15, 22777 },
+    { 110, 167, 22785 },
+    { 81, 84, 22787 },
+    { 149, 191, 22791 },
+    { 19, 37, 22797 },
+    { 8, 233, 22798 },
+    { 103, 136, 22798 },
+    { 124, 125, 22798 },
+    { 108, 111, 22799 },
+    { 103, 112, 22802 },
+    { 30, 70, 22804 },
+    { 183, 189, 22808 },
+    { 3, 127, 22815 },
+    { 196, 234, 22816 },
+    { 6, 228, 22817 },
+    { 18, 255, 22818 },
+    { 79, 129, 22818 },
+    { 172, 218, 22820 },
+    { 63, 89, 22824 },
+    { 108, 189, 22825 },
+    { 142, 161, 22825 },
+    { 66, 73, 22826 },
+    { 48, 59, 22828 },
+    { 166, 221, 22829 },
+    { 30, 48, 22833 },
+    { 103, 121, 22834 },
+    { 17, 250, 22835 },
+    { 37, 52, 22836 },
+    { 20, 40, 22837 },
+    { 163, 184, 22839 },
+    { 5, 242, 22846 },
+    { 109, 197, 22846 },
+    { 130, 192, 22846 },
+    { 161, 216, 22847 },
+    { 188, 219, 22848 },
+    { 1, 43, 22850 },
+    { 45, 77, 22851 },
+    { 67, 117, 22852 },
+    { 70, 98, 22852 },
+    { 2, 24, 22854 },
+    { 30, 255, 22854 },
+    { 35, 80, 22856 },
+    { 227, 240, 22866 },
+    { 92, 144, 22867 },
+    { 128, 129, 22870 },
+    { 223, 248, 22874 },
+    { 231, 254, 22878 },
+    { 18, 254, 22881 },
+    { 162, 216, 22885 },
+    { 14, 31, 22892 },
+    { 42, 79, 22895 },
+    { 105, 167, 22896 },
+    { 147, 212, 22896 },
+    { 125, 162, 22901 },
+    { 63, 98, 22903 },
+    { 127, 187, 22904 },
+    { 148, 197, 22904 },
+    { 33, 69, 22907 },
+    { 10, 39, 22909 },
+    { 73, 105, 22909 },
+    { 18, 60, 22910 },
+    { 93, 147, 22913 },
+    { 121, 132, 22915 },
+    { 150, 183, 22915 },
+    { 54, 94, 22916 },
+    { 126, 167, 22917 },
+    { 199, 238, 22921 },
+    { 17, 31, 22922 },
+    { 87, 185, 22926 },
+    { 50, 57, 22928 },
+    { 83, 108, 22928 },
+    { 112, 255, 22930 },
+    { 13, 190, 22934 },
+    { 99, 155, 22943 },
+    { 191, 232, 22945 },
+    { 160, 216, 22946 },
+    { 97, 172, 22951 },
+    { 208, 226, 22951 },
+    { 141, 180, 22953 },
+    { 176, 222, 22953 },
+    { 134, 255, 22954 },
+    { 147, 175, 22959 },
+    { 203, 233, 22961 },
+    { 148, 150, 22962 },
+    { 136, 184, 22966 },
+    { 15, 185, 22968 },
+    { 1, 29, 22969 },
+    { 223, 249, 22972 },
+    { 183, 197, 22973 },
+    { 124, 166, 22974 },
+    { 27, 93, 22976 },
+    { 134, 184, 22980 },
+    { 194, 236, 22982 },
+    { 19, 114, 22986 },
+    { 176, 224, 22994 },
+    { 116, 144, 22996 },
+    { 203, 223, 22997 },
+    { 115, 151, 23000 },
+    { 150, 162, 23000 },
+    { 100, 118, 23001 },
+    { 185, 223, 23001 },
+    { 117, 124, 23002 },
+    { 21, 25, 23004 },
+    { 32, 75, 23005 },
+    { 34, 69, 23011 },
+    { 26, 80, 23016 },
+    { 96, 140, 23017 },
+    { 185, 216, 23017 },
+    { 88, 136, 23019 },
+    { 114, 150, 23025 },
+    { 49, 71, 23033 },
+    { 114, 157, 23033 },
+    { 167, 219, 23033 },
+    { 75, 102, 23038 },
+    { 148, 198, 23044 },
+    { 81, 92, 23046 },
+    { 166, 219, 23048 },
+    { 106, 134, 23056 },
+    { 121, 153, 23056 },
+    { 121, 154, 23056 },
+    { 139, 201, 23059 },
+    { 44, 80, 23061 },
+    { 250, 251, 23064 },
+    { 24, 45, 23066 },
+    { 181, 228, 23067 },
+    { 125, 187, 23076 },
+    { 128, 145, 23081 },
+    { 33, 248, 23088 },
+    { 76, 117, 23090 },
+    { 159, 210, 23090 },
+    { 51, 82, 23091 },
+    { 177, 223, 23092 },
+    { 129, 234, 23095 },
+    { 146, 196, 23096 },
+    { 177, 221, 23097 },
+    { 7, 17, 23100 },
+    { 65, 122, 23102 },
+    { 128, 173, 23102 },
+    { 2, 8, 23104 },
+    { 12, 54, 23107 },
+    { 138, 171, 23110 },
+    { 94, 139, 23112 },
+    { 18, 35, 23114 },
+    { 66, 85, 23114 },
+    { 163, 214, 23115 },
+    { 71, 147, 23116 },
+    { 197, 210, 23118 },
+    { 107, 165, 23122 },
+    { 131, 171, 23122 },
+    { 90, 100, 23127 },
+    { 94, 189, 23127 },
+    { 20, 248, 23129 },
+    { 29, 80, 23131 },
+    { 158, 236, 23132 },
+    { 31, 75, 23136 },
+    { 193, 231, 23137 },
+    { 10, 36, 23143 },
+    { 133, 186, 23145 },
+    { 84, 132, 23146 },
+    { 34, 81, 23147 },
+    { 95, 111, 23148 },
+    { 38, 78, 23152 },
+    { 123, 169, 23153 },
+    { 49, 68, 23159 },
+    { 39, 40, 23161 },
+    { 196, 222, 23161 },
+    { 228, 231, 23161 },
+    { 69, 87, 23162 },
+    { 148, 205, 23167 },
+    { 8, 228, 23174 },
+    { 181, 226, 23174 },
+    { 207, 246, 23175 },
+    { 79, 120, 23180 },
+    { 113, 116, 23180 },
+    { 97, 98, 23182 },
+    { 152, 213, 23185 },
+    { 132, 234, 23188 },
+    { 194, 237, 23192 },
+    { 11, 88, 23194 },
+    { 91, 100, 23194 },
+    { 129, 138, 23197 },
+    { 21, 39, 23202 },
+    { 64, 101, 23202 },
+    { 107, 137, 23203 },
+    { 142, 183, 23206 },
+    { 43, 48, 23210 },
+    { 97, 185, 23212 },
+    { 162, 185, 23213 },
+    { 156, 211, 23214 },
+    { 52, 59, 23220 },
+    { 85, 94, 23220 },
+    { 189, 246, 23220 },
+    { 194, 225, 23220 },
+    { 11, 165, 23221 },
+    { 157, 183, 23221 },
+    { 128, 156, 23227 },
+    { 46, 49, 23228 },
+    { 140, 255, 23228 },
+    { 12, 57, 23235 },
+    { 193, 211, 23237 },
+    { 35, 82, 23240 },
+    { 142, 160, 23242 },
+    { 25, 35, 23244 },
+    { 62, 94, 23244 },
+    { 109, 170, 23245 },
+    { 164, 174, 23246 },
+    { 37, 44, 23248 },
+    { 166, 210, 23254 },
+    { 122, 192, 23255 },
+    { 121, 170, 23261 },
+    { 83, 94, 23263 },
+    { 185, 249, 23263 },
+    { 88, 168, 23272 },
+    { 211, 222, 23276 },
+    { 213, 246, 23277 },
+    { 204, 246, 23279 },
+    { 64, 100, 23281 },
+    { 209, 229, 23287 },
+    { 231, 236, 23291 },
+    { 37, 55, 23292 },
+    { 125, 126, 23294 },
+    { 121, 163, 23301 },
+    { 92, 165, 23302 },
+    { 93, 128, 23303 },
+    { 79, 132, 23306 },
+    { 138, 176, 23308 },
+    { 185, 219, 23310 },
+    { 227, 253, 23310 },
+    { 33, 83, 23311 },
+    { 42, 60, 23315 },
+    { 159, 211, 23321 },
+    { 113, 240, 23322 },
+    { 245, 246, 23322 },
+    { 117, 201, 23325 },
+    { 62, 66, 23326 },
+    { 38, 81, 23327 },
+    { 10, 43, 23330 },
+    { 59, 107, 23333 },
+    { 32, 249, 23336 },
+    { 211, 230, 23338 },
+    { 103, 119, 23340 },
+    { 227, 245, 23340 },
+    { 111, 148, 23341 },
+    { 42, 65, 23342 },
+    { 32, 49, 23344 },
+    { 59, 112, 23347 },
+    { 121, 129, 23348 },
+    { 191, 230, 23354 },
+    { 191, 229, 23357 },
+    { 232, 238, 23357 },
+    { 6, 28, 23358 },
+    { 126, 170, 23359 },
+    { 27, 110, 23360 },
+    { 95, 155, 23362 },
+    { 116, 140, 23369 },
+    { 159, 189, 23372 },
+    { 85, 103, 23376 },
+    { 145, 194, 23379 },
+    { 77, 109, 23380 },
+    { 183, 198, 23381 },
+    { 159, 193, 23382 },
+    { 205, 248, 23388 },
+    { 142, 166, 23392 },
+    { 82, 113, 23394 },
+    { 102, 160, 23394 },
+    { 42, 72, 23395 },
+    { 26, 240, 23401 },
+    { 133, 173, 23402 },
+    { 8, 28, 23407 },
+    { 26, 45, 23407 },
+    { 30, 44, 23408 },
+    { 164, 213, 23408 },
+    { 123, 209, 23410 },
+    { 195, 240, 23410 },
+    { 231, 235, 23410 },
+    { 145, 162, 23414 },
+    { 134, 195, 23418 },
+    { 89, 98, 23419 },
+    { 159, 201, 23419 },
+    { 167, 234, 23419 },
+    { 222, 245, 23420 },
+    { 137, 162, 23425 },
+    { 63, 87, 23427 },
+    { 144, 194, 23429 },
+    { 7, 31, 23437 },
+    { 43, 96, 23444 },
+    { 114, 179, 23446 },
+    { 100, 168, 23448 },
+    { 41, 68, 23453 },
+    { 89, 146, 23454 },
+    { 193, 218, 23454 },
+    { 101, 134, 23455 },
+    { 142, 146, 23456 },
+    { 16, 254, 23462 },
+    { 36, 81, 23462 },
+    { 233, 245, 23463 },
+    { 151, 217, 23467 },
+    { 30, 52, 23468 },
+    { 16, 19, 23470 },
+    { 43, 78, 23472 },
+    { 45, 83, 23473 },
+    { 107, 151, 23473 },
+    { 108, 166, 23474 },
+    { 123, 137, 23474 },
+    { 2, 11, 23475 },
+    { 75, 94, 23478 },
+    { 56, 60, 23483 },
+    { 106, 124, 23483 },
+    { 174, 185, 23491 },
+    { 75, 105, 23494 },
+    { 130, 174, 23496 },
+    { 98, 128, 23498 },
+    { 124, 147, 23501 },
+    { 206, 209, 23501 },
+    { 36, 92, 23502 },
+    { 0, 233, 23505 },
+    { 126, 147, 23508 },
+    { 138, 177, 23509 },
+    { 102, 149, 23511 },
+    { 193, 213, 23511 },
+    { 191, 231, 23512 },
+    { 0, 240, 23520 },
+    { 87, 172, 23521 },
+    { 8, 36, 23522 },
+    { 99, 128, 23524 },
+    { 69, 82, 23526 },
+    { 66, 77, 23527 },
+    { 198, 210, 23533 },
+    { 124, 150, 23536 },
+    { 55, 59, 23538 },
+    { 238, 243, 23538 },
+    { 141, 183, 23541 },
+    { 157, 158, 23544 },
+    { 24, 68, 23546 },
+    { 138, 186, 23548 },
+    { 172, 223, 23552 },
+    { 84, 133, 23555 },
+    { 127, 141, 23557 },
+    { 169, 175, 23557 },
+    { 62, 102, 23563 },
+    { 207, 244, 23566 },
+    { 178, 181, 23567 },
+    { 211, 244, 23567 },
+    { 128, 174, 23568 },
+    { 93, 124, 23584 },
+    { 77, 104, 23585 },
+    { 55, 90, 23586 },
+    { 171, 187, 23587 },
+    { 172, 219, 23592 },
+    { 216, 243, 23592 },
+    { 131, 151, 23599 },
+    { 102, 189, 23604 },
+    { 50, 77, 23606 },
+    { 31, 46, 23607 },
+    { 56, 82, 23607 },
+    { 40, 85, 23608 },
+    { 156, 175, 23608 },
+    { 135, 144, 23614 },
+    { 188, 202, 23618 },
+    { 105, 189, 23619 },
+    { 114, 135, 23624 },
+    { 22, 61, 23626 },
+    { 125, 204, 23626 },
+    { 245, 249, 23629 },
+    { 5, 255, 23631 },
+    { 142, 178, 23631 },
+    { 192, 248, 23632 },
+    { 51, 80, 23635 },
+    { 220, 250, 23642 },
+    { 148, 207, 23645 },
+    { 130, 186, 23646 },
+    { 242, 244, 23648 },
+    { 167, 223, 23653 },
+    { 71, 185, 23655 },
+    { 188, 200, 23655 },
+    { 198, 249, 23656 },
+    { 85, 109, 23660 },
+    { 51, 72, 23668 },
+    { 35, 75, 23669 },
+    { 12, 67, 23671 },
+    { 73, 110, 23674 },
+    { 64, 74, 23679 },
+    { 166, 171, 23683 },
+    { 168, 236, 23684 },
+    { 150, 175, 23686 },
+    { 72, 127, 23687 },
+    { 156, 196, 23689 },
+    { 18, 53, 23695 },
+    { 97, 128, 23695 },
+    { 159, 206, 23697 },
+    { 32, 41, 23699 },
+    { 43, 52, 23699 },
+    { 56, 90, 23700 },
+    { 177, 226, 23700 },
+    { 32, 125, 23702 },
+    { 164, 196, 23703 },
+    { 203, 221, 23703 },
+    { 208, 248, 23705 },
+    { 59, 255, 23706 },
+    { 124, 167, 23707 },
+    { 145, 195, 23714 },
+    { 94, 198, 23719 },
+    { 198, 244, 23720 },
+    { 11, 190, 23721 },
+    { 187, 188, 23721 },
+    { 201, 244, 23723 },
+    { 117, 126, 23725 },
+    { 35, 73, 23728 },
+    { 155, 177, 23728 },
+    { 5, 240, 23730 },
+    { 196, 231, 23731 },
+    { 84, 91, 23737 },
+    { 193, 219, 23737 },
+    { 84, 90, 23739 },
+    { 138, 187, 23742 },
+    { 8, 238, 23743 },
+    { 163, 213, 23746 },
+    { 120, 159, 23747 },
+    { 214, 241, 23747 },
+    { 6, 158, 23748 },
+    { 184, 229, 23754 },
+    { 130, 131, 23755 },
+    { 111, 117, 23757 },
+    { 50, 90, 23758 },
+    { 37, 78, 23763 },
+    { 75, 110, 23765 },
+    { 33, 42, 23767 },
+    { 26, 66, 23768 },
+    { 237, 255, 23769 },
+    { 79, 127, 23774 },
+    { 197, 244, 23774 },
+    { 154, 213, 23779 },
+    { 151, 225, 23781 },
+    { 153, 213, 23781 },
+    { 176, 223, 23784 },
+    { 71, 130, 23789 },
+    { 119, 199, 23791 },
+    { 204, 206, 23793 },
+    { 176, 221, 23794 },
+    { 15, 95, 23795 },
+    { 110, 166, 23795 },
+    { 166, 223, 23795 },
+    { 51, 84, 23796 },
+    { 231, 250, 23799 },
+    { 132, 162, 23800 },
+    { 39, 51, 23804 },
+    { 68, 107, 23804 },
+    { 168, 247, 23805 },
+    { 211, 229, 23805 },
+    { 73, 108, 23807 },
+    { 12, 104, 23808 },
+    { 95, 121, 23808 },
+    { 165, 233, 23809 },
+    { 208, 246, 23811 },
+    { 23, 68, 23814 },
+    { 93, 139, 23816 },
+    { 8, 237, 23817 },
+    { 170, 171, 23819 },
+    { 170, 234, 23824 },
+    { 141, 182, 23825 },
+    { 87, 146, 23828 },
+    { 0, 30, 23830 },
+    { 33, 56, 23833 },
+    { 224, 245, 23835 },
+    { 197, 249, 23837 },
+    { 21, 37, 23847 },
+    { 208, 244, 23851 },
+    { 102, 161, 23852 },
+    { 189, 210, 23854 },
+    { 195, 210, 23857 },
+    { 140, 240, 23861 },
+    { 54, 102, 23862 },
+    { 26, 247, 23869 },
+    { 108, 198, 23871 },
+    { 50, 83, 23873 },
+    { 175, 194, 23873 },
+    { 61, 100, 23875 },
+    { 132, 186, 23879 },
+    { 230, 254, 23879 },
+    { 205, 246, 23881 },
+    { 41, 86, 23883 },
+    { 122, 187, 23886 },
+    { 177, 201, 23886 },
+    { 6, 190, 23887 },
+    { 2, 243, 23888 },
+    { 156, 235, 23888 },
+    { 108, 124, 23889 },
+    { 158, 169, 23894 },
+    { 108, 138, 23895 },
+    { 61, 74, 23897 },
+    { 32, 74, 23899 },
+    { 184, 236, 23902 },
+    { 30, 82, 23903 },
+    { 94, 152, 23903 },
+    { 199, 206, 23905 },
+    { 82, 115, 23910 },
+    { 5, 236, 23917 },
+    { 12, 87, 23917 },
+    { 51, 65, 23917 },
+    { 138, 172, 23918 },
+    { 0, 7, 23919 },
+    { 184, 191, 23919 },
+    { 25, 239, 23920 },
+    { 250, 255, 23921 },
+    { 104, 166, 23930 },
+    { 137, 139, 23934 },
+    { 215, 230, 23935 },
+    { 113, 118, 23936 },
+    { 72, 120, 23937 },
+    { 97, 155, 23941 },
+    { 55, 79, 23942 },
+    { 148, 208, 23942 },
+    { 30, 40, 23943 },
+    { 202, 226, 23945 },
+    { 150, 179, 23946 },
+    { 72, 133, 23954 },
+    { 127, 173, 23954 },
+    { 132, 207, 23958 },
+    { 180, 181, 23961 },
+    { 11, 60, 23965 },
+    { 1, 39, 23967 },
+    { 5, 245, 23967 },
+    { 111, 149, 23968 },
+    { 184, 226, 23974 },
+    { 38, 61, 23977 },
+    { 243, 253, 23977 },
+    { 102, 167, 23981 },
+    { 119, 225, 23982 },
+    { 151, 203, 23982 },
+    { 44, 59, 23992 },
+    { 145, 193, 23992 },
+    { 163, 216, 23996 },
+    { 179, 193, 23998 },
+    { 53, 90, 24002 },
+    { 188, 208, 24003 },
+    { 155, 176, 24011 },
+    { 186, 203, 24023 },
+    { 14, 43, 24025 },
+    { 131, 152, 24025 },
+    { 115, 128, 24040 },
+    { 157, 206, 24044 },
+    { 161, 218, 24044 },
+    { 57, 105, 24048 },
+    { 30, 55, 24051 },
+    { 56, 86, 24052 },
+    { 9, 71, 24060 },
+    { 140, 181, 24068 },
+    { 181, 229, 24068 },
+    { 201, 214, 24069 },
+    { 204, 244, 24070 },
+    { 216, 241, 24072 },
+    { 0, 21, 24074 },
+    { 108, 170, 24074 },
+    { 52, 90, 24080 },
+    { 181, 196, 24080 },
+    { 0, 29, 24081 },
+    { 39, 255, 24088 },
+    { 142, 181, 24089 },
+    { 88, 190, 24092 },
+    { 216, 246, 24092 },
+    { 27, 62, 24094 },
+    { 19, 39, 24096 },
+    { 160, 218, 24100 },
+    { 151, 176, 24103 },
+    { 183, 195, 24103 },
+    { 173, 181, 24104 },
+    { 94, 197, 24106 },
+    { 143, 163, 24106 },
+    { 109, 111, 24107 },
+    { 150, 203, 24109 },
+    { 25, 50, 24113 },
+    { 130, 178, 24114 },
+    { 61, 101, 24115 },
+    { 57, 81, 24116 },
+    { 43, 55, 24118 },
+    { 129, 248, 24119 },
+    { 176, 226, 24121 },
+    { 8, 88, 24128 },
+    { 53, 92, 24129 },
+    { 193, 233, 24131 },
+    { 219, 248, 24132 },
+    { 136, 199, 24134 },
+    { 243, 250, 24134 },
+    { 76, 90, 24146 },
+    { 165, 220, 24146 },
+    { 127, 204, 24154 },
+    { 101, 137, 24155 },
+    { 203, 237, 24156 },
+    { 0, 251, 24157 },
+    { 134, 240, 24158 },
+    { 19, 24, 24159 },
+    { 88, 240, 24159 },
+    { 225, 250, 24159 },
+    { 14, 46, 24160 },
+    { 188, 215, 24161 },
+    { 121, 145, 24162 },
+    { 146, 212, 24162 },
+    { 192, 206, 24163 },
+    { 115, 157, 24171 },
+    { 24, 247, 24175 },
+    { 27, 198, 24175 },
+    { 102, 121, 24178 },
+    { 32, 185, 24179 },
+    { 127, 186, 24179 },
+    { 92, 118, 24180 },
+    { 205, 226, 24181 },
+    { 22, 64, 24184 },
+    { 106, 126, 24185 },
+    { 2, 252, 24186 },
+    { 98, 99, 24190 },
+    { 203, 215, 24190 },
+    { 169, 191, 24193 },
+    { 20, 56, 24196 },
+    { 119, 169, 24197 },
+    { 83, 109, 24199 },
+    { 108, 197, 24199 },
+    { 200, 226, 24199 },
+    { 54, 81, 24200 },
+    { 132, 205, 24201 },
+    { 205, 244, 24204 },
+    { 91, 114, 24208 },
+    { 109, 138, 24211 },
+    { 13, 46, 24212 },
+    { 43, 44, 24213 },
+    { 71, 153, 24216 },
+    { 107, 168, 24218 },
+    { 57, 104, 24219 },
+    { 71, 154, 24219 },
+    { 113, 199, 24222 },
+    { 7, 241, 24223 },
+    { 167, 210, 24228 },
+    { 156, 213, 24229 },
+    { 58, 76, 24230 },
+    { 206, 228, 24230 },
+    { 17, 53, 24234 },
+    { 139, 204, 24234 },
+    { 15, 89, 24235 },
+    { 32, 164, 24236 },
+    { 15, 129, 24243 },
+    { 188, 223, 24243 },
+    { 147, 215, 24245 },
+    { 229, 254, 24246 },
+    { 111, 133, 24255 },
+    { 46, 63, 24259 },
+    { 149, 171, 24260 },
+    { 233, 241, 24261 },
+    { 148, 185, 24266 },
+    { 105, 124, 24279 },
+    { 104, 170, 24282 },
+    { 131, 146, 24283 },
+    { 79, 81, 24291 },
+    { 33, 129, 24297 },
+    { 124, 170, 24297 },
+    { 242, 247, 24297 },
+    { 33, 117, 24305 },
+    { 84, 130, 24307 },
+    { 6, 165, 24309 },
+    { 209, 230, 24309 },
+    { 69, 97, 24313 },
+    { 5, 237, 24315 },
+    { 62, 98, 24315 },
+    { 136, 181, 24316 },
+    { 129, 207, 24323 },
+    { 119, 255, 24327 },
+    { 0, 255, 24328 },
+    { 2, 247, 24337 },
+    { 159, 172, 24341 },
+    { 99, 152, 24342 },
+    { 38, 64, 24344 },
+    { 168, 233, 24349 },
+    { 66, 88, 24350 },
+    { 80, 98, 24353 },
+    { 3, 252, 24354 },
+    { 127, 159, 24354 },
+    { 207, 226, 24356 },
+    { 31, 65, 24365 },
+    { 41, 71, 24369 },
+    { 208, 231, 24369 },
+    { 31, 36, 24375 },
+    { 75, 108, 24379 },
+    { 3, 143, 24380 },
+    { 77, 111, 24382 },
+    { 105, 166, 24382 },
+    { 3, 67, 24383 },
+    { 76, 91, 24386 },
+    { 211, 246, 24389 },
+    { 56, 80, 24390 },
+    { 129, 186, 24391 },
+    { 215, 243, 24395 },
+    { 218, 248, 24396 },
+    { 6, 59, 24397 },
+    { 0, 28, 24402 },
+    { 219, 249, 24409 },
+    { 98, 131, 24411 },
+    { 138, 183, 24412 },
+    { 93, 146, 24415 },
+    { 151, 163, 24415 },
+    { 79, 133, 24417 },
+    { 132, 200, 24418 },
+    { 130, 182, 24421 },
+    { 19, 107, 24423 },
+    { 102, 198, 24423 },
+    { 147, 196, 24424 },
+    { 142, 170, 24425 },
+    { 162, 206, 24427 },
+    { 5, 7, 24429 },
+    { 15, 109, 24429 },
+    { 60, 90, 24430 },
+    { 6, 36, 24432 },
+    { 132, 248, 24432 },
+    { 9, 31, 24438 },
+    { 65, 127, 24442 },
+    { 94, 160, 24445 },
+    { 74, 102, 24452 },
+    { 212, 249, 24452 },
+    { 231, 252, 24456 },
+    { 129, 162, 24457 },
+    { 153, 248, 24457 },
+    { 154, 248, 24458 },
+    { 224, 242, 24460 },
+    { 66, 98, 24462 },
+    { 93, 156, 24462 },
+    { 128, 175, 24462 },
+    { 37, 40, 24464 },
+    { 213, 243, 24471 },
+    { 156, 159, 24477 },
+    { 112, 225, 24478 },
+    { 120, 201, 24478 },
+    { 15, 164, 24480 },
+    { 116, 151, 24480 },
+    { 133, 207, 24484 },
+    { 139, 200, 24491 },
+    { 112, 157, 24494 },
+    { 130, 180, 24494 },
+    { 168, 193, 24495 },
+    { 138, 164, 24501 },
+    { 150, 174, 24501 },
+    { 201, 232, 24501 },
+    { 25, 80, 24502 },
+    { 176, 201, 24504 },
+    { 123, 240, 24505 },
+    { 121, 156, 24510 },
+    { 78, 84, 24511 },
+    { 142, 155, 24513 },
+    { 89, 185, 24514 },
+    { 133, 141, 24515 },
+    { 186, 193, 24515 },
+    { 215, 229, 24515 },
+    { 88, 179, 24519 },
+    { 99, 149, 24522 },
+    { 182, 234, 24524 },
+    { 133, 200, 24525 },
+    { 31, 32, 24526 },
+    { 48, 90, 24526 },
+    { 52, 79, 24529 },
+    { 133, 159, 24531 },
+    { 125, 186, 24535 },
+    { 9, 65, 24539 },
+    { 65, 133, 24539 },
+    { 12, 185, 24542 },
+    { 163, 212, 24542 },
+    { 20, 63, 24544 },
+    { 179, 237, 24548 },
+    { 105, 138, 24556 },
+    { 232, 237, 24559 },
+    { 1, 209, 24567 },
+    { 31, 70, 24568 },
+    { 89, 139, 24574 },
+    { 215, 249, 24579 },
+    { 28, 49, 24580 },
+    { 26, 58, 24583 },
+    { 20, 79, 24584 },
+    { 46, 69, 24584 },
+    { 129, 205, 24584 },
+    { 90, 114, 24586 },
+    { 133, 205, 24588 },
+    { 20, 51, 24591 },
+    { 68, 74, 24591 },
+    { 16, 53, 24592 },
+    { 116, 138, 24594 },
+    { 163, 201, 24594 },
+    { 27, 197, 24595 },
+    { 111, 146, 24597 },
+    { 31, 61, 24600 },
+    { 106, 140, 24603 },
+    { 217, 255, 24603 },
+    { 155, 216, 24604 },
+    { 11, 233, 24605 },
+    { 100, 255, 24607 },
+    { 192, 232, 24607 },
+    { 27, 189, 24610 },
+    { 141, 169, 24611 },
+    { 55, 91, 24612 },
+    { 157, 217, 24614 },
+    { 230, 253, 24614 },
+    { 195, 238, 24615 },
+    { 128, 150, 24616 },
+    { 215, 222, 24617 },
+    { 159, 197, 24620 },
+    { 10, 238, 24621 },
+    { 224, 227, 24622 },
+    { 42, 84, 24623 },
+    { 105, 198, 24630 },
+    { 170, 224, 24632 },
+    { 188, 231, 24633 },
+    { 236, 245, 24633 },
+    { 132, 202, 24636 },
+    { 56, 91, 24638 },
+    { 43, 113, 24645 },
+    { 142, 180, 24645 },
+    { 126, 173, 24646 },
+    { 62, 105, 24647 },
+    { 73, 104, 24650 },
+    { 40, 79, 24651 },
+    { 27, 235, 24652 },
+    { 19, 30, 24653 },
+    { 85, 104, 24653 },
+    { 51, 90, 24654 },
+    { 201, 249, 24655 },
+    { 22, 68, 24657 },
+    { 89, 172, 24660 },
+    { 3, 86, 24663 },
+    { 88, 115, 24665 },
+    { 162, 218, 24676 },
+    { 210, 217, 24676 },
+    { 229, 253, 24681 },
+    { 46, 47, 24685 },
+    { 202, 248, 24686 },
+    { 203, 232, 24686 },
+    { 213, 248, 24688 },
+    { 66, 100, 24695 },
+    { 122, 141, 24696 },
+    { 44, 79, 24703 },
+    { 164, 175, 24703 },
+    { 184, 230, 24703 },
+    { 21, 22, 24710 },
+    { 109, 124, 24710 },
+    { 110, 170, 24710 },
+    { 144, 171, 24712 },
+    { 149, 212, 24714 },
+    { 54, 78, 24716 },
+    { 23, 58, 24717 },
+    { 188, 221, 24717 },
+    { 47, 68, 24718 },
+    { 10, 34, 24723 },
+    { 145, 183, 24723 },
+    { 133, 182, 24725 },
+    { 147, 211, 24725 },
+    { 91, 93, 24730 },
+    { 172, 191, 24731 },
+    { 20, 76, 24732 },
+    { 39, 42, 24735 },
+    { 149, 211, 24738 },
+    { 20, 252, 24742 },
+    { 163, 215, 24747 },
+    { 54, 70, 24749 },
+    { 94, 167, 24749 },
+    { 31, 66, 24751 },
+    { 94, 248, 24751 },
+    { 70, 103, 24754 },
+    { 188, 205, 24757 },
+    { 36, 41, 24759 },
+    { 47, 87, 24759 },
+    { 23, 247, 24765 },
+    { 57, 78, 24769 },
+    { 53, 74, 24771 },
+    { 151, 177, 24774 },
+    { 33, 85, 24776 },
+    { 109, 148, 24777 },
+    { 133, 202, 24778 },
+    { 39, 81, 24782 },
+    { 7, 248, 24785 },
+    { 102, 197, 24785 },
+    { 200, 248, 24786 },
+    { 101, 131, 24789 },
+    { 143, 212, 24789 },
+    { 139, 202, 24790 },
+    { 102, 128, 24791 },
+    { 136, 171, 24795 },
+    { 196, 230, 24797 },
+    { 234, 251, 24803 },
+    { 161, 171, 24805 },
+    { 39, 96, 24808 },
+    { 73, 109, 24813 },
+    { 159, 203, 24815 },
+    { 15, 79, 24818 },
+    { 29, 82, 24818 },
+    { 165, 194, 24819 },
+    { 29, 56, 24821 },
+    { 86, 147, 24821 },
+    { 158, 233, 24824 },
+    { 53, 88, 24828 },
+    { 15, 132, 24832 },
+    { 161, 221, 24833 },
+    { 202, 203, 24833 },
+    { 160, 221, 24835 },
+    { 129, 200, 24836 },
+    { 175, 185, 24836 },
+    { 130, 204, 24837 },
+    { 89, 121, 24843 },
+    { 95, 128, 24843 },
+    { 46, 96, 24845 },
+    { 108, 148, 24846 },
+    { 130, 142, 24849 },
+    { 104, 248, 24850 },
+    { 50, 91, 24851 },
+    { 137, 149, 24854 },
+    { 126, 174, 24855 },
+    { 60, 107, 24856 },
+    { 253, 255, 24860 },
+    { 169, 174, 24862 },
+    { 181, 182, 24862 },
+    { 71, 143, 24863 },
+    { 203, 208, 24864 },
+    { 141, 147, 24865 },
+    { 74, 94, 24868 },
+    { 1, 179, 24871 },
+    { 82, 116, 24872 },
+    { 108, 126, 24872 },
+    { 20, 73, 24880 },
+    { 194, 231, 24881 },
+    { 32, 63, 24882 },
+    { 159, 198, 24886 },
+    { 120, 131, 24888 },
+    { 19, 233, 24889 },
+    { 60, 101, 24890 },
+    { 112, 145, 24890 },
+    { 181, 230, 24891 },
+    { 27, 120, 24892 },
+    { 8, 254, 24896 },
+    { 83, 104, 24902 },
+    { 122, 204, 24904 },
+    { 188, 212, 24905 },
+    { 95, 152, 24906 },
+    { 74, 105, 24909 },
+    { 104, 201, 24911 },
+    { 111, 143, 24912 },
+    { 120, 173, 24913 },
+    { 143, 196, 24920 },
+    { 111, 125, 24921 },
+    { 37, 96, 24922 },
+    { 166, 234, 24922 },
+    { 153, 235, 24928 },
+    { 154, 235, 24928 },
+    { 94, 161, 24930 },
+    { 159, 213, 24930 },
+    { 68, 106, 24932 },
+    { 200, 203, 24933 },
+    { 194, 196, 24934 },
+    { 57, 108, 24935 },
+    { 133, 178, 24935 },
+    { 117, 192, 24936 },
+    { 130, 175, 24936 },
+    { 11, 228, 24937 },
+    { 145, 175, 24939 },
+    { 199, 229, 24944 },
+    { 68, 103, 24951 },
+    { 97, 124, 24953 },
+    { 93, 153, 24954 },
+    { 93, 154, 24956 },
+    { 33, 132, 24957 },
+    { 169, 214, 24962 },
+    { 224, 249, 24962 },
+    { 105, 197, 24965 },
+    { 222, 243, 24968 },
+    { 99, 124, 24971 },
+    { 136, 141, 24973 },
+    { 55, 84, 24975 },
+    { 105, 170, 24981 },
+    { 171, 222, 24982 },
+    { 24, 58, 24983 },
+    { 142, 144, 24993 },
+    { 47, 89, 24995 },
+    { 86, 143, 24996 },
+    { 133, 174, 24997 },
+    { 137, 176, 25000 },
+    { 80, 115, 25003 },
+    { 102, 111, 25003 },
+    { 159, 212, 25003 },
+    { 218, 249, 25004 },
+    { 146, 183, 25010 },
+    { 126, 153, 25012 },
+    { 126, 154, 25012 },
+    { 69, 80, 25013 },
+    { 182, 235, 25013 },
+    { 196, 229, 25019 },
+    { 120, 192, 25020 },
+    { 45, 85, 25023 },
+    { 21, 61, 25026 },
+    { 15, 105, 25030 },
+    { 31, 77, 25030 },
+    { 83, 103, 25031 },
+    { 171, 211, 25032 },
+    { 65, 120, 25036 },
+    { 96, 144, 25037 },
+    { 2, 237, 25038 },
+    { 101, 135, 25038 },
+    { 152, 216, 25038 },
+    { 45, 90, 25039 },
+    { 155, 234, 25040 },
+    { 31, 76, 25041 },
+    { 90, 93, 25041 },
+    { 146, 211, 25046 },
+    { 59, 101, 25047 },
+    { 129, 202, 25048 },
+    { 193, 223, 25048 },
+    { 116, 157, 25052 },
+    { 150, 199, 25056 },
+    { 40, 65, 25059 },
+    { 223, 252, 25060 },
+    { 64, 75, 25064 },
+    { 63, 82, 25071 },
+    { 133, 180, 25075 },
+    { 113, 157, 25076 },
+    { 142, 167, 25076 },
+    { 164, 221, 25077 },
+    { 135, 176, 25078 },
+    { 53, 91, 25082 },
+    { 12, 102, 25084 },
+    { 24, 240, 25084 },
+    { 120, 187, 25089 },
+    { 28, 80, 25090 },
+    { 238, 255, 25092 },
+    { 28, 38, 25094 },
+    { 67, 129, 25094 },
+    { 74, 110, 25097 },
+    { 114, 190, 25104 },
+    { 214, 237, 25106 },
+    { 52, 91, 25114 },
+    { 80, 119, 25115 },
+    { 32, 246, 25118 },
+    { 79, 111, 25119 },
+    { 232, 248, 25122 },
+    { 210, 235, 25123 },
+    { 136, 195, 25126 },
+    { 103, 128, 25128 },
+    { 106, 121, 25128 },
+    { 161, 219, 25128 },
+    { 63, 97, 25131 },
+    { 124, 153, 25132 },
+    { 124, 154, 25132 },
+    { 26, 82, 25135 },
+    { 20, 44, 25137 },
+    { 202, 246, 25140 },
+    { 131, 169, 25142 },
+    { 40, 72, 25146 },
+    { 171, 200, 25146 },
+    { 22, 253, 25150 },
+    { 37, 51, 25152 },
+    { 110, 141, 25152 },
+    { 114, 131, 25155 },
+    { 93, 126, 25157 },
+    { 57, 70, 25166 },
+    { 203, 212, 25168 },
+    { 25, 45, 25169 },
+    { 48, 79, 25172 },
+    { 40, 82, 25175 },
+    { 160, 219, 25176 },
+    { 232, 254, 25181 },
+    { 32, 122, 25194 },
+    { 67, 81, 25194 },
+    { 192, 246, 25195 },
+    { 122, 173, 25205 },
+    { 145, 179, 25205 },
+    { 22, 225, 25206 },
+    { 231, 253, 25208 },
+    { 221, 252, 25210 },
+    { 33, 40, 25211 },
+    { 19, 23, 25216 },
+    { 122, 186, 25217 },
+    { 104, 121, 25221 },
+    { 206, 233, 25221 },
+    { 15, 38, 25224 },
+    { 78, 100, 25228 },
+    { 125, 173, 25228 },
+    { 10, 236, 25229 },
+    { 171, 202, 25234 },
+    { 217, 250, 25234 },
+    { 212, 243, 25241 },
+    { 172, 246, 25243 },
+    { 17, 45, 25244 },
+    { 15, 99, 25249 },
+    { 94, 149, 25250 },
+    { 71, 172, 25251 },
+    { 26, 92, 25255 },
+    { 27, 143, 25255 },
+    { 107, 145, 25255 },
+    { 106, 144, 25260 },
+    { 106, 145, 25260 },
+    { 53, 96, 25262 },
+    { 97, 152, 25264 },
+    { 50, 85, 25275 },
+    { 70, 76, 25276 },
+    { 23, 253, 25283 },
+    { 101, 140, 25284 },
+    { 13, 113, 25285 },
+    { 31, 64, 25287 },
+    { 169, 210, 25287 },
+    { 171, 217, 25287 },
+    { 97, 149, 25289 },
+    { 139, 205, 25291 },
+    { 61, 75, 25293 },
+    { 212, 230, 25297 },
+    { 67, 98, 25298 },
+    { 179, 203, 25307 },
+    { 62, 90, 25316 },
+    { 105, 126, 25316 },
+    { 160, 171, 25317 },
+    { 15, 108, 25320 },
+    { 46, 100, 25320 },
+    { 200, 246, 25320 },
+    { 38, 87, 25321 },
+    { 95, 149, 25322 },
+    { 188, 228, 25322 },
+    { 95, 98, 25328 },
+    { 185, 244, 25328 },
+    { 33, 51, 25330 },
+    { 47, 93, 25336 },
+    { 163, 189, 25340 },
+    { 169, 222, 25346 },
+    { 125, 207, 25351 },
+    { 60, 91, 25356 },
+    { 45, 76, 25357 },
+    { 202, 244, 25357 },
+    { 217, 242, 25363 },
+    { 18, 240, 25365 },
+    { 69, 95, 25368 },
+    { 11, 46, 25373 },
+    { 184, 237, 25373 },
+    { 117, 162, 25374 },
+    { 211, 248, 25374 },
+    { 235, 245, 25374 },
+    { 24, 88, 25381 },
+    { 157, 175, 25385 },
+    { 146, 215, 25391 },
+    { 103, 113, 25393 },
+    { 171, 199, 25395 },
+    { 124, 132, 25399 },
+    { 174, 194, 25402 },
+    { 223, 245, 25402 },
+    { 31, 72, 25403 },
+    { 137, 181, 25404 },
+    { 132, 173, 25408 },
+    { 55, 72, 25412 },
+    { 189, 249, 25412 },
+    { 54, 105, 25414 },
+    { 188, 207, 25416 },
+    { 15, 86, 25419 },
+    { 132, 208, 25419 },
+    { 69, 99, 25420 },
+    { 88, 225, 25421 },
+    { 3, 204, 25424 },
+    { 16, 35, 25425 },
+    { 40, 80, 25425 },
+    { 162, 193, 25425 },
+    { 32, 110, 25429 },
+    { 161, 210, 25433 },
+    { 2, 22, 25435 },
+    { 135, 152, 25437 },
+    { 190, 238, 25440 },
+    { 24, 253, 25453 },
+    { 87, 111, 25453 },
+    { 109, 201, 25453 },
+    { 78, 107, 25456 },
+    { 75, 109, 25461 },
+    { 11, 238, 25464 },
+    { 239, 254, 25464 },
+    { 2, 28, 25468 },
+    { 54, 104, 25470 },
+    { 99, 160, 25472 },
+    { 171, 216, 25472 },
+    { 213, 241, 25474 },
+    { 146, 191, 25475 },
+    { 227, 254, 25480 },
+    { 159, 215, 25482 },
+    { 57, 109, 25488 },
+    { 127, 174, 25491 },
+    { 104, 128, 25497 },
+    { 20, 246, 25504 },
+    { 131, 161, 25507 },
+    { 144, 217, 25509 },
+    { 75, 104, 25513 },
+    { 160, 234, 25515 },
+    { 125, 205, 25519 },
+    { 112, 137, 25525 },
+    { 152, 171, 25526 },
+    { 12, 38, 25527 },
+    { 21, 43, 25533 },
+    { 207, 231, 25537 },
+    { 76, 111, 25552 },
+    { 93, 164, 25553 },
+    { 126, 175, 25553 },
+    { 164, 246, 25553 },
+    { 62, 108, 25554 },
+    { 186, 232, 25559 },
+    { 66, 103, 25560 },
+    { 127, 182, 25560 },
+    { 205, 231, 25560 },
+    { 9, 243, 25562 },
+    { 30, 51, 25562 },
+    { 40, 43, 25562 },
+    { 43, 81, 25562 },
+    { 28, 47, 25563 },
+    { 48, 91, 25569 },
+    { 51, 59, 25572 },
+    { 130, 163, 25574 },
+    { 24, 66, 25576 },
+    { 139, 207, 25576 },
+    { 158, 220, 25577 },
+    { 125, 200, 25579 },
+    { 155, 218, 25581 },
+    { 12, 31, 25584 },
+    { 200, 244, 25585 },
+    { 189, 244, 25589 },
+    { 22, 35, 25591 },
+    { 25, 66, 25591 },
+    { 0, 241, 25596 },
+    { 103, 123, 25601 },
+    { 1, 199, 25602 },
+    { 102, 166, 25602 },
+    { 11, 237, 25603 },
+    { 67, 125, 25604 },
+    { 17, 60, 25606 },
+    { 109, 126, 25607 },
+    { 52, 84, 25608 },
+    { 38, 46, 25613 },
+    { 76, 122, 25614 },
+    { 203, 236, 25615 },
+    { 224, 248, 25615 },
+    { 162, 181, 25616 },
+    { 119, 209, 25618 },
+    { 145, 174, 25618 },
+    { 128, 178, 25623 },
+    { 137, 177, 25625 },
+    { 214, 233, 25626 },
+    { 44, 90, 25627 },
+    { 62, 104, 25627 },
+    { 107, 135, 25628 },
+    { 195, 247, 25628 },
+    { 127, 178, 25629 },
+    { 27, 73, 25635 },
+    { 32, 234, 25635 },
+    { 135, 177, 25637 },
+    { 159, 216, 25641 },
+    { 105, 148, 25643 },
+    { 51, 91, 25644 },
+    { 23, 66, 25646 },
+    { 81, 107, 25646 },
+    { 86, 156, 25651 },
+    { 139, 183, 25652 },
+    { 17, 50, 25656 },
+    { 67, 132, 25658 },
+    { 70, 100, 25658 },
+    { 3, 79, 25660 },
+    { 165, 181, 25661 },
+    { 190, 193, 25667 },
+    { 142, 182, 25669 },
+    { 180, 234, 25669 },
+    { 123, 184, 25670 },
+    { 26, 239, 25671 },
+    { 202, 231, 25671 },
+    { 167, 171, 25673 },
+    { 193, 221, 25675 },
+    { 40, 59, 25678 },
+    { 17, 59, 25679 },
+    { 71, 248, 25679 },
+    { 30, 42, 25683 },
+    { 220, 232, 25683 },
+    { 42, 82, 25685 },
+    { 100, 179, 25690 },
+    { 122, 159, 25693 },
+    { 182, 226, 25695 },
+    { 228, 254, 25697 },
+    { 43, 112, 25698 },
+    { 60, 113, 25698 },
+    { 87, 139, 25707 },
+    { 164, 218, 25709 },
+    { 12, 251, 25710 },
+    { 26, 70, 25710 },
+    { 32, 156, 25712 },
+    { 193, 237, 25712 },
+    { 160, 210, 25714 },
+    { 8, 60, 25719 },
+    { 15, 97, 25720 },
+    { 187, 232, 25731 },
+    { 82, 119, 25732 },
+    { 44, 72, 25742 },
+    { 164, 216, 25742 },
+    { 142, 188, 25747 },
+    { 193, 215, 25750 },
+    { 125, 234, 25752 },
+    { 67, 122, 25753 },
+    { 8, 179, 25754 },
+    { 144, 240, 25754 },
+    { 214, 228, 25756 },
+    { 13, 228, 25757 },
+    { 144, 255, 25757 },
+    { 149, 215, 25757 },
+    { 70, 88, 25758 },
+    { 58, 67, 25760 },
+    { 141, 154, 25765 },
+    { 141, 153, 25766 },
+    { 206, 237, 25767 },
+    { 55, 65, 25771 },
+    { 1, 28, 25772 },
+    { 113, 209, 25772 },
+    { 140, 194, 25774 },
+    { 1, 59, 25777 },
+    { 2, 13, 25777 },
+    { 183, 229, 25777 },
+    { 138, 189, 25781 },
+    { 19, 217, 25787 },
+    { 138, 192, 25791 },
+    { 74, 108, 25793 },
+    { 127, 200, 25793 },
+    { 128, 164, 25796 },
+    { 78, 79, 25797 },
+    { 129, 208, 25798 },
+    { 162, 219, 25798 },
+    { 23, 48, 25800 },
+    { 187, 203, 25802 },
+    { 85, 117, 25805 },
+    { 32, 83, 25807 },
+    { 18, 239, 25808 },
+    { 32, 133, 25808 },
+    { 203, 205, 25810 },
+    { 133, 208, 25816 },
+    { 125, 202, 25817 },
+    { 131, 160, 25822 },
+    { 112, 150, 25825 },
+    { 161, 223, 25828 },
+    { 126, 132, 25830 },
+    { 29, 41, 25833 },
+    { 13, 233, 25835 },
+    { 49, 87, 25835 },
+    { 127, 180, 25837 },
+    { 193, 202, 25844 },
+    { 161, 234, 25845 },
+    { 160, 223, 25846 },
+    { 36, 49, 25849 },
+    { 124, 129, 25851 },
+    { 13, 179, 25853 },
+    { 81, 111, 25853 },
+    { 127, 207, 25854 },
+    { 98, 107, 25855 },
+    { 224, 252, 25856 },
+    { 139, 177, 25862 },
+    { 139, 176, 25863 },
+    { 168, 227, 25864 },
+    { 62, 91, 25869 },
+    { 104, 234, 25875 },
+    { 212, 229, 25877 },
+    { 70, 106, 25880 },
+    { 150, 173, 25883 },
+    { 11, 254, 25884 },
+    { 99, 161, 25885 },
+    { 14, 53, 25886 },
+    { 37, 81, 25886 },
+    { 147, 248, 25886 },
+    { 180, 226, 25887 },
+    { 230, 251, 25889 },
+    { 39, 56, 25891 },
+    { 49, 93, 25894 },
+    { 38, 89, 25895 },
+    { 44, 65, 25896 },
+    { 121, 173, 25896 },
+    { 64, 83, 25899 },
+    { 147, 213, 25900 },
+    { 166, 224, 25900 },
+    { 2, 25, 25902 },
+    { 22, 80, 25903 },
+    { 22, 250, 25908 },
+    { 52, 72, 25912 },
+    { 193, 200, 25912 },
+    { 209, 226, 25912 },
+    { 128, 172, 25915 },
+    { 23, 240, 25918 },
+    { 49, 89, 25919 },
+    { 95, 160, 25919 },
+    { 121, 150, 25921 },
+    { 135, 140, 25924 },
+    { 127, 205, 25925 },
+    { 68, 75, 25931 },
+    { 212, 222, 25931 },
+    { 3, 192, 25933 },
+    { 20, 87, 25933 },
+    { 21, 64, 25933 },
+    { 35, 77, 25933 },
+    { 106, 142, 25934 },
+    { 119, 135, 25934 },
+    { 141, 151, 25940 },
+    { 117, 187, 25941 },
+    { 169, 227, 25950 },
+    { 9, 54, 25951 },
+    { 63, 95, 25952 },
+    { 76, 125, 25957 },
+    { 154, 163, 25958 },
+    { 200, 231, 25958 },
+    { 112, 199, 25960 },
+    { 92, 255, 25961 },
+    { 153, 163, 25961 },
+    { 177, 189, 25963 },
+    { 215, 241, 25966 },
+    { 183, 230, 25968 },
+    { 207, 249, 25969 },
+    { 141, 186, 25971 },
+    { 199, 230, 25974 },
+    { 77, 117, 25978 },
+    { 76, 120, 25981 },
+    { 88, 103, 25982 },
+    { 123, 195, 25983 },
+    { 79, 130, 25986 },
+    { 112, 240, 25986 },
+    { 167, 224, 25990 },
+    { 204, 249, 25991 },
+    { 5, 233, 25994 },
+    { 3, 120, 25997 },
+    { 130, 200, 25997 },
+    { 132, 182, 25998 },
+    { 25, 92, 26001 },
+    { 36, 100, 26007 },
+    { 7, 253, 26008 },
+    { 135, 174, 26017 },
+    { 44, 84, 26021 },
+    { 129, 173, 26021 },
+    { 135, 175, 26026 },
+    { 81, 100, 26035 },
+    { 236, 241, 26037 },
+    { 43, 51, 26038 },
+    { 178, 194, 26042 },
+    { 124, 173, 26046 },
+    { 193, 208, 26049 },
+    { 214, 242, 26050 },
+    { 37, 42, 26051 },
+    { 148, 211, 26051 },
+    { 127, 202, 26053 },
+    { 154, 216, 26057 },
+    { 225, 253, 26057 },
+    { 153, 216, 26059 },
+    { 175, 184, 26061 },
+    { 100, 151, 26064 },
+    { 60, 112, 26067 },
+    { 75, 111, 26075 },
+    { 237, 243, 26075 },
+    { 238, 251, 26078 },
+    { 102, 170, 26079 },
+    { 204, 226, 26082 },
+    { 163, 218, 26086 },
+    { 155, 221, 26091 },
+    { 143, 215, 26092 },
+    { 169, 225, 26092 },
+    { 33, 249, 26093 },
+    { 181, 233, 26096 },
+    { 64, 73, 26099 },
+    { 42, 80, 26100 },
+    { 76, 129, 26100 },
+    { 46, 90, 26101 },
+    { 45, 67, 26105 },
+    { 171, 220, 26106 },
+    { 23, 44, 26111 },
+    { 53, 62, 26112 },
+    { 171, 213, 26112 },
+    { 216, 248, 26112 },
+    { 68, 98, 26117 },
+    { 45, 91, 26121 },
+    { 214, 243, 26126 },
+    { 15, 62, 26127 },
+    { 211, 243, 26128 },
+    { 139, 196, 26132 },
+    { 186, 226, 26132 },
+    { 220, 253, 26137 },
+    { 180, 235, 26138 },
+    { 143, 211, 26142 },
+    { 23, 40, 26143 },
+    { 86, 164, 26149 },
+    { 100, 190, 26152 },
+    { 7, 242, 26156 },
+    { 22, 158, 26158 },
+    { 87, 98, 26160 },
+    { 120, 186, 26164 },
+    { 21, 60, 26166 },
+    { 167, 235, 26166 },
+    { 54, 66, 26167 },
+    { 80, 116, 26167 },
+    { 19, 60, 26168 },
+    { 63, 99, 26176 },
+    { 19, 136, 26177 },
+    { 110, 189, 26177 },
+    { 168, 203, 26178 },
+    { 170, 235, 26183 },
+    { 135, 146, 26185 },
+    { 53, 75, 26188 },
+    { 5, 37, 26189 },
+    { 3, 110, 26190 },
+    { 136, 209, 26190 },
+    { 162, 214, 26193 },
+    { 19, 151, 26214 },
+    { 213, 249, 26214 },
+    { 68, 83, 26215 },
+    { 194, 238, 26215 },
+    { 89, 128, 26219 },
+    { 171, 208, 26219 },
+    { 180, 194, 26220 },
+    { 99, 126, 26221 },
+    { 192, 244, 26221 },
+    { 27, 77, 26222 },
+    { 52, 65, 26223 },
+    { 130, 135, 26224 },
+    { 134, 181, 26228 },
+    { 29, 88, 26230 },
+    { 152, 218, 26233 },
+    { 146, 177, 26236 },
+    { 162, 221, 26238 },
+    { 222, 250, 26242 },
+    { 169, 228, 26245 },
+    { 17, 40, 26246 },
+    { 154, 221, 26253 },
+    { 179, 188, 26253 },
+    { 4, 245, 26254 },
+    { 153, 221, 26254 },
+    { 33, 125, 26255 },
+    { 162, 169, 26259 },
+    { 15, 117, 26264 },
+    { 97, 126, 26268 },
+    { 61, 73, 26273 },
+    { 191, 195, 26273 },
+    { 157, 162, 26279 },
+    { 130, 202, 26280 },
+    { 154, 191, 26280 },
+    { 164, 223, 26280 },
+    { 24, 48, 26282 },
+    { 113, 145, 26282 },
+    { 134, 135, 26282 },
+    { 153, 191, 26282 },
+    { 48, 84, 26283 },
+    { 185, 224, 26287 },
+    { 30, 92, 26288 },
+    { 62, 64, 26291 },
+    { 177, 197, 26292 },
+    { 61, 62, 26293 },
+    { 163, 197, 26293 },
+    { 22, 92, 26295 },
+    { 54, 108, 26296 },
+    { 120, 174, 26296 },
+    { 181, 225, 26298 },
+    { 37, 113, 26301 },
+    { 221, 245, 26301 },
+    { 82, 85, 26302 },
+    { 61, 83, 26307 },
+    { 168, 188, 26308 },
+    { 133, 234, 26309 },
+    { 143, 234, 26311 },
+    { 15, 31, 26312 },
+    { 81, 93, 26312 },
+    { 131, 174, 26314 },
+    { 126, 129, 26316 },
+    { 139, 208, 26317 },
+    { 125, 182, 26320 },
+    { 12, 95, 26324 },
+    { 219, 245, 26326 },
+    { 214, 238, 26327 },
+    { 40, 84, 26333 },
+    { 124, 174, 26334 },
+    { 150, 206, 26334 },
+    { 168, 171, 26336 },
+    { 156, 221, 26339 },
+    { 220, 241, 26341 },
+    { 66, 106, 26346 },
+    { 67, 78, 26349 },
+    { 231, 246, 26349 },
+    { 95, 161, 26350 },
+    { 171, 209, 26350 },
+    { 62, 109, 26353 },
+    { 187, 193, 26355 },
+    { 131, 144, 26357 },
+    { 149, 213, 26357 },
+    { 188, 192, 26358 },
+    { 2, 29, 26359 },
+    { 103, 142, 26360 },
+    { 79, 90, 26367 },
+    { 117, 204, 26367 },
+    { 95, 124, 26368 },
+    { 12, 164, 26369 },
+    { 63, 80, 26370 },
+    { 89, 155, 26370 },
+    { 32, 69, 26374 },
+    { 85, 120, 26374 },
+    { 162, 203, 26375 },
+    { 87, 155, 26381 },
+    { 121, 174, 26382 },
+    { 50, 76, 26384 },
+    { 203, 207, 26385 },
+    { 210, 241, 26388 },
+    { 130, 205, 26389 },
+    { 23, 88, 26392 },
+    { 147, 163, 26393 },
+    { 234, 241, 26397 },
+    { 9, 57, 26399 },
+    { 99, 167, 26405 },
+    { 197, 232, 26405 },
+    { 34, 54, 26406 },
+    { 131, 155, 26408 },
+    { 158, 194, 26409 },
+    { 25, 58, 26412 },
+    { 159, 164, 26413 },
+    { 59, 114, 26417 },
+    { 226, 235, 26417 },
+    { 1, 88, 26422 },
+    { 62, 110, 26424 },
+    { 74, 82, 26426 },
+    { 164, 219, 26426 },
+    { 146, 176, 26427 },
+    { 140, 217, 26428 },
+    { 32, 127, 26433 },
+    { 184, 239, 26434 },
+    { 8, 209, 26438 },
+    { 154, 218, 26438 },
+    { 153, 218, 26439 },
+    { 142, 143, 26441 },
+    { 6, 88, 26444 },
+    { 82, 83, 26447 },
+    { 14, 45, 26448 },
+    { 59, 90, 26451 },
+    { 130, 207, 26452 },
+    { 97, 160, 26453 },
+    { 99, 138, 26453 },
+    { 51, 86, 26455 },
+    { 128, 180, 26456 },
+    { 239, 242, 26457 },
+    { 27, 38, 26458 },
+    { 27, 130, 26459 },
+    { 22, 50, 26460 },
+    { 191, 235, 26460 },
+    { 34, 62, 26464 },
+    { 157, 174, 26464 },
+    { 1, 36, 26471 },
+    { 20, 75, 26471 },
+    { 23, 52, 26476 },
+    { 18, 50, 26479 },
+    { 48, 72, 26485 },
+    { 79, 91, 26485 },
+    { 125, 141, 26490 },
+    { 81, 86, 26493 },
+    { 20, 52, 26494 },
+    { 33, 110, 26503 },
+    { 94, 166, 26506 },
+    { 219, 252, 26507 },
+    { 5, 251, 26515 },
+    { 146, 213, 26515 },
+    { 28, 82, 26517 },
+    { 133, 175, 26517 },
+    { 64, 107, 26518 },
+    { 178, 226, 26521 },
+    { 131, 175, 26522 },
+    { 176, 189, 26522 },
+    { 118, 148, 26523 },
+    { 83, 117, 26525 },
+    { 119, 240, 26525 },
+    { 72, 98, 26529 },
+    { 171, 205, 26529 },
+    { 10, 237, 26532 },
+    { 24, 80, 26534 },
+    { 132, 180, 26537 },
+    { 3, 207, 26539 },
+    { 20, 48, 26539 },
+    { 156, 216, 26544 },
+    { 15, 172, 26549 },
+    { 20, 55, 26550 },
+    { 129, 182, 26556 },
+    { 101, 144, 26559 },
+    { 178, 234, 26559 },
+    { 226, 244, 26567 },
+    { 132, 178, 26573 },
+    { 169, 173, 26574 },
+    { 188, 204, 26574 },
+    { 12, 129, 26575 },
+    { 10, 242, 26577 },
+    { 80, 123, 26577 },
+    { 131, 176, 26578 },
+    { 76, 132, 26579 },
+    { 140, 239, 26580 },
+    { 38, 68, 26584 },
+    { 26, 100, 26588 },
+    { 203, 238, 26593 },
+    { 15, 156, 26597 },
+    { 145, 203, 26599 },
+    { 193, 236, 26599 },
+    { 15, 76, 26600 },
+    { 21, 54, 26601 },
+    { 25, 253, 26601 },
+    { 43, 107, 26605 },
+    { 86, 153, 26605 },
+    { 86, 154, 26608 },
+    { 18, 45, 26611 },
+    { 135, 173, 26612 },
+    { 92, 168, 26615 },
+    { 98, 135, 26616 },
+    { 163, 198, 26616 },
+    { 122, 207, 26617 },
+    { 115, 138, 26620 },
+    { 141, 187, 26620 },
+    { 155, 219, 26621 },
+    { 214, 235, 26625 },
+    { 72, 130, 26628 },
+    { 94, 234, 26628 },
+    { 126, 171, 26628 },
+    { 198, 232, 26629 },
+    { 64, 85, 26631 },
+    { 193, 212, 26631 },
+    { 131, 166, 26632 },
+    { 194, 216, 26632 },
+    { 125, 159, 26640 },
+    { 107, 131, 26644 },
+    { 4, 241, 26648 },
+    { 24, 239, 26649 },
+    { 176, 220, 26650 },
+    { 24, 44, 26652 },
+    { 20, 74, 26653 },
+    { 125, 178, 26653 },
+    { 25, 82, 26656 },
+    { 44, 91, 26656 },
+    { 122, 200, 26657 },
+    { 208, 249, 26658 },
+    { 57, 66, 26665 },
+    { 3, 57, 26668 },
+    { 224, 251, 26668 },
+    { 126, 156, 26669 },
+    { 190, 203, 26670 },
+    { 177, 220, 26676 },
+    { 159, 214, 26678 },
+    { 0, 228, 26681 },
+    { 120, 142, 26683 },
+    { 205, 249, 26683 },
+    { 172, 224, 26684 },
+    { 124, 156, 26686 },
+    { 29, 255, 26689 },
+    { 131, 173, 26689 },
+    { 177, 198, 26690 },
+    { 172, 183, 26695 },
+    { 131, 143, 26696 },
+    { 12, 89, 26698 },
+    { 122, 182, 26706 },
+    { 185, 191, 26706 },
+    { 68, 85, 26708 },
+    { 170, 214, 26709 },
+    { 56, 71, 26712 },
+    { 135, 161, 26714 },
+    { 151, 220, 26714 },
+    { 148, 212, 26716 },
+    { 95, 167, 26719 },
+    { 74, 111, 26722 },
+    { 122, 205, 26723 },
+    { 9, 38, 26724 },
+    { 223, 242, 26728 },
+    { 98, 105, 26732 },
+    { 2, 236, 26735 },
+    { 125, 180, 26736 },
+    { 156, 218, 26736 },
+    { 150, 165, 26746 },
+    { 169, 178, 26747 },
+    { 125, 208, 26748 },
+    { 48, 65, 26755 },
+    { 171, 192, 26755 },
+    { 98, 120, 26757 },
+    { 30, 31, 26759 },
+    { 122, 174, 26759 },
+    { 23, 250, 26768 },
+    { 108, 201, 26769 },
+    { 11, 179, 26771 },
+    { 86, 121, 26772 },
+    { 3, 155, 26776 },
+    { 24, 40, 26784 },
+    { 182, 232, 26794 },
+    { 102, 124, 26796 },
+    { 229, 251, 26796 },
+    { 26, 48, 26803 },
+    { 9, 72, 26805 },
+    { 33, 44, 26819 },
+    { 54, 109, 26819 },
+    { 76, 127, 26822 },
+    { 132, 212, 26830 },
+    { 85, 101, 26831 },
+    { 150, 209, 26832 },
+    { 49, 90, 26833 },
+    { 94, 170, 26833 },
+    { 5, 39, 26834 },
+    { 122, 178, 26834 },
+    { 194, 224, 26835 },
+    { 24, 250, 26839 },
+    { 97, 138, 26840 },
+    { 10, 19, 26845 },
+    { 81, 116, 26847 },
+    { 97, 161, 26856 },
+    { 125, 174, 26856 },
+    { 187, 248, 26857 },
+    { 176, 217, 26858 },
+    { 120, 178, 26859 },
+    { 223, 251, 26865 },
+    { 78, 88, 26868 },
+    { 118, 169, 26870 },
+    { 12, 79, 26875 },
+    { 19, 195, 26875 },
+    { 145, 199, 26875 },
+    { 74, 109, 26878 },
+    { 164, 249, 26878 },
+    { 3, 130, 26880 },
+    { 145, 173, 26883 },
+    { 176, 197, 26884 },
+    { 38, 93, 26887 },
+    { 220, 224, 26888 },
+    { 5, 36, 26889 },
+    { 53, 73, 26892 },
+    { 23, 31, 26893 },
+    { 4, 31, 26899 },
+    { 20, 35, 26899 },
+    { 222, 225, 26905 },
+    { 120, 204, 26906 },
+    { 193, 205, 26907 },
+    { 27, 244, 26908 },
+    { 122, 202, 26911 },
+    { 102, 138, 26912 },
+    { 94, 201, 26915 },
+    { 10, 46, 26917 },
+    { 197, 214, 26917 },
+    { 74, 104, 26919 },
+    { 95, 189, 26919 },
+    { 94, 121, 26920 },
+    { 162, 223, 26921 },
+    { 172, 249, 26923 },
+    { 57, 110, 26927 },
+    { 36, 96, 26929 },
+    { 163, 195, 26930 },
+    { 64, 77, 26933 },
+    { 147, 235, 26937 },
+    { 20, 94, 26938 },
+    { 110, 131, 26940 },
+    { 42, 86, 26941 },
+    { 2, 26, 26942 },
+    { 182, 194, 26943 },
+    { 12, 109, 26950 },
+    { 24, 52, 26951 },
+    { 159, 194, 26951 },
+    { 226, 250, 26953 },
+    { 107, 150, 26954 },
+    { 67, 120, 26960 },
+    { 220, 255, 26960 },
+    { 208, 222, 26962 },
+    { 113, 150, 26967 },
+    { 65, 164, 26970 },
+    { 13, 100, 26972 },
+    { 208, 230, 26974 },
+    { 7, 10, 26982 },
+    { 177, 229, 26984 },
+    { 31, 79, 26992 },
+    { 88, 116, 26995 },
+    { 127, 175, 26995 },
+    { 14, 40, 26997 },
+    { 170, 188, 26997 },
+    { 177, 217, 26998 },
+    { 152, 221, 26999 },
+    { 14, 50, 27001 },
+    { 34, 74, 27005 },
+    { 128, 182, 27009 },
+    { 6, 209, 27013 },
+    { 35, 83, 27013 },
+    { 122, 180, 27015 },
+    { 66, 107, 27019 },
+    { 87, 121, 27021 },
+    { 32, 172, 27022 },
+    { 216, 249, 27024 },
+    { 103, 141, 27030 },
+    { 20, 69, 27035 },
+    { 183, 231, 27035 },
+    { 17, 247, 27036 },
+    { 104, 138, 27038 },
+    { 212, 241, 27041 },
+    { 21, 63, 27042 },
+    { 113, 239, 27042 },
+    { 32, 85, 27048 },
+    { 121, 164, 27051 },
+    { 222, 239, 27051 },
+    { 42, 59, 27053 },
+    { 67, 127, 27057 },
+    { 1, 217, 27061 },
+    { 15, 125, 27063 },
+    { 104, 111, 27064 },
+    { 23, 80, 27066 },
+    { 6, 179, 27074 },
+    { 135, 160, 27075 },
+    { 22, 100, 27076 },
+    { 131, 177, 27085 },
+    { 124, 175, 27086 },
+    { 173, 194, 27086 },
+    { 175, 226, 27089 },
+    { 150, 178, 27090 },
+    { 163, 219, 27096 },
+    { 120, 182, 27098 },
+    { 39, 113, 27100 },
+    { 10, 59, 27101 },
+    { 42, 43, 27101 },
+    { 132, 174, 27102 },
+    { 25, 100, 27103 },
+    { 56, 98, 27104 },
+    { 20, 86, 27108 },
+    { 61, 85, 27109 },
+    { 68, 73, 27109 },
+    { 129, 180, 27110 },
+    { 178, 235, 27110 },
+    { 23, 55, 27113 },
+    { 123, 135, 27113 },
+    { 21, 66, 27117 },
+    { 86, 91, 27119 },
+    { 106, 128, 27126 },
+    { 211, 241, 27128 },
+    { 81, 115, 27131 },
+    { 125, 248, 27133 },
+    { 46, 91, 27138 },
+    { 18, 19, 27140 },
+    { 13, 92, 27143 },
+    { 134, 239, 27148 },
+    { 66, 76, 27149 },
+    { 127, 208, 27149 },
+    { 12, 132, 27150 },
+    { 129, 212, 27150 },
+    { 15, 47, 27151 },
+    { 73, 111, 27155 },
+    { 170, 206, 27155 },
+    { 27, 75, 27160 },
+    { 129, 178, 27160 },
+    { 13, 237, 27161 },
+    { 155, 223, 27161 },
+    { 84, 121, 27163 },
+    { 126, 178, 27163 },
+    { 98, 108, 27168 },
+    { 104, 148, 27169 },
+    { 118, 159, 27171 },
+    { 3, 54, 27173 },
+    { 158, 181, 27173 },
+    { 187, 226, 27179 },
+    { 8, 46, 27180 },
+    { 18, 61, 27184 },
+    { 58, 96, 27185 },
+    { 53, 100, 27186 },
+    { 103, 134, 27187 },
+    { 184, 240, 27187 },
+    { 138, 157, 27188 },
+    { 150, 190, 27191 },
+    { 86, 90, 27192 },
+    { 88, 90, 27194 },
+    { 6, 60, 27195 },
+    { 20, 77, 27197 },
+    { 99, 189, 27197 },
+    { 3, 205, 27200 },
+    { 204, 231, 27200 },
+    { 137, 184, 27209 },
+    { 61, 77, 27211 },
+    { 120, 180, 27211 },
+    { 36, 47, 27219 },
+    { 104, 192, 27234 },
+    { 230, 244, 27237 },
+    { 163, 172, 27239 },
+    { 37, 56, 27247 },
+    { 17, 44, 27251 },
+    { 201, 206, 27251 },
+    { 159, 184, 27255 },
+    { 111, 152, 27261 },
+    { 72, 164, 27262 },
+    { 171, 207, 27263 },
+    { 151, 159, 27264 },
+    { 157, 220, 27264 },
+    { 102, 248, 27265 },
+    { 193, 232, 27267 },
+    { 126, 157, 27268 },
+    { 8, 199, 27269 },
+    { 64, 103, 27271 },
+    { 2, 30, 27272 },
+    { 41, 60, 27272 },
+    { 13, 238, 27275 },
+    { 148, 157, 27276 },
+    { 61, 107, 27277 },
+    { 176, 198, 27279 },
+    { 59, 91, 27280 },
+    { 121, 175, 27280 },
+    { 229, 239, 27281 },
+    { 107, 179, 27282 },
+    { 59, 119, 27284 },
+    { 137, 175, 27296 },
+    { 5, 43, 27297 },
+    { 89, 124, 27301 },
+    { 119, 184, 27301 },
+    { 110, 162, 27303 },
+    { 142, 184, 27303 },
+    { 144, 193, 27304 },
+    { 154, 219, 27307 },
+    { 153, 219, 27309 },
+    { 22, 165, 27314 },
+    { 152, 219, 27315 },
+    { 29, 78, 27316 },
+    { 183, 232, 27316 },
+    { 211, 249, 27317 },
+    { 27, 201, 27318 },
+    { 176, 229, 27320 },
+    { 198, 214, 27320 },
+    { 209, 214, 27320 },
+    { 152, 234, 27321 },
+    { 13, 34, 27323 },
+    { 32, 147, 27327 },
+    { 177, 230, 27329 },
+    { 3, 146, 27331 },
+    { 85, 106, 27331 },
+    { 139, 171, 27336 },
+    { 199, 226, 27336 },
+    { 56, 59, 27341 },
+    { 28, 78, 27343 },
+    { 219, 242, 27345 },
+    { 82, 123, 27351 },
+    { 109, 192, 27353 },
+    { 221, 251, 27353 },
+    { 14, 247, 27354 },
+    { 23, 239, 27356 },
+    { 188, 233, 27356 },
+    { 154, 183, 27358 },
+    { 3, 212, 27361 },
+    { 153, 183, 27361 },
+    { 166, 188, 27367 },
+    { 138, 191, 27368 },
+    { 139, 191, 27371 },
+    { 117, 234, 27376 },
+    { 91, 124, 27378 },
+    { 169, 180, 27378 },
+    { 37, 112, 27385 },
+    { 103, 145, 27389 },
+    { 141, 191, 27398 },
+    { 12, 62, 27399 },
+    { 96, 111, 27399 },
+    { 166, 235, 27400 },
+    { 93, 138, 27401 },
+    { 107, 157, 27401 },
+    { 33, 55, 27406 },
+    { 117, 186, 27408 },
+    { 194, 239, 27408 },
+    { 24, 70, 27412 },
+    { 218, 252, 27414 },
+    { 145, 149, 27420 },
+    { 26, 52, 27423 },
+    { 94, 128, 27425 },
+    { 60, 255, 27429 },
+    { 210, 234, 27429 },
+    { 26, 44, 27433 },
+    { 154, 223, 27435 },
+    { 153, 223, 27437 },
+    { 23, 70, 27445 },
+    { 42, 90, 27445 },
+    { 97, 167, 27445 },
+    { 145, 165, 27446 },
+    { 18, 31, 27447 },
+    { 56, 93, 27448 },
+    { 65, 156, 27449 },
+    { 64, 98, 27452 },
+    { 67, 133, 27452 },
+    { 183, 220, 27452 },
+    { 218, 245, 27453 },
+    { 152, 210, 27455 },
+    { 229, 247, 27459 },
+    { 219, 227, 27461 },
+    { 181, 216, 27463 },
+    { 85, 122, 27466 },
+    { 208, 229, 27466 },
+    { 191, 220, 27467 },
+    { 70, 107, 27474 },
+    { 151, 206, 27475 },
+    { 191, 234, 27476 },
+    { 64, 106, 27477 },
+    { 220, 245, 27483 },
+    { 137, 168, 27485 },
+    { 143, 213, 27487 },
+    { 30, 240, 27489 },
+    { 60, 69, 27489 },
+    { 88, 91, 27489 },
+    { 25, 225, 27490 },
+    { 33, 122, 27495 },
+    { 72, 156, 27495 },
+    { 180, 232, 27497 },
+    { 3, 167, 27499 },
+    { 102, 201, 27501 },
+    { 11, 113, 27505 },
+    { 148, 188, 27505 },
+    { 43, 240, 27508 },
+    { 50, 67, 27508 },
+    { 121, 172, 27508 },
+    { 58, 79, 27509 },
+    { 96, 158, 27515 },
+    { 138, 196, 27516 },
+    { 29, 49, 27518 },
+    { 232, 233, 27519 },
+    { 137, 174, 27526 },
+    { 193, 207, 27526 },
+    { 226, 251, 27526 },
+    { 120, 135, 27530 },
+    { 14, 60, 27531 },
+    { 36, 63, 27533 },
+    { 165, 227, 27533 },
+    { 17, 48, 27534 },
+    { 22, 45, 27534 },
+    { 227, 243, 27535 },
+    { 156, 223, 27537 },
+    { 228, 245, 27537 },
+    { 25, 70, 27538 },
+    { 156, 219, 27538 },
+    { 72, 147, 27539 },
+    { 25, 250, 27545 },
+    { 76, 133, 27546 },
+    { 135, 181, 27548 },
+    { 174, 184, 27551 },
+    { 128, 171, 27553 },
+    { 73, 117, 27554 },
+    { 110, 198, 27554 },
+    { 138, 197, 27558 },
+    { 105, 201, 27560 },
+    { 106, 141, 27562 },
+    { 114, 169, 27568 },
+    { 148, 215, 27568 },
+    { 75, 82, 27569 },
+    { 171, 218, 27571 },
+    { 130, 208, 27572 },
+    { 12, 105, 27573 },
+    { 111, 132, 27574 },
+    { 113, 137, 27574 },
+    { 244, 254, 27574 },
+    { 24, 55, 27577 },
+    { 126, 136, 27588 },
+    { 150, 158, 27589 },
+    { 156, 191, 27593 },
+    { 95, 126, 27594 },
+    { 138, 200, 27594 },
+    { 101, 124, 27595 },
+    { 171, 226, 27595 },
+    { 27, 47, 27596 },
+    { 47, 97, 27597 },
+    { 85, 121, 27600 },
+    { 135, 166, 27601 },
+    { 16, 61, 27606 },
+    { 192, 226, 27607 },
+    { 34, 57, 27608 },
+    { 53, 54, 27609 },
+    { 159, 218, 27611 },
+    { 41, 87, 27614 },
+    { 83, 120, 27614 },
+    { 106, 150, 27622 },
+    { 112, 209, 27624 },
+    { 95, 138, 27630 },
+    { 109, 248, 27631 },
+    { 165, 237, 27635 },
+    { 142, 191, 27637 },
+    { 68, 112, 27638 },
+    { 138, 198, 27638 },
+    { 133, 212, 27639 },
+    { 68, 77, 27641 },
+    { 65, 130, 27643 },
+    { 14, 59, 27644 },
+    { 226, 254, 27644 },
+    { 10, 233, 27647 },
+    { 30, 247, 27649 },
+    { 58, 98, 27654 },
+    { 33, 52, 27659 },
+    { 12, 47, 27661 },
+    { 180, 222, 27661 },
+    { 166, 214, 27664 },
+    { 96, 137, 27666 },
+    { 15, 198, 27669 },
+    { 191, 227, 27672 },
+    { 22, 113, 27675 },
+    { 22, 66, 27677 },
+    { 49, 91, 27678 },
+    { 202, 222, 27678 },
+    { 150, 191, 27679 },
+    { 86, 146, 27682 },
+    { 32, 42, 27685 },
+    { 179, 238, 27687 },
+    { 32, 153, 27688 },
+    { 32, 154, 27690 },
+    { 176, 230, 27690 },
+    { 31, 83, 27691 },
+    { 11, 34, 27692 },
+    { 138, 185, 27694 },
+    { 5, 34, 27700 },
+    { 114, 142, 27700 },
+    { 117, 141, 27700 },
+    { 49, 60, 27701 },
+    { 138, 201, 27704 },
+    { 241, 248, 27705 },
+    { 12, 86, 27708 },
+    { 102, 148, 27714 },
+    { 60, 63, 27717 },
+    { 36, 255, 27718 },
+    { 148, 213, 27718 },
+    { 32, 56, 27720 },
+    { 129, 174, 27720 },
+    { 13, 112, 27723 },
+    { 190, 222, 27725 },
+    { 195, 255, 27726 },
+    { 141, 156, 27729 },
+    { 157, 191, 27730 },
+    { 217, 253, 27736 },
+    { 216, 227, 27737 },
+    { 195, 231, 27741 },
+    { 62, 68, 27742 },
+    { 120, 175, 27742 },
+    { 182, 222, 27747 },
+    { 3, 93, 27752 },
+    { 91, 121, 27753 },
+    { 33, 164, 27754 },
+    { 143, 183, 27762 },
+    { 59, 123, 27764 },
+    { 206, 238, 27764 },
+    { 155, 171, 27775 },
+    { 111, 129, 27776 },
+    { 143, 191, 27777 },
+    { 146, 234, 27777 },
+    { 95, 198, 27778 },
+    { 12, 99, 27779 },
+    { 13, 209, 27780 },
+    { 203, 204, 27781 },
+    { 129, 235, 27782 },
+    { 94, 111, 27783 },
+    { 140, 142, 27783 },
+    { 36, 38, 27787 },
+    { 171, 215, 27791 },
+    { 171, 179, 27792 },
+    { 123, 239, 27793 },
+    { 221, 242, 27794 },
+    { 149, 150, 27798 },
+    { 89, 152, 27799 },
+    { 65, 147, 27800 },
+    { 175, 222, 27806 },
+    { 110, 197, 27815 },
+    { 189, 214, 27815 },
+    { 55, 86, 27817 },
+    { 8, 113, 27820 },
+    { 118, 139, 27820 },
+    { 99, 166, 27824 },
+    { 17, 42, 27825 },
+    { 102, 126, 27827 },
+    { 136, 194, 27828 },
+    { 192, 249, 27835 },
+    { 24, 31, 27837 },
+    { 171, 204, 27840 },
+    { 132, 235, 27841 },
+    { 104, 124, 27843 },
+    { 131, 170, 27843 },
+    { 209, 250, 27844 },
+    { 166, 206, 27845 },
+    { 84, 143, 27848 },
+    { 139, 145, 27848 },
+    { 127, 131, 27851 },
+    { 179, 222, 27852 },
+    { 47, 95, 27854 },
+    { 12, 108, 27856 },
+    { 16, 236, 27858 },
+    { 21, 70, 27865 },
+    { 132, 159, 27865 },
+    { 173, 234, 27873 },
+    { 78, 111, 27877 },
+    { 210, 243, 27878 },
+    { 119, 195, 27880 },
+    { 19, 96, 27884 },
+    { 138, 202, 27884 },
+    { 147, 191, 27892 },
+    { 2, 233, 27894 },
+    { 93, 149, 27895 },
+    { 200, 222, 27895 },
+    { 47, 90, 27896 },
+    { 41, 89, 27899 },
+    { 1, 168, 27904 },
+    { 11, 209, 27904 },
+    { 35, 67, 27906 },
+    { 23, 42, 27907 },
+    { 30, 56, 27907 },
+    { 164, 191, 27907 },
+    { 93, 155, 27911 },
+    { 40, 90, 27916 },
+    { 10, 245, 27918 },
+    { 117, 248, 27924 },
+    { 122, 234, 27924 },
+    { 25, 158, 27926 },
+    { 78, 116, 27936 },
+    { 188, 232, 27940 },
+    { 89, 149, 27944 },
+    { 135, 155, 27945 },
+    { 4, 71, 27946 },
+    { 134, 194, 27946 },
+    { 33, 185, 27949 },
+    { 35, 76, 27950 },
+    { 122, 208, 27951 },
+    { 58, 84, 27952 },
+    { 202, 249, 27954 },
+    { 16, 225, 27957 },
+    { 156, 163, 27959 },
+    { 31, 68, 27960 },
+    { 1, 227, 27961 },
+    { 223, 227, 27961 },
+    { 141, 181, 27962 },
+    { 155, 210, 27964 },
+    { 3, 208, 27966 },
+    { 131, 167, 27966 },
+    { 70, 84, 27970 },
+    { 9, 67, 27975 },
+    { 49, 82, 27979 },
+    { 26, 55, 27987 },
+    { 181, 236, 27988 },
+    { 127, 234, 27990 },
+    { 150, 180, 27990 },
+    { 117, 173, 27991 },
+    { 181, 186, 27992 },
+    { 19, 237, 27994 },
+    { 231, 234, 27994 },
+    { 152, 223, 28003 },
+    { 218, 227, 28003 },
+    { 18, 64, 28007 },
+    { 33, 48, 28008 },
+    { 140, 171, 28011 },
+    { 208, 243, 28012 },
+    { 53, 83, 28013 },
+    { 78, 115, 28013 },
+    { 228, 241, 28014 },
+    { 230, 239, 28014 },
+    { 161, 224, 28017 },
+    { 119, 131, 28018 },
+    { 6, 199, 28021 },
+    { 192, 203, 28021 },
+    { 84, 147, 28028 },
+    { 109, 234, 28032 },
+    { 149, 216, 28034 },
+    { 21, 57, 28036 },
+    { 26, 40, 28036 },
+    { 157, 173, 28040 },
+    { 202, 230, 28040 },
+    { 77, 120, 28041 },
+    { 112, 169, 28044 },
+    { 37, 240, 28045 },
+    { 144, 188, 28048 },
+    { 15, 251, 28049 },
+    { 15, 197, 28050 },
+    { 9, 94, 28052 },
+    { 43, 56, 28052 },
+    { 57, 98, 28052 },
+    { 15, 84, 28054 },
+    { 159, 185, 28056 },
+    { 67, 70, 28059 },
+    { 171, 212, 28061 },
+    { 39, 112, 28062 },
+    { 230, 247, 28062 },
+    { 128, 187, 28063 },
+    { 126, 180, 28066 },
+    { 87, 152, 28074 },
+    { 214, 245, 28074 },
+    { 144, 239, 28075 },
+    { 3, 84, 28077 },
+    { 162, 224, 28078 },
+    { 206, 236, 28078 },
+    { 13, 168, 28079 },
+    { 156, 246, 28083 },
+    { 36, 69, 28084 },
+    { 128, 186, 28084 },
+    { 138, 204, 28084 },
+    { 178, 222, 28084 },
+    { 111, 147, 28086 },
+    { 222, 247, 28086 },
+    { 1, 220, 28087 },
+    { 160, 224, 28091 },
+    { 117, 207, 28094 },
+    { 16, 50, 28098 },
+    { 58, 92, 28098 },
+    { 22, 82, 28104 },
+    { 113, 169, 28104 },
+    { 30, 100, 28108 },
+    { 71, 146, 28110 },
+    { 30, 78, 28113 },
+    { 75, 117, 28113 },
+    { 68, 114, 28115 },
+    { 74, 80, 28115 },
+    { 83, 101, 28118 },
+    { 199, 214, 28119 },
+    { 13, 53, 28120 },
+    { 19, 36, 28121 },
+    { 194, 218, 28124 },
+    { 200, 249, 28124 },
+    { 68, 113, 28126 },
+    { 21, 59, 28127 },
+    { 174, 226, 28127 },
+    { 7, 250, 28135 },
+    { 95, 197, 28136 },
+    { 91, 112, 28137 },
+    { 33, 246, 28139 },
+    { 145, 158, 28144 },
+    { 31, 78, 28145 },
+    { 189, 232, 28152 },
+    { 86, 139, 28155 },
+    { 1, 242, 28156 },
+    { 99, 198, 28156 },
+    { 163, 221, 28158 },
+    { 81, 88, 28160 },
+    { 147, 216, 28162 },
+    { 205, 222, 28163 },
+    { 14, 44, 28171 },
+    { 88, 239, 28177 },
+    { 219, 251, 28177 },
+    { 20, 89, 28178 },
+    { 2, 239, 28181 },
+    { 20, 84, 28184 },
+    { 87, 128, 28185 },
+    { 157, 225, 28186 },
+    { 188, 190, 28186 },
+    { 132, 215, 28191 },
+    { 6, 46, 28197 },
+    { 26, 253, 28198 },
+    { 41, 93, 28198 },
+    { 205, 230, 28203 },
+    { 61, 103, 28204 },
+    { 78, 86, 28208 },
+    { 142, 193, 28209 },
+    { 42, 71, 28210 },
+    { 17, 52, 28214 },
+    { 95, 166, 28223 },
+    { 99, 148, 28225 },
+    { 77, 122, 28231 },
+    { 12, 97, 28234 },
+    { 151, 228, 28237 },
+    { 12, 172, 28238 },
+    { 187, 246, 28242 },
+    { 27, 74, 28246 },
+    { 136, 225, 28247 },
+    { 104, 204, 28250 },
+    { 37, 107, 28254 },
+    { 232, 250, 28255 },
+    { 98, 102, 28259 },
+    { 126, 176, 28259 },
+    { 134, 217, 28263 },
+    { 61, 98, 28269 },
+    { 122, 175, 28269 },
+    { 120, 200, 28272 },
+    { 229, 244, 28272 },
+    { 17, 61, 28275 },
+    { 13, 254, 28279 },
+    { 78, 93, 28281 },
+    { 128, 176, 28281 },
+    { 117, 205, 28286 },
+    { 120, 163, 28286 },
+    { 194, 219, 28286 },
+    { 28, 63, 28290 },
+    { 194, 211, 28293 },
+    { 168, 237, 28294 },
+    { 53, 77, 28295 },
+    { 90, 112, 28300 },
+    { 145, 178, 28300 },
+    { 133, 248, 28302 },
+    { 200, 230, 28302 },
+    { 193, 225, 28304 },
+    { 231, 249, 28311 },
+    { 0, 243, 28325 },
+    { 13, 199, 28325 },
+    { 124, 136, 28326 },
+    { 3, 215, 28328 },
+    { 207, 230, 28331 },
+    { 23, 51, 28332 },
+    { 155, 235, 28332 },
+    { 177, 227, 28332 },
+    { 171, 219, 28336 },
+    { 141, 188, 28337 },
+    { 3, 200, 28338 },
+    { 34, 75, 28339 },
+    { 142, 186, 28341 },
+    { 183, 217, 28346 },
+    { 3, 76, 28347 },
+    { 111, 155, 28349 },
+    { 16, 64, 28351 },
+    { 193, 238, 28351 },
+    { 3, 202, 28358 },
+    { 54, 110, 28360 },
+    { 137, 173, 28363 },
+    { 109, 162, 28366 },
+    { 93, 172, 28367 },
+    { 80, 85, 28371 },
+    { 59, 158, 28373 },
+    { 33, 133, 28376 },
+    { 15, 41, 28381 },
+    { 124, 171, 28381 },
+    { 125, 175, 28382 },
+    { 181, 211, 28383 },
+    { 7, 18, 28385 },
+    { 97, 189, 28385 },
+    { 125, 212, 28388 },
+    { 117, 200, 28389 },
+    { 207, 243, 28392 },
+    { 85, 127, 28397 },
+    { 160, 235, 28398 },
+    { 61, 106, 28399 },
+    { 101, 126, 28401 },
+    { 55, 98, 28404 },
+    { 83, 122, 28406 },
+    { 121, 178, 28415 },
+    { 27, 252, 28416 },
+    { 118, 163, 28418 },
+    { 60, 114, 28420 },
+    { 176, 227, 28420 },
+    { 10, 60, 28422 },
+    { 32, 120, 28422 },
+    { 52, 86, 28422 },
+    { 218, 242, 28423 },
+    { 42, 91, 28424 },
+    { 72, 81, 28424 },
+    { 178, 232, 28426 },
+    { 17, 58, 28427 },
+    { 80, 83, 28428 },
+    { 98, 137, 28430 },
+    { 169, 182, 28431 },
+    { 135, 183, 28435 },
+    { 29, 38, 28438 },
+    { 222, 253, 28441 },
+    { 227, 255, 28442 },
+    { 50, 96, 28443 },
+    { 90, 124, 28443 },
+    { 147, 221, 28447 },
+    { 145, 190, 28448 },
+    { 8, 168, 28449 },
+    { 47, 99, 28452 },
+    { 17, 255, 28456 },
+    { 194, 213, 28456 },
+    { 9, 21, 28457 },
+    { 12, 76, 28457 },
+    { 16, 88, 28459 },
+    { 186, 248, 28465 },
+    { 151, 183, 28466 },
+    { 207, 222, 28470 },
+    { 53, 101, 28473 },
+    { 163, 223, 28474 },
+    { 49, 97, 28477 },
+    { 99, 170, 28478 },
+    { 57, 117, 28479 },
+    { 25, 113, 28481 },
+    { 91, 131, 28481 },
+    { 106, 151, 28481 },
+    { 56, 89, 28483 },
+    { 202, 229, 28484 },
+    { 7, 33, 28486 },
+    { 183, 227, 28488 },
+    { 31, 39, 28493 },
+    { 172, 244, 28498 },
+    { 39, 107, 28499 },
+    { 53, 57, 28500 },
+    { 99, 197, 28500 },
+    { 129, 215, 28509 },
+    { 14, 42, 28510 },
+    { 27, 146, 28510 },
+    { 65, 185, 28512 },
+    { 128, 177, 28515 },
+    { 131, 140, 28521 },
+    { 45, 79, 28523 },
+    { 92, 98, 28524 },
+    { 163, 224, 28524 },
+    { 129, 159, 28525 },
+    { 146, 216, 28527 },
+    { 69, 102, 28529 },
+    { 98, 130, 28529 },
+    { 24, 82, 28530 },
+    { 16, 45, 28531 },
+    { 34, 73, 28532 },
+    { 215, 252, 28536 },
+    { 93, 103, 28544 },
+    { 242, 246, 28544 },
+    { 70, 79, 28545 },
+    { 120, 202, 28548 },
+    { 24, 42, 28549 },
+    { 25, 48, 28551 },
+    { 31, 71, 28552 },
+    { 98, 138, 28553 },
+    { 14, 48, 28554 },
+    { 181, 237, 28555 },
+    { 230, 235, 28557 },
+    { 21, 68, 28559 },
+    { 38, 97, 28559 },
+    { 108, 192, 28560 },
+    { 85, 125, 28561 },
+    { 86, 128, 28561 },
+    { 120, 205, 28561 },
+    { 140, 228, 28562 },
+    { 120, 207, 28566 },
+    { 26, 113, 28568 },
+    { 50, 92, 28571 },
+    { 109, 187, 28571 },
+    { 124, 178, 28571 },
+    { 144, 228, 28571 },
+    { 10, 225, 28572 },
+    { 38, 95, 28578 },
+    { 134, 142, 28579 },
+    { 12, 156, 28586 },
+    { 79, 147, 28587 },
+    { 126, 177, 28587 },
+    { 107, 190, 28591 },
+    { 158, 237, 28591 },
+    { 111, 145, 28592 },
+    { 147, 218, 28595 },
+    { 54, 61, 28599 },
+    { 77, 103, 28601 },
+    { 12, 41, 28605 },
+    { 0, 225, 28607 },
+    { 102, 234, 28607 },
+    { 9, 185, 28614 },
+    { 117, 202, 28623 },
+    { 132, 175, 28628 },
+    { 29, 47, 28632 },
+    { 109, 204, 28634 },
+    { 148, 210, 28634 },
+    { 137, 152, 28635 },
+    { 240, 254, 28636 },
+    { 147, 183, 28637 },
+    { 167, 214, 28638 },
+    { 15, 189, 28639 },
+    { 184, 238, 28640 },
+    { 3, 160, 28645 },
+    { 11, 199, 28645 },
+    { 7, 32, 28653 },
+    { 132, 141, 28653 },
+    { 98, 109, 28654 },
+    { 161, 235, 28657 },
+    { 4, 65, 28660 },
+    { 225, 229, 28662 },
+    { 44, 86, 28668 },
+    { 15, 153, 28670 },
+    { 15, 154, 28672 },
+    { 43, 158, 28674 },
+    { 214, 236, 28674 },
+    { 138, 205, 28676 },
+    { 89, 126, 28678 },
+    { 72, 143, 28680 },
+    { 103, 140, 28681 },
+    { 87, 149, 28686 },
+    { 14, 251, 28688 },
+    { 23, 254, 28688 },
+    { 46, 74, 28689 },
+    { 40, 86, 28693 },
+    { 203, 225, 28693 },
+    { 139, 150, 28696 },
+    { 205, 229, 28696 },
+    { 159, 219, 28697 },
+    { 171, 224, 28697 },
+    { 178, 184, 28698 },
+    { 15, 49, 28699 },
+    { 47, 91, 28706 },
+    { 35, 85, 28709 },
+    { 104, 126, 28711 },
+    { 127, 163, 28713 },
+    { 19, 29, 28714 },
+    { 20, 244, 28715 },
+    { 92, 179, 28715 },
+    { 184, 196, 28716 },
+    { 124, 157, 28718 },
+    { 145, 209, 28723 },
+    { 39, 41, 28730 },
+    { 131, 134, 28732 },
+    { 12, 117, 28733 },
+    { 22, 58, 28733 },
+    { 148, 169, 28735 },
+    { 88, 151, 28738 },
+    { 135, 170, 28739 },
+    { 200, 229, 28740 },
+    { 145, 206, 28741 },
+    { 93, 152, 28744 },
+    { 128, 189, 28744 },
+    { 126, 182, 28745 },
+    { 58, 101, 28750 },
+    { 96, 165, 28758 },
+    { 54, 64, 28759 },
+    { 141, 196, 28759 },
+    { 41, 90, 28763 },
+    { 122, 131, 28768 },
+    { 133, 163, 28769 },
+    { 157, 178, 28769 },
+    { 12, 198, 28771 },
+    { 65, 98, 28773 },
+    { 108, 162, 28775 },
+    { 77, 82, 28777 },
+    { 2, 4, 28784 },
+    { 90, 121, 28784 },
+    { 226, 253, 28784 },
+    { 91, 126, 28788 },
+    { 135, 178, 28789 },
+    { 67, 90, 28790 },
+    { 1, 60, 28793 },
+    { 33, 127, 28793 },
+    { 51, 98, 28793 },
+    { 20, 45, 28794 },
+    { 76, 130, 28794 },
+    { 41, 82, 28796 },
+    { 186, 231, 28796 },
+    { 137, 183, 28798 },
+    { 19, 220, 28802 },
+    { 87, 189, 28808 },
+    { 95, 170, 28808 },
+    { 135, 143, 28809 },
+    { 171, 227, 28812 },
+    { 193, 204, 28812 },
+    { 43, 101, 28814 },
+    { 51, 71, 28816 },
+    { 192, 193, 28816 },
+    { 112, 135, 28817 },
+    { 56, 87, 28823 },
+    { 205, 243, 28823 },
+    { 97, 166, 28825 },
+    { 188, 237, 28826 },
+    { 49, 80, 28827 },
+    { 181, 224, 28827 },
+    { 173, 235, 28830 },
+    { 69, 94, 28833 },
+    { 49, 98, 28834 },
+    { 104, 187, 28836 },
+    { 7, 235, 28839 },
+    { 5, 228, 28840 },
+    { 49, 95, 28846 },
+    { 77, 125, 28848 },
+    { 207, 229, 28851 },
+    { 65, 248, 28856 },
+    { 97, 148, 28857 },
+    { 111, 159, 28857 },
+    { 74, 103, 28861 },
+    { 252, 253, 28861 },
+    { 15, 73, 28862 },
+    { 46, 101, 28863 },
+    { 212, 252, 28863 },
+    { 24, 51, 28865 },
+    { 26, 158, 28868 },
+    { 117, 159, 28875 },
+    { 222, 254, 28876 },
+    { 5, 241, 28879 },
+    { 100, 240, 28879 },
+    { 158, 227, 28879 },
+    { 6, 242, 28885 },
+    { 82, 118, 28887 },
+    { 17, 55, 28890 },
+    { 20, 251, 28891 },
+    { 114, 255, 28891 },
+    { 10, 35, 28892 },
+    { 83, 106, 28900 },
+    { 100, 225, 28903 },
+    { 13, 123, 28905 },
+    { 89, 160, 28908 },
+    { 181, 213, 28912 },
+    { 69, 103, 28913 },
+    { 72, 153, 28913 },
+    { 72, 154, 28915 },
+    { 169, 196, 28915 },
+    { 206, 241, 28919 },
+    { 173, 226, 28921 },
+    { 101, 145, 28926 },
+    { 40, 91, 28928 },
+    { 139, 212, 28929 },
+    { 3, 187, 28930 },
+    { 133, 196, 28931 },
+    { 27, 155, 28936 },
+    { 63, 94, 28936 },
+    { 123, 181, 28940 },
+    { 137, 188, 28940 },
+    { 186, 222, 28948 },
+    { 86, 185, 28949 },
+    { 93, 185, 28949 },
+    { 63, 102, 28952 },
+    { 194, 240, 28952 },
+    { 87, 160, 28957 },
+    { 85, 124, 28959 },
+    { 136, 163, 28960 },
+    { 156, 183, 28961 },
+    { 79, 143, 28965 },
+    { 127, 142, 28965 },
+    { 19, 80, 28966 },
+    { 98, 114, 28969 },
+    { 187, 244, 28977 },
+    { 54, 98, 28980 },
+    { 92, 190, 28980 },
+    { 18, 40, 28982 },
+    { 15, 133, 28985 },
+    { 133, 215, 28988 },
+    { 65, 153, 29004 },
+    { 85, 130, 29004 },
+    { 172, 210, 29005 },
+    { 220, 254, 29006 },
+    { 65, 154, 29007 },
+    { 31, 81, 29008 },
+    { 15, 122, 29010 },
+    { 131, 178, 29011 },
+    { 3, 170, 29012 },
+    { 108, 248, 29014 },
+    { 23, 82, 29017 },
+    { 107, 111, 29019 },
+    { 26, 225, 29021 },
+    { 86, 124, 29021 },
+    { 52, 98, 29024 },
+    { 15, 147, 29027 },
+    { 69, 105, 29033 },
+    { 148, 216, 29041 },
+    { 73, 82, 29042 },
+    { 22, 236, 29043 },
+    { 16, 238, 29047 },
+    { 33, 156, 29051 },
+    { 180, 184, 29052 },
+    { 127, 212, 29056 },
+    { 87, 248, 29063 },
+    { 101, 121, 29073 },
+    { 84, 156, 29075 },
+    { 191, 217, 29075 },
+    { 48, 86, 29077 },
+    { 29, 92, 29081 },
+    { 75, 103, 29081 },
+    { 167, 188, 29082 },
+    { 216, 245, 29083 },
+    { 174, 222, 29087 },
+    { 67, 91, 29088 },
+    { 119, 142, 29090 },
+    { 161, 188, 29095 },
+    { 24, 254, 29103 },
+    { 135, 167, 29105 },
+    { 192, 231, 29105 },
+    { 232, 253, 29107 },
+    { 196, 244, 29114 },
+    { 221, 227, 29114 },
+    { 32, 40, 29115 },
+    { 31, 60, 29116 },
+    { 182, 231, 29117 },
+    { 138, 207, 29119 },
+    { 118, 171, 29120 },
+    { 132, 211, 29120 },
+    { 242, 249, 29120 },
+    { 27, 49, 29124 },
+    { 131, 133, 29126 },
+    { 53, 85, 29128 },
+    { 69, 110, 29128 },
+    { 12, 197, 29133 },
+    { 176, 199, 29134 },
+    { 27, 83, 29136 },
+    { 150, 182, 29136 },
+    { 3, 161, 29144 },
+    { 72, 185, 29144 },
+    { 88, 118, 29145 },
+    { 177, 231, 29145 },
+    { 25, 44, 29146 },
+    { 167, 248, 29146 },
+    { 25, 165, 29152 },
+    { 4, 21, 29156 },
+    { 144, 220, 29165 },
+    { 103, 144, 29168 },
+    { 174, 234, 29169 },
+    { 21, 62, 29172 },
+    { 181, 231, 29173 },
+    { 79, 156, 29176 },
+    { 84, 124, 29176 },
+    { 17, 64, 29178 },
+    { 25, 52, 29178 },
+    { 95, 148, 29178 },
+    { 117, 182, 29178 },
+    { 12, 49, 29179 },
+    { 141, 192, 29180 },
+    { 69, 111, 29184 },
+    { 103, 138, 29185 },
+    { 201, 226, 29185 },
+    { 139, 211, 29189 },
+    { 20, 95, 29197 },
+    { 105, 248, 29204 },
+    { 20, 104, 29207 },
+    { 11, 53, 29213 },
+    { 237, 251, 29216 },
+    { 9, 47, 29217 },
+    { 18, 58, 29219 },
+    { 1, 113, 29220 },
+    { 14, 52, 29222 },
+    { 47, 60, 29222 },
+    { 26, 250, 29225 },
+    { 22, 190, 29229 },
+    { 167, 206, 29230 },
+    { 32, 235, 29231 },
+    { 92, 151, 29235 },
+    { 218, 251, 29235 },
+    { 86, 172, 29237 },
+    { 121, 180, 29237 },
+    { 98, 141, 29238 },
+    { 143, 177, 29239 },
+    { 126, 164, 29240 },
+    { 145, 180, 29240 },
+    { 5, 19, 29245 },
+    { 129, 141, 29245 },
+    { 183, 185, 29245 },
+    { 129, 175, 29246 },
+    { 32, 51, 29247 },
+    { 124, 164, 29248 },
+    { 62, 117, 29258 },
+    { 126, 172, 29258 },
+    { 181, 218, 29258 },
+    { 59, 240, 29264 },
+    { 245, 247, 29265 },
+    { 84, 128, 29266 },
+    { 96, 135, 29271 },
+    { 115, 168, 29273 },
+    { 65, 143, 29274 },
+    { 57, 61, 29275 },
+    { 11, 168, 29277 },
+    { 5, 225, 29280 },
+    { 94, 138, 29284 },
+    { 80, 134, 29285 },
+    { 164, 244, 29288 },
+    { 141, 172, 29289 },
+    { 216, 220, 29289 },
+    { 100, 137, 29294 },
+    { 60, 106, 29296 },
+    { 130, 196, 29297 },
+    { 173, 184, 29299 },
+    { 72, 111, 29302 },
+    { 75, 80, 29308 },
+    { 151, 240, 29309 },
+    { 77, 129, 29318 },
+    { 38, 99, 29319 },
+    { 89, 161, 29326 },
+    { 149, 210, 29328 },
+    { 59, 106, 29334 },
+    { 142, 187, 29335 },
+    { 17, 51, 29336 },
+    { 83, 125, 29339 },
+    { 97, 198, 29350 },
+    { 28, 81, 29351 },
+    { 77, 127, 29355 },
+    { 43, 114, 29356 },
+    { 123, 131, 29361 },
+    { 4, 185, 29363 },
+    { 11, 100, 29368 },
+    { 49, 99, 29376 },
+    { 20, 102, 29380 },
+    { 57, 64, 29387 },
+    { 33, 234, 29389 },
+    { 8, 34, 29395 },
+    { 35, 90, 29397 },
+    { 39, 240, 29403 },
+    { 47, 98, 29405 },
+    { 105, 192, 29405 },
+    { 87, 161, 29407 },
+    { 83, 127, 29409 },
+    { 21, 69, 29415 },
+    { 122, 248, 29416 },
+    { 149, 218, 29416 },
+    { 217, 232, 29417 },
+    { 29, 81, 29422 },
+    { 146, 171, 29422 },
+    { 94, 192, 29424 },
+    { 111, 161, 29426 },
+    { 111, 160, 29427 },
+    { 179, 206, 29431 },
+    { 41, 80, 29433 },
+    { 79, 164, 29433 },
+    { 128, 185, 29434 },
+    { 30, 41, 29436 },
+    { 0, 37, 29440 },
+    { 18, 48, 29440 },
+    { 159, 221, 29440 },
+    { 12, 125, 29442 },
+    { 156, 249, 29444 },
+    { 172, 177, 29445 },
+    { 3, 152, 29446 },
+    { 3, 221, 29447 },
+    { 124, 180, 29452 },
+    { 187, 231, 29452 },
+    { 87, 198, 29454 },
+    { 133, 211, 29457 },
+    { 143, 176, 29470 },
+    { 18, 44, 29471 },
+    { 6, 217, 29473 },
+    { 117, 178, 29475 },
+    { 175, 195, 29475 },
+    { 147, 219, 29478 },
+    { 47, 82, 29482 },
+    { 164, 224, 29485 },
+    { 13, 61, 29486 },
+    { 45, 84, 29488 },
+    { 89, 138, 29489 },
+    { 124, 172, 29494 },
+    { 9, 41, 29496 },
+    { 219, 220, 29496 },
+    { 57, 90, 29498 },
+    { 114, 199, 29498 },
+    { 129, 211, 29498 },
+    { 138, 208, 29499 },
+    { 142, 194, 29500 },
+    { 4, 232, 29503 },
+    { 146, 218, 29503 },
+    { 3, 166, 29508 },
+    { 16, 68, 29508 },
+    { 177, 199, 29508 },
+    { 97, 170, 29509 },
+    { 19, 184, 29510 },
+    { 194, 223, 29511 },
+    { 229, 235, 29512 },
+    { 117, 208, 29514 },
+    { 145, 191, 29514 },
+    { 204, 243, 29514 },
+    { 108, 234, 29518 },
+    { 210, 237, 29519 },
+    { 128, 183, 29520 },
+    { 186, 246, 29521 },
+    { 98, 117, 29524 },
+    { 74, 117, 29525 },
+    { 96, 131, 29525 },
+    { 18, 68, 29529 },
+    { 235, 242, 29529 },
+    { 213, 252, 29531 },
+    { 11, 92, 29535 },
+    { 11, 21, 29539 },
+    { 180, 231, 29539 },
+    { 87, 124, 29542 },
+    { 94, 124, 29543 },
+    { 216, 252, 29546 },
+    { 32, 252, 29547 },
+    { 132, 196, 29548 },
+    { 160, 188, 29551 },
+    { 8, 217, 29552 },
+    { 9, 87, 29553 },
+    { 157, 180, 29555 },
+    { 9, 104, 29557 },
+    { 14, 255, 29557 },
+    { 43, 119, 29557 },
+    { 150, 217, 29557 },
+    { 26, 51, 29564 },
+    { 90, 131, 29570 },
+    { 83, 121, 29571 },
+    { 153, 246, 29571 },
+    { 225, 230, 29571 },
+    { 144, 203, 29572 },
+    { 154, 246, 29572 },
+    { 154, 177, 29574 },
+    { 153, 177, 29576 },
+    { 110, 159, 29578 },
+    { 117, 180, 29578 },
+    { 230, 252, 29579 },
+    { 31, 37, 29580 },
+    { 131, 183, 29580 },
+    { 47, 94, 29581 },
+    { 87, 167, 29588 },
+    { 85, 133, 29591 },
+    { 224, 238, 29594 },
+    { 117, 174, 29595 },
+    { 58, 72, 29611 },
+    { 12, 243, 29614 },
+    { 48, 98, 29618 },
+    { 50, 79, 29618 },
+    { 214, 234, 29621 },
+    { 27, 41, 29622 },
+    { 155, 224, 29622 },
+    { 176, 231, 29626 },
+    { 147, 223, 29628 },
+    { 202, 243, 29631 },
+    { 22, 70, 29638 },
+    { 143, 216, 29639 },
+    { 184, 231, 29639 },
+    { 162, 194, 29641 },
+    { 30, 239, 29649 },
+    { 105, 162, 29649 },
+    { 163, 164, 29649 },
+    { 6, 34, 29651 },
+    { 98, 122, 29651 },
+    { 41, 91, 29652 },
+    { 3, 7, 29656 },
+    { 181, 219, 29657 },
+    { 108, 187, 29659 },
+    { 94, 148, 29660 },
+    { 116, 148, 29664 },
+    { 176, 209, 29664 },
+    { 25, 40, 29671 },
+    { 102, 192, 29673 },
+    { 114, 225, 29675 },
+    { 112, 239, 29676 },
+    { 210, 242, 29677 },
+    { 210, 244, 29680 },
+    { 39, 49, 29684 },
+    { 216, 242, 29684 },
+    { 19, 250, 29691 },
+    { 85, 129, 29692 },
+    { 208, 241, 29692 },
+    { 97, 197, 29693 },
+    { 115, 169, 29693 },
+    { 143, 248, 29694 },
+    { 108, 141, 29697 },
+    { 67, 111, 29698 },
+    { 113, 195, 29698 },
+    { 118, 168, 29698 },
+    { 21, 254, 29702 },
+    { 84, 164, 29704 },
+    { 36, 90, 29709 },
+    { 186, 194, 29713 },
+    { 22, 112, 29717 },
+    { 67, 130, 29720 },
+    { 148, 181, 29720 },
+    { 63, 105, 29725 },
+    { 137, 146, 29725 },
+    { 72, 78, 29727 },
+    { 137, 161, 29732 },
+    { 88, 247, 29734 },
+    { 38, 94, 29741 },
+    { 43, 123, 29745 },
+    { 84, 103, 29745 },
+    { 43, 247, 29746 },
+    { 164, 183, 29747 },
+    { 125, 215, 29748 },
+    { 6, 21, 29749 },
+    { 77, 132, 29750 },
+    { 25, 55, 29751 },
+    { 14, 58, 29754 },
+    { 128, 157, 29757 },
+    { 24, 92, 29763 },
+    { 122, 212, 29763 },
+    { 120, 208, 29765 },
+    { 98, 139, 29768 },
+    { 28, 69, 29769 },
+    { 31, 85, 29769 },
+    { 121, 182, 29769 },
+    { 26, 42, 29771 },
+    { 209, 231, 29771 },
+    { 199, 250, 29773 },
+    { 31, 84, 29774 },
+    { 128, 192, 29774 },
+    { 214, 244, 29778 },
+    { 10, 53, 29782 },
+    { 89, 167, 29792 },
+    { 130, 212, 29796 },
+    { 224, 237, 29796 },
+    { 66, 67, 29798 },
+    { 13, 80, 29803 },
+    { 135, 180, 29803 },
+    { 113, 247, 29805 },
+    { 171, 223, 29807 },
+    { 54, 117, 29814 },
+    { 201, 231, 29816 },
+    { 19, 238, 29822 },
+    { 32, 244, 29822 },
+    { 111, 162, 29833 },
+    { 87, 197, 29838 },
+    { 161, 214, 29840 },
+    { 184, 247, 29841 },
+    { 196, 246, 29848 },
+    { 188, 236, 29849 },
+    { 37, 247, 29854 },
+    { 103, 150, 29854 },
+    { 110, 135, 29854 },
+    { 138, 169, 29855 },
+    { 188, 201, 29860 },
+    { 14, 245, 29861 },
+    { 90, 126, 29864 },
+    { 161, 206, 29864 },
+    { 51, 93, 29865 },
+    { 157, 210, 29865 },
+    { 233, 243, 29867 },
+    { 174, 235, 29872 },
+    { 28, 88, 29873 },
+    { 181, 187, 29877 },
+    { 127, 248, 29879 },
+    { 218, 220, 29882 },
+    { 12, 189, 29887 },
+    { 14, 55, 29894 },
+    { 123, 142, 29895 },
+    { 133, 142, 29898 },
+    { 13, 134, 29902 },
+    { 39, 101, 29902 },
+    { 119, 239, 29902 },
+    { 108, 204, 29905 },
+    { 71, 234, 29906 },
+    { 84, 153, 29906 },
+    { 171, 221, 29906 },
+    { 84, 154, 29908 },
+    { 91, 119, 29910 },
+    { 40, 71, 29915 },
+    { 182, 184, 29916 },
+    { 45, 72, 29918 },
+    { 69, 108, 29918 },
+    { 200, 243, 29918 },
+    { 134, 171, 29919 },
+    { 169, 233, 29919 },
+    { 172, 176, 29920 },
+    { 13, 64, 29922 },
+    { 66, 84, 29922 },
+    { 13, 68, 29929 },
+    { 121, 171, 29930 },
+    { 206, 242, 29933 },
+    { 95, 248, 29934 },
+    { 210, 228, 29935 },
+    { 69, 101, 29936 },
+    { 104, 207, 29939 },
+    { 91, 135, 29941 },
+    { 15, 93, 29943 },
+    { 154, 176, 29945 },
+    { 39, 90, 29946 },
+    { 155, 248, 29946 },
+    { 234, 245, 29946 },
+    { 153, 176, 29947 },
+    { 171, 229, 29947 },
+    { 165, 193, 29948 },
+    { 59, 165, 29951 },
+    { 182, 230, 29951 },
+    { 186, 244, 29952 },
+    { 135, 184, 29957 },
+    { 170, 248, 29957 },
+    { 159, 223, 29959 },
+    { 127, 196, 29962 },
+    { 54, 90, 29966 },
+    { 105, 234, 29967 },
+    { 113, 184, 29967 },
+    { 169, 226, 29967 },
+    { 140, 193, 29968 },
+    { 175, 234, 29968 },
+    { 4, 54, 29971 },
+    { 250, 252, 29972 },
+    { 146, 221, 29978 },
+    { 6, 168, 29979 },
+    { 10, 228, 29980 },
+    { 37, 158, 29981 },
+    { 11, 112, 29983 },
+    { 217, 241, 29983 },
+    { 43, 90, 29985 },
+    { 27, 85, 29986 },
+    { 124, 176, 29986 },
+    { 177, 209, 29988 },
+    { 210, 233, 29990 },
+    { 142, 196, 29992 },
+    { 134, 228, 29993 },
+    { 245, 248, 29995 },
+    { 14, 61, 29996 },
+    { 98, 127, 29999 },
+    { 85, 132, 30004 },
+    { 73, 122, 30010 },
+    { 131, 180, 30011 },
+    { 78, 114, 30016 },
+    { 60, 119, 30017 },
+    { 142, 147, 30021 },
+    { 0, 227, 30023 },
+    { 116, 139, 30026 },
+    { 82, 134, 30032 },
+    { 46, 62, 30035 },
+    { 57, 91, 30035 },
+    { 129, 196, 30037 },
+    { 110, 201, 30038 },
+    { 139, 215, 30038 },
+    { 84, 139, 30040 },
+    { 37, 41, 30041 },
+    { 65, 81, 30042 },
+    { 190, 250, 30043 },
+    { 157, 214, 30044 },
+    { 15, 127, 30046 },
+    { 130, 137, 30046 },
+    { 204, 230, 30052 },
+    { 46, 107, 30053 },
+    { 122, 163, 30054 },
+    { 89, 189, 30055 },
+    { 50, 88, 30056 },
+    { 80, 118, 30063 },
+    { 170, 193, 30068 },
+    { 71, 189, 30069 },
+    { 27, 63, 30070 },
+    { 213, 227, 30071 },
+    { 71, 155, 30072 },
+    { 22, 254, 30075 },
+    { 32, 143, 30078 },
+    { 124, 182, 30088 },
+    { 126, 183, 30094 },
+    { 132, 213, 30094 },
+    { 6, 227, 30099 },
+    { 182, 229, 30099 },
+    { 194, 232, 30103 },
+    { 109, 186, 30104 },
+    { 6, 113, 30105 },
+    { 46, 75, 30106 },
+    { 197, 206, 30107 },
+    { 109, 141, 30109 },
+    { 122, 142, 30109 },
+    { 232, 236, 30120 },
+    { 160, 214, 30125 },
+    { 64, 112, 30128 },
+    { 137, 160, 30129 },
+    { 180, 230, 30131 },
+    { 18, 52, 30132 },
+    { 17, 41, 30135 },
+    { 107, 255, 30139 },
+    { 0, 39, 30141 },
+    { 65, 172, 30149 },
+    { 73, 120, 30150 },
+    { 131, 181, 30150 },
+    { 217, 224, 30150 },
+    { 81, 114, 30152 },
+    { 0, 19, 30157 },
+    { 26, 165, 30157 },
+    { 13, 119, 30160 },
+    { 226, 252, 30163 },
+    { 111, 153, 30168 },
+    { 111, 154, 30169 },
+    { 204, 222, 30170 },
+    { 1, 46, 30172 },
+    { 98, 100, 30174 },
+    { 185, 210, 30174 },
+    { 32, 198, 30175 },
+    { 45, 65, 30177 },
+    { 140, 220, 30178 },
+    { 37, 101, 30184 },
+    { 135, 188, 30185 },
+    { 30, 253, 30187 },
+    { 85, 128, 30193 },
+    { 14, 51, 30195 },
+    { 220, 223, 30195 },
+    { 43, 165, 30197 },
+    { 140, 247, 30198 },
+    { 141, 164, 30198 },
+    { 126, 186, 30199 },
+    { 12, 84, 30202 },
+    { 209, 253, 30202 },
+    { 104, 162, 30204 },
+    { 118, 149, 30205 },
+    { 58, 65, 30208 },
+    { 152, 224, 30209 },
+    { 170, 203, 30214 },
+    { 91, 110, 30217 },
+    { 107, 142, 30220 },
+    { 85, 116, 30221 },
+    { 8, 100, 30223 },
+    { 90, 119, 30226 },
+    { 3, 62, 30229 },
+    { 173, 222, 30229 },
+    { 15, 77, 30232 },
+    { 180, 229, 30232 },
+    { 181, 202, 30234 },
+    { 228, 232, 30234 },
+    { 177, 232, 30235 },
+    { 83, 129, 30236 },
+    { 160, 206, 30244 },
+    { 181, 200, 30245 },
+    { 4, 254, 30248 },
+    { 194, 221, 30249 },
+    { 4, 38, 30251 },
+    { 34, 88, 30255 },
+    { 30, 81, 30261 },
+    { 59, 134, 30261 },
+    { 77, 133, 30261 },
+    { 100, 145, 30262 },
+    { 93, 160, 30266 },
+    { 119, 181, 30271 },
+    { 104, 205, 30272 },
+    { 106, 157, 30272 },
+    { 79, 153, 30275 },
+    { 79, 154, 30278 },
+    { 168, 222, 30279 },
+    { 110, 142, 30283 },
+    { 10, 251, 30285 },
+    { 101, 142, 30285 },
+    { 26, 112, 30290 },
+    { 71, 198, 30290 },
+    { 79, 121, 30294 },
+    { 168, 206, 30295 },
+    { 141, 200, 30297 },
+    { 75, 120, 30298 },
+    { 125, 196, 30299 },
+    { 50, 84, 30303 },
+    { 124, 177, 30305 },
+    { 187, 222, 30306 },
+    { 83, 130, 30307 },
+    { 105, 141, 30308 },
+    { 28, 255, 30309 },
+    { 58, 88, 30311 },
+    { 84, 146, 30311 },
+    { 94, 204, 30311 },
+    { 178, 231, 30318 },
+    { 0, 36, 30324 },
+    { 91, 113, 30326 },
+    { 136, 159, 30330 },
+    { 137, 178, 30331 },
+    { 196, 248, 30332 },
+    { 71, 98, 30334 },
+    { 143, 235, 30334 },
+    { 141, 144, 30337 },
+    { 47, 102, 30338 },
+    { 89, 91, 30348 },
+    { 129, 246, 30348 },
+    { 125, 235, 30352 },
+    { 25, 112, 30353 },
+    { 33, 120, 30353 },
+    { 109, 207, 30355 },
+    { 60, 103, 30356 },
+    { 127, 135, 30356 },
+    { 194, 247, 30356 },
+    { 47, 80, 30360 },
+    { 143, 218, 30362 },
+    { 15, 201, 30364 },
+    { 2, 240, 30367 },
+    { 8, 112, 30368 },
+    { 186, 230, 30368 },
+    { 240, 242, 30368 },
+    { 16, 237, 30369 },
+    { 152, 235, 30373 },
+    { 27, 31, 30375 },
+    { 44, 98, 30379 },
+    { 145, 182, 30380 },
+    { 50, 98, 30381 },
+    { 57, 129, 30386 },
+    { 126, 187, 30386 },
+    { 9, 245, 30389 },
+    { 207, 241, 30389 },
+    { 149, 221, 30393 },
+    { 141, 189, 30396 },
+    { 222, 240, 30396 },
+    { 3, 223, 30397 },
+    { 127, 215, 30398 },
+    { 33, 147, 30399 },
+    { 6, 220, 30400 },
+    { 137, 166, 30400 },
+    { 175, 235, 30405 },
+    { 12, 73, 30406 },
+    { 165, 238, 30412 },
+    { 96, 151, 30413 },
+    { 18, 236, 30416 },
+    { 90, 113, 30418 },
+    { 32, 130, 30421 },
+    { 154, 224, 30422 },
+    { 153, 224, 30424 },
+    { 73, 125, 30425 },
+    { 13, 21, 30426 },
+    { 75, 122, 30427 },
+    { 115, 158, 30427 },
+    { 19, 46, 30430 },
+    { 66, 79, 30430 },
+    { 125, 211, 30430 },
+    { 111, 114, 30432 },
+    { 149, 188, 30433 },
+    { 175, 232, 30436 },
+    { 129, 213, 30442 },
+    { 72, 172, 30459 },
+    { 152, 188, 30467 },
+    { 123, 217, 30469 },
+    { 38, 60, 30470 },
+    { 91, 128, 30470 },
+    { 201, 243, 30470 },
+    { 63, 110, 30472 },
+    { 171, 201, 30475 },
+    { 4, 57, 30476 },
+    { 0, 43, 30477 },
+    { 64, 113, 30479 },
+    { 213, 245, 30481 },
+    { 64, 76, 30482 },
+    { 35, 91, 30483 },
+    { 157, 228, 30488 },
+    { 45, 96, 30491 },
+    { 166, 193, 30491 },
+    { 104, 186, 30496 },
+    { 142, 203, 30498 },
+    { 27, 167, 30499 },
+    { 131, 147, 30501 },
+    { 41, 97, 30506 },
+    { 14, 242, 30509 },
+    { 20, 97, 30510 },
+    { 83, 133, 30511 },
+    { 148, 206, 30517 },
+    { 203, 242, 30523 },
+    { 149, 219, 30525 },
+    { 94, 126, 30528 },
+    { 198, 206, 30529 },
+    { 15, 75, 30530 },
+    { 143, 221, 30530 },
+    { 171, 230, 30532 },
+    { 105, 187, 30538 },
+    { 146, 219, 30539 },
+    { 226, 234, 30542 },
+    { 0, 252, 30545 },
+    { 50, 101, 30550 },
+    { 94, 98, 30551 },
+    { 136, 188, 30551 },
+    { 20, 99, 30552 },
+    { 171, 190, 30552 },
+    { 54, 91, 30554 },
+    { 14, 41, 30561 },
+    { 151, 255, 30561 },
+    { 7, 234, 30562 },
+    { 17, 239, 30562 },
+    { 141, 202, 30564 },
+    { 169, 229, 30564 },
+    { 89, 90, 30565 },
+    { 86, 126, 30567 },
+    { 7, 38, 30569 },
+    { 91, 137, 30569 },
+    { 54, 68, 30570 },
+    { 204, 229, 30577 },
+    { 9, 62, 30578 },
+    { 229, 252, 30579 },
+    { 159, 224, 30585 },
+    { 8, 92, 30591 },
+    { 18, 238, 30592 },
+    { 116, 169, 30592 },
+    { 20, 34, 30593 },
+    { 32, 197, 30594 },
+    { 83, 132, 30594 },
+    { 132, 246, 30597 },
+    { 34, 77, 30598 },
+    { 5, 46, 30601 },
+    { 17, 240, 30601 },
+    { 73, 129, 30601 },
+    { 93, 161, 30601 },
+    { 109, 205, 30603 },
+    { 91, 97, 30605 },
+    { 128, 197, 30605 },
+    { 20, 234, 30607 },
+    { 29, 247, 30607 },
+    { 9, 49, 30612 },
+    { 32, 189, 30612 },
+    { 137, 194, 30612 },
+    { 147, 177, 30612 },
+    { 128, 198, 30613 },
+    { 3, 213, 30616 },
+    { 163, 222, 30617 },
+    { 85, 96, 30618 },
+    { 77, 80, 30621 },
+    { 29, 63, 30622 },
+    { 93, 148, 30622 },
+    { 123, 194, 30623 },
+    { 134, 247, 30626 },
+    { 63, 108, 30627 },
+    { 189, 206, 30627 },
+    { 43, 239, 30628 },
+    { 13, 140, 30629 },
+    { 209, 210, 30632 },
+    { 106, 138, 30634 },
+    { 112, 131, 30634 },
+    { 92, 240, 30639 },
+    { 17, 251, 30640 },
+    { 156, 224, 30640 },
+    { 121, 187, 30642 },
+    { 33, 172, 30643 },
+    { 145, 152, 30643 },
+    { 190, 229, 30644 },
+    { 133, 213, 30646 },
+    { 12, 153, 30650 },
+    { 16, 233, 30650 },
+    { 38, 90, 30651 },
+    { 12, 154, 30652 },
+    { 27, 204, 30652 },
+    { 186, 229, 30653 },
+    { 104, 200, 30659 },
+    { 23, 92, 30660 },
+    { 55, 71, 30664 },
+    { 136, 193, 30676 },
+    { 196, 227, 30676 },
+    { 157, 182, 30679 },
+    { 104, 235, 30683 },
+    { 205, 241, 30684 },
+    { 61, 112, 30689 },
+    { 210, 238, 30690 },
+    { 18, 42, 30691 },
+    { 61, 76, 30692 },
+    { 26, 31, 30694 },
+    { 8, 21, 30701 },
+    { 112, 184, 30703 },
+    { 21, 253, 30705 },
+    { 71, 197, 30705 },
+    { 88, 199, 30706 },
+    { 73, 103, 30708 },
+    { 148, 218, 30708 },
+    { 46, 255, 30709 },
+    { 85, 126, 30715 },
+    { 162, 184, 30720 },
+    { 26, 78, 30722 },
+    { 105, 204, 30722 },
+    { 36, 91, 30723 },
+    { 72, 248, 30726 },
+    { 148, 193, 30726 },
+    { 190, 206, 30727 },
+    { 194, 215, 30727 },
+    { 73, 80, 30729 },
+    { 60, 123, 30732 },
+    { 81, 89, 30732 },
+    { 19, 253, 30733 },
+    { 181, 208, 30735 },
+    { 163, 185, 30739 },
+    { 3, 211, 30740 },
+    { 41, 95, 30740 },
+    { 151, 239, 30740 },
+    { 32, 44, 30741 },
+    { 121, 186, 30743 },
+    { 45, 92, 30745 },
+    { 121, 189, 30745 },
+    { 16, 58, 30746 },
+    { 7, 28, 30747 },
+    { 23, 56, 30747 },
+    { 137, 193, 30747 },
+    { 178, 230, 30750 },
+    { 101, 151, 30753 },
+    { 226, 246, 30753 },
+    { 20, 83, 30754 },
+    { 7, 27, 30757 },
+    { 127, 211, 30757 },
+    { 203, 241, 30757 },
+    { 142, 154, 30758 },
+    { 150, 152, 30758 },
+    { 142, 153, 30759 },
+    { 96, 168, 30761 },
+    { 71, 249, 30762 },
+    { 166, 203, 30766 },
+    { 62, 82, 30767 },
+    { 86, 155, 30770 },
+    { 133, 235, 30771 },
+    { 37, 90, 30780 },
+    { 139, 213, 30782 },
+    { 44, 71, 30792 },
+    { 102, 204, 30793 },
+    { 38, 102, 30794 },
+    { 49, 94, 30794 },
+    { 3, 186, 30795 },
+    { 135, 182, 30799 },
+    { 18, 55, 30802 },
+    { 64, 114, 30803 },
+    { 9, 241, 30811 },
+    { 109, 200, 30813 },
+    { 8, 220, 30818 },
+    { 42, 93, 30818 },
+    { 178, 229, 30818 },
+    { 77, 130, 30823 },
+    { 90, 110, 30823 },
+    { 27, 192, 30826 },
+    { 84, 126, 30828 },
+    { 95, 201, 30830 },
+    { 46, 73, 30832 },
+    { 87, 126, 30835 },
+    { 71, 139, 30840 },
+    { 176, 232, 30840 },
+    { 16, 31, 30845 },
+    { 217, 245, 30848 },
+    { 121, 185, 30849 },
+    { 104, 202, 30852 },
+    { 43, 91, 30853 },
+    { 151, 227, 30853 },
+    { 125, 163, 30854 },
+    { 125, 131, 30857 },
+    { 34, 92, 30858 },
+    { 136, 138, 30862 },
+    { 51, 89, 30865 },
+    { 9, 102, 30871 },
+    { 112, 195, 30872 },
+    { 89, 198, 30875 },
+    { 150, 166, 30877 },
+    { 39, 91, 30878 },
+    { 56, 97, 30881 },
+    { 39, 63, 30885 },
+    { 157, 222, 30887 },
+    { 174, 232, 30887 },
+    { 8, 227, 30891 },
+    { 29, 253, 30892 },
+    { 111, 150, 30892 },
+    { 68, 115, 30893 },
+    { 144, 176, 30894 },
+    { 166, 248, 30894 },
+    { 130, 234, 30898 },
+    { 211, 227, 30900 },
+    { 14, 64, 30907 },
+    { 31, 86, 30912 },
+    { 98, 104, 30912 },
+    { 19, 82, 30914 },
+    { 195, 196, 30915 },
+    { 55, 93, 30917 },
+    { 22, 48, 30918 },
+    { 11, 61, 30919 },
+    { 4, 72, 30922 },
+    { 173, 232, 30925 },
+    { 115, 165, 30926 },
+    { 215, 245, 30927 },
+    { 2, 231, 30928 },
+    { 74, 101, 30928 },
+    { 126, 151, 30929 },
+    { 130, 183, 30930 },
+    { 100, 157, 30931 },
+    { 131, 182, 30934 },
+    { 187, 249, 30934 },
+    { 35, 79, 30935 },
+    { 90, 97, 30935 },
+    { 147, 176, 30935 },
+    { 121, 136, 30941 },
+    { 8, 242, 30944 },
+    { 26, 96, 30944 },
+    { 144, 163, 30944 },
+    { 109, 173, 30945 },
+    { 140, 188, 30948 },
+    { 69, 104, 30952 },
+    { 11, 123, 30957 },
+    { 30, 49, 30957 },
+    { 61, 113, 30958 },
+    { 2, 244, 30960 },
+    { 128, 136, 30962 },
+    { 33, 153, 30964 },
+    { 121, 176, 30964 },
+    { 33, 154, 30966 },
+    { 20, 50, 30971 },
+    { 36, 113, 30974 },
+    { 57, 132, 30981 },
+    { 103, 110, 30984 },
+    { 211, 252, 30984 },
+    { 75, 125, 30985 },
+    { 8, 123, 30986 },
+    { 83, 124, 30986 },
+    { 160, 248, 30987 },
+    { 37, 239, 30988 },
+    { 130, 211, 30989 },
+    { 69, 109, 30992 },
+    { 198, 252, 30992 },
+    { 174, 195, 30994 },
+    { 9, 164, 30996 },
+    { 71, 111, 30998 },
+    { 118, 162, 30998 },
+    { 113, 135, 30999 },
+    { 14, 239, 31000 },
+    { 122, 196, 31005 },
+    { 59, 103, 31006 },
+    { 209, 242, 31007 },
+    { 90, 135, 31010 },
+    { 98, 142, 31014 },
+    { 116, 159, 31018 },
+    { 8, 53, 31019 },
+    { 81, 118, 31019 },
+    { 111, 136, 31022 },
+    { 37, 49, 31024 },
+    { 181, 223, 31026 },
+    { 229, 240, 31026 },
+    { 34, 90, 31030 },
+    { 41, 59, 31032 },
+    { 18, 66, 31033 },
+    { 109, 202, 31033 },
+    { 129, 249, 31033 },
+    { 210, 245, 31038 },
+    { 137, 195, 31044 },
+    { 37, 114, 31046 },
+    { 31, 43, 31047 },
+    { 33, 35, 31047 },
+    { 181, 215, 31047 },
+    { 194, 202, 31049 },
+    { 196, 243, 31050 },
+    { 110, 192, 31051 },
+    { 21, 33, 31052 },
+    { 151, 175, 31053 },
+    { 150, 161, 31055 },
+    { 136, 176, 31057 },
+    { 123, 247, 31059 },
+    { 146, 223, 31059 },
+    { 24, 225, 31063 },
+    { 5, 59, 31069 },
+    { 117, 212, 31069 },
+    { 196, 220, 31070 },
+    { 153, 249, 31075 },
+    { 154, 249, 31075 },
+    { 0, 34, 31077 },
+    { 183, 235, 31077 },
+    { 73, 132, 31080 },
+    { 130, 215, 31082 },
+    { 87, 138, 31085 },
+    { 150, 210, 31085 },
+    { 57, 68, 31087 },
+    { 29, 240, 31088 },
+    { 197, 252, 31090 },
+    { 111, 156, 31092 },
+    { 96, 145, 31098 },
+    { 39, 47, 31099 },
+    { 102, 187, 31102 },
+    { 67, 164, 31104 },
+    { 121, 157, 31104 },
+    { 41, 43, 31105 },
+    { 184, 255, 31108 },
+    { 122, 215, 31114 },
+    { 117, 175, 31116 },
+    { 19, 227, 31118 },
+    { 52, 71, 31120 },
+    { 194, 200, 31123 },
+    { 94, 249, 31125 },
+    { 42, 87, 31130 },
+    { 45, 98, 31130 },
+    { 99, 201, 31132 },
+    { 175, 229, 31135 },
+    { 137, 179, 31137 },
+    { 12, 147, 31139 },
+    { 51, 87, 31140 },
+    { 58, 86, 31144 },
+    { 108, 186, 31144 },
+    { 249, 254, 31144 },
+    { 39, 69, 31145 },
+    { 39, 247, 31148 },
+    { 126, 169, 31148 },
+    { 145, 161, 31154 },
+    { 33, 45, 31156 },
+    { 25, 254, 31162 },
+    { 53, 107, 31163 },
+    { 57, 125, 31164 },
+    { 141, 193, 31164 },
+    { 99, 248, 31168 },
+    { 27, 160, 31169 },
+    { 42, 89, 31170 },
+    { 30, 96, 31171 },
+    { 94, 187, 31172 },
+    { 169, 236, 31172 },
+    { 17, 68, 31173 },
+    { 142, 206, 31173 },
+    { 72, 90, 31178 },
+    { 18, 88, 31179 },
+    { 24, 100, 31181 },
+    { 101, 150, 31181 },
+    { 157, 227, 31183 },
+    { 39, 158, 31184 },
+    { 199, 210, 31189 },
+    { 30, 113, 31191 },
+    { 73, 127, 31192 },
+    { 87, 166, 31192 },
+    { 145, 166, 31195 },
+    { 29, 100, 31204 },
+    { 41, 98, 31204 },
+    { 175, 230, 31207 },
+    { 128, 201, 31208 },
+    { 63, 104, 31209 },
+    { 194, 208, 31212 },
+    { 67, 147, 31215 },
+    { 137, 155, 31216 },
+    { 101, 128, 31217 },
+    { 121, 177, 31220 },
+    { 201, 203, 31220 },
+    { 46, 113, 31222 },
+    { 58, 103, 31222 },
+    { 188, 225, 31223 },
+    { 184, 216, 31227 },
+    { 27, 69, 31229 },
+    { 65, 78, 31230 },
+    { 207, 252, 31234 },
+    { 37, 119, 31236 },
+    { 92, 137, 31236 },
+    { 89, 197, 31239 },
+    { 11, 217, 31247 },
+    { 89, 166, 31247 },
+    { 42, 98, 31251 },
+    { 3, 251, 31253 },
+    { 202, 241, 31255 },
+    { 158, 238, 31259 },
+    { 59, 69, 31264 },
+    { 201, 252, 31267 },
+    { 216, 251, 31269 },
+    { 24, 56, 31272 },
+    { 147, 246, 31273 },
+    { 12, 201, 31276 },
+    { 2, 31, 31278 },
+    { 92, 225, 31282 },
+    { 4, 94, 31284 },
+    { 15, 110, 31285 },
+    { 220, 221, 31288 },
+    { 67, 156, 31289 },
+    { 254, 255, 31289 },
+    { 25, 51, 31293 },
+    { 2, 255, 31297 },
+    { 15, 74, 31299 },
+    { 165, 203, 31299 },
+    { 138, 188, 31300 },
+    { 62, 111, 31304 },
+    { 135, 168, 31306 },
+    { 5, 243, 31309 },
+    { 3, 218, 31313 },
+    { 23, 41, 31317 },
+    { 179, 229, 31318 },
+    { 32, 55, 31321 },
+    { 156, 177, 31325 },
+    { 149, 234, 31328 },
+    { 12, 133, 31329 },
+    { 143, 219, 31331 },
+    { 122, 135, 31333 },
+    { 149, 223, 31333 },
+    { 196, 241, 31335 },
+    { 14, 240, 31337 },
+    { 137, 180, 31340 },
+    { 58, 100, 31343 },
+    { 72, 91, 31344 },
+    { 25, 236, 31345 },
+    { 25, 190, 31346 },
+    { 34, 83, 31347 },
+    { 217, 254, 31347 },
+    { 50, 72, 31349 },
+    { 75, 129, 31349 },
+    { 132, 249, 31349 },
+    { 20, 58, 31354 },
+    { 192, 222, 31354 },
+    { 41, 99, 31355 },
+    { 68, 119, 31355 },
+    { 102, 162, 31357 },
+    { 68, 76, 31359 },
+    { 188, 238, 31365 },
+    { 114, 209, 31368 },
+    { 7, 232, 31369 },
+    { 154, 210, 31372 },
+    { 153, 210, 31374 },
+    { 187, 230, 31377 },
+    { 46, 54, 31381 },
+    { 3, 219, 31384 },
+    { 117, 131, 31388 },
+    { 141, 204, 31390 },
+    { 124, 186, 31391 },
+    { 53, 76, 31392 },
+    { 120, 137, 31393 },
+    { 161, 248, 31394 },
+    { 37, 123, 31395 },
+    { 82, 111, 31403 },
+    { 94, 235, 31404 },
+    { 36, 107, 31405 },
+    { 181, 239, 31405 },
+    { 110, 187, 31413 },
+    { 25, 42, 31415 },
+    { 159, 195, 31416 },
+    { 11, 64, 31417 },
+    { 60, 74, 31419 },
+    { 181, 205, 31420 },
+    { 33, 252, 31422 },
+    { 215, 251, 31426 },
+    { 12, 122, 31430 },
+    { 116, 168, 31431 },
+    { 146, 235, 31434 },
+    { 49, 102, 31435 },
+    { 169, 230, 31439 },
+    { 14, 20, 31442 },
+    { 94, 246, 31443 },
+    { 2, 34, 31447 },
+    { 110, 173, 31450 },
+    { 199, 231, 31450 },
+    { 15, 63, 31454 },
+    { 28, 253, 31455 },
+    { 57, 122, 31456 },
+    { 111, 166, 31456 },
+    { 137, 170, 31457 },
+    { 104, 208, 31459 },
+    { 35, 65, 31462 },
+    { 80, 140, 31466 },
+    { 197, 243, 31467 },
+    { 38, 91, 31468 },
+    { 213, 242, 31471 },
+    { 65, 111, 31478 },
+    { 168, 238, 31478 },
+    { 104, 249, 31479 },
+    { 124, 187, 31479 },
+    { 39, 114, 31480 },
+    { 37, 165, 31481 },
+    { 36, 101, 31482 },
+    { 75, 101, 31482 },
+    { 208, 252, 31485 },
+    { 27, 152, 31488 },
+    { 66, 114, 31489 },
+    { 175, 231, 31492 },
+    { 225, 242, 31498 },
+    { 104, 246, 31499 },
+    { 5, 35, 31502 },
+    { 115, 148, 31503 },
+    { 18, 225, 31508 },
+    { 90, 128, 31512 },
+    { 22, 44, 31513 },
+    { 2, 9, 31517 },
+    { 61, 114, 31523 },
+    { 125, 213, 31526 },
+    { 30, 250, 31527 },
+    { 226, 239, 31527 },
+    { 158, 193, 31529 },
+    { 55, 96, 31532 },
+    { 4, 198, 31533 },
+    { 49, 59, 31533 },
+    { 77, 101, 31536 },
+    { 17, 38, 31540 },
+    { 22, 52, 31544 },
+    { 198, 243, 31544 },
+    { 91, 136, 31547 },
+    { 150, 160, 31548 },
+    { 7, 16, 31549 },
+    { 89, 148, 31549 },
+    { 181, 221, 31551 },
+    { 15, 243, 31552 },
+    { 70, 86, 31553 },
+    { 133, 135, 31553 },
+    { 150, 170, 31554 },
+    { 200, 241, 31554 },
+    { 56, 95, 31559 },
+    { 141, 205, 31560 },
+    { 144, 177, 31561 },
+    { 187, 194, 31561 },
+    { 59, 63, 31562 },
+    { 83, 96, 31563 },
+    { 69, 96, 31565 },
+    { 142, 195, 31565 },
+    { 16, 40, 31566 },
+    { 75, 127, 31566 },
+    { 52, 93, 31567 },
+    { 98, 125, 31567 },
+    { 163, 226, 31571 },
+    { 35, 72, 31575 },
+    { 17, 245, 31576 },
+    { 32, 52, 31579 },
+    { 213, 220, 31580 },
+    { 120, 234, 31582 },
+    { 100, 150, 31583 },
+    { 16, 48, 31585 },
+    { 63, 109, 31585 },
+    { 90, 137, 31589 },
+    { 122, 211, 31592 },
+    { 236, 243, 31594 },
+    { 2, 228, 31598 },
+    { 66, 112, 31600 },
+    { 63, 103, 31602 },
+    { 10, 31, 31607 },
+    { 16, 66, 31609 },
+    { 152, 206, 31609 },
+    { 220, 243, 31609 },
+    { 46, 112, 31612 },
+    { 98, 133, 31613 },
+    { 93, 167, 31614 },
+    { 181, 238, 31614 },
+    { 11, 68, 31617 },
+    { 54, 129, 31620 },
+    { 16, 158, 31623 },
+    { 146, 210, 31624 },
+    { 93, 131, 31627 },
+    { 108, 207, 31629 },
+    { 145, 160, 31629 },
+    { 17, 56, 31631 },
+    { 74, 120, 31641 },
+    { 190, 230, 31644 },
+    { 14, 238, 31646 },
+    { 150, 196, 31647 },
+    { 185, 252, 31649 },
+    { 48, 71, 31653 },
+    { 130, 191, 31654 },
+    { 8, 134, 31661 },
+    { 9, 79, 31661 },
+    { 111, 167, 31661 },
+    { 108, 173, 31663 },
+    { 143, 223, 31671 },
+    { 194, 212, 31671 },
+    { 18, 51, 31674 },
+    { 192, 230, 31674 },
+    { 123, 228, 31680 },
+    { 37, 91, 31686 },
+    { 87, 170, 31686 },
+    { 27, 161, 31687 },
+    { 141, 201, 31688 },
+    { 142, 168, 31689 },
+    { 47, 105, 31691 },
+    { 0, 230, 31693 },
+    { 138, 211, 31696 },
+    { 91, 99, 31702 },
+    { 76, 103, 31712 },
+    { 79, 146, 31712 },
+    { 140, 236, 31712 },
+    { 101, 158, 31713 },
+    { 168, 176, 31713 },
+    { 17, 66, 31716 },
+    { 156, 176, 31722 },
+    { 187, 229, 31723 },
+    { 52, 96, 31725 },
+    { 246, 254, 31725 },
+    { 136, 255, 31727 },
+    { 63, 111, 31728 },
+    { 156, 244, 31730 },
+    { 38, 82, 31731 },
+    { 13, 217, 31732 },
+    { 204, 252, 31738 },
+    { 14, 38, 31740 },
+    { 141, 184, 31740 },
+    { 72, 146, 31744 },
+    { 124, 183, 31744 },
+    { 50, 65, 31748 },
+    { 114, 240, 31749 },
+    { 131, 154, 31754 },
+    { 185, 232, 31754 },
+    { 131, 153, 31755 },
+    { 183, 234, 31755 },
+    { 50, 100, 31758 },
+    { 184, 224, 31758 },
+    { 70, 72, 31759 },
+    { 68, 116, 31760 },
+    { 136, 177, 31760 },
+    { 204, 241, 31760 },
+    { 181, 212, 31762 },
+    { 89, 248, 31763 },
+    { 36, 112, 31764 },
+    { 239, 245, 31765 },
+    { 95, 234, 31770 },
+    { 62, 129, 31774 },
+    { 0, 229, 31779 },
+    { 114, 141, 31780 },
+    { 29, 69, 31781 },
+    { 224, 233, 31781 },
+    { 16, 44, 31782 },
+    { 46, 83, 31783 },
+    { 169, 186, 31787 },
+    { 203, 239, 31790 },
+    { 4, 197, 31794 },
+    { 3, 73, 31795 },
+    { 9, 198, 31797 },
+    { 230, 240, 31799 },
+    { 75, 132, 31800 },
+    { 231, 247, 31800 },
+    { 78, 112, 31801 },
+    { 38, 39, 31803 },
+    { 76, 147, 31803 },
+    { 130, 177, 31805 },
+    { 197, 226, 31808 },
+    { 109, 159, 31810 },
+    { 192, 243, 31812 },
+    { 76, 121, 31813 },
+    { 20, 105, 31814 },
+    { 11, 134, 31817 },
+    { 109, 208, 31821 },
+    { 230, 246, 31821 },
+    { 88, 209, 31824 },
+    { 74, 122, 31825 },
+    { 145, 217, 31825 },
+    { 206, 243, 31829 },
+    { 19, 157, 31830 },
+    { 182, 248, 31832 },
+    { 77, 121, 31834 },
+    { 126, 189, 31835 },
+    { 148, 219, 31836 },
+    { 12, 21, 31837 },
+    { 178, 195, 31839 },
+    { 144, 247, 31840 },
+    { 48, 96, 31843 },
+    { 1, 112, 31846 },
+    { 114, 126, 31847 },
+    { 152, 214, 31850 },
+    { 108, 205, 31856 },
+    { 86, 149, 31858 },
+    { 120, 212, 31860 },
+    { 213, 251, 31863 },
+    { 205, 252, 31867 },
+    { 11, 80, 31871 },
+    { 132, 163, 31871 },
+    { 120, 196, 31872 },
+    { 89, 170, 31873 },
+    { 114, 184, 31875 },
+    { 87, 234, 31877 },
+    { 26, 56, 31882 },
+    { 93, 141, 31883 },
+    { 56, 99, 31887 },
+    { 125, 142, 31888 },
+    { 85, 115, 31894 },
+    { 103, 151, 31895 },
+    { 25, 31, 31901 },
+    { 146, 248, 31902 },
+    { 99, 141, 31904 },
+    { 1, 123, 31905 },
+    { 53, 98, 31906 },
+    { 79, 185, 31907 },
+    { 226, 247, 31909 },
+    { 3, 38, 31911 },
+    { 130, 176, 31915 },
+    { 138, 151, 31915 },
+    { 114, 124, 31925 },
+    { 195, 224, 31925 },
+    { 128, 200, 31926 },
+    { 27, 207, 31931 },
+    { 32, 48, 31931 },
+    { 23, 225, 31935 },
+    { 6, 53, 31942 },
+    { 39, 119, 31951 },
+    { 81, 97, 31951 },
+    { 183, 199, 31952 },
+    { 162, 234, 31953 },
+    { 22, 179, 31957 },
+    { 12, 77, 31961 },
+    { 43, 49, 31962 },
+    { 0, 231, 31964 },
+    { 17, 242, 31964 },
+    { 25, 96, 31967 },
+    { 132, 221, 31972 },
+    { 136, 217, 31972 },
+    { 212, 245, 31973 },
+    { 94, 207, 31974 },
+    { 170, 181, 31974 },
+    { 73, 133, 31975 },
+    { 82, 136, 31975 },
+    { 222, 251, 31975 },
+    { 80, 136, 31976 },
+    { 101, 141, 31978 },
+    { 145, 170, 31979 },
+    { 71, 246, 31990 },
+    { 100, 135, 31990 },
+    { 150, 220, 31990 },
+    { 127, 213, 31993 },
+    { 1, 34, 31995 },
+    { 28, 54, 31996 },
+    { 19, 169, 31997 },
+    { 4, 242, 31999 },
+    { 62, 122, 31999 },
+    { 70, 114, 32006 },
+    { 7, 41, 32008 },
+    { 109, 182, 32008 },
+    { 9, 129, 32011 },
+    { 108, 159, 32012 },
+    { 20, 109, 32013 },
+    { 151, 162, 32015 },
+    { 22, 40, 32019 },
+    { 108, 200, 32019 },
+    { 76, 143, 32024 },
+    { 148, 203, 32025 },
+    { 24, 41, 32029 },
+    { 134, 220, 32030 },
+    { 105, 186, 32033 },
+    { 137, 167, 32039 },
+    { 149, 157, 32040 },
+    { 190, 253, 32043 },
+    { 141, 197, 32044 },
+    { 193, 239, 32045 },
+    { 90, 99, 32050 },
+    { 86, 152, 32052 },
+    { 210, 246, 32053 },
+    { 225, 254, 32054 },
+    { 13, 82, 32056 },
+    { 4, 221, 32058 },
+    { 148, 221, 32061 },
+    { 9, 95, 32066 },
+    { 128, 204, 32068 },
+    { 212, 251, 32070 },
+    { 180, 195, 32073 },
+    { 62, 125, 32075 },
+    { 38, 98, 32077 },
+    { 107, 169, 32077 },
+    { 43, 134, 32081 },
+    { 16, 80, 32083 },
+    { 83, 116, 32083 },
+    { 44, 93, 32084 },
+    { 166, 181, 32084 },
+    { 22, 233, 32085 },
+    { 12, 75, 32086 },
+    { 69, 106, 32086 },
+    { 197, 231, 32086 },
+    { 117, 235, 32089 },
+    { 1, 245, 32093 },
+    { 97, 248, 32093 },
+    { 194, 205, 32096 },
+    { 22, 123, 32099 },
+    { 165, 188, 32099 },
+    { 181, 207, 32100 },
+    { 47, 104, 32104 },
+    { 199, 253, 32105 },
+    { 9, 197, 32108 },
+    { 15, 42, 32109 },
+    { 71, 152, 32110 },
+    { 91, 123, 32115 },
+    { 140, 203, 32115 },
+    { 150, 214, 32115 },
+    { 8, 140, 32116 },
+    { 22, 55, 32116 },
+    { 100, 199, 32118 },
+    { 141, 207, 32118 },
+    { 216, 217, 32119 },
+    { 34, 91, 32125 },
+    { 43, 225, 32128 },
+    { 155, 188, 32129 },
+    { 83, 128, 32130 },
+    { 241, 247, 32131 },
+    { 16, 228, 32132 },
+    { 60, 158, 32132 },
+    { 133, 191, 32134 },
+    { 3, 243, 32136 },
+    { 2, 230, 32137 },
+    { 171, 189, 32137 },
+    { 211, 245, 32137 },
+    { 192, 229, 32139 },
+    { 231, 248, 32139 },
+    { 23, 100, 32145 },
+    { 67, 143, 32146 },
+    { 78, 118, 32147 },
+    { 134, 193, 32147 },
+    { 4, 67, 32148 },
+    { 215, 227, 32150 },
+    { 1, 21, 32152 },
+    { 104, 173, 32152 },
+    { 198, 226, 32156 },
+    { 30, 47, 32160 },
+    { 97, 141, 32161 },
+    { 167, 193, 32162 },
+    { 12, 42, 32163 },
+    { 141, 208, 32170 },
+    { 30, 38, 32171 },
+    { 124, 151, 32172 },
+    { 151, 174, 32176 },
+    { 211, 220, 32177 },
+    { 80, 158, 32183 },
+    { 157, 196, 32186 },
+    { 164, 210, 32187 },
+    { 21, 251, 32188 },
+    { 137, 165, 32188 },
+    { 193, 201, 32189 },
+    { 45, 88, 32190 },
+    { 141, 198, 32190 },
+    { 46, 77, 32193 },
+    { 183, 209, 32197 },
+    { 70, 115, 32204 },
+    { 79, 139, 32204 },
+    { 62, 80, 32205 },
+    { 144, 236, 32205 },
+    { 82, 140, 32208 },
+    { 39, 123, 32209 },
+    { 36, 74, 32210 },
+    { 59, 140, 32210 },
+    { 121, 192, 32210 },
+    { 169, 240, 32211 },
+    { 206, 235, 32211 },
+    { 90, 136, 32216 },
+    { 142, 192, 32217 },
+    { 128, 202, 32222 },
+    { 54, 132, 32224 },
+    { 129, 221, 32224 },
+    { 28, 92, 32225 },
+    { 4, 164, 32239 },
+    { 37, 63, 32243 },
+    { 79, 128, 32245 },
+    { 108, 202, 32245 },
+    { 40, 98, 32249 },
+    { 48, 93, 32252 },
+    { 138, 181, 32260 },
+    { 174, 229, 32261 },
+    { 59, 247, 32262 },
+    { 138, 212, 32262 },
+    { 161, 193, 32264 },
+    { 177, 185, 32267 },
+    { 19, 68, 32268 },
+    { 222, 235, 32269 },
+    { 16, 52, 32270 },
+    { 1, 134, 32271 },
+    { 168, 177, 32271 },
+    { 151, 222, 32272 },
+    { 186, 249, 32273 },
+    { 66, 113, 32275 },
+    { 115, 139, 32276 },
+    { 115, 159, 32276 },
+    { 195, 216, 32278 },
+    { 27, 170, 32288 },
+    { 174, 230, 32290 },
+    { 225, 226, 32293 },
+    { 118, 130, 32294 },
+    { 119, 194, 32296 },
+    { 9, 89, 32299 },
+    { 11, 119, 32299 },
+    { 55, 89, 32302 },
+    { 3, 77, 32303 },
+    { 20, 235, 32308 },
+    { 31, 59, 32308 },
+    { 107, 124, 32309 },
+    { 18, 237, 32310 },
+    { 121, 183, 32310 },
+    { 167, 203, 32310 },
+    { 38, 104, 32318 },
+    { 80, 255, 32318 },
+    { 46, 57, 32319 },
+    { 62, 132, 32319 },
+    { 97, 201, 32321 },
+    { 131, 188, 32322 },
+    { 174, 231, 32323 },
+    { 4, 223, 32325 },
+    { 39, 239, 32329 },
+    { 169, 239, 32331 },
+    { 171, 228, 32331 },
+    { 231, 239, 32331 },
+    { 41, 94, 32334 },
+    { 5, 60, 32337 },
+    { 181, 240, 32341 },
+    { 179, 230, 32343 },
+    { 118, 158, 32344 },
+    { 94, 205, 32348 },
+    { 12, 93, 32352 },
+    { 33, 58, 32354 },
+    { 126, 192, 32359 },
+    { 135, 193, 32360 },
+    { 2, 232, 32365 },
+    { 38, 105, 32365 },
+    { 222, 244, 32366 },
+    { 198, 231, 32369 },
+    { 191, 241, 32370 },
+    { 1, 100, 32371 },
+    { 156, 210, 32374 },
+    { 11, 242, 32375 },
+    { 22, 228, 32375 },
+    { 35, 84, 32376 },
+    { 109, 178, 32377 },
+    { 155, 214, 32377 },
+    { 164, 177, 32378 },
+    { 45, 101, 32381 },
+    { 112, 142, 32383 },
+    { 151, 233, 32383 },
+    { 45, 86, 32386 },
+    { 128, 196, 32388 },
+    { 63, 101, 32390 },
+    { 124, 189, 32390 },
+    { 130, 213, 32390 },
+    { 13, 35, 32391 },
+    { 55, 101, 32395 },
+    { 133, 183, 32396 },
+    { 74, 125, 32398 },
+    { 86, 138, 32399 },
+    { 6, 245, 32400 },
+    { 215, 242, 32402 },
+    { 81, 112, 32406 },
+    { 137, 182, 32406 },
+    { 20, 108, 32407 },
+    { 90, 123, 32408 },
+    { 79, 124, 32417 },
+    { 123, 171, 32417 },
+    { 238, 252, 32417 },
+    { 11, 140, 32419 },
+    { 132, 216, 32419 },
+    { 24, 158, 32426 },
+    { 14, 56, 32430 },
+    { 21, 74, 32431 },
+    { 117, 215, 32431 },
+    { 17, 238, 32432 },
+    { 37, 47, 32432 },
+    { 12, 63, 32433 },
+    { 17, 20, 32434 },
+    { 74, 106, 32436 },
+    { 12, 127, 32437 },
+    { 65, 146, 32440 },
+    { 75, 133, 32441 },
+    { 150, 186, 32443 },
+    { 105, 207, 32445 },
+    { 109, 180, 32447 },
+    { 128, 191, 32448 },
+    { 206, 225, 32448 },
+    { 77, 106, 32449 },
+    { 9, 172, 32451 },
+    { 15, 143, 32451 },
+    { 8, 119, 32453 },
+    { 16, 242, 32453 },
+    { 127, 235, 32454 },
+    { 106, 158, 32455 },
+    { 137, 143, 32463 },
+    { 76, 156, 32464 },
+    { 38, 80, 32467 },
+    { 0, 220, 32472 },
+    { 1, 140, 32473 },
+    { 54, 125, 32475 },
+    { 136, 240, 32476 },
+    { 86, 103, 32477 },
+    { 122, 235, 32477 },
+    { 112, 247, 32481 },
+    { 17, 49, 32485 },
+    { 37, 69, 32488 },
+    { 152, 248, 32488 },
+    { 22, 238, 32489 },
+    { 70, 116, 32490 },
+    { 2, 229, 32495 },
+    { 102, 207, 32497 },
+    { 108, 131, 32501 },
+    { 149, 206, 32508 },
+    { 25, 78, 32509 },
+    { 18, 242, 32511 },
+    { 40, 93, 32513 },
+    { 16, 165, 32514 },
+    { 116, 163, 32514 },
+    { 27, 166, 32515 },
+    { 132, 218, 32519 },
+    { 104, 212, 32527 },
+    { 129, 163, 32529 },
+    { 10, 50, 32531 },
+    { 78, 89, 32532 },
+    { 70, 93, 32533 },
+    { 137, 158, 32537 },
+    { 139, 216, 32538 },
+    { 107, 126, 32540 },
+    { 70, 112, 32542 },
+    { 53, 103, 32543 },
+    { 4, 104, 32544 },
+    { 9, 42, 32544 },
+    { 20, 93, 32545 },
+    { 27, 205, 32546 },
+    { 29, 250, 32547 },
+    { 118, 165, 32551 },
+    { 6, 100, 32553 },
+    { 26, 254, 32555 },
+    { 9, 132, 32557 },
+    { 3, 216, 32560 },
+    { 109, 174, 32563 },
+    { 110, 116, 32567 },
+    { 10, 45, 32568 },
+    { 5, 252, 32569 },
+    { 105, 173, 32569 },
+    { 107, 225, 32571 },
+    { 5, 31, 32573 },
+    { 135, 147, 32574 },
+    { 58, 106, 32577 },
+    { 188, 197, 32581 },
+    { 11, 220, 32584 },
+    { 110, 186, 32585 },
+    { 79, 172, 32587 },
+    { 47, 108, 32591 },
+    { 184, 211, 32592 },
+    { 147, 224, 32593 },
+    { 33, 130, 32598 },
+    { 66, 115, 32598 },
+    { 19, 28, 32599 },
+    { 84, 185, 32602 },
+    { 121, 198, 32602 },
+    { 22, 96, 32604 },
+    { 217, 219, 32610 },
+    { 176, 179, 32617 },
+    { 87, 148, 32619 },
+    { 20, 85, 32621 },
+    { 223, 238, 32624 },
+    { 147, 249, 32625 },
+    { 121, 197, 32626 },
+    { 30, 112, 32629 },
+    { 71, 160, 32630 },
+    { 140, 233, 32630 },
+    { 87, 201, 32631 },
+    { 119, 217, 32631 },
+    { 148, 151, 32634 },
+    { 1, 195, 32635 },
+    { 30, 158, 32637 },
+    { 33, 244, 32639 },
+    { 167, 246, 32639 },
+    { 111, 163, 32645 },
+    { 26, 190, 32647 },
+    { 151, 236, 32648 },
+    { 182, 246, 32648 },
+    { 81, 87, 32651 },
+    { 3, 149, 32655 },
+    { 2, 249, 32659 },
+    { 67, 153, 32659 },
+    { 148, 214, 32659 },
+    { 67, 154, 32661 },
+    { 68, 123, 32664 },
+    { 161, 203, 32664 },
+    { 6, 112, 32668 },
+    { 194, 242, 32670 },
+    { 91, 95, 32682 },
+    { 105, 205, 32682 },
+    { 188, 189, 32683 },
+    { 59, 239, 32689 },
+    { 143, 171, 32689 },
+    { 49, 105, 32691 },
+    { 99, 162, 32694 },
+    { 11, 227, 32696 },
+    { 39, 165, 32697 },
+    { 171, 197, 32697 },
+    { 62, 120, 32698 },
+    { 93, 106, 32699 },
+    { 102, 186, 32699 },
+    { 28, 62, 32704 },
+    { 194, 207, 32704 },
+    { 9, 109, 32705 },
+    { 219, 238, 32709 },
+    { 20, 28, 32711 },
+    { 8, 61, 32712 },
+    { 160, 193, 32712 },
+    { 142, 200, 32715 },
+    { 173, 195, 32715 },
+    { 118, 120, 32716 },
+    { 93, 166, 32718 },
+    { 181, 192, 32721 },
+    { 102, 141, 32724 },
+    { 155, 206, 32728 },
+    { 104, 182, 32729 },
+    { 110, 118, 32729 },
+    { 76, 82, 32730 },
+    { 11, 35, 32731 },
+    { 52, 101, 32731 },
+    { 99, 234, 32734 },
+    { 55, 87, 32735 },
+    { 124, 169, 32735 },
+    { 144, 233, 32740 },
+    { 18, 70, 32741 },
+    { 83, 126, 32741 },
+    { 191, 244, 32741 },
+    { 76, 164, 32742 },
+    { 84, 172, 32751 },
+    { 165, 171, 32756 },
+    { 12, 74, 32758 },
+    { 182, 244, 32758 },
+    { 111, 170, 32759 },
+    { 34, 96, 32760 },
+    { 196, 249, 32762 },
+    { 74, 129, 32764 },
+    { 101, 165, 32764 },
+    { 151, 191, 32766 },
+    { 53, 106, 32768 },
+    { 75, 106, 32770 },
+    { 129, 216, 32770 },
+    { 142, 156, 32771 },
+    { 57, 127, 32773 },
+    { 110, 204, 32776 },
+    { 21, 73, 32779 },
+    { 122, 213, 32780 },
+    { 131, 184, 32782 },
+    { 15, 120, 32783 },
+    { 93, 116, 32786 },
+    { 57, 120, 32787 },
+    { 24, 78, 32793 },
+    { 176, 185, 32793 },
+    { 33, 235, 32796 },
+    { 102, 205, 32800 },
+    { 94, 162, 32801 },
+    { 46, 85, 32803 },
+    { 110, 174, 32804 },
+    { 10, 241, 32810 },
+    { 60, 75, 32811 },
+    { 9, 76, 32812 },
+    { 54, 122, 32813 },
+    { 94, 200, 32816 },
+    { 129, 218, 32823 },
+    { 173, 231, 32824 },
+    { 109, 235, 32825 },
+    { 164, 176, 32826 },
+    { 7, 35, 32829 },
+    { 126, 185, 32832 },
+    { 184, 218, 32832 },
+    { 182, 195, 32836 },
+    { 71, 167, 32838 },
+    { 43, 63, 32839 },
+    { 4, 47, 32840 },
+    { 105, 159, 32840 },
+    { 150, 167, 32841 },
+    { 189, 252, 32841 },
+    { 34, 76, 32842 },
+    { 7, 40, 32844 },
+    { 145, 146, 32844 },
+    { 206, 245, 32844 },
+    { 229, 246, 32848 },
+    { 100, 239, 32851 },
+    { 148, 223, 32853 },
+    { 4, 41, 32857 },
+    { 3, 139, 32858 },
+    { 33, 143, 32858 },
+    { 19, 194, 32859 },
+    { 71, 121, 32860 },
+    { 26, 81, 32862 },
+    { 36, 240, 32862 },
+    { 22, 119, 32864 },
+    { 105, 200, 32864 },
+    { 92, 145, 32867 },
+    { 94, 186, 32869 },
+    { 134, 236, 32869 },
+    { 214, 246, 32870 },
+    { 65, 70, 32876 },
+    { 6, 92, 32878 },
+    { 219, 237, 32880 },
+    { 7, 23, 32890 },
+    { 87, 91, 32891 },
+    { 116, 158, 32891 },
+    { 40, 87, 32892 },
+    { 52, 89, 32893 },
+    { 128, 205, 32893 },
+    { 158, 203, 32893 },
+    { 23, 78, 32894 },
+    { 34, 85, 32896 },
+    { 64, 67, 32899 },
+    { 17, 19, 32903 },
+    { 133, 216, 32903 },
+    { 217, 218, 32903 },
+    { 53, 67, 32904 },
+    { 135, 191, 32904 },
+    { 135, 194, 32904 },
+    { 95, 192, 32905 },
+    { 37, 225, 32911 },
+    { 193, 242, 32911 },
+    { 48, 92, 32912 },
+    { 43, 69, 32913 },
+    { 105, 131, 32915 },
+    { 184, 213, 32916 },
+    { 16, 55, 32922 },
+    { 22, 237, 32922 },
+    { 108, 182, 32923 },
+    { 5, 227, 32925 },
+    { 40, 89, 32933 },
+    { 116, 149, 32933 },
+    { 127, 183, 32938 },
+    { 18, 80, 32943 },
+    { 29, 239, 32946 },
+    { 9, 86, 32950 },
+    { 113, 131, 32950 },
+    { 21, 78, 32951 },
+    { 113, 228, 32951 },
+    { 142, 202, 32951 },
+    { 179, 250, 32952 },
+    { 73, 130, 32955 },
+    { 74, 127, 32956 },
+    { 61, 67, 32957 },
+    { 124, 185, 32957 },
+    { 127, 191, 32959 },
+    { 34, 67, 32961 },
+    { 60, 240, 32961 },
+    { 184, 186, 32964 },
+    { 14, 68, 32965 },
+    { 14, 49, 32968 },
+    { 55, 92, 32968 },
+    { 180, 248, 32972 },
+    { 195, 242, 32981 },
+    { 52, 92, 32982 },
+    { 67, 185, 32985 },
+    { 90, 95, 32986 },
+    { 170, 246, 32986 },
+    { 223, 237, 32986 },
+    { 227, 251, 32986 },
+    { 17, 47, 32987 },
+    { 2, 36, 32988 },
+    { 94, 202, 32996 },
+    { 230, 234, 32998 },
+    { 1, 92, 32999 },
+    { 48, 101, 32999 },
+    { 169, 237, 33000 },
+    { 188, 198, 33002 },
+    { 104, 141, 33003 },
+    { 153, 244, 33003 },
+    { 154, 244, 33003 },
+    { 14, 252, 33007 },
+    { 114, 195, 33007 },
+    { 202, 252, 33007 },
+    { 96, 255, 33016 },
+    { 106, 168, 33017 },
+    { 210, 236, 33027 },
+    { 113, 217, 33029 },
+    { 99, 192, 33031 },
+    { 2, 227, 33037 },
+    { 226, 249, 33041 },
+    { 201, 230, 33042 },
+    { 119, 171, 33043 },
+    { 140, 141, 33044 },
+    { 211, 242, 33044 },
+    { 47, 59, 33047 },
+    { 18, 233, 33050 },
+    { 199, 242, 33052 },
+    { 87, 90, 33053 },
+    { 115, 179, 33053 },
+    { 96, 150, 33055 },
+    { 79, 103, 33059 },
+    { 24, 113, 33063 },
+    { 44, 89, 33063 },
+    { 26, 107, 33065 },
+    { 184, 219, 33066 },
+    { 66, 116, 33069 },
+    { 141, 206, 33069 },
+    { 103, 157, 33074 },
+    { 171, 198, 33075 },
+    { 196, 217, 33075 },
+    { 43, 106, 33079 },
+    { 57, 133, 33079 },
+    { 108, 208, 33079 },
+    { 191, 243, 33080 },
+    { 172, 214, 33082 },
+    { 75, 130, 33083 },
+    { 160, 203, 33083 },
+    { 13, 50, 33084 },
+    { 105, 202, 33088 },
+    { 24, 236, 33089 },
+    { 119, 247, 33089 },
+    { 27, 212, 33099 },
+    { 4, 189, 33100 },
+    { 37, 38, 33100 },
+    { 145, 167, 33101 },
+    { 65, 249, 33102 },
+    { 134, 188, 33102 },
+    { 16, 190, 33103 },
+    { 177, 179, 33108 },
+    { 117, 142, 33110 },
+    { 25, 123, 33112 },
+    { 36, 62, 33115 },
+    { 33, 50, 33118 },
+    { 71, 161, 33119 },
+    { 102, 200, 33119 },
+    { 189, 226, 33128 },
+    { 21, 250, 33129 },
+    { 4, 201, 33132 },
+    { 173, 230, 33132 },
+    { 12, 40, 33135 },
+    { 30, 225, 33135 },
+    { 141, 185, 33137 },
+    { 81, 99, 33145 },
+    { 181, 204, 33156 },
+    { 138, 215, 33157 },
+    { 6, 123, 33159 },
+    { 133, 221, 33159 },
+    { 15, 56, 33160 },
+    { 150, 225, 33161 },
+    { 233, 251, 33161 },
+    { 17, 70, 33162 },
+    { 95, 141, 33163 },
+    { 173, 229, 33163 },
+    { 73, 101, 33164 },
+    { 4, 14, 33165 },
+    { 9, 40, 33167 },
+    { 78, 113, 33169 },
+    { 100, 131, 33169 },
+    { 117, 196, 33170 },
+    { 142, 210, 33171 },
+    { 41, 102, 33175 },
+    { 120, 215, 33175 },
+    { 132, 223, 33175 },
+    { 23, 49, 33176 },
+    { 141, 203, 33178 },
+    { 9, 189, 33179 },
+    { 31, 87, 33180 },
+    { 10, 61, 33181 },
+    { 26, 236, 33181 },
+    { 172, 232, 33183 },
+    { 109, 212, 33188 },
+    { 7, 42, 33189 },
+    { 27, 139, 33191 },
+    { 108, 178, 33195 },
+    { 128, 169, 33198 },
+    { 131, 186, 33199 },
+    { 149, 169, 33201 },
+    { 8, 64, 33202 },
+    { 103, 139, 33204 },
+    { 136, 203, 33205 },
+    { 117, 211, 33206 },
+    { 65, 90, 33207 },
+    { 117, 163, 33209 },
+    { 147, 210, 33213 },
+    { 74, 132, 33216 },
+    { 15, 40, 33219 },
+    { 19, 101, 33231 },
+    { 4, 172, 33232 },
+    { 170, 232, 33233 },
+    { 44, 96, 33235 },
+    { 29, 96, 33238 },
+    { 200, 252, 33240 },
+    { 47, 109, 33243 },
+    { 108, 174, 33243 },
+    { 38, 108, 33248 },
+    { 96, 124, 33251 },
+    { 9, 232, 33254 },
+    { 145, 210, 33256 },
+    { 28, 254, 33257 },
+    { 72, 121, 33258 },
+    { 62, 127, 33260 },
+    { 128, 207, 33266 },
+    { 15, 204, 33267 },
+    { 35, 92, 33268 },
+    { 46, 106, 33268 },
+    { 109, 131, 33268 },
+    { 120, 211, 33271 },
+    { 145, 196, 33271 },
+    { 59, 225, 33274 },
+    { 132, 219, 33274 },
+    { 195, 250, 33274 },
+    { 5, 53, 33276 },
+    { 86, 160, 33279 },
+    { 51, 97, 33281 },
+    { 144, 227, 33281 },
+    { 4, 87, 33282 },
+    { 125, 246, 33286 },
+    { 141, 194, 33286 },
+    { 44, 87, 33287 },
+    { 52, 87, 33287 },
+    { 85, 118, 33287 },
+    { 49, 104, 33289 },
+    { 104, 180, 33289 },
+    { 149, 224, 33289 },
+    { 106, 165, 33290 },
+    { 137, 203, 33292 },
+    { 101, 157, 33294 },
+    { 132, 191, 33295 },
+    { 32, 201, 33302 },
+    { 28, 57, 33305 },
+    { 3, 75, 33307 },
+    { 124, 192, 33307 },
+    { 15, 69, 33309 },
+    { 3, 47, 33310 },
+    { 16, 42, 33312 },
+    { 108, 180, 33313 },
+    { 146, 150, 33315 },
+    { 7, 47, 33318 },
+    { 145, 155, 33319 },
+    { 60, 134, 33320 },
+    { 224, 228, 33320 },
+    { 102, 202, 33323 },
+    { 116, 171, 33328 },
+    { 165, 222, 33330 },
+    { 131, 132, 33332 },
+    { 71, 149, 33333 },
+    { 28, 247, 33334 },
+    { 85, 143, 33335 },
+    { 51, 96, 33336 },
+    { 104, 178, 33336 },
+    { 118, 181, 33339 },
+    { 133, 218, 33340 },
+    { 135, 186, 33342 },
+    { 14, 66, 33346 },
+    { 26, 123, 33346 },
+    { 116, 165, 33347 },
+    { 201, 241, 33348 },
+    { 189, 243, 33356 },
+    { 9, 105, 33358 },
+    { 144, 206, 33359 },
+    { 14, 47, 33360 },
+    { 125, 135, 33361 },
+    { 138, 213, 33362 },
+    { 8, 68, 33364 },
+    { 193, 241, 33366 },
+    { 9, 156, 33369 },
+    { 50, 86, 33372 },
+    { 28, 250, 33374 },
+    { 115, 171, 33374 },
+    { 18, 245, 33375 },
+    { 115, 163, 33377 },
+    { 85, 139, 33378 },
+    { 13, 220, 33379 },
+    { 70, 113, 33385 },
+    { 111, 164, 33385 },
+    { 2, 37, 33386 },
+    { 7, 34, 33387 },
+    { 64, 84, 33387 },
+    { 21, 75, 33391 },
+    { 72, 139, 33393 },
+    { 13, 107, 33397 },
+    { 15, 21, 33397 },
+    { 60, 98, 33397 },
+    { 169, 216, 33399 },
+    { 32, 146, 33400 },
+    { 139, 157, 33402 },
+    { 43, 47, 33405 },
+    { 74, 96, 33406 },
+    { 217, 223, 33411 },
+    { 102, 235, 33412 },
+    { 65, 91, 33413 },
+    { 120, 248, 33415 },
+    { 110, 178, 33416 },
+    { 95, 162, 33418 },
+    { 150, 155, 33418 },
+    { 27, 208, 33421 },
+    { 27, 56, 33422 },
+    { 144, 159, 33422 },
+    { 129, 223, 33427 },
+    { 121, 201, 33429 },
+    { 13, 66, 33437 },
+    { 16, 70, 33440 },
+    { 175, 220, 33443 },
+    { 163, 217, 33447 },
+    { 8, 80, 33448 },
+    { 151, 214, 33462 },
+    { 50, 103, 33463 },
+    { 77, 124, 33472 },
+    { 211, 251, 33475 },
+    { 137, 191, 33479 },
+    { 212, 227, 33481 },
+    { 58, 93, 33482 },
+    { 23, 158, 33489 },
+    { 66, 86, 33491 },
+    { 201, 222, 33491 },
+    { 56, 96, 33492 },
+    { 161, 181, 33493 },
+    { 126, 191, 33500 },
+    { 97, 162, 33502 },
+    { 13, 144, 33504 },
+    { 130, 248, 33505 },
+    { 171, 231, 33508 },
+    { 70, 111, 33510 },
+    { 94, 208, 33513 },
+    { 64, 115, 33514 },
+    { 80, 111, 33516 },
+    { 107, 199, 33517 },
+    { 13, 114, 33520 },
+    { 97, 131, 33521 },
+    { 9, 99, 33522 },
+    { 7, 54, 33524 },
+    { 136, 148, 33527 },
+    { 56, 101, 33528 },
+    { 149, 181, 33528 },
+    { 76, 153, 33529 },
+    { 96, 179, 33530 },
+    { 76, 154, 33531 },
+    { 194, 255, 33531 },
+    { 30, 63, 33533 },
+    { 66, 72, 33534 },
+    { 48, 89, 33537 },
+    { 19, 61, 33540 },
+    { 26, 41, 33543 },
+    { 3, 224, 33544 },
+    { 84, 138, 33544 },
+    { 190, 226, 33545 },
+    { 146, 224, 33547 },
+    { 0, 217, 33548 },
+    { 19, 64, 33548 },
+    { 23, 236, 33555 },
+    { 1, 119, 33556 },
+    { 129, 219, 33560 },
+    { 27, 200, 33562 },
+    { 118, 179, 33567 },
+    { 101, 168, 33571 },
+    { 131, 156, 33573 },
+    { 71, 201, 33575 },
+    { 18, 41, 33585 },
+    { 93, 170, 33586 },
+    { 99, 131, 33587 },
+    { 67, 248, 33589 },
+    { 141, 210, 33589 },
+    { 218, 238, 33589 },
+    { 24, 165, 33594 },
+    { 27, 187, 33595 },
+    { 49, 108, 33596 },
+    { 15, 83, 33599 },
+    { 12, 56, 33601 },
+    { 98, 143, 33602 },
+    { 116, 120, 33604 },
+    { 60, 83, 33606 },
+    { 100, 209, 33606 },
+    { 145, 186, 33606 },
+    { 181, 232, 33606 },
+    { 212, 242, 33610 },
+    { 29, 254, 33614 },
+    { 228, 243, 33616 },
+    { 116, 130, 33619 },
+    { 27, 42, 33620 },
+    { 27, 202, 33620 },
+    { 113, 181, 33620 },
+    { 169, 187, 33620 },
+    { 92, 135, 33621 },
+    { 149, 214, 33621 },
+    { 36, 75, 33624 },
+    { 84, 155, 33624 },
+    { 201, 229, 33624 },
+    { 25, 56, 33628 },
+    { 195, 218, 33632 },
+    { 9, 108, 33633 },
+    { 143, 210, 33637 },
+    { 110, 182, 33638 },
+    { 22, 134, 33647 },
+    { 110, 137, 33647 },
+    { 69, 117, 33653 },
+    { 158, 188, 33653 },
+    { 14, 236, 33654 },
+    { 46, 103, 33657 },
+    { 25, 107, 33658 },
+    { 22, 51, 33661 },
+    { 218, 237, 33662 },
+    { 135, 154, 33665 },
+    { 135, 153, 33666 },
+    { 126, 197, 33671 },
+    { 141, 211, 33671 },
+    { 83, 115, 33677 },
+    { 86, 161, 33678 },
+    { 152, 193, 33679 },
+    { 63, 96, 33681 },
+    { 189, 231, 33682 },
+    { 22, 107, 33683 },
+    { 81, 95, 33683 },
+    { 195, 219, 33684 },
+    { 107, 141, 33685 },
+    { 149, 193, 33689 },
+    { 23, 38, 33690 },
+    { 162, 235, 33691 },
+    { 34, 100, 33695 },
+    { 25, 119, 33697 },
+    { 137, 199, 33697 },
+    { 42, 97, 33701 },
+    { 82, 158, 33703 },
+    { 37, 134, 33706 },
+    { 126, 198, 33706 },
+    { 28, 74, 33709 },
+    { 2, 20, 33713 },
+    { 125, 191, 33713 },
+    { 166, 169, 33717 },
+    { 60, 165, 33718 },
+    { 134, 141, 33718 },
+    { 80, 165, 33719 },
+    { 165, 250, 33721 },
+    { 60, 62, 33724 },
+    { 61, 84, 33726 },
+    { 22, 168, 33727 },
+    { 35, 88, 33727 },
+    { 244, 253, 33733 },
+    { 6, 134, 33735 },
+    { 120, 183, 33736 },
+    { 21, 252, 33739 },
+    { 98, 136, 33740 },
+    { 76, 124, 33743 },
+    { 125, 221, 33744 },
+    { 53, 113, 33746 },
+    { 20, 129, 33750 },
+    { 16, 92, 33752 },
+    { 163, 220, 33757 },
+    { 38, 109, 33759 },
+    { 107, 240, 33759 },
+    { 187, 243, 33760 },
+    { 102, 249, 33761 },
+    { 179, 226, 33762 },
+    { 110, 180, 33766 },
+    { 22, 42, 33767 },
+    { 151, 173, 33776 },
+    { 4, 219, 33777 },
+    { 26, 119, 33777 },
+    { 64, 79, 33779 },
+    { 180, 246, 33779 },
+    { 230, 249, 33784 },
+    { 215, 220, 33785 },
+    { 176, 228, 33790 },
+    { 30, 254, 33791 },
+    { 93, 189, 33791 },
+    { 128, 151, 33798 },
+    { 169, 211, 33798 },
+    { 7, 29, 33799 },
+    { 46, 114, 33803 },
+    { 2, 39, 33804 },
+    { 60, 73, 33805 },
+    { 53, 112, 33811 },
+    { 128, 208, 33813 },
+    { 221, 238, 33818 },
+    { 4, 212, 33819 },
+    { 62, 133, 33822 },
+    { 125, 216, 33822 },
+    { 178, 248, 33823 },
+    { 105, 182, 33827 },
+    { 9, 254, 33830 },
+    { 12, 110, 33830 },
+    { 131, 191, 33830 },
+    { 195, 232, 33830 },
+    { 9, 201, 33831 },
+    { 24, 49, 33833 },
+    { 129, 191, 33833 },
+    { 97, 234, 33834 },
+    { 21, 67, 33835 },
+    { 104, 174, 33835 },
+    { 180, 244, 33837 },
+    { 13, 227, 33839 },
+    { 139, 218, 33839 },
+    { 102, 173, 33841 },
+    { 97, 103, 33843 },
+    { 74, 133, 33844 },
+    { 129, 131, 33845 },
+    { 78, 97, 33851 },
+    { 119, 141, 33853 },
+    { 17, 236, 33863 },
+    { 68, 84, 33863 },
+    { 98, 129, 33864 },
+    { 104, 215, 33865 },
+    { 75, 121, 33866 },
+    { 47, 110, 33874 },
+    { 192, 252, 33875 },
+    { 84, 106, 33880 },
+    { 131, 187, 33880 },
+    { 65, 234, 33881 },
+    { 93, 101, 33884 },
+    { 43, 140, 33886 },
+    { 98, 132, 33888 },
+    { 59, 115, 33889 },
+    { 193, 240, 33889 },
+    { 177, 228, 33890 },
+    { 58, 107, 33891 },
+    { 64, 119, 33898 },
+    { 35, 96, 33899 },
+    { 48, 87, 33901 },
+    { 105, 208, 33902 },
+    { 7, 24, 33906 },
+    { 51, 101, 33916 },
+    { 229, 234, 33920 },
+    { 216, 237, 33926 },
+    { 51, 95, 33927 },
+    { 96, 126, 33928 },
+    { 11, 50, 33932 },
+    { 139, 210, 33933 },
+    { 36, 247, 33934 },
+    { 45, 100, 33935 },
+    { 139, 234, 33935 },
+    { 9, 97, 33940 },
+    { 55, 103, 33941 },
+    { 169, 170, 33941 },
+    { 71, 81, 33944 },
+    { 71, 128, 33944 },
+    { 119, 228, 33944 },
+    { 102, 246, 33946 },
+    { 98, 112, 33947 },
+    { 138, 210, 33949 },
+    { 6, 61, 33951 },
+    { 81, 113, 33951 },
+    { 89, 201, 33956 },
+    { 112, 181, 33960 },
+    { 103, 120, 33961 },
+    { 185, 214, 33962 },
+    { 104, 159, 33963 },
+    { 133, 177, 33963 },
+    { 92, 157, 33976 },
+    { 167, 181, 33977 },
+    { 76, 128, 33979 },
+    { 1, 53, 33981 },
+    { 30, 165, 33981 },
+    { 10, 64, 33982 },
+    { 142, 172, 33982 },
+    { 191, 209, 33984 },
+    { 203, 240, 33984 },
+    { 134, 233, 33985 },
+    { 21, 32, 33986 },
+    { 135, 195, 33986 },
+    { 150, 187, 33986 },
+    { 12, 204, 33988 },
+    { 22, 31, 33989 },
+    { 160, 181, 33990 },
+    { 163, 199, 33990 },
+    { 36, 54, 33991 },
+    { 25, 179, 33993 },
+    { 61, 79, 33997 },
+    { 192, 241, 33999 },
+    { 102, 208, 34000 },
+    { 4, 215, 34003 },
+    { 16, 51, 34006 },
+    { 132, 142, 34013 },
+    { 118, 146, 34014 },
+    { 98, 148, 34015 },
+    { 194, 204, 34016 },
+    { 191, 246, 34017 },
+    { 126, 144, 34021 },
+    { 81, 110, 34027 },
+    { 79, 126, 34029 },
+    { 126, 196, 34029 },
+    { 151, 210, 34029 },
+    { 192, 194, 34041 },
+    { 84, 101, 34043 },
+    { 224, 254, 34043 },
+    { 33, 198, 34044 },
+    { 158, 250, 34044 },
+    { 157, 240, 34047 },
+    { 125, 249, 34049 },
+    { 0, 46, 34052 },
+    { 117, 135, 34053 },
+    { 84, 149, 34055 },
+    { 98, 146, 34057 },
+    { 2, 35, 34059 },
+    { 27, 149, 34059 },
+    { 197, 203, 34060 },
+    { 186, 243, 34069 },
+    { 96, 157, 34073 },
+    { 157, 186, 34075 },
+    { 9, 73, 34076 },
+    { 126, 201, 34077 },
+    { 18, 56, 34078 },
+    { 118, 184, 34078 },
+    { 236, 251, 34078 },
+    { 82, 84, 34081 },
+    { 15, 192, 34083 },
+    { 191, 199, 34083 },
+    { 142, 205, 34085 },
+    { 109, 175, 34086 },
+    { 118, 176, 34090 },
+    { 2, 246, 34091 },
+    { 4, 224, 34091 },
+    { 95, 204, 34093 },
+    { 158, 171, 34093 },
+    { 3, 182, 34094 },
+    { 6, 140, 34094 },
+    { 14, 237, 34097 },
+    { 130, 171, 34099 },
+    { 239, 241, 34101 },
+    { 105, 178, 34103 },
+    { 125, 218, 34104 },
+    { 10, 88, 34107 },
+    { 13, 96, 34107 },
+    { 16, 245, 34107 },
+    { 122, 191, 34113 },
+    { 166, 246, 34113 },
+    { 56, 94, 34114 },
+    { 4, 102, 34115 },
+    { 179, 214, 34116 },
+    { 216, 238, 34121 },
+    { 11, 82, 34123 },
+    { 157, 166, 34123 },
+    { 42, 95, 34124 },
+    { 114, 181, 34129 },
+    { 56, 103, 34131 },
+    { 54, 127, 34135 },
+    { 238, 244, 34135 },
+    { 23, 113, 34138 },
+    { 43, 190, 34138 },
+    { 195, 211, 34138 },
+    { 7, 49, 34141 },
+    { 27, 215, 34146 },
+    { 105, 174, 34148 },
+    { 15, 207, 34155 },
+    { 99, 187, 34161 },
+    { 140, 176, 34162 },
+    { 80, 144, 34163 },
+    { 203, 247, 34163 },
+    { 168, 229, 34164 },
+    { 16, 82, 34165 },
+    { 57, 111, 34171 },
+    { 67, 68, 34171 },
+    { 4, 49, 34172 },
+    { 88, 157, 34172 },
+    { 203, 245, 34174 },
+    { 19, 53, 34176 },
+    { 110, 163, 34179 },
+    { 23, 47, 34183 },
+    { 140, 227, 34184 },
+    { 163, 168, 34184 },
+    { 127, 137, 34186 },
+    { 214, 251, 34187 },
+    { 221, 237, 34188 },
+    { 123, 236, 34192 },
+    { 131, 168, 34192 },
+    { 15, 130, 34195 },
+    { 97, 192, 34196 },
+    { 122, 183, 34196 },
+    { 54, 120, 34198 },
+    { 95, 187, 34200 },
+    { 133, 176, 34202 },
+    { 155, 246, 34204 },
+    { 195, 213, 34204 },
+    { 125, 183, 34205 },
+    { 9, 14, 34206 },
+    { 38, 43, 34209 },
+    { 15, 51, 34211 },
+    { 75, 96, 34215 },
+    { 133, 219, 34217 },
+    { 135, 187, 34217 },
+    { 109, 246, 34218 },
+    { 118, 152, 34218 },
+    { 38, 59, 34220 },
+    { 105, 180, 34220 },
+    { 154, 171, 34221 },
+    { 0, 59, 34223 },
+    { 31, 89, 34224 },
+    { 153, 171, 34224 },
+    { 127, 216, 34225 },
+    { 72, 155, 34230 },
+    { 110, 175, 34231 },
+    { 170, 226, 34231 },
+    { 91, 134, 34232 },
+    { 14, 19, 34233 },
+    { 152, 203, 34236 },
+    { 60, 85, 34238 },
+    { 126, 200, 34242 },
+    { 175, 217, 34244 },
+    { 89, 234, 34245 },
+    { 123, 220, 34245 },
+    { 36, 73, 34247 },
+    { 133, 246, 34247 },
+    { 77, 128, 34248 },
+    { 124, 197, 34251 },
+    { 39, 106, 34253 },
+    { 13, 45, 34255 },
+    { 124, 198, 34260 },
+    { 117, 213, 34262 },
+    { 114, 121, 34264 },
+    { 39, 225, 34266 },
+    { 86, 167, 34266 },
+    { 132, 183, 34268 },
+    { 140, 163, 34268 },
+    { 4, 129, 34270 },
+    { 244, 250, 34277 },
+    { 51, 99, 34279 },
+    { 234, 242, 34279 },
+    { 142, 204, 34281 },
+    { 1, 229, 34287 },
+    { 85, 147, 34293 },
+    { 113, 142, 34293 },
+    { 127, 177, 34293 },
+    { 71, 235, 34294 },
+    { 134, 203, 34295 },
+    { 137, 190, 34296 },
+    { 148, 224, 34296 },
+    { 32, 155, 34299 },
+    { 64, 116, 34299 },
+    { 203, 243, 34299 },
+    { 30, 107, 34300 },
+    { 67, 172, 34302 },
+    { 49, 109, 34307 },
+    { 44, 101, 34309 },
+    { 44, 92, 34311 },
+    { 139, 188, 34311 },
+    { 108, 235, 34312 },
+    { 98, 149, 34313 },
+    { 99, 204, 34324 },
+    { 117, 246, 34326 },
+    { 184, 223, 34336 },
+    { 18, 251, 34337 },
+    { 92, 150, 34338 },
+    { 96, 142, 34343 },
+    { 133, 223, 34344 },
+    { 15, 212, 34345 },
+    { 93, 118, 34348 },
+    { 78, 87, 34349 },
+    { 213, 217, 34356 },
+    { 109, 249, 34360 },
+    { 145, 220, 34364 },
+    { 148, 194, 34368 },
+    { 10, 190, 34372 },
+    { 63, 117, 34374 },
+    { 149, 235, 34377 },
+    { 25, 233, 34378 },
+    { 120, 191, 34378 },
+    { 167, 232, 34383 },
+    { 20, 185, 34385 },
+    { 30, 69, 34396 },
+    { 138, 193, 34396 },
+    { 20, 132, 34397 },
+    { 92, 111, 34401 },
+    { 9, 117, 34402 },
+    { 157, 233, 34404 },
+    { 110, 200, 34405 },
+    { 107, 121, 34406 },
+    { 52, 103, 34407 },
+    { 3, 74, 34408 },
+    { 54, 133, 34409 },
+    { 94, 212, 34412 },
+    { 151, 178, 34412 },
+    { 96, 190, 34414 },
+    { 4, 218, 34415 },
+    { 56, 102, 34416 },
+    { 143, 224, 34417 },
+    { 74, 130, 34418 },
+    { 8, 35, 34420 },
+    { 61, 115, 34421 },
+    { 68, 255, 34422 },
+    { 73, 106, 34424 },
+    { 33, 189, 34426 },
+    { 142, 189, 34427 },
+    { 54, 82, 34428 },
+    { 175, 227, 34435 },
+    { 12, 51, 34439 },
+    { 28, 240, 34444 },
+    { 31, 80, 34444 },
+    { 82, 255, 34444 },
+    { 59, 190, 34451 },
+    { 83, 143, 34451 },
+    { 31, 82, 34452 },
+    { 12, 69, 34461 },
+    { 7, 231, 34462 },
+    { 217, 221, 34462 },
+    { 10, 158, 34464 },
+    { 145, 214, 34464 },
+    { 33, 197, 34465 },
+    { 60, 115, 34465 },
+    { 24, 38, 34468 },
+    { 152, 181, 34472 },
+    { 22, 78, 34477 },
+    { 110, 207, 34479 },
+    { 10, 40, 34482 },
+    { 198, 203, 34484 },
+    { 130, 216, 34486 },
+    { 189, 203, 34486 },
+    { 142, 208, 34488 },
+    { 127, 176, 34489 },
+    { 37, 106, 34490 },
+    { 89, 103, 34490 },
+    { 61, 119, 34491 },
+    { 92, 131, 34491 },
+    { 121, 204, 34493 },
+    { 121, 200, 34494 },
+    { 6, 64, 34499 },
+    { 180, 220, 34499 },
+    { 148, 184, 34500 },
+    { 21, 81, 34502 },
+    { 66, 93, 34510 },
+    { 22, 209, 34511 },
+    { 108, 212, 34514 },
+    { 145, 225, 34515 },
+    { 46, 98, 34523 },
+    { 77, 143, 34526 },
+    { 3, 196, 34530 },
+    { 126, 202, 34533 },
+    { 25, 238, 34536 },
+    { 166, 232, 34536 },
+    { 62, 103, 34540 },
+    { 50, 106, 34541 },
+    { 20, 117, 34544 },
+    { 109, 215, 34547 },
+    { 3, 31, 34553 },
+    { 65, 139, 34553 },
+    { 76, 80, 34553 },
+    { 110, 205, 34553 },
+    { 28, 100, 34558 },
+    { 91, 105, 34564 },
+    { 7, 57, 34568 },
+    { 169, 213, 34570 },
+    { 41, 105, 34572 },
+    { 19, 181, 34575 },
+    { 73, 121, 34575 },
+    { 39, 134, 34576 },
+    { 49, 110, 34578 },
+    { 65, 66, 34580 },
+    { 150, 222, 34589 },
+    { 90, 134, 34591 },
+    { 208, 227, 34591 },
+    { 6, 35, 34595 },
+    { 116, 162, 34596 },
+    { 13, 242, 34600 },
+    { 93, 135, 34600 },
+    { 113, 236, 34602 },
+    { 210, 248, 34603 },
+    { 12, 212, 34608 },
+    { 16, 100, 34610 },
+    { 120, 177, 34610 },
+    { 120, 213, 34610 },
+    { 68, 79, 34611 },
+    { 129, 142, 34612 },
+    { 157, 170, 34612 },
+    { 86, 189, 34616 },
+    { 8, 195, 34618 },
+    { 8, 245, 34621 },
+    { 225, 231, 34623 },
+    { 42, 99, 34624 },
+    { 149, 203, 34626 },
+    { 57, 82, 34627 },
+    { 157, 161, 34628 },
+    { 86, 248, 34629 },
+    { 91, 141, 34629 },
+    { 151, 247, 34631 },
+    { 152, 157, 34633 },
+    { 127, 221, 34635 },
+    { 4, 62, 34639 },
+    { 21, 80, 34639 },
+    { 53, 255, 34640 },
+    { 55, 97, 34643 },
+    { 9, 221, 34644 },
+    { 71, 166, 34644 },
+    { 23, 165, 34646 },
+    { 25, 81, 34646 },
+    { 12, 143, 34648 },
+    { 130, 145, 34650 },
+    { 208, 245, 34650 },
+    { 92, 239, 34652 },
+    { 161, 169, 34653 },
+    { 162, 226, 34656 },
+    { 194, 241, 34656 },
+    { 126, 204, 34657 },
+    { 65, 155, 34664 },
+    { 162, 195, 34664 },
+    { 76, 146, 34665 },
+    { 178, 220, 34667 },
+    { 110, 202, 34668 },
+    { 129, 244, 34669 },
+    { 181, 247, 34673 },
+    { 84, 152, 34676 },
+    { 131, 193, 34677 },
+    { 6, 119, 34678 },
+    { 0, 209, 34680 },
+    { 53, 79, 34680 },
+    { 242, 255, 34681 },
+    { 139, 221, 34685 },
+    { 2, 43, 34691 },
+    { 60, 77, 34696 },
+    { 63, 106, 34696 },
+    { 138, 216, 34696 },
+    { 3, 232, 34703 },
+    { 193, 247, 34711 },
+    { 77, 96, 34712 },
+    { 118, 177, 34712 },
+    { 17, 237, 34713 },
+    { 99, 103, 34715 },
+    { 120, 176, 34715 },
+    { 121, 151, 34715 },
+    { 94, 173, 34717 },
+    { 142, 207, 34721 },
+    { 77, 147, 34723 },
+    { 79, 155, 34724 },
+    { 76, 139, 34728 },
+    { 14, 70, 34731 },
+    { 0, 190, 34733 },
+    { 25, 228, 34733 },
+    { 82, 144, 34734 },
+    { 89, 141, 34734 },
+    { 4, 156, 34735 },
+    { 12, 207, 34735 },
+    { 185, 243, 34735 },
+    { 111, 172, 34739 },
+    { 160, 246, 34739 },
+    { 103, 148, 34740 },
+    { 127, 218, 34740 },
+    { 65, 246, 34741 },
+    { 170, 244, 34741 },
+    { 178, 246, 34741 },
+    { 0, 35, 34743 },
+    { 36, 114, 34743 },
+    { 8, 144, 34746 },
+    { 102, 182, 34747 },
+    { 224, 236, 34755 },
+    { 167, 244, 34756 },
+    { 108, 175, 34758 },
+    { 106, 110, 34759 },
+    { 4, 132, 34761 },
+    { 1, 230, 34766 },
+    { 105, 235, 34770 },
+    { 57, 248, 34771 },
+    { 219, 233, 34780 },
+    { 146, 188, 34783 },
+    { 169, 200, 34787 },
+    { 102, 159, 34788 },
+    { 206, 234, 34789 },
+    { 113, 194, 34791 },
+    { 98, 119, 34792 },
+    { 121, 202, 34792 },
+    { 135, 203, 34792 },
+    { 9, 56, 34793 },
+    { 211, 217, 34793 },
+    { 22, 140, 34795 },
+    { 43, 103, 34795 },
+    { 117, 249, 34795 },
+    { 74, 121, 34800 },
+    { 100, 169, 34808 },
+    { 197, 241, 34809 },
+    { 78, 119, 34811 },
+    { 159, 222, 34812 },
+    { 158, 222, 34816 },
+    { 48, 103, 34817 },
+    { 195, 223, 34818 },
+    { 229, 249, 34819 },
+    { 177, 235, 34823 },
+    { 103, 130, 34824 },
+    { 140, 177, 34824 },
+    { 112, 217, 34829 },
+    { 124, 201, 34829 },
+    { 147, 171, 34832 },
+    { 25, 134, 34833 },
+    { 169, 202, 34835 },
+    { 208, 251, 34835 },
+    { 12, 221, 34837 },
+    { 180, 227, 34837 },
+    { 14, 241, 34838 },
+    { 178, 244, 34841 },
+    { 167, 249, 34842 },
+    { 9, 63, 34843 },
+    { 88, 145, 34846 },
+    { 184, 187, 34846 },
+    { 1, 144, 34847 },
+    { 123, 141, 34850 },
+    { 24, 112, 34852 },
+    { 6, 68, 34853 },
+    { 132, 244, 34857 },
+    { 123, 193, 34859 },
+    { 3, 49, 34860 },
+    { 15, 205, 34860 },
+    { 96, 121, 34865 },
+    { 129, 183, 34865 },
+    { 182, 220, 34866 },
+    { 72, 128, 34867 },
+    { 41, 104, 34877 },
+    { 24, 47, 34878 },
+    { 16, 113, 34880 },
+    { 147, 244, 34880 },
+    { 88, 137, 34883 },
+    { 32, 35, 34885 },
+    { 4, 17, 34886 },
+    { 18, 82, 34887 },
+    { 93, 198, 34891 },
+    { 184, 202, 34893 },
+    { 15, 85, 34899 },
+    { 71, 170, 34904 },
+    { 29, 113, 34906 },
+    { 87, 249, 34906 },
+    { 174, 220, 34912 },
+    { 50, 107, 34917 },
+    { 137, 206, 34920 },
+    { 135, 179, 34922 },
+    { 18, 228, 34923 },
+    { 101, 138, 34923 },
+    { 188, 241, 34923 },
+    { 100, 247, 34924 },
+    { 125, 219, 34925 },
+    { 121, 169, 34927 },
+    { 4, 204, 34929 },
+    { 11, 66, 34930 },
+    { 184, 200, 34930 },
+    { 190, 214, 34931 },
+    { 67, 121, 34933 },
+    { 141, 212, 34933 },
+    { 210, 249, 34933 },
+    { 157, 239, 34935 },
+    { 139, 219, 34936 },
+    { 207, 251, 34936 },
+    { 0, 31, 34937 },
+    { 24, 81, 34938 },
+    { 173, 248, 34939 },
+    { 54, 248, 34940 },
+    { 163, 229, 34940 },
+    { 11, 45, 34941 },
+    { 35, 86, 34941 },
+    { 125, 223, 34941 },
+    { 124, 144, 34942 },
+    { 48, 88, 34943 },
+    { 85, 131, 34943 },
+    { 171, 172, 34943 },
+    { 110, 234, 34947 },
+    { 163, 209, 34948 },
+    { 9, 125, 34951 },
+    { 22, 114, 34952 },
+    { 65, 189, 34952 },
+    { 100, 111, 34952 },
+    { 24, 238, 34953 },
+    { 142, 179, 34956 },
+    { 198, 241, 34956 },
+    { 183, 228, 34957 },
+    { 22, 199, 34958 },
+    { 61, 255, 34959 },
+    { 17, 252, 34965 },
+    { 7, 238, 34971 },
+    { 170, 194, 34977 },
+    { 19, 115, 34978 },
+    { 193, 197, 34978 },
+    { 53, 84, 34984 },
+    { 45, 103, 34985 },
+    { 191, 248, 34986 },
+    { 51, 92, 34987 },
+    { 115, 149, 34991 },
+    { 143, 246, 34992 },
+    { 95, 131, 34995 },
+    { 12, 192, 34996 },
+    { 83, 139, 34996 },
+    { 90, 105, 34998 },
+    { 26, 114, 34999 },
+    { 91, 142, 35003 },
+    { 206, 239, 35004 },
+    { 28, 75, 35015 },
+    { 184, 221, 35018 },
+    { 179, 253, 35029 },
+    { 23, 81, 35031 },
+    { 87, 192, 35031 },
+    { 26, 49, 35033 },
+    { 182, 227, 35033 },
+    { 122, 216, 35038 },
+    { 126, 181, 35040 },
+    { 36, 57, 35041 },
+    { 108, 142, 35043 },
+    { 78, 99, 35046 },
+    { 9, 223, 35052 },
+    { 145, 187, 35052 },
+    { 10, 165, 35054 },
+    { 58, 71, 35054 },
+    { 124, 191, 35056 },
+    { 176, 190, 35056 },
+    { 169, 255, 35058 },
+    { 212, 220, 35059 },
+    { 209, 254, 35061 },
+    { 136, 239, 35064 },
+    { 66, 111, 35067 },
+    { 27, 51, 35070 },
+    { 161, 246, 35070 },
+    { 65, 121, 35072 },
+    { 223, 233, 35072 },
+    { 32, 45, 35075 },
+    { 45, 71, 35076 },
+    { 184, 232, 35077 },
+    { 51, 103, 35078 },
+    { 138, 206, 35080 },
+    { 27, 40, 35083 },
+    { 91, 108, 35084 },
+    { 5, 230, 35085 },
+    { 110, 248, 35086 },
+    { 91, 120, 35087 },
+    { 15, 215, 35091 },
+    { 6, 195, 35092 },
+    { 5, 220, 35098 },
+    { 4, 207, 35099 },
+    { 10, 227, 35100 },
+    { 28, 73, 35100 },
+    { 93, 115, 35102 },
+    { 25, 237, 35103 },
+    { 3, 83, 35104 },
+    { 110, 115, 35104 },
+    { 86, 148, 35106 },
+    { 23, 238, 35107 },
+    { 152, 169, 35108 },
+    { 76, 101, 35110 },
+    { 85, 138, 35111 },
+    { 67, 146, 35112 },
+    { 3, 41, 35113 },
+    { 12, 241, 35113 },
+    { 191, 228, 35114 },
+    { 130, 235, 35115 },
+    { 3, 180, 35116 },
+    { 27, 251, 35118 },
+    { 0, 232, 35120 },
+    { 38, 110, 35120 },
+    { 171, 233, 35122 },
+    { 15, 221, 35123 },
+    { 64, 123, 35129 },
+    { 92, 199, 35129 },
+    { 9, 51, 35131 },
+    { 65, 198, 35132 },
+    { 104, 211, 35132 },
+    { 9, 84, 35135 },
+    { 25, 41, 35139 },
+    { 157, 160, 35139 },
+    { 5, 229, 35141 },
+    { 172, 252, 35143 },
+    { 184, 215, 35143 },
+    { 59, 74, 35145 },
+    { 88, 98, 35148 },
+    { 142, 201, 35150 },
+    { 83, 147, 35152 },
+    { 121, 196, 35156 },
+    { 178, 227, 35157 },
+    { 4, 231, 35159 },
+    { 136, 162, 35160 },
+    { 226, 240, 35162 },
+    { 151, 180, 35164 },
+    { 64, 255, 35165 },
+    { 102, 212, 35166 },
+    { 114, 171, 35169 },
+    { 160, 169, 35171 },
+    { 52, 88, 35173 },
+    { 142, 164, 35174 },
+    { 2, 225, 35179 },
+    { 122, 137, 35180 },
+    { 11, 144, 35181 },
+    { 94, 141, 35184 },
+    { 26, 179, 35193 },
+    { 171, 225, 35193 },
+    { 10, 44, 35194 },
+    { 94, 182, 35194 },
+    { 66, 119, 35195 },
+    { 76, 185, 35196 },
+    { 72, 249, 35197 },
+    { 168, 230, 35198 },
+    { 102, 178, 35202 },
+    { 81, 119, 35204 },
+    { 133, 249, 35204 },
+    { 24, 96, 35207 },
+    { 26, 134, 35207 },
+    { 82, 165, 35209 },
+    { 77, 126, 35210 },
+    { 112, 228, 35212 },
+    { 93, 197, 35213 },
+    { 188, 239, 35215 },
+    { 214, 252, 35216 },
+    { 85, 146, 35220 },
+    { 61, 116, 35222 },
+    { 137, 186, 35224 },
+    { 37, 190, 35227 },
+    { 39, 74, 35227 },
+    { 7, 44, 35230 },
+    { 189, 193, 35230 },
+    { 20, 243, 35232 },
+    { 102, 180, 35232 },
+    { 242, 248, 35234 },
+    { 148, 234, 35235 },
+    { 159, 226, 35235 },
+    { 188, 242, 35235 },
+    { 135, 196, 35236 },
+    { 13, 58, 35239 },
+    { 29, 54, 35239 },
+    { 144, 183, 35239 },
+    { 83, 118, 35242 },
+    { 12, 120, 35243 },
+    { 12, 215, 35243 },
+    { 184, 208, 35246 },
+    { 19, 106, 35247 },
+    { 116, 179, 35249 },
+    { 52, 97, 35250 },
+    { 53, 114, 35250 },
+    { 34, 255, 35253 },
+    { 214, 250, 35259 },
+    { 122, 221, 35262 },
+    { 15, 44, 35264 },
+    { 121, 191, 35267 },
+    { 10, 48, 35270 },
+    { 10, 243, 35271 },
+    { 157, 236, 35271 },
+    { 163, 230, 35273 },
+    { 91, 138, 35278 },
+    { 31, 252, 35279 },
+    { 10, 58, 35283 },
+    { 155, 193, 35287 },
+    { 97, 187, 35288 },
+    { 105, 212, 35300 },
+    { 162, 222, 35300 },
+    { 207, 245, 35300 },
+    { 12, 44, 35302 },
+    { 114, 128, 35302 },
+    { 107, 209, 35304 },
+    { 166, 194, 35307 },
+    { 126, 205, 35309 },
+    { 25, 114, 35310 },
+    { 130, 218, 35312 },
+    { 5, 190, 35314 },
+    { 217, 243, 35314 },
+    { 202, 227, 35316 },
+    { 114, 239, 35317 },
+    { 141, 213, 35317 },
+    { 36, 158, 35318 },
+    { 119, 126, 35318 },
+    { 18, 158, 35319 },
+    { 55, 88, 35319 },
+    { 166, 226, 35319 },
+    { 169, 224, 35319 },
+    { 71, 78, 35320 },
+    { 108, 135, 35324 },
+    { 142, 211, 35324 },
+    { 235, 254, 35324 },
+    { 6, 80, 35328 },
+    { 169, 218, 35328 },
+    { 186, 241, 35328 },
+    { 46, 76, 35332 },
+    { 170, 249, 35332 },
+    { 37, 253, 35336 },
+    { 124, 200, 35343 },
+    { 15, 155, 35348 },
+    { 60, 140, 35348 },
+    { 12, 245, 35350 },
+    { 45, 93, 35350 },
+    { 133, 137, 35354 },
+    { 104, 175, 35363 },
+    { 10, 68, 35365 },
+    { 56, 105, 35377 },
+    { 68, 134, 35378 },
+    { 237, 252, 35383 },
+    { 86, 198, 35388 },
+    { 9, 153, 35392 },
+    { 71, 124, 35392 },
+    { 9, 154, 35394 },
+    { 24, 190, 35399 },
+    { 187, 241, 35399 },
+    { 106, 139, 35401 },
+    { 193, 198, 35402 },
+    { 12, 83, 35405 },
+    { 55, 95, 35406 },
+    { 79, 248, 35409 },
+    { 54, 111, 35411 },
+    { 115, 190, 35411 },
+    { 121, 205, 35412 },
+    { 13, 70, 35413 },
+    { 21, 65, 35413 },
+    { 164, 252, 35413 },
+    { 124, 196, 35415 },
+    { 75, 124, 35419 },
+    { 139, 169, 35419 },
+    { 5, 45, 35422 },
+    { 72, 234, 35423 },
+    { 76, 126, 35424 },
+    { 165, 206, 35424 },
+    { 222, 252, 35424 },
+    { 216, 233, 35427 },
+    { 5, 231, 35428 },
+    { 102, 131, 35431 },
+    { 165, 253, 35434 },
+    { 182, 249, 35447 },
+    { 218, 233, 35449 },
+    { 15, 208, 35453 },
+    { 12, 205, 35457 },
+    { 157, 226, 35458 },
+    { 18, 38, 35459 },
+    { 40, 97, 35460 },
+    { 72, 189, 35462 },
+    { 1, 222, 35467 },
+    { 122, 218, 35468 },
+    { 41, 108, 35470 },
+    { 205, 251, 35470 },
+    { 136, 220, 35472 },
+    { 168, 214, 35473 },
+    { 177, 234, 35473 },
+    { 20, 164, 35474 },
+    { 21, 77, 35474 },
+    { 35, 98, 35474 },
+    { 102, 174, 35476 },
+    { 12, 223, 35477 },
+    { 84, 116, 35479 },
+    { 27, 186, 35480 },
+    { 59, 144, 35481 },
+    { 37, 140, 35487 },
+    { 44, 97, 35492 },
+    { 29, 62, 35493 },
+    { 109, 142, 35494 },
+    { 172, 206, 35494 },
+    { 136, 183, 35500 },
+    { 164, 232, 35501 },
+    { 0, 222, 35504 },
+    { 177, 190, 35504 },
+    { 97, 204, 35505 },
+    { 62, 130, 35507 },
+    { 36, 239, 35512 },
+    { 109, 211, 35522 },
+    { 36, 83, 35523 },
+    { 176, 235, 35525 },
+    { 168, 183, 35526 },
+    { 78, 95, 35530 },
+    { 200, 227, 35532 },
+    { 27, 221, 35534 },
+    { 57, 130, 35538 },
+    { 9, 44, 35539 },
+    { 14, 243, 35539 },
+    { 59, 98, 35539 },
+    { 131, 194, 35541 },
+    { 90, 108, 35545 },
+    { 126, 188, 35546 },
+    { 123, 233, 35549 },
+    { 65, 197, 35550 },
+    { 122, 246, 35557 },
+    { 21, 82, 35558 },
+    { 46, 119, 35561 },
+    { 135, 156, 35564 },
+    { 99, 159, 35565 },
+    { 130, 221, 35565 },
+    { 214, 225, 35566 },
+    { 15, 146, 35570 },
+    { 197, 230, 35572 },
+    { 240, 245, 35572 },
+    { 25, 168, 35586 },
+    { 72, 124, 35586 },
+    { 98, 145, 35596 },
+    { 141, 215, 35597 },
+    { 4, 95, 35598 },
+    { 5, 50, 35601 },
+    { 122, 177, 35601 },
+    { 124, 204, 35605 },
+    { 136, 228, 35605 },
+    { 60, 247, 35606 },
+    { 59, 116, 35611 },
+    { 150, 228, 35611 },
+    { 214, 249, 35616 },
+    { 169, 208, 35617 },
+    { 111, 119, 35618 },
+    { 205, 245, 35619 },
+    { 108, 246, 35624 },
+    { 4, 42, 35625 },
+    { 39, 103, 35629 },
+    { 105, 142, 35630 },
+    { 137, 209, 35630 },
+    { 155, 203, 35630 },
+    { 124, 202, 35637 },
+    { 77, 116, 35638 },
+    { 112, 194, 35641 },
+    { 127, 219, 35641 },
+    { 99, 186, 35642 },
+    { 54, 80, 35647 },
+    { 158, 253, 35647 },
+    { 194, 250, 35648 },
+    { 17, 80, 35649 },
+    { 195, 221, 35649 },
+    { 130, 150, 35650 },
+    { 86, 166, 35655 },
+    { 154, 214, 35655 },
+    { 9, 212, 35656 },
+    { 59, 168, 35657 },
+    { 153, 214, 35657 },
+    { 0, 60, 35658 },
+    { 105, 175, 35662 },
+    { 69, 92, 35668 },
+    { 4, 213, 35669 },
+    { 186, 195, 35669 },
+    { 61, 123, 35670 },
+    { 139, 223, 35672 },
+    { 55, 99, 35677 },
+    { 77, 156, 35677 },
+    { 87, 246, 35677 },
+    { 131, 172, 35678 },
+    { 69, 120, 35682 },
+    { 32, 251, 35686 },
+    { 4, 109, 35690 },
+    { 33, 81, 35690 },
+    { 131, 196, 35690 },
+    { 36, 119, 35692 },
+    { 40, 96, 35692 },
+    { 76, 106, 35693 },
+    { 119, 124, 35697 },
+    { 8, 82, 35701 },
+    { 108, 249, 35704 },
+    { 79, 82, 35712 },
+    { 3, 178, 35714 },
+    { 8, 50, 35718 },
+    { 54, 60, 35720 },
+    { 191, 237, 35721 },
+    { 90, 141, 35725 },
+    { 94, 215, 35729 },
+    { 167, 169, 35729 },
+    { 58, 89, 35730 },
+    { 126, 207, 35739 },
+    { 95, 186, 35742 },
+    { 106, 169, 35743 },
+    { 18, 49, 35744 },
+    { 9, 75, 35746 },
+    { 28, 96, 35748 },
+    { 56, 92, 35751 },
+    { 121, 207, 35754 },
+    { 0, 4, 35757 },
+    { 174, 217, 35757 },
+    { 86, 197, 35759 },
+    { 36, 77, 35761 },
+    { 132, 135, 35762 },
+    { 1, 61, 35764 },
+    { 9, 17, 35764 },
+    { 105, 135, 35765 },
+    { 195, 253, 35766 },
+    { 191, 233, 35767 },
+    { 150, 227, 35769 },
+    { 19, 150, 35773 },
+    { 110, 208, 35777 },
+    { 33, 34, 35778 },
+    { 11, 107, 35780 },
+    { 176, 233, 35782 },
+    { 94, 180, 35783 },
+    { 118, 161, 35783 },
+    { 204, 251, 35784 },
+    { 177, 233, 35785 },
+    { 206, 244, 35786 },
+    { 208, 220, 35786 },
+    { 88, 150, 35788 },
+    { 89, 131, 35789 },
+    { 157, 187, 35791 },
+    { 72, 198, 35793 },
+    { 205, 227, 35796 },
+    { 4, 79, 35800 },
+    { 95, 207, 35803 },
+    { 111, 157, 35804 },
+    { 122, 176, 35805 },
+    { 123, 188, 35809 },
+    { 14, 233, 35813 },
+    { 127, 223, 35814 },
+    { 3, 85, 35820 },
+    { 11, 114, 35820 },
+    { 174, 227, 35823 },
+    { 142, 214, 35824 },
+    { 4, 205, 35827 },
+    { 109, 196, 35829 },
+    { 91, 102, 35830 },
+    { 105, 249, 35830 },
+    { 68, 118, 35831 },
+    { 90, 120, 35834 },
+    { 0, 226, 35835 },
+    { 85, 156, 35839 },
+    { 5, 217, 35840 },
+    { 11, 245, 35843 },
+    { 105, 246, 35846 },
+    { 29, 74, 35848 },
+    { 169, 219, 35848 },
+    { 180, 217, 35853 },
+    { 15, 223, 35855 },
+    { 94, 178, 35856 },
+    { 81, 121, 35859 },
+    { 226, 248, 35862 },
+    { 31, 93, 35864 },
+    { 163, 227, 35868 },
+    { 73, 96, 35870 },
+    { 107, 128, 35872 },
+    { 108, 215, 35874 },
+    { 134, 163, 35875 },
+    { 2, 226, 35878 },
+    { 55, 106, 35878 },
+    { 157, 255, 35878 },
+    { 127, 246, 35882 },
+    { 171, 232, 35884 },
+    { 12, 232, 35886 },
+    { 20, 53, 35886 },
+    { 135, 206, 35887 },
+    { 40, 95, 35889 },
+    { 178, 217, 35889 },
+    { 34, 79, 35890 },
+    { 118, 175, 35892 },
+    { 76, 172, 35894 },
+    { 223, 254, 35894 },
+    { 125, 177, 35899 },
+    { 36, 106, 35900 },
+    { 198, 230, 35901 },
+    { 59, 179, 35902 },
+    { 60, 116, 35903 },
+    { 111, 173, 35903 },
+    { 48, 97, 35906 },
+    { 23, 112, 35907 },
+    { 57, 164, 35907 },
+    { 4, 208, 35908 },
+    { 142, 197, 35928 },
+    { 104, 213, 35929 },
+    { 169, 231, 35929 },
+    { 79, 149, 35930 },
+    { 118, 174, 35930 },
+    { 1, 241, 35940 },
+    { 3, 173, 35942 },
+    { 57, 80, 35944 },
+    { 81, 124, 35944 },
+    { 12, 208, 35949 },
+    { 69, 122, 35949 },
+    { 210, 252, 35952 },
+    { 99, 173, 35954 },
+    { 182, 243, 35959 },
+    { 222, 255, 35961 },
+    { 10, 52, 35962 },
+    { 106, 148, 35963 },
+    { 143, 145, 35968 },
+    { 44, 103, 35972 },
+    { 166, 244, 35972 },
+    { 146, 206, 35973 },
+    { 23, 96, 35978 },
+    { 50, 93, 35979 },
+    { 28, 239, 35980 },
+    { 134, 227, 35980 },
+    { 43, 179, 35981 },
+    { 72, 152, 35981 },
+    { 13, 195, 35985 },
+    { 52, 95, 35988 },
+    { 9, 77, 35989 },
+    { 184, 212, 35991 },
+    { 21, 76, 35992 },
+    { 22, 56, 35995 },
+    { 167, 226, 35996 },
+    { 95, 103, 35997 },
+    { 210, 251, 35997 },
+    { 7, 51, 36000 },
+    { 87, 204, 36005 },
+    { 24, 233, 36006 },
+    { 201, 251, 36011 },
+    { 18, 92, 36012 },
+    { 120, 235, 36013 },
+    { 70, 119, 36020 },
+    { 140, 206, 36023 },
+    { 9, 215, 36024 },
+    { 184, 205, 36025 },
+    { 169, 247, 36028 },
+    { 46, 240, 36029 },
+    { 118, 143, 36033 },
+    { 146, 214, 36034 },
+    { 138, 203, 36038 },
+    { 109, 135, 36040 },
+    { 71, 90, 36044 },
+    { 42, 96, 36045 },
+    { 99, 207, 36045 },
+    { 163, 179, 36051 },
+    { 142, 199, 36052 },
+    { 135, 165, 36055 },
+    { 37, 103, 36057 },
+    { 9, 204, 36058 },
+    { 42, 94, 36058 },
+    { 6, 229, 36060 },
+    { 4, 40, 36064 },
+    { 91, 140, 36064 },
+    { 179, 183, 36064 },
+    { 84, 160, 36068 },
+    { 4, 89, 36069 },
+    { 89, 192, 36071 },
+    { 208, 242, 36073 },
+    { 141, 195, 36076 },
+    { 79, 152, 36077 },
+    { 104, 196, 36079 },
+    { 118, 160, 36080 },
+    { 24, 237, 36081 },
+    { 115, 130, 36082 },
+    { 70, 89, 36083 },
+    { 151, 237, 36083 },
+    { 90, 142, 36084 },
+    { 71, 91, 36085 },
+    { 128, 188, 36085 },
+    { 36, 123, 36087 },
+    { 95, 205, 36088 },
+    { 207, 227, 36092 },
+    { 41, 109, 36097 },
+    { 15, 202, 36098 },
+    { 169, 205, 36100 },
+    { 157, 229, 36101 },
+    { 80, 84, 36102 },
+    { 98, 147, 36105 },
+    { 11, 195, 36108 },
+    { 118, 127, 36109 },
+    { 115, 162, 36110 },
+    { 44, 95, 36112 },
+    { 25, 140, 36116 },
+    { 78, 110, 36118 },
+    { 134, 176, 36118 },
+    { 9, 242, 36121 },
+    { 115, 120, 36122 },
+    { 15, 200, 36123 },
+    { 93, 162, 36125 },
+    { 131, 164, 36127 },
+    { 34, 101, 36129 },
+    { 142, 198, 36129 },
+    { 10, 252, 36132 },
+    { 20, 125, 36132 },
+    { 9, 147, 36133 },
+    { 155, 249, 36133 },
+    { 10, 42, 36136 },
+    { 89, 162, 36136 },
+    { 157, 167, 36139 },
+    { 30, 90, 36146 },
+    { 126, 208, 36146 },
+    { 43, 253, 36148 },
+    { 30, 123, 36152 },
+    { 48, 100, 36154 },
+    { 176, 234, 36155 },
+    { 156, 171, 36157 },
+    { 125, 176, 36158 },
+    { 219, 228, 36160 },
+    { 77, 164, 36161 },
+    { 19, 145, 36164 },
+    { 29, 90, 36167 },
+    { 32, 167, 36168 },
+    { 3, 63, 36169 },
+    { 17, 233, 36174 },
+    { 77, 139, 36174 },
+    { 109, 163, 36175 },
+    { 16, 179, 36177 },
+    { 90, 102, 36180 },
+    { 126, 140, 36180 },
+    { 116, 146, 36181 },
+    { 29, 112, 36182 },
+    { 203, 235, 36184 },
+    { 33, 146, 36186 },
+    { 168, 226, 36186 },
+    { 214, 254, 36190 },
+    { 137, 147, 36192 },
+    { 9, 74, 36195 },
+    { 190, 242, 36195 },
+    { 59, 136, 36196 },
+    { 197, 229, 36196 },
+    { 15, 167, 36198 },
+    { 2, 220, 36200 },
+    { 95, 249, 36200 },
+    { 5, 209, 36201 },
+    { 39, 253, 36201 },
+    { 72, 197, 36203 },
+    { 17, 88, 36207 },
+    { 141, 216, 36210 },
+    { 47, 117, 36214 },
+    { 213, 237, 36214 },
+    { 26, 233, 36217 },
+    { 191, 242, 36217 },
+    { 18, 165, 36223 },
+    { 11, 58, 36224 },
+    { 202, 245, 36224 },
+    { 55, 100, 36225 },
+    { 224, 250, 36231 },
+    { 52, 100, 36232 },
+    { 97, 159, 36233 },
+    { 164, 214, 36237 },
+    { 73, 124, 36243 },
+    { 26, 47, 36254 },
+    { 67, 139, 36254 },
+    { 231, 240, 36257 },
+    { 32, 58, 36259 },
+    { 197, 222, 36261 },
+    { 1, 64, 36264 },
+    { 44, 88, 36264 },
+    { 221, 233, 36264 },
+    { 74, 124, 36265 },
+    { 104, 244, 36268 },
+    { 46, 123, 36269 },
+    { 52, 106, 36271 },
+    { 43, 168, 36272 },
+    { 79, 138, 36273 },
+    { 151, 182, 36274 },
+    { 222, 234, 36275 },
+    { 8, 114, 36277 },
+    { 52, 99, 36277 },
+    { 45, 106, 36278 },
+    { 60, 239, 36278 },
+    { 73, 147, 36281 },
+    { 26, 38, 36284 },
+    { 56, 108, 36284 },
+    { 128, 211, 36286 },
+    { 132, 177, 36286 },
+    { 169, 238, 36288 },
+    { 202, 220, 36289 },
+    { 15, 55, 36292 },
+    { 99, 205, 36293 },
+    { 35, 101, 36296 },
+    { 31, 249, 36297 },
+    { 137, 187, 36298 },
+    { 35, 71, 36300 },
+    { 129, 135, 36301 },
+    { 118, 190, 36303 },
+    { 203, 250, 36303 },
+    { 130, 219, 36305 },
+    { 16, 251, 36311 },
+    { 111, 112, 36311 },
+    { 181, 255, 36313 },
+    { 117, 221, 36317 },
+    { 30, 119, 36322 },
+    { 196, 245, 36323 },
+    { 198, 251, 36323 },
+    { 126, 134, 36327 },
+    { 183, 233, 36328 },
+    { 94, 244, 36329 },
+    { 75, 128, 36330 },
+    { 122, 249, 36332 },
+    { 181, 201, 36332 },
+    { 213, 238, 36333 },
+    { 35, 100, 36334 },
+    { 86, 170, 36335 },
+    { 119, 193, 36336 },
+    { 165, 229, 36338 },
+    { 2, 46, 36339 },
+    { 122, 219, 36339 },
+    { 90, 138, 36340 },
+    { 174, 248, 36340 },
+    { 100, 142, 36344 },
+    { 149, 248, 36344 },
+    { 115, 184, 36345 },
+    { 68, 111, 36348 },
+    { 85, 153, 36349 },
+    { 144, 222, 36349 },
+    { 197, 251, 36350 },
+    { 85, 154, 36351 },
+    { 216, 228, 36352 },
+    { 132, 224, 36353 },
+    { 196, 242, 36356 },
+    { 182, 217, 36357 },
+    { 26, 238, 36358 },
+    { 124, 205, 36358 },
+    { 51, 94, 36359 },
+    { 138, 218, 36359 },
+    { 95, 200, 36360 },
+    { 23, 237, 36361 },
+    { 37, 250, 36361 },
+    { 10, 209, 36362 },
+    { 214, 248, 36366 },
+    { 92, 247, 36367 },
+    { 23, 190, 36368 },
+    { 121, 208, 36368 },
+    { 184, 242, 36368 },
+    { 6, 50, 36369 },
+    { 173, 246, 36372 },
+    { 0, 199, 36373 },
+    { 5, 158, 36374 },
+    { 111, 174, 36378 },
+    { 104, 131, 36379 },
+    { 173, 220, 36379 },
+    { 137, 196, 36382 },
+    { 138, 144, 36382 },
+    { 56, 110, 36385 },
+    { 40, 99, 36386 },
+    { 57, 156, 36390 },
+    { 150, 200, 36391 },
+    { 73, 143, 36393 },
+    { 135, 158, 36394 },
+    { 30, 101, 36395 },
+    { 15, 52, 36398 },
+    { 39, 140, 36403 },
+    { 119, 220, 36404 },
+    { 74, 116, 36407 },
+    { 94, 174, 36408 },
+    { 166, 249, 36409 },
+    { 143, 249, 36410 },
+    { 95, 173, 36414 },
+    { 85, 107, 36416 },
+    { 1, 80, 36422 },
+    { 7, 65, 36423 },
+    { 128, 181, 36424 },
+    { 16, 56, 36427 },
+    { 19, 34, 36430 },
+    { 98, 113, 36430 },
+    { 93, 142, 36431 },
+    { 27, 211, 36432 },
+    { 131, 192, 36433 },
+    { 23, 233, 36435 },
+    { 84, 161, 36435 },
+    { 33, 78, 36436 },
+    { 107, 184, 36436 },
+    { 1, 68, 36438 },
+    { 119, 236, 36440 },
+    { 115, 181, 36443 },
+    { 202, 251, 36443 },
+    { 75, 116, 36444 },
+    { 27, 213, 36447 },
+    { 67, 82, 36447 },
+    { 113, 233, 36449 },
+    { 122, 223, 36450 },
+    { 183, 241, 36450 },
+    { 108, 163, 36452 },
+    { 4, 216, 36455 },
+    { 7, 48, 36455 },
+    { 16, 41, 36455 },
+    { 4, 253, 36456 },
+    { 186, 227, 36459 },
+    { 95, 159, 36464 },
+    { 9, 219, 36466 },
+    { 90, 140, 36467 },
+    { 200, 220, 36472 },
+    { 9, 207, 36478 },
+    { 6, 230, 36480 },
+    { 109, 213, 36481 },
+    { 9, 35, 36483 },
+    { 44, 99, 36483 },
+    { 97, 135, 36483 },
+    { 11, 96, 36484 },
+    { 120, 145, 36484 },
+    { 136, 206, 36485 },
+    { 12, 55, 36491 },
+    { 99, 200, 36491 },
+    { 29, 57, 36492 },
+    { 83, 156, 36493 },
+    { 195, 215, 36495 },
+    { 18, 47, 36496 },
+    { 31, 251, 36497 },
+    { 196, 252, 36497 },
+    { 118, 155, 36500 },
+    { 62, 101, 36501 },
+    { 57, 60, 36505 },
+    { 83, 146, 36507 },
+    { 56, 104, 36508 },
+    { 27, 223, 36510 },
+    { 102, 215, 36512 },
+    { 34, 65, 36522 },
+    { 200, 245, 36522 },
+    { 6, 241, 36523 },
+    { 8, 107, 36523 },
+    { 26, 228, 36523 },
+    { 58, 87, 36523 },
+    { 94, 159, 36523 },
+    { 39, 190, 36525 },
+    { 59, 75, 36525 },
+    { 69, 125, 36526 },
+    { 71, 192, 36526 },
+    { 237, 244, 36527 },
+    { 99, 135, 36529 },
+    { 152, 246, 36529 },
+    { 128, 212, 36530 },
+    { 155, 181, 36531 },
+    { 143, 150, 36532 },
+    { 198, 229, 36533 },
+    { 12, 52, 36534 },
+    { 118, 173, 36534 },
+    { 150, 202, 36539 },
+    { 92, 209, 36544 },
+    { 138, 184, 36545 },
+    { 26, 101, 36549 },
+    { 169, 215, 36549 },
+    { 67, 103, 36550 },
+    { 4, 105, 36551 },
+    { 209, 241, 36553 },
+    { 229, 255, 36553 },
+    { 65, 128, 36555 },
+    { 106, 179, 36557 },
+    { 21, 72, 36559 },
+    { 72, 149, 36560 },
+    { 95, 235, 36563 },
+    { 37, 74, 36565 },
+    { 117, 216, 36570 },
+    { 136, 175, 36570 },
+    { 87, 141, 36571 },
+    { 17, 241, 36572 },
+    { 91, 109, 36572 },
+    { 95, 202, 36572 },
+    { 156, 214, 36573 },
+    { 161, 232, 36573 },
+    { 65, 152, 36574 },
+    { 4, 192, 36576 },
+    { 77, 153, 36576 },
+    { 117, 191, 36576 },
+    { 140, 237, 36576 },
+    { 87, 235, 36577 },
+    { 77, 154, 36579 },
+    { 12, 130, 36584 },
+    { 56, 106, 36584 },
+    { 180, 249, 36584 },
+    { 195, 241, 36584 },
+    { 71, 138, 36588 },
+    { 160, 232, 36588 },
+    { 26, 168, 36591 },
+    { 22, 81, 36599 },
+    { 31, 95, 36599 },
+    { 15, 48, 36600 },
+    { 23, 63, 36600 },
+    { 48, 106, 36600 },
+    { 81, 105, 36601 },
+    { 159, 234, 36602 },
+    { 26, 140, 36603 },
+    { 36, 85, 36604 },
+    { 182, 241, 36606 },
+    { 132, 176, 36608 },
+    { 87, 187, 36609 },
+    { 32, 204, 36612 },
+    { 4, 5, 36614 },
+    { 215, 217, 36614 },
+    { 40, 92, 36615 },
+    { 6, 144, 36619 },
+    { 57, 147, 36620 },
+    { 103, 158, 36623 },
+    { 95, 246, 36624 },
+    { 19, 66, 36625 },
+    { 204, 245, 36625 },
+    { 48, 95, 36626 },
+    { 129, 224, 36627 },
+    { 85, 92, 36636 },
+    { 10, 55, 36637 },
+    { 50, 71, 36639 },
+    { 34, 72, 36641 },
+    { 198, 222, 36641 },
+    { 39, 75, 36643 },
+    { 222, 246, 36643 },
+    { 27, 44, 36644 },
+    { 66, 123, 36644 },
+    { 32, 160, 36650 },
+    { 86, 106, 36650 },
+    { 187, 252, 36650 },
+    { 39, 62, 36655 },
+    { 223, 228, 36657 },
+    { 105, 215, 36659 },
+    { 103, 105, 36660 },
+    { 71, 126, 36664 },
+    { 189, 241, 36664 },
+    { 5, 40, 36666 },
+    { 140, 159, 36666 },
+    { 209, 232, 36666 },
+    { 144, 237, 36667 },
+    { 78, 123, 36668 },
+    { 4, 153, 36669 },
+    { 20, 29, 36669 },
+    { 4, 154, 36670 },
+    { 12, 48, 36674 },
+    { 0, 158, 36675 },
+    { 170, 222, 36675 },
+    { 1, 184, 36676 },
+    { 184, 207, 36677 },
+    { 33, 70, 36679 },
+    { 64, 72, 36685 },
+    { 218, 228, 36689 },
+    { 30, 190, 36691 },
+    { 17, 225, 36692 },
+    { 25, 49, 36694 },
+    { 130, 223, 36694 },
+    { 36, 103, 36695 },
+    { 139, 181, 36695 },
+    { 8, 45, 36703 },
+    { 70, 118, 36712 },
+    { 87, 162, 36712 },
+    { 193, 245, 36712 },
+    { 200, 251, 36712 },
+    { 99, 202, 36713 },
+    { 33, 98, 36714 },
+    { 29, 158, 36717 },
+    { 209, 245, 36717 },
+    { 8, 66, 36718 },
+    { 219, 254, 36722 },
+    { 12, 202, 36726 },
+    { 169, 192, 36726 },
+    { 227, 244, 36726 },
+    { 42, 102, 36730 },
+    { 31, 94, 36732 },
+    { 4, 108, 36737 },
+    { 56, 111, 36738 },
+    { 0, 53, 36740 },
+    { 42, 101, 36741 },
+    { 51, 102, 36743 },
+    { 16, 209, 36745 },
+    { 84, 131, 36745 },
+    { 214, 239, 36746 },
+    { 75, 143, 36747 },
+    { 186, 220, 36747 },
+    { 72, 246, 36749 },
+    { 32, 152, 36750 },
+    { 97, 186, 36750 },
+    { 124, 181, 36750 },
+    { 4, 211, 36752 },
+    { 38, 117, 36755 },
+    { 53, 72, 36755 },
+    { 113, 220, 36755 },
+    { 124, 207, 36756 },
+    { 118, 122, 36758 },
+    { 146, 246, 36759 },
+    { 18, 190, 36762 },
+    { 9, 133, 36763 },
+    { 7, 30, 36764 },
+    { 61, 72, 36765 },
+    { 40, 101, 36766 },
+    { 5, 165, 36767 },
+    { 120, 216, 36768 },
+    { 120, 171, 36770 },
+    { 0, 244, 36771 },
+    { 7, 45, 36775 },
+    { 12, 219, 36775 },
+    { 28, 90, 36776 },
+    { 41, 110, 36777 },
+    { 117, 218, 36777 },
+    { 12, 200, 36778 },
+    { 108, 211, 36778 },
+    { 96, 141, 36788 },
+    { 134, 177, 36788 },
+    { 127, 249, 36790 },
+    { 173, 244, 36796 },
+    { 168, 250, 36797 },
+    { 10, 220, 36799 },
+    { 30, 114, 36803 },
+    { 25, 209, 36804 },
+    { 123, 126, 36805 },
+    { 12, 85, 36808 },
+    { 72, 160, 36809 },
+    { 101, 179, 36809 },
+    { 7, 52, 36810 },
+    { 91, 130, 36810 },
+    { 85, 164, 36813 },
+    { 180, 243, 36817 },
+    { 67, 128, 36820 },
+    { 169, 207, 36822 },
+    { 36, 165, 36825 },
+    { 32, 192, 36827 },
+    { 46, 67, 36828 },
+    { 163, 231, 36831 },
+    { 139, 206, 36840 },
+    { 179, 210, 36840 },
+    { 221, 254, 36844 },
+    { 5, 61, 36846 },
+    { 69, 129, 36853 },
+    { 30, 236, 36857 },
+    { 155, 244, 36859 },
+    { 75, 147, 36860 },
+    { 84, 148, 36860 },
+    { 69, 116, 36864 },
+    { 131, 195, 36864 },
+    { 160, 249, 36864 },
+    { 0, 165, 36871 },
+    { 63, 122, 36875 },
+    { 88, 228, 36875 },
+    { 91, 145, 36876 },
+    { 45, 89, 36881 },
+    { 29, 225, 36888 },
+    { 36, 253, 36889 },
+    { 141, 214, 36889 },
+    { 142, 213, 36889 },
+    { 172, 188, 36891 },
+    { 114, 194, 36892 },
+    { 96, 128, 36894 },
+    { 112, 141, 36896 },
+    { 108, 196, 36899 },
+    { 103, 108, 36900 },
+    { 11, 70, 36904 },
+    { 77, 146, 36908 },
+    { 68, 158, 36909 },
+    { 170, 231, 36909 },
+    { 129, 177, 36912 },
+    { 97, 173, 36917 },
+    { 31, 97, 36918 },
+    { 114, 138, 36918 },
+    { 193, 243, 36927 },
+    { 48, 99, 36928 },
+    { 7, 56, 36929 },
+    { 64, 86, 36930 },
+    { 188, 240, 36931 },
+    { 71, 244, 36932 },
+    { 116, 152, 36938 },
+    { 177, 237, 36941 },
+    { 205, 220, 36941 },
+    { 43, 74, 36942 },
+    { 54, 130, 36943 },
+    { 9, 48, 36948 },
+    { 26, 237, 36949 },
+    { 118, 166, 36952 },
+    { 9, 52, 36953 },
+    { 124, 140, 36953 },
+    { 191, 249, 36954 },
+    { 73, 128, 36956 },
+    { 183, 237, 36960 },
+    { 73, 156, 36964 },
+    { 1, 35, 36967 },
+    { 161, 194, 36967 },
+    { 4, 86, 36968 },
+    { 82, 93, 36968 },
+    { 135, 192, 36970 },
+    { 124, 134, 36972 },
+    { 63, 120, 36980 },
+    { 157, 230, 36980 },
+    { 117, 183, 36981 },
+    { 4, 76, 36985 },
+    { 189, 230, 36985 },
+    { 160, 244, 36986 },
+    { 88, 236, 36988 },
+    { 9, 218, 36989 },
+    { 103, 149, 36992 },
+    { 112, 171, 36993 },
+    { 123, 203, 36995 },
+    { 54, 164, 36996 },
+    { 207, 242, 36997 },
+    { 83, 138, 37000 },
+    { 102, 175, 37002 },
+    { 9, 122, 37006 },
+    { 24, 228, 37008 },
+    { 158, 206, 37018 },
+    { 195, 202, 37019 },
+    { 45, 107, 37028 },
+    { 79, 101, 37030 },
+    { 90, 109, 37030 },
+    { 131, 203, 37030 },
+    { 176, 237, 37034 },
+    { 190, 231, 37034 },
+    { 10, 217, 37035 },
+    { 83, 131, 37036 },
+    { 32, 50, 37040 },
+    { 2, 222, 37042 },
+    { 206, 247, 37042 },
+    { 43, 250, 37044 },
+    { 71, 204, 37045 },
+    { 4, 99, 37046 },
+    { 46, 158, 37047 },
+    { 16, 112, 37050 },
+    { 9, 55, 37051 },
+    { 167, 194, 37056 },
+    { 98, 123, 37057 },
+    { 99, 142, 37060 },
+    { 81, 102, 37063 },
+    { 199, 254, 37064 },
+    { 69, 127, 37072 },
+    { 169, 212, 37073 },
+    { 12, 218, 37077 },
+    { 33, 251, 37077 },
+    { 10, 66, 37078 },
+    { 112, 236, 37079 },
+    { 119, 188, 37079 },
+    { 59, 83, 37081 },
+    { 72, 126, 37081 },
+    { 15, 219, 37083 },
+    { 67, 124, 37085 },
+    { 24, 63, 37087 },
+    { 103, 168, 37087 },
+    { 21, 245, 37095 },
+    { 141, 168, 37095 },
+    { 4, 117, 37096 },
+    { 163, 232, 37097 },
+    { 195, 200, 37097 },
+    { 185, 206, 37100 },
+    { 162, 232, 37101 },
+    { 145, 222, 37103 },
+    { 2, 19, 37106 },
+    { 15, 241, 37108 },
+    { 86, 131, 37108 },
+    { 29, 107, 37110 },
+    { 60, 225, 37113 },
+    { 4, 202, 37118 },
+    { 30, 91, 37119 },
+    { 49, 103, 37119 },
+    { 27, 55, 37124 },
+    { 9, 224, 37125 },
+    { 225, 245, 37126 },
+    { 191, 238, 37128 },
+    { 173, 227, 37129 },
+    { 209, 224, 37134 },
+    { 88, 169, 37141 },
+    { 116, 127, 37144 },
+    { 195, 208, 37145 },
+    { 83, 153, 37146 },
+    { 150, 211, 37146 },
+    { 220, 251, 37147 },
+    { 83, 154, 37148 },
+    { 94, 211, 37151 },
+    { 142, 212, 37151 },
+    { 79, 106, 37155 },
+    { 81, 123, 37156 },
+    { 34, 84, 37158 },
+    { 56, 109, 37158 },
+    { 86, 141, 37163 },
+    { 75, 126, 37166 },
+    { 32, 161, 37167 },
+    { 19, 254, 37170 },
+    { 97, 116, 37170 },
+    { 137, 154, 37174 },
+    { 86, 101, 37175 },
+    { 137, 153, 37176 },
+    { 205, 242, 37176 },
+    { 170, 184, 37177 },
+    { 54, 249, 37178 },
+    { 156, 232, 37183 },
+    { 31, 90, 37184 },
+    { 104, 221, 37187 },
+    { 125, 137, 37188 },
+    { 6, 45, 37190 },
+    { 9, 69, 37190 },
+    { 37, 179, 37191 },
+    { 191, 245, 37191 },
+    { 18, 100, 37192 },
+    { 33, 201, 37192 },
+    { 142, 165, 37195 },
+    { 171, 237, 37195 },
+    { 15, 187, 37197 },
+    { 15, 232, 37198 },
+    { 25, 199, 37201 },
+    { 171, 236, 37203 },
+    { 29, 91, 37204 },
+    { 150, 192, 37204 },
+    { 116, 181, 37207 },
+    { 214, 253, 37207 },
+    { 135, 199, 37210 },
+    { 29, 75, 37211 },
+    { 9, 205, 37214 },
+    { 73, 164, 37214 },
+    { 43, 144, 37215 },
+    { 49, 101, 37217 },
+    { 154, 206, 37220 },
+    { 101, 110, 37221 },
+    { 153, 206, 37223 },
+    { 161, 249, 37223 },
+    { 175, 199, 37223 },
+    { 97, 207, 37227 },
+    { 61, 86, 37231 },
+    { 84, 167, 37232 },
+    { 7, 55, 37233 },
+    { 155, 157, 37233 },
+    { 91, 144, 37236 },
+    { 194, 245, 37236 },
+    { 65, 160, 37238 },
+    { 89, 204, 37238 },
+    { 129, 176, 37238 },
+    { 51, 106, 37239 },
+    { 63, 125, 37239 },
+    { 111, 175, 37239 },
+    { 175, 248, 37239 },
+    { 124, 208, 37240 },
+    { 97, 142, 37241 },
+    { 243, 247, 37245 },
+    { 106, 120, 37246 },
+    { 151, 229, 37247 },
+    { 161, 244, 37247 },
+    { 77, 115, 37252 },
+    { 79, 160, 37252 },
+    { 27, 243, 37254 },
+    { 49, 117, 37257 },
+    { 128, 144, 37257 },
+    { 2, 12, 37258 },
+    { 53, 65, 37262 },
+    { 6, 7, 37263 },
+    { 12, 155, 37264 },
+    { 4, 200, 37266 },
+    { 63, 129, 37267 },
+    { 66, 118, 37268 },
+    { 169, 223, 37268 },
+    { 72, 161, 37269 },
+    { 15, 213, 37272 },
+    { 28, 77, 37279 },
+    { 98, 152, 37282 },
+    { 15, 218, 37285 },
+    { 57, 185, 37285 },
+    { 228, 251, 37285 },
+    { 247, 251, 37286 },
+    { 83, 92, 37287 },
+    { 123, 124, 37287 },
+    { 166, 184, 37287 },
+    { 83, 164, 37290 },
+    { 180, 241, 37293 },
+    { 95, 208, 37295 },
+    { 105, 163, 37296 },
+    { 87, 103, 37297 },
+    { 4, 125, 37298 },
+    { 15, 160, 37300 },
+    { 124, 188, 37303 },
+    { 230, 255, 37305 },
+    { 118, 195, 37306 },
+    { 45, 87, 37307 },
+    { 39, 250, 37310 },
+    { 127, 171, 37312 },
+    { 20, 110, 37314 },
+    { 69, 132, 37314 },
+    { 74, 128, 37314 },
+    { 206, 250, 37325 },
+    { 88, 195, 37326 },
+    { 72, 167, 37327 },
+    { 27, 218, 37332 },
+    { 133, 224, 37332 },
+    { 207, 220, 37332 },
+    { 188, 235, 37335 },
+    { 20, 156, 37338 },
+    { 165, 230, 37338 },
+    { 81, 108, 37339 },
+    { 173, 217, 37339 },
+    { 17, 82, 37341 },
+    { 63, 92, 37342 },
+    { 211, 237, 37344 },
+    { 12, 213, 37345 },
+    { 138, 194, 37345 },
+    { 131, 189, 37346 },
+    { 136, 174, 37349 },
+    { 57, 249, 37350 },
+    { 8, 229, 37353 },
+    { 14, 225, 37355 },
+    { 142, 216, 37355 },
+    { 172, 243, 37357 },
+    { 7, 71, 37361 },
+    { 10, 51, 37364 },
+    { 189, 222, 37364 },
+    { 89, 187, 37365 },
+    { 135, 172, 37365 },
+    { 133, 171, 37366 },
+    { 99, 182, 37370 },
+    { 20, 70, 37372 },
+    { 3, 162, 37380 },
+    { 3, 69, 37390 },
+    { 151, 196, 37391 },
+    { 42, 92, 37396 },
+    { 194, 201, 37404 },
+    { 51, 88, 37410 },
+    { 111, 185, 37410 },
+    { 26, 63, 37415 },
+    { 27, 52, 37417 },
+    { 70, 71, 37420 },
+    { 39, 73, 37421 },
+    { 17, 63, 37423 },
+    { 17, 243, 37424 },
+    { 224, 253, 37424 },
+    { 32, 139, 37430 },
+    { 154, 232, 37431 },
+    { 153, 232, 37433 },
+    { 160, 194, 37435 },
+    { 157, 211, 37437 },
+    { 33, 155, 37443 },
+    { 9, 192, 37450 },
+    { 149, 151, 37453 },
+    { 27, 219, 37456 },
+    { 107, 195, 37456 },
+    { 65, 124, 37457 },
+    { 65, 149, 37460 },
+    { 139, 235, 37463 },
+    { 103, 165, 37466 },
+    { 120, 218, 37467 },
+    { 9, 208, 37468 },
+    { 67, 249, 37470 },
+    { 97, 205, 37470 },
+    { 22, 41, 37471 },
+    { 3, 148, 37477 },
+    { 43, 115, 37479 },
+    { 174, 246, 37482 },
+    { 138, 219, 37488 },
+    { 206, 240, 37490 },
+    { 99, 174, 37492 },
+    { 195, 212, 37493 },
+    { 29, 73, 37494 },
+    { 81, 126, 37495 },
+    { 68, 86, 37496 },
+    { 91, 139, 37508 },
+    { 99, 249, 37510 },
+    { 125, 244, 37510 },
+    { 70, 87, 37511 },
+    { 99, 208, 37511 },
+    { 113, 171, 37512 },
+    { 184, 250, 37516 },
+    { 117, 223, 37518 },
+    { 96, 240, 37519 },
+    { 151, 226, 37521 },
+    { 84, 115, 37522 },
+    { 128, 215, 37524 },
+    { 187, 195, 37524 },
+    { 19, 116, 37525 },
+    { 161, 226, 37525 },
+    { 6, 222, 37526 },
+    { 155, 169, 37526 },
+    { 230, 248, 37526 },
+    { 183, 244, 37530 },
+    { 31, 99, 37533 },
+    { 178, 249, 37535 },
+    { 202, 242, 37536 },
+    { 99, 235, 37539 },
+    { 131, 200, 37540 },
+    { 147, 214, 37540 },
+    { 46, 247, 37542 },
+    { 12, 35, 37545 },
+    { 103, 127, 37546 },
+    { 157, 216, 37546 },
+    { 68, 140, 37547 },
+    { 44, 100, 37551 },
+    { 4, 97, 37552 },
+    { 116, 184, 37553 },
+    { 139, 193, 37553 },
+    { 14, 80, 37555 },
+    { 120, 221, 37557 },
+    { 96, 225, 37558 },
+    { 54, 156, 37559 },
+    { 249, 253, 37559 },
+    { 86, 116, 37563 },
+    { 107, 239, 37565 },
+    { 121, 144, 37566 },
+    { 163, 234, 37566 },
+    { 117, 219, 37567 },
+    { 59, 73, 37568 },
+    { 85, 135, 37569 },
+    { 189, 229, 37570 },
+    { 65, 167, 37571 },
+    { 49, 111, 37575 },
+    { 99, 178, 37575 },
+    { 59, 85, 37577 },
+    { 70, 123, 37578 },
+    { 6, 82, 37579 },
+    { 59, 62, 37580 },
+    { 23, 228, 37581 },
+    { 100, 195, 37584 },
+    { 184, 192, 37587 },
+    { 142, 215, 37589 },
+    { 183, 243, 37589 },
+    { 100, 184, 37590 },
+    { 166, 222, 37592 },
+    { 71, 148, 37594 },
+    { 146, 157, 37597 },
+    { 15, 245, 37600 },
+    { 79, 80, 37600 },
+    { 112, 126, 37601 },
+    { 169, 204, 37601 },
+    { 10, 179, 37603 },
+    { 105, 211, 37603 },
+    { 118, 133, 37603 },
+    { 64, 65, 37605 },
+    { 211, 238, 37605 },
+    { 157, 200, 37608 },
+    { 116, 122, 37611 },
+    { 186, 252, 37611 },
+    { 83, 107, 37612 },
+    { 61, 65, 37614 },
+    { 8, 96, 37615 },
+    { 164, 171, 37618 },
+    { 90, 130, 37619 },
+    { 136, 139, 37622 },
+    { 95, 182, 37623 },
+    { 103, 122, 37626 },
+    { 103, 159, 37626 },
+    { 3, 174, 37627 },
+    { 24, 107, 37629 },
+    { 37, 168, 37636 },
+    { 49, 96, 37642 },
+    { 154, 188, 37642 },
+    { 153, 188, 37645 },
+    { 174, 244, 37645 },
+    { 3, 241, 37646 },
+    { 5, 44, 37652 },
+    { 93, 248, 37654 },
+    { 97, 200, 37655 },
+    { 120, 150, 37655 },
+    { 13, 48, 37658 },
+    { 20, 122, 37660 },
+    { 21, 83, 37661 },
+    { 79, 161, 37661 },
+    { 110, 212, 37663 },
+    { 118, 188, 37663 },
+    { 159, 168, 37666 },
+    { 175, 209, 37669 },
+    { 169, 221, 37670 },
+    { 5, 64, 37673 },
+    { 91, 117, 37676 },
+    { 25, 101, 37677 },
+    { 87, 207, 37681 },
+    { 111, 151, 37681 },
+    { 138, 221, 37681 },
+    { 102, 211, 37689 },
+    { 111, 123, 37691 },
+    { 145, 200, 37695 },
+    { 16, 199, 37696 },
+    { 10, 199, 37698 },
+    { 89, 249, 37698 },
+    { 4, 147, 37699 },
+    { 5, 88, 37701 },
+    { 145, 228, 37701 },
+    { 168, 210, 37701 },
+    { 116, 190, 37704 },
+    { 12, 146, 37705 },
+    { 157, 202, 37706 },
+    { 1, 194, 37710 },
+    { 15, 170, 37711 },
+    { 53, 119, 37711 },
+    { 158, 229, 37712 },
+    { 65, 161, 37715 },
+    { 75, 156, 37716 },
+    { 82, 137, 37717 },
+    { 133, 210, 37719 },
+    { 135, 200, 37720 },
+    { 15, 211, 37729 },
+    { 99, 180, 37729 },
+    { 143, 188, 37732 },
+    { 93, 201, 37735 },
+    { 160, 226, 37743 },
+    { 5, 199, 37748 },
+    { 157, 237, 37750 },
+    { 90, 144, 37751 },
+    { 51, 105, 37752 },
+    { 74, 115, 37752 },
+    { 24, 123, 37753 },
+    { 70, 97, 37753 },
+    { 142, 209, 37753 },
+    { 213, 233, 37757 },
+    { 80, 168, 37762 },
+    { 150, 208, 37764 },
+    { 80, 240, 37766 },
+    { 139, 224, 37766 },
+    { 84, 141, 37769 },
+    { 63, 132, 37772 },
+    { 112, 124, 37772 },
+    { 108, 213, 37775 },
+    { 219, 236, 37775 },
+    { 47, 111, 37777 },
+    { 82, 86, 37780 },
+    { 105, 196, 37783 },
+    { 67, 155, 37784 },
+    { 99, 116, 37785 },
+    { 84, 118, 37795 },
+    { 106, 159, 37796 },
+    { 204, 227, 37797 },
+    { 27, 48, 37798 },
+    { 40, 94, 37798 },
+    { 62, 147, 37799 },
+    { 144, 175, 37799 },
+    { 57, 143, 37801 },
+    { 76, 155, 37801 },
+    { 178, 243, 37802 },
+    { 15, 161, 37803 },
+    { 131, 202, 37804 },
+    { 149, 194, 37807 },
+    { 131, 206, 37811 },
+    { 179, 231, 37811 },
+    { 138, 214, 37813 },
+    { 1, 114, 37814 },
+    { 119, 233, 37814 },
+    { 221, 228, 37814 },
+    { 1, 231, 37815 },
+    { 142, 158, 37817 },
+    { 25, 38, 37819 },
+    { 116, 143, 37820 },
+    { 9, 93, 37821 },
+    { 20, 172, 37824 },
+    { 90, 145, 37827 },
+    { 148, 235, 37829 },
+    { 150, 205, 37829 },
+    { 88, 135, 37830 },
+    { 23, 69, 37833 },
+    { 200, 242, 37834 },
+    { 106, 130, 37835 },
+    { 118, 183, 37835 },
+    { 6, 251, 37836 },
+    { 155, 232, 37837 },
+    { 8, 230, 37838 },
+    { 64, 134, 37838 },
+    { 212, 217, 37838 },
+    { 218, 254, 37838 },
+    { 2, 40, 37840 },
+    { 130, 210, 37840 },
+    { 131, 179, 37842 },
+    { 118, 199, 37846 },
+    { 39, 54, 37847 },
+    { 184, 204, 37849 },
+    { 32, 207, 37851 },
+    { 28, 91, 37853 },
+    { 142, 185, 37853 },
+    { 44, 106, 37854 },
+    { 85, 149, 37856 },
+    { 94, 213, 37856 },
+    { 99, 246, 37860 },
+    { 91, 94, 37862 },
+    { 145, 202, 37863 },
+    { 58, 97, 37864 },
+    { 71, 252, 37864 },
+    { 12, 167, 37870 },
+    { 79, 189, 37872 },
+    { 69, 115, 37873 },
+    { 187, 227, 37876 },
+    { 42, 103, 37877 },
+    { 54, 147, 37877 },
+    { 190, 254, 37878 },
+    { 68, 72, 37879 },
+    { 97, 202, 37880 },
+    { 5, 48, 37884 },
+    { 9, 213, 37884 },
+    { 31, 248, 37884 },
+    { 25, 47, 37885 },
+    { 78, 121, 37886 },
+    { 181, 242, 37888 },
+    { 76, 248, 37891 },
+    { 185, 251, 37892 },
+    { 62, 164, 37893 },
+    { 78, 124, 37893 },
+    { 81, 131, 37896 },
+    { 75, 115, 37899 },
+    { 69, 121, 37903 },
+    { 150, 216, 37904 },
+    { 57, 153, 37909 },
+    { 57, 154, 37912 },
+    { 26, 90, 37917 },
+    { 134, 237, 37917 },
+    { 117, 137, 37918 },
+    { 64, 111, 37921 },
+    { 50, 89, 37926 },
+    { 95, 135, 37930 },
+    { 97, 106, 37932 },
+    { 94, 175, 37935 },
+    { 95, 178, 37935 },
+    { 86, 234, 37937 },
+    { 128, 213, 37938 },
+    { 215, 238, 37938 },
+    { 0, 179, 37939 },
+    { 85, 141, 37940 },
+    { 188, 247, 37941 },
+    { 227, 252, 37944 },
+    { 22, 144, 37947 },
+    { 12, 211, 37948 },
+    { 91, 122, 37952 },
+    { 9, 127, 37957 },
+    { 156, 252, 37957 },
+    { 98, 155, 37961 },
+    { 175, 244, 37963 },
+    { 135, 202, 37966 },
+    { 42, 105, 37969 },
+    { 69, 133, 37973 },
+    { 73, 126, 37978 },
+    { 37, 75, 37980 },
+    { 188, 243, 37990 },
+    { 92, 169, 37991 },
+    { 95, 174, 37992 },
+    { 19, 118, 37993 },
+    { 84, 248, 37994 },
+    { 73, 116, 37995 },
+    { 93, 159, 37996 },
+    { 6, 66, 37998 },
+    { 72, 103, 37998 },
+    { 36, 225, 38001 },
+    { 15, 152, 38003 },
+    { 2, 217, 38006 },
+    { 146, 193, 38007 },
+    { 215, 237, 38010 },
+    { 165, 176, 38014 },
+    { 37, 62, 38015 },
+    { 65, 235, 38017 },
+    { 74, 126, 38018 },
+    { 93, 137, 38018 },
+    { 248, 254, 38020 },
+    { 8, 58, 38024 },
+    { 73, 153, 38024 },
+    { 140, 222, 38024 },
+    { 62, 156, 38025 },
+    { 64, 93, 38026 },
+    { 29, 101, 38027 },
+    { 73, 154, 38027 },
+    { 223, 236, 38028 },
+    { 32, 170, 38029 },
+    { 159, 235, 38030 },
+    { 66, 89, 38031 },
+    { 125, 224, 38031 },
+    { 190, 210, 38031 },
+    { 87, 205, 38035 },
+    { 214, 247, 38036 },
+    { 95, 180, 38037 },
+    { 201, 245, 38039 },
+    { 134, 159, 38040 },
+    { 246, 253, 38042 },
+    { 143, 214, 38043 },
+    { 139, 248, 38044 },
+    { 15, 35, 38047 },
+    { 193, 250, 38048 },
+    { 159, 217, 38049 },
+    { 185, 231, 38049 },
+    { 12, 224, 38050 },
+    { 39, 83, 38050 },
+    { 123, 163, 38050 },
+    { 192, 251, 38050 },
+    { 195, 205, 38051 },
+    { 33, 66, 38055 },
+    { 144, 148, 38056 },
+    { 29, 165, 38058 },
+    { 18, 20, 38062 },
+    { 175, 246, 38062 },
+    { 63, 127, 38063 },
+    { 68, 93, 38063 },
+    { 55, 94, 38064 },
+    { 240, 241, 38067 },
+    { 102, 142, 38069 },
+    { 104, 218, 38075 },
+    { 14, 88, 38084 },
+    { 19, 193, 38084 },
+    { 135, 164, 38084 },
+    { 47, 103, 38090 },
+    { 98, 150, 38095 },
+    { 97, 118, 38097 },
+    { 135, 190, 38100 },
+    { 75, 164, 38101 },
+    { 67, 80, 38102 },
+    { 20, 66, 38103 },
+    { 123, 227, 38108 },
+    { 7, 62, 38111 },
+    { 22, 242, 38113 },
+    { 62, 106, 38114 },
+    { 18, 113, 38117 },
+    { 141, 218, 38118 },
+    { 87, 131, 38120 },
+    { 119, 163, 38120 },
+    { 21, 79, 38123 },
+    { 14, 63, 38124 },
+    { 166, 231, 38125 },
+    { 26, 69, 38128 },
+    { 23, 242, 38129 },
+    { 74, 143, 38131 },
+    { 90, 94, 38136 },
+    { 111, 171, 38138 },
+    { 171, 185, 38139 },
+    { 38, 248, 38141 },
+    { 21, 249, 38143 },
+    { 194, 253, 38143 },
+    { 31, 91, 38150 },
+    { 28, 83, 38153 },
+    { 115, 199, 38156 },
+    { 79, 167, 38159 },
+    { 84, 189, 38159 },
+    { 94, 131, 38159 },
+    { 4, 250, 38161 },
+    { 196, 237, 38163 },
+    { 32, 166, 38164 },
+    { 34, 253, 38165 },
+    { 118, 170, 38166 },
+    { 12, 187, 38172 },
+    { 104, 163, 38182 },
+    { 34, 98, 38185 },
+    { 118, 194, 38185 },
+    { 13, 245, 38187 },
+    { 24, 179, 38191 },
+    { 145, 227, 38191 },
+    { 189, 251, 38195 },
+    { 232, 247, 38197 },
+    { 111, 144, 38198 },
+    { 119, 121, 38198 },
+    { 134, 206, 38202 },
+    { 4, 56, 38203 },
+    { 4, 73, 38204 },
+    { 19, 222, 38204 },
+    { 139, 214, 38204 },
+    { 142, 190, 38204 },
+    { 195, 245, 38206 },
+    { 15, 166, 38209 },
+    { 109, 221, 38210 },
+    { 178, 241, 38210 },
+    { 30, 134, 38213 },
+    { 60, 76, 38218 },
+    { 151, 230, 38218 },
+    { 163, 235, 38222 },
+    { 20, 133, 38225 },
+    { 136, 149, 38225 },
+    { 152, 194, 38225 },
+    { 101, 190, 38227 },
+    { 74, 92, 38229 },
+    { 199, 224, 38229 },
+    { 24, 69, 38230 },
+    { 10, 229, 38231 },
+    { 90, 117, 38231 },
+    { 5, 42, 38233 },
+    { 54, 185, 38234 },
+    { 58, 112, 38235 },
+    { 145, 192, 38235 },
+    { 87, 186, 38242 },
+    { 2, 53, 38243 },
+    { 51, 100, 38247 },
+    { 1, 251, 38250 },
+    { 107, 138, 38253 },
+    { 183, 190, 38254 },
+    { 92, 142, 38255 },
+    { 118, 167, 38256 },
+    { 193, 235, 38256 },
+    { 84, 96, 38257 },
+    { 144, 162, 38261 },
+    { 53, 86, 38262 },
+    { 104, 216, 38262 },
+    { 199, 232, 38262 },
+    { 10, 80, 38265 },
+    { 17, 54, 38265 },
+    { 10, 230, 38267 },
+    { 132, 210, 38271 },
+    { 58, 111, 38272 },
+    { 74, 147, 38272 },
+    { 133, 244, 38272 },
+    { 13, 52, 38273 },
+    { 47, 129, 38277 },
+    { 102, 135, 38277 },
+    { 24, 119, 38280 },
+    { 7, 25, 38282 },
+    { 36, 98, 38282 },
+    { 76, 116, 38282 },
+    { 114, 217, 38282 },
+    { 159, 199, 38284 },
+    { 13, 44, 38288 },
+    { 114, 247, 38288 },
+    { 11, 48, 38293 },
+    { 179, 242, 38294 },
+    { 40, 88, 38296 },
+    { 18, 78, 38299 },
+    { 60, 190, 38299 },
+    { 208, 217, 38299 },
+    { 88, 184, 38302 },
+    { 40, 103, 38303 },
+    { 76, 138, 38303 },
+    { 98, 153, 38308 },
+    { 98, 154, 38309 },
+    { 116, 176, 38310 },
+    { 31, 102, 38312 },
+    { 36, 250, 38315 },
+    { 4, 51, 38317 },
+    { 55, 102, 38317 },
+    { 81, 94, 38317 },
+    { 176, 236, 38317 },
+    { 14, 54, 38319 },
+    { 103, 109, 38322 },
+    { 137, 210, 38323 },
+    { 91, 127, 38325 },
+    { 34, 107, 38326 },
+    { 110, 196, 38332 },
+    { 187, 220, 38333 },
+    { 126, 211, 38335 },
+    { 72, 138, 38336 },
+    { 26, 209, 38340 },
+    { 135, 210, 38341 },
+    { 159, 220, 38343 },
+    { 82, 131, 38349 },
+    { 97, 249, 38349 },
+    { 43, 75, 38350 },
+    { 18, 241, 38353 },
+    { 58, 114, 38355 },
+    { 59, 77, 38355 },
+    { 95, 142, 38361 },
+    { 7, 237, 38362 },
+    { 150, 213, 38363 },
+    { 177, 236, 38364 },
+    { 102, 196, 38365 },
+    { 61, 134, 38372 },
+    { 227, 235, 38373 },
+    { 111, 134, 38375 },
+    { 5, 58, 38377 },
+    { 7, 223, 38378 },
+    { 104, 223, 38378 },
+    { 7, 67, 38381 },
+    { 94, 196, 38381 },
+    { 24, 242, 38385 },
+    { 2, 45, 38386 },
+    { 19, 70, 38388 },
+    { 55, 107, 38389 },
+    { 126, 193, 38390 },
+    { 62, 121, 38405 },
+    { 89, 246, 38406 },
+    { 139, 151, 38406 },
+    { 104, 142, 38407 },
+    { 64, 118, 38408 },
+    { 69, 107, 38408 },
+    { 167, 231, 38413 },
+    { 65, 201, 38419 },
+    { 111, 178, 38420 },
+    { 162, 248, 38420 },
+    { 157, 213, 38421 },
+    { 106, 190, 38422 },
+    { 120, 219, 38423 },
+    { 75, 139, 38425 },
+    { 97, 182, 38425 },
+    { 146, 249, 38426 },
+    { 38, 129, 38430 },
+    { 97, 174, 38432 },
+    { 196, 209, 38433 },
+    { 62, 143, 38434 },
+    { 103, 117, 38435 },
+    { 22, 101, 38436 },
+    { 8, 222, 38439 },
+    { 44, 94, 38441 },
+    { 69, 130, 38443 },
+    { 47, 101, 38444 },
+    { 39, 179, 38445 },
+    { 87, 200, 38451 },
+    { 35, 93, 38453 },
+    { 115, 146, 38456 },
+    { 143, 244, 38456 },
+    { 0, 9, 38461 },
+    { 32, 98, 38462 },
+    { 218, 236, 38463 },
+    { 185, 226, 38464 },
+    { 2, 59, 38473 },
+    { 68, 136, 38474 },
+    { 1, 107, 38476 },
+    { 216, 236, 38477 },
+    { 27, 216, 38478 },
+    { 90, 139, 38478 },
+    { 170, 230, 38479 },
+    { 140, 183, 38480 },
+    { 32, 205, 38481 },
+    { 79, 198, 38482 },
+    { 5, 232, 38486 },
+    { 89, 116, 38488 },
+    { 40, 102, 38491 },
+    { 84, 166, 38491 },
+    { 138, 223, 38491 },
+    { 61, 93, 38492 },
+    { 16, 49, 38493 },
+    { 68, 165, 38495 },
+    { 20, 245, 38497 },
+    { 4, 44, 38498 },
+    { 8, 184, 38499 },
+    { 20, 46, 38501 },
+    { 86, 201, 38501 },
+    { 199, 241, 38501 },
+    { 149, 184, 38502 },
+    { 22, 217, 38505 },
+    { 156, 206, 38505 },
+    { 143, 206, 38509 },
+    { 7, 26, 38514 },
+    { 9, 202, 38514 },
+    { 204, 242, 38514 },
+    { 95, 212, 38517 },
+    { 30, 74, 38519 },
+    { 36, 134, 38519 },
+    { 66, 255, 38527 },
+    { 7, 230, 38528 },
+    { 229, 248, 38528 },
+    { 14, 228, 38529 },
+    { 16, 38, 38534 },
+    { 27, 121, 38535 },
+    { 50, 87, 38538 },
+    { 135, 189, 38538 },
+    { 76, 96, 38540 },
+    { 78, 105, 38540 },
+    { 102, 213, 38540 },
+    { 126, 184, 38540 },
+    { 146, 181, 38540 },
+    { 52, 107, 38547 },
+    { 60, 144, 38550 },
+    { 165, 177, 38550 },
+    { 249, 250, 38553 },
+    { 99, 118, 38554 },
+    { 152, 249, 38556 },
+    { 60, 136, 38557 },
+    { 150, 207, 38557 },
+    { 5, 179, 38560 },
+    { 23, 107, 38561 },
+    { 1, 50, 38562 },
+    { 117, 177, 38562 },
+    { 119, 203, 38562 },
+    { 172, 226, 38564 },
+    { 42, 104, 38567 },
+    { 150, 226, 38567 },
+    { 5, 52, 38569 },
+    { 50, 112, 38569 },
+    { 91, 104, 38570 },
+    { 102, 103, 38572 },
+    { 186, 217, 38573 },
+    { 73, 139, 38574 },
+    { 7, 50, 38575 },
+    { 57, 103, 38577 },
+    { 7, 221, 38580 },
+    { 105, 213, 38580 },
+    { 52, 94, 38582 },
+    { 97, 178, 38585 },
+    { 7, 72, 38588 },
+    { 6, 114, 38589 },
+    { 112, 220, 38590 },
+    { 55, 111, 38592 },
+    { 121, 181, 38594 },
+    { 71, 207, 38599 },
+    { 16, 227, 38601 },
+    { 146, 203, 38605 },
+    { 46, 165, 38607 },
+    { 101, 255, 38607 },
+    { 15, 224, 38610 },
+    { 103, 169, 38610 },
+    { 209, 216, 38610 },
+    { 90, 122, 38611 },
+    { 27, 182, 38615 },
+    { 101, 169, 38615 },
+    { 225, 241, 38616 },
+    { 9, 200, 38623 },
+    { 46, 79, 38623 },
+    { 48, 107, 38624 },
+    { 167, 222, 38627 },
+    { 188, 245, 38629 },
+    { 121, 188, 38631 },
+    { 193, 255, 38633 },
+    { 62, 96, 38634 },
+    { 97, 235, 38634 },
+    { 202, 217, 38638 },
+    { 87, 202, 38640 },
+    { 71, 187, 38641 },
+    { 89, 106, 38642 },
+    { 76, 149, 38648 },
+    { 195, 207, 38649 },
+    { 131, 204, 38650 },
+    { 8, 241, 38652 },
+    { 146, 169, 38652 },
+    { 122, 171, 38653 },
+    { 123, 176, 38655 },
+    { 17, 228, 38657 },
+    { 26, 199, 38658 },
+    { 51, 108, 38660 },
+    { 196, 199, 38661 },
+    { 196, 228, 38661 },
+    { 16, 168, 38662 },
+    { 56, 88, 38662 },
+    { 53, 123, 38665 },
+    { 81, 128, 38667 },
+    { 116, 161, 38670 },
+    { 203, 253, 38672 },
+    { 136, 173, 38673 },
+    { 196, 251, 38673 },
+    { 1, 82, 38675 },
+    { 13, 136, 38677 },
+    { 75, 153, 38677 },
+    { 98, 134, 38677 },
+    { 213, 228, 38678 },
+    { 75, 154, 38679 },
+    { 161, 184, 38679 },
+    { 107, 181, 38682 },
+    { 28, 113, 38684 },
+    { 67, 126, 38685 },
+    { 39, 77, 38689 },
+    { 164, 206, 38689 },
+    { 4, 63, 38690 },
+    { 97, 208, 38690 },
+    { 183, 246, 38690 },
+    { 8, 70, 38692 },
+    { 51, 111, 38693 },
+    { 115, 176, 38694 },
+    { 4, 35, 38695 },
+    { 10, 41, 38696 },
+    { 33, 53, 38696 },
+    { 98, 156, 38700 },
+    { 104, 219, 38701 },
+    { 139, 203, 38701 },
+    { 58, 113, 38703 },
+    { 158, 230, 38703 },
+    { 80, 137, 38705 },
+    { 114, 163, 38707 },
+    { 118, 178, 38708 },
+    { 43, 62, 38709 },
+    { 120, 223, 38713 },
+    { 211, 233, 38714 },
+    { 5, 222, 38717 },
+    { 157, 208, 38717 },
+    { 82, 135, 38719 },
+    { 62, 248, 38723 },
+    { 127, 210, 38724 },
+    { 162, 229, 38724 },
+    { 81, 109, 38725 },
+    { 148, 195, 38725 },
+    { 191, 236, 38726 },
+    { 170, 229, 38727 },
+    { 1, 7, 38730 },
+    { 43, 136, 38731 },
+    { 174, 199, 38732 },
+    { 116, 133, 38736 },
+    { 77, 118, 38737 },
+    { 30, 62, 38739 },
+    { 64, 158, 38740 },
+    { 129, 210, 38740 },
+    { 0, 45, 38742 },
+    { 36, 76, 38742 },
+    { 152, 232, 38747 },
+    { 206, 246, 38749 },
+    { 127, 145, 38752 },
+    { 136, 247, 38753 },
+    { 199, 245, 38753 },
+    { 127, 224, 38754 },
+    { 20, 254, 38756 },
+    { 69, 100, 38757 },
+    { 97, 180, 38761 },
+    { 150, 204, 38761 },
+    { 27, 128, 38762 },
+    { 53, 115, 38763 },
+    { 164, 243, 38763 },
+    { 67, 234, 38764 },
+    { 89, 135, 38766 },
+    { 223, 250, 38766 },
+    { 37, 73, 38770 },
+    { 61, 111, 38772 },
+    { 50, 113, 38773 },
+    { 21, 247, 38776 },
+    { 131, 165, 38776 },
+    { 99, 106, 38777 },
+    { 102, 244, 38777 },
+    { 196, 233, 38777 },
+    { 97, 246, 38783 },
+    { 51, 104, 38784 },
+    { 117, 244, 38784 },
+    { 108, 116, 38785 },
+    { 17, 78, 38789 },
+    { 157, 247, 38789 },
+    { 38, 249, 38790 },
+    { 246, 250, 38790 },
+    { 162, 230, 38791 },
+    { 6, 58, 38792 },
+    { 9, 211, 38794 },
+    { 117, 176, 38794 },
+    { 119, 128, 38795 },
+    { 200, 217, 38795 },
+    { 106, 149, 38798 },
+    { 105, 116, 38801 },
+    { 39, 168, 38805 },
+    { 51, 110, 38805 },
+    { 12, 216, 38806 },
+    { 109, 216, 38808 },
+    { 145, 211, 38809 },
+    { 10, 70, 38812 },
+    { 26, 91, 38812 },
+    { 94, 221, 38815 },
+    { 131, 205, 38815 },
+    { 11, 44, 38816 },
+    { 117, 118, 38818 },
+    { 1, 226, 38820 },
+    { 13, 40, 38820 },
+    { 37, 144, 38820 },
+    { 147, 206, 38820 },
+    { 112, 233, 38821 },
+    { 41, 96, 38822 },
+    { 77, 185, 38823 },
+    { 16, 78, 38825 },
+    { 63, 133, 38827 },
+    { 13, 55, 38830 },
+    { 39, 57, 38838 },
+    { 7, 22, 38839 },
+    { 41, 101, 38839 },
+    { 23, 123, 38840 },
+    { 46, 134, 38845 },
+    { 168, 253, 38845 },
+    { 20, 61, 38846 },
+    { 109, 218, 38856 },
+    { 183, 238, 38856 },
+    { 181, 189, 38857 },
+    { 32, 212, 38859 },
+    { 99, 212, 38860 },
+    { 30, 54, 38861 },
+    { 6, 107, 38862 },
+    { 27, 148, 38863 },
+    { 131, 201, 38863 },
+    { 46, 84, 38867 },
+    { 47, 132, 38867 },
+    { 162, 231, 38867 },
+    { 147, 188, 38868 },
+    { 168, 191, 38868 },
+    { 79, 197, 38871 },
+    { 13, 151, 38873 },
+    { 42, 108, 38875 },
+    { 222, 249, 38875 },
+    { 52, 102, 38876 },
+    { 7, 224, 38881 },
+    { 159, 229, 38882 },
+    { 108, 118, 38884 },
+    { 144, 174, 38884 },
+    { 192, 245, 38885 },
+    { 39, 98, 38886 },
+    { 203, 234, 38887 },
+    { 109, 244, 38891 },
+    { 58, 95, 38892 },
+    { 15, 216, 38893 },
+    { 46, 115, 38893 },
+    { 44, 102, 38894 },
+    { 100, 124, 38894 },
+    { 20, 127, 38895 },
+    { 150, 240, 38895 },
+    { 179, 191, 38895 },
+    { 89, 186, 38897 },
+    { 3, 175, 38902 },
+    { 46, 239, 38902 },
+    { 39, 85, 38905 },
+    { 65, 126, 38906 },
+    { 126, 212, 38906 },
+    { 5, 9, 38907 },
+    { 103, 146, 38907 },
+    { 82, 168, 38910 },
+    { 78, 102, 38911 },
+    { 88, 217, 38917 },
+    { 58, 115, 38918 },
+    { 116, 160, 38918 },
+    { 176, 225, 38918 },
+    { 77, 138, 38919 },
+    { 85, 155, 38919 },
+    { 89, 159, 38922 },
+    { 28, 67, 38924 },
+    { 116, 177, 38929 },
+    { 11, 52, 38933 },
+    { 96, 169, 38935 },
+    { 70, 99, 38936 },
+    { 111, 189, 38936 },
+    { 73, 146, 38937 },
+    { 90, 104, 38937 },
+    { 9, 45, 38938 },
+    { 32, 149, 38938 },
+    { 9, 216, 38939 },
+    { 93, 96, 38941 },
+    { 163, 190, 38943 },
+    { 194, 243, 38943 },
+    { 89, 207, 38945 },
+    { 121, 211, 38946 },
+    { 61, 158, 38949 },
+    { 152, 244, 38949 },
+    { 47, 125, 38953 },
+    { 181, 197, 38954 },
+    { 4, 133, 38955 },
+    { 16, 241, 38961 },
+    { 235, 238, 38964 },
+    { 59, 118, 38968 },
+    { 177, 241, 38970 },
+    { 58, 99, 38971 },
+    { 65, 68, 38974 },
+    { 19, 203, 38977 },
+    { 172, 231, 38980 },
+    { 204, 220, 38980 },
+    { 203, 255, 38986 },
+    { 16, 217, 38987 },
+    { 0, 50, 38988 },
+    { 185, 241, 38990 },
+    { 84, 198, 38991 },
+    { 192, 227, 38991 },
+    { 113, 141, 38993 },
+    { 89, 235, 38994 },
+    { 99, 175, 38994 },
+    { 31, 254, 38995 },
+    { 72, 166, 38998 },
+    { 111, 113, 38998 },
+    { 39, 115, 39004 },
+    { 157, 205, 39004 },
+    { 115, 152, 39007 },
+    { 118, 125, 39007 },
+    { 157, 192, 39007 },
+    { 56, 100, 39010 },
+    { 110, 215, 39010 },
+    { 32, 81, 39013 },
+    { 10, 231, 39015 },
+    { 79, 116, 39019 },
+    { 15, 186, 39023 },
+    { 90, 127, 39024 },
+    { 37, 115, 39027 },
+    { 115, 195, 39027 },
+    { 16, 123, 39029 },
+    { 116, 155, 39036 },
+    { 105, 118, 39037 },
+    { 76, 152, 39039 },
+    { 131, 158, 39042 },
+    { 43, 98, 39044 },
+    { 128, 210, 39044 },
+    { 47, 96, 39045 },
+    { 38, 132, 39047 },
+    { 22, 49, 39049 },
+    { 5, 20, 39051 },
+    { 138, 140, 39052 },
+    { 121, 212, 39057 },
+    { 131, 197, 39058 },
+    { 135, 205, 39059 },
+    { 3, 42, 39061 },
+    { 12, 14, 39063 },
+    { 72, 201, 39068 },
+    { 1, 151, 39070 },
+    { 41, 117, 39075 },
+    { 196, 238, 39076 },
+    { 71, 205, 39078 },
+    { 57, 172, 39079 },
+    { 21, 255, 39088 },
+    { 125, 210, 39088 },
+    { 43, 236, 39093 },
+    { 232, 239, 39093 },
+    { 173, 249, 39094 },
+    { 238, 246, 39095 },
+    { 2, 42, 39096 },
+    { 135, 209, 39096 },
+    { 47, 122, 39102 },
+    { 128, 193, 39102 },
+    { 12, 160, 39105 },
+    { 183, 236, 39105 },
+    { 135, 204, 39110 },
+    { 58, 116, 39111 },
+    { 137, 156, 39118 },
+    { 54, 153, 39119 },
+    { 54, 154, 39121 },
+    { 6, 184, 39122 },
+    { 2, 60, 39123 },
+    { 104, 135, 39127 },
+    { 159, 230, 39127 },
+    { 85, 100, 39129 },
+    { 74, 156, 39132 },
+    { 11, 229, 39133 },
+    { 69, 124, 39135 },
+    { 41, 103, 39136 },
+    { 145, 205, 39137 },
+    { 54, 143, 39138 },
+    { 137, 217, 39138 },
+    { 81, 136, 39139 },
+    { 111, 140, 39139 },
+    { 184, 241, 39141 },
+    { 11, 40, 39142 },
+    { 79, 148, 39142 },
+    { 9, 231, 39147 },
+    { 80, 93, 39147 },
+    { 100, 126, 39149 },
+    { 118, 193, 39150 },
+    { 75, 146, 39158 },
+    { 2, 50, 39159 },
+    { 102, 163, 39165 },
+    { 145, 208, 39165 },
+    { 5, 68, 39166 },
+    { 48, 94, 39166 },
+    { 19, 103, 39167 },
+    { 30, 179, 39168 },
+    { 131, 198, 39176 },
+    { 108, 137, 39177 },
+    { 160, 184, 39178 },
+    { 167, 184, 39181 },
+    { 66, 71, 39184 },
+    { 165, 226, 39184 },
+    { 37, 54, 39185 },
+    { 23, 179, 39188 },
+    { 174, 209, 39191 },
+    { 172, 203, 39192 },
+    { 177, 238, 39197 },
+    { 12, 45, 39200 },
+    { 0, 249, 39201 },
+    { 88, 131, 39201 },
+    { 25, 63, 39202 },
+    { 55, 105, 39204 },
+    { 144, 214, 39205 },
+    { 70, 95, 39206 },
+    { 5, 244, 39207 },
+    { 95, 116, 39207 },
+    { 6, 231, 39208 },
+    { 45, 97, 39208 },
+    { 185, 188, 39209 },
+    { 20, 36, 39210 },
+    { 87, 208, 39211 },
+    { 80, 190, 39213 },
+    { 14, 82, 39218 },
+    { 20, 198, 39219 },
+    { 141, 219, 39223 },
+    { 31, 246, 39224 },
+    { 221, 236, 39224 },
+    { 43, 73, 39226 },
+    { 103, 133, 39228 },
+    { 23, 245, 39229 },
+    { 137, 192, 39229 },
+    { 111, 180, 39234 },
+    { 35, 103, 39236 },
+    { 37, 236, 39236 },
+    { 89, 205, 39239 },
+    { 130, 246, 39240 },
+    { 52, 111, 39241 },
+    { 219, 250, 39241 },
+    { 3, 56, 39242 },
+    { 75, 92, 39242 },
+    { 5, 55, 39247 },
+    { 65, 252, 39248 },
+    { 5, 226, 39250 },
+    { 4, 84, 39252 },
+    { 78, 134, 39253 },
+    { 156, 188, 39253 },
+    { 203, 244, 39262 },
+    { 20, 78, 39263 },
+    { 181, 241, 39264 },
+    { 183, 248, 39264 },
+    { 35, 89, 39265 },
+    { 50, 114, 39265 },
+    { 77, 172, 39265 },
+    { 84, 170, 39265 },
+    { 177, 225, 39265 },
+    { 43, 116, 39274 },
+    { 12, 170, 39277 },
+    { 210, 225, 39277 },
+    { 4, 10, 39278 },
+    { 116, 117, 39281 },
+    { 27, 111, 39282 },
+    { 67, 246, 39284 },
+    { 93, 192, 39285 },
+    { 212, 238, 39287 },
+    { 54, 103, 39288 },
+    { 78, 108, 39295 },
+    { 60, 168, 39297 },
+    { 28, 76, 39298 },
+    { 20, 81, 39303 },
+    { 35, 87, 39305 },
+    { 67, 189, 39313 },
+    { 233, 252, 39313 },
+    { 107, 171, 39314 },
+    { 21, 27, 39316 },
+    { 113, 193, 39316 },
+    { 188, 234, 39318 },
+    { 197, 245, 39318 },
+    { 216, 254, 39321 },
+    { 32, 208, 39323 },
+    { 31, 104, 39325 },
+    { 61, 118, 39325 },
+    { 15, 45, 39328 },
+    { 37, 83, 39329 },
+    { 65, 166, 39329 },
+    { 62, 153, 39332 },
+    { 119, 176, 39332 },
+    { 123, 177, 39332 },
+    { 114, 159, 39333 },
+    { 62, 154, 39334 },
+    { 106, 163, 39336 },
+    { 25, 144, 39338 },
+    { 115, 177, 39340 },
+    { 159, 209, 39342 },
+    { 21, 71, 39344 },
+    { 7, 11, 39345 },
+    { 91, 150, 39347 },
+    { 20, 147, 39352 },
+    { 3, 191, 39353 },
+    { 23, 119, 39353 },
+    { 176, 238, 39353 },
+    { 84, 197, 39355 },
+    { 66, 134, 39356 },
+    { 7, 229, 39360 },
+    { 16, 47, 39362 },
+    { 136, 236, 39362 },
+    { 34, 113, 39366 },
+    { 181, 198, 39368 },
+    { 199, 216, 39368 },
+    { 130, 224, 39370 },
+    { 212, 237, 39372 },
+    { 7, 8, 39374 },
+    { 131, 207, 39377 },
+    { 110, 211, 39379 },
+    { 30, 238, 39384 },
+    { 109, 191, 39385 },
+    { 20, 153, 39392 },
+    { 78, 136, 39392 },
+    { 20, 154, 39394 },
+    { 38, 125, 39396 },
+    { 89, 173, 39397 },
+    { 145, 147, 39397 },
+    { 98, 160, 39403 },
+    { 131, 208, 39404 },
+    { 205, 217, 39404 },
+    { 85, 152, 39406 },
+    { 20, 64, 39407 },
+    { 142, 218, 39409 },
+    { 83, 149, 39410 },
+    { 67, 152, 39412 },
+    { 81, 135, 39412 },
+    { 109, 223, 39412 },
+    { 78, 126, 39416 },
+    { 9, 34, 39417 },
+    { 128, 216, 39417 },
+    { 42, 88, 39419 },
+    { 72, 170, 39422 },
+    { 66, 87, 39423 },
+    { 101, 139, 39423 },
+    { 211, 228, 39424 },
+    { 18, 252, 39425 },
+    { 32, 243, 39425 },
+    { 87, 173, 39425 },
+    { 209, 219, 39425 },
+    { 17, 69, 39429 },
+    { 43, 83, 39429 },
+    { 98, 159, 39432 },
+    { 198, 245, 39432 },
+    { 2, 235, 39434 },
+    { 94, 252, 39435 },
+    { 131, 185, 39437 },
+    { 92, 124, 39441 },
+    { 123, 237, 39441 },
+    { 125, 171, 39445 },
+    { 2, 44, 39446 },
+    { 2, 248, 39448 },
+    { 158, 176, 39450 },
+    { 122, 224, 39454 },
+    { 29, 77, 39455 },
+    { 239, 243, 39455 },
+    { 1, 45, 39457 },
+    { 86, 118, 39457 },
+    { 4, 122, 39460 },
+    { 49, 129, 39468 },
+    { 144, 191, 39469 },
+    { 210, 250, 39469 },
+    { 151, 238, 39470 },
+    { 195, 254, 39471 },
+    { 150, 233, 39472 },
+    { 153, 252, 39473 },
+    { 120, 246, 39474 },
+    { 154, 252, 39474 },
+    { 97, 101, 39475 },
+    { 98, 161, 39475 },
+    { 80, 179, 39479 },
+    { 78, 131, 39483 },
+    { 159, 232, 39487 },
+    { 245, 255, 39491 },
+    { 33, 111, 39492 },
+    { 73, 115, 39494 },
+    { 48, 102, 39495 },
+    { 21, 242, 39497 },
+    { 24, 134, 39501 },
+    { 34, 254, 39505 },
+    { 88, 233, 39506 },
+    { 95, 175, 39506 },
+    { 176, 241, 39506 },
+    { 74, 164, 39507 },
+    { 51, 109, 39511 },
+    { 183, 242, 39512 },
+    { 11, 55, 39520 },
+    { 119, 138, 39520 },
+    { 128, 140, 39520 },
+    { 37, 254, 39521 },
+    { 25, 90, 39525 },
+    { 89, 200, 39525 },
+    { 54, 246, 39526 },
+    { 32, 200, 39527 },
+    { 135, 208, 39531 },
+    { 16, 220, 39532 },
+    { 8, 151, 39535 },
+    { 12, 254, 39535 },
+    { 9, 83, 39539 },
+    { 65, 244, 39539 },
+    { 27, 180, 39545 },
+    { 32, 34, 39549 },
+    { 206, 253, 39551 },
+    { 85, 148, 39553 },
+    { 29, 236, 39554 },
+    { 132, 137, 39559 },
+    { 33, 167, 39563 },
+    { 121, 134, 39566 },
+    { 124, 211, 39568 },
+    { 121, 140, 39570 },
+    { 166, 230, 39574 },
+    { 54, 59, 39575 },
+    { 7, 36, 39577 },
+    { 32, 202, 39577 },
+    { 73, 185, 39577 },
+    { 137, 200, 39578 },
+    { 157, 218, 39578 },
+    { 109, 219, 39580 },
+    { 20, 23, 39581 },
+    { 60, 118, 39582 },
+    { 142, 217, 39586 },
+    { 63, 116, 39587 },
+    { 13, 184, 39591 },
+    { 53, 116, 39593 },
+    { 20, 197, 39597 },
+    { 234, 254, 39597 },
+    { 32, 187, 39598 },
+    { 42, 109, 39599 },
+    { 12, 161, 39600 },
+    { 108, 221, 39600 },
+    { 57, 246, 39604 },
+    { 79, 166, 39604 },
+    { 105, 137, 39606 },
+    { 168, 175, 39606 },
+    { 11, 230, 39607 },
+    { 209, 218, 39609 },
+    { 24, 114, 39610 },
+    { 97, 115, 39613 },
+    { 152, 184, 39613 },
+    { 9, 110, 39616 },
+    { 131, 210, 39625 },
+    { 3, 138, 39628 },
+    { 34, 247, 39629 },
+    { 79, 234, 39631 },
+    { 67, 198, 39632 },
+    { 3, 245, 39634 },
+    { 136, 227, 39634 },
+    { 42, 110, 39635 },
+    { 152, 226, 39636 },
+    { 133, 145, 39637 },
+    { 25, 242, 39638 },
+    { 147, 232, 39641 },
+    { 21, 85, 39649 },
+    { 65, 170, 39651 },
+    { 115, 127, 39651 },
+    { 134, 138, 39654 },
+    { 84, 135, 39658 },
+    { 74, 139, 39659 },
+    { 83, 135, 39660 },
+    { 172, 193, 39664 },
+    { 110, 235, 39665 },
+    { 135, 207, 39668 },
+    { 10, 113, 39669 },
+    { 3, 128, 39670 },
+    { 81, 134, 39672 },
+    { 151, 186, 39673 },
+    { 103, 143, 39674 },
+    { 119, 159, 39675 },
+    { 178, 199, 39677 },
+    { 33, 139, 39678 },
+    { 140, 238, 39680 },
+    { 135, 201, 39681 },
+    { 27, 224, 39686 },
+    { 127, 150, 39686 },
+    { 60, 179, 39688 },
+    { 138, 234, 39691 },
+    { 24, 245, 39693 },
+    { 72, 235, 39694 },
+    { 0, 40, 39695 },
+    { 17, 57, 39697 },
+    { 67, 149, 39705 },
+    { 85, 172, 39708 },
+    { 93, 234, 39719 },
+    { 28, 85, 39720 },
+    { 10, 92, 39721 },
+    { 66, 97, 39721 },
+    { 118, 180, 39722 },
+    { 215, 233, 39724 },
+    { 106, 171, 39727 },
+    { 39, 144, 39728 },
+    { 128, 134, 39733 },
+    { 40, 105, 39734 },
+    { 10, 56, 39736 },
+    { 89, 202, 39736 },
+    { 157, 207, 39739 },
+    { 206, 254, 39739 },
+    { 111, 182, 39740 },
+    { 62, 185, 39744 },
+    { 89, 118, 39745 },
+    { 161, 222, 39746 },
+    { 122, 244, 39747 },
+    { 75, 118, 39749 },
+    { 89, 142, 39750 },
+    { 5, 51, 39752 },
+    { 59, 253, 39753 },
+    { 14, 57, 39755 },
+    { 86, 115, 39759 },
+    { 38, 122, 39764 },
+    { 19, 229, 39766 },
+    { 71, 200, 39766 },
+    { 30, 140, 39767 },
+    { 4, 187, 39768 },
+    { 110, 145, 39774 },
+    { 223, 253, 39774 },
+    { 19, 50, 39777 },
+    { 27, 196, 39777 },
+    { 155, 226, 39777 },
+    { 1, 66, 39778 },
+    { 2, 15, 39778 },
+    { 13, 78, 39778 },
+    { 63, 130, 39778 },
+    { 9, 143, 39779 },
+    { 37, 98, 39779 },
+    { 114, 228, 39779 },
+    { 145, 216, 39783 },
+    { 206, 251, 39784 },
+    { 122, 210, 39785 },
+    { 129, 252, 39786 },
+    { 89, 101, 39787 },
+    { 80, 131, 39788 },
+    { 33, 152, 39789 },
+    { 136, 233, 39793 },
+    { 52, 105, 39794 },
+    { 103, 163, 39794 },
+    { 166, 229, 39794 },
+    { 72, 82, 39795 },
+    { 203, 254, 39795 },
+    { 65, 138, 39797 },
+    { 147, 150, 39798 },
+    { 137, 202, 39802 },
+    { 191, 252, 39803 },
+    { 80, 86, 39807 },
+    { 7, 219, 39808 },
+    { 126, 215, 39809 },
+    { 141, 221, 39812 },
+    { 27, 173, 39814 },
+    { 81, 104, 39814 },
+    { 214, 240, 39823 },
+    { 91, 125, 39824 },
+    { 116, 174, 39825 },
+    { 146, 244, 39825 },
+    { 103, 125, 39826 },
+    { 9, 28, 39827 },
+    { 121, 123, 39830 },
+    { 27, 138, 39831 },
+    { 32, 111, 39832 },
+    { 118, 147, 39833 },
+    { 150, 229, 39834 },
+    { 40, 100, 39840 },
+    { 74, 118, 39841 },
+    { 28, 112, 39844 },
+    { 32, 215, 39847 },
+    { 67, 101, 39848 },
+    { 16, 96, 39849 },
+    { 82, 124, 39849 },
+    { 150, 215, 39850 },
+    { 82, 240, 39854 },
+    { 94, 218, 39854 },
+    { 145, 207, 39855 },
+    { 30, 233, 39856 },
+    { 207, 217, 39856 },
+    { 18, 179, 39857 },
+    { 210, 254, 39857 },
+    { 12, 166, 39860 },
+    { 19, 137, 39861 },
+    { 34, 86, 39862 },
+    { 238, 249, 39863 },
+    { 95, 215, 39866 },
+    { 159, 179, 39868 },
+    { 4, 75, 39869 },
+    { 9, 253, 39872 },
+    { 48, 111, 39872 },
+    { 116, 175, 39872 },
+    { 33, 160, 39873 },
+    { 26, 144, 39874 },
+    { 221, 250, 39875 },
+    { 6, 96, 39876 },
+    { 87, 159, 39876 },
+    { 145, 154, 39876 },
+    { 145, 153, 39878 },
+    { 151, 166, 39878 },
+    { 192, 220, 39880 },
+    { 36, 67, 39881 },
+    { 7, 63, 39887 },
+    { 28, 33, 39888 },
+    { 55, 110, 39888 },
+    { 92, 126, 39892 },
+    { 11, 31, 39893 },
+    { 116, 125, 39893 },
+    { 29, 83, 39898 },
+    { 0, 20, 39900 },
+    { 32, 78, 39900 },
+    { 118, 209, 39901 },
+    { 4, 48, 39902 },
+    { 112, 193, 39902 },
+    { 96, 199, 39903 },
+    { 109, 137, 39904 },
+    { 71, 202, 39905 },
+    { 11, 184, 39909 },
+    { 34, 112, 39910 },
+    { 122, 145, 39910 },
+    { 144, 238, 39912 },
+    { 30, 75, 39916 },
+    { 102, 221, 39918 },
+    { 83, 100, 39923 },
+    { 145, 204, 39924 },
+    { 97, 175, 39926 },
+    { 109, 183, 39928 },
+    { 180, 199, 39929 },
+    { 0, 88, 39930 },
+    { 150, 212, 39931 },
+    { 29, 123, 39932 },
+    { 91, 133, 39932 },
+    { 12, 152, 39934 },
+    { 8, 194, 39935 },
+    { 127, 244, 39940 },
+    { 34, 240, 39941 },
+    { 49, 106, 39941 },
+    { 44, 105, 39943 },
+    { 178, 209, 39944 },
+    { 138, 224, 39948 },
+    { 19, 242, 39949 },
+    { 123, 159, 39950 },
+    { 12, 186, 39952 },
+    { 25, 69, 39952 },
+    { 81, 137, 39960 },
+    { 126, 210, 39960 },
+    { 6, 70, 39962 },
+    { 10, 20, 39962 },
+    { 29, 119, 39965 },
+    { 80, 135, 39966 },
+    { 83, 141, 39966 },
+    { 136, 178, 39970 },
+    { 53, 240, 39975 },
+    { 4, 52, 39979 },
+    { 104, 191, 39980 },
+    { 124, 212, 39981 },
+    { 29, 114, 39984 },
+    { 74, 107, 39984 },
+    { 164, 188, 39984 },
+    { 195, 204, 39984 },
+    { 45, 95, 39987 },
+    { 109, 118, 39987 },
+    { 94, 223, 39990 },
+    { 150, 239, 39993 },
+    { 64, 140, 39995 },
+    { 158, 177, 39997 },
+    { 68, 240, 39998 },
+    { 16, 119, 40002 },
+    { 126, 213, 40002 },
+    { 18, 63, 40003 },
+    { 23, 251, 40004 },
+    { 85, 137, 40004 },
+    { 11, 241, 40006 },
+    { 27, 178, 40006 },
+    { 85, 185, 40006 },
+    { 95, 118, 40007 },
+    { 24, 168, 40009 },
+    { 171, 238, 40009 },
+    { 93, 187, 40010 },
+    { 104, 252, 40012 },
+    { 86, 249, 40013 },
+    { 155, 194, 40014 },
+    { 81, 120, 40015 },
+    { 37, 77, 40016 },
+    { 184, 253, 40016 },
+    { 56, 117, 40018 },
+    { 150, 218, 40020 },
+    { 22, 220, 40021 },
+    { 119, 177, 40021 },
+    { 77, 131, 40023 },
+    { 109, 116, 40025 },
+    { 192, 195, 40025 },
+    { 44, 107, 40027 },
+    { 20, 241, 40028 },
+    { 49, 125, 40030 },
+    { 116, 166, 40033 },
+    { 50, 255, 40037 },
+    { 157, 224, 40042 },
+    { 67, 197, 40043 },
+    { 8, 48, 40044 },
+    { 49, 132, 40047 },
+    { 3, 121, 40049 },
+    { 97, 212, 40051 },
+    { 46, 116, 40052 },
+    { 160, 222, 40052 },
+    { 145, 240, 40055 },
+    { 78, 94, 40056 },
+    { 113, 126, 40057 },
+    { 13, 101, 40059 },
+    { 134, 222, 40060 },
+    { 165, 214, 40060 },
+    { 30, 57, 40063 },
+    { 41, 111, 40064 },
+    { 34, 103, 40066 },
+    { 2, 48, 40068 },
+    { 47, 120, 40069 },
+    { 42, 106, 40072 },
+    { 36, 254, 40081 },
+    { 86, 135, 40081 },
+    { 95, 106, 40082 },
+    { 175, 241, 40082 },
+    { 49, 122, 40084 },
+    { 150, 154, 40085 },
+    { 150, 153, 40087 },
+    { 1, 96, 40088 },
+    { 28, 101, 40089 },
+    { 76, 115, 40090 },
+    { 121, 215, 40090 },
+    { 74, 153, 40093 },
+    { 74, 154, 40095 },
+    { 108, 216, 40097 },
+    { 132, 252, 40099 },
+    { 145, 213, 40099 },
+    { 79, 249, 40102 },
+    { 99, 163, 40104 },
+    { 128, 206, 40107 },
+    { 129, 137, 40108 },
+    { 55, 108, 40109 },
+    { 100, 141, 40112 },
+    { 27, 162, 40113 },
+    { 77, 92, 40118 },
+    { 86, 162, 40118 },
+    { 83, 155, 40119 },
+    { 22, 38, 40120 },
+    { 43, 54, 40120 },
+    { 126, 206, 40120 },
+    { 180, 209, 40124 },
+    { 35, 107, 40126 },
+    { 69, 88, 40130 },
+    { 43, 85, 40132 },
+    { 18, 209, 40133 },
+    { 159, 231, 40133 },
+    { 107, 247, 40135 },
+    { 115, 122, 40135 },
+    { 116, 199, 40138 },
+    { 47, 248, 40142 },
+    { 4, 55, 40145 },
+    { 98, 140, 40145 },
+    { 124, 193, 40145 },
+    { 34, 250, 40146 },
+    { 37, 85, 40150 },
+    { 4, 77, 40151 },
+    { 54, 172, 40151 },
+    { 50, 97, 40152 },
+    { 71, 208, 40156 },
+    { 14, 249, 40157 },
+    { 112, 121, 40157 },
+    { 113, 237, 40157 },
+    { 6, 194, 40161 },
+    { 87, 212, 40161 },
+    { 135, 197, 40163 },
+    { 2, 41, 40166 },
+    { 136, 191, 40167 },
+    { 27, 98, 40168 },
+    { 18, 112, 40172 },
+    { 8, 251, 40175 },
+    { 49, 92, 40177 },
+    { 124, 184, 40177 },
+    { 38, 111, 40180 },
+    { 94, 216, 40180 },
+    { 80, 225, 40182 },
+    { 37, 57, 40184 },
+    { 39, 254, 40184 },
+    { 22, 227, 40185 },
+    { 79, 131, 40186 },
+    { 62, 124, 40187 },
+    { 20, 189, 40190 },
+    { 28, 107, 40191 },
+    { 97, 137, 40193 },
+    { 131, 199, 40195 },
+    { 85, 114, 40196 },
+    { 108, 218, 40198 },
+    { 115, 209, 40198 },
+    { 115, 143, 40200 },
+    { 194, 197, 40200 },
+    { 63, 121, 40201 },
+    { 173, 243, 40202 },
+    { 157, 215, 40205 },
+    { 175, 243, 40205 },
+    { 233, 244, 40209 },
+    { 10, 38, 40215 },
+    { 31, 105, 40216 },
+    { 99, 215, 40216 },
+    { 21, 243, 40218 },
+    { 100, 228, 40218 },
+    { 157, 219, 40219 },
+    { 110, 183, 40220 },
+    { 167, 230, 40229 },
+    { 22, 47, 40230 },
+    { 65, 103, 40231 },
+    { 151, 152, 40235 },
+    { 18, 243, 40236 },
+    { 51, 107, 40240 },
+    { 79, 170, 40240 },
+    { 157, 204, 40244 },
+    { 11, 222, 40247 },
+    { 14, 69, 40247 },
+    { 33, 61, 40248 },
+    { 33, 90, 40248 },
+    { 45, 99, 40249 },
+    { 99, 115, 40253 },
+    { 111, 176, 40254 },
+    { 174, 249, 40254 },
+    { 11, 151, 40259 },
+    { 123, 128, 40264 },
+    { 162, 220, 40266 },
+    { 111, 187, 40267 },
+    { 187, 217, 40267 },
+    { 137, 214, 40272 },
+    { 144, 210, 40273 },
+    { 218, 250, 40273 },
+    { 40, 106, 40274 },
+    { 70, 134, 40276 },
+    { 83, 172, 40276 },
+    { 24, 209, 40279 },
+    { 150, 255, 40280 },
+    { 4, 74, 40281 },
+    { 35, 255, 40282 },
+    { 99, 137, 40282 },
+    { 30, 237, 40284 },
+    { 90, 150, 40288 },
+    { 4, 127, 40289 },
+    { 113, 124, 40291 },
+    { 77, 155, 40294 },
+    { 83, 185, 40294 },
+    { 53, 93, 40295 },
+    { 161, 231, 40298 },
+    { 0, 61, 40302 },
+    { 16, 134, 40302 },
+    { 119, 227, 40302 },
+    { 76, 160, 40303 },
+    { 96, 138, 40305 },
+    { 40, 104, 40313 },
+    { 101, 148, 40313 },
+    { 113, 227, 40313 },
+    { 10, 82, 40319 },
+    { 135, 198, 40320 },
+    { 239, 251, 40321 },
+    { 108, 191, 40323 },
+    { 43, 77, 40324 },
+    { 108, 244, 40324 },
+    { 116, 173, 40324 },
+    { 151, 161, 40324 },
+    { 31, 98, 40325 },
+    { 35, 106, 40325 },
+    { 141, 179, 40325 },
+    { 1, 243, 40326 },
+    { 209, 223, 40329 },
+    { 57, 121, 40331 },
+    { 120, 249, 40331 },
+    { 10, 100, 40333 },
+    { 128, 184, 40333 },
+    { 64, 165, 40334 },
+    { 186, 245, 40334 },
+    { 80, 151, 40335 },
+    { 105, 221, 40335 },
+    { 14, 78, 40342 },
+    { 87, 182, 40348 },
+    { 72, 148, 40354 },
+    { 67, 160, 40356 },
+    { 2, 209, 40357 },
+    { 159, 227, 40358 },
+    { 219, 253, 40360 },
+    { 182, 252, 40366 },
+    { 0, 246, 40369 },
+    { 57, 59, 40370 },
+    { 130, 249, 40372 },
+    { 30, 73, 40373 },
+    { 73, 172, 40375 },
+    { 130, 188, 40375 },
+    { 187, 245, 40375 },
+    { 38, 252, 40376 },
+    { 13, 31, 40377 },
+    { 28, 225, 40377 },
+    { 199, 219, 40380 },
+    { 77, 149, 40383 },
+    { 151, 170, 40383 },
+    { 132, 171, 40384 },
+    { 2, 38, 40385 },
+    { 33, 161, 40387 },
+    { 68, 144, 40387 },
+    { 126, 203, 40387 },
+    { 5, 41, 40389 },
+    { 30, 168, 40394 },
+    { 36, 140, 40396 },
+    { 47, 127, 40397 },
+    { 25, 91, 40399 },
+    { 126, 194, 40406 },
+    { 3, 40, 40407 },
+    { 4, 230, 40408 },
+    { 30, 228, 40408 },
+    { 18, 81, 40409 },
+    { 4, 18, 40411 },
+    { 94, 219, 40414 },
+    { 34, 106, 40421 },
+    { 114, 193, 40421 },
+    { 13, 51, 40422 },
+    { 160, 231, 40422 },
+    { 37, 136, 40423 },
+    { 93, 173, 40423 },
+    { 141, 223, 40425 },
+    { 71, 186, 40426 },
+    { 150, 236, 40426 },
+    { 137, 225, 40427 },
+    { 101, 120, 40430 },
+    { 187, 251, 40430 },
+    { 70, 255, 40433 },
+    { 99, 101, 40434 },
+    { 48, 105, 40436 },
+    { 60, 67, 40436 },
+    { 130, 157, 40439 },
+    { 90, 125, 40441 },
+    { 32, 70, 40442 },
+    { 89, 208, 40443 },
+    { 55, 104, 40445 },
+    { 98, 144, 40445 },
+    { 169, 201, 40445 },
+    { 133, 150, 40447 },
+    { 174, 243, 40447 },
+    { 169, 232, 40449 },
+    { 144, 173, 40451 },
+    { 142, 219, 40452 },
+    { 189, 194, 40453 },
+    { 6, 48, 40454 },
+    { 17, 92, 40454 },
+    { 7, 58, 40456 },
+    { 56, 107, 40467 },
+    { 173, 199, 40467 },
+    { 193, 253, 40468 },
+    { 12, 17, 40469 },
+    { 134, 183, 40470 },
+    { 17, 62, 40471 },
+    { 8, 136, 40482 },
+    { 44, 111, 40483 },
+    { 61, 240, 40483 },
+    { 53, 158, 40485 },
+    { 120, 210, 40489 },
+    { 33, 64, 40491 },
+    { 199, 218, 40492 },
+    { 116, 195, 40493 },
+    { 163, 228, 40497 },
+    { 103, 162, 40501 },
+    { 4, 28, 40503 },
+    { 63, 100, 40503 },
+    { 201, 242, 40505 },
+    { 74, 146, 40513 },
+    { 7, 226, 40515 },
+    { 98, 162, 40517 },
+    { 113, 188, 40517 },
+    { 167, 229, 40517 },
+    { 33, 204, 40518 },
+    { 61, 140, 40520 },
+    { 67, 106, 40525 },
+    { 135, 211, 40525 },
+    { 236, 252, 40525 },
+    { 69, 128, 40528 },
+    { 149, 246, 40529 },
+    { 220, 244, 40529 },
+    { 39, 236, 40532 },
+    { 157, 212, 40533 },
+    { 111, 186, 40535 },
+    { 52, 110, 40537 },
+    { 59, 250, 40537 },
+    { 8, 44, 40544 },
+    { 61, 165, 40544 },
+    { 36, 190, 40546 },
+    { 71, 212, 40551 },
+    { 63, 115, 40553 },
+    { 162, 217, 40554 },
+    { 94, 142, 40565 },
+    { 6, 31, 40566 },
+    { 13, 42, 40567 },
+    { 14, 244, 40574 },
+    { 98, 164, 40575 },
+    { 43, 254, 40577 },
+    { 105, 106, 40588 },
+    { 6, 243, 40589 },
+    { 121, 213, 40590 },
+    { 154, 203, 40590 },
+    { 153, 203, 40592 },
+    { 23, 134, 40595 },
+    { 105, 244, 40595 },
+    { 111, 177, 40596 },
+    { 177, 243, 40599 },
+    { 63, 107, 40601 },
+    { 217, 251, 40601 },
+    { 33, 91, 40606 },
+    { 6, 226, 40608 },
+    { 19, 188, 40608 },
+    { 23, 54, 40608 },
+    { 163, 165, 40610 },
+    { 90, 133, 40615 },
+    { 23, 114, 40617 },
+    { 174, 241, 40617 },
+    { 69, 118, 40622 },
+    { 75, 185, 40622 },
+    { 110, 213, 40622 },
+    { 194, 198, 40624 },
+    { 4, 226, 40625 },
+    { 11, 136, 40628 },
+    { 170, 195, 40630 },
+    { 22, 245, 40631 },
+    { 19, 230, 40632 },
+    { 150, 230, 40634 },
+    { 40, 108, 40640 },
+    { 235, 237, 40642 },
+    { 42, 100, 40643 },
+    { 20, 24, 40646 },
+    { 87, 244, 40647 },
+    { 28, 158, 40649 },
+    { 158, 226, 40649 },
+    { 192, 242, 40649 },
+    { 154, 193, 40653 },
+    { 24, 101, 40654 },
+    { 123, 138, 40656 },
+    { 153, 193, 40656 },
+    { 108, 183, 40657 },
+    { 114, 188, 40658 },
+    { 39, 116, 40659 },
+    { 82, 151, 40659 },
+    { 117, 224, 40661 },
+    { 10, 168, 40663 },
+    { 78, 109, 40663 },
+    { 115, 161, 40663 },
+    { 81, 117, 40666 },
+    { 86, 192, 40667 },
+    { 5, 66, 40668 },
+    { 29, 190, 40669 },
+    { 171, 239, 40671 },
+    { 103, 179, 40673 },
+    { 168, 231, 40673 },
+    { 46, 72, 40678 },
+    { 9, 187, 40679 },
+    { 62, 128, 40681 },
+    { 75, 107, 40683 },
+    { 111, 169, 40683 },
+    { 78, 128, 40687 },
+    { 8, 52, 40688 },
+    { 137, 172, 40690 },
+    { 33, 192, 40691 },
+    { 57, 101, 40691 },
+    { 2, 52, 40695 },
+    { 26, 106, 40696 },
+    { 13, 229, 40698 },
+    { 67, 138, 40698 },
+    { 76, 161, 40698 },
+    { 111, 198, 40699 },
+    { 182, 199, 40699 },
+    { 52, 108, 40700 },
+    { 175, 179, 40702 },
+    { 193, 234, 40703 },
+    { 46, 253, 40704 },
+    { 194, 254, 40704 },
+    { 15, 139, 40706 },
+    { 64, 240, 40711 },
+    { 179, 254, 40713 },
+    { 27, 232, 40714 },
+    { 173, 241, 40718 },
+    { 190, 191, 40720 },
+    { 30, 106, 40721 },
+    { 118, 182, 40722 },
+    { 226, 255, 40726 },
+    { 20, 30, 40727 },
+    { 89, 182, 40729 },
+    { 115, 225, 40733 },
+    { 148, 248, 40737 },
+    { 3, 51, 40741 },
+    { 82, 121, 40742 },
+    { 45, 112, 40747 },
+    { 209, 213, 40747 },
+    { 7, 218, 40750 },
+    { 19, 78, 40753 },
+    { 21, 84, 40753 },
+    { 102, 218, 40754 },
+    { 150, 201, 40754 },
+    { 83, 152, 40760 },
+    { 94, 163, 40766 },
+    { 131, 211, 40770 },
+    { 17, 81, 40772 },
+    { 37, 116, 40773 },
+    { 24, 251, 40777 },
+    { 18, 227, 40778 },
+    { 93, 204, 40780 },
+    { 106, 108, 40781 },
+    { 82, 190, 40782 },
+    { 103, 152, 40782 },
+    { 24, 140, 40785 },
+    { 92, 195, 40787 },
+    { 41, 92, 40798 },
+    { 97, 163, 40798 },
+    { 215, 228, 40798 },
+    { 67, 161, 40802 },
+    { 108, 223, 40802 },
+    { 0, 44, 40805 },
+    { 213, 236, 40805 },
+    { 87, 178, 40810 },
+    { 14, 62, 40811 },
+    { 54, 252, 40811 },
+    { 111, 197, 40812 },
+    { 135, 214, 40813 },
+    { 47, 133, 40814 },
+    { 73, 92, 40814 },
+    { 112, 188, 40814 },
+    { 8, 40, 40817 },
+    { 150, 219, 40820 },
+    { 79, 141, 40822 },
+    { 170, 243, 40822 },
+    { 43, 199, 40828 },
+    { 182, 209, 40830 },
+    { 50, 115, 40831 },
+    { 151, 160, 40831 },
+    { 57, 146, 40836 },
+    { 87, 180, 40841 },
+    { 20, 120, 40842 },
+    { 221, 253, 40842 },
+    { 6, 44, 40845 },
+    { 100, 181, 40845 },
+    { 46, 225, 40848 },
+    { 92, 184, 40850 },
+    { 44, 108, 40851 },
+    { 106, 127, 40852 },
+    { 82, 179, 40853 },
+    { 32, 221, 40854 },
+    { 46, 140, 40856 },
+    { 38, 103, 40858 },
+    { 78, 135, 40858 },
+    { 70, 110, 40860 },
+    { 166, 195, 40861 },
+    { 89, 115, 40862 },
+    { 8, 231, 40864 },
+    { 115, 194, 40865 },
+    { 100, 217, 40871 },
+    { 25, 217, 40872 },
+    { 49, 120, 40872 },
+    { 102, 216, 40875 },
+    { 91, 151, 40876 },
+    { 128, 203, 40877 },
+    { 136, 180, 40877 },
+    { 175, 249, 40879 },
+    { 144, 229, 40882 },
+    { 24, 90, 40883 },
+    { 9, 120, 40884 },
+    { 143, 157, 40886 },
+    { 115, 255, 40887 },
+    { 79, 96, 40888 },
+    { 24, 199, 40890 },
+    { 27, 35, 40890 },
+    { 138, 195, 40890 },
+    { 44, 104, 40891 },
+    { 69, 126, 40891 },
+    { 42, 111, 40892 },
+    { 213, 254, 40892 },
+    { 122, 150, 40895 },
+    { 66, 99, 40903 },
+    { 173, 209, 40904 },
+    { 11, 42, 40905 },
+    { 105, 216, 40906 },
+    { 110, 177, 40907 },
+    { 28, 251, 40908 },
+    { 114, 148, 40908 },
+    { 88, 111, 40911 },
+    { 123, 206, 40913 },
+    { 91, 148, 40914 },
+    { 6, 40, 40916 },
+    { 106, 255, 40917 },
+    { 143, 193, 40925 },
+    { 1, 58, 40926 },
+    { 175, 228, 40927 },
+    { 210, 239, 40928 },
+    { 134, 238, 40929 },
+    { 162, 246, 40929 },
+    { 124, 215, 40933 },
+    { 73, 248, 40934 },
+    { 110, 191, 40934 },
+    { 115, 160, 40935 },
+    { 45, 113, 40939 },
+    { 57, 234, 40939 },
+    { 115, 175, 40939 },
+    { 108, 219, 40941 },
+    { 89, 174, 40943 },
+    { 100, 121, 40944 },
+    { 21, 246, 40945 },
+    { 77, 107, 40945 },
+    { 11, 251, 40953 },
+    { 168, 174, 40958 },
+    { 110, 176, 40963 },
+    { 3, 210, 40965 },
+    { 7, 53, 40966 },
+    { 95, 163, 40967 },
+    { 209, 211, 40969 },
+    { 16, 81, 40971 },
+    { 137, 205, 40971 },
+    { 105, 218, 40973 },
+    { 82, 126, 40974 },
+    { 128, 218, 40975 },
+    { 52, 104, 40979 },
+    { 94, 135, 40979 },
+    { 67, 167, 40982 },
+    { 89, 178, 40986 },
+    { 10, 49, 40988 },
+    { 181, 250, 40988 },
+    { 95, 211, 40991 },
+    { 145, 255, 40991 },
+    { 11, 51, 40995 },
+    { 27, 45, 40997 },
+    { 71, 162, 40998 },
+    { 185, 203, 40999 },
+    { 131, 190, 41004 },
+    { 103, 104, 41005 },
+    { 208, 237, 41009 },
+    { 156, 243, 41012 },
+    { 115, 174, 41016 },
+    { 50, 111, 41019 },
+    { 79, 115, 41019 },
+    { 1, 136, 41023 },
+    { 15, 149, 41024 },
+    { 55, 109, 41024 },
+    { 44, 110, 41028 },
+    { 76, 131, 41028 },
+    { 104, 183, 41030 },
+    { 186, 251, 41032 },
+    { 5, 249, 41038 },
+    { 41, 129, 41038 },
+    { 47, 106, 41038 },
+    { 129, 171, 41039 },
+    { 76, 118, 41044 },
+    { 87, 174, 41047 },
+    { 145, 226, 41048 },
+    { 31, 108, 41049 },
+    { 106, 122, 41049 },
+    { 191, 251, 41052 },
+    { 39, 136, 41053 },
+    { 23, 168, 41054 },
+    { 140, 148, 41058 },
+    { 4, 34, 41059 },
+    { 75, 138, 41060 },
+    { 17, 158, 41061 },
+    { 19, 58, 41064 },
+    { 43, 57, 41066 },
+    { 43, 209, 41067 },
+    { 50, 95, 41068 },
+    { 112, 128, 41075 },
+    { 188, 250, 41077 },
+    { 212, 233, 41078 },
+    { 87, 135, 41079 },
+    { 22, 90, 41083 },
+    { 38, 127, 41087 },
+    { 62, 172, 41091 },
+    { 102, 116, 41092 },
+    { 38, 120, 41093 },
+    { 201, 227, 41096 },
+    { 0, 48, 41104 },
+    { 86, 246, 41104 },
+    { 157, 238, 41105 },
+    { 9, 50, 41109 },
+    { 102, 223, 41111 },
+    { 4, 69, 41112 },
+    { 12, 242, 41112 },
+    { 23, 209, 41114 },
+    { 54, 101, 41114 },
+    { 183, 245, 41116 },
+    { 6, 52, 41117 },
+    { 89, 180, 41117 },
+    { 0, 64, 41124 },
+    { 184, 201, 41124 },
+    { 94, 103, 41125 },
+    { 141, 199, 41125 },
+    { 235, 253, 41126 },
+    { 6, 151, 41128 },
+    { 29, 238, 41128 },
+    { 32, 121, 41128 },
+    { 38, 101, 41131 },
+    { 85, 160, 41131 },
+    { 140, 175, 41133 },
+    { 186, 242, 41135 },
+    { 85, 142, 41136 },
+    { 46, 65, 41137 },
+    { 60, 84, 41140 },
+    { 9, 85, 41147 },
+    { 147, 252, 41147 },
+    { 148, 226, 41153 },
+    { 21, 244, 41154 },
+    { 177, 244, 41155 },
+    { 27, 124, 41158 },
+    { 66, 95, 41161 },
+    { 116, 167, 41165 },
+    { 172, 251, 41168 },
+    { 36, 115, 41169 },
+    { 9, 10, 41172 },
+    { 64, 136, 41173 },
+    { 74, 100, 41173 },
+    { 18, 199, 41174 },
+    { 144, 178, 41174 },
+    { 78, 137, 41177 },
+    { 76, 189, 41181 },
+    { 208, 238, 41182 },
+    { 31, 253, 41185 },
+    { 206, 252, 41185 },
+    { 16, 140, 41186 },
+    { 115, 155, 41187 },
+    { 135, 185, 41190 },
+    { 14, 15, 41191 },
+    { 172, 241, 41191 },
+    { 47, 249, 41194 },
+    { 189, 245, 41195 },
+    { 50, 116, 41197 },
+    { 23, 90, 41202 },
+    { 150, 224, 41203 },
+    { 100, 236, 41204 },
+    { 0, 42, 41208 },
+    { 99, 211, 41212 },
+    { 176, 243, 41212 },
+    { 16, 107, 41215 },
+    { 19, 35, 41216 },
+    { 177, 242, 41217 },
+    { 106, 162, 41219 },
+    { 165, 242, 41220 },
+    { 48, 110, 41221 },
+    { 7, 247, 41222 },
+    { 105, 191, 41225 },
+    { 13, 230, 41229 },
+    { 124, 213, 41230 },
+    { 73, 118, 41231 },
+    { 50, 99, 41232 },
+    { 62, 146, 41233 },
+    { 75, 172, 41233 },
+    { 115, 133, 41233 },
+    { 141, 224, 41235 },
+    { 12, 34, 41243 },
+    { 2, 51, 41246 },
+    { 26, 242, 41246 },
+    { 8, 31, 41247 },
+    { 235, 250, 41248 },
+    { 4, 186, 41253 },
+    { 77, 152, 41256 },
+    { 41, 248, 41258 },
+    { 137, 204, 41260 },
+    { 21, 88, 41261 },
+    { 23, 62, 41266 },
+    { 0, 195, 41267 },
+    { 29, 85, 41275 },
+    { 59, 199, 41275 },
+    { 8, 55, 41280 },
+    { 126, 216, 41289 },
+    { 92, 121, 41291 },
+    { 15, 58, 41292 },
+    { 216, 250, 41294 },
+    { 116, 170, 41295 },
+    { 76, 167, 41297 },
+    { 113, 203, 41298 },
+    { 87, 116, 41299 },
+    { 31, 109, 41300 },
+    { 101, 130, 41301 },
+    { 93, 186, 41304 },
+    { 137, 208, 41304 },
+    { 2, 190, 41306 },
+    { 184, 245, 41308 },
+    { 7, 46, 41310 },
+    { 83, 148, 41311 },
+    { 54, 234, 41318 },
+    { 53, 134, 41321 },
+    { 108, 115, 41321 },
+    { 171, 240, 41322 },
+    { 66, 158, 41323 },
+    { 31, 244, 41325 },
+    { 65, 82, 41327 },
+    { 105, 115, 41328 },
+    { 139, 194, 41328 },
+    { 150, 189, 41328 },
+    { 209, 221, 41328 },
+    { 210, 253, 41332 },
+    { 2, 55, 41342 },
+    { 48, 108, 41343 },
+    { 38, 133, 41347 },
+    { 118, 154, 41347 },
+    { 34, 71, 41348 },
+    { 118, 153, 41348 },
+    { 23, 101, 41352 },
+    { 40, 110, 41356 },
+    { 199, 223, 41357 },
+    { 110, 150, 41360 },
+    { 49, 127, 41362 },
+    { 12, 50, 41363 },
+    { 40, 109, 41363 },
+    { 24, 54, 41364 },
+    { 106, 146, 41364 },
+    { 143, 203, 41364 },
+    { 57, 252, 41372 },
+    { 63, 88, 41376 },
+    { 142, 221, 41376 },
+    { 2, 224, 41381 },
+    { 78, 140, 41381 },
+    { 79, 118, 41393 },
+    { 99, 196, 41399 },
+    { 45, 114, 41400 },
+    { 103, 171, 41402 },
+    { 102, 219, 41403 },
+    { 7, 13, 41406 },
+    { 142, 220, 41406 },
+    { 97, 215, 41408 },
+    { 114, 176, 41410 },
+    { 85, 161, 41411 },
+    { 65, 192, 41413 },
+    { 53, 247, 41414 },
+    { 7, 185, 41418 },
+    { 10, 222, 41419 },
+    { 4, 229, 41421 },
+    { 151, 187, 41425 },
+    { 218, 253, 41425 },
+    { 137, 189, 41429 },
+    { 180, 252, 41429 },
+    { 199, 213, 41436 },
+    { 139, 184, 41437 },
+    { 157, 231, 41443 },
+    { 145, 239, 41444 },
+    { 12, 58, 41445 },
+    { 204, 217, 41445 },
+    { 145, 212, 41453 },
+    { 87, 106, 41454 },
+    { 13, 222, 41455 },
+    { 107, 194, 41455 },
+    { 102, 118, 41457 },
+    { 15, 50, 41458 },
+    { 115, 188, 41458 },
+    { 227, 246, 41458 },
+    { 95, 196, 41461 },
+    { 59, 236, 41463 },
+    { 65, 148, 41463 },
+    { 4, 143, 41465 },
+    { 145, 215, 41466 },
+    { 167, 243, 41470 },
+    { 9, 18, 41471 },
+    { 87, 215, 41482 },
+    { 32, 186, 41483 },
+    { 72, 252, 41483 },
+    { 111, 192, 41485 },
+    { 33, 170, 41486 },
+    { 64, 89, 41487 },
+    { 215, 254, 41487 },
+    { 11, 78, 41488 },
+    { 38, 246, 41490 },
+    { 220, 235, 41498 },
+    { 16, 243, 41500 },
+    { 0, 168, 41501 },
+    { 164, 226, 41502 },
+    { 237, 246, 41503 },
+    { 195, 243, 41504 },
+    { 96, 239, 41510 },
+    { 183, 225, 41515 },
+    { 11, 194, 41516 },
+    { 120, 224, 41517 },
+    { 45, 255, 41518 },
+    { 140, 162, 41518 },
+    { 62, 249, 41519 },
+    { 142, 222, 41519 },
+    { 60, 79, 41521 },
+    { 98, 167, 41527 },
+    { 188, 255, 41528 },
+    { 5, 38, 41529 },
+    { 95, 244, 41529 },
+    { 33, 166, 41530 },
+    { 38, 96, 41533 },
+    { 66, 140, 41535 },
+    { 116, 147, 41535 },
+    { 105, 223, 41536 },
+    { 83, 114, 41538 },
+    { 206, 249, 41539 },
+    { 148, 222, 41541 },
+    { 199, 211, 41543 },
+    { 72, 80, 41546 },
+    { 63, 124, 41548 },
+    { 187, 242, 41551 },
+    { 14, 33, 41552 },
+    { 109, 177, 41554 },
+    { 124, 210, 41557 },
+    { 19, 45, 41558 },
+    { 27, 174, 41558 },
+    { 22, 63, 41560 },
+    { 105, 183, 41564 },
+    { 21, 241, 41567 },
+    { 73, 138, 41569 },
+    { 96, 209, 41570 },
+    { 79, 246, 41571 },
+    { 4, 45, 41572 },
+    { 10, 47, 41575 },
+    { 84, 234, 41575 },
+    { 90, 151, 41575 },
+    { 48, 104, 41576 },
+    { 62, 139, 41581 },
+    { 164, 231, 41581 },
+    { 76, 148, 41585 },
+    { 43, 228, 41589 },
+    { 121, 193, 41590 },
+    { 72, 244, 41591 },
+    { 13, 194, 41593 },
+    { 52, 109, 41600 },
+    { 98, 166, 41600 },
+    { 137, 164, 41606 },
+    { 182, 245, 41611 },
+    { 176, 242, 41613 },
+    { 231, 255, 41617 },
+    { 89, 212, 41619 },
+    { 183, 249, 41620 },
+    { 92, 141, 41621 },
+    { 80, 239, 41624 },
+    { 18, 69, 41625 },
+    { 137, 207, 41626 },
+    { 110, 246, 41629 },
+    { 136, 222, 41629 },
+    { 95, 101, 41631 },
+    { 41, 249, 41632 },
+    { 165, 254, 41632 },
+    { 145, 233, 41636 },
+    { 41, 132, 41637 },
+    { 78, 104, 41642 },
+    { 115, 173, 41644 },
+    { 86, 96, 41645 },
+    { 158, 214, 41646 },
+    { 33, 149, 41648 },
+    { 125, 145, 41654 },
+    { 45, 111, 41657 },
+    { 188, 244, 41657 },
+    { 18, 96, 41660 },
+    { 118, 132, 41663 },
+    { 162, 227, 41665 },
+    { 95, 115, 41667 },
+    { 128, 194, 41674 },
+    { 104, 224, 41675 },
+    { 157, 223, 41675 },
+    { 33, 243, 41679 },
+    { 79, 201, 41680 },
+    { 145, 201, 41681 },
+    { 44, 109, 41683 },
+    { 49, 248, 41685 },
+    { 75, 131, 41686 },
+    { 165, 183, 41688 },
+    { 225, 232, 41691 },
+    { 95, 137, 41696 },
+    { 66, 136, 41699 },
+    { 47, 92, 41701 },
+    { 60, 253, 41702 },
+    { 105, 219, 41702 },
+    { 152, 222, 41702 },
+    { 1, 181, 41703 },
+    { 119, 237, 41704 },
+    { 193, 244, 41705 },
+    { 146, 232, 41706 },
+    { 155, 184, 41712 },
+    { 4, 93, 41714 },
+    { 137, 220, 41717 },
+    { 9, 250, 41721 },
+    { 54, 121, 41724 },
+    { 82, 145, 41724 },
+    { 87, 142, 41725 },
+    { 6, 55, 41734 },
+    { 25, 106, 41736 },
+    { 80, 124, 41737 },
+    { 140, 214, 41742 },
+    { 143, 181, 41742 },
+    { 126, 168, 41745 },
+    { 35, 97, 41747 },
+    { 9, 58, 41751 },
+    { 1, 70, 41752 },
+    { 32, 223, 41753 },
+    { 182, 242, 41754 },
+    { 81, 140, 41757 },
+    { 118, 203, 41758 },
+    { 93, 174, 41765 },
+    { 0, 58, 41767 },
+    { 33, 207, 41769 },
+    { 71, 103, 41770 },
+    { 222, 248, 41770 },
+    { 23, 199, 41772 },
+    { 16, 20, 41773 },
+    { 185, 193, 41773 },
+    { 71, 215, 41775 },
+    { 211, 236, 41775 },
+    { 1, 203, 41779 },
+    { 41, 106, 41780 },
+    { 161, 230, 41780 },
+    { 59, 209, 41781 },
+    { 3, 231, 41782 },
+    { 76, 198, 41782 },
+    { 0, 52, 41783 },
+    { 164, 251, 41783 },
+    { 116, 188, 41784 },
+    { 109, 176, 41790 },
+    { 142, 223, 41790 },
+    { 25, 245, 41793 },
+    { 77, 248, 41793 },
+    { 9, 155, 41796 },
+    { 41, 125, 41796 },
+    { 136, 152, 41798 },
+    { 149, 226, 41799 },
+    { 58, 255, 41806 },
+    { 61, 89, 41807 },
+    { 86, 204, 41808 },
+    { 171, 235, 41809 },
+    { 117, 171, 41811 },
+    { 19, 90, 41815 },
+    { 196, 236, 41818 },
+    { 158, 163, 41820 },
+    { 13, 81, 41822 },
+    { 115, 117, 41827 },
+    { 35, 253, 41834 },
+    { 86, 142, 41835 },
+    { 37, 199, 41840 },
+    { 206, 248, 41842 },
+    { 29, 76, 41845 },
+    { 110, 249, 41846 },
+    { 137, 211, 41846 },
+    { 49, 133, 41848 },
+    { 7, 236, 41850 },
+    { 24, 91, 41850 },
+    { 124, 206, 41852 },
+    { 176, 244, 41852 },
+    { 20, 201, 41859 },
+    { 82, 89, 41859 },
+    { 121, 210, 41862 },
+    { 2, 58, 41868 },
+    { 32, 66, 41868 },
+    { 16, 252, 41870 },
+    { 32, 128, 41874 },
+    { 95, 213, 41875 },
+    { 116, 194, 41879 },
+    { 24, 62, 41880 },
+    { 23, 140, 41881 },
+    { 9, 167, 41882 },
+    { 72, 192, 41882 },
+    { 8, 226, 41883 },
+    { 23, 74, 41883 },
+    { 151, 167, 41889 },
+    { 65, 204, 41890 },
+    { 88, 142, 41890 },
+    { 91, 143, 41890 },
+    { 18, 217, 41898 },
+    { 7, 215, 41901 },
+    { 61, 136, 41903 },
+    { 62, 126, 41905 },
+    { 144, 230, 41906 },
+    { 28, 236, 41910 },
+    { 5, 168, 41912 },
+    { 81, 122, 41912 },
+    { 145, 218, 41912 },
+    { 22, 91, 41913 },
+    { 91, 149, 41914 },
+    { 39, 76, 41917 },
+    { 58, 119, 41919 },
+    { 154, 226, 41919 },
+    { 153, 226, 41921 },
+    { 115, 166, 41922 },
+    { 20, 68, 41923 },
+    { 145, 189, 41924 },
+    { 23, 57, 41925 },
+    { 17, 165, 41931 },
+    { 153, 243, 41931 },
+    { 154, 243, 41931 },
+    { 158, 254, 41933 },
+    { 157, 221, 41935 },
+    { 145, 156, 41938 },
+    { 144, 180, 41941 },
+    { 190, 245, 41942 },
+    { 59, 76, 41948 },
+    { 29, 67, 41949 },
+    { 72, 101, 41950 },
+    { 147, 193, 41952 },
+    { 34, 239, 41955 },
+    { 162, 199, 41956 },
+    { 86, 187, 41957 },
+    { 117, 210, 41957 },
+    { 90, 148, 41971 },
+    { 193, 254, 41972 },
+    { 112, 163, 41973 },
+    { 68, 89, 41974 },
+    { 21, 240, 41975 },
+    { 28, 165, 41975 },
+    { 37, 209, 41978 },
+    { 143, 169, 41980 },
+    { 91, 158, 41981 },
+    { 37, 228, 41982 },
+    { 142, 224, 41984 },
+    { 41, 122, 41986 },
+    { 203, 251, 41989 },
+    { 58, 102, 41995 },
+    { 160, 230, 41996 },
+    { 17, 100, 41998 },
+    { 74, 185, 41998 },
+    { 161, 229, 41998 },
 };
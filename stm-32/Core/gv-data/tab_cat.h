@@ -1,7 +1,18 @@
 #ifndef TAB_CAT_H
 #define TAB_CAT_H
 
+#include "catalog_luts.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// every catalog pair within the binned range, sorted by angle
 #define N_PAIRS 14999
-extern const double tab_cat[N_PAIRS][3];
+extern const catalog_pair_t tab_cat[N_PAIRS];
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif
@@ -9,6 +9,11 @@ C_SRCS += \
 ../Core/Src/delay.c \
 ../Core/Src/eeprom.c \
 ../Core/Src/gvalg.c \
+../Core/Src/gvatt.c \
+../Core/Src/gvhash.c \
+../Core/Src/gvpairs.c \
+../Core/Src/gvtrack.c \
+../Core/Src/gvtri.c \
 ../Core/Src/main.c \
 ../Core/Src/stm32l4xx_hal_msp.c \
 ../Core/Src/stm32l4xx_it.c \
@@ -22,6 +27,11 @@ C_DEPS += \
 ./Core/Src/delay.d \
 ./Core/Src/eeprom.d \
 ./Core/Src/gvalg.d \
+./Core/Src/gvatt.d \
+./Core/Src/gvhash.d \
+./Core/Src/gvpairs.d \
+./Core/Src/gvtrack.d \
+./Core/Src/gvtri.d \
 ./Core/Src/main.d \
 ./Core/Src/stm32l4xx_hal_msp.d \
 ./Core/Src/stm32l4xx_it.d \
@@ -35,6 +45,11 @@ OBJS += \
 ./Core/Src/delay.o \
 ./Core/Src/eeprom.o \
 ./Core/Src/gvalg.o \
+./Core/Src/gvatt.o \
+./Core/Src/gvhash.o \
+./Core/Src/gvpairs.o \
+./Core/Src/gvtrack.o \
+./Core/Src/gvtri.o \
 ./Core/Src/main.o \
 ./Core/Src/stm32l4xx_hal_msp.o \
 ./Core/Src/stm32l4xx_it.o \
@@ -51,7 +66,7 @@ Core/Src/%.o Core/Src/%.su Core/Src/%.cyclo: ../Core/Src/%.c Core/Src/subdir.mk
 clean: clean-Core-2f-Src
 
 clean-Core-2f-Src:
-	-$(RM) ./Core/Src/LPUART.cyclo ./Core/Src/LPUART.d ./Core/Src/LPUART.o ./Core/Src/LPUART.su ./Core/Src/delay.cyclo ./Core/Src/delay.d ./Core/Src/delay.o ./Core/Src/delay.su ./Core/Src/eeprom.cyclo ./Core/Src/eeprom.d ./Core/Src/eeprom.o ./Core/Src/eeprom.su ./Core/Src/gvalg.cyclo ./Core/Src/gvalg.d ./Core/Src/gvalg.o ./Core/Src/gvalg.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/stm32l4xx_hal_msp.cyclo ./Core/Src/stm32l4xx_hal_msp.d ./Core/Src/stm32l4xx_hal_msp.o ./Core/Src/stm32l4xx_hal_msp.su ./Core/Src/stm32l4xx_it.cyclo ./Core/Src/stm32l4xx_it.d ./Core/Src/stm32l4xx_it.o ./Core/Src/stm32l4xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32l4xx.cyclo ./Core/Src/system_stm32l4xx.d ./Core/Src/system_stm32l4xx.o ./Core/Src/system_stm32l4xx.su ./Core/Src/userled.cyclo ./Core/Src/userled.d ./Core/Src/userled.o ./Core/Src/userled.su
+	-$(RM) ./Core/Src/LPUART.cyclo ./Core/Src/LPUART.d ./Core/Src/LPUART.o ./Core/Src/LPUART.su ./Core/Src/delay.cyclo ./Core/Src/delay.d ./Core/Src/delay.o ./Core/Src/delay.su ./Core/Src/eeprom.cyclo ./Core/Src/eeprom.d ./Core/Src/eeprom.o ./Core/Src/eeprom.su ./Core/Src/gvalg.cyclo ./Core/Src/gvalg.d ./Core/Src/gvalg.o ./Core/Src/gvalg.su ./Core/Src/gvatt.cyclo ./Core/Src/gvatt.d ./Core/Src/gvatt.o ./Core/Src/gvatt.su ./Core/Src/gvhash.cyclo ./Core/Src/gvhash.d ./Core/Src/gvhash.o ./Core/Src/gvhash.su ./Core/Src/gvpairs.cyclo ./Core/Src/gvpairs.d ./Core/Src/gvpairs.o ./Core/Src/gvpairs.su ./Core/Src/gvtrack.cyclo ./Core/Src/gvtrack.d ./Core/Src/gvtrack.o ./Core/Src/gvtrack.su ./Core/Src/gvtri.cyclo ./Core/Src/gvtri.d ./Core/Src/gvtri.o ./Core/Src/gvtri.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/stm32l4xx_hal_msp.cyclo ./Core/Src/stm32l4xx_hal_msp.d ./Core/Src/stm32l4xx_hal_msp.o ./Core/Src/stm32l4xx_hal_msp.su ./Core/Src/stm32l4xx_it.cyclo ./Core/Src/stm32l4xx_it.d ./Core/Src/stm32l4xx_it.o ./Core/Src/stm32l4xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32l4xx.cyclo ./Core/Src/system_stm32l4xx.d ./Core/Src/system_stm32l4xx.o ./Core/Src/system_stm32l4xx.su ./Core/Src/userled.cyclo ./Core/Src/userled.d ./Core/Src/userled.o ./Core/Src/userled.su
 
 .PHONY: clean-Core-2f-Src
 
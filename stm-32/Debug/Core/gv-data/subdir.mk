@@ -5,20 +5,35 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+../Core/gv-data/catalog_adjacency.c \
+../Core/gv-data/catalog_angle_matrix.c \
 ../Core/gv-data/catalog_bytestream.c \
+../Core/gv-data/catalog_hash.c \
+../Core/gv-data/catalog_kvector.c \
 ../Core/gv-data/catalog_luts.c \
+../Core/gv-data/catalog_triangles.c \
 ../Core/gv-data/catalog_xyz.c \
 ../Core/gv-data/tab_cat.c 
 
 C_DEPS += \
+./Core/gv-data/catalog_adjacency.d \
+./Core/gv-data/catalog_angle_matrix.d \
 ./Core/gv-data/catalog_bytestream.d \
+./Core/gv-data/catalog_hash.d \
+./Core/gv-data/catalog_kvector.d \
 ./Core/gv-data/catalog_luts.d \
+./Core/gv-data/catalog_triangles.d \
 ./Core/gv-data/catalog_xyz.d \
 ./Core/gv-data/tab_cat.d 
 
 OBJS += \
+./Core/gv-data/catalog_adjacency.o \
+./Core/gv-data/catalog_angle_matrix.o \
 ./Core/gv-data/catalog_bytestream.o \
+./Core/gv-data/catalog_hash.o \
+./Core/gv-data/catalog_kvector.o \
 ./Core/gv-data/catalog_luts.o \
+./Core/gv-data/catalog_triangles.o \
 ./Core/gv-data/catalog_xyz.o \
 ./Core/gv-data/tab_cat.o 
 
@@ -30,7 +45,7 @@ Core/gv-data/%.o Core/gv-data/%.su Core/gv-data/%.cyclo: ../Core/gv-data/%.c Cor
 clean: clean-Core-2f-gv-2d-data
 
 clean-Core-2f-gv-2d-data:
-	-$(RM) ./Core/gv-data/catalog_bytestream.cyclo ./Core/gv-data/catalog_bytestream.d ./Core/gv-data/catalog_bytestream.o ./Core/gv-data/catalog_bytestream.su ./Core/gv-data/catalog_luts.cyclo ./Core/gv-data/catalog_luts.d ./Core/gv-data/catalog_luts.o ./Core/gv-data/catalog_luts.su ./Core/gv-data/catalog_xyz.cyclo ./Core/gv-data/catalog_xyz.d ./Core/gv-data/catalog_xyz.o ./Core/gv-data/catalog_xyz.su ./Core/gv-data/tab_cat.cyclo ./Core/gv-data/tab_cat.d ./Core/gv-data/tab_cat.o ./Core/gv-data/tab_cat.su
+	-$(RM) ./Core/gv-data/catalog_adjacency.cyclo ./Core/gv-data/catalog_adjacency.d ./Core/gv-data/catalog_adjacency.o ./Core/gv-data/catalog_adjacency.su ./Core/gv-data/catalog_angle_matrix.cyclo ./Core/gv-data/catalog_angle_matrix.d ./Core/gv-data/catalog_angle_matrix.o ./Core/gv-data/catalog_angle_matrix.su ./Core/gv-data/catalog_bytestream.cyclo ./Core/gv-data/catalog_bytestream.d ./Core/gv-data/catalog_bytestream.o ./Core/gv-data/catalog_bytestream.su ./Core/gv-data/catalog_hash.cyclo ./Core/gv-data/catalog_hash.d ./Core/gv-data/catalog_hash.o ./Core/gv-data/catalog_hash.su ./Core/gv-data/catalog_kvector.cyclo ./Core/gv-data/catalog_kvector.d ./Core/gv-data/catalog_kvector.o ./Core/gv-data/catalog_kvector.su ./Core/gv-data/catalog_luts.cyclo ./Core/gv-data/catalog_luts.d ./Core/gv-data/catalog_luts.o ./Core/gv-data/catalog_luts.su ./Core/gv-data/catalog_triangles.cyclo ./Core/gv-data/catalog_triangles.d ./Core/gv-data/catalog_triangles.o ./Core/gv-data/catalog_triangles.su ./Core/gv-data/catalog_xyz.cyclo ./Core/gv-data/catalog_xyz.d ./Core/gv-data/catalog_xyz.o ./Core/gv-data/catalog_xyz.su ./Core/gv-data/tab_cat.cyclo ./Core/gv-data/tab_cat.d ./Core/gv-data/tab_cat.o ./Core/gv-data/tab_cat.su
 
 .PHONY: clean-Core-2f-gv-2d-data
 